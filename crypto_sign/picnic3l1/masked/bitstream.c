@@ -191,7 +191,40 @@ void masked_mzd_from_bitstream(bitstream_t* bs, masked_mzd_t* v, const size_t wi
   mzd_from_bitstream(bs, &(v->shares[0]), width, size);
 }
 
+/* Loads a 129-bit value (width 3) with three word loads instead of bit-wise extraction. The
+ * value spans at most 17 bytes starting at the current position. */
+static inline uint64_t load_be64(const uint8_t* p) {
+  uint64_t ret = 0;
+  for (unsigned int i = 0; i < 8; ++i) {
+    ret = ret << 8 | p[i];
+  }
+  return ret;
+}
+
+static void mzd_from_bitstream_129(bitstream_t* bs, mzd_local_t* v) {
+  const uint8_t* p         = &bs->buffer.r[bs->position / 8];
+  const unsigned int skip  = bs->position % 8;
+  block_t* block           = BLOCK(v, 0);
+
+  uint64_t hi  = load_be64(p);
+  uint64_t mid = load_be64(p + 8);
+  if (skip) {
+    hi  = hi << skip | p[8] >> (8 - skip);
+    mid = mid << skip | p[16] >> (8 - skip);
+  }
+  block->w64[2] = hi;
+  block->w64[1] = mid;
+  block->w64[0] = (uint64_t)((p[16] >> (7 - skip)) & 1) << 63;
+  bs->position += 129;
+}
+
 void masked_mzd_from_masked_bitstream(masked_bitstream_t* bs, masked_mzd_t* v, const size_t width, const size_t size) {
+  if (width == 3 && size == 129) {
+    for (size_t j = 0; j < MASKING_T; j++) {
+      mzd_from_bitstream_129(&bs->shares[j], &v->shares[j]);
+    }
+    return;
+  }
   mzd_from_bitstream(&bs->shares[0], &v->shares[0], width, size);
   mzd_from_bitstream(&bs->shares[1], &v->shares[1], width, size);
 }
@@ -1,4 +1,8 @@
-/* Configurations used in the paper. */
+/* Configurations used in the paper. A configuration can also be selected on the command line
+ * (e.g. -DCONFIG_DOM_SECURE), which overrides the default below. */
+#if !defined(CONFIG_MASK_NONE) && !defined(CONFIG_SNI_SECURE) && !defined(CONFIG_DOM_SECURE) &&  \
+    !defined(CONFIG_IND_SECURE) && !defined(CONFIG_MASK_SEL) && !defined(CONFIG_SEL_HALF) &&     \
+    !defined(CONFIG_LEAK_TEST)
 //#define CONFIG_MASK_NONE         // No Keccak masking.
 //#define CONFIG_SNI_SECURE        // Refresh AND inputs/output and Keccak result, "All-SNI" in the paper.
 //#define CONFIG_DOM_SECURE        // Randomize ANDs using Domain-Oriented Masking, "All-DOM" in the paper.
@@ -6,6 +10,7 @@
 //#define CONFIG_MASK_SEL          // Selective masking with independent values.
 #define CONFIG_SEL_HALF            // Selective half-masking with independent values.
 //#define CONFIG_LEAK_TEST         // Reduced version for running leakage test.
+#endif
 //#define CONFIG_TEST_VECTORS      // Compatible with known-answer tests.
 
 /* SHA-3 (Keccak) configuration. */
@@ -47,6 +52,12 @@
 #define MASKED_IMPL_DETERMINISTIC // Do not randomize seeds and satisfy test vectors.
 #endif
 
+/* Use the AVX2 implementation of the masked Keccak rounds on x86-64 hosts if the CPU supports it
+ * (checked at run time). Build with -DNO_KECCAK_MPC_AVX2 to always use the reference rounds. */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(NO_KECCAK_MPC_AVX2)
+#define KECCAK_MPC_AVX2
+#endif
+
 /* Other XKCP configuration. */
 #define XKCP_has_Sponge_Keccak
 #define XKCP_has_FIPS202
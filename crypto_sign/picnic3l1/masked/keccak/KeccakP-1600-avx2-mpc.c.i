@@ -0,0 +1,165 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+/*
+Two-share Keccak-p[1600] rounds for x86-64 hosts with AVX2.
+
+One 256-bit register holds both shares of the lanes (x, 2p) and (x, 2p+1):
+share 0 and share 1 of row 2p in the low 128 bits, those of row 2p+1 in
+the high 128 bits. The 25 lanes fit into 15 registers, of which the high
+half of the row pair p = 2 stays zero. Theta, rho (with per-lane shift
+counts), chi and iota process two lanes and both of their shares at once;
+pi moves the 128-bit halves through memory. The masked chi swaps the shares
+of one operand to compute the cross terms and uses the same gadgets, refresh
+points and order of random masks as mpc_chi in KeccakP-1600-ref-mpc.c.i.
+The round constant is only added to share 0.
+
+This file is included by KeccakP-1600-ref-mpc.c.i and relies on its
+definitions of the round constants and rho offsets.
+*/
+
+#include <immintrin.h>
+
+#include "macros.h"
+
+#define nrRowPairs 3
+#define pairIndex(x, p) (((x)%5)+5*(p))
+#define KECCAK_MPC_SWAP_SHARES(a) _mm256_shuffle_epi32((a), _MM_SHUFFLE(1, 0, 3, 2))
+
+/* Both shares of lane (x, 2p) in the low and of lane (x, 2p+1) in the high half */
+ATTR_TARGET_AVX2 static inline __m256i keccak_mpc_pair_avx2(tKeccakLane low0, tKeccakLane low1,
+                                                            tKeccakLane high0, tKeccakLane high1)
+{
+    return _mm256_set_epi64x((long long)high1, (long long)high0, (long long)low1, (long long)low0);
+}
+
+ATTR_TARGET_AVX2 static inline __m256i keccak_mpc_rol64_avx2(__m256i a, __m256i left, __m256i right)
+{
+    return _mm256_or_si256(_mm256_sllv_epi64(a, left), _mm256_srlv_epi64(a, right));
+}
+
+ATTR_TARGET_AVX2 static void mpc_chi_avx2(__m256i *A)
+{
+    unsigned int x, p;
+    __m256i C[5];
+
+#ifdef KECCAK_SNI_SECURE
+    uint64_t masks[nrLanes];
+    rand_mask((uint8_t*)masks, sizeof(masks));
+    for(p=0; p<nrRowPairs; p++)
+        for(x=0; x<5; x++) {
+            const tKeccakLane high = (2*p+1 < 5) ? masks[index(x,2*p+1)] : 0;
+            A[pairIndex(x,p)] = _mm256_xor_si256(A[pairIndex(x,p)],
+                keccak_mpc_pair_avx2(masks[index(x,2*p)], masks[index(x,2*p)], high, high));
+        }
+#endif
+
+    for(p=0; p<nrRowPairs; p++) {
+#if defined(KECCAK_DOM_SECURE) || defined(KECCAK_SNI_SECURE)
+        /* the masks of row 2p are drawn before those of row 2p+1, as in mpc_chi */
+        uint64_t row_masks[2][5] = {{0}};
+        rand_mask((uint8_t*)row_masks[0], sizeof(row_masks[0]));
+        if (2*p+1 < 5)
+            rand_mask((uint8_t*)row_masks[1], sizeof(row_masks[1]));
+        for(x=0; x<5; x++) {
+            C[x] = _mm256_and_si256(A[pairIndex(x+1,p)], KECCAK_MPC_SWAP_SHARES(A[pairIndex(x+2,p)]));
+            C[x] = _mm256_xor_si256(C[x], keccak_mpc_pair_avx2(row_masks[0][x], row_masks[0][x],
+                                                               row_masks[1][x], row_masks[1][x]));
+        }
+        for(x=0; x<5; x++)
+            C[x] = _mm256_xor_si256(C[x], _mm256_andnot_si256(A[pairIndex(x+1,p)], A[pairIndex(x+2,p)]));
+        for(x=0; x<5; x++)
+            C[x] = _mm256_xor_si256(C[x], A[pairIndex(x,p)]);
+#else
+        for(x=0; x<5; x++)
+            C[x] = _mm256_xor_si256(A[pairIndex(x,p)], _mm256_andnot_si256(A[pairIndex(x+1,p)], A[pairIndex(x+2,p)]));
+        for(x=0; x<5; x++)
+            C[x] = _mm256_xor_si256(C[x], _mm256_and_si256(A[pairIndex(x+1,p)], KECCAK_MPC_SWAP_SHARES(A[pairIndex(x+2,p)])));
+#endif
+        for(x=0; x<5; x++)
+            A[pairIndex(x,p)] = C[x];
+    }
+}
+
+/*
+Runs rounds first..last-1 on the two-share state (share 0 in lanes 0-24,
+share 1 in lanes 25-49).
+*/
+ATTR_TARGET_AVX2 static void KeccakP1600MPCRounds_avx2(tKeccakLane *state, unsigned int first, unsigned int last)
+{
+    unsigned int i, x, p;
+    __m256i A[5*nrRowPairs], C[5], D[5], rhoLeft[5*nrRowPairs], rhoRight[5*nrRowPairs];
+    __m128i B[5*2*nrRowPairs];
+    const __m256i lowHalf = _mm256_set_epi64x(0, 0, -1, -1);
+    const __m256i sixtyFour = _mm256_set1_epi64x(64);
+
+    for(p=0; p<nrRowPairs; p++)
+        for(x=0; x<5; x++) {
+            const unsigned int high = (2*p+1 < 5) ? KeccakRhoOffsets[index(x,2*p+1)] : 0;
+            const unsigned int low = KeccakRhoOffsets[index(x,2*p)];
+            rhoLeft[pairIndex(x,p)] = _mm256_set_epi64x(high, high, low, low);
+            rhoRight[pairIndex(x,p)] = _mm256_sub_epi64(sixtyFour, rhoLeft[pairIndex(x,p)]);
+            if (2*p+1 < 5)
+                A[pairIndex(x,p)] = keccak_mpc_pair_avx2(state[index(x,2*p)], state[index(x,2*p) + nrLanes],
+                    state[index(x,2*p+1)], state[index(x,2*p+1) + nrLanes]);
+            else
+                A[pairIndex(x,p)] = keccak_mpc_pair_avx2(state[index(x,2*p)], state[index(x,2*p) + nrLanes], 0, 0);
+        }
+
+    for(i=first; i<last; i++) {
+        /* theta, the unused half of the last row pair stays zero */
+        for(x=0; x<5; x++) {
+            C[x] = _mm256_xor_si256(A[pairIndex(x,0)], _mm256_xor_si256(A[pairIndex(x,1)], A[pairIndex(x,2)]));
+            C[x] = _mm256_xor_si256(C[x], _mm256_permute2x128_si256(C[x], C[x], 0x01));
+        }
+        for(x=0; x<5; x++)
+            D[x] = _mm256_xor_si256(_mm256_or_si256(_mm256_slli_epi64(C[(x+1)%5], 1), _mm256_srli_epi64(C[(x+1)%5], 63)),
+                                    C[(x+4)%5]);
+        for(x=0; x<5; x++) {
+            A[pairIndex(x,0)] = _mm256_xor_si256(A[pairIndex(x,0)], D[x]);
+            A[pairIndex(x,1)] = _mm256_xor_si256(A[pairIndex(x,1)], D[x]);
+            A[pairIndex(x,2)] = _mm256_xor_si256(A[pairIndex(x,2)], _mm256_and_si256(D[x], lowHalf));
+        }
+
+        /* rho, then pi through the lanes of B: lane (X, Y) of the result is lane (X+3Y, X) */
+        for(x=0; x<5*nrRowPairs; x++) {
+            const __m256i a = keccak_mpc_rol64_avx2(A[x], rhoLeft[x], rhoRight[x]);
+            B[(x%5)+5*(2*(x/5))] = _mm256_castsi256_si128(a);
+            B[(x%5)+5*(2*(x/5)+1)] = _mm256_extracti128_si256(a, 1);
+        }
+        for(p=0; p<nrRowPairs; p++)
+            for(x=0; x<5; x++) {
+                const unsigned int y = 2*p;
+                const __m128i low = B[index(x+3*y, x)];
+                const __m128i high = (y+1 < 5) ? B[index(x+3*(y+1), x)] : _mm_setzero_si128();
+                A[pairIndex(x,p)] = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+            }
+
+        mpc_chi_avx2(A);
+
+        /* iota, on share 0 only */
+        A[pairIndex(0,0)] = _mm256_xor_si256(A[pairIndex(0,0)], _mm256_set_epi64x(0, 0, 0, (long long)KeccakRoundConstants[i]));
+    }
+
+    for(p=0; p<nrRowPairs; p++)
+        for(x=0; x<5; x++) {
+            uint64_t lanes[4];
+            _mm256_storeu_si256((__m256i*)lanes, A[pairIndex(x,p)]);
+            state[index(x,2*p)] = lanes[0];
+            state[index(x,2*p) + nrLanes] = lanes[1];
+            if (2*p+1 < 5) {
+                state[index(x,2*p+1)] = lanes[2];
+                state[index(x,2*p+1) + nrLanes] = lanes[3];
+            }
+        }
+}
+
+#undef KECCAK_MPC_SWAP_SHARES
+#undef pairIndex
+#undef nrRowPairs
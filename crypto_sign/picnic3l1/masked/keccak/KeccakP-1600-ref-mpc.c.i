@@ -165,6 +165,7 @@ static void rho(tKeccakLane *A);
 static void pi(tKeccakLane *A);
 static void mpc_chi(tKeccakLane *state0, tKeccakLane * state1);
 static void iota(tKeccakLane *A, unsigned int indexRound);
+static void KeccakP1600MPCRounds(tKeccakLane *state, unsigned int first, unsigned int last);
 
 void KeccakP1600MPC_Permute_Nrounds(void *state, unsigned int nrounds)
 {
@@ -242,9 +243,7 @@ void KeccakP1600MPCHalf_Permute_24rounds(void *state)
 #endif
 #if (PLATFORM_BYTE_ORDER == IS_LITTLE_ENDIAN)
 	/* Run first 12 rounds in 2 shares. */
-	for(int i = 0; i < 12; i++) {
-		KeccakP1600MPCRound(state, i);
-	}
+	KeccakP1600MPCRounds(state, 0, 12);
 	/* Combine shares and finish in single state. */
 	for (int i = 0; i < 1600/64; i++) {
 		((tKeccakLane *)state)[i] ^= ((tKeccakLane *)state)[i + 1600/64];
@@ -254,9 +253,7 @@ void KeccakP1600MPCHalf_Permute_24rounds(void *state)
 #else
     fromBytesToWords(stateAsWords, (const unsigned char *)state);
 	/* Run first 12 rounds in 2 shares. */
-	for(int i = 0; i < 12; i++) {
-		KeccakP1600MPCRound(stateAsWords, i);
-	}
+	KeccakP1600MPCRounds(stateAsWords, 0, 12);
 	/* Combine shares and finish in single state. */
 	for (int i = 0; i < 1600/64; i++) {
 		((tKeccakLane *)stateAsWords)[i] ^= ((tKeccakLane *)state)[i + 1600/64];
@@ -296,16 +293,44 @@ static void fromWordsToBytes(unsigned char *state, const tKeccakLane *stateAsWor
 }
 */
 
-void KeccakP1600MPCOnWords(tKeccakLane *state, unsigned int nrRounds)
+#if defined(KECCAK_MPC_AVX2)
+#include "KeccakP-1600-avx2-mpc.c.i"
+
+/* The AVX2 rounds are used if the CPU supports them, checked once. */
+static int KeccakP1600MPC_useAVX2(void)
+{
+    static int supported = -1;
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return supported;
+}
+#endif
+
+/* Runs rounds first..last-1 on the two-share state. */
+static void KeccakP1600MPCRounds(tKeccakLane *state, unsigned int first, unsigned int last)
 {
     unsigned int i;
 
+#if defined(KECCAK_MPC_AVX2) && !defined(KeccakReference)
+    if (KeccakP1600MPC_useAVX2()) {
+        KeccakP1600MPCRounds_avx2(state, first, last);
+        return;
+    }
+#endif
+
+    for(i=first; i<last; i++)
+        KeccakP1600MPCRound(state, i);
+}
+
+void KeccakP1600MPCOnWords(tKeccakLane *state, unsigned int nrRounds)
+{
 #ifdef KeccakReference
     displaySharedStateAsLanes(3, "Same, with lanes as 64-bit words", state, KeccakP1600_stateSplit, 2);
 #endif
 
-    for(i=(maxNrRounds-nrRounds); i<maxNrRounds; i++)
-        KeccakP1600MPCRound(state, i);
+    KeccakP1600MPCRounds(state, maxNrRounds-nrRounds, maxNrRounds);
 }
 
 void KeccakP1600MPCRound(tKeccakLane *state, unsigned int indexRound)
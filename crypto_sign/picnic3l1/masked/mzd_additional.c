@@ -24,6 +24,36 @@
 
 static_assert(((sizeof(mzd_local_t) + 0x1f) & ~0x1f) == 32, "sizeof mzd_local_t not supported");
 
+/* Share-sliced kernels: with AVX2 each share of a 192-bit value is held in one 256-bit register and
+ * all shares are processed side by side. The unused fourth word is ignored on input and cleared by
+ * the shifts. */
+#if defined(__AVX2__) && MASKING_T == 2
+#include <immintrin.h>
+#define MASKED_MZD_AVX2
+
+#define mm256_load_share(v, j) _mm256_load_si256((const __m256i*)(v)->shares[j].w64)
+#define mm256_store_share(v, j, x) _mm256_store_si256((__m256i*)(v)->shares[j].w64, (x))
+#define mm256_load_mzd(v) _mm256_load_si256((const __m256i*)(v)->w64)
+
+/* (w0, w1, w2) << count, returns (r0, r1, r2, 0) */
+static inline __m256i mm256_shift_left_192(__m256i v, unsigned int count) {
+  const __m256i carry = _mm256_blend_epi32(_mm256_permute4x64_epi64(v, _MM_SHUFFLE(2, 1, 0, 3)),
+                                           _mm256_setzero_si256(), 0x03);
+  const __m256i r = _mm256_or_si256(_mm256_sll_epi64(v, _mm_cvtsi32_si128(count)),
+                                    _mm256_srl_epi64(carry, _mm_cvtsi32_si128(64 - count)));
+  return _mm256_blend_epi32(r, _mm256_setzero_si256(), 0xc0);
+}
+
+/* (w0, w1, w2) >> count, returns (r0, r1, r2, 0) */
+static inline __m256i mm256_shift_right_192(__m256i v, unsigned int count) {
+  const __m256i carry = _mm256_blend_epi32(_mm256_permute4x64_epi64(v, _MM_SHUFFLE(0, 3, 2, 1)),
+                                           _mm256_setzero_si256(), 0xf0);
+  const __m256i r = _mm256_or_si256(_mm256_srl_epi64(v, _mm_cvtsi32_si128(count)),
+                                    _mm256_sll_epi64(carry, _mm_cvtsi32_si128(64 - count)));
+  return _mm256_blend_epi32(r, _mm256_setzero_si256(), 0xc0);
+}
+#endif
+
 #if 0  /* Used for debugging */
 void mzd_share(masked_mzd_t* shared, const mzd_local_t* unshared){
 #if 0
@@ -47,8 +77,14 @@ void masked_mzd_refresh(masked_mzd_t* a) {
   assert(MASKING_T==2);
 
   mzd_random(r, 24);
+#if defined(MASKED_MZD_AVX2)
+  const __m256i vr = mm256_load_mzd(r);
+  mm256_store_share(a, 0, _mm256_xor_si256(mm256_load_share(a, 0), vr));
+  mm256_store_share(a, 1, _mm256_xor_si256(mm256_load_share(a, 1), vr));
+#else
   mzd_xor_uint64_192(&a->shares[0], &a->shares[0], r);
   mzd_xor_uint64_192(&a->shares[1], &a->shares[1], r);
+#endif
 }
 
 void mzd_reconstruct(mzd_local_t* unshared, const masked_mzd_t* shared){
@@ -93,16 +129,30 @@ void mzd_xor_uint64_192(mzd_local_t* res, mzd_local_t const* first, mzd_local_t
 }
 
 void masked_mzd_xor_uint64_192(masked_mzd_t* res, masked_mzd_t const* first, masked_mzd_t const* second) {
+#if defined(MASKED_MZD_AVX2)
+  const __m256i r0 = _mm256_xor_si256(mm256_load_share(first, 0), mm256_load_share(second, 0));
+  const __m256i r1 = _mm256_xor_si256(mm256_load_share(first, 1), mm256_load_share(second, 1));
+  mm256_store_share(res, 0, r0);
+  mm256_store_share(res, 1, r1);
+#else
   for(size_t j = 0; j < MASKING_T; j++) {
     mzd_xor_uint64_192(&(res->shares[j]), &(first->shares[j]), &(second->shares[j]));
   }
+#endif
 }
 
 void masked_mzd_xorconstant_uint64_192(masked_mzd_t* res, masked_mzd_t const* first, mzd_local_t const* second) {
+#if defined(MASKED_MZD_AVX2)
+  const __m256i r0 = _mm256_xor_si256(mm256_load_share(first, 0), mm256_load_mzd(second));
+  const __m256i r1 = mm256_load_share(first, 1);
+  mm256_store_share(res, 0, r0);
+  mm256_store_share(res, 1, r1);
+#else
     mzd_xor_uint64_192(&(res->shares[0]), &(first->shares[0]), second);
     if(first!=res) {
       mzd_copy_uint64_192(&res->shares[1], &first->shares[1]);
     }
+#endif
 }
 
 
@@ -139,9 +189,17 @@ void masked_mzd_andconstant_uint64_192(masked_mzd_t* res, masked_mzd_t const* fi
 void masked_mzd_andconstant_uint64_192(masked_mzd_t* res, masked_mzd_t const* first, mzd_local_t const* second) {
   /* E.g., when MASKING_T = 2, first = first0 + first1, and second is a constant, compute 
    * res = second *(first0 + first1) = second*first0 + second*first1    */
+#if defined(MASKED_MZD_AVX2)
+  const __m256i vsecond = mm256_load_mzd(second);
+  const __m256i r0      = _mm256_and_si256(mm256_load_share(first, 0), vsecond);
+  const __m256i r1      = _mm256_and_si256(mm256_load_share(first, 1), vsecond);
+  mm256_store_share(res, 0, r0);
+  mm256_store_share(res, 1, r1);
+#else
   for(size_t j = 0; j < MASKING_T; j++) {
     mzd_and_uint64_192(&res->shares[j], &first->shares[j], second);
   }
+#endif
 }
 
 
@@ -153,6 +211,14 @@ void masked_mzd_and_uint64_192(masked_mzd_t* c, masked_mzd_t const* a, masked_mz
   // our two inputs are a = a0 + a1 and b = b0 + b1, we compute
   // c = a*b
   //   = (a0*b0 + a0*b1) + (a1*b0 + a1*b1) = c0 + c1
+#if defined(MASKED_MZD_AVX2)
+  const __m256i a0 = mm256_load_share(a, 0), a1 = mm256_load_share(a, 1);
+  const __m256i b0 = mm256_load_share(b, 0), b1 = mm256_load_share(b, 1);
+  const __m256i c0 = _mm256_xor_si256(_mm256_and_si256(a0, b1), _mm256_and_si256(a0, b0));
+  const __m256i c1 = _mm256_xor_si256(_mm256_and_si256(a1, b1), _mm256_and_si256(a1, b0));
+  mm256_store_share(c, 0, c0);
+  mm256_store_share(c, 1, c1);
+#else
   mzd_local_t tmp[1];
   mzd_and_uint64_192(tmp, &a->shares[0], &b->shares[0]);
   mzd_and_uint64_192(&c->shares[0], &a->shares[0], &b->shares[1]);
@@ -161,10 +227,26 @@ void masked_mzd_and_uint64_192(masked_mzd_t* c, masked_mzd_t const* a, masked_mz
   mzd_and_uint64_192(tmp, &a->shares[1], &b->shares[0]);
   mzd_and_uint64_192(&c->shares[1], &a->shares[1], &b->shares[1]);
   mzd_xor_uint64_192(&c->shares[1], &c->shares[1], tmp);
+#endif
 }
 #else   // This is SNI-mult from the paper, with t=2
 void masked_mzd_and_uint64_192(masked_mzd_t* c, masked_mzd_t const* a, masked_mzd_t const* b) {
   mzd_local_t r0[1] ={0};
+#if defined(MASKED_MZD_AVX2)
+  const __m256i a0 = mm256_load_share(a, 0), a1 = mm256_load_share(a, 1);
+  const __m256i b0 = mm256_load_share(b, 0), b1 = mm256_load_share(b, 1);
+
+  mzd_random(r0, MAX(PICNIC_INPUT_SIZE, PICNIC_OUTPUT_SIZE));
+  const __m256i r = mm256_load_mzd(r0);
+
+  /* same order of operations as below: z0 = a0*b0 + r, z1 = a1*b1 + ((a0*b1 + r) + a1*b0) */
+  const __m256i z0 = _mm256_xor_si256(_mm256_and_si256(a0, b0), r);
+  __m256i t        = _mm256_xor_si256(_mm256_and_si256(a0, b1), r);
+  t                = _mm256_xor_si256(t, _mm256_and_si256(a1, b0));
+  const __m256i z1 = _mm256_xor_si256(_mm256_and_si256(a1, b1), t);
+  mm256_store_share(c, 1, z1);
+  mm256_store_share(c, 0, z0);
+#else
   mzd_local_t r1[1];
   mzd_local_t z0[1];  // Output is (z0, z1)
   mzd_local_t z1[1];
@@ -181,6 +263,7 @@ void masked_mzd_and_uint64_192(masked_mzd_t* c, masked_mzd_t const* a, masked_mz
   mzd_xor_uint64_192(r1, r1, r0);
   mzd_xor_uint64_192(&c->shares[1], z1, r1);
   mzd_copy_uint64_192(&c->shares[0], z0);
+#endif
 
 }
 #endif
@@ -209,9 +292,16 @@ void mzd_shift_left_uint64_192(mzd_local_t* res, const mzd_local_t* val, unsigne
   rblock->w64[0] = block->w64[0] << count;
 }
 void masked_mzd_shift_left_uint64_192(masked_mzd_t* res, const masked_mzd_t* val, unsigned int count) {
+#if defined(MASKED_MZD_AVX2)
+  const __m256i r0 = mm256_shift_left_192(mm256_load_share(val, 0), count);
+  const __m256i r1 = mm256_shift_left_192(mm256_load_share(val, 1), count);
+  mm256_store_share(res, 0, r0);
+  mm256_store_share(res, 1, r1);
+#else
   for(size_t j = 0; j < MASKING_T; j++) {
     mzd_shift_left_uint64_192(&(res->shares[j]), &(val->shares[j]), count);
   }
+#endif
 }
 
 void mzd_shift_right_uint64_192(mzd_local_t* res, const mzd_local_t* val, unsigned int count) {
@@ -225,9 +315,16 @@ void mzd_shift_right_uint64_192(mzd_local_t* res, const mzd_local_t* val, unsign
 }
 
 void masked_mzd_shift_right_uint64_192(masked_mzd_t* res, const masked_mzd_t* val, unsigned int count) {
+#if defined(MASKED_MZD_AVX2)
+  const __m256i r0 = mm256_shift_right_192(mm256_load_share(val, 0), count);
+  const __m256i r1 = mm256_shift_right_192(mm256_load_share(val, 1), count);
+  mm256_store_share(res, 0, r0);
+  mm256_store_share(res, 1, r1);
+#else
   for(size_t j = 0; j < MASKING_T; j++) {
     mzd_shift_right_uint64_192(&(res->shares[j]), &(val->shares[j]), count);
   }
+#endif
 }
 
 
@@ -317,17 +414,64 @@ void mzd_mul_v_uint64_192(mzd_local_t* c, mzd_local_t const* v, mzd_local_t cons
 }
 
 
+#if defined(MASKED_MZD_AVX2)
+/* Both shares are multiplied with the same matrix, so each row of A is loaded once and added to
+ * both shares selected by the respective bit of each share of v. */
+static inline void masked_mzd_addmul_v_uint64_129_avx2(__m256i* c0, __m256i* c1, masked_mzd_t const* v,
+                                                       mzd_local_t const* A) {
+  const word* v0ptr     = CONST_BLOCK(&v->shares[0], 0)->w64;
+  const word* v1ptr     = CONST_BLOCK(&v->shares[1], 0)->w64;
+  const block_t* Ablock = CONST_BLOCK(A, 0);
+  __m256i r0 = *c0, r1 = *c1;
+
+  {
+    const __m256i row = _mm256_load_si256((const __m256i*)Ablock->w64);
+    r0 = _mm256_xor_si256(r0, _mm256_and_si256(row, _mm256_set1_epi64x(-(int64_t)((*v0ptr) >> 63))));
+    r1 = _mm256_xor_si256(r1, _mm256_and_si256(row, _mm256_set1_epi64x(-(int64_t)((*v1ptr) >> 63))));
+    Ablock++;
+    v0ptr++;
+    v1ptr++;
+  }
+
+  for (unsigned int w = 2; w; --w, ++v0ptr, ++v1ptr) {
+    word idx0 = *v0ptr;
+    word idx1 = *v1ptr;
+    for (unsigned int i = sizeof(word) * 8; i; --i, idx0 >>= 1, idx1 >>= 1, ++Ablock) {
+      const __m256i row = _mm256_load_si256((const __m256i*)Ablock->w64);
+      r0 = _mm256_xor_si256(r0, _mm256_and_si256(row, _mm256_set1_epi64x(-(int64_t)(idx0 & 1))));
+      r1 = _mm256_xor_si256(r1, _mm256_and_si256(row, _mm256_set1_epi64x(-(int64_t)(idx1 & 1))));
+    }
+  }
+
+  *c0 = r0;
+  *c1 = r1;
+}
+#endif
+
 void masked_mzd_addmul_v_uint64_129(masked_mzd_t* c, masked_mzd_t const* v, mzd_local_t const* A) {
+#if defined(MASKED_MZD_AVX2)
+  __m256i c0 = mm256_load_share(c, 0), c1 = mm256_load_share(c, 1);
+  masked_mzd_addmul_v_uint64_129_avx2(&c0, &c1, v, A);
+  mm256_store_share(c, 0, c0);
+  mm256_store_share(c, 1, c1);
+#else
   for(size_t j = 0; j < MASKING_T; j++) {
     mzd_addmul_v_uint64_129(&(c->shares[j]), &(v->shares[j]), A);
   }
+#endif
 }
 void masked_mzd_mul_v_uint64_129(masked_mzd_t* c, masked_mzd_t const* v, mzd_local_t const* A) {
+#if defined(MASKED_MZD_AVX2)
+  __m256i c0 = _mm256_setzero_si256(), c1 = _mm256_setzero_si256();
+  masked_mzd_addmul_v_uint64_129_avx2(&c0, &c1, v, A);
+  mm256_store_share(c, 0, c0);
+  mm256_store_share(c, 1, c1);
+#else
     for(size_t j = 0; j < MASKING_T; j++) {
         clear_uint64_block(BLOCK(&(c->shares[j]), 0), 3);
         mzd_addmul_v_uint64_129(&(c->shares[j]), &(v->shares[j]), A);
     }
-
+#endif
 }
 
 // no SIMD
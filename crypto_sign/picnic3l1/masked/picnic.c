@@ -187,6 +187,14 @@ int PICNIC_CALLING_CONVENTION picnic_validate_keypair(const picnic_privatekey_t*
 int PICNIC_CALLING_CONVENTION picnic_sign(const picnic_privatekey_t* sk, const uint8_t* message,
                                           size_t message_len, uint8_t* signature,
                                           size_t* signature_len) {
+  return picnic_sign_with_masking(sk, message, message_len, signature, signature_len,
+                                  PICNIC_MASKING_ENABLED);
+}
+
+int PICNIC_CALLING_CONVENTION picnic_sign_with_masking(const picnic_privatekey_t* sk,
+                                                       const uint8_t* message, size_t message_len,
+                                                       uint8_t* signature, size_t* signature_len,
+                                                       picnic_masking_t masking) {
   if (!sk || !signature || !signature_len) {
     return -1;
   }
@@ -204,7 +212,12 @@ int PICNIC_CALLING_CONVENTION picnic_sign(const picnic_privatekey_t* sk, const u
   const uint8_t* sk_c  = SK_C(sk);
   const uint8_t* sk_pt = SK_PT(sk);
 
-  return impl_sign_picnic3(sk_pt, sk_sk, sk_c, message, message_len, signature, signature_len);
+  if (masking != PICNIC_MASKING_ENABLED && masking != PICNIC_MASKING_NONE) {
+    return -1;
+  }
+
+  return impl_sign_picnic3(sk_pt, sk_sk, sk_c, message, message_len, signature, signature_len,
+                           masking);
 }
 
 int PICNIC_CALLING_CONVENTION picnic_verify(const picnic_publickey_t* pk, const uint8_t* message,
@@ -158,6 +158,39 @@ PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign(const picnic_privatekey_
                                                         const uint8_t* message, size_t message_len,
                                                         uint8_t* signature, size_t* signature_len);
 
+/** Masking of the signing operation */
+typedef enum {
+  /* Masked signing with the configuration selected in config.h, as used by picnic_sign */
+  PICNIC_MASKING_ENABLED = 0,
+  /* Unmasked LowMC evaluations in the signer, without side-channel protection; calls to SHA-3 are
+   * still masked as configured in config.h */
+  PICNIC_MASKING_NONE = 1,
+} picnic_masking_t;
+
+/**
+ * Signature function with a run-time choice of the masking.
+ * Both choices produce valid signatures for the same key, so the masking can be chosen per key
+ * (e.g. depending on where it is deployed) or per call.
+ *
+ * @param[in] sk      The signer's private key.
+ * @param[in] message The message to be signed.
+ * @param[in] message_len The length of the message, in bytes.
+ * @param[out] signature A buffer to hold the signature, see picnic_sign().
+ * @param[in,out] signature_len The length of the provided signature buffer.
+ * On success, this is set to the number of bytes written to the signature buffer.
+ * @param[in] masking Whether to use the masked or the unmasked signing path.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error.
+ *
+ * @see picnic_sign()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign_with_masking(const picnic_privatekey_t* sk,
+                                                                     const uint8_t* message,
+                                                                     size_t message_len,
+                                                                     uint8_t* signature,
+                                                                     size_t* signature_len,
+                                                                     picnic_masking_t masking);
+
 /**
  * Get the number of bytes required to hold a signature.
  *
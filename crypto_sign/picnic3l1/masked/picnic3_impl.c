@@ -723,8 +723,119 @@ static void maskedComputeSaltAndRootSeed(uint8_t* saltAndRoot, size_t saltAndRoo
 }
 #endif
 
+/* Per-repetition state of the signer: the tapes, views and masked input are shared if the call is
+ * masked and plain otherwise */
+typedef union {
+  struct {
+    maskedRandomTape_t tape;
+    maskedMsgs_t msgs;
+    masked_uint8_t input;
+  } masked;
+  struct {
+    randomTape_t tape;
+    msgs_t msgs;
+    uint8_t input[PICNIC_INPUT_SIZE];
+  } unmasked;
+} sign_repetition_t;
+
+/* Preprocessing and online simulation of repetition t. With PICNIC_MASKING_NONE the key is
+ * reconstructed and the unmasked simulation of the verifier is used, which offers no protection
+ * against side-channel attacks. Returns -1 if the simulation fails. */
+static int simulateRepetition(sign_repetition_t* rep, picnic_masking_t masking,
+                              const masked_private_key_t* privateKey, tree_t* seed, uint8_t* salt,
+                              size_t t, const mzd_local_t* m_plaintext, const uint8_t* pubKey) {
+  if (masking == PICNIC_MASKING_NONE) {
+    uint8_t* maskedKey = rep->unmasked.input;
+    uint8_t key[PICNIC_INPUT_SIZE];
+    mzd_local_t m_maskedKey[1];
+
+    createRandomTapes(&rep->unmasked.tape, getLeaves(seed), salt, t);
+    /* Preprocessing; compute aux tape for the N-th player, for each parallel rep */
+    computeAuxTape(&rep->unmasked.tape, maskedKey);
+
+    maskedReconstruct(key, privateKey);
+    xor_byte_array(maskedKey, maskedKey, key, PICNIC_INPUT_SIZE); // maskedKey += privateKey
+    for (size_t i = LOWMC_N; i < PICNIC_INPUT_SIZE * 8; i++) {
+      setBit(maskedKey, i, 0);
+    }
+    mzd_from_char_array(m_maskedKey, maskedKey, PICNIC_INPUT_SIZE);
+
+    rep->unmasked.msgs.pos      = 0;
+    rep->unmasked.msgs.unopened = -1;
+    memset(rep->unmasked.msgs.msgs, 0, PICNIC_VIEW_SIZE * PICNIC_NUM_PARTIES);
+    return lowmc_simulate_online_uint64_129_43(m_maskedKey, &rep->unmasked.tape,
+                                               &rep->unmasked.msgs, m_plaintext, pubKey);
+  }
+
+  masked_uint8_t* maskedKey = &rep->masked.input;
+  masked_mzd_t m_maskedKey[1];
+
+  maskedCreateRandomTapes(&rep->masked.tape, getLeaves(seed), salt, t);
+  /* Preprocessing; compute aux tape for the N-th player, for each parallel rep */
+  maskedComputeAuxTape(&rep->masked.tape, maskedKey);
+
+  masked_xor_byte_array(maskedKey, maskedKey, privateKey); // maskedKey += privateKey
+  for (size_t i = LOWMC_N; i < PICNIC_INPUT_SIZE * 8; i++) {
+    maskedSetBitZero(maskedKey, i);
+  }
+  masked_mzd_from_char_array(m_maskedKey, maskedKey, PICNIC_INPUT_SIZE);
+
+#if PICNIC_DEBUG_TRACE
+  printf("preprocessing t = %lu ", t);
+  masked_mzd_print("m_maskedKey", m_maskedKey, PICNIC_INPUT_SIZE);
+#endif
+
+  rep->masked.msgs.pos      = 0;
+  rep->masked.msgs.unopened = -1;
+  memset(rep->masked.msgs.msgs, 0, sizeof(masked_view_t) * PICNIC_NUM_PARTIES);
+  return masked_lowmc_simulate_online_uint64_129_43(m_maskedKey, &rep->masked.tape,
+                                                    &rep->masked.msgs, m_plaintext, pubKey);
+}
+
+/* Commitment to the seed and the aux bits of the last party */
+static void commitLastParty(uint8_t* digest, sign_repetition_t* rep, picnic_masking_t masking,
+                            const uint8_t* seed, const uint8_t* salt, size_t t) {
+  if (masking == PICNIC_MASKING_NONE) {
+    commit(digest, seed, rep->unmasked.tape.aux_bits, salt, t, PICNIC_NUM_PARTIES - 1);
+  } else {
+    maskedCommit(digest, seed, &rep->masked.tape.aux_bits, salt, t, PICNIC_NUM_PARTIES - 1);
+  }
+}
+
+/* Writes the aux bits (unless the last party is unopened), the masked input and the messages of the
+ * unopened party of an opened repetition into the proof; shared values are reconstructed */
+static void openRepetition(proof2_t* proof, sign_repetition_t* rep, picnic_masking_t masking) {
+  const size_t unopened = proof->unOpenedIndex;
+
+  if (masking == PICNIC_MASKING_NONE) {
+    if (unopened != PICNIC_NUM_PARTIES - 1) {
+      memcpy(proof->aux, rep->unmasked.tape.aux_bits, PICNIC_VIEW_SIZE);
+    }
+    memcpy(proof->input, rep->unmasked.input, PICNIC_INPUT_SIZE);
+    memcpy(proof->msgs, rep->unmasked.msgs.msgs[unopened], PICNIC_VIEW_SIZE);
+    return;
+  }
+
+  masked_aux_t* aux = &rep->masked.tape.aux_bits;
+  if (unopened != PICNIC_NUM_PARTIES - 1) {
+    // Reconstruct before output
+    xor_byte_array(aux->shares[0], aux->shares[0], aux->shares[1], PICNIC_AUX_SIZE);
+    memcpy(proof->aux, aux->shares[0], PICNIC_AUX_SIZE);
+  }
+
+  uint8_t tmp[PICNIC_INPUT_SIZE];
+  // Reconstruct the MPC input to output in proof, since t \in C
+  maskedReconstruct(tmp, &rep->masked.input);
+  memcpy(proof->input, tmp, PICNIC_INPUT_SIZE);
+
+  // Reconstruct msgs for unopened party; since it's part of the signature
+  xor_byte_array(proof->msgs, rep->masked.msgs.msgs[unopened].shares[0],
+      rep->masked.msgs.msgs[unopened].shares[1], PICNIC_VIEW_SIZE);
+}
+
 static int sign_picnic3(masked_private_key_t* privateKey, const uint8_t* pubKey, const uint8_t* plaintext,
-                        const uint8_t* message, size_t messageByteLength, signature2_t* sig) {
+                        const uint8_t* message, size_t messageByteLength, signature2_t* sig,
+                        picnic_masking_t masking) {
   int ret = 0;
   uint8_t saltAndRoot[PICNIC_SEED_SIZE + PICNIC_SALT_SIZE];
 
@@ -736,55 +847,23 @@ static int sign_picnic3(masked_private_key_t* privateKey, const uint8_t* pubKey,
   generateRoundSeeds(&iSeedsTree, &iSeedsTreeStorage, saltAndRoot + PICNIC_SALT_SIZE, sig->salt, 0);
   uint8_t** iSeeds = getLeaves(&iSeedsTree);
 
-  maskedRandomTape_t tape;
+  sign_repetition_t rep;
   tree_t seed;
   parties_seed_tree_storage_t seedTreeStorage;
 
-  masked_lowmc_simulate_online_f simulateOnline = masked_lowmc_simulate_online_uint64_129_43;
-  masked_uint8_t input;
-  maskedMsgs_t msgs;
-
   party_commitments_t C;
   /* Commitments to the commitments and views */
   round_commitments_t Ch;
   round_commitments_t Cv;
 
   mzd_local_t m_plaintext[1];
-  masked_mzd_t m_maskedKey[1];
 
   mzd_from_char_array(m_plaintext, plaintext, PICNIC_OUTPUT_SIZE);
 
   for (size_t t = 0; t < PICNIC_NUM_ROUNDS; t++) {
     generatePartySeeds(&seed, &seedTreeStorage, iSeeds[t], sig->salt, t);
-    maskedCreateRandomTapes(&tape, getLeaves(&seed), sig->salt, t);
-    /* Preprocessing; compute aux tape for the N-th player, for each parallel rep */
-    maskedComputeAuxTape(&tape, &input);
-    /* Commit to seeds and aux bits */
-    const size_t last = PICNIC_NUM_PARTIES - 1;
-    for (size_t j = 0; j < last; j++) {
-      commit(C.hashes[j], getLeaf(&seed, j), NULL, sig->salt, t, j);
-    }
-    maskedCommit(C.hashes[last], getLeaf(&seed, last), &tape.aux_bits, sig->salt, t, last);
-
-    /* Simulate the online phase of the MPC */
-    masked_uint8_t* maskedKey = &input;
-
-    masked_xor_byte_array(maskedKey, maskedKey, privateKey); // maskedKey += privateKey
-    for (size_t i = LOWMC_N; i < PICNIC_INPUT_SIZE * 8; i++) {
-      maskedSetBitZero(maskedKey, i);
-    }
-
-    masked_mzd_from_char_array(m_maskedKey, maskedKey, PICNIC_INPUT_SIZE);
-
-#if PICNIC_DEBUG_TRACE
-    printf("preprocessing t = %lu ", t);
-    masked_mzd_print("m_maskedKey", m_maskedKey, PICNIC_INPUT_SIZE);
-#endif
-
-    msgs.pos      = 0;
-    msgs.unopened = -1;
-    memset(msgs.msgs, 0, sizeof(masked_view_t) * PICNIC_NUM_PARTIES);
-    int rv = simulateOnline(m_maskedKey, &tape, &msgs, m_plaintext, pubKey);
+    int rv =
+        simulateRepetition(&rep, masking, privateKey, &seed, sig->salt, t, m_plaintext, pubKey);
     if (rv != 0) {
 #if !defined(NDEBUG)
       printf("MPC simulation failed in round " SIZET_FMT ", aborting signature\n", t);
@@ -795,8 +874,18 @@ static int sign_picnic3(masked_private_key_t* privateKey, const uint8_t* pubKey,
 #endif
       ret = -1;
     }
+    /* Commit to seeds and aux bits */
+    const size_t last = PICNIC_NUM_PARTIES - 1;
+    for (size_t j = 0; j < last; j++) {
+      commit(C.hashes[j], getLeaf(&seed, j), NULL, sig->salt, t, j);
+    }
+    commitLastParty(C.hashes[last], &rep, masking, getLeaf(&seed, last), sig->salt, t);
     commit_h(Ch.hashes[t], &C);
-    maskedCommit_v(Cv.hashes[t], &input, &msgs);
+    if (masking == PICNIC_MASKING_NONE) {
+      commit_v(Cv.hashes[t], rep.unmasked.input, &rep.unmasked.msgs);
+    } else {
+      maskedCommit_v(Cv.hashes[t], &rep.masked.input, &rep.masked.msgs);
+    }
   }
 
   /* Create a Merkle tree with Cv as the leaves */
@@ -831,23 +920,8 @@ static int sign_picnic3(masked_private_key_t* privateKey, const uint8_t* pubKey,
   for (size_t t = 0; t < PICNIC_NUM_ROUNDS; t++) {
     if (contains(challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
       generatePartySeeds(&seed, &seedTreeStorage, iSeeds[t], sig->salt, t);
-      maskedCreateRandomTapes(&tape, getLeaves(&seed), sig->salt, t);
-      /* Preprocessing; compute aux tape for the N-th player, for each parallel rep */
-      maskedComputeAuxTape(&tape, &input);
-      /* Simulate the online phase of the MPC */
-      masked_uint8_t* maskedKey = &input;
-
-      masked_xor_byte_array(maskedKey, maskedKey, privateKey);  // maskedKey += privateKey
-      for (size_t i = LOWMC_N; i < PICNIC_INPUT_SIZE * 8; i++) {
-        maskedSetBitZero(maskedKey, i);
-      }
-
-      masked_mzd_from_char_array(m_maskedKey, maskedKey, PICNIC_INPUT_SIZE);
-
-      msgs.pos      = 0;
-      msgs.unopened = -1;
-      memset(msgs.msgs, 0, PICNIC_VIEW_SIZE * PICNIC_NUM_PARTIES);
-      int rv = simulateOnline(m_maskedKey, &tape, &msgs, m_plaintext, pubKey);
+      int rv =
+          simulateRepetition(&rep, masking, privateKey, &seed, sig->salt, t, m_plaintext, pubKey);
       if (rv != 0) {
 #if !defined(NDEBUG)
         printf("MPC simulation failed in round " SIZET_FMT ", aborting signature\n", t);
@@ -863,25 +937,13 @@ static int sign_picnic3(masked_private_key_t* privateKey, const uint8_t* pubKey,
       proof->seedInfoLen =
           revealPartySeeds(&seed, challengeP[P_index], proof->seedInfo, sizeof(proof->seedInfo));
 
-      size_t last = PICNIC_NUM_PARTIES - 1;
-      if (challengeP[P_index] != last) {
-        xor_byte_array(tape.aux_bits.shares[0], tape.aux_bits.shares[0], tape.aux_bits.shares[1], PICNIC_AUX_SIZE); // Reconstruct before output
-        memcpy(proof->aux, tape.aux_bits.shares[0], PICNIC_AUX_SIZE);
-      }
-
-      uint8_t tmp[PICNIC_INPUT_SIZE];
-      maskedReconstruct(tmp, &input);   // Reconstruct the MPC input to output in proof, since t \in C
-      memcpy(proof->input, tmp, PICNIC_INPUT_SIZE);
-
-      // Reconstruct msgs for unopened party; since it's part of the signature
-      xor_byte_array(proof->msgs, msgs.msgs[challengeP[P_index]].shares[0],
-          msgs.msgs[challengeP[P_index]].shares[1], PICNIC_VIEW_SIZE);
+      openRepetition(proof, &rep, masking);
 
       /* recompute commitment of unopened party since we did not store it for memory optimization
        */
       if (proof->unOpenedIndex == PICNIC_NUM_PARTIES - 1) {
-        maskedCommit(proof->C, getLeaf(&seed, proof->unOpenedIndex), &tape.aux_bits, sig->salt, t,
-               proof->unOpenedIndex);
+        commitLastParty(proof->C, &rep, masking, getLeaf(&seed, proof->unOpenedIndex), sig->salt,
+                        t);
       } else {
         commit(proof->C, getLeaf(&seed, proof->unOpenedIndex), NULL, sig->salt, t,
                proof->unOpenedIndex);
@@ -1081,12 +1143,12 @@ static int serializeSignature2(const signature2_t* sig, uint8_t* sigBytes, size_
 
 int impl_sign_picnic3(const uint8_t* plaintext, const uint8_t* private_key,
                       const uint8_t* public_key, const uint8_t* msg, size_t msglen,
-                      uint8_t* signature, size_t* signature_len) {
+                      uint8_t* signature, size_t* signature_len, picnic_masking_t masking) {
   signature2_t sig;
   masked_private_key_t masked_sk = {0};
   maskedShare(&masked_sk, private_key);   // This is where we start masking in this implementation
 
-  int ret = sign_picnic3(&masked_sk, public_key, plaintext, msg, msglen, &sig);
+  int ret = sign_picnic3(&masked_sk, public_key, plaintext, msg, msglen, &sig, masking);
   picnic_declassify(&ret, sizeof(ret));
   if (ret != EXIT_SUCCESS) {
 #if !defined(NDEBUG)
@@ -17,6 +17,7 @@
 #include <stddef.h>
 #include "picnic_params.h"
 #include "masking.h"
+#include "picnic.h"
 
 typedef struct proof2_t {
   uint16_t unOpenedIndex; // P[t], index of the party that is not opened.
@@ -59,9 +60,10 @@ typedef struct signature2_t {
 typedef masked_uint8_t masked_private_key_t; 
 
 
+/* Signs with the masked path configured in config.h or, with PICNIC_MASKING_NONE, unmasked */
 int impl_sign_picnic3(const uint8_t* plaintext, const uint8_t* private_key,
                       const uint8_t* public_key, const uint8_t* msg, size_t msglen, uint8_t* sig,
-                      size_t* siglen);
+                      size_t* siglen, picnic_masking_t masking);
 int impl_verify_picnic3(const uint8_t* plaintext, const uint8_t* public_key, const uint8_t* msg,
                         size_t msglen, const uint8_t* signature, size_t signature_len);
 
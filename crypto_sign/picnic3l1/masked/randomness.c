@@ -138,44 +138,131 @@ int rand_bits(uint8_t* dst, size_t num_bits) {
   return 0;
 }
 
-#ifdef STM32F4
+/* Buffered mask generator.
+ *
+ * Masks are requested many times per round in small amounts. Instead of asking the entropy source
+ * for every request, masks are handed out from a pool. On the STM32F4 the pool is refilled from
+ * the hardware RNG, otherwise from a SHAKE128 stream that is reseeded from the OS every
+ * RAND_MASK_RESEED_INTERVAL bytes. Handed out masks are erased from the pool. */
+
+#include <string.h>
+
+#if !defined(STM32F4)
+#include "KeccakHash.h"
+#endif
 
-#include <stdint.h>
+#if defined(STM32F4)
 #include <libopencm3/stm32/rng.h>
 
-int rand_mask(uint8_t *obuf, size_t len)
-{
-    union
-    {
-        unsigned char aschar[4];
-        uint32_t asint;
-    } random;
-
-    while (len > 4)
-    {
-        random.asint = rng_get_random_blocking();
-        *obuf++ = random.aschar[0];
-        *obuf++ = random.aschar[1];
-        *obuf++ = random.aschar[2];
-        *obuf++ = random.aschar[3];
-        len -= 4;
-    }
-    if (len > 0)
-    {
-        for (random.asint = rng_get_random_blocking(); len > 0; --len)
-        {
-            *obuf++ = random.aschar[len - 1];
-        }
+static int rand_mask_entropy(uint8_t* obuf, size_t len) {
+  union {
+    unsigned char aschar[4];
+    uint32_t asint;
+  } random;
+
+  while (len > 4) {
+    random.asint = rng_get_random_blocking();
+    *obuf++      = random.aschar[0];
+    *obuf++      = random.aschar[1];
+    *obuf++      = random.aschar[2];
+    *obuf++      = random.aschar[3];
+    len -= 4;
+  }
+  if (len > 0) {
+    for (random.asint = rng_get_random_blocking(); len > 0; --len) {
+      *obuf++ = random.aschar[len - 1];
     }
+  }
 
-    return 0;
+  return 0;
 }
-
 #elif defined(MUPQ_NAMESPACE)
-
-int rand_mask(uint8_t *obuf, size_t len) {
-	randombytes(obuf, len);
-	return 0;
+static int rand_mask_entropy(uint8_t* obuf, size_t len) {
+  randombytes(obuf, len);
+  return 0;
 }
+#else
+#define rand_mask_entropy rand_bytes
+#endif
 
+/* The pool is per thread on hosted platforms */
+#if defined(STM32F4) || !(defined(__GNUC__) || defined(__clang__))
+#define RAND_MASK_THREAD_LOCAL
+#else
+#define RAND_MASK_THREAD_LOCAL __thread
 #endif
+
+/* SHAKE128 rate in bytes */
+#define RAND_MASK_SHAKE_RATE 168
+#define RAND_MASK_SEED_SIZE 32
+
+typedef struct {
+  uint8_t pool[RAND_MASK_POOL_SIZE];
+  size_t pos;
+#if !defined(STM32F4)
+  Keccak_HashInstance shake;
+  uint64_t since_reseed;
+  int seeded;
+#endif
+  rand_mask_stats_t stats;
+} rand_mask_state_t;
+
+static RAND_MASK_THREAD_LOCAL rand_mask_state_t mask_state = {.pos = RAND_MASK_POOL_SIZE};
+
+static int rand_mask_refill(void) {
+#if defined(STM32F4)
+  if (rand_mask_entropy(mask_state.pool, RAND_MASK_POOL_SIZE)) {
+    return -1;
+  }
+#else
+  if (!mask_state.seeded || mask_state.since_reseed >= RAND_MASK_RESEED_INTERVAL) {
+    uint8_t seed[RAND_MASK_SEED_SIZE];
+    if (rand_mask_entropy(seed, sizeof(seed))) {
+      return -1;
+    }
+    Keccak_HashInitialize_SHAKE128(&mask_state.shake);
+    Keccak_HashUpdate(&mask_state.shake, seed, sizeof(seed) * 8);
+    Keccak_HashFinal(&mask_state.shake, NULL);
+    memset(seed, 0, sizeof(seed));
+    mask_state.seeded       = 1;
+    mask_state.since_reseed = 0;
+    mask_state.stats.reseeds++;
+  }
+  Keccak_HashSqueeze(&mask_state.shake, mask_state.pool, RAND_MASK_POOL_SIZE * 8);
+  mask_state.since_reseed += RAND_MASK_POOL_SIZE;
+#endif
+  mask_state.pos = 0;
+  mask_state.stats.refills++;
+  return 0;
+}
+
+int rand_mask(uint8_t* dst, size_t len) {
+  mask_state.stats.requests++;
+  mask_state.stats.bytes += len;
+
+  while (len) {
+    if (mask_state.pos == RAND_MASK_POOL_SIZE && rand_mask_refill()) {
+      return -1;
+    }
+
+    size_t n = RAND_MASK_POOL_SIZE - mask_state.pos;
+    if (n > len) {
+      n = len;
+    }
+    memcpy(dst, mask_state.pool + mask_state.pos, n);
+    memset(mask_state.pool + mask_state.pos, 0, n);
+    mask_state.pos += n;
+    dst += n;
+    len -= n;
+  }
+
+  return 0;
+}
+
+void rand_mask_get_stats(rand_mask_stats_t* stats) {
+  *stats = mask_state.stats;
+}
+
+void rand_mask_reset_stats(void) {
+  memset(&mask_state.stats, 0, sizeof(mask_state.stats));
+}
@@ -21,13 +21,29 @@ int rand_bits(uint8_t* dst, size_t num_bits);
 /* If we are building under pqm4 for either host or board, use external PRNG. */
 #define HAVE_RANDOMBYTES
 
-/* Also define another RNG for mask generation. */
-int rand_mask(uint8_t* dst, size_t len);
-
-#else
+#endif
 
-#define rand_mask rand_bytes
+/* Size of the pool of the mask generator in bytes, a multiple of the SHAKE128 rate */
+#if !defined(RAND_MASK_POOL_SIZE)
+#define RAND_MASK_POOL_SIZE (4 * 168)
+#endif
 
+/* Number of mask bytes after which the SHAKE128 stream is reseeded from the OS */
+#if !defined(RAND_MASK_RESEED_INTERVAL)
+#define RAND_MASK_RESEED_INTERVAL (1024 * 1024)
 #endif
 
+/* Counters of the mask generator of the calling thread */
+typedef struct rand_mask_stats_t {
+  uint64_t bytes;    /* mask bytes handed out */
+  uint64_t requests; /* calls to rand_mask */
+  uint64_t refills;  /* pool refills */
+  uint64_t reseeds;  /* reseeds from the OS (not used on the STM32F4) */
+} rand_mask_stats_t;
+
+/* Fresh randomness for masks, handed out from a buffered pool */
+int rand_mask(uint8_t* dst, size_t len);
+void rand_mask_get_stats(rand_mask_stats_t* stats);
+void rand_mask_reset_stats(void);
+
 #endif /* RANDOMNESS_H */
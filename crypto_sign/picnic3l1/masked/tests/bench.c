@@ -14,20 +14,49 @@
 #include "bench_timing.h"
 #include "bench_utils.h"
 #include "../picnic.h"
+#include "../randomness.h"
 
 #include <inttypes.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+#if defined(PROFILE_HASHING)
+#include "hal.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+/* cycles spent in Keccak, accumulated by kdf_shake.h */
+unsigned long long hash_cycles;
+
+uint64_t hal_get_time(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+#endif
+
 typedef struct {
-  uint64_t keygen, sign, verify, size, max_size;
+  uint64_t keygen, sign, verify, size, max_size, mask_bytes, mask_refills;
+  /* only with PROFILE_HASHING: signing time and time spent in Keccak, both in hal_get_time units */
+  uint64_t sign_hal, hash_sign;
 } timing_and_size_t;
 
 static void print_timings(timing_and_size_t* timings, unsigned int iter) {
   for (unsigned int i = 0; i < iter; i++) {
-    printf("%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n", timings[i].keygen,
-           timings[i].sign, timings[i].verify, timings[i].size, timings[i].max_size);
+    printf("%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+           ",%" PRIu64 ",%" PRIu64 "\n",
+           timings[i].keygen, timings[i].sign, timings[i].verify, timings[i].size,
+           timings[i].max_size, timings[i].mask_bytes, timings[i].mask_refills,
+           timings[i].sign_hal, timings[i].hash_sign);
   }
 }
 
@@ -69,10 +98,25 @@ static void bench_sign_and_verify(const bench_options_t* options) {
     start_time        = timing_read(&ctx);
 
     size_t siglen = max_signature_size;
+    rand_mask_reset_stats();
+#if defined(PROFILE_HASHING)
+    hash_cycles               = 0;
+    const uint64_t start_hal  = hal_get_time();
+#endif
     if (!picnic_sign(&private_key, m, sizeof(m), sig, &siglen)) {
       tmp_time     = timing_read(&ctx);
       timing->sign = tmp_time - start_time;
       timing->size = siglen;
+#if defined(PROFILE_HASHING)
+      timing->sign_hal  = hal_get_time() - start_hal;
+      timing->hash_sign = hash_cycles;
+#endif
+
+      /* randomness consumed for masks by this signature */
+      rand_mask_stats_t mask_stats;
+      rand_mask_get_stats(&mask_stats);
+      timing->mask_bytes   = mask_stats.bytes;
+      timing->mask_refills = mask_stats.refills;
       start_time   = timing_read(&ctx);
 
       if (picnic_verify(&public_key, m, sizeof(m), sig, siglen)) {
@@ -0,0 +1,54 @@
+#!/bin/sh
+#
+#  This file is part of the optimized implementation of the Picnic signature scheme.
+#  See the accompanying documentation for complete details.
+#
+#  The code is provided under the MIT license, see LICENSE for
+#  more details.
+#  SPDX-License-Identifier: MIT
+#
+# Runs the benchmark binaries built by "make -f x64-Makefile bench-matrix" and prints one row per
+# masking configuration:
+#  - sign: median signing time (cycles if perf counters are available, otherwise microseconds)
+#  - keccak: median share of the signing time spent in Keccak (%)
+#  - mask bytes: mean number of random bytes drawn for masks per signature
+#
+# usage: tests/bench_matrix.sh iterations config...
+
+if [ $# -lt 2 ]; then
+  echo "usage: $0 iterations config..."
+  exit 1
+fi
+
+iter=$1
+shift
+
+printf "%-12s %14s %8s %14s\n" "config" "sign" "keccak" "mask bytes"
+for config in "$@"; do
+  bin=./bench_matrix_${config}.out
+  if [ ! -x "$bin" ]; then
+    echo "$bin not found, run make -f x64-Makefile bench-matrix first"
+    exit 1
+  fi
+  "$bin" -i "$iter" 7 | awk -F, -v config="$config" '
+    NF >= 9 {
+      n++
+      sign[n] = $2
+      keccak[n] = $8 ? 100 * $9 / $8 : 0
+      mask += $6
+    }
+    function median(a, n,    i, j, t) {
+      for (i = 2; i <= n; i++)
+        for (j = i; j > 1 && a[j - 1] > a[j]; j--) {
+          t = a[j]; a[j] = a[j - 1]; a[j - 1] = t
+        }
+      return n % 2 ? a[(n + 1) / 2] : (a[n / 2] + a[n / 2 + 1]) / 2
+    }
+    END {
+      if (!n) {
+        printf "%-12s %14s %8s %14s\n", config, "failed", "-", "-"
+        exit 1
+      }
+      printf "%-12s %14d %7.1f%% %14d\n", config, median(sign, n), median(keccak, n), mask / n
+    }' || exit 1
+done
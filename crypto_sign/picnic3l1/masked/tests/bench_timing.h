@@ -15,6 +15,22 @@
 
 typedef struct timing_context_s timing_context_t;
 
+/* Hardware events counted with perf_event_open on Linux, independently of the timing source */
+typedef enum {
+  TIMING_COUNTER_CYCLES,
+  TIMING_COUNTER_INSTRUCTIONS,
+  TIMING_COUNTER_L1D_MISSES,
+  TIMING_COUNTER_LLC_MISSES,
+  TIMING_COUNTER_BRANCH_MISSES,
+  TIMING_COUNTER_MAX,
+} timing_counter_t;
+
+typedef struct {
+  uint64_t values[TIMING_COUNTER_MAX];
+  /* bit i is set if values[i] was counted */
+  unsigned int available;
+} timing_counters_t;
+
 typedef uint64_t (*timing_read_f)(timing_context_t* ctx);
 typedef void (*timing_close_f)(timing_context_t* ctx);
 
@@ -25,16 +41,30 @@ struct timing_context_s {
   union {
     int fd;
   } data;
+
+  /* file descriptors of the hardware counters, -1 if not available */
+  int counter_fds[TIMING_COUNTER_MAX];
 };
 
 bool timing_init(timing_context_t* ctx);
+void timing_close(timing_context_t* ctx);
 
 static inline uint64_t timing_read(timing_context_t* ctx) {
   return ctx->read(ctx);
 }
 
-static inline void timing_close(timing_context_t* ctx) {
-  ctx->close(ctx);
-}
+/**
+ * Read the hardware counters. Counters that are not supported by the CPU or not permitted (see
+ * /proc/sys/kernel/perf_event_paranoid) are missing from counters->available.
+ *
+ * @return false if no counter is available
+ */
+bool timing_read_counters(timing_context_t* ctx, timing_counters_t* counters);
+/**
+ * Compute end - start of the counters available in both.
+ */
+void timing_counters_sub(timing_counters_t* diff, const timing_counters_t* end,
+                         const timing_counters_t* start);
+const char* timing_counter_name(timing_counter_t counter);
 
 #endif
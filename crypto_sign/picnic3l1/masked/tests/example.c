@@ -79,6 +79,29 @@ int picnicExample(picnic_params_t parameters)
     }
     printf(" success\n");
 
+    fprintf(stdout, "Signing and verifying without masking... ");
+    fflush(stdout);
+
+    uint8_t* unmasked_signature = malloc(picnic_signature_size(parameters));
+    size_t unmasked_signature_len = picnic_signature_size(parameters);
+    if (unmasked_signature == NULL) {
+        printf("failed to allocate signature\n");
+        exit(-1);
+    }
+    ret = picnic_sign_with_masking(&sk, message, sizeof(message), unmasked_signature,
+                                   &unmasked_signature_len, PICNIC_MASKING_NONE);
+    if (ret != 0) {
+        printf("picnic_sign_with_masking failed\n");
+        exit(-1);
+    }
+    ret = picnic_verify(&pk, message, sizeof(message), unmasked_signature, unmasked_signature_len);
+    if (ret != 0) {
+        printf("picnic_verify failed\n");
+        exit(-1);
+    }
+    free(unmasked_signature);
+    printf(" success\n");
+
     printf("Testing public key serialization... ");
     uint8_t pk_buf[PICNIC_MAX_PUBLICKEY_SIZE];
     ret = picnic_write_public_key(&pk, pk_buf, sizeof(pk_buf));
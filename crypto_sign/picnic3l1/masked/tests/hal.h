@@ -0,0 +1,20 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+/* Host stand-in for the pqm4 HAL, only used by the benchmark builds with -DPROFILE_HASHING (see
+ * bench-matrix in x64-Makefile). The timer is implemented in bench.c. */
+
+#ifndef HAL_H
+#define HAL_H
+
+#include <stdint.h>
+
+uint64_t hal_get_time(void);
+
+#endif
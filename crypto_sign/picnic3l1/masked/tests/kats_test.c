@@ -219,6 +219,20 @@ static int run_picnic_test(const uint8_t *msg, size_t msg_len,
     goto err;
   }
 
+  /* The unmasked signing path has to produce the same signature */
+  signature_len = sig_len + 5000;
+  ret = picnic_sign_with_masking(&private_key, msg, msg_len, signature, &signature_len,
+                                 PICNIC_MASKING_NONE);
+  if (ret != 0) {
+    printf("Unable to sign without masking.\n");
+    goto err;
+  }
+
+  if (signature_len != sig_len || memcmp(sig, signature, signature_len) != 0) {
+    printf("Signature without masking does not match.\n");
+    goto err;
+  }
+
   /* Verify the provided signature */
   ret = picnic_verify(&public_key, msg, msg_len, sig, sig_len);
   if (ret != 0) {
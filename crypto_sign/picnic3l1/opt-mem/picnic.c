@@ -228,6 +228,190 @@ int PICNIC_CALLING_CONVENTION picnic_verify(const picnic_publickey_t* pk, const
   return impl_verify_picnic3(pk_pt, pk_c, message, message_len, signature, signature_len);
 }
 
+size_t PICNIC_CALLING_CONVENTION picnic_sign_workspace_size(picnic_params_t param) {
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return 0;
+  }
+
+  return impl_sign_picnic3_workspace_size();
+}
+
+size_t PICNIC_CALLING_CONVENTION picnic_verify_workspace_size(picnic_params_t param) {
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return 0;
+  }
+
+  return impl_verify_picnic3_workspace_size();
+}
+
+int PICNIC_CALLING_CONVENTION picnic_sign_ws(const picnic_privatekey_t* sk, const uint8_t* message,
+                                             size_t message_len, uint8_t* signature,
+                                             size_t* signature_len, void* workspace,
+                                             size_t workspace_len) {
+  if (!sk || !signature || !signature_len || !workspace) {
+    return -1;
+  }
+
+  const picnic_params_t param       = sk->data[0];
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return -1;
+  }
+
+  const size_t output_size = instance->output_size;
+  const size_t input_size  = instance->input_size;
+
+  const uint8_t* sk_sk = SK_SK(sk);
+  const uint8_t* sk_c  = SK_C(sk);
+  const uint8_t* sk_pt = SK_PT(sk);
+
+  return impl_sign_picnic3_ws(sk_pt, sk_sk, sk_c, message, message_len, signature, signature_len,
+                              workspace, workspace_len);
+}
+
+int PICNIC_CALLING_CONVENTION picnic_verify_ws(const picnic_publickey_t* pk, const uint8_t* message,
+                                               size_t message_len, const uint8_t* signature,
+                                               size_t signature_len, void* workspace,
+                                               size_t workspace_len) {
+  if (!pk || !signature || !signature_len || !workspace) {
+    return -1;
+  }
+
+  const picnic_params_t param       = pk->data[0];
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return -1;
+  }
+
+  const size_t output_size = instance->output_size;
+
+  const uint8_t* pk_c  = PK_C(pk);
+  const uint8_t* pk_pt = PK_PT(pk);
+
+  return impl_verify_picnic3_ws(pk_pt, pk_c, message, message_len, signature, signature_len,
+                                workspace, workspace_len);
+}
+
+size_t PICNIC_CALLING_CONVENTION picnic_sign_context_size(picnic_params_t param) {
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return 0;
+  }
+
+  return impl_sign_picnic3_workspace_size();
+}
+
+int PICNIC_CALLING_CONVENTION picnic_sign_begin(void* context, size_t context_len,
+                                                const picnic_privatekey_t* sk,
+                                                const uint8_t* message, size_t message_len,
+                                                uint8_t* signature, size_t signature_len) {
+  if (!context || !sk || !signature) {
+    return -1;
+  }
+
+  const picnic_params_t param       = sk->data[0];
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return -1;
+  }
+
+  const size_t output_size = instance->output_size;
+  const size_t input_size  = instance->input_size;
+
+  const uint8_t* sk_sk = SK_SK(sk);
+  const uint8_t* sk_c  = SK_C(sk);
+  const uint8_t* sk_pt = SK_PT(sk);
+
+  return impl_sign_picnic3_begin(context, context_len, sk_pt, sk_sk, sk_c, message, message_len,
+                                 signature, signature_len);
+}
+
+int PICNIC_CALLING_CONVENTION picnic_sign_step(void* context) {
+  if (!context) {
+    return -1;
+  }
+
+  return impl_sign_picnic3_step(context);
+}
+
+int PICNIC_CALLING_CONVENTION picnic_sign_finish(void* context, size_t* signature_len) {
+  if (!context || !signature_len) {
+    return -1;
+  }
+
+  return impl_sign_picnic3_finish(context, signature_len);
+}
+
+size_t PICNIC_CALLING_CONVENTION picnic_presign_size(picnic_params_t param) {
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return 0;
+  }
+
+  return impl_presign_picnic3_size();
+}
+
+size_t PICNIC_CALLING_CONVENTION picnic_presign_workspace_size(picnic_params_t param) {
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return 0;
+  }
+
+  return impl_presign_picnic3_workspace_size();
+}
+
+int PICNIC_CALLING_CONVENTION picnic_presign(const picnic_privatekey_t* sk, void* presign,
+                                             size_t presign_len, void* workspace,
+                                             size_t workspace_len) {
+  if (!sk || !presign || !workspace) {
+    return -1;
+  }
+
+  const picnic_params_t param       = sk->data[0];
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return -1;
+  }
+
+  const size_t output_size = instance->output_size;
+  const size_t input_size  = instance->input_size;
+
+  const uint8_t* sk_sk = SK_SK(sk);
+  const uint8_t* sk_c  = SK_C(sk);
+  const uint8_t* sk_pt = SK_PT(sk);
+
+  return impl_presign_picnic3(sk_pt, sk_sk, sk_c, presign, presign_len, workspace, workspace_len);
+}
+
+int PICNIC_CALLING_CONVENTION picnic_sign_presigned(const picnic_privatekey_t* sk, void* presign,
+                                                    size_t presign_len, const uint8_t* message,
+                                                    size_t message_len, uint8_t* signature,
+                                                    size_t* signature_len, void* workspace,
+                                                    size_t workspace_len) {
+  if (!sk || !presign || !signature || !signature_len || !workspace) {
+    return -1;
+  }
+
+  const picnic_params_t param       = sk->data[0];
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return -1;
+  }
+
+  const size_t output_size = instance->output_size;
+  const size_t input_size  = instance->input_size;
+
+  const uint8_t* sk_sk = SK_SK(sk);
+  const uint8_t* sk_c  = SK_C(sk);
+  const uint8_t* sk_pt = SK_PT(sk);
+
+  return impl_sign_picnic3_presigned(sk_pt, sk_sk, sk_c, message, message_len, presign,
+                                     presign_len, signature, signature_len, workspace,
+                                     workspace_len);
+}
+
 const char* PICNIC_CALLING_CONVENTION picnic_get_param_name(picnic_params_t parameters) {
   switch (parameters) {
   case Picnic_L1_FS:
@@ -196,6 +196,227 @@ PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_verify(const picnic_publickey
                                                           const uint8_t* signature,
                                                           size_t signature_len);
 
+/**
+ * Required alignment of the workspaces passed to picnic_sign_ws() and picnic_verify_ws().
+ */
+#define PICNIC_WORKSPACE_ALIGNMENT 8
+
+/**
+ * Get the number of bytes of the workspace required by picnic_sign_ws().
+ *
+ * @param[in] parameters The parameter set.
+ *
+ * @return The workspace size in bytes, or 0 if the parameter set is not supported.
+ *
+ * @see picnic_sign_ws()
+ */
+PICNIC_EXPORT size_t PICNIC_CALLING_CONVENTION
+picnic_sign_workspace_size(picnic_params_t parameters);
+
+/**
+ * Get the number of bytes of the workspace required by picnic_verify_ws().
+ *
+ * @param[in] parameters The parameter set.
+ *
+ * @return The workspace size in bytes, or 0 if the parameter set is not supported.
+ *
+ * @see picnic_verify_ws()
+ */
+PICNIC_EXPORT size_t PICNIC_CALLING_CONVENTION
+picnic_verify_workspace_size(picnic_params_t parameters);
+
+/**
+ * Signature function using a caller-provided workspace.
+ * Behaves like picnic_sign(), but keeps all large intermediate values in the
+ * workspace instead of on the stack. No memory is allocated. A workspace may
+ * be reused for subsequent calls, but not by concurrent calls.
+ *
+ * @param[in] sk      The signer's private key.
+ * @param[in] message The message to be signed.
+ * @param[in] message_len The length of the message, in bytes.
+ * @param[out] signature A buffer to hold the signature, see picnic_sign().
+ * @param[in,out] signature_len The length of the provided signature buffer.
+ * On success, this is set to the number of bytes written to the signature buffer.
+ * @param[in] workspace Scratch memory, aligned to PICNIC_WORKSPACE_ALIGNMENT bytes.
+ * @param[in] workspace_len The size of the workspace, at least
+ * picnic_sign_workspace_size() bytes.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error.
+ *
+ * @see picnic_sign(), picnic_sign_workspace_size()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign_ws(const picnic_privatekey_t* sk,
+                                                           const uint8_t* message,
+                                                           size_t message_len, uint8_t* signature,
+                                                           size_t* signature_len, void* workspace,
+                                                           size_t workspace_len);
+
+/**
+ * Verification function using a caller-provided workspace.
+ * Behaves like picnic_verify(), but keeps all large intermediate values in the
+ * workspace instead of on the stack. No memory is allocated.
+ *
+ * @param[in] pk      The signer's public key.
+ * @param[in] message The message the signature purpotedly signs.
+ * @param[in] message_len The length of the message, in bytes.
+ * @param[in] signature The signature to verify.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] workspace Scratch memory, aligned to PICNIC_WORKSPACE_ALIGNMENT bytes.
+ * @param[in] workspace_len The size of the workspace, at least
+ * picnic_verify_workspace_size() bytes.
+ *
+ * @return Returns 0 for success, indicating a valid signature, or a nonzero
+ * value indicating an error or an invalid signature.
+ *
+ * @see picnic_verify(), picnic_verify_workspace_size()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_verify_ws(const picnic_publickey_t* pk,
+                                                             const uint8_t* message,
+                                                             size_t message_len,
+                                                             const uint8_t* signature,
+                                                             size_t signature_len, void* workspace,
+                                                             size_t workspace_len);
+
+/**
+ * Get the number of bytes of the context required by picnic_sign_begin().
+ *
+ * @param[in] parameters The parameter set.
+ *
+ * @return The context size in bytes, or 0 if the parameter set is not supported.
+ *
+ * @see picnic_sign_begin()
+ */
+PICNIC_EXPORT size_t PICNIC_CALLING_CONVENTION
+picnic_sign_context_size(picnic_params_t parameters);
+
+/**
+ * Start a signature that is computed step by step.
+ * The signature is computed by calling picnic_sign_step() until it returns 0,
+ * and obtained with picnic_sign_finish(). Each step does a bounded amount of
+ * work, at most one repetition of the MPC simulation, so signing can be
+ * interleaved with other work without threads. The resulting signature is
+ * identical to the one created by picnic_sign(). No memory is allocated.
+ *
+ * The message and the signature buffer must stay valid and must not be
+ * modified until picnic_sign_finish() returns, since the signature buffer is
+ * used as scratch space while signing.
+ *
+ * @param[out] context The signing state, aligned to PICNIC_WORKSPACE_ALIGNMENT bytes.
+ * @param[in] context_len The size of the context, at least
+ * picnic_sign_context_size() bytes.
+ * @param[in] sk      The signer's private key.
+ * @param[in] message The message to be signed.
+ * @param[in] message_len The length of the message, in bytes.
+ * @param[out] signature A buffer to hold the signature, see picnic_sign().
+ * @param[in] signature_len The length of the provided signature buffer, at
+ * least picnic_signature_size() bytes.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error.
+ *
+ * @see picnic_sign_step(), picnic_sign_finish()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign_begin(void* context, size_t context_len,
+                                                              const picnic_privatekey_t* sk,
+                                                              const uint8_t* message,
+                                                              size_t message_len,
+                                                              uint8_t* signature,
+                                                              size_t signature_len);
+
+/**
+ * Perform the next step of a signature started with picnic_sign_begin().
+ *
+ * @param[in,out] context The signing state.
+ *
+ * @return Returns 1 if more steps are required, 0 if the signature is
+ * complete and picnic_sign_finish() can be called, or -1 on error.
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign_step(void* context);
+
+/**
+ * Finish a signature computed with picnic_sign_step() and clear the secret
+ * values in the context.
+ *
+ * @param[in,out] context The signing state.
+ * @param[out] signature_len The number of bytes written to the signature buffer.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error or
+ * that not all steps were performed.
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign_finish(void* context,
+                                                               size_t* signature_len);
+
+/**
+ * Get the number of bytes of a presigned entry, see picnic_presign().
+ *
+ * @param[in] parameters The parameter set.
+ *
+ * @return The entry size in bytes, or 0 if the parameter set is not supported.
+ */
+PICNIC_EXPORT size_t PICNIC_CALLING_CONVENTION picnic_presign_size(picnic_params_t parameters);
+
+/**
+ * Get the number of bytes of the workspace required by picnic_presign().
+ *
+ * @param[in] parameters The parameter set.
+ *
+ * @return The workspace size in bytes, or 0 if the parameter set is not supported.
+ */
+PICNIC_EXPORT size_t PICNIC_CALLING_CONVENTION
+picnic_presign_workspace_size(picnic_params_t parameters);
+
+/**
+ * Precompute the message independent part of a randomized signature.
+ * Salt and root seed are drawn at random instead of being derived from the
+ * message, and the seed trees, random tapes, aux bits, commitments and online
+ * transcripts of all repetitions are computed and condensed into the entry.
+ * picnic_sign_presigned() then only has to hash the message and assemble the
+ * proofs of the opened repetitions. Keeping a pool of entries that is refilled
+ * in the background moves most of the signing time out of the signing path.
+ *
+ * Entries contain secret values and are bound to the key pair. Each entry can
+ * only be used for a single signature.
+ *
+ * @param[in] sk The signer's private key.
+ * @param[out] presign The entry, aligned to PICNIC_WORKSPACE_ALIGNMENT bytes.
+ * @param[in] presign_len The size of the entry, at least picnic_presign_size() bytes.
+ * @param[in] workspace Scratch memory, aligned to PICNIC_WORKSPACE_ALIGNMENT bytes.
+ * @param[in] workspace_len The size of the workspace, at least
+ * picnic_presign_workspace_size() bytes.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error.
+ *
+ * @see picnic_sign_presigned()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_presign(const picnic_privatekey_t* sk,
+                                                           void* presign, size_t presign_len,
+                                                           void* workspace, size_t workspace_len);
+
+/**
+ * Sign a message with an entry computed by picnic_presign().
+ * The entry is cleared, also if signing fails. The signature is randomized and
+ * verifies with picnic_verify().
+ *
+ * @param[in] sk      The signer's private key, the same as for picnic_presign().
+ * @param[in,out] presign The entry.
+ * @param[in] presign_len The size of the entry.
+ * @param[in] message The message to be signed.
+ * @param[in] message_len The length of the message, in bytes.
+ * @param[out] signature A buffer to hold the signature, see picnic_sign().
+ * @param[in,out] signature_len The length of the provided signature buffer.
+ * On success, this is set to the number of bytes written to the signature buffer.
+ * @param[in] workspace Scratch memory, aligned to PICNIC_WORKSPACE_ALIGNMENT bytes.
+ * @param[in] workspace_len The size of the workspace, at least
+ * picnic_sign_workspace_size() bytes.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error.
+ *
+ * @see picnic_presign()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION
+picnic_sign_presigned(const picnic_privatekey_t* sk, void* presign, size_t presign_len,
+                      const uint8_t* message, size_t message_len, uint8_t* signature,
+                      size_t* signature_len, void* workspace, size_t workspace_len);
+
 /**
  * Serialize a public key.
  *
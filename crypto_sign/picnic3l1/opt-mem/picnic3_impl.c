@@ -26,6 +26,28 @@
 #include "picnic3_simulate.h"
 #include "picnic3_tree.h"
 #include "picnic3_types.h"
+#include "randomness.h"
+
+/* Scratch memory of the signer that does not fit into the signature buffer, see sign_picnic3 */
+typedef struct sign_workspace_t {
+  round_commitments_t Cv;
+  uint8_t merkleTmp[PICNIC_NUM_ROUNDS / 2][PICNIC_DIGEST_SIZE];
+  randomTape_t tape;
+  msgs_t msgs;
+} sign_workspace_t;
+
+/* Scratch memory of the verifier, see verify_picnic3. The signature is read in place and only the
+ * state of the current round is kept. */
+typedef struct verify_workspace_t {
+  round_seed_stream_t iSeeds;
+  merkle_stream_t treeCv;
+  parties_seed_tree_storage_t seedStorage;
+  randomTape_t tape;
+  msgs_t msgs;
+  party_commitments_t C;
+  /* Running hash of the Ch commitments, see sign_context_t */
+  hash_context ctx_challenge;
+} verify_workspace_t;
 
 /* Helper functions */
 
@@ -153,7 +175,7 @@ static int indexOf(const uint16_t* list, size_t len, uint16_t value) {
   return -1;
 }
 
-static void setAuxBits(randomTape_t* tapes, uint8_t* input) {
+static void setAuxBits(randomTape_t* tapes, const uint8_t* input) {
   size_t last  = PICNIC_NUM_PARTIES - 1;
   size_t inBit = 0;
 
@@ -250,31 +272,6 @@ static void expandChallenge(uint16_t* challengeC, uint16_t* challengeP, const ui
   }
 }
 
-static void HCP(uint8_t* sigH, uint16_t* challengeC, uint16_t* challengeP, round_commitments_t* Ch,
-                uint8_t* hCv, uint8_t* salt, const uint8_t* pubKey, const uint8_t* plaintext,
-                const uint8_t* message, size_t messageByteLength) {
-  hash_context ctx;
-
-  assert(PICNIC_NUM_OPENED_ROUNDS < PICNIC_NUM_ROUNDS);
-
-  hash_init(&ctx, PICNIC_DIGEST_SIZE);
-  for (size_t t = 0; t < PICNIC_NUM_ROUNDS; t++) {
-    hash_update(&ctx, Ch->hashes[t], PICNIC_DIGEST_SIZE);
-  }
-
-  hash_update(&ctx, hCv, PICNIC_DIGEST_SIZE);
-  hash_update(&ctx, salt, PICNIC_SALT_SIZE);
-  hash_update(&ctx, pubKey, PICNIC_INPUT_SIZE);
-  hash_update(&ctx, plaintext, PICNIC_INPUT_SIZE);
-  hash_update(&ctx, message, messageByteLength);
-  hash_final(&ctx);
-  hash_squeeze(&ctx, sigH, PICNIC_DIGEST_SIZE);
-  /* parts of this hash will be published as challenge so is public anyway */
-  picnic_declassify(sigH, PICNIC_DIGEST_SIZE);
-
-  expandChallenge(challengeC, challengeP, sigH);
-}
-
 static void HCP_sign(hash_context* ctx, uint8_t* sigH, uint16_t* challengeC, uint16_t* challengeP,
                 uint8_t* hCv, uint8_t* salt, const uint8_t* pubKey, const uint8_t* plaintext,
                 const uint8_t* message, size_t messageByteLength) {
@@ -306,166 +303,6 @@ static void getMissingLeavesList(uint16_t* missingLeaves, uint16_t* challengeC)
   }
 }
 
-static int verify_picnic3(signature2_t* sig, const uint8_t* pubKey, const uint8_t* plaintext,
-                          const uint8_t* message, size_t messageByteLength) {
-  msgs_t msgs;
-  memset(msgs.msgs, 0, PICNIC_VIEW_SIZE * PICNIC_NUM_PARTIES);
-  tree_t treeCv;
-  round_commitment_tree_storage_t treeCvStorage;
-  createRoundCommitmentTree(&treeCv, &treeCvStorage);
-  uint16_t challengeC[PICNIC_NUM_OPENED_ROUNDS * sizeof(uint16_t)];
-  uint16_t challengeP[PICNIC_NUM_OPENED_ROUNDS * sizeof(uint16_t)];
-  uint8_t challenge[PICNIC_DIGEST_SIZE];
-  randomTape_t tape;
-  tree_t iSeedsTree;
-  round_seed_tree_storage_t iSeedsStorage;
-  createRoundSeedTree(&iSeedsTree, &iSeedsStorage);
-  int ret           = reconstructRoundSeeds(&iSeedsTree, sig->challengeC, PICNIC_NUM_OPENED_ROUNDS,
-                                  sig->iSeedInfo, sig->iSeedInfoLen, sig->salt, 0);
-  const size_t last = PICNIC_NUM_PARTIES - 1;
-  lowmc_simulate_online_f simulateOnline = lowmc_simulate_online_uint64_129_43;
-
-  party_commitments_t C;
-  round_commitments_t Ch;
-  round_commitments_t Cv;
-  mzd_local_t m_plaintext[1];
-  mzd_local_t m_maskedKey[1];
-  mzd_from_char_array(m_plaintext, plaintext, PICNIC_OUTPUT_SIZE);
-
-  if (ret != 0) {
-    ret = -1;
-    goto Exit;
-  }
-
-  uint8_t* Cv_hashes[PICNIC_NUM_ROUNDS]; // to be able to store NULL pointers sometimes
-  for (uint32_t i = 0; i < PICNIC_NUM_ROUNDS; i++) {
-    Cv_hashes[i] = Cv.hashes[i];
-  }
-
-  /* Populate seeds with values from the signature */
-  size_t proof_index = 0;
-  for (size_t t = 0; t < PICNIC_NUM_ROUNDS; t++) {
-    tree_t seed;
-    parties_seed_tree_storage_t seedStorage;
-    if (!contains(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
-      /* Expand iSeed[t] to seeds for each parties, using a seed tree */
-      generatePartySeeds(&seed, &seedStorage, getLeaf(&iSeedsTree, t), sig->salt, t);
-    } else {
-      /* We don't have the initial seed for the round, but instead a seed
-       * for each unopened party */
-      createPartySeedTree(&seed, &seedStorage);
-      size_t P_index = indexOf(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t);
-      ret =
-          reconstructPartySeeds(&seed, sig->challengeP[P_index], sig->proofs[proof_index].seedInfo,
-                                sig->proofs[proof_index].seedInfoLen, sig->salt, t);
-      if (ret != 0) {
-#if !defined(NDEBUG)
-        printf("Failed to reconstruct seeds for round " SIZET_FMT "\n", t);
-#endif
-        ret = -1;
-        goto Exit;
-      }
-    }
-    /* Commit */
-
-    /* Compute random tapes for all parties.  One party for each repitition
-     * challengeC will have a bogus seed; but we won't use that party's
-     * random tape. */
-    createRandomTapes(&tape, getLeaves(&seed), sig->salt, t);
-
-    if (!contains(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
-      /* We're given iSeed, have expanded the seeds, compute aux from scratch so we can comnpte
-       * Com[t] */
-      computeAuxTape(&tape, NULL);
-      for (size_t j = 0; j < last; j++) {
-        commit(C.hashes[j], getLeaf(&seed, j), NULL, sig->salt, t, j);
-      }
-      commit(C.hashes[last], getLeaf(&seed, last), tape.aux_bits, sig->salt, t, last);
-      /* after we have checked the tape, we do not need it anymore for this opened iteration */
-    } else {
-      /* We're given all seeds and aux bits, execpt for the unopened
-       * party, we get their commitment */
-      size_t unopened = sig->challengeP[indexOf(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)];
-      for (size_t j = 0; j < last; j++) {
-        commit(C.hashes[j], getLeaf(&seed, j), NULL, sig->salt, t, j);
-      }
-      if (last != unopened) {
-        commit(C.hashes[last], getLeaf(&seed, last), sig->proofs[proof_index].aux, sig->salt, t,
-               last);
-      }
-
-      memcpy(C.hashes[unopened], sig->proofs[proof_index].C, PICNIC_DIGEST_SIZE);
-    }
-    /* hash commitments every four iterations if possible, for the last few do single commitments
-     */
-    commit_h(Ch.hashes[t], &C);
-
-    /* Commit to the views */
-    if (!contains(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
-      Cv_hashes[t] = NULL;
-    }
-    if (contains(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
-      /* 2. When t is in C, we have everything we need to re-compute the view, as an honest signer
-       * would.
-       * We simulate the MPC with one fewer party; the unopned party's values are all set to zero.
-       */
-      size_t unopened = sig->challengeP[indexOf(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)];
-      uint8_t* input  = sig->proofs[proof_index].input;
-      setAuxBits(&tape, sig->proofs[proof_index].aux);
-      memset(tape.tape[unopened], 0, 2 * PICNIC_VIEW_SIZE);
-      memcpy(msgs.msgs[unopened], sig->proofs[proof_index].msgs, PICNIC_VIEW_SIZE);
-      mzd_from_char_array(m_maskedKey, input, PICNIC_INPUT_SIZE);
-      msgs.unopened = unopened;
-      msgs.pos      = 0;
-      ret           = simulateOnline(m_maskedKey, &tape, &msgs, m_plaintext, pubKey);
-
-      if (ret != 0) {
-#if !defined(NDEBUG)
-        printf("MPC simulation failed for round " SIZET_FMT ", signature invalid\n", t);
-#endif
-        ret = -1;
-        goto Exit;
-      }
-      commit_v(Cv.hashes[t], sig->proofs[proof_index].input, &msgs);
-      proof_index++;
-    }
-  }
-
-  size_t missingLeavesSize = PICNIC_NUM_ROUNDS - PICNIC_NUM_OPENED_ROUNDS;
-  uint16_t missingLeaves[PICNIC_NUM_ROUNDS - PICNIC_NUM_OPENED_ROUNDS];
-  getMissingLeavesList(missingLeaves, sig->challengeC);
-  ret = addMerkleNodes(&treeCv, missingLeaves, missingLeavesSize, sig->cvInfo, sig->cvInfoLen);
-  if (ret != 0) {
-    ret = -1;
-    goto Exit;
-  }
-
-  ret = verifyMerkleTree(&treeCv, Cv_hashes, sig->salt);
-  if (ret != 0) {
-    ret = -1;
-    goto Exit;
-  }
-
-  /* Compute the challenge; two lists of integers */
-  HCP(challenge, challengeC, challengeP, &Ch, treeCv.nodes[0], sig->salt, pubKey, plaintext,
-      message, messageByteLength);
-
-  /* Compare to challenge from signature */
-  if (memcmp(sig->challenge, challenge, PICNIC_DIGEST_SIZE) != 0) {
-#if !defined(NDEBUG)
-    printf("Challenge does not match, signature invalid\n");
-#endif
-    ret = -1;
-    goto Exit;
-  }
-
-  ret = EXIT_SUCCESS;
-
-Exit:
-
-  return ret;
-}
-
 static void computeSaltAndRootSeed(uint8_t* saltAndRoot, size_t saltAndRootLength,
                                    const uint8_t* privateKey, const uint8_t* pubKey,
                                    const uint8_t* plaintext, const uint8_t* message,
@@ -482,347 +319,660 @@ static void computeSaltAndRootSeed(uint8_t* saltAndRoot, size_t saltAndRootLengt
   hash_squeeze(&ctx, saltAndRoot, saltAndRootLength);
 }
 
-static int sign_picnic3(const uint8_t* privateKey, const uint8_t* pubKey, const uint8_t* plaintext,
-                        const uint8_t* message, size_t messageByteLength, signature2_t* sig, uint8_t* tmp) {
-  int ret = 0;
-  uint8_t saltAndRoot[PICNIC_SEED_SIZE + PICNIC_SALT_SIZE];
+/* Number of bytes of the serialized proofs for the opened rounds */
+static size_t proofsSize(const uint16_t* challengeP) {
+  size_t bytesRequired = 0;
+  for (size_t i = 0; i < PICNIC_NUM_OPENED_ROUNDS; i++) {
+    if (challengeP[i] != (PICNIC_NUM_PARTIES - 1)) {
+      bytesRequired += PICNIC_VIEW_SIZE;
+    }
+    bytesRequired += PICNIC_NUM_PARTIES_LOG2 * PICNIC_SEED_SIZE;
+    bytesRequired += PICNIC_DIGEST_SIZE;
+    bytesRequired += PICNIC_INPUT_SIZE;
+    bytesRequired += PICNIC_VIEW_SIZE;
+  }
+  return bytesRequired;
+}
 
-  computeSaltAndRootSeed(saltAndRoot, PICNIC_SEED_SIZE + PICNIC_SALT_SIZE, privateKey, pubKey,
-                         plaintext, message, messageByteLength);
-  memcpy(sig->salt, saltAndRoot, PICNIC_SALT_SIZE);
+/* Phases of a step-wise signature, see sign_step */
+typedef enum {
+  SIGN_PHASE_COMMIT,    /* one repetition of the preprocessing and online phase per step */
+  SIGN_PHASE_CHALLENGE, /* Merkle root of Cv and the challenge */
+  SIGN_PHASE_OPEN,      /* seed and Merkle tree openings */
+  SIGN_PHASE_PROVE,     /* one opened repetition per step */
+  SIGN_PHASE_DONE,
+} sign_phase_t;
+
+/* State of a signature that is computed step by step. Everything that lives across repetitions
+ * is kept here, so that a step can return to the caller after each repetition. */
+typedef struct sign_context_t {
+  sign_workspace_t ws;
+  /* Running hash of the Ch commitments, will be used to compute challenge. Uses less stack than
+   * storing them all, then hashing. */
+  hash_context ctx_challenge;
   tree_t iSeedsTree;
-  /* Allocate things to tmp buffer. tmp is PICNIC_SIGNATURE_SIZE_Picnic3_L1 bytes */
-  round_seed_tree_storage_t* iSeedsTreeStorage = (round_seed_tree_storage_t*) tmp;
-  parties_seed_tree_storage_t* seedTreeStorage = (parties_seed_tree_storage_t*) (tmp + sizeof(round_seed_tree_storage_t));
-  party_commitments_t* C = (party_commitments_t*) (tmp + sizeof(round_seed_tree_storage_t) + sizeof(parties_seed_tree_storage_t));
-  
-  generateRoundSeeds(&iSeedsTree, iSeedsTreeStorage, saltAndRoot + PICNIC_SALT_SIZE, sig->salt, 0);
-  uint8_t** iSeeds = getLeaves(&iSeedsTree);
-
-  randomTape_t tape;
-  tree_t seed;
-
-  lowmc_simulate_online_f simulateOnline = lowmc_simulate_online_uint64_129_43;
-  uint8_t input[PICNIC_INPUT_SIZE];
-  msgs_t msgs;
-
-  
-  /* Commitments to the commitments and views */
-  hash_context ctx_challenge;  /* Running hash of the Ch commitments, will be used to compute challenge. Uses less stack than storing them all, then hashing. */
-  hash_init(&ctx_challenge, PICNIC_DIGEST_SIZE);  
-  round_commitments_t* Cv = (round_commitments_t*) &sig->proofs; 
-  uint8_t Ch_hash[PICNIC_DIGEST_SIZE];
+  uint8_t saltAndRoot[PICNIC_SALT_SIZE + PICNIC_SEED_SIZE];
+  uint8_t privateKey[PICNIC_INPUT_SIZE];
+  uint8_t pubKey[PICNIC_OUTPUT_SIZE];
+  uint8_t plaintext[PICNIC_OUTPUT_SIZE];
+  const uint8_t* message;
+  size_t messageByteLength;
+  uint8_t* sigBytes;
+  size_t sigBytesLen;
+  size_t sigPos;
+  size_t bytesRequired;
+  uint16_t challengeC[PICNIC_NUM_OPENED_ROUNDS];
+  uint16_t challengeP[PICNIC_NUM_OPENED_ROUNDS];
+  uint8_t openedSeeds[PICNIC_NUM_OPENED_ROUNDS][PICNIC_SEED_SIZE];
+  uint8_t treeCvRoot[PICNIC_DIGEST_SIZE];
+  size_t t;
+  sign_phase_t phase;
+  int ret;
+} sign_context_t;
+
+/* Message independent part of a randomized signature: all commitments of a signature with random
+ * salt and root seed, up to the point where the challenge hash needs the message. Single use, see
+ * impl_presign_picnic3. */
+#define PRESIGN_READY 0x50524531
+typedef struct presign_t {
+  uint32_t ready;
+  uint8_t saltAndRoot[PICNIC_SALT_SIZE + PICNIC_SEED_SIZE];
+  uint8_t pubKey[PICNIC_OUTPUT_SIZE];
+  uint8_t plaintext[PICNIC_OUTPUT_SIZE];
+  hash_context ctx_challenge;
+  round_commitments_t Cv;
+} presign_t;
+
+/* Scratch memory of impl_presign_picnic3; sigBytes replaces the signature buffer that holds the
+ * seed trees while signing */
+typedef struct presign_workspace_t {
+  sign_context_t ctx;
+  uint8_t sigBytes[PICNIC_SIGNATURE_SIZE_Picnic3_L1];
+} presign_workspace_t;
+
+/* The round seed tree lives at the end of the signature buffer (aligned to 8 bytes) */
+static round_seed_tree_storage_t* iSeedsTreeStorage(uint8_t* sigBytes) {
+  const size_t iSeedsTreeOffset =
+      (PICNIC_SIGNATURE_SIZE_Picnic3_L1 - sizeof(round_seed_tree_storage_t)) & ~(size_t)7;
+  return (round_seed_tree_storage_t*)(sigBytes + iSeedsTreeOffset);
+}
 
+/* Runs the preprocessing and the online phase of repetition t. On return, tape holds the aux bits,
+ * input the masked key and msgs the broadcast messages of all parties. */
+static int simulateRepetition(sign_context_t* ctx, tree_t* seed,
+                              parties_seed_tree_storage_t* seedTreeStorage, uint8_t* iSeed,
+                              size_t t, uint8_t* input) {
+  randomTape_t* tape = &ctx->ws.tape;
+  msgs_t* msgs       = &ctx->ws.msgs;
+  uint8_t* salt      = ctx->saltAndRoot;
   mzd_local_t m_plaintext[1];
   mzd_local_t m_maskedKey[1];
-  mzd_from_char_array(m_plaintext, plaintext, PICNIC_OUTPUT_SIZE);
-  
-  for (size_t t = 0; t < PICNIC_NUM_ROUNDS; t++) {
-    generatePartySeeds(&seed, seedTreeStorage, iSeeds[t], sig->salt, t);
-    createRandomTapes(&tape, getLeaves(&seed), sig->salt, t);
-    /* Preprocessing; compute aux tape for the N-th player, for each parallel rep */
-    computeAuxTape(&tape, input);
-    /* Commit to seeds and aux bits */
-    const size_t last = PICNIC_NUM_PARTIES - 1;
-    for (size_t j = 0; j < last; j++) {
-      commit(C->hashes[j], getLeaf(&seed, j), NULL, sig->salt, t, j);
-    }
-    commit(C->hashes[last], getLeaf(&seed, last), tape.aux_bits, sig->salt, t, last);
 
-    /* Simulate the online phase of the MPC */
-    uint8_t* maskedKey = input;
+  generatePartySeeds(seed, seedTreeStorage, iSeed, salt, t);
+  createRandomTapes(tape, getLeaves(seed), salt, t);
+  /* Preprocessing; compute aux tape for the N-th player, for each parallel rep */
+  computeAuxTape(tape, input);
 
-    xor_byte_array(maskedKey, maskedKey, privateKey,
-                   PICNIC_INPUT_SIZE); // maskedKey += privateKey
-    for (size_t i = LOWMC_N; i < PICNIC_INPUT_SIZE * 8; i++) {
-      setBit(maskedKey, i, 0);
-    }
-    mzd_from_char_array(m_maskedKey, maskedKey, PICNIC_INPUT_SIZE); 
+  /* Simulate the online phase of the MPC */
+  uint8_t* maskedKey = input;
 
-    msgs.pos      = 0;
-    msgs.unopened = -1;
-    memset(msgs.msgs, 0, PICNIC_VIEW_SIZE * PICNIC_NUM_PARTIES);
-    int rv = simulateOnline(m_maskedKey, &tape, &msgs, m_plaintext, pubKey);
-    if (rv != 0) {
+  xor_byte_array(maskedKey, maskedKey, ctx->privateKey,
+                 PICNIC_INPUT_SIZE); // maskedKey += privateKey
+  for (size_t i = LOWMC_N; i < PICNIC_INPUT_SIZE * 8; i++) {
+    setBit(maskedKey, i, 0);
+  }
+  mzd_from_char_array(m_maskedKey, maskedKey, PICNIC_INPUT_SIZE);
+  mzd_from_char_array(m_plaintext, ctx->plaintext, PICNIC_OUTPUT_SIZE);
+
+  msgs->pos      = 0;
+  msgs->unopened = -1;
+  memset(msgs->msgs, 0, PICNIC_VIEW_SIZE * PICNIC_NUM_PARTIES);
+  int rv = lowmc_simulate_online_uint64_129_43(m_maskedKey, tape, msgs, m_plaintext, ctx->pubKey);
+  if (rv != 0) {
 #if !defined(NDEBUG)
-      printf("MPC simulation failed in round " SIZET_FMT ", aborting signature\n", t);
+    printf("MPC simulation failed in round " SIZET_FMT ", aborting signature\n", t);
 #endif
-      ret = -1;
-    }
+    return -1;
+  }
+  return 0;
+}
 
-    commit_h(Ch_hash, C);
-    hash_update(&ctx_challenge, Ch_hash, PICNIC_DIGEST_SIZE);
-    commit_v(Cv->hashes[t], input, &msgs);
+/* Signs and writes the signature directly into sigBytes, without an intermediate copy.
+ * sigBytes must hold at least PICNIC_SIGNATURE_SIZE_Picnic3_L1 bytes, since it is also used as
+ * scratch space: the round seed tree lives at the end of the buffer, while the party seed tree and
+ * the party commitments of the current round live at the beginning. Both are dead by the time the
+ * challenge, salt and seed information are written to the front of the buffer. All other large
+ * buffers are kept in the context.
+ *
+ * sign_begin only derives the salt and the round seeds, the work is done by repeated calls of
+ * sign_step, see the phases in sign_phase_t. */
+static void sign_init(sign_context_t* ctx, const uint8_t* privateKey, const uint8_t* pubKey,
+                      const uint8_t* plaintext, const uint8_t* message, size_t messageByteLength,
+                      uint8_t* sigBytes, size_t sigBytesLen) {
+  memcpy(ctx->privateKey, privateKey, PICNIC_INPUT_SIZE);
+  memcpy(ctx->pubKey, pubKey, PICNIC_OUTPUT_SIZE);
+  memcpy(ctx->plaintext, plaintext, PICNIC_OUTPUT_SIZE);
+  ctx->message           = message;
+  ctx->messageByteLength = messageByteLength;
+  ctx->sigBytes          = sigBytes;
+  ctx->sigBytesLen       = sigBytesLen;
+  ctx->t                 = 0;
+  ctx->phase             = SIGN_PHASE_COMMIT;
+  ctx->ret               = 0;
+}
+
+static void sign_begin(sign_context_t* ctx, const uint8_t* privateKey, const uint8_t* pubKey,
+                       const uint8_t* plaintext, const uint8_t* message, size_t messageByteLength,
+                       uint8_t* sigBytes, size_t sigBytesLen) {
+  sign_init(ctx, privateKey, pubKey, plaintext, message, messageByteLength, sigBytes, sigBytesLen);
+  computeSaltAndRootSeed(ctx->saltAndRoot, PICNIC_SEED_SIZE + PICNIC_SALT_SIZE, privateKey,
+                         pubKey, plaintext, message, messageByteLength);
+  generateRoundSeeds(&ctx->iSeedsTree, iSeedsTreeStorage(sigBytes),
+                     ctx->saltAndRoot + PICNIC_SALT_SIZE, ctx->saltAndRoot, 0);
+  hash_init(&ctx->ctx_challenge, PICNIC_DIGEST_SIZE);
+}
+
+/* Commit to seeds, aux bits and views of repetition ctx->t */
+static void sign_step_commit(sign_context_t* ctx) {
+  parties_seed_tree_storage_t* seedTreeStorage = (parties_seed_tree_storage_t*)ctx->sigBytes;
+  party_commitments_t* C =
+      (party_commitments_t*)(ctx->sigBytes + sizeof(parties_seed_tree_storage_t));
+  assert(sizeof(parties_seed_tree_storage_t) + sizeof(party_commitments_t) <=
+         (size_t)((uint8_t*)iSeedsTreeStorage(ctx->sigBytes) - ctx->sigBytes));
+  randomTape_t* tape = &ctx->ws.tape;
+  uint8_t* salt      = ctx->saltAndRoot;
+  const size_t t     = ctx->t;
+  tree_t seed;
+  uint8_t input[PICNIC_INPUT_SIZE];
+  uint8_t Ch_hash[PICNIC_DIGEST_SIZE];
+
+  if (simulateRepetition(ctx, &seed, seedTreeStorage, getLeaves(&ctx->iSeedsTree)[t], t, input)) {
+    ctx->ret = -1;
   }
 
-  /* Create a Merkle tree with Cv as the leaves */
-  tree_t treeCv;  /* treeCv is short-lived, we can store it in sig->iSeedInfo before we use that field. */
-  round_commitment_tree_storage_light_t* treeCvStorage = (round_commitment_tree_storage_light_t*) (sig->iSeedInfo); 
-  uint8_t* treeCvRoot = (uint8_t*) (sig->iSeedInfo + sizeof(round_commitment_tree_storage_light_t));
-  createRoundCommitmentTreeLight(&treeCv, treeCvStorage);
-  computeMerkleRoot(treeCvRoot, Cv->hashes, sig->salt);
+  /* Commit to seeds and aux bits */
+  const size_t last = PICNIC_NUM_PARTIES - 1;
+  for (size_t j = 0; j < last; j++) {
+    commit(C->hashes[j], getLeaf(&seed, j), NULL, salt, t, j);
+  }
+  commit(C->hashes[last], getLeaf(&seed, last), tape->aux_bits, salt, t, last);
+
+  commit_h(Ch_hash, C);
+  hash_update(&ctx->ctx_challenge, Ch_hash, PICNIC_DIGEST_SIZE);
+  commit_v(ctx->ws.Cv.hashes[t], input, &ctx->ws.msgs);
+
+  if (++ctx->t == PICNIC_NUM_ROUNDS) {
+    ctx->phase = SIGN_PHASE_CHALLENGE;
+  }
+}
+
+static void sign_step_challenge(sign_context_t* ctx) {
+  /* Compute the root of the Merkle tree with Cv as the leaves */
+  computeMerkleRoot(ctx->treeCvRoot, ctx->ws.Cv.hashes, ctx->saltAndRoot, ctx->ws.merkleTmp);
 
   /* Compute the challenge; two lists of integers */
-  uint16_t* challengeC = sig->challengeC;
-  uint16_t* challengeP = sig->challengeP;
-  HCP_sign(&ctx_challenge, sig->challenge, challengeC, challengeP, treeCvRoot, sig->salt, pubKey, plaintext,
-      message, messageByteLength);
+  uint8_t challenge[PICNIC_DIGEST_SIZE];
+  HCP_sign(&ctx->ctx_challenge, challenge, ctx->challengeC, ctx->challengeP, ctx->treeCvRoot,
+           ctx->saltAndRoot, ctx->pubKey, ctx->plaintext, ctx->message, ctx->messageByteLength);
+
+  const size_t missingLeavesSize = PICNIC_NUM_ROUNDS - PICNIC_NUM_OPENED_ROUNDS;
+  uint16_t missingLeaves[PICNIC_NUM_ROUNDS - PICNIC_NUM_OPENED_ROUNDS];
+  getMissingLeavesList(missingLeaves, ctx->challengeC);
+
+  const size_t iSeedInfoLen = revealRoundSeedsSize(ctx->challengeC, PICNIC_NUM_OPENED_ROUNDS);
+  const size_t cvInfoLen    = openMerkleTreeSize(missingLeaves, missingLeavesSize);
+  ctx->bytesRequired = PICNIC_DIGEST_SIZE + PICNIC_SALT_SIZE + iSeedInfoLen + cvInfoLen +
+                       proofsSize(ctx->challengeP);
+  if (ctx->sigBytesLen < ctx->bytesRequired) {
+    ctx->ret   = -1;
+    ctx->phase = SIGN_PHASE_DONE;
+    return;
+  }
+
+  /* The challenge and salt are written to the beginning of the signature, the party seed tree and
+   * C living there are not needed anymore. */
+  memcpy(ctx->sigBytes, challenge, PICNIC_DIGEST_SIZE);
+  memcpy(ctx->sigBytes + PICNIC_DIGEST_SIZE, ctx->saltAndRoot, PICNIC_SALT_SIZE);
+  ctx->sigPos = PICNIC_DIGEST_SIZE + PICNIC_SALT_SIZE;
+  ctx->phase  = SIGN_PHASE_OPEN;
+}
+
+static void sign_step_open(sign_context_t* ctx) {
+  randomTape_t* tape   = &ctx->ws.tape;
+  uint8_t* salt        = ctx->saltAndRoot;
+  uint8_t** iSeeds     = getLeaves(&ctx->iSeedsTree);
+  uint16_t* challengeC = ctx->challengeC;
+  uint8_t* sigPos      = ctx->sigBytes + ctx->sigPos;
 
-  /* Send information required for checking commitments with Merkle tree.
-   * The commitments the verifier will be missing are those not in challengeC. */
   const size_t missingLeavesSize = PICNIC_NUM_ROUNDS - PICNIC_NUM_OPENED_ROUNDS;
   uint16_t missingLeaves[PICNIC_NUM_ROUNDS - PICNIC_NUM_OPENED_ROUNDS];
   getMissingLeavesList(missingLeaves, challengeC);
-  computeMerkleTreeOpening(&treeCv, Cv->hashes, missingLeaves, missingLeavesSize, sig->cvInfo, &sig->cvInfoLen, sig->salt);
+  const size_t iSeedInfoLen = revealRoundSeedsSize(challengeC, PICNIC_NUM_OPENED_ROUNDS);
+  const size_t cvInfoLen    = openMerkleTreeSize(missingLeaves, missingLeavesSize);
 
-  /* Reveal iSeeds for unopened rounds, those in {0..T-1} \ ChallengeC. */
-  sig->iSeedInfoLen = revealRoundSeeds(&iSeedsTree, challengeC, PICNIC_NUM_OPENED_ROUNDS,
-                                       sig->iSeedInfo, sizeof(sig->iSeedInfo));
+  /* Keep the initial seeds of the opened rounds, the round seed tree is overwritten below */
+  for (size_t i = 0; i < PICNIC_NUM_OPENED_ROUNDS; i++) {
+    memcpy(ctx->openedSeeds[i], iSeeds[challengeC[i]], PICNIC_SEED_SIZE);
+  }
 
-  /* Assemble the proof */
-  size_t proof_index = 0;
-  for (size_t t = 0; t < PICNIC_NUM_ROUNDS; t++) {
-    if (contains(challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
-      generatePartySeeds(&seed, seedTreeStorage, iSeeds[t], sig->salt, t);
-      createRandomTapes(&tape, getLeaves(&seed), sig->salt, t);
-      /* Preprocessing; compute aux tape for the N-th player, for each parallel rep */
-      computeAuxTape(&tape, input);
-      /* Simulate the online phase of the MPC */
-      uint8_t* maskedKey = input;
-
-      xor_byte_array(maskedKey, maskedKey, privateKey,
-                     PICNIC_INPUT_SIZE); // maskedKey += privateKey
-      for (size_t i = LOWMC_N; i < PICNIC_INPUT_SIZE * 8; i++) {
-        setBit(maskedKey, i, 0);
-      }
-      mzd_from_char_array(m_maskedKey, maskedKey, PICNIC_INPUT_SIZE);
+  /* Reveal iSeeds for unopened rounds, those in {0..T-1} \ ChallengeC. If the output would overlap
+   * the round seed tree (only possible with 64-bit pointers), it is staged in the unused tapes. */
+  if (sigPos + iSeedInfoLen <= (uint8_t*)iSeedsTreeStorage(ctx->sigBytes)) {
+    revealRoundSeeds(&ctx->iSeedsTree, challengeC, PICNIC_NUM_OPENED_ROUNDS, sigPos,
+                     iSeedInfoLen);
+  } else {
+    assert(iSeedInfoLen <= sizeof(tape->tape));
+    revealRoundSeeds(&ctx->iSeedsTree, challengeC, PICNIC_NUM_OPENED_ROUNDS, tape->tape[0],
+                     sizeof(tape->tape));
+    memcpy(sigPos, tape->tape[0], iSeedInfoLen);
+  }
+  sigPos += iSeedInfoLen;
 
-      msgs.pos      = 0;
-      msgs.unopened = -1;
-      memset(msgs.msgs, 0, PICNIC_VIEW_SIZE * PICNIC_NUM_PARTIES);
-      int rv = simulateOnline(m_maskedKey, &tape, &msgs, m_plaintext, pubKey);
-      if (rv != 0) {
-#if !defined(NDEBUG)
-        printf("MPC simulation failed in round " SIZET_FMT ", aborting signature\n", t);
-#endif
-        ret = -1;
-      }
+  /* Send information required for checking commitments with Merkle tree.
+   * The commitments the verifier will be missing are those not in challengeC. */
+  tree_t treeCv;  /* treeCv is short-lived, we can store it in msgs before we use that again. */
+  round_commitment_tree_storage_light_t* treeCvStorage =
+      (round_commitment_tree_storage_light_t*)ctx->ws.msgs.msgs;
+  size_t cvInfoWritten = 0;
+  createRoundCommitmentTreeLight(&treeCv, treeCvStorage);
+  computeMerkleTreeOpening(&treeCv, ctx->ws.Cv.hashes, missingLeaves, missingLeavesSize, sigPos,
+                           &cvInfoWritten, salt, ctx->ws.merkleTmp);
+  assert(cvInfoWritten == cvInfoLen);
+  sigPos += cvInfoLen;
+
+  ctx->sigPos = sigPos - ctx->sigBytes;
+  ctx->t      = 0;
+  ctx->phase  = SIGN_PHASE_PROVE;
+}
 
-      proof2_t* proof = &sig->proofs[proof_index];
-      proof_index++;
-      size_t P_index       = indexOf(challengeC, PICNIC_NUM_OPENED_ROUNDS, t);
-      proof->unOpenedIndex = challengeP[P_index];
+/* Assemble the proof of the next opened repetition in place. Cv is not needed anymore, so it
+ * holds the party seed tree. */
+static void sign_step_prove(sign_context_t* ctx) {
+  parties_seed_tree_storage_t* seedTreeStorage = (parties_seed_tree_storage_t*)ctx->ws.Cv.hashes;
+  randomTape_t* tape = &ctx->ws.tape;
+  uint8_t* sigPos    = ctx->sigBytes + ctx->sigPos;
+  tree_t seed;
+  uint8_t input[PICNIC_INPUT_SIZE];
 
-      proof->seedInfoLen =
-          revealPartySeeds(&seed, challengeP[P_index], proof->seedInfo, sizeof(proof->seedInfo));
+  /* proofs are ordered by repetition */
+  size_t t = ctx->t;
+  while (!contains(ctx->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
+    t++;
+  }
 
-      size_t last = PICNIC_NUM_PARTIES - 1;
-      if (challengeP[P_index] != last) {
-        memcpy(proof->aux, tape.aux_bits, PICNIC_VIEW_SIZE);
-      }
+  size_t P_index = indexOf(ctx->challengeC, PICNIC_NUM_OPENED_ROUNDS, t);
+  if (simulateRepetition(ctx, &seed, seedTreeStorage, ctx->openedSeeds[P_index], t, input)) {
+    ctx->ret = -1;
+  }
 
-      memcpy(proof->input, input, PICNIC_INPUT_SIZE);
-      memcpy(proof->msgs, msgs.msgs[challengeP[P_index]], PICNIC_VIEW_SIZE);
-
-      /* recompute commitment of unopened party since we did not store it for memory optimization
-       */
-      if (proof->unOpenedIndex == PICNIC_NUM_PARTIES - 1) {
-        commit(proof->C, getLeaf(&seed, proof->unOpenedIndex), tape.aux_bits, sig->salt, t,
-               proof->unOpenedIndex);
-      } else {
-        commit(proof->C, getLeaf(&seed, proof->unOpenedIndex), NULL, sig->salt, t,
-               proof->unOpenedIndex);
-      }
-    }
+  const uint16_t unOpenedIndex = ctx->challengeP[P_index];
+  sigPos +=
+      revealPartySeeds(&seed, unOpenedIndex, sigPos, PICNIC_NUM_PARTIES_LOG2 * PICNIC_SEED_SIZE);
+
+  const size_t last = PICNIC_NUM_PARTIES - 1;
+  if (unOpenedIndex != last) {
+    memcpy(sigPos, tape->aux_bits, PICNIC_VIEW_SIZE);
+    sigPos += PICNIC_VIEW_SIZE;
   }
 
-  return ret;
+  memcpy(sigPos, input, PICNIC_INPUT_SIZE);
+  sigPos += PICNIC_INPUT_SIZE;
+  memcpy(sigPos, ctx->ws.msgs.msgs[unOpenedIndex], PICNIC_VIEW_SIZE);
+  sigPos += PICNIC_VIEW_SIZE;
+
+  /* recompute commitment of unopened party since we did not store it for memory optimization
+   */
+  commit(sigPos, getLeaf(&seed, unOpenedIndex), (unOpenedIndex == last) ? tape->aux_bits : NULL,
+         ctx->saltAndRoot, t, unOpenedIndex);
+  sigPos += PICNIC_DIGEST_SIZE;
+
+  ctx->sigPos = sigPos - ctx->sigBytes;
+  ctx->t      = t + 1;
+  if (ctx->sigPos == ctx->bytesRequired) {
+    ctx->phase = SIGN_PHASE_DONE;
+  }
 }
 
-static int arePaddingBitsZero(uint8_t* data, size_t byteLength, size_t bitLength) {
-  return !check_padding_bits(data[byteLength - 1], byteLength * 8 - bitLength);
+/* Returns 1 if more steps are required and 0 once the signature is complete */
+static int sign_step(sign_context_t* ctx) {
+  switch (ctx->phase) {
+  case SIGN_PHASE_COMMIT:
+    sign_step_commit(ctx);
+    break;
+  case SIGN_PHASE_CHALLENGE:
+    sign_step_challenge(ctx);
+    break;
+  case SIGN_PHASE_OPEN:
+    sign_step_open(ctx);
+    break;
+  case SIGN_PHASE_PROVE:
+    sign_step_prove(ctx);
+    break;
+  default:
+    break;
+  }
+  return ctx->phase != SIGN_PHASE_DONE;
 }
 
-static int deserializeSignature2(signature2_t* sig, const uint8_t* sigBytes, size_t sigBytesLen) {
-  /* Read the challenge and salt */
-  size_t bytesRequired = PICNIC_DIGEST_SIZE + PICNIC_SALT_SIZE;
+static int sign_finish(sign_context_t* ctx, size_t* sigBytesLen) {
+  int ret = ctx->ret;
+  if (ret == 0) {
+    assert(ctx->sigPos == ctx->bytesRequired);
+    *sigBytesLen = ctx->bytesRequired;
+  }
+  memset(ctx->privateKey, 0, sizeof(ctx->privateKey));
+  memset(ctx->saltAndRoot, 0, sizeof(ctx->saltAndRoot));
+  ctx->phase = SIGN_PHASE_DONE;
+  return ret;
+}
 
-  if (sigBytesLen < bytesRequired) {
-    return EXIT_FAILURE;
+static int sign_picnic3(const uint8_t* privateKey, const uint8_t* pubKey, const uint8_t* plaintext,
+                        const uint8_t* message, size_t messageByteLength, uint8_t* sigBytes,
+                        size_t* sigBytesLen, sign_context_t* ctx) {
+  sign_begin(ctx, privateKey, pubKey, plaintext, message, messageByteLength, sigBytes,
+             *sigBytesLen);
+  while (sign_step(ctx)) {
   }
+  return sign_finish(ctx, sigBytesLen);
+}
 
-  memcpy(sig->challenge, sigBytes, PICNIC_DIGEST_SIZE);
-  sigBytes += PICNIC_DIGEST_SIZE;
-  memcpy(sig->salt, sigBytes, PICNIC_SALT_SIZE);
-  sigBytes += PICNIC_SALT_SIZE;
+static int arePaddingBitsZero(const uint8_t* data, size_t byteLength, size_t bitLength) {
+  return !check_padding_bits(data[byteLength - 1], byteLength * 8 - bitLength);
+}
 
-  expandChallenge(sig->challengeC, sig->challengeP, sig->challenge);
+/* Proof of an opened round, pointing into the signature */
+typedef struct proof_view_t {
+  const uint8_t* seedInfo;
+  const uint8_t* aux; /* NULL if the last party is unopened */
+  const uint8_t* input;
+  const uint8_t* msgs;
+  const uint8_t* C;
+} proof_view_t;
+
+/* Parses the next proof at *sigPos and checks its padding bits */
+static int readProof(proof_view_t* proof, const uint8_t** sigPos, uint16_t unopened) {
+  const uint8_t* pos = *sigPos;
+
+  proof->seedInfo = pos;
+  pos += PICNIC_NUM_PARTIES_LOG2 * PICNIC_SEED_SIZE;
+  proof->aux = NULL;
+  if (unopened != PICNIC_NUM_PARTIES - 1) {
+    proof->aux = pos;
+    pos += PICNIC_VIEW_SIZE;
+    if (!arePaddingBitsZero(proof->aux, PICNIC_VIEW_SIZE, 3 * LOWMC_R * LOWMC_M)) {
+#if !defined(NDEBUG)
+      printf("%s: failed while deserializing aux bits\n", __func__);
+#endif
+      return -1;
+    }
+  }
+  proof->input = pos;
+  pos += PICNIC_INPUT_SIZE;
+  if (!arePaddingBitsZero(proof->input, PICNIC_INPUT_SIZE, LOWMC_N)) {
+#if !defined(NDEBUG)
+    printf("%s: failed while deserializing input bits\n", __func__);
+#endif
+    return -1;
+  }
+  proof->msgs = pos;
+  pos += PICNIC_VIEW_SIZE;
+  if (!arePaddingBitsZero(proof->msgs, PICNIC_VIEW_SIZE, 3 * LOWMC_R * LOWMC_M)) {
+#if !defined(NDEBUG)
+    printf("%s: failed while deserializing msgs bits\n", __func__);
+#endif
+    return -1;
+  }
+  proof->C = pos;
+  pos += PICNIC_DIGEST_SIZE;
 
-  /* Add size of iSeeds tree data */
-  sig->iSeedInfoLen = revealRoundSeedsSize(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS);
-  bytesRequired += sig->iSeedInfoLen;
+  *sigPos = pos;
+  return 0;
+}
 
-  /* Add the size of the Cv Merkle tree data */
-  size_t missingLeavesSize = PICNIC_NUM_ROUNDS - PICNIC_NUM_OPENED_ROUNDS;
-  uint16_t missingLeaves[PICNIC_NUM_ROUNDS - PICNIC_NUM_OPENED_ROUNDS];
-  getMissingLeavesList(missingLeaves, sig->challengeC);
-  sig->cvInfoLen = openMerkleTreeSize(missingLeaves, missingLeavesSize);
-  bytesRequired += sig->cvInfoLen;
+/* Verifies the signature directly from sigBytes. The rounds are processed in order: the seeds of
+ * unopened rounds are expanded from the revealed round seeds when the round is reached, the proofs
+ * of opened rounds are parsed as they come up, Ch is absorbed into the challenge hash and Cv into
+ * a streaming Merkle root. Neither the signature nor any of the round trees is held in memory. */
+static int verify_picnic3(const uint8_t* sigBytes, size_t sigBytesLen, const uint8_t* pubKey,
+                          const uint8_t* plaintext, const uint8_t* message,
+                          size_t messageByteLength, verify_workspace_t* ws) {
+  msgs_t* msgs           = &ws->msgs;
+  randomTape_t* tape     = &ws->tape;
+  party_commitments_t* C = &ws->C;
+  const size_t last      = PICNIC_NUM_PARTIES - 1;
+  uint16_t challengeC[PICNIC_NUM_OPENED_ROUNDS];
+  uint16_t challengeP[PICNIC_NUM_OPENED_ROUNDS];
+  uint8_t challenge[PICNIC_DIGEST_SIZE];
+  uint8_t treeCvRoot[PICNIC_DIGEST_SIZE];
+  uint8_t salt[PICNIC_SALT_SIZE];
+  uint8_t iSeed[PICNIC_SEED_SIZE];
+  uint8_t Ch_hash[PICNIC_DIGEST_SIZE];
+  uint8_t Cv_hash[PICNIC_DIGEST_SIZE];
+  mzd_local_t m_plaintext[1];
+  mzd_local_t m_maskedKey[1];
 
-  /* Compute the number of bytes required for the proofs */
-  size_t seedInfoLen = PICNIC_NUM_PARTIES_LOG2 * PICNIC_SEED_SIZE;
-  for (size_t t = 0; t < PICNIC_NUM_ROUNDS; t++) {
-    if (contains(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
-      size_t P_t = sig->challengeP[indexOf(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)];
-      if (P_t != (PICNIC_NUM_PARTIES - 1)) {
-        bytesRequired += PICNIC_VIEW_SIZE;
-      }
-      bytesRequired += PICNIC_DIGEST_SIZE;
-      bytesRequired += PICNIC_INPUT_SIZE;
-      bytesRequired += PICNIC_VIEW_SIZE;
-      bytesRequired += seedInfoLen;
-    }
+  /* Read the challenge and salt */
+  if (sigBytesLen < PICNIC_DIGEST_SIZE + PICNIC_SALT_SIZE) {
+    return -1;
   }
+  const uint8_t* sigChallenge = sigBytes;
+  memcpy(salt, sigBytes + PICNIC_DIGEST_SIZE, PICNIC_SALT_SIZE);
+  expandChallenge(challengeC, challengeP, sigChallenge);
 
   /* Fail if the signature does not have the exact number of bytes we expect */
+  const size_t missingLeavesSize = PICNIC_NUM_ROUNDS - PICNIC_NUM_OPENED_ROUNDS;
+  uint16_t missingLeaves[PICNIC_NUM_ROUNDS - PICNIC_NUM_OPENED_ROUNDS];
+  getMissingLeavesList(missingLeaves, challengeC);
+  const size_t iSeedInfoLen  = revealRoundSeedsSize(challengeC, PICNIC_NUM_OPENED_ROUNDS);
+  const size_t cvInfoLen     = openMerkleTreeSize(missingLeaves, missingLeavesSize);
+  const size_t bytesRequired = PICNIC_DIGEST_SIZE + PICNIC_SALT_SIZE + iSeedInfoLen + cvInfoLen +
+                               proofsSize(challengeP);
   if (sigBytesLen != bytesRequired) {
 #if !defined(NDEBUG)
     printf("%s: sigBytesLen = " SIZET_FMT ", expected bytesRequired = " SIZET_FMT "\n", __func__,
            sigBytesLen, bytesRequired);
 #endif
-    return EXIT_FAILURE;
+    return -1;
   }
 
-  memcpy(sig->iSeedInfo, sigBytes, sig->iSeedInfoLen);
-  sigBytes += sig->iSeedInfoLen;
-
-  memcpy(sig->cvInfo, sigBytes, sig->cvInfoLen);
-  sigBytes += sig->cvInfoLen;
+  const uint8_t* iSeedInfo = sigBytes + PICNIC_DIGEST_SIZE + PICNIC_SALT_SIZE;
+  const uint8_t* cvInfo    = iSeedInfo + iSeedInfoLen;
+  const uint8_t* sigPos    = cvInfo + cvInfoLen;
+  createRoundSeedStream(&ws->iSeeds, challengeC, PICNIC_NUM_OPENED_ROUNDS, iSeedInfo, salt);
+  createMerkleStream(&ws->treeCv, missingLeaves, missingLeavesSize, cvInfo, salt);
+  hash_init(&ws->ctx_challenge, PICNIC_DIGEST_SIZE);
+  mzd_from_char_array(m_plaintext, plaintext, PICNIC_OUTPUT_SIZE);
 
-  /* Read the proofs */
-  size_t proof_index = 0;
   for (size_t t = 0; t < PICNIC_NUM_ROUNDS; t++) {
-    if (contains(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
-      sig->proofs[proof_index].seedInfoLen = seedInfoLen;
-      memcpy(sig->proofs[proof_index].seedInfo, sigBytes, sig->proofs[proof_index].seedInfoLen);
-      sigBytes += sig->proofs[proof_index].seedInfoLen;
-
-      size_t P_t = sig->challengeP[indexOf(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)];
-      if (P_t != (PICNIC_NUM_PARTIES - 1)) {
-        memcpy(sig->proofs[proof_index].aux, sigBytes, PICNIC_VIEW_SIZE);
-        sigBytes += PICNIC_VIEW_SIZE;
-        if (!arePaddingBitsZero(sig->proofs[proof_index].aux, PICNIC_VIEW_SIZE,
-                                3 * LOWMC_R * LOWMC_M)) {
-#if !defined(NDEBUG)
-          printf("%s: failed while deserializing aux bits\n", __func__);
-#endif
-          return -1;
-        }
-      }
+    tree_t seed;
 
-      memcpy(sig->proofs[proof_index].input, sigBytes, PICNIC_INPUT_SIZE);
-      if (!arePaddingBitsZero(sig->proofs[proof_index].input, PICNIC_INPUT_SIZE, LOWMC_N)) {
-#if !defined(NDEBUG)
-        printf("%s: failed while deserializing input bits\n", __func__);
-#endif
+    if (!contains(challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
+      /* Expand iSeed[t] to seeds for each parties, using a seed tree, and compute aux from scratch
+       * so we can compute Com[t] */
+      if (getRoundSeedFromStream(&ws->iSeeds, t, iSeed) != 0) {
         return -1;
       }
-      sigBytes += PICNIC_INPUT_SIZE;
+      generatePartySeeds(&seed, &ws->seedStorage, iSeed, salt, t);
+      createRandomTapes(tape, getLeaves(&seed), salt, t);
+      computeAuxTape(tape, NULL);
+      for (size_t j = 0; j < last; j++) {
+        commit(C->hashes[j], getLeaf(&seed, j), NULL, salt, t, j);
+      }
+      commit(C->hashes[last], getLeaf(&seed, last), tape->aux_bits, salt, t, last);
+      commit_h(Ch_hash, C);
+      hash_update(&ws->ctx_challenge, Ch_hash, PICNIC_DIGEST_SIZE);
 
-      size_t msgsByteLength = PICNIC_VIEW_SIZE;
-      memcpy(sig->proofs[proof_index].msgs, sigBytes, msgsByteLength);
-      sigBytes += msgsByteLength;
-      size_t msgsBitLength = 3 * LOWMC_R * LOWMC_M;
-      if (!arePaddingBitsZero(sig->proofs[proof_index].msgs, msgsByteLength, msgsBitLength)) {
-#if !defined(NDEBUG)
-        printf("%s: failed while deserializing msgs bits\n", __func__);
-#endif
+      /* The verifier does not have Cv[t], it is covered by the revealed Merkle nodes */
+      if (addMerkleStreamLeaf(&ws->treeCv, t, NULL) != 0) {
         return -1;
       }
-
-      memcpy(sig->proofs[proof_index].C, sigBytes, PICNIC_DIGEST_SIZE);
-      sigBytes += PICNIC_DIGEST_SIZE;
-      proof_index++;
+      continue;
     }
-  }
-
-  return EXIT_SUCCESS;
-}
 
-static int serializeSignature2(const signature2_t* sig, uint8_t* sigBytes, size_t sigBytesLen) {
-  uint8_t* sigBytesBase = sigBytes;
-
-  /* Compute the number of bytes required for the signature */
-  size_t bytesRequired = PICNIC_DIGEST_SIZE + PICNIC_SALT_SIZE; /* challenge and salt */
+    /* We're given all seeds and aux bits, except for the unopened party, we get their commitment */
+    const uint16_t unopened = challengeP[indexOf(challengeC, PICNIC_NUM_OPENED_ROUNDS, t)];
+    proof_view_t proof;
+    if (readProof(&proof, &sigPos, unopened) != 0) {
+      return -1;
+    }
+    createPartySeedTree(&seed, &ws->seedStorage);
+    if (reconstructPartySeeds(&seed, unopened, proof.seedInfo,
+                              PICNIC_NUM_PARTIES_LOG2 * PICNIC_SEED_SIZE, salt, t) != 0) {
+#if !defined(NDEBUG)
+      printf("Failed to reconstruct seeds for round " SIZET_FMT "\n", t);
+#endif
+      return -1;
+    }
 
-  bytesRequired +=
-      sig->iSeedInfoLen; /* Encode only iSeedInfo, the length will be recomputed by deserialize */
-  bytesRequired += sig->cvInfoLen;
+    /* Compute random tapes for all parties. The unopened party has a bogus seed, but we won't use
+     * that party's random tape. */
+    createRandomTapes(tape, getLeaves(&seed), salt, t);
+    for (size_t j = 0; j < last; j++) {
+      commit(C->hashes[j], getLeaf(&seed, j), NULL, salt, t, j);
+    }
+    if (last != unopened) {
+      commit(C->hashes[last], getLeaf(&seed, last), proof.aux, salt, t, last);
+    }
+    memcpy(C->hashes[unopened], proof.C, PICNIC_DIGEST_SIZE);
+    commit_h(Ch_hash, C);
+    hash_update(&ws->ctx_challenge, Ch_hash, PICNIC_DIGEST_SIZE);
 
-  size_t proof_index = 0;
-  for (size_t t = 0; t < PICNIC_NUM_ROUNDS; t++) { /* proofs */
-    if (contains(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
-      size_t P_t = sig->challengeP[indexOf(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)];
-      bytesRequired += sig->proofs[proof_index].seedInfoLen;
-      if (P_t != (PICNIC_NUM_PARTIES - 1)) {
-        bytesRequired += PICNIC_VIEW_SIZE;
-      }
-      bytesRequired += PICNIC_DIGEST_SIZE;
-      bytesRequired += PICNIC_INPUT_SIZE;
-      bytesRequired += PICNIC_VIEW_SIZE;
-      proof_index++;
+    /* We have everything we need to re-compute the view, as an honest signer would. We simulate
+     * the MPC with one fewer party; the unopened party's values are all set to zero. */
+    if (proof.aux != NULL) {
+      setAuxBits(tape, proof.aux);
+    }
+    memset(tape->tape[unopened], 0, 2 * PICNIC_VIEW_SIZE);
+    memset(msgs->msgs, 0, PICNIC_VIEW_SIZE * PICNIC_NUM_PARTIES);
+    memcpy(msgs->msgs[unopened], proof.msgs, PICNIC_VIEW_SIZE);
+    mzd_from_char_array(m_maskedKey, proof.input, PICNIC_INPUT_SIZE);
+    msgs->unopened = unopened;
+    msgs->pos      = 0;
+    if (lowmc_simulate_online_uint64_129_43(m_maskedKey, tape, msgs, m_plaintext, pubKey) != 0) {
+#if !defined(NDEBUG)
+      printf("MPC simulation failed for round " SIZET_FMT ", signature invalid\n", t);
+#endif
+      return -1;
+    }
+    commit_v(Cv_hash, proof.input, msgs);
+    if (addMerkleStreamLeaf(&ws->treeCv, t, Cv_hash) != 0) {
+      return -1;
     }
   }
 
-  if (sigBytesLen < bytesRequired) {
+  if (getMerkleStreamRoot(&ws->treeCv, treeCvRoot) != 0) {
     return -1;
   }
 
-  memcpy(sigBytes, sig->challenge, PICNIC_DIGEST_SIZE);
-  sigBytes += PICNIC_DIGEST_SIZE;
+  /* Compute the challenge; two lists of integers */
+  HCP_sign(&ws->ctx_challenge, challenge, challengeC, challengeP, treeCvRoot, salt, pubKey,
+           plaintext, message, messageByteLength);
 
-  memcpy(sigBytes, sig->salt, PICNIC_SALT_SIZE);
-  sigBytes += PICNIC_SALT_SIZE;
+  /* Compare to challenge from signature */
+  if (memcmp(sigChallenge, challenge, PICNIC_DIGEST_SIZE) != 0) {
+#if !defined(NDEBUG)
+    printf("Challenge does not match, signature invalid\n");
+#endif
+    return -1;
+  }
 
-  memcpy(sigBytes, sig->iSeedInfo, sig->iSeedInfoLen);
-  sigBytes += sig->iSeedInfoLen;
-  memcpy(sigBytes, sig->cvInfo, sig->cvInfoLen);
-  sigBytes += sig->cvInfoLen;
+  return 0;
+}
 
-  /* Write the proofs */
-  proof_index = 0;
-  for (size_t t = 0; t < PICNIC_NUM_ROUNDS; t++) {
-    if (contains(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
-      memcpy(sigBytes, sig->proofs[proof_index].seedInfo, sig->proofs[proof_index].seedInfoLen);
-      sigBytes += sig->proofs[proof_index].seedInfoLen;
+static int is_valid_workspace(const void* workspace, size_t workspace_len, size_t required) {
+  return workspace && workspace_len >= required &&
+         ((uintptr_t)workspace % PICNIC_WORKSPACE_ALIGNMENT) == 0;
+}
 
-      size_t P_t = sig->challengeP[indexOf(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)];
+size_t impl_sign_picnic3_workspace_size(void) {
+  return sizeof(sign_context_t);
+}
 
-      if (P_t != (PICNIC_NUM_PARTIES - 1)) {
-        memcpy(sigBytes, sig->proofs[proof_index].aux, PICNIC_VIEW_SIZE);
-        sigBytes += PICNIC_VIEW_SIZE;
-      }
+size_t impl_verify_picnic3_workspace_size(void) {
+  return sizeof(verify_workspace_t);
+}
 
-      memcpy(sigBytes, sig->proofs[proof_index].input, PICNIC_INPUT_SIZE);
-      sigBytes += PICNIC_INPUT_SIZE;
+int impl_sign_picnic3_ws(const uint8_t* plaintext, const uint8_t* private_key,
+                         const uint8_t* public_key, const uint8_t* msg, size_t msglen,
+                         uint8_t* signature, size_t* signature_len, void* workspace,
+                         size_t workspace_len) {
+  if (!is_valid_workspace(workspace, workspace_len, sizeof(sign_context_t))) {
+#if !defined(NDEBUG)
+    fprintf(stderr, "Invalid workspace\n");
+    fflush(stderr);
+#endif
+    return -1;
+  }
 
-      memcpy(sigBytes, sig->proofs[proof_index].msgs, PICNIC_VIEW_SIZE);
-      sigBytes += PICNIC_VIEW_SIZE;
+  /* The signature buffer doubles as scratch space while signing */
+  if (*signature_len < PICNIC_SIGNATURE_SIZE_Picnic3_L1) {
+#if !defined(NDEBUG)
+    fprintf(stderr, "Signature buffer too small\n");
+    fflush(stderr);
+#endif
+    return -1;
+  }
 
-      memcpy(sigBytes, sig->proofs[proof_index].C, PICNIC_DIGEST_SIZE);
-      sigBytes += PICNIC_DIGEST_SIZE;
-      proof_index++;
-    }
+  int ret = sign_picnic3(private_key, public_key, plaintext, msg, msglen, signature, signature_len,
+                         (sign_context_t*)workspace);
+  picnic_declassify(&ret, sizeof(ret));
+  if (ret != EXIT_SUCCESS) {
+#if !defined(NDEBUG)
+    fprintf(stderr, "Failed to create signature\n");
+    fflush(stderr);
+#endif
+    return -1;
   }
 
-  return (int)(sigBytes - sigBytesBase);
+  return 0;
 }
 
 int impl_sign_picnic3(const uint8_t* plaintext, const uint8_t* private_key,
                       const uint8_t* public_key, const uint8_t* msg, size_t msglen,
                       uint8_t* signature, size_t* signature_len) {
-  signature2_t sig;
-  int ret = sign_picnic3(private_key, public_key, plaintext, msg, msglen, &sig, signature);
+  sign_context_t ctx;
+  return impl_sign_picnic3_ws(plaintext, private_key, public_key, msg, msglen, signature,
+                              signature_len, &ctx, sizeof(ctx));
+}
+
+int impl_sign_picnic3_begin(void* context, size_t context_len, const uint8_t* plaintext,
+                            const uint8_t* private_key, const uint8_t* public_key,
+                            const uint8_t* msg, size_t msglen, uint8_t* signature,
+                            size_t signature_len) {
+  if (!is_valid_workspace(context, context_len, sizeof(sign_context_t))) {
+#if !defined(NDEBUG)
+    fprintf(stderr, "Invalid context\n");
+    fflush(stderr);
+#endif
+    return -1;
+  }
+
+  /* The signature buffer doubles as scratch space while signing */
+  if (signature_len < PICNIC_SIGNATURE_SIZE_Picnic3_L1) {
+#if !defined(NDEBUG)
+    fprintf(stderr, "Signature buffer too small\n");
+    fflush(stderr);
+#endif
+    return -1;
+  }
+
+  sign_begin((sign_context_t*)context, private_key, public_key, plaintext, msg, msglen, signature,
+             signature_len);
+  return 0;
+}
+
+int impl_sign_picnic3_step(void* context) {
+  return sign_step((sign_context_t*)context);
+}
+
+int impl_sign_picnic3_finish(void* context, size_t* signature_len) {
+  sign_context_t* ctx = (sign_context_t*)context;
+  if (ctx->phase != SIGN_PHASE_DONE) {
+    /* not all steps were run */
+    ctx->ret = -1;
+  }
+
+  int ret = sign_finish(ctx, signature_len);
   picnic_declassify(&ret, sizeof(ret));
   if (ret != EXIT_SUCCESS) {
 #if !defined(NDEBUG)
@@ -831,34 +981,140 @@ int impl_sign_picnic3(const uint8_t* plaintext, const uint8_t* private_key,
 #endif
     return -1;
   }
-  ret = serializeSignature2(&sig, signature, *signature_len);
-  if (ret == -1) {
+
+  return 0;
+}
+
+size_t impl_presign_picnic3_size(void) {
+  return sizeof(presign_t);
+}
+
+size_t impl_presign_picnic3_workspace_size(void) {
+  return sizeof(presign_workspace_t);
+}
+
+int impl_presign_picnic3(const uint8_t* plaintext, const uint8_t* private_key,
+                         const uint8_t* public_key, void* presign, size_t presign_len,
+                         void* workspace, size_t workspace_len) {
+  if (!is_valid_workspace(workspace, workspace_len, sizeof(presign_workspace_t)) ||
+      !is_valid_workspace(presign, presign_len, sizeof(presign_t))) {
 #if !defined(NDEBUG)
-    fprintf(stderr, "Failed to serialize signature\n");
+    fprintf(stderr, "Invalid workspace\n");
     fflush(stderr);
 #endif
     return -1;
   }
-  *signature_len = ret;
 
-  return 0;
+  presign_workspace_t* ws = (presign_workspace_t*)workspace;
+  presign_t* entry        = (presign_t*)presign;
+  sign_context_t* ctx     = &ws->ctx;
+  entry->ready            = 0;
+
+  /* salt and root seed are drawn at random instead of being derived from the message */
+  sign_init(ctx, private_key, public_key, plaintext, NULL, 0, ws->sigBytes, sizeof(ws->sigBytes));
+  if (rand_bytes(ctx->saltAndRoot, sizeof(ctx->saltAndRoot)) != 0) {
+#if !defined(NDEBUG)
+    fprintf(stderr, "Failed to generate salt and root seed\n");
+    fflush(stderr);
+#endif
+    memset(ctx->privateKey, 0, sizeof(ctx->privateKey));
+    return -1;
+  }
+  generateRoundSeeds(&ctx->iSeedsTree, iSeedsTreeStorage(ctx->sigBytes),
+                     ctx->saltAndRoot + PICNIC_SALT_SIZE, ctx->saltAndRoot, 0);
+  hash_init(&ctx->ctx_challenge, PICNIC_DIGEST_SIZE);
+  while (ctx->phase == SIGN_PHASE_COMMIT) {
+    sign_step(ctx);
+  }
+
+  int ret = ctx->ret;
+  if (ret == 0) {
+    memcpy(entry->saltAndRoot, ctx->saltAndRoot, sizeof(entry->saltAndRoot));
+    memcpy(entry->pubKey, public_key, PICNIC_OUTPUT_SIZE);
+    memcpy(entry->plaintext, plaintext, PICNIC_OUTPUT_SIZE);
+    entry->ctx_challenge = ctx->ctx_challenge;
+    memcpy(&entry->Cv, &ctx->ws.Cv, sizeof(entry->Cv));
+    entry->ready = PRESIGN_READY;
+  }
+  memset(ctx->privateKey, 0, sizeof(ctx->privateKey));
+  memset(ctx->saltAndRoot, 0, sizeof(ctx->saltAndRoot));
+  ctx->phase = SIGN_PHASE_DONE;
+  picnic_declassify(&ret, sizeof(ret));
+  return ret == 0 ? 0 : -1;
 }
 
-int impl_verify_picnic3(const uint8_t* plaintext, const uint8_t* public_key, const uint8_t* msg,
-                        size_t msglen, const uint8_t* signature, size_t signature_len) {
-  int ret;
-  signature2_t sig;
+int impl_sign_picnic3_presigned(const uint8_t* plaintext, const uint8_t* private_key,
+                                const uint8_t* public_key, const uint8_t* msg, size_t msglen,
+                                void* presign, size_t presign_len, uint8_t* signature,
+                                size_t* signature_len, void* workspace, size_t workspace_len) {
+  if (!is_valid_workspace(workspace, workspace_len, sizeof(sign_context_t)) ||
+      !is_valid_workspace(presign, presign_len, sizeof(presign_t))) {
+#if !defined(NDEBUG)
+    fprintf(stderr, "Invalid workspace\n");
+    fflush(stderr);
+#endif
+    return -1;
+  }
+
+  /* The signature buffer doubles as scratch space while signing */
+  if (*signature_len < PICNIC_SIGNATURE_SIZE_Picnic3_L1) {
+#if !defined(NDEBUG)
+    fprintf(stderr, "Signature buffer too small\n");
+    fflush(stderr);
+#endif
+    return -1;
+  }
+
+  presign_t* entry = (presign_t*)presign;
+  if (entry->ready != PRESIGN_READY || memcmp(entry->pubKey, public_key, PICNIC_OUTPUT_SIZE) ||
+      memcmp(entry->plaintext, plaintext, PICNIC_OUTPUT_SIZE)) {
+#if !defined(NDEBUG)
+    fprintf(stderr, "Presigned entry is unused or belongs to a different key\n");
+    fflush(stderr);
+#endif
+    return -1;
+  }
 
-  ret = deserializeSignature2(&sig, signature, signature_len);
+  /* Resume right before the challenge. The entry is cleared, since signing two messages with the
+   * same entry would reveal the private key. */
+  sign_context_t* ctx = (sign_context_t*)workspace;
+  sign_init(ctx, private_key, public_key, plaintext, msg, msglen, signature, *signature_len);
+  memcpy(ctx->saltAndRoot, entry->saltAndRoot, sizeof(ctx->saltAndRoot));
+  generateRoundSeeds(&ctx->iSeedsTree, iSeedsTreeStorage(signature),
+                     ctx->saltAndRoot + PICNIC_SALT_SIZE, ctx->saltAndRoot, 0);
+  ctx->ctx_challenge = entry->ctx_challenge;
+  memcpy(&ctx->ws.Cv, &entry->Cv, sizeof(ctx->ws.Cv));
+  ctx->phase = SIGN_PHASE_CHALLENGE;
+  memset(entry, 0, sizeof(*entry));
+
+  while (sign_step(ctx)) {
+  }
+  int ret = sign_finish(ctx, signature_len);
+  picnic_declassify(&ret, sizeof(ret));
   if (ret != EXIT_SUCCESS) {
 #if !defined(NDEBUG)
-    fprintf(stderr, "Failed to deserialize signature\n");
+    fprintf(stderr, "Failed to create signature\n");
     fflush(stderr);
 #endif
     return -1;
   }
 
-  ret = verify_picnic3(&sig, public_key, plaintext, msg, msglen);
+  return 0;
+}
+
+int impl_verify_picnic3_ws(const uint8_t* plaintext, const uint8_t* public_key, const uint8_t* msg,
+                           size_t msglen, const uint8_t* signature, size_t signature_len,
+                           void* workspace, size_t workspace_len) {
+  if (!is_valid_workspace(workspace, workspace_len, sizeof(verify_workspace_t))) {
+#if !defined(NDEBUG)
+    fprintf(stderr, "Invalid workspace\n");
+    fflush(stderr);
+#endif
+    return -1;
+  }
+
+  int ret = verify_picnic3(signature, signature_len, public_key, plaintext, msg, msglen,
+                           (verify_workspace_t*)workspace);
   if (ret != EXIT_SUCCESS) {
     /* Signature is invalid, or verify function failed */
     return -1;
@@ -866,3 +1122,10 @@ int impl_verify_picnic3(const uint8_t* plaintext, const uint8_t* public_key, con
 
   return 0;
 }
+
+int impl_verify_picnic3(const uint8_t* plaintext, const uint8_t* public_key, const uint8_t* msg,
+                        size_t msglen, const uint8_t* signature, size_t signature_len) {
+  verify_workspace_t ws;
+  return impl_verify_picnic3_ws(plaintext, public_key, msg, msglen, signature, signature_len, &ws,
+                                sizeof(ws));
+}
@@ -17,40 +17,41 @@
 #include <stddef.h>
 #include "picnic_params.h"
 
-typedef struct proof2_t {
-  uint16_t unOpenedIndex; // P[t], index of the party that is not opened.
-  uint8_t
-      seedInfo[PICNIC_SEED_SIZE *
-               PICNIC_PARTY_TREE_MAX_REVEALED_NODES]; // Information required to compute the tree
-                                                      // with seeds of of all opened parties (log)
-  size_t seedInfoLen;                                 // Length of seedInfo buffer
-  uint8_t aux[PICNIC_VIEW_SIZE];    // Last party's correction bits; NULL if P[t] == N-1
-  uint8_t C[PICNIC_DIGEST_SIZE];    // Commitment to preprocessing step of unopened party
-  uint8_t input[PICNIC_INPUT_SIZE]; // Masked input used in online execution
-  uint8_t msgs[PICNIC_VIEW_SIZE];   // Broadcast messages of unopened party P[t]
-} proof2_t;
-
-typedef struct signature2_t {
-  uint8_t salt[PICNIC_SALT_SIZE];
-  uint8_t iSeedInfo[PICNIC_SEED_SIZE *
-                    PICNIC_ROUND_TREE_MAX_REVEALED_NODES]; // Info required to recompute the
-                                                           // tree of all initial seeds
-  size_t iSeedInfoLen;
-  uint8_t cvInfo[PICNIC_DIGEST_SIZE *
-                 PICNIC_ROUND_TREE_MAX_REVEALED_NODES]; // Info required to check commitments to
-                                                        // views (reconstruct Merkle tree)
-  size_t cvInfoLen;
-  uint8_t challenge[PICNIC_DIGEST_SIZE]; // output of HCP
-  uint16_t challengeC[PICNIC_NUM_OPENED_ROUNDS];
-  uint16_t challengeP[PICNIC_NUM_OPENED_ROUNDS];
-  proof2_t
-      proofs[PICNIC_NUM_OPENED_ROUNDS]; // One proof for each online execution the verifier checks
-} signature2_t;
-
 int impl_sign_picnic3(const uint8_t* plaintext, const uint8_t* private_key,
                       const uint8_t* public_key, const uint8_t* msg, size_t msglen, uint8_t* sig,
                       size_t* siglen);
 int impl_verify_picnic3(const uint8_t* plaintext, const uint8_t* public_key, const uint8_t* msg,
                         size_t msglen, const uint8_t* signature, size_t signature_len);
 
+/* Variants of the above that keep all large buffers in a caller-provided workspace */
+size_t impl_sign_picnic3_workspace_size(void);
+size_t impl_verify_picnic3_workspace_size(void);
+int impl_sign_picnic3_ws(const uint8_t* plaintext, const uint8_t* private_key,
+                         const uint8_t* public_key, const uint8_t* msg, size_t msglen, uint8_t* sig,
+                         size_t* siglen, void* workspace, size_t workspace_len);
+int impl_verify_picnic3_ws(const uint8_t* plaintext, const uint8_t* public_key, const uint8_t* msg,
+                           size_t msglen, const uint8_t* signature, size_t signature_len,
+                           void* workspace, size_t workspace_len);
+
+/* Step-wise signing; the context has impl_sign_picnic3_workspace_size() bytes. The message and the
+ * signature buffer must stay valid until impl_sign_picnic3_finish() */
+int impl_sign_picnic3_begin(void* context, size_t context_len, const uint8_t* plaintext,
+                            const uint8_t* private_key, const uint8_t* public_key,
+                            const uint8_t* msg, size_t msglen, uint8_t* sig, size_t siglen);
+int impl_sign_picnic3_step(void* context);
+int impl_sign_picnic3_finish(void* context, size_t* siglen);
+
+/* Randomized signing with the message independent work done ahead of time by
+ * impl_presign_picnic3; impl_sign_picnic3_presigned uses a workspace of
+ * impl_sign_picnic3_workspace_size() bytes and consumes the presigned entry */
+size_t impl_presign_picnic3_size(void);
+size_t impl_presign_picnic3_workspace_size(void);
+int impl_presign_picnic3(const uint8_t* plaintext, const uint8_t* private_key,
+                         const uint8_t* public_key, void* presign, size_t presign_len,
+                         void* workspace, size_t workspace_len);
+int impl_sign_picnic3_presigned(const uint8_t* plaintext, const uint8_t* private_key,
+                                const uint8_t* public_key, const uint8_t* msg, size_t msglen,
+                                void* presign, size_t presign_len, uint8_t* sig, size_t* siglen,
+                                void* workspace, size_t workspace_len);
+
 #endif /* PICNIC3_IMPL_H */
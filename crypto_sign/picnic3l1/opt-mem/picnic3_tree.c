@@ -155,8 +155,8 @@ uint8_t* getLeaf(tree_t* tree, size_t leafIndex) {
   return tree->nodes[firstLeaf + leafIndex];
 }
 
-static void hashSeed(uint8_t* digest, const uint8_t* inputSeed, uint8_t* salt, uint8_t hashPrefix,
-                     size_t repIndex, size_t nodeIndex) {
+static void hashSeed(uint8_t* digest, const uint8_t* inputSeed, const uint8_t* salt,
+                     uint8_t hashPrefix, size_t repIndex, size_t nodeIndex) {
   hash_context ctx;
 
   hash_init_prefix(&ctx, PICNIC_DIGEST_SIZE, hashPrefix);
@@ -340,9 +340,10 @@ static void getRevealedNodesPartyTree(tree_t* tree, uint16_t hideParty, size_t*
 }
 
 size_t revealRoundSeedsSize(uint16_t* hideList, size_t hideListSize) {
+  /* only the shape of the tree is needed */
   tree_t tree;
-  round_seed_tree_storage_t storage;
-  createRoundSeedTree(&tree, &storage);
+  round_commitment_tree_storage_light_t storage;
+  createRoundCommitmentTreeLight(&tree, &storage);
   size_t numNodesRevealed = 0;
   size_t revealed[PICNIC_ROUND_TREE_MAX_REVEALED_NODES];
   getRevealedNodesRoundTree(&tree, hideList, hideListSize, revealed, &numNodesRevealed);
@@ -426,7 +427,7 @@ int reconstructRoundSeeds(tree_t* tree, uint16_t* hideList, size_t hideListSize,
 Exit:
   return ret;
 }
-int reconstructPartySeeds(tree_t* tree, uint16_t hideParty, uint8_t* input, size_t inputLen,
+int reconstructPartySeeds(tree_t* tree, uint16_t hideParty, const uint8_t* input, size_t inputLen,
                           uint8_t* salt, size_t repIndex) {
   int ret = 0;
 
@@ -561,10 +562,10 @@ static void getRevealedMerkleNodes(tree_t* tree, const uint16_t* missingLeaves,
 }
 
 size_t openMerkleTreeSize(uint16_t* missingLeaves, size_t missingLeavesSize) {
-
+  /* only the shape of the tree is needed */
   tree_t tree;
-  round_commitment_tree_storage_t storage;
-  createRoundCommitmentTree(&tree, &storage);
+  round_commitment_tree_storage_light_t storage;
+  createRoundCommitmentTreeLight(&tree, &storage);
   size_t revealedSize = 0;
   size_t revealed[PICNIC_ROUND_TREE_MAX_REVEALED_NODES];
   getRevealedMerkleNodes(&tree, missingLeaves, missingLeavesSize, revealed, &revealedSize);
@@ -674,10 +675,10 @@ static void hashMerkleNode(uint8_t* out, const uint8_t* in1, const uint8_t* in2,
   hash_squeeze(&ctx, out, PICNIC_DIGEST_SIZE);
 }
 
-void computeMerkleRoot(uint8_t* root, uint8_t leafData[PICNIC_NUM_ROUNDS][PICNIC_DIGEST_SIZE], const uint8_t* salt)
+void computeMerkleRoot(uint8_t* root, uint8_t leafData[PICNIC_NUM_ROUNDS][PICNIC_DIGEST_SIZE], const uint8_t* salt,
+                       uint8_t tmp[PICNIC_NUM_ROUNDS / 2][PICNIC_DIGEST_SIZE])
 {
   assert(PICNIC_NUM_ROUNDS % 2 == 0);
-  uint8_t tmp[PICNIC_NUM_ROUNDS/2][PICNIC_DIGEST_SIZE];
   uint8_t zeroBuf[PICNIC_DIGEST_SIZE] = {0};
 
   size_t layerSizePrevious = PICNIC_NUM_ROUNDS;
@@ -750,10 +751,10 @@ static void copyIfRevealed(size_t* revealed, size_t revealedSize, const uint8_t*
 
 /* In this implementation we compute all the nodes, and copy the ones we need into the output buffer. 
  * The code is nearly identical to computeMerkleRoot */
-void computeMerkleTreeOpening(tree_t* tree, const uint8_t leafData[PICNIC_NUM_ROUNDS][PICNIC_DIGEST_SIZE], const uint16_t* missingLeaves, size_t missingLeavesSize, uint8_t* output, size_t* outputSizeBytes, const uint8_t* salt)
+void computeMerkleTreeOpening(tree_t* tree, const uint8_t leafData[PICNIC_NUM_ROUNDS][PICNIC_DIGEST_SIZE], const uint16_t* missingLeaves, size_t missingLeavesSize, uint8_t* output, size_t* outputSizeBytes, const uint8_t* salt,
+                              uint8_t tmp[PICNIC_NUM_ROUNDS / 2][PICNIC_DIGEST_SIZE])
 {
   assert(PICNIC_NUM_ROUNDS == 250); // because we hardcode 128 and 255 below
-  uint8_t tmp[PICNIC_NUM_ROUNDS/2][PICNIC_DIGEST_SIZE];
   size_t revealedSize = 0;
   size_t revealed[PICNIC_ROUND_TREE_MAX_REVEALED_NODES];
   uint8_t zeroBuf[PICNIC_DIGEST_SIZE] = {0};
@@ -794,3 +795,163 @@ void computeMerkleTreeOpening(tree_t* tree, const uint8_t leafData[PICNIC_NUM_RO
   }
 
 }
+
+
+/* Streaming verifier functions. The round trees are never built: seeds of unopened rounds are
+ * expanded from the revealed nodes when their round is reached, and the Merkle root is computed
+ * from left to right with one pending node per level. */
+
+#define ROUND_TREE_FIRST_LEAF (PICNIC_ROUND_TREE_NUM_NODES - PICNIC_NUM_ROUNDS)
+#define NO_NODE UINT16_MAX
+
+/* Leftmost leaf below node; the node exists iff this is less than PICNIC_ROUND_TREE_NUM_NODES */
+static size_t getFirstLeaf(size_t node) {
+  while (node < ROUND_TREE_FIRST_LEAF) {
+    node = 2 * node + 1;
+  }
+  return node;
+}
+
+static size_t getDepth(size_t node) {
+  size_t depth = 0;
+  for (; node; node = getParent(node)) {
+    depth++;
+  }
+  return depth;
+}
+
+static int indexOfNode(const uint16_t* list, size_t len, size_t value) {
+  for (size_t i = 0; i < len; i++) {
+    if (list[i] == value) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void createRoundSeedStream(round_seed_stream_t* stream, uint16_t* hideList, size_t hideListSize,
+                           const uint8_t* input, const uint8_t* salt) {
+  tree_t tree;
+  round_commitment_tree_storage_light_t storage;
+  size_t revealed[PICNIC_ROUND_TREE_MAX_REVEALED_NODES];
+
+  createRoundCommitmentTreeLight(&tree, &storage);
+  getRevealedNodesRoundTree(&tree, hideList, hideListSize, revealed, &stream->revealedSize);
+  for (size_t i = 0; i < stream->revealedSize; i++) {
+    stream->revealed[i] = revealed[i];
+  }
+  for (size_t i = 0; i < PICNIC_NUM_ROUNDS_LOG2; i++) {
+    stream->expanded[i] = NO_NODE;
+  }
+  stream->input = input;
+  stream->salt  = salt;
+}
+
+static int getStreamNodeSeed(round_seed_stream_t* stream, size_t node, uint8_t* seed) {
+  const int index = indexOfNode(stream->revealed, stream->revealedSize, node);
+  if (index >= 0) {
+    memcpy(seed, stream->input + index * PICNIC_SEED_SIZE, PICNIC_SEED_SIZE);
+    return 0;
+  }
+  if (node == 0) {
+    /* node is below a hidden leaf */
+    return -1;
+  }
+
+  /* Both children of the last expanded node of each level are kept, so every node is expanded
+   * only once if the leaves are requested in order */
+  const size_t parent = getParent(node);
+  const size_t depth  = getDepth(parent);
+  assert(depth < PICNIC_NUM_ROUNDS_LOG2);
+  if (stream->expanded[depth] != parent) {
+    uint8_t parentSeed[PICNIC_SEED_SIZE];
+    if (getStreamNodeSeed(stream, parent, parentSeed) != 0) {
+      return -1;
+    }
+    hashSeed(stream->children[depth], parentSeed, stream->salt, HASH_PREFIX_1, 0, parent);
+    stream->expanded[depth] = parent;
+  }
+  memcpy(seed, stream->children[depth] + (isLeftChild(node) ? 0 : PICNIC_SEED_SIZE),
+         PICNIC_SEED_SIZE);
+  return 0;
+}
+
+int getRoundSeedFromStream(round_seed_stream_t* stream, size_t leafIndex, uint8_t* seed) {
+  return getStreamNodeSeed(stream, ROUND_TREE_FIRST_LEAF + leafIndex, seed);
+}
+
+void createMerkleStream(merkle_stream_t* stream, const uint16_t* missingLeaves,
+                        size_t missingLeavesSize, const uint8_t* input, const uint8_t* salt) {
+  tree_t tree;
+  round_commitment_tree_storage_light_t storage;
+  size_t revealed[PICNIC_ROUND_TREE_MAX_REVEALED_NODES];
+
+  createRoundCommitmentTreeLight(&tree, &storage);
+  getRevealedMerkleNodes(&tree, missingLeaves, missingLeavesSize, revealed, &stream->revealedSize);
+  for (size_t i = 0; i < stream->revealedSize; i++) {
+    stream->revealed[i] = revealed[i];
+  }
+  stream->input     = input;
+  stream->salt      = salt;
+  stream->stackSize = 0;
+}
+
+int addMerkleStreamLeaf(merkle_stream_t* stream, size_t leafIndex, const uint8_t* leafData) {
+  const uint8_t zeroBuf[PICNIC_DIGEST_SIZE] = {0};
+  const size_t leaf                         = ROUND_TREE_FIRST_LEAF + leafIndex;
+  size_t node                               = leaf;
+  uint8_t digest[PICNIC_DIGEST_SIZE];
+
+  if (leafData != NULL) {
+    memcpy(digest, leafData, PICNIC_DIGEST_SIZE);
+  } else {
+    /* A missing leaf is covered by a revealed node, which is added with its first leaf */
+    int index;
+    while ((index = indexOfNode(stream->revealed, stream->revealedSize, node)) < 0) {
+      if (node == 0) {
+        return -1;
+      }
+      node = getParent(node);
+    }
+    if (getFirstLeaf(node) != leaf) {
+      return 0;
+    }
+    memcpy(digest, stream->input + index * PICNIC_DIGEST_SIZE, PICNIC_DIGEST_SIZE);
+  }
+
+  /* Combine with the pending left siblings */
+  while (node != 0) {
+    const size_t parent = getParent(node);
+    if (isLeftChild(node)) {
+      if (getFirstLeaf(node + 1) < PICNIC_ROUND_TREE_NUM_NODES) {
+        break;
+      }
+      /* The right child does not exist and is hashed as zeros, as in computeParentHash */
+      hashMerkleNode(digest, digest, zeroBuf, stream->salt, parent);
+    } else {
+      if (stream->stackSize == 0 || stream->nodes[stream->stackSize - 1] != node - 1) {
+        return -1;
+      }
+      stream->stackSize--;
+      hashMerkleNode(digest, stream->digests[stream->stackSize], digest, stream->salt, parent);
+    }
+    node = parent;
+  }
+
+  if (stream->stackSize == PICNIC_NUM_ROUNDS_LOG2 + 1) {
+    return -1;
+  }
+  stream->nodes[stream->stackSize] = node;
+  memcpy(stream->digests[stream->stackSize], digest, PICNIC_DIGEST_SIZE);
+  stream->stackSize++;
+  return 0;
+}
+
+int getMerkleStreamRoot(merkle_stream_t* stream, uint8_t* root) {
+  /* Fail if not all leaves were added */
+  if (stream->stackSize != 1 || stream->nodes[0] != 0) {
+    return -1;
+  }
+  memcpy(root, stream->digests[0], PICNIC_DIGEST_SIZE);
+  return 0;
+}
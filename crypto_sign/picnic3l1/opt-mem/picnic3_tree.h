@@ -63,6 +63,27 @@ typedef struct parties_seed_tree_storage_t {
                                            marked 0 don't   exist */
 } parties_seed_tree_storage_t;
 
+/* Seeds of the unopened rounds, expanded from the revealed nodes without storing the round tree */
+typedef struct round_seed_stream_t {
+  const uint8_t* input; /* the revealed seeds */
+  const uint8_t* salt;
+  uint16_t revealed[PICNIC_ROUND_TREE_MAX_REVEALED_NODES];
+  size_t revealedSize;
+  uint16_t expanded[PICNIC_NUM_ROUNDS_LOG2]; /* last expanded node of each level */
+  uint8_t children[PICNIC_NUM_ROUNDS_LOG2][2 * PICNIC_SEED_SIZE];
+} round_seed_stream_t;
+
+/* Merkle root computed from left to right; nodes/digests hold the pending left children */
+typedef struct merkle_stream_t {
+  const uint8_t* input; /* the revealed nodes */
+  const uint8_t* salt;
+  uint16_t revealed[PICNIC_ROUND_TREE_MAX_REVEALED_NODES];
+  size_t revealedSize;
+  uint16_t nodes[PICNIC_NUM_ROUNDS_LOG2 + 1];
+  uint8_t digests[PICNIC_NUM_ROUNDS_LOG2 + 1][PICNIC_DIGEST_SIZE];
+  size_t stackSize;
+} merkle_stream_t;
+
 /* The largest seed size is 256 bits, for the Picnic3-L5-FS parameter set. */
 #define MAX_SEED_SIZE_BYTES (32)
 
@@ -88,7 +109,7 @@ size_t revealPartySeeds(tree_t* tree, uint16_t hideParty, uint8_t* output, size_
 size_t revealRoundSeeds(tree_t* tree, uint16_t* hideList, size_t hideListSize, uint8_t* output,
                         size_t outputLen);
 size_t revealRoundSeedsSize(uint16_t* hideList, size_t hideListSize);
-int reconstructPartySeeds(tree_t* tree, uint16_t hideParty, uint8_t* input, size_t inputLen,
+int reconstructPartySeeds(tree_t* tree, uint16_t hideParty, const uint8_t* input, size_t inputLen,
                           uint8_t* salt, size_t repIndex);
 int reconstructRoundSeeds(tree_t* tree, uint16_t* hideList, size_t hideListSize, uint8_t* input,
                           size_t inputLen, uint8_t* salt, size_t repIndex);
@@ -114,8 +135,25 @@ int addMerkleNodes(tree_t* tree, uint16_t* missingLeaves, size_t missingLeavesSi
                    size_t inputSize);
 int verifyMerkleTree(tree_t* tree, uint8_t** leafData, uint8_t* salt);
 
-/* Low RAM functions */
-void computeMerkleRoot(uint8_t* root, uint8_t leafData[PICNIC_NUM_ROUNDS][PICNIC_DIGEST_SIZE], const uint8_t* salt);
+/* Low RAM functions, tmp is scratch space for one layer of the tree */
+void computeMerkleRoot(uint8_t* root, uint8_t leafData[PICNIC_NUM_ROUNDS][PICNIC_DIGEST_SIZE], const uint8_t* salt,
+                       uint8_t tmp[PICNIC_NUM_ROUNDS / 2][PICNIC_DIGEST_SIZE]);
 void createRoundCommitmentTreeLight(tree_t* tree, round_commitment_tree_storage_light_t* storage);
-void computeMerkleTreeOpening(tree_t* tree, const uint8_t leafData[PICNIC_NUM_ROUNDS][PICNIC_DIGEST_SIZE], const uint16_t* missingLeaves, size_t missingLeavesSize, uint8_t* output, size_t* outputSizeBytes, const uint8_t* salt);
+void computeMerkleTreeOpening(tree_t* tree, const uint8_t leafData[PICNIC_NUM_ROUNDS][PICNIC_DIGEST_SIZE], const uint16_t* missingLeaves, size_t missingLeavesSize, uint8_t* output, size_t* outputSizeBytes, const uint8_t* salt,
+                              uint8_t tmp[PICNIC_NUM_ROUNDS / 2][PICNIC_DIGEST_SIZE]);
+
+/* Streaming verifier functions, the leaves must be processed in order.
+ *     1. createRoundSeedStream  with the hidden rounds and the revealed seeds of the signature
+ *        createMerkleStream     with the missing leaves and the revealed nodes of the signature
+ *     2. for each round: getRoundSeedFromStream if it is not hidden, and addMerkleStreamLeaf with
+ *        its commitment, or NULL for a missing leaf
+ *     3. getMerkleStreamRoot
+ */
+void createRoundSeedStream(round_seed_stream_t* stream, uint16_t* hideList, size_t hideListSize,
+                           const uint8_t* input, const uint8_t* salt);
+int getRoundSeedFromStream(round_seed_stream_t* stream, size_t leafIndex, uint8_t* seed);
+void createMerkleStream(merkle_stream_t* stream, const uint16_t* missingLeaves,
+                        size_t missingLeavesSize, const uint8_t* input, const uint8_t* salt);
+int addMerkleStreamLeaf(merkle_stream_t* stream, size_t leafIndex, const uint8_t* leafData);
+int getMerkleStreamRoot(merkle_stream_t* stream, uint8_t* root);
 #endif
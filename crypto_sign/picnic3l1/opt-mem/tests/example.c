@@ -79,6 +79,117 @@ int picnicExample(picnic_params_t parameters)
     }
     printf(" success\n");
 
+    fprintf(stdout, "Signing and verifying with a caller-provided workspace... ");
+    fflush(stdout);
+
+    size_t workspace_len = picnic_sign_workspace_size(parameters);
+    if (picnic_verify_workspace_size(parameters) > workspace_len) {
+        workspace_len = picnic_verify_workspace_size(parameters);
+    }
+    /* malloc'ed memory satisfies PICNIC_WORKSPACE_ALIGNMENT */
+    void* workspace = malloc(workspace_len);
+    size_t signature_ws_len = picnic_signature_size(parameters);
+    uint8_t* signature_ws = (uint8_t*)malloc(signature_ws_len);
+    if (workspace == NULL || signature_ws == NULL) {
+        printf("failed to allocate workspace\n");
+        exit(-1);
+    }
+
+    ret = picnic_sign_ws(&sk, message, sizeof(message), signature_ws, &signature_ws_len, workspace,
+                         workspace_len);
+    if (ret != 0) {
+        printf("picnic_sign_ws failed\n");
+        exit(-1);
+    }
+    /* signing is deterministic, so both signatures have to match */
+    if (signature_ws_len != signature_len || memcmp(signature_ws, signature, signature_len) != 0) {
+        printf("picnic_sign_ws produced a different signature\n");
+        exit(-1);
+    }
+    ret = picnic_verify_ws(&pk, message, sizeof(message), signature_ws, signature_ws_len,
+                           workspace, workspace_len);
+    if (ret != 0) {
+        printf("picnic_verify_ws failed\n");
+        exit(-1);
+    }
+    printf(" success, workspace is %d bytes\n", (int)workspace_len);
+
+    fprintf(stdout, "Signing step by step... ");
+    fflush(stdout);
+
+    size_t context_len = picnic_sign_context_size(parameters);
+    void* context = malloc(context_len);
+    if (context == NULL) {
+        printf("failed to allocate context\n");
+        exit(-1);
+    }
+
+    signature_ws_len = picnic_signature_size(parameters);
+    ret = picnic_sign_begin(context, context_len, &sk, message, sizeof(message), signature_ws,
+                            signature_ws_len);
+    if (ret != 0) {
+        printf("picnic_sign_begin failed\n");
+        exit(-1);
+    }
+    size_t steps = 0;
+    while ((ret = picnic_sign_step(context)) == 1) {
+        steps++;
+    }
+    if (ret != 0 || picnic_sign_finish(context, &signature_ws_len) != 0) {
+        printf("step-wise signing failed\n");
+        exit(-1);
+    }
+    if (signature_ws_len != signature_len || memcmp(signature_ws, signature, signature_len) != 0) {
+        printf("step-wise signing produced a different signature\n");
+        exit(-1);
+    }
+    printf(" success, %d steps\n", (int)steps + 1);
+
+    fprintf(stdout, "Signing with a presigned entry... ");
+    fflush(stdout);
+
+    size_t presign_len = picnic_presign_size(parameters);
+    size_t presign_workspace_len = picnic_presign_workspace_size(parameters);
+    void* presign = malloc(presign_len);
+    void* presign_workspace = malloc(presign_workspace_len);
+    if (presign == NULL || presign_workspace == NULL) {
+        printf("failed to allocate presigned entry\n");
+        exit(-1);
+    }
+
+    ret = picnic_presign(&sk, presign, presign_len, presign_workspace, presign_workspace_len);
+    if (ret != 0) {
+        printf("picnic_presign failed\n");
+        exit(-1);
+    }
+    signature_ws_len = picnic_signature_size(parameters);
+    ret = picnic_sign_presigned(&sk, presign, presign_len, message, sizeof(message), signature_ws,
+                                &signature_ws_len, workspace, workspace_len);
+    if (ret != 0) {
+        printf("picnic_sign_presigned failed\n");
+        exit(-1);
+    }
+    ret = picnic_verify(&pk, message, sizeof(message), signature_ws, signature_ws_len);
+    if (ret != 0) {
+        printf("picnic_verify failed for a presigned signature\n");
+        exit(-1);
+    }
+    /* entries are single use */
+    signature_ws_len = picnic_signature_size(parameters);
+    ret = picnic_sign_presigned(&sk, presign, presign_len, message, sizeof(message), signature_ws,
+                                &signature_ws_len, workspace, workspace_len);
+    if (ret == 0) {
+        printf("picnic_sign_presigned accepted a used entry\n");
+        exit(-1);
+    }
+    printf(" success, entry is %d bytes\n", (int)presign_len);
+
+    free(presign_workspace);
+    free(presign);
+    free(context);
+    free(signature_ws);
+    free(workspace);
+
     printf("Testing public key serialization... ");
     uint8_t pk_buf[PICNIC_MAX_PUBLICKEY_SIZE];
     ret = picnic_write_public_key(&pk, pk_buf, sizeof(pk_buf));
@@ -266,10 +266,47 @@ static int picnic3_test_vector_L1(void) {
                                     PICNIC_PRIVATE_KEY_SIZE(Picnic3_L1));
 }
 
+/* The verifier parses the signature while it verifies, every part of it has to be checked */
+static int picnic3_test_modified_signature_L1(void) {
+  picnic_privatekey_t private_key;
+  picnic_publickey_t public_key;
+  const uint8_t msg[] = "message";
+  uint8_t signature[PICNIC_SIGNATURE_SIZE_Picnic3_L1];
+  size_t signature_len = sizeof(signature);
+
+  if (picnic_keygen(Picnic3_L1, &public_key, &private_key) ||
+      picnic_sign(&private_key, msg, sizeof(msg), signature, &signature_len) ||
+      picnic_verify(&public_key, msg, sizeof(msg), signature, signature_len)) {
+    printf("Unable to create a valid signature.\n");
+    return 0;
+  }
+
+  /* flip one bit in each sixteenth of the signature, including the first and the last byte */
+  for (size_t i = 0; i <= 16; ++i) {
+    const size_t pos = i < 16 ? i * (signature_len / 16) : signature_len - 1;
+    signature[pos] ^= 0x01;
+    const int ret = picnic_verify(&public_key, msg, sizeof(msg), signature, signature_len);
+    signature[pos] ^= 0x01;
+    if (ret == 0) {
+      printf("Signature with modified byte %zu verifies.\n", pos);
+      return 0;
+    }
+  }
+
+  if (!picnic_verify(&public_key, msg, sizeof(msg), signature, signature_len - 1) ||
+      !picnic_verify(&public_key, msg, sizeof(msg) - 1, signature, signature_len)) {
+    printf("Truncated signature or message verifies.\n");
+    return 0;
+  }
+
+  return picnic_verify(&public_key, msg, sizeof(msg), signature, signature_len) == 0;
+}
+
 typedef int (*test_fn_t)(void);
 
 static const test_fn_t tests[] = {
     picnic3_test_vector_L1,
+    picnic3_test_modified_signature_L1,
 };
 
 static const size_t num_tests = sizeof(tests) / sizeof(tests[0]);
@@ -1,10 +1,22 @@
 #ifndef PICNIC3_L1_FS_API_H
 #define PICNIC3_L1_FS_API_H
 
+#if defined(PICNIC3_L5)
+#define CRYPTO_SECRETKEYBYTES (1 + 2 * 32 + 32)
+#define CRYPTO_PUBLICKEYBYTES (1 + 2 * 32)
+#define CRYPTO_BYTES (4 + 61024)
+#define CRYPTO_ALGNAME "picnic3l5"
+#elif defined(PICNIC3_L3)
+#define CRYPTO_SECRETKEYBYTES (1 + 2 * 24 + 24)
+#define CRYPTO_PUBLICKEYBYTES (1 + 2 * 24)
+#define CRYPTO_BYTES (4 + 35024)
+#define CRYPTO_ALGNAME "picnic3l3"
+#else
 #define CRYPTO_SECRETKEYBYTES (1 + 2 * 17 + 17)
 #define CRYPTO_PUBLICKEYBYTES (1 + 2 * 17)
 #define CRYPTO_BYTES (4 + 14608)
 #define CRYPTO_ALGNAME "picnic3l1fs"
+#endif
 #define CRYPTO_DETERMINISTIC 1
 
 #include <stddef.h>
@@ -14,5 +26,11 @@ int crypto_sign(unsigned char* sm, size_t* smlen, const unsigned char* m,
                 size_t mlen, const unsigned char* sk);
 int crypto_sign_open(unsigned char* m, size_t* mlen, const unsigned char* sm,
                      size_t smlen, const unsigned char* pk);
+/* Detached signatures: the signature (at most CRYPTO_BYTES - 4 bytes) is written to and read from
+ * a separate buffer and the message is not copied. */
+int crypto_sign_signature(unsigned char* sig, size_t* siglen, const unsigned char* m,
+                          size_t mlen, const unsigned char* sk);
+int crypto_sign_verify(const unsigned char* sig, size_t siglen, const unsigned char* m,
+                       size_t mlen, const unsigned char* pk);
 
 #endif
@@ -0,0 +1,164 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+#include "kdf_shake_x4.h"
+#include "macros.h"
+
+#if defined(KECCAK_X4_AVX2)
+#include <immintrin.h>
+#include <string.h>
+
+#define SHAKE128_RATE 168
+#define SHAKE256_RATE 136
+
+static const uint64_t keccak_round_constants[24] = {
+    UINT64_C(0x0000000000000001), UINT64_C(0x0000000000008082), UINT64_C(0x800000000000808a),
+    UINT64_C(0x8000000080008000), UINT64_C(0x000000000000808b), UINT64_C(0x0000000080000001),
+    UINT64_C(0x8000000080008081), UINT64_C(0x8000000000008009), UINT64_C(0x000000000000008a),
+    UINT64_C(0x0000000000000088), UINT64_C(0x0000000080008009), UINT64_C(0x000000008000000a),
+    UINT64_C(0x000000008000808b), UINT64_C(0x800000000000008b), UINT64_C(0x8000000000008089),
+    UINT64_C(0x8000000000008003), UINT64_C(0x8000000000008002), UINT64_C(0x8000000000000080),
+    UINT64_C(0x000000000000800a), UINT64_C(0x800000008000000a), UINT64_C(0x8000000080008081),
+    UINT64_C(0x8000000000008080), UINT64_C(0x0000000080000001), UINT64_C(0x8000000080008008),
+};
+
+/* rotation offsets of lane x + 5 * y */
+static const unsigned int keccak_rho_offsets[25] = {
+    0, 1, 62, 28, 27, 36, 44, 6, 55, 20, 3, 10, 43, 25, 39, 41, 45, 15, 21, 8, 18, 2, 61, 56, 14,
+};
+
+#define index(x, y) (((x) % 5) + 5 * ((y) % 5))
+
+ATTR_TARGET_AVX2 static inline __m256i rol64_avx2(__m256i a, unsigned int offset) {
+  return _mm256_or_si256(_mm256_sll_epi64(a, _mm_cvtsi32_si128(offset)),
+                         _mm256_srl_epi64(a, _mm_cvtsi32_si128(64 - offset)));
+}
+
+ATTR_TARGET_AVX2 static void keccakf1600_x4_avx2(uint64_t* state) {
+  __m256i A[25], B[25], C[5], D[5];
+
+  for (unsigned int i = 0; i < 25; ++i) {
+    A[i] = _mm256_loadu_si256((const __m256i*)&state[4 * i]);
+  }
+
+  for (unsigned int round = 0; round < 24; ++round) {
+    /* theta */
+    for (unsigned int x = 0; x < 5; ++x) {
+      C[x] = _mm256_xor_si256(_mm256_xor_si256(A[index(x, 0)], A[index(x, 1)]),
+                              _mm256_xor_si256(_mm256_xor_si256(A[index(x, 2)], A[index(x, 3)]),
+                                               A[index(x, 4)]));
+    }
+    for (unsigned int x = 0; x < 5; ++x) {
+      D[x] = _mm256_xor_si256(rol64_avx2(C[(x + 1) % 5], 1), C[(x + 4) % 5]);
+    }
+    /* theta, rho and pi */
+    for (unsigned int x = 0; x < 5; ++x) {
+      for (unsigned int y = 0; y < 5; ++y) {
+        B[index(y, 2 * x + 3 * y)] = rol64_avx2(_mm256_xor_si256(A[index(x, y)], D[x]),
+                                                keccak_rho_offsets[index(x, y)]);
+      }
+    }
+    /* chi */
+    for (unsigned int y = 0; y < 5; ++y) {
+      for (unsigned int x = 0; x < 5; ++x) {
+        A[index(x, y)] = _mm256_xor_si256(
+            B[index(x, y)], _mm256_andnot_si256(B[index(x + 1, y)], B[index(x + 2, y)]));
+      }
+    }
+    /* iota */
+    A[0] = _mm256_xor_si256(A[0], _mm256_set1_epi64x((long long)keccak_round_constants[round]));
+  }
+
+  for (unsigned int i = 0; i < 25; ++i) {
+    _mm256_storeu_si256((__m256i*)&state[4 * i], A[i]);
+  }
+}
+
+#undef index
+
+int hash_x4_available(void) {
+  static int supported = -1;
+  if (supported < 0) {
+    __builtin_cpu_init();
+    supported = __builtin_cpu_supports("avx2") ? 1 : 0;
+  }
+  return supported;
+}
+
+static inline void xor_byte(hash_context_x4* ctx, unsigned int k, uint8_t byte) {
+  ctx->state[4 * (ctx->pos / 8) + k] ^= (uint64_t)byte << (8 * (ctx->pos % 8));
+}
+
+static inline uint8_t extract_byte(const hash_context_x4* ctx, unsigned int k) {
+  return (uint8_t)(ctx->state[4 * (ctx->pos / 8) + k] >> (8 * (ctx->pos % 8)));
+}
+
+void hash_init_x4(hash_context_x4* ctx, size_t digest_size) {
+  memset(ctx->state, 0, sizeof(ctx->state));
+  ctx->rate = digest_size == 32 ? SHAKE128_RATE : SHAKE256_RATE;
+  ctx->pos  = 0;
+}
+
+void hash_init_prefix_x4(hash_context_x4* ctx, size_t digest_size, const uint8_t prefix) {
+  hash_init_x4(ctx, digest_size);
+  hash_update_x4_1(ctx, &prefix, sizeof(prefix));
+}
+
+void hash_update_x4(hash_context_x4* ctx, const uint8_t* const* data, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    for (unsigned int k = 0; k < 4; ++k) {
+      xor_byte(ctx, k, data[k][i]);
+    }
+    if (++ctx->pos == ctx->rate) {
+      keccakf1600_x4_avx2(ctx->state);
+      ctx->pos = 0;
+    }
+  }
+}
+
+void hash_update_x4_1(hash_context_x4* ctx, const uint8_t* data, size_t size) {
+  const uint8_t* const data_x4[4] = {data, data, data, data};
+  hash_update_x4(ctx, data_x4, size);
+}
+
+void hash_update_x4_uint16_le(hash_context_x4* ctx, const uint16_t data[4]) {
+  uint8_t data_le[4][sizeof(uint16_t)];
+  for (unsigned int k = 0; k < 4; ++k) {
+    data_le[k][0] = (uint8_t)data[k];
+    data_le[k][1] = (uint8_t)(data[k] >> 8);
+  }
+  const uint8_t* const data_x4[4] = {data_le[0], data_le[1], data_le[2], data_le[3]};
+  hash_update_x4(ctx, data_x4, sizeof(uint16_t));
+}
+
+void hash_final_x4(hash_context_x4* ctx) {
+  for (unsigned int k = 0; k < 4; ++k) {
+    xor_byte(ctx, k, 0x1f);
+  }
+  ctx->pos = ctx->rate - 1;
+  for (unsigned int k = 0; k < 4; ++k) {
+    xor_byte(ctx, k, 0x80);
+  }
+  keccakf1600_x4_avx2(ctx->state);
+  ctx->pos = 0;
+}
+
+void hash_squeeze_x4(hash_context_x4* ctx, uint8_t* const* buffer, size_t buflen) {
+  for (size_t i = 0; i < buflen; ++i) {
+    if (ctx->pos == ctx->rate) {
+      keccakf1600_x4_avx2(ctx->state);
+      ctx->pos = 0;
+    }
+    for (unsigned int k = 0; k < 4; ++k) {
+      buffer[k][i] = extract_byte(ctx, k);
+    }
+    ++ctx->pos;
+  }
+}
+#endif
@@ -0,0 +1,61 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+#ifndef KDF_SHAKE_X4_H
+#define KDF_SHAKE_X4_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* The four-lane functions are only built where the permutation has a SIMD backend (AVX2 on
+ * x86-64). Computed lane by lane, they are slower than four single-lane hashes, so callers use
+ * them only if KECCAK_X4_AVX2 is defined and hash_x4_available() returns 1, and otherwise hash
+ * with kdf_shake.h. */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(NO_KECCAK_X4_AVX2)
+#define KECCAK_X4_AVX2
+#endif
+
+#if defined(KECCAK_X4_AVX2)
+/* Four SHAKE instances that absorb inputs of the same length and are squeezed to the same length,
+ * with the four Keccak-f[1600] permutations computed at once with AVX2. Used for the independent
+ * hashes of the parties of a KKW repetition and of the nodes of a tree level. The state is stored
+ * lane-interleaved, i.e., lane i of instance j is at state[4 * i + j]. */
+typedef struct hash_context_x4_s {
+  uint64_t state[25 * 4];
+  unsigned int rate;
+  unsigned int pos;
+} hash_context_x4;
+
+/**
+ * Initialize all four instances based on the digest size used by Picnic, see hash_init().
+ */
+void hash_init_x4(hash_context_x4* ctx, size_t digest_size);
+void hash_init_prefix_x4(hash_context_x4* ctx, size_t digest_size, const uint8_t prefix);
+/**
+ * Absorb size bytes of data[j] into instance j.
+ */
+void hash_update_x4(hash_context_x4* ctx, const uint8_t* const* data, size_t size);
+/**
+ * Absorb the same size bytes of data into all instances.
+ */
+void hash_update_x4_1(hash_context_x4* ctx, const uint8_t* data, size_t size);
+void hash_update_x4_uint16_le(hash_context_x4* ctx, const uint16_t data[4]);
+void hash_final_x4(hash_context_x4* ctx);
+/**
+ * Squeeze buflen bytes of instance j into buffer[j].
+ */
+void hash_squeeze_x4(hash_context_x4* ctx, uint8_t* const* buffer, size_t buflen);
+
+/**
+ * Returns 1 if the CPU supports AVX2, checked once.
+ */
+int hash_x4_available(void);
+#endif
+
+#endif
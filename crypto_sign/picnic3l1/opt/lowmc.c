@@ -20,49 +20,48 @@
 #include <assert.h>
 #include <string.h>
 
-#include "lowmc_129_129_4.h"
-
 /**
- * S-box for m = 43
+ * Bitsliced S-box layer, (a, b, c) are the bits c - 2, c - 1, c of every S-box
  */
-static void sbox_uint64_lowmc_129_129_4(mzd_local_t* in) {
-  mzd_local_t x0m[1], x1m[1], x2m[1];
-  // a
-  mzd_and_uint64_192(x0m, mask_129_129_43_a, in);
-  // b
-  mzd_and_uint64_192(x1m, mask_129_129_43_b, in);
-  // c
-  mzd_and_uint64_192(x2m, mask_129_129_43_c, in);
-
-  mzd_shift_left_uint64_192(x0m, x0m, 2);
-  mzd_shift_left_uint64_192(x1m, x1m, 1);
-
-  mzd_local_t t0[1], t1[1], t2[1];
-  // b & c
-  mzd_and_uint64_192(t0, x1m, x2m);
-  // c & a
-  mzd_and_uint64_192(t1, x0m, x2m);
-  // a & b
-  mzd_and_uint64_192(t2, x0m, x1m);
-
-  // (b & c) ^ a
-  mzd_xor_uint64_192(t0, t0, x0m);
-
-  // (c & a) ^ a ^ b
-  mzd_xor_uint64_192(t1, t1, x0m);
-  mzd_xor_uint64_192(t1, t1, x1m);
-
-  // (a & b) ^ a ^ b ^c
-  mzd_xor_uint64_192(t2, t2, x0m);
-  mzd_xor_uint64_192(t2, t2, x1m);
-  mzd_xor_uint64_192(t2, t2, x2m);
-
-  mzd_shift_right_uint64_192(t0, t0, 2);
-  mzd_shift_right_uint64_192(t1, t1, 1);
-
-  mzd_xor_uint64_192(t2, t2, t1);
-  mzd_xor_uint64_192(in, t2, t0);
-}
+#define picnic3_sbox_bitsliced(XOR, AND, SHL, SHR, bitmask_a, bitmask_b, bitmask_c)                \
+  do {                                                                                             \
+    mzd_local_t x0m[1], x1m[1], x2m[1];                                                            \
+    /* a */                                                                                        \
+    AND(x0m, bitmask_a, in);                                                                       \
+    /* b */                                                                                        \
+    AND(x1m, bitmask_b, in);                                                                       \
+    /* c */                                                                                        \
+    AND(x2m, bitmask_c, in);                                                                       \
+                                                                                                   \
+    SHL(x0m, x0m, 2);                                                                              \
+    SHL(x1m, x1m, 1);                                                                              \
+                                                                                                   \
+    mzd_local_t t0[1], t1[1], t2[1];                                                               \
+    /* b & c */                                                                                    \
+    AND(t0, x1m, x2m);                                                                             \
+    /* c & a */                                                                                    \
+    AND(t1, x0m, x2m);                                                                             \
+    /* a & b */                                                                                    \
+    AND(t2, x0m, x1m);                                                                             \
+                                                                                                   \
+    /* (b & c) ^ a */                                                                              \
+    XOR(t0, t0, x0m);                                                                              \
+                                                                                                   \
+    /* (c & a) ^ a ^ b */                                                                          \
+    XOR(t1, t1, x0m);                                                                              \
+    XOR(t1, t1, x1m);                                                                              \
+                                                                                                   \
+    /* (a & b) ^ a ^ b ^c */                                                                       \
+    XOR(t2, t2, x0m);                                                                              \
+    XOR(t2, t2, x1m);                                                                              \
+    XOR(t2, t2, x2m);                                                                              \
+                                                                                                   \
+    SHR(t0, t0, 2);                                                                                \
+    SHR(t1, t1, 1);                                                                                \
+                                                                                                   \
+    XOR(t2, t2, t1);                                                                               \
+    XOR(in, t2, t0);                                                                               \
+  } while (0)
 
 #define picnic3_aux_sbox_bitsliced(LOWMC_N, XOR, AND, SHL, SHR, bitmask_a, bitmask_b, bitmask_c)   \
   do {                                                                                             \
@@ -128,6 +127,53 @@ static void sbox_uint64_lowmc_129_129_4(mzd_local_t* in) {
     tapes->aux_pos += LOWMC_N;                                                                     \
   } while (0)
 
+#if defined(PICNIC3_L5)
+#include "lowmc_255_255_4.h"
+
+static void sbox_uint64_lowmc_255_255_4(mzd_local_t* in) {
+  picnic3_sbox_bitsliced(mzd_xor_uint64_256, mzd_and_uint64_256, mzd_shift_left_uint64_256,
+                         mzd_shift_right_uint64_256, mask_255_255_85_a, mask_255_255_85_b,
+                         mask_255_255_85_c);
+}
+
+static void sbox_aux_uint64_lowmc_255_255_4(mzd_local_t* statein, mzd_local_t* stateout,
+                                            randomTape_t* tapes) {
+  picnic3_aux_sbox_bitsliced(LOWMC_255_255_4_N, mzd_xor_uint64_256, mzd_and_uint64_256,
+                             mzd_shift_left_uint64_256, mzd_shift_right_uint64_256,
+                             mask_255_255_85_a, mask_255_255_85_b, mask_255_255_85_c);
+}
+
+// uint64 based implementation
+#define IMPL uint64
+#include "lowmc_255_255_4_fns_uint64.h"
+#elif defined(PICNIC3_L3)
+#include "lowmc_192_192_4.h"
+
+static void sbox_uint64_lowmc_192_192_4(mzd_local_t* in) {
+  picnic3_sbox_bitsliced(mzd_xor_uint64_192, mzd_and_uint64_192, mzd_shift_left_uint64_192,
+                         mzd_shift_right_uint64_192, mask_192_192_64_a, mask_192_192_64_b,
+                         mask_192_192_64_c);
+}
+
+static void sbox_aux_uint64_lowmc_192_192_4(mzd_local_t* statein, mzd_local_t* stateout,
+                                            randomTape_t* tapes) {
+  picnic3_aux_sbox_bitsliced(LOWMC_192_192_4_N, mzd_xor_uint64_192, mzd_and_uint64_192,
+                             mzd_shift_left_uint64_192, mzd_shift_right_uint64_192,
+                             mask_192_192_64_a, mask_192_192_64_b, mask_192_192_64_c);
+}
+
+// uint64 based implementation
+#define IMPL uint64
+#include "lowmc_192_192_4_fns_uint64.h"
+#else
+#include "lowmc_129_129_4.h"
+
+static void sbox_uint64_lowmc_129_129_4(mzd_local_t* in) {
+  picnic3_sbox_bitsliced(mzd_xor_uint64_192, mzd_and_uint64_192, mzd_shift_left_uint64_192,
+                         mzd_shift_right_uint64_192, mask_129_129_43_a, mask_129_129_43_b,
+                         mask_129_129_43_c);
+}
+
 static void sbox_aux_uint64_lowmc_129_129_4(mzd_local_t* statein, mzd_local_t* stateout,
                                             randomTape_t* tapes) {
   picnic3_aux_sbox_bitsliced(LOWMC_129_129_4_N, mzd_xor_uint64_192, mzd_and_uint64_192,
@@ -138,4 +184,178 @@ static void sbox_aux_uint64_lowmc_129_129_4(mzd_local_t* statein, mzd_local_t* s
 // uint64 based implementation
 #define IMPL uint64
 #include "lowmc_129_129_4_fns_uint64.h"
-#include "lowmc.c.i"
\ No newline at end of file
+#endif
+#include "lowmc.c.i"
+
+/* bits of the lower half of each block of 2 * 2^s bits */
+static const word transpose64_masks[6] = {
+    UINT64_C(0x5555555555555555), UINT64_C(0x3333333333333333), UINT64_C(0x0f0f0f0f0f0f0f0f),
+    UINT64_C(0x00ff00ff00ff00ff), UINT64_C(0x0000ffff0000ffff), UINT64_C(0x00000000ffffffff)};
+
+/* transposes the 64x64 bit matrix a, i.e. bit j of a[k] is swapped with bit k of a[j] */
+static void transpose64(word a[64]) {
+  for (unsigned int s = 6; s--;) {
+    const unsigned int width = 1u << s;
+    for (unsigned int j = 0; j < 64; j += 2 * width) {
+      for (unsigned int k = j; k < j + width; ++k) {
+        const word t = ((a[k] >> width) ^ a[k + width]) & transpose64_masks[s];
+        a[k] ^= t << width;
+        a[k + width] ^= t;
+      }
+    }
+  }
+}
+
+/*
+ * Bitsliced LowMC for many independent (key, plaintext) pairs.
+ *
+ * Bit i of the state (the bit selecting row i of the matrices) of up to
+ * LOWMC_BITSLICED_BLOCKS encryptions is stored in one lane, so a matrix row
+ * is applied to all blocks with a handful of word XORs and the S-box layer is
+ * evaluated with plain AND/XOR on whole lanes. The matrices only select which
+ * lanes are combined, hence the loops below branch on public data only.
+ */
+typedef struct {
+  word w[LOWMC_BITSLICED_WORDS];
+} bitsliced_lane_t;
+
+#define N_LOWMC_BITSLICED CONCAT(lowmc_bitsliced, CONCAT(IMPL, LOWMC_INSTANCE))
+
+/* state bit i lives at global bit offset + i of the block, the bits below are unused */
+#define BITSLICED_WORDS ((LOWMC_N + 63) / 64)
+#define BITSLICED_OFFSET (BITSLICED_WORDS * 64 - LOWMC_N)
+#define BITSLICED_POS(i) (BITSLICED_OFFSET + (i))
+/* distance between two matrix rows in words (packed or full blocks) */
+#define BITSLICED_ROW_STRIDE (sizeof(*LOWMC_INSTANCE.k0_matrix) / sizeof(word))
+
+static inline void bitsliced_xor(bitsliced_lane_t* y, const bitsliced_lane_t* x) {
+  for (unsigned int w = 0; w < LOWMC_BITSLICED_WORDS; ++w) {
+    y->w[w] ^= x->w[w];
+  }
+}
+
+/* word w of 64 blocks at a time is transposed into one word of the lanes of bits 64 * w + k */
+static void bitsliced_transpose_in(bitsliced_lane_t* out, const mzd_local_t* in, size_t count) {
+  memset(out, 0, sizeof(bitsliced_lane_t) * LOWMC_N);
+  for (size_t j0 = 0; j0 < count; j0 += 64) {
+    const size_t n = MIN(count - j0, (size_t)64);
+    for (unsigned int w = 0; w < BITSLICED_WORDS; ++w) {
+      word m[64];
+      for (size_t j = 0; j < 64; ++j) {
+        m[j] = j < n ? CONST_BLOCK(&in[j0 + j], 0)->w64[w] : 0;
+      }
+      transpose64(m);
+      for (unsigned int k = w ? 0 : BITSLICED_OFFSET; k < 64; ++k) {
+        out[w * 64 + k - BITSLICED_OFFSET].w[j0 / 64] = m[k];
+      }
+    }
+  }
+}
+
+static void bitsliced_transpose_out(mzd_local_t* out, const bitsliced_lane_t* in, size_t count) {
+  for (size_t j0 = 0; j0 < count; j0 += 64) {
+    const size_t n = MIN(count - j0, (size_t)64);
+    for (size_t j = 0; j < n; ++j) {
+      memset(BLOCK(&out[j0 + j], 0), 0, sizeof(block_t));
+    }
+    for (unsigned int w = 0; w < BITSLICED_WORDS; ++w) {
+      word m[64] = {0};
+      for (unsigned int k = w ? 0 : BITSLICED_OFFSET; k < 64; ++k) {
+        m[k] = in[w * 64 + k - BITSLICED_OFFSET].w[j0 / 64];
+      }
+      transpose64(m);
+      for (size_t j = 0; j < n; ++j) {
+        BLOCK(&out[j0 + j], 0)->w64[w] = m[j];
+      }
+    }
+  }
+}
+
+/* y ^= x * A, where the rows of A are stride words apart */
+static void bitsliced_addmul(bitsliced_lane_t* y, const bitsliced_lane_t* x, const word* A,
+                             const size_t stride) {
+  for (unsigned int r = 0; r < LOWMC_N; ++r, A += stride) {
+    word row[BITSLICED_WORDS];
+    for (unsigned int w = 0; w < BITSLICED_WORDS; ++w) {
+      row[w] = A[w];
+    }
+    row[0] &= ~((UINT64_C(1) << BITSLICED_OFFSET) - 1);
+    for (unsigned int w = 0; w < BITSLICED_WORDS; ++w) {
+      for (; row[w]; row[w] &= row[w] - 1) {
+        const unsigned int q = w * 64 + ctz64(row[w]);
+        bitsliced_xor(&y[q - BITSLICED_OFFSET], &x[r]);
+      }
+    }
+  }
+}
+
+static void bitsliced_xor_constant(bitsliced_lane_t* x, const mzd_local_t* constant) {
+  const block_t* block = CONST_BLOCK(constant, 0);
+  for (unsigned int i = 0; i < LOWMC_N; ++i) {
+    const unsigned int q = BITSLICED_POS(i);
+    if ((block->w64[q / 64] >> (q % 64)) & 1) {
+      for (unsigned int w = 0; w < LOWMC_BITSLICED_WORDS; ++w) {
+        x[i].w[w] = ~x[i].w[w];
+      }
+    }
+  }
+}
+
+/*
+ * same S-box layer as picnic3_sbox_bitsliced: (a, b, c) are the bits c - 2, c - 1, c and all
+ * instances have a full S-box layer with n divisible by 3, so c is every third bit
+ */
+static void bitsliced_sbox(bitsliced_lane_t* x) {
+  for (unsigned int i = 2; i < LOWMC_N; i += 3) {
+    for (unsigned int w = 0; w < LOWMC_BITSLICED_WORDS; ++w) {
+      const word a = x[i - 2].w[w];
+      const word b = x[i - 1].w[w];
+      const word c = x[i].w[w];
+
+      x[i - 2].w[w] = (b & c) ^ a;
+      x[i - 1].w[w] = (c & a) ^ a ^ b;
+      x[i].w[w]     = (a & b) ^ a ^ b ^ c;
+    }
+  }
+}
+
+void N_LOWMC_BITSLICED(lowmc_key_t const* keys, mzd_local_t const* p, mzd_local_t* c,
+                       size_t count) {
+  bitsliced_lane_t key[LOWMC_N];
+  bitsliced_lane_t x[LOWMC_N];
+  bitsliced_lane_t y[LOWMC_N];
+
+  while (count) {
+    const size_t chunk = MIN(count, (size_t)LOWMC_BITSLICED_BLOCKS);
+
+    bitsliced_transpose_in(key, keys, chunk);
+    bitsliced_transpose_in(x, p, chunk);
+    bitsliced_addmul(x, key, LOWMC_INSTANCE.k0_matrix->w64, BITSLICED_ROW_STRIDE);
+
+    LOWMC_ROUND const* round = LOWMC_INSTANCE.rounds;
+    for (unsigned int i = 0; i < LOWMC_R; ++i, ++round) {
+      bitsliced_sbox(x);
+
+      memset(y, 0, sizeof(y));
+#if defined(MUL_LK)
+      bitsliced_addmul(y, x, round->lk_matrix->l.w64, 2 * BITSLICED_ROW_STRIDE);
+      bitsliced_xor_constant(y, round->constant);
+      bitsliced_addmul(y, key, round->lk_matrix->k.w64, 2 * BITSLICED_ROW_STRIDE);
+#else
+      bitsliced_addmul(y, x, round->l_matrix->w64, BITSLICED_ROW_STRIDE);
+      bitsliced_xor_constant(y, round->constant);
+      bitsliced_addmul(y, key, round->k_matrix->w64, BITSLICED_ROW_STRIDE);
+#endif
+      memcpy(x, y, sizeof(x));
+    }
+
+    bitsliced_transpose_out(c, x, chunk);
+
+    keys += chunk;
+    p += chunk;
+    c += chunk;
+    count -= chunk;
+  }
+
+  memset(key, 0, sizeof(key));
+}
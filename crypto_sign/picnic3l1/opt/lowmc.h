@@ -16,9 +16,33 @@
 typedef struct randomTape_t randomTape_t;
 
 typedef void (*lowmc_implementation_f)(lowmc_key_t const*, mzd_local_t const*, mzd_local_t*);
+typedef void (*lowmc_batch_implementation_f)(lowmc_key_t const*, mzd_local_t const*, mzd_local_t*,
+                                             size_t);
 typedef void (*lowmc_compute_aux_implementation_f)(lowmc_key_t*, randomTape_t* tapes);
 
+/* only the instance selected in picnic_params.h is compiled */
 void lowmc_uint64_lowmc_129_129_4(lowmc_key_t const*, mzd_local_t const*, mzd_local_t*);
 void lowmc_compute_aux_uint64_lowmc_129_129_4(lowmc_key_t*, randomTape_t* tapes);
+void lowmc_uint64_lowmc_192_192_4(lowmc_key_t const*, mzd_local_t const*, mzd_local_t*);
+void lowmc_compute_aux_uint64_lowmc_192_192_4(lowmc_key_t*, randomTape_t* tapes);
+void lowmc_uint64_lowmc_255_255_4(lowmc_key_t const*, mzd_local_t const*, mzd_local_t*);
+void lowmc_compute_aux_uint64_lowmc_255_255_4(lowmc_key_t*, randomTape_t* tapes);
+
+/* number of 64 bit words per bitsliced lane, i.e. blocks encrypted per pass / 64 */
+#if !defined(LOWMC_BITSLICED_WORDS)
+#define LOWMC_BITSLICED_WORDS 4
+#endif
+#define LOWMC_BITSLICED_BLOCKS (64 * LOWMC_BITSLICED_WORDS)
+
+/**
+ * Encrypts count independent plaintexts p[i] under keys[i] into c[i], processing
+ * LOWMC_BITSLICED_BLOCKS blocks at once.
+ */
+void lowmc_bitsliced_uint64_lowmc_129_129_4(lowmc_key_t const*, mzd_local_t const*, mzd_local_t*,
+                                            size_t);
+void lowmc_bitsliced_uint64_lowmc_192_192_4(lowmc_key_t const*, mzd_local_t const*, mzd_local_t*,
+                                            size_t);
+void lowmc_bitsliced_uint64_lowmc_255_255_4(lowmc_key_t const*, mzd_local_t const*, mzd_local_t*,
+                                            size_t);
 
 #endif
@@ -3,7 +3,8 @@
 
 #include "lowmc_129_129_4.h"
 
-static const mzd_local_t L_0[] = {
+#if !defined(LOWMC_INTERLEAVED_LK)
+static const mzd_row192_t L_0[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3ce84e7dabb1b5ff), UINT64_C(0xaec0e87f5ec44964)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc078a98402182027), UINT64_C(0xec4e502c9f3bb861)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x94e95d5a34ba6673), UINT64_C(0xf1032011bc5271fd)}},
@@ -135,7 +136,7 @@ static const mzd_local_t L_0[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x533bac8bac6811b4), UINT64_C(0x561eaa155357a696)}},
 };
 
-static const mzd_local_t L_1[] = {
+static const mzd_row192_t L_1[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8fbf4fdaa498b991), UINT64_C(0xb356831a047fdf3f)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1a7dda5e0d686cdf), UINT64_C(0x04dda133221492ff)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7bd38c7eaf55a38f), UINT64_C(0x8c45ff8673c1ed10)}},
@@ -267,7 +268,7 @@ static const mzd_local_t L_1[] = {
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5f7c915f4bbf9952), UINT64_C(0x78701574faacb626)}},
 };
 
-static const mzd_local_t L_2[] = {
+static const mzd_row192_t L_2[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe657c33ebece05a4), UINT64_C(0x7f10363963225fbc)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xb4a71ce9d6295b54), UINT64_C(0xa989acd6502d9127)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe4c4d6566f88e932), UINT64_C(0x448a4009d9987bc2)}},
@@ -399,7 +400,7 @@ static const mzd_local_t L_2[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x716e31b6a0dae741), UINT64_C(0x1e7e9f80b9f15813)}},
 };
 
-static const mzd_local_t L_3[] = {
+static const mzd_row192_t L_3[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x0d1df2efeb111aaf), UINT64_C(0x7996850307bef0f2)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf197b7ed55baacae), UINT64_C(0x2bbaa267f09b460b)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x52ce61c3310e747b), UINT64_C(0xd144605de0dbff40)}},
@@ -531,7 +532,1582 @@ static const mzd_local_t L_3[] = {
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x86dedc4eb3531030), UINT64_C(0x4c962c641f8a2d4f)}},
 };
 
-static const mzd_local_t Li_0[] = {
+static const mzd_row192_t K_1[] = {
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf5363757a219b4e9), UINT64_C(0xc9945ebdba4ddd30)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd31df2137100de97), UINT64_C(0x77c26116f7d25278)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3161a689d06e391d), UINT64_C(0xcb207af91bb451e0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x71f6287713901099), UINT64_C(0x016a6a78f7aafb02)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfcaf5c3461f01c1e), UINT64_C(0x42f1593ef99ba2d8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xff25c0019975a3bd), UINT64_C(0x5b4762914790ad2e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xaf26d350e5c20f05), UINT64_C(0x270b1adc9ccdbeab)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4bf0944d301272d7), UINT64_C(0xbe01431af36a79b6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb4fa159623104bd2), UINT64_C(0xd7e42c6bd5f77206)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2ab86858847d3ec7), UINT64_C(0xe010e903f4996c14)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8f9cdfcd4ee95985), UINT64_C(0x923d05cd20c6bd11)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3afd6fcf76718ea1), UINT64_C(0x63bf144ca1f59f8b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc63c4e3da8f0cf74), UINT64_C(0x1112e92e384b6faf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6bb4fcfb1d6c962a), UINT64_C(0xced0ce5dc62b0367)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4ad93665968f343e), UINT64_C(0x3e6f245d8a5e0c4a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x46b04fafbae9e6be), UINT64_C(0xd0e9ecc3396e3dc7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3622ca4489e25b83), UINT64_C(0xc3ab6eb1757c66e8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7e8496f187fb3189), UINT64_C(0x0b583809933e3de1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9fbc3b79d01650c3), UINT64_C(0xdad8847b159ac42f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x035d4d3dc427795f), UINT64_C(0x4f4850901a30b2a4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf2f726e7dd8eec71), UINT64_C(0x43ebbdf191281f91)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4491d080168e7768), UINT64_C(0x3d6eef3bcb17e571)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x16e08719c85fc377), UINT64_C(0xafabe894f2841dec)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x90a6d88d8964af49), UINT64_C(0x98c0d6bfb34c5606)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x169248e3289c5c75), UINT64_C(0x3360e4fd445e897c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd35840c12bf865fc), UINT64_C(0x58edc5f984dc21dc)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8e613ada07fbb9e6), UINT64_C(0xcef6ab5e5ea6d3a6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xef4ea59338f19fc7), UINT64_C(0x921db55510e2a25d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x24340d58e6cb17be), UINT64_C(0x0114034b3946f7f1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x10031a2a9f89b238), UINT64_C(0x09ec5347be5b9fa4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc92ac314f43ad9fc), UINT64_C(0xc401de26dbab7209)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x772973ecbc1c1830), UINT64_C(0xd3d34c74b7e5139d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa9ee2ea0e7e6a89b), UINT64_C(0x34e074d5f1452e56)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6145c6a99e729157), UINT64_C(0x3cd0db1c42c166fa)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5906d211b3333a58), UINT64_C(0xe7fa501ca5d46686)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8d466f70a1232b61), UINT64_C(0x12618e03d5fb02ff)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc730f1e8065b1cd8), UINT64_C(0xc5e783dd95ad1af2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2edbfdd1d2b031e9), UINT64_C(0x9e17fec22d84ecc4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x472760f18d4d682e), UINT64_C(0xe20baf1459353f40)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x62d523cdb4566fcc), UINT64_C(0x61becb0b5dde0387)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x04b7718ef09cfdba), UINT64_C(0x68ba55cd5fb1cd0d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xee5da9eef353626f), UINT64_C(0xa1dab56767368f13)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x32cdd83ea5d08f69), UINT64_C(0x354114837134c693)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x026466686e8a9cef), UINT64_C(0xe2f0fe00d8b7c38f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x674eb66501d8a527), UINT64_C(0xf446f64a78c502fc)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x240fed9fed3d7a41), UINT64_C(0xbfbf60a97a7b877f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5692fdf9811232bb), UINT64_C(0xffd341c33435889f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x63eec18d2b91f8d3), UINT64_C(0x56b8b8ce73868f38)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfb5516aa9c9a942f), UINT64_C(0xf75c442966a64d86)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6f84adbca591ecf2), UINT64_C(0x589d988b5660df15)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc81523de3ba5dd18), UINT64_C(0xd1c150fbe1c65011)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x56f0ab0106241d42), UINT64_C(0xee19475812e54bc1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4278dd3bc3fc3045), UINT64_C(0xd834e80cfec32f97)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x00b26dea0e44fc93), UINT64_C(0xcd1a7212fbd031c6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8eabc48d6e526641), UINT64_C(0xae27bf27ff090f82)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0f9b5e88c067c2d9), UINT64_C(0x51019a6f9601e331)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x162fc75c0da0920c), UINT64_C(0x3b527686d91f3beb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1855595a16745622), UINT64_C(0xbb16ec66fd07322b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xde3c673fe0593363), UINT64_C(0x3cc1f1d36addd2bd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x47e8b4357790f29d), UINT64_C(0x28bfb7674388f007)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x44df4c4b305ab0ca), UINT64_C(0x5c80a85c4945185d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfffaa05d20512d37), UINT64_C(0x2a0adcc1ba895b4f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbcaca0d8ce6df571), UINT64_C(0xa9c65d397e9e6ac5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8e37c97289115fbe), UINT64_C(0xf1a006eb93b7898b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb0ac1a6827f69d38), UINT64_C(0x7e93d0fd98c1ff31)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x47ab05e9640807c9), UINT64_C(0xbce9f852ecb46782)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf63c72e84d1c06ac), UINT64_C(0x7e8e8affac966729)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe7f2239bb0485313), UINT64_C(0x1e0724ad61ed6a13)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbef5aa8c48488f09), UINT64_C(0xaf8ebf7490f8c7b3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x876e840acd57d672), UINT64_C(0x0e1dd2a1f3b66e1e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x62995e51db834ebc), UINT64_C(0xb49ac5801dc1ba1d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfeeff53b4295b21f), UINT64_C(0x0aea6e194f8df5f9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xde88957a63c285ec), UINT64_C(0x8315c094b30186a3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x74da2f153431e136), UINT64_C(0x9e8a537afdf27340)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6943477d3b5421e9), UINT64_C(0x56c78b5670a9d449)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x277b04efdf4bf3e6), UINT64_C(0xcab0f189a6f70370)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x51d716258c09ee47), UINT64_C(0x534973bbd9e72bf6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x119c2ed13b30b8a2), UINT64_C(0x69ebaa5c7284d94d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9e6998f475db380f), UINT64_C(0x9c9b52426ebe7397)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc3210b19141f177f), UINT64_C(0x4153f3c5f6d2db81)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x29296b385286df59), UINT64_C(0x139596b347392417)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x93402d7bd6760fff), UINT64_C(0xde1238b6b3fdeeee)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa6e1a7e1a5acfa6a), UINT64_C(0x1cc1a374ccb99270)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x02ae83a7fd5fd149), UINT64_C(0xf1de89ad251935b0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xec772d121364927b), UINT64_C(0x925cb8511a409128)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x355a5ba624bc0814), UINT64_C(0xdfd5c1abc07d7829)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9cb0ba11678ebfc6), UINT64_C(0x6e409d630460e1e6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x041bdd49d9a8dc42), UINT64_C(0x72efc576dc7a9bf8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x70841bbb21d21f39), UINT64_C(0xd8731535cb1810bd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbe6f76faec213844), UINT64_C(0xf5839c79ac403dcc)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb9aa440704a5110e), UINT64_C(0xda62db507ed08de2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7c490eae0da156fe), UINT64_C(0xc637f4dac0e1909b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0c6b09abc53fa86d), UINT64_C(0xcb2897040f317e45)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4a6ff134e2513b65), UINT64_C(0x55216153ccd5420b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x44f705223b38d400), UINT64_C(0xfddb4d8c5ec2a620)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x35e10890b08dbfd6), UINT64_C(0x1600edcb9ad57177)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2fb474e4e4018d49), UINT64_C(0x087c5eacfa9d7625)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcc02cb336c6dcb51), UINT64_C(0xbaf7ef5060ab3691)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2a7cd66e5c242379), UINT64_C(0x958a03620fbed86f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x29a2ca09e04b8a1d), UINT64_C(0x55a3183d75cccff9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7b64ab8c0ec73451), UINT64_C(0x3fcce79fe9a5732e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2950a5be2145793), UINT64_C(0x2c62f89210b25565)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x98081ae203e19ce0), UINT64_C(0xb97a2a4286207af6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x695aaaecce0c36f2), UINT64_C(0x5b77b2c17c95ada4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x531b5cd92cdedeed), UINT64_C(0x1afc676ca91210fe)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7a5fd571d63802bf), UINT64_C(0x58301cf6ca974ed3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc7334b16712d348d), UINT64_C(0x52f0aa71d0d0f2df)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9c511954b5cc9785), UINT64_C(0xd89d3d993d914979)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xacae6ebe469aaa9e), UINT64_C(0xbeb97458dcd15732)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd9321f1572cf69e), UINT64_C(0x12e856a8cfd21f1e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa6e6684b3298e0e9), UINT64_C(0x52a37bd1a933f62c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x73ab7f0dbf22e6c3), UINT64_C(0x4aa39fe6b85c07c7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x33dd18c0feed877e), UINT64_C(0xa98cfaa94bbd21ae)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe29ee2e2c9bd17dc), UINT64_C(0x9453d72f392d6eae)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x275e9cd936d73826), UINT64_C(0x49dbe0da4c6f0d29)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x75cab49bb66b26f7), UINT64_C(0x190504c92ee7b837)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x813ce6dca91bbd40), UINT64_C(0xec32e2bc3b0bced9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf5e74afded28ec4d), UINT64_C(0x3a5b954e3f35106e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7b5ea07625f86d1c), UINT64_C(0x29df6a1c902a3a2e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb318c5d0282fb3cc), UINT64_C(0x96f515a4a2b2fb2a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8f57076415969f3b), UINT64_C(0xcf0205928d92d604)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4dd880920753ad33), UINT64_C(0x4ea860b1b7787fd2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb95e8cfa0ca87d48), UINT64_C(0x4936a0cc6f45426d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb6fb0371a2b3f8c8), UINT64_C(0x0a12103972845439)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa9c33ee3ec23b789), UINT64_C(0xd16c2f0964df706c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe28bedb010b5339b), UINT64_C(0xce8f043efac64549)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9e91d438faa9b77d), UINT64_C(0xcc811c1bf8f92916)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2ac2746489f18de2), UINT64_C(0x6b3f969dea1627c5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf5c728d2ad4abed9), UINT64_C(0x6c3faf85da3ac0a5)}},
+};
+
+static const mzd_row192_t K_2[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7f2159388c3c2fca), UINT64_C(0x17b2916a7cc31c81)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf0a6d3b11fb5b6a7), UINT64_C(0x403a98c4b63f2797)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x010d47e2bce4fbd1), UINT64_C(0x530b4df986d3640d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc2de6a195423c2b8), UINT64_C(0x0a35adbd108a35a9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6dc9487872bbc668), UINT64_C(0xd086f00d36728b3d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8532d941e2d6b0f4), UINT64_C(0x4c11225eaf89082c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6518108854bd3591), UINT64_C(0xfee30d28da6cce58)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x13e611db0599385e), UINT64_C(0xbb3d83800b6052e2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4bb99b73c10a5c92), UINT64_C(0xde5dc90c3531b412)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x19f167f1352d3837), UINT64_C(0x17ac10a7569c22bf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6cb4a56970c55d10), UINT64_C(0xd7fa82da03e49e2b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9d114b96fa10e6ca), UINT64_C(0xa3a77ee60bdf189c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x77fda1f26c939042), UINT64_C(0xc4ed44592516b8f6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa946c240e502aeab), UINT64_C(0x13d3f412c449a6b0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x97ae1bcb54693685), UINT64_C(0x42805a8d7165ba38)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6a5c6e001c0ff70b), UINT64_C(0xda8ffc730b317a5a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7862c9aaaa94a827), UINT64_C(0x865b7f3e9dba2476)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0df4ecd758ed28ef), UINT64_C(0xccbed33c2b24649d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x22d402bf73d3ecd0), UINT64_C(0x574f9ed8e6f28bf0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9e3f6b57233820e2), UINT64_C(0x16233a9d0e95fc1f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x762bd3e449abecb0), UINT64_C(0xe7a2353c6a554246)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x15b77737c12fcce0), UINT64_C(0x3eec754b1193bbf6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc333f0b41e585b87), UINT64_C(0xc64caa762deb6682)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc4e94d33b2851a18), UINT64_C(0x38c228fb602de03f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd3dd64f74bd8e1fe), UINT64_C(0xb4a04c587f55f066)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd6298099b7bf438d), UINT64_C(0x7f055162ae088782)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb1aa1f5aab57bac6), UINT64_C(0x3f7353cf633c2174)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x63900cfea288085b), UINT64_C(0x9801482d9017c36e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa24125c0ecb5cc97), UINT64_C(0xda0b34abf1bf4501)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbf51d9d0120c585f), UINT64_C(0xf8d007af1161bc92)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xddf3f8470d2b2dbd), UINT64_C(0x35c48b7de9837936)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9d58038b2f21ec89), UINT64_C(0x8bce64f7d8a7a3a3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x95fd5bc23c131f2f), UINT64_C(0xc97ed9d52b4d82b4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1b120f9124ddd4a7), UINT64_C(0x8830657160ef30bc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9187768c164a2171), UINT64_C(0x9b994ddb760a5fe5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2253b6eaf0364b3f), UINT64_C(0x0eb6e406a550a4db)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe340b87c98fbd2cb), UINT64_C(0x78e06a352ab92757)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe65a2ae5b06ac6ee), UINT64_C(0x45a0cd068a7060f8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfe8c7c5fdcff83c0), UINT64_C(0x948466d8cb73dd34)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xec0e31d912fd4496), UINT64_C(0xc8ae977f8e7add1b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x37c70823d9362b45), UINT64_C(0xa777af814fcc5b3c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x58f8a6a3345a2a65), UINT64_C(0xcdbda914441c8bd9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x21d4defa413f3a36), UINT64_C(0xc8ee1d8ff8103618)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9eb238f077a4ac65), UINT64_C(0x4e535391595366a0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0180e66e53197078), UINT64_C(0xf94080e3d84fbf30)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa03fb48750308faf), UINT64_C(0xcc43c14834156ce4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4ba2324571535b4f), UINT64_C(0x8ea4ae9e22be5334)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x14a1c991ec89e53f), UINT64_C(0x7f81eac16a14efb2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7635afa9bd8d4e3d), UINT64_C(0x6b8bc394223ae57c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xce49f96ec01c4200), UINT64_C(0x1d822475e76ceb69)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xec76316136c4bfb2), UINT64_C(0xc50b6f0145888f1d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeba754134fc1c80a), UINT64_C(0x6a12ad8b336e4cbb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcd64e03a831f9ebe), UINT64_C(0x2f7375067cfe7b75)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2c89c0761609b699), UINT64_C(0xf666bbcbb76b4a7d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x81c392e75ba19bf0), UINT64_C(0x87257f783a6e7d74)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0f1d5efa3a1cec64), UINT64_C(0x0cea4a1ad02f7ab0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb2eab7f37c36b580), UINT64_C(0x5d472ae0343d5594)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4b0d4811712a3ad5), UINT64_C(0x33c348277da3def9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x01b03bb8c31fa104), UINT64_C(0x0c7c921e1d845b90)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9f28c7b6abac7401), UINT64_C(0x48ee467a631c8912)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5927e5a5b7a6335f), UINT64_C(0x4bd5e43436f5939f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd3f319d2af86c83a), UINT64_C(0x222c57e6b90cc593)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5e2d8fa983ffc9a9), UINT64_C(0xfd4e725226fdfc24)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdbbcd36722bb4278), UINT64_C(0x2c26a61501c4901a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0e5ec2d9fd4db010), UINT64_C(0xcd3c4ae7063205ee)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd353079865eed7f7), UINT64_C(0x95c95d633752fcf7)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1d38386cb17fdf45), UINT64_C(0x02730555e814e864)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7bd6846d37ed3a58), UINT64_C(0x072e893d98600920)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd040258ae0df2a4), UINT64_C(0xa7ff124a3db7af64)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x32059cc665dc94e3), UINT64_C(0x3ed557668966e299)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6f78c6175ab1dc47), UINT64_C(0xf49fae03250bb2fb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7d780c6e35391ca), UINT64_C(0x3c47f6c2b5bc181c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1904a1ef247bda7d), UINT64_C(0xe9cb0e6bef1fee0c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x683f5145cd922318), UINT64_C(0x4c821d25b3fd660b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4051999abaf71121), UINT64_C(0xceec0d669c4758bf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc8e22e60971727e0), UINT64_C(0x861bececa88f7531)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x72ed6f9fabf9a4a7), UINT64_C(0x01dede6bfabcacf1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeed13abada61ea3d), UINT64_C(0x77ed27bc971ae398)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x32bd3ddb16c8b18c), UINT64_C(0xd7e369587e3db042)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2f76d56efa9dce79), UINT64_C(0x8a771341b289ec71)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1ead8d42373de729), UINT64_C(0xdf6576ffe4459f06)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x547e5cf665d9bb8d), UINT64_C(0x449d5590fc919569)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd2aeafd827102349), UINT64_C(0x7592b5a8ae750a9f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2d473e41950e679), UINT64_C(0x209711732ddd9b82)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x87444af100895642), UINT64_C(0x7d5109f42d398fda)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x462a1af2cb1f8d60), UINT64_C(0x94b6e5f5942c2e03)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbb8e83f1230a3d6d), UINT64_C(0x15ad37937f16a15a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x69cf97d4ef82e429), UINT64_C(0xd642ee9b62345531)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x72dfc9adbc3bcb48), UINT64_C(0xc3970a2e580bfbd3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd5ec7eda783e0865), UINT64_C(0x6d4e367d9dc73c00)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8e7d25d30e038d55), UINT64_C(0xc79ba3e5340e6a87)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xab814f449f4e4b4a), UINT64_C(0xd881bb3f93318b8e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x53d07eff9cb60c2b), UINT64_C(0x72e5c2d63a891911)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9cec7b2d0a84f419), UINT64_C(0xd0610e93bb975b62)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdb6644b83881e1c1), UINT64_C(0xff89bf2f2ee08023)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1bf59750a391fc0a), UINT64_C(0xfbda9bd00475ff20)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb175add2f5a59e3d), UINT64_C(0x9893f96afe158513)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3870d9e189de656e), UINT64_C(0xe7ec4ca2dcd056a3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc4d69a45201223de), UINT64_C(0x491382e15a4b8bbe)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdd5c7d9ef4330e06), UINT64_C(0x912c40eb6ba63a45)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x78065d80b726de13), UINT64_C(0x0478c9d8985cf51e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2973c31efd62c7a5), UINT64_C(0x043a3750e3d07026)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7aa00d4f9a15ace1), UINT64_C(0x853b23046ef3a9c2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9357f223e2601b61), UINT64_C(0xe97e496db3098b12)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1606d42ca7fe48c0), UINT64_C(0xd405aac270a20989)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3590d5df1fca0ee7), UINT64_C(0xcf8f61d826fae0f7)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8646b5aff9202dfd), UINT64_C(0x359177c9239b9d8e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc9a95df9d95b53d8), UINT64_C(0x18ca7e0353bad20d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc8498aaa16ea2850), UINT64_C(0x2e1f7785bd13374b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x547d2371cc6479bc), UINT64_C(0x95ca4edff944a74b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe32cbd2c6519e208), UINT64_C(0x2d6c7c2f31f26363)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa81be0c1b3554dfa), UINT64_C(0x10cd983edfbe097c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x420889eacf7d7ed8), UINT64_C(0x4d507dc4c2eec492)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd511ba8ab97632d8), UINT64_C(0x728a166c6de808a4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc706e0a0b253a243), UINT64_C(0xfb5ef02eea38009d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x50e893ef58a01c4c), UINT64_C(0xa39f96838c981c39)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd5facb894c7f14f9), UINT64_C(0x6850101550e9ad50)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe9ef0f8ac1fdabd1), UINT64_C(0xfe286f6f815b9d0a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x20e9d63905c3a860), UINT64_C(0xb96e9ac36bee6812)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6f366b798653f4a1), UINT64_C(0xcb4ae427d86b0eab)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x95d11115e166a5df), UINT64_C(0xfb04a9e2e1cee39a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x06242522eb6e180c), UINT64_C(0x1d3220e913a763fc)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x84040e19ff6bf076), UINT64_C(0x3c13f0792eb17858)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4969a232155ccca8), UINT64_C(0x74005ffe9e1eb871)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x78befb9d1b4e5bab), UINT64_C(0x050d7ddcf721b436)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcf8571ed69ad822c), UINT64_C(0x4a325b2e4c6e3147)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe701464093cb4fad), UINT64_C(0x333058cfaf0abd79)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x613d055804f976e2), UINT64_C(0xb97fa8e32df79ca4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd2aa3ca2c60e019d), UINT64_C(0xdd5b6a2d01f0235a)}},
+};
+
+static const mzd_row192_t K_3[] = {
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x44ec76fc0c26f8b9), UINT64_C(0x9a9fbb66bdee7229)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe4df542bf43aeccd), UINT64_C(0xdade57aa66d1aba4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7e3111b99e7978e), UINT64_C(0xe577b5f444e4d480)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x93f09812adbc98c1), UINT64_C(0x9e276a9eb4071209)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x74684f9e0516136d), UINT64_C(0x1898e7a1ff454c2f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x163b1f6e5882e3ec), UINT64_C(0xc7d8edc1777a8616)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x90dd4433979ef6c2), UINT64_C(0x8c0de7e22be02ba0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf68c14656a49a1bd), UINT64_C(0x211ed96c67c22b8b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf1fd27ef5c02698a), UINT64_C(0x536bdb22584a36f9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x181a71b57a20c2e2), UINT64_C(0xf7011086400ec7b5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe5e7de3e45091070), UINT64_C(0xd12730f0e530336a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1a294fd0b09204e4), UINT64_C(0x1f8eb8f7fdc4cccc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2dd206f5a4bb9563), UINT64_C(0x616ccb7b25845311)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa6030acf57104ef4), UINT64_C(0xa71be63ace32a49e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x75c35d8e94fab011), UINT64_C(0xdc2692dc4c89964f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x426a301c092edef2), UINT64_C(0x04280bce3007de05)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfe173f5e2878a7f4), UINT64_C(0xf209727ecd4beecd)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd61237b50781e03b), UINT64_C(0xe514d28230b65a9f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x96a4b15d1e81edf5), UINT64_C(0x81879e422ec5f017)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1253e08a4cdf217f), UINT64_C(0x219211d434934851)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x86849bfab33e6ec4), UINT64_C(0x2a8d26bcd858b518)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xec987c2c2a832f02), UINT64_C(0x04560c698655b93f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfdb21f6136165c4a), UINT64_C(0xd8bb731a1711af7c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x15e2f4d9c19a3fcc), UINT64_C(0xec4783992d01d5e8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x29ad2ec4c621105c), UINT64_C(0xd05693aa887ca81a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x37860f58b1b8af7c), UINT64_C(0x05a4762029d02e59)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeeb88c1e86e022d0), UINT64_C(0x9f8d912dc01739af)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x09f200e4de695dc7), UINT64_C(0x4e77f871291cca4a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf0e83689cff1aa75), UINT64_C(0x569055676d60d0b9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf3806eb12b1848a2), UINT64_C(0x017bfed64ede281b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7d722bff38670537), UINT64_C(0xe4f60ac0fa63bd81)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9646a957e2702b42), UINT64_C(0x1f5321d51df928e0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x64c7f091dd347b47), UINT64_C(0x8f4fe74737507991)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8c8cd9c207cf6b6f), UINT64_C(0xd6cc681f917f02b8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4d86afa76d6b4f56), UINT64_C(0xd072aa21cb065f91)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x30f10ee6eb88e46e), UINT64_C(0xa51896421874013c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xeabbedbd9c6621f4), UINT64_C(0x83d9593f02566629)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4bd2ffc55a025075), UINT64_C(0xbd9bae5016536498)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe54357f9798e28eb), UINT64_C(0x941445b5057da1c6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcee3cd9e2000ab45), UINT64_C(0x04406507650d395a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3f1da9926cc2ee20), UINT64_C(0x77d33378093f185f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x31742e8755b5e92b), UINT64_C(0xd33d1fee01e49445)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd56b88aeda8cba58), UINT64_C(0xed7ee56f0042eb7a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9a0161848c4c9715), UINT64_C(0xc4f39675a655736d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1a7943e404ad8676), UINT64_C(0xb703b1bc296419da)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0176d34bd9bc969b), UINT64_C(0x94803955f950af9d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2eca3b553b7ccd94), UINT64_C(0xff4d53284b9c2f5d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3c1cb9889033ddd9), UINT64_C(0xc90065bd525e204c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x49afc02b37f41f55), UINT64_C(0x5303149a9a5a2fc5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf3bf0df59ec09160), UINT64_C(0x61163da278edf031)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x54b18b23968a0b50), UINT64_C(0x5ca454da1f84c12c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x24e9988b9fd54833), UINT64_C(0x154ec5c49f595f78)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x49da63b94b66edc9), UINT64_C(0x6d487abc5c3c87e2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfc9959d655f34897), UINT64_C(0x71d023b55e95fa0d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb92e4ccdc34ca348), UINT64_C(0x24d16fd0f3268cb4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x02f61b71bc9977f5), UINT64_C(0xa0865f81ff77f182)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf942b05710bdaa54), UINT64_C(0x5be5be79afff9977)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x181a585deb311d9d), UINT64_C(0xbfb92a84263f02c2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdb15aa0a03cc022d), UINT64_C(0x3bcb8d2af9427489)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc4552b00c605a472), UINT64_C(0x56a33a2352f008fc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x57edbef46cb2b6b6), UINT64_C(0x6b48f93eb4948379)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x65dc0398ec99c0ad), UINT64_C(0xcbd2eba19e2b6335)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xee2868ba1042d228), UINT64_C(0x99024e24820f04e9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x415f0f62f619df90), UINT64_C(0xed2dbb18fca45d6e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x425b1e49d1f426db), UINT64_C(0xa8bb6d90f6a2f1fb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2944ff3affc6285), UINT64_C(0xb0e9180da7ac12b3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x555a8c28bb227c4e), UINT64_C(0xed66bce6550d4816)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xea1a17dc634e6c7e), UINT64_C(0x19a0acd109af9af1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xaa6d6d6926fb3f3f), UINT64_C(0xd5aed23ffa9cc605)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7ed8eb977cdcb0dd), UINT64_C(0x84ed643fa4d90695)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe02250f5ed9da8eb), UINT64_C(0x1450ec5821655766)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc85d2af09bd211fb), UINT64_C(0xcb0c6f2077f13f54)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x226fe57b390c5f72), UINT64_C(0x56381ed1cb3153b3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2a64bacf6913ca76), UINT64_C(0x91dd73aa2387ade1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe51ed5ba84a09485), UINT64_C(0x122c425e347d492e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdb9efc5161a9b356), UINT64_C(0x79672f37917a53e9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x141fc837590eb82e), UINT64_C(0xb208edf8f693f541)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x344fad9de7543c74), UINT64_C(0x1ecb9b354fa07d87)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3dd859172efc4a95), UINT64_C(0xbf50e0b4a88d96fb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcf20f47ecfe1c109), UINT64_C(0xaa38aedbe7d4ec3c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xecf0b1f157f40e3d), UINT64_C(0x424c53731eba36df)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcbd7515fe6313d73), UINT64_C(0xf72ed8f248e66e24)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe977c988dccce998), UINT64_C(0x0dcb125d547db50a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4fc2bb957c2fc859), UINT64_C(0x29e48835e5a06bb8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x94fd59641c57d3fa), UINT64_C(0x20ae0777a249069e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x94c8e70b148c7222), UINT64_C(0x9e024cf928e13eeb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xee72bdc9db875448), UINT64_C(0xf15a2fdf4569382c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9ee2fba7f2e2597e), UINT64_C(0x8662a914635f4e19)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbb47e8b95b47cdc2), UINT64_C(0x39837672de3d2de4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7346519351502f87), UINT64_C(0xf679f19ba9e53f41)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc9ebbcf7910a0f90), UINT64_C(0x112e3f7de821cb35)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb60ae9ef636b9dea), UINT64_C(0x5af8261c9af3e988)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x909b71156e5982d6), UINT64_C(0x85ccfd51fb5788ef)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3781acec43bc1bfc), UINT64_C(0xd7b0000cc19ada7b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5d0c65aa987c3315), UINT64_C(0xb7d024df5bf12ef7)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5548e5d6fe53e43f), UINT64_C(0xb93cf96d96c91c35)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x07fb59c6fee5c5e2), UINT64_C(0x2a05bc3ec95022b6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc0d5d5665e695a8b), UINT64_C(0x6cf86c9070f1afa2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x20ae4792b99a3629), UINT64_C(0x8e543ebae70de0e2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd2bf750c5e3cd595), UINT64_C(0x359822c7029027c8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xea176fb45e90bbea), UINT64_C(0x5eb67d0fbb331ca3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x55420d95399290f3), UINT64_C(0x7082f3c2e2bc91eb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd1f662a6ae393f11), UINT64_C(0x34bc3c92030afe7d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb5b16dbbdc8930c8), UINT64_C(0x6e37cd97db36725c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8f46d0e352293c99), UINT64_C(0x1208f0f4fc2867e9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdfb5252554f71c32), UINT64_C(0x5ee6b837766d70d4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4faaa20527b013fb), UINT64_C(0x009d62261b86693c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd2caa0d1537be6c1), UINT64_C(0x776d60b6b0e013e8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7e23876e2afa40fc), UINT64_C(0x62243e50125e740e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x416ba89dbfa08851), UINT64_C(0xc8b698a423022314)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x66523fe16c9f33f5), UINT64_C(0x09f37d83facc8686)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdc6e6a38eea6a97c), UINT64_C(0x812a47e4d2e17a73)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3e11b22a68d431db), UINT64_C(0x62399a550e6e7206)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5529ff9b4aa6a6ec), UINT64_C(0xb342b4136e9f609f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x83eb0d37d1da21f6), UINT64_C(0x2ad3307cdde31a98)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x774c3b9a177856f5), UINT64_C(0x73e81eb384c58add)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x676a759375ca63cb), UINT64_C(0x9a35f53d0b5090a9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0caca34804531de0), UINT64_C(0x68588dd7e2b89687)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1e88e7c033f05cd5), UINT64_C(0x3f816a339b6310fd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb453c710e7f1025e), UINT64_C(0xca3bc1846e91bd63)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6449def4111735fa), UINT64_C(0x7372935f58030567)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe9bd14dd8066ca65), UINT64_C(0x480dd38ad89fe8a0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x86a539c077077147), UINT64_C(0x95f9a2176c04fc41)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa738f8ada097099e), UINT64_C(0x12da0765adfd4f9c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xba3eb9cedbac74ec), UINT64_C(0x5a833e28cf631ec2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd68a30d06ec134af), UINT64_C(0x0cd47ceb9edb59a7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x97cfeff8614e1bcf), UINT64_C(0xb4a762d1e19fdb9b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1f24d39df144dc9c), UINT64_C(0x5cd74759a6c670fe)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6011db454456dd2c), UINT64_C(0xb151b077446874fc)}},
+};
+
+static const mzd_row192_t K_4[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3e41b8e827f6220e), UINT64_C(0xa7c034c34fd2006e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7932af6cad51ecb9), UINT64_C(0xfcadee66d86cd082)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x562674f221407029), UINT64_C(0x0ca9df5f06279877)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdcecdc7747fca8cd), UINT64_C(0x7942a6c732c9396b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4e9ff9ef7f2a1576), UINT64_C(0xa39ed3ced4007d5d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdf1824192d59d331), UINT64_C(0xae4324ec645a4785)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcad9ec7de4150ff8), UINT64_C(0x5d52cf416f7158f3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x195c981a956be33e), UINT64_C(0xdd22737ac60314b2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x243c8a7799580323), UINT64_C(0xa09619b8059d26a6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x805f45735e4a0722), UINT64_C(0x0427e18efe509d4f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8bb07860c7a5a417), UINT64_C(0xd684908a84add479)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xca004651c49dbe50), UINT64_C(0x9ae9f0c85575d224)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd473d0f16dd6370e), UINT64_C(0x458b1bd6f24fe735)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa5e14b5c8e7d9bb8), UINT64_C(0xbe08ab8efc7e1fc6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd240c6d44a55ba3b), UINT64_C(0xa1463628d74cc653)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x527eea70f0f290e4), UINT64_C(0x9408d6fab3524920)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9a035a27620e933c), UINT64_C(0xa95d6d68effaf861)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6eaffb98916dbf98), UINT64_C(0xd6137079d10f2e7c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1fe043f948ef031d), UINT64_C(0x054cfe8720162d75)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1e6619b971efb51e), UINT64_C(0x0b0d88886ba10e38)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9d6fc2ce3a59dae6), UINT64_C(0x62a9976937471dc8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd22520acb8c561b9), UINT64_C(0xead3dde662943dee)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe3a906796ad2f47d), UINT64_C(0x85567901e9158dda)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1b4372c76dbb0339), UINT64_C(0xbcc72ecfd2e03489)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc8ca52e86e71eba0), UINT64_C(0x8a07f6e51b6f7b1a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe06f51341f360f9d), UINT64_C(0x1a684d73c404f094)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1ace7d7318feeaf5), UINT64_C(0xbb734bad474bbee6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x27ae1925de107b48), UINT64_C(0x134ecb4edd44c36a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd62f2d0b8e6f4ffa), UINT64_C(0x401ae0ab5a8c444a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x977e0f16e8c074fd), UINT64_C(0xfef76a2617ce0cac)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x97878a721b118a4d), UINT64_C(0x8b7306416b6268c4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xea6312f0d77dbbd6), UINT64_C(0x6e10a00d5341056e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7fce6339d058aeb1), UINT64_C(0xc59ba810e09f7cee)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8ee5c1b8a3318cf4), UINT64_C(0x91b1aa16b7ac18d8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5c7498a0c7d8c94f), UINT64_C(0xab3ef71e8bc092f3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf6c39f499d913bb2), UINT64_C(0x6c06a336cee5e88c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1883b9d471b178fc), UINT64_C(0x4342c0b64c384dd2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x231dd0c4c264691c), UINT64_C(0x8aade70ffd1c8e85)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x27ac30c6d77b62b6), UINT64_C(0x12ec25c262fdbb6a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0c74e88e4a13fdd0), UINT64_C(0x68f85265728ae06c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcc1647cee724a28e), UINT64_C(0x6f4c63c02294c390)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2809495b9ab96f40), UINT64_C(0x4b07a5e736013a6b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd94b029b2f328a60), UINT64_C(0xb5fc6a487263d79d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3c4b5ab1192adabc), UINT64_C(0x35a04dd0e9937ac0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5d7b78ee0a7d7fcc), UINT64_C(0xfa4eae3a610ad152)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x96877fc86f1ca835), UINT64_C(0x358e090eaf8e254b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4fc59ed0ac8393ae), UINT64_C(0xf9342ed76997e362)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x89fc2dbfd1bf86b7), UINT64_C(0x3ecd63cd2e733e88)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x71771c38684acdf6), UINT64_C(0xe3a33ed2fe53926f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdb1cfbf3e77a7aeb), UINT64_C(0x6b2d6300331ac466)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb0889e7d1970f076), UINT64_C(0x4e633031701eafaa)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x512a84565a3ddf8a), UINT64_C(0x7237d4595cc4cb9c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x04e7904534d66dce), UINT64_C(0x54b74eabd8857478)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa1c513a422dd58ee), UINT64_C(0xfe3593d970269ee8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7f212489dfbfc4a5), UINT64_C(0x4f219b580535c472)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe528f29a7b7b94f4), UINT64_C(0x4bae35ddc5c1e4d0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x44e787382f71f14f), UINT64_C(0x31476a62cee7c6ea)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2bdc3f8743b2b479), UINT64_C(0x5f158ac83996b8a6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xeb423e8e06aaf4fd), UINT64_C(0x094196c900e9dd10)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdfbd7315fa5928ca), UINT64_C(0xb7467c0e2b297e68)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbc7acb667e7b27e8), UINT64_C(0x7d7771861412bf51)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5ab91ccf99ee56c3), UINT64_C(0x974fcdbd9bd62e77)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6859b8cc0793d8a8), UINT64_C(0xd45a2bb9c7089b15)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x40bef5e8f3c92ff6), UINT64_C(0x7852e9810df8e739)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8cbec40851e2523c), UINT64_C(0xa95269f419f6ad79)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x045ad33bc506f00c), UINT64_C(0x6c1b696a82cc836a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x19574abc12133f85), UINT64_C(0xd03e866a9d690e5e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2f3c074c408e5602), UINT64_C(0x1e7b6486f837d9c5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd9c756855b7f8569), UINT64_C(0xef2e3ed10a011e52)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2e416a618257f0ca), UINT64_C(0x81e0ade710cd337d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x18987f2afd395aba), UINT64_C(0xeed2a4f983a9aa20)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3ca52898655b6f04), UINT64_C(0x2423bf2c1c46fbf7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x32f7b29bae335e96), UINT64_C(0x98173dff4678dfea)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xead93ff01d6341a6), UINT64_C(0xec06d7eeb06d718f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xed163f5f8f23c898), UINT64_C(0x71badc60e0573ee4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe675412ed54da78b), UINT64_C(0xc7de39a531881321)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x22d14dc2e2be0da0), UINT64_C(0xe555c8e19ef6953d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8defe2aea19d17be), UINT64_C(0x8517afccf29bc6e2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb1e384e00ae5d7fb), UINT64_C(0x09f3a700a3e074bc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfd840e1fb40439d7), UINT64_C(0x6761bbaab722de9d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x74e97b1e36fdea52), UINT64_C(0xd990d7d1a7f2f746)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x58cd4cff56e36cd1), UINT64_C(0x73169acae86fe79a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf187c456cccaffa4), UINT64_C(0x8e251533c0421c64)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xeda0af2097024610), UINT64_C(0x20f3aad4f8adeaf9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0bcc635fb70bc329), UINT64_C(0x30472910d572f0f0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x940bfb951f3f1ea6), UINT64_C(0xc4c9a10364e51efe)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xffa55d0fa91b6669), UINT64_C(0xc92b7462f71d0c66)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x213cc94a7d20c58a), UINT64_C(0x982d5590602d8aab)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbed29129bf9a01ef), UINT64_C(0xad24ac1c01e547c8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5296c41b0e717cdc), UINT64_C(0xe194c25217e84669)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd44ce6e0bd49e134), UINT64_C(0x405e0af915c7843b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x993662e93784cfa7), UINT64_C(0x5b71b0828d1a5b06)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1ec8e678d06b24c8), UINT64_C(0x3a4e282a3426bb1d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2f6e2a82ac2d2412), UINT64_C(0x70b2f1a1f96b4ef5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc8c66003f0c12ae8), UINT64_C(0x291f172c236c75e8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x67087513e1815387), UINT64_C(0x69162658c6cfafd3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb65bbe69b769fdbb), UINT64_C(0x3307eaf5092c0be2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5e9498d0c7d06bfe), UINT64_C(0xe26f13f31c9ccac4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbbff0fce90736713), UINT64_C(0x9dc198b4e73a72b8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x43b37c6c647ea15b), UINT64_C(0x189b3cf9a3e114c5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x24f9e5636b5f1b69), UINT64_C(0x39488d6a8ea0e0bc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1bc726321827c370), UINT64_C(0xd7537268faac5048)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb28496a23548d6ad), UINT64_C(0x8f869e66dd2c296b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0a308f14e188f8e0), UINT64_C(0x897247ba77ad675e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x55a3b48274d4c334), UINT64_C(0xe12cfa19605242fb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc93047234c4de5d6), UINT64_C(0x7b780cbf4c07ead3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x230e7f7b4007f1ec), UINT64_C(0xee75a2f9727444ce)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa03720340064f794), UINT64_C(0xf7dcfc9f72daf8e3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x528cf4268dfd07ac), UINT64_C(0x0b2089a3c3c32fbd)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc981ff3dac5bb689), UINT64_C(0x643a32134125cad9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf24de6b05706cfe1), UINT64_C(0x19b1211a480d149f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd48719fff2ebea3c), UINT64_C(0x72126ff6836fa564)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x09a4087c6f62f995), UINT64_C(0x92eb74879fd0c558)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x14c3b4cea9f341d9), UINT64_C(0x85ccf427044ae688)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8fab6a41e2d7e7af), UINT64_C(0x0c2121fb14cd9ee6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf28cc18b9d5265af), UINT64_C(0x22f20e5c5257dec0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7511fb451318ea61), UINT64_C(0x5b941807a56204d3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x16daaadaae1ca36a), UINT64_C(0x27fde43d5e8b679d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xaf256c7527d5abb0), UINT64_C(0xc171a8c1595c39df)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xaffd3890d3234470), UINT64_C(0xeb338b275d4f5176)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe45ea37e51c90666), UINT64_C(0x51cc35e6d8a8b24f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7d69a2817c5370a8), UINT64_C(0xecbc0bafd560a2fb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x743169e783219af5), UINT64_C(0x9e21177d5091964d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x944386d9275c3dc6), UINT64_C(0xc3b2692c6df0bab8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8a446c1e5b2806f8), UINT64_C(0xf75aea488b86b8e8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8fefec343ccff666), UINT64_C(0xf3ec4be1dd18739e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xab8040f469000ea1), UINT64_C(0x160dd8dd27caec57)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x92718d9b9388233b), UINT64_C(0x9c59e44013a7cf8c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3b2895e72d962416), UINT64_C(0xba44b0dacd949961)}},
+};
+
+#else
+static const mzd_row192x2_t LK_0[] = {
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x3ce84e7dabb1b5ff), UINT64_C(0xaec0e87f5ec44964)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf5363757a219b4e9), UINT64_C(0xc9945ebdba4ddd30)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xc078a98402182027), UINT64_C(0xec4e502c9f3bb861)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd31df2137100de97), UINT64_C(0x77c26116f7d25278)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x94e95d5a34ba6673), UINT64_C(0xf1032011bc5271fd)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3161a689d06e391d), UINT64_C(0xcb207af91bb451e0)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x9f219fa5b2183cad), UINT64_C(0x18f467e8fa3a7db9)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x71f6287713901099), UINT64_C(0x016a6a78f7aafb02)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x345b7773ff5dd410), UINT64_C(0xddd9f523fb9b7744)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xfcaf5c3461f01c1e), UINT64_C(0x42f1593ef99ba2d8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x25fe6cdad5947231), UINT64_C(0x08863f9ff3f7e80e)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xff25c0019975a3bd), UINT64_C(0x5b4762914790ad2e)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x98f97dabea94fa06), UINT64_C(0xccc560fac2bfe3c6)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xaf26d350e5c20f05), UINT64_C(0x270b1adc9ccdbeab)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x11596edefa9975e3), UINT64_C(0x2b6a07c059cb7d4d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4bf0944d301272d7), UINT64_C(0xbe01431af36a79b6)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd9428cb979058a27), UINT64_C(0x7c5e5f89d1e17b10)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb4fa159623104bd2), UINT64_C(0xd7e42c6bd5f77206)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb3765b74c789353a), UINT64_C(0xbd8eecc3811485d2)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x2ab86858847d3ec7), UINT64_C(0xe010e903f4996c14)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x7d5aa6736d18ff00), UINT64_C(0xf9d3cb84f0112752)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8f9cdfcd4ee95985), UINT64_C(0x923d05cd20c6bd11)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xca3d0bc87f5e7fd0), UINT64_C(0x57ac12947834683c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3afd6fcf76718ea1), UINT64_C(0x63bf144ca1f59f8b)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x7b24e6d014c2ea45), UINT64_C(0x10d195039651474f)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc63c4e3da8f0cf74), UINT64_C(0x1112e92e384b6faf)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x3120692c6341e6f6), UINT64_C(0x4cb20fb8e1ae9d23)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x6bb4fcfb1d6c962a), UINT64_C(0xced0ce5dc62b0367)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x389c93e13a4c80fb), UINT64_C(0x5e5ea823be7c5a67)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x4ad93665968f343e), UINT64_C(0x3e6f245d8a5e0c4a)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x1ebf241cfbf7fa3b), UINT64_C(0x7cc9036d28ae78d2)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x46b04fafbae9e6be), UINT64_C(0xd0e9ecc3396e3dc7)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xc39c1acf58331b7a), UINT64_C(0x032a2570823ce9a3)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3622ca4489e25b83), UINT64_C(0xc3ab6eb1757c66e8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x57ba051453d404ce), UINT64_C(0x0172f9c1bd25d7d0)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7e8496f187fb3189), UINT64_C(0x0b583809933e3de1)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x1fed17d3ffb045df), UINT64_C(0x90683be9b5f3cb0a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9fbc3b79d01650c3), UINT64_C(0xdad8847b159ac42f)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x653fb557f3fac02c), UINT64_C(0xaea7a975c8d2355f)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x035d4d3dc427795f), UINT64_C(0x4f4850901a30b2a4)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6068491d340d401b), UINT64_C(0x615b682fc38a7af9)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf2f726e7dd8eec71), UINT64_C(0x43ebbdf191281f91)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x92965f1d1a7ab07e), UINT64_C(0x4aacf92bc689228a)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4491d080168e7768), UINT64_C(0x3d6eef3bcb17e571)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x05f22f74db2ab7ab), UINT64_C(0xa44e66c6f1578378)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x16e08719c85fc377), UINT64_C(0xafabe894f2841dec)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x5fe486f29362fd58), UINT64_C(0x85faab0bdf422303)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x90a6d88d8964af49), UINT64_C(0x98c0d6bfb34c5606)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6937f2bc5ae1c769), UINT64_C(0xe65161fa8f6b9cec)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x169248e3289c5c75), UINT64_C(0x3360e4fd445e897c)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x06482950e024b1a9), UINT64_C(0x660f2b94775d743f)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd35840c12bf865fc), UINT64_C(0x58edc5f984dc21dc)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x8cec7caa2d6c7feb), UINT64_C(0xb54e8ea2b9e6a6ee)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8e613ada07fbb9e6), UINT64_C(0xcef6ab5e5ea6d3a6)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x7d7adfce7d89b6f1), UINT64_C(0x25f2d2db267f2853)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xef4ea59338f19fc7), UINT64_C(0x921db55510e2a25d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xbad518172eee2e29), UINT64_C(0x1e9daf3b6b64f446)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x24340d58e6cb17be), UINT64_C(0x0114034b3946f7f1)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xfd50830a1d0e24de), UINT64_C(0x7be028528985f048)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x10031a2a9f89b238), UINT64_C(0x09ec5347be5b9fa4)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x71e928d36e2b9162), UINT64_C(0x4396c1062f3d12a5)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc92ac314f43ad9fc), UINT64_C(0xc401de26dbab7209)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xbfd040ed7d83c401), UINT64_C(0x50fd90a3e2445496)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x772973ecbc1c1830), UINT64_C(0xd3d34c74b7e5139d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd5986d7ca41cdf3c), UINT64_C(0x3d76cda440b391ff)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xa9ee2ea0e7e6a89b), UINT64_C(0x34e074d5f1452e56)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x251b1ec5caeea7df), UINT64_C(0xd669f18ef0df7830)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x6145c6a99e729157), UINT64_C(0x3cd0db1c42c166fa)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x26b867b432b23b5f), UINT64_C(0x810e27191824cde0)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5906d211b3333a58), UINT64_C(0xe7fa501ca5d46686)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf3db70e69d0b387c), UINT64_C(0xbd5ffacc3e974b55)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8d466f70a1232b61), UINT64_C(0x12618e03d5fb02ff)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xa8319530aa249b88), UINT64_C(0x6de9971caf13d68d)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc730f1e8065b1cd8), UINT64_C(0xc5e783dd95ad1af2)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xfd46f97892429a40), UINT64_C(0x77d98889750b8c18)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2edbfdd1d2b031e9), UINT64_C(0x9e17fec22d84ecc4)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x1cc85f83a4df201a), UINT64_C(0x8adfcb5e50bfee13)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x472760f18d4d682e), UINT64_C(0xe20baf1459353f40)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x9dc8626d3e569d7c), UINT64_C(0x22afd19b4b698363)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x62d523cdb4566fcc), UINT64_C(0x61becb0b5dde0387)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x63edbc1e006b30f5), UINT64_C(0x0dc35e3d9941bc67)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x04b7718ef09cfdba), UINT64_C(0x68ba55cd5fb1cd0d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x94fdf3a79b8e599b), UINT64_C(0xf55e44a12ead44eb)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xee5da9eef353626f), UINT64_C(0xa1dab56767368f13)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x8cb28212b7a1f815), UINT64_C(0x2277eea693ec2727)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x32cdd83ea5d08f69), UINT64_C(0x354114837134c693)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x4ae67cf4a7c2b4d9), UINT64_C(0x96e5d345c52e56bc)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x026466686e8a9cef), UINT64_C(0xe2f0fe00d8b7c38f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6520270493a540ed), UINT64_C(0xbdd3428053a5e0d7)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x674eb66501d8a527), UINT64_C(0xf446f64a78c502fc)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x98656939a08b2fa4), UINT64_C(0x9e778534391a6324)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x240fed9fed3d7a41), UINT64_C(0xbfbf60a97a7b877f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xa1d08ddf93112afd), UINT64_C(0x889a8f57cffecff8)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x5692fdf9811232bb), UINT64_C(0xffd341c33435889f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x21a6acb897cf259b), UINT64_C(0xf3ad663e3eabeb77)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x63eec18d2b91f8d3), UINT64_C(0x56b8b8ce73868f38)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x7280d76dd4efee33), UINT64_C(0x57343410c42ecac0)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xfb5516aa9c9a942f), UINT64_C(0xf75c442966a64d86)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x197c451d387404d0), UINT64_C(0xa49356b201b2d8ad)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x6f84adbca591ecf2), UINT64_C(0x589d988b5660df15)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x9e660151b1f61296), UINT64_C(0x1ea916eefe18bb74)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc81523de3ba5dd18), UINT64_C(0xd1c150fbe1c65011)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x710f35ddd5534a5c), UINT64_C(0x5472680ded63ebc3)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x56f0ab0106241d42), UINT64_C(0xee19475812e54bc1)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf3119f3c374c6213), UINT64_C(0x546a3d56be418c02)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4278dd3bc3fc3045), UINT64_C(0xd834e80cfec32f97)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xdf04f6f8afa92cb4), UINT64_C(0xe295c4dbc7b2917e)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x00b26dea0e44fc93), UINT64_C(0xcd1a7212fbd031c6)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x0de33bd75267dec3), UINT64_C(0x4a8db76e7991f430)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8eabc48d6e526641), UINT64_C(0xae27bf27ff090f82)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb14fbe2cc8b217cb), UINT64_C(0x142107cbfc54c638)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0f9b5e88c067c2d9), UINT64_C(0x51019a6f9601e331)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x255ade612f0c7c94), UINT64_C(0xd31b2e3597b7f2be)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x162fc75c0da0920c), UINT64_C(0x3b527686d91f3beb)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x516afdfa7d844498), UINT64_C(0x74cb2248a3744b32)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1855595a16745622), UINT64_C(0xbb16ec66fd07322b)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x5c0abd476b77ba0f), UINT64_C(0xb9ed4ea50c1c7fb0)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xde3c673fe0593363), UINT64_C(0x3cc1f1d36addd2bd)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xaecea8e3846a6378), UINT64_C(0x5ea3aa5232a0a7bd)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x47e8b4357790f29d), UINT64_C(0x28bfb7674388f007)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xa7779214dc7678df), UINT64_C(0x9f7cb662b016f467)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x44df4c4b305ab0ca), UINT64_C(0x5c80a85c4945185d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xa53b3e69a322429a), UINT64_C(0xac0943723a3bae82)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xfffaa05d20512d37), UINT64_C(0x2a0adcc1ba895b4f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6493abd10153823c), UINT64_C(0x81570f947ba98947)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xbcaca0d8ce6df571), UINT64_C(0xa9c65d397e9e6ac5)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6b89f4800346cd3c), UINT64_C(0xca628948e34accc8)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8e37c97289115fbe), UINT64_C(0xf1a006eb93b7898b)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xea024683705b1234), UINT64_C(0xf038c21f4b6e6c20)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb0ac1a6827f69d38), UINT64_C(0x7e93d0fd98c1ff31)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x7f782ddd16762e40), UINT64_C(0x27c50127685456f7)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x47ab05e9640807c9), UINT64_C(0xbce9f852ecb46782)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb5cc89096da24c9e), UINT64_C(0x52576373fcc3d92c)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf63c72e84d1c06ac), UINT64_C(0x7e8e8affac966729)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf4379241e68fa9bb), UINT64_C(0x6ea2fe249464a377)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe7f2239bb0485313), UINT64_C(0x1e0724ad61ed6a13)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x921ca2d9acd77a52), UINT64_C(0xe2620517056a92ff)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xbef5aa8c48488f09), UINT64_C(0xaf8ebf7490f8c7b3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x441b9ce3edc22393), UINT64_C(0xb6037dd251709f6a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x876e840acd57d672), UINT64_C(0x0e1dd2a1f3b66e1e)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x1849ad6c333c4c83), UINT64_C(0x0387f8d654da904c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x62995e51db834ebc), UINT64_C(0xb49ac5801dc1ba1d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x9a91dabdd7833204), UINT64_C(0x9113054fad179de8)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xfeeff53b4295b21f), UINT64_C(0x0aea6e194f8df5f9)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xa4216abc4784f565), UINT64_C(0xfa833c3f67e0d515)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xde88957a63c285ec), UINT64_C(0x8315c094b30186a3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6f7c1108c4573a08), UINT64_C(0x442e8536adb16f08)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x74da2f153431e136), UINT64_C(0x9e8a537afdf27340)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x9a4dd79b33cf0c3f), UINT64_C(0xf2fc0ffbc42402fe)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x6943477d3b5421e9), UINT64_C(0x56c78b5670a9d449)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x4fce226e5456b742), UINT64_C(0xfe7f33293d3e26d6)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x277b04efdf4bf3e6), UINT64_C(0xcab0f189a6f70370)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xcd3802d8630b89c4), UINT64_C(0xaf04c689a7e7bc9c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x51d716258c09ee47), UINT64_C(0x534973bbd9e72bf6)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x9b553934cab99c71), UINT64_C(0x40e2d43956d7f5df)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x119c2ed13b30b8a2), UINT64_C(0x69ebaa5c7284d94d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x2b547b2e3596f613), UINT64_C(0xd66dd5a0c640fe05)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9e6998f475db380f), UINT64_C(0x9c9b52426ebe7397)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xd7c2c22eac5233d2), UINT64_C(0x0cd1eb14d44d5a40)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc3210b19141f177f), UINT64_C(0x4153f3c5f6d2db81)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x5648c9d446d2b40a), UINT64_C(0xf5f346f9cd1a4d99)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x29296b385286df59), UINT64_C(0x139596b347392417)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf9451fdb23bae890), UINT64_C(0xd342660b90e5f309)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x93402d7bd6760fff), UINT64_C(0xde1238b6b3fdeeee)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x8839f71fe1b14e63), UINT64_C(0xe197030c657bcba1)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xa6e1a7e1a5acfa6a), UINT64_C(0x1cc1a374ccb99270)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x295a688d94560784), UINT64_C(0x357449db14b6ae4e)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x02ae83a7fd5fd149), UINT64_C(0xf1de89ad251935b0)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf7baf51f472e45b7), UINT64_C(0x49f9dc100e3c15c6)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xec772d121364927b), UINT64_C(0x925cb8511a409128)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb63afdfcbe2fec3e), UINT64_C(0xd577bef734cb9f06)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x355a5ba624bc0814), UINT64_C(0xdfd5c1abc07d7829)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x657dd512d63d3f8a), UINT64_C(0x11a1f09b9938f61a)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9cb0ba11678ebfc6), UINT64_C(0x6e409d630460e1e6)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf13653e08b4dde50), UINT64_C(0xaba31c2a28cc0b9c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x041bdd49d9a8dc42), UINT64_C(0x72efc576dc7a9bf8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd28da1f16b07e5e0), UINT64_C(0xe58c5d9211dccf92)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x70841bbb21d21f39), UINT64_C(0xd8731535cb1810bd)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf1611a1e8801ce19), UINT64_C(0xf38cfa7b748a4489)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xbe6f76faec213844), UINT64_C(0xf5839c79ac403dcc)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb6efa0b5f820610b), UINT64_C(0x717f03904806d3a8)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xb9aa440704a5110e), UINT64_C(0xda62db507ed08de2)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x9840ac1c6013517e), UINT64_C(0x7e8b2306d14574cc)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7c490eae0da156fe), UINT64_C(0xc637f4dac0e1909b)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x390a04579fddbfb1), UINT64_C(0x47da6f3037e5e352)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0c6b09abc53fa86d), UINT64_C(0xcb2897040f317e45)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x6e755b92fdb76541), UINT64_C(0x96dd0897a493b59b)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4a6ff134e2513b65), UINT64_C(0x55216153ccd5420b)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x03080869e70c9871), UINT64_C(0x822e4ae943cd8781)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x44f705223b38d400), UINT64_C(0xfddb4d8c5ec2a620)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf8c1e3a7d7be233b), UINT64_C(0x2b9bfec6f11888ac)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x35e10890b08dbfd6), UINT64_C(0x1600edcb9ad57177)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xfb4992f884ae1727), UINT64_C(0xa0332bc1a90855c1)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2fb474e4e4018d49), UINT64_C(0x087c5eacfa9d7625)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb4fd59abb82cc3c0), UINT64_C(0x1052e27c1f68ab55)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xcc02cb336c6dcb51), UINT64_C(0xbaf7ef5060ab3691)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd8f1824124ce4c42), UINT64_C(0xe4cb8963794d976c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2a7cd66e5c242379), UINT64_C(0x958a03620fbed86f)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xeb47b61f5dafaba6), UINT64_C(0xe569658e2efb8110)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x29a2ca09e04b8a1d), UINT64_C(0x55a3183d75cccff9)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x04ddaf7f036c6f8a), UINT64_C(0x756d62358d799646)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7b64ab8c0ec73451), UINT64_C(0x3fcce79fe9a5732e)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x34ac6d74190ec51b), UINT64_C(0xfc744e9442b2406d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2950a5be2145793), UINT64_C(0x2c62f89210b25565)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x66832d9fc5cf68c7), UINT64_C(0xc6b4e4ccf92bdb7c)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x98081ae203e19ce0), UINT64_C(0xb97a2a4286207af6)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x5bf2816e9bd7b5b2), UINT64_C(0x6aecabc4fefc88af)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x695aaaecce0c36f2), UINT64_C(0x5b77b2c17c95ada4)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x40f5d7fcf195b646), UINT64_C(0x46d6f83f146ba7ce)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x531b5cd92cdedeed), UINT64_C(0x1afc676ca91210fe)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd957bc3d3e39dda7), UINT64_C(0x7eaa8043f3340eb0)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7a5fd571d63802bf), UINT64_C(0x58301cf6ca974ed3)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xcc25a46dcef6bbcf), UINT64_C(0xcf5a56e60f7c3f6f)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc7334b16712d348d), UINT64_C(0x52f0aa71d0d0f2df)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x8b886976e80312d1), UINT64_C(0x5534b41d91db5cf2)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9c511954b5cc9785), UINT64_C(0xd89d3d993d914979)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x7530ccb28ca0c16a), UINT64_C(0x0638d2b1cd3840c0)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xacae6ebe469aaa9e), UINT64_C(0xbeb97458dcd15732)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x94ff36e2f2d3828b), UINT64_C(0xb179154cafe9cc6b)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd9321f1572cf69e), UINT64_C(0x12e856a8cfd21f1e)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf2552f9be9597eba), UINT64_C(0x0e896342fd7cd2b7)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xa6e6684b3298e0e9), UINT64_C(0x52a37bd1a933f62c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x4fa14031cbb27647), UINT64_C(0x55d95dce1ca5a801)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x73ab7f0dbf22e6c3), UINT64_C(0x4aa39fe6b85c07c7)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xe833cdcb0f06fbc5), UINT64_C(0x6b98d220b68caf0f)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x33dd18c0feed877e), UINT64_C(0xa98cfaa94bbd21ae)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x94b2ba276d52a3de), UINT64_C(0xd5dd687ae1d2fb9a)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe29ee2e2c9bd17dc), UINT64_C(0x9453d72f392d6eae)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x53568899bc81a69a), UINT64_C(0x357158a82b2bf4b3)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x275e9cd936d73826), UINT64_C(0x49dbe0da4c6f0d29)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xe9703a38eb26fbdc), UINT64_C(0x6c87e8e9195dc601)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x75cab49bb66b26f7), UINT64_C(0x190504c92ee7b837)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xca76ff3a6be2b522), UINT64_C(0x60c818eb612d35be)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x813ce6dca91bbd40), UINT64_C(0xec32e2bc3b0bced9)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xc97c7fc2fd9a9b42), UINT64_C(0x1d9415828b5ca4cc)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf5e74afded28ec4d), UINT64_C(0x3a5b954e3f35106e)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x3c14d8ffe66b0490), UINT64_C(0x29435b61c6f51640)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7b5ea07625f86d1c), UINT64_C(0x29df6a1c902a3a2e)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x59a22fa22470b911), UINT64_C(0x80f584ab802cebee)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb318c5d0282fb3cc), UINT64_C(0x96f515a4a2b2fb2a)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xc3804efce51bdb5a), UINT64_C(0x83e968933b107f0d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8f57076415969f3b), UINT64_C(0xcf0205928d92d604)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x50c90ef8a14ac6b4), UINT64_C(0xa3b27a650d17df5b)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x4dd880920753ad33), UINT64_C(0x4ea860b1b7787fd2)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xae5f5e968626eac2), UINT64_C(0x3d5bf2817b0f314a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb95e8cfa0ca87d48), UINT64_C(0x4936a0cc6f45426d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x4f3b6e56670f4ed0), UINT64_C(0x6ffec5f655a3b721)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb6fb0371a2b3f8c8), UINT64_C(0x0a12103972845439)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x7cb317cd8c865593), UINT64_C(0x0c0335bb9437dd80)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xa9c33ee3ec23b789), UINT64_C(0xd16c2f0964df706c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x44c4b55d66e7a850), UINT64_C(0x990e8e4b54733656)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe28bedb010b5339b), UINT64_C(0xce8f043efac64549)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb40b385f2488db4a), UINT64_C(0xa04edeff6ca24f0b)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9e91d438faa9b77d), UINT64_C(0xcc811c1bf8f92916)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x0b8d7c1a883e5a66), UINT64_C(0x3172588a74cc21bd)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x2ac2746489f18de2), UINT64_C(0x6b3f969dea1627c5)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x533bac8bac6811b4), UINT64_C(0x561eaa155357a696)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf5c728d2ad4abed9), UINT64_C(0x6c3faf85da3ac0a5)}}},
+};
+
+static const mzd_row192x2_t LK_1[] = {
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x8fbf4fdaa498b991), UINT64_C(0xb356831a047fdf3f)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7f2159388c3c2fca), UINT64_C(0x17b2916a7cc31c81)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x1a7dda5e0d686cdf), UINT64_C(0x04dda133221492ff)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf0a6d3b11fb5b6a7), UINT64_C(0x403a98c4b63f2797)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x7bd38c7eaf55a38f), UINT64_C(0x8c45ff8673c1ed10)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x010d47e2bce4fbd1), UINT64_C(0x530b4df986d3640d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x6d9d278201633ce5), UINT64_C(0x316ad778a3a2a016)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc2de6a195423c2b8), UINT64_C(0x0a35adbd108a35a9)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xe208b3c8ef9db3d6), UINT64_C(0xc476dafa104f536a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x6dc9487872bbc668), UINT64_C(0xd086f00d36728b3d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x8d9e20dc810d19a6), UINT64_C(0xea4527d26814df47)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8532d941e2d6b0f4), UINT64_C(0x4c11225eaf89082c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf842b8acff6c4002), UINT64_C(0x6e0fb4451c03c4b6)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x6518108854bd3591), UINT64_C(0xfee30d28da6cce58)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x48ad9f8d638f0f1c), UINT64_C(0x70938741d20a136a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x13e611db0599385e), UINT64_C(0xbb3d83800b6052e2)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x1f7f89ae1276f036), UINT64_C(0xe0c6b17fdd8ccd7d)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x4bb99b73c10a5c92), UINT64_C(0xde5dc90c3531b412)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x5474071fceeb571c), UINT64_C(0x6963ea530d683a93)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x19f167f1352d3837), UINT64_C(0x17ac10a7569c22bf)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x741826e19b657b7b), UINT64_C(0xc6207583089a96eb)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x6cb4a56970c55d10), UINT64_C(0xd7fa82da03e49e2b)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x34d2db60d6cc3484), UINT64_C(0x2ba7803f350195bd)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9d114b96fa10e6ca), UINT64_C(0xa3a77ee60bdf189c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xa18416dba0e24f8a), UINT64_C(0x98871be4b344e936)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x77fda1f26c939042), UINT64_C(0xc4ed44592516b8f6)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xec4bde9dc0dfd275), UINT64_C(0x2487d9bfcf6b43eb)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xa946c240e502aeab), UINT64_C(0x13d3f412c449a6b0)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x3dbd99e09b5746e8), UINT64_C(0x879ac415d20123f0)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x97ae1bcb54693685), UINT64_C(0x42805a8d7165ba38)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x25a8138d34b6bf32), UINT64_C(0x468d960e39a9e373)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x6a5c6e001c0ff70b), UINT64_C(0xda8ffc730b317a5a)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb430d42055840004), UINT64_C(0xbccc18cb8b3ec0db)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7862c9aaaa94a827), UINT64_C(0x865b7f3e9dba2476)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xad75b3be2f3472d6), UINT64_C(0x7446565294e54489)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0df4ecd758ed28ef), UINT64_C(0xccbed33c2b24649d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x29776c863dfd69d1), UINT64_C(0x034cffd1986dff7f)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x22d402bf73d3ecd0), UINT64_C(0x574f9ed8e6f28bf0)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xd41328d5a4e9a747), UINT64_C(0xb64895f0ccdb5554)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9e3f6b57233820e2), UINT64_C(0x16233a9d0e95fc1f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x100ace29343ba237), UINT64_C(0x1e2b747b85f644a2)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x762bd3e449abecb0), UINT64_C(0xe7a2353c6a554246)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x0c42f157d175d87e), UINT64_C(0xe03b9cf56f683231)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x15b77737c12fcce0), UINT64_C(0x3eec754b1193bbf6)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6720a0566660859a), UINT64_C(0xe7b30da2ef365220)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc333f0b41e585b87), UINT64_C(0xc64caa762deb6682)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x0428fc778aafaae2), UINT64_C(0xa577ae8e576827ac)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc4e94d33b2851a18), UINT64_C(0x38c228fb602de03f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xc750cbbf1291c47c), UINT64_C(0x643d1d9a3396a9d1)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd3dd64f74bd8e1fe), UINT64_C(0xb4a04c587f55f066)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x50ab1a2b090e3bf4), UINT64_C(0x5baef880af4c693c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd6298099b7bf438d), UINT64_C(0x7f055162ae088782)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x34b9e856bad58732), UINT64_C(0xc7a3abc6675f313c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb1aa1f5aab57bac6), UINT64_C(0x3f7353cf633c2174)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6ffa6d88cab5ae1d), UINT64_C(0x095f7616d6c5a416)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x63900cfea288085b), UINT64_C(0x9801482d9017c36e)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x201d38cb89e95be3), UINT64_C(0x714ed01e54e1db9f)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xa24125c0ecb5cc97), UINT64_C(0xda0b34abf1bf4501)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x0f2492d8a79681ad), UINT64_C(0xc0287b83d3ca0361)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xbf51d9d0120c585f), UINT64_C(0xf8d007af1161bc92)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x86130fda9cbff84e), UINT64_C(0x558ff1ded80b20ed)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xddf3f8470d2b2dbd), UINT64_C(0x35c48b7de9837936)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x38fbbb2cdf14c312), UINT64_C(0xe54ca037bc4b86f9)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9d58038b2f21ec89), UINT64_C(0x8bce64f7d8a7a3a3)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x3613fa9c506c3d30), UINT64_C(0xa10f446777016f1d)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x95fd5bc23c131f2f), UINT64_C(0xc97ed9d52b4d82b4)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x9460354f6f598a98), UINT64_C(0x2228d625539869de)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1b120f9124ddd4a7), UINT64_C(0x8830657160ef30bc)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x20037999222c5e93), UINT64_C(0xae132ef032a9408b)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9187768c164a2171), UINT64_C(0x9b994ddb760a5fe5)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xfac31bfc7f16fd0b), UINT64_C(0x93e0814233d1a0e8)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2253b6eaf0364b3f), UINT64_C(0x0eb6e406a550a4db)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x3f7cec8bdfc340ab), UINT64_C(0x9b48bbd4f574a074)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe340b87c98fbd2cb), UINT64_C(0x78e06a352ab92757)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd7f600ec4b92ae8f), UINT64_C(0x12d3ed549c9cc495)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe65a2ae5b06ac6ee), UINT64_C(0x45a0cd068a7060f8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x79e56fe68f7e3452), UINT64_C(0x91b22e1e7561c95f)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xfe8c7c5fdcff83c0), UINT64_C(0x948466d8cb73dd34)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x0a41a8ad886774cf), UINT64_C(0xe21a28ced2eeded8)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xec0e31d912fd4496), UINT64_C(0xc8ae977f8e7add1b)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xac43f732475dd88d), UINT64_C(0x11a8736f52013f7a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x37c70823d9362b45), UINT64_C(0xa777af814fcc5b3c)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb2f65ad0d15a10d7), UINT64_C(0x7fc669efd16d3557)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x58f8a6a3345a2a65), UINT64_C(0xcdbda914441c8bd9)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x05724bb9244f53fa), UINT64_C(0x8f6acf2c26f32c67)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x21d4defa413f3a36), UINT64_C(0xc8ee1d8ff8103618)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6404ded7110032c7), UINT64_C(0xd01220ac0d3584bd)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9eb238f077a4ac65), UINT64_C(0x4e535391595366a0)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x602ef1465f8ee328), UINT64_C(0x4434579d6fc54918)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0180e66e53197078), UINT64_C(0xf94080e3d84fbf30)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x03edaedc858a0d01), UINT64_C(0x3afaa8d9926a5ef7)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xa03fb48750308faf), UINT64_C(0xcc43c14834156ce4)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x3a23823fdc223874), UINT64_C(0xf16c6659299b771b)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4ba2324571535b4f), UINT64_C(0x8ea4ae9e22be5334)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x64e50a47ed60a886), UINT64_C(0x722191b902a22db8)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x14a1c991ec89e53f), UINT64_C(0x7f81eac16a14efb2)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xd86658b5f99a11a1), UINT64_C(0xf3343739df40ff5b)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7635afa9bd8d4e3d), UINT64_C(0x6b8bc394223ae57c)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x4b5f291ccb4da2f1), UINT64_C(0x1beee9bb50419905)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xce49f96ec01c4200), UINT64_C(0x1d822475e76ceb69)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x0c6f9d6775869d3e), UINT64_C(0x2b22665444ada553)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xec76316136c4bfb2), UINT64_C(0xc50b6f0145888f1d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x5790dbfe07086021), UINT64_C(0x09e1424284146f2d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xeba754134fc1c80a), UINT64_C(0x6a12ad8b336e4cbb)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xfd5c192449fd5607), UINT64_C(0xcf57b455867d90fc)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xcd64e03a831f9ebe), UINT64_C(0x2f7375067cfe7b75)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x138fa5529b92f280), UINT64_C(0xf72be2b3ef95897a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2c89c0761609b699), UINT64_C(0xf666bbcbb76b4a7d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6b0850fbab4cbd3e), UINT64_C(0xf64dea7ef12fcb24)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x81c392e75ba19bf0), UINT64_C(0x87257f783a6e7d74)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x22ededbf5422b909), UINT64_C(0x3b0511bc0d48fb20)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x0f1d5efa3a1cec64), UINT64_C(0x0cea4a1ad02f7ab0)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x2f06233fca8c13a0), UINT64_C(0x26e4b27784e50afa)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb2eab7f37c36b580), UINT64_C(0x5d472ae0343d5594)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x6f86e780cf982fe5), UINT64_C(0x02549a77f3f20724)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4b0d4811712a3ad5), UINT64_C(0x33c348277da3def9)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf837a359a2b199a0), UINT64_C(0xac580766a4951df1)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x01b03bb8c31fa104), UINT64_C(0x0c7c921e1d845b90)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd458cba7fe587579), UINT64_C(0xcc72458e5703ed70)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9f28c7b6abac7401), UINT64_C(0x48ee467a631c8912)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf13b8434285f302f), UINT64_C(0x637a04d8d9526772)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x5927e5a5b7a6335f), UINT64_C(0x4bd5e43436f5939f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x2e4fe24f4cfa63b9), UINT64_C(0x6bdd33d8d4ec8249)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd3f319d2af86c83a), UINT64_C(0x222c57e6b90cc593)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x81f9901671c23b65), UINT64_C(0x9305f8b35ee203db)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5e2d8fa983ffc9a9), UINT64_C(0xfd4e725226fdfc24)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x441e04fd7e1667c5), UINT64_C(0x7ad47eb362d60f19)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xdbbcd36722bb4278), UINT64_C(0x2c26a61501c4901a)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x008004ccb68a8def), UINT64_C(0x14beeaa42e1bbb3d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x0e5ec2d9fd4db010), UINT64_C(0xcd3c4ae7063205ee)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xeeedc323047b613f), UINT64_C(0x0fa17d447921b1f8)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd353079865eed7f7), UINT64_C(0x95c95d633752fcf7)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x2388927503dd1ba7), UINT64_C(0x11f1202b6f44219f)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1d38386cb17fdf45), UINT64_C(0x02730555e814e864)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xfb37c96c546b74fa), UINT64_C(0xc304b370f680cb55)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7bd6846d37ed3a58), UINT64_C(0x072e893d98600920)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x32bf5ec87d31f6c8), UINT64_C(0xb7943f7d51a4b280)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd040258ae0df2a4), UINT64_C(0xa7ff124a3db7af64)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x9fbd97e1b3b9ca03), UINT64_C(0xa411f602821b01a4)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x32059cc665dc94e3), UINT64_C(0x3ed557668966e299)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x16bc07cc4b199a64), UINT64_C(0xef98da59a80d6a3a)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x6f78c6175ab1dc47), UINT64_C(0xf49fae03250bb2fb)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x8abf59ecf2053c94), UINT64_C(0xa205f0caf4161f84)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7d780c6e35391ca), UINT64_C(0x3c47f6c2b5bc181c)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x541990eaa1467155), UINT64_C(0xe91dc4e39d07fd7d)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1904a1ef247bda7d), UINT64_C(0xe9cb0e6bef1fee0c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb573d62f68e44d73), UINT64_C(0xe2d3ef0172c2944d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x683f5145cd922318), UINT64_C(0x4c821d25b3fd660b)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xca82a0840caa0efa), UINT64_C(0xd4b0c40669622bd8)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4051999abaf71121), UINT64_C(0xceec0d669c4758bf)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf636d7b97f436ad1), UINT64_C(0x4600b6e87300c002)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc8e22e60971727e0), UINT64_C(0x861bececa88f7531)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x5cc3b0290da8e13b), UINT64_C(0x9386e4b31874c7b8)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x72ed6f9fabf9a4a7), UINT64_C(0x01dede6bfabcacf1)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x1ba0bf0538568e33), UINT64_C(0x61209f197f288c61)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xeed13abada61ea3d), UINT64_C(0x77ed27bc971ae398)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xe13bf3bf055afb19), UINT64_C(0xd5ef12dd27b8c0eb)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x32bd3ddb16c8b18c), UINT64_C(0xd7e369587e3db042)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xc83d513a476fbe31), UINT64_C(0xc6962ec7f5ca1d15)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x2f76d56efa9dce79), UINT64_C(0x8a771341b289ec71)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x8252805f9d3b1ba6), UINT64_C(0xae360fdfe2c04e5b)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1ead8d42373de729), UINT64_C(0xdf6576ffe4459f06)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x670a948e0fd30b54), UINT64_C(0x1165fe81995aa735)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x547e5cf665d9bb8d), UINT64_C(0x449d5590fc919569)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xa72a68af4f1fc5ee), UINT64_C(0xea1f5d689ef48b48)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd2aeafd827102349), UINT64_C(0x7592b5a8ae750a9f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x591f3690458a5443), UINT64_C(0xc52d2bd379ebc4c5)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2d473e41950e679), UINT64_C(0x209711732ddd9b82)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x1b2f97be4704f7a2), UINT64_C(0x4879653fafa1e061)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x87444af100895642), UINT64_C(0x7d5109f42d398fda)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf1606c0c68a68540), UINT64_C(0xc60867b05a7bb94d)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x462a1af2cb1f8d60), UINT64_C(0x94b6e5f5942c2e03)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x391e41838f86cb98), UINT64_C(0x6b4e32ff23965d4c)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xbb8e83f1230a3d6d), UINT64_C(0x15ad37937f16a15a)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x402345b1bf7132c7), UINT64_C(0xfc0829ab58982d0b)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x69cf97d4ef82e429), UINT64_C(0xd642ee9b62345531)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x4b6a93368ca51360), UINT64_C(0xe2851041a975d413)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x72dfc9adbc3bcb48), UINT64_C(0xc3970a2e580bfbd3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6d920389688c1197), UINT64_C(0xa1bc360d36f50a07)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd5ec7eda783e0865), UINT64_C(0x6d4e367d9dc73c00)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xd64fe8b007e3690c), UINT64_C(0x044708298accb812)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8e7d25d30e038d55), UINT64_C(0xc79ba3e5340e6a87)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xc78ff1f378397f7d), UINT64_C(0xcdca74f3b6653ad8)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xab814f449f4e4b4a), UINT64_C(0xd881bb3f93318b8e)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf64ecf26d763bf46), UINT64_C(0x6cc38db683c4a949)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x53d07eff9cb60c2b), UINT64_C(0x72e5c2d63a891911)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf1e0259da814e43c), UINT64_C(0xd6778f9fb7942ef1)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9cec7b2d0a84f419), UINT64_C(0xd0610e93bb975b62)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xc6bdd879be01b83c), UINT64_C(0x559feff760b31caf)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xdb6644b83881e1c1), UINT64_C(0xff89bf2f2ee08023)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xcf6784bfc50a7922), UINT64_C(0xd9a9972a71504c72)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1bf59750a391fc0a), UINT64_C(0xfbda9bd00475ff20)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x29556e0c79badd9b), UINT64_C(0x95fab6c856ddcd63)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb175add2f5a59e3d), UINT64_C(0x9893f96afe158513)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x214acb1c9023b29a), UINT64_C(0xbcf3dbc50f646fd8)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3870d9e189de656e), UINT64_C(0xe7ec4ca2dcd056a3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x524a0f756f06f805), UINT64_C(0xbd608f7a93a50865)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc4d69a45201223de), UINT64_C(0x491382e15a4b8bbe)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xace304eacda9c30b), UINT64_C(0xc0d2ec1af320f14e)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xdd5c7d9ef4330e06), UINT64_C(0x912c40eb6ba63a45)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb75f0dd19161b2c2), UINT64_C(0x5569154e8f797611)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x78065d80b726de13), UINT64_C(0x0478c9d8985cf51e)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xd1083af7412eb1ee), UINT64_C(0xaa2a2b4a6cfd2517)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x2973c31efd62c7a5), UINT64_C(0x043a3750e3d07026)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x40f3ebff77ef4205), UINT64_C(0x2cd915ab2ec6cd87)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7aa00d4f9a15ace1), UINT64_C(0x853b23046ef3a9c2)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xcce25e3617a7b602), UINT64_C(0xaf1694a3d75e93ae)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9357f223e2601b61), UINT64_C(0xe97e496db3098b12)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xa41c4be98a16f7d1), UINT64_C(0x215ca4a3f15ddb1c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1606d42ca7fe48c0), UINT64_C(0xd405aac270a20989)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xaee54391d5a9130a), UINT64_C(0x7ee01ea676bc6319)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3590d5df1fca0ee7), UINT64_C(0xcf8f61d826fae0f7)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x232cef02e62c1d4f), UINT64_C(0x6cf3cd86dd781e32)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8646b5aff9202dfd), UINT64_C(0x359177c9239b9d8e)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x75bf75285be31f6a), UINT64_C(0x1974e0f53b9c243e)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc9a95df9d95b53d8), UINT64_C(0x18ca7e0353bad20d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xbe05c40153748d08), UINT64_C(0xaf6aa4ec77be4c83)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc8498aaa16ea2850), UINT64_C(0x2e1f7785bd13374b)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xe1ac189020f942df), UINT64_C(0x29d66d2fa54bc72a)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x547d2371cc6479bc), UINT64_C(0x95ca4edff944a74b)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xfce173026c78912a), UINT64_C(0xd4d368fe7948a070)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe32cbd2c6519e208), UINT64_C(0x2d6c7c2f31f26363)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xd6d2b075b563a147), UINT64_C(0x39da28065e0b6613)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xa81be0c1b3554dfa), UINT64_C(0x10cd983edfbe097c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x291b0e3772923421), UINT64_C(0x6ce8745dd3b3575a)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x420889eacf7d7ed8), UINT64_C(0x4d507dc4c2eec492)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x6ec2e06cc038b09a), UINT64_C(0x87973a642aeddd21)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd511ba8ab97632d8), UINT64_C(0x728a166c6de808a4)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xcf8aadf6d2c64a08), UINT64_C(0x2d64942dfa2ff77f)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc706e0a0b253a243), UINT64_C(0xfb5ef02eea38009d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x9c7acd781852df01), UINT64_C(0x6d73e6fe200dd56c)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x50e893ef58a01c4c), UINT64_C(0xa39f96838c981c39)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf720f7657a041f20), UINT64_C(0x98e93b706d3ee452)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd5facb894c7f14f9), UINT64_C(0x6850101550e9ad50)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x682429b5e3bd49db), UINT64_C(0x52301363d6cd0702)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe9ef0f8ac1fdabd1), UINT64_C(0xfe286f6f815b9d0a)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x816e524b9bf4b9cd), UINT64_C(0x69394f8b85b4714e)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x20e9d63905c3a860), UINT64_C(0xb96e9ac36bee6812)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xac413254fb8433b4), UINT64_C(0xf62539a152e999cc)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x6f366b798653f4a1), UINT64_C(0xcb4ae427d86b0eab)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x821b0b7006b5276e), UINT64_C(0x4e34de874f47d18b)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x95d11115e166a5df), UINT64_C(0xfb04a9e2e1cee39a)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6687e2ae53c1e136), UINT64_C(0x8b85ac5f4239160c)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x06242522eb6e180c), UINT64_C(0x1d3220e913a763fc)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xbeda852f403e8d92), UINT64_C(0x14dc10ed162c6ae2)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x84040e19ff6bf076), UINT64_C(0x3c13f0792eb17858)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x0eb7b7423a922fe3), UINT64_C(0xc3f51811e686cd73)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4969a232155ccca8), UINT64_C(0x74005ffe9e1eb871)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x4239f5dbac0d669c), UINT64_C(0x4e131717fc53cb2d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x78befb9d1b4e5bab), UINT64_C(0x050d7ddcf721b436)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xd0967d90e54a26f8), UINT64_C(0xc0a99c0e99ac1c33)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xcf8571ed69ad822c), UINT64_C(0x4a325b2e4c6e3147)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xaa0a1dffe91cca5e), UINT64_C(0x3158c400ce760e92)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe701464093cb4fad), UINT64_C(0x333058cfaf0abd79)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x0d6c6eccb3a61f97), UINT64_C(0xed927b95dbd9e7d9)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x613d055804f976e2), UINT64_C(0xb97fa8e32df79ca4)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x5f7c915f4bbf9952), UINT64_C(0x78701574faacb626)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd2aa3ca2c60e019d), UINT64_C(0xdd5b6a2d01f0235a)}}},
+};
+
+static const mzd_row192x2_t LK_2[] = {
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xe657c33ebece05a4), UINT64_C(0x7f10363963225fbc)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x44ec76fc0c26f8b9), UINT64_C(0x9a9fbb66bdee7229)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb4a71ce9d6295b54), UINT64_C(0xa989acd6502d9127)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe4df542bf43aeccd), UINT64_C(0xdade57aa66d1aba4)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xe4c4d6566f88e932), UINT64_C(0x448a4009d9987bc2)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7e3111b99e7978e), UINT64_C(0xe577b5f444e4d480)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x157018f9f3cfa2c7), UINT64_C(0xe2acdadd1e47492c)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x93f09812adbc98c1), UINT64_C(0x9e276a9eb4071209)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x5b670a61731475dd), UINT64_C(0xcac5a79f43d4626a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x74684f9e0516136d), UINT64_C(0x1898e7a1ff454c2f)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xd8841b91a406b5ff), UINT64_C(0xd95f5bc26b15d258)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x163b1f6e5882e3ec), UINT64_C(0xc7d8edc1777a8616)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x5d2c255653d28092), UINT64_C(0x9b512f754f776205)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x90dd4433979ef6c2), UINT64_C(0x8c0de7e22be02ba0)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x3c50ad9a90168826), UINT64_C(0x130121871687ba9d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf68c14656a49a1bd), UINT64_C(0x211ed96c67c22b8b)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf6133cefafa51b6f), UINT64_C(0x081c61e887debefd)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf1fd27ef5c02698a), UINT64_C(0x536bdb22584a36f9)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb5efc7ca0e187566), UINT64_C(0x093c833cdf12b33e)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x181a71b57a20c2e2), UINT64_C(0xf7011086400ec7b5)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x347232fd210af0b1), UINT64_C(0x7590679bf6755d17)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe5e7de3e45091070), UINT64_C(0xd12730f0e530336a)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xde0f75ef49287b3f), UINT64_C(0x203a2ddebf729f3a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1a294fd0b09204e4), UINT64_C(0x1f8eb8f7fdc4cccc)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x10914b7ed06742b4), UINT64_C(0xbb3b3ea829be828e)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2dd206f5a4bb9563), UINT64_C(0x616ccb7b25845311)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x3c2c057e2184e1b1), UINT64_C(0x9725116983173417)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xa6030acf57104ef4), UINT64_C(0xa71be63ace32a49e)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x49ef91cbf7a69834), UINT64_C(0xe5e1e867c74ed00f)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x75c35d8e94fab011), UINT64_C(0xdc2692dc4c89964f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x65ad5692573fd5d1), UINT64_C(0x734f984b112ed57c)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x426a301c092edef2), UINT64_C(0x04280bce3007de05)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x490c90aef5b2f15c), UINT64_C(0x6b78a4f9f100a3a1)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xfe173f5e2878a7f4), UINT64_C(0xf209727ecd4beecd)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x67919e8f994d7b99), UINT64_C(0x020fbfb991cd01a5)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd61237b50781e03b), UINT64_C(0xe514d28230b65a9f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x5edc4b9280f4d11b), UINT64_C(0x7afecabc964505fb)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x96a4b15d1e81edf5), UINT64_C(0x81879e422ec5f017)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x610f9506f9fa7f59), UINT64_C(0xc9acdcfc10d82111)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1253e08a4cdf217f), UINT64_C(0x219211d434934851)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xbfd5c27772772934), UINT64_C(0x7fc87d1f1393cb6a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x86849bfab33e6ec4), UINT64_C(0x2a8d26bcd858b518)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x5ab36681976900ce), UINT64_C(0x2c4998df08a7162e)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xec987c2c2a832f02), UINT64_C(0x04560c698655b93f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xaad2e0643859d3fe), UINT64_C(0x51f9c587814bfadf)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xfdb21f6136165c4a), UINT64_C(0xd8bb731a1711af7c)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x301bd71c371d6b89), UINT64_C(0x0d0b4c5eec3d4f3b)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x15e2f4d9c19a3fcc), UINT64_C(0xec4783992d01d5e8)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x0a7be01124d2decd), UINT64_C(0xaf43f954a9ea6365)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x29ad2ec4c621105c), UINT64_C(0xd05693aa887ca81a)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x476ea60b3725a0dc), UINT64_C(0x6968fc9067dd1bec)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x37860f58b1b8af7c), UINT64_C(0x05a4762029d02e59)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x520f4561881e5b55), UINT64_C(0xd9018e66a1a038ab)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xeeb88c1e86e022d0), UINT64_C(0x9f8d912dc01739af)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x917476c4b20cb98e), UINT64_C(0xa455a6bb94a24550)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x09f200e4de695dc7), UINT64_C(0x4e77f871291cca4a)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd56aac0b0d835b5b), UINT64_C(0x817f228cbd12cbc9)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf0e83689cff1aa75), UINT64_C(0x569055676d60d0b9)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x86c68aede58f7015), UINT64_C(0x0cc7a43a280cef0c)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf3806eb12b1848a2), UINT64_C(0x017bfed64ede281b)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6bd399f86b433ec5), UINT64_C(0x79f3d801dee9a11d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7d722bff38670537), UINT64_C(0xe4f60ac0fa63bd81)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x5207dc5435be17db), UINT64_C(0x1aa893bf2490baa7)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9646a957e2702b42), UINT64_C(0x1f5321d51df928e0)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x53c99bc7bc7f1af0), UINT64_C(0xf2391ea40f975069)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x64c7f091dd347b47), UINT64_C(0x8f4fe74737507991)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xfb0baf9a48775685), UINT64_C(0x82e46545344c80b3)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8c8cd9c207cf6b6f), UINT64_C(0xd6cc681f917f02b8)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x9fbcc792b7bc560a), UINT64_C(0xdc81ea9f5347f6f1)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4d86afa76d6b4f56), UINT64_C(0xd072aa21cb065f91)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb65e97756959d223), UINT64_C(0x35b4a49c5b9a6a96)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x30f10ee6eb88e46e), UINT64_C(0xa51896421874013c)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x530405d35d15e58b), UINT64_C(0xcf1f946a4a485352)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xeabbedbd9c6621f4), UINT64_C(0x83d9593f02566629)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x417d489267b835e5), UINT64_C(0xb2e92c3256ef7613)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4bd2ffc55a025075), UINT64_C(0xbd9bae5016536498)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xa52f731a400c1b3c), UINT64_C(0x1807a09736a45b4f)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe54357f9798e28eb), UINT64_C(0x941445b5057da1c6)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xcda695f65e4d5346), UINT64_C(0x6143c8082fb868bd)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xcee3cd9e2000ab45), UINT64_C(0x04406507650d395a)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x4bc9b6a11319026f), UINT64_C(0xf982d2afbc608e56)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3f1da9926cc2ee20), UINT64_C(0x77d33378093f185f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x12bfdae5e0cd6788), UINT64_C(0x13fcbfcb631fc124)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x31742e8755b5e92b), UINT64_C(0xd33d1fee01e49445)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x2e57e93ac2f29f8c), UINT64_C(0xcec70bbff88ba0d9)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd56b88aeda8cba58), UINT64_C(0xed7ee56f0042eb7a)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x7ad6847b960b85d2), UINT64_C(0x6fc2b216207aa97d)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9a0161848c4c9715), UINT64_C(0xc4f39675a655736d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x99c18d6dff303cce), UINT64_C(0x112676250624cd05)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1a7943e404ad8676), UINT64_C(0xb703b1bc296419da)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x1c4d8db9c63b9ae6), UINT64_C(0xfcb2d8fff23bda26)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0176d34bd9bc969b), UINT64_C(0x94803955f950af9d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x9732fbfd6a759be8), UINT64_C(0x0894cbcabfa6d2d9)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2eca3b553b7ccd94), UINT64_C(0xff4d53284b9c2f5d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xbf5bc3fe16cedfd1), UINT64_C(0x1041b7a3ff39560b)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3c1cb9889033ddd9), UINT64_C(0xc90065bd525e204c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xdbf686d2dd1f2258), UINT64_C(0x01503145bca2505d)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x49afc02b37f41f55), UINT64_C(0x5303149a9a5a2fc5)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xfa7c5115d5b95c3a), UINT64_C(0xcd20ee60919ae963)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf3bf0df59ec09160), UINT64_C(0x61163da278edf031)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x0c98be1bf6aacef2), UINT64_C(0x69b4a2b60aa026fc)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x54b18b23968a0b50), UINT64_C(0x5ca454da1f84c12c)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf0a1143607ce2b01), UINT64_C(0x5d7c61f993c5143f)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x24e9988b9fd54833), UINT64_C(0x154ec5c49f595f78)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x0c8f2475117e8b12), UINT64_C(0x75bbbb44b28097f1)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x49da63b94b66edc9), UINT64_C(0x6d487abc5c3c87e2)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xa0b87f6bd339c223), UINT64_C(0xb80f11a52ee05e7c)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xfc9959d655f34897), UINT64_C(0x71d023b55e95fa0d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf66696abdd802227), UINT64_C(0xee2480b0b5aba489)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb92e4ccdc34ca348), UINT64_C(0x24d16fd0f3268cb4)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x0b0b7ab1f4eb9c0a), UINT64_C(0xc56c7a428b1441af)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x02f61b71bc9977f5), UINT64_C(0xa0865f81ff77f182)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x1e0f6e194933234c), UINT64_C(0xbb19e21af94c48a9)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf942b05710bdaa54), UINT64_C(0x5be5be79afff9977)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x6483b4daec99df35), UINT64_C(0xfec1df03b6896785)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x181a585deb311d9d), UINT64_C(0xbfb92a84263f02c2)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x32e1db82edda2624), UINT64_C(0x0d31f006c29cdc8e)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xdb15aa0a03cc022d), UINT64_C(0x3bcb8d2af9427489)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x562f93be4f47ab2d), UINT64_C(0x9293fb2993299f3c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc4552b00c605a472), UINT64_C(0x56a33a2352f008fc)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xae6f0e0cfec7ba8a), UINT64_C(0xa922e816c2b366a9)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x57edbef46cb2b6b6), UINT64_C(0x6b48f93eb4948379)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x48d0bae9af6e168e), UINT64_C(0xf2d426d97fff4530)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x65dc0398ec99c0ad), UINT64_C(0xcbd2eba19e2b6335)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x8c4019b1b143e7fc), UINT64_C(0x89695d18a7300a43)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xee2868ba1042d228), UINT64_C(0x99024e24820f04e9)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x7bd02c8a3b71b517), UINT64_C(0x284e5c29fec8a72f)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x415f0f62f619df90), UINT64_C(0xed2dbb18fca45d6e)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x34044e2fe4e21df2), UINT64_C(0x33fb1a76525c63c7)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x425b1e49d1f426db), UINT64_C(0xa8bb6d90f6a2f1fb)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x79f12e3a5a30343c), UINT64_C(0x4525b7be5b311806)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2944ff3affc6285), UINT64_C(0xb0e9180da7ac12b3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x39293fff0b4f294a), UINT64_C(0xb444a7324cf1ce6e)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x555a8c28bb227c4e), UINT64_C(0xed66bce6550d4816)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x5e2ae4918def302e), UINT64_C(0x2ddd52ccac8d052a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xea1a17dc634e6c7e), UINT64_C(0x19a0acd109af9af1)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x00e493c221e5f1c5), UINT64_C(0x1c7816599b2112fe)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xaa6d6d6926fb3f3f), UINT64_C(0xd5aed23ffa9cc605)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x3513384e3a241291), UINT64_C(0x4b41587c8bea87cf)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7ed8eb977cdcb0dd), UINT64_C(0x84ed643fa4d90695)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x56a79839905bdaec), UINT64_C(0xaa3dfda469ce9223)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe02250f5ed9da8eb), UINT64_C(0x1450ec5821655766)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xdf45984e24042e5e), UINT64_C(0x36fcc0c2d819d0d0)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc85d2af09bd211fb), UINT64_C(0xcb0c6f2077f13f54)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x756a6929cc0ef1a7), UINT64_C(0xebc62ce4f6a2cb80)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x226fe57b390c5f72), UINT64_C(0x56381ed1cb3153b3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x53f76d507e8348de), UINT64_C(0x30a4fd57af000cf1)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2a64bacf6913ca76), UINT64_C(0x91dd73aa2387ade1)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x30b5abe4920760c4), UINT64_C(0x017e68d780b8bc0d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe51ed5ba84a09485), UINT64_C(0x122c425e347d492e)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x1cbf70166e02d5f2), UINT64_C(0x5ad4e662eb1f7034)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xdb9efc5161a9b356), UINT64_C(0x79672f37917a53e9)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xcc0a93967b1a73ce), UINT64_C(0x69749273458f81a3)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x141fc837590eb82e), UINT64_C(0xb208edf8f693f541)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xaa72311aac5a24f7), UINT64_C(0x57cab18808d2dbf4)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x344fad9de7543c74), UINT64_C(0x1ecb9b354fa07d87)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x3d78590ada7233b5), UINT64_C(0xa2c06b5101b047de)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3dd859172efc4a95), UINT64_C(0xbf50e0b4a88d96fb)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x05f4900074a2a7f3), UINT64_C(0x5b249a223a506035)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xcf20f47ecfe1c109), UINT64_C(0xaa38aedbe7d4ec3c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x5d4746c9e96708bc), UINT64_C(0x2cb83751dd15a484)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xecf0b1f157f40e3d), UINT64_C(0x424c53731eba36df)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x1daa72b10dfe00ab), UINT64_C(0xeedfab119a909fae)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xcbd7515fe6313d73), UINT64_C(0xf72ed8f248e66e24)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xe547864dbe9dd1cf), UINT64_C(0xb2225b7d01987151)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe977c988dccce998), UINT64_C(0x0dcb125d547db50a)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd662827eb8f76367), UINT64_C(0x86f0db9233873ffa)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x4fc2bb957c2fc859), UINT64_C(0x29e48835e5a06bb8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x2006865c9ebb3f2e), UINT64_C(0x1a931fabffbf76e2)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x94fd59641c57d3fa), UINT64_C(0x20ae0777a249069e)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xac7ddf4c37c7d74e), UINT64_C(0xa52c0f87f035a1d4)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x94c8e70b148c7222), UINT64_C(0x9e024cf928e13eeb)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd196da8d197274e5), UINT64_C(0x8d39188ccc24e2bc)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xee72bdc9db875448), UINT64_C(0xf15a2fdf4569382c)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xe645f6cac2ae4b9c), UINT64_C(0x502e0ae838f1cd0f)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9ee2fba7f2e2597e), UINT64_C(0x8662a914635f4e19)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x42aa219b85e13771), UINT64_C(0x3b56d2666751e7c9)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xbb47e8b95b47cdc2), UINT64_C(0x39837672de3d2de4)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x1e201fc3303cb2e4), UINT64_C(0x45ac8dfc2c69a5ea)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7346519351502f87), UINT64_C(0xf679f19ba9e53f41)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x96c961aed9da0d24), UINT64_C(0x73cf8d8d28863a68)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc9ebbcf7910a0f90), UINT64_C(0x112e3f7de821cb35)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x031fc8a1784da19d), UINT64_C(0xa19f39626e16cd21)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb60ae9ef636b9dea), UINT64_C(0x5af8261c9af3e988)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x0cd4d70acbf886e1), UINT64_C(0xd1162f8780d46620)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x909b71156e5982d6), UINT64_C(0x85ccfd51fb5788ef)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf158c24b763983d0), UINT64_C(0x53a015f08e580a30)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3781acec43bc1bfc), UINT64_C(0xd7b0000cc19ada7b)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x488521d1cfb54a54), UINT64_C(0xdb5e3d740ee9cf0c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5d0c65aa987c3315), UINT64_C(0xb7d024df5bf12ef7)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xbf7a06857463411a), UINT64_C(0x112fc82d86927b99)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5548e5d6fe53e43f), UINT64_C(0xb93cf96d96c91c35)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x12b795ae9cadd8d1), UINT64_C(0xa38545a723d39901)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x07fb59c6fee5c5e2), UINT64_C(0x2a05bc3ec95022b6)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x87b33e7f9603b92e), UINT64_C(0x644d5d328c39204c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc0d5d5665e695a8b), UINT64_C(0x6cf86c9070f1afa2)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x5a10fd082b5bad2b), UINT64_C(0x939106cd29a514e1)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x20ae4792b99a3629), UINT64_C(0x8e543ebae70de0e2)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb70afbb17aa3547f), UINT64_C(0xd777fe6b44a934e0)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd2bf750c5e3cd595), UINT64_C(0x359822c7029027c8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xa0f969c45371c07d), UINT64_C(0xe3e912ae290eb532)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xea176fb45e90bbea), UINT64_C(0x5eb67d0fbb331ca3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x7ed9991777f79bba), UINT64_C(0x98c09a992f8b832c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x55420d95399290f3), UINT64_C(0x7082f3c2e2bc91eb)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xbd72549d6e2350e3), UINT64_C(0x9d53f57c258b8114)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd1f662a6ae393f11), UINT64_C(0x34bc3c92030afe7d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xc2d816ed1c33cbb7), UINT64_C(0x7a6007a58bc3ae4d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xb5b16dbbdc8930c8), UINT64_C(0x6e37cd97db36725c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x92eed4e752d417a6), UINT64_C(0x720f868c090c633e)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8f46d0e352293c99), UINT64_C(0x1208f0f4fc2867e9)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x14994e7dddb4fb42), UINT64_C(0x568825a33b83b5f1)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xdfb5252554f71c32), UINT64_C(0x5ee6b837766d70d4)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xa03097c719d713c7), UINT64_C(0x586348d2cf2108a7)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x4faaa20527b013fb), UINT64_C(0x009d62261b86693c)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xe844780f1ed1a211), UINT64_C(0x74d729beb21d0c2d)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd2caa0d1537be6c1), UINT64_C(0x776d60b6b0e013e8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xcb749a3cf71f9e88), UINT64_C(0x24a4eda094c93d35)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7e23876e2afa40fc), UINT64_C(0x62243e50125e740e)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x606e34978e252a0c), UINT64_C(0xb469c36b344af8c5)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x416ba89dbfa08851), UINT64_C(0xc8b698a423022314)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xc3cafc697bc253ac), UINT64_C(0x8108d414bcf53c9a)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x66523fe16c9f33f5), UINT64_C(0x09f37d83facc8686)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x9ac33dd419ea5a61), UINT64_C(0xaceee65dd7e3d96b)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xdc6e6a38eea6a97c), UINT64_C(0x812a47e4d2e17a73)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x9e08c13c939a15b0), UINT64_C(0x5b9cca5823dcd2dd)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3e11b22a68d431db), UINT64_C(0x62399a550e6e7206)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x2d43002af8f25eae), UINT64_C(0x67220d22c12e3df0)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5529ff9b4aa6a6ec), UINT64_C(0xb342b4136e9f609f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x97881801a2b56fa1), UINT64_C(0xde2c92e81354ccb7)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x83eb0d37d1da21f6), UINT64_C(0x2ad3307cdde31a98)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x22cd5e85872519ec), UINT64_C(0xa8a49d7361eb997c)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x774c3b9a177856f5), UINT64_C(0x73e81eb384c58add)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xba8b0a0b4532e641), UINT64_C(0xa94590372ef794fc)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x676a759375ca63cb), UINT64_C(0x9a35f53d0b5090a9)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xc78d0c8f21cba731), UINT64_C(0x5fc24ffc44779c5a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0caca34804531de0), UINT64_C(0x68588dd7e2b89687)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x4c9b370afc5f5642), UINT64_C(0x462ba5bd607c3209)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1e88e7c033f05cd5), UINT64_C(0x3f816a339b6310fd)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xd099a03e966caa1c), UINT64_C(0xe0cee32eb80de9c8)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb453c710e7f1025e), UINT64_C(0xca3bc1846e91bd63)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xc58f95ee4c51f3e9), UINT64_C(0xecf3157c218e05d4)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x6449def4111735fa), UINT64_C(0x7372935f58030567)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x0af7e39ac190fed7), UINT64_C(0x31db52cb832228bf)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe9bd14dd8066ca65), UINT64_C(0x480dd38ad89fe8a0)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf81fc1d38ea5fdae), UINT64_C(0x1f4d19c1e8b50d96)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x86a539c077077147), UINT64_C(0x95f9a2176c04fc41)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x0aabd349d3a1b659), UINT64_C(0x3fa963f0c374c3d9)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xa738f8ada097099e), UINT64_C(0x12da0765adfd4f9c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xa0d371cb8cd7a224), UINT64_C(0x74d4905df8c8500a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xba3eb9cedbac74ec), UINT64_C(0x5a833e28cf631ec2)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x8ff3b0e09efa7622), UINT64_C(0xd515f1b689658424)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd68a30d06ec134af), UINT64_C(0x0cd47ceb9edb59a7)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x73b8d91826061da6), UINT64_C(0x352b55b4809e5d0f)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x97cfeff8614e1bcf), UINT64_C(0xb4a762d1e19fdb9b)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x25cf9528fda74b0c), UINT64_C(0x5ceeac4c1aa198ad)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1f24d39df144dc9c), UINT64_C(0x5cd74759a6c670fe)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x716e31b6a0dae741), UINT64_C(0x1e7e9f80b9f15813)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x6011db454456dd2c), UINT64_C(0xb151b077446874fc)}}},
+};
+
+static const mzd_row192x2_t LK_3[] = {
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x0d1df2efeb111aaf), UINT64_C(0x7996850307bef0f2)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3e41b8e827f6220e), UINT64_C(0xa7c034c34fd2006e)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf197b7ed55baacae), UINT64_C(0x2bbaa267f09b460b)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7932af6cad51ecb9), UINT64_C(0xfcadee66d86cd082)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x52ce61c3310e747b), UINT64_C(0xd144605de0dbff40)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x562674f221407029), UINT64_C(0x0ca9df5f06279877)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x2364631f20b2df59), UINT64_C(0x2156424640f53554)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xdcecdc7747fca8cd), UINT64_C(0x7942a6c732c9396b)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x55acd652edbe14ad), UINT64_C(0xaa7809a86063f9ba)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4e9ff9ef7f2a1576), UINT64_C(0xa39ed3ced4007d5d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xdf9f0bb7b51a4511), UINT64_C(0x7ddc05ec6befb051)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xdf1824192d59d331), UINT64_C(0xae4324ec645a4785)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xbed5291c9c9f7c52), UINT64_C(0x02465c181d7266c2)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xcad9ec7de4150ff8), UINT64_C(0x5d52cf416f7158f3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x3b2160d06537c5bd), UINT64_C(0x8c06ee29db89e269)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x195c981a956be33e), UINT64_C(0xdd22737ac60314b2)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xc743c729f4bc1f55), UINT64_C(0x076abf36dfb1883b)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x243c8a7799580323), UINT64_C(0xa09619b8059d26a6)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xea167801ce296244), UINT64_C(0xafa141b7e67ff727)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x805f45735e4a0722), UINT64_C(0x0427e18efe509d4f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x6b41c68408408296), UINT64_C(0x6e964b30645e04b6)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8bb07860c7a5a417), UINT64_C(0xd684908a84add479)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xe66199858b97c7c6), UINT64_C(0x748bc8e6df396d71)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xca004651c49dbe50), UINT64_C(0x9ae9f0c85575d224)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x9380f0eb4c1e6540), UINT64_C(0x3c604ccdbaeb3cdc)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd473d0f16dd6370e), UINT64_C(0x458b1bd6f24fe735)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x41c451b7ad419da4), UINT64_C(0x0e403fd09f823323)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xa5e14b5c8e7d9bb8), UINT64_C(0xbe08ab8efc7e1fc6)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x43924dbc82c8964a), UINT64_C(0x7f56ab7ae4f4d47a)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd240c6d44a55ba3b), UINT64_C(0xa1463628d74cc653)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xdc46aa8e273154ec), UINT64_C(0x50e906c9dce7fbce)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x527eea70f0f290e4), UINT64_C(0x9408d6fab3524920)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd79a93023a9374c0), UINT64_C(0xd4507d7f0d0a312d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9a035a27620e933c), UINT64_C(0xa95d6d68effaf861)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x37217c18b446b1df), UINT64_C(0x0cbcdf594ef4dc13)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x6eaffb98916dbf98), UINT64_C(0xd6137079d10f2e7c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf5f06523ca5c3bdb), UINT64_C(0x222c1ef484b6c8d2)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1fe043f948ef031d), UINT64_C(0x054cfe8720162d75)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xdba015771514777c), UINT64_C(0x2efa0c014e541c02)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1e6619b971efb51e), UINT64_C(0x0b0d88886ba10e38)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xe0d80c9fde2ddfb3), UINT64_C(0xc69df6eee63462da)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9d6fc2ce3a59dae6), UINT64_C(0x62a9976937471dc8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xcb2796b31b69feae), UINT64_C(0xe551b6abdd3997a5)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd22520acb8c561b9), UINT64_C(0xead3dde662943dee)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xeefc8a2e51f56347), UINT64_C(0xd4c6e1df7e97e66f)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe3a906796ad2f47d), UINT64_C(0x85567901e9158dda)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xa5ec40c2373cd444), UINT64_C(0x4f516910b85ad6a8)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1b4372c76dbb0339), UINT64_C(0xbcc72ecfd2e03489)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x0f74ac31f98ada82), UINT64_C(0xb6a062091941a3bc)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc8ca52e86e71eba0), UINT64_C(0x8a07f6e51b6f7b1a)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x2c2fe699f201b184), UINT64_C(0x31a305edaa191c67)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe06f51341f360f9d), UINT64_C(0x1a684d73c404f094)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x66a6f29baac16d0e), UINT64_C(0xffeec1f99260bdd1)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1ace7d7318feeaf5), UINT64_C(0xbb734bad474bbee6)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x3844ecb4a5a92585), UINT64_C(0xeef49d6207773433)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x27ae1925de107b48), UINT64_C(0x134ecb4edd44c36a)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x5f579860eafe6d13), UINT64_C(0x66b4ac5471e961d3)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd62f2d0b8e6f4ffa), UINT64_C(0x401ae0ab5a8c444a)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x12ad49de4d3c18ba), UINT64_C(0xc747ea324281e8bd)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x977e0f16e8c074fd), UINT64_C(0xfef76a2617ce0cac)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x9ab3682273b658db), UINT64_C(0x3a541893b11bf814)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x97878a721b118a4d), UINT64_C(0x8b7306416b6268c4)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x75f526ccf8fcfe30), UINT64_C(0x7630adfc9728b5f5)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xea6312f0d77dbbd6), UINT64_C(0x6e10a00d5341056e)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xf6247e7ad006b169), UINT64_C(0x7c12c3ef24fc54f1)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7fce6339d058aeb1), UINT64_C(0xc59ba810e09f7cee)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb2cb2f34fb35cfeb), UINT64_C(0xefb3f9a9527aaf46)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8ee5c1b8a3318cf4), UINT64_C(0x91b1aa16b7ac18d8)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x535a529f45d5031c), UINT64_C(0xb7657bce3aac6748)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x5c7498a0c7d8c94f), UINT64_C(0xab3ef71e8bc092f3)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x14ac9559fd177752), UINT64_C(0x2e6da55e02176d25)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf6c39f499d913bb2), UINT64_C(0x6c06a336cee5e88c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x600d153fb1c21cf7), UINT64_C(0x136a776c1b122ce7)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1883b9d471b178fc), UINT64_C(0x4342c0b64c384dd2)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xa9a0a19631171cb2), UINT64_C(0x472335ee770a06bc)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x231dd0c4c264691c), UINT64_C(0x8aade70ffd1c8e85)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x3c392f6a9b679ae8), UINT64_C(0x6f192a139fc7c24b)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x27ac30c6d77b62b6), UINT64_C(0x12ec25c262fdbb6a)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x99b6349549cb13eb), UINT64_C(0xf1c3b056296d367f)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0c74e88e4a13fdd0), UINT64_C(0x68f85265728ae06c)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x1bbacdebc19a57d7), UINT64_C(0xd938b3bfa19aa517)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xcc1647cee724a28e), UINT64_C(0x6f4c63c02294c390)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb5ccf6f09f458038), UINT64_C(0x28f9eb806d4114a1)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x2809495b9ab96f40), UINT64_C(0x4b07a5e736013a6b)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb501225ab225d1a6), UINT64_C(0xdc417f7a58967f6d)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd94b029b2f328a60), UINT64_C(0xb5fc6a487263d79d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x8822014936b91ec8), UINT64_C(0xa808bab0bee75cde)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3c4b5ab1192adabc), UINT64_C(0x35a04dd0e9937ac0)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xad747835cde5ea0b), UINT64_C(0x195a2d2155557d90)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x5d7b78ee0a7d7fcc), UINT64_C(0xfa4eae3a610ad152)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x050ec4058161c6a8), UINT64_C(0xfecbdffa093be660)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x96877fc86f1ca835), UINT64_C(0x358e090eaf8e254b)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x5a33c58894004865), UINT64_C(0x50b1a6d760ed7ea3)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4fc59ed0ac8393ae), UINT64_C(0xf9342ed76997e362)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x72fb96724a0bdac6), UINT64_C(0xd234b8e47445b899)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x89fc2dbfd1bf86b7), UINT64_C(0x3ecd63cd2e733e88)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xaf21388d20805322), UINT64_C(0xa7c8386d916cddec)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x71771c38684acdf6), UINT64_C(0xe3a33ed2fe53926f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x75c2393428ce0455), UINT64_C(0x12a0a24c90d22df4)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xdb1cfbf3e77a7aeb), UINT64_C(0x6b2d6300331ac466)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd9385edcdc236304), UINT64_C(0xf2f4c9609562d348)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb0889e7d1970f076), UINT64_C(0x4e633031701eafaa)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x91bdd2d28fa59dde), UINT64_C(0xed1f80ad40c77414)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x512a84565a3ddf8a), UINT64_C(0x7237d4595cc4cb9c)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x3d89cf428213d2b9), UINT64_C(0x955e55b37ab186e3)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x04e7904534d66dce), UINT64_C(0x54b74eabd8857478)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x86f7be81b65b710b), UINT64_C(0xb4571bc40f05b3b0)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xa1c513a422dd58ee), UINT64_C(0xfe3593d970269ee8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xeb44d0d909ad4638), UINT64_C(0xc64d3f0b7c1bc1b1)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7f212489dfbfc4a5), UINT64_C(0x4f219b580535c472)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x92dfa30ba6e7b593), UINT64_C(0x2a119296af26304b)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe528f29a7b7b94f4), UINT64_C(0x4bae35ddc5c1e4d0)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x4ee22f1deca68733), UINT64_C(0x815d76f84ca51fdf)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x44e787382f71f14f), UINT64_C(0x31476a62cee7c6ea)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xa4b2158572756ad8), UINT64_C(0xf51fe902c678b54e)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2bdc3f8743b2b479), UINT64_C(0x5f158ac83996b8a6)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb61fc92d05161180), UINT64_C(0xc49bb677919e3853)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xeb423e8e06aaf4fd), UINT64_C(0x094196c900e9dd10)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd2e941b6a75e8454), UINT64_C(0xec4b9566cf218772)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xdfbd7315fa5928ca), UINT64_C(0xb7467c0e2b297e68)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x4da83e5143caa4e0), UINT64_C(0xc14f84cb4335ac1e)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xbc7acb667e7b27e8), UINT64_C(0x7d7771861412bf51)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd3148d44057550c5), UINT64_C(0xd72f0aacda242843)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5ab91ccf99ee56c3), UINT64_C(0x974fcdbd9bd62e77)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf7b88f78446cd7d3), UINT64_C(0xc0c99d4b5f7981d4)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x6859b8cc0793d8a8), UINT64_C(0xd45a2bb9c7089b15)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb27d8b19512e3d14), UINT64_C(0xdddcee1a476b21b9)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x40bef5e8f3c92ff6), UINT64_C(0x7852e9810df8e739)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xce44cc1a9f907974), UINT64_C(0x89eab4bc81aa2e4a)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8cbec40851e2523c), UINT64_C(0xa95269f419f6ad79)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x52054bb20c96080e), UINT64_C(0x99c76163266e48e8)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x045ad33bc506f00c), UINT64_C(0x6c1b696a82cc836a)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x9535e4365a539de9), UINT64_C(0xba775cac12fe6565)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x19574abc12133f85), UINT64_C(0xd03e866a9d690e5e)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xa9b7de124700033f), UINT64_C(0x7981b1f09178c38c)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x2f3c074c408e5602), UINT64_C(0x1e7b6486f837d9c5)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x0b6bea1899fda0d1), UINT64_C(0xd7fcdbec7a620492)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd9c756855b7f8569), UINT64_C(0xef2e3ed10a011e52)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf8ff533941ddb4eb), UINT64_C(0x3bb376f911bb3444)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2e416a618257f0ca), UINT64_C(0x81e0ade710cd337d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xbd548e0971cdbe3f), UINT64_C(0x67d407fe30db2494)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x18987f2afd395aba), UINT64_C(0xeed2a4f983a9aa20)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xeb2d887a442b2703), UINT64_C(0xc49fdf19a25f7098)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3ca52898655b6f04), UINT64_C(0x2423bf2c1c46fbf7)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x41565971e4a1e963), UINT64_C(0xcdd15fc549e4bfdb)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x32f7b29bae335e96), UINT64_C(0x98173dff4678dfea)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x2e8106b8535a8dda), UINT64_C(0xbf66df18ab87d9ea)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xead93ff01d6341a6), UINT64_C(0xec06d7eeb06d718f)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xcfa84c413fc2ef04), UINT64_C(0xad71e03e4d656862)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xed163f5f8f23c898), UINT64_C(0x71badc60e0573ee4)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x3d51dcb6f2d3040e), UINT64_C(0xca2aef42dd49a862)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe675412ed54da78b), UINT64_C(0xc7de39a531881321)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xffa9701e24229243), UINT64_C(0x939447cc12a7f72f)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x22d14dc2e2be0da0), UINT64_C(0xe555c8e19ef6953d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x285168e41c3018ef), UINT64_C(0x27655a46070b6a4a)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8defe2aea19d17be), UINT64_C(0x8517afccf29bc6e2)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xcbaf93ccdb7f973e), UINT64_C(0x98f4a6b3f39ddea7)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xb1e384e00ae5d7fb), UINT64_C(0x09f3a700a3e074bc)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x9eb4a2601d53b4d9), UINT64_C(0x5e8a5abc7d87c194)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xfd840e1fb40439d7), UINT64_C(0x6761bbaab722de9d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x7610658b408f8009), UINT64_C(0x0eb49245ca2f260e)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x74e97b1e36fdea52), UINT64_C(0xd990d7d1a7f2f746)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x53c428cceb798ada), UINT64_C(0x29ea927b5fa28438)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x58cd4cff56e36cd1), UINT64_C(0x73169acae86fe79a)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x22e5b074d2ffc985), UINT64_C(0x16067ef8e5832b49)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf187c456cccaffa4), UINT64_C(0x8e251533c0421c64)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x49a5f9beea278929), UINT64_C(0x5d86730f81168d67)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xeda0af2097024610), UINT64_C(0x20f3aad4f8adeaf9)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x384f453584035e72), UINT64_C(0x914fff035a816000)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0bcc635fb70bc329), UINT64_C(0x30472910d572f0f0)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xb0671ec4424b9022), UINT64_C(0xe61679c3d09d9bc8)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x940bfb951f3f1ea6), UINT64_C(0xc4c9a10364e51efe)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xd85e5e43fdd012bd), UINT64_C(0x46a0809b68e60904)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xffa55d0fa91b6669), UINT64_C(0xc92b7462f71d0c66)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x9eb98f679eae7df2), UINT64_C(0x6214e343237e6a14)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x213cc94a7d20c58a), UINT64_C(0x982d5590602d8aab)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x84f34b6f508f34ea), UINT64_C(0x0aefc89a62951c0d)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xbed29129bf9a01ef), UINT64_C(0xad24ac1c01e547c8)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x6ee1d4b65b498d2e), UINT64_C(0x46c2b4a532ca1095)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5296c41b0e717cdc), UINT64_C(0xe194c25217e84669)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xce23468f895a184b), UINT64_C(0xfc481eb29560e1fb)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd44ce6e0bd49e134), UINT64_C(0x405e0af915c7843b)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x0714c01ff3017e53), UINT64_C(0xdbcf633f5bc49438)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x993662e93784cfa7), UINT64_C(0x5b71b0828d1a5b06)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb52e8d09ac46d2e0), UINT64_C(0x32344ce7309e8429)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1ec8e678d06b24c8), UINT64_C(0x3a4e282a3426bb1d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x65c0bd7b3163aaca), UINT64_C(0xa80be35b5f5694b9)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x2f6e2a82ac2d2412), UINT64_C(0x70b2f1a1f96b4ef5)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x94ec12827c8a032e), UINT64_C(0x8f0c8da2b5e8cb5e)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc8c66003f0c12ae8), UINT64_C(0x291f172c236c75e8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x7be8fa0c07322cb8), UINT64_C(0xacf43ad4d130f59b)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x67087513e1815387), UINT64_C(0x69162658c6cfafd3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb424b523dc350850), UINT64_C(0x895601b44f164043)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb65bbe69b769fdbb), UINT64_C(0x3307eaf5092c0be2)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xc078307aeeccf5ef), UINT64_C(0x87a55626887ff0bb)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5e9498d0c7d06bfe), UINT64_C(0xe26f13f31c9ccac4)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xa9e7612a93b8001a), UINT64_C(0xfb8e1193f5ee0178)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xbbff0fce90736713), UINT64_C(0x9dc198b4e73a72b8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xca024ddb26d8db8b), UINT64_C(0x60d682354e8e1b14)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x43b37c6c647ea15b), UINT64_C(0x189b3cf9a3e114c5)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x98c270edccc867a7), UINT64_C(0xb7c94730cc965c66)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x24f9e5636b5f1b69), UINT64_C(0x39488d6a8ea0e0bc)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xfcf85323080d340c), UINT64_C(0x27e54f0174f3d657)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1bc726321827c370), UINT64_C(0xd7537268faac5048)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x2dacc75431a1f94b), UINT64_C(0x7639b98da80a9e55)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xb28496a23548d6ad), UINT64_C(0x8f869e66dd2c296b)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf417a57e03bb3e49), UINT64_C(0xaf92c67809587799)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x0a308f14e188f8e0), UINT64_C(0x897247ba77ad675e)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x13ed625f68af770e), UINT64_C(0x44efa7a61b623aa3)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x55a3b48274d4c334), UINT64_C(0xe12cfa19605242fb)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0xa333c909420e8ab5), UINT64_C(0x657c07d6be336403)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc93047234c4de5d6), UINT64_C(0x7b780cbf4c07ead3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x51ac85398627e852), UINT64_C(0x1c15fa55a1240b39)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x230e7f7b4007f1ec), UINT64_C(0xee75a2f9727444ce)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x5eae3206e11f5b74), UINT64_C(0x7aaac3a367c8f841)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xa03720340064f794), UINT64_C(0xf7dcfc9f72daf8e3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb82ae6d29e250fa5), UINT64_C(0x1edc0970b285c43f)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x528cf4268dfd07ac), UINT64_C(0x0b2089a3c3c32fbd)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x7d11c0f3b2a9b80c), UINT64_C(0x12cabcd2302305eb)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc981ff3dac5bb689), UINT64_C(0x643a32134125cad9)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb769db6071ee5689), UINT64_C(0xf78283122330a66a)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf24de6b05706cfe1), UINT64_C(0x19b1211a480d149f)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x15d0366997b2cd70), UINT64_C(0x571c3ffa889163cc)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd48719fff2ebea3c), UINT64_C(0x72126ff6836fa564)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb14a9fe641d223d7), UINT64_C(0xd1518055e472c9a0)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x09a4087c6f62f995), UINT64_C(0x92eb74879fd0c558)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x888509755bae48a5), UINT64_C(0x759d3beb39d9e949)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x14c3b4cea9f341d9), UINT64_C(0x85ccf427044ae688)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x43545978a199efac), UINT64_C(0xec62c13ac5a60909)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8fab6a41e2d7e7af), UINT64_C(0x0c2121fb14cd9ee6)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xea0f77b59df56cd6), UINT64_C(0xe8e2b47b641ae918)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf28cc18b9d5265af), UINT64_C(0x22f20e5c5257dec0)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xf86ccb9f92bd4eca), UINT64_C(0xa3a3a73cdcc04c56)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7511fb451318ea61), UINT64_C(0x5b941807a56204d3)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x645f6fa0d1b08df2), UINT64_C(0xa5a9cc44d949035d)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x16daaadaae1ca36a), UINT64_C(0x27fde43d5e8b679d)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xcce5954d38d8c404), UINT64_C(0x7b67a1c5ecc29059)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xaf256c7527d5abb0), UINT64_C(0xc171a8c1595c39df)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xbcdb12e966f323f7), UINT64_C(0xab2538acaee09103)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xaffd3890d3234470), UINT64_C(0xeb338b275d4f5176)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x5239d044fa4d6aaa), UINT64_C(0x77d399c5053875d5)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe45ea37e51c90666), UINT64_C(0x51cc35e6d8a8b24f)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x18dafe76f278487c), UINT64_C(0x095e3231c6181788)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7d69a2817c5370a8), UINT64_C(0xecbc0bafd560a2fb)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x3f2009752e7105d9), UINT64_C(0x8beae8bb1edfa3c4)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x743169e783219af5), UINT64_C(0x9e21177d5091964d)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x2e5df56fe2ee0187), UINT64_C(0xb1d533b3cfa7cc2b)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x944386d9275c3dc6), UINT64_C(0xc3b2692c6df0bab8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0xb64b12cdd0655712), UINT64_C(0x07393cd818bc14fb)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8a446c1e5b2806f8), UINT64_C(0xf75aea488b86b8e8)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x48ac2131efb451b5), UINT64_C(0x5bbecd9a43e686aa)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8fefec343ccff666), UINT64_C(0xf3ec4be1dd18739e)}}},
+  {{{ UINT64_C(0x0000000000000000), UINT64_C(0x984e93e9d67a972e), UINT64_C(0xc966fb4a66fcfc17)}},
+   {{ UINT64_C(0x0000000000000000), UINT64_C(0xab8040f469000ea1), UINT64_C(0x160dd8dd27caec57)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x6402056444789c71), UINT64_C(0x595a3b65e9bf0dac)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x92718d9b9388233b), UINT64_C(0x9c59e44013a7cf8c)}}},
+  {{{ UINT64_C(0x8000000000000000), UINT64_C(0x86dedc4eb3531030), UINT64_C(0x4c962c641f8a2d4f)}},
+   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3b2895e72d962416), UINT64_C(0xba44b0dacd949961)}}},
+};
+
+#endif
+
+static const mzd_row192_t Li_0[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xaa68c1a3b90ce23f), UINT64_C(0x390d3bf628c3281c)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3e16e3f5b4d14976), UINT64_C(0xae129d014e5b2722)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x92ee0b48d4c68651), UINT64_C(0x69b42ae2776cabf6)}},
@@ -663,7 +2239,7 @@ static const mzd_local_t Li_0[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8a93968b9e85e953), UINT64_C(0x7e6308ec418000d1)}},
 };
 
-static const mzd_local_t Li_1[] = {
+static const mzd_row192_t Li_1[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe390873b935ab614), UINT64_C(0x99052a360dbb3c5b)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd741e29d87212402), UINT64_C(0xed8d0faa94f3ee42)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xfe3f819e8263a40b), UINT64_C(0x8d8b02ddd2db3d89)}},
@@ -795,7 +2371,7 @@ static const mzd_local_t Li_1[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf334f71734319f74), UINT64_C(0x6d442b88128588c8)}},
 };
 
-static const mzd_local_t Li_2[] = {
+static const mzd_row192_t Li_2[] = {
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x758b0defdfe1ba98), UINT64_C(0xbc9942927463d1e2)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7723e37b3f0992e5), UINT64_C(0xb21b42f2b38b0ad8)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x46968ee43d962ca2), UINT64_C(0x448de814558a0703)}},
@@ -927,7 +2503,7 @@ static const mzd_local_t Li_2[] = {
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x93a293fd0831290e), UINT64_C(0x2addcace7a48918f)}},
 };
 
-static const mzd_local_t Li_3[] = {
+static const mzd_row192_t Li_3[] = {
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd783a3c1861644e4), UINT64_C(0x3c11b04f67e7de06)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x5aeb4b7a1ccd4a58), UINT64_C(0x6f322af332cd50e2)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf9fb965ca4ee3a0e), UINT64_C(0x61ec29c03abea9ea)}},
@@ -1059,8 +2635,7 @@ static const mzd_local_t Li_3[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xac5384ccdd2376a3), UINT64_C(0xde059ca550ba04f5)}},
 };
 
-
-static const mzd_local_t K_0[] = {
+static const mzd_row192_t K_0[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x6585136501694c07), UINT64_C(0x5fb02d5951af53c1)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xb536c15f6b3769b9), UINT64_C(0xe308a41b66b98477)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf8ff059e4fcd90d1), UINT64_C(0x73b6c7049d289ae9)}},
@@ -1069,787 +2644,1559 @@ static const mzd_local_t K_0[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x10a07e04c000ebb0), UINT64_C(0xc506ff5242b97f70)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe6adeb0e67f25322), UINT64_C(0x6aefe352d6165aad)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xfb951c632bbeadd7), UINT64_C(0x3cbb6b59e911f9ff)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2366333cdf9a049b), UINT64_C(0x013008f126988bdb)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcb0679e88218fb31), UINT64_C(0x070a6faa2b16dc11)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5300e88140cc46fb), UINT64_C(0x69a888b999b1b6e1)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5b659abd0281fa11), UINT64_C(0x7e53113e8c58b533)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0e90e89a48a83a35), UINT64_C(0xfc0661da7aa9f214)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa148ba3bef29238c), UINT64_C(0xbfa8ef0c33a07778)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf61f81b6dc48c83e), UINT64_C(0x86f7866415d782d8)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x080119db6ce02949), UINT64_C(0xc2c4408c50e47c95)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x548b69fb9a82583a), UINT64_C(0x04fea2df602643e0)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x524435026f2d1e30), UINT64_C(0x17efa7c5355f6694)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x54e84f27e27968bd), UINT64_C(0x7dad17bdc147816d)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x80077c47f4b300c3), UINT64_C(0xee37a1362356595e)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x73fe79d248c9e353), UINT64_C(0x37d4f609720b1589)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x561d1ecd3b6dab8e), UINT64_C(0x93d2c731cf010e45)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7a8cbe19760ef1fa), UINT64_C(0x53d9cad5ef939eda)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa03b36769c069122), UINT64_C(0xb270c1c43d49f645)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1f561334757ff763), UINT64_C(0xf2366a0ae24e9c30)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x859dbd1b9813398e), UINT64_C(0x6d0d71083129c7ad)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xef88375af9ec4099), UINT64_C(0xf362de02328f8e69)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcdaf7179a4a5edd9), UINT64_C(0x03db1d57dac977eb)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x539a47169e6104bd), UINT64_C(0x0d6639e31323049f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x751849156724f74b), UINT64_C(0x0b0f05cfccccff23)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb3453245da8eafff), UINT64_C(0xd66888ca09d3f85a)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x557822bce87f2982), UINT64_C(0x32320b5d82ed51c1)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf3f863b6967775e9), UINT64_C(0x1bf41d401140ec42)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x66fcf3f04d3ffe08), UINT64_C(0x2acbe34fd499f8a1)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7a4f13b44e0ecb95), UINT64_C(0xb555f0161a6fafe4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8c6a5d33d5202a63), UINT64_C(0x41ba1df70093c7a8)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfc2b7731f1e0e549), UINT64_C(0x75a62f12abef2d88)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1264996c0b32f7be), UINT64_C(0x64e8fa7829434fe3)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc478a859f384f8a5), UINT64_C(0x29767f11c8e3976c)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe62f1710260f5f18), UINT64_C(0x2e306aa753470995)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcddcb366db2298e4), UINT64_C(0x8b45bce77985b45b)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc599e3cdc22777bd), UINT64_C(0xccef63e2920a3707)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd42aab976ce26e67), UINT64_C(0x4603d71a4d4673d4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8351a1364787c521), UINT64_C(0xd998f34bad7e304d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfb82c4aba5d665c6), UINT64_C(0x4a41852dc25c9369)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x053053c7c487c65f), UINT64_C(0x5902a80099236a70)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5294b482404832b0), UINT64_C(0x4b5cfba391bd48ae)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0ee041c6a2449c63), UINT64_C(0x4971a37f4f719670)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x50e7ebe568a38485), UINT64_C(0xd0b7e301406b2e97)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1fdd82ad6f4a4a89), UINT64_C(0x3c5fad1bde94f2db)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa5dcfef7e44c51de), UINT64_C(0xdb7918c2135a5037)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3b52c08901c8c0d9), UINT64_C(0x7f90bbd518aa0746)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc853f87717794be9), UINT64_C(0x39da73faadac0150)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x85b7c84c98517dfa), UINT64_C(0xb523fa2d3e2ebeeb)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc95f70f8ab666533), UINT64_C(0xbe565b66a483f556)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xae934c639c0c846f), UINT64_C(0xa0d0d4cbf0055dc3)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x409e91468d45e891), UINT64_C(0x09ea684ceee8c47c)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5bd542ca3c848a57), UINT64_C(0xe0e84cf9cf7bc105)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x16f2bf38e23ecdeb), UINT64_C(0x009381a5b29425c1)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf6b2b47266b3f844), UINT64_C(0x22be5d1fe4f5a64a)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd7e4039e5fed5f75), UINT64_C(0xaaf13e02409ee5bd)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x71cb97a0fa15c715), UINT64_C(0x6f5e180137f90a3d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb0f8441afd466767), UINT64_C(0x1d088c4e8b1d1496)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe380c791bed60af0), UINT64_C(0xad83b1f7cd0b11e3)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x32b9ac0cc79eea5a), UINT64_C(0xbfcd7db7c2493ac7)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbf8567046a42e016), UINT64_C(0x3b26be598d52b1ec)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6035857722b9d359), UINT64_C(0x6d7a43e53c305676)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2b872cc0b13748d3), UINT64_C(0xb75add8c979d6f1b)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xedaba0fa1b9da6d3), UINT64_C(0x284502ca82e3155d)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcb526fc5d0ed84d4), UINT64_C(0x3c3495e9f2b8c942)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9fb3c911d184452a), UINT64_C(0x3dce4ede7b7b67b4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5880b9cdff1d3cb8), UINT64_C(0xa325c8b899b45d4a)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9e46a2ca143dfca1), UINT64_C(0x275fb09fe35e3547)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9967fa76160b803a), UINT64_C(0x8d8257ef3abe8d8b)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x617c351089226fd8), UINT64_C(0x3b6707186616ee33)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0f2b5b5ef450bfd0), UINT64_C(0x7b66439ca4eb8e19)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb9fa99c2d2deb74d), UINT64_C(0xa71ea77e01b2aca4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x820f51a2233ea244), UINT64_C(0x053051d9892436d9)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7543db3a5013c27), UINT64_C(0x2568246b0ca84893)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3abafbce2b04a32a), UINT64_C(0x135e02c3dc8c5259)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5db207d86c1a3f87), UINT64_C(0xc5715a6676e62134)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x36ca4db46546bb8a), UINT64_C(0xdfb741914c67b580)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1b0ef353eb188183), UINT64_C(0x51f0840c0004de90)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb76ea3394419df7a), UINT64_C(0x1ac1a98840dbbee7)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8b8315513e27393c), UINT64_C(0x6664653e9f11f902)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc75eceba7d4c9824), UINT64_C(0xac4aca1774a63cb4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3598483d757f5974), UINT64_C(0x1bff838c3654e54b)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6ceb6e9ff41839d8), UINT64_C(0x52781f2599af2720)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0c3572fa2473163c), UINT64_C(0x9d2797763eee6ff6)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x132379a7863cb131), UINT64_C(0x0a8a48babea05f83)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa0c2c8fb9eb22d3f), UINT64_C(0x04fb6ae35d469693)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x456deaa371d069a0), UINT64_C(0x5895a65ef2fb6b28)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x06fb11cd1e26fae8), UINT64_C(0xe0130168b63e861f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbee99727bcae999c), UINT64_C(0x1fc4854553d58e94)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7ff476e5986ff9c6), UINT64_C(0x68a408efb9c1471b)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa2c15c42d404e8b5), UINT64_C(0xf7886658635b0d98)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x589239c67ab35d75), UINT64_C(0x0b121c68d557c398)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x505bc55d924ac664), UINT64_C(0x6d0bbe258c381a18)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x60347849e145ac28), UINT64_C(0x81e398884ba7268e)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x219df4ab09430d3f), UINT64_C(0xa54e80a99e385499)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4873276bc6821160), UINT64_C(0xbf0b879b14ee5157)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0ccb81f714541804), UINT64_C(0xd4a757e5bd74908e)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xce4cbcbdb65b7543), UINT64_C(0xfca1a7522f67270c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7b4acd4b9d466d2), UINT64_C(0xa8f7a9ffa47a77f0)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x38710b820fd0b01c), UINT64_C(0x6fe3f2f0795721ac)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8e59d30ff1ff790f), UINT64_C(0xbb167eb2609202b8)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd2407a57512004a1), UINT64_C(0xfb37ac09560dc943)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xad7e7385d69c5892), UINT64_C(0x5011ee44b81f9387)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0538798ba38d729d), UINT64_C(0xb9b5cdd3a53d4583)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf5730b61d2f07dab), UINT64_C(0xb40aeb7722eae755)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x55389ef1a0551543), UINT64_C(0x926cf7b8c6914aa8)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf46207d7a2bd8804), UINT64_C(0xb4f6f4c9ad651d5c)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2cb9d3a1f2db5df7), UINT64_C(0x6daa01890103dfe5)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7d5a4b3f550ff2e8), UINT64_C(0x65b330e8bc3258b6)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf231936a6d521f47), UINT64_C(0xa65c48dae4c3d626)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6fe272179c3f25d1), UINT64_C(0x8315908ecd8edbc7)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x811c9d852999daaf), UINT64_C(0x1f45cf138bc8f934)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x35b7341e430bf776), UINT64_C(0x6f242268f52ea7c6)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x57fc45ae608b37f4), UINT64_C(0x3195a91508a2dd25)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbdef8e24f35e2f1d), UINT64_C(0x023c5dddac12a176)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb93a1279d3d77bb4), UINT64_C(0x4ab949a52b21e6b9)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x816bb5dff8cb4f55), UINT64_C(0x5289d691327420cd)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbf5fd49023a06b70), UINT64_C(0xa2bc1d841cc7a4dd)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6f3ea955b5f14489), UINT64_C(0x07c882c50fb440a0)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x269f55399313d54c), UINT64_C(0x882426f57d4961ae)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdb3a9c3841bafcef), UINT64_C(0xb057549b3695525d)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x86c8961e40ea3ac7), UINT64_C(0xbbdc8711189e3ad2)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf7f7254a6d4b610e), UINT64_C(0x5bb58c46e40343be)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3824d9fcd068f314), UINT64_C(0x5fd69ccbd2b322fb)}},
-};
-
-static const mzd_local_t K_1[] = {
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf5363757a219b4e9), UINT64_C(0xc9945ebdba4ddd30)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd31df2137100de97), UINT64_C(0x77c26116f7d25278)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3161a689d06e391d), UINT64_C(0xcb207af91bb451e0)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x71f6287713901099), UINT64_C(0x016a6a78f7aafb02)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfcaf5c3461f01c1e), UINT64_C(0x42f1593ef99ba2d8)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xff25c0019975a3bd), UINT64_C(0x5b4762914790ad2e)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xaf26d350e5c20f05), UINT64_C(0x270b1adc9ccdbeab)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4bf0944d301272d7), UINT64_C(0xbe01431af36a79b6)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb4fa159623104bd2), UINT64_C(0xd7e42c6bd5f77206)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2ab86858847d3ec7), UINT64_C(0xe010e903f4996c14)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8f9cdfcd4ee95985), UINT64_C(0x923d05cd20c6bd11)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3afd6fcf76718ea1), UINT64_C(0x63bf144ca1f59f8b)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc63c4e3da8f0cf74), UINT64_C(0x1112e92e384b6faf)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6bb4fcfb1d6c962a), UINT64_C(0xced0ce5dc62b0367)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4ad93665968f343e), UINT64_C(0x3e6f245d8a5e0c4a)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x46b04fafbae9e6be), UINT64_C(0xd0e9ecc3396e3dc7)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3622ca4489e25b83), UINT64_C(0xc3ab6eb1757c66e8)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7e8496f187fb3189), UINT64_C(0x0b583809933e3de1)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9fbc3b79d01650c3), UINT64_C(0xdad8847b159ac42f)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x035d4d3dc427795f), UINT64_C(0x4f4850901a30b2a4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf2f726e7dd8eec71), UINT64_C(0x43ebbdf191281f91)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4491d080168e7768), UINT64_C(0x3d6eef3bcb17e571)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x16e08719c85fc377), UINT64_C(0xafabe894f2841dec)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x90a6d88d8964af49), UINT64_C(0x98c0d6bfb34c5606)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x169248e3289c5c75), UINT64_C(0x3360e4fd445e897c)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd35840c12bf865fc), UINT64_C(0x58edc5f984dc21dc)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8e613ada07fbb9e6), UINT64_C(0xcef6ab5e5ea6d3a6)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xef4ea59338f19fc7), UINT64_C(0x921db55510e2a25d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x24340d58e6cb17be), UINT64_C(0x0114034b3946f7f1)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x10031a2a9f89b238), UINT64_C(0x09ec5347be5b9fa4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc92ac314f43ad9fc), UINT64_C(0xc401de26dbab7209)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x772973ecbc1c1830), UINT64_C(0xd3d34c74b7e5139d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa9ee2ea0e7e6a89b), UINT64_C(0x34e074d5f1452e56)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6145c6a99e729157), UINT64_C(0x3cd0db1c42c166fa)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5906d211b3333a58), UINT64_C(0xe7fa501ca5d46686)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8d466f70a1232b61), UINT64_C(0x12618e03d5fb02ff)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc730f1e8065b1cd8), UINT64_C(0xc5e783dd95ad1af2)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2edbfdd1d2b031e9), UINT64_C(0x9e17fec22d84ecc4)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x472760f18d4d682e), UINT64_C(0xe20baf1459353f40)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x62d523cdb4566fcc), UINT64_C(0x61becb0b5dde0387)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x04b7718ef09cfdba), UINT64_C(0x68ba55cd5fb1cd0d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xee5da9eef353626f), UINT64_C(0xa1dab56767368f13)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x32cdd83ea5d08f69), UINT64_C(0x354114837134c693)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x026466686e8a9cef), UINT64_C(0xe2f0fe00d8b7c38f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x674eb66501d8a527), UINT64_C(0xf446f64a78c502fc)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x240fed9fed3d7a41), UINT64_C(0xbfbf60a97a7b877f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5692fdf9811232bb), UINT64_C(0xffd341c33435889f)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x63eec18d2b91f8d3), UINT64_C(0x56b8b8ce73868f38)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfb5516aa9c9a942f), UINT64_C(0xf75c442966a64d86)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6f84adbca591ecf2), UINT64_C(0x589d988b5660df15)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc81523de3ba5dd18), UINT64_C(0xd1c150fbe1c65011)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x56f0ab0106241d42), UINT64_C(0xee19475812e54bc1)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4278dd3bc3fc3045), UINT64_C(0xd834e80cfec32f97)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x00b26dea0e44fc93), UINT64_C(0xcd1a7212fbd031c6)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8eabc48d6e526641), UINT64_C(0xae27bf27ff090f82)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0f9b5e88c067c2d9), UINT64_C(0x51019a6f9601e331)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x162fc75c0da0920c), UINT64_C(0x3b527686d91f3beb)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1855595a16745622), UINT64_C(0xbb16ec66fd07322b)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xde3c673fe0593363), UINT64_C(0x3cc1f1d36addd2bd)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x47e8b4357790f29d), UINT64_C(0x28bfb7674388f007)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x44df4c4b305ab0ca), UINT64_C(0x5c80a85c4945185d)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfffaa05d20512d37), UINT64_C(0x2a0adcc1ba895b4f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbcaca0d8ce6df571), UINT64_C(0xa9c65d397e9e6ac5)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8e37c97289115fbe), UINT64_C(0xf1a006eb93b7898b)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb0ac1a6827f69d38), UINT64_C(0x7e93d0fd98c1ff31)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x47ab05e9640807c9), UINT64_C(0xbce9f852ecb46782)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf63c72e84d1c06ac), UINT64_C(0x7e8e8affac966729)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe7f2239bb0485313), UINT64_C(0x1e0724ad61ed6a13)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbef5aa8c48488f09), UINT64_C(0xaf8ebf7490f8c7b3)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x876e840acd57d672), UINT64_C(0x0e1dd2a1f3b66e1e)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x62995e51db834ebc), UINT64_C(0xb49ac5801dc1ba1d)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfeeff53b4295b21f), UINT64_C(0x0aea6e194f8df5f9)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xde88957a63c285ec), UINT64_C(0x8315c094b30186a3)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x74da2f153431e136), UINT64_C(0x9e8a537afdf27340)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6943477d3b5421e9), UINT64_C(0x56c78b5670a9d449)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x277b04efdf4bf3e6), UINT64_C(0xcab0f189a6f70370)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x51d716258c09ee47), UINT64_C(0x534973bbd9e72bf6)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x119c2ed13b30b8a2), UINT64_C(0x69ebaa5c7284d94d)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9e6998f475db380f), UINT64_C(0x9c9b52426ebe7397)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc3210b19141f177f), UINT64_C(0x4153f3c5f6d2db81)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x29296b385286df59), UINT64_C(0x139596b347392417)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x93402d7bd6760fff), UINT64_C(0xde1238b6b3fdeeee)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa6e1a7e1a5acfa6a), UINT64_C(0x1cc1a374ccb99270)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x02ae83a7fd5fd149), UINT64_C(0xf1de89ad251935b0)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xec772d121364927b), UINT64_C(0x925cb8511a409128)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x355a5ba624bc0814), UINT64_C(0xdfd5c1abc07d7829)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9cb0ba11678ebfc6), UINT64_C(0x6e409d630460e1e6)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x041bdd49d9a8dc42), UINT64_C(0x72efc576dc7a9bf8)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x70841bbb21d21f39), UINT64_C(0xd8731535cb1810bd)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbe6f76faec213844), UINT64_C(0xf5839c79ac403dcc)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb9aa440704a5110e), UINT64_C(0xda62db507ed08de2)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7c490eae0da156fe), UINT64_C(0xc637f4dac0e1909b)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0c6b09abc53fa86d), UINT64_C(0xcb2897040f317e45)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4a6ff134e2513b65), UINT64_C(0x55216153ccd5420b)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x44f705223b38d400), UINT64_C(0xfddb4d8c5ec2a620)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x35e10890b08dbfd6), UINT64_C(0x1600edcb9ad57177)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2fb474e4e4018d49), UINT64_C(0x087c5eacfa9d7625)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcc02cb336c6dcb51), UINT64_C(0xbaf7ef5060ab3691)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2a7cd66e5c242379), UINT64_C(0x958a03620fbed86f)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x29a2ca09e04b8a1d), UINT64_C(0x55a3183d75cccff9)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7b64ab8c0ec73451), UINT64_C(0x3fcce79fe9a5732e)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2950a5be2145793), UINT64_C(0x2c62f89210b25565)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x98081ae203e19ce0), UINT64_C(0xb97a2a4286207af6)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x695aaaecce0c36f2), UINT64_C(0x5b77b2c17c95ada4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x531b5cd92cdedeed), UINT64_C(0x1afc676ca91210fe)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7a5fd571d63802bf), UINT64_C(0x58301cf6ca974ed3)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc7334b16712d348d), UINT64_C(0x52f0aa71d0d0f2df)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9c511954b5cc9785), UINT64_C(0xd89d3d993d914979)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xacae6ebe469aaa9e), UINT64_C(0xbeb97458dcd15732)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd9321f1572cf69e), UINT64_C(0x12e856a8cfd21f1e)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa6e6684b3298e0e9), UINT64_C(0x52a37bd1a933f62c)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x73ab7f0dbf22e6c3), UINT64_C(0x4aa39fe6b85c07c7)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x33dd18c0feed877e), UINT64_C(0xa98cfaa94bbd21ae)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe29ee2e2c9bd17dc), UINT64_C(0x9453d72f392d6eae)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x275e9cd936d73826), UINT64_C(0x49dbe0da4c6f0d29)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x75cab49bb66b26f7), UINT64_C(0x190504c92ee7b837)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x813ce6dca91bbd40), UINT64_C(0xec32e2bc3b0bced9)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf5e74afded28ec4d), UINT64_C(0x3a5b954e3f35106e)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7b5ea07625f86d1c), UINT64_C(0x29df6a1c902a3a2e)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb318c5d0282fb3cc), UINT64_C(0x96f515a4a2b2fb2a)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8f57076415969f3b), UINT64_C(0xcf0205928d92d604)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4dd880920753ad33), UINT64_C(0x4ea860b1b7787fd2)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb95e8cfa0ca87d48), UINT64_C(0x4936a0cc6f45426d)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb6fb0371a2b3f8c8), UINT64_C(0x0a12103972845439)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa9c33ee3ec23b789), UINT64_C(0xd16c2f0964df706c)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe28bedb010b5339b), UINT64_C(0xce8f043efac64549)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9e91d438faa9b77d), UINT64_C(0xcc811c1bf8f92916)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2ac2746489f18de2), UINT64_C(0x6b3f969dea1627c5)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf5c728d2ad4abed9), UINT64_C(0x6c3faf85da3ac0a5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2366333cdf9a049b), UINT64_C(0x013008f126988bdb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcb0679e88218fb31), UINT64_C(0x070a6faa2b16dc11)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5300e88140cc46fb), UINT64_C(0x69a888b999b1b6e1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5b659abd0281fa11), UINT64_C(0x7e53113e8c58b533)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0e90e89a48a83a35), UINT64_C(0xfc0661da7aa9f214)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa148ba3bef29238c), UINT64_C(0xbfa8ef0c33a07778)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf61f81b6dc48c83e), UINT64_C(0x86f7866415d782d8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x080119db6ce02949), UINT64_C(0xc2c4408c50e47c95)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x548b69fb9a82583a), UINT64_C(0x04fea2df602643e0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x524435026f2d1e30), UINT64_C(0x17efa7c5355f6694)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x54e84f27e27968bd), UINT64_C(0x7dad17bdc147816d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x80077c47f4b300c3), UINT64_C(0xee37a1362356595e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x73fe79d248c9e353), UINT64_C(0x37d4f609720b1589)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x561d1ecd3b6dab8e), UINT64_C(0x93d2c731cf010e45)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7a8cbe19760ef1fa), UINT64_C(0x53d9cad5ef939eda)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa03b36769c069122), UINT64_C(0xb270c1c43d49f645)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1f561334757ff763), UINT64_C(0xf2366a0ae24e9c30)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x859dbd1b9813398e), UINT64_C(0x6d0d71083129c7ad)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xef88375af9ec4099), UINT64_C(0xf362de02328f8e69)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcdaf7179a4a5edd9), UINT64_C(0x03db1d57dac977eb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x539a47169e6104bd), UINT64_C(0x0d6639e31323049f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x751849156724f74b), UINT64_C(0x0b0f05cfccccff23)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb3453245da8eafff), UINT64_C(0xd66888ca09d3f85a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x557822bce87f2982), UINT64_C(0x32320b5d82ed51c1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf3f863b6967775e9), UINT64_C(0x1bf41d401140ec42)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x66fcf3f04d3ffe08), UINT64_C(0x2acbe34fd499f8a1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7a4f13b44e0ecb95), UINT64_C(0xb555f0161a6fafe4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8c6a5d33d5202a63), UINT64_C(0x41ba1df70093c7a8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfc2b7731f1e0e549), UINT64_C(0x75a62f12abef2d88)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1264996c0b32f7be), UINT64_C(0x64e8fa7829434fe3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc478a859f384f8a5), UINT64_C(0x29767f11c8e3976c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe62f1710260f5f18), UINT64_C(0x2e306aa753470995)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcddcb366db2298e4), UINT64_C(0x8b45bce77985b45b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc599e3cdc22777bd), UINT64_C(0xccef63e2920a3707)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd42aab976ce26e67), UINT64_C(0x4603d71a4d4673d4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8351a1364787c521), UINT64_C(0xd998f34bad7e304d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfb82c4aba5d665c6), UINT64_C(0x4a41852dc25c9369)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x053053c7c487c65f), UINT64_C(0x5902a80099236a70)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5294b482404832b0), UINT64_C(0x4b5cfba391bd48ae)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0ee041c6a2449c63), UINT64_C(0x4971a37f4f719670)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x50e7ebe568a38485), UINT64_C(0xd0b7e301406b2e97)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1fdd82ad6f4a4a89), UINT64_C(0x3c5fad1bde94f2db)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa5dcfef7e44c51de), UINT64_C(0xdb7918c2135a5037)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3b52c08901c8c0d9), UINT64_C(0x7f90bbd518aa0746)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc853f87717794be9), UINT64_C(0x39da73faadac0150)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x85b7c84c98517dfa), UINT64_C(0xb523fa2d3e2ebeeb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc95f70f8ab666533), UINT64_C(0xbe565b66a483f556)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xae934c639c0c846f), UINT64_C(0xa0d0d4cbf0055dc3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x409e91468d45e891), UINT64_C(0x09ea684ceee8c47c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5bd542ca3c848a57), UINT64_C(0xe0e84cf9cf7bc105)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x16f2bf38e23ecdeb), UINT64_C(0x009381a5b29425c1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf6b2b47266b3f844), UINT64_C(0x22be5d1fe4f5a64a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd7e4039e5fed5f75), UINT64_C(0xaaf13e02409ee5bd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x71cb97a0fa15c715), UINT64_C(0x6f5e180137f90a3d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb0f8441afd466767), UINT64_C(0x1d088c4e8b1d1496)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe380c791bed60af0), UINT64_C(0xad83b1f7cd0b11e3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x32b9ac0cc79eea5a), UINT64_C(0xbfcd7db7c2493ac7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbf8567046a42e016), UINT64_C(0x3b26be598d52b1ec)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6035857722b9d359), UINT64_C(0x6d7a43e53c305676)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2b872cc0b13748d3), UINT64_C(0xb75add8c979d6f1b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xedaba0fa1b9da6d3), UINT64_C(0x284502ca82e3155d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcb526fc5d0ed84d4), UINT64_C(0x3c3495e9f2b8c942)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9fb3c911d184452a), UINT64_C(0x3dce4ede7b7b67b4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5880b9cdff1d3cb8), UINT64_C(0xa325c8b899b45d4a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9e46a2ca143dfca1), UINT64_C(0x275fb09fe35e3547)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9967fa76160b803a), UINT64_C(0x8d8257ef3abe8d8b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x617c351089226fd8), UINT64_C(0x3b6707186616ee33)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0f2b5b5ef450bfd0), UINT64_C(0x7b66439ca4eb8e19)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb9fa99c2d2deb74d), UINT64_C(0xa71ea77e01b2aca4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x820f51a2233ea244), UINT64_C(0x053051d9892436d9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7543db3a5013c27), UINT64_C(0x2568246b0ca84893)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3abafbce2b04a32a), UINT64_C(0x135e02c3dc8c5259)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5db207d86c1a3f87), UINT64_C(0xc5715a6676e62134)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x36ca4db46546bb8a), UINT64_C(0xdfb741914c67b580)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1b0ef353eb188183), UINT64_C(0x51f0840c0004de90)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb76ea3394419df7a), UINT64_C(0x1ac1a98840dbbee7)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8b8315513e27393c), UINT64_C(0x6664653e9f11f902)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc75eceba7d4c9824), UINT64_C(0xac4aca1774a63cb4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3598483d757f5974), UINT64_C(0x1bff838c3654e54b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6ceb6e9ff41839d8), UINT64_C(0x52781f2599af2720)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0c3572fa2473163c), UINT64_C(0x9d2797763eee6ff6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x132379a7863cb131), UINT64_C(0x0a8a48babea05f83)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa0c2c8fb9eb22d3f), UINT64_C(0x04fb6ae35d469693)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x456deaa371d069a0), UINT64_C(0x5895a65ef2fb6b28)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x06fb11cd1e26fae8), UINT64_C(0xe0130168b63e861f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbee99727bcae999c), UINT64_C(0x1fc4854553d58e94)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7ff476e5986ff9c6), UINT64_C(0x68a408efb9c1471b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa2c15c42d404e8b5), UINT64_C(0xf7886658635b0d98)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x589239c67ab35d75), UINT64_C(0x0b121c68d557c398)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x505bc55d924ac664), UINT64_C(0x6d0bbe258c381a18)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x60347849e145ac28), UINT64_C(0x81e398884ba7268e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x219df4ab09430d3f), UINT64_C(0xa54e80a99e385499)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4873276bc6821160), UINT64_C(0xbf0b879b14ee5157)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0ccb81f714541804), UINT64_C(0xd4a757e5bd74908e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xce4cbcbdb65b7543), UINT64_C(0xfca1a7522f67270c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7b4acd4b9d466d2), UINT64_C(0xa8f7a9ffa47a77f0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x38710b820fd0b01c), UINT64_C(0x6fe3f2f0795721ac)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8e59d30ff1ff790f), UINT64_C(0xbb167eb2609202b8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd2407a57512004a1), UINT64_C(0xfb37ac09560dc943)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xad7e7385d69c5892), UINT64_C(0x5011ee44b81f9387)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0538798ba38d729d), UINT64_C(0xb9b5cdd3a53d4583)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf5730b61d2f07dab), UINT64_C(0xb40aeb7722eae755)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x55389ef1a0551543), UINT64_C(0x926cf7b8c6914aa8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf46207d7a2bd8804), UINT64_C(0xb4f6f4c9ad651d5c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2cb9d3a1f2db5df7), UINT64_C(0x6daa01890103dfe5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7d5a4b3f550ff2e8), UINT64_C(0x65b330e8bc3258b6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf231936a6d521f47), UINT64_C(0xa65c48dae4c3d626)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6fe272179c3f25d1), UINT64_C(0x8315908ecd8edbc7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x811c9d852999daaf), UINT64_C(0x1f45cf138bc8f934)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x35b7341e430bf776), UINT64_C(0x6f242268f52ea7c6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x57fc45ae608b37f4), UINT64_C(0x3195a91508a2dd25)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbdef8e24f35e2f1d), UINT64_C(0x023c5dddac12a176)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb93a1279d3d77bb4), UINT64_C(0x4ab949a52b21e6b9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x816bb5dff8cb4f55), UINT64_C(0x5289d691327420cd)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbf5fd49023a06b70), UINT64_C(0xa2bc1d841cc7a4dd)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6f3ea955b5f14489), UINT64_C(0x07c882c50fb440a0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x269f55399313d54c), UINT64_C(0x882426f57d4961ae)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdb3a9c3841bafcef), UINT64_C(0xb057549b3695525d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x86c8961e40ea3ac7), UINT64_C(0xbbdc8711189e3ad2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf7f7254a6d4b610e), UINT64_C(0x5bb58c46e40343be)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3824d9fcd068f314), UINT64_C(0x5fd69ccbd2b322fb)}},
 };
 
-static const mzd_local_t K_2[] = {
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7f2159388c3c2fca), UINT64_C(0x17b2916a7cc31c81)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf0a6d3b11fb5b6a7), UINT64_C(0x403a98c4b63f2797)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x010d47e2bce4fbd1), UINT64_C(0x530b4df986d3640d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc2de6a195423c2b8), UINT64_C(0x0a35adbd108a35a9)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6dc9487872bbc668), UINT64_C(0xd086f00d36728b3d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8532d941e2d6b0f4), UINT64_C(0x4c11225eaf89082c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6518108854bd3591), UINT64_C(0xfee30d28da6cce58)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x13e611db0599385e), UINT64_C(0xbb3d83800b6052e2)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4bb99b73c10a5c92), UINT64_C(0xde5dc90c3531b412)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x19f167f1352d3837), UINT64_C(0x17ac10a7569c22bf)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6cb4a56970c55d10), UINT64_C(0xd7fa82da03e49e2b)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9d114b96fa10e6ca), UINT64_C(0xa3a77ee60bdf189c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x77fda1f26c939042), UINT64_C(0xc4ed44592516b8f6)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa946c240e502aeab), UINT64_C(0x13d3f412c449a6b0)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x97ae1bcb54693685), UINT64_C(0x42805a8d7165ba38)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6a5c6e001c0ff70b), UINT64_C(0xda8ffc730b317a5a)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7862c9aaaa94a827), UINT64_C(0x865b7f3e9dba2476)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0df4ecd758ed28ef), UINT64_C(0xccbed33c2b24649d)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x22d402bf73d3ecd0), UINT64_C(0x574f9ed8e6f28bf0)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9e3f6b57233820e2), UINT64_C(0x16233a9d0e95fc1f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x762bd3e449abecb0), UINT64_C(0xe7a2353c6a554246)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x15b77737c12fcce0), UINT64_C(0x3eec754b1193bbf6)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc333f0b41e585b87), UINT64_C(0xc64caa762deb6682)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc4e94d33b2851a18), UINT64_C(0x38c228fb602de03f)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd3dd64f74bd8e1fe), UINT64_C(0xb4a04c587f55f066)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd6298099b7bf438d), UINT64_C(0x7f055162ae088782)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb1aa1f5aab57bac6), UINT64_C(0x3f7353cf633c2174)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x63900cfea288085b), UINT64_C(0x9801482d9017c36e)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa24125c0ecb5cc97), UINT64_C(0xda0b34abf1bf4501)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbf51d9d0120c585f), UINT64_C(0xf8d007af1161bc92)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xddf3f8470d2b2dbd), UINT64_C(0x35c48b7de9837936)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9d58038b2f21ec89), UINT64_C(0x8bce64f7d8a7a3a3)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x95fd5bc23c131f2f), UINT64_C(0xc97ed9d52b4d82b4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1b120f9124ddd4a7), UINT64_C(0x8830657160ef30bc)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9187768c164a2171), UINT64_C(0x9b994ddb760a5fe5)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2253b6eaf0364b3f), UINT64_C(0x0eb6e406a550a4db)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe340b87c98fbd2cb), UINT64_C(0x78e06a352ab92757)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe65a2ae5b06ac6ee), UINT64_C(0x45a0cd068a7060f8)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfe8c7c5fdcff83c0), UINT64_C(0x948466d8cb73dd34)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xec0e31d912fd4496), UINT64_C(0xc8ae977f8e7add1b)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x37c70823d9362b45), UINT64_C(0xa777af814fcc5b3c)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x58f8a6a3345a2a65), UINT64_C(0xcdbda914441c8bd9)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x21d4defa413f3a36), UINT64_C(0xc8ee1d8ff8103618)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9eb238f077a4ac65), UINT64_C(0x4e535391595366a0)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0180e66e53197078), UINT64_C(0xf94080e3d84fbf30)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa03fb48750308faf), UINT64_C(0xcc43c14834156ce4)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4ba2324571535b4f), UINT64_C(0x8ea4ae9e22be5334)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x14a1c991ec89e53f), UINT64_C(0x7f81eac16a14efb2)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7635afa9bd8d4e3d), UINT64_C(0x6b8bc394223ae57c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xce49f96ec01c4200), UINT64_C(0x1d822475e76ceb69)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xec76316136c4bfb2), UINT64_C(0xc50b6f0145888f1d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeba754134fc1c80a), UINT64_C(0x6a12ad8b336e4cbb)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcd64e03a831f9ebe), UINT64_C(0x2f7375067cfe7b75)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2c89c0761609b699), UINT64_C(0xf666bbcbb76b4a7d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x81c392e75ba19bf0), UINT64_C(0x87257f783a6e7d74)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0f1d5efa3a1cec64), UINT64_C(0x0cea4a1ad02f7ab0)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb2eab7f37c36b580), UINT64_C(0x5d472ae0343d5594)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4b0d4811712a3ad5), UINT64_C(0x33c348277da3def9)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x01b03bb8c31fa104), UINT64_C(0x0c7c921e1d845b90)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9f28c7b6abac7401), UINT64_C(0x48ee467a631c8912)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5927e5a5b7a6335f), UINT64_C(0x4bd5e43436f5939f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd3f319d2af86c83a), UINT64_C(0x222c57e6b90cc593)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5e2d8fa983ffc9a9), UINT64_C(0xfd4e725226fdfc24)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdbbcd36722bb4278), UINT64_C(0x2c26a61501c4901a)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0e5ec2d9fd4db010), UINT64_C(0xcd3c4ae7063205ee)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd353079865eed7f7), UINT64_C(0x95c95d633752fcf7)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1d38386cb17fdf45), UINT64_C(0x02730555e814e864)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7bd6846d37ed3a58), UINT64_C(0x072e893d98600920)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd040258ae0df2a4), UINT64_C(0xa7ff124a3db7af64)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x32059cc665dc94e3), UINT64_C(0x3ed557668966e299)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6f78c6175ab1dc47), UINT64_C(0xf49fae03250bb2fb)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7d780c6e35391ca), UINT64_C(0x3c47f6c2b5bc181c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1904a1ef247bda7d), UINT64_C(0xe9cb0e6bef1fee0c)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x683f5145cd922318), UINT64_C(0x4c821d25b3fd660b)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4051999abaf71121), UINT64_C(0xceec0d669c4758bf)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc8e22e60971727e0), UINT64_C(0x861bececa88f7531)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x72ed6f9fabf9a4a7), UINT64_C(0x01dede6bfabcacf1)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeed13abada61ea3d), UINT64_C(0x77ed27bc971ae398)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x32bd3ddb16c8b18c), UINT64_C(0xd7e369587e3db042)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2f76d56efa9dce79), UINT64_C(0x8a771341b289ec71)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1ead8d42373de729), UINT64_C(0xdf6576ffe4459f06)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x547e5cf665d9bb8d), UINT64_C(0x449d5590fc919569)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd2aeafd827102349), UINT64_C(0x7592b5a8ae750a9f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2d473e41950e679), UINT64_C(0x209711732ddd9b82)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x87444af100895642), UINT64_C(0x7d5109f42d398fda)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x462a1af2cb1f8d60), UINT64_C(0x94b6e5f5942c2e03)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbb8e83f1230a3d6d), UINT64_C(0x15ad37937f16a15a)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x69cf97d4ef82e429), UINT64_C(0xd642ee9b62345531)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x72dfc9adbc3bcb48), UINT64_C(0xc3970a2e580bfbd3)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd5ec7eda783e0865), UINT64_C(0x6d4e367d9dc73c00)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8e7d25d30e038d55), UINT64_C(0xc79ba3e5340e6a87)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xab814f449f4e4b4a), UINT64_C(0xd881bb3f93318b8e)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x53d07eff9cb60c2b), UINT64_C(0x72e5c2d63a891911)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9cec7b2d0a84f419), UINT64_C(0xd0610e93bb975b62)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdb6644b83881e1c1), UINT64_C(0xff89bf2f2ee08023)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1bf59750a391fc0a), UINT64_C(0xfbda9bd00475ff20)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb175add2f5a59e3d), UINT64_C(0x9893f96afe158513)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3870d9e189de656e), UINT64_C(0xe7ec4ca2dcd056a3)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc4d69a45201223de), UINT64_C(0x491382e15a4b8bbe)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdd5c7d9ef4330e06), UINT64_C(0x912c40eb6ba63a45)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x78065d80b726de13), UINT64_C(0x0478c9d8985cf51e)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2973c31efd62c7a5), UINT64_C(0x043a3750e3d07026)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7aa00d4f9a15ace1), UINT64_C(0x853b23046ef3a9c2)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9357f223e2601b61), UINT64_C(0xe97e496db3098b12)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1606d42ca7fe48c0), UINT64_C(0xd405aac270a20989)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3590d5df1fca0ee7), UINT64_C(0xcf8f61d826fae0f7)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8646b5aff9202dfd), UINT64_C(0x359177c9239b9d8e)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc9a95df9d95b53d8), UINT64_C(0x18ca7e0353bad20d)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc8498aaa16ea2850), UINT64_C(0x2e1f7785bd13374b)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x547d2371cc6479bc), UINT64_C(0x95ca4edff944a74b)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe32cbd2c6519e208), UINT64_C(0x2d6c7c2f31f26363)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa81be0c1b3554dfa), UINT64_C(0x10cd983edfbe097c)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x420889eacf7d7ed8), UINT64_C(0x4d507dc4c2eec492)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd511ba8ab97632d8), UINT64_C(0x728a166c6de808a4)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc706e0a0b253a243), UINT64_C(0xfb5ef02eea38009d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x50e893ef58a01c4c), UINT64_C(0xa39f96838c981c39)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd5facb894c7f14f9), UINT64_C(0x6850101550e9ad50)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe9ef0f8ac1fdabd1), UINT64_C(0xfe286f6f815b9d0a)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x20e9d63905c3a860), UINT64_C(0xb96e9ac36bee6812)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6f366b798653f4a1), UINT64_C(0xcb4ae427d86b0eab)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x95d11115e166a5df), UINT64_C(0xfb04a9e2e1cee39a)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x06242522eb6e180c), UINT64_C(0x1d3220e913a763fc)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x84040e19ff6bf076), UINT64_C(0x3c13f0792eb17858)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4969a232155ccca8), UINT64_C(0x74005ffe9e1eb871)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x78befb9d1b4e5bab), UINT64_C(0x050d7ddcf721b436)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcf8571ed69ad822c), UINT64_C(0x4a325b2e4c6e3147)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe701464093cb4fad), UINT64_C(0x333058cfaf0abd79)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x613d055804f976e2), UINT64_C(0xb97fa8e32df79ca4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd2aa3ca2c60e019d), UINT64_C(0xdd5b6a2d01f0235a)}},
+static const mzd_row192_t Ki_0[] = {
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc663d551326dc293), UINT64_C(0xa4b800062f864c9f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0712deac83196b08), UINT64_C(0x6707556ec3678686)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1f0a9e854ddd8043), UINT64_C(0xdcdc0bcbe41a8a6c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9313e416f221dfde), UINT64_C(0xe881b460765a2ba3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc082c2b09a6f672c), UINT64_C(0xdcf5cc6e02a1d1f8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc33fc7d9ab670654), UINT64_C(0x5d5a690bb4ae9f2b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x928cb2c12bd1e337), UINT64_C(0x9485ec9c647861a5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd28dbad403608263), UINT64_C(0xbf32f5cf2d777e1b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x32a9a44e4f4bdb30), UINT64_C(0xc38ba07ece4d9f4a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3acdb8ed8f0135d3), UINT64_C(0x51abba12352bd6da)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x71128caa43dad442), UINT64_C(0x151c47deeb2f4205)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc8cd500ed5b7c52a), UINT64_C(0x384b5b395f18521f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdec7b2d11abc0b07), UINT64_C(0x3a3030a4d73f53da)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x49612d8c358aa655), UINT64_C(0x677f9d57e741826a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3e16389ced2b84d9), UINT64_C(0x7382cca354d83123)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9ef72538abe983c5), UINT64_C(0xb4c61a2146cb4b3b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0a642ec00705593c), UINT64_C(0x8b33d064321269c9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x191904be4ca9a6c8), UINT64_C(0x27de86b2ef1fcd00)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x60a7dcbf8c19735a), UINT64_C(0xbe2b277f0312fedf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x862a8873b288a92f), UINT64_C(0x6376eff27c03980b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2f52e9d6748d15c), UINT64_C(0x1626bf0d98b9d47e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd1e4c87cf7e3a8fb), UINT64_C(0x46c8262696b08bc5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xddf11814a27a6b0a), UINT64_C(0xef4a8324e3b76004)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x92c33a10c020fcbd), UINT64_C(0xa8231b7c3c5b1355)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcd26c3bd86423766), UINT64_C(0xe35a38878c79b7a3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb60c8c146c5cb0b9), UINT64_C(0xce0467c55cf62b17)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x25e7b953cf55e524), UINT64_C(0x9a0ae455d1d0f239)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe1d4758114b89a02), UINT64_C(0x3b4a351abc2a1af8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x14f5ce5ca778e743), UINT64_C(0x110518895b585f0b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb56a21ede7aa187a), UINT64_C(0x5e4894c31e7b11dc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xff7d030c0fedcba7), UINT64_C(0xaa0d81d705cfc052)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7e7cbc32b3a8e959), UINT64_C(0x94e7b534e155917b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xafb9d40df957f153), UINT64_C(0x088a1e8bd0338648)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbca10eb6dea3fe7e), UINT64_C(0x66d838397abf2875)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf43e9bd91bb3f2ba), UINT64_C(0x0d4645ce4657da44)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe6d3558613926aa1), UINT64_C(0xe5708b5e26488a37)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xced3f8f2872622c5), UINT64_C(0xc212b9b5e11a4be4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5ab2b055f226d89e), UINT64_C(0xe8f79a4030584357)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xba1ba314a59e209a), UINT64_C(0x9500719e1abe214c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa14fdcb9ec9dee95), UINT64_C(0xdc83a19a130535aa)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x604e2bdda6c01952), UINT64_C(0xad04bf5a53c429ff)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0986b31e2df7a4ca), UINT64_C(0x97e617d0a9a71d3c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xff1bf1145d76ea36), UINT64_C(0x3b95d53a77c7f9f2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6ef1a0922f05f942), UINT64_C(0x2285ba913fff78ec)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x697ace3b45e47c9f), UINT64_C(0xd5621c50ee7577c2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbd58bd1e3e281694), UINT64_C(0x455fa7ee36c44fe7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa734f3f251277d55), UINT64_C(0xc0a0df01662e81d3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xead61f4af6e604a3), UINT64_C(0xe40b15d8526c64d3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd89e83ce84c39c22), UINT64_C(0x25e8fb41b2c42c06)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xac60128db4238b3b), UINT64_C(0xd2b954066062e2dd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf27851663e6e2039), UINT64_C(0xd103e3becd07b771)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x044364716fcf7c20), UINT64_C(0x07afc417919b42b2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfa003b53b93ba4a4), UINT64_C(0x9022bfabf88e79af)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3d55c5c4bbc2adec), UINT64_C(0x2a1c148f82ee7178)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xebbc8494b1626f73), UINT64_C(0x3a8e5f2f4651af95)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfbdf338767380d28), UINT64_C(0x84d6ea032a617420)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc8ccd8e45a511c30), UINT64_C(0xb34bf894f3fe7a75)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe7a6185b6bf869b2), UINT64_C(0xc7e6b3c6312a8f92)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfb3393a935316554), UINT64_C(0x5454932a9b8e6063)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x24229e8f97825871), UINT64_C(0x0649d45a4454331f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe91ee4b97682e14b), UINT64_C(0x19c91ad550d8a815)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6d302c37fc3a740f), UINT64_C(0x9f1737066b80cea3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x20bf33226c380bbb), UINT64_C(0x26e9a4fc04878ee2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd73d0541708381b3), UINT64_C(0x25fd4c808cca0941)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x07bc42b80b865a22), UINT64_C(0x8cfa1b1e39106f64)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xea63c330db607a3d), UINT64_C(0x4514dbefb3c734dc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xac35603f6703327a), UINT64_C(0xefbccd0f5a0c72d1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xde9ba85eaa752698), UINT64_C(0x7cb726a6e0c4c5bf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1583f944ee482b2d), UINT64_C(0x2edbef90cc016ec0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe9ace5594981d96f), UINT64_C(0xd22f89bcb7f64f57)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf023adaf19d84bd4), UINT64_C(0x288a8e4b83da60f0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4b86ed81f0703eaa), UINT64_C(0xf05c542af2e1bb17)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8c18a6ba92e985e9), UINT64_C(0x6e0c4ecf30bc69bf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x203fe264b0ba9a1b), UINT64_C(0x5fdee0bfc31263ae)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x966c5be3a8f2b6b1), UINT64_C(0x4661ca96b7a9ba94)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x53c756e23381363b), UINT64_C(0x9155e8e263d6dbb6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x60ef7ec5eae0e075), UINT64_C(0xef3eadf428008a27)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xca424ece3cd040be), UINT64_C(0xcf0a2cbb5f27e8c3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x809aa309db77f682), UINT64_C(0x59aa0d7258bbd4bf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd950e95a3567d18), UINT64_C(0x1c168086755ff140)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5a3656cbe35307af), UINT64_C(0x58d3fbc34aa9bc8c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x07bb942f0a6ef85f), UINT64_C(0xd2179a4c4b219a93)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8c6035475facda58), UINT64_C(0xe5050bd5bfd744d2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xea459da9c7464997), UINT64_C(0x262cb13c37576662)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x184c6c36e3e272f6), UINT64_C(0xb5b369af8699c426)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3e6bfcbb98e2c71d), UINT64_C(0x54612d6940fd1cfc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2d0c90b3b6fc1726), UINT64_C(0x1b709302269e11e6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x093ccf7f3dac3346), UINT64_C(0x20510f603ae6c371)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x657d58a8d8d4dded), UINT64_C(0xc8f534394d1bede0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7ae5ac1709250380), UINT64_C(0x7bbb134ca64d294e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3abb5515018685b0), UINT64_C(0xc5266778ef901215)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x94b875e6447684a3), UINT64_C(0x6cce75654622ef75)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x25cf6c38b2302d1c), UINT64_C(0x7b375c96d80a22e0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3306138dc9acc865), UINT64_C(0x9e9f7abad5851a06)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x069d52d973ada812), UINT64_C(0x10f405fd8086f90e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8591e3a1ada6079a), UINT64_C(0xaa0d31cac0baa8c5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8abd8139e51ab1a4), UINT64_C(0x5a64aed16c083130)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe63881532ad07399), UINT64_C(0xe0e049785024a25f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1d98eff1955ca1b3), UINT64_C(0x3e9ac25d501ec799)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x35348f69c6cd9c86), UINT64_C(0xd5967659635b7bbf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5e6a00aa1a4a3935), UINT64_C(0xcc4ed3dcc607b369)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x619a12e0207a95bc), UINT64_C(0x25d51475b4338ed6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9ba72c4408015f45), UINT64_C(0xfbce21909473209e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9ccf58539a8fc229), UINT64_C(0x940d450aa31ab461)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfee062da1e91c4e2), UINT64_C(0xf1e03b24829c778c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x53bbddfa7936fa78), UINT64_C(0x8912f5b509c50d07)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x93cbc873ca237567), UINT64_C(0x112115299a71ea78)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x88cb46806419f9fa), UINT64_C(0xe07020d3b8dbc4b8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x15132649d7c11fb4), UINT64_C(0xbdc2e098c5a64f6f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x89c6f2779f79d23b), UINT64_C(0x4752f7bc0ac56531)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7e57b436fff593d1), UINT64_C(0x9c5ac44125010d8c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x74868555128fab2d), UINT64_C(0x194b6254a5142ac0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3a2998e3d9497250), UINT64_C(0x511c4ec8e6051520)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0f6576290edecb96), UINT64_C(0x14c0ac67cbbc2f01)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x99b68ca600060497), UINT64_C(0x9d46b6e489546471)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf3597e5f0e8f9b1a), UINT64_C(0xc8f5cae9c9a4050a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x98b66169c574bfc2), UINT64_C(0xf4c3c64c4f524fac)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa7d2193a61619122), UINT64_C(0x0a3e5f9c74cbb8e2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc10bce28b85496b6), UINT64_C(0x1c3939b9e77e3bf8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x65b465a7abcd402e), UINT64_C(0x0e2fe3cc88a02a15)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbfe0026922bf8ba9), UINT64_C(0xd1de52d2c764b6c4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x423479776cb943f5), UINT64_C(0x7cf797aef5f2e129)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2a2cddd2406d8357), UINT64_C(0xfded293a6560a5e2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe75fd764cd452bc3), UINT64_C(0x1dc8a62e5e097df9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb46ef07721d70da9), UINT64_C(0x2c87452269da69ec)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbbd88787663d5914), UINT64_C(0xa4861c1e16e92017)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x137677247f31b4a3), UINT64_C(0xdfb3088bdb359ab9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x927d84c878d41520), UINT64_C(0xf5d3025faef708bf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe2a1191e7d5f8264), UINT64_C(0x8ade111f9835891b)}},
 };
 
-static const mzd_local_t K_3[] = {
+/* K_0 | K_1 | ... | K_4, five packed rows per row */
+#if !defined(LOWMC_INTERLEAVED_LK)
+static const mzd_row192_t KS[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6585136501694c07), UINT64_C(0x5fb02d5951af53c1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf5363757a219b4e9), UINT64_C(0xc9945ebdba4ddd30)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7f2159388c3c2fca), UINT64_C(0x17b2916a7cc31c81)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x44ec76fc0c26f8b9), UINT64_C(0x9a9fbb66bdee7229)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe4df542bf43aeccd), UINT64_C(0xdade57aa66d1aba4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7e3111b99e7978e), UINT64_C(0xe577b5f444e4d480)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x93f09812adbc98c1), UINT64_C(0x9e276a9eb4071209)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x74684f9e0516136d), UINT64_C(0x1898e7a1ff454c2f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x163b1f6e5882e3ec), UINT64_C(0xc7d8edc1777a8616)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x90dd4433979ef6c2), UINT64_C(0x8c0de7e22be02ba0)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf68c14656a49a1bd), UINT64_C(0x211ed96c67c22b8b)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf1fd27ef5c02698a), UINT64_C(0x536bdb22584a36f9)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x181a71b57a20c2e2), UINT64_C(0xf7011086400ec7b5)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe5e7de3e45091070), UINT64_C(0xd12730f0e530336a)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1a294fd0b09204e4), UINT64_C(0x1f8eb8f7fdc4cccc)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2dd206f5a4bb9563), UINT64_C(0x616ccb7b25845311)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa6030acf57104ef4), UINT64_C(0xa71be63ace32a49e)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x75c35d8e94fab011), UINT64_C(0xdc2692dc4c89964f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x426a301c092edef2), UINT64_C(0x04280bce3007de05)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfe173f5e2878a7f4), UINT64_C(0xf209727ecd4beecd)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd61237b50781e03b), UINT64_C(0xe514d28230b65a9f)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x96a4b15d1e81edf5), UINT64_C(0x81879e422ec5f017)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1253e08a4cdf217f), UINT64_C(0x219211d434934851)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x86849bfab33e6ec4), UINT64_C(0x2a8d26bcd858b518)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xec987c2c2a832f02), UINT64_C(0x04560c698655b93f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfdb21f6136165c4a), UINT64_C(0xd8bb731a1711af7c)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x15e2f4d9c19a3fcc), UINT64_C(0xec4783992d01d5e8)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x29ad2ec4c621105c), UINT64_C(0xd05693aa887ca81a)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x37860f58b1b8af7c), UINT64_C(0x05a4762029d02e59)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeeb88c1e86e022d0), UINT64_C(0x9f8d912dc01739af)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x09f200e4de695dc7), UINT64_C(0x4e77f871291cca4a)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf0e83689cff1aa75), UINT64_C(0x569055676d60d0b9)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf3806eb12b1848a2), UINT64_C(0x017bfed64ede281b)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7d722bff38670537), UINT64_C(0xe4f60ac0fa63bd81)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9646a957e2702b42), UINT64_C(0x1f5321d51df928e0)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x64c7f091dd347b47), UINT64_C(0x8f4fe74737507991)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8c8cd9c207cf6b6f), UINT64_C(0xd6cc681f917f02b8)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4d86afa76d6b4f56), UINT64_C(0xd072aa21cb065f91)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x30f10ee6eb88e46e), UINT64_C(0xa51896421874013c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xeabbedbd9c6621f4), UINT64_C(0x83d9593f02566629)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4bd2ffc55a025075), UINT64_C(0xbd9bae5016536498)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe54357f9798e28eb), UINT64_C(0x941445b5057da1c6)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcee3cd9e2000ab45), UINT64_C(0x04406507650d395a)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3f1da9926cc2ee20), UINT64_C(0x77d33378093f185f)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x31742e8755b5e92b), UINT64_C(0xd33d1fee01e49445)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd56b88aeda8cba58), UINT64_C(0xed7ee56f0042eb7a)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9a0161848c4c9715), UINT64_C(0xc4f39675a655736d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1a7943e404ad8676), UINT64_C(0xb703b1bc296419da)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0176d34bd9bc969b), UINT64_C(0x94803955f950af9d)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2eca3b553b7ccd94), UINT64_C(0xff4d53284b9c2f5d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3c1cb9889033ddd9), UINT64_C(0xc90065bd525e204c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x49afc02b37f41f55), UINT64_C(0x5303149a9a5a2fc5)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf3bf0df59ec09160), UINT64_C(0x61163da278edf031)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x54b18b23968a0b50), UINT64_C(0x5ca454da1f84c12c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x24e9988b9fd54833), UINT64_C(0x154ec5c49f595f78)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x49da63b94b66edc9), UINT64_C(0x6d487abc5c3c87e2)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfc9959d655f34897), UINT64_C(0x71d023b55e95fa0d)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb92e4ccdc34ca348), UINT64_C(0x24d16fd0f3268cb4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x02f61b71bc9977f5), UINT64_C(0xa0865f81ff77f182)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf942b05710bdaa54), UINT64_C(0x5be5be79afff9977)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x181a585deb311d9d), UINT64_C(0xbfb92a84263f02c2)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdb15aa0a03cc022d), UINT64_C(0x3bcb8d2af9427489)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc4552b00c605a472), UINT64_C(0x56a33a2352f008fc)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x57edbef46cb2b6b6), UINT64_C(0x6b48f93eb4948379)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x65dc0398ec99c0ad), UINT64_C(0xcbd2eba19e2b6335)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xee2868ba1042d228), UINT64_C(0x99024e24820f04e9)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x415f0f62f619df90), UINT64_C(0xed2dbb18fca45d6e)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x425b1e49d1f426db), UINT64_C(0xa8bb6d90f6a2f1fb)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2944ff3affc6285), UINT64_C(0xb0e9180da7ac12b3)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x555a8c28bb227c4e), UINT64_C(0xed66bce6550d4816)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xea1a17dc634e6c7e), UINT64_C(0x19a0acd109af9af1)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xaa6d6d6926fb3f3f), UINT64_C(0xd5aed23ffa9cc605)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7ed8eb977cdcb0dd), UINT64_C(0x84ed643fa4d90695)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe02250f5ed9da8eb), UINT64_C(0x1450ec5821655766)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc85d2af09bd211fb), UINT64_C(0xcb0c6f2077f13f54)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x226fe57b390c5f72), UINT64_C(0x56381ed1cb3153b3)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2a64bacf6913ca76), UINT64_C(0x91dd73aa2387ade1)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe51ed5ba84a09485), UINT64_C(0x122c425e347d492e)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdb9efc5161a9b356), UINT64_C(0x79672f37917a53e9)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x141fc837590eb82e), UINT64_C(0xb208edf8f693f541)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x344fad9de7543c74), UINT64_C(0x1ecb9b354fa07d87)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3dd859172efc4a95), UINT64_C(0xbf50e0b4a88d96fb)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcf20f47ecfe1c109), UINT64_C(0xaa38aedbe7d4ec3c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xecf0b1f157f40e3d), UINT64_C(0x424c53731eba36df)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcbd7515fe6313d73), UINT64_C(0xf72ed8f248e66e24)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe977c988dccce998), UINT64_C(0x0dcb125d547db50a)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4fc2bb957c2fc859), UINT64_C(0x29e48835e5a06bb8)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x94fd59641c57d3fa), UINT64_C(0x20ae0777a249069e)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x94c8e70b148c7222), UINT64_C(0x9e024cf928e13eeb)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xee72bdc9db875448), UINT64_C(0xf15a2fdf4569382c)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9ee2fba7f2e2597e), UINT64_C(0x8662a914635f4e19)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbb47e8b95b47cdc2), UINT64_C(0x39837672de3d2de4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7346519351502f87), UINT64_C(0xf679f19ba9e53f41)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc9ebbcf7910a0f90), UINT64_C(0x112e3f7de821cb35)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb60ae9ef636b9dea), UINT64_C(0x5af8261c9af3e988)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x909b71156e5982d6), UINT64_C(0x85ccfd51fb5788ef)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3781acec43bc1bfc), UINT64_C(0xd7b0000cc19ada7b)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5d0c65aa987c3315), UINT64_C(0xb7d024df5bf12ef7)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5548e5d6fe53e43f), UINT64_C(0xb93cf96d96c91c35)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x07fb59c6fee5c5e2), UINT64_C(0x2a05bc3ec95022b6)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc0d5d5665e695a8b), UINT64_C(0x6cf86c9070f1afa2)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x20ae4792b99a3629), UINT64_C(0x8e543ebae70de0e2)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd2bf750c5e3cd595), UINT64_C(0x359822c7029027c8)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xea176fb45e90bbea), UINT64_C(0x5eb67d0fbb331ca3)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x55420d95399290f3), UINT64_C(0x7082f3c2e2bc91eb)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd1f662a6ae393f11), UINT64_C(0x34bc3c92030afe7d)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb5b16dbbdc8930c8), UINT64_C(0x6e37cd97db36725c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8f46d0e352293c99), UINT64_C(0x1208f0f4fc2867e9)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdfb5252554f71c32), UINT64_C(0x5ee6b837766d70d4)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4faaa20527b013fb), UINT64_C(0x009d62261b86693c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd2caa0d1537be6c1), UINT64_C(0x776d60b6b0e013e8)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7e23876e2afa40fc), UINT64_C(0x62243e50125e740e)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x416ba89dbfa08851), UINT64_C(0xc8b698a423022314)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x66523fe16c9f33f5), UINT64_C(0x09f37d83facc8686)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdc6e6a38eea6a97c), UINT64_C(0x812a47e4d2e17a73)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3e11b22a68d431db), UINT64_C(0x62399a550e6e7206)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5529ff9b4aa6a6ec), UINT64_C(0xb342b4136e9f609f)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x83eb0d37d1da21f6), UINT64_C(0x2ad3307cdde31a98)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x774c3b9a177856f5), UINT64_C(0x73e81eb384c58add)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x676a759375ca63cb), UINT64_C(0x9a35f53d0b5090a9)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0caca34804531de0), UINT64_C(0x68588dd7e2b89687)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1e88e7c033f05cd5), UINT64_C(0x3f816a339b6310fd)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb453c710e7f1025e), UINT64_C(0xca3bc1846e91bd63)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6449def4111735fa), UINT64_C(0x7372935f58030567)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe9bd14dd8066ca65), UINT64_C(0x480dd38ad89fe8a0)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0x86a539c077077147), UINT64_C(0x95f9a2176c04fc41)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa738f8ada097099e), UINT64_C(0x12da0765adfd4f9c)}},
-  {{ UINT64_C(0x8000000000000000), UINT64_C(0xba3eb9cedbac74ec), UINT64_C(0x5a833e28cf631ec2)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd68a30d06ec134af), UINT64_C(0x0cd47ceb9edb59a7)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x97cfeff8614e1bcf), UINT64_C(0xb4a762d1e19fdb9b)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1f24d39df144dc9c), UINT64_C(0x5cd74759a6c670fe)}},
-  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6011db454456dd2c), UINT64_C(0xb151b077446874fc)}},
-};
-
-static const mzd_local_t K_4[] = {
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3e41b8e827f6220e), UINT64_C(0xa7c034c34fd2006e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb536c15f6b3769b9), UINT64_C(0xe308a41b66b98477)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd31df2137100de97), UINT64_C(0x77c26116f7d25278)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf0a6d3b11fb5b6a7), UINT64_C(0x403a98c4b63f2797)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe4df542bf43aeccd), UINT64_C(0xdade57aa66d1aba4)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7932af6cad51ecb9), UINT64_C(0xfcadee66d86cd082)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf8ff059e4fcd90d1), UINT64_C(0x73b6c7049d289ae9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3161a689d06e391d), UINT64_C(0xcb207af91bb451e0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x010d47e2bce4fbd1), UINT64_C(0x530b4df986d3640d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7e3111b99e7978e), UINT64_C(0xe577b5f444e4d480)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x562674f221407029), UINT64_C(0x0ca9df5f06279877)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x830be29391d4ee12), UINT64_C(0x2a5c0841afd3341c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x71f6287713901099), UINT64_C(0x016a6a78f7aafb02)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc2de6a195423c2b8), UINT64_C(0x0a35adbd108a35a9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x93f09812adbc98c1), UINT64_C(0x9e276a9eb4071209)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xdcecdc7747fca8cd), UINT64_C(0x7942a6c732c9396b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x18407b6662a3fc69), UINT64_C(0xb47bafd703c2272d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfcaf5c3461f01c1e), UINT64_C(0x42f1593ef99ba2d8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6dc9487872bbc668), UINT64_C(0xd086f00d36728b3d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x74684f9e0516136d), UINT64_C(0x1898e7a1ff454c2f)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4e9ff9ef7f2a1576), UINT64_C(0xa39ed3ced4007d5d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x10a07e04c000ebb0), UINT64_C(0xc506ff5242b97f70)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xff25c0019975a3bd), UINT64_C(0x5b4762914790ad2e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8532d941e2d6b0f4), UINT64_C(0x4c11225eaf89082c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x163b1f6e5882e3ec), UINT64_C(0xc7d8edc1777a8616)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xdf1824192d59d331), UINT64_C(0xae4324ec645a4785)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe6adeb0e67f25322), UINT64_C(0x6aefe352d6165aad)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xaf26d350e5c20f05), UINT64_C(0x270b1adc9ccdbeab)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6518108854bd3591), UINT64_C(0xfee30d28da6cce58)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x90dd4433979ef6c2), UINT64_C(0x8c0de7e22be02ba0)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xcad9ec7de4150ff8), UINT64_C(0x5d52cf416f7158f3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfb951c632bbeadd7), UINT64_C(0x3cbb6b59e911f9ff)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4bf0944d301272d7), UINT64_C(0xbe01431af36a79b6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x13e611db0599385e), UINT64_C(0xbb3d83800b6052e2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf68c14656a49a1bd), UINT64_C(0x211ed96c67c22b8b)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x195c981a956be33e), UINT64_C(0xdd22737ac60314b2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2366333cdf9a049b), UINT64_C(0x013008f126988bdb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb4fa159623104bd2), UINT64_C(0xd7e42c6bd5f77206)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4bb99b73c10a5c92), UINT64_C(0xde5dc90c3531b412)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf1fd27ef5c02698a), UINT64_C(0x536bdb22584a36f9)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x243c8a7799580323), UINT64_C(0xa09619b8059d26a6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcb0679e88218fb31), UINT64_C(0x070a6faa2b16dc11)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2ab86858847d3ec7), UINT64_C(0xe010e903f4996c14)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x19f167f1352d3837), UINT64_C(0x17ac10a7569c22bf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x181a71b57a20c2e2), UINT64_C(0xf7011086400ec7b5)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x805f45735e4a0722), UINT64_C(0x0427e18efe509d4f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5300e88140cc46fb), UINT64_C(0x69a888b999b1b6e1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8f9cdfcd4ee95985), UINT64_C(0x923d05cd20c6bd11)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6cb4a56970c55d10), UINT64_C(0xd7fa82da03e49e2b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe5e7de3e45091070), UINT64_C(0xd12730f0e530336a)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8bb07860c7a5a417), UINT64_C(0xd684908a84add479)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5b659abd0281fa11), UINT64_C(0x7e53113e8c58b533)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3afd6fcf76718ea1), UINT64_C(0x63bf144ca1f59f8b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9d114b96fa10e6ca), UINT64_C(0xa3a77ee60bdf189c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1a294fd0b09204e4), UINT64_C(0x1f8eb8f7fdc4cccc)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xca004651c49dbe50), UINT64_C(0x9ae9f0c85575d224)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0e90e89a48a83a35), UINT64_C(0xfc0661da7aa9f214)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc63c4e3da8f0cf74), UINT64_C(0x1112e92e384b6faf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x77fda1f26c939042), UINT64_C(0xc4ed44592516b8f6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2dd206f5a4bb9563), UINT64_C(0x616ccb7b25845311)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd473d0f16dd6370e), UINT64_C(0x458b1bd6f24fe735)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa148ba3bef29238c), UINT64_C(0xbfa8ef0c33a07778)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6bb4fcfb1d6c962a), UINT64_C(0xced0ce5dc62b0367)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa946c240e502aeab), UINT64_C(0x13d3f412c449a6b0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa6030acf57104ef4), UINT64_C(0xa71be63ace32a49e)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xa5e14b5c8e7d9bb8), UINT64_C(0xbe08ab8efc7e1fc6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf61f81b6dc48c83e), UINT64_C(0x86f7866415d782d8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4ad93665968f343e), UINT64_C(0x3e6f245d8a5e0c4a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x97ae1bcb54693685), UINT64_C(0x42805a8d7165ba38)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x75c35d8e94fab011), UINT64_C(0xdc2692dc4c89964f)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd240c6d44a55ba3b), UINT64_C(0xa1463628d74cc653)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x080119db6ce02949), UINT64_C(0xc2c4408c50e47c95)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x46b04fafbae9e6be), UINT64_C(0xd0e9ecc3396e3dc7)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6a5c6e001c0ff70b), UINT64_C(0xda8ffc730b317a5a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x426a301c092edef2), UINT64_C(0x04280bce3007de05)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x527eea70f0f290e4), UINT64_C(0x9408d6fab3524920)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x548b69fb9a82583a), UINT64_C(0x04fea2df602643e0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3622ca4489e25b83), UINT64_C(0xc3ab6eb1757c66e8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7862c9aaaa94a827), UINT64_C(0x865b7f3e9dba2476)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfe173f5e2878a7f4), UINT64_C(0xf209727ecd4beecd)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9a035a27620e933c), UINT64_C(0xa95d6d68effaf861)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x524435026f2d1e30), UINT64_C(0x17efa7c5355f6694)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7e8496f187fb3189), UINT64_C(0x0b583809933e3de1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0df4ecd758ed28ef), UINT64_C(0xccbed33c2b24649d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd61237b50781e03b), UINT64_C(0xe514d28230b65a9f)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x6eaffb98916dbf98), UINT64_C(0xd6137079d10f2e7c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x54e84f27e27968bd), UINT64_C(0x7dad17bdc147816d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9fbc3b79d01650c3), UINT64_C(0xdad8847b159ac42f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x22d402bf73d3ecd0), UINT64_C(0x574f9ed8e6f28bf0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x96a4b15d1e81edf5), UINT64_C(0x81879e422ec5f017)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1fe043f948ef031d), UINT64_C(0x054cfe8720162d75)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x80077c47f4b300c3), UINT64_C(0xee37a1362356595e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x035d4d3dc427795f), UINT64_C(0x4f4850901a30b2a4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9e3f6b57233820e2), UINT64_C(0x16233a9d0e95fc1f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1253e08a4cdf217f), UINT64_C(0x219211d434934851)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1e6619b971efb51e), UINT64_C(0x0b0d88886ba10e38)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x73fe79d248c9e353), UINT64_C(0x37d4f609720b1589)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf2f726e7dd8eec71), UINT64_C(0x43ebbdf191281f91)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x762bd3e449abecb0), UINT64_C(0xe7a2353c6a554246)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x86849bfab33e6ec4), UINT64_C(0x2a8d26bcd858b518)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9d6fc2ce3a59dae6), UINT64_C(0x62a9976937471dc8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x561d1ecd3b6dab8e), UINT64_C(0x93d2c731cf010e45)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4491d080168e7768), UINT64_C(0x3d6eef3bcb17e571)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x15b77737c12fcce0), UINT64_C(0x3eec754b1193bbf6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xec987c2c2a832f02), UINT64_C(0x04560c698655b93f)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd22520acb8c561b9), UINT64_C(0xead3dde662943dee)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7a8cbe19760ef1fa), UINT64_C(0x53d9cad5ef939eda)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x16e08719c85fc377), UINT64_C(0xafabe894f2841dec)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc333f0b41e585b87), UINT64_C(0xc64caa762deb6682)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfdb21f6136165c4a), UINT64_C(0xd8bb731a1711af7c)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe3a906796ad2f47d), UINT64_C(0x85567901e9158dda)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa03b36769c069122), UINT64_C(0xb270c1c43d49f645)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x90a6d88d8964af49), UINT64_C(0x98c0d6bfb34c5606)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc4e94d33b2851a18), UINT64_C(0x38c228fb602de03f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x15e2f4d9c19a3fcc), UINT64_C(0xec4783992d01d5e8)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x1b4372c76dbb0339), UINT64_C(0xbcc72ecfd2e03489)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1f561334757ff763), UINT64_C(0xf2366a0ae24e9c30)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x169248e3289c5c75), UINT64_C(0x3360e4fd445e897c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd3dd64f74bd8e1fe), UINT64_C(0xb4a04c587f55f066)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x29ad2ec4c621105c), UINT64_C(0xd05693aa887ca81a)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc8ca52e86e71eba0), UINT64_C(0x8a07f6e51b6f7b1a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x859dbd1b9813398e), UINT64_C(0x6d0d71083129c7ad)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd35840c12bf865fc), UINT64_C(0x58edc5f984dc21dc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd6298099b7bf438d), UINT64_C(0x7f055162ae088782)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x37860f58b1b8af7c), UINT64_C(0x05a4762029d02e59)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe06f51341f360f9d), UINT64_C(0x1a684d73c404f094)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xef88375af9ec4099), UINT64_C(0xf362de02328f8e69)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8e613ada07fbb9e6), UINT64_C(0xcef6ab5e5ea6d3a6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb1aa1f5aab57bac6), UINT64_C(0x3f7353cf633c2174)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeeb88c1e86e022d0), UINT64_C(0x9f8d912dc01739af)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1ace7d7318feeaf5), UINT64_C(0xbb734bad474bbee6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcdaf7179a4a5edd9), UINT64_C(0x03db1d57dac977eb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xef4ea59338f19fc7), UINT64_C(0x921db55510e2a25d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x63900cfea288085b), UINT64_C(0x9801482d9017c36e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x09f200e4de695dc7), UINT64_C(0x4e77f871291cca4a)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x27ae1925de107b48), UINT64_C(0x134ecb4edd44c36a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x539a47169e6104bd), UINT64_C(0x0d6639e31323049f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x24340d58e6cb17be), UINT64_C(0x0114034b3946f7f1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa24125c0ecb5cc97), UINT64_C(0xda0b34abf1bf4501)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf0e83689cff1aa75), UINT64_C(0x569055676d60d0b9)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd62f2d0b8e6f4ffa), UINT64_C(0x401ae0ab5a8c444a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x751849156724f74b), UINT64_C(0x0b0f05cfccccff23)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x10031a2a9f89b238), UINT64_C(0x09ec5347be5b9fa4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbf51d9d0120c585f), UINT64_C(0xf8d007af1161bc92)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf3806eb12b1848a2), UINT64_C(0x017bfed64ede281b)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x977e0f16e8c074fd), UINT64_C(0xfef76a2617ce0cac)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb3453245da8eafff), UINT64_C(0xd66888ca09d3f85a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc92ac314f43ad9fc), UINT64_C(0xc401de26dbab7209)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xddf3f8470d2b2dbd), UINT64_C(0x35c48b7de9837936)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7d722bff38670537), UINT64_C(0xe4f60ac0fa63bd81)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x97878a721b118a4d), UINT64_C(0x8b7306416b6268c4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x557822bce87f2982), UINT64_C(0x32320b5d82ed51c1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x772973ecbc1c1830), UINT64_C(0xd3d34c74b7e5139d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9d58038b2f21ec89), UINT64_C(0x8bce64f7d8a7a3a3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9646a957e2702b42), UINT64_C(0x1f5321d51df928e0)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xea6312f0d77dbbd6), UINT64_C(0x6e10a00d5341056e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf3f863b6967775e9), UINT64_C(0x1bf41d401140ec42)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa9ee2ea0e7e6a89b), UINT64_C(0x34e074d5f1452e56)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x95fd5bc23c131f2f), UINT64_C(0xc97ed9d52b4d82b4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x64c7f091dd347b47), UINT64_C(0x8f4fe74737507991)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7fce6339d058aeb1), UINT64_C(0xc59ba810e09f7cee)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x66fcf3f04d3ffe08), UINT64_C(0x2acbe34fd499f8a1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6145c6a99e729157), UINT64_C(0x3cd0db1c42c166fa)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1b120f9124ddd4a7), UINT64_C(0x8830657160ef30bc)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8c8cd9c207cf6b6f), UINT64_C(0xd6cc681f917f02b8)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8ee5c1b8a3318cf4), UINT64_C(0x91b1aa16b7ac18d8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7a4f13b44e0ecb95), UINT64_C(0xb555f0161a6fafe4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5906d211b3333a58), UINT64_C(0xe7fa501ca5d46686)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9187768c164a2171), UINT64_C(0x9b994ddb760a5fe5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4d86afa76d6b4f56), UINT64_C(0xd072aa21cb065f91)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x5c7498a0c7d8c94f), UINT64_C(0xab3ef71e8bc092f3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8c6a5d33d5202a63), UINT64_C(0x41ba1df70093c7a8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8d466f70a1232b61), UINT64_C(0x12618e03d5fb02ff)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2253b6eaf0364b3f), UINT64_C(0x0eb6e406a550a4db)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x30f10ee6eb88e46e), UINT64_C(0xa51896421874013c)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf6c39f499d913bb2), UINT64_C(0x6c06a336cee5e88c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfc2b7731f1e0e549), UINT64_C(0x75a62f12abef2d88)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc730f1e8065b1cd8), UINT64_C(0xc5e783dd95ad1af2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe340b87c98fbd2cb), UINT64_C(0x78e06a352ab92757)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xeabbedbd9c6621f4), UINT64_C(0x83d9593f02566629)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1883b9d471b178fc), UINT64_C(0x4342c0b64c384dd2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1264996c0b32f7be), UINT64_C(0x64e8fa7829434fe3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2edbfdd1d2b031e9), UINT64_C(0x9e17fec22d84ecc4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe65a2ae5b06ac6ee), UINT64_C(0x45a0cd068a7060f8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4bd2ffc55a025075), UINT64_C(0xbd9bae5016536498)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x231dd0c4c264691c), UINT64_C(0x8aade70ffd1c8e85)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc478a859f384f8a5), UINT64_C(0x29767f11c8e3976c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x472760f18d4d682e), UINT64_C(0xe20baf1459353f40)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfe8c7c5fdcff83c0), UINT64_C(0x948466d8cb73dd34)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe54357f9798e28eb), UINT64_C(0x941445b5057da1c6)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x27ac30c6d77b62b6), UINT64_C(0x12ec25c262fdbb6a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe62f1710260f5f18), UINT64_C(0x2e306aa753470995)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x62d523cdb4566fcc), UINT64_C(0x61becb0b5dde0387)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xec0e31d912fd4496), UINT64_C(0xc8ae977f8e7add1b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcee3cd9e2000ab45), UINT64_C(0x04406507650d395a)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0c74e88e4a13fdd0), UINT64_C(0x68f85265728ae06c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcddcb366db2298e4), UINT64_C(0x8b45bce77985b45b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x04b7718ef09cfdba), UINT64_C(0x68ba55cd5fb1cd0d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x37c70823d9362b45), UINT64_C(0xa777af814fcc5b3c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3f1da9926cc2ee20), UINT64_C(0x77d33378093f185f)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xcc1647cee724a28e), UINT64_C(0x6f4c63c02294c390)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc599e3cdc22777bd), UINT64_C(0xccef63e2920a3707)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xee5da9eef353626f), UINT64_C(0xa1dab56767368f13)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x58f8a6a3345a2a65), UINT64_C(0xcdbda914441c8bd9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x31742e8755b5e92b), UINT64_C(0xd33d1fee01e49445)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x2809495b9ab96f40), UINT64_C(0x4b07a5e736013a6b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd42aab976ce26e67), UINT64_C(0x4603d71a4d4673d4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x32cdd83ea5d08f69), UINT64_C(0x354114837134c693)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x21d4defa413f3a36), UINT64_C(0xc8ee1d8ff8103618)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd56b88aeda8cba58), UINT64_C(0xed7ee56f0042eb7a)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd94b029b2f328a60), UINT64_C(0xb5fc6a487263d79d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8351a1364787c521), UINT64_C(0xd998f34bad7e304d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x026466686e8a9cef), UINT64_C(0xe2f0fe00d8b7c38f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9eb238f077a4ac65), UINT64_C(0x4e535391595366a0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9a0161848c4c9715), UINT64_C(0xc4f39675a655736d)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3c4b5ab1192adabc), UINT64_C(0x35a04dd0e9937ac0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfb82c4aba5d665c6), UINT64_C(0x4a41852dc25c9369)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x674eb66501d8a527), UINT64_C(0xf446f64a78c502fc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0180e66e53197078), UINT64_C(0xf94080e3d84fbf30)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1a7943e404ad8676), UINT64_C(0xb703b1bc296419da)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x5d7b78ee0a7d7fcc), UINT64_C(0xfa4eae3a610ad152)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x053053c7c487c65f), UINT64_C(0x5902a80099236a70)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x240fed9fed3d7a41), UINT64_C(0xbfbf60a97a7b877f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa03fb48750308faf), UINT64_C(0xcc43c14834156ce4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0176d34bd9bc969b), UINT64_C(0x94803955f950af9d)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x96877fc86f1ca835), UINT64_C(0x358e090eaf8e254b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5294b482404832b0), UINT64_C(0x4b5cfba391bd48ae)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5692fdf9811232bb), UINT64_C(0xffd341c33435889f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4ba2324571535b4f), UINT64_C(0x8ea4ae9e22be5334)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2eca3b553b7ccd94), UINT64_C(0xff4d53284b9c2f5d)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x4fc59ed0ac8393ae), UINT64_C(0xf9342ed76997e362)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0ee041c6a2449c63), UINT64_C(0x4971a37f4f719670)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x63eec18d2b91f8d3), UINT64_C(0x56b8b8ce73868f38)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x14a1c991ec89e53f), UINT64_C(0x7f81eac16a14efb2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3c1cb9889033ddd9), UINT64_C(0xc90065bd525e204c)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x89fc2dbfd1bf86b7), UINT64_C(0x3ecd63cd2e733e88)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x50e7ebe568a38485), UINT64_C(0xd0b7e301406b2e97)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfb5516aa9c9a942f), UINT64_C(0xf75c442966a64d86)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7635afa9bd8d4e3d), UINT64_C(0x6b8bc394223ae57c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x49afc02b37f41f55), UINT64_C(0x5303149a9a5a2fc5)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x71771c38684acdf6), UINT64_C(0xe3a33ed2fe53926f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1fdd82ad6f4a4a89), UINT64_C(0x3c5fad1bde94f2db)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6f84adbca591ecf2), UINT64_C(0x589d988b5660df15)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xce49f96ec01c4200), UINT64_C(0x1d822475e76ceb69)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf3bf0df59ec09160), UINT64_C(0x61163da278edf031)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xdb1cfbf3e77a7aeb), UINT64_C(0x6b2d6300331ac466)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa5dcfef7e44c51de), UINT64_C(0xdb7918c2135a5037)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc81523de3ba5dd18), UINT64_C(0xd1c150fbe1c65011)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xec76316136c4bfb2), UINT64_C(0xc50b6f0145888f1d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x54b18b23968a0b50), UINT64_C(0x5ca454da1f84c12c)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb0889e7d1970f076), UINT64_C(0x4e633031701eafaa)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3b52c08901c8c0d9), UINT64_C(0x7f90bbd518aa0746)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x56f0ab0106241d42), UINT64_C(0xee19475812e54bc1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeba754134fc1c80a), UINT64_C(0x6a12ad8b336e4cbb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x24e9988b9fd54833), UINT64_C(0x154ec5c49f595f78)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x512a84565a3ddf8a), UINT64_C(0x7237d4595cc4cb9c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc853f87717794be9), UINT64_C(0x39da73faadac0150)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4278dd3bc3fc3045), UINT64_C(0xd834e80cfec32f97)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcd64e03a831f9ebe), UINT64_C(0x2f7375067cfe7b75)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x49da63b94b66edc9), UINT64_C(0x6d487abc5c3c87e2)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x04e7904534d66dce), UINT64_C(0x54b74eabd8857478)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x85b7c84c98517dfa), UINT64_C(0xb523fa2d3e2ebeeb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x00b26dea0e44fc93), UINT64_C(0xcd1a7212fbd031c6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2c89c0761609b699), UINT64_C(0xf666bbcbb76b4a7d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfc9959d655f34897), UINT64_C(0x71d023b55e95fa0d)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xa1c513a422dd58ee), UINT64_C(0xfe3593d970269ee8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc95f70f8ab666533), UINT64_C(0xbe565b66a483f556)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8eabc48d6e526641), UINT64_C(0xae27bf27ff090f82)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x81c392e75ba19bf0), UINT64_C(0x87257f783a6e7d74)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb92e4ccdc34ca348), UINT64_C(0x24d16fd0f3268cb4)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7f212489dfbfc4a5), UINT64_C(0x4f219b580535c472)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xae934c639c0c846f), UINT64_C(0xa0d0d4cbf0055dc3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0f9b5e88c067c2d9), UINT64_C(0x51019a6f9601e331)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0f1d5efa3a1cec64), UINT64_C(0x0cea4a1ad02f7ab0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x02f61b71bc9977f5), UINT64_C(0xa0865f81ff77f182)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe528f29a7b7b94f4), UINT64_C(0x4bae35ddc5c1e4d0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x409e91468d45e891), UINT64_C(0x09ea684ceee8c47c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x162fc75c0da0920c), UINT64_C(0x3b527686d91f3beb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb2eab7f37c36b580), UINT64_C(0x5d472ae0343d5594)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf942b05710bdaa54), UINT64_C(0x5be5be79afff9977)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x44e787382f71f14f), UINT64_C(0x31476a62cee7c6ea)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5bd542ca3c848a57), UINT64_C(0xe0e84cf9cf7bc105)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1855595a16745622), UINT64_C(0xbb16ec66fd07322b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4b0d4811712a3ad5), UINT64_C(0x33c348277da3def9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x181a585deb311d9d), UINT64_C(0xbfb92a84263f02c2)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2bdc3f8743b2b479), UINT64_C(0x5f158ac83996b8a6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x16f2bf38e23ecdeb), UINT64_C(0x009381a5b29425c1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xde3c673fe0593363), UINT64_C(0x3cc1f1d36addd2bd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x01b03bb8c31fa104), UINT64_C(0x0c7c921e1d845b90)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdb15aa0a03cc022d), UINT64_C(0x3bcb8d2af9427489)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xeb423e8e06aaf4fd), UINT64_C(0x094196c900e9dd10)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf6b2b47266b3f844), UINT64_C(0x22be5d1fe4f5a64a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x47e8b4357790f29d), UINT64_C(0x28bfb7674388f007)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9f28c7b6abac7401), UINT64_C(0x48ee467a631c8912)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc4552b00c605a472), UINT64_C(0x56a33a2352f008fc)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xdfbd7315fa5928ca), UINT64_C(0xb7467c0e2b297e68)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd7e4039e5fed5f75), UINT64_C(0xaaf13e02409ee5bd)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x44df4c4b305ab0ca), UINT64_C(0x5c80a85c4945185d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5927e5a5b7a6335f), UINT64_C(0x4bd5e43436f5939f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x57edbef46cb2b6b6), UINT64_C(0x6b48f93eb4948379)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xbc7acb667e7b27e8), UINT64_C(0x7d7771861412bf51)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x71cb97a0fa15c715), UINT64_C(0x6f5e180137f90a3d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfffaa05d20512d37), UINT64_C(0x2a0adcc1ba895b4f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd3f319d2af86c83a), UINT64_C(0x222c57e6b90cc593)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x65dc0398ec99c0ad), UINT64_C(0xcbd2eba19e2b6335)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5ab91ccf99ee56c3), UINT64_C(0x974fcdbd9bd62e77)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb0f8441afd466767), UINT64_C(0x1d088c4e8b1d1496)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbcaca0d8ce6df571), UINT64_C(0xa9c65d397e9e6ac5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5e2d8fa983ffc9a9), UINT64_C(0xfd4e725226fdfc24)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xee2868ba1042d228), UINT64_C(0x99024e24820f04e9)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x6859b8cc0793d8a8), UINT64_C(0xd45a2bb9c7089b15)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe380c791bed60af0), UINT64_C(0xad83b1f7cd0b11e3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8e37c97289115fbe), UINT64_C(0xf1a006eb93b7898b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdbbcd36722bb4278), UINT64_C(0x2c26a61501c4901a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x415f0f62f619df90), UINT64_C(0xed2dbb18fca45d6e)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x40bef5e8f3c92ff6), UINT64_C(0x7852e9810df8e739)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x32b9ac0cc79eea5a), UINT64_C(0xbfcd7db7c2493ac7)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb0ac1a6827f69d38), UINT64_C(0x7e93d0fd98c1ff31)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0e5ec2d9fd4db010), UINT64_C(0xcd3c4ae7063205ee)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x425b1e49d1f426db), UINT64_C(0xa8bb6d90f6a2f1fb)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8cbec40851e2523c), UINT64_C(0xa95269f419f6ad79)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbf8567046a42e016), UINT64_C(0x3b26be598d52b1ec)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x47ab05e9640807c9), UINT64_C(0xbce9f852ecb46782)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd353079865eed7f7), UINT64_C(0x95c95d633752fcf7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2944ff3affc6285), UINT64_C(0xb0e9180da7ac12b3)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x045ad33bc506f00c), UINT64_C(0x6c1b696a82cc836a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6035857722b9d359), UINT64_C(0x6d7a43e53c305676)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf63c72e84d1c06ac), UINT64_C(0x7e8e8affac966729)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1d38386cb17fdf45), UINT64_C(0x02730555e814e864)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x555a8c28bb227c4e), UINT64_C(0xed66bce6550d4816)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x19574abc12133f85), UINT64_C(0xd03e866a9d690e5e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2b872cc0b13748d3), UINT64_C(0xb75add8c979d6f1b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe7f2239bb0485313), UINT64_C(0x1e0724ad61ed6a13)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7bd6846d37ed3a58), UINT64_C(0x072e893d98600920)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xea1a17dc634e6c7e), UINT64_C(0x19a0acd109af9af1)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x2f3c074c408e5602), UINT64_C(0x1e7b6486f837d9c5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xedaba0fa1b9da6d3), UINT64_C(0x284502ca82e3155d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbef5aa8c48488f09), UINT64_C(0xaf8ebf7490f8c7b3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd040258ae0df2a4), UINT64_C(0xa7ff124a3db7af64)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xaa6d6d6926fb3f3f), UINT64_C(0xd5aed23ffa9cc605)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd9c756855b7f8569), UINT64_C(0xef2e3ed10a011e52)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcb526fc5d0ed84d4), UINT64_C(0x3c3495e9f2b8c942)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x876e840acd57d672), UINT64_C(0x0e1dd2a1f3b66e1e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x32059cc665dc94e3), UINT64_C(0x3ed557668966e299)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7ed8eb977cdcb0dd), UINT64_C(0x84ed643fa4d90695)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2e416a618257f0ca), UINT64_C(0x81e0ade710cd337d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9fb3c911d184452a), UINT64_C(0x3dce4ede7b7b67b4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x62995e51db834ebc), UINT64_C(0xb49ac5801dc1ba1d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6f78c6175ab1dc47), UINT64_C(0xf49fae03250bb2fb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe02250f5ed9da8eb), UINT64_C(0x1450ec5821655766)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x18987f2afd395aba), UINT64_C(0xeed2a4f983a9aa20)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5880b9cdff1d3cb8), UINT64_C(0xa325c8b899b45d4a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfeeff53b4295b21f), UINT64_C(0x0aea6e194f8df5f9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7d780c6e35391ca), UINT64_C(0x3c47f6c2b5bc181c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc85d2af09bd211fb), UINT64_C(0xcb0c6f2077f13f54)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3ca52898655b6f04), UINT64_C(0x2423bf2c1c46fbf7)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9e46a2ca143dfca1), UINT64_C(0x275fb09fe35e3547)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xde88957a63c285ec), UINT64_C(0x8315c094b30186a3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1904a1ef247bda7d), UINT64_C(0xe9cb0e6bef1fee0c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x226fe57b390c5f72), UINT64_C(0x56381ed1cb3153b3)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x32f7b29bae335e96), UINT64_C(0x98173dff4678dfea)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9967fa76160b803a), UINT64_C(0x8d8257ef3abe8d8b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x74da2f153431e136), UINT64_C(0x9e8a537afdf27340)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x683f5145cd922318), UINT64_C(0x4c821d25b3fd660b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2a64bacf6913ca76), UINT64_C(0x91dd73aa2387ade1)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xead93ff01d6341a6), UINT64_C(0xec06d7eeb06d718f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x617c351089226fd8), UINT64_C(0x3b6707186616ee33)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6943477d3b5421e9), UINT64_C(0x56c78b5670a9d449)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4051999abaf71121), UINT64_C(0xceec0d669c4758bf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe51ed5ba84a09485), UINT64_C(0x122c425e347d492e)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xed163f5f8f23c898), UINT64_C(0x71badc60e0573ee4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0f2b5b5ef450bfd0), UINT64_C(0x7b66439ca4eb8e19)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x277b04efdf4bf3e6), UINT64_C(0xcab0f189a6f70370)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc8e22e60971727e0), UINT64_C(0x861bececa88f7531)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdb9efc5161a9b356), UINT64_C(0x79672f37917a53e9)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe675412ed54da78b), UINT64_C(0xc7de39a531881321)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb9fa99c2d2deb74d), UINT64_C(0xa71ea77e01b2aca4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x51d716258c09ee47), UINT64_C(0x534973bbd9e72bf6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x72ed6f9fabf9a4a7), UINT64_C(0x01dede6bfabcacf1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x141fc837590eb82e), UINT64_C(0xb208edf8f693f541)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x22d14dc2e2be0da0), UINT64_C(0xe555c8e19ef6953d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x820f51a2233ea244), UINT64_C(0x053051d9892436d9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x119c2ed13b30b8a2), UINT64_C(0x69ebaa5c7284d94d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeed13abada61ea3d), UINT64_C(0x77ed27bc971ae398)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x344fad9de7543c74), UINT64_C(0x1ecb9b354fa07d87)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8defe2aea19d17be), UINT64_C(0x8517afccf29bc6e2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7543db3a5013c27), UINT64_C(0x2568246b0ca84893)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9e6998f475db380f), UINT64_C(0x9c9b52426ebe7397)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x32bd3ddb16c8b18c), UINT64_C(0xd7e369587e3db042)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3dd859172efc4a95), UINT64_C(0xbf50e0b4a88d96fb)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xb1e384e00ae5d7fb), UINT64_C(0x09f3a700a3e074bc)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3abafbce2b04a32a), UINT64_C(0x135e02c3dc8c5259)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc3210b19141f177f), UINT64_C(0x4153f3c5f6d2db81)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2f76d56efa9dce79), UINT64_C(0x8a771341b289ec71)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcf20f47ecfe1c109), UINT64_C(0xaa38aedbe7d4ec3c)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xfd840e1fb40439d7), UINT64_C(0x6761bbaab722de9d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5db207d86c1a3f87), UINT64_C(0xc5715a6676e62134)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x29296b385286df59), UINT64_C(0x139596b347392417)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1ead8d42373de729), UINT64_C(0xdf6576ffe4459f06)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xecf0b1f157f40e3d), UINT64_C(0x424c53731eba36df)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x74e97b1e36fdea52), UINT64_C(0xd990d7d1a7f2f746)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x36ca4db46546bb8a), UINT64_C(0xdfb741914c67b580)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x93402d7bd6760fff), UINT64_C(0xde1238b6b3fdeeee)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x547e5cf665d9bb8d), UINT64_C(0x449d5590fc919569)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcbd7515fe6313d73), UINT64_C(0xf72ed8f248e66e24)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x58cd4cff56e36cd1), UINT64_C(0x73169acae86fe79a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1b0ef353eb188183), UINT64_C(0x51f0840c0004de90)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa6e1a7e1a5acfa6a), UINT64_C(0x1cc1a374ccb99270)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd2aeafd827102349), UINT64_C(0x7592b5a8ae750a9f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe977c988dccce998), UINT64_C(0x0dcb125d547db50a)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf187c456cccaffa4), UINT64_C(0x8e251533c0421c64)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb76ea3394419df7a), UINT64_C(0x1ac1a98840dbbee7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x02ae83a7fd5fd149), UINT64_C(0xf1de89ad251935b0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2d473e41950e679), UINT64_C(0x209711732ddd9b82)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4fc2bb957c2fc859), UINT64_C(0x29e48835e5a06bb8)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xeda0af2097024610), UINT64_C(0x20f3aad4f8adeaf9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8b8315513e27393c), UINT64_C(0x6664653e9f11f902)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xec772d121364927b), UINT64_C(0x925cb8511a409128)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x87444af100895642), UINT64_C(0x7d5109f42d398fda)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x94fd59641c57d3fa), UINT64_C(0x20ae0777a249069e)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0bcc635fb70bc329), UINT64_C(0x30472910d572f0f0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc75eceba7d4c9824), UINT64_C(0xac4aca1774a63cb4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x355a5ba624bc0814), UINT64_C(0xdfd5c1abc07d7829)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x462a1af2cb1f8d60), UINT64_C(0x94b6e5f5942c2e03)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x94c8e70b148c7222), UINT64_C(0x9e024cf928e13eeb)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x940bfb951f3f1ea6), UINT64_C(0xc4c9a10364e51efe)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3598483d757f5974), UINT64_C(0x1bff838c3654e54b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9cb0ba11678ebfc6), UINT64_C(0x6e409d630460e1e6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbb8e83f1230a3d6d), UINT64_C(0x15ad37937f16a15a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xee72bdc9db875448), UINT64_C(0xf15a2fdf4569382c)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xffa55d0fa91b6669), UINT64_C(0xc92b7462f71d0c66)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6ceb6e9ff41839d8), UINT64_C(0x52781f2599af2720)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x041bdd49d9a8dc42), UINT64_C(0x72efc576dc7a9bf8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x69cf97d4ef82e429), UINT64_C(0xd642ee9b62345531)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9ee2fba7f2e2597e), UINT64_C(0x8662a914635f4e19)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x213cc94a7d20c58a), UINT64_C(0x982d5590602d8aab)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0c3572fa2473163c), UINT64_C(0x9d2797763eee6ff6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x70841bbb21d21f39), UINT64_C(0xd8731535cb1810bd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x72dfc9adbc3bcb48), UINT64_C(0xc3970a2e580bfbd3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbb47e8b95b47cdc2), UINT64_C(0x39837672de3d2de4)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xbed29129bf9a01ef), UINT64_C(0xad24ac1c01e547c8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x132379a7863cb131), UINT64_C(0x0a8a48babea05f83)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbe6f76faec213844), UINT64_C(0xf5839c79ac403dcc)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd5ec7eda783e0865), UINT64_C(0x6d4e367d9dc73c00)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7346519351502f87), UINT64_C(0xf679f19ba9e53f41)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5296c41b0e717cdc), UINT64_C(0xe194c25217e84669)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa0c2c8fb9eb22d3f), UINT64_C(0x04fb6ae35d469693)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb9aa440704a5110e), UINT64_C(0xda62db507ed08de2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8e7d25d30e038d55), UINT64_C(0xc79ba3e5340e6a87)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc9ebbcf7910a0f90), UINT64_C(0x112e3f7de821cb35)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd44ce6e0bd49e134), UINT64_C(0x405e0af915c7843b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x456deaa371d069a0), UINT64_C(0x5895a65ef2fb6b28)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7c490eae0da156fe), UINT64_C(0xc637f4dac0e1909b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xab814f449f4e4b4a), UINT64_C(0xd881bb3f93318b8e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb60ae9ef636b9dea), UINT64_C(0x5af8261c9af3e988)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x993662e93784cfa7), UINT64_C(0x5b71b0828d1a5b06)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x06fb11cd1e26fae8), UINT64_C(0xe0130168b63e861f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0c6b09abc53fa86d), UINT64_C(0xcb2897040f317e45)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x53d07eff9cb60c2b), UINT64_C(0x72e5c2d63a891911)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x909b71156e5982d6), UINT64_C(0x85ccfd51fb5788ef)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1ec8e678d06b24c8), UINT64_C(0x3a4e282a3426bb1d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbee99727bcae999c), UINT64_C(0x1fc4854553d58e94)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4a6ff134e2513b65), UINT64_C(0x55216153ccd5420b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9cec7b2d0a84f419), UINT64_C(0xd0610e93bb975b62)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3781acec43bc1bfc), UINT64_C(0xd7b0000cc19ada7b)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x2f6e2a82ac2d2412), UINT64_C(0x70b2f1a1f96b4ef5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7ff476e5986ff9c6), UINT64_C(0x68a408efb9c1471b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x44f705223b38d400), UINT64_C(0xfddb4d8c5ec2a620)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdb6644b83881e1c1), UINT64_C(0xff89bf2f2ee08023)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5d0c65aa987c3315), UINT64_C(0xb7d024df5bf12ef7)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc8c66003f0c12ae8), UINT64_C(0x291f172c236c75e8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa2c15c42d404e8b5), UINT64_C(0xf7886658635b0d98)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x35e10890b08dbfd6), UINT64_C(0x1600edcb9ad57177)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1bf59750a391fc0a), UINT64_C(0xfbda9bd00475ff20)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5548e5d6fe53e43f), UINT64_C(0xb93cf96d96c91c35)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x67087513e1815387), UINT64_C(0x69162658c6cfafd3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x589239c67ab35d75), UINT64_C(0x0b121c68d557c398)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2fb474e4e4018d49), UINT64_C(0x087c5eacfa9d7625)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb175add2f5a59e3d), UINT64_C(0x9893f96afe158513)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x07fb59c6fee5c5e2), UINT64_C(0x2a05bc3ec95022b6)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xb65bbe69b769fdbb), UINT64_C(0x3307eaf5092c0be2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x505bc55d924ac664), UINT64_C(0x6d0bbe258c381a18)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcc02cb336c6dcb51), UINT64_C(0xbaf7ef5060ab3691)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3870d9e189de656e), UINT64_C(0xe7ec4ca2dcd056a3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc0d5d5665e695a8b), UINT64_C(0x6cf86c9070f1afa2)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5e9498d0c7d06bfe), UINT64_C(0xe26f13f31c9ccac4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x60347849e145ac28), UINT64_C(0x81e398884ba7268e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2a7cd66e5c242379), UINT64_C(0x958a03620fbed86f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc4d69a45201223de), UINT64_C(0x491382e15a4b8bbe)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x20ae4792b99a3629), UINT64_C(0x8e543ebae70de0e2)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xbbff0fce90736713), UINT64_C(0x9dc198b4e73a72b8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x219df4ab09430d3f), UINT64_C(0xa54e80a99e385499)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x29a2ca09e04b8a1d), UINT64_C(0x55a3183d75cccff9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdd5c7d9ef4330e06), UINT64_C(0x912c40eb6ba63a45)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd2bf750c5e3cd595), UINT64_C(0x359822c7029027c8)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x43b37c6c647ea15b), UINT64_C(0x189b3cf9a3e114c5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4873276bc6821160), UINT64_C(0xbf0b879b14ee5157)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7b64ab8c0ec73451), UINT64_C(0x3fcce79fe9a5732e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x78065d80b726de13), UINT64_C(0x0478c9d8985cf51e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xea176fb45e90bbea), UINT64_C(0x5eb67d0fbb331ca3)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x24f9e5636b5f1b69), UINT64_C(0x39488d6a8ea0e0bc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0ccb81f714541804), UINT64_C(0xd4a757e5bd74908e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2950a5be2145793), UINT64_C(0x2c62f89210b25565)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2973c31efd62c7a5), UINT64_C(0x043a3750e3d07026)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x55420d95399290f3), UINT64_C(0x7082f3c2e2bc91eb)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1bc726321827c370), UINT64_C(0xd7537268faac5048)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xce4cbcbdb65b7543), UINT64_C(0xfca1a7522f67270c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x98081ae203e19ce0), UINT64_C(0xb97a2a4286207af6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7aa00d4f9a15ace1), UINT64_C(0x853b23046ef3a9c2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd1f662a6ae393f11), UINT64_C(0x34bc3c92030afe7d)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xb28496a23548d6ad), UINT64_C(0x8f869e66dd2c296b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa7b4acd4b9d466d2), UINT64_C(0xa8f7a9ffa47a77f0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x695aaaecce0c36f2), UINT64_C(0x5b77b2c17c95ada4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9357f223e2601b61), UINT64_C(0xe97e496db3098b12)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb5b16dbbdc8930c8), UINT64_C(0x6e37cd97db36725c)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x0a308f14e188f8e0), UINT64_C(0x897247ba77ad675e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x38710b820fd0b01c), UINT64_C(0x6fe3f2f0795721ac)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x531b5cd92cdedeed), UINT64_C(0x1afc676ca91210fe)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1606d42ca7fe48c0), UINT64_C(0xd405aac270a20989)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8f46d0e352293c99), UINT64_C(0x1208f0f4fc2867e9)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x55a3b48274d4c334), UINT64_C(0xe12cfa19605242fb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8e59d30ff1ff790f), UINT64_C(0xbb167eb2609202b8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7a5fd571d63802bf), UINT64_C(0x58301cf6ca974ed3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3590d5df1fca0ee7), UINT64_C(0xcf8f61d826fae0f7)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdfb5252554f71c32), UINT64_C(0x5ee6b837766d70d4)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc93047234c4de5d6), UINT64_C(0x7b780cbf4c07ead3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd2407a57512004a1), UINT64_C(0xfb37ac09560dc943)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc7334b16712d348d), UINT64_C(0x52f0aa71d0d0f2df)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8646b5aff9202dfd), UINT64_C(0x359177c9239b9d8e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4faaa20527b013fb), UINT64_C(0x009d62261b86693c)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x230e7f7b4007f1ec), UINT64_C(0xee75a2f9727444ce)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xad7e7385d69c5892), UINT64_C(0x5011ee44b81f9387)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9c511954b5cc9785), UINT64_C(0xd89d3d993d914979)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc9a95df9d95b53d8), UINT64_C(0x18ca7e0353bad20d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd2caa0d1537be6c1), UINT64_C(0x776d60b6b0e013e8)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xa03720340064f794), UINT64_C(0xf7dcfc9f72daf8e3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0538798ba38d729d), UINT64_C(0xb9b5cdd3a53d4583)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xacae6ebe469aaa9e), UINT64_C(0xbeb97458dcd15732)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc8498aaa16ea2850), UINT64_C(0x2e1f7785bd13374b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7e23876e2afa40fc), UINT64_C(0x62243e50125e740e)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x528cf4268dfd07ac), UINT64_C(0x0b2089a3c3c32fbd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf5730b61d2f07dab), UINT64_C(0xb40aeb7722eae755)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd9321f1572cf69e), UINT64_C(0x12e856a8cfd21f1e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x547d2371cc6479bc), UINT64_C(0x95ca4edff944a74b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x416ba89dbfa08851), UINT64_C(0xc8b698a423022314)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc981ff3dac5bb689), UINT64_C(0x643a32134125cad9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x55389ef1a0551543), UINT64_C(0x926cf7b8c6914aa8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa6e6684b3298e0e9), UINT64_C(0x52a37bd1a933f62c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe32cbd2c6519e208), UINT64_C(0x2d6c7c2f31f26363)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x66523fe16c9f33f5), UINT64_C(0x09f37d83facc8686)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf24de6b05706cfe1), UINT64_C(0x19b1211a480d149f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf46207d7a2bd8804), UINT64_C(0xb4f6f4c9ad651d5c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x73ab7f0dbf22e6c3), UINT64_C(0x4aa39fe6b85c07c7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa81be0c1b3554dfa), UINT64_C(0x10cd983edfbe097c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xdc6e6a38eea6a97c), UINT64_C(0x812a47e4d2e17a73)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xd48719fff2ebea3c), UINT64_C(0x72126ff6836fa564)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2cb9d3a1f2db5df7), UINT64_C(0x6daa01890103dfe5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x33dd18c0feed877e), UINT64_C(0xa98cfaa94bbd21ae)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x420889eacf7d7ed8), UINT64_C(0x4d507dc4c2eec492)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3e11b22a68d431db), UINT64_C(0x62399a550e6e7206)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x09a4087c6f62f995), UINT64_C(0x92eb74879fd0c558)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7d5a4b3f550ff2e8), UINT64_C(0x65b330e8bc3258b6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe29ee2e2c9bd17dc), UINT64_C(0x9453d72f392d6eae)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd511ba8ab97632d8), UINT64_C(0x728a166c6de808a4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5529ff9b4aa6a6ec), UINT64_C(0xb342b4136e9f609f)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x14c3b4cea9f341d9), UINT64_C(0x85ccf427044ae688)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf231936a6d521f47), UINT64_C(0xa65c48dae4c3d626)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x275e9cd936d73826), UINT64_C(0x49dbe0da4c6f0d29)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc706e0a0b253a243), UINT64_C(0xfb5ef02eea38009d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x83eb0d37d1da21f6), UINT64_C(0x2ad3307cdde31a98)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8fab6a41e2d7e7af), UINT64_C(0x0c2121fb14cd9ee6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6fe272179c3f25d1), UINT64_C(0x8315908ecd8edbc7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x75cab49bb66b26f7), UINT64_C(0x190504c92ee7b837)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x50e893ef58a01c4c), UINT64_C(0xa39f96838c981c39)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x774c3b9a177856f5), UINT64_C(0x73e81eb384c58add)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf28cc18b9d5265af), UINT64_C(0x22f20e5c5257dec0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x811c9d852999daaf), UINT64_C(0x1f45cf138bc8f934)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x813ce6dca91bbd40), UINT64_C(0xec32e2bc3b0bced9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd5facb894c7f14f9), UINT64_C(0x6850101550e9ad50)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x676a759375ca63cb), UINT64_C(0x9a35f53d0b5090a9)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7511fb451318ea61), UINT64_C(0x5b941807a56204d3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x35b7341e430bf776), UINT64_C(0x6f242268f52ea7c6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf5e74afded28ec4d), UINT64_C(0x3a5b954e3f35106e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe9ef0f8ac1fdabd1), UINT64_C(0xfe286f6f815b9d0a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0caca34804531de0), UINT64_C(0x68588dd7e2b89687)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x16daaadaae1ca36a), UINT64_C(0x27fde43d5e8b679d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x57fc45ae608b37f4), UINT64_C(0x3195a91508a2dd25)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7b5ea07625f86d1c), UINT64_C(0x29df6a1c902a3a2e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x20e9d63905c3a860), UINT64_C(0xb96e9ac36bee6812)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1e88e7c033f05cd5), UINT64_C(0x3f816a339b6310fd)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xaf256c7527d5abb0), UINT64_C(0xc171a8c1595c39df)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbdef8e24f35e2f1d), UINT64_C(0x023c5dddac12a176)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb318c5d0282fb3cc), UINT64_C(0x96f515a4a2b2fb2a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6f366b798653f4a1), UINT64_C(0xcb4ae427d86b0eab)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb453c710e7f1025e), UINT64_C(0xca3bc1846e91bd63)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xaffd3890d3234470), UINT64_C(0xeb338b275d4f5176)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb93a1279d3d77bb4), UINT64_C(0x4ab949a52b21e6b9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8f57076415969f3b), UINT64_C(0xcf0205928d92d604)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x95d11115e166a5df), UINT64_C(0xfb04a9e2e1cee39a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6449def4111735fa), UINT64_C(0x7372935f58030567)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe45ea37e51c90666), UINT64_C(0x51cc35e6d8a8b24f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x816bb5dff8cb4f55), UINT64_C(0x5289d691327420cd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4dd880920753ad33), UINT64_C(0x4ea860b1b7787fd2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x06242522eb6e180c), UINT64_C(0x1d3220e913a763fc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe9bd14dd8066ca65), UINT64_C(0x480dd38ad89fe8a0)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7d69a2817c5370a8), UINT64_C(0xecbc0bafd560a2fb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbf5fd49023a06b70), UINT64_C(0xa2bc1d841cc7a4dd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb95e8cfa0ca87d48), UINT64_C(0x4936a0cc6f45426d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x84040e19ff6bf076), UINT64_C(0x3c13f0792eb17858)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x86a539c077077147), UINT64_C(0x95f9a2176c04fc41)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x743169e783219af5), UINT64_C(0x9e21177d5091964d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6f3ea955b5f14489), UINT64_C(0x07c882c50fb440a0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb6fb0371a2b3f8c8), UINT64_C(0x0a12103972845439)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4969a232155ccca8), UINT64_C(0x74005ffe9e1eb871)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa738f8ada097099e), UINT64_C(0x12da0765adfd4f9c)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x944386d9275c3dc6), UINT64_C(0xc3b2692c6df0bab8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x269f55399313d54c), UINT64_C(0x882426f57d4961ae)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa9c33ee3ec23b789), UINT64_C(0xd16c2f0964df706c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x78befb9d1b4e5bab), UINT64_C(0x050d7ddcf721b436)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xba3eb9cedbac74ec), UINT64_C(0x5a833e28cf631ec2)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8a446c1e5b2806f8), UINT64_C(0xf75aea488b86b8e8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdb3a9c3841bafcef), UINT64_C(0xb057549b3695525d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe28bedb010b5339b), UINT64_C(0xce8f043efac64549)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcf8571ed69ad822c), UINT64_C(0x4a325b2e4c6e3147)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd68a30d06ec134af), UINT64_C(0x0cd47ceb9edb59a7)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8fefec343ccff666), UINT64_C(0xf3ec4be1dd18739e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x86c8961e40ea3ac7), UINT64_C(0xbbdc8711189e3ad2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9e91d438faa9b77d), UINT64_C(0xcc811c1bf8f92916)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe701464093cb4fad), UINT64_C(0x333058cfaf0abd79)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x97cfeff8614e1bcf), UINT64_C(0xb4a762d1e19fdb9b)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xab8040f469000ea1), UINT64_C(0x160dd8dd27caec57)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf7f7254a6d4b610e), UINT64_C(0x5bb58c46e40343be)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2ac2746489f18de2), UINT64_C(0x6b3f969dea1627c5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x613d055804f976e2), UINT64_C(0xb97fa8e32df79ca4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1f24d39df144dc9c), UINT64_C(0x5cd74759a6c670fe)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x92718d9b9388233b), UINT64_C(0x9c59e44013a7cf8c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3824d9fcd068f314), UINT64_C(0x5fd69ccbd2b322fb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf5c728d2ad4abed9), UINT64_C(0x6c3faf85da3ac0a5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd2aa3ca2c60e019d), UINT64_C(0xdd5b6a2d01f0235a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6011db454456dd2c), UINT64_C(0xb151b077446874fc)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3b2895e72d962416), UINT64_C(0xba44b0dacd949961)}},
 };
+#endif
 
-static const mzd_local_t Ki_0[] = {
+/* K_0^-1 | K_0^-1 * K_1 | ... | K_0^-1 * K_4, five packed rows per row */
+static const mzd_row192_t KiS[] = {
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc663d551326dc293), UINT64_C(0xa4b800062f864c9f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbc1245862638bc94), UINT64_C(0xae2a79a8fe27d445)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xed22fc91fc994c08), UINT64_C(0x964be1e3bda5303c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7151174ea8b9dbea), UINT64_C(0xf3575569b9312e8e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0507525579e43f31), UINT64_C(0xac74c7783aff56dd)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0712deac83196b08), UINT64_C(0x6707556ec3678686)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6cd79ab237be90df), UINT64_C(0xdb229cf51ddcde42)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x29c5b99a37fe3490), UINT64_C(0x16df1d987ab1a275)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xef88afc6f221cf1b), UINT64_C(0x202b2e415f6c9fb7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3df72721611a3a07), UINT64_C(0xf336e0e0185aff47)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1f0a9e854ddd8043), UINT64_C(0xdcdc0bcbe41a8a6c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb842f0023b7a0b42), UINT64_C(0x70c5f23d3a2031c2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xba8e1d4fca285b60), UINT64_C(0xb4a428d733d1e3cb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf0a90f3e33dafd27), UINT64_C(0xed211d4c3a18ac28)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x60540d5f6b09f705), UINT64_C(0xd9eef935b96b079d)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9313e416f221dfde), UINT64_C(0xe881b460765a2ba3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfd2cf392d268a88a), UINT64_C(0x8607cabaa8d1f4ef)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x532ad51e6a6831fc), UINT64_C(0x0d89e2d2571624ea)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x085b74b1b8d91c64), UINT64_C(0xb1d46886c94d9cb1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf1047615223314a8), UINT64_C(0x2d90f83a28f33780)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc082c2b09a6f672c), UINT64_C(0xdcf5cc6e02a1d1f8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2a8923808961ddb6), UINT64_C(0x69303cf17856b377)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbc96acf08a18e0eb), UINT64_C(0xfae1e23dca3d8ae4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1b333ef8e0394dfb), UINT64_C(0x5922c8ada3228eb2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7d15daa761922d3c), UINT64_C(0x2fa6efef22a04da6)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc33fc7d9ab670654), UINT64_C(0x5d5a690bb4ae9f2b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x43595c72707d697c), UINT64_C(0x3c818f95729daf0a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfabf3c2e5de8b859), UINT64_C(0x9cb7af464ca85a3f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x67016534dfc35530), UINT64_C(0x54340b214e5a1606)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9d4b51262dd9961d), UINT64_C(0x909e0f0e014ddf0a)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x928cb2c12bd1e337), UINT64_C(0x9485ec9c647861a5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9a9fb4afec28bb7d), UINT64_C(0x49980137375dc04c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x05f1fd8b1319f237), UINT64_C(0xfb148815d55c8cdf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc7b2f0bd5bf0a0b1), UINT64_C(0x00568d2eaec0d112)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3608c609a68c6627), UINT64_C(0x2edf630a4fb7739c)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd28dbad403608263), UINT64_C(0xbf32f5cf2d777e1b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa9947a5e0ea5833b), UINT64_C(0x01c228889c4d0dc6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7793ab7c8e5ce55e), UINT64_C(0x3786d858f4d1bb0a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x44ea36b604f4fbb3), UINT64_C(0x1e68da5d2aa1d4a0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x222d09e999c77c45), UINT64_C(0xdddb5141fa32d75e)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x32a9a44e4f4bdb30), UINT64_C(0xc38ba07ece4d9f4a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x088b617e31eb4b88), UINT64_C(0x04ae464170d672dd)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd12a568b1fa2bcd2), UINT64_C(0xe8891f5e75da22f2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0b2bce3e02ec4432), UINT64_C(0x5e24adf332bfacaf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfbabeb40353d74db), UINT64_C(0x5071d8e5caddbec3)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3acdb8ed8f0135d3), UINT64_C(0x51abba12352bd6da)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x259518d45577622c), UINT64_C(0x7e0f00c2d712d2f0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x20f81d6a8549accd), UINT64_C(0x824ddba202405c10)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0aa64ec633474fb3), UINT64_C(0x20843374ad971970)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x541fa814d9ee93eb), UINT64_C(0x73d25a7198784178)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x71128caa43dad442), UINT64_C(0x151c47deeb2f4205)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6240295ef6a184d0), UINT64_C(0x2f70f43a265d2441)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x120aa21097b5cdff), UINT64_C(0xd8a597c45e56c953)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7dc33376c17c3e0c), UINT64_C(0xe2e220f254f84d10)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x77df24855e2fbe18), UINT64_C(0xe86f2589e12f9517)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc8cd500ed5b7c52a), UINT64_C(0x384b5b395f18521f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5f7e6dcc79eba532), UINT64_C(0x8cb86cc5b288c765)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x46fb7a06d81ddc94), UINT64_C(0x69fc14322765c3b4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x69678118511c67d7), UINT64_C(0xe8f00d4aae7d01fc)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe66e975ba255eb7d), UINT64_C(0x76fb98d5b7748671)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xdec7b2d11abc0b07), UINT64_C(0x3a3030a4d73f53da)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6ec7adf4eef36868), UINT64_C(0x8eaedd76f7af3388)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x560f74687d1d9c91), UINT64_C(0xa4c99bc84f19782f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa7c5161a417660a0), UINT64_C(0xa46d9660a7092a64)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x049fb75cbf11af7c), UINT64_C(0x322b39e9cf82a399)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x49612d8c358aa655), UINT64_C(0x677f9d57e741826a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc28b819b854f9c2a), UINT64_C(0x77011f2c196775d9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x36f246724a3c7711), UINT64_C(0x261608e1f8cf777d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x201575b107b303a7), UINT64_C(0xf81b76015ace22b7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb5f51680e0205019), UINT64_C(0x9ab4d2dd5fa58a25)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3e16389ced2b84d9), UINT64_C(0x7382cca354d83123)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x78b0af64b3d05d12), UINT64_C(0x8974fd02381d149c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x18777fdd5c50bc55), UINT64_C(0x28b53c03aa1c3728)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3cd285b0953842d8), UINT64_C(0xbd616d2f60e545bb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x23f43461d572a232), UINT64_C(0x110fca187b1cfa77)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9ef72538abe983c5), UINT64_C(0xb4c61a2146cb4b3b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x55013e283ce23af8), UINT64_C(0x561e19773d9d186d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x16fa5ecdf6a76f7a), UINT64_C(0xb54f69dcc31c8ca5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf85660a04a9a930d), UINT64_C(0x48d1809a68f1ca9b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb8964e5034572f36), UINT64_C(0xfc91032a4b9bfc71)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x0a642ec00705593c), UINT64_C(0x8b33d064321269c9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xda5bd0e36be35587), UINT64_C(0x3d13e432c971c177)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf59e22411c82047b), UINT64_C(0xb4bc22dd455edf7b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf910211f46980bb6), UINT64_C(0xabb70f259be7a4b2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x56ce6de1d21ad5b2), UINT64_C(0x6aa7ba0402486662)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x191904be4ca9a6c8), UINT64_C(0x27de86b2ef1fcd00)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9abc78cae0acc489), UINT64_C(0x385fb2cedda08291)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x661a63864db25615), UINT64_C(0xc097534204b4b6d2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbc1802ce3a847a12), UINT64_C(0x23c6daf1a7fc67db)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x866e15770d549c6d), UINT64_C(0x24729980bfdaccb4)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x60a7dcbf8c19735a), UINT64_C(0xbe2b277f0312fedf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf87468de0b8502ac), UINT64_C(0x0013258b5bfdf962)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4cebb84d52140ec2), UINT64_C(0x754de1c73519dc71)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x44c6e495137e2a64), UINT64_C(0xa3f6bdcc6e6aec31)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xaaa81ffda34db88d), UINT64_C(0x4272efa634b7c60c)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x862a8873b288a92f), UINT64_C(0x6376eff27c03980b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xeec9f18130b8dbc8), UINT64_C(0x477f5b291fd140de)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4f177d14d06ced1c), UINT64_C(0xd441f5ef9795912a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x43d3c470a55ef4f0), UINT64_C(0xe1abdda36cdff049)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4e9b62f558068d51), UINT64_C(0xecbca914b72d1e8b)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2f52e9d6748d15c), UINT64_C(0x1626bf0d98b9d47e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x530b1387f6408767), UINT64_C(0x8190d80646eab80b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe43d42748ad14865), UINT64_C(0x5dacaf8fb6429115)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbf93e777ef2cacd8), UINT64_C(0x8cb41525ca23dba8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xaf97c0008f652b8c), UINT64_C(0x3ec03e0236f04695)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd1e4c87cf7e3a8fb), UINT64_C(0x46c8262696b08bc5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfe66e620d4dbcdf9), UINT64_C(0x2942d095abc5d5d0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x03a62d590ebc0346), UINT64_C(0xb1cf7f01d0736114)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xaecda5facdb6d9eb), UINT64_C(0x993fa21d9fe35c11)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9146f2608021beb7), UINT64_C(0x20907c12514113d1)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xddf11814a27a6b0a), UINT64_C(0xef4a8324e3b76004)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xac87e10dd5b99de9), UINT64_C(0x6baf75d657cdf79a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x67751dcb4f7eb34d), UINT64_C(0xdf56df3e82fb608f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x711c746c33aa614e), UINT64_C(0x34c671614907f7e5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x468548162d8bcaf5), UINT64_C(0x938e73326c12dc24)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x92c33a10c020fcbd), UINT64_C(0xa8231b7c3c5b1355)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5b85a827f29f96e4), UINT64_C(0x0ae9178636850e60)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc85d4538e4ff6d41), UINT64_C(0xcd5a1816fcf582d7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xae7811d100a31c43), UINT64_C(0xa79832322e12073d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdb88546d2feb66c4), UINT64_C(0xb8ea885fff782f93)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xcd26c3bd86423766), UINT64_C(0xe35a38878c79b7a3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe8b13abf050e30cd), UINT64_C(0x433bd8e090b8152e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6c69e3829240c253), UINT64_C(0x4fd50d4ba17651f5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x40b70950f46fac07), UINT64_C(0x3a6d8f4c3edd7fd3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7673fef544af00f6), UINT64_C(0x439a686439409650)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xb60c8c146c5cb0b9), UINT64_C(0xce0467c55cf62b17)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9d26cdb1bcb35814), UINT64_C(0xb7cc47f5f2b5d2e0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8f0a1c5901fed42a), UINT64_C(0x00fa7e1f83e7d91a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x973d5b5c01266707), UINT64_C(0x48ee47a6268bb935)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x87ebbf90f617434c), UINT64_C(0x02fae6c0f90fff39)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x25e7b953cf55e524), UINT64_C(0x9a0ae455d1d0f239)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0be1fad2803634ce), UINT64_C(0xe0cc27b8a9b093c8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x22c161829ac42129), UINT64_C(0xe64d81298b076892)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfd514a0ebd0e065e), UINT64_C(0x35d094fea0f2aae5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x201f8080238b1fb3), UINT64_C(0x0389297e67cf650c)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe1d4758114b89a02), UINT64_C(0x3b4a351abc2a1af8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfeb4c5f5f214b32c), UINT64_C(0xf5195fd763808ffe)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb87d1535169e7e3a), UINT64_C(0x4e295ae6f0709662)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1cfd2eae97406c9c), UINT64_C(0xa309c09013a93f90)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6eedb3b0b22692d6), UINT64_C(0x33b12b0a1a2b0092)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x14f5ce5ca778e743), UINT64_C(0x110518895b585f0b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x76ef19f7f612be0d), UINT64_C(0xef2edcc8ad45dc4f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5702aa7cf4aac138), UINT64_C(0x620e568f0987b4e1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x84855925e8005ab2), UINT64_C(0xa0a932d5fe49e220)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x19b2fd84f007afb8), UINT64_C(0x86dce7769700561c)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xb56a21ede7aa187a), UINT64_C(0x5e4894c31e7b11dc)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3816744039d1d749), UINT64_C(0xe0749c194ded736e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x14c94d44f41a1a90), UINT64_C(0xe67bd60660b065ee)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xebe64fdbcdfa6ba1), UINT64_C(0x21f6e0e66a5bd18b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc539ecacc17860ce), UINT64_C(0x4a9192ee74745ce3)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xff7d030c0fedcba7), UINT64_C(0xaa0d81d705cfc052)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x18f5febadb810ac9), UINT64_C(0xbd27a3564ba919aa)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8ff40134f1adadff), UINT64_C(0x24e4d4fde4667390)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xee77ee46c5b76700), UINT64_C(0x5ac068085ec31d38)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5390d19da88e692c), UINT64_C(0x4edd50cde0ffbf9e)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7e7cbc32b3a8e959), UINT64_C(0x94e7b534e155917b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x68e9d39bf1968c5d), UINT64_C(0xa0fba6fae7343944)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9f27bd57ca61b9fa), UINT64_C(0xec70dcc396597ed4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x271473a7bed95f51), UINT64_C(0xfeb14e50bd617c23)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0331b3d735fd98d7), UINT64_C(0x3695362052a6aece)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xafb9d40df957f153), UINT64_C(0x088a1e8bd0338648)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x78ad72fea2c156c1), UINT64_C(0xb5716a55c163268c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0a38ada9a8d6b1a7), UINT64_C(0xb8b08d66d0f81c36)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5288e36aa80e13f9), UINT64_C(0x0e4944524e319324)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x63f94948436f4227), UINT64_C(0x6b624e3d720b5c54)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xbca10eb6dea3fe7e), UINT64_C(0x66d838397abf2875)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf2f88f46db2a9cf2), UINT64_C(0xc7a597d8013e230f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe47c41428cbfc09a), UINT64_C(0x236ae7ce7885c60b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc78597a51b702179), UINT64_C(0x4120c913892ec57b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa1dd150b6a4affb7), UINT64_C(0x5c019f3dbbc4e395)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf43e9bd91bb3f2ba), UINT64_C(0x0d4645ce4657da44)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x643d1df35082d569), UINT64_C(0x0bd12cc291c69a2c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x48f9f7c5b9084658), UINT64_C(0x2974c2d9a433842a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5ce243df6736b942), UINT64_C(0x7c8b236c7ee0d3dd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb8dddad582e6e23b), UINT64_C(0xa6101830b52c2042)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe6d3558613926aa1), UINT64_C(0xe5708b5e26488a37)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5efd3a29bb5233d9), UINT64_C(0x64b9438558c9bbec)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdf151d2c69401e9d), UINT64_C(0xb0b8c3a130ca9ba4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4b8b7b827597021c), UINT64_C(0xbaafe6478fbc224c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x27752c2cbd315e16), UINT64_C(0xbc1e77ba09ac655c)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xced3f8f2872622c5), UINT64_C(0xc212b9b5e11a4be4)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcc34ff92d5a19f4c), UINT64_C(0x3b27b268496f243f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd47ea73b915833c), UINT64_C(0x1f089847fb07726d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2224892b8f86f2b8), UINT64_C(0xe0c8fd29a9bbb647)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x828b7f153648964c), UINT64_C(0xeb025992b1b31c26)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5ab2b055f226d89e), UINT64_C(0xe8f79a4030584357)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6a5dcdd3b5b51fab), UINT64_C(0xd52ef4d9076d9ee0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x24b4c524bd7e0bb9), UINT64_C(0x9d71d17814d78f04)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe57434a5d4b13d74), UINT64_C(0xc21e3a7bd8203156)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x66db5c95e17a5687), UINT64_C(0x50a3cb939c9fe317)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xba1ba314a59e209a), UINT64_C(0x9500719e1abe214c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x96fe1e4281c1ec7f), UINT64_C(0x5e626b2693407485)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x48498b710f2148df), UINT64_C(0x068b93babd3fb530)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1266128c5164b893), UINT64_C(0x8c68027c2abb8f9c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfaf39274bf161c12), UINT64_C(0xc4707948cd1ff089)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xa14fdcb9ec9dee95), UINT64_C(0xdc83a19a130535aa)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6dc2ca7ad78c93d8), UINT64_C(0x0dd6b4469fc935cb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5b661c65eb485d8b), UINT64_C(0x4baf8dfecc5c161b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1c4dad9cb863f4bd), UINT64_C(0x9d199ac0bc17e4e0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xccaa8326341f94a1), UINT64_C(0x4ad5e871bff2aee8)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x604e2bdda6c01952), UINT64_C(0xad04bf5a53c429ff)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x318e9ef6483a17c9), UINT64_C(0x498f53eb99a5f394)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcc29b3f55853af24), UINT64_C(0xf6b892243519f884)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe706e483f81f1c75), UINT64_C(0x4396b3275cae3e52)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9c91628109093426), UINT64_C(0x08c59a28d8ca6053)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x0986b31e2df7a4ca), UINT64_C(0x97e617d0a9a71d3c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x03c77340b750c415), UINT64_C(0x787d1a1a6b85b570)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf90a7615b1035738), UINT64_C(0x5d34ec9724b833db)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf3a5c24e533cd755), UINT64_C(0x5e80f0194c8dcfef)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4b6c14c541ff338f), UINT64_C(0xed611bbba57fd284)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xff1bf1145d76ea36), UINT64_C(0x3b95d53a77c7f9f2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4483cf09ec152a42), UINT64_C(0x32f2faf52cfc5f42)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x68f233278fc0c804), UINT64_C(0xa707c1b511af5c5b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x32c7ec9ac23418f2), UINT64_C(0x7c28a8eb9e5ff686)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x32fbd4cc96691aed), UINT64_C(0xef5fda3c71d47fc7)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x6ef1a0922f05f942), UINT64_C(0x2285ba913fff78ec)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x24b37103cc05c2ea), UINT64_C(0xafb078f35a2c7c81)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9142fba1cd4f0642), UINT64_C(0x25554f9ed834d0cd)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcb8fec7c80e991fa), UINT64_C(0xac4cc49aade1dce4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1144633b089e36c7), UINT64_C(0xcc52eb9e8870a29a)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x697ace3b45e47c9f), UINT64_C(0xd5621c50ee7577c2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0f3319fe624050e7), UINT64_C(0xf6648d361532a618)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x24707873f43c8385), UINT64_C(0xd33012470e89d4f6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xaf4df0a8b4566f9f), UINT64_C(0x8af8750f9e835432)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2877772c14f205dd), UINT64_C(0xd4a3561868f0d595)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xbd58bd1e3e281694), UINT64_C(0x455fa7ee36c44fe7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3a2aeff1cc9cdb92), UINT64_C(0x44cec9bbfbcf0568)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa8b12e65c5c4f77c), UINT64_C(0x0f024e317eaf231f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x44f727e028f041ee), UINT64_C(0xd7309101c8d760dd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x32818ba35473c3d2), UINT64_C(0x21c38ec97672dfa1)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xa734f3f251277d55), UINT64_C(0xc0a0df01662e81d3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0e432962ef5d12d2), UINT64_C(0x684296ec07e5d69e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1bc832f64244e9a7), UINT64_C(0x27bed10eb6e66ba9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb6a6c4c20768e129), UINT64_C(0xbe0717b1f4519a90)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xecf8c539593cb160), UINT64_C(0xf4dd68963d57936b)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xead61f4af6e604a3), UINT64_C(0xe40b15d8526c64d3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x45bb01c537aecd39), UINT64_C(0x254675d037b1ae07)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xefa7c93717a90d2b), UINT64_C(0xcab6b0b87ec81a0f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9597c2a74ee70109), UINT64_C(0x967ca82c39ddc566)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7b86a88df205d416), UINT64_C(0xc90206520b07b992)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd89e83ce84c39c22), UINT64_C(0x25e8fb41b2c42c06)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcd596ca143f6950b), UINT64_C(0x92e7fe4dc94821ec)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x34793c96f9ba604a), UINT64_C(0xd511b7d1af381516)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6650857eea229c42), UINT64_C(0xe1a8e6881438edbe)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcc5760a13ef0690d), UINT64_C(0xa4112923f6cd17a4)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xac60128db4238b3b), UINT64_C(0xd2b954066062e2dd)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf80a01ae716c84ce), UINT64_C(0xffa24c8aacf6c65e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf8b239716e5e55a3), UINT64_C(0x0654173b9eb9a934)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x62ca0180e55dc5d8), UINT64_C(0x9f7c000aecf3412b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa98f28202c81033d), UINT64_C(0x36b548dad6734e73)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf27851663e6e2039), UINT64_C(0xd103e3becd07b771)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x00f5a7e9da968640), UINT64_C(0x87d020347b61bbcf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3f9a6186eb5fcd5c), UINT64_C(0x5c8869f9798a6e45)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfd0a75d5c6120dd5), UINT64_C(0x601dd60f5fca40a6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1f56317ea090710e), UINT64_C(0x5c27ea8cacf535aa)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x044364716fcf7c20), UINT64_C(0x07afc417919b42b2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7efb47f3e030160c), UINT64_C(0x8a2720201395e273)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x48fd4d40d746a758), UINT64_C(0x8a140e43124f72c3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2a1fc81101a5117c), UINT64_C(0x408e096612858a40)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcfa48d88293266ae), UINT64_C(0x99b42300739aa7db)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xfa003b53b93ba4a4), UINT64_C(0x9022bfabf88e79af)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x75256df590fcd0a5), UINT64_C(0xb497fa3a2bb4c338)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x48de347b7d74943a), UINT64_C(0xbea2fdf5f0651b73)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xaeef71447cb29114), UINT64_C(0xabf79e0f5948d4ce)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd4c846b6cbb52a9f), UINT64_C(0x2d9d3407d7efe4ee)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3d55c5c4bbc2adec), UINT64_C(0x2a1c148f82ee7178)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe1da0a9cf7fe742d), UINT64_C(0x79d4bd655db4df30)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8c7458243335fb65), UINT64_C(0x2ec23d636043f553)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9b3f3eca64bee9e5), UINT64_C(0xcbca6f067961e0fb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeba7de37a1bab6ef), UINT64_C(0xe1f12825bddf3c35)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xebbc8494b1626f73), UINT64_C(0x3a8e5f2f4651af95)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x79de962ffa26768c), UINT64_C(0xdeb2a126fee3dc69)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb78a8d71cec303a9), UINT64_C(0xfebbef82c382b2ca)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4af8d7cf59cb97dc), UINT64_C(0x8399ba40277c7c92)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x46d2254788a4de33), UINT64_C(0x5fa706fe581c62fd)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xfbdf338767380d28), UINT64_C(0x84d6ea032a617420)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd67770449c7ee1d2), UINT64_C(0x857d9da3810d3142)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc3a990b4e823e0d5), UINT64_C(0xd2a7657f965ba1c0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0f7e764864ee5c9f), UINT64_C(0x6c163de1fa95772d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdbf1d8c61e25bdd4), UINT64_C(0xf7f19773f622b9ab)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xc8ccd8e45a511c30), UINT64_C(0xb34bf894f3fe7a75)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7c4142ff4683f1b1), UINT64_C(0x09a789057feca0dd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5e6b068579f3e306), UINT64_C(0x0eb257ed7dd7e04d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa54cd6245421fd90), UINT64_C(0x8dd83bb1e02e8d8a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8c9407fbfd10387c), UINT64_C(0x0ccf38b7d594526c)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe7a6185b6bf869b2), UINT64_C(0xc7e6b3c6312a8f92)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xee93370ccfef0bc7), UINT64_C(0x482e7f81a490e0d4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8a93876cef63d68b), UINT64_C(0x54e442f7a07ac64f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7773f1e9fc54b900), UINT64_C(0xd18bf1c157e1c0a2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0289b6bf6fc482dd), UINT64_C(0xd378523e0833d5f9)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xfb3393a935316554), UINT64_C(0x5454932a9b8e6063)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x24fa60f0da63cc94), UINT64_C(0x4bcce0964ba095eb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbdbb5301c0708056), UINT64_C(0xd852456ba0f53808)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x208e5f3bdc78004d), UINT64_C(0x2cea5f4791635c9f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x322f475a6e232baf), UINT64_C(0x909463b5caa1ff08)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x24229e8f97825871), UINT64_C(0x0649d45a4454331f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8438b7c0f2b89638), UINT64_C(0xc7bb02e6e655520a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbf7f3c50b9cb7c8a), UINT64_C(0x372413fb2a154266)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1a2aa4a1473d636b), UINT64_C(0x49adb72baabcf80d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x11722fc6c7cfb230), UINT64_C(0xdab603349aac0efb)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe91ee4b97682e14b), UINT64_C(0x19c91ad550d8a815)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x229d9dd2df998add), UINT64_C(0x8d54525193f80643)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2e6630d9c745f080), UINT64_C(0xef083ace0c27a5a2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xcb31f034a60dc4a3), UINT64_C(0xb067d66349c6aecd)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x67eff54570d3aac3), UINT64_C(0x5eeaae8e0e2f900f)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x6d302c37fc3a740f), UINT64_C(0x9f1737066b80cea3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6ee833f3efe41ae9), UINT64_C(0x02ad10cec45279ae)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x183f5e89cad36aec), UINT64_C(0x0ebd73288618ad0f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x74b1901652d8e880), UINT64_C(0x7ed9b3e983ebea16)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x40bdaad660b38866), UINT64_C(0x211001db62cf6a62)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x20bf33226c380bbb), UINT64_C(0x26e9a4fc04878ee2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9965f1f0a10b4263), UINT64_C(0x9d90075cf0a26c9d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xbd90cae7f61d22dc), UINT64_C(0x5dbb7f134d9cd6a9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x15613d8858bf0f34), UINT64_C(0xa8063aaebc321aff)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3bdcfe7f558a2b33), UINT64_C(0xf7c03c713f148fb8)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xd73d0541708381b3), UINT64_C(0x25fd4c808cca0941)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xc06a44c6a1f718be), UINT64_C(0xd7d64dbba028645d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfd4467d710e2a232), UINT64_C(0x6386b70e1a07d54d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x688711e0badf79f1), UINT64_C(0xc0ccfbda257f97ac)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd2577c8f6d601744), UINT64_C(0x59df37ffc6a4f88a)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x07bc42b80b865a22), UINT64_C(0x8cfa1b1e39106f64)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x83d0128023eb4000), UINT64_C(0x7b12192a8852fde7)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1d5287098122115d), UINT64_C(0x5d2049c648cbfea9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4f77f51ad53167fe), UINT64_C(0x4b82daaa9e1729f9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa1670a10ee217f0d), UINT64_C(0xa2a1f28adc708fef)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xea63c330db607a3d), UINT64_C(0x4514dbefb3c734dc)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfaf4142a40c2294d), UINT64_C(0x37a1b8903debe351)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf126f2a65b749e06), UINT64_C(0xc0dced958030c6ec)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x93b55e59db36a43b), UINT64_C(0x0e47a29e59dbdbaf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0138bf8d3562d55d), UINT64_C(0x1abda544710b38a5)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xac35603f6703327a), UINT64_C(0xefbccd0f5a0c72d1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf6a6e531f45aa167), UINT64_C(0xc329e2fe7ff4e76f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb1b7d4f4d9351c11), UINT64_C(0x206eec4a2bc98f97)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb047600671ede376), UINT64_C(0x9d20d80a24506e7f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xed11688182f094dd), UINT64_C(0x079072e98d16cc40)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xde9ba85eaa752698), UINT64_C(0x7cb726a6e0c4c5bf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3d109dbc97899953), UINT64_C(0x258600cb0dfe2be2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2c2713105fb6cc1c), UINT64_C(0x003044a770c8d4d8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1f713d6a5266d8fe), UINT64_C(0x904f39854460c832)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xffdccf37060e1701), UINT64_C(0x1250344d93815c19)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1583f944ee482b2d), UINT64_C(0x2edbef90cc016ec0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x64b4faa4c90e50c6), UINT64_C(0x5f47060a67b1fe8b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x13fcc162e245b1c8), UINT64_C(0xe9014347d90176dc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9f6f5d4ac2e291a8), UINT64_C(0x063449037942b537)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3c35ad06c8807350), UINT64_C(0xaf9ca6d464506346)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe9ace5594981d96f), UINT64_C(0xd22f89bcb7f64f57)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1f50241218181a18), UINT64_C(0x14bcdd97ec014f27)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6986bf3f4d2fe997), UINT64_C(0x5277c780c5cf3b5d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6cec260ead6ab31d), UINT64_C(0x1340c1c441cdde64)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x040561af846072b9), UINT64_C(0x6b3ed8937419c383)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf023adaf19d84bd4), UINT64_C(0x288a8e4b83da60f0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa0549e2a3de5989f), UINT64_C(0x4da15ef2a1064191)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe22de3f394b3992e), UINT64_C(0xe007368a95c36189)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8f3e43cb9237b159), UINT64_C(0x22a94529ec3a4671)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x632f0cae1062d257), UINT64_C(0xd226b80c709b6fdc)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x4b86ed81f0703eaa), UINT64_C(0xf05c542af2e1bb17)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x173452ef014b2b0b), UINT64_C(0x05d96c62b0055a4d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa1a0892e10051659), UINT64_C(0x54a2f57c1e1e48e0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb491e049f6e2f68e), UINT64_C(0xd0bbc7f29f6bc479)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x38fa5c6763f84ec9), UINT64_C(0x90a0891f5ca56c28)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8c18a6ba92e985e9), UINT64_C(0x6e0c4ecf30bc69bf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x934861f1b7d55323), UINT64_C(0x305ac2cfd61e2553)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4dbafdd8a538f326), UINT64_C(0x9a6da797c27ea7fd)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5032877be60e1de0), UINT64_C(0xfec8441eb73287a0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8fba89a40564d6db), UINT64_C(0xb8262c2ff9f538f7)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x203fe264b0ba9a1b), UINT64_C(0x5fdee0bfc31263ae)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf6da1d89b9de8d31), UINT64_C(0xa75d56336dedfb4f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7e8fd93f03174f50), UINT64_C(0xebfb4b8bec0afbb4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5bb92cc10dd05809), UINT64_C(0x0cd31ab57e2f3eb6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x53f9ee37c266d0ee), UINT64_C(0x6031fa1aa7d50f8d)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x966c5be3a8f2b6b1), UINT64_C(0x4661ca96b7a9ba94)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa60df0736b0e1ffa), UINT64_C(0xccc9cbcd6983d116)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1a899bb554deb9d6), UINT64_C(0xaa2625b74ecefbd6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5c97ef19b2bf8ee4), UINT64_C(0x216c46d7f874a35c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x266ed394e4462df6), UINT64_C(0x8bce3d7c94ddfae8)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x53c756e23381363b), UINT64_C(0x9155e8e263d6dbb6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd490dd8e2140f0b0), UINT64_C(0x40e098ae333dc46e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3dad710a847b19d3), UINT64_C(0x0d5f56d6f418d5d3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5bc4acf9bb524463), UINT64_C(0xfbc3485d879001cb)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb0cdc2039c57eaef), UINT64_C(0xff6cc7bef564e288)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x60ef7ec5eae0e075), UINT64_C(0xef3eadf428008a27)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4854e164cc3e78f6), UINT64_C(0xf4f6ec34e23e4085)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc40ef9d02b7c0d82), UINT64_C(0x8995e7ff716fa78d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x933bf157b7840209), UINT64_C(0x7ae95785d802008d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4383a3b45a9b06fb), UINT64_C(0x6462995c1cc7fb8d)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xca424ece3cd040be), UINT64_C(0xcf0a2cbb5f27e8c3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5ba68c6c91b90156), UINT64_C(0x2790c2ac9f188735)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5a64b86e96c6da85), UINT64_C(0x422a5a0ef8f4fb4b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1c32cd0632a93d06), UINT64_C(0xee92778b86cb720f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x587e2ce7caae17f4), UINT64_C(0x3ea0ef453979edb3)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x809aa309db77f682), UINT64_C(0x59aa0d7258bbd4bf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9949a5f30cc28e82), UINT64_C(0xd80f2d52130c0b85)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x12aec073c8abbf87), UINT64_C(0x17f8e98fef861acc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x37987c4cf06796f9), UINT64_C(0xdd5fc02c4dabdfe5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x09e7aec5a9cf7963), UINT64_C(0xe0031c601639d373)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd950e95a3567d18), UINT64_C(0x1c168086755ff140)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x66112a4e447b451f), UINT64_C(0x9270abb43b4ed327)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7af159d06603ec8e), UINT64_C(0xbe559672b23687c0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x72cb6132d6390e1c), UINT64_C(0xd674ac9f59ca8af6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe2ce2fd6a9eb2dc2), UINT64_C(0x7485747274d6a30a)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x5a3656cbe35307af), UINT64_C(0x58d3fbc34aa9bc8c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xab865da66d51cc67), UINT64_C(0xdb42ea96e35bac5c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7b7ce250fc27778c), UINT64_C(0x921e5ed9b206ed2d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7aad138ce9e2fde2), UINT64_C(0x0dfb597f40d6c887)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2c25fc59ea5c3a09), UINT64_C(0x6d796927822f36f1)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x07bb942f0a6ef85f), UINT64_C(0xd2179a4c4b219a93)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x49ef06bc5f9bca6f), UINT64_C(0x8733d3cad3a90e59)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0cd07d73db98de3b), UINT64_C(0xc59dd09a75d1dfa1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x068d79667c08b7e7), UINT64_C(0xf01d426e53ef7297)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x32d6a20d81b66869), UINT64_C(0x9ae9eeb0ab1c2f86)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x8c6035475facda58), UINT64_C(0xe5050bd5bfd744d2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe5a9e8f763d67df2), UINT64_C(0x6a6c8f0c7aaa4a11)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xaed553efcc79ef6c), UINT64_C(0x6e01daf8616ba6bc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7de6222041a3fa52), UINT64_C(0x4703420ccfc1278c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2595f5bb96ddebc7), UINT64_C(0x878e185265076af9)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xea459da9c7464997), UINT64_C(0x262cb13c37576662)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x93355a09a58912c3), UINT64_C(0x900a2b5e3956a003)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x412ba70e5ff52a6b), UINT64_C(0xa99b2e25ab47d727)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x707a994e80f2c9f1), UINT64_C(0x4bd8c4ae49542ca7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x366f3c4b06b2380b), UINT64_C(0xd9bc8d415dcd3327)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x184c6c36e3e272f6), UINT64_C(0xb5b369af8699c426)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5ed433dc684f8da2), UINT64_C(0xc826b1e373041177)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4b46cce59498b3c5), UINT64_C(0x48e27d6d46c8354e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x65296b2e7b8fed9d), UINT64_C(0x094458626f9eff07)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x91e19f87d7b1d16e), UINT64_C(0xd80beeb54e948f66)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3e6bfcbb98e2c71d), UINT64_C(0x54612d6940fd1cfc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xab99e29b6be41eb3), UINT64_C(0x5a0c75d6749bc30f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeb0316ed7af1076c), UINT64_C(0xaaf9afa8185536ec)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x971da4e08445aaba), UINT64_C(0x9d9b44746c9f4d91)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1dccd8e5fd0ca430), UINT64_C(0x6297011056083697)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x2d0c90b3b6fc1726), UINT64_C(0x1b709302269e11e6)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa24c177a68d9bd73), UINT64_C(0x36def79632e4b4da)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbcff257a49d5464f), UINT64_C(0xa5b1b592922b226d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfb9f6ae2446d5456), UINT64_C(0x9ecefc96d4cae133)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc542a33b4517a779), UINT64_C(0x98def2af09175a83)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x093ccf7f3dac3346), UINT64_C(0x20510f603ae6c371)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x3bd1597c70d42bb8), UINT64_C(0x9c103293369e42be)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x71c8e0ef72149b4a), UINT64_C(0x397e436871bdb339)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd53fa1b2f3a9793c), UINT64_C(0x756bf55cf97b9170)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x61563b9b1dc39786), UINT64_C(0xc692c54fbc7e9e8c)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x657d58a8d8d4dded), UINT64_C(0xc8f534394d1bede0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x91ea3360e559aff0), UINT64_C(0xcab030c1bd20a746)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4681ff69899b4bc3), UINT64_C(0xfdc32d537fb64fa1)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x823895e0ed487b98), UINT64_C(0x5670fb9a6826e63a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x07d373a484f0721e), UINT64_C(0x4892028fad73136a)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x7ae5ac1709250380), UINT64_C(0x7bbb134ca64d294e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0f2f0317e63b4308), UINT64_C(0xf7c43cd9b5ead156)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2b5d064aa44990b3), UINT64_C(0xa188aa68727beaa2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x19162efca59dc6b2), UINT64_C(0xb0bf81f07e92310f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6d07d27c271cdc66), UINT64_C(0x2571ba47c7cb56b2)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x3abb5515018685b0), UINT64_C(0xc5266778ef901215)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe49305d74238ff01), UINT64_C(0xb1d547bcf878f732)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x76b7aed50a3f5dca), UINT64_C(0xe5a17e30e1fa4f5b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd6117dc43a5e2e90), UINT64_C(0x31400b34b6687e0a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x26a65b00171d02bb), UINT64_C(0xe45a8fe5069a42a6)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x94b875e6447684a3), UINT64_C(0x6cce75654622ef75)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x39793aa8c57b863d), UINT64_C(0x6e2c151fe1a0f347)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x21206df04bc8cff6), UINT64_C(0x09b8e97369850e21)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3502ff35eba08ca0), UINT64_C(0xee031341c49c139e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x50be62265bdd4f98), UINT64_C(0x976cceebdd3f8104)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x25cf6c38b2302d1c), UINT64_C(0x7b375c96d80a22e0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5f872ee4caa4c320), UINT64_C(0xa198df97f068ed76)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa6f55e7682aab991), UINT64_C(0x01352caf75f7d1bf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x10ad22954ae6e35f), UINT64_C(0x8ffcc1be69f726bb)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x01eae3afa560df40), UINT64_C(0x9072c7d8dbf14f94)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3306138dc9acc865), UINT64_C(0x9e9f7abad5851a06)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xabd68f390fac9cea), UINT64_C(0x34681b48fd3f059b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe3440f1a99fc01a6), UINT64_C(0x117e1d8f43c6044c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x688539b3beda3ac1), UINT64_C(0x7c9ec823c1d39327)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x00f7ec59e156c38f), UINT64_C(0x5d09842a12216ef5)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x069d52d973ada812), UINT64_C(0x10f405fd8086f90e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8b6061c7691a082a), UINT64_C(0x19e906c6a6accca5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x02e0b7f5bba90718), UINT64_C(0xc4f543cd071301ff)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x87cee561ad2c6c3b), UINT64_C(0xffc76353dd08bffc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbec9a941dd22e977), UINT64_C(0x477819c7b17c3a11)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8591e3a1ada6079a), UINT64_C(0xaa0d31cac0baa8c5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x463b46e9d84a8ade), UINT64_C(0x746fc92b0289f764)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd433cb56a8a8415d), UINT64_C(0xbd07477a87fa3c03)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xceb733688f77a14d), UINT64_C(0x406ee93e3baebded)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x59a2a17cce97bf54), UINT64_C(0xd7299e6525570d58)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x8abd8139e51ab1a4), UINT64_C(0x5a64aed16c083130)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x43dc73e0d878e2db), UINT64_C(0x7befd3209ec492d8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2b6578b0276e44ba), UINT64_C(0xc9c1a786089af728)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa98a3553b9236739), UINT64_C(0x701b5f2b913d3648)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x12daaea29cfd04d1), UINT64_C(0x1378389869df7dd5)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe63881532ad07399), UINT64_C(0xe0e049785024a25f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc47798cbc18f7204), UINT64_C(0x190e3d627460c6c8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x594a165c4f02e1f7), UINT64_C(0xbb53c9dbc0e068b0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x4cc34e68c48e5731), UINT64_C(0x3d587d538b7c0aec)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf3d317c77ef65935), UINT64_C(0x92a7b248be5d237a)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x1d98eff1955ca1b3), UINT64_C(0x3e9ac25d501ec799)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x5afd37026947eb1e), UINT64_C(0x3831b445877b4f1c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x456a7754167bc5f8), UINT64_C(0x6423c1f3796db7f3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7df3a1a78c63d6af), UINT64_C(0x8d120fcc7f473c3e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe1de36bfa4ca4988), UINT64_C(0x4730a63a1d026344)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x35348f69c6cd9c86), UINT64_C(0xd5967659635b7bbf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xcf39a7198419d725), UINT64_C(0x28107fb31515e9f2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc377dec1745bbde9), UINT64_C(0x7085e593f2d7df9f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4c08d21c14b15ac1), UINT64_C(0x8ee27842a6ddd890)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x400cdb415e42cc1c), UINT64_C(0x4a3ed591f98254ca)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x5e6a00aa1a4a3935), UINT64_C(0xcc4ed3dcc607b369)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2e45cc3d9246b1eb), UINT64_C(0xb9f29b6e620b7252)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1927e9e2e6683bbc), UINT64_C(0x459625db820208e9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x733da5fa2f5dcb03), UINT64_C(0x272b8801c513d525)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xe13681864834e91c), UINT64_C(0x4f2905385c3f464d)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x619a12e0207a95bc), UINT64_C(0x25d51475b4338ed6)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xeb8e2232f640c3f7), UINT64_C(0x26c0d6a75ad08bc3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xce43e8aaae2c99de), UINT64_C(0xe80cc20091c6da37)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x715b95407e763e0e), UINT64_C(0x482a802846afe937)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x42bdf15eceb64b43), UINT64_C(0x28f5b8acdc7a93fe)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x9ba72c4408015f45), UINT64_C(0xfbce21909473209e)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3a988015dacdc5c3), UINT64_C(0x75a50bd84878070e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfa91c34c222f35a9), UINT64_C(0xda98863ceb265cae)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x56d036bfc74868be), UINT64_C(0xbecfd44884390960)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x005c111665e53bf1), UINT64_C(0x7b629de7fd2224ea)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x9ccf58539a8fc229), UINT64_C(0x940d450aa31ab461)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1768b3c8539e3786), UINT64_C(0x86745b750bd27b37)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9c2ec5714fa28b13), UINT64_C(0x299abe10dcd54c4c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2d577360d313561c), UINT64_C(0x0ff1dd2f228c889d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x8227757d179867f5), UINT64_C(0xc3e336e8530a683b)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xfee062da1e91c4e2), UINT64_C(0xf1e03b24829c778c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0a311c525824caaa), UINT64_C(0x1c3aaff3f585c098)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdbc3ce4b250d27a4), UINT64_C(0x20a1c7e36be1cf94)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x608d5fee46426bcb), UINT64_C(0x540cf503c56fe9cc)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x97eef411b89eab5e), UINT64_C(0xaaf95b5d3a3e8618)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x53bbddfa7936fa78), UINT64_C(0x8912f5b509c50d07)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x30f1a030999f38c8), UINT64_C(0x61ca5e085dbe369d)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeea6b3b7c3b6e08a), UINT64_C(0x7b547509ceed7ada)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa27f099e134cad08), UINT64_C(0xb23f1c84107aff7f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb9bed5d8368c5614), UINT64_C(0xe1782b08c0503819)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x93cbc873ca237567), UINT64_C(0x112115299a71ea78)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1fa031642dec077b), UINT64_C(0xbc3e86236963d891)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x32f961061fa9ee75), UINT64_C(0x4254eeef94ce2af0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd7bda8ccbb91da8), UINT64_C(0x1554f4841267b3c0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x67c573e455904b0d), UINT64_C(0x2b664b126c5d4cc3)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x88cb46806419f9fa), UINT64_C(0xe07020d3b8dbc4b8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1019fa6a3dcf0e65), UINT64_C(0x90cbfccffde514e5)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9a26c238c104e9c3), UINT64_C(0xf9c98d48f2dfa4d8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xa9667b07a4196ffc), UINT64_C(0xcb0f1b9755bf81ed)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xedd58f1f58e9a028), UINT64_C(0x0d40d074165b5871)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x15132649d7c11fb4), UINT64_C(0xbdc2e098c5a64f6f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x360e867019068ff9), UINT64_C(0x9b35b297a69c064c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x81ca8406da4ebd33), UINT64_C(0x350146d288a71e06)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xce4c8ad192e5e039), UINT64_C(0x3f4083a29534e703)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x209dc9b84174b996), UINT64_C(0x4b5895c64ae549c6)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x89c6f2779f79d23b), UINT64_C(0x4752f7bc0ac56531)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x32b50e5d9f55e2d5), UINT64_C(0x77048f344086dbf2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x636f798f052f6f0b), UINT64_C(0x09ee9b34b5bc44d8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xface5729fc84f1df), UINT64_C(0x46747159633967d9)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbb7c0fe0585400ea), UINT64_C(0x449307220ab45bf8)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x7e57b436fff593d1), UINT64_C(0x9c5ac44125010d8c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3f4b2c5eb3173565), UINT64_C(0x33b9d09c981a08fa)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x17bf750cb9c46aad), UINT64_C(0x18cb07e1b875c772)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x17c1ff978dc8623a), UINT64_C(0xe84146fda7a0229c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x52797e64f9a4eabe), UINT64_C(0x6742baa81ef1e47e)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x74868555128fab2d), UINT64_C(0x194b6254a5142ac0)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8aad2206acbdefae), UINT64_C(0xf977d45ad47cf5d3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x9f4bcd1f85463ed6), UINT64_C(0xb0526a0047b3a843)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5195d7ac83242ac5), UINT64_C(0x9de8c2f644942cd1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe981a85bb5b49013), UINT64_C(0xe55f08ab1fceb9f3)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x3a2998e3d9497250), UINT64_C(0x511c4ec8e6051520)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3ce676cff7264d77), UINT64_C(0xc55e9ffcdda39172)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x47ed9053e900e05c), UINT64_C(0x7442771a53708a80)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd2d520cc7531204c), UINT64_C(0xf4abae9c9d3041c5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x371d81fa6602c5c2), UINT64_C(0x5dfab38698da5bbf)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x0f6576290edecb96), UINT64_C(0x14c0ac67cbbc2f01)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2b367fb2bf705f20), UINT64_C(0x5268476c18468ff8)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xfb87657fd92ae53a), UINT64_C(0x0dc1d1a41ba9e6b0)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x37771194ab3113f5), UINT64_C(0xd585a049b5d9c210)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xeca5d051001046a9), UINT64_C(0x8da5052fec8bf884)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x99b68ca600060497), UINT64_C(0x9d46b6e489546471)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd63790e8c691e857), UINT64_C(0xc306d8db9bd0a1e7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc4dd65207dc2e89a), UINT64_C(0xc3d000c96b7f2431)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xf04e989f004ee797), UINT64_C(0xa44b12cc5f016a4a)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb43064ed72feb2b4), UINT64_C(0x628c6fcae18392d5)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xf3597e5f0e8f9b1a), UINT64_C(0xc8f5cae9c9a4050a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6b95fd0f2323b33a), UINT64_C(0x16a3bede7073e1a1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x029b44c3cf916c31), UINT64_C(0xb6cd0db11897bef7)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa60f5fdddc883b9c), UINT64_C(0xd200a60cc03dde5f)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x677bdedf2b9b1a4d), UINT64_C(0x0d0f39df9860e0bf)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x98b66169c574bfc2), UINT64_C(0xf4c3c64c4f524fac)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x57170635f8173428), UINT64_C(0xed0b9fe1efd981f3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3e727d383d5c83cd), UINT64_C(0xb7869acb738fdf2f)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x016da0d19b469d6a), UINT64_C(0x77bd67ed6403bfba)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xb397a1906fcca525), UINT64_C(0x8ad0a2d7cc7b1d50)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xa7d2193a61619122), UINT64_C(0x0a3e5f9c74cbb8e2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x4e6bbb47a3b8d8bb), UINT64_C(0xe32e2a509daa01ae)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x69c671828d209c79), UINT64_C(0x7970ba89a588e260)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x048a690ca8d6f462), UINT64_C(0xd811a48b488e857c)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xe23f70b857efa07a), UINT64_C(0xc3d473c7111637ce)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xc10bce28b85496b6), UINT64_C(0x1c3939b9e77e3bf8)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xfdaf595df5d5e888), UINT64_C(0x1001f463989bf28e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xefe7ea65121236d6), UINT64_C(0x2c31f315f412f34b)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x1e739b42bff5ab4e), UINT64_C(0xb1eacdf7f8622b37)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xbe2abccf7290b718), UINT64_C(0xa4a5ddaaf737335f)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x65b465a7abcd402e), UINT64_C(0x0e2fe3cc88a02a15)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5819ed3f734df138), UINT64_C(0x23ef6d64c5377bf2)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xaa99bf001072a1be), UINT64_C(0xd63eed17bdd01b55)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x987f46c1fb561a7c), UINT64_C(0x1dad301cf6773744)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x1aae213334ebb30b), UINT64_C(0xa0d8bd471b8f82b6)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xbfe0026922bf8ba9), UINT64_C(0xd1de52d2c764b6c4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa2f150749f388c8e), UINT64_C(0x02a3080e84984367)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x2c8f93d2c72ead7e), UINT64_C(0x8f9d408b929baea1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8f55efcf31763760), UINT64_C(0x92255e110c44f49c)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd39e07a9b6b6cf59), UINT64_C(0x915349cc7541a495)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x423479776cb943f5), UINT64_C(0x7cf797aef5f2e129)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x09c21ce70d483fa9), UINT64_C(0xce43fd2bbebf4bcd)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb62916af0ad415e3), UINT64_C(0x7603fd13ac460159)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb9af8349f010958b), UINT64_C(0xe69cf5b5ee56d81a)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2cf497ba97f1fd3c), UINT64_C(0x9fe0eace76827eb2)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0x2a2cddd2406d8357), UINT64_C(0xfded293a6560a5e2)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc0a4b1169a38c363), UINT64_C(0xd4a777750ce5eaf3)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x24d15ef23b74761c), UINT64_C(0x5918fb0cf6bc6714)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x8173c50b8e734642), UINT64_C(0xff4b4356b80a8f01)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x6c34a655be143293), UINT64_C(0x31bc00e0137a22d8)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xe75fd764cd452bc3), UINT64_C(0x1dc8a62e5e097df9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xf2f14b24a5400e6b), UINT64_C(0xb95fde9e87c863ad)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xd41b7941b6b474f4), UINT64_C(0xb97033f2092ff4b4)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x87d9a3b6e579eeee), UINT64_C(0x843fe5ea5ebc7256)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc955239ec4623400), UINT64_C(0x3a1f7fd17d781e18)}},
   {{ UINT64_C(0x0000000000000000), UINT64_C(0xb46ef07721d70da9), UINT64_C(0x2c87452269da69ec)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x57c842cc5d6fd7b5), UINT64_C(0x730d1c25da1b29b1)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xa0f25143527f76ae), UINT64_C(0x2d94bb3ee852f2c5)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x9c4bdcaf326de7ae), UINT64_C(0x0ef9918b9a1d9421)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xb75e460af94504e8), UINT64_C(0x4ea5a602e9b61ea3)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xbbd88787663d5914), UINT64_C(0xa4861c1e16e92017)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x36ec31e4472bb559), UINT64_C(0xc60dff815161e5e3)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xeaaa6fcf3718d61b), UINT64_C(0x2ea2a2b2c7798d12)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x177d2194d5fe9d11), UINT64_C(0x6e4665bf61662e14)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x0dd26a9836f53075), UINT64_C(0x9bf36e78f1ffc3c4)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x137677247f31b4a3), UINT64_C(0xdfb3088bdb359ab9)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xc7a1c1b8a67f4a25), UINT64_C(0xa3320f5401acf50e)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x37daa1597052df68), UINT64_C(0xe068080dc1f55d35)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x7b1e8eb02688a497), UINT64_C(0xfaad3ba5ac15e7ef)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0c19832265156953), UINT64_C(0xc41fc075406f213c)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x927d84c878d41520), UINT64_C(0xf5d3025faef708bf)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x2f33ab40b4415e48), UINT64_C(0x045b6a264591c26d)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0xd02bf4defc3dba19), UINT64_C(0xc86d4bcb72dc8ebf)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x72a5997ec04fc04b), UINT64_C(0x5a619c2614714cab)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x6785c3697638e12a), UINT64_C(0xd31c3c1530ff13e1)}},
   {{ UINT64_C(0x8000000000000000), UINT64_C(0xe2a1191e7d5f8264), UINT64_C(0x8ade111f9835891b)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x5bb4ae6f2b9fe94c), UINT64_C(0x83a299a1eac0d584)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x7715385a768dd18e), UINT64_C(0xa5a3e911860536ea)}},
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0xdd01c8dfef25fcee), UINT64_C(0x0fb4a99e1faac150)}},
+  {{ UINT64_C(0x8000000000000000), UINT64_C(0x3bc3c42954227f47), UINT64_C(0x84eef1202d12f25d)}},
 };
 
 static const mzd_local_t C_0[] = {
@@ -1863,24 +4210,44 @@ static const mzd_local_t C_2[] = {
 
 static const mzd_local_t C_3[] = {
   {{ UINT64_C(0x8000000000000000), UINT64_C(0x49856dddee063660), UINT64_C(0x3d9c4092e4214ccd), UINT64_C(0x0000000000000000) }}};
-static const lowmc_round_t rounds[4] = {
 
+static const lowmc_packed_round_t rounds[4] = {
   {
+#if defined(LOWMC_INTERLEAVED_LK)
+    LK_0, Li_0, C_0
+#else
     K_1, L_0, Li_0, C_0
+#endif
   },
   {
+#if defined(LOWMC_INTERLEAVED_LK)
+    LK_1, Li_1, C_1
+#else
     K_2, L_1, Li_1, C_1
+#endif
   },
   {
+#if defined(LOWMC_INTERLEAVED_LK)
+    LK_2, Li_2, C_2
+#else
     K_3, L_2, Li_2, C_2
+#endif
   },
   {
+#if defined(LOWMC_INTERLEAVED_LK)
+    LK_3, Li_3, C_3
+#else
     K_4, L_3, Li_3, C_3
+#endif
   },
 };
 
-const lowmc_t lowmc_129_129_4 = {
+const lowmc_packed_t lowmc_129_129_4 = {
   K_0,
   Ki_0,
   rounds,
+#if !defined(LOWMC_INTERLEAVED_LK)
+  KS,
+#endif
+  KiS,
 };
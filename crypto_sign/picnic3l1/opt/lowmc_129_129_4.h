@@ -8,7 +8,7 @@
 #define LOWMC_129_129_4_K LOWMC_129_129_4_N
 #define LOWMC_129_129_4_R 4
 
-extern const lowmc_t lowmc_129_129_4;
+extern const lowmc_packed_t lowmc_129_129_4;
 #define lowmc_parameters_129_129_4 {43, 129, 4, 129}
 
 static const mzd_local_t mask_129_129_43_a[1] = {
@@ -9,12 +9,19 @@
 
 #include "lowmc_fns_undef.h"
 
-#define ADDMUL mzd_addmul_v_uint64_129
-#define MUL mzd_mul_v_uint64_129
+#define ADDMUL mzd_addmul_v_uint64_129_packed
+#define MUL mzd_mul_v_uint64_129_packed
+#if defined(LOWMC_INTERLEAVED_LK)
+#define MUL_LK mzd_mul_v2_uint64_129_packed
+#else
+#define MUL_KS mzd_mul_v_uint64_129_645_packed
+#endif
+#define MUL_KIS mzd_mul_v_uint64_129_645_packed
 #define XOR mzd_xor_uint64_192
 #define COPY mzd_copy_uint64_192
 #define MPC_MUL mpc_matrix_mul_uint64_129
 
+#define LOWMC_ROUND lowmc_packed_round_t
 #define LOWMC_INSTANCE lowmc_129_129_4
 #define LOWMC_N LOWMC_129_129_4_N
 #define LOWMC_R LOWMC_129_129_4_R
@@ -0,0 +1,6269 @@
+
+#include <stddef.h>
+
+#include "lowmc_192_192_4.h"
+
+#if !defined(LOWMC_INTERLEAVED_LK)
+static const mzd_row192_t L_0[] = {
+  {{ UINT64_C(0x91d895ecdb28884c), UINT64_C(0x759546c7eab5b1c6), UINT64_C(0x32382adc69b20600)}},
+  {{ UINT64_C(0x99f9026f002451b7), UINT64_C(0x96ce1991fa7d0a5e), UINT64_C(0xe55d63824542a451)}},
+  {{ UINT64_C(0x820e88818e8f42ba), UINT64_C(0xbb1bcdf1d104c9cf), UINT64_C(0x28d59a65573baba5)}},
+  {{ UINT64_C(0xaded8dc02b0cb256), UINT64_C(0x3176eaa2e72757bc), UINT64_C(0x85a9f89edcc5f345)}},
+  {{ UINT64_C(0x4ac1998960f98127), UINT64_C(0x86918902f1bd5c4c), UINT64_C(0x0f8e19f30c84cd4a)}},
+  {{ UINT64_C(0xd260cc2341869ada), UINT64_C(0xdac71918aee92773), UINT64_C(0x48de818a97c1464d)}},
+  {{ UINT64_C(0xcd58cd5c100b43cd), UINT64_C(0x8823c5f90dec7089), UINT64_C(0xd779c3ef377402b2)}},
+  {{ UINT64_C(0xb78e8190fcd199a6), UINT64_C(0x08cb1e4448752bfe), UINT64_C(0xd4114b13fb37262c)}},
+  {{ UINT64_C(0xab0205453a3b2a43), UINT64_C(0x3f34c8dd9c4eb10d), UINT64_C(0x497aaa02942c3640)}},
+  {{ UINT64_C(0xfcff03ba4b5d836c), UINT64_C(0xfc267a181b0f8da9), UINT64_C(0xebfaa0d95fe78260)}},
+  {{ UINT64_C(0x11d375f0452ecd2b), UINT64_C(0xa3a1fcdd9570d157), UINT64_C(0xb64e216f8226dd93)}},
+  {{ UINT64_C(0xbf89972811594086), UINT64_C(0x04197caf432199b6), UINT64_C(0x36e132d0576fa3b0)}},
+  {{ UINT64_C(0x35b587a68e016499), UINT64_C(0xa0a5fbdd58ff5d98), UINT64_C(0x9e95a4bfcd0a151e)}},
+  {{ UINT64_C(0x10699bbcb81b59e6), UINT64_C(0x460b31fbfabe8001), UINT64_C(0xe096207b85769c88)}},
+  {{ UINT64_C(0x61890c2f3c812f42), UINT64_C(0x517aab59a935a37a), UINT64_C(0xcbc1bb84ee3849f7)}},
+  {{ UINT64_C(0xe1ba48e476348957), UINT64_C(0xea1ec91ae9eb8bea), UINT64_C(0x2086e558143c69cf)}},
+  {{ UINT64_C(0x2054f15ad471c638), UINT64_C(0x7626ba8563491c18), UINT64_C(0x5aff222539ad403f)}},
+  {{ UINT64_C(0x5614e8d95ed210f7), UINT64_C(0x07167c74be4ff046), UINT64_C(0x78b6e3abb35c8cef)}},
+  {{ UINT64_C(0x1ac8b52a6c79415d), UINT64_C(0x3088188d81c37894), UINT64_C(0x766d1e9f4a8e3d62)}},
+  {{ UINT64_C(0x72dbd7b0d2fa4da9), UINT64_C(0x39f2e512332c4586), UINT64_C(0x763d8cde3be4cb96)}},
+  {{ UINT64_C(0x53dc50b80a9a1d06), UINT64_C(0xb0cd11c2eba24b48), UINT64_C(0x30eb21e50b92961b)}},
+  {{ UINT64_C(0x4fef51c1c32b077d), UINT64_C(0x5c87960b440f4f16), UINT64_C(0xdd7f57d9bcbcc6b4)}},
+  {{ UINT64_C(0xaac3ec19dea729fb), UINT64_C(0xfe4333b4513ad17a), UINT64_C(0x988b1655e4776e4d)}},
+  {{ UINT64_C(0x62a60b7e5a66795b), UINT64_C(0xc4c814470f8e2148), UINT64_C(0x15c68850093e8067)}},
+  {{ UINT64_C(0xd4137b89ccec1c25), UINT64_C(0xce59009af12253c1), UINT64_C(0xa4d2214ea6831b0d)}},
+  {{ UINT64_C(0x32e27d8c1f6f40f9), UINT64_C(0x84749f39301f24bd), UINT64_C(0x91d36e97a1401bd9)}},
+  {{ UINT64_C(0xa994e8b6363c38e0), UINT64_C(0xfe4dba25aa02d979), UINT64_C(0x7f7f3ed625df14be)}},
+  {{ UINT64_C(0xc65e0bf0ec190e1b), UINT64_C(0x14cb364e03656a77), UINT64_C(0x2170f3182289e18c)}},
+  {{ UINT64_C(0xe4810d30a18e1a79), UINT64_C(0xa689e2b4477064af), UINT64_C(0xff89f5acffc84603)}},
+  {{ UINT64_C(0x9975b21635b7c4cb), UINT64_C(0x08efb5f2043e5543), UINT64_C(0xa41ac3f9c3010361)}},
+  {{ UINT64_C(0x17b51d2e0447ae05), UINT64_C(0xec693e31a697024b), UINT64_C(0x0fd633c8380464c1)}},
+  {{ UINT64_C(0x669ad5cc00e4c052), UINT64_C(0x079ff52efb13f7da), UINT64_C(0x6ab6c0dee9937ec7)}},
+  {{ UINT64_C(0x6b76aa3fc60da6bd), UINT64_C(0xeef90c694dac1c9f), UINT64_C(0x156c68688ccbf020)}},
+  {{ UINT64_C(0x194ff3990d242742), UINT64_C(0x6a76f479904b6e0d), UINT64_C(0xcf5030db3dd47855)}},
+  {{ UINT64_C(0x0a79972abee9389b), UINT64_C(0xbb3746b6cec972f7), UINT64_C(0x52897f573305ed8c)}},
+  {{ UINT64_C(0x2e1c64d8bb32b635), UINT64_C(0x2204559bb2ad1788), UINT64_C(0x841a5cdb39e4f985)}},
+  {{ UINT64_C(0x8758ed99994e0f74), UINT64_C(0xfe07303ff8b45ca8), UINT64_C(0xf0347b8bff11dd71)}},
+  {{ UINT64_C(0x06bdf0ac812f707d), UINT64_C(0x1d35bfc1fc3e9a91), UINT64_C(0x728d3c141259dea4)}},
+  {{ UINT64_C(0xdb49dd6b41267504), UINT64_C(0x32c91ad025bb412b), UINT64_C(0x3910637052ea17ac)}},
+  {{ UINT64_C(0x04810c7db19ca825), UINT64_C(0x0ee4a783559706ef), UINT64_C(0x25e2979bb380ea5b)}},
+  {{ UINT64_C(0xa50694a8b97067ff), UINT64_C(0xb198fe49f2d553fa), UINT64_C(0x950bb89f21c909c0)}},
+  {{ UINT64_C(0xded57e1dad436fd8), UINT64_C(0xc6ada6fa20667e9c), UINT64_C(0xee1ed12c44b962c9)}},
+  {{ UINT64_C(0x5d480f3842521113), UINT64_C(0x812fc1ce7dc781a2), UINT64_C(0xf629cf7d4eec1eda)}},
+  {{ UINT64_C(0x9adeeeee4d25c22c), UINT64_C(0x851b529ec41020e7), UINT64_C(0x718e3eccc741e69d)}},
+  {{ UINT64_C(0x4290b02ae3b6a025), UINT64_C(0x948618ca1c2e2ac9), UINT64_C(0x416870b422b2a8b7)}},
+  {{ UINT64_C(0x2980bc264c45ff95), UINT64_C(0xa837c42b9816205a), UINT64_C(0x89fdf5424331511d)}},
+  {{ UINT64_C(0xc7ca3e8612fb8c51), UINT64_C(0x4d17c747e87636fd), UINT64_C(0x1cbcfab187cc9544)}},
+  {{ UINT64_C(0x047b550e67d9be97), UINT64_C(0xc0ba95269617d83c), UINT64_C(0xe432aa653f10c41d)}},
+  {{ UINT64_C(0x88bbe8201000642b), UINT64_C(0xbf6877f6cf34b74d), UINT64_C(0x94f642e0e8c48f2c)}},
+  {{ UINT64_C(0x3fa1c020101f9b06), UINT64_C(0xf646818b941371b5), UINT64_C(0x692eea2815893e45)}},
+  {{ UINT64_C(0x797d709497c4e885), UINT64_C(0x11df1f456532c6e7), UINT64_C(0x4a2f68609288f359)}},
+  {{ UINT64_C(0x0689263504d9d383), UINT64_C(0x962ca83be8bacf34), UINT64_C(0x65594746e9238151)}},
+  {{ UINT64_C(0x943af4bc7053c66d), UINT64_C(0x7361e8f80285bdd8), UINT64_C(0x925584d0f0c8960a)}},
+  {{ UINT64_C(0xee3e6aa156db3c58), UINT64_C(0x397c7cdca26face7), UINT64_C(0x0b309f2aa73e4952)}},
+  {{ UINT64_C(0x9a7cd21c1da83675), UINT64_C(0xc680c07c9736927c), UINT64_C(0xe0fd77d69f75eac5)}},
+  {{ UINT64_C(0x26db465d6f59acf6), UINT64_C(0x5af368492b96e91a), UINT64_C(0x5865a1cb5ae92886)}},
+  {{ UINT64_C(0xb149059ebd5174df), UINT64_C(0xc16a4458592db4cc), UINT64_C(0x34dc20ad24b8b242)}},
+  {{ UINT64_C(0x5f81061ae0e77ddc), UINT64_C(0xe3afaac4d78f7350), UINT64_C(0xe60671c525282834)}},
+  {{ UINT64_C(0xd7abd8598e93dde0), UINT64_C(0x604e4dda842149a0), UINT64_C(0xa984e1988fab64ab)}},
+  {{ UINT64_C(0x9ad08c0eb176b06a), UINT64_C(0xe5a18cc0c405495c), UINT64_C(0x81312acfd9ba2346)}},
+  {{ UINT64_C(0xa7f2cbaec172bf4e), UINT64_C(0xe7cdb67c35118fb1), UINT64_C(0x643eeedf98872711)}},
+  {{ UINT64_C(0x8f80c3b1d3431257), UINT64_C(0x0c3e8fb120c622c7), UINT64_C(0x1de817c66dd69f98)}},
+  {{ UINT64_C(0xead96c4e7ce8e79c), UINT64_C(0x57543a33f266aa3e), UINT64_C(0x276c916923496020)}},
+  {{ UINT64_C(0x07f7ca97d1b91495), UINT64_C(0xb0218c5ac327c07f), UINT64_C(0x3fe7d602a771d44c)}},
+  {{ UINT64_C(0x8335862660c5f3d5), UINT64_C(0x0ecaa6b6a41d1bce), UINT64_C(0x21341f16d131723d)}},
+  {{ UINT64_C(0xb8f6d00630375b8e), UINT64_C(0x025ed20d561e3901), UINT64_C(0xe23fc49287d65351)}},
+  {{ UINT64_C(0x09dc6174ea10e715), UINT64_C(0x874aa6f8da009949), UINT64_C(0x9b1503e5bfc89c1f)}},
+  {{ UINT64_C(0xc9836ea510332fc1), UINT64_C(0x0f26886e3c47fc51), UINT64_C(0x4187f9769a27ee66)}},
+  {{ UINT64_C(0xf37bccc6c77c01b3), UINT64_C(0x07c60acd3adc2f3b), UINT64_C(0x0a55273e54a3ea6b)}},
+  {{ UINT64_C(0x9f0fe96510bd2710), UINT64_C(0xfa447df0e39e0c4c), UINT64_C(0x895b363ae509d337)}},
+  {{ UINT64_C(0x8b97d5d5a95477f6), UINT64_C(0x73c162f0445ea280), UINT64_C(0x3169b61c229a33ca)}},
+  {{ UINT64_C(0x3e043547e3afc554), UINT64_C(0x986ee01ac79bcccf), UINT64_C(0x48571e38967298ea)}},
+  {{ UINT64_C(0x22f6442d7ce6bf55), UINT64_C(0x644d66def7e1517f), UINT64_C(0x7ea6a8c79385c7f9)}},
+  {{ UINT64_C(0x04660bcee2c56936), UINT64_C(0x3c1c7fc1ea5efbf0), UINT64_C(0xc418e2447aff8c99)}},
+  {{ UINT64_C(0xc2ac12ab246394ea), UINT64_C(0xede3f30e26a10bee), UINT64_C(0x5ec66ce2029566e7)}},
+  {{ UINT64_C(0x7c00f867fc334bae), UINT64_C(0x0901d81db5c70f7e), UINT64_C(0xd16cc166a4775042)}},
+  {{ UINT64_C(0x603d3e825f62e20e), UINT64_C(0xdd70e58af3404699), UINT64_C(0x1d314348785ecae2)}},
+  {{ UINT64_C(0x3ec11c7e91bc9f93), UINT64_C(0x3384dba514c65eac), UINT64_C(0x6adfaa4dafb5f881)}},
+  {{ UINT64_C(0x4cf212380416cda4), UINT64_C(0x9e0e1ff30583730e), UINT64_C(0x0aa7729e1589e266)}},
+  {{ UINT64_C(0x44b3748ca30b7c20), UINT64_C(0xd0e635549e327eae), UINT64_C(0x7d84346c02be7b9e)}},
+  {{ UINT64_C(0x46c85d948bfdec8f), UINT64_C(0x8504311c3379d02f), UINT64_C(0xa332170edabc1a2b)}},
+  {{ UINT64_C(0x7b3736df2de2d743), UINT64_C(0xf2da380731e364dc), UINT64_C(0xd64b9059aa9ca87a)}},
+  {{ UINT64_C(0x40260a559a415d8a), UINT64_C(0xa997030f23383047), UINT64_C(0xe9c505bc8508b332)}},
+  {{ UINT64_C(0xa43ef3f4239fc394), UINT64_C(0x5e3d286630115ac0), UINT64_C(0xc0f3e3a0c38fed5b)}},
+  {{ UINT64_C(0x7b1b69fd677142d4), UINT64_C(0x0e35b927da635f19), UINT64_C(0xd02abae1000ae291)}},
+  {{ UINT64_C(0xc57c8b99f0eb2d6c), UINT64_C(0x2fc4e7ea92e13fcf), UINT64_C(0x1b327dbf126a560a)}},
+  {{ UINT64_C(0xbb93d0a41c3d6c1a), UINT64_C(0xc610692f067f7517), UINT64_C(0x69303d7b7c535f14)}},
+  {{ UINT64_C(0xe1710a96c004c351), UINT64_C(0xe54497d2e61bed4e), UINT64_C(0x244fa74efc2e53d8)}},
+  {{ UINT64_C(0x98f2a08989571366), UINT64_C(0x0f01ed31850a658c), UINT64_C(0xdf926d5cee774088)}},
+  {{ UINT64_C(0x1f8024a55eaf0f79), UINT64_C(0xfc265d62baec13d3), UINT64_C(0x030cd589c9996c25)}},
+  {{ UINT64_C(0xfde646921bc4d913), UINT64_C(0x440c721244bbf410), UINT64_C(0x6fea01b5d3c0a3bc)}},
+  {{ UINT64_C(0x9689c25a678bea73), UINT64_C(0xef3e00f0c243fbce), UINT64_C(0x10b39077da190dd8)}},
+  {{ UINT64_C(0x790620990903f9a9), UINT64_C(0x66252f69e071b400), UINT64_C(0x2d9618e93e83688f)}},
+  {{ UINT64_C(0xa1977abcc488bc73), UINT64_C(0x9b2c04bcb4abd052), UINT64_C(0x03ef667979336ae6)}},
+  {{ UINT64_C(0xae00743d90aab597), UINT64_C(0xe11a6b6e023d38d8), UINT64_C(0x791d27ed781f0b64)}},
+  {{ UINT64_C(0x2c33a59fdbd83e9f), UINT64_C(0x5d3f5f1d9ec7853c), UINT64_C(0xaf96d8ea3bc1e96b)}},
+  {{ UINT64_C(0x08bc14ae2708cc3f), UINT64_C(0xd142cc0516fbcfb4), UINT64_C(0xd30276077643a861)}},
+  {{ UINT64_C(0xf07a86c9057d93bd), UINT64_C(0xefcdab8a384e61ce), UINT64_C(0xaeb14a796e426819)}},
+  {{ UINT64_C(0x3eef837fc148806b), UINT64_C(0x94a26806b4772a32), UINT64_C(0x8f5ef6116efaded5)}},
+  {{ UINT64_C(0x8d112045d4ae3fe1), UINT64_C(0x77cf4d1f56d7c7ee), UINT64_C(0xdee2536f6cc95a3d)}},
+  {{ UINT64_C(0xe005860226bd38ae), UINT64_C(0x5631bba43e5cb0ee), UINT64_C(0xe3b4fc540833fe3a)}},
+  {{ UINT64_C(0x40232714565b7a9a), UINT64_C(0x8600382a848b224c), UINT64_C(0x722401b4b68d1c6b)}},
+  {{ UINT64_C(0x9964b7e8c0075b46), UINT64_C(0xf17b59bc3d3acde1), UINT64_C(0x6339310e6dc24f16)}},
+  {{ UINT64_C(0x64f9c34f8d0f9761), UINT64_C(0x663702b77db21c6d), UINT64_C(0x25b7ff915429a4a9)}},
+  {{ UINT64_C(0xd0d18f2dca2a13d8), UINT64_C(0xc6fa97c35c02a215), UINT64_C(0x056e0b678d35f4f6)}},
+  {{ UINT64_C(0x3dd2c79a9522dfd2), UINT64_C(0x4277e6b0dd758489), UINT64_C(0x121ffa83054fe53f)}},
+  {{ UINT64_C(0x66b18cf66166f48a), UINT64_C(0xfbe0fd669ab4f1a7), UINT64_C(0xccf2077c9217efdf)}},
+  {{ UINT64_C(0xb56f8637243b22a0), UINT64_C(0x50fe896d6e83de25), UINT64_C(0x19438fe303f828e4)}},
+  {{ UINT64_C(0xdf4fa4b32016a35e), UINT64_C(0xd3bcf1eac71eaf74), UINT64_C(0x88ea5f402ffc1b43)}},
+  {{ UINT64_C(0x1372c4ad1a552ce5), UINT64_C(0xf37881fd380166a6), UINT64_C(0x9572a3828e7194d4)}},
+  {{ UINT64_C(0x7eb899943f03d28b), UINT64_C(0x8cae7259e64ebccc), UINT64_C(0x1bc9f2575f22cc8a)}},
+  {{ UINT64_C(0xc1451a1cb16bc019), UINT64_C(0xbc4486edf8f5fefe), UINT64_C(0xee7af07d1eb45324)}},
+  {{ UINT64_C(0xaea7e4e87318949f), UINT64_C(0x2aa6dd71634f770c), UINT64_C(0x76f517fffa4c40be)}},
+  {{ UINT64_C(0xbecb0bb309e418fd), UINT64_C(0xabfb641a48402866), UINT64_C(0xf0106192d8f209c7)}},
+  {{ UINT64_C(0x4b0639b1cd92f9d7), UINT64_C(0x568e602370495969), UINT64_C(0x61d8268f49344676)}},
+  {{ UINT64_C(0x64693a566406f913), UINT64_C(0xfb2b71f4e704447b), UINT64_C(0xf07702ff1720ab61)}},
+  {{ UINT64_C(0xf0eda18fa23ad6a4), UINT64_C(0x6e331621bf45f6a2), UINT64_C(0xba7bf01d9ed0cc23)}},
+  {{ UINT64_C(0xd8abbe8fd5c2a86d), UINT64_C(0x64dd9cfe8f88cde4), UINT64_C(0x0335d60e7a80a13e)}},
+  {{ UINT64_C(0x311e7599eb850fbf), UINT64_C(0xadf953b8c270eff5), UINT64_C(0x867d7a881f39fe25)}},
+  {{ UINT64_C(0x08bd1d9ff9badaa9), UINT64_C(0xb44d498cefd757c1), UINT64_C(0x738e8ba542dc2896)}},
+  {{ UINT64_C(0x1924d0eaa7b07b14), UINT64_C(0x9117600871570814), UINT64_C(0xb70f44fc56a7efc1)}},
+  {{ UINT64_C(0xf50328df969dcf33), UINT64_C(0xa69b577fdbf9cf20), UINT64_C(0x429dfcecdb5ee6e8)}},
+  {{ UINT64_C(0x313146c65d9d34e5), UINT64_C(0x05a6164f64ab0a32), UINT64_C(0x7d5ae5384f8d6fdf)}},
+  {{ UINT64_C(0xde1d6d6854631946), UINT64_C(0xe5f9c0175174a8df), UINT64_C(0x59abe747cfb528a5)}},
+  {{ UINT64_C(0x2a7be87a5c5e9235), UINT64_C(0xd3e92417a1f4cfdd), UINT64_C(0xb1ab21c857cd4a01)}},
+  {{ UINT64_C(0x49a7e35ced0af35f), UINT64_C(0x95dcda6e22dfd952), UINT64_C(0x899e1c06d764d1b5)}},
+  {{ UINT64_C(0x60e357100f522832), UINT64_C(0x7a382bcb509509a3), UINT64_C(0xaf64f90db3d144e8)}},
+  {{ UINT64_C(0xe8fef153be7d1493), UINT64_C(0x207bc5cec2b433d7), UINT64_C(0xb941d8f616699fd8)}},
+  {{ UINT64_C(0xfa6699217cfb5694), UINT64_C(0xe2bb68ccf5ce2de0), UINT64_C(0x2e07427c45d1613b)}},
+  {{ UINT64_C(0x34b38a21be6f3c0a), UINT64_C(0x0c00db49f4c8616c), UINT64_C(0x8ba2e2e98dda73a1)}},
+  {{ UINT64_C(0x415baaeff93bc89c), UINT64_C(0x77817e1ed73e1c2b), UINT64_C(0xa69e101a45b2bb6a)}},
+  {{ UINT64_C(0x96610ffde1a479c3), UINT64_C(0x5ec450e06097e836), UINT64_C(0x0d0148cb6e13f4d4)}},
+  {{ UINT64_C(0xfaf5ad5d60ced562), UINT64_C(0xca5980c9d370eb80), UINT64_C(0xd6f9e1eeb0e582e7)}},
+  {{ UINT64_C(0x7f8fc36065134deb), UINT64_C(0xf5a03d2e49519697), UINT64_C(0x7dcc3cb13a3d0301)}},
+  {{ UINT64_C(0x08f5aa2000ce69b9), UINT64_C(0xae6278baf946a61c), UINT64_C(0x0a4b2913d80bfc7f)}},
+  {{ UINT64_C(0xddf04e1d907fc02b), UINT64_C(0x8c49b1d8818de76b), UINT64_C(0x04cf2d74e119e89b)}},
+  {{ UINT64_C(0x4cfbe94537f4b7cb), UINT64_C(0x5fc7fa1cda3c47c3), UINT64_C(0x78178fb54ccd7955)}},
+  {{ UINT64_C(0xb4d52cbab223240a), UINT64_C(0x45da8f15f39ec3a4), UINT64_C(0x6df8a087d856daaa)}},
+  {{ UINT64_C(0x723fcd697fa66b0c), UINT64_C(0x1f3c8f6f2ffbd484), UINT64_C(0x3a3939cef23e2daa)}},
+  {{ UINT64_C(0xba403a302e7c684d), UINT64_C(0x6ee04152b244c05c), UINT64_C(0x78d4a2afdc48cbf7)}},
+  {{ UINT64_C(0xd0ef584a950b90b2), UINT64_C(0x3e3ab0dab0ab285f), UINT64_C(0xefd64cd413fce73e)}},
+  {{ UINT64_C(0x3b484739e80610bb), UINT64_C(0xa981275d5b2fad09), UINT64_C(0xf6b79c34cf056f09)}},
+  {{ UINT64_C(0xf658fb56214c4e6a), UINT64_C(0x3bfd94136f5a349c), UINT64_C(0x77eb5a5aea2d53f1)}},
+  {{ UINT64_C(0x9801a34dead63638), UINT64_C(0x331a08d08b26d94a), UINT64_C(0xc481d86863da1d8e)}},
+  {{ UINT64_C(0x14eac881cfc4d7c2), UINT64_C(0xec9bc2b34be20b36), UINT64_C(0x4b73ba354bfa7209)}},
+  {{ UINT64_C(0xfaa9335e2d8b860c), UINT64_C(0x05ec185374731dc2), UINT64_C(0xa11d62007fad469d)}},
+  {{ UINT64_C(0xfd995ab43ea9d574), UINT64_C(0x34ba9fa02607cd01), UINT64_C(0x5406c3a8608ba730)}},
+  {{ UINT64_C(0xc18ae6f09e2b4597), UINT64_C(0x126680c4a10a7d1d), UINT64_C(0x0b0ded6b543dd3f5)}},
+  {{ UINT64_C(0x26c52127dab8c5f7), UINT64_C(0x0f3f6967392006f9), UINT64_C(0xe03ffd2c7cc211da)}},
+  {{ UINT64_C(0x56c9ff9e13a147ef), UINT64_C(0x9fc5b0fb1b200579), UINT64_C(0xd7f9fd6343210f00)}},
+  {{ UINT64_C(0xce65b9cef1f70b53), UINT64_C(0xf5eb9bd508c25c91), UINT64_C(0x35f7e717deb1245f)}},
+  {{ UINT64_C(0x93b407dfc2563e57), UINT64_C(0x9e4498abfec1a10c), UINT64_C(0x014c43249b5ce77b)}},
+  {{ UINT64_C(0x1088a504d75ce273), UINT64_C(0xde51f181dc3d3d1f), UINT64_C(0x107f702a7ccf49d0)}},
+  {{ UINT64_C(0xa9867d39d00b42c0), UINT64_C(0xdfc7d2c8f84fbfa2), UINT64_C(0x755bf291bee59da2)}},
+  {{ UINT64_C(0x9ee2bfa4cf97f259), UINT64_C(0xb0d87aed6b2520dc), UINT64_C(0x0880c39448febeea)}},
+  {{ UINT64_C(0xfd47cf7cd623732e), UINT64_C(0x27b16f45326e7155), UINT64_C(0x4ad0bbc2e0f7232d)}},
+  {{ UINT64_C(0xb3bbe2fc1f607fca), UINT64_C(0x6d68be9bccd64e2e), UINT64_C(0xbf09d796c975d324)}},
+  {{ UINT64_C(0xb112455f1e53d8ba), UINT64_C(0x34cc3f405e7a0625), UINT64_C(0x08e9dcb6a2694c00)}},
+  {{ UINT64_C(0xae7e44837179273f), UINT64_C(0x2d2aef4ea53311ba), UINT64_C(0xf899e9392237081c)}},
+  {{ UINT64_C(0x6f5d83e7134284f9), UINT64_C(0x8900194c3474d773), UINT64_C(0xe93231e281c8df89)}},
+  {{ UINT64_C(0x0c01880322502612), UINT64_C(0x4afdda20b682c955), UINT64_C(0x736c5bb70f51ec49)}},
+  {{ UINT64_C(0x9f332d6f6d3b8032), UINT64_C(0xa79dffd114b7ce83), UINT64_C(0x43c1857142b39b44)}},
+  {{ UINT64_C(0x831e59bf6d33450a), UINT64_C(0x6c545d88f3558165), UINT64_C(0x599eb69a468a4698)}},
+  {{ UINT64_C(0xa5324519f1a37802), UINT64_C(0x43a17e2a40887288), UINT64_C(0x7a5cf006f37f9d8f)}},
+  {{ UINT64_C(0xb97fdd6387c8c350), UINT64_C(0xf326e99954520b4e), UINT64_C(0x3a7e56e3ede8a819)}},
+  {{ UINT64_C(0xe2a9c22adb87fc28), UINT64_C(0x658e71655d7cdd6e), UINT64_C(0x813897365d7428e4)}},
+  {{ UINT64_C(0xb176dd5d649c0fee), UINT64_C(0xa4ece475f8f5a33d), UINT64_C(0xc7719939d1e7727e)}},
+  {{ UINT64_C(0x2e37606b20a0a9b4), UINT64_C(0x6b997d6f5f5970e0), UINT64_C(0xe8d2db62d13344f1)}},
+  {{ UINT64_C(0x62b301dc38fdf9a5), UINT64_C(0x13d161cfca1f73cc), UINT64_C(0x4169b3c37b12f1c4)}},
+  {{ UINT64_C(0x10980178d30188d8), UINT64_C(0x9836baa954f7ad1f), UINT64_C(0x8a71698a10be4edf)}},
+  {{ UINT64_C(0x28177d84d6a87cdb), UINT64_C(0x3bc9f64c474716e2), UINT64_C(0xbc2d8f9c00045054)}},
+  {{ UINT64_C(0x3c1f391fe87459f1), UINT64_C(0xce11af6e384a4785), UINT64_C(0x1a5b5ccf336a2dfd)}},
+  {{ UINT64_C(0xbffeaa4c50df5371), UINT64_C(0x2d8863ec0c84ed2b), UINT64_C(0x1679ce842f7cac43)}},
+  {{ UINT64_C(0x8a4ec3fbd241ce50), UINT64_C(0x4b73300bf8d0b54e), UINT64_C(0xca8d68cd5600a578)}},
+  {{ UINT64_C(0x4da4986c273f1333), UINT64_C(0x868c0ee8affa194a), UINT64_C(0x678b4d811ef67ee2)}},
+  {{ UINT64_C(0x5861f81f17e0b916), UINT64_C(0xd78a3a6b4e47fddc), UINT64_C(0x03aa2ea39eb20d45)}},
+  {{ UINT64_C(0x8888b8154218fa4f), UINT64_C(0x68e7a19fd9913843), UINT64_C(0x9aaa37ea0a1dc396)}},
+  {{ UINT64_C(0x56fc4bb34b5d17dc), UINT64_C(0xc7ca423d3dac8974), UINT64_C(0x608ac3fe9ef0d25c)}},
+  {{ UINT64_C(0x21002443e62c0536), UINT64_C(0x889f22d37fd0fdf0), UINT64_C(0xca0ca08ab532372d)}},
+  {{ UINT64_C(0x60b3e75d26a8a976), UINT64_C(0xeae3bb43a1ff0b31), UINT64_C(0xc17354d8380ff205)}},
+  {{ UINT64_C(0x0593601d44159d9c), UINT64_C(0x453a419392fcb25b), UINT64_C(0x0fca30af5604dff9)}},
+  {{ UINT64_C(0x2c60c679bf37b1a6), UINT64_C(0xe5bfcff3b50a9264), UINT64_C(0x45629e407d73456b)}},
+  {{ UINT64_C(0xa668b8efcb4cf29d), UINT64_C(0x19d756797a1990d9), UINT64_C(0xc9099559d0ca1060)}},
+  {{ UINT64_C(0x775e1bdaf36f9575), UINT64_C(0x5d44ca22982673c4), UINT64_C(0xa61690ddd61d030a)}},
+  {{ UINT64_C(0x5586c5122a0ba2a4), UINT64_C(0x89597fd3adaa85af), UINT64_C(0x07a912d93c6c3e3e)}},
+  {{ UINT64_C(0xff23f5a248276ba6), UINT64_C(0x36684af953ba3904), UINT64_C(0xc2a5a22732e1e3c2)}},
+  {{ UINT64_C(0x5ec113c92b947c69), UINT64_C(0x3194c7a92e4af4f3), UINT64_C(0x9a9fb28050e3f2ae)}},
+  {{ UINT64_C(0x7cac5c63dfa3b381), UINT64_C(0x93f522f53aacd8ad), UINT64_C(0x511d502e46da19f9)}},
+  {{ UINT64_C(0xdbd0241900c620c8), UINT64_C(0xb1e375c59827c0f2), UINT64_C(0x1dea1e5b1e948c59)}},
+  {{ UINT64_C(0xe1373a8b7e6983b3), UINT64_C(0x619cb6cfb2bd51f2), UINT64_C(0x1dfd3250df041aa7)}},
+  {{ UINT64_C(0x038d5a645113420f), UINT64_C(0x925a0d8edb7c7e14), UINT64_C(0xe0594f96593b0e02)}},
+  {{ UINT64_C(0x846b605e09c5ff55), UINT64_C(0x68e9de2320361c5f), UINT64_C(0x21db535a07d0bbae)}},
+};
+
+static const mzd_row192_t L_1[] = {
+  {{ UINT64_C(0x44fc0f57d887c3fa), UINT64_C(0x481495d2da5f3c04), UINT64_C(0x8ed5ba66172c39e9)}},
+  {{ UINT64_C(0xf7c334185b9b0fa2), UINT64_C(0xee0ea8268d4b3428), UINT64_C(0xb1d6d4d22edfb82b)}},
+  {{ UINT64_C(0x18579b5c37334162), UINT64_C(0x71e2a7a727d5ebb1), UINT64_C(0x0a3f7a40fd5a76b0)}},
+  {{ UINT64_C(0x4555874124d0e6de), UINT64_C(0x62cd5472e92a76d4), UINT64_C(0x6c82c5f572f2b29c)}},
+  {{ UINT64_C(0xdca7132be2eb41bf), UINT64_C(0xbdf202ba8c97c1e4), UINT64_C(0x3a790fc79544adc7)}},
+  {{ UINT64_C(0x6af0abdcee73f298), UINT64_C(0x48a2c1219efb2d25), UINT64_C(0xdfa9e99e1657bbd8)}},
+  {{ UINT64_C(0x12c6b564cd4b07e2), UINT64_C(0xcaf15cc0aaacda24), UINT64_C(0x16d1362853975b02)}},
+  {{ UINT64_C(0xe3d87c4a3acfe131), UINT64_C(0x6afc534368000d1c), UINT64_C(0x485a1b88ad3982ba)}},
+  {{ UINT64_C(0xdbd9c98607f0dcd3), UINT64_C(0x5fc775b7ff377715), UINT64_C(0xbbae9d99893cd043)}},
+  {{ UINT64_C(0x513afd8a8076ca63), UINT64_C(0x2d31557de521d155), UINT64_C(0x89bddaf4b27be64e)}},
+  {{ UINT64_C(0x12ea1bd0966c6983), UINT64_C(0x6b548eee869c3377), UINT64_C(0xa25eec7b7c1ba8b4)}},
+  {{ UINT64_C(0xc8b1680e4f279341), UINT64_C(0x3c7fc5bf209a9b9c), UINT64_C(0x2dd83be4849cc05a)}},
+  {{ UINT64_C(0x22cdb3b02faa3cca), UINT64_C(0xb6370d67f9d4c135), UINT64_C(0x2bcfcfa80120cc17)}},
+  {{ UINT64_C(0x13203cfde168fae7), UINT64_C(0x562f173cc400ed7c), UINT64_C(0x7c7cc8095d5f0330)}},
+  {{ UINT64_C(0x3feaa120be6b6055), UINT64_C(0x1471ac7a4bea6158), UINT64_C(0xa806c4d1b11c18d3)}},
+  {{ UINT64_C(0x0643954677294764), UINT64_C(0x995f85625e0d6172), UINT64_C(0x4413b5bb3367b9cc)}},
+  {{ UINT64_C(0x1ff8833a8f14d816), UINT64_C(0x20ea772310eb776b), UINT64_C(0x44ed3f10eb2c022e)}},
+  {{ UINT64_C(0xf8f49267de58fddf), UINT64_C(0xc372f49ceb221cfb), UINT64_C(0x61af0b3053d98bcf)}},
+  {{ UINT64_C(0xca2f1ed11f3e799b), UINT64_C(0x5914c1ba17763991), UINT64_C(0xa3546ef397947b7b)}},
+  {{ UINT64_C(0xc1b3dcc37dadc345), UINT64_C(0x1c24a7c84c232977), UINT64_C(0xef1ef5f02235f2f7)}},
+  {{ UINT64_C(0x84ed53e21f3cdbf3), UINT64_C(0x057d3b1125bb29ea), UINT64_C(0xc15abe1df9e16677)}},
+  {{ UINT64_C(0x4edfae6ff387bc02), UINT64_C(0xf6994e881eea39e6), UINT64_C(0x21bb310b9dc896db)}},
+  {{ UINT64_C(0xde0408e27d15b58b), UINT64_C(0x595e9d09d150bdd5), UINT64_C(0x389195d88f10d170)}},
+  {{ UINT64_C(0x1782cc09a0b21252), UINT64_C(0xac3822b55cae9f75), UINT64_C(0x1b9b12693ff92c0c)}},
+  {{ UINT64_C(0xaee63a75487ccc67), UINT64_C(0x26a0d8fb198c8054), UINT64_C(0xa66fe37ada4dbc5b)}},
+  {{ UINT64_C(0xdfbadae264f24148), UINT64_C(0x7e84d487ddf27340), UINT64_C(0xc34762727023ab83)}},
+  {{ UINT64_C(0x11cb770fcb14951e), UINT64_C(0x5cd360654b5862cc), UINT64_C(0x80615617eae29103)}},
+  {{ UINT64_C(0x11348e22b7e7cf45), UINT64_C(0x02fedcf1a2c1e5f4), UINT64_C(0x448f8d90bd676a69)}},
+  {{ UINT64_C(0xf0aa762c4134f4e4), UINT64_C(0x299f7bd3e9b41ab1), UINT64_C(0xc0481bc4764cf984)}},
+  {{ UINT64_C(0x09078b94d96cb513), UINT64_C(0x8b69b1dde0f24baa), UINT64_C(0xa8d0eb4bbab445d2)}},
+  {{ UINT64_C(0xd5ab59577ee7f025), UINT64_C(0x591c239f609bd986), UINT64_C(0x643591ff15c464fd)}},
+  {{ UINT64_C(0x48728aebaaab3036), UINT64_C(0x4f987515b56a1de9), UINT64_C(0xa72e8abef533e245)}},
+  {{ UINT64_C(0xc867ce4ef3d04198), UINT64_C(0x6b1dd762faa9b3e0), UINT64_C(0x1186ff9b21d12595)}},
+  {{ UINT64_C(0x347a8a807d5616cc), UINT64_C(0x78f8306a999c4115), UINT64_C(0x0655fe01fa2714e1)}},
+  {{ UINT64_C(0xa5069b8936d32144), UINT64_C(0x671013620d63a5e9), UINT64_C(0xd1667ebc5f22c800)}},
+  {{ UINT64_C(0x700778f125bb5a0d), UINT64_C(0xf6670db3fcaf2f06), UINT64_C(0x7b562f35bf27b29d)}},
+  {{ UINT64_C(0xbdd22c8877157bba), UINT64_C(0x41385f858cc4a0f7), UINT64_C(0xe524ceb278e54415)}},
+  {{ UINT64_C(0x17541782b48617aa), UINT64_C(0x610fba4bab5eae49), UINT64_C(0x091aeb102bc0d8d7)}},
+  {{ UINT64_C(0xbe00e2ce2d294534), UINT64_C(0x97d8dd744bffe4be), UINT64_C(0xc5ad6735950e3e82)}},
+  {{ UINT64_C(0x1862a61068fd9f9c), UINT64_C(0x29dec93ad8748a56), UINT64_C(0xf9d74991e422b2d9)}},
+  {{ UINT64_C(0xebb8bad4254c35da), UINT64_C(0x8f50861dca3abeb0), UINT64_C(0xad0678d24dfcfbc9)}},
+  {{ UINT64_C(0xdf89fa56b1bdd2da), UINT64_C(0x40830b08d76ba907), UINT64_C(0x9eb753b24f03baf8)}},
+  {{ UINT64_C(0xc57674b7e7040939), UINT64_C(0x727a2f2b0b9cc725), UINT64_C(0xee7e0bdc0e3adfa6)}},
+  {{ UINT64_C(0xe69de86da2f233a9), UINT64_C(0x3641b7f55da98e74), UINT64_C(0x081be6dc6489b0f1)}},
+  {{ UINT64_C(0xf6854e29013340e4), UINT64_C(0x62f7ebf8157b84c6), UINT64_C(0xff61ab111e64e817)}},
+  {{ UINT64_C(0x5b9c6518e4bfb331), UINT64_C(0xd899b9e3bbf23980), UINT64_C(0xb94419baeeca5178)}},
+  {{ UINT64_C(0xd178848f812ffb25), UINT64_C(0xce04a91a181e7f54), UINT64_C(0x8d6de6ceb52f8e26)}},
+  {{ UINT64_C(0x419c291a7a6cdae8), UINT64_C(0x54783a16953d64c2), UINT64_C(0x5b2f1c2c829d13f6)}},
+  {{ UINT64_C(0xbb41764e009344bf), UINT64_C(0x9bb907dffc0cbf79), UINT64_C(0xde9702f22f067d49)}},
+  {{ UINT64_C(0xb69abbfe97f61e93), UINT64_C(0x491d5ea1b794c798), UINT64_C(0xce6dfe162594bc12)}},
+  {{ UINT64_C(0x38aff69c36e3afc4), UINT64_C(0x7b7bf1f52bd03087), UINT64_C(0xdb56fb9362322d70)}},
+  {{ UINT64_C(0x54f4d9004168ba30), UINT64_C(0x11caf292f6353ea1), UINT64_C(0x57034106053621e4)}},
+  {{ UINT64_C(0xb7d952649df80fc3), UINT64_C(0xdd1bb8078dc784c8), UINT64_C(0xb7ede4891f1a8440)}},
+  {{ UINT64_C(0x3987153bca465ee7), UINT64_C(0x3c11a10333ffd9ff), UINT64_C(0x4bf82f9410092f73)}},
+  {{ UINT64_C(0xbf33cfea0bbe28a2), UINT64_C(0x2029fe061d37cc87), UINT64_C(0xff2e4b2802dfe4ad)}},
+  {{ UINT64_C(0x33fb2ac337e27c38), UINT64_C(0x3d2c7f3197b76dcf), UINT64_C(0xd36f2ea4b20c07f7)}},
+  {{ UINT64_C(0x61f30aa9eb2bb952), UINT64_C(0x2912142837ef607b), UINT64_C(0x7c99b982cdaad1b0)}},
+  {{ UINT64_C(0x7314040a00517797), UINT64_C(0xadd8345337a79b75), UINT64_C(0x46415e34f6ea71ba)}},
+  {{ UINT64_C(0x9af9f90b03ab6a8e), UINT64_C(0x970b435e79798f54), UINT64_C(0x5987c806576404f4)}},
+  {{ UINT64_C(0x4a29e0981124069d), UINT64_C(0xcc9cd9f14e3dd3a8), UINT64_C(0x424990d7a30c26c1)}},
+  {{ UINT64_C(0x83fa94e3525dd0d2), UINT64_C(0xfde1b918ba3e21c4), UINT64_C(0x12b871573b48bb57)}},
+  {{ UINT64_C(0x3d5e390d559870bc), UINT64_C(0xf636fa6778200c50), UINT64_C(0xbebc5b6c8add85e4)}},
+  {{ UINT64_C(0xf3388e2a7b2481df), UINT64_C(0x206ad2a5d60c575a), UINT64_C(0x95f2a0c19c59b2bc)}},
+  {{ UINT64_C(0x080bef799be2e859), UINT64_C(0x6d3704e42411abab), UINT64_C(0xf3093903e9ac0bab)}},
+  {{ UINT64_C(0xcd7b86414d5f741d), UINT64_C(0xf38b6a66b95d93fb), UINT64_C(0x1b3e738c0c2e295a)}},
+  {{ UINT64_C(0x9691cadc38125765), UINT64_C(0x496f4d7484fb50c4), UINT64_C(0x7fd772c899bf561b)}},
+  {{ UINT64_C(0x696241b90a4c2e7c), UINT64_C(0x768693805ac023e1), UINT64_C(0x19c3d4229e54aff8)}},
+  {{ UINT64_C(0xd5b3b07571a46818), UINT64_C(0xdc6433891eb40d84), UINT64_C(0x9ec4151d228669a2)}},
+  {{ UINT64_C(0x93b8ccb894eefcac), UINT64_C(0xc7b0fd6b34dedcec), UINT64_C(0xf81ca0456a170d2b)}},
+  {{ UINT64_C(0x264abc3f3b652a8f), UINT64_C(0x81e98132111d241f), UINT64_C(0x0b80cd73ae3133ae)}},
+  {{ UINT64_C(0x503cf0893c82de63), UINT64_C(0x3dcf15308ba89ca0), UINT64_C(0x332db6492673e397)}},
+  {{ UINT64_C(0x2c16361ac7dad7c4), UINT64_C(0xdf4644fb86bf760a), UINT64_C(0x54aa17bb76233f92)}},
+  {{ UINT64_C(0x7a84474e61fb8c7b), UINT64_C(0xa87946a8fc2b00d6), UINT64_C(0x435fa5358bca85db)}},
+  {{ UINT64_C(0xb4f308073a4b315b), UINT64_C(0x9b21a582649757a7), UINT64_C(0x3c734e6ff73a75ab)}},
+  {{ UINT64_C(0x5511c90a5c7ef270), UINT64_C(0x517ad966fcb4bebc), UINT64_C(0x9c66817de129b173)}},
+  {{ UINT64_C(0x8c1e596f62296e8c), UINT64_C(0x47eb3c83d3298f98), UINT64_C(0x1bdc0e0ae02a8f94)}},
+  {{ UINT64_C(0x7b33f0d783c0b85c), UINT64_C(0x34e22047fc9153bc), UINT64_C(0xdce1b6fa6755fc1d)}},
+  {{ UINT64_C(0x93fdc135d7f59d76), UINT64_C(0x8aa8f33e4a323e25), UINT64_C(0x7ef5fc1c6a2d98c5)}},
+  {{ UINT64_C(0x42727d2c7fcc7af2), UINT64_C(0x4c50aa7137961299), UINT64_C(0x9cbd95617abb2661)}},
+  {{ UINT64_C(0x2db4e0221cacbf4c), UINT64_C(0x12235212dcf40861), UINT64_C(0x1a24fed97403a4e9)}},
+  {{ UINT64_C(0x16a536ab6fd74161), UINT64_C(0xd1cfc162030eefac), UINT64_C(0x09254fc5f6edc59a)}},
+  {{ UINT64_C(0xfe3de59891fe9398), UINT64_C(0x89ea5d2ee53249e5), UINT64_C(0x24fd5a3ff23d35d9)}},
+  {{ UINT64_C(0xae7ca216799248b1), UINT64_C(0x71d2b175dfc154dc), UINT64_C(0x2e6b2ebb1e17fdae)}},
+  {{ UINT64_C(0xefad60fd4599de92), UINT64_C(0x7170416741e5d5f4), UINT64_C(0xd40a74186e7c41b5)}},
+  {{ UINT64_C(0xe13454fd76b25473), UINT64_C(0x171ab889391c9c25), UINT64_C(0x456fbb0b91741f83)}},
+  {{ UINT64_C(0x2fbc972267f3a250), UINT64_C(0x079f6f795431eaa9), UINT64_C(0x32a88ff822c1e77c)}},
+  {{ UINT64_C(0x2526dd8caa2cd288), UINT64_C(0x565131d79036bdcf), UINT64_C(0x9528120ef534d9ce)}},
+  {{ UINT64_C(0xb8fdb2e249e8f626), UINT64_C(0x6aa574b123897c94), UINT64_C(0x8fdf6fce7841eb08)}},
+  {{ UINT64_C(0xc6c0d0020fb304d5), UINT64_C(0xfe0dfe0e5f78a56a), UINT64_C(0x75a6423da2c04258)}},
+  {{ UINT64_C(0x718c189377ed924a), UINT64_C(0xc8aaa1a19e716f6a), UINT64_C(0x415f87db95db609b)}},
+  {{ UINT64_C(0xe9632f190e9c8963), UINT64_C(0x1771b6ea2835f36a), UINT64_C(0x6bbbb0d2b5ebe69b)}},
+  {{ UINT64_C(0xde6e5f3cc28a159c), UINT64_C(0x4b99fd44cb3d90af), UINT64_C(0x21d2293e7d5b9096)}},
+  {{ UINT64_C(0xa57b49bda62fce4a), UINT64_C(0x628870fa6e18e542), UINT64_C(0x146811168d0b016c)}},
+  {{ UINT64_C(0x7bc6973f95741a4c), UINT64_C(0xd1df2503247231e2), UINT64_C(0x658b6e394011866b)}},
+  {{ UINT64_C(0x65285ddd3aa69712), UINT64_C(0xd5b1ab21b0dfe21c), UINT64_C(0xc837c9b00dbac206)}},
+  {{ UINT64_C(0x71d0c9cfb1c6bf3e), UINT64_C(0x9c5ce30636e57d8d), UINT64_C(0xb8ca088d8c718ec3)}},
+  {{ UINT64_C(0x2892c14f81d8ed97), UINT64_C(0xab096ecce6469ba0), UINT64_C(0xcb52e913132dc62d)}},
+  {{ UINT64_C(0x369cb865c087340e), UINT64_C(0x0edb76097607b996), UINT64_C(0x78fc8467bfc777a2)}},
+  {{ UINT64_C(0xa5b368472580d1c7), UINT64_C(0xd2a78eb5bf0f1b77), UINT64_C(0xb0a78743bc95ce45)}},
+  {{ UINT64_C(0xa55f30bdfa65e0b5), UINT64_C(0x01727acba6ba5695), UINT64_C(0x452b2400c06a029d)}},
+  {{ UINT64_C(0x3ce4ad9116fb6eb3), UINT64_C(0x055b68e3522b7bec), UINT64_C(0x423c7fd17000f4d4)}},
+  {{ UINT64_C(0x914209c45baea6ce), UINT64_C(0x8733b5e90dd0eaf2), UINT64_C(0x6ae918af4fe51511)}},
+  {{ UINT64_C(0xd7f61e7ec026077a), UINT64_C(0x69eb9ab903cde511), UINT64_C(0x0cb7cda868670f31)}},
+  {{ UINT64_C(0x777dfa397c0850ee), UINT64_C(0x37c9d6bba4143256), UINT64_C(0x390af3983c6692d6)}},
+  {{ UINT64_C(0x3c2612989c1ac199), UINT64_C(0xf2ce0cfec6e3a06a), UINT64_C(0x52dcd0e8db6e61f1)}},
+  {{ UINT64_C(0xe219c80745d94459), UINT64_C(0xec85b2fb26a93c86), UINT64_C(0xb38e183213586071)}},
+  {{ UINT64_C(0x0f686f5491fddb00), UINT64_C(0x63667e9a7af94b6d), UINT64_C(0x4294f81aaa2a252a)}},
+  {{ UINT64_C(0xea2eb10b0393f4a9), UINT64_C(0x97216af9762f5ee2), UINT64_C(0xa4b56f770e9f6b5c)}},
+  {{ UINT64_C(0x66f032afae224a69), UINT64_C(0x155897863c1bf95a), UINT64_C(0x1d9beb1ddc4395c7)}},
+  {{ UINT64_C(0x5cc758767df5e989), UINT64_C(0xd3508e8d13dfd3a2), UINT64_C(0xe7e0c61b49c42278)}},
+  {{ UINT64_C(0x00e13e2e661f8c5e), UINT64_C(0x27b13e540f978572), UINT64_C(0x081495573161567e)}},
+  {{ UINT64_C(0xb807f25433a483f4), UINT64_C(0xa25033f4ebed8c04), UINT64_C(0x212551eb42eed4e3)}},
+  {{ UINT64_C(0xd9801ceea4d9eae2), UINT64_C(0xbb8ae09f3bfde64c), UINT64_C(0xff4b65bbf41188cc)}},
+  {{ UINT64_C(0x613d6f22e162754b), UINT64_C(0x2c112a23ecfe5d5b), UINT64_C(0x9056041767326f99)}},
+  {{ UINT64_C(0x40d74ffa235ba161), UINT64_C(0xc1d0901f2c5efe29), UINT64_C(0xcae37338e57e6aff)}},
+  {{ UINT64_C(0x052de0edb1bf5bdd), UINT64_C(0xb6bdabc12e2d6d99), UINT64_C(0xbb509410f979f1a2)}},
+  {{ UINT64_C(0xf9e3d585e70fb733), UINT64_C(0x4710e1aa819a2636), UINT64_C(0xe7257887c5627f9a)}},
+  {{ UINT64_C(0x49f18a4947f825ec), UINT64_C(0xf4672e01482aa5d8), UINT64_C(0x1dc4b4272250b674)}},
+  {{ UINT64_C(0x35a0cfc64f3936e3), UINT64_C(0x15983f898dbc76e0), UINT64_C(0xd043cecf46da22c4)}},
+  {{ UINT64_C(0xa4da1849177be1c9), UINT64_C(0xd8e47abae3441109), UINT64_C(0x6e420c803d4ffcfa)}},
+  {{ UINT64_C(0xa718a46cbe78788a), UINT64_C(0x79420c221a1e73ac), UINT64_C(0x02cbeb385eefd327)}},
+  {{ UINT64_C(0xafc7d98c938d81eb), UINT64_C(0x1d2f02ecb72c374d), UINT64_C(0x43259477885452ec)}},
+  {{ UINT64_C(0x6b2cd313d4a3903f), UINT64_C(0xaa9e963abc109718), UINT64_C(0xd6229a76a3d27faf)}},
+  {{ UINT64_C(0x9e4e04fa7a2b1973), UINT64_C(0xc6aba896e57bfbc2), UINT64_C(0x1ebcc94e971c80f7)}},
+  {{ UINT64_C(0x50e6d1a4c062430b), UINT64_C(0xeea475ce2da46f1e), UINT64_C(0x9c5841cc59cdfa67)}},
+  {{ UINT64_C(0xa85c71bb62ba5dac), UINT64_C(0xbf53600bd8827db3), UINT64_C(0xc1c45ab4a546dd31)}},
+  {{ UINT64_C(0xa92d2c1eeff0d697), UINT64_C(0x4c55d825b3d87598), UINT64_C(0x449d8427266435ff)}},
+  {{ UINT64_C(0x4aba1df20210b1f3), UINT64_C(0x7126afb87f54dcd8), UINT64_C(0xbe71dcb78d4fa6b7)}},
+  {{ UINT64_C(0xa62b07cf6a645bc5), UINT64_C(0x167ed60b1370eb23), UINT64_C(0xba769fe32847fc29)}},
+  {{ UINT64_C(0xf2d320233ec64834), UINT64_C(0x4c9a3d5dbdacc81f), UINT64_C(0x05e79f3d2da6bdf4)}},
+  {{ UINT64_C(0x54f1bac4aa0e156e), UINT64_C(0x0ccaebf9bb0d40d3), UINT64_C(0x2745ff207b2eb54a)}},
+  {{ UINT64_C(0xe967dcad5c9d178c), UINT64_C(0x5598c6dc702c812e), UINT64_C(0x85a99e82b0c7774a)}},
+  {{ UINT64_C(0x42e431f0d7fb4364), UINT64_C(0x50592367d4359dd3), UINT64_C(0x5ef1a445a6477995)}},
+  {{ UINT64_C(0x639743a229e98f45), UINT64_C(0x6742e2fb7f4d6c56), UINT64_C(0xe9872fe35a0a7f5f)}},
+  {{ UINT64_C(0x4c677b51eb191e17), UINT64_C(0x61dfbc6a92012bd0), UINT64_C(0x2d5fbe3ef1c1c60b)}},
+  {{ UINT64_C(0x12828f8267a52f09), UINT64_C(0x5405940c780c4476), UINT64_C(0x21f661b0c98db387)}},
+  {{ UINT64_C(0x2221b4a28d22a87e), UINT64_C(0x29e41ccde2352a4b), UINT64_C(0xb87bfe9e9e6edb53)}},
+  {{ UINT64_C(0x84c9b92097837578), UINT64_C(0x690a50b6c0f743bc), UINT64_C(0xb01ad770c209a64d)}},
+  {{ UINT64_C(0x23024b43ceeabd06), UINT64_C(0x19c4e2bab30c21d0), UINT64_C(0x8ad785dd5a4639ab)}},
+  {{ UINT64_C(0x782fd908d7805fa2), UINT64_C(0xa8154bf7b47d67ac), UINT64_C(0x9ac61ce61e278b6f)}},
+  {{ UINT64_C(0x6d62289b39a100ce), UINT64_C(0xcb176201a481bf57), UINT64_C(0xc3a344465666229e)}},
+  {{ UINT64_C(0x32c16bcdbe869324), UINT64_C(0x0848123f54abe7ca), UINT64_C(0x83dab71a07d1f5ca)}},
+  {{ UINT64_C(0x3a846e452606ddd8), UINT64_C(0xad884ccec10f0c5c), UINT64_C(0xee3254eb20927d18)}},
+  {{ UINT64_C(0xca4bb1482f5def72), UINT64_C(0x129e09b28613404d), UINT64_C(0x9b4a799f29846195)}},
+  {{ UINT64_C(0xd34e3619d6121008), UINT64_C(0xc689282a37afe419), UINT64_C(0xeb8e8a4d110b1422)}},
+  {{ UINT64_C(0x81074baa712276c1), UINT64_C(0x70c383a317c0fd6c), UINT64_C(0x86e048182714ebd8)}},
+  {{ UINT64_C(0xb08af8832bbdc7d4), UINT64_C(0x5a65da16d414b73a), UINT64_C(0xef2e85e74491c5aa)}},
+  {{ UINT64_C(0xd4b394c7e2ff12e5), UINT64_C(0xa89645baadb3e230), UINT64_C(0xd61e5d007f40418a)}},
+  {{ UINT64_C(0x35bfa6df6c84cf8e), UINT64_C(0xa5ee8174fbaf7b60), UINT64_C(0x5138f8216bb09fd3)}},
+  {{ UINT64_C(0x7165c321b5f18027), UINT64_C(0xfbc92719a28273cb), UINT64_C(0xed3f63eeae175661)}},
+  {{ UINT64_C(0x3beb09d691eeaddd), UINT64_C(0x309b6431d0d26e5c), UINT64_C(0x8f0842129e313bc1)}},
+  {{ UINT64_C(0x2cd4eeb216cf96e3), UINT64_C(0xab91b49201f0a9d9), UINT64_C(0xcaf5277dfc53c966)}},
+  {{ UINT64_C(0x3240e59cad316943), UINT64_C(0x4030748b146608bd), UINT64_C(0xfaffab9c4867ae1f)}},
+  {{ UINT64_C(0xc41b5763de5ae3a8), UINT64_C(0xbb936d630d5eebaf), UINT64_C(0xc807dcf32f4fc041)}},
+  {{ UINT64_C(0xaa73ff1ea52c2aa3), UINT64_C(0x50286e8dd5edadc9), UINT64_C(0x460e69cf6066668a)}},
+  {{ UINT64_C(0x1f4b1c0fe84aeb7b), UINT64_C(0x3c47393595b25786), UINT64_C(0x09f5391e547ab395)}},
+  {{ UINT64_C(0xbc009cdb342a92c5), UINT64_C(0x461744b45fd6dab4), UINT64_C(0x2b49cb3afbf3dd11)}},
+  {{ UINT64_C(0x2134e44e5549f5b0), UINT64_C(0xa18ef5402a28bce3), UINT64_C(0xb4c029356128fba6)}},
+  {{ UINT64_C(0xa1983e90add3dbbe), UINT64_C(0x8b48c171a4a13730), UINT64_C(0x1507e8c94d84d0bd)}},
+  {{ UINT64_C(0x89005c87114392bf), UINT64_C(0xcedfe0e63e8af42d), UINT64_C(0xc620cbb407b151b2)}},
+  {{ UINT64_C(0xc0482971e15f65c2), UINT64_C(0x379f6e506440b74d), UINT64_C(0x658bc5d198cf3801)}},
+  {{ UINT64_C(0x80cc6bb373292c9a), UINT64_C(0x620440b2f56450c7), UINT64_C(0xa7561843a752dd15)}},
+  {{ UINT64_C(0x0c345571dd5d9d3a), UINT64_C(0x564e66604e598bb7), UINT64_C(0xaa42f183b159db12)}},
+  {{ UINT64_C(0x56dde74b947cb0a0), UINT64_C(0xd876654dfd02bd72), UINT64_C(0x389c46b994c59f9c)}},
+  {{ UINT64_C(0xe22fb17a8b75d600), UINT64_C(0x4e655bda5da956b6), UINT64_C(0x6c31c8f012ca117a)}},
+  {{ UINT64_C(0x25d7a85d89bf1477), UINT64_C(0x55e618e63c0d7282), UINT64_C(0xe5e49845e6038a72)}},
+  {{ UINT64_C(0x09aa4a577e42d329), UINT64_C(0x6281d309ad9a9af6), UINT64_C(0xb93f1b8acacbd2b3)}},
+  {{ UINT64_C(0xcb3c3bcda5a8c94c), UINT64_C(0x8d01058763705f3a), UINT64_C(0x9edb1b001c085c9d)}},
+  {{ UINT64_C(0xd960b05ef81bf95e), UINT64_C(0xf640efd44a1792dd), UINT64_C(0x5bbb23406cd2ed48)}},
+  {{ UINT64_C(0xec800f5d84fcb826), UINT64_C(0xb7afd6a45de720ef), UINT64_C(0xfbd000cd50fc85c9)}},
+  {{ UINT64_C(0x9c1611b4e71e243b), UINT64_C(0xc01c9f6cdef1bd55), UINT64_C(0xd891e63dfeb38efb)}},
+  {{ UINT64_C(0x5d338014b21299b9), UINT64_C(0x71bc2729ca180efa), UINT64_C(0x55db123420408804)}},
+  {{ UINT64_C(0x3709930439aa48c7), UINT64_C(0x529552d2a99bc97d), UINT64_C(0x7307384c67672b97)}},
+  {{ UINT64_C(0x59301c2fef48e1b4), UINT64_C(0xddd8c77dc7cab630), UINT64_C(0x2d69dbf553aad63b)}},
+  {{ UINT64_C(0x19f6761667a1f38e), UINT64_C(0x540a9f727774ec56), UINT64_C(0xe2865f241669652e)}},
+  {{ UINT64_C(0x28bd9b8c14272f33), UINT64_C(0x99ceda8d0dbd6953), UINT64_C(0xc650414fb2c52c31)}},
+  {{ UINT64_C(0xa674ca178b345c16), UINT64_C(0x0f98ad769a334650), UINT64_C(0x10c8faa1f863dda4)}},
+  {{ UINT64_C(0x9ad2515935a48614), UINT64_C(0x0b7523325a7546d7), UINT64_C(0xe24592d77cb7e4cb)}},
+  {{ UINT64_C(0x4a7d2546ade37cf4), UINT64_C(0x819c1b32aa1a43c1), UINT64_C(0xe5b43fbd6f790f09)}},
+  {{ UINT64_C(0x2d2279f08048d9ab), UINT64_C(0x20c5e3dd14d82c14), UINT64_C(0x6deb5fd913c08898)}},
+  {{ UINT64_C(0xb023cf09b0b59d9c), UINT64_C(0x74a2960fff4c6f19), UINT64_C(0x3e496193326a7644)}},
+  {{ UINT64_C(0x5c6c302cfd6bcd76), UINT64_C(0x9e21789888146205), UINT64_C(0x165e5b7752a7661b)}},
+  {{ UINT64_C(0x61c28e9f9f032ecc), UINT64_C(0x708fd9ff30c35169), UINT64_C(0x69182637f37333cb)}},
+  {{ UINT64_C(0x78abc36570e6af45), UINT64_C(0x9cb997d590418cc1), UINT64_C(0x9d80a7138a019cb9)}},
+  {{ UINT64_C(0x7288885d164322c8), UINT64_C(0x8d10b540191d75f8), UINT64_C(0x332318a28233552d)}},
+  {{ UINT64_C(0xb48279f5318a1a4e), UINT64_C(0x9aceb4de4df4606f), UINT64_C(0xaf9c69a2ff253cec)}},
+  {{ UINT64_C(0x6e0f27d4574036bd), UINT64_C(0xfd85375d04a93002), UINT64_C(0x4b920ce747837059)}},
+  {{ UINT64_C(0x6df4501eb17f7b32), UINT64_C(0x30f78e5bd7f5391b), UINT64_C(0xa4234fc62ebf9db8)}},
+  {{ UINT64_C(0x11d97c1b0a2fb2bd), UINT64_C(0xb3e2772590206dfe), UINT64_C(0x5b3db1440aef2386)}},
+  {{ UINT64_C(0x2ce7265a84c887d6), UINT64_C(0x879625de00da8d71), UINT64_C(0x2be2b0092731658f)}},
+  {{ UINT64_C(0x34f9355aad294e1e), UINT64_C(0xda4674a85dd1d2f2), UINT64_C(0xaaebfc6b6c6aa44d)}},
+  {{ UINT64_C(0xc12ad38c6739597a), UINT64_C(0xd7083259908b43e1), UINT64_C(0xb7f1768dd98e3737)}},
+};
+
+static const mzd_row192_t L_2[] = {
+  {{ UINT64_C(0x4fe31784d0f9255b), UINT64_C(0xd991e9e2084a0efc), UINT64_C(0xbb51a0ec5f4bce47)}},
+  {{ UINT64_C(0x5e37fe4f4981f789), UINT64_C(0x20a8d8c4e16db9ca), UINT64_C(0x72c17ac393e5e68b)}},
+  {{ UINT64_C(0x6a9bc945e6f2e2b6), UINT64_C(0xfde2746a4378c37a), UINT64_C(0x5e65094dc3256832)}},
+  {{ UINT64_C(0xcbf721b05b07f7ef), UINT64_C(0xce2f78e57945b6a2), UINT64_C(0x650f42c66ba4dfc0)}},
+  {{ UINT64_C(0xc962122e5787e493), UINT64_C(0xa64be2d6921d3f53), UINT64_C(0x01abdda4b6aceb0a)}},
+  {{ UINT64_C(0x1ad344fc8d9a83ab), UINT64_C(0xcbd891357cf5f543), UINT64_C(0x9135cad342b0875f)}},
+  {{ UINT64_C(0x582bd2e331b361bd), UINT64_C(0xfc17d2762cbfe78b), UINT64_C(0xabd58682c66901b7)}},
+  {{ UINT64_C(0x175001041fcb1258), UINT64_C(0xd5465c9684375d28), UINT64_C(0x602f9b085f403dff)}},
+  {{ UINT64_C(0x756846f8f730cea1), UINT64_C(0x5ae9f08e50b41134), UINT64_C(0xdd5d2f81c75ccaa3)}},
+  {{ UINT64_C(0x4ae09b04f6386e2a), UINT64_C(0xf7d1aca08e566986), UINT64_C(0xccb0c34ae18b5e72)}},
+  {{ UINT64_C(0x4fce16af75de3fdf), UINT64_C(0x0245cab803f7a4a8), UINT64_C(0xd93e0b43ab4dc5a9)}},
+  {{ UINT64_C(0x971595d1326b65c4), UINT64_C(0x1aa819966daff5b1), UINT64_C(0xffde9d9aff631632)}},
+  {{ UINT64_C(0xd1060a87a1e382bd), UINT64_C(0x652410b69ce62789), UINT64_C(0x83420aebd3fc21aa)}},
+  {{ UINT64_C(0x43e66dcf50eda7c8), UINT64_C(0xf1c49c025f7680e7), UINT64_C(0x759f2d3d0d32a8a8)}},
+  {{ UINT64_C(0x8dfac9a6bc4c6d9d), UINT64_C(0x2bea9e030d9f2ff3), UINT64_C(0x86de2bff21344824)}},
+  {{ UINT64_C(0x5000e1d50194d473), UINT64_C(0x30ed96d058296a80), UINT64_C(0xb2a0399c1673df7e)}},
+  {{ UINT64_C(0x38ca22fe548096ca), UINT64_C(0x43999b686d5cff1d), UINT64_C(0xdfdd3c64f8702b63)}},
+  {{ UINT64_C(0x71a11705393e7015), UINT64_C(0x436a0e481d18f2e1), UINT64_C(0xd0c999661990dc4f)}},
+  {{ UINT64_C(0xd91a99c8b3f7175a), UINT64_C(0x20dc55e4bbef24c3), UINT64_C(0xc0b688ece7f7794e)}},
+  {{ UINT64_C(0x965afdd9f2145ab9), UINT64_C(0xff3c3713ac31f863), UINT64_C(0x41c56e6f1d2bf9a2)}},
+  {{ UINT64_C(0xf9f1f96d1b856d51), UINT64_C(0xaed072065f59e7db), UINT64_C(0xf664d4a6813b4c9a)}},
+  {{ UINT64_C(0xf6a246a68869d632), UINT64_C(0xfeeaa3ed80ca9c71), UINT64_C(0xd3547dd49893dd9f)}},
+  {{ UINT64_C(0xa50bb7b76c1e0d72), UINT64_C(0xe29421387650830a), UINT64_C(0x31672eb0325b297d)}},
+  {{ UINT64_C(0x61f2e6c122a4cde9), UINT64_C(0xc9087098a681a924), UINT64_C(0x988b001140b3ff91)}},
+  {{ UINT64_C(0x1e4b71c50c1d7fe9), UINT64_C(0x6d274a519e071804), UINT64_C(0x6945eecc7c02f3a8)}},
+  {{ UINT64_C(0x5ba6d301f1881cd6), UINT64_C(0xaa7d5ab9240ba8b4), UINT64_C(0x90fa65cde86a9208)}},
+  {{ UINT64_C(0x7aae4ed1fb8d1de9), UINT64_C(0x7eb20c79c0834893), UINT64_C(0xf7c3339e4a882cb8)}},
+  {{ UINT64_C(0x594acfc705e9f6f9), UINT64_C(0xad0eb15f30aa7003), UINT64_C(0xc5052d2c4010d69c)}},
+  {{ UINT64_C(0x7262ab3ca044944c), UINT64_C(0xbc1628ef459964a8), UINT64_C(0xcd68dbe37278dde6)}},
+  {{ UINT64_C(0xf0672bc16789e370), UINT64_C(0x1333bb36f259472b), UINT64_C(0xf6c6d667da64711f)}},
+  {{ UINT64_C(0x81eac634c5e31179), UINT64_C(0x2a44095dc5498410), UINT64_C(0xb6c62d8eeefc815a)}},
+  {{ UINT64_C(0x4b685445adc9a542), UINT64_C(0xf41543cf667da199), UINT64_C(0x323f88e5c9450c59)}},
+  {{ UINT64_C(0xc643d0e2faa21551), UINT64_C(0x5943d43e995f0ef9), UINT64_C(0xb8a8a4cc07d48bfd)}},
+  {{ UINT64_C(0x488df57fb3da33b6), UINT64_C(0xcd0cd3c0bc249007), UINT64_C(0x963f689cd22034e7)}},
+  {{ UINT64_C(0xd22346c7e41ff4a9), UINT64_C(0x1633a5508544b21b), UINT64_C(0x751e090091ba9a1a)}},
+  {{ UINT64_C(0x631749e58395617a), UINT64_C(0xca1c72b3f5fb0103), UINT64_C(0xdbedca5a41b93732)}},
+  {{ UINT64_C(0xf62a137d09bac701), UINT64_C(0x639677a3ac22b970), UINT64_C(0xbc6041cb14d88f75)}},
+  {{ UINT64_C(0x868ad02e767aa1c2), UINT64_C(0x6c6d9efe37fdd895), UINT64_C(0x755af2a0912e81fa)}},
+  {{ UINT64_C(0x70e993053f4f9731), UINT64_C(0xfcc6d91ec3563a00), UINT64_C(0x6211677c5e8cb8b1)}},
+  {{ UINT64_C(0xf93ae94a99cbee9d), UINT64_C(0x2fc8fa43efd67979), UINT64_C(0x3de8321f17139c0c)}},
+  {{ UINT64_C(0x969bf42686ac314a), UINT64_C(0xe220ca2f9673c98d), UINT64_C(0x560852351c00e341)}},
+  {{ UINT64_C(0xcba8e42442fcd761), UINT64_C(0xc29f34c47178a07b), UINT64_C(0x9f99db93e4a82300)}},
+  {{ UINT64_C(0x4af723fae81d9292), UINT64_C(0x552f03568a324b42), UINT64_C(0xa58056ab5f321718)}},
+  {{ UINT64_C(0x7ac10da38e1d217e), UINT64_C(0x0e85e33997f448cc), UINT64_C(0xd3ec2e82127e70ac)}},
+  {{ UINT64_C(0xbd3bd9ffaf8638be), UINT64_C(0xa09ea0e7fb5aea8a), UINT64_C(0xe37a170ef2d75bd6)}},
+  {{ UINT64_C(0xe89b337ef1c79971), UINT64_C(0x2cff87ae97b11513), UINT64_C(0xb02ce77d03354be8)}},
+  {{ UINT64_C(0xbe7c8aca4e330c44), UINT64_C(0x69794f9b379316f1), UINT64_C(0xc136276b24ded021)}},
+  {{ UINT64_C(0x3a495a9eb9696a98), UINT64_C(0x3fcbe1ee677ae040), UINT64_C(0xde1d6028dac3e460)}},
+  {{ UINT64_C(0x3b7b8d647bc1c1cb), UINT64_C(0x5eb2ebb928716df6), UINT64_C(0x20cdfe029396f665)}},
+  {{ UINT64_C(0x87a006cb6038dea0), UINT64_C(0x0fee192863331c3b), UINT64_C(0xa44d8790cad351e5)}},
+  {{ UINT64_C(0x5d5145ca34fcbf37), UINT64_C(0x43fdc14a282289b4), UINT64_C(0xafa60b5c0cdb1d0a)}},
+  {{ UINT64_C(0x8b9fce6c5f2d451e), UINT64_C(0x6a3ca4ccc0af546d), UINT64_C(0x9e955ec3dcd4c239)}},
+  {{ UINT64_C(0x475f7ae8703adff1), UINT64_C(0x832e039de4a4b97b), UINT64_C(0x9dd12a3a3aa4ce0a)}},
+  {{ UINT64_C(0xe594d90430f00382), UINT64_C(0xf370654040d79f1f), UINT64_C(0xce08d54cd72f24fc)}},
+  {{ UINT64_C(0x7e83779c12ddcd8c), UINT64_C(0x98ad53e75fe63724), UINT64_C(0xb5e3957707944fe0)}},
+  {{ UINT64_C(0x8564a270dbf81c74), UINT64_C(0x76227398dc27ec91), UINT64_C(0x01e6fef9c0380aee)}},
+  {{ UINT64_C(0x14d1d578a73416b9), UINT64_C(0xdfd6d93079f9baf4), UINT64_C(0x91cccf217ca4fd22)}},
+  {{ UINT64_C(0xaa323558847fec9a), UINT64_C(0x6d6131b7653afd39), UINT64_C(0x0e1c0ed74cc02e11)}},
+  {{ UINT64_C(0x077de431cbf8e2aa), UINT64_C(0xc4ca0147cae35cdc), UINT64_C(0x98f886760522543d)}},
+  {{ UINT64_C(0x449071cccc04e02a), UINT64_C(0xbe9c576e0540e59e), UINT64_C(0x3972c69fc4628ae2)}},
+  {{ UINT64_C(0xcda0a89ac007d57a), UINT64_C(0x1c7c06e79e62c955), UINT64_C(0xe20039518bdf0aa7)}},
+  {{ UINT64_C(0x97ad96545f21882f), UINT64_C(0xc76b4c7abd85da96), UINT64_C(0x0a206264c0fd035a)}},
+  {{ UINT64_C(0x6d1a91e0ab60dc3a), UINT64_C(0x11685f5404a25347), UINT64_C(0xa3ec04efdcdc4f8a)}},
+  {{ UINT64_C(0x5a79af84013a7aed), UINT64_C(0xe93b18c29eeb3a4a), UINT64_C(0xc169df4b6f6a0c62)}},
+  {{ UINT64_C(0x0ef0d03bd7b775cd), UINT64_C(0x0ca46ab7fcb4af62), UINT64_C(0xc44232a168541eb8)}},
+  {{ UINT64_C(0x215ff52acb2067aa), UINT64_C(0x767f0fbae90f2e2c), UINT64_C(0x10de5d42915dc371)}},
+  {{ UINT64_C(0xd694edd048ed9d24), UINT64_C(0xb389abe331f43d60), UINT64_C(0x2606dc9be71ae92c)}},
+  {{ UINT64_C(0xbfb5dc15543475a7), UINT64_C(0xa0bb3aeb529a3796), UINT64_C(0x909c38e5408572fb)}},
+  {{ UINT64_C(0x7d95c744acdae783), UINT64_C(0xcc0871e06b9bfef4), UINT64_C(0xcbbd3e8a9e4f9b14)}},
+  {{ UINT64_C(0x93e28115a7b7a97f), UINT64_C(0x77cabfcc57375444), UINT64_C(0x27d7e219835a0ebf)}},
+  {{ UINT64_C(0x19c10813571b6026), UINT64_C(0xce693fc8e43516fc), UINT64_C(0xc542297fbb269ef6)}},
+  {{ UINT64_C(0xe299f66f15592c52), UINT64_C(0xdaacc59f96eabd93), UINT64_C(0xb67074b846fc38d9)}},
+  {{ UINT64_C(0x653614bc278b8068), UINT64_C(0x16c458b6179e6cd7), UINT64_C(0xc068f2b987ebda7a)}},
+  {{ UINT64_C(0xe9ddc873f71e8f33), UINT64_C(0x9ed2df8f69b3e520), UINT64_C(0x2d2ada04ea2b38c1)}},
+  {{ UINT64_C(0x635cf59dfb3d585c), UINT64_C(0xa37ceaacfef32432), UINT64_C(0x05bd311ee36dcfe8)}},
+  {{ UINT64_C(0x3e021f3a1054bfcb), UINT64_C(0x471bb290de878e2d), UINT64_C(0xc4c2581a6b298b4a)}},
+  {{ UINT64_C(0x38b60479d6c51992), UINT64_C(0x87c473b2d40969f8), UINT64_C(0x4baceb9928c3349a)}},
+  {{ UINT64_C(0x657b195d536304e1), UINT64_C(0x3853cb9f2d5d1e89), UINT64_C(0x1ae3f6709bbcd137)}},
+  {{ UINT64_C(0x11b7dd7e1263ccf8), UINT64_C(0xec95e3002d76f16c), UINT64_C(0xd4dcdf3ebe0376f4)}},
+  {{ UINT64_C(0xde6e054becd140ea), UINT64_C(0x55d98d113a77856f), UINT64_C(0x1174d8f998ed8c01)}},
+  {{ UINT64_C(0x9d0f1f5d567dfddf), UINT64_C(0xe570c6fd841958d4), UINT64_C(0x18426e59737c4b66)}},
+  {{ UINT64_C(0x0f9bc49069b627b8), UINT64_C(0xf94067e08bd8b4bd), UINT64_C(0x535502b620f3da67)}},
+  {{ UINT64_C(0xad9d79e789318893), UINT64_C(0x676238032d97a589), UINT64_C(0x741f73661513d10c)}},
+  {{ UINT64_C(0x73b8f373008ee043), UINT64_C(0x51d46a0a627b0923), UINT64_C(0xef1d6104251c2ed3)}},
+  {{ UINT64_C(0xd3ebca5a143d305e), UINT64_C(0xebe4832d9b657a30), UINT64_C(0xb7a8f9baac0436ca)}},
+  {{ UINT64_C(0x09a33f50c616f816), UINT64_C(0x963de9ba173e724a), UINT64_C(0x70e5423a016a26a3)}},
+  {{ UINT64_C(0xc6fe003b5e4b0ff8), UINT64_C(0xb894fe5e5e3525ad), UINT64_C(0x167ba728147eefb3)}},
+  {{ UINT64_C(0x5f5790908c71ede7), UINT64_C(0x660a2d6172aa2923), UINT64_C(0x270df853c702e2ea)}},
+  {{ UINT64_C(0x083f909b112fb463), UINT64_C(0xb50b3fd00bfc89ff), UINT64_C(0x6a270daf3a40e186)}},
+  {{ UINT64_C(0x68c2d1b0e4e53669), UINT64_C(0xd9489c464888ef02), UINT64_C(0xd7bae776b759c8e2)}},
+  {{ UINT64_C(0xdb6af7f6b41d06d7), UINT64_C(0xc2f8ccad51374ba1), UINT64_C(0x91265403e01fa695)}},
+  {{ UINT64_C(0x793d5c6777f9fba8), UINT64_C(0x75010e2c9209445e), UINT64_C(0xe4a7e6cbbc287ffd)}},
+  {{ UINT64_C(0x4c67b2ac7835f267), UINT64_C(0x632cbe7014a1a458), UINT64_C(0x94d5c2b72545b0d7)}},
+  {{ UINT64_C(0x1cc9db2dc2aa5f36), UINT64_C(0x5ffeebd45b8aa477), UINT64_C(0x6f93de2642238140)}},
+  {{ UINT64_C(0x352433d8ee283ca7), UINT64_C(0x96e545bae4d54cb5), UINT64_C(0x734241e82035af2d)}},
+  {{ UINT64_C(0x24b3fe7cce7ff883), UINT64_C(0x7043990c2f6c0495), UINT64_C(0x97b49fdff68953a0)}},
+  {{ UINT64_C(0x49942681fb3ec751), UINT64_C(0x60c8558e0cb5b06e), UINT64_C(0xe8d87da5035c5450)}},
+  {{ UINT64_C(0x314b7ffd9f5a591e), UINT64_C(0x753f56bd19364724), UINT64_C(0x8f59495ba96f94ac)}},
+  {{ UINT64_C(0x4eaafabd09488136), UINT64_C(0x9b8d6c95418e49c6), UINT64_C(0xc71b0f900080ebb2)}},
+  {{ UINT64_C(0x9e24991db207a84b), UINT64_C(0x6d00a42e61d40a26), UINT64_C(0x71768349ff02239a)}},
+  {{ UINT64_C(0x235c836c10c27daa), UINT64_C(0x27306b0fdc69bd75), UINT64_C(0xd5873e9c3a941152)}},
+  {{ UINT64_C(0xb112eb055b90c771), UINT64_C(0x1712f529a6ab524c), UINT64_C(0x9da52a0b0b07da72)}},
+  {{ UINT64_C(0x9be452cd0ef7ca7c), UINT64_C(0xde34dc82cad3de93), UINT64_C(0x29078cd61836d894)}},
+  {{ UINT64_C(0x43404815be2bb39c), UINT64_C(0xf055f8cd01921a6b), UINT64_C(0xc9121397f8f33061)}},
+  {{ UINT64_C(0x38d8d6ba237f6085), UINT64_C(0xd23beb3892ca2fca), UINT64_C(0xd9e18a4264847340)}},
+  {{ UINT64_C(0x58c5efa4c547924e), UINT64_C(0xf5880505d0c3a8ab), UINT64_C(0x589ed6da788d6a4d)}},
+  {{ UINT64_C(0xb199afafb85f9fe7), UINT64_C(0x3300a91626cff3ab), UINT64_C(0x7f9941720462f5f8)}},
+  {{ UINT64_C(0xefda0597d8628167), UINT64_C(0x78a81d28560cd71d), UINT64_C(0x949f1c0b9b5fa654)}},
+  {{ UINT64_C(0xcc0b89ecee794ecd), UINT64_C(0x5898a03a0d47413b), UINT64_C(0x5bb902ba6f4e1e01)}},
+  {{ UINT64_C(0xab84df1da2163a7e), UINT64_C(0xe0ce31007a11fe3c), UINT64_C(0x40d77670d5217a51)}},
+  {{ UINT64_C(0xab6665114aaf6276), UINT64_C(0xff437c2016162a33), UINT64_C(0xc5cc2b5f876ef7cd)}},
+  {{ UINT64_C(0xcea1608b1710ff57), UINT64_C(0x325cfc3024468c55), UINT64_C(0x7b8ed3b48969733a)}},
+  {{ UINT64_C(0xb88ce32b04d03f0b), UINT64_C(0x23568b13ed5aea89), UINT64_C(0x0e33c9684d80ec87)}},
+  {{ UINT64_C(0x26c201d6e540ab12), UINT64_C(0x6467ee56fdb9bf45), UINT64_C(0xb3b497207f87a192)}},
+  {{ UINT64_C(0x6b4c4252163d9e8a), UINT64_C(0x557b09c2e6ece58f), UINT64_C(0x536e361a3190675e)}},
+  {{ UINT64_C(0x04347c0af2984b0b), UINT64_C(0x1a03047e8b14b013), UINT64_C(0x222a95b056b31c34)}},
+  {{ UINT64_C(0xc87a160a80d01810), UINT64_C(0x9fda656add03150c), UINT64_C(0xcf23cb73ac97c7a5)}},
+  {{ UINT64_C(0x421d43650269eff5), UINT64_C(0xd1dc049b50078703), UINT64_C(0x6fa75e9d7085f40d)}},
+  {{ UINT64_C(0xe4acff9c27f0bf10), UINT64_C(0xb8861ac353533c8c), UINT64_C(0x14e6574c29d6e994)}},
+  {{ UINT64_C(0x391aa8a751eba815), UINT64_C(0x461c75a1453f4b98), UINT64_C(0x2d6c645ae917136a)}},
+  {{ UINT64_C(0x1adbaddfe486225f), UINT64_C(0xf5ac0c1e142d36c8), UINT64_C(0xdb340a526d37be1b)}},
+  {{ UINT64_C(0x312cc82e4b70c7f8), UINT64_C(0x8cbaf2da37bbefa2), UINT64_C(0x78ddbcbb5bed85ef)}},
+  {{ UINT64_C(0xea30bb07e85ee059), UINT64_C(0xdad6c80f653990a4), UINT64_C(0xbe1c901016eb2f8b)}},
+  {{ UINT64_C(0xd89cfde04fca0244), UINT64_C(0x59cbfcae821482f7), UINT64_C(0x224f335aa895d2a7)}},
+  {{ UINT64_C(0x16547575465e3c05), UINT64_C(0xd3b7423dd9e4234e), UINT64_C(0xc560a032859f9e77)}},
+  {{ UINT64_C(0x91dd938a44c59767), UINT64_C(0xa9439fd8872a485e), UINT64_C(0x23e9fc56d8cc9234)}},
+  {{ UINT64_C(0xf54aa2411bf41ecb), UINT64_C(0x874688ef21b70007), UINT64_C(0xd4673f7e04903716)}},
+  {{ UINT64_C(0x12bcc9b4e2d74b23), UINT64_C(0xda3090691f38c523), UINT64_C(0x78ca6487e065b082)}},
+  {{ UINT64_C(0x1981783f8efd80cc), UINT64_C(0x7dd33830c0b6a771), UINT64_C(0xcf95f51ca709f97e)}},
+  {{ UINT64_C(0x02eb43459fbb7abc), UINT64_C(0x8f98352c0fcc242d), UINT64_C(0x6081ff25aab4a235)}},
+  {{ UINT64_C(0x1618aa4774ee3d23), UINT64_C(0xea2b971042c6103f), UINT64_C(0xff4c93c2eb8b76ea)}},
+  {{ UINT64_C(0x36ed76ee2e031887), UINT64_C(0x1fafefd670f41510), UINT64_C(0xec69ba6a14e9ae52)}},
+  {{ UINT64_C(0xc6cb26e3687f5ec2), UINT64_C(0x653cafe590a9a350), UINT64_C(0xa64de7cb2896daa4)}},
+  {{ UINT64_C(0x70d26b67ae6e7f39), UINT64_C(0xae32cd2c1244b237), UINT64_C(0x677351b3fad45113)}},
+  {{ UINT64_C(0x75c824f4e5e951e3), UINT64_C(0xac722fe051091206), UINT64_C(0xb7381dd63892b895)}},
+  {{ UINT64_C(0xf827bcbc60c99581), UINT64_C(0xa2d951004b070827), UINT64_C(0xf16695153d9b62b6)}},
+  {{ UINT64_C(0x02bb8c6e36c01fab), UINT64_C(0xb10132736cde0f63), UINT64_C(0x2db1e071bced4436)}},
+  {{ UINT64_C(0xd5565db71d83b370), UINT64_C(0xe031c978b7c1967f), UINT64_C(0xca888877f457b6bd)}},
+  {{ UINT64_C(0x46773cacfb1ffbbf), UINT64_C(0xa8dbe70f4c1577a4), UINT64_C(0xf715258d1441196d)}},
+  {{ UINT64_C(0x6dedeb2f2bbf7185), UINT64_C(0xb697fba8e4f0fe7b), UINT64_C(0x1968a32b908547af)}},
+  {{ UINT64_C(0xe9b9bcd5919f7b68), UINT64_C(0x7c829669127314a8), UINT64_C(0x8c4d011d2bd62aaf)}},
+  {{ UINT64_C(0x0b96f49165f994e5), UINT64_C(0x122861e193bfde21), UINT64_C(0xaa084705851bba10)}},
+  {{ UINT64_C(0x42230378ab9bd5d7), UINT64_C(0x4f57976c05bc13c6), UINT64_C(0x9598f7368af583e1)}},
+  {{ UINT64_C(0xc4d62e90df0b2d69), UINT64_C(0x660711c3ec2faf90), UINT64_C(0x4860937cb3215dd7)}},
+  {{ UINT64_C(0xb6db8443ab570622), UINT64_C(0xde7704e8159e4d22), UINT64_C(0x4c0776df6504d4b6)}},
+  {{ UINT64_C(0xffffac3afec4bc71), UINT64_C(0x7f419b5af396bdb0), UINT64_C(0xbc222e1e5567574f)}},
+  {{ UINT64_C(0x7ab65be59c469f52), UINT64_C(0xc9d0e1ae5e17d7a8), UINT64_C(0xbb8b0c8234dffa33)}},
+  {{ UINT64_C(0x22dc643e0fb46e48), UINT64_C(0x00a4eeb576159825), UINT64_C(0x4f677cb286785388)}},
+  {{ UINT64_C(0x439af5d6ec8ed98f), UINT64_C(0x14aa0e8edaa88ac9), UINT64_C(0x7bb7577c62c0ca84)}},
+  {{ UINT64_C(0x9e264a9812c3e3c6), UINT64_C(0x862cf328cbe05a39), UINT64_C(0xec7dc7977a4db763)}},
+  {{ UINT64_C(0x273e270b10245982), UINT64_C(0x60bdf6f06ac74543), UINT64_C(0xc46c1fb776f2e628)}},
+  {{ UINT64_C(0x8b2328e040bf5379), UINT64_C(0xf0098813ae42ea60), UINT64_C(0x6748dca1501cd653)}},
+  {{ UINT64_C(0x6f3e63762bb1e166), UINT64_C(0x45fc97052fc06388), UINT64_C(0xf8592e28b323d1ea)}},
+  {{ UINT64_C(0xc751dcbc4961e17e), UINT64_C(0x36abaa9c4a7ef9dd), UINT64_C(0x37a6f24957fb5345)}},
+  {{ UINT64_C(0x295e3970e934f343), UINT64_C(0xc3da30a0ab760b00), UINT64_C(0xbc5d4c54d9315a6f)}},
+  {{ UINT64_C(0x47d74fd862c9824b), UINT64_C(0x758fb2b35bfa895c), UINT64_C(0x0ae975e59e66ed63)}},
+  {{ UINT64_C(0x3147d6f26931e327), UINT64_C(0x6e2398f39b67b544), UINT64_C(0x46e0e2daf7d89701)}},
+  {{ UINT64_C(0xc79ef94bf7612bae), UINT64_C(0x9ad3aacb9cbb146f), UINT64_C(0xadb18ee5a8d6c7da)}},
+  {{ UINT64_C(0xa95571353eea9329), UINT64_C(0xd9b4bd4b195f9059), UINT64_C(0x05911f448b551c33)}},
+  {{ UINT64_C(0xbef9acfae82294ac), UINT64_C(0x5fab000857687a36), UINT64_C(0xc89936f13d034713)}},
+  {{ UINT64_C(0x405856c54bc6f14f), UINT64_C(0xea24a1ea5aa98829), UINT64_C(0xe5782038602c79b6)}},
+  {{ UINT64_C(0x06032d24413b7d20), UINT64_C(0x0efb567ba740a0fe), UINT64_C(0x9dd22dc25418bff6)}},
+  {{ UINT64_C(0xe6caa9102a2d5cf2), UINT64_C(0xc2718877af9bb8f6), UINT64_C(0x25b69db4eb5f44d2)}},
+  {{ UINT64_C(0x4e31244d7010ff88), UINT64_C(0x1f4f8cc78c111159), UINT64_C(0x45be08e240aeb706)}},
+  {{ UINT64_C(0x9e11caaf3d73114d), UINT64_C(0x3fcdb343f0b89fa9), UINT64_C(0xa6c8cf80bed5a00f)}},
+  {{ UINT64_C(0xd201feeebfe47ab3), UINT64_C(0x623516a41180281d), UINT64_C(0x3ee51d7cd21f6b97)}},
+  {{ UINT64_C(0x566b13f8ad6c6ff8), UINT64_C(0x87df27a80aea24b4), UINT64_C(0xe338374a0533848f)}},
+  {{ UINT64_C(0x4ede7263c7948408), UINT64_C(0xe5e0f64abb048e77), UINT64_C(0x7b16bfa62527190d)}},
+  {{ UINT64_C(0x6ab7b498c23f4038), UINT64_C(0x9ebcd45300fe4daf), UINT64_C(0xa6203d5d3c8e7a8f)}},
+  {{ UINT64_C(0xc93745959d094d6f), UINT64_C(0x767fc4a9a5bec9bc), UINT64_C(0x3a6be60161e64e28)}},
+  {{ UINT64_C(0xd8241943d16c43e8), UINT64_C(0xac1f01a1980f9066), UINT64_C(0x4caa2db53717fe74)}},
+  {{ UINT64_C(0xabb9b6922b87610c), UINT64_C(0xef7317cc18091ba3), UINT64_C(0xd95cf6dc50dfb134)}},
+  {{ UINT64_C(0x72dea4cf7112207e), UINT64_C(0xd6b8323db15932aa), UINT64_C(0xf76dcf1a025a2472)}},
+  {{ UINT64_C(0x42be9842c796aa20), UINT64_C(0x554ac916f4f596b8), UINT64_C(0xa6e09d4a0697ee78)}},
+  {{ UINT64_C(0x3e6dfbeba8bcea0b), UINT64_C(0x4e63e3ad9fcb5ea6), UINT64_C(0xd81bd137b2eced23)}},
+  {{ UINT64_C(0x91fa9cb02b0c96e3), UINT64_C(0x7b34b5126566cea6), UINT64_C(0x0205d93334454aeb)}},
+  {{ UINT64_C(0x8abe6e021158f30f), UINT64_C(0xf13d84df52ff6479), UINT64_C(0x48af6c1006916763)}},
+  {{ UINT64_C(0xebe9a7f563566c0f), UINT64_C(0xd1f75015f957b7d0), UINT64_C(0x7ae9b90d79a7edc6)}},
+  {{ UINT64_C(0xbc7a7c31ea88a667), UINT64_C(0x63e6fbe03099ca5d), UINT64_C(0x391aee7a987a23f6)}},
+  {{ UINT64_C(0x4879f125dbf14f1e), UINT64_C(0x6b931478eb77e6b0), UINT64_C(0x218856e8bb86a9e8)}},
+  {{ UINT64_C(0x1a8ea74e5524422a), UINT64_C(0xeaaec24353363c2a), UINT64_C(0xa25d057d7afe255a)}},
+  {{ UINT64_C(0xdbd98892b3e314ea), UINT64_C(0x7d16b66de8c95de7), UINT64_C(0x7c27dca256e3bf88)}},
+  {{ UINT64_C(0x6e7e93dfabd9c12a), UINT64_C(0x8d613d681511ee67), UINT64_C(0xc5aeaa822801f6bd)}},
+  {{ UINT64_C(0x7c85155de90f1969), UINT64_C(0x5fcc501cfa7d7b35), UINT64_C(0x05875663c3c03286)}},
+  {{ UINT64_C(0xfd840d7b02fca1ea), UINT64_C(0xadcc26c521ff4374), UINT64_C(0x9245f9958cc6b1dd)}},
+  {{ UINT64_C(0xe617f3a2948b225b), UINT64_C(0xf9ab7a71562bb7a6), UINT64_C(0x717c82a545b72fd3)}},
+  {{ UINT64_C(0x829cd4cb5765b5ca), UINT64_C(0xc34a43d84537d057), UINT64_C(0xef37b1823d34a685)}},
+  {{ UINT64_C(0xe5e83ec92f5650f1), UINT64_C(0x3eddc384a2dee51d), UINT64_C(0x8b5960fa74b1082b)}},
+  {{ UINT64_C(0x3b9dd2807ed3ee1a), UINT64_C(0x84e2881af464355f), UINT64_C(0x3f4cb5bade8c360a)}},
+  {{ UINT64_C(0x22b13e10d40404d2), UINT64_C(0xe69b6584932fddc3), UINT64_C(0x21026f26dbba314a)}},
+  {{ UINT64_C(0x16d68d84a429d3d2), UINT64_C(0xc2ef9b8158daf4d5), UINT64_C(0xec7fe1ef61423c15)}},
+  {{ UINT64_C(0x848a34f7110b4691), UINT64_C(0xb7637b5121f980f6), UINT64_C(0x9e4bfdc614191bc4)}},
+};
+
+static const mzd_row192_t L_3[] = {
+  {{ UINT64_C(0x2ee637cd06f00878), UINT64_C(0x83de691082849931), UINT64_C(0x76ef555fa1ae11b0)}},
+  {{ UINT64_C(0xf929f375583c505a), UINT64_C(0xabbe82439f3f29d3), UINT64_C(0x0fd06f74ee9ef0e6)}},
+  {{ UINT64_C(0x8f0e70474cda4023), UINT64_C(0xd98eed07f731e8a4), UINT64_C(0xb72e2681b2090174)}},
+  {{ UINT64_C(0x1be590952432c23e), UINT64_C(0x16538ab19587513b), UINT64_C(0x40c418c2ac49f482)}},
+  {{ UINT64_C(0x24ce98e5d468107b), UINT64_C(0x4c6c94d286577292), UINT64_C(0x27946077b434343d)}},
+  {{ UINT64_C(0x9ee20aabcb2baf0c), UINT64_C(0xee74eab4ac3fc032), UINT64_C(0x31e61433fbcd926d)}},
+  {{ UINT64_C(0x15e11074b2095d38), UINT64_C(0x2be0e2b691f333b0), UINT64_C(0x91b608225af99294)}},
+  {{ UINT64_C(0x124512f1d5bc85ff), UINT64_C(0xe7662751ec8abe0a), UINT64_C(0xbc20f097712e6ded)}},
+  {{ UINT64_C(0x7975d6dcc532acc5), UINT64_C(0xf7915f1dc63f22d3), UINT64_C(0xb5b626afb9373c38)}},
+  {{ UINT64_C(0x39c4d8bc2cb28baf), UINT64_C(0x1be53d1911073d80), UINT64_C(0x96ead496d6ba77c1)}},
+  {{ UINT64_C(0x1142cf13feb995fb), UINT64_C(0x3e40aa0a1a95db22), UINT64_C(0x48cc0e542c11476a)}},
+  {{ UINT64_C(0xfa6ad4be451a7fb2), UINT64_C(0xc873bf9cbf09c854), UINT64_C(0x4ffe72009d2a3d6d)}},
+  {{ UINT64_C(0x577ab19f11158d24), UINT64_C(0x7e8bad86eb147835), UINT64_C(0x3459e048e034bc52)}},
+  {{ UINT64_C(0x459be0f70185fd71), UINT64_C(0xb0a611b54ed555d5), UINT64_C(0x5ef0b904841a62fe)}},
+  {{ UINT64_C(0x0eb7eb8dfeacac85), UINT64_C(0x1633933c1d2e0826), UINT64_C(0x7db0dc9c60961b83)}},
+  {{ UINT64_C(0xfa658433adaf299c), UINT64_C(0x806239ad1a792092), UINT64_C(0x1a254f896f85bdb4)}},
+  {{ UINT64_C(0x450bf4d1a9e170cc), UINT64_C(0x5220be6b02d9a308), UINT64_C(0x0c7590101872d407)}},
+  {{ UINT64_C(0x909ba4ec1a1fb943), UINT64_C(0xfb1bf2c499df2971), UINT64_C(0x91f2a4372ff487dc)}},
+  {{ UINT64_C(0xad3d552eb261e519), UINT64_C(0x357e5d608c53a530), UINT64_C(0x3003bfb46f82e573)}},
+  {{ UINT64_C(0x6389dd462ad5d114), UINT64_C(0xa6a46c780defe3d3), UINT64_C(0x64a4811618899a7d)}},
+  {{ UINT64_C(0x9e90835f7b2eea0a), UINT64_C(0x86ccd577511ebc8c), UINT64_C(0xf3c6b589bf448677)}},
+  {{ UINT64_C(0x68a17afae6b21517), UINT64_C(0x5f0f78e0cb030ae3), UINT64_C(0xa91b0b4d7d1010c2)}},
+  {{ UINT64_C(0xcec8f61c92e00558), UINT64_C(0xfda3540c94a598c4), UINT64_C(0xdf3d3b09d3507b9a)}},
+  {{ UINT64_C(0x640f1d775e7ced18), UINT64_C(0x663137ccfc897211), UINT64_C(0x1f37698646863d6a)}},
+  {{ UINT64_C(0xa52d6746d246eab1), UINT64_C(0x6a572dfaf4fdde87), UINT64_C(0x081a38826d20dc8b)}},
+  {{ UINT64_C(0xb199657ba9d3cd25), UINT64_C(0x40e2bec80fd64449), UINT64_C(0x195a6c0f01b3bfff)}},
+  {{ UINT64_C(0x1cbbf0a55bdf5e74), UINT64_C(0x3708e9ec3ec8fc83), UINT64_C(0x0f9d9a421c102574)}},
+  {{ UINT64_C(0x3c0f780d9d130b62), UINT64_C(0x455e13cd1f98acf6), UINT64_C(0xdca9791af627c4d0)}},
+  {{ UINT64_C(0x6a0b6ae7b6971f3f), UINT64_C(0xe56b6b2979070977), UINT64_C(0xea003965de322f79)}},
+  {{ UINT64_C(0x0d43a02716d3cf4a), UINT64_C(0xbd424f74d3e1661c), UINT64_C(0xe2f14c81b6536456)}},
+  {{ UINT64_C(0x6676a71249d8c0bf), UINT64_C(0x84f26b9fb8dd1eae), UINT64_C(0xa98f1fd9c29924cc)}},
+  {{ UINT64_C(0x1209627d24e32411), UINT64_C(0x3230caa6391c36f7), UINT64_C(0x87620ac87145c0f8)}},
+  {{ UINT64_C(0x47dfebf160c2d23f), UINT64_C(0x3d38acc75f7077b9), UINT64_C(0x701d1a95c58c1175)}},
+  {{ UINT64_C(0x71ab2f625cd11a01), UINT64_C(0x476466a20d242002), UINT64_C(0x7f3b63cbbf565a83)}},
+  {{ UINT64_C(0x3579bc7afc05d6ec), UINT64_C(0x6f447d94758de213), UINT64_C(0x02f427d326f56ea5)}},
+  {{ UINT64_C(0x56ddc6317eb89558), UINT64_C(0xc254155d360f328d), UINT64_C(0x94db3376c9b93033)}},
+  {{ UINT64_C(0xc486095dfeb25dbc), UINT64_C(0x33637a1a14da11cf), UINT64_C(0xa44edbb2d5280d68)}},
+  {{ UINT64_C(0x1de3d9af265216fb), UINT64_C(0xab68856842bd8e3e), UINT64_C(0xcde0cbea0fb723a2)}},
+  {{ UINT64_C(0x8abea48ec35ec662), UINT64_C(0x65f20764d7676a66), UINT64_C(0x30c2275bee9750f6)}},
+  {{ UINT64_C(0x8d9fb7deacf87fd0), UINT64_C(0x8c6e00a93c985c07), UINT64_C(0xce824f0f2fa50c0d)}},
+  {{ UINT64_C(0x441478cecaf70d3b), UINT64_C(0xec1d18d6b92ce9d1), UINT64_C(0xf81d0c9986848d72)}},
+  {{ UINT64_C(0x3705547e2a54b8c0), UINT64_C(0xc8f354cdf91f2433), UINT64_C(0xe740d025f40b85ad)}},
+  {{ UINT64_C(0x61f9e1c710df9b17), UINT64_C(0x8e33b4e2480a5e81), UINT64_C(0x3d793b57bf9d3962)}},
+  {{ UINT64_C(0x92308c4eb828c176), UINT64_C(0x23a3bfdbd8bb81f8), UINT64_C(0xe4a8f6693891d0e3)}},
+  {{ UINT64_C(0x92efe3e4bd9af09f), UINT64_C(0x1cd3ce06fe55e6a9), UINT64_C(0x9334d11623a6fe58)}},
+  {{ UINT64_C(0xb906853144638e33), UINT64_C(0x7399ee7066c99b7b), UINT64_C(0xddebbfdabcbb55e1)}},
+  {{ UINT64_C(0xb11c070baef4e1e5), UINT64_C(0x4cbde4ed66c1c7f9), UINT64_C(0xced726d137b460aa)}},
+  {{ UINT64_C(0x1df49f6ac9ebffff), UINT64_C(0xbd974a71931c5a9f), UINT64_C(0x7ec34789437beee1)}},
+  {{ UINT64_C(0x214ba35e63800394), UINT64_C(0x48b9a2fb1c1398bd), UINT64_C(0x986d24fb8f697911)}},
+  {{ UINT64_C(0x23a343beafd0bc68), UINT64_C(0x68d8e26814f6496a), UINT64_C(0x7d4ff1a0c54fdbd0)}},
+  {{ UINT64_C(0x1e05c9a780659600), UINT64_C(0xd2cf7e5d4e2f4bea), UINT64_C(0x31f94d3befbb96b1)}},
+  {{ UINT64_C(0xed07138641febc82), UINT64_C(0x328133f2cb186dda), UINT64_C(0xf85a11721d0cf84f)}},
+  {{ UINT64_C(0x7dd0ae5ba83c8eac), UINT64_C(0xc2624c5d908bb900), UINT64_C(0x975af8b55a32eca3)}},
+  {{ UINT64_C(0xe53ca8c3870cbb81), UINT64_C(0x00a395d219d9d057), UINT64_C(0x14c2b3d49716e1b1)}},
+  {{ UINT64_C(0xfcaa6813996fbff3), UINT64_C(0x9da3c9b840fc91ee), UINT64_C(0xc289ae86a6717afd)}},
+  {{ UINT64_C(0xc86607e540a3f0d2), UINT64_C(0x87733e2a3ae6d90d), UINT64_C(0xe2c432dddce22201)}},
+  {{ UINT64_C(0x67c68bdf9e6b676a), UINT64_C(0xbd2f981408018a33), UINT64_C(0x7dd3f63826404ba3)}},
+  {{ UINT64_C(0x2fcf1d5852908548), UINT64_C(0x4dab5ed44bef20f9), UINT64_C(0x815bc99ff3859ee8)}},
+  {{ UINT64_C(0x787279658692f4f6), UINT64_C(0x99a1c26bf0932bf7), UINT64_C(0xa532a02b70d482f7)}},
+  {{ UINT64_C(0x61ad887998ecde04), UINT64_C(0x48421c64d5537ede), UINT64_C(0xf8b4249b11b09faf)}},
+  {{ UINT64_C(0xbcbe726429e81d44), UINT64_C(0x3dbec35a8d689740), UINT64_C(0x5f25317c45b805ee)}},
+  {{ UINT64_C(0xd0fd6f53d95bba49), UINT64_C(0x61fc11f277dbd2d8), UINT64_C(0x565cd697e3f77d33)}},
+  {{ UINT64_C(0x44720ab591aa8230), UINT64_C(0xd3f57785c143cd85), UINT64_C(0x603c843c1d3fa31e)}},
+  {{ UINT64_C(0xb4e6fd41de5ceb42), UINT64_C(0xff2b12742aefc536), UINT64_C(0x068e9b3900b097a7)}},
+  {{ UINT64_C(0xbc1a071318d2cf54), UINT64_C(0x5f1c7b7f17e46132), UINT64_C(0xbe2e1b75c70d05a7)}},
+  {{ UINT64_C(0xae879547020bea31), UINT64_C(0xccadbf7a756f67a7), UINT64_C(0x78e2f26a26b1764d)}},
+  {{ UINT64_C(0x1a9f0da9e7b06caf), UINT64_C(0x4a44a005f31fd8e3), UINT64_C(0xb8dfb38dfd2e5a3a)}},
+  {{ UINT64_C(0x1fa4f53cf3eecc0f), UINT64_C(0x1bcd250082b79b6e), UINT64_C(0x7093bce383c9377e)}},
+  {{ UINT64_C(0x007008aa4a57719c), UINT64_C(0x7c4e4c7430867416), UINT64_C(0xaa9fd72e98967637)}},
+  {{ UINT64_C(0x3aeff35ed6d61bdc), UINT64_C(0x2cd186370e60bedc), UINT64_C(0xf43aedc49026f63c)}},
+  {{ UINT64_C(0xede72b97390bdc0e), UINT64_C(0xf107094448b3896e), UINT64_C(0x1bf4874bcb26d7eb)}},
+  {{ UINT64_C(0x58958f5efa8e0ab8), UINT64_C(0x85c5721d03e65f9c), UINT64_C(0x759a5c4a50d47219)}},
+  {{ UINT64_C(0x6127e18f8c9fd7a9), UINT64_C(0x59771da793763352), UINT64_C(0x96bde3e40355b9d6)}},
+  {{ UINT64_C(0x6c3aa3b5bb64c7a7), UINT64_C(0x087f17862677c390), UINT64_C(0xa35e3745bfc4631f)}},
+  {{ UINT64_C(0x82630356d3c9d82f), UINT64_C(0xa0f3e6e102a723cc), UINT64_C(0xd03971d35c50b0e7)}},
+  {{ UINT64_C(0x03fe040345194c1a), UINT64_C(0x571e5268bf630d66), UINT64_C(0x2f4a64e1eafb0c84)}},
+  {{ UINT64_C(0x09ac3b593032e9a5), UINT64_C(0x72a4111f92173883), UINT64_C(0x519455c05c971fdd)}},
+  {{ UINT64_C(0x9e5b3a1932e19ac6), UINT64_C(0x53bcdf4fb65cb0c3), UINT64_C(0xcfb455c107247ccf)}},
+  {{ UINT64_C(0x9d4d681e0b27c62b), UINT64_C(0x3f7c39c7c99fa77b), UINT64_C(0x6e4dd1df86b312da)}},
+  {{ UINT64_C(0x8a0603da3470416e), UINT64_C(0x00670811a370726e), UINT64_C(0xa6b991de8ab0d7ed)}},
+  {{ UINT64_C(0x313894065e8ae81d), UINT64_C(0x351f441f5eec074b), UINT64_C(0x61491a9af477aaba)}},
+  {{ UINT64_C(0x2ac7c1c2178fe1a5), UINT64_C(0xd79df0e73b3bb247), UINT64_C(0x108411583e855299)}},
+  {{ UINT64_C(0x3ae404cf9ecb68d4), UINT64_C(0xcbfca82d3e451daf), UINT64_C(0xb0fccb40f8622a10)}},
+  {{ UINT64_C(0xa51bf986797e8b6a), UINT64_C(0x820a8f3beb831ec4), UINT64_C(0xf93716ebe6ae64a5)}},
+  {{ UINT64_C(0x22a0b91488e6976d), UINT64_C(0xebd0bd69c293fd5a), UINT64_C(0x695fc29478a890aa)}},
+  {{ UINT64_C(0x4a4702fc7e1220af), UINT64_C(0xcde3036edbdc8952), UINT64_C(0xf24cc01a9fed145b)}},
+  {{ UINT64_C(0x414c8372bf10a0f2), UINT64_C(0xd857998823ca419d), UINT64_C(0xcf72185f28d54953)}},
+  {{ UINT64_C(0xaf6e3f5e3348d08c), UINT64_C(0xe74ce0e23b74d0c1), UINT64_C(0xd4b2e8415c891c58)}},
+  {{ UINT64_C(0xfc6c6192d77615b7), UINT64_C(0x7e44be76170c3f86), UINT64_C(0xaa5a0624c6942005)}},
+  {{ UINT64_C(0x29319ecd73bf3d46), UINT64_C(0xb918f9599c868a5f), UINT64_C(0xb5996cfdb15b0aa9)}},
+  {{ UINT64_C(0xd46b10ac00362af3), UINT64_C(0xd0103292d7afd343), UINT64_C(0x0fb1e64a98a579d6)}},
+  {{ UINT64_C(0xe58dcd0b8821d9c3), UINT64_C(0x94f51bb19f899115), UINT64_C(0xdf7fe9931e2283e6)}},
+  {{ UINT64_C(0x2e42fa9e486e264c), UINT64_C(0x13d6b710601dc105), UINT64_C(0x319ec2f7aae26fdd)}},
+  {{ UINT64_C(0xb8e1c8ea765f4319), UINT64_C(0xc202ba41c5080112), UINT64_C(0x9250caeeb020b374)}},
+  {{ UINT64_C(0xfc33daccd588147e), UINT64_C(0x5213adfb9be7ccc5), UINT64_C(0xdb2e34c25e9a9a21)}},
+  {{ UINT64_C(0x58f93fdc47c3f6bf), UINT64_C(0xc9ca4f9a395e7234), UINT64_C(0xbb1d4f9fe6bf0dc0)}},
+  {{ UINT64_C(0x4778494af7dad1e0), UINT64_C(0xebccce6195dedc23), UINT64_C(0xa3c5bcb57f4f549d)}},
+  {{ UINT64_C(0xea187f5a5737ba77), UINT64_C(0xf6b681316d64a7d1), UINT64_C(0x755ba06707ad77ff)}},
+  {{ UINT64_C(0xe06b1f9013301732), UINT64_C(0xa3c58a3eb85a8b4f), UINT64_C(0x649d3db927dc3a87)}},
+  {{ UINT64_C(0x8a3d688bd9ebb4c8), UINT64_C(0xc2980022276e877e), UINT64_C(0xd2646b1d1989bec5)}},
+  {{ UINT64_C(0xf14a623f909a3cac), UINT64_C(0xff7c182664fab103), UINT64_C(0x7747c72e93ceb26b)}},
+  {{ UINT64_C(0x0d63daa6993aeb4f), UINT64_C(0x52c1fbfbbc6facea), UINT64_C(0xcd4502fe20c0b38e)}},
+  {{ UINT64_C(0xfadd15dde95f1f3b), UINT64_C(0x0054a084b101343e), UINT64_C(0x2994cbb3be394ba7)}},
+  {{ UINT64_C(0xcd5da0a29cea4b88), UINT64_C(0x8ef2b7100f7e55d0), UINT64_C(0x6d2564ef44705653)}},
+  {{ UINT64_C(0x052438db3e9b6312), UINT64_C(0x91b8821574ea0317), UINT64_C(0x9aa71e8ec7d418b4)}},
+  {{ UINT64_C(0xec8d7f4e0774df63), UINT64_C(0x5af352eec49ecf8d), UINT64_C(0x05b37affab2ebeff)}},
+  {{ UINT64_C(0x3032531167d431ca), UINT64_C(0x13bd952270833fdd), UINT64_C(0xbcd4eaead851c7b5)}},
+  {{ UINT64_C(0x59370ac1c87f561a), UINT64_C(0xc9f6b9b7723e5f9f), UINT64_C(0xed1cb5ec4c11352a)}},
+  {{ UINT64_C(0x70872f885d31c6f3), UINT64_C(0x0810effa35d98c18), UINT64_C(0x84680e29a68488b6)}},
+  {{ UINT64_C(0x74886ffe9c7190f7), UINT64_C(0x4beb1c157add308b), UINT64_C(0x8ab28b81937b8075)}},
+  {{ UINT64_C(0x532418b0c342be53), UINT64_C(0xbc2845b84863b259), UINT64_C(0xcda2443202dc9aca)}},
+  {{ UINT64_C(0x4205280208bab732), UINT64_C(0xe3f7d9e7b622b1ac), UINT64_C(0xd18433d0c3fb2401)}},
+  {{ UINT64_C(0x89023a413f20390b), UINT64_C(0xb2ef1a067b9b6624), UINT64_C(0x73dea803c13390c9)}},
+  {{ UINT64_C(0x4628422fc3166306), UINT64_C(0x06a62547f270b34c), UINT64_C(0xa92bfc0380cdf314)}},
+  {{ UINT64_C(0x7176602137cdf00a), UINT64_C(0xe75cd69b0f55418a), UINT64_C(0x2bd045b0ff109b62)}},
+  {{ UINT64_C(0x20a81d9325a4720c), UINT64_C(0xd52b8438d1e8dfc1), UINT64_C(0x407d857720e71533)}},
+  {{ UINT64_C(0x596955de2f294c83), UINT64_C(0x239d632217bdce8d), UINT64_C(0xd8cc25ad8dabd4cd)}},
+  {{ UINT64_C(0x01090ef7908f749c), UINT64_C(0x9b45492bb0159a4b), UINT64_C(0x54dab779dea7a06d)}},
+  {{ UINT64_C(0xe879951c6fb6cb60), UINT64_C(0x711c14bba058eb11), UINT64_C(0x279c56d526503ca2)}},
+  {{ UINT64_C(0x59e4938241b37b83), UINT64_C(0x5fa0ddd78e96dd41), UINT64_C(0xea42ae5e4b296a70)}},
+  {{ UINT64_C(0x200659ebc9b6c0fb), UINT64_C(0xa519ac4df77f03b4), UINT64_C(0x5f3c6300ec513688)}},
+  {{ UINT64_C(0x1f9f6a1324fdafa7), UINT64_C(0x1ddaf46e1d2d99ba), UINT64_C(0x2c3d61035d9036b3)}},
+  {{ UINT64_C(0x59aceafa41a012a8), UINT64_C(0x7ca2a3044b054cb8), UINT64_C(0x6b1d381f89e74b8b)}},
+  {{ UINT64_C(0x86740033717cf6eb), UINT64_C(0xf6596f55e04e5fdc), UINT64_C(0x05023a0950fead64)}},
+  {{ UINT64_C(0x64f9dcb9ac53b8da), UINT64_C(0xfb30fb87348b9b0c), UINT64_C(0x3336c8de7a2f024b)}},
+  {{ UINT64_C(0xa92201d75b265fe3), UINT64_C(0x47e1a4f5739881fb), UINT64_C(0x12a07ec42ced7f10)}},
+  {{ UINT64_C(0x0ef7058ffccafccd), UINT64_C(0x38941d8833dfd6d2), UINT64_C(0x177a637d0141a803)}},
+  {{ UINT64_C(0x110880bdd8353651), UINT64_C(0xb45cbe2825f01814), UINT64_C(0x1110af29f5f426ba)}},
+  {{ UINT64_C(0xa04c4df7cf919895), UINT64_C(0x13d63a3f6a3b9ad0), UINT64_C(0x43a2ab100e56a787)}},
+  {{ UINT64_C(0xe3ab9ef74f8fa762), UINT64_C(0x85e1390bbb9f1ff0), UINT64_C(0x19dbf875dcc61bba)}},
+  {{ UINT64_C(0x0099bc8b5429051e), UINT64_C(0xbbd8e075f452f351), UINT64_C(0xd38099eee90e6fab)}},
+  {{ UINT64_C(0x21574227cd56aad2), UINT64_C(0x8f2271e935aa5d3b), UINT64_C(0x8a20331e225d5f70)}},
+  {{ UINT64_C(0x5a2fe308c6531fde), UINT64_C(0xc3ad4c6a71f08cbc), UINT64_C(0xfda4c3963c0de7dc)}},
+  {{ UINT64_C(0xae1303974f938316), UINT64_C(0x046bbc9a1dea2790), UINT64_C(0x6c8aa3cbc1a37c9e)}},
+  {{ UINT64_C(0x0350245ddb6eb25b), UINT64_C(0x215b649f08831467), UINT64_C(0xb72f5d57e9e3d35d)}},
+  {{ UINT64_C(0xc59a956c70c0a207), UINT64_C(0xa9442bef575f63cf), UINT64_C(0x760bb191c0291bba)}},
+  {{ UINT64_C(0x9ba2b1e11e885efc), UINT64_C(0x9f85b9a866790383), UINT64_C(0xe73d9edd95e7b618)}},
+  {{ UINT64_C(0xbd320f74234eec5c), UINT64_C(0xedf97d12d0afdca7), UINT64_C(0x1bf294f304d0379f)}},
+  {{ UINT64_C(0x97aa1a46eebedd7e), UINT64_C(0x210545ccdab9812f), UINT64_C(0x888b0fd92235b08c)}},
+  {{ UINT64_C(0x80a90254178aa709), UINT64_C(0x139f28a8108a782b), UINT64_C(0xe58806645c63b112)}},
+  {{ UINT64_C(0x3ebba729cdb8fd04), UINT64_C(0xca60ecb438aaee6f), UINT64_C(0x053c9bc3fcdac97a)}},
+  {{ UINT64_C(0x60fc38bdee323575), UINT64_C(0x7be7a0db2783c70f), UINT64_C(0xc0c51a72a36c70e1)}},
+  {{ UINT64_C(0x5cf01c26a9a99865), UINT64_C(0x4590c09167f93587), UINT64_C(0xb221d967f1b65da6)}},
+  {{ UINT64_C(0x5c2fb229ecee66a4), UINT64_C(0x8be9891ef9d5320f), UINT64_C(0x0d03d7133c1002a5)}},
+  {{ UINT64_C(0xb4d6dc6cb400df12), UINT64_C(0x9055b4a54ca47390), UINT64_C(0x2d97fd491f0e87ac)}},
+  {{ UINT64_C(0x04a6e2a619ff968d), UINT64_C(0x68b3f5795168bd71), UINT64_C(0x173f7e773ddd166c)}},
+  {{ UINT64_C(0x0ac780b7a594ffa0), UINT64_C(0xc5128b42ee343c68), UINT64_C(0xb328e818daed44cd)}},
+  {{ UINT64_C(0x5e01eded7a8f9f75), UINT64_C(0x2fc11813ff37f4e2), UINT64_C(0x65017f2202d0e570)}},
+  {{ UINT64_C(0xba670146c4969643), UINT64_C(0x9573e8a8cff609de), UINT64_C(0x68151b7e3fd55651)}},
+  {{ UINT64_C(0xe4fe600c0f69ddc0), UINT64_C(0xbd0a3d5f6deed206), UINT64_C(0x474544e31f4240b8)}},
+  {{ UINT64_C(0x8daa13f127611be5), UINT64_C(0xa0bfe8ff94c3b347), UINT64_C(0x33504cedf225b7f5)}},
+  {{ UINT64_C(0x3ccfa1b4bd9358ed), UINT64_C(0x4ae31ec7a5e64f46), UINT64_C(0x2776e9b66a976e61)}},
+  {{ UINT64_C(0xcf56150a71ec45c0), UINT64_C(0xf0c6097f1f0e6e3d), UINT64_C(0x9b551944019c73a5)}},
+  {{ UINT64_C(0x46e9d57dac1f85aa), UINT64_C(0x3cda081488048682), UINT64_C(0x3b6ebdf2077ec6b8)}},
+  {{ UINT64_C(0x861e27ee7c7e15f8), UINT64_C(0xf2b8afc6c7fdf38c), UINT64_C(0x2f57236f125a47d4)}},
+  {{ UINT64_C(0xa661b1972a5fb091), UINT64_C(0x9b7b955e863e27b5), UINT64_C(0xae5ea83ee1831bb1)}},
+  {{ UINT64_C(0x5cdbf282754191d1), UINT64_C(0x9eb5f2629eb58a4e), UINT64_C(0x06ddb78daad0a0d4)}},
+  {{ UINT64_C(0xe11b0c2006dd47ad), UINT64_C(0xe493a5d89d4131b8), UINT64_C(0xff1059d8add8eb75)}},
+  {{ UINT64_C(0xd56b37d92e0863f8), UINT64_C(0x990c639e5669c3ba), UINT64_C(0x3cfdc0684233e9e6)}},
+  {{ UINT64_C(0x98f2ecd8fe402c19), UINT64_C(0x4fff1aca76c94df1), UINT64_C(0x87830c3b76003380)}},
+  {{ UINT64_C(0xcb0557b4fc4afbf0), UINT64_C(0xa0e617346fc1e42a), UINT64_C(0x02408846f8d5e619)}},
+  {{ UINT64_C(0x4493f0aef0d1632a), UINT64_C(0x062d2453014330d9), UINT64_C(0xfc870ebc2cc3b502)}},
+  {{ UINT64_C(0x91c2891ef8d05476), UINT64_C(0xe4872af37e30a99a), UINT64_C(0xb5037fa9ed6cc8de)}},
+  {{ UINT64_C(0x667c849a80cb9815), UINT64_C(0x7b60b1a4221d108b), UINT64_C(0x45be31ced5d71505)}},
+  {{ UINT64_C(0xb2756d16123b8420), UINT64_C(0x7b2b39b0d50ab333), UINT64_C(0xf1391c086180a208)}},
+  {{ UINT64_C(0x66b3c9f746dd3b61), UINT64_C(0xcb9d3fd26f787032), UINT64_C(0x2282b86a3635a129)}},
+  {{ UINT64_C(0xf4d71acbee9297df), UINT64_C(0x12652cc5f39779d6), UINT64_C(0x5855bdadc6a022b3)}},
+  {{ UINT64_C(0x4c68ffb0e09db5f0), UINT64_C(0x7c9d250f248a97db), UINT64_C(0xa5d93c260ae40458)}},
+  {{ UINT64_C(0x801ac53214f4f685), UINT64_C(0x5d5be85d643c05ed), UINT64_C(0x94f2ccc435318b3f)}},
+  {{ UINT64_C(0x534cc86233226577), UINT64_C(0x9d0fa3842713e7a4), UINT64_C(0xe3b984901f1189d9)}},
+  {{ UINT64_C(0xafdd40ba5f9b4a68), UINT64_C(0x5cf864458040e7e4), UINT64_C(0x1f80f098ca91122d)}},
+  {{ UINT64_C(0x04a86648780121a0), UINT64_C(0xfc84e65bb7f53f45), UINT64_C(0x0caf768ca923701e)}},
+  {{ UINT64_C(0xa32de733aa4e52f4), UINT64_C(0xc207c0611fe76060), UINT64_C(0x06b425b3d6a52b0d)}},
+  {{ UINT64_C(0xedff0f6a0ce9d5f2), UINT64_C(0x217fb84d44839763), UINT64_C(0x337e842b5561d547)}},
+  {{ UINT64_C(0x3e3d9ff1b4bf98e9), UINT64_C(0x472aef8c47aa1ab9), UINT64_C(0x916b7c8c565cb402)}},
+  {{ UINT64_C(0x77a92cfd7cd0503a), UINT64_C(0xd2fcc01b5bc17cc3), UINT64_C(0x7948dcec729500bd)}},
+  {{ UINT64_C(0x76a1f494cde903b6), UINT64_C(0x878f8340bdeb9354), UINT64_C(0x755297ce307036e0)}},
+  {{ UINT64_C(0x91bc8c52dda7e8d0), UINT64_C(0xbd1848d4e485f7ea), UINT64_C(0xce604ba3d93dbad3)}},
+  {{ UINT64_C(0x7fe248947fd7139e), UINT64_C(0xc4ee3ab6fcfb5167), UINT64_C(0x51c7380dd9e46754)}},
+  {{ UINT64_C(0x7b261efb81f637d2), UINT64_C(0xfb1afcdd827e8674), UINT64_C(0xdd7b2fc6a64f7706)}},
+  {{ UINT64_C(0xe5963cc7da180c44), UINT64_C(0x7c4ae8b8a2892402), UINT64_C(0xe77df3336f542d2a)}},
+  {{ UINT64_C(0xc183efcbbce9c66a), UINT64_C(0x8f4a208327715197), UINT64_C(0x5cbba7e6c06deb80)}},
+  {{ UINT64_C(0x94a3496295616daa), UINT64_C(0x53f60d6b0e9d8b6d), UINT64_C(0x6057ccef90505702)}},
+  {{ UINT64_C(0x6980e77aa8fa0a70), UINT64_C(0x3bf9448dc29a5c51), UINT64_C(0x3e9064e5af13fc26)}},
+  {{ UINT64_C(0x167e73686d5cdd6d), UINT64_C(0xf214ecb16df015c4), UINT64_C(0x24cfcbf2d3b8aea8)}},
+  {{ UINT64_C(0xe84ec511efc184b7), UINT64_C(0x7399a20b86ef5e18), UINT64_C(0x64d8dad9b61fe41e)}},
+  {{ UINT64_C(0x925f2a020cf87533), UINT64_C(0xdec5104013478fa9), UINT64_C(0x725bd7c6a87eacce)}},
+  {{ UINT64_C(0x63778ece96ede3ec), UINT64_C(0x0bf3b5d541eef739), UINT64_C(0x82d4219621f10179)}},
+  {{ UINT64_C(0x3f7454d1d55fb176), UINT64_C(0xd8e848b1a5bcbd24), UINT64_C(0xdc6ac3da143d54b4)}},
+  {{ UINT64_C(0xb636f7aa53e471b5), UINT64_C(0x961ea8154fda1485), UINT64_C(0xda0288deb33f2f87)}},
+  {{ UINT64_C(0x5a5dd3ab941aa207), UINT64_C(0x6bbb27b5ea7ce9bb), UINT64_C(0xe6b75c08f8c1ac76)}},
+  {{ UINT64_C(0xbdec5cf5a4ed704a), UINT64_C(0xf22138d19dfbbee6), UINT64_C(0xe62429296ebbcc1d)}},
+};
+
+static const mzd_row192_t K_1[] = {
+  {{ UINT64_C(0x9ae5e69ec165545a), UINT64_C(0x3ca38530bc80d381), UINT64_C(0xa4d4fc7eab33fe64)}},
+  {{ UINT64_C(0x88c9cf6f76c21218), UINT64_C(0x1a6c5d1d198bbabb), UINT64_C(0x5a7ef99c31ad935a)}},
+  {{ UINT64_C(0xc9d8619d8afc9b03), UINT64_C(0x62e3ff8a30fd63b6), UINT64_C(0x737ad5460073eae2)}},
+  {{ UINT64_C(0x12dbc0de7665f72e), UINT64_C(0xf5b84c4ed665cd5f), UINT64_C(0x4a100a9bd3b7149d)}},
+  {{ UINT64_C(0x55c467cda0bc9a76), UINT64_C(0xb8dd9de6787dca92), UINT64_C(0xdff4a2228638eba2)}},
+  {{ UINT64_C(0x1297a6be0a59aa6b), UINT64_C(0xfcf36ca4474c54cf), UINT64_C(0xf607b60ccaa3874a)}},
+  {{ UINT64_C(0x4e26ec01edb61c5e), UINT64_C(0xcc02e1e572863c23), UINT64_C(0x1dd9f7782a1af251)}},
+  {{ UINT64_C(0xca18c46766b02aa4), UINT64_C(0xf310106b07978c72), UINT64_C(0x916e806c21a8a910)}},
+  {{ UINT64_C(0xf97d673ad0b64330), UINT64_C(0xbf156b267a99da80), UINT64_C(0x6a82b650059849cc)}},
+  {{ UINT64_C(0x72015ee107be9fd4), UINT64_C(0x818ae137f553de73), UINT64_C(0xe692bedd876d7922)}},
+  {{ UINT64_C(0x3c3ffddfc5700456), UINT64_C(0x858ea548a1acd1a5), UINT64_C(0x60d719045b54affc)}},
+  {{ UINT64_C(0x90ada813a5bc5daf), UINT64_C(0xbaf821105d8dd72a), UINT64_C(0x4f90fa9cfdef8c71)}},
+  {{ UINT64_C(0x35673c7410e78c70), UINT64_C(0xa6aedb17714026f6), UINT64_C(0xde64072de5bbfa4d)}},
+  {{ UINT64_C(0xa0d6002e23cebc2c), UINT64_C(0x7deb3fa147635516), UINT64_C(0xc8909cbe11413e6b)}},
+  {{ UINT64_C(0x8167b5cbaeadd008), UINT64_C(0x0358c8db1d121d57), UINT64_C(0xb82cdb2acb778bd6)}},
+  {{ UINT64_C(0x146c37a6d7469701), UINT64_C(0xd79b327ebb987299), UINT64_C(0x26ef890500d23f8f)}},
+  {{ UINT64_C(0x8978d18a99fcb0d3), UINT64_C(0xd5fbb8869a982166), UINT64_C(0xdf8ad48692932ecb)}},
+  {{ UINT64_C(0x5c36e363a838dc46), UINT64_C(0x32987790742d2068), UINT64_C(0x26b4ac9c042a3ba4)}},
+  {{ UINT64_C(0x1c475c13a53c2647), UINT64_C(0xa99ccb84ca982dc6), UINT64_C(0xc854f61e3289b623)}},
+  {{ UINT64_C(0x0d5322fb3edfb471), UINT64_C(0x8389a597122e0281), UINT64_C(0xf30aa95709838b18)}},
+  {{ UINT64_C(0xd65f6d1cc05b269c), UINT64_C(0x3da587bda92d8722), UINT64_C(0x95b6b4f4ee302626)}},
+  {{ UINT64_C(0xbc03340154fb9aea), UINT64_C(0xb18b1a39231372bf), UINT64_C(0x8b99d4269e819678)}},
+  {{ UINT64_C(0xa17b7132a9a51e3e), UINT64_C(0x1ba4e51f980d45fe), UINT64_C(0x9a5b9d02eabd06d1)}},
+  {{ UINT64_C(0x759902cfa5635bae), UINT64_C(0x9abaf3469c8ef3eb), UINT64_C(0x0f816d744e6c89ed)}},
+  {{ UINT64_C(0xf32ff36a20a51993), UINT64_C(0x7937273269c6cb8e), UINT64_C(0x7824bc0d936b936d)}},
+  {{ UINT64_C(0x1f96bf26b644d5ca), UINT64_C(0x8fad7f961cac1d4f), UINT64_C(0x80d21850cc392561)}},
+  {{ UINT64_C(0x146a4e5f085dd169), UINT64_C(0xd2f647adc1eb41b9), UINT64_C(0xf60271dd936c9dd7)}},
+  {{ UINT64_C(0x71ed43ca6c8ea68d), UINT64_C(0xa9bcfecb0f0cdf0a), UINT64_C(0xc673c17541afb354)}},
+  {{ UINT64_C(0x5695e89e40b4fb8b), UINT64_C(0x4aaeb80b5d058fd1), UINT64_C(0x28ce8f63ed8aaedd)}},
+  {{ UINT64_C(0x60421cffc0e9d75e), UINT64_C(0x160a83ebda3bdc86), UINT64_C(0x230dd844b33dfbd8)}},
+  {{ UINT64_C(0xca672f1f9b4c59e8), UINT64_C(0x57900385647548f9), UINT64_C(0xac1717fb06de7dcc)}},
+  {{ UINT64_C(0x3142f1f19433da81), UINT64_C(0x470d346f8d004db1), UINT64_C(0xac7c814caf25c5df)}},
+  {{ UINT64_C(0x2ee23b46bfa1b102), UINT64_C(0x7ec89ed241501b4b), UINT64_C(0x5c1576cfcb570cb9)}},
+  {{ UINT64_C(0x840f0fa71d7d58e6), UINT64_C(0x620d12303716db3e), UINT64_C(0x0fa235f84839fa13)}},
+  {{ UINT64_C(0xd71f9893762a3686), UINT64_C(0xf20f626d986cfe4a), UINT64_C(0xd66eeb7ba876286c)}},
+  {{ UINT64_C(0x0a5478610efc05ee), UINT64_C(0xf968e7191ea76ae6), UINT64_C(0x65dfce346d3806f5)}},
+  {{ UINT64_C(0x60cfa2927a965831), UINT64_C(0x665a73686f3c2941), UINT64_C(0x34351f8d9276c1b8)}},
+  {{ UINT64_C(0x50702caa42f71d76), UINT64_C(0xd453375f68676550), UINT64_C(0x6be3a37033d6496d)}},
+  {{ UINT64_C(0x6699b224a4d4cd3c), UINT64_C(0x4358f7b13d2cc25a), UINT64_C(0x62cbf3fc934cd6df)}},
+  {{ UINT64_C(0xade7303704715c3d), UINT64_C(0xa98dc776b89c35ac), UINT64_C(0xef24cb7619300112)}},
+  {{ UINT64_C(0x1e4b9315d4d7dea9), UINT64_C(0xb04c30c64c3cf406), UINT64_C(0xe1797de713cf0f4a)}},
+  {{ UINT64_C(0x21dd0504325d070d), UINT64_C(0xc7d61a4d7c62aa56), UINT64_C(0x491c5fd6f8185c61)}},
+  {{ UINT64_C(0xfa15063367b50cfc), UINT64_C(0x67ea9087a1992560), UINT64_C(0x1b694c752e0221b4)}},
+  {{ UINT64_C(0x9045e90900eeec64), UINT64_C(0xfe9777cd81ac1129), UINT64_C(0x63b8f428cdc45537)}},
+  {{ UINT64_C(0xc9d89d1f0c6470da), UINT64_C(0xa7e20f43062d2a01), UINT64_C(0x775dd20b795ca194)}},
+  {{ UINT64_C(0x9bf6e41e66b561db), UINT64_C(0x37ba2c0eedecf3f8), UINT64_C(0x9cff9ddda45b708e)}},
+  {{ UINT64_C(0x5c7422104ee8e56a), UINT64_C(0xd3f4567659d12d3b), UINT64_C(0x607d6c5404f01f23)}},
+  {{ UINT64_C(0xe911a07d029168f0), UINT64_C(0xa6c7b7c94603e10a), UINT64_C(0x687a886591579a51)}},
+  {{ UINT64_C(0xbd8a6fbdd0582112), UINT64_C(0x0dcb039b5501e0f5), UINT64_C(0xe438e6cd74acf0dc)}},
+  {{ UINT64_C(0x7f132d3460b74a71), UINT64_C(0x807a11fa87d9d991), UINT64_C(0xada8fb91386be4f8)}},
+  {{ UINT64_C(0x6d66bb24d3606a73), UINT64_C(0x6d681a2c6b2ae131), UINT64_C(0x02738a823dbd5145)}},
+  {{ UINT64_C(0x6bbc9b3bf0c9720b), UINT64_C(0x09a5ff995b1a7439), UINT64_C(0xc03bdd5a2d98385d)}},
+  {{ UINT64_C(0xfd23af5210fc424e), UINT64_C(0xa87beb32bba66dd7), UINT64_C(0x0411641dbbefee78)}},
+  {{ UINT64_C(0x7b9c36831d0a4c59), UINT64_C(0xbafd76435d3d2c6b), UINT64_C(0xb728ad105175c0e1)}},
+  {{ UINT64_C(0x74b60d3f7666964f), UINT64_C(0x3cd9ebc5ca84473d), UINT64_C(0xd89e5477233d855c)}},
+  {{ UINT64_C(0xee83ac111d0f1842), UINT64_C(0xc5aadf6d8deb4803), UINT64_C(0xb305bb717d0ecbbc)}},
+  {{ UINT64_C(0x2c129868d931894a), UINT64_C(0xfb36afc270de4e46), UINT64_C(0x8a97444b8014a776)}},
+  {{ UINT64_C(0x4f52572e7977aae9), UINT64_C(0xbeff837e702315ca), UINT64_C(0x2197af31c2457400)}},
+  {{ UINT64_C(0x32a5c25d009569b9), UINT64_C(0x8d1c8314e96bd235), UINT64_C(0x4cd00dad862ac8a6)}},
+  {{ UINT64_C(0xbd9774d974b7f7c7), UINT64_C(0x9cf2013e6dc7198c), UINT64_C(0x30c9a6a41684eb6c)}},
+  {{ UINT64_C(0xdd1f9c1bf9953f0f), UINT64_C(0xcfb62466ac313aae), UINT64_C(0xcf47876e477e11ba)}},
+  {{ UINT64_C(0x0e27bf6adddb019e), UINT64_C(0x57a57361191a9e6f), UINT64_C(0x76975db71ad73aaf)}},
+  {{ UINT64_C(0x08ee50a386190de1), UINT64_C(0x7716944f5313fa56), UINT64_C(0x506592c4ce73acaf)}},
+  {{ UINT64_C(0xf403b653d72ff494), UINT64_C(0x471444a8199e9365), UINT64_C(0xedac4f263e9973ca)}},
+  {{ UINT64_C(0x5ea9b20aab81448b), UINT64_C(0x041c57e2ea1814b5), UINT64_C(0xfdb66dfd35ca07b2)}},
+  {{ UINT64_C(0xe9a83fbb149ee383), UINT64_C(0x21a833331899a4f3), UINT64_C(0xe50283e19f97b907)}},
+  {{ UINT64_C(0xcf041d91c9db4967), UINT64_C(0x8d5fcd76c0a334e2), UINT64_C(0xbd45800b67390338)}},
+  {{ UINT64_C(0x00b90c135ba7acd8), UINT64_C(0x1be9adba21e5ca96), UINT64_C(0x751b5c5107ca14d0)}},
+  {{ UINT64_C(0x1ddf9a1eb1b60dbe), UINT64_C(0x784f9c4e457bbd53), UINT64_C(0xbe8c321a7c6c4c23)}},
+  {{ UINT64_C(0x9d57f00af78fe826), UINT64_C(0xdfe0e10a76784f3e), UINT64_C(0x0fd190ac5087d77e)}},
+  {{ UINT64_C(0x1897229ff7e237e9), UINT64_C(0x79eb7ceceb2e5928), UINT64_C(0x4bfd228c59cf163f)}},
+  {{ UINT64_C(0x295fd3fb89335c81), UINT64_C(0xac69ba7296a13fbe), UINT64_C(0x4ed6a9bd01b73ef0)}},
+  {{ UINT64_C(0x4d6b107feff64aa0), UINT64_C(0x8925b0e416752fb5), UINT64_C(0x65928f0ae5769a62)}},
+  {{ UINT64_C(0xa243bc13b0b35d78), UINT64_C(0xe7d88e7ba60e90ba), UINT64_C(0x7640a2ca4210b0c4)}},
+  {{ UINT64_C(0x6101bf433ce85c78), UINT64_C(0x606ebdde13b20d6b), UINT64_C(0x523fca2e2234f05f)}},
+  {{ UINT64_C(0x71531ea213e0f2fe), UINT64_C(0x537d1b11974deb53), UINT64_C(0xc4287eb6d27594ab)}},
+  {{ UINT64_C(0x8d8ffb07a2b0ac3c), UINT64_C(0xca62c57ddd93a99d), UINT64_C(0xcb3953179c43abcc)}},
+  {{ UINT64_C(0x95a67358e30a53cf), UINT64_C(0x5fd63655e87b41c8), UINT64_C(0x7e93ad28d2cb4e63)}},
+  {{ UINT64_C(0x43d2c2b4589c1b5e), UINT64_C(0xb3a490d4a59b8e6b), UINT64_C(0x7492b5d21ebb962c)}},
+  {{ UINT64_C(0xa7e7507270f129a9), UINT64_C(0xbaa9b94bbcf0ee1c), UINT64_C(0x00db31c825864057)}},
+  {{ UINT64_C(0x521b1315300367d7), UINT64_C(0xdcd3366f6adfe56f), UINT64_C(0x626147e563422821)}},
+  {{ UINT64_C(0xdd33bfb8768c38f0), UINT64_C(0x1f455cff2522b8cd), UINT64_C(0xfc16a3865846d968)}},
+  {{ UINT64_C(0x3132e5adb0964f80), UINT64_C(0x12ae8a8883538215), UINT64_C(0xf22775fa145d9808)}},
+  {{ UINT64_C(0x06247042d914337b), UINT64_C(0x351b5f3de5afe550), UINT64_C(0x049c5f0be9bafe55)}},
+  {{ UINT64_C(0x1686cfbf3f6869d1), UINT64_C(0xac04f7ad80df5118), UINT64_C(0xeace7941ab1bce64)}},
+  {{ UINT64_C(0xbb0ad4b2509d000a), UINT64_C(0xade3c294174d6cfd), UINT64_C(0x0ccfcc993eb25089)}},
+  {{ UINT64_C(0xfb4ab9b8c76bfdf7), UINT64_C(0x06e41b8faea0fe60), UINT64_C(0xb92e4ecee7677f19)}},
+  {{ UINT64_C(0x5b922df927644f33), UINT64_C(0x848a30602f1f9376), UINT64_C(0x61ca32d917cc6e76)}},
+  {{ UINT64_C(0xd07adc687bd7a618), UINT64_C(0xc176dd9a337d19a7), UINT64_C(0x2dcd9deccb1f839b)}},
+  {{ UINT64_C(0x134b135e3661374d), UINT64_C(0x29d30812bcf0e712), UINT64_C(0xd63fc1a08971a3dc)}},
+  {{ UINT64_C(0x91e8c4fa079c50a0), UINT64_C(0xa7a776a4620ac746), UINT64_C(0x5dc335e3a9808dac)}},
+  {{ UINT64_C(0xb208e06587db6fdb), UINT64_C(0x36498041fafa426d), UINT64_C(0xd3822ee820e2c674)}},
+  {{ UINT64_C(0xb87f7830c645e3f0), UINT64_C(0xe81bc2e7ca2859c7), UINT64_C(0x14402b062501c8a8)}},
+  {{ UINT64_C(0xad4653ff88447df1), UINT64_C(0x8f8e0a38b93f8ca1), UINT64_C(0xe58b433e35e3be84)}},
+  {{ UINT64_C(0xe2592c4eb827f642), UINT64_C(0x1c5d5717bc388d70), UINT64_C(0x665f6e9c9c314622)}},
+  {{ UINT64_C(0xc16a60a8e5080935), UINT64_C(0x937ca34e031a4071), UINT64_C(0xb9fa722a61b06fc0)}},
+  {{ UINT64_C(0x85f66224d5f5d595), UINT64_C(0x934a4f0dbb81e123), UINT64_C(0x3b7785b1ae3a07eb)}},
+  {{ UINT64_C(0xf89011d93ca0155c), UINT64_C(0x0f9dfb5c0dfba9c9), UINT64_C(0x04715d3c7476ac17)}},
+  {{ UINT64_C(0xb693c110e768e0f5), UINT64_C(0x2d2f097b64e728fa), UINT64_C(0xcb7b187f03c5eb8a)}},
+  {{ UINT64_C(0x0e20055a5f5abef9), UINT64_C(0x07c096937263c350), UINT64_C(0x8c5631e8c2e10517)}},
+  {{ UINT64_C(0x9d7e4dd63cf319b1), UINT64_C(0x35588d68bb82ed9e), UINT64_C(0xeae63e810dae9925)}},
+  {{ UINT64_C(0x0a661561eefa32b9), UINT64_C(0xc0ab810339f1bbd6), UINT64_C(0x781f823082a89345)}},
+  {{ UINT64_C(0x09d41a252d53e531), UINT64_C(0x93f05724b87a799c), UINT64_C(0x3f6ed8fefb5c4e3f)}},
+  {{ UINT64_C(0x84c5732dd451adb3), UINT64_C(0x3acfbc024243098b), UINT64_C(0xb7d512e044e53ad4)}},
+  {{ UINT64_C(0xda46d412bf2fd40b), UINT64_C(0x9a306f97d252f087), UINT64_C(0x016533832bb73c12)}},
+  {{ UINT64_C(0xa56049acf11f94a9), UINT64_C(0x031eabf9767f9ca2), UINT64_C(0x8332de01cc4197d0)}},
+  {{ UINT64_C(0x6afc362da9a2a338), UINT64_C(0x9dfb8a903e20fd18), UINT64_C(0x3c847ce0c8da27e6)}},
+  {{ UINT64_C(0x57c3325791cea18c), UINT64_C(0x17fb996cbbb8a141), UINT64_C(0xb4fb3b493941e351)}},
+  {{ UINT64_C(0xdf81ce1f4b13d9f4), UINT64_C(0x532ccec3015c8db9), UINT64_C(0x20703a97d72e6b6e)}},
+  {{ UINT64_C(0xb00c90298a15267b), UINT64_C(0x33b72b1858753c64), UINT64_C(0xec0bbd132372eb2e)}},
+  {{ UINT64_C(0x5944a2720531cb18), UINT64_C(0xe15b6fbdc5c4f54b), UINT64_C(0x973126bf874a0124)}},
+  {{ UINT64_C(0x73fc05161897b41f), UINT64_C(0xe44ec9d776a74f3b), UINT64_C(0x9abd0d8ab2b16195)}},
+  {{ UINT64_C(0x0c49914dc76b2a5e), UINT64_C(0x30682359f2dad1d1), UINT64_C(0x34d8831aa6359260)}},
+  {{ UINT64_C(0x996d01ee564fc07e), UINT64_C(0xb78da4d726765d11), UINT64_C(0xbace3534a4a3b6f0)}},
+  {{ UINT64_C(0xfee370c87ec948e4), UINT64_C(0x5cacc03c13f7b34f), UINT64_C(0x302036725dd6d13a)}},
+  {{ UINT64_C(0x483c641d64cc1cf7), UINT64_C(0xc98c255c96448b48), UINT64_C(0x82696c22f8470127)}},
+  {{ UINT64_C(0xb3601ffafcabe11f), UINT64_C(0xa7e01376b8625890), UINT64_C(0x9be10651c4ac7b54)}},
+  {{ UINT64_C(0x93d17ea2f9495ebc), UINT64_C(0x2d1e6ad6739db9b5), UINT64_C(0x70ba4f83bf2436c3)}},
+  {{ UINT64_C(0x52ed5885a8664005), UINT64_C(0x19827a35e2ece19e), UINT64_C(0x168121901e234dba)}},
+  {{ UINT64_C(0xa277c3bbde631708), UINT64_C(0x7b7f455be042ffb9), UINT64_C(0x29a8df2f84e6b1e8)}},
+  {{ UINT64_C(0x08bb0b11fbf2b2fc), UINT64_C(0x786a51c41d641da5), UINT64_C(0x5efa8ff74676da7e)}},
+  {{ UINT64_C(0x3efd5221b3879ba7), UINT64_C(0x7445e6f3d90a4b0f), UINT64_C(0x13359adbf9c3b1ed)}},
+  {{ UINT64_C(0x7c6828c265dad065), UINT64_C(0x17b91dbd1f5a2745), UINT64_C(0x7b157e41e7e288e4)}},
+  {{ UINT64_C(0x7e0972c748998ca1), UINT64_C(0xcb295a540cd4af43), UINT64_C(0x7450c32e9734ace4)}},
+  {{ UINT64_C(0xf387ad466978cf01), UINT64_C(0x941f91f8306e1d4d), UINT64_C(0x5bdf9f2396ad11d6)}},
+  {{ UINT64_C(0x2e9487453b860056), UINT64_C(0x1245b4149d71b6bd), UINT64_C(0x2852b1d1620baa01)}},
+  {{ UINT64_C(0x248462aa465cf6e1), UINT64_C(0xb0f9f6417784a88d), UINT64_C(0x9fe89a84585fb727)}},
+  {{ UINT64_C(0x0b16d0fa80f7ada7), UINT64_C(0x9721b2816e04a686), UINT64_C(0x0e231f8457aefee3)}},
+  {{ UINT64_C(0x3284b29ae4feca79), UINT64_C(0x5696781c663ac390), UINT64_C(0x8827a0426f20e609)}},
+  {{ UINT64_C(0xdbdc06d3207b58e7), UINT64_C(0x8f678f90142cd3c7), UINT64_C(0xf0023dca2ed2daf0)}},
+  {{ UINT64_C(0xe6a8bf952c97bc3e), UINT64_C(0x9cd2164426c1b66b), UINT64_C(0x781fd055829cb7b6)}},
+  {{ UINT64_C(0xe0c1672cd0d27db8), UINT64_C(0xfa8fd5654afb4aa4), UINT64_C(0x635fa40539707610)}},
+  {{ UINT64_C(0x28d66d08a7515d52), UINT64_C(0xf1bc61512a1631a8), UINT64_C(0x57e9dbb2bdbc5bc2)}},
+  {{ UINT64_C(0x1ba421b8373ddb28), UINT64_C(0x100a9da3685b31b1), UINT64_C(0xd55945dc6700603f)}},
+  {{ UINT64_C(0x5e133e53f62aec3e), UINT64_C(0x2c86781764120fc3), UINT64_C(0xe023368b660b6518)}},
+  {{ UINT64_C(0x02edb62eb26119a2), UINT64_C(0x9d374bc2d9f0fd3a), UINT64_C(0xe829e93962ecf4f5)}},
+  {{ UINT64_C(0xcbcb6645f07486ef), UINT64_C(0x586fc33baffc0c8b), UINT64_C(0x873aa8ecba3e9921)}},
+  {{ UINT64_C(0x3bf06fb788ea206c), UINT64_C(0x77498c08d69d8e92), UINT64_C(0x8852230688046009)}},
+  {{ UINT64_C(0x3ea2da1e9c28f615), UINT64_C(0x4e3370ae31bbfb0a), UINT64_C(0xb21d8771f3dcee2f)}},
+  {{ UINT64_C(0x4a266b9c4e1c0892), UINT64_C(0x179bd4bae6ba107f), UINT64_C(0x20d783852b6e39ad)}},
+  {{ UINT64_C(0x2cdd73dc949d328d), UINT64_C(0x27ef47a9da049e31), UINT64_C(0x31e7861b2808738f)}},
+  {{ UINT64_C(0x02e070b60e7f9e4e), UINT64_C(0x837a804aa523415a), UINT64_C(0xa72e154ba51dd790)}},
+  {{ UINT64_C(0x0e9cb1a659e9a6c5), UINT64_C(0xf4bb694c8e96104d), UINT64_C(0xc8e855a9128d9bda)}},
+  {{ UINT64_C(0xbbc8d9e6aff63066), UINT64_C(0x125fe49c6e770391), UINT64_C(0xa9bacfea0b45f63c)}},
+  {{ UINT64_C(0xec0f2313c3e7c24c), UINT64_C(0x203cbe5964c2ecd5), UINT64_C(0xdd0d1da943c78a6a)}},
+  {{ UINT64_C(0xb2980ccc80b4cec6), UINT64_C(0xae03f12983eb5d81), UINT64_C(0x9e7f17821944daf8)}},
+  {{ UINT64_C(0x734c9f50c7a53b21), UINT64_C(0x2f9edc248faf30eb), UINT64_C(0x37d1e64150bb6197)}},
+  {{ UINT64_C(0x1c6404ffc24c2f03), UINT64_C(0xeeee3dce7c24aac9), UINT64_C(0xf063ddbd454557f5)}},
+  {{ UINT64_C(0x90aefdbf20b79802), UINT64_C(0x188ad0044efb5841), UINT64_C(0x805257a29ce868ea)}},
+  {{ UINT64_C(0xf76d3a6867ac081e), UINT64_C(0x1c4305d6b8760db2), UINT64_C(0xcaa6f1a2aaeb2519)}},
+  {{ UINT64_C(0x5c95812d6305deda), UINT64_C(0x1ce4a9f0b2d66401), UINT64_C(0xdbd33f10d6515a69)}},
+  {{ UINT64_C(0xe65a8fd9efe04625), UINT64_C(0x9ab6b8d6122e415d), UINT64_C(0xd29622099bbae137)}},
+  {{ UINT64_C(0xeccd53bab86b03b7), UINT64_C(0xcc7b8279dad939be), UINT64_C(0xce1ae35eca1b0813)}},
+  {{ UINT64_C(0x6bb15964208d2a61), UINT64_C(0x3be9c441d6b8f95b), UINT64_C(0x01c99386d824bf88)}},
+  {{ UINT64_C(0x7fc66a92a2d9d4eb), UINT64_C(0xc93b50b3ddc4449f), UINT64_C(0x7413b7d956c5c492)}},
+  {{ UINT64_C(0x86d289e22f92cf42), UINT64_C(0xf2509ead05bf4e29), UINT64_C(0x92b31dee6b8e3020)}},
+  {{ UINT64_C(0x4b7f7295b1698f94), UINT64_C(0xf14cfe39af85c4a2), UINT64_C(0xcbe15ba3564a459e)}},
+  {{ UINT64_C(0xf7697d8ab586fcc9), UINT64_C(0xfeadbae9442cde1c), UINT64_C(0x86f40dad157bc5a0)}},
+  {{ UINT64_C(0x71926f3135f29d1c), UINT64_C(0xf87d5cfa6919e284), UINT64_C(0x191fb7c511b230b9)}},
+  {{ UINT64_C(0x2ebe8037f70b8167), UINT64_C(0x248982c2cebf73ad), UINT64_C(0x3360bd523dc54f26)}},
+  {{ UINT64_C(0x9416c2cccc56cdec), UINT64_C(0x7e7af3db1a1d7cbd), UINT64_C(0xb5fa0396aca98b7c)}},
+  {{ UINT64_C(0xf5f0a28c423f9029), UINT64_C(0xb846de96c2304c37), UINT64_C(0x5849c1105a6b591c)}},
+  {{ UINT64_C(0xe3a853fdaef178db), UINT64_C(0xfd340e685452d974), UINT64_C(0x0cbf8a7f14dada9f)}},
+  {{ UINT64_C(0x8e592695af6f2750), UINT64_C(0xe981a3525ef96e4f), UINT64_C(0x6fc5e6ced35c8033)}},
+  {{ UINT64_C(0x2e54176c3a11f938), UINT64_C(0x5f1833e82d3acb62), UINT64_C(0x9de09440128f2b0c)}},
+  {{ UINT64_C(0x52cfeccea098bf0a), UINT64_C(0x6f1dd3f417a1e25b), UINT64_C(0x341df93c89c514d5)}},
+  {{ UINT64_C(0x4df287cdc2ffa77d), UINT64_C(0xbaeefdd01e97c239), UINT64_C(0xe35fa9f1b3b2b946)}},
+  {{ UINT64_C(0xbdc44d79e9a64e8c), UINT64_C(0x9773e2b5814d73c0), UINT64_C(0x54d03cf9625d8fc1)}},
+  {{ UINT64_C(0xaba671fb6e5e5f7c), UINT64_C(0x617fb15c47eeef17), UINT64_C(0x15974416bb107103)}},
+  {{ UINT64_C(0x4cf89f8d2164fb37), UINT64_C(0xab16f8a446635cd8), UINT64_C(0x509e14a4dfcb96e2)}},
+  {{ UINT64_C(0x1b88125b5013a740), UINT64_C(0xdddf107915cc05a5), UINT64_C(0xe7763ec17616ab01)}},
+  {{ UINT64_C(0xda8a62fdcce4ad25), UINT64_C(0x019fd5abf4e0b6d6), UINT64_C(0xd25571ca58a0eb01)}},
+  {{ UINT64_C(0x704125abdd9fdafd), UINT64_C(0xea5822a3e625c5a5), UINT64_C(0x41539607115a50a7)}},
+  {{ UINT64_C(0xf48a73ab9d456ea6), UINT64_C(0x6d2f70fc629a4660), UINT64_C(0x71e1f6a4f4df0d4e)}},
+  {{ UINT64_C(0x0c9fe5315ac513ff), UINT64_C(0x00a06242ebc7dbf6), UINT64_C(0x3a4899ab68a6b3e8)}},
+  {{ UINT64_C(0x93acb15965a017af), UINT64_C(0x9fcb68bfb1b88f38), UINT64_C(0xc84810800341b712)}},
+  {{ UINT64_C(0xf93b3daad29fde9b), UINT64_C(0x15b376604e0320e1), UINT64_C(0x7c240f2fa00045b0)}},
+  {{ UINT64_C(0x6da37fcb59ce41aa), UINT64_C(0xed110355b906732f), UINT64_C(0x1ab2d63190e3a2e6)}},
+  {{ UINT64_C(0x8d9e88efe9ad66a6), UINT64_C(0x6570846ed5d0f10c), UINT64_C(0x3b41d13a6a7c3d6b)}},
+  {{ UINT64_C(0x4f62c7aa44645f8b), UINT64_C(0xb0b44eee15db33f5), UINT64_C(0x9ed815b3662b0228)}},
+  {{ UINT64_C(0x5da80a0b82780ee7), UINT64_C(0x5e228e5910f295dc), UINT64_C(0x7db2959793635339)}},
+  {{ UINT64_C(0xe113bcfe56351c97), UINT64_C(0x8a7d6ce89ea354dd), UINT64_C(0xa6491c02739e8b55)}},
+  {{ UINT64_C(0x9b1a44505e35592b), UINT64_C(0xd9ce20780b8b2b43), UINT64_C(0x5966394ffa055ee7)}},
+  {{ UINT64_C(0x3ac432b047776911), UINT64_C(0x22dde202bd2b025d), UINT64_C(0x411c85ed0fc02303)}},
+  {{ UINT64_C(0xdb2943f481ad880d), UINT64_C(0xc65d9ee8f703cbc3), UINT64_C(0xb740f544e7330bca)}},
+  {{ UINT64_C(0xa479dddf27f2129e), UINT64_C(0x8d1abba1db228a73), UINT64_C(0xeaf759eb1aa3ca2d)}},
+  {{ UINT64_C(0xd38fdea3e084bde2), UINT64_C(0x8336e924b9f4be0c), UINT64_C(0xedaa7349022ea85e)}},
+  {{ UINT64_C(0x6b51c1d8dcae4078), UINT64_C(0x009344523725cf01), UINT64_C(0x2b6b4e97f7c53942)}},
+  {{ UINT64_C(0xc7098a08279bd2be), UINT64_C(0xa8405619d2b29931), UINT64_C(0x0bd8a669c92d8e6c)}},
+  {{ UINT64_C(0xddac0f2d524fd6e6), UINT64_C(0xef4bcada3ef67ab9), UINT64_C(0xf2341442a7641653)}},
+  {{ UINT64_C(0x5675c6997ddc3655), UINT64_C(0x42a893624f94b6d2), UINT64_C(0x03a37af4cb7ae096)}},
+  {{ UINT64_C(0x79f290be0e32c595), UINT64_C(0xd5ac6758323ea1dc), UINT64_C(0xefc8835d6c6e19ba)}},
+};
+
+static const mzd_row192_t K_2[] = {
+  {{ UINT64_C(0x8739d65b6b977e02), UINT64_C(0xde394bac13c9eaa9), UINT64_C(0x53fee3d81b3a0934)}},
+  {{ UINT64_C(0x584848fee002bc02), UINT64_C(0x8428de93c94367a4), UINT64_C(0x26a69b85918178dd)}},
+  {{ UINT64_C(0xa43131dfce44dad4), UINT64_C(0x938b3f6c41558468), UINT64_C(0x0a3a757e3180d18b)}},
+  {{ UINT64_C(0x9eed9189ab8a0943), UINT64_C(0xc8d0d7a96316d7cd), UINT64_C(0xe2fcb450d9278207)}},
+  {{ UINT64_C(0x5c720f3e0c024876), UINT64_C(0x8a018544b4706fbe), UINT64_C(0xc835a56a14875fdf)}},
+  {{ UINT64_C(0xe25215963ec1219c), UINT64_C(0xcb9d4aa72b400f4c), UINT64_C(0x35e24c1f00f8f7ec)}},
+  {{ UINT64_C(0x9071433ac0551e3f), UINT64_C(0x6ba1f6c3b626ca33), UINT64_C(0xf120fb7de11289df)}},
+  {{ UINT64_C(0xc992f31cb9f45b5a), UINT64_C(0xfbdb4c23cc7c0a14), UINT64_C(0x3f8dd1e26d8a5774)}},
+  {{ UINT64_C(0x5ec3400bcab26eaa), UINT64_C(0x9e5d9da7d344b62b), UINT64_C(0x6fba1f21d7fd73de)}},
+  {{ UINT64_C(0xf089c18aaa841693), UINT64_C(0x3c0e7d8886ccd7ab), UINT64_C(0x39b2ec874081ffb3)}},
+  {{ UINT64_C(0x960ac8d24642b9b4), UINT64_C(0x8c9d7ac6c9209540), UINT64_C(0xdac5def9c5f8cac6)}},
+  {{ UINT64_C(0xbb343d1228aaea4c), UINT64_C(0x2631164e147343a9), UINT64_C(0x655d34e8f3cd6c93)}},
+  {{ UINT64_C(0x8eb52a89bf18cc63), UINT64_C(0xc7ca830b3180a5fb), UINT64_C(0xb728114acbf95028)}},
+  {{ UINT64_C(0x5066692780ac649d), UINT64_C(0x7e2f7e53c01d8dd0), UINT64_C(0xb9fd66599973d82d)}},
+  {{ UINT64_C(0x8db0deeaf08e151a), UINT64_C(0x16d126f6d8badc77), UINT64_C(0xe076be04e50e4f13)}},
+  {{ UINT64_C(0x0731aa60ffe7fb0b), UINT64_C(0x67904e7d69c4dc78), UINT64_C(0xcfb5afbe503718a7)}},
+  {{ UINT64_C(0x21d20779465c3373), UINT64_C(0x40a076ab4410ffe7), UINT64_C(0xde18f696af687735)}},
+  {{ UINT64_C(0x954ec3413015d3e7), UINT64_C(0xbbaec6f274565e98), UINT64_C(0xac8b93b9a2634a45)}},
+  {{ UINT64_C(0xace17fbfc603e4e5), UINT64_C(0x8290a43e6ae98317), UINT64_C(0xd4d4557e493766a3)}},
+  {{ UINT64_C(0x2e80116ca186f6be), UINT64_C(0xe950d52f9058e7fe), UINT64_C(0xd9d28f9d1b484d88)}},
+  {{ UINT64_C(0x32072b233e36ee07), UINT64_C(0x0c122c79179ce66b), UINT64_C(0x342506068666ce02)}},
+  {{ UINT64_C(0xdb6a7ee5a29285b2), UINT64_C(0x99bbd769f194b61b), UINT64_C(0x1b051e986f00ae0d)}},
+  {{ UINT64_C(0x328cf03433e356fb), UINT64_C(0x561a1320a9762234), UINT64_C(0xabb659fe7012866a)}},
+  {{ UINT64_C(0xf0caae77fd26b16f), UINT64_C(0x29281232b2edaaab), UINT64_C(0x998341fbf4447778)}},
+  {{ UINT64_C(0xf5e55f2463902885), UINT64_C(0xef973525b4f792d8), UINT64_C(0xda165be81f966fe8)}},
+  {{ UINT64_C(0x93a00952445b798c), UINT64_C(0xc15e5e00eb2df8e9), UINT64_C(0x752de43c8d32eb73)}},
+  {{ UINT64_C(0xa93eede5cab2840b), UINT64_C(0x6780f6d3a5a181d2), UINT64_C(0x4d7bb37fba5489c8)}},
+  {{ UINT64_C(0x30071f54f2cb1bf5), UINT64_C(0x998e04b45f9ceb73), UINT64_C(0x09d1d75ef711a5a6)}},
+  {{ UINT64_C(0x1c68c78d6bf96d06), UINT64_C(0x77fd20becefe9eb0), UINT64_C(0xc253c35fafe22ac3)}},
+  {{ UINT64_C(0x6aab6e799ae51d30), UINT64_C(0x6129366dabe03a92), UINT64_C(0xb80a0fdcf0670caa)}},
+  {{ UINT64_C(0x9485225001d71af8), UINT64_C(0xbc54f9d8a2cb3a3a), UINT64_C(0x3122637e9b969c82)}},
+  {{ UINT64_C(0x33ab64050029ef0a), UINT64_C(0xdf7690fc6b5a46c5), UINT64_C(0x1d5923e73f6c8914)}},
+  {{ UINT64_C(0xf026054413abc1be), UINT64_C(0x903e799205e70280), UINT64_C(0xe374e115e263d35e)}},
+  {{ UINT64_C(0xc544b14d05c5ecc5), UINT64_C(0xab19a239e947b9f3), UINT64_C(0xeb6f9cc3f17a8b90)}},
+  {{ UINT64_C(0xce272eb86e209d0b), UINT64_C(0x22fb19658a917d40), UINT64_C(0x90be747b5f39ff17)}},
+  {{ UINT64_C(0xe4d3961654e3520c), UINT64_C(0x6901a40262b73b21), UINT64_C(0x6905d5b9f5de72c9)}},
+  {{ UINT64_C(0x98a97dcb14ce2e28), UINT64_C(0x73b90e5ea3621381), UINT64_C(0xd047f9f523bc089c)}},
+  {{ UINT64_C(0xc2089acccd9b7d51), UINT64_C(0x51d95d974421252a), UINT64_C(0x0498ceae75cf626e)}},
+  {{ UINT64_C(0x81d1e8295ec6a012), UINT64_C(0x832bcdb5376705d3), UINT64_C(0xfa1e9ae89cacdd17)}},
+  {{ UINT64_C(0x1ba07230961fd33f), UINT64_C(0xf3afc2c97674b7f6), UINT64_C(0xe15abf4fded9607c)}},
+  {{ UINT64_C(0x42f6158396a798dd), UINT64_C(0xf234771f1d8ea7a5), UINT64_C(0xbc82ba1ef4f38a00)}},
+  {{ UINT64_C(0xa37741b0a4e68ed9), UINT64_C(0x8e83f91db9b48c0e), UINT64_C(0x86fb6bb797c94a6b)}},
+  {{ UINT64_C(0xb358db3464eadbf9), UINT64_C(0x2e0e4ecba33cbde5), UINT64_C(0x6066f3af4d002e7f)}},
+  {{ UINT64_C(0x7711abca9dcb1380), UINT64_C(0x29f57b29591f0b3a), UINT64_C(0xaf810c6a4dde8e9b)}},
+  {{ UINT64_C(0x6dc548fb07b6c9f7), UINT64_C(0x41e6ec72f395c9ab), UINT64_C(0x04fe5b3b37dc433d)}},
+  {{ UINT64_C(0x5e8dfddcf247d132), UINT64_C(0xbcbe7777c359d4e8), UINT64_C(0x8808e2c2e847cbbc)}},
+  {{ UINT64_C(0xb296892f8ba89a9f), UINT64_C(0x23161f740625eaec), UINT64_C(0x2d53246e27fc5583)}},
+  {{ UINT64_C(0x691095d222502491), UINT64_C(0x5bc0797164cc010a), UINT64_C(0xdb8ccedb882e8383)}},
+  {{ UINT64_C(0x9efdb5505b0ecd27), UINT64_C(0xcd7b33d635f3dbd9), UINT64_C(0x905a0982fc915d3d)}},
+  {{ UINT64_C(0x422258db70d2af34), UINT64_C(0xa6c17dd8d9b3eaa7), UINT64_C(0x448b148bcac2d8e4)}},
+  {{ UINT64_C(0xb83166c9c83b0109), UINT64_C(0xe61d31951e929fbd), UINT64_C(0x8c853d2da6c4f224)}},
+  {{ UINT64_C(0x71d2508f68bcf5a9), UINT64_C(0x583927083c47b225), UINT64_C(0x354c6450eb75a442)}},
+  {{ UINT64_C(0xec0ecbfe83575705), UINT64_C(0xc1dbb8ec19331d77), UINT64_C(0xe10c239af952c4fe)}},
+  {{ UINT64_C(0x6f1a6051037ff538), UINT64_C(0xa26c4b1e9f361090), UINT64_C(0xd1021c0d2cf2fce3)}},
+  {{ UINT64_C(0xd1fe5d8cfc26845e), UINT64_C(0x9ab3b72303eb4c00), UINT64_C(0xf29a5833d3fbf5fe)}},
+  {{ UINT64_C(0x8626c85b9e6c5e74), UINT64_C(0x203f969783f32d78), UINT64_C(0x4c236289e7f7f520)}},
+  {{ UINT64_C(0x95581375774c957b), UINT64_C(0xdb3776eb3db09264), UINT64_C(0x2b3c5df4fb8d2b74)}},
+  {{ UINT64_C(0xcfc8b7c0ce5f0d0b), UINT64_C(0xe6385b33d629e763), UINT64_C(0xd5112fe6b4a5ee72)}},
+  {{ UINT64_C(0x280368d966a0beac), UINT64_C(0x45361b4730abf6ea), UINT64_C(0x602f3a46e6d97a2c)}},
+  {{ UINT64_C(0x90b8bad8d464be7e), UINT64_C(0x3f6ae3b417740755), UINT64_C(0x0b196b516953eed6)}},
+  {{ UINT64_C(0x9b55de8a1b5321cf), UINT64_C(0x057bb3d347682101), UINT64_C(0x34004ee544526865)}},
+  {{ UINT64_C(0x60d22116912c2088), UINT64_C(0x73d09e53c6a364c6), UINT64_C(0xd4633c48b0858390)}},
+  {{ UINT64_C(0xb22d328acaf240d0), UINT64_C(0xe28fde69f58b77f5), UINT64_C(0x1d7393bd17daa42e)}},
+  {{ UINT64_C(0xca29fc5a302e3b4a), UINT64_C(0x0abad0a503e913b2), UINT64_C(0xbeb1f84ab1d1cf7c)}},
+  {{ UINT64_C(0xe3d69ad945cdefe7), UINT64_C(0x776a100dc7ed0a7d), UINT64_C(0x7e17771b590de9b3)}},
+  {{ UINT64_C(0x9c051e3da16fe11c), UINT64_C(0x352f9b68ce3de2d4), UINT64_C(0x6bf18d418f9fa76a)}},
+  {{ UINT64_C(0x06a83ca926357ccd), UINT64_C(0x4b9c0d74488eda89), UINT64_C(0x9c6165ab60afbb5a)}},
+  {{ UINT64_C(0xf453ad36dc56c551), UINT64_C(0x72eb2502cfdb963d), UINT64_C(0xf0ce0922546e1bf1)}},
+  {{ UINT64_C(0xda0ea9510265f6bf), UINT64_C(0x386e1a7ec0bc514f), UINT64_C(0xaf6d4641c8aff024)}},
+  {{ UINT64_C(0x0537521fc691bc4b), UINT64_C(0x0d3ca606a5b8a573), UINT64_C(0x64071f9a4f543376)}},
+  {{ UINT64_C(0x7206380d425ea2e8), UINT64_C(0xd4288880e06b5bfa), UINT64_C(0x30267b2508f7545f)}},
+  {{ UINT64_C(0x74317834dc57d774), UINT64_C(0xbfdaf9bd7b77ccf1), UINT64_C(0x9250bd9e12d37661)}},
+  {{ UINT64_C(0xca7133780f5df51e), UINT64_C(0xf5f2fe829a9f2890), UINT64_C(0x0c8a0aa51e4bfa3d)}},
+  {{ UINT64_C(0x3f90f6049dd95381), UINT64_C(0x0947558bd9695c62), UINT64_C(0xf636c7c7a4e15f0b)}},
+  {{ UINT64_C(0x942c19c39bf470c5), UINT64_C(0x2ea11fa0e93de281), UINT64_C(0x4d9b72019872e96b)}},
+  {{ UINT64_C(0xb561e77481eb073c), UINT64_C(0xda05a9e3545e887e), UINT64_C(0xcc4dc4edd9e0408a)}},
+  {{ UINT64_C(0x03af82818ea4abea), UINT64_C(0xe8a7fede1c00e7e5), UINT64_C(0x946ae207296e87f3)}},
+  {{ UINT64_C(0xcccf2a0e9056df56), UINT64_C(0x893a2d5e4e9be6a0), UINT64_C(0xb850c48e5223e7d9)}},
+  {{ UINT64_C(0x5e8f73e1acbc5f17), UINT64_C(0x8991941d4a8bde41), UINT64_C(0xbb8e890a7b230a9b)}},
+  {{ UINT64_C(0x7fdf2c041fc65deb), UINT64_C(0xbcd1cd5d1c38f9e3), UINT64_C(0x875c3c86ba6fe472)}},
+  {{ UINT64_C(0x03fc1041c0dd5136), UINT64_C(0x282ae54eaf6bf52b), UINT64_C(0x2ececce947188c00)}},
+  {{ UINT64_C(0xcf2bb96539a5cdb1), UINT64_C(0x01dc9fd9e47141af), UINT64_C(0xc9c663b7967ef7c0)}},
+  {{ UINT64_C(0x41162273ba9a3c10), UINT64_C(0x814a5df1b3e37f94), UINT64_C(0xc943da3b1a8e8573)}},
+  {{ UINT64_C(0x2040ecd0e7225dcd), UINT64_C(0x72f6daaa298ec108), UINT64_C(0x2c0212a8530e4aff)}},
+  {{ UINT64_C(0xb524fa62adc6fae3), UINT64_C(0x50a34e879c223701), UINT64_C(0x3720480166cae044)}},
+  {{ UINT64_C(0x5fc6ff3a5e9e39d8), UINT64_C(0x136220899552b62a), UINT64_C(0x8b5b22889b02a333)}},
+  {{ UINT64_C(0xe326136cb4b05f0f), UINT64_C(0x077a7efe29d2ad68), UINT64_C(0xb54dcc6ac204960e)}},
+  {{ UINT64_C(0x4f91771f9eca96f9), UINT64_C(0xa0613c9265ad976e), UINT64_C(0x62001cfa57373412)}},
+  {{ UINT64_C(0x1e545b46778afc38), UINT64_C(0xc50b3a49779fc780), UINT64_C(0xefa29d0a7dbe4d28)}},
+  {{ UINT64_C(0x34f2c91727499b85), UINT64_C(0xdd387b16324634f5), UINT64_C(0xa33a6cbf02150228)}},
+  {{ UINT64_C(0x3eb3d8365d3c82ec), UINT64_C(0x148b9f8fb0c83d90), UINT64_C(0x8f82a40d42e5425b)}},
+  {{ UINT64_C(0xbb08f92b73927ffa), UINT64_C(0x77ed4da2d2359ec1), UINT64_C(0xe3e7bf8e6c750f8d)}},
+  {{ UINT64_C(0xdad178dfaa795576), UINT64_C(0x3866815909d5a35b), UINT64_C(0xd237b8a25bbfd125)}},
+  {{ UINT64_C(0x42933ea0a02db68c), UINT64_C(0xb719749d27c3bd5b), UINT64_C(0xd50071bbc6ae1b05)}},
+  {{ UINT64_C(0x7b60e768f34aa317), UINT64_C(0xc135dc51a4e0bb70), UINT64_C(0x347b2a3f915f32fd)}},
+  {{ UINT64_C(0x01e3839e9f2bb352), UINT64_C(0x02f657484821c5c0), UINT64_C(0xda5af7598684f39f)}},
+  {{ UINT64_C(0xd9285e77c3011871), UINT64_C(0x67e5f379a84f145a), UINT64_C(0x799bd4be2bb54d07)}},
+  {{ UINT64_C(0xb7703bfe900ccb8f), UINT64_C(0xa41489681f6a99bb), UINT64_C(0x6fa76a50b6555b93)}},
+  {{ UINT64_C(0xe735c402f57ca35a), UINT64_C(0xc1e34a3b59fd5cab), UINT64_C(0x095ba369c29a9218)}},
+  {{ UINT64_C(0xe0eb25031e43bf18), UINT64_C(0xf6fcb64b2e204bcf), UINT64_C(0xc8aa611fa0e2c208)}},
+  {{ UINT64_C(0xf09bcef3577c1d6a), UINT64_C(0x1e1d5a528f07758a), UINT64_C(0xed7a299a3a64fca3)}},
+  {{ UINT64_C(0x864da0aec19c1bdc), UINT64_C(0x21db1e2fc22d9879), UINT64_C(0xfb78903f4f0ac892)}},
+  {{ UINT64_C(0x761e7f2918343540), UINT64_C(0xee9011560fc85abb), UINT64_C(0xfd84ed40f6bd37c3)}},
+  {{ UINT64_C(0x3b08f56c7ffac5ac), UINT64_C(0x4a952bb26fd94c7e), UINT64_C(0xfc98334aa02258e5)}},
+  {{ UINT64_C(0x4572dc0829bd6830), UINT64_C(0x10522e25d3a53163), UINT64_C(0xd7bb782ed7fd3735)}},
+  {{ UINT64_C(0x9b8c5e9ce722c4c3), UINT64_C(0xc08bc0ffb2f01279), UINT64_C(0x9c6841073a500a0a)}},
+  {{ UINT64_C(0x232d514aad1b2b83), UINT64_C(0x0b03a912951792b3), UINT64_C(0xfb0757019d979f31)}},
+  {{ UINT64_C(0x5c5cc88a15114ca8), UINT64_C(0x86105b3cfd782eb7), UINT64_C(0xa9ab20ba4fb5c21d)}},
+  {{ UINT64_C(0x5e4919363377b780), UINT64_C(0x12c435dd6536c338), UINT64_C(0xa58868b1ddc2c5e7)}},
+  {{ UINT64_C(0xbc4008779cc4c72c), UINT64_C(0xf1e6c1ea7c0f2f0b), UINT64_C(0x0e9cccda524d2586)}},
+  {{ UINT64_C(0xbf60814903dc9280), UINT64_C(0xdd01d8e7d13d3319), UINT64_C(0x51deb3d94b6b2f00)}},
+  {{ UINT64_C(0x82a87d422b30848c), UINT64_C(0x3cb2a26a4bf5d148), UINT64_C(0x19cb9948db95dc02)}},
+  {{ UINT64_C(0x4e42e435c4b6d914), UINT64_C(0x479013b5cb21c983), UINT64_C(0x75d365a7f6b025e1)}},
+  {{ UINT64_C(0xef0785b092a4d486), UINT64_C(0xf1ed780716b59794), UINT64_C(0x114657ebf0c57b58)}},
+  {{ UINT64_C(0xb5076b89fb4224e1), UINT64_C(0x3fecf382fedf671d), UINT64_C(0xc3ca9dd1e081282f)}},
+  {{ UINT64_C(0xe081f4db71f14992), UINT64_C(0x3bd9dd40d826f35c), UINT64_C(0x91f2e2876dd206e0)}},
+  {{ UINT64_C(0x08957b81fd983474), UINT64_C(0xe2a55810c58a2745), UINT64_C(0x6fcdeef7ed9ffba3)}},
+  {{ UINT64_C(0x838b8ea7ec643390), UINT64_C(0xf204941430bc3b1f), UINT64_C(0xba8b0c9e28008b86)}},
+  {{ UINT64_C(0x5c6dd2030cd29a86), UINT64_C(0x6d1f2f046495def4), UINT64_C(0x856165f1b0bdfef8)}},
+  {{ UINT64_C(0x129453c27621cf7e), UINT64_C(0x4d22b636d8875957), UINT64_C(0xeb295e51dc42e2df)}},
+  {{ UINT64_C(0x331b349c8ddf7970), UINT64_C(0xd9b39617a580dead), UINT64_C(0x0c714e552c776256)}},
+  {{ UINT64_C(0xcc4e2301473f90b1), UINT64_C(0x0a4ab5c95cb5e1bf), UINT64_C(0x26a3d38bcb628920)}},
+  {{ UINT64_C(0x5c469821c9a7808e), UINT64_C(0xda5c03daf167ea44), UINT64_C(0xe06c712a36795b26)}},
+  {{ UINT64_C(0x6a3b95fa2eb62e11), UINT64_C(0x60cebc438a4ea61c), UINT64_C(0x1d25264a3cdcb8c0)}},
+  {{ UINT64_C(0x55a48456d6d6a5f8), UINT64_C(0xdf46f0c9675ebf9c), UINT64_C(0xefefe628ca11efff)}},
+  {{ UINT64_C(0x56c68933ac3adb22), UINT64_C(0x436e87677da61ab7), UINT64_C(0x55eb50e27149334e)}},
+  {{ UINT64_C(0x55edeb7a6e45c066), UINT64_C(0xe6ed278413d54a8e), UINT64_C(0x08934eda60f9fb84)}},
+  {{ UINT64_C(0x99d1d3782301d6e1), UINT64_C(0x26ed888badc8bbc3), UINT64_C(0x0c4e42f52d078e42)}},
+  {{ UINT64_C(0x53426f586dbf67d7), UINT64_C(0x4d8888233967b139), UINT64_C(0x1f7abf929b1123e7)}},
+  {{ UINT64_C(0x0413ff69cc875553), UINT64_C(0xc375491c3f7bdc05), UINT64_C(0xb3c0642456dbce7e)}},
+  {{ UINT64_C(0xe1a0672c82d08ce0), UINT64_C(0x283452bc85623999), UINT64_C(0x273e756ca5043b1b)}},
+  {{ UINT64_C(0xadbc9ee98a45fb4e), UINT64_C(0x5cca52ae725236e2), UINT64_C(0xfe1c1526c519cab9)}},
+  {{ UINT64_C(0xcf87a6a13d807af6), UINT64_C(0x6a99c8e3fb316a0e), UINT64_C(0xaefb279e4ea4d5c9)}},
+  {{ UINT64_C(0x7b79893ff6c806ed), UINT64_C(0x406a9e70fe32e605), UINT64_C(0x9cab7f87e0be3ea5)}},
+  {{ UINT64_C(0xe287e9e5d9aec316), UINT64_C(0x64a6a40e7fc8b465), UINT64_C(0x9c2c28477d87f255)}},
+  {{ UINT64_C(0xbca051bc16cd43e7), UINT64_C(0x0a68c68e8b0cc4c2), UINT64_C(0x8ffe34f6051615be)}},
+  {{ UINT64_C(0x612b6aa78796a8e0), UINT64_C(0x0d9e40e7d4014bab), UINT64_C(0xdc56933c23daf737)}},
+  {{ UINT64_C(0xb9edd04f6ef45bca), UINT64_C(0xd27583780431619a), UINT64_C(0xc44e82d49e4c03a8)}},
+  {{ UINT64_C(0x4e0fed38c29ebc3a), UINT64_C(0xf5b96cf4aac28be9), UINT64_C(0x274a246fbef9f7a8)}},
+  {{ UINT64_C(0x755ec02861584b93), UINT64_C(0x00af8a5769624739), UINT64_C(0x659602029b33f0b2)}},
+  {{ UINT64_C(0xaa37c7c177f004f4), UINT64_C(0xbe375b6fb4411bd6), UINT64_C(0x5786fdd5cffd2bb3)}},
+  {{ UINT64_C(0x759df765c5cab487), UINT64_C(0x29983a98aa8174d0), UINT64_C(0x7d87494fbbaba425)}},
+  {{ UINT64_C(0x70f6f11221ee306d), UINT64_C(0x9f4aaaa977491498), UINT64_C(0x897ec0f4826bb88a)}},
+  {{ UINT64_C(0xdd873a8f7ec7605b), UINT64_C(0xb19b95c025af0f00), UINT64_C(0x68f26b6939ec5438)}},
+  {{ UINT64_C(0x20598d3c9c1b5b2c), UINT64_C(0x98aa83541d17d78f), UINT64_C(0x7367dde393359429)}},
+  {{ UINT64_C(0xb2c0c9a6c956e152), UINT64_C(0x826c359499517143), UINT64_C(0x213d886777d449a7)}},
+  {{ UINT64_C(0x13e4ad5b7339fe9f), UINT64_C(0x9730df50af9a50a4), UINT64_C(0x9fa46a262bf6f850)}},
+  {{ UINT64_C(0xbfa36fdaa1cc044b), UINT64_C(0x66830f207da2a22d), UINT64_C(0x0e2e06a8ec5115db)}},
+  {{ UINT64_C(0x24357622ae73fe64), UINT64_C(0x251821e9823fd6c1), UINT64_C(0x2a9e9f541ebdc738)}},
+  {{ UINT64_C(0x1797d45364be3c90), UINT64_C(0xff881b74b441a844), UINT64_C(0xc84981ed948834ef)}},
+  {{ UINT64_C(0x5c78c835d9936052), UINT64_C(0x1443860602030024), UINT64_C(0x9aa1493ce4f53fa4)}},
+  {{ UINT64_C(0xcff9371e1dfc27fa), UINT64_C(0x1deb44454a4cdc78), UINT64_C(0xb3a84f8b170eb850)}},
+  {{ UINT64_C(0x7ee34dbe925532b8), UINT64_C(0xd86c167dcd9057f6), UINT64_C(0x90225cff11a0691c)}},
+  {{ UINT64_C(0x988168be5a234893), UINT64_C(0x51b60e64786f9fc6), UINT64_C(0x8557af1741a8819d)}},
+  {{ UINT64_C(0xb2e2dec122e39cb0), UINT64_C(0x5ad96b7d0fa311e1), UINT64_C(0x9f1307e621101ca8)}},
+  {{ UINT64_C(0x64680efebbb7b16e), UINT64_C(0x6fa6004ece920f3e), UINT64_C(0xd34193a3128f29df)}},
+  {{ UINT64_C(0x18e2c413fdbc1910), UINT64_C(0xe808b64fcdc06c4e), UINT64_C(0x48482dbd3934d74b)}},
+  {{ UINT64_C(0xdec48903babe878e), UINT64_C(0xe5a30a7fa3384c5e), UINT64_C(0xd64df59dd73d432c)}},
+  {{ UINT64_C(0x18739bbdc5fe09ea), UINT64_C(0xf93aba64d7ed87bc), UINT64_C(0xaf620ff7c7357f6d)}},
+  {{ UINT64_C(0x9c72353435b1dfe0), UINT64_C(0x930169f8a25257e8), UINT64_C(0xd7f139a7fae26ac2)}},
+  {{ UINT64_C(0xe1374a755f1e1353), UINT64_C(0x30fbbc75064e7c7b), UINT64_C(0x16bf300cbf7011a7)}},
+  {{ UINT64_C(0x5d8b59c1517faaf9), UINT64_C(0x13bd2b52507d9fed), UINT64_C(0x3cc55ded1ff094e3)}},
+  {{ UINT64_C(0xd9f07ea5af852ad5), UINT64_C(0xaf7dd3a79d55cc39), UINT64_C(0x1b6bb3711a3c34fa)}},
+  {{ UINT64_C(0x4dad77a2f7e2a642), UINT64_C(0xa0ad9bccaa386f28), UINT64_C(0x3e0dd84d9ce35164)}},
+  {{ UINT64_C(0x9ff4c171dcde0453), UINT64_C(0xbc4f1991442ed67f), UINT64_C(0xcf01d65a3b08b81d)}},
+  {{ UINT64_C(0x96c9b02660346e66), UINT64_C(0x0b5ca520c611ffa6), UINT64_C(0xc79810e9f0cb6463)}},
+  {{ UINT64_C(0x0ddcf5a64305d7ef), UINT64_C(0xfd6f5690acc6042c), UINT64_C(0x7d82d553e1f7bfc5)}},
+  {{ UINT64_C(0x951e52234e2928c1), UINT64_C(0x021db4f22f7313e5), UINT64_C(0x9e562cf87810444e)}},
+  {{ UINT64_C(0x692e4f6cb23843c0), UINT64_C(0xb07a0678ad812027), UINT64_C(0x6d11871c57abf0ad)}},
+  {{ UINT64_C(0xaeb7f08a32f01300), UINT64_C(0x2c8987dd508489c2), UINT64_C(0x2cd22a25d7e420aa)}},
+  {{ UINT64_C(0x7d24785aa31f2df3), UINT64_C(0x6741c51aa70e53e7), UINT64_C(0x086bff01777d2f2b)}},
+  {{ UINT64_C(0x84fe89bbfb587dcb), UINT64_C(0xd87dc0bccf92f467), UINT64_C(0x953c4b92cdbbab6a)}},
+  {{ UINT64_C(0xb48c0dff4421cfa5), UINT64_C(0xc3aad8c63e2a10f2), UINT64_C(0x3e17f74f33f666e3)}},
+  {{ UINT64_C(0x7f1879062de88b29), UINT64_C(0x3ce4a2233cd9b628), UINT64_C(0x192d658fb6f5e1f1)}},
+  {{ UINT64_C(0x86ae38db557a9a53), UINT64_C(0x532225a8cd945338), UINT64_C(0x1b4fa002ce2f6d6f)}},
+  {{ UINT64_C(0xa1921590dd814b9f), UINT64_C(0x526c500a4529ba27), UINT64_C(0xb49748d1e39b9d71)}},
+  {{ UINT64_C(0x6da0e61ed2a641aa), UINT64_C(0x01f846b929bb4a30), UINT64_C(0xe40cb009a1881e25)}},
+  {{ UINT64_C(0xa969e05ebe9b4671), UINT64_C(0x0dcde76643b88873), UINT64_C(0x1396e9c414bc1ec6)}},
+  {{ UINT64_C(0x99eefbc96c17702b), UINT64_C(0x29a7f286f2b0445a), UINT64_C(0x48e733dc81e48b4c)}},
+  {{ UINT64_C(0x9d8c28e538dd1080), UINT64_C(0x9049bf7476850ed1), UINT64_C(0x2e4f5da63b65815a)}},
+  {{ UINT64_C(0xfa1cd6ae1aae3456), UINT64_C(0xc1d601792ec30b80), UINT64_C(0xfd76f8dbd821d794)}},
+  {{ UINT64_C(0xbe34e33131619295), UINT64_C(0xb68857caf0407c48), UINT64_C(0x1b9a8064c4b90417)}},
+  {{ UINT64_C(0xd492bcb38f6bf00b), UINT64_C(0x44b5cbcd5cc31c8e), UINT64_C(0x5e9b70d8da991013)}},
+  {{ UINT64_C(0x85c873615778129e), UINT64_C(0xc31b84a6cb5886df), UINT64_C(0x08218e3dace42947)}},
+  {{ UINT64_C(0x65975150f0fc4ec8), UINT64_C(0xb58fbee2bf004263), UINT64_C(0xb61a41c0c6db782d)}},
+  {{ UINT64_C(0x9d94769567de0c38), UINT64_C(0x861a564bbdb29517), UINT64_C(0x78d483a8caa4d874)}},
+  {{ UINT64_C(0x5e396c21759a7bdb), UINT64_C(0xa9ed4ace1d7d5d48), UINT64_C(0x90c2a2ff94d50733)}},
+  {{ UINT64_C(0xc629c90e1c43aaea), UINT64_C(0xd74cc256d423f9ba), UINT64_C(0x78c913288ba2c843)}},
+  {{ UINT64_C(0x2ddeb70c76737077), UINT64_C(0x324ca3a4c94dd41b), UINT64_C(0x16ff73e56cba8d3f)}},
+  {{ UINT64_C(0x1b95aa8dca522374), UINT64_C(0x32060ea8b71fd1a3), UINT64_C(0x52b164703f70c2d9)}},
+  {{ UINT64_C(0xbcf235da0bd515fe), UINT64_C(0xc4a218f5abc4b9e8), UINT64_C(0x1daa588fab35c007)}},
+  {{ UINT64_C(0x3fef73754b644e95), UINT64_C(0x6c466683d7ff228c), UINT64_C(0xad098f8a4e9eb4e1)}},
+};
+
+static const mzd_row192_t K_3[] = {
+  {{ UINT64_C(0x49e6c95432a54cb1), UINT64_C(0xf0e42955a98079c8), UINT64_C(0x7d088d3010d25970)}},
+  {{ UINT64_C(0xf9013be08477e9b1), UINT64_C(0xf0ffd4d2ed25cac5), UINT64_C(0xb97323c243fe64ce)}},
+  {{ UINT64_C(0x6aade7a589ea5e21), UINT64_C(0x736b973cb48bf42c), UINT64_C(0xc43c0acefad7bbbb)}},
+  {{ UINT64_C(0x5bd92751f0fbe443), UINT64_C(0x8a707bce9f5713cd), UINT64_C(0x477c60fdb0509898)}},
+  {{ UINT64_C(0x1ba92519452e5abb), UINT64_C(0xed146217c650f312), UINT64_C(0x8981bdd2b47150dd)}},
+  {{ UINT64_C(0x71f66673f59aa493), UINT64_C(0x8689b5a5ffe8ca20), UINT64_C(0x6c41bf530c4ba6c3)}},
+  {{ UINT64_C(0x58fca072beed0fa6), UINT64_C(0xa1aac8b2f632650c), UINT64_C(0x31939679cbc35e90)}},
+  {{ UINT64_C(0x61a06b12ba23dda3), UINT64_C(0xe28a19fc629a243f), UINT64_C(0x42346ab34782e6da)}},
+  {{ UINT64_C(0xf61b7bd2384e2085), UINT64_C(0xcbfad26d4ccb5082), UINT64_C(0x78aa63d630969990)}},
+  {{ UINT64_C(0x15f9f2a4e2279d6a), UINT64_C(0x8ac4457f65a7ccde), UINT64_C(0x8f90a3b3b951d3c1)}},
+  {{ UINT64_C(0xe3bb2ead52b2946d), UINT64_C(0x9141d2720cb1a05e), UINT64_C(0x3125b13c867f4ac5)}},
+  {{ UINT64_C(0x5d61b5eac8fc94a0), UINT64_C(0x42d099ae8030209c), UINT64_C(0x6966a666677a3138)}},
+  {{ UINT64_C(0x3bd2a6a611e41d0b), UINT64_C(0xd9db343acf57615d), UINT64_C(0xf3f8ec694abe2c56)}},
+  {{ UINT64_C(0xed2c4c2f22731a00), UINT64_C(0x00794d2241fe4c28), UINT64_C(0x7ce6c028337bd4c9)}},
+  {{ UINT64_C(0x125600a0dd358814), UINT64_C(0xf98ef94237e3e065), UINT64_C(0x11da4e85c8d0295a)}},
+  {{ UINT64_C(0xcc0861068ec09215), UINT64_C(0x337bb7f64b95ea48), UINT64_C(0xf69cc100e29f86c3)}},
+  {{ UINT64_C(0x5cf7795f82910830), UINT64_C(0x0f334e4b11e10b98), UINT64_C(0x46c7375e57514bdc)}},
+  {{ UINT64_C(0x0dda6cc60cd9d811), UINT64_C(0xe3722f1e721c2e55), UINT64_C(0x3373904807e9cfa5)}},
+  {{ UINT64_C(0x420479c1ee4e9301), UINT64_C(0xc450a88a57d49846), UINT64_C(0xfe2d3cc0b19271f1)}},
+  {{ UINT64_C(0x133206f3bf92f106), UINT64_C(0x8d88d8fb75c63dff), UINT64_C(0x6c581d7f7ea996c2)}},
+  {{ UINT64_C(0x522e31457defb0ed), UINT64_C(0x807a812655341733), UINT64_C(0xfff373e454b791a5)}},
+  {{ UINT64_C(0x80bc6a25d51379b0), UINT64_C(0x739d5a87f102ac27), UINT64_C(0x61eb40998f8b0264)}},
+  {{ UINT64_C(0x148e75bf9b1817eb), UINT64_C(0xd7c0362be0ae1739), UINT64_C(0xb50746c52bacf004)}},
+  {{ UINT64_C(0x82e73a1fd61e5645), UINT64_C(0x4001c0cbe7efe760), UINT64_C(0xbb290936d35aaa02)}},
+  {{ UINT64_C(0x18c46b1e89e2d640), UINT64_C(0xbaef0dda1440495c), UINT64_C(0x16da9cff6b4ebdc7)}},
+  {{ UINT64_C(0x8de352785343e260), UINT64_C(0xc115173cbebfbf29), UINT64_C(0x20771da89864267d)}},
+  {{ UINT64_C(0xd57d6ed4d33ea2fe), UINT64_C(0xe216160767f9b6ba), UINT64_C(0x9f90905eca426b95)}},
+  {{ UINT64_C(0xef4e33bc55b76739), UINT64_C(0x1e52c24d68d50453), UINT64_C(0xbbd025e8730514a3)}},
+  {{ UINT64_C(0x70cc7a9c5027f774), UINT64_C(0x15b3637a0d9d75a5), UINT64_C(0x74ed082efceebaf4)}},
+  {{ UINT64_C(0x68ac06670b1b7106), UINT64_C(0xfcf8e4810bb7e838), UINT64_C(0xf5cf5d8b11596c88)}},
+  {{ UINT64_C(0x8579966b41fcc780), UINT64_C(0x388777f146fe2946), UINT64_C(0x64642fad1b39c307)}},
+  {{ UINT64_C(0xf34b40862b3c304c), UINT64_C(0x1c6712164d6d1770), UINT64_C(0x38b3b37b8166d332)}},
+  {{ UINT64_C(0x355225b1b1f771cd), UINT64_C(0x77b0df58b5dbe6be), UINT64_C(0x190357abc3b39599)}},
+  {{ UINT64_C(0x426769c4fc0bddd5), UINT64_C(0xeb349379452873f5), UINT64_C(0xd0674e34387e6ba9)}},
+  {{ UINT64_C(0x17d1af49aaa16526), UINT64_C(0xe798277e47a00b02), UINT64_C(0x229527a9477d1bed)}},
+  {{ UINT64_C(0x2b56a516fe54e552), UINT64_C(0x473d790eb7a94e07), UINT64_C(0x66e4f06b7b909d24)}},
+  {{ UINT64_C(0x11ec733a42ac3eaf), UINT64_C(0x5bda91ce3ed85175), UINT64_C(0x9f336015b5e946e3)}},
+  {{ UINT64_C(0xfb7138ec25aded9b), UINT64_C(0xc8ca99c5c361d9cf), UINT64_C(0xe9d19e54787386e2)}},
+  {{ UINT64_C(0xbaf733efd5419e24), UINT64_C(0x9d14d112fc5b7b5d), UINT64_C(0x33d008345011c4f0)}},
+  {{ UINT64_C(0x73595037601cadd9), UINT64_C(0x9c09eef97ce71761), UINT64_C(0xa9d889b7a0d467f7)}},
+  {{ UINT64_C(0x477038e3bfa4236c), UINT64_C(0xc73cc2d19f4c3af5), UINT64_C(0x8f5ee5d9b1160041)}},
+  {{ UINT64_C(0x667bc13193badc78), UINT64_C(0xd7fb0846ab719aad), UINT64_C(0x87ba68777c1eccfd)}},
+  {{ UINT64_C(0xdb02b417c616db3d), UINT64_C(0x895c662a5ad8a8d3), UINT64_C(0x79ef4bd1848602a3)}},
+  {{ UINT64_C(0x821461ee5ac3da99), UINT64_C(0x57ffa84c828ca5aa), UINT64_C(0xaf77583a84574ee6)}},
+  {{ UINT64_C(0x02182dd4b7e41a36), UINT64_C(0x17493d34733cf594), UINT64_C(0x18bbd2255a91772b)}},
+  {{ UINT64_C(0xaebe03b5f947b16c), UINT64_C(0xf095b01dbce0620f), UINT64_C(0x13ac08e4c83e1575)}},
+  {{ UINT64_C(0x18e006c82a43fa62), UINT64_C(0xda6a2b10a60c6af9), UINT64_C(0x9eeefecd78290520)}},
+  {{ UINT64_C(0x20ccad35b281fd13), UINT64_C(0xbdb3116a745fd976), UINT64_C(0xa17c5c3b5f666ea0)}},
+  {{ UINT64_C(0x4eb73a19765d3680), UINT64_C(0x0d0afa8337979293), UINT64_C(0xca89dc945ff22a1f)}},
+  {{ UINT64_C(0x35872c1ba0a7c4bb), UINT64_C(0x04e0b30cd78c67f6), UINT64_C(0x1045be14a00c8881)}},
+  {{ UINT64_C(0x336fb510ff15a6c9), UINT64_C(0x5486436765b9b376), UINT64_C(0x2b0fc99d7a6bcdf0)}},
+  {{ UINT64_C(0x5f3fceba7e306deb), UINT64_C(0xfc5ee1bd08370d19), UINT64_C(0x64fe646b6eb7162d)}},
+  {{ UINT64_C(0xcf404afad6f11c8b), UINT64_C(0xaa784bc529beb363), UINT64_C(0x6c5f9b16ad46d26e)}},
+  {{ UINT64_C(0x84783e87f0ad9b02), UINT64_C(0xd2a1228bf4e22de7), UINT64_C(0xd1f9898b26f93675)}},
+  {{ UINT64_C(0xd87cdaa31f502300), UINT64_C(0x9eec260a827dbb00), UINT64_C(0xbddcebb3ba0aa2b8)}},
+  {{ UINT64_C(0xc9dada84c8598cb9), UINT64_C(0x0ec3bb62ee20a2e2), UINT64_C(0xa5f94ad3981cb87c)}},
+  {{ UINT64_C(0x6e977081ce112e83), UINT64_C(0x6d67d4eee65766b5), UINT64_C(0x1374704b0f3ad75b)}},
+  {{ UINT64_C(0x2192bac25754aa08), UINT64_C(0xa914815e5a48917b), UINT64_C(0x771ddcb8f84c3b14)}},
+  {{ UINT64_C(0x5e9af8c8f4a691e2), UINT64_C(0xecf64cfcef0f297d), UINT64_C(0xfd1461939a3e023a)}},
+  {{ UINT64_C(0xbf1588cb2e8c55c8), UINT64_C(0x9837e8538945f480), UINT64_C(0x973b38c5f7485c44)}},
+  {{ UINT64_C(0x39112018a870a473), UINT64_C(0x84ed46ee67425cd8), UINT64_C(0xf0488853f53e9120)}},
+  {{ UINT64_C(0xc4705fb976d83f07), UINT64_C(0xa9e00315b00642e6), UINT64_C(0xb38c064b6db3d5b2)}},
+  {{ UINT64_C(0xf060c334ac882195), UINT64_C(0xc757b11d1afda0c9), UINT64_C(0x60f4efceb3dac33e)}},
+  {{ UINT64_C(0x3bec17165e91b4b3), UINT64_C(0xb28a18393aa7395c), UINT64_C(0x8e1d0160e29b9ab4)}},
+  {{ UINT64_C(0xec1d39f9f8b08b69), UINT64_C(0x7ffe95497cd6b9f5), UINT64_C(0x4b2a514875ddd399)}},
+  {{ UINT64_C(0x0231ea16b2210210), UINT64_C(0xcfa05ea8eee83157), UINT64_C(0xeb5ee11872ea2999)}},
+  {{ UINT64_C(0x91faad7f7fbd942d), UINT64_C(0x3bfae5e439a92c28), UINT64_C(0xac42cc667add702a)}},
+  {{ UINT64_C(0x7d69e89e02ba93f9), UINT64_C(0x0bd6663590b43b53), UINT64_C(0xf33a390a1ccff5ee)}},
+  {{ UINT64_C(0x234742b01c1d0a13), UINT64_C(0xabd471c16281b9e9), UINT64_C(0x77a4a2fece513ee7)}},
+  {{ UINT64_C(0xf1280c61ad0d0a1f), UINT64_C(0xed0e3a68f2b39aa8), UINT64_C(0x9288a319e96bf98f)}},
+  {{ UINT64_C(0xeb2de0bc8c1e6eaa), UINT64_C(0xc5d76bb95efab76b), UINT64_C(0xa0f5eb01160788e0)}},
+  {{ UINT64_C(0x3aac7ef28e478932), UINT64_C(0xc769bf95c4befe8e), UINT64_C(0xe70e015f50ac3d6f)}},
+  {{ UINT64_C(0x299eea997069e650), UINT64_C(0x62d2383df8e90b65), UINT64_C(0x0051c9768e24d577)}},
+  {{ UINT64_C(0x312abf629f32e7b6), UINT64_C(0x625e9295971705ac), UINT64_C(0x599a79b7a245d3d3)}},
+  {{ UINT64_C(0xaa8d47979764566f), UINT64_C(0x160dc3dc4f14368e), UINT64_C(0x54cbbf3a8e8c0d2a)}},
+  {{ UINT64_C(0x8f66630ee71a6a09), UINT64_C(0x0fb1833c3ae90442), UINT64_C(0xd1195bada1e9c97d)}},
+  {{ UINT64_C(0xe521143b744cd886), UINT64_C(0xdff9986f8949e45e), UINT64_C(0xb5716f755a015492)}},
+  {{ UINT64_C(0xcb01a9bfa21c5629), UINT64_C(0xcba187cd4bcf54e8), UINT64_C(0x459d289a40d6e187)}},
+  {{ UINT64_C(0xb7e08b3274eca1d1), UINT64_C(0x6b97296b7ca3761f), UINT64_C(0xfe7a4bc26bcf8e5f)}},
+  {{ UINT64_C(0x36d6f0d7983fe065), UINT64_C(0x7e01577fb7ae7979), UINT64_C(0x4a4650b9b66dc4d7)}},
+  {{ UINT64_C(0x37524dd1404e3092), UINT64_C(0xec6782e9a178dad6), UINT64_C(0xaf51bfe84395ce4e)}},
+  {{ UINT64_C(0xb4a05b440a14b721), UINT64_C(0xf706a684499e4a36), UINT64_C(0xa41f7df004014d62)}},
+  {{ UINT64_C(0xbd25d06bbcb0e584), UINT64_C(0xccb66dc498164238), UINT64_C(0x97d1a6d1ad7e2ec0)}},
+  {{ UINT64_C(0x2c52fc664e963d93), UINT64_C(0xa79365e36d84b507), UINT64_C(0x30d4eb78a7b41fd3)}},
+  {{ UINT64_C(0x4d059ea04d9a5fb5), UINT64_C(0x35fdd99fd8fded23), UINT64_C(0xfea75c4dea9b8391)}},
+  {{ UINT64_C(0xcb3fa7aed0ae43a4), UINT64_C(0xb6474fd90a87251c), UINT64_C(0xdf79523ca1f8d6a8)}},
+  {{ UINT64_C(0xcfdeeb5ada53b31b), UINT64_C(0x07f9ab07c625926d), UINT64_C(0x96b847cbf4d56d85)}},
+  {{ UINT64_C(0x4acff18ae4f8a2c0), UINT64_C(0x446f32d584ca8c51), UINT64_C(0x97aaf2daeabf6b1f)}},
+  {{ UINT64_C(0x144f759156e2a8ae), UINT64_C(0xb3bcf655bfe0ef93), UINT64_C(0x0f1f8d93077277e0)}},
+  {{ UINT64_C(0xc89c993a1d1f9653), UINT64_C(0x6d9a7f777a489f8c), UINT64_C(0xdbde17e28f70fe56)}},
+  {{ UINT64_C(0x1a24f66ace17225a), UINT64_C(0x7f1e60f39b439fea), UINT64_C(0xde7fa1a950489701)}},
+  {{ UINT64_C(0x648b5a4ea32b23b2), UINT64_C(0x8403d4e55bca6af7), UINT64_C(0x09bbffe62170dfc5)}},
+  {{ UINT64_C(0x3b4192a043cc6b88), UINT64_C(0x481ed70c8320d1d9), UINT64_C(0xcb269f4997263877)}},
+  {{ UINT64_C(0x04da8e35fe117d96), UINT64_C(0xe394ccdc58bb2117), UINT64_C(0x450ca151b05e4db5)}},
+  {{ UINT64_C(0x48c700aa00033691), UINT64_C(0x9e7948da51816333), UINT64_C(0xb28cb8970f1ad1f3)}},
+  {{ UINT64_C(0xd5313e78d4707d88), UINT64_C(0xcf9cb9c2e5b63421), UINT64_C(0x2bcb25ebd11dcc25)}},
+  {{ UINT64_C(0x551df71c61bb60eb), UINT64_C(0x7d907a5fb328e063), UINT64_C(0x70cfa517c692f212)}},
+  {{ UINT64_C(0x6d0db6aec87ec3e6), UINT64_C(0x43fa25f29900daaa), UINT64_C(0xe8a7717a7a0ca173)}},
+  {{ UINT64_C(0x3ab44012cf53a42f), UINT64_C(0xb2b824f69174a0a9), UINT64_C(0xb67dcc2bd9a364cb)}},
+  {{ UINT64_C(0xef33bec689b62849), UINT64_C(0xc5407a74074127b1), UINT64_C(0xb298adacf1ba1696)}},
+  {{ UINT64_C(0x8d8d9f7dd0fc8390), UINT64_C(0x00723e8d39d7c1c8), UINT64_C(0x4f1a2a9eecb7d85c)}},
+  {{ UINT64_C(0x3fac95cf980b35f6), UINT64_C(0x253ba6df8bbaea34), UINT64_C(0x66c12bf07cd59acd)}},
+  {{ UINT64_C(0xe5fec0638ae8b507), UINT64_C(0xacdd83941d1b6565), UINT64_C(0xbab23d61681ced41)}},
+  {{ UINT64_C(0xce9eea8dfc1810d4), UINT64_C(0x2beeb21614d0eacd), UINT64_C(0xe2db6a437a5e743c)}},
+  {{ UINT64_C(0x93098bddeb004529), UINT64_C(0x0872a11cde8b3116), UINT64_C(0x580d6b1bd6a5f92f)}},
+  {{ UINT64_C(0xc9193b035a3fd188), UINT64_C(0xb9245a58142c4a85), UINT64_C(0xa99b3351f61daa15)}},
+  {{ UINT64_C(0x70b4ff938844fb03), UINT64_C(0x732bf2fad19808e7), UINT64_C(0xab5c659795e8fbd9)}},
+  {{ UINT64_C(0xc4058f500d5f81ba), UINT64_C(0x1d6bdc2df4dc02cf), UINT64_C(0xa21cb93e730f6798)}},
+  {{ UINT64_C(0xaac0ca0ede788ae6), UINT64_C(0xf801bc88e65710bb), UINT64_C(0xd1a8e891e8a4c64b)}},
+  {{ UINT64_C(0x5858db960651feea), UINT64_C(0x4ae6e0dbf25012f5), UINT64_C(0x98136d93b7d438f1)}},
+  {{ UINT64_C(0x34debec2019479df), UINT64_C(0xb84ffde009462d63), UINT64_C(0xd23f4c4afd640cb9)}},
+  {{ UINT64_C(0xa2edf75ddaa14baf), UINT64_C(0x3a22637338f4a094), UINT64_C(0x83fb9e233d6094c2)}},
+  {{ UINT64_C(0xeba4645bc2d92307), UINT64_C(0x573fc14f8fb18e04), UINT64_C(0x9d65938bddfa9b32)}},
+  {{ UINT64_C(0xd9710a985e75d0c4), UINT64_C(0x8bcf36a935a37a83), UINT64_C(0xf4f4782308f9e8f1)}},
+  {{ UINT64_C(0x728203cf97721c67), UINT64_C(0x1201af15b0033533), UINT64_C(0xab03486e2e1930cf)}},
+  {{ UINT64_C(0x5f5e2dce8682bfd6), UINT64_C(0xfb30276a531df47a), UINT64_C(0x9ce29412f5f22930)}},
+  {{ UINT64_C(0xdf4fd2e1fac6fa21), UINT64_C(0x47496a383ac9890c), UINT64_C(0xdbb2858f803de0be)}},
+  {{ UINT64_C(0xd24126ed6699fd07), UINT64_C(0x114ab9d29c2bfc5a), UINT64_C(0xed61a43e214f071c)}},
+  {{ UINT64_C(0xee9e0de248f43b1d), UINT64_C(0x28560d929b6498d3), UINT64_C(0xaa80892901e062ac)}},
+  {{ UINT64_C(0xc12b531ae54aa5f4), UINT64_C(0x06c53c1d8c9e8014), UINT64_C(0x9f174da7bb5d1e7b)}},
+  {{ UINT64_C(0x0a7ca9de956491b7), UINT64_C(0xb50753190b9f183c), UINT64_C(0x8193f7471fc460c8)}},
+  {{ UINT64_C(0x97439f72a3854960), UINT64_C(0x440d6e21c5ef4537), UINT64_C(0x1860dd57ef9ac09d)}},
+  {{ UINT64_C(0x7b8de97eaaab463b), UINT64_C(0x3308e124df6798b4), UINT64_C(0xb2be93ccf79083a6)}},
+  {{ UINT64_C(0x1aa8afbea66d0e27), UINT64_C(0x91b722be8bd4e0b4), UINT64_C(0x6abd57496022f8cb)}},
+  {{ UINT64_C(0x36d0cc607458a025), UINT64_C(0xd645ccd9ff375944), UINT64_C(0xd6fcf3fa61c128e6)}},
+  {{ UINT64_C(0x858ad7ef6b6d3bd8), UINT64_C(0xd92a5db7215ce5dd), UINT64_C(0x55906861e93e7a1a)}},
+  {{ UINT64_C(0x6707f032e5bbd079), UINT64_C(0x1ba3d63d382ef7bd), UINT64_C(0x55acab6c44b57449)}},
+  {{ UINT64_C(0xf9d752df0fae43a4), UINT64_C(0xee78b6ceaf8389e5), UINT64_C(0x8fae0b5e65d8d5c4)}},
+  {{ UINT64_C(0x9a263c8926b72468), UINT64_C(0xddd3614c8ce678e5), UINT64_C(0x215ddcb729eb106f)}},
+  {{ UINT64_C(0x4d15d174571b73ca), UINT64_C(0xeae6a41f19db1c33), UINT64_C(0xf10ff4ef8b80b515)}},
+  {{ UINT64_C(0xf98332271fd3723b), UINT64_C(0xc8a1f428f1aa0909), UINT64_C(0xc74cf9bf9568e584)}},
+  {{ UINT64_C(0x2032f4aa565bc20a), UINT64_C(0x21a4a11ff42bc3ea), UINT64_C(0x5e65a13e259a7ee6)}},
+  {{ UINT64_C(0xbefb12a36c77af8b), UINT64_C(0x95f6f80400942b1f), UINT64_C(0x78738f755b98efd8)}},
+  {{ UINT64_C(0xfc21b3470a709ab3), UINT64_C(0xd840a7427765ca70), UINT64_C(0xd82043e09156e6c8)}},
+  {{ UINT64_C(0xe83208d213086cec), UINT64_C(0x40134bfff8f62894), UINT64_C(0x919b523f7b518a02)}},
+  {{ UINT64_C(0xd94cfeec81ccf911), UINT64_C(0x5e6eb69dad55c276), UINT64_C(0xa825559135aac09c)}},
+  {{ UINT64_C(0x85105db5fd7cbbfc), UINT64_C(0x50e9ac66e0cb743e), UINT64_C(0xe336031f4d8d025d)}},
+  {{ UINT64_C(0xe6989a3075fd87dc), UINT64_C(0x0a64b0f60acc7d01), UINT64_C(0xc194407634480428)}},
+  {{ UINT64_C(0x6406deacc8746709), UINT64_C(0x4e7440f76654abda), UINT64_C(0x01f9b32c0426b8c1)}},
+  {{ UINT64_C(0x4ef33d3f6330983b), UINT64_C(0x49d2ccc75d487949), UINT64_C(0x37d305d64e5cd1d2)}},
+  {{ UINT64_C(0x08bf6a35dc5f9c31), UINT64_C(0xcb8a4fc7fa0ff87b), UINT64_C(0x5fd134c7d613599f)}},
+  {{ UINT64_C(0x59a45ca6d1a5fbff), UINT64_C(0x650424b9c859bfe0), UINT64_C(0xf3772eaf85bcad35)}},
+  {{ UINT64_C(0xf002d34e4c0dd01c), UINT64_C(0xf9b004dd41ab75e0), UINT64_C(0x732cbecbcd235441)}},
+  {{ UINT64_C(0xc624390b8246e073), UINT64_C(0xf200a65b575a2723), UINT64_C(0xc63261b6551d2e3b)}},
+  {{ UINT64_C(0x9bb1a963cb0d72f8), UINT64_C(0x4769762346d8d8b0), UINT64_C(0x8e2b4a32c342020b)}},
+  {{ UINT64_C(0x4b020e8963856e2b), UINT64_C(0xb33c82f22aa40e1e), UINT64_C(0x6983dc279133d90a)}},
+  {{ UINT64_C(0x3ba6a2933b3b1741), UINT64_C(0x9c59adedbb985e75), UINT64_C(0xfe31ab3345296f93)}},
+  {{ UINT64_C(0x1fcd22b5035169c7), UINT64_C(0x9ae2b3a907abecfe), UINT64_C(0xe06d31a5fa552dcc)}},
+  {{ UINT64_C(0x97b9b5992bf7fd1c), UINT64_C(0xc29bf6e2fcb5150e), UINT64_C(0x974e259260e9c698)}},
+  {{ UINT64_C(0x52babefceb885821), UINT64_C(0x780f0f80a44efb24), UINT64_C(0xe05150bddc9b59de)}},
+  {{ UINT64_C(0x17c21b86a761cbca), UINT64_C(0x916d3da5baf2b562), UINT64_C(0xe6ae9890b6951ca0)}},
+  {{ UINT64_C(0x43ae2e2b88418c66), UINT64_C(0xfed76bd617d813cd), UINT64_C(0x8ab73b4dad8eba25)}},
+  {{ UINT64_C(0xf96361e852e37937), UINT64_C(0xa540a87050e19967), UINT64_C(0x6f7e9a5d7c16138f)}},
+  {{ UINT64_C(0xa12c6b1027a30d2c), UINT64_C(0xbe1b54f333583b43), UINT64_C(0x5aaf22cf74b4e365)}},
+  {{ UINT64_C(0xfa3a36a407c57b99), UINT64_C(0x25c9f6fc99745941), UINT64_C(0x9259bc580b8719a9)}},
+  {{ UINT64_C(0xdfeb26eec1fa06f5), UINT64_C(0xa36dca3acd673e79), UINT64_C(0xa3fbd53863e80509)}},
+  {{ UINT64_C(0xab7183acbf6f4b25), UINT64_C(0x9309b253bf4149a0), UINT64_C(0xc7f0db4912bf9bff)}},
+  {{ UINT64_C(0x82ce496ca0fd81b9), UINT64_C(0xfd89f9f2bfc72fe4), UINT64_C(0x705b2c3f7c96b85f)}},
+  {{ UINT64_C(0x71b1c0d4b6a99ae1), UINT64_C(0x8b1af7e7a7df6cb5), UINT64_C(0xf0cbe6d567da12f3)}},
+  {{ UINT64_C(0x225ec21ef35abc55), UINT64_C(0x157f038b0acf3a26), UINT64_C(0x4902a925be09f222)}},
+  {{ UINT64_C(0x834bfc2c73ca84f1), UINT64_C(0xd4a2aba5c4d6537f), UINT64_C(0xcedf70b9ca299f13)}},
+  {{ UINT64_C(0xc25b98a3e49d4d35), UINT64_C(0xdd99ed25928dd464), UINT64_C(0xafbd5a48c3899312)}},
+  {{ UINT64_C(0x67be44b1fc4af7f0), UINT64_C(0xc3eac477063a25a5), UINT64_C(0x51d110b9617be74e)}},
+  {{ UINT64_C(0x889e67d3513f4d2b), UINT64_C(0x0b35e3cea6c2d4e3), UINT64_C(0xd99d39d30d0ed410)}},
+  {{ UINT64_C(0x3928a8fbde4bd897), UINT64_C(0x3d3c42525617412b), UINT64_C(0xf001e3960ead2f60)}},
+  {{ UINT64_C(0x169a626a2b8a6a4d), UINT64_C(0x18584edbb50890a5), UINT64_C(0x3e83d2f6f67f1a0f)}},
+  {{ UINT64_C(0x2df8c77c6017bc1a), UINT64_C(0xfc60e8fe4fbf0680), UINT64_C(0x5f2d66e197096607)}},
+  {{ UINT64_C(0x28e66d07c48dee67), UINT64_C(0x3ac298c4b02f44e9), UINT64_C(0x711ff433fda97a63)}},
+  {{ UINT64_C(0xb04cf1bb71aeddf8), UINT64_C(0xa5072e36c9ff10dd), UINT64_C(0xde8c3efdeec492e5)}},
+  {{ UINT64_C(0x1750daecccd81026), UINT64_C(0x20ae076860c7a2ac), UINT64_C(0x66db28c47a84b5b6)}},
+  {{ UINT64_C(0x81e712f35ad3a5d8), UINT64_C(0xbb75b5233a3c542f), UINT64_C(0xe9599fa6fa82179e)}},
+  {{ UINT64_C(0xdb50ee07f38ecd4a), UINT64_C(0x2e5c1d288724526e), UINT64_C(0xc711f87df90bef64)}},
+  {{ UINT64_C(0xd8478a7dcd3b525d), UINT64_C(0x5eea5faa60a611d0), UINT64_C(0x5b9a1b499aab5d8a)}},
+  {{ UINT64_C(0x4746f2c526b5903d), UINT64_C(0x837ff154a305dab2), UINT64_C(0x42f3926f536ff6e9)}},
+  {{ UINT64_C(0x4d1ac529f3f2dd0d), UINT64_C(0x094a1bf1dfba916a), UINT64_C(0x8db38ec7366deb93)}},
+  {{ UINT64_C(0x613362095d5cb263), UINT64_C(0xc0ea2965b14b6e6a), UINT64_C(0x2e5b8a23fe01445d)}},
+  {{ UINT64_C(0xca7f32024100c80e), UINT64_C(0x96fa1cdcac6b59a9), UINT64_C(0x4ab5ea79810d8261)}},
+  {{ UINT64_C(0x47964aa7bcd28e8a), UINT64_C(0x44f8754202e18099), UINT64_C(0xcde95b9fa6e8fb3b)}},
+  {{ UINT64_C(0x7626c5eb3a35a2f4), UINT64_C(0x9a44583dfc04cd79), UINT64_C(0x0c75bdd477fc77fa)}},
+  {{ UINT64_C(0xc25297c35c1397d9), UINT64_C(0xc74231a18184641f), UINT64_C(0x5ff607a72a4a9bdf)}},
+  {{ UINT64_C(0x820f4492446fd6f4), UINT64_C(0xf26f64e5ad00ae01), UINT64_C(0x2cc93b454cd96c07)}},
+  {{ UINT64_C(0x7cab522c78136764), UINT64_C(0x0c9a27b0f8f79f4f), UINT64_C(0x4c4ad493e6eddc59)}},
+  {{ UINT64_C(0x5767005244573d47), UINT64_C(0xab5f2f3142f6537c), UINT64_C(0xb51672a7956ca813)}},
+  {{ UINT64_C(0x5a6b809008d4af7b), UINT64_C(0x86f905402d3a50a9), UINT64_C(0xd08dd6d9861593b6)}},
+  {{ UINT64_C(0x12d4c70113a8ae46), UINT64_C(0xcac6da6d3c7f4bfa), UINT64_C(0x8e1e034799a5a96a)}},
+  {{ UINT64_C(0xd6e81046f5b20a84), UINT64_C(0x49b09d93490269f8), UINT64_C(0x57360dbf69c8b0f1)}},
+  {{ UINT64_C(0xe6c54d895f226e24), UINT64_C(0x34e615e6c23ff5b7), UINT64_C(0x93bf026961f56d9e)}},
+  {{ UINT64_C(0xc300b17e89452a66), UINT64_C(0x9ccb4caf1e84960c), UINT64_C(0x4bc3464241a08148)}},
+  {{ UINT64_C(0x46d3d7344a6d7eed), UINT64_C(0xee6069623ab56f84), UINT64_C(0x82daf75778b93b4b)}},
+  {{ UINT64_C(0xb9637e38cf13a44e), UINT64_C(0xcf307d9f61a41871), UINT64_C(0x125376516d45a6f3)}},
+  {{ UINT64_C(0x25e61ad8742fa535), UINT64_C(0x5127d852667874a3), UINT64_C(0x2628020da7eca041)}},
+  {{ UINT64_C(0xcc6c6dd79e4cc612), UINT64_C(0xc74db99bf030fa32), UINT64_C(0xfc0d3b0c6f4b5c74)}},
+};
+
+static const mzd_row192_t K_4[] = {
+  {{ UINT64_C(0x3df93eb8b10598bb), UINT64_C(0x8d1d46ac008e0a02), UINT64_C(0x53a38800439f170d)}},
+  {{ UINT64_C(0x10dd6fe9ccdd2e3d), UINT64_C(0x70a99e9b8fdafb69), UINT64_C(0xd301d0d4a554ed06)}},
+  {{ UINT64_C(0xce56786ceb85c3ec), UINT64_C(0xb61242b38ff03bed), UINT64_C(0x92f8201f7e27a224)}},
+  {{ UINT64_C(0xf6b1f0f68c98a9b2), UINT64_C(0xfea8e0d88f3b641e), UINT64_C(0xadbcacbf6804c049)}},
+  {{ UINT64_C(0x31dcc287aa17628d), UINT64_C(0x11f1dcd78ca4d04f), UINT64_C(0x5e9a08bc88292046)}},
+  {{ UINT64_C(0x048ec833ba07bd9e), UINT64_C(0xf94684cdb896b2df), UINT64_C(0xeaa10f4168bbe472)}},
+  {{ UINT64_C(0x7d4ac8056109df92), UINT64_C(0xeff33f5384f3e81e), UINT64_C(0x5adc1ac38c5628bb)}},
+  {{ UINT64_C(0x8a8468023e509edf), UINT64_C(0x422b772fd17e98aa), UINT64_C(0x6e8dab2cdf19c18d)}},
+  {{ UINT64_C(0x574f6d143edec6b9), UINT64_C(0x16f37d9a606867db), UINT64_C(0x3bcd0c9cf1349900)}},
+  {{ UINT64_C(0x68e223dc04ba513f), UINT64_C(0xdcfd18e009019dad), UINT64_C(0x774f3eab01ad174f)}},
+  {{ UINT64_C(0x55f7395e634c4c53), UINT64_C(0xe1373e5893494833), UINT64_C(0x771725b843a73e54)}},
+  {{ UINT64_C(0x8200875bbbf9cf8f), UINT64_C(0x23e87555c7a3f373), UINT64_C(0x51fa6ae9f99a295f)}},
+  {{ UINT64_C(0x87efdf02b9e409ad), UINT64_C(0xbb1bf85244e88596), UINT64_C(0xda9bbd346104bc0e)}},
+  {{ UINT64_C(0x5e531343e3bd5ecd), UINT64_C(0xefeb154906ed6b0f), UINT64_C(0x99908b2fa13acda0)}},
+  {{ UINT64_C(0x589e37ca8a3df8c3), UINT64_C(0x5c70425460a8de68), UINT64_C(0x96e47711e43ad753)}},
+  {{ UINT64_C(0x6b7eb568d7e32819), UINT64_C(0x9ff5bd786f65eb36), UINT64_C(0xe7da7a7be9cd4a54)}},
+  {{ UINT64_C(0xfdfe415e8adb8079), UINT64_C(0x3e564010b640692f), UINT64_C(0xfe66216bf818fc5b)}},
+  {{ UINT64_C(0xc53bdf8b93f89a82), UINT64_C(0xaa358e22471dc7f9), UINT64_C(0x9eaf94247dab22dd)}},
+  {{ UINT64_C(0x8c00119746f85efd), UINT64_C(0xade9c8907eb24fcb), UINT64_C(0xb1b6c68e67d9f9a6)}},
+  {{ UINT64_C(0x00b23495afd9de94), UINT64_C(0x249487fead25f9a8), UINT64_C(0xa676aa5445e7db62)}},
+  {{ UINT64_C(0x2604a69f93ffb01b), UINT64_C(0xd918364e5c33b989), UINT64_C(0x4e0cc880f6f2cb28)}},
+  {{ UINT64_C(0x4038ac62592dd1b0), UINT64_C(0xf30e744b70c3f81a), UINT64_C(0x1e54e775307864c1)}},
+  {{ UINT64_C(0x51c785e9fdbbcfd6), UINT64_C(0xf39a074adf3abf0a), UINT64_C(0xdd01f9233f57480b)}},
+  {{ UINT64_C(0xa972da29c2b48970), UINT64_C(0xffca3e1b26d10674), UINT64_C(0xda6aa5e241946719)}},
+  {{ UINT64_C(0xe3313bdbd80eb75e), UINT64_C(0xb87d668aee03a3da), UINT64_C(0x36407c4f3c6bd6aa)}},
+  {{ UINT64_C(0x64cf594df6f40ac3), UINT64_C(0xed849013c31148fd), UINT64_C(0x236dc8246bb6cd27)}},
+  {{ UINT64_C(0xfa79b2cfb04c4e5c), UINT64_C(0xde43abfe64abca99), UINT64_C(0xec87c7435535ad5b)}},
+  {{ UINT64_C(0xe6753898fc0b4ba5), UINT64_C(0x53828bc26b360e6c), UINT64_C(0xe7d301b7378fa3a8)}},
+  {{ UINT64_C(0xeeb535ca3308f288), UINT64_C(0xaab92d6adf391c64), UINT64_C(0xf39ac86374c09582)}},
+  {{ UINT64_C(0x7596d2aa1966cea2), UINT64_C(0x49c557b010d89077), UINT64_C(0x397fa10b48f3cf5b)}},
+  {{ UINT64_C(0xa3ba86f86be250dc), UINT64_C(0x052cb40c645e5811), UINT64_C(0x2855f09cd3fb57d4)}},
+  {{ UINT64_C(0x2fd4d19952c45f3d), UINT64_C(0x054d7e0b10faa37d), UINT64_C(0xd044fdc82c7b38ba)}},
+  {{ UINT64_C(0x3e796bfbf39391e3), UINT64_C(0x6d0bfb9ed5a2812f), UINT64_C(0xb2184ec25c768651)}},
+  {{ UINT64_C(0x9afcc71d81b62204), UINT64_C(0xfecaff5744b09766), UINT64_C(0x53dd2cf2520dddf7)}},
+  {{ UINT64_C(0x8aa818c459177e55), UINT64_C(0xf29daab5cd110d65), UINT64_C(0x99fc927ce4e0eea4)}},
+  {{ UINT64_C(0x583fca0a85733a88), UINT64_C(0xc3a60e60746fba62), UINT64_C(0x177c2e904484bf83)}},
+  {{ UINT64_C(0xff01d7a4136e9374), UINT64_C(0xa2a921ab6d48883f), UINT64_C(0x473fe7882a56a0de)}},
+  {{ UINT64_C(0xd6b78316ba4dea5c), UINT64_C(0x2722d6692456a1f6), UINT64_C(0x2d1c748aa48d7fee)}},
+  {{ UINT64_C(0x4b1f4f66e2f593bc), UINT64_C(0x992fcd0bf75ff81f), UINT64_C(0xd6ebe7ff039268f6)}},
+  {{ UINT64_C(0x718b6b255a4e2fe2), UINT64_C(0x3240102d11d44030), UINT64_C(0x12358d3b48bd400f)}},
+  {{ UINT64_C(0xd0bd4a3f389785b8), UINT64_C(0x60c78661376cbe20), UINT64_C(0x5a87db31060c4218)}},
+  {{ UINT64_C(0xfe45c5b1722f12d6), UINT64_C(0x94f7202ee59d8f51), UINT64_C(0x18af2206ee7cf068)}},
+  {{ UINT64_C(0xde612ede0dde382d), UINT64_C(0x729e4705c1dcb0ae), UINT64_C(0x44f58a021935e210)}},
+  {{ UINT64_C(0xa9f2eea9f340d5c0), UINT64_C(0xe82ffd57c59df5db), UINT64_C(0x9f8c65e9077f02f8)}},
+  {{ UINT64_C(0x84ff152b7cc0890a), UINT64_C(0x6d5ebe589365c2b0), UINT64_C(0x01104face0ed754e)}},
+  {{ UINT64_C(0xd28e163b5dd9db51), UINT64_C(0xd36c08cdf26831f4), UINT64_C(0x3b5b3d39ea37da00)}},
+  {{ UINT64_C(0x2a1b2abf2734de59), UINT64_C(0x03d897d14bf51e37), UINT64_C(0x2a61c19c27f8ad55)}},
+  {{ UINT64_C(0x042dd884026b0a81), UINT64_C(0x1f7102632c93e7a7), UINT64_C(0x0fc4da87c62df09e)}},
+  {{ UINT64_C(0x7d2953b58726ff83), UINT64_C(0xc5b20bb6e6a646ad), UINT64_C(0x8a057ad19d7b2845)}},
+  {{ UINT64_C(0xa2f3c60370a8daef), UINT64_C(0x98ef8e8280c16cd5), UINT64_C(0x4c22e54387ecd1bb)}},
+  {{ UINT64_C(0xe0fe77447a8f682b), UINT64_C(0x4ed06aee259ea763), UINT64_C(0x4ce651fcb00419ee)}},
+  {{ UINT64_C(0x6fcad87ba901b54e), UINT64_C(0xddb0bc5382edca01), UINT64_C(0x818adfcf3f2fe10c)}},
+  {{ UINT64_C(0x319066d9557bf0a1), UINT64_C(0x2e78a4fc83e14d88), UINT64_C(0x40f70460aee486e5)}},
+  {{ UINT64_C(0x7acf15da9ad7f957), UINT64_C(0x53dae360abd70a99), UINT64_C(0x8a8b92779bf151e9)}},
+  {{ UINT64_C(0xf8ab379c1f28f413), UINT64_C(0x62a733bd196c32e6), UINT64_C(0x4371caca7110cd7e)}},
+  {{ UINT64_C(0x417307b11a9e4eea), UINT64_C(0xa8431dc54d6efdc0), UINT64_C(0xb83cae25c2b83b78)}},
+  {{ UINT64_C(0x7135d5a7684d7217), UINT64_C(0xcbe53f9b922906de), UINT64_C(0x56716954497df6de)}},
+  {{ UINT64_C(0x198d9eebd4ca59df), UINT64_C(0x4b28254bc2b5cfcd), UINT64_C(0x5c831fb69ce64f2e)}},
+  {{ UINT64_C(0x428a8ef5cb695971), UINT64_C(0x2b063434678a66e0), UINT64_C(0x40192b55eb4265cf)}},
+  {{ UINT64_C(0x7edf8e406bdc9eac), UINT64_C(0x30870aa4abbc4082), UINT64_C(0x1736fb7701029eca)}},
+  {{ UINT64_C(0x75da8eb6a0ef0cf7), UINT64_C(0xd01e3e7dce85de7c), UINT64_C(0x989c4ef1ab0e6652)}},
+  {{ UINT64_C(0x37ce6f5b1d381a3d), UINT64_C(0xf999d0556b503783), UINT64_C(0x00de6c1b98b3dd4c)}},
+  {{ UINT64_C(0x98191dfc8132db57), UINT64_C(0x96c3246bb0f68649), UINT64_C(0x888934b8a8ed34ac)}},
+  {{ UINT64_C(0xd380903ac5abc2f5), UINT64_C(0xdc4725b8b038006d), UINT64_C(0x7c6e210b3f637668)}},
+  {{ UINT64_C(0xcd39a28af017ba9c), UINT64_C(0x53cb82f2ddbf0833), UINT64_C(0xcca4f980951032d2)}},
+  {{ UINT64_C(0x10157c2c364288cf), UINT64_C(0x403b9bfac4a1e45a), UINT64_C(0xa1c10b512b691315)}},
+  {{ UINT64_C(0x2e9063edd5b4e09c), UINT64_C(0x9139cf52de19e935), UINT64_C(0x0852a8fd2febbf1c)}},
+  {{ UINT64_C(0xe34efc81cc9b989d), UINT64_C(0x6ca6b42352f997e1), UINT64_C(0xa0d6cbc26b5be8f1)}},
+  {{ UINT64_C(0x40116244da016608), UINT64_C(0x15156c3068d82060), UINT64_C(0x87ec9a24d7de6061)}},
+  {{ UINT64_C(0x27a123109099757b), UINT64_C(0xcac8e1f7f422915c), UINT64_C(0xffd4c6550312581a)}},
+  {{ UINT64_C(0xda4800b9b3635959), UINT64_C(0x022570a5a6b79a8e), UINT64_C(0xb327bce6eccc9f35)}},
+  {{ UINT64_C(0x04de1dd285696f60), UINT64_C(0xf8108cf2f8d6fd13), UINT64_C(0x706756d7a2eb770f)}},
+  {{ UINT64_C(0x4da1c27a01a09574), UINT64_C(0x3e03beb7d2bc85aa), UINT64_C(0xcacdbc2c45cb2c9b)}},
+  {{ UINT64_C(0xc5d5fb5a9ea80c73), UINT64_C(0xb38f337a4c74de91), UINT64_C(0xa0dc0e5f4d85f1d8)}},
+  {{ UINT64_C(0x485c43988dad077b), UINT64_C(0xb119faef8fb4224e), UINT64_C(0x1503eeebf37b9c16)}},
+  {{ UINT64_C(0xe1889628a30d7f00), UINT64_C(0x95b040db879f5f17), UINT64_C(0x4e9120f24f21f14b)}},
+  {{ UINT64_C(0xf3a5ec200c033710), UINT64_C(0xf2b668e3d78b9154), UINT64_C(0x4443efa854cb6c54)}},
+  {{ UINT64_C(0xeb9b7567589c79b3), UINT64_C(0xb9f69935547fa188), UINT64_C(0xf5f65ddeb17a26e5)}},
+  {{ UINT64_C(0x744db2e746e1d2cf), UINT64_C(0x388a8e627f943df9), UINT64_C(0xe42cfdd3324da84a)}},
+  {{ UINT64_C(0x415dc219a61da948), UINT64_C(0x34f4d57e4878beb7), UINT64_C(0x006dfbb657505233)}},
+  {{ UINT64_C(0xed1f7f93fe9a8dd9), UINT64_C(0xe2edd5274b38ded6), UINT64_C(0x44a87711fb0c3b71)}},
+  {{ UINT64_C(0x18f842dc840e7863), UINT64_C(0x28b2df4c55b1842f), UINT64_C(0x47a497d325360efd)}},
+  {{ UINT64_C(0x15bacdbf15e611c7), UINT64_C(0x6d036fa2aedd037e), UINT64_C(0x53a223c9f08a91b6)}},
+  {{ UINT64_C(0x68a26a86c36aebae), UINT64_C(0x13bc53086ce0a885), UINT64_C(0x16549874ae1f56c9)}},
+  {{ UINT64_C(0xcd9fc461bffaf1f1), UINT64_C(0x7b6585b37949b335), UINT64_C(0x2dc1c872683fa14b)}},
+  {{ UINT64_C(0x792703bf4e8f80a2), UINT64_C(0x2008aa3b91c8aca2), UINT64_C(0x79dcb548e968701d)}},
+  {{ UINT64_C(0x8d33fe7b98c06bae), UINT64_C(0xef0d83dcc88a7a00), UINT64_C(0x3885d9fead7d4f56)}},
+  {{ UINT64_C(0x949db86fc40f8da8), UINT64_C(0xcdf86234e962885e), UINT64_C(0x52bc047c686e1d64)}},
+  {{ UINT64_C(0x3bdece227058cf62), UINT64_C(0x5643bd5d9777f342), UINT64_C(0x15a192b58a2755c1)}},
+  {{ UINT64_C(0x7f6984474bb1bfda), UINT64_C(0x4502b728d9fe16dd), UINT64_C(0x54d999b5ba67a1b9)}},
+  {{ UINT64_C(0x4940f0155a69021d), UINT64_C(0x37774b87e281b721), UINT64_C(0x5658735dae0d0bb8)}},
+  {{ UINT64_C(0x254d46cd4b322896), UINT64_C(0x5f626b9c0c25707b), UINT64_C(0xd528e7fc48586227)}},
+  {{ UINT64_C(0x14ea571d4b83744d), UINT64_C(0xdee1613af0602643), UINT64_C(0x81d3d3082a2fc7d3)}},
+  {{ UINT64_C(0x159ff446631ffcbb), UINT64_C(0x78bb88baebe7ee11), UINT64_C(0xe2eef62ee414e371)}},
+  {{ UINT64_C(0x0542e0adaccfa8d1), UINT64_C(0xa52772898fc625b9), UINT64_C(0xd0db08b3169d2f7c)}},
+  {{ UINT64_C(0x7eeea2ef4924f0ed), UINT64_C(0xfb43d11fa6f75528), UINT64_C(0xc97b9e0c45be28bb)}},
+  {{ UINT64_C(0xec41ca780a2ddc46), UINT64_C(0x582856679637f4b2), UINT64_C(0xfb4dc45f15b67c15)}},
+  {{ UINT64_C(0xf488ec9279559905), UINT64_C(0x9d1995d7f71fb8dd), UINT64_C(0xfe5721267210deb4)}},
+  {{ UINT64_C(0x98e01a66d4570c1c), UINT64_C(0xf87550ce01358471), UINT64_C(0x800d0b35879c5c1a)}},
+  {{ UINT64_C(0x1ae0c44d256a38e2), UINT64_C(0x0b2c70be9dbb00a9), UINT64_C(0x5ba1349a23649a25)}},
+  {{ UINT64_C(0x48e53683311cb75b), UINT64_C(0x2b1ea2b084995727), UINT64_C(0xe717800c0be93804)}},
+  {{ UINT64_C(0xe9db35ae7d6afa75), UINT64_C(0x73f06b8f5f8e40f1), UINT64_C(0x318a6ff53a57dbe9)}},
+  {{ UINT64_C(0x6730d600992ff045), UINT64_C(0x4df239cafb47a5ac), UINT64_C(0xb4efec6f0f33bbb2)}},
+  {{ UINT64_C(0xcba7b0eee7168aec), UINT64_C(0xc95e2fe7261ce739), UINT64_C(0x2650751a43145e79)}},
+  {{ UINT64_C(0xbb2c1f9e6d151fe6), UINT64_C(0x57d218ca8259b450), UINT64_C(0x88de208a97f789c5)}},
+  {{ UINT64_C(0xcda78b9eef667d6c), UINT64_C(0x6aaebe9ebdbd180f), UINT64_C(0xeb6a452997eca825)}},
+  {{ UINT64_C(0x652e35f4336fefbc), UINT64_C(0xeba17406223ae8ad), UINT64_C(0xac81ae4d59750ce1)}},
+  {{ UINT64_C(0xa6e4d1f47bddf21c), UINT64_C(0x48171a3351c8bc09), UINT64_C(0x50eb6006eff59576)}},
+  {{ UINT64_C(0x1d3420dcd1991922), UINT64_C(0x1fcd7e24e9449521), UINT64_C(0x597623ee48f11fda)}},
+  {{ UINT64_C(0x7d3ff973fb7cfc44), UINT64_C(0xbef51bfc6e22a7b2), UINT64_C(0x77d0b18777d8997f)}},
+  {{ UINT64_C(0x079b4f17575a8ac2), UINT64_C(0xc4360d2e77bc3e1c), UINT64_C(0x7cb70d0f78477e7f)}},
+  {{ UINT64_C(0xa6b931282dcfd653), UINT64_C(0x09e3ef976a241f2b), UINT64_C(0x933983d8653a6c28)}},
+  {{ UINT64_C(0x614d22789447b17d), UINT64_C(0x630c06632515d9ad), UINT64_C(0x2b69ab957a639a30)}},
+  {{ UINT64_C(0xfae0c17a40dd2861), UINT64_C(0xf0a94152cd7c1827), UINT64_C(0x4ce39b40d1e58dfe)}},
+  {{ UINT64_C(0x4224a61ed129ecfe), UINT64_C(0xc46fb455fc061e49), UINT64_C(0x7319b06cdb9d5b81)}},
+  {{ UINT64_C(0x8ee930b5d5a680aa), UINT64_C(0x4204811d71c00168), UINT64_C(0xd34d17d8325bc536)}},
+  {{ UINT64_C(0xeae3a4cafd34331f), UINT64_C(0xdde523a72935dcf2), UINT64_C(0x51d7ee8d59ee8caf)}},
+  {{ UINT64_C(0x47beb2166f55d9aa), UINT64_C(0x87fde743befbf95c), UINT64_C(0xc0b16230c2e3dc8e)}},
+  {{ UINT64_C(0xb55b578ed024b51c), UINT64_C(0x70b3ef6e17741e74), UINT64_C(0x052b2867ab98848a)}},
+  {{ UINT64_C(0x610f2e97b9be7b36), UINT64_C(0xcc94d27de4835873), UINT64_C(0xd96a9624f38ef701)}},
+  {{ UINT64_C(0x2f0efc8dabef2b2d), UINT64_C(0x8859af86b4fb7849), UINT64_C(0x9783c8c69ea1d296)}},
+  {{ UINT64_C(0x5a9bc5e91223fa93), UINT64_C(0xfb95c77c2da70753), UINT64_C(0xbc349ca774f94393)}},
+  {{ UINT64_C(0xb149787658b75f14), UINT64_C(0x78b1211302f9c7c0), UINT64_C(0x16872ab6c00d46cb)}},
+  {{ UINT64_C(0xfd8c5efe7e683f8d), UINT64_C(0xcf477fedd0f79e90), UINT64_C(0xde983fa4a3257df4)}},
+  {{ UINT64_C(0x700f69c255280f40), UINT64_C(0x413f0820f543abf8), UINT64_C(0xd4359ad2d717551f)}},
+  {{ UINT64_C(0x0d1352579f4a74e2), UINT64_C(0xaa0bcd65374d3ac0), UINT64_C(0x29d16d329a2ffc1f)}},
+  {{ UINT64_C(0xaded9e72cce16bb3), UINT64_C(0xb21279a83c54fae5), UINT64_C(0x1aa3b8be11099c5c)}},
+  {{ UINT64_C(0x883867504cf95a65), UINT64_C(0x4191bd38113bc594), UINT64_C(0xa1d93ca04e79a401)}},
+  {{ UINT64_C(0xf1f8ce749165da98), UINT64_C(0xdea60c4bedc0e2be), UINT64_C(0x2d71876f22deba04)}},
+  {{ UINT64_C(0xabc55701d63c4676), UINT64_C(0x73bf83f33200f323), UINT64_C(0x287ec01dd7064f0a)}},
+  {{ UINT64_C(0x78504b280c564617), UINT64_C(0x6669c44909038161), UINT64_C(0xeec841c19a9099e3)}},
+  {{ UINT64_C(0x9f70c6d038d2e21a), UINT64_C(0x368fdf2fbb7a6009), UINT64_C(0x37b8ac3632419962)}},
+  {{ UINT64_C(0x9fb49c1f82376b97), UINT64_C(0xaf3718e178d42d95), UINT64_C(0x0d7ddadb66fd3886)}},
+  {{ UINT64_C(0xbb17a5fc155fa740), UINT64_C(0x0b7042c31ce6be73), UINT64_C(0x3ad675eaf9a1b92d)}},
+  {{ UINT64_C(0x949dd0a4a98a5402), UINT64_C(0x338225810d33a053), UINT64_C(0xad82b25e4c75976e)}},
+  {{ UINT64_C(0x4236011845b4e53e), UINT64_C(0x83be4ed9e2080e30), UINT64_C(0x3ee33bcb4e5b99db)}},
+  {{ UINT64_C(0x22f5793eb80fcd2e), UINT64_C(0x8d434f716c6e874a), UINT64_C(0xb37d4630877e25df)}},
+  {{ UINT64_C(0x8460d4815872442b), UINT64_C(0xc56fc8c02e354b25), UINT64_C(0xd0a57863cfa1e0ce)}},
+  {{ UINT64_C(0x6ef5030583fd2f46), UINT64_C(0xbb322d518c97864d), UINT64_C(0xed04755004579126)}},
+  {{ UINT64_C(0xcf358bafee2f0644), UINT64_C(0x509c5463c6770cb8), UINT64_C(0x7ac7bbd488153688)}},
+  {{ UINT64_C(0x7cb94c5e69778c1c), UINT64_C(0xf4b5baedffad25ae), UINT64_C(0x5ced0ed1ed4e0fd0)}},
+  {{ UINT64_C(0x56fbd67ad0cb183a), UINT64_C(0xa65c204d358e69ed), UINT64_C(0x3ed324b11e0cd853)}},
+  {{ UINT64_C(0xccc0cfdb65fc7316), UINT64_C(0xefe425b50e3d2124), UINT64_C(0xe06ebb3a02fb6895)}},
+  {{ UINT64_C(0x25d2f800fb1ae846), UINT64_C(0x0a6346bffcf1893e), UINT64_C(0x10c417d968de449a)}},
+  {{ UINT64_C(0xe156ad1aa3a06131), UINT64_C(0x04cfa2481c369388), UINT64_C(0x6e7fb80fdd10a9aa)}},
+  {{ UINT64_C(0xae73c1363815e4b6), UINT64_C(0x65c020bb95826456), UINT64_C(0x24a819ba3e98ba12)}},
+  {{ UINT64_C(0x6e76c291a6235438), UINT64_C(0xea0c76c424bb6a12), UINT64_C(0xae0ad200d74ff72b)}},
+  {{ UINT64_C(0x6cc811a45e58152e), UINT64_C(0xa4bc287729074334), UINT64_C(0x9b7a7c6898bb05b4)}},
+  {{ UINT64_C(0x4b1fb9775a382a46), UINT64_C(0xeed1bf828d7c62ef), UINT64_C(0xdf2fca93b5204eb5)}},
+  {{ UINT64_C(0x40d4bf99fa0310db), UINT64_C(0x9a41dded4551bd32), UINT64_C(0xe997a4970cf0c9ab)}},
+  {{ UINT64_C(0x2d8400b2a9ccef35), UINT64_C(0x09b769787e88aa32), UINT64_C(0x0e62f167b21463c7)}},
+  {{ UINT64_C(0x4b75dd76d257167d), UINT64_C(0x6705fce0ef498670), UINT64_C(0x6f0dba5907d16395)}},
+  {{ UINT64_C(0xb422b5c7d4144154), UINT64_C(0x88b7f8300f6f3a07), UINT64_C(0x44465d48c9f73f88)}},
+  {{ UINT64_C(0x7c33bab087506404), UINT64_C(0xafba2ea625273a51), UINT64_C(0x2d88f9e69c3bcfd0)}},
+  {{ UINT64_C(0xe7df02168d410c3e), UINT64_C(0x39e3a513c6758dcb), UINT64_C(0xbc2f6e2b64bf9508)}},
+  {{ UINT64_C(0xa0f883dd4922b4a6), UINT64_C(0xe5539e910bcd3b59), UINT64_C(0xa73d08f757d60755)}},
+  {{ UINT64_C(0xe3689d4294c01571), UINT64_C(0x5c295a4d3c9f5f72), UINT64_C(0xd825b4bb5dc37c03)}},
+  {{ UINT64_C(0x2d9681a049c1baf8), UINT64_C(0x5a016d40e7eea3da), UINT64_C(0x98e1f352e2d7e58a)}},
+  {{ UINT64_C(0xfce6e0d1fba81e99), UINT64_C(0x1098404ccd64cc2d), UINT64_C(0x430a7e1d4c5883bc)}},
+  {{ UINT64_C(0x6ee7fc891cfc5b76), UINT64_C(0xe8a0283c41c87d8a), UINT64_C(0x3842081ca86f6b18)}},
+  {{ UINT64_C(0x700e40931af7d1f0), UINT64_C(0x7b20513b7a72d0d3), UINT64_C(0x82b3377a60ce7157)}},
+  {{ UINT64_C(0xe5aff352243a5afe), UINT64_C(0x37df19f4895c8ae2), UINT64_C(0x81734c15659081f7)}},
+  {{ UINT64_C(0xc2dfaa8a84234346), UINT64_C(0xef49ceee50dc8831), UINT64_C(0x2e2af41581823f72)}},
+  {{ UINT64_C(0xeee8a0856113ec2d), UINT64_C(0x229aca6c5c94a556), UINT64_C(0xe6cb2a0f72e0ada4)}},
+  {{ UINT64_C(0xc49f747f31cfc198), UINT64_C(0x2e1745e545ffeb3f), UINT64_C(0x462ed995f6b4aabc)}},
+  {{ UINT64_C(0xce9fd927640f4187), UINT64_C(0x0af989057a4cee95), UINT64_C(0x1ed9b1e84022a5fd)}},
+  {{ UINT64_C(0x429035a70c4101d2), UINT64_C(0x3dca3142440a3236), UINT64_C(0x0e73698bb8581b8a)}},
+  {{ UINT64_C(0x6593e69c9f3596b4), UINT64_C(0x50002f2994353662), UINT64_C(0x23e4111fd5f5ff93)}},
+  {{ UINT64_C(0x186dd3098aeb4506), UINT64_C(0x66d8c50041ba6b22), UINT64_C(0x7efe4491bb8dd652)}},
+  {{ UINT64_C(0x0699a0ce12d20f72), UINT64_C(0x0cac1b573de7e031), UINT64_C(0x889736af74106c31)}},
+  {{ UINT64_C(0xe2fdbb6618dcd5f6), UINT64_C(0xf3b80a5aeffcba5c), UINT64_C(0x350116586d46392e)}},
+  {{ UINT64_C(0x208625f85c397b0a), UINT64_C(0x4791c11cf70715b7), UINT64_C(0xac70e0d0595e1b29)}},
+  {{ UINT64_C(0xe8e6797c92cd5834), UINT64_C(0x85bdd808f1068de0), UINT64_C(0x141fa3b000c06a53)}},
+  {{ UINT64_C(0xfe528869da1dd759), UINT64_C(0x90b66f5618245a0d), UINT64_C(0xd34ac3048497781a)}},
+  {{ UINT64_C(0xc50a0629efd47274), UINT64_C(0xeaa7a384efbbba73), UINT64_C(0x9921893825d97aae)}},
+  {{ UINT64_C(0xccafbff1a8b707cc), UINT64_C(0x3cdb9be13f809832), UINT64_C(0x19b7ded6174bd0f7)}},
+  {{ UINT64_C(0x350a376493b71215), UINT64_C(0x70ca78c4bbbf6461), UINT64_C(0x9543fae8f767a64e)}},
+  {{ UINT64_C(0xe4dfbe7688cd3492), UINT64_C(0xcd2b239edc917ab3), UINT64_C(0x35f720bd5a8be208)}},
+  {{ UINT64_C(0xfef2ad875c8804a9), UINT64_C(0x86783e54c0a40455), UINT64_C(0x1c1e664a1102a6c6)}},
+  {{ UINT64_C(0xec21aa4099c55f4d), UINT64_C(0x0d27d8d740765e81), UINT64_C(0xdf2cbe94599eaa4a)}},
+  {{ UINT64_C(0x076d98e4f4606f36), UINT64_C(0x65f3809afb99091a), UINT64_C(0x3594d4a962c47262)}},
+  {{ UINT64_C(0xfd1bea75eb010724), UINT64_C(0x1d91cea3c6550916), UINT64_C(0xa43f433ac7722ed7)}},
+  {{ UINT64_C(0x45da7049d8c8a9f8), UINT64_C(0x5ffe05ce1c9fc73e), UINT64_C(0x24505dd7b6afb2fd)}},
+  {{ UINT64_C(0x837a1ab5d2d73def), UINT64_C(0x911ac451f1a01792), UINT64_C(0x7dc9c8220808b10b)}},
+  {{ UINT64_C(0x458b34ade37c8af9), UINT64_C(0xb95859cb6065269a), UINT64_C(0xd8a8ca20119332ac)}},
+  {{ UINT64_C(0x2cbd6d334f12c699), UINT64_C(0x142f5eacdb9f3c35), UINT64_C(0x3555c4adba0861e7)}},
+  {{ UINT64_C(0x561d6c47cea0a614), UINT64_C(0xa068effd0faa7bfb), UINT64_C(0x67b232a47d90c86e)}},
+  {{ UINT64_C(0x1df2305fa18086a6), UINT64_C(0xc7f1eb7f279262ac), UINT64_C(0x9cfc897f545a0df1)}},
+  {{ UINT64_C(0x83a7677cde156a8f), UINT64_C(0x2b6bf032a4ec9092), UINT64_C(0xc6cbb3beba917408)}},
+  {{ UINT64_C(0x35e63a90c091a206), UINT64_C(0x21a370840d415cf2), UINT64_C(0x313e8262ae749c8d)}},
+  {{ UINT64_C(0x3013eeb2701cdd26), UINT64_C(0xa8c4b154f25bd58f), UINT64_C(0x88f2886fceecc4d3)}},
+  {{ UINT64_C(0x7aeccee2c80a0b8f), UINT64_C(0x1e1b0eae28b1c8b2), UINT64_C(0xa6e8ced78a614683)}},
+};
+
+#else
+static const mzd_row192x2_t LK_0[] = {
+  {{{ UINT64_C(0x91d895ecdb28884c), UINT64_C(0x759546c7eab5b1c6), UINT64_C(0x32382adc69b20600)}},
+   {{ UINT64_C(0x9ae5e69ec165545a), UINT64_C(0x3ca38530bc80d381), UINT64_C(0xa4d4fc7eab33fe64)}}},
+  {{{ UINT64_C(0x99f9026f002451b7), UINT64_C(0x96ce1991fa7d0a5e), UINT64_C(0xe55d63824542a451)}},
+   {{ UINT64_C(0x88c9cf6f76c21218), UINT64_C(0x1a6c5d1d198bbabb), UINT64_C(0x5a7ef99c31ad935a)}}},
+  {{{ UINT64_C(0x820e88818e8f42ba), UINT64_C(0xbb1bcdf1d104c9cf), UINT64_C(0x28d59a65573baba5)}},
+   {{ UINT64_C(0xc9d8619d8afc9b03), UINT64_C(0x62e3ff8a30fd63b6), UINT64_C(0x737ad5460073eae2)}}},
+  {{{ UINT64_C(0xaded8dc02b0cb256), UINT64_C(0x3176eaa2e72757bc), UINT64_C(0x85a9f89edcc5f345)}},
+   {{ UINT64_C(0x12dbc0de7665f72e), UINT64_C(0xf5b84c4ed665cd5f), UINT64_C(0x4a100a9bd3b7149d)}}},
+  {{{ UINT64_C(0x4ac1998960f98127), UINT64_C(0x86918902f1bd5c4c), UINT64_C(0x0f8e19f30c84cd4a)}},
+   {{ UINT64_C(0x55c467cda0bc9a76), UINT64_C(0xb8dd9de6787dca92), UINT64_C(0xdff4a2228638eba2)}}},
+  {{{ UINT64_C(0xd260cc2341869ada), UINT64_C(0xdac71918aee92773), UINT64_C(0x48de818a97c1464d)}},
+   {{ UINT64_C(0x1297a6be0a59aa6b), UINT64_C(0xfcf36ca4474c54cf), UINT64_C(0xf607b60ccaa3874a)}}},
+  {{{ UINT64_C(0xcd58cd5c100b43cd), UINT64_C(0x8823c5f90dec7089), UINT64_C(0xd779c3ef377402b2)}},
+   {{ UINT64_C(0x4e26ec01edb61c5e), UINT64_C(0xcc02e1e572863c23), UINT64_C(0x1dd9f7782a1af251)}}},
+  {{{ UINT64_C(0xb78e8190fcd199a6), UINT64_C(0x08cb1e4448752bfe), UINT64_C(0xd4114b13fb37262c)}},
+   {{ UINT64_C(0xca18c46766b02aa4), UINT64_C(0xf310106b07978c72), UINT64_C(0x916e806c21a8a910)}}},
+  {{{ UINT64_C(0xab0205453a3b2a43), UINT64_C(0x3f34c8dd9c4eb10d), UINT64_C(0x497aaa02942c3640)}},
+   {{ UINT64_C(0xf97d673ad0b64330), UINT64_C(0xbf156b267a99da80), UINT64_C(0x6a82b650059849cc)}}},
+  {{{ UINT64_C(0xfcff03ba4b5d836c), UINT64_C(0xfc267a181b0f8da9), UINT64_C(0xebfaa0d95fe78260)}},
+   {{ UINT64_C(0x72015ee107be9fd4), UINT64_C(0x818ae137f553de73), UINT64_C(0xe692bedd876d7922)}}},
+  {{{ UINT64_C(0x11d375f0452ecd2b), UINT64_C(0xa3a1fcdd9570d157), UINT64_C(0xb64e216f8226dd93)}},
+   {{ UINT64_C(0x3c3ffddfc5700456), UINT64_C(0x858ea548a1acd1a5), UINT64_C(0x60d719045b54affc)}}},
+  {{{ UINT64_C(0xbf89972811594086), UINT64_C(0x04197caf432199b6), UINT64_C(0x36e132d0576fa3b0)}},
+   {{ UINT64_C(0x90ada813a5bc5daf), UINT64_C(0xbaf821105d8dd72a), UINT64_C(0x4f90fa9cfdef8c71)}}},
+  {{{ UINT64_C(0x35b587a68e016499), UINT64_C(0xa0a5fbdd58ff5d98), UINT64_C(0x9e95a4bfcd0a151e)}},
+   {{ UINT64_C(0x35673c7410e78c70), UINT64_C(0xa6aedb17714026f6), UINT64_C(0xde64072de5bbfa4d)}}},
+  {{{ UINT64_C(0x10699bbcb81b59e6), UINT64_C(0x460b31fbfabe8001), UINT64_C(0xe096207b85769c88)}},
+   {{ UINT64_C(0xa0d6002e23cebc2c), UINT64_C(0x7deb3fa147635516), UINT64_C(0xc8909cbe11413e6b)}}},
+  {{{ UINT64_C(0x61890c2f3c812f42), UINT64_C(0x517aab59a935a37a), UINT64_C(0xcbc1bb84ee3849f7)}},
+   {{ UINT64_C(0x8167b5cbaeadd008), UINT64_C(0x0358c8db1d121d57), UINT64_C(0xb82cdb2acb778bd6)}}},
+  {{{ UINT64_C(0xe1ba48e476348957), UINT64_C(0xea1ec91ae9eb8bea), UINT64_C(0x2086e558143c69cf)}},
+   {{ UINT64_C(0x146c37a6d7469701), UINT64_C(0xd79b327ebb987299), UINT64_C(0x26ef890500d23f8f)}}},
+  {{{ UINT64_C(0x2054f15ad471c638), UINT64_C(0x7626ba8563491c18), UINT64_C(0x5aff222539ad403f)}},
+   {{ UINT64_C(0x8978d18a99fcb0d3), UINT64_C(0xd5fbb8869a982166), UINT64_C(0xdf8ad48692932ecb)}}},
+  {{{ UINT64_C(0x5614e8d95ed210f7), UINT64_C(0x07167c74be4ff046), UINT64_C(0x78b6e3abb35c8cef)}},
+   {{ UINT64_C(0x5c36e363a838dc46), UINT64_C(0x32987790742d2068), UINT64_C(0x26b4ac9c042a3ba4)}}},
+  {{{ UINT64_C(0x1ac8b52a6c79415d), UINT64_C(0x3088188d81c37894), UINT64_C(0x766d1e9f4a8e3d62)}},
+   {{ UINT64_C(0x1c475c13a53c2647), UINT64_C(0xa99ccb84ca982dc6), UINT64_C(0xc854f61e3289b623)}}},
+  {{{ UINT64_C(0x72dbd7b0d2fa4da9), UINT64_C(0x39f2e512332c4586), UINT64_C(0x763d8cde3be4cb96)}},
+   {{ UINT64_C(0x0d5322fb3edfb471), UINT64_C(0x8389a597122e0281), UINT64_C(0xf30aa95709838b18)}}},
+  {{{ UINT64_C(0x53dc50b80a9a1d06), UINT64_C(0xb0cd11c2eba24b48), UINT64_C(0x30eb21e50b92961b)}},
+   {{ UINT64_C(0xd65f6d1cc05b269c), UINT64_C(0x3da587bda92d8722), UINT64_C(0x95b6b4f4ee302626)}}},
+  {{{ UINT64_C(0x4fef51c1c32b077d), UINT64_C(0x5c87960b440f4f16), UINT64_C(0xdd7f57d9bcbcc6b4)}},
+   {{ UINT64_C(0xbc03340154fb9aea), UINT64_C(0xb18b1a39231372bf), UINT64_C(0x8b99d4269e819678)}}},
+  {{{ UINT64_C(0xaac3ec19dea729fb), UINT64_C(0xfe4333b4513ad17a), UINT64_C(0x988b1655e4776e4d)}},
+   {{ UINT64_C(0xa17b7132a9a51e3e), UINT64_C(0x1ba4e51f980d45fe), UINT64_C(0x9a5b9d02eabd06d1)}}},
+  {{{ UINT64_C(0x62a60b7e5a66795b), UINT64_C(0xc4c814470f8e2148), UINT64_C(0x15c68850093e8067)}},
+   {{ UINT64_C(0x759902cfa5635bae), UINT64_C(0x9abaf3469c8ef3eb), UINT64_C(0x0f816d744e6c89ed)}}},
+  {{{ UINT64_C(0xd4137b89ccec1c25), UINT64_C(0xce59009af12253c1), UINT64_C(0xa4d2214ea6831b0d)}},
+   {{ UINT64_C(0xf32ff36a20a51993), UINT64_C(0x7937273269c6cb8e), UINT64_C(0x7824bc0d936b936d)}}},
+  {{{ UINT64_C(0x32e27d8c1f6f40f9), UINT64_C(0x84749f39301f24bd), UINT64_C(0x91d36e97a1401bd9)}},
+   {{ UINT64_C(0x1f96bf26b644d5ca), UINT64_C(0x8fad7f961cac1d4f), UINT64_C(0x80d21850cc392561)}}},
+  {{{ UINT64_C(0xa994e8b6363c38e0), UINT64_C(0xfe4dba25aa02d979), UINT64_C(0x7f7f3ed625df14be)}},
+   {{ UINT64_C(0x146a4e5f085dd169), UINT64_C(0xd2f647adc1eb41b9), UINT64_C(0xf60271dd936c9dd7)}}},
+  {{{ UINT64_C(0xc65e0bf0ec190e1b), UINT64_C(0x14cb364e03656a77), UINT64_C(0x2170f3182289e18c)}},
+   {{ UINT64_C(0x71ed43ca6c8ea68d), UINT64_C(0xa9bcfecb0f0cdf0a), UINT64_C(0xc673c17541afb354)}}},
+  {{{ UINT64_C(0xe4810d30a18e1a79), UINT64_C(0xa689e2b4477064af), UINT64_C(0xff89f5acffc84603)}},
+   {{ UINT64_C(0x5695e89e40b4fb8b), UINT64_C(0x4aaeb80b5d058fd1), UINT64_C(0x28ce8f63ed8aaedd)}}},
+  {{{ UINT64_C(0x9975b21635b7c4cb), UINT64_C(0x08efb5f2043e5543), UINT64_C(0xa41ac3f9c3010361)}},
+   {{ UINT64_C(0x60421cffc0e9d75e), UINT64_C(0x160a83ebda3bdc86), UINT64_C(0x230dd844b33dfbd8)}}},
+  {{{ UINT64_C(0x17b51d2e0447ae05), UINT64_C(0xec693e31a697024b), UINT64_C(0x0fd633c8380464c1)}},
+   {{ UINT64_C(0xca672f1f9b4c59e8), UINT64_C(0x57900385647548f9), UINT64_C(0xac1717fb06de7dcc)}}},
+  {{{ UINT64_C(0x669ad5cc00e4c052), UINT64_C(0x079ff52efb13f7da), UINT64_C(0x6ab6c0dee9937ec7)}},
+   {{ UINT64_C(0x3142f1f19433da81), UINT64_C(0x470d346f8d004db1), UINT64_C(0xac7c814caf25c5df)}}},
+  {{{ UINT64_C(0x6b76aa3fc60da6bd), UINT64_C(0xeef90c694dac1c9f), UINT64_C(0x156c68688ccbf020)}},
+   {{ UINT64_C(0x2ee23b46bfa1b102), UINT64_C(0x7ec89ed241501b4b), UINT64_C(0x5c1576cfcb570cb9)}}},
+  {{{ UINT64_C(0x194ff3990d242742), UINT64_C(0x6a76f479904b6e0d), UINT64_C(0xcf5030db3dd47855)}},
+   {{ UINT64_C(0x840f0fa71d7d58e6), UINT64_C(0x620d12303716db3e), UINT64_C(0x0fa235f84839fa13)}}},
+  {{{ UINT64_C(0x0a79972abee9389b), UINT64_C(0xbb3746b6cec972f7), UINT64_C(0x52897f573305ed8c)}},
+   {{ UINT64_C(0xd71f9893762a3686), UINT64_C(0xf20f626d986cfe4a), UINT64_C(0xd66eeb7ba876286c)}}},
+  {{{ UINT64_C(0x2e1c64d8bb32b635), UINT64_C(0x2204559bb2ad1788), UINT64_C(0x841a5cdb39e4f985)}},
+   {{ UINT64_C(0x0a5478610efc05ee), UINT64_C(0xf968e7191ea76ae6), UINT64_C(0x65dfce346d3806f5)}}},
+  {{{ UINT64_C(0x8758ed99994e0f74), UINT64_C(0xfe07303ff8b45ca8), UINT64_C(0xf0347b8bff11dd71)}},
+   {{ UINT64_C(0x60cfa2927a965831), UINT64_C(0x665a73686f3c2941), UINT64_C(0x34351f8d9276c1b8)}}},
+  {{{ UINT64_C(0x06bdf0ac812f707d), UINT64_C(0x1d35bfc1fc3e9a91), UINT64_C(0x728d3c141259dea4)}},
+   {{ UINT64_C(0x50702caa42f71d76), UINT64_C(0xd453375f68676550), UINT64_C(0x6be3a37033d6496d)}}},
+  {{{ UINT64_C(0xdb49dd6b41267504), UINT64_C(0x32c91ad025bb412b), UINT64_C(0x3910637052ea17ac)}},
+   {{ UINT64_C(0x6699b224a4d4cd3c), UINT64_C(0x4358f7b13d2cc25a), UINT64_C(0x62cbf3fc934cd6df)}}},
+  {{{ UINT64_C(0x04810c7db19ca825), UINT64_C(0x0ee4a783559706ef), UINT64_C(0x25e2979bb380ea5b)}},
+   {{ UINT64_C(0xade7303704715c3d), UINT64_C(0xa98dc776b89c35ac), UINT64_C(0xef24cb7619300112)}}},
+  {{{ UINT64_C(0xa50694a8b97067ff), UINT64_C(0xb198fe49f2d553fa), UINT64_C(0x950bb89f21c909c0)}},
+   {{ UINT64_C(0x1e4b9315d4d7dea9), UINT64_C(0xb04c30c64c3cf406), UINT64_C(0xe1797de713cf0f4a)}}},
+  {{{ UINT64_C(0xded57e1dad436fd8), UINT64_C(0xc6ada6fa20667e9c), UINT64_C(0xee1ed12c44b962c9)}},
+   {{ UINT64_C(0x21dd0504325d070d), UINT64_C(0xc7d61a4d7c62aa56), UINT64_C(0x491c5fd6f8185c61)}}},
+  {{{ UINT64_C(0x5d480f3842521113), UINT64_C(0x812fc1ce7dc781a2), UINT64_C(0xf629cf7d4eec1eda)}},
+   {{ UINT64_C(0xfa15063367b50cfc), UINT64_C(0x67ea9087a1992560), UINT64_C(0x1b694c752e0221b4)}}},
+  {{{ UINT64_C(0x9adeeeee4d25c22c), UINT64_C(0x851b529ec41020e7), UINT64_C(0x718e3eccc741e69d)}},
+   {{ UINT64_C(0x9045e90900eeec64), UINT64_C(0xfe9777cd81ac1129), UINT64_C(0x63b8f428cdc45537)}}},
+  {{{ UINT64_C(0x4290b02ae3b6a025), UINT64_C(0x948618ca1c2e2ac9), UINT64_C(0x416870b422b2a8b7)}},
+   {{ UINT64_C(0xc9d89d1f0c6470da), UINT64_C(0xa7e20f43062d2a01), UINT64_C(0x775dd20b795ca194)}}},
+  {{{ UINT64_C(0x2980bc264c45ff95), UINT64_C(0xa837c42b9816205a), UINT64_C(0x89fdf5424331511d)}},
+   {{ UINT64_C(0x9bf6e41e66b561db), UINT64_C(0x37ba2c0eedecf3f8), UINT64_C(0x9cff9ddda45b708e)}}},
+  {{{ UINT64_C(0xc7ca3e8612fb8c51), UINT64_C(0x4d17c747e87636fd), UINT64_C(0x1cbcfab187cc9544)}},
+   {{ UINT64_C(0x5c7422104ee8e56a), UINT64_C(0xd3f4567659d12d3b), UINT64_C(0x607d6c5404f01f23)}}},
+  {{{ UINT64_C(0x047b550e67d9be97), UINT64_C(0xc0ba95269617d83c), UINT64_C(0xe432aa653f10c41d)}},
+   {{ UINT64_C(0xe911a07d029168f0), UINT64_C(0xa6c7b7c94603e10a), UINT64_C(0x687a886591579a51)}}},
+  {{{ UINT64_C(0x88bbe8201000642b), UINT64_C(0xbf6877f6cf34b74d), UINT64_C(0x94f642e0e8c48f2c)}},
+   {{ UINT64_C(0xbd8a6fbdd0582112), UINT64_C(0x0dcb039b5501e0f5), UINT64_C(0xe438e6cd74acf0dc)}}},
+  {{{ UINT64_C(0x3fa1c020101f9b06), UINT64_C(0xf646818b941371b5), UINT64_C(0x692eea2815893e45)}},
+   {{ UINT64_C(0x7f132d3460b74a71), UINT64_C(0x807a11fa87d9d991), UINT64_C(0xada8fb91386be4f8)}}},
+  {{{ UINT64_C(0x797d709497c4e885), UINT64_C(0x11df1f456532c6e7), UINT64_C(0x4a2f68609288f359)}},
+   {{ UINT64_C(0x6d66bb24d3606a73), UINT64_C(0x6d681a2c6b2ae131), UINT64_C(0x02738a823dbd5145)}}},
+  {{{ UINT64_C(0x0689263504d9d383), UINT64_C(0x962ca83be8bacf34), UINT64_C(0x65594746e9238151)}},
+   {{ UINT64_C(0x6bbc9b3bf0c9720b), UINT64_C(0x09a5ff995b1a7439), UINT64_C(0xc03bdd5a2d98385d)}}},
+  {{{ UINT64_C(0x943af4bc7053c66d), UINT64_C(0x7361e8f80285bdd8), UINT64_C(0x925584d0f0c8960a)}},
+   {{ UINT64_C(0xfd23af5210fc424e), UINT64_C(0xa87beb32bba66dd7), UINT64_C(0x0411641dbbefee78)}}},
+  {{{ UINT64_C(0xee3e6aa156db3c58), UINT64_C(0x397c7cdca26face7), UINT64_C(0x0b309f2aa73e4952)}},
+   {{ UINT64_C(0x7b9c36831d0a4c59), UINT64_C(0xbafd76435d3d2c6b), UINT64_C(0xb728ad105175c0e1)}}},
+  {{{ UINT64_C(0x9a7cd21c1da83675), UINT64_C(0xc680c07c9736927c), UINT64_C(0xe0fd77d69f75eac5)}},
+   {{ UINT64_C(0x74b60d3f7666964f), UINT64_C(0x3cd9ebc5ca84473d), UINT64_C(0xd89e5477233d855c)}}},
+  {{{ UINT64_C(0x26db465d6f59acf6), UINT64_C(0x5af368492b96e91a), UINT64_C(0x5865a1cb5ae92886)}},
+   {{ UINT64_C(0xee83ac111d0f1842), UINT64_C(0xc5aadf6d8deb4803), UINT64_C(0xb305bb717d0ecbbc)}}},
+  {{{ UINT64_C(0xb149059ebd5174df), UINT64_C(0xc16a4458592db4cc), UINT64_C(0x34dc20ad24b8b242)}},
+   {{ UINT64_C(0x2c129868d931894a), UINT64_C(0xfb36afc270de4e46), UINT64_C(0x8a97444b8014a776)}}},
+  {{{ UINT64_C(0x5f81061ae0e77ddc), UINT64_C(0xe3afaac4d78f7350), UINT64_C(0xe60671c525282834)}},
+   {{ UINT64_C(0x4f52572e7977aae9), UINT64_C(0xbeff837e702315ca), UINT64_C(0x2197af31c2457400)}}},
+  {{{ UINT64_C(0xd7abd8598e93dde0), UINT64_C(0x604e4dda842149a0), UINT64_C(0xa984e1988fab64ab)}},
+   {{ UINT64_C(0x32a5c25d009569b9), UINT64_C(0x8d1c8314e96bd235), UINT64_C(0x4cd00dad862ac8a6)}}},
+  {{{ UINT64_C(0x9ad08c0eb176b06a), UINT64_C(0xe5a18cc0c405495c), UINT64_C(0x81312acfd9ba2346)}},
+   {{ UINT64_C(0xbd9774d974b7f7c7), UINT64_C(0x9cf2013e6dc7198c), UINT64_C(0x30c9a6a41684eb6c)}}},
+  {{{ UINT64_C(0xa7f2cbaec172bf4e), UINT64_C(0xe7cdb67c35118fb1), UINT64_C(0x643eeedf98872711)}},
+   {{ UINT64_C(0xdd1f9c1bf9953f0f), UINT64_C(0xcfb62466ac313aae), UINT64_C(0xcf47876e477e11ba)}}},
+  {{{ UINT64_C(0x8f80c3b1d3431257), UINT64_C(0x0c3e8fb120c622c7), UINT64_C(0x1de817c66dd69f98)}},
+   {{ UINT64_C(0x0e27bf6adddb019e), UINT64_C(0x57a57361191a9e6f), UINT64_C(0x76975db71ad73aaf)}}},
+  {{{ UINT64_C(0xead96c4e7ce8e79c), UINT64_C(0x57543a33f266aa3e), UINT64_C(0x276c916923496020)}},
+   {{ UINT64_C(0x08ee50a386190de1), UINT64_C(0x7716944f5313fa56), UINT64_C(0x506592c4ce73acaf)}}},
+  {{{ UINT64_C(0x07f7ca97d1b91495), UINT64_C(0xb0218c5ac327c07f), UINT64_C(0x3fe7d602a771d44c)}},
+   {{ UINT64_C(0xf403b653d72ff494), UINT64_C(0x471444a8199e9365), UINT64_C(0xedac4f263e9973ca)}}},
+  {{{ UINT64_C(0x8335862660c5f3d5), UINT64_C(0x0ecaa6b6a41d1bce), UINT64_C(0x21341f16d131723d)}},
+   {{ UINT64_C(0x5ea9b20aab81448b), UINT64_C(0x041c57e2ea1814b5), UINT64_C(0xfdb66dfd35ca07b2)}}},
+  {{{ UINT64_C(0xb8f6d00630375b8e), UINT64_C(0x025ed20d561e3901), UINT64_C(0xe23fc49287d65351)}},
+   {{ UINT64_C(0xe9a83fbb149ee383), UINT64_C(0x21a833331899a4f3), UINT64_C(0xe50283e19f97b907)}}},
+  {{{ UINT64_C(0x09dc6174ea10e715), UINT64_C(0x874aa6f8da009949), UINT64_C(0x9b1503e5bfc89c1f)}},
+   {{ UINT64_C(0xcf041d91c9db4967), UINT64_C(0x8d5fcd76c0a334e2), UINT64_C(0xbd45800b67390338)}}},
+  {{{ UINT64_C(0xc9836ea510332fc1), UINT64_C(0x0f26886e3c47fc51), UINT64_C(0x4187f9769a27ee66)}},
+   {{ UINT64_C(0x00b90c135ba7acd8), UINT64_C(0x1be9adba21e5ca96), UINT64_C(0x751b5c5107ca14d0)}}},
+  {{{ UINT64_C(0xf37bccc6c77c01b3), UINT64_C(0x07c60acd3adc2f3b), UINT64_C(0x0a55273e54a3ea6b)}},
+   {{ UINT64_C(0x1ddf9a1eb1b60dbe), UINT64_C(0x784f9c4e457bbd53), UINT64_C(0xbe8c321a7c6c4c23)}}},
+  {{{ UINT64_C(0x9f0fe96510bd2710), UINT64_C(0xfa447df0e39e0c4c), UINT64_C(0x895b363ae509d337)}},
+   {{ UINT64_C(0x9d57f00af78fe826), UINT64_C(0xdfe0e10a76784f3e), UINT64_C(0x0fd190ac5087d77e)}}},
+  {{{ UINT64_C(0x8b97d5d5a95477f6), UINT64_C(0x73c162f0445ea280), UINT64_C(0x3169b61c229a33ca)}},
+   {{ UINT64_C(0x1897229ff7e237e9), UINT64_C(0x79eb7ceceb2e5928), UINT64_C(0x4bfd228c59cf163f)}}},
+  {{{ UINT64_C(0x3e043547e3afc554), UINT64_C(0x986ee01ac79bcccf), UINT64_C(0x48571e38967298ea)}},
+   {{ UINT64_C(0x295fd3fb89335c81), UINT64_C(0xac69ba7296a13fbe), UINT64_C(0x4ed6a9bd01b73ef0)}}},
+  {{{ UINT64_C(0x22f6442d7ce6bf55), UINT64_C(0x644d66def7e1517f), UINT64_C(0x7ea6a8c79385c7f9)}},
+   {{ UINT64_C(0x4d6b107feff64aa0), UINT64_C(0x8925b0e416752fb5), UINT64_C(0x65928f0ae5769a62)}}},
+  {{{ UINT64_C(0x04660bcee2c56936), UINT64_C(0x3c1c7fc1ea5efbf0), UINT64_C(0xc418e2447aff8c99)}},
+   {{ UINT64_C(0xa243bc13b0b35d78), UINT64_C(0xe7d88e7ba60e90ba), UINT64_C(0x7640a2ca4210b0c4)}}},
+  {{{ UINT64_C(0xc2ac12ab246394ea), UINT64_C(0xede3f30e26a10bee), UINT64_C(0x5ec66ce2029566e7)}},
+   {{ UINT64_C(0x6101bf433ce85c78), UINT64_C(0x606ebdde13b20d6b), UINT64_C(0x523fca2e2234f05f)}}},
+  {{{ UINT64_C(0x7c00f867fc334bae), UINT64_C(0x0901d81db5c70f7e), UINT64_C(0xd16cc166a4775042)}},
+   {{ UINT64_C(0x71531ea213e0f2fe), UINT64_C(0x537d1b11974deb53), UINT64_C(0xc4287eb6d27594ab)}}},
+  {{{ UINT64_C(0x603d3e825f62e20e), UINT64_C(0xdd70e58af3404699), UINT64_C(0x1d314348785ecae2)}},
+   {{ UINT64_C(0x8d8ffb07a2b0ac3c), UINT64_C(0xca62c57ddd93a99d), UINT64_C(0xcb3953179c43abcc)}}},
+  {{{ UINT64_C(0x3ec11c7e91bc9f93), UINT64_C(0x3384dba514c65eac), UINT64_C(0x6adfaa4dafb5f881)}},
+   {{ UINT64_C(0x95a67358e30a53cf), UINT64_C(0x5fd63655e87b41c8), UINT64_C(0x7e93ad28d2cb4e63)}}},
+  {{{ UINT64_C(0x4cf212380416cda4), UINT64_C(0x9e0e1ff30583730e), UINT64_C(0x0aa7729e1589e266)}},
+   {{ UINT64_C(0x43d2c2b4589c1b5e), UINT64_C(0xb3a490d4a59b8e6b), UINT64_C(0x7492b5d21ebb962c)}}},
+  {{{ UINT64_C(0x44b3748ca30b7c20), UINT64_C(0xd0e635549e327eae), UINT64_C(0x7d84346c02be7b9e)}},
+   {{ UINT64_C(0xa7e7507270f129a9), UINT64_C(0xbaa9b94bbcf0ee1c), UINT64_C(0x00db31c825864057)}}},
+  {{{ UINT64_C(0x46c85d948bfdec8f), UINT64_C(0x8504311c3379d02f), UINT64_C(0xa332170edabc1a2b)}},
+   {{ UINT64_C(0x521b1315300367d7), UINT64_C(0xdcd3366f6adfe56f), UINT64_C(0x626147e563422821)}}},
+  {{{ UINT64_C(0x7b3736df2de2d743), UINT64_C(0xf2da380731e364dc), UINT64_C(0xd64b9059aa9ca87a)}},
+   {{ UINT64_C(0xdd33bfb8768c38f0), UINT64_C(0x1f455cff2522b8cd), UINT64_C(0xfc16a3865846d968)}}},
+  {{{ UINT64_C(0x40260a559a415d8a), UINT64_C(0xa997030f23383047), UINT64_C(0xe9c505bc8508b332)}},
+   {{ UINT64_C(0x3132e5adb0964f80), UINT64_C(0x12ae8a8883538215), UINT64_C(0xf22775fa145d9808)}}},
+  {{{ UINT64_C(0xa43ef3f4239fc394), UINT64_C(0x5e3d286630115ac0), UINT64_C(0xc0f3e3a0c38fed5b)}},
+   {{ UINT64_C(0x06247042d914337b), UINT64_C(0x351b5f3de5afe550), UINT64_C(0x049c5f0be9bafe55)}}},
+  {{{ UINT64_C(0x7b1b69fd677142d4), UINT64_C(0x0e35b927da635f19), UINT64_C(0xd02abae1000ae291)}},
+   {{ UINT64_C(0x1686cfbf3f6869d1), UINT64_C(0xac04f7ad80df5118), UINT64_C(0xeace7941ab1bce64)}}},
+  {{{ UINT64_C(0xc57c8b99f0eb2d6c), UINT64_C(0x2fc4e7ea92e13fcf), UINT64_C(0x1b327dbf126a560a)}},
+   {{ UINT64_C(0xbb0ad4b2509d000a), UINT64_C(0xade3c294174d6cfd), UINT64_C(0x0ccfcc993eb25089)}}},
+  {{{ UINT64_C(0xbb93d0a41c3d6c1a), UINT64_C(0xc610692f067f7517), UINT64_C(0x69303d7b7c535f14)}},
+   {{ UINT64_C(0xfb4ab9b8c76bfdf7), UINT64_C(0x06e41b8faea0fe60), UINT64_C(0xb92e4ecee7677f19)}}},
+  {{{ UINT64_C(0xe1710a96c004c351), UINT64_C(0xe54497d2e61bed4e), UINT64_C(0x244fa74efc2e53d8)}},
+   {{ UINT64_C(0x5b922df927644f33), UINT64_C(0x848a30602f1f9376), UINT64_C(0x61ca32d917cc6e76)}}},
+  {{{ UINT64_C(0x98f2a08989571366), UINT64_C(0x0f01ed31850a658c), UINT64_C(0xdf926d5cee774088)}},
+   {{ UINT64_C(0xd07adc687bd7a618), UINT64_C(0xc176dd9a337d19a7), UINT64_C(0x2dcd9deccb1f839b)}}},
+  {{{ UINT64_C(0x1f8024a55eaf0f79), UINT64_C(0xfc265d62baec13d3), UINT64_C(0x030cd589c9996c25)}},
+   {{ UINT64_C(0x134b135e3661374d), UINT64_C(0x29d30812bcf0e712), UINT64_C(0xd63fc1a08971a3dc)}}},
+  {{{ UINT64_C(0xfde646921bc4d913), UINT64_C(0x440c721244bbf410), UINT64_C(0x6fea01b5d3c0a3bc)}},
+   {{ UINT64_C(0x91e8c4fa079c50a0), UINT64_C(0xa7a776a4620ac746), UINT64_C(0x5dc335e3a9808dac)}}},
+  {{{ UINT64_C(0x9689c25a678bea73), UINT64_C(0xef3e00f0c243fbce), UINT64_C(0x10b39077da190dd8)}},
+   {{ UINT64_C(0xb208e06587db6fdb), UINT64_C(0x36498041fafa426d), UINT64_C(0xd3822ee820e2c674)}}},
+  {{{ UINT64_C(0x790620990903f9a9), UINT64_C(0x66252f69e071b400), UINT64_C(0x2d9618e93e83688f)}},
+   {{ UINT64_C(0xb87f7830c645e3f0), UINT64_C(0xe81bc2e7ca2859c7), UINT64_C(0x14402b062501c8a8)}}},
+  {{{ UINT64_C(0xa1977abcc488bc73), UINT64_C(0x9b2c04bcb4abd052), UINT64_C(0x03ef667979336ae6)}},
+   {{ UINT64_C(0xad4653ff88447df1), UINT64_C(0x8f8e0a38b93f8ca1), UINT64_C(0xe58b433e35e3be84)}}},
+  {{{ UINT64_C(0xae00743d90aab597), UINT64_C(0xe11a6b6e023d38d8), UINT64_C(0x791d27ed781f0b64)}},
+   {{ UINT64_C(0xe2592c4eb827f642), UINT64_C(0x1c5d5717bc388d70), UINT64_C(0x665f6e9c9c314622)}}},
+  {{{ UINT64_C(0x2c33a59fdbd83e9f), UINT64_C(0x5d3f5f1d9ec7853c), UINT64_C(0xaf96d8ea3bc1e96b)}},
+   {{ UINT64_C(0xc16a60a8e5080935), UINT64_C(0x937ca34e031a4071), UINT64_C(0xb9fa722a61b06fc0)}}},
+  {{{ UINT64_C(0x08bc14ae2708cc3f), UINT64_C(0xd142cc0516fbcfb4), UINT64_C(0xd30276077643a861)}},
+   {{ UINT64_C(0x85f66224d5f5d595), UINT64_C(0x934a4f0dbb81e123), UINT64_C(0x3b7785b1ae3a07eb)}}},
+  {{{ UINT64_C(0xf07a86c9057d93bd), UINT64_C(0xefcdab8a384e61ce), UINT64_C(0xaeb14a796e426819)}},
+   {{ UINT64_C(0xf89011d93ca0155c), UINT64_C(0x0f9dfb5c0dfba9c9), UINT64_C(0x04715d3c7476ac17)}}},
+  {{{ UINT64_C(0x3eef837fc148806b), UINT64_C(0x94a26806b4772a32), UINT64_C(0x8f5ef6116efaded5)}},
+   {{ UINT64_C(0xb693c110e768e0f5), UINT64_C(0x2d2f097b64e728fa), UINT64_C(0xcb7b187f03c5eb8a)}}},
+  {{{ UINT64_C(0x8d112045d4ae3fe1), UINT64_C(0x77cf4d1f56d7c7ee), UINT64_C(0xdee2536f6cc95a3d)}},
+   {{ UINT64_C(0x0e20055a5f5abef9), UINT64_C(0x07c096937263c350), UINT64_C(0x8c5631e8c2e10517)}}},
+  {{{ UINT64_C(0xe005860226bd38ae), UINT64_C(0x5631bba43e5cb0ee), UINT64_C(0xe3b4fc540833fe3a)}},
+   {{ UINT64_C(0x9d7e4dd63cf319b1), UINT64_C(0x35588d68bb82ed9e), UINT64_C(0xeae63e810dae9925)}}},
+  {{{ UINT64_C(0x40232714565b7a9a), UINT64_C(0x8600382a848b224c), UINT64_C(0x722401b4b68d1c6b)}},
+   {{ UINT64_C(0x0a661561eefa32b9), UINT64_C(0xc0ab810339f1bbd6), UINT64_C(0x781f823082a89345)}}},
+  {{{ UINT64_C(0x9964b7e8c0075b46), UINT64_C(0xf17b59bc3d3acde1), UINT64_C(0x6339310e6dc24f16)}},
+   {{ UINT64_C(0x09d41a252d53e531), UINT64_C(0x93f05724b87a799c), UINT64_C(0x3f6ed8fefb5c4e3f)}}},
+  {{{ UINT64_C(0x64f9c34f8d0f9761), UINT64_C(0x663702b77db21c6d), UINT64_C(0x25b7ff915429a4a9)}},
+   {{ UINT64_C(0x84c5732dd451adb3), UINT64_C(0x3acfbc024243098b), UINT64_C(0xb7d512e044e53ad4)}}},
+  {{{ UINT64_C(0xd0d18f2dca2a13d8), UINT64_C(0xc6fa97c35c02a215), UINT64_C(0x056e0b678d35f4f6)}},
+   {{ UINT64_C(0xda46d412bf2fd40b), UINT64_C(0x9a306f97d252f087), UINT64_C(0x016533832bb73c12)}}},
+  {{{ UINT64_C(0x3dd2c79a9522dfd2), UINT64_C(0x4277e6b0dd758489), UINT64_C(0x121ffa83054fe53f)}},
+   {{ UINT64_C(0xa56049acf11f94a9), UINT64_C(0x031eabf9767f9ca2), UINT64_C(0x8332de01cc4197d0)}}},
+  {{{ UINT64_C(0x66b18cf66166f48a), UINT64_C(0xfbe0fd669ab4f1a7), UINT64_C(0xccf2077c9217efdf)}},
+   {{ UINT64_C(0x6afc362da9a2a338), UINT64_C(0x9dfb8a903e20fd18), UINT64_C(0x3c847ce0c8da27e6)}}},
+  {{{ UINT64_C(0xb56f8637243b22a0), UINT64_C(0x50fe896d6e83de25), UINT64_C(0x19438fe303f828e4)}},
+   {{ UINT64_C(0x57c3325791cea18c), UINT64_C(0x17fb996cbbb8a141), UINT64_C(0xb4fb3b493941e351)}}},
+  {{{ UINT64_C(0xdf4fa4b32016a35e), UINT64_C(0xd3bcf1eac71eaf74), UINT64_C(0x88ea5f402ffc1b43)}},
+   {{ UINT64_C(0xdf81ce1f4b13d9f4), UINT64_C(0x532ccec3015c8db9), UINT64_C(0x20703a97d72e6b6e)}}},
+  {{{ UINT64_C(0x1372c4ad1a552ce5), UINT64_C(0xf37881fd380166a6), UINT64_C(0x9572a3828e7194d4)}},
+   {{ UINT64_C(0xb00c90298a15267b), UINT64_C(0x33b72b1858753c64), UINT64_C(0xec0bbd132372eb2e)}}},
+  {{{ UINT64_C(0x7eb899943f03d28b), UINT64_C(0x8cae7259e64ebccc), UINT64_C(0x1bc9f2575f22cc8a)}},
+   {{ UINT64_C(0x5944a2720531cb18), UINT64_C(0xe15b6fbdc5c4f54b), UINT64_C(0x973126bf874a0124)}}},
+  {{{ UINT64_C(0xc1451a1cb16bc019), UINT64_C(0xbc4486edf8f5fefe), UINT64_C(0xee7af07d1eb45324)}},
+   {{ UINT64_C(0x73fc05161897b41f), UINT64_C(0xe44ec9d776a74f3b), UINT64_C(0x9abd0d8ab2b16195)}}},
+  {{{ UINT64_C(0xaea7e4e87318949f), UINT64_C(0x2aa6dd71634f770c), UINT64_C(0x76f517fffa4c40be)}},
+   {{ UINT64_C(0x0c49914dc76b2a5e), UINT64_C(0x30682359f2dad1d1), UINT64_C(0x34d8831aa6359260)}}},
+  {{{ UINT64_C(0xbecb0bb309e418fd), UINT64_C(0xabfb641a48402866), UINT64_C(0xf0106192d8f209c7)}},
+   {{ UINT64_C(0x996d01ee564fc07e), UINT64_C(0xb78da4d726765d11), UINT64_C(0xbace3534a4a3b6f0)}}},
+  {{{ UINT64_C(0x4b0639b1cd92f9d7), UINT64_C(0x568e602370495969), UINT64_C(0x61d8268f49344676)}},
+   {{ UINT64_C(0xfee370c87ec948e4), UINT64_C(0x5cacc03c13f7b34f), UINT64_C(0x302036725dd6d13a)}}},
+  {{{ UINT64_C(0x64693a566406f913), UINT64_C(0xfb2b71f4e704447b), UINT64_C(0xf07702ff1720ab61)}},
+   {{ UINT64_C(0x483c641d64cc1cf7), UINT64_C(0xc98c255c96448b48), UINT64_C(0x82696c22f8470127)}}},
+  {{{ UINT64_C(0xf0eda18fa23ad6a4), UINT64_C(0x6e331621bf45f6a2), UINT64_C(0xba7bf01d9ed0cc23)}},
+   {{ UINT64_C(0xb3601ffafcabe11f), UINT64_C(0xa7e01376b8625890), UINT64_C(0x9be10651c4ac7b54)}}},
+  {{{ UINT64_C(0xd8abbe8fd5c2a86d), UINT64_C(0x64dd9cfe8f88cde4), UINT64_C(0x0335d60e7a80a13e)}},
+   {{ UINT64_C(0x93d17ea2f9495ebc), UINT64_C(0x2d1e6ad6739db9b5), UINT64_C(0x70ba4f83bf2436c3)}}},
+  {{{ UINT64_C(0x311e7599eb850fbf), UINT64_C(0xadf953b8c270eff5), UINT64_C(0x867d7a881f39fe25)}},
+   {{ UINT64_C(0x52ed5885a8664005), UINT64_C(0x19827a35e2ece19e), UINT64_C(0x168121901e234dba)}}},
+  {{{ UINT64_C(0x08bd1d9ff9badaa9), UINT64_C(0xb44d498cefd757c1), UINT64_C(0x738e8ba542dc2896)}},
+   {{ UINT64_C(0xa277c3bbde631708), UINT64_C(0x7b7f455be042ffb9), UINT64_C(0x29a8df2f84e6b1e8)}}},
+  {{{ UINT64_C(0x1924d0eaa7b07b14), UINT64_C(0x9117600871570814), UINT64_C(0xb70f44fc56a7efc1)}},
+   {{ UINT64_C(0x08bb0b11fbf2b2fc), UINT64_C(0x786a51c41d641da5), UINT64_C(0x5efa8ff74676da7e)}}},
+  {{{ UINT64_C(0xf50328df969dcf33), UINT64_C(0xa69b577fdbf9cf20), UINT64_C(0x429dfcecdb5ee6e8)}},
+   {{ UINT64_C(0x3efd5221b3879ba7), UINT64_C(0x7445e6f3d90a4b0f), UINT64_C(0x13359adbf9c3b1ed)}}},
+  {{{ UINT64_C(0x313146c65d9d34e5), UINT64_C(0x05a6164f64ab0a32), UINT64_C(0x7d5ae5384f8d6fdf)}},
+   {{ UINT64_C(0x7c6828c265dad065), UINT64_C(0x17b91dbd1f5a2745), UINT64_C(0x7b157e41e7e288e4)}}},
+  {{{ UINT64_C(0xde1d6d6854631946), UINT64_C(0xe5f9c0175174a8df), UINT64_C(0x59abe747cfb528a5)}},
+   {{ UINT64_C(0x7e0972c748998ca1), UINT64_C(0xcb295a540cd4af43), UINT64_C(0x7450c32e9734ace4)}}},
+  {{{ UINT64_C(0x2a7be87a5c5e9235), UINT64_C(0xd3e92417a1f4cfdd), UINT64_C(0xb1ab21c857cd4a01)}},
+   {{ UINT64_C(0xf387ad466978cf01), UINT64_C(0x941f91f8306e1d4d), UINT64_C(0x5bdf9f2396ad11d6)}}},
+  {{{ UINT64_C(0x49a7e35ced0af35f), UINT64_C(0x95dcda6e22dfd952), UINT64_C(0x899e1c06d764d1b5)}},
+   {{ UINT64_C(0x2e9487453b860056), UINT64_C(0x1245b4149d71b6bd), UINT64_C(0x2852b1d1620baa01)}}},
+  {{{ UINT64_C(0x60e357100f522832), UINT64_C(0x7a382bcb509509a3), UINT64_C(0xaf64f90db3d144e8)}},
+   {{ UINT64_C(0x248462aa465cf6e1), UINT64_C(0xb0f9f6417784a88d), UINT64_C(0x9fe89a84585fb727)}}},
+  {{{ UINT64_C(0xe8fef153be7d1493), UINT64_C(0x207bc5cec2b433d7), UINT64_C(0xb941d8f616699fd8)}},
+   {{ UINT64_C(0x0b16d0fa80f7ada7), UINT64_C(0x9721b2816e04a686), UINT64_C(0x0e231f8457aefee3)}}},
+  {{{ UINT64_C(0xfa6699217cfb5694), UINT64_C(0xe2bb68ccf5ce2de0), UINT64_C(0x2e07427c45d1613b)}},
+   {{ UINT64_C(0x3284b29ae4feca79), UINT64_C(0x5696781c663ac390), UINT64_C(0x8827a0426f20e609)}}},
+  {{{ UINT64_C(0x34b38a21be6f3c0a), UINT64_C(0x0c00db49f4c8616c), UINT64_C(0x8ba2e2e98dda73a1)}},
+   {{ UINT64_C(0xdbdc06d3207b58e7), UINT64_C(0x8f678f90142cd3c7), UINT64_C(0xf0023dca2ed2daf0)}}},
+  {{{ UINT64_C(0x415baaeff93bc89c), UINT64_C(0x77817e1ed73e1c2b), UINT64_C(0xa69e101a45b2bb6a)}},
+   {{ UINT64_C(0xe6a8bf952c97bc3e), UINT64_C(0x9cd2164426c1b66b), UINT64_C(0x781fd055829cb7b6)}}},
+  {{{ UINT64_C(0x96610ffde1a479c3), UINT64_C(0x5ec450e06097e836), UINT64_C(0x0d0148cb6e13f4d4)}},
+   {{ UINT64_C(0xe0c1672cd0d27db8), UINT64_C(0xfa8fd5654afb4aa4), UINT64_C(0x635fa40539707610)}}},
+  {{{ UINT64_C(0xfaf5ad5d60ced562), UINT64_C(0xca5980c9d370eb80), UINT64_C(0xd6f9e1eeb0e582e7)}},
+   {{ UINT64_C(0x28d66d08a7515d52), UINT64_C(0xf1bc61512a1631a8), UINT64_C(0x57e9dbb2bdbc5bc2)}}},
+  {{{ UINT64_C(0x7f8fc36065134deb), UINT64_C(0xf5a03d2e49519697), UINT64_C(0x7dcc3cb13a3d0301)}},
+   {{ UINT64_C(0x1ba421b8373ddb28), UINT64_C(0x100a9da3685b31b1), UINT64_C(0xd55945dc6700603f)}}},
+  {{{ UINT64_C(0x08f5aa2000ce69b9), UINT64_C(0xae6278baf946a61c), UINT64_C(0x0a4b2913d80bfc7f)}},
+   {{ UINT64_C(0x5e133e53f62aec3e), UINT64_C(0x2c86781764120fc3), UINT64_C(0xe023368b660b6518)}}},
+  {{{ UINT64_C(0xddf04e1d907fc02b), UINT64_C(0x8c49b1d8818de76b), UINT64_C(0x04cf2d74e119e89b)}},
+   {{ UINT64_C(0x02edb62eb26119a2), UINT64_C(0x9d374bc2d9f0fd3a), UINT64_C(0xe829e93962ecf4f5)}}},
+  {{{ UINT64_C(0x4cfbe94537f4b7cb), UINT64_C(0x5fc7fa1cda3c47c3), UINT64_C(0x78178fb54ccd7955)}},
+   {{ UINT64_C(0xcbcb6645f07486ef), UINT64_C(0x586fc33baffc0c8b), UINT64_C(0x873aa8ecba3e9921)}}},
+  {{{ UINT64_C(0xb4d52cbab223240a), UINT64_C(0x45da8f15f39ec3a4), UINT64_C(0x6df8a087d856daaa)}},
+   {{ UINT64_C(0x3bf06fb788ea206c), UINT64_C(0x77498c08d69d8e92), UINT64_C(0x8852230688046009)}}},
+  {{{ UINT64_C(0x723fcd697fa66b0c), UINT64_C(0x1f3c8f6f2ffbd484), UINT64_C(0x3a3939cef23e2daa)}},
+   {{ UINT64_C(0x3ea2da1e9c28f615), UINT64_C(0x4e3370ae31bbfb0a), UINT64_C(0xb21d8771f3dcee2f)}}},
+  {{{ UINT64_C(0xba403a302e7c684d), UINT64_C(0x6ee04152b244c05c), UINT64_C(0x78d4a2afdc48cbf7)}},
+   {{ UINT64_C(0x4a266b9c4e1c0892), UINT64_C(0x179bd4bae6ba107f), UINT64_C(0x20d783852b6e39ad)}}},
+  {{{ UINT64_C(0xd0ef584a950b90b2), UINT64_C(0x3e3ab0dab0ab285f), UINT64_C(0xefd64cd413fce73e)}},
+   {{ UINT64_C(0x2cdd73dc949d328d), UINT64_C(0x27ef47a9da049e31), UINT64_C(0x31e7861b2808738f)}}},
+  {{{ UINT64_C(0x3b484739e80610bb), UINT64_C(0xa981275d5b2fad09), UINT64_C(0xf6b79c34cf056f09)}},
+   {{ UINT64_C(0x02e070b60e7f9e4e), UINT64_C(0x837a804aa523415a), UINT64_C(0xa72e154ba51dd790)}}},
+  {{{ UINT64_C(0xf658fb56214c4e6a), UINT64_C(0x3bfd94136f5a349c), UINT64_C(0x77eb5a5aea2d53f1)}},
+   {{ UINT64_C(0x0e9cb1a659e9a6c5), UINT64_C(0xf4bb694c8e96104d), UINT64_C(0xc8e855a9128d9bda)}}},
+  {{{ UINT64_C(0x9801a34dead63638), UINT64_C(0x331a08d08b26d94a), UINT64_C(0xc481d86863da1d8e)}},
+   {{ UINT64_C(0xbbc8d9e6aff63066), UINT64_C(0x125fe49c6e770391), UINT64_C(0xa9bacfea0b45f63c)}}},
+  {{{ UINT64_C(0x14eac881cfc4d7c2), UINT64_C(0xec9bc2b34be20b36), UINT64_C(0x4b73ba354bfa7209)}},
+   {{ UINT64_C(0xec0f2313c3e7c24c), UINT64_C(0x203cbe5964c2ecd5), UINT64_C(0xdd0d1da943c78a6a)}}},
+  {{{ UINT64_C(0xfaa9335e2d8b860c), UINT64_C(0x05ec185374731dc2), UINT64_C(0xa11d62007fad469d)}},
+   {{ UINT64_C(0xb2980ccc80b4cec6), UINT64_C(0xae03f12983eb5d81), UINT64_C(0x9e7f17821944daf8)}}},
+  {{{ UINT64_C(0xfd995ab43ea9d574), UINT64_C(0x34ba9fa02607cd01), UINT64_C(0x5406c3a8608ba730)}},
+   {{ UINT64_C(0x734c9f50c7a53b21), UINT64_C(0x2f9edc248faf30eb), UINT64_C(0x37d1e64150bb6197)}}},
+  {{{ UINT64_C(0xc18ae6f09e2b4597), UINT64_C(0x126680c4a10a7d1d), UINT64_C(0x0b0ded6b543dd3f5)}},
+   {{ UINT64_C(0x1c6404ffc24c2f03), UINT64_C(0xeeee3dce7c24aac9), UINT64_C(0xf063ddbd454557f5)}}},
+  {{{ UINT64_C(0x26c52127dab8c5f7), UINT64_C(0x0f3f6967392006f9), UINT64_C(0xe03ffd2c7cc211da)}},
+   {{ UINT64_C(0x90aefdbf20b79802), UINT64_C(0x188ad0044efb5841), UINT64_C(0x805257a29ce868ea)}}},
+  {{{ UINT64_C(0x56c9ff9e13a147ef), UINT64_C(0x9fc5b0fb1b200579), UINT64_C(0xd7f9fd6343210f00)}},
+   {{ UINT64_C(0xf76d3a6867ac081e), UINT64_C(0x1c4305d6b8760db2), UINT64_C(0xcaa6f1a2aaeb2519)}}},
+  {{{ UINT64_C(0xce65b9cef1f70b53), UINT64_C(0xf5eb9bd508c25c91), UINT64_C(0x35f7e717deb1245f)}},
+   {{ UINT64_C(0x5c95812d6305deda), UINT64_C(0x1ce4a9f0b2d66401), UINT64_C(0xdbd33f10d6515a69)}}},
+  {{{ UINT64_C(0x93b407dfc2563e57), UINT64_C(0x9e4498abfec1a10c), UINT64_C(0x014c43249b5ce77b)}},
+   {{ UINT64_C(0xe65a8fd9efe04625), UINT64_C(0x9ab6b8d6122e415d), UINT64_C(0xd29622099bbae137)}}},
+  {{{ UINT64_C(0x1088a504d75ce273), UINT64_C(0xde51f181dc3d3d1f), UINT64_C(0x107f702a7ccf49d0)}},
+   {{ UINT64_C(0xeccd53bab86b03b7), UINT64_C(0xcc7b8279dad939be), UINT64_C(0xce1ae35eca1b0813)}}},
+  {{{ UINT64_C(0xa9867d39d00b42c0), UINT64_C(0xdfc7d2c8f84fbfa2), UINT64_C(0x755bf291bee59da2)}},
+   {{ UINT64_C(0x6bb15964208d2a61), UINT64_C(0x3be9c441d6b8f95b), UINT64_C(0x01c99386d824bf88)}}},
+  {{{ UINT64_C(0x9ee2bfa4cf97f259), UINT64_C(0xb0d87aed6b2520dc), UINT64_C(0x0880c39448febeea)}},
+   {{ UINT64_C(0x7fc66a92a2d9d4eb), UINT64_C(0xc93b50b3ddc4449f), UINT64_C(0x7413b7d956c5c492)}}},
+  {{{ UINT64_C(0xfd47cf7cd623732e), UINT64_C(0x27b16f45326e7155), UINT64_C(0x4ad0bbc2e0f7232d)}},
+   {{ UINT64_C(0x86d289e22f92cf42), UINT64_C(0xf2509ead05bf4e29), UINT64_C(0x92b31dee6b8e3020)}}},
+  {{{ UINT64_C(0xb3bbe2fc1f607fca), UINT64_C(0x6d68be9bccd64e2e), UINT64_C(0xbf09d796c975d324)}},
+   {{ UINT64_C(0x4b7f7295b1698f94), UINT64_C(0xf14cfe39af85c4a2), UINT64_C(0xcbe15ba3564a459e)}}},
+  {{{ UINT64_C(0xb112455f1e53d8ba), UINT64_C(0x34cc3f405e7a0625), UINT64_C(0x08e9dcb6a2694c00)}},
+   {{ UINT64_C(0xf7697d8ab586fcc9), UINT64_C(0xfeadbae9442cde1c), UINT64_C(0x86f40dad157bc5a0)}}},
+  {{{ UINT64_C(0xae7e44837179273f), UINT64_C(0x2d2aef4ea53311ba), UINT64_C(0xf899e9392237081c)}},
+   {{ UINT64_C(0x71926f3135f29d1c), UINT64_C(0xf87d5cfa6919e284), UINT64_C(0x191fb7c511b230b9)}}},
+  {{{ UINT64_C(0x6f5d83e7134284f9), UINT64_C(0x8900194c3474d773), UINT64_C(0xe93231e281c8df89)}},
+   {{ UINT64_C(0x2ebe8037f70b8167), UINT64_C(0x248982c2cebf73ad), UINT64_C(0x3360bd523dc54f26)}}},
+  {{{ UINT64_C(0x0c01880322502612), UINT64_C(0x4afdda20b682c955), UINT64_C(0x736c5bb70f51ec49)}},
+   {{ UINT64_C(0x9416c2cccc56cdec), UINT64_C(0x7e7af3db1a1d7cbd), UINT64_C(0xb5fa0396aca98b7c)}}},
+  {{{ UINT64_C(0x9f332d6f6d3b8032), UINT64_C(0xa79dffd114b7ce83), UINT64_C(0x43c1857142b39b44)}},
+   {{ UINT64_C(0xf5f0a28c423f9029), UINT64_C(0xb846de96c2304c37), UINT64_C(0x5849c1105a6b591c)}}},
+  {{{ UINT64_C(0x831e59bf6d33450a), UINT64_C(0x6c545d88f3558165), UINT64_C(0x599eb69a468a4698)}},
+   {{ UINT64_C(0xe3a853fdaef178db), UINT64_C(0xfd340e685452d974), UINT64_C(0x0cbf8a7f14dada9f)}}},
+  {{{ UINT64_C(0xa5324519f1a37802), UINT64_C(0x43a17e2a40887288), UINT64_C(0x7a5cf006f37f9d8f)}},
+   {{ UINT64_C(0x8e592695af6f2750), UINT64_C(0xe981a3525ef96e4f), UINT64_C(0x6fc5e6ced35c8033)}}},
+  {{{ UINT64_C(0xb97fdd6387c8c350), UINT64_C(0xf326e99954520b4e), UINT64_C(0x3a7e56e3ede8a819)}},
+   {{ UINT64_C(0x2e54176c3a11f938), UINT64_C(0x5f1833e82d3acb62), UINT64_C(0x9de09440128f2b0c)}}},
+  {{{ UINT64_C(0xe2a9c22adb87fc28), UINT64_C(0x658e71655d7cdd6e), UINT64_C(0x813897365d7428e4)}},
+   {{ UINT64_C(0x52cfeccea098bf0a), UINT64_C(0x6f1dd3f417a1e25b), UINT64_C(0x341df93c89c514d5)}}},
+  {{{ UINT64_C(0xb176dd5d649c0fee), UINT64_C(0xa4ece475f8f5a33d), UINT64_C(0xc7719939d1e7727e)}},
+   {{ UINT64_C(0x4df287cdc2ffa77d), UINT64_C(0xbaeefdd01e97c239), UINT64_C(0xe35fa9f1b3b2b946)}}},
+  {{{ UINT64_C(0x2e37606b20a0a9b4), UINT64_C(0x6b997d6f5f5970e0), UINT64_C(0xe8d2db62d13344f1)}},
+   {{ UINT64_C(0xbdc44d79e9a64e8c), UINT64_C(0x9773e2b5814d73c0), UINT64_C(0x54d03cf9625d8fc1)}}},
+  {{{ UINT64_C(0x62b301dc38fdf9a5), UINT64_C(0x13d161cfca1f73cc), UINT64_C(0x4169b3c37b12f1c4)}},
+   {{ UINT64_C(0xaba671fb6e5e5f7c), UINT64_C(0x617fb15c47eeef17), UINT64_C(0x15974416bb107103)}}},
+  {{{ UINT64_C(0x10980178d30188d8), UINT64_C(0x9836baa954f7ad1f), UINT64_C(0x8a71698a10be4edf)}},
+   {{ UINT64_C(0x4cf89f8d2164fb37), UINT64_C(0xab16f8a446635cd8), UINT64_C(0x509e14a4dfcb96e2)}}},
+  {{{ UINT64_C(0x28177d84d6a87cdb), UINT64_C(0x3bc9f64c474716e2), UINT64_C(0xbc2d8f9c00045054)}},
+   {{ UINT64_C(0x1b88125b5013a740), UINT64_C(0xdddf107915cc05a5), UINT64_C(0xe7763ec17616ab01)}}},
+  {{{ UINT64_C(0x3c1f391fe87459f1), UINT64_C(0xce11af6e384a4785), UINT64_C(0x1a5b5ccf336a2dfd)}},
+   {{ UINT64_C(0xda8a62fdcce4ad25), UINT64_C(0x019fd5abf4e0b6d6), UINT64_C(0xd25571ca58a0eb01)}}},
+  {{{ UINT64_C(0xbffeaa4c50df5371), UINT64_C(0x2d8863ec0c84ed2b), UINT64_C(0x1679ce842f7cac43)}},
+   {{ UINT64_C(0x704125abdd9fdafd), UINT64_C(0xea5822a3e625c5a5), UINT64_C(0x41539607115a50a7)}}},
+  {{{ UINT64_C(0x8a4ec3fbd241ce50), UINT64_C(0x4b73300bf8d0b54e), UINT64_C(0xca8d68cd5600a578)}},
+   {{ UINT64_C(0xf48a73ab9d456ea6), UINT64_C(0x6d2f70fc629a4660), UINT64_C(0x71e1f6a4f4df0d4e)}}},
+  {{{ UINT64_C(0x4da4986c273f1333), UINT64_C(0x868c0ee8affa194a), UINT64_C(0x678b4d811ef67ee2)}},
+   {{ UINT64_C(0x0c9fe5315ac513ff), UINT64_C(0x00a06242ebc7dbf6), UINT64_C(0x3a4899ab68a6b3e8)}}},
+  {{{ UINT64_C(0x5861f81f17e0b916), UINT64_C(0xd78a3a6b4e47fddc), UINT64_C(0x03aa2ea39eb20d45)}},
+   {{ UINT64_C(0x93acb15965a017af), UINT64_C(0x9fcb68bfb1b88f38), UINT64_C(0xc84810800341b712)}}},
+  {{{ UINT64_C(0x8888b8154218fa4f), UINT64_C(0x68e7a19fd9913843), UINT64_C(0x9aaa37ea0a1dc396)}},
+   {{ UINT64_C(0xf93b3daad29fde9b), UINT64_C(0x15b376604e0320e1), UINT64_C(0x7c240f2fa00045b0)}}},
+  {{{ UINT64_C(0x56fc4bb34b5d17dc), UINT64_C(0xc7ca423d3dac8974), UINT64_C(0x608ac3fe9ef0d25c)}},
+   {{ UINT64_C(0x6da37fcb59ce41aa), UINT64_C(0xed110355b906732f), UINT64_C(0x1ab2d63190e3a2e6)}}},
+  {{{ UINT64_C(0x21002443e62c0536), UINT64_C(0x889f22d37fd0fdf0), UINT64_C(0xca0ca08ab532372d)}},
+   {{ UINT64_C(0x8d9e88efe9ad66a6), UINT64_C(0x6570846ed5d0f10c), UINT64_C(0x3b41d13a6a7c3d6b)}}},
+  {{{ UINT64_C(0x60b3e75d26a8a976), UINT64_C(0xeae3bb43a1ff0b31), UINT64_C(0xc17354d8380ff205)}},
+   {{ UINT64_C(0x4f62c7aa44645f8b), UINT64_C(0xb0b44eee15db33f5), UINT64_C(0x9ed815b3662b0228)}}},
+  {{{ UINT64_C(0x0593601d44159d9c), UINT64_C(0x453a419392fcb25b), UINT64_C(0x0fca30af5604dff9)}},
+   {{ UINT64_C(0x5da80a0b82780ee7), UINT64_C(0x5e228e5910f295dc), UINT64_C(0x7db2959793635339)}}},
+  {{{ UINT64_C(0x2c60c679bf37b1a6), UINT64_C(0xe5bfcff3b50a9264), UINT64_C(0x45629e407d73456b)}},
+   {{ UINT64_C(0xe113bcfe56351c97), UINT64_C(0x8a7d6ce89ea354dd), UINT64_C(0xa6491c02739e8b55)}}},
+  {{{ UINT64_C(0xa668b8efcb4cf29d), UINT64_C(0x19d756797a1990d9), UINT64_C(0xc9099559d0ca1060)}},
+   {{ UINT64_C(0x9b1a44505e35592b), UINT64_C(0xd9ce20780b8b2b43), UINT64_C(0x5966394ffa055ee7)}}},
+  {{{ UINT64_C(0x775e1bdaf36f9575), UINT64_C(0x5d44ca22982673c4), UINT64_C(0xa61690ddd61d030a)}},
+   {{ UINT64_C(0x3ac432b047776911), UINT64_C(0x22dde202bd2b025d), UINT64_C(0x411c85ed0fc02303)}}},
+  {{{ UINT64_C(0x5586c5122a0ba2a4), UINT64_C(0x89597fd3adaa85af), UINT64_C(0x07a912d93c6c3e3e)}},
+   {{ UINT64_C(0xdb2943f481ad880d), UINT64_C(0xc65d9ee8f703cbc3), UINT64_C(0xb740f544e7330bca)}}},
+  {{{ UINT64_C(0xff23f5a248276ba6), UINT64_C(0x36684af953ba3904), UINT64_C(0xc2a5a22732e1e3c2)}},
+   {{ UINT64_C(0xa479dddf27f2129e), UINT64_C(0x8d1abba1db228a73), UINT64_C(0xeaf759eb1aa3ca2d)}}},
+  {{{ UINT64_C(0x5ec113c92b947c69), UINT64_C(0x3194c7a92e4af4f3), UINT64_C(0x9a9fb28050e3f2ae)}},
+   {{ UINT64_C(0xd38fdea3e084bde2), UINT64_C(0x8336e924b9f4be0c), UINT64_C(0xedaa7349022ea85e)}}},
+  {{{ UINT64_C(0x7cac5c63dfa3b381), UINT64_C(0x93f522f53aacd8ad), UINT64_C(0x511d502e46da19f9)}},
+   {{ UINT64_C(0x6b51c1d8dcae4078), UINT64_C(0x009344523725cf01), UINT64_C(0x2b6b4e97f7c53942)}}},
+  {{{ UINT64_C(0xdbd0241900c620c8), UINT64_C(0xb1e375c59827c0f2), UINT64_C(0x1dea1e5b1e948c59)}},
+   {{ UINT64_C(0xc7098a08279bd2be), UINT64_C(0xa8405619d2b29931), UINT64_C(0x0bd8a669c92d8e6c)}}},
+  {{{ UINT64_C(0xe1373a8b7e6983b3), UINT64_C(0x619cb6cfb2bd51f2), UINT64_C(0x1dfd3250df041aa7)}},
+   {{ UINT64_C(0xddac0f2d524fd6e6), UINT64_C(0xef4bcada3ef67ab9), UINT64_C(0xf2341442a7641653)}}},
+  {{{ UINT64_C(0x038d5a645113420f), UINT64_C(0x925a0d8edb7c7e14), UINT64_C(0xe0594f96593b0e02)}},
+   {{ UINT64_C(0x5675c6997ddc3655), UINT64_C(0x42a893624f94b6d2), UINT64_C(0x03a37af4cb7ae096)}}},
+  {{{ UINT64_C(0x846b605e09c5ff55), UINT64_C(0x68e9de2320361c5f), UINT64_C(0x21db535a07d0bbae)}},
+   {{ UINT64_C(0x79f290be0e32c595), UINT64_C(0xd5ac6758323ea1dc), UINT64_C(0xefc8835d6c6e19ba)}}},
+};
+
+static const mzd_row192x2_t LK_1[] = {
+  {{{ UINT64_C(0x44fc0f57d887c3fa), UINT64_C(0x481495d2da5f3c04), UINT64_C(0x8ed5ba66172c39e9)}},
+   {{ UINT64_C(0x8739d65b6b977e02), UINT64_C(0xde394bac13c9eaa9), UINT64_C(0x53fee3d81b3a0934)}}},
+  {{{ UINT64_C(0xf7c334185b9b0fa2), UINT64_C(0xee0ea8268d4b3428), UINT64_C(0xb1d6d4d22edfb82b)}},
+   {{ UINT64_C(0x584848fee002bc02), UINT64_C(0x8428de93c94367a4), UINT64_C(0x26a69b85918178dd)}}},
+  {{{ UINT64_C(0x18579b5c37334162), UINT64_C(0x71e2a7a727d5ebb1), UINT64_C(0x0a3f7a40fd5a76b0)}},
+   {{ UINT64_C(0xa43131dfce44dad4), UINT64_C(0x938b3f6c41558468), UINT64_C(0x0a3a757e3180d18b)}}},
+  {{{ UINT64_C(0x4555874124d0e6de), UINT64_C(0x62cd5472e92a76d4), UINT64_C(0x6c82c5f572f2b29c)}},
+   {{ UINT64_C(0x9eed9189ab8a0943), UINT64_C(0xc8d0d7a96316d7cd), UINT64_C(0xe2fcb450d9278207)}}},
+  {{{ UINT64_C(0xdca7132be2eb41bf), UINT64_C(0xbdf202ba8c97c1e4), UINT64_C(0x3a790fc79544adc7)}},
+   {{ UINT64_C(0x5c720f3e0c024876), UINT64_C(0x8a018544b4706fbe), UINT64_C(0xc835a56a14875fdf)}}},
+  {{{ UINT64_C(0x6af0abdcee73f298), UINT64_C(0x48a2c1219efb2d25), UINT64_C(0xdfa9e99e1657bbd8)}},
+   {{ UINT64_C(0xe25215963ec1219c), UINT64_C(0xcb9d4aa72b400f4c), UINT64_C(0x35e24c1f00f8f7ec)}}},
+  {{{ UINT64_C(0x12c6b564cd4b07e2), UINT64_C(0xcaf15cc0aaacda24), UINT64_C(0x16d1362853975b02)}},
+   {{ UINT64_C(0x9071433ac0551e3f), UINT64_C(0x6ba1f6c3b626ca33), UINT64_C(0xf120fb7de11289df)}}},
+  {{{ UINT64_C(0xe3d87c4a3acfe131), UINT64_C(0x6afc534368000d1c), UINT64_C(0x485a1b88ad3982ba)}},
+   {{ UINT64_C(0xc992f31cb9f45b5a), UINT64_C(0xfbdb4c23cc7c0a14), UINT64_C(0x3f8dd1e26d8a5774)}}},
+  {{{ UINT64_C(0xdbd9c98607f0dcd3), UINT64_C(0x5fc775b7ff377715), UINT64_C(0xbbae9d99893cd043)}},
+   {{ UINT64_C(0x5ec3400bcab26eaa), UINT64_C(0x9e5d9da7d344b62b), UINT64_C(0x6fba1f21d7fd73de)}}},
+  {{{ UINT64_C(0x513afd8a8076ca63), UINT64_C(0x2d31557de521d155), UINT64_C(0x89bddaf4b27be64e)}},
+   {{ UINT64_C(0xf089c18aaa841693), UINT64_C(0x3c0e7d8886ccd7ab), UINT64_C(0x39b2ec874081ffb3)}}},
+  {{{ UINT64_C(0x12ea1bd0966c6983), UINT64_C(0x6b548eee869c3377), UINT64_C(0xa25eec7b7c1ba8b4)}},
+   {{ UINT64_C(0x960ac8d24642b9b4), UINT64_C(0x8c9d7ac6c9209540), UINT64_C(0xdac5def9c5f8cac6)}}},
+  {{{ UINT64_C(0xc8b1680e4f279341), UINT64_C(0x3c7fc5bf209a9b9c), UINT64_C(0x2dd83be4849cc05a)}},
+   {{ UINT64_C(0xbb343d1228aaea4c), UINT64_C(0x2631164e147343a9), UINT64_C(0x655d34e8f3cd6c93)}}},
+  {{{ UINT64_C(0x22cdb3b02faa3cca), UINT64_C(0xb6370d67f9d4c135), UINT64_C(0x2bcfcfa80120cc17)}},
+   {{ UINT64_C(0x8eb52a89bf18cc63), UINT64_C(0xc7ca830b3180a5fb), UINT64_C(0xb728114acbf95028)}}},
+  {{{ UINT64_C(0x13203cfde168fae7), UINT64_C(0x562f173cc400ed7c), UINT64_C(0x7c7cc8095d5f0330)}},
+   {{ UINT64_C(0x5066692780ac649d), UINT64_C(0x7e2f7e53c01d8dd0), UINT64_C(0xb9fd66599973d82d)}}},
+  {{{ UINT64_C(0x3feaa120be6b6055), UINT64_C(0x1471ac7a4bea6158), UINT64_C(0xa806c4d1b11c18d3)}},
+   {{ UINT64_C(0x8db0deeaf08e151a), UINT64_C(0x16d126f6d8badc77), UINT64_C(0xe076be04e50e4f13)}}},
+  {{{ UINT64_C(0x0643954677294764), UINT64_C(0x995f85625e0d6172), UINT64_C(0x4413b5bb3367b9cc)}},
+   {{ UINT64_C(0x0731aa60ffe7fb0b), UINT64_C(0x67904e7d69c4dc78), UINT64_C(0xcfb5afbe503718a7)}}},
+  {{{ UINT64_C(0x1ff8833a8f14d816), UINT64_C(0x20ea772310eb776b), UINT64_C(0x44ed3f10eb2c022e)}},
+   {{ UINT64_C(0x21d20779465c3373), UINT64_C(0x40a076ab4410ffe7), UINT64_C(0xde18f696af687735)}}},
+  {{{ UINT64_C(0xf8f49267de58fddf), UINT64_C(0xc372f49ceb221cfb), UINT64_C(0x61af0b3053d98bcf)}},
+   {{ UINT64_C(0x954ec3413015d3e7), UINT64_C(0xbbaec6f274565e98), UINT64_C(0xac8b93b9a2634a45)}}},
+  {{{ UINT64_C(0xca2f1ed11f3e799b), UINT64_C(0x5914c1ba17763991), UINT64_C(0xa3546ef397947b7b)}},
+   {{ UINT64_C(0xace17fbfc603e4e5), UINT64_C(0x8290a43e6ae98317), UINT64_C(0xd4d4557e493766a3)}}},
+  {{{ UINT64_C(0xc1b3dcc37dadc345), UINT64_C(0x1c24a7c84c232977), UINT64_C(0xef1ef5f02235f2f7)}},
+   {{ UINT64_C(0x2e80116ca186f6be), UINT64_C(0xe950d52f9058e7fe), UINT64_C(0xd9d28f9d1b484d88)}}},
+  {{{ UINT64_C(0x84ed53e21f3cdbf3), UINT64_C(0x057d3b1125bb29ea), UINT64_C(0xc15abe1df9e16677)}},
+   {{ UINT64_C(0x32072b233e36ee07), UINT64_C(0x0c122c79179ce66b), UINT64_C(0x342506068666ce02)}}},
+  {{{ UINT64_C(0x4edfae6ff387bc02), UINT64_C(0xf6994e881eea39e6), UINT64_C(0x21bb310b9dc896db)}},
+   {{ UINT64_C(0xdb6a7ee5a29285b2), UINT64_C(0x99bbd769f194b61b), UINT64_C(0x1b051e986f00ae0d)}}},
+  {{{ UINT64_C(0xde0408e27d15b58b), UINT64_C(0x595e9d09d150bdd5), UINT64_C(0x389195d88f10d170)}},
+   {{ UINT64_C(0x328cf03433e356fb), UINT64_C(0x561a1320a9762234), UINT64_C(0xabb659fe7012866a)}}},
+  {{{ UINT64_C(0x1782cc09a0b21252), UINT64_C(0xac3822b55cae9f75), UINT64_C(0x1b9b12693ff92c0c)}},
+   {{ UINT64_C(0xf0caae77fd26b16f), UINT64_C(0x29281232b2edaaab), UINT64_C(0x998341fbf4447778)}}},
+  {{{ UINT64_C(0xaee63a75487ccc67), UINT64_C(0x26a0d8fb198c8054), UINT64_C(0xa66fe37ada4dbc5b)}},
+   {{ UINT64_C(0xf5e55f2463902885), UINT64_C(0xef973525b4f792d8), UINT64_C(0xda165be81f966fe8)}}},
+  {{{ UINT64_C(0xdfbadae264f24148), UINT64_C(0x7e84d487ddf27340), UINT64_C(0xc34762727023ab83)}},
+   {{ UINT64_C(0x93a00952445b798c), UINT64_C(0xc15e5e00eb2df8e9), UINT64_C(0x752de43c8d32eb73)}}},
+  {{{ UINT64_C(0x11cb770fcb14951e), UINT64_C(0x5cd360654b5862cc), UINT64_C(0x80615617eae29103)}},
+   {{ UINT64_C(0xa93eede5cab2840b), UINT64_C(0x6780f6d3a5a181d2), UINT64_C(0x4d7bb37fba5489c8)}}},
+  {{{ UINT64_C(0x11348e22b7e7cf45), UINT64_C(0x02fedcf1a2c1e5f4), UINT64_C(0x448f8d90bd676a69)}},
+   {{ UINT64_C(0x30071f54f2cb1bf5), UINT64_C(0x998e04b45f9ceb73), UINT64_C(0x09d1d75ef711a5a6)}}},
+  {{{ UINT64_C(0xf0aa762c4134f4e4), UINT64_C(0x299f7bd3e9b41ab1), UINT64_C(0xc0481bc4764cf984)}},
+   {{ UINT64_C(0x1c68c78d6bf96d06), UINT64_C(0x77fd20becefe9eb0), UINT64_C(0xc253c35fafe22ac3)}}},
+  {{{ UINT64_C(0x09078b94d96cb513), UINT64_C(0x8b69b1dde0f24baa), UINT64_C(0xa8d0eb4bbab445d2)}},
+   {{ UINT64_C(0x6aab6e799ae51d30), UINT64_C(0x6129366dabe03a92), UINT64_C(0xb80a0fdcf0670caa)}}},
+  {{{ UINT64_C(0xd5ab59577ee7f025), UINT64_C(0x591c239f609bd986), UINT64_C(0x643591ff15c464fd)}},
+   {{ UINT64_C(0x9485225001d71af8), UINT64_C(0xbc54f9d8a2cb3a3a), UINT64_C(0x3122637e9b969c82)}}},
+  {{{ UINT64_C(0x48728aebaaab3036), UINT64_C(0x4f987515b56a1de9), UINT64_C(0xa72e8abef533e245)}},
+   {{ UINT64_C(0x33ab64050029ef0a), UINT64_C(0xdf7690fc6b5a46c5), UINT64_C(0x1d5923e73f6c8914)}}},
+  {{{ UINT64_C(0xc867ce4ef3d04198), UINT64_C(0x6b1dd762faa9b3e0), UINT64_C(0x1186ff9b21d12595)}},
+   {{ UINT64_C(0xf026054413abc1be), UINT64_C(0x903e799205e70280), UINT64_C(0xe374e115e263d35e)}}},
+  {{{ UINT64_C(0x347a8a807d5616cc), UINT64_C(0x78f8306a999c4115), UINT64_C(0x0655fe01fa2714e1)}},
+   {{ UINT64_C(0xc544b14d05c5ecc5), UINT64_C(0xab19a239e947b9f3), UINT64_C(0xeb6f9cc3f17a8b90)}}},
+  {{{ UINT64_C(0xa5069b8936d32144), UINT64_C(0x671013620d63a5e9), UINT64_C(0xd1667ebc5f22c800)}},
+   {{ UINT64_C(0xce272eb86e209d0b), UINT64_C(0x22fb19658a917d40), UINT64_C(0x90be747b5f39ff17)}}},
+  {{{ UINT64_C(0x700778f125bb5a0d), UINT64_C(0xf6670db3fcaf2f06), UINT64_C(0x7b562f35bf27b29d)}},
+   {{ UINT64_C(0xe4d3961654e3520c), UINT64_C(0x6901a40262b73b21), UINT64_C(0x6905d5b9f5de72c9)}}},
+  {{{ UINT64_C(0xbdd22c8877157bba), UINT64_C(0x41385f858cc4a0f7), UINT64_C(0xe524ceb278e54415)}},
+   {{ UINT64_C(0x98a97dcb14ce2e28), UINT64_C(0x73b90e5ea3621381), UINT64_C(0xd047f9f523bc089c)}}},
+  {{{ UINT64_C(0x17541782b48617aa), UINT64_C(0x610fba4bab5eae49), UINT64_C(0x091aeb102bc0d8d7)}},
+   {{ UINT64_C(0xc2089acccd9b7d51), UINT64_C(0x51d95d974421252a), UINT64_C(0x0498ceae75cf626e)}}},
+  {{{ UINT64_C(0xbe00e2ce2d294534), UINT64_C(0x97d8dd744bffe4be), UINT64_C(0xc5ad6735950e3e82)}},
+   {{ UINT64_C(0x81d1e8295ec6a012), UINT64_C(0x832bcdb5376705d3), UINT64_C(0xfa1e9ae89cacdd17)}}},
+  {{{ UINT64_C(0x1862a61068fd9f9c), UINT64_C(0x29dec93ad8748a56), UINT64_C(0xf9d74991e422b2d9)}},
+   {{ UINT64_C(0x1ba07230961fd33f), UINT64_C(0xf3afc2c97674b7f6), UINT64_C(0xe15abf4fded9607c)}}},
+  {{{ UINT64_C(0xebb8bad4254c35da), UINT64_C(0x8f50861dca3abeb0), UINT64_C(0xad0678d24dfcfbc9)}},
+   {{ UINT64_C(0x42f6158396a798dd), UINT64_C(0xf234771f1d8ea7a5), UINT64_C(0xbc82ba1ef4f38a00)}}},
+  {{{ UINT64_C(0xdf89fa56b1bdd2da), UINT64_C(0x40830b08d76ba907), UINT64_C(0x9eb753b24f03baf8)}},
+   {{ UINT64_C(0xa37741b0a4e68ed9), UINT64_C(0x8e83f91db9b48c0e), UINT64_C(0x86fb6bb797c94a6b)}}},
+  {{{ UINT64_C(0xc57674b7e7040939), UINT64_C(0x727a2f2b0b9cc725), UINT64_C(0xee7e0bdc0e3adfa6)}},
+   {{ UINT64_C(0xb358db3464eadbf9), UINT64_C(0x2e0e4ecba33cbde5), UINT64_C(0x6066f3af4d002e7f)}}},
+  {{{ UINT64_C(0xe69de86da2f233a9), UINT64_C(0x3641b7f55da98e74), UINT64_C(0x081be6dc6489b0f1)}},
+   {{ UINT64_C(0x7711abca9dcb1380), UINT64_C(0x29f57b29591f0b3a), UINT64_C(0xaf810c6a4dde8e9b)}}},
+  {{{ UINT64_C(0xf6854e29013340e4), UINT64_C(0x62f7ebf8157b84c6), UINT64_C(0xff61ab111e64e817)}},
+   {{ UINT64_C(0x6dc548fb07b6c9f7), UINT64_C(0x41e6ec72f395c9ab), UINT64_C(0x04fe5b3b37dc433d)}}},
+  {{{ UINT64_C(0x5b9c6518e4bfb331), UINT64_C(0xd899b9e3bbf23980), UINT64_C(0xb94419baeeca5178)}},
+   {{ UINT64_C(0x5e8dfddcf247d132), UINT64_C(0xbcbe7777c359d4e8), UINT64_C(0x8808e2c2e847cbbc)}}},
+  {{{ UINT64_C(0xd178848f812ffb25), UINT64_C(0xce04a91a181e7f54), UINT64_C(0x8d6de6ceb52f8e26)}},
+   {{ UINT64_C(0xb296892f8ba89a9f), UINT64_C(0x23161f740625eaec), UINT64_C(0x2d53246e27fc5583)}}},
+  {{{ UINT64_C(0x419c291a7a6cdae8), UINT64_C(0x54783a16953d64c2), UINT64_C(0x5b2f1c2c829d13f6)}},
+   {{ UINT64_C(0x691095d222502491), UINT64_C(0x5bc0797164cc010a), UINT64_C(0xdb8ccedb882e8383)}}},
+  {{{ UINT64_C(0xbb41764e009344bf), UINT64_C(0x9bb907dffc0cbf79), UINT64_C(0xde9702f22f067d49)}},
+   {{ UINT64_C(0x9efdb5505b0ecd27), UINT64_C(0xcd7b33d635f3dbd9), UINT64_C(0x905a0982fc915d3d)}}},
+  {{{ UINT64_C(0xb69abbfe97f61e93), UINT64_C(0x491d5ea1b794c798), UINT64_C(0xce6dfe162594bc12)}},
+   {{ UINT64_C(0x422258db70d2af34), UINT64_C(0xa6c17dd8d9b3eaa7), UINT64_C(0x448b148bcac2d8e4)}}},
+  {{{ UINT64_C(0x38aff69c36e3afc4), UINT64_C(0x7b7bf1f52bd03087), UINT64_C(0xdb56fb9362322d70)}},
+   {{ UINT64_C(0xb83166c9c83b0109), UINT64_C(0xe61d31951e929fbd), UINT64_C(0x8c853d2da6c4f224)}}},
+  {{{ UINT64_C(0x54f4d9004168ba30), UINT64_C(0x11caf292f6353ea1), UINT64_C(0x57034106053621e4)}},
+   {{ UINT64_C(0x71d2508f68bcf5a9), UINT64_C(0x583927083c47b225), UINT64_C(0x354c6450eb75a442)}}},
+  {{{ UINT64_C(0xb7d952649df80fc3), UINT64_C(0xdd1bb8078dc784c8), UINT64_C(0xb7ede4891f1a8440)}},
+   {{ UINT64_C(0xec0ecbfe83575705), UINT64_C(0xc1dbb8ec19331d77), UINT64_C(0xe10c239af952c4fe)}}},
+  {{{ UINT64_C(0x3987153bca465ee7), UINT64_C(0x3c11a10333ffd9ff), UINT64_C(0x4bf82f9410092f73)}},
+   {{ UINT64_C(0x6f1a6051037ff538), UINT64_C(0xa26c4b1e9f361090), UINT64_C(0xd1021c0d2cf2fce3)}}},
+  {{{ UINT64_C(0xbf33cfea0bbe28a2), UINT64_C(0x2029fe061d37cc87), UINT64_C(0xff2e4b2802dfe4ad)}},
+   {{ UINT64_C(0xd1fe5d8cfc26845e), UINT64_C(0x9ab3b72303eb4c00), UINT64_C(0xf29a5833d3fbf5fe)}}},
+  {{{ UINT64_C(0x33fb2ac337e27c38), UINT64_C(0x3d2c7f3197b76dcf), UINT64_C(0xd36f2ea4b20c07f7)}},
+   {{ UINT64_C(0x8626c85b9e6c5e74), UINT64_C(0x203f969783f32d78), UINT64_C(0x4c236289e7f7f520)}}},
+  {{{ UINT64_C(0x61f30aa9eb2bb952), UINT64_C(0x2912142837ef607b), UINT64_C(0x7c99b982cdaad1b0)}},
+   {{ UINT64_C(0x95581375774c957b), UINT64_C(0xdb3776eb3db09264), UINT64_C(0x2b3c5df4fb8d2b74)}}},
+  {{{ UINT64_C(0x7314040a00517797), UINT64_C(0xadd8345337a79b75), UINT64_C(0x46415e34f6ea71ba)}},
+   {{ UINT64_C(0xcfc8b7c0ce5f0d0b), UINT64_C(0xe6385b33d629e763), UINT64_C(0xd5112fe6b4a5ee72)}}},
+  {{{ UINT64_C(0x9af9f90b03ab6a8e), UINT64_C(0x970b435e79798f54), UINT64_C(0x5987c806576404f4)}},
+   {{ UINT64_C(0x280368d966a0beac), UINT64_C(0x45361b4730abf6ea), UINT64_C(0x602f3a46e6d97a2c)}}},
+  {{{ UINT64_C(0x4a29e0981124069d), UINT64_C(0xcc9cd9f14e3dd3a8), UINT64_C(0x424990d7a30c26c1)}},
+   {{ UINT64_C(0x90b8bad8d464be7e), UINT64_C(0x3f6ae3b417740755), UINT64_C(0x0b196b516953eed6)}}},
+  {{{ UINT64_C(0x83fa94e3525dd0d2), UINT64_C(0xfde1b918ba3e21c4), UINT64_C(0x12b871573b48bb57)}},
+   {{ UINT64_C(0x9b55de8a1b5321cf), UINT64_C(0x057bb3d347682101), UINT64_C(0x34004ee544526865)}}},
+  {{{ UINT64_C(0x3d5e390d559870bc), UINT64_C(0xf636fa6778200c50), UINT64_C(0xbebc5b6c8add85e4)}},
+   {{ UINT64_C(0x60d22116912c2088), UINT64_C(0x73d09e53c6a364c6), UINT64_C(0xd4633c48b0858390)}}},
+  {{{ UINT64_C(0xf3388e2a7b2481df), UINT64_C(0x206ad2a5d60c575a), UINT64_C(0x95f2a0c19c59b2bc)}},
+   {{ UINT64_C(0xb22d328acaf240d0), UINT64_C(0xe28fde69f58b77f5), UINT64_C(0x1d7393bd17daa42e)}}},
+  {{{ UINT64_C(0x080bef799be2e859), UINT64_C(0x6d3704e42411abab), UINT64_C(0xf3093903e9ac0bab)}},
+   {{ UINT64_C(0xca29fc5a302e3b4a), UINT64_C(0x0abad0a503e913b2), UINT64_C(0xbeb1f84ab1d1cf7c)}}},
+  {{{ UINT64_C(0xcd7b86414d5f741d), UINT64_C(0xf38b6a66b95d93fb), UINT64_C(0x1b3e738c0c2e295a)}},
+   {{ UINT64_C(0xe3d69ad945cdefe7), UINT64_C(0x776a100dc7ed0a7d), UINT64_C(0x7e17771b590de9b3)}}},
+  {{{ UINT64_C(0x9691cadc38125765), UINT64_C(0x496f4d7484fb50c4), UINT64_C(0x7fd772c899bf561b)}},
+   {{ UINT64_C(0x9c051e3da16fe11c), UINT64_C(0x352f9b68ce3de2d4), UINT64_C(0x6bf18d418f9fa76a)}}},
+  {{{ UINT64_C(0x696241b90a4c2e7c), UINT64_C(0x768693805ac023e1), UINT64_C(0x19c3d4229e54aff8)}},
+   {{ UINT64_C(0x06a83ca926357ccd), UINT64_C(0x4b9c0d74488eda89), UINT64_C(0x9c6165ab60afbb5a)}}},
+  {{{ UINT64_C(0xd5b3b07571a46818), UINT64_C(0xdc6433891eb40d84), UINT64_C(0x9ec4151d228669a2)}},
+   {{ UINT64_C(0xf453ad36dc56c551), UINT64_C(0x72eb2502cfdb963d), UINT64_C(0xf0ce0922546e1bf1)}}},
+  {{{ UINT64_C(0x93b8ccb894eefcac), UINT64_C(0xc7b0fd6b34dedcec), UINT64_C(0xf81ca0456a170d2b)}},
+   {{ UINT64_C(0xda0ea9510265f6bf), UINT64_C(0x386e1a7ec0bc514f), UINT64_C(0xaf6d4641c8aff024)}}},
+  {{{ UINT64_C(0x264abc3f3b652a8f), UINT64_C(0x81e98132111d241f), UINT64_C(0x0b80cd73ae3133ae)}},
+   {{ UINT64_C(0x0537521fc691bc4b), UINT64_C(0x0d3ca606a5b8a573), UINT64_C(0x64071f9a4f543376)}}},
+  {{{ UINT64_C(0x503cf0893c82de63), UINT64_C(0x3dcf15308ba89ca0), UINT64_C(0x332db6492673e397)}},
+   {{ UINT64_C(0x7206380d425ea2e8), UINT64_C(0xd4288880e06b5bfa), UINT64_C(0x30267b2508f7545f)}}},
+  {{{ UINT64_C(0x2c16361ac7dad7c4), UINT64_C(0xdf4644fb86bf760a), UINT64_C(0x54aa17bb76233f92)}},
+   {{ UINT64_C(0x74317834dc57d774), UINT64_C(0xbfdaf9bd7b77ccf1), UINT64_C(0x9250bd9e12d37661)}}},
+  {{{ UINT64_C(0x7a84474e61fb8c7b), UINT64_C(0xa87946a8fc2b00d6), UINT64_C(0x435fa5358bca85db)}},
+   {{ UINT64_C(0xca7133780f5df51e), UINT64_C(0xf5f2fe829a9f2890), UINT64_C(0x0c8a0aa51e4bfa3d)}}},
+  {{{ UINT64_C(0xb4f308073a4b315b), UINT64_C(0x9b21a582649757a7), UINT64_C(0x3c734e6ff73a75ab)}},
+   {{ UINT64_C(0x3f90f6049dd95381), UINT64_C(0x0947558bd9695c62), UINT64_C(0xf636c7c7a4e15f0b)}}},
+  {{{ UINT64_C(0x5511c90a5c7ef270), UINT64_C(0x517ad966fcb4bebc), UINT64_C(0x9c66817de129b173)}},
+   {{ UINT64_C(0x942c19c39bf470c5), UINT64_C(0x2ea11fa0e93de281), UINT64_C(0x4d9b72019872e96b)}}},
+  {{{ UINT64_C(0x8c1e596f62296e8c), UINT64_C(0x47eb3c83d3298f98), UINT64_C(0x1bdc0e0ae02a8f94)}},
+   {{ UINT64_C(0xb561e77481eb073c), UINT64_C(0xda05a9e3545e887e), UINT64_C(0xcc4dc4edd9e0408a)}}},
+  {{{ UINT64_C(0x7b33f0d783c0b85c), UINT64_C(0x34e22047fc9153bc), UINT64_C(0xdce1b6fa6755fc1d)}},
+   {{ UINT64_C(0x03af82818ea4abea), UINT64_C(0xe8a7fede1c00e7e5), UINT64_C(0x946ae207296e87f3)}}},
+  {{{ UINT64_C(0x93fdc135d7f59d76), UINT64_C(0x8aa8f33e4a323e25), UINT64_C(0x7ef5fc1c6a2d98c5)}},
+   {{ UINT64_C(0xcccf2a0e9056df56), UINT64_C(0x893a2d5e4e9be6a0), UINT64_C(0xb850c48e5223e7d9)}}},
+  {{{ UINT64_C(0x42727d2c7fcc7af2), UINT64_C(0x4c50aa7137961299), UINT64_C(0x9cbd95617abb2661)}},
+   {{ UINT64_C(0x5e8f73e1acbc5f17), UINT64_C(0x8991941d4a8bde41), UINT64_C(0xbb8e890a7b230a9b)}}},
+  {{{ UINT64_C(0x2db4e0221cacbf4c), UINT64_C(0x12235212dcf40861), UINT64_C(0x1a24fed97403a4e9)}},
+   {{ UINT64_C(0x7fdf2c041fc65deb), UINT64_C(0xbcd1cd5d1c38f9e3), UINT64_C(0x875c3c86ba6fe472)}}},
+  {{{ UINT64_C(0x16a536ab6fd74161), UINT64_C(0xd1cfc162030eefac), UINT64_C(0x09254fc5f6edc59a)}},
+   {{ UINT64_C(0x03fc1041c0dd5136), UINT64_C(0x282ae54eaf6bf52b), UINT64_C(0x2ececce947188c00)}}},
+  {{{ UINT64_C(0xfe3de59891fe9398), UINT64_C(0x89ea5d2ee53249e5), UINT64_C(0x24fd5a3ff23d35d9)}},
+   {{ UINT64_C(0xcf2bb96539a5cdb1), UINT64_C(0x01dc9fd9e47141af), UINT64_C(0xc9c663b7967ef7c0)}}},
+  {{{ UINT64_C(0xae7ca216799248b1), UINT64_C(0x71d2b175dfc154dc), UINT64_C(0x2e6b2ebb1e17fdae)}},
+   {{ UINT64_C(0x41162273ba9a3c10), UINT64_C(0x814a5df1b3e37f94), UINT64_C(0xc943da3b1a8e8573)}}},
+  {{{ UINT64_C(0xefad60fd4599de92), UINT64_C(0x7170416741e5d5f4), UINT64_C(0xd40a74186e7c41b5)}},
+   {{ UINT64_C(0x2040ecd0e7225dcd), UINT64_C(0x72f6daaa298ec108), UINT64_C(0x2c0212a8530e4aff)}}},
+  {{{ UINT64_C(0xe13454fd76b25473), UINT64_C(0x171ab889391c9c25), UINT64_C(0x456fbb0b91741f83)}},
+   {{ UINT64_C(0xb524fa62adc6fae3), UINT64_C(0x50a34e879c223701), UINT64_C(0x3720480166cae044)}}},
+  {{{ UINT64_C(0x2fbc972267f3a250), UINT64_C(0x079f6f795431eaa9), UINT64_C(0x32a88ff822c1e77c)}},
+   {{ UINT64_C(0x5fc6ff3a5e9e39d8), UINT64_C(0x136220899552b62a), UINT64_C(0x8b5b22889b02a333)}}},
+  {{{ UINT64_C(0x2526dd8caa2cd288), UINT64_C(0x565131d79036bdcf), UINT64_C(0x9528120ef534d9ce)}},
+   {{ UINT64_C(0xe326136cb4b05f0f), UINT64_C(0x077a7efe29d2ad68), UINT64_C(0xb54dcc6ac204960e)}}},
+  {{{ UINT64_C(0xb8fdb2e249e8f626), UINT64_C(0x6aa574b123897c94), UINT64_C(0x8fdf6fce7841eb08)}},
+   {{ UINT64_C(0x4f91771f9eca96f9), UINT64_C(0xa0613c9265ad976e), UINT64_C(0x62001cfa57373412)}}},
+  {{{ UINT64_C(0xc6c0d0020fb304d5), UINT64_C(0xfe0dfe0e5f78a56a), UINT64_C(0x75a6423da2c04258)}},
+   {{ UINT64_C(0x1e545b46778afc38), UINT64_C(0xc50b3a49779fc780), UINT64_C(0xefa29d0a7dbe4d28)}}},
+  {{{ UINT64_C(0x718c189377ed924a), UINT64_C(0xc8aaa1a19e716f6a), UINT64_C(0x415f87db95db609b)}},
+   {{ UINT64_C(0x34f2c91727499b85), UINT64_C(0xdd387b16324634f5), UINT64_C(0xa33a6cbf02150228)}}},
+  {{{ UINT64_C(0xe9632f190e9c8963), UINT64_C(0x1771b6ea2835f36a), UINT64_C(0x6bbbb0d2b5ebe69b)}},
+   {{ UINT64_C(0x3eb3d8365d3c82ec), UINT64_C(0x148b9f8fb0c83d90), UINT64_C(0x8f82a40d42e5425b)}}},
+  {{{ UINT64_C(0xde6e5f3cc28a159c), UINT64_C(0x4b99fd44cb3d90af), UINT64_C(0x21d2293e7d5b9096)}},
+   {{ UINT64_C(0xbb08f92b73927ffa), UINT64_C(0x77ed4da2d2359ec1), UINT64_C(0xe3e7bf8e6c750f8d)}}},
+  {{{ UINT64_C(0xa57b49bda62fce4a), UINT64_C(0x628870fa6e18e542), UINT64_C(0x146811168d0b016c)}},
+   {{ UINT64_C(0xdad178dfaa795576), UINT64_C(0x3866815909d5a35b), UINT64_C(0xd237b8a25bbfd125)}}},
+  {{{ UINT64_C(0x7bc6973f95741a4c), UINT64_C(0xd1df2503247231e2), UINT64_C(0x658b6e394011866b)}},
+   {{ UINT64_C(0x42933ea0a02db68c), UINT64_C(0xb719749d27c3bd5b), UINT64_C(0xd50071bbc6ae1b05)}}},
+  {{{ UINT64_C(0x65285ddd3aa69712), UINT64_C(0xd5b1ab21b0dfe21c), UINT64_C(0xc837c9b00dbac206)}},
+   {{ UINT64_C(0x7b60e768f34aa317), UINT64_C(0xc135dc51a4e0bb70), UINT64_C(0x347b2a3f915f32fd)}}},
+  {{{ UINT64_C(0x71d0c9cfb1c6bf3e), UINT64_C(0x9c5ce30636e57d8d), UINT64_C(0xb8ca088d8c718ec3)}},
+   {{ UINT64_C(0x01e3839e9f2bb352), UINT64_C(0x02f657484821c5c0), UINT64_C(0xda5af7598684f39f)}}},
+  {{{ UINT64_C(0x2892c14f81d8ed97), UINT64_C(0xab096ecce6469ba0), UINT64_C(0xcb52e913132dc62d)}},
+   {{ UINT64_C(0xd9285e77c3011871), UINT64_C(0x67e5f379a84f145a), UINT64_C(0x799bd4be2bb54d07)}}},
+  {{{ UINT64_C(0x369cb865c087340e), UINT64_C(0x0edb76097607b996), UINT64_C(0x78fc8467bfc777a2)}},
+   {{ UINT64_C(0xb7703bfe900ccb8f), UINT64_C(0xa41489681f6a99bb), UINT64_C(0x6fa76a50b6555b93)}}},
+  {{{ UINT64_C(0xa5b368472580d1c7), UINT64_C(0xd2a78eb5bf0f1b77), UINT64_C(0xb0a78743bc95ce45)}},
+   {{ UINT64_C(0xe735c402f57ca35a), UINT64_C(0xc1e34a3b59fd5cab), UINT64_C(0x095ba369c29a9218)}}},
+  {{{ UINT64_C(0xa55f30bdfa65e0b5), UINT64_C(0x01727acba6ba5695), UINT64_C(0x452b2400c06a029d)}},
+   {{ UINT64_C(0xe0eb25031e43bf18), UINT64_C(0xf6fcb64b2e204bcf), UINT64_C(0xc8aa611fa0e2c208)}}},
+  {{{ UINT64_C(0x3ce4ad9116fb6eb3), UINT64_C(0x055b68e3522b7bec), UINT64_C(0x423c7fd17000f4d4)}},
+   {{ UINT64_C(0xf09bcef3577c1d6a), UINT64_C(0x1e1d5a528f07758a), UINT64_C(0xed7a299a3a64fca3)}}},
+  {{{ UINT64_C(0x914209c45baea6ce), UINT64_C(0x8733b5e90dd0eaf2), UINT64_C(0x6ae918af4fe51511)}},
+   {{ UINT64_C(0x864da0aec19c1bdc), UINT64_C(0x21db1e2fc22d9879), UINT64_C(0xfb78903f4f0ac892)}}},
+  {{{ UINT64_C(0xd7f61e7ec026077a), UINT64_C(0x69eb9ab903cde511), UINT64_C(0x0cb7cda868670f31)}},
+   {{ UINT64_C(0x761e7f2918343540), UINT64_C(0xee9011560fc85abb), UINT64_C(0xfd84ed40f6bd37c3)}}},
+  {{{ UINT64_C(0x777dfa397c0850ee), UINT64_C(0x37c9d6bba4143256), UINT64_C(0x390af3983c6692d6)}},
+   {{ UINT64_C(0x3b08f56c7ffac5ac), UINT64_C(0x4a952bb26fd94c7e), UINT64_C(0xfc98334aa02258e5)}}},
+  {{{ UINT64_C(0x3c2612989c1ac199), UINT64_C(0xf2ce0cfec6e3a06a), UINT64_C(0x52dcd0e8db6e61f1)}},
+   {{ UINT64_C(0x4572dc0829bd6830), UINT64_C(0x10522e25d3a53163), UINT64_C(0xd7bb782ed7fd3735)}}},
+  {{{ UINT64_C(0xe219c80745d94459), UINT64_C(0xec85b2fb26a93c86), UINT64_C(0xb38e183213586071)}},
+   {{ UINT64_C(0x9b8c5e9ce722c4c3), UINT64_C(0xc08bc0ffb2f01279), UINT64_C(0x9c6841073a500a0a)}}},
+  {{{ UINT64_C(0x0f686f5491fddb00), UINT64_C(0x63667e9a7af94b6d), UINT64_C(0x4294f81aaa2a252a)}},
+   {{ UINT64_C(0x232d514aad1b2b83), UINT64_C(0x0b03a912951792b3), UINT64_C(0xfb0757019d979f31)}}},
+  {{{ UINT64_C(0xea2eb10b0393f4a9), UINT64_C(0x97216af9762f5ee2), UINT64_C(0xa4b56f770e9f6b5c)}},
+   {{ UINT64_C(0x5c5cc88a15114ca8), UINT64_C(0x86105b3cfd782eb7), UINT64_C(0xa9ab20ba4fb5c21d)}}},
+  {{{ UINT64_C(0x66f032afae224a69), UINT64_C(0x155897863c1bf95a), UINT64_C(0x1d9beb1ddc4395c7)}},
+   {{ UINT64_C(0x5e4919363377b780), UINT64_C(0x12c435dd6536c338), UINT64_C(0xa58868b1ddc2c5e7)}}},
+  {{{ UINT64_C(0x5cc758767df5e989), UINT64_C(0xd3508e8d13dfd3a2), UINT64_C(0xe7e0c61b49c42278)}},
+   {{ UINT64_C(0xbc4008779cc4c72c), UINT64_C(0xf1e6c1ea7c0f2f0b), UINT64_C(0x0e9cccda524d2586)}}},
+  {{{ UINT64_C(0x00e13e2e661f8c5e), UINT64_C(0x27b13e540f978572), UINT64_C(0x081495573161567e)}},
+   {{ UINT64_C(0xbf60814903dc9280), UINT64_C(0xdd01d8e7d13d3319), UINT64_C(0x51deb3d94b6b2f00)}}},
+  {{{ UINT64_C(0xb807f25433a483f4), UINT64_C(0xa25033f4ebed8c04), UINT64_C(0x212551eb42eed4e3)}},
+   {{ UINT64_C(0x82a87d422b30848c), UINT64_C(0x3cb2a26a4bf5d148), UINT64_C(0x19cb9948db95dc02)}}},
+  {{{ UINT64_C(0xd9801ceea4d9eae2), UINT64_C(0xbb8ae09f3bfde64c), UINT64_C(0xff4b65bbf41188cc)}},
+   {{ UINT64_C(0x4e42e435c4b6d914), UINT64_C(0x479013b5cb21c983), UINT64_C(0x75d365a7f6b025e1)}}},
+  {{{ UINT64_C(0x613d6f22e162754b), UINT64_C(0x2c112a23ecfe5d5b), UINT64_C(0x9056041767326f99)}},
+   {{ UINT64_C(0xef0785b092a4d486), UINT64_C(0xf1ed780716b59794), UINT64_C(0x114657ebf0c57b58)}}},
+  {{{ UINT64_C(0x40d74ffa235ba161), UINT64_C(0xc1d0901f2c5efe29), UINT64_C(0xcae37338e57e6aff)}},
+   {{ UINT64_C(0xb5076b89fb4224e1), UINT64_C(0x3fecf382fedf671d), UINT64_C(0xc3ca9dd1e081282f)}}},
+  {{{ UINT64_C(0x052de0edb1bf5bdd), UINT64_C(0xb6bdabc12e2d6d99), UINT64_C(0xbb509410f979f1a2)}},
+   {{ UINT64_C(0xe081f4db71f14992), UINT64_C(0x3bd9dd40d826f35c), UINT64_C(0x91f2e2876dd206e0)}}},
+  {{{ UINT64_C(0xf9e3d585e70fb733), UINT64_C(0x4710e1aa819a2636), UINT64_C(0xe7257887c5627f9a)}},
+   {{ UINT64_C(0x08957b81fd983474), UINT64_C(0xe2a55810c58a2745), UINT64_C(0x6fcdeef7ed9ffba3)}}},
+  {{{ UINT64_C(0x49f18a4947f825ec), UINT64_C(0xf4672e01482aa5d8), UINT64_C(0x1dc4b4272250b674)}},
+   {{ UINT64_C(0x838b8ea7ec643390), UINT64_C(0xf204941430bc3b1f), UINT64_C(0xba8b0c9e28008b86)}}},
+  {{{ UINT64_C(0x35a0cfc64f3936e3), UINT64_C(0x15983f898dbc76e0), UINT64_C(0xd043cecf46da22c4)}},
+   {{ UINT64_C(0x5c6dd2030cd29a86), UINT64_C(0x6d1f2f046495def4), UINT64_C(0x856165f1b0bdfef8)}}},
+  {{{ UINT64_C(0xa4da1849177be1c9), UINT64_C(0xd8e47abae3441109), UINT64_C(0x6e420c803d4ffcfa)}},
+   {{ UINT64_C(0x129453c27621cf7e), UINT64_C(0x4d22b636d8875957), UINT64_C(0xeb295e51dc42e2df)}}},
+  {{{ UINT64_C(0xa718a46cbe78788a), UINT64_C(0x79420c221a1e73ac), UINT64_C(0x02cbeb385eefd327)}},
+   {{ UINT64_C(0x331b349c8ddf7970), UINT64_C(0xd9b39617a580dead), UINT64_C(0x0c714e552c776256)}}},
+  {{{ UINT64_C(0xafc7d98c938d81eb), UINT64_C(0x1d2f02ecb72c374d), UINT64_C(0x43259477885452ec)}},
+   {{ UINT64_C(0xcc4e2301473f90b1), UINT64_C(0x0a4ab5c95cb5e1bf), UINT64_C(0x26a3d38bcb628920)}}},
+  {{{ UINT64_C(0x6b2cd313d4a3903f), UINT64_C(0xaa9e963abc109718), UINT64_C(0xd6229a76a3d27faf)}},
+   {{ UINT64_C(0x5c469821c9a7808e), UINT64_C(0xda5c03daf167ea44), UINT64_C(0xe06c712a36795b26)}}},
+  {{{ UINT64_C(0x9e4e04fa7a2b1973), UINT64_C(0xc6aba896e57bfbc2), UINT64_C(0x1ebcc94e971c80f7)}},
+   {{ UINT64_C(0x6a3b95fa2eb62e11), UINT64_C(0x60cebc438a4ea61c), UINT64_C(0x1d25264a3cdcb8c0)}}},
+  {{{ UINT64_C(0x50e6d1a4c062430b), UINT64_C(0xeea475ce2da46f1e), UINT64_C(0x9c5841cc59cdfa67)}},
+   {{ UINT64_C(0x55a48456d6d6a5f8), UINT64_C(0xdf46f0c9675ebf9c), UINT64_C(0xefefe628ca11efff)}}},
+  {{{ UINT64_C(0xa85c71bb62ba5dac), UINT64_C(0xbf53600bd8827db3), UINT64_C(0xc1c45ab4a546dd31)}},
+   {{ UINT64_C(0x56c68933ac3adb22), UINT64_C(0x436e87677da61ab7), UINT64_C(0x55eb50e27149334e)}}},
+  {{{ UINT64_C(0xa92d2c1eeff0d697), UINT64_C(0x4c55d825b3d87598), UINT64_C(0x449d8427266435ff)}},
+   {{ UINT64_C(0x55edeb7a6e45c066), UINT64_C(0xe6ed278413d54a8e), UINT64_C(0x08934eda60f9fb84)}}},
+  {{{ UINT64_C(0x4aba1df20210b1f3), UINT64_C(0x7126afb87f54dcd8), UINT64_C(0xbe71dcb78d4fa6b7)}},
+   {{ UINT64_C(0x99d1d3782301d6e1), UINT64_C(0x26ed888badc8bbc3), UINT64_C(0x0c4e42f52d078e42)}}},
+  {{{ UINT64_C(0xa62b07cf6a645bc5), UINT64_C(0x167ed60b1370eb23), UINT64_C(0xba769fe32847fc29)}},
+   {{ UINT64_C(0x53426f586dbf67d7), UINT64_C(0x4d8888233967b139), UINT64_C(0x1f7abf929b1123e7)}}},
+  {{{ UINT64_C(0xf2d320233ec64834), UINT64_C(0x4c9a3d5dbdacc81f), UINT64_C(0x05e79f3d2da6bdf4)}},
+   {{ UINT64_C(0x0413ff69cc875553), UINT64_C(0xc375491c3f7bdc05), UINT64_C(0xb3c0642456dbce7e)}}},
+  {{{ UINT64_C(0x54f1bac4aa0e156e), UINT64_C(0x0ccaebf9bb0d40d3), UINT64_C(0x2745ff207b2eb54a)}},
+   {{ UINT64_C(0xe1a0672c82d08ce0), UINT64_C(0x283452bc85623999), UINT64_C(0x273e756ca5043b1b)}}},
+  {{{ UINT64_C(0xe967dcad5c9d178c), UINT64_C(0x5598c6dc702c812e), UINT64_C(0x85a99e82b0c7774a)}},
+   {{ UINT64_C(0xadbc9ee98a45fb4e), UINT64_C(0x5cca52ae725236e2), UINT64_C(0xfe1c1526c519cab9)}}},
+  {{{ UINT64_C(0x42e431f0d7fb4364), UINT64_C(0x50592367d4359dd3), UINT64_C(0x5ef1a445a6477995)}},
+   {{ UINT64_C(0xcf87a6a13d807af6), UINT64_C(0x6a99c8e3fb316a0e), UINT64_C(0xaefb279e4ea4d5c9)}}},
+  {{{ UINT64_C(0x639743a229e98f45), UINT64_C(0x6742e2fb7f4d6c56), UINT64_C(0xe9872fe35a0a7f5f)}},
+   {{ UINT64_C(0x7b79893ff6c806ed), UINT64_C(0x406a9e70fe32e605), UINT64_C(0x9cab7f87e0be3ea5)}}},
+  {{{ UINT64_C(0x4c677b51eb191e17), UINT64_C(0x61dfbc6a92012bd0), UINT64_C(0x2d5fbe3ef1c1c60b)}},
+   {{ UINT64_C(0xe287e9e5d9aec316), UINT64_C(0x64a6a40e7fc8b465), UINT64_C(0x9c2c28477d87f255)}}},
+  {{{ UINT64_C(0x12828f8267a52f09), UINT64_C(0x5405940c780c4476), UINT64_C(0x21f661b0c98db387)}},
+   {{ UINT64_C(0xbca051bc16cd43e7), UINT64_C(0x0a68c68e8b0cc4c2), UINT64_C(0x8ffe34f6051615be)}}},
+  {{{ UINT64_C(0x2221b4a28d22a87e), UINT64_C(0x29e41ccde2352a4b), UINT64_C(0xb87bfe9e9e6edb53)}},
+   {{ UINT64_C(0x612b6aa78796a8e0), UINT64_C(0x0d9e40e7d4014bab), UINT64_C(0xdc56933c23daf737)}}},
+  {{{ UINT64_C(0x84c9b92097837578), UINT64_C(0x690a50b6c0f743bc), UINT64_C(0xb01ad770c209a64d)}},
+   {{ UINT64_C(0xb9edd04f6ef45bca), UINT64_C(0xd27583780431619a), UINT64_C(0xc44e82d49e4c03a8)}}},
+  {{{ UINT64_C(0x23024b43ceeabd06), UINT64_C(0x19c4e2bab30c21d0), UINT64_C(0x8ad785dd5a4639ab)}},
+   {{ UINT64_C(0x4e0fed38c29ebc3a), UINT64_C(0xf5b96cf4aac28be9), UINT64_C(0x274a246fbef9f7a8)}}},
+  {{{ UINT64_C(0x782fd908d7805fa2), UINT64_C(0xa8154bf7b47d67ac), UINT64_C(0x9ac61ce61e278b6f)}},
+   {{ UINT64_C(0x755ec02861584b93), UINT64_C(0x00af8a5769624739), UINT64_C(0x659602029b33f0b2)}}},
+  {{{ UINT64_C(0x6d62289b39a100ce), UINT64_C(0xcb176201a481bf57), UINT64_C(0xc3a344465666229e)}},
+   {{ UINT64_C(0xaa37c7c177f004f4), UINT64_C(0xbe375b6fb4411bd6), UINT64_C(0x5786fdd5cffd2bb3)}}},
+  {{{ UINT64_C(0x32c16bcdbe869324), UINT64_C(0x0848123f54abe7ca), UINT64_C(0x83dab71a07d1f5ca)}},
+   {{ UINT64_C(0x759df765c5cab487), UINT64_C(0x29983a98aa8174d0), UINT64_C(0x7d87494fbbaba425)}}},
+  {{{ UINT64_C(0x3a846e452606ddd8), UINT64_C(0xad884ccec10f0c5c), UINT64_C(0xee3254eb20927d18)}},
+   {{ UINT64_C(0x70f6f11221ee306d), UINT64_C(0x9f4aaaa977491498), UINT64_C(0x897ec0f4826bb88a)}}},
+  {{{ UINT64_C(0xca4bb1482f5def72), UINT64_C(0x129e09b28613404d), UINT64_C(0x9b4a799f29846195)}},
+   {{ UINT64_C(0xdd873a8f7ec7605b), UINT64_C(0xb19b95c025af0f00), UINT64_C(0x68f26b6939ec5438)}}},
+  {{{ UINT64_C(0xd34e3619d6121008), UINT64_C(0xc689282a37afe419), UINT64_C(0xeb8e8a4d110b1422)}},
+   {{ UINT64_C(0x20598d3c9c1b5b2c), UINT64_C(0x98aa83541d17d78f), UINT64_C(0x7367dde393359429)}}},
+  {{{ UINT64_C(0x81074baa712276c1), UINT64_C(0x70c383a317c0fd6c), UINT64_C(0x86e048182714ebd8)}},
+   {{ UINT64_C(0xb2c0c9a6c956e152), UINT64_C(0x826c359499517143), UINT64_C(0x213d886777d449a7)}}},
+  {{{ UINT64_C(0xb08af8832bbdc7d4), UINT64_C(0x5a65da16d414b73a), UINT64_C(0xef2e85e74491c5aa)}},
+   {{ UINT64_C(0x13e4ad5b7339fe9f), UINT64_C(0x9730df50af9a50a4), UINT64_C(0x9fa46a262bf6f850)}}},
+  {{{ UINT64_C(0xd4b394c7e2ff12e5), UINT64_C(0xa89645baadb3e230), UINT64_C(0xd61e5d007f40418a)}},
+   {{ UINT64_C(0xbfa36fdaa1cc044b), UINT64_C(0x66830f207da2a22d), UINT64_C(0x0e2e06a8ec5115db)}}},
+  {{{ UINT64_C(0x35bfa6df6c84cf8e), UINT64_C(0xa5ee8174fbaf7b60), UINT64_C(0x5138f8216bb09fd3)}},
+   {{ UINT64_C(0x24357622ae73fe64), UINT64_C(0x251821e9823fd6c1), UINT64_C(0x2a9e9f541ebdc738)}}},
+  {{{ UINT64_C(0x7165c321b5f18027), UINT64_C(0xfbc92719a28273cb), UINT64_C(0xed3f63eeae175661)}},
+   {{ UINT64_C(0x1797d45364be3c90), UINT64_C(0xff881b74b441a844), UINT64_C(0xc84981ed948834ef)}}},
+  {{{ UINT64_C(0x3beb09d691eeaddd), UINT64_C(0x309b6431d0d26e5c), UINT64_C(0x8f0842129e313bc1)}},
+   {{ UINT64_C(0x5c78c835d9936052), UINT64_C(0x1443860602030024), UINT64_C(0x9aa1493ce4f53fa4)}}},
+  {{{ UINT64_C(0x2cd4eeb216cf96e3), UINT64_C(0xab91b49201f0a9d9), UINT64_C(0xcaf5277dfc53c966)}},
+   {{ UINT64_C(0xcff9371e1dfc27fa), UINT64_C(0x1deb44454a4cdc78), UINT64_C(0xb3a84f8b170eb850)}}},
+  {{{ UINT64_C(0x3240e59cad316943), UINT64_C(0x4030748b146608bd), UINT64_C(0xfaffab9c4867ae1f)}},
+   {{ UINT64_C(0x7ee34dbe925532b8), UINT64_C(0xd86c167dcd9057f6), UINT64_C(0x90225cff11a0691c)}}},
+  {{{ UINT64_C(0xc41b5763de5ae3a8), UINT64_C(0xbb936d630d5eebaf), UINT64_C(0xc807dcf32f4fc041)}},
+   {{ UINT64_C(0x988168be5a234893), UINT64_C(0x51b60e64786f9fc6), UINT64_C(0x8557af1741a8819d)}}},
+  {{{ UINT64_C(0xaa73ff1ea52c2aa3), UINT64_C(0x50286e8dd5edadc9), UINT64_C(0x460e69cf6066668a)}},
+   {{ UINT64_C(0xb2e2dec122e39cb0), UINT64_C(0x5ad96b7d0fa311e1), UINT64_C(0x9f1307e621101ca8)}}},
+  {{{ UINT64_C(0x1f4b1c0fe84aeb7b), UINT64_C(0x3c47393595b25786), UINT64_C(0x09f5391e547ab395)}},
+   {{ UINT64_C(0x64680efebbb7b16e), UINT64_C(0x6fa6004ece920f3e), UINT64_C(0xd34193a3128f29df)}}},
+  {{{ UINT64_C(0xbc009cdb342a92c5), UINT64_C(0x461744b45fd6dab4), UINT64_C(0x2b49cb3afbf3dd11)}},
+   {{ UINT64_C(0x18e2c413fdbc1910), UINT64_C(0xe808b64fcdc06c4e), UINT64_C(0x48482dbd3934d74b)}}},
+  {{{ UINT64_C(0x2134e44e5549f5b0), UINT64_C(0xa18ef5402a28bce3), UINT64_C(0xb4c029356128fba6)}},
+   {{ UINT64_C(0xdec48903babe878e), UINT64_C(0xe5a30a7fa3384c5e), UINT64_C(0xd64df59dd73d432c)}}},
+  {{{ UINT64_C(0xa1983e90add3dbbe), UINT64_C(0x8b48c171a4a13730), UINT64_C(0x1507e8c94d84d0bd)}},
+   {{ UINT64_C(0x18739bbdc5fe09ea), UINT64_C(0xf93aba64d7ed87bc), UINT64_C(0xaf620ff7c7357f6d)}}},
+  {{{ UINT64_C(0x89005c87114392bf), UINT64_C(0xcedfe0e63e8af42d), UINT64_C(0xc620cbb407b151b2)}},
+   {{ UINT64_C(0x9c72353435b1dfe0), UINT64_C(0x930169f8a25257e8), UINT64_C(0xd7f139a7fae26ac2)}}},
+  {{{ UINT64_C(0xc0482971e15f65c2), UINT64_C(0x379f6e506440b74d), UINT64_C(0x658bc5d198cf3801)}},
+   {{ UINT64_C(0xe1374a755f1e1353), UINT64_C(0x30fbbc75064e7c7b), UINT64_C(0x16bf300cbf7011a7)}}},
+  {{{ UINT64_C(0x80cc6bb373292c9a), UINT64_C(0x620440b2f56450c7), UINT64_C(0xa7561843a752dd15)}},
+   {{ UINT64_C(0x5d8b59c1517faaf9), UINT64_C(0x13bd2b52507d9fed), UINT64_C(0x3cc55ded1ff094e3)}}},
+  {{{ UINT64_C(0x0c345571dd5d9d3a), UINT64_C(0x564e66604e598bb7), UINT64_C(0xaa42f183b159db12)}},
+   {{ UINT64_C(0xd9f07ea5af852ad5), UINT64_C(0xaf7dd3a79d55cc39), UINT64_C(0x1b6bb3711a3c34fa)}}},
+  {{{ UINT64_C(0x56dde74b947cb0a0), UINT64_C(0xd876654dfd02bd72), UINT64_C(0x389c46b994c59f9c)}},
+   {{ UINT64_C(0x4dad77a2f7e2a642), UINT64_C(0xa0ad9bccaa386f28), UINT64_C(0x3e0dd84d9ce35164)}}},
+  {{{ UINT64_C(0xe22fb17a8b75d600), UINT64_C(0x4e655bda5da956b6), UINT64_C(0x6c31c8f012ca117a)}},
+   {{ UINT64_C(0x9ff4c171dcde0453), UINT64_C(0xbc4f1991442ed67f), UINT64_C(0xcf01d65a3b08b81d)}}},
+  {{{ UINT64_C(0x25d7a85d89bf1477), UINT64_C(0x55e618e63c0d7282), UINT64_C(0xe5e49845e6038a72)}},
+   {{ UINT64_C(0x96c9b02660346e66), UINT64_C(0x0b5ca520c611ffa6), UINT64_C(0xc79810e9f0cb6463)}}},
+  {{{ UINT64_C(0x09aa4a577e42d329), UINT64_C(0x6281d309ad9a9af6), UINT64_C(0xb93f1b8acacbd2b3)}},
+   {{ UINT64_C(0x0ddcf5a64305d7ef), UINT64_C(0xfd6f5690acc6042c), UINT64_C(0x7d82d553e1f7bfc5)}}},
+  {{{ UINT64_C(0xcb3c3bcda5a8c94c), UINT64_C(0x8d01058763705f3a), UINT64_C(0x9edb1b001c085c9d)}},
+   {{ UINT64_C(0x951e52234e2928c1), UINT64_C(0x021db4f22f7313e5), UINT64_C(0x9e562cf87810444e)}}},
+  {{{ UINT64_C(0xd960b05ef81bf95e), UINT64_C(0xf640efd44a1792dd), UINT64_C(0x5bbb23406cd2ed48)}},
+   {{ UINT64_C(0x692e4f6cb23843c0), UINT64_C(0xb07a0678ad812027), UINT64_C(0x6d11871c57abf0ad)}}},
+  {{{ UINT64_C(0xec800f5d84fcb826), UINT64_C(0xb7afd6a45de720ef), UINT64_C(0xfbd000cd50fc85c9)}},
+   {{ UINT64_C(0xaeb7f08a32f01300), UINT64_C(0x2c8987dd508489c2), UINT64_C(0x2cd22a25d7e420aa)}}},
+  {{{ UINT64_C(0x9c1611b4e71e243b), UINT64_C(0xc01c9f6cdef1bd55), UINT64_C(0xd891e63dfeb38efb)}},
+   {{ UINT64_C(0x7d24785aa31f2df3), UINT64_C(0x6741c51aa70e53e7), UINT64_C(0x086bff01777d2f2b)}}},
+  {{{ UINT64_C(0x5d338014b21299b9), UINT64_C(0x71bc2729ca180efa), UINT64_C(0x55db123420408804)}},
+   {{ UINT64_C(0x84fe89bbfb587dcb), UINT64_C(0xd87dc0bccf92f467), UINT64_C(0x953c4b92cdbbab6a)}}},
+  {{{ UINT64_C(0x3709930439aa48c7), UINT64_C(0x529552d2a99bc97d), UINT64_C(0x7307384c67672b97)}},
+   {{ UINT64_C(0xb48c0dff4421cfa5), UINT64_C(0xc3aad8c63e2a10f2), UINT64_C(0x3e17f74f33f666e3)}}},
+  {{{ UINT64_C(0x59301c2fef48e1b4), UINT64_C(0xddd8c77dc7cab630), UINT64_C(0x2d69dbf553aad63b)}},
+   {{ UINT64_C(0x7f1879062de88b29), UINT64_C(0x3ce4a2233cd9b628), UINT64_C(0x192d658fb6f5e1f1)}}},
+  {{{ UINT64_C(0x19f6761667a1f38e), UINT64_C(0x540a9f727774ec56), UINT64_C(0xe2865f241669652e)}},
+   {{ UINT64_C(0x86ae38db557a9a53), UINT64_C(0x532225a8cd945338), UINT64_C(0x1b4fa002ce2f6d6f)}}},
+  {{{ UINT64_C(0x28bd9b8c14272f33), UINT64_C(0x99ceda8d0dbd6953), UINT64_C(0xc650414fb2c52c31)}},
+   {{ UINT64_C(0xa1921590dd814b9f), UINT64_C(0x526c500a4529ba27), UINT64_C(0xb49748d1e39b9d71)}}},
+  {{{ UINT64_C(0xa674ca178b345c16), UINT64_C(0x0f98ad769a334650), UINT64_C(0x10c8faa1f863dda4)}},
+   {{ UINT64_C(0x6da0e61ed2a641aa), UINT64_C(0x01f846b929bb4a30), UINT64_C(0xe40cb009a1881e25)}}},
+  {{{ UINT64_C(0x9ad2515935a48614), UINT64_C(0x0b7523325a7546d7), UINT64_C(0xe24592d77cb7e4cb)}},
+   {{ UINT64_C(0xa969e05ebe9b4671), UINT64_C(0x0dcde76643b88873), UINT64_C(0x1396e9c414bc1ec6)}}},
+  {{{ UINT64_C(0x4a7d2546ade37cf4), UINT64_C(0x819c1b32aa1a43c1), UINT64_C(0xe5b43fbd6f790f09)}},
+   {{ UINT64_C(0x99eefbc96c17702b), UINT64_C(0x29a7f286f2b0445a), UINT64_C(0x48e733dc81e48b4c)}}},
+  {{{ UINT64_C(0x2d2279f08048d9ab), UINT64_C(0x20c5e3dd14d82c14), UINT64_C(0x6deb5fd913c08898)}},
+   {{ UINT64_C(0x9d8c28e538dd1080), UINT64_C(0x9049bf7476850ed1), UINT64_C(0x2e4f5da63b65815a)}}},
+  {{{ UINT64_C(0xb023cf09b0b59d9c), UINT64_C(0x74a2960fff4c6f19), UINT64_C(0x3e496193326a7644)}},
+   {{ UINT64_C(0xfa1cd6ae1aae3456), UINT64_C(0xc1d601792ec30b80), UINT64_C(0xfd76f8dbd821d794)}}},
+  {{{ UINT64_C(0x5c6c302cfd6bcd76), UINT64_C(0x9e21789888146205), UINT64_C(0x165e5b7752a7661b)}},
+   {{ UINT64_C(0xbe34e33131619295), UINT64_C(0xb68857caf0407c48), UINT64_C(0x1b9a8064c4b90417)}}},
+  {{{ UINT64_C(0x61c28e9f9f032ecc), UINT64_C(0x708fd9ff30c35169), UINT64_C(0x69182637f37333cb)}},
+   {{ UINT64_C(0xd492bcb38f6bf00b), UINT64_C(0x44b5cbcd5cc31c8e), UINT64_C(0x5e9b70d8da991013)}}},
+  {{{ UINT64_C(0x78abc36570e6af45), UINT64_C(0x9cb997d590418cc1), UINT64_C(0x9d80a7138a019cb9)}},
+   {{ UINT64_C(0x85c873615778129e), UINT64_C(0xc31b84a6cb5886df), UINT64_C(0x08218e3dace42947)}}},
+  {{{ UINT64_C(0x7288885d164322c8), UINT64_C(0x8d10b540191d75f8), UINT64_C(0x332318a28233552d)}},
+   {{ UINT64_C(0x65975150f0fc4ec8), UINT64_C(0xb58fbee2bf004263), UINT64_C(0xb61a41c0c6db782d)}}},
+  {{{ UINT64_C(0xb48279f5318a1a4e), UINT64_C(0x9aceb4de4df4606f), UINT64_C(0xaf9c69a2ff253cec)}},
+   {{ UINT64_C(0x9d94769567de0c38), UINT64_C(0x861a564bbdb29517), UINT64_C(0x78d483a8caa4d874)}}},
+  {{{ UINT64_C(0x6e0f27d4574036bd), UINT64_C(0xfd85375d04a93002), UINT64_C(0x4b920ce747837059)}},
+   {{ UINT64_C(0x5e396c21759a7bdb), UINT64_C(0xa9ed4ace1d7d5d48), UINT64_C(0x90c2a2ff94d50733)}}},
+  {{{ UINT64_C(0x6df4501eb17f7b32), UINT64_C(0x30f78e5bd7f5391b), UINT64_C(0xa4234fc62ebf9db8)}},
+   {{ UINT64_C(0xc629c90e1c43aaea), UINT64_C(0xd74cc256d423f9ba), UINT64_C(0x78c913288ba2c843)}}},
+  {{{ UINT64_C(0x11d97c1b0a2fb2bd), UINT64_C(0xb3e2772590206dfe), UINT64_C(0x5b3db1440aef2386)}},
+   {{ UINT64_C(0x2ddeb70c76737077), UINT64_C(0x324ca3a4c94dd41b), UINT64_C(0x16ff73e56cba8d3f)}}},
+  {{{ UINT64_C(0x2ce7265a84c887d6), UINT64_C(0x879625de00da8d71), UINT64_C(0x2be2b0092731658f)}},
+   {{ UINT64_C(0x1b95aa8dca522374), UINT64_C(0x32060ea8b71fd1a3), UINT64_C(0x52b164703f70c2d9)}}},
+  {{{ UINT64_C(0x34f9355aad294e1e), UINT64_C(0xda4674a85dd1d2f2), UINT64_C(0xaaebfc6b6c6aa44d)}},
+   {{ UINT64_C(0xbcf235da0bd515fe), UINT64_C(0xc4a218f5abc4b9e8), UINT64_C(0x1daa588fab35c007)}}},
+  {{{ UINT64_C(0xc12ad38c6739597a), UINT64_C(0xd7083259908b43e1), UINT64_C(0xb7f1768dd98e3737)}},
+   {{ UINT64_C(0x3fef73754b644e95), UINT64_C(0x6c466683d7ff228c), UINT64_C(0xad098f8a4e9eb4e1)}}},
+};
+
+static const mzd_row192x2_t LK_2[] = {
+  {{{ UINT64_C(0x4fe31784d0f9255b), UINT64_C(0xd991e9e2084a0efc), UINT64_C(0xbb51a0ec5f4bce47)}},
+   {{ UINT64_C(0x49e6c95432a54cb1), UINT64_C(0xf0e42955a98079c8), UINT64_C(0x7d088d3010d25970)}}},
+  {{{ UINT64_C(0x5e37fe4f4981f789), UINT64_C(0x20a8d8c4e16db9ca), UINT64_C(0x72c17ac393e5e68b)}},
+   {{ UINT64_C(0xf9013be08477e9b1), UINT64_C(0xf0ffd4d2ed25cac5), UINT64_C(0xb97323c243fe64ce)}}},
+  {{{ UINT64_C(0x6a9bc945e6f2e2b6), UINT64_C(0xfde2746a4378c37a), UINT64_C(0x5e65094dc3256832)}},
+   {{ UINT64_C(0x6aade7a589ea5e21), UINT64_C(0x736b973cb48bf42c), UINT64_C(0xc43c0acefad7bbbb)}}},
+  {{{ UINT64_C(0xcbf721b05b07f7ef), UINT64_C(0xce2f78e57945b6a2), UINT64_C(0x650f42c66ba4dfc0)}},
+   {{ UINT64_C(0x5bd92751f0fbe443), UINT64_C(0x8a707bce9f5713cd), UINT64_C(0x477c60fdb0509898)}}},
+  {{{ UINT64_C(0xc962122e5787e493), UINT64_C(0xa64be2d6921d3f53), UINT64_C(0x01abdda4b6aceb0a)}},
+   {{ UINT64_C(0x1ba92519452e5abb), UINT64_C(0xed146217c650f312), UINT64_C(0x8981bdd2b47150dd)}}},
+  {{{ UINT64_C(0x1ad344fc8d9a83ab), UINT64_C(0xcbd891357cf5f543), UINT64_C(0x9135cad342b0875f)}},
+   {{ UINT64_C(0x71f66673f59aa493), UINT64_C(0x8689b5a5ffe8ca20), UINT64_C(0x6c41bf530c4ba6c3)}}},
+  {{{ UINT64_C(0x582bd2e331b361bd), UINT64_C(0xfc17d2762cbfe78b), UINT64_C(0xabd58682c66901b7)}},
+   {{ UINT64_C(0x58fca072beed0fa6), UINT64_C(0xa1aac8b2f632650c), UINT64_C(0x31939679cbc35e90)}}},
+  {{{ UINT64_C(0x175001041fcb1258), UINT64_C(0xd5465c9684375d28), UINT64_C(0x602f9b085f403dff)}},
+   {{ UINT64_C(0x61a06b12ba23dda3), UINT64_C(0xe28a19fc629a243f), UINT64_C(0x42346ab34782e6da)}}},
+  {{{ UINT64_C(0x756846f8f730cea1), UINT64_C(0x5ae9f08e50b41134), UINT64_C(0xdd5d2f81c75ccaa3)}},
+   {{ UINT64_C(0xf61b7bd2384e2085), UINT64_C(0xcbfad26d4ccb5082), UINT64_C(0x78aa63d630969990)}}},
+  {{{ UINT64_C(0x4ae09b04f6386e2a), UINT64_C(0xf7d1aca08e566986), UINT64_C(0xccb0c34ae18b5e72)}},
+   {{ UINT64_C(0x15f9f2a4e2279d6a), UINT64_C(0x8ac4457f65a7ccde), UINT64_C(0x8f90a3b3b951d3c1)}}},
+  {{{ UINT64_C(0x4fce16af75de3fdf), UINT64_C(0x0245cab803f7a4a8), UINT64_C(0xd93e0b43ab4dc5a9)}},
+   {{ UINT64_C(0xe3bb2ead52b2946d), UINT64_C(0x9141d2720cb1a05e), UINT64_C(0x3125b13c867f4ac5)}}},
+  {{{ UINT64_C(0x971595d1326b65c4), UINT64_C(0x1aa819966daff5b1), UINT64_C(0xffde9d9aff631632)}},
+   {{ UINT64_C(0x5d61b5eac8fc94a0), UINT64_C(0x42d099ae8030209c), UINT64_C(0x6966a666677a3138)}}},
+  {{{ UINT64_C(0xd1060a87a1e382bd), UINT64_C(0x652410b69ce62789), UINT64_C(0x83420aebd3fc21aa)}},
+   {{ UINT64_C(0x3bd2a6a611e41d0b), UINT64_C(0xd9db343acf57615d), UINT64_C(0xf3f8ec694abe2c56)}}},
+  {{{ UINT64_C(0x43e66dcf50eda7c8), UINT64_C(0xf1c49c025f7680e7), UINT64_C(0x759f2d3d0d32a8a8)}},
+   {{ UINT64_C(0xed2c4c2f22731a00), UINT64_C(0x00794d2241fe4c28), UINT64_C(0x7ce6c028337bd4c9)}}},
+  {{{ UINT64_C(0x8dfac9a6bc4c6d9d), UINT64_C(0x2bea9e030d9f2ff3), UINT64_C(0x86de2bff21344824)}},
+   {{ UINT64_C(0x125600a0dd358814), UINT64_C(0xf98ef94237e3e065), UINT64_C(0x11da4e85c8d0295a)}}},
+  {{{ UINT64_C(0x5000e1d50194d473), UINT64_C(0x30ed96d058296a80), UINT64_C(0xb2a0399c1673df7e)}},
+   {{ UINT64_C(0xcc0861068ec09215), UINT64_C(0x337bb7f64b95ea48), UINT64_C(0xf69cc100e29f86c3)}}},
+  {{{ UINT64_C(0x38ca22fe548096ca), UINT64_C(0x43999b686d5cff1d), UINT64_C(0xdfdd3c64f8702b63)}},
+   {{ UINT64_C(0x5cf7795f82910830), UINT64_C(0x0f334e4b11e10b98), UINT64_C(0x46c7375e57514bdc)}}},
+  {{{ UINT64_C(0x71a11705393e7015), UINT64_C(0x436a0e481d18f2e1), UINT64_C(0xd0c999661990dc4f)}},
+   {{ UINT64_C(0x0dda6cc60cd9d811), UINT64_C(0xe3722f1e721c2e55), UINT64_C(0x3373904807e9cfa5)}}},
+  {{{ UINT64_C(0xd91a99c8b3f7175a), UINT64_C(0x20dc55e4bbef24c3), UINT64_C(0xc0b688ece7f7794e)}},
+   {{ UINT64_C(0x420479c1ee4e9301), UINT64_C(0xc450a88a57d49846), UINT64_C(0xfe2d3cc0b19271f1)}}},
+  {{{ UINT64_C(0x965afdd9f2145ab9), UINT64_C(0xff3c3713ac31f863), UINT64_C(0x41c56e6f1d2bf9a2)}},
+   {{ UINT64_C(0x133206f3bf92f106), UINT64_C(0x8d88d8fb75c63dff), UINT64_C(0x6c581d7f7ea996c2)}}},
+  {{{ UINT64_C(0xf9f1f96d1b856d51), UINT64_C(0xaed072065f59e7db), UINT64_C(0xf664d4a6813b4c9a)}},
+   {{ UINT64_C(0x522e31457defb0ed), UINT64_C(0x807a812655341733), UINT64_C(0xfff373e454b791a5)}}},
+  {{{ UINT64_C(0xf6a246a68869d632), UINT64_C(0xfeeaa3ed80ca9c71), UINT64_C(0xd3547dd49893dd9f)}},
+   {{ UINT64_C(0x80bc6a25d51379b0), UINT64_C(0x739d5a87f102ac27), UINT64_C(0x61eb40998f8b0264)}}},
+  {{{ UINT64_C(0xa50bb7b76c1e0d72), UINT64_C(0xe29421387650830a), UINT64_C(0x31672eb0325b297d)}},
+   {{ UINT64_C(0x148e75bf9b1817eb), UINT64_C(0xd7c0362be0ae1739), UINT64_C(0xb50746c52bacf004)}}},
+  {{{ UINT64_C(0x61f2e6c122a4cde9), UINT64_C(0xc9087098a681a924), UINT64_C(0x988b001140b3ff91)}},
+   {{ UINT64_C(0x82e73a1fd61e5645), UINT64_C(0x4001c0cbe7efe760), UINT64_C(0xbb290936d35aaa02)}}},
+  {{{ UINT64_C(0x1e4b71c50c1d7fe9), UINT64_C(0x6d274a519e071804), UINT64_C(0x6945eecc7c02f3a8)}},
+   {{ UINT64_C(0x18c46b1e89e2d640), UINT64_C(0xbaef0dda1440495c), UINT64_C(0x16da9cff6b4ebdc7)}}},
+  {{{ UINT64_C(0x5ba6d301f1881cd6), UINT64_C(0xaa7d5ab9240ba8b4), UINT64_C(0x90fa65cde86a9208)}},
+   {{ UINT64_C(0x8de352785343e260), UINT64_C(0xc115173cbebfbf29), UINT64_C(0x20771da89864267d)}}},
+  {{{ UINT64_C(0x7aae4ed1fb8d1de9), UINT64_C(0x7eb20c79c0834893), UINT64_C(0xf7c3339e4a882cb8)}},
+   {{ UINT64_C(0xd57d6ed4d33ea2fe), UINT64_C(0xe216160767f9b6ba), UINT64_C(0x9f90905eca426b95)}}},
+  {{{ UINT64_C(0x594acfc705e9f6f9), UINT64_C(0xad0eb15f30aa7003), UINT64_C(0xc5052d2c4010d69c)}},
+   {{ UINT64_C(0xef4e33bc55b76739), UINT64_C(0x1e52c24d68d50453), UINT64_C(0xbbd025e8730514a3)}}},
+  {{{ UINT64_C(0x7262ab3ca044944c), UINT64_C(0xbc1628ef459964a8), UINT64_C(0xcd68dbe37278dde6)}},
+   {{ UINT64_C(0x70cc7a9c5027f774), UINT64_C(0x15b3637a0d9d75a5), UINT64_C(0x74ed082efceebaf4)}}},
+  {{{ UINT64_C(0xf0672bc16789e370), UINT64_C(0x1333bb36f259472b), UINT64_C(0xf6c6d667da64711f)}},
+   {{ UINT64_C(0x68ac06670b1b7106), UINT64_C(0xfcf8e4810bb7e838), UINT64_C(0xf5cf5d8b11596c88)}}},
+  {{{ UINT64_C(0x81eac634c5e31179), UINT64_C(0x2a44095dc5498410), UINT64_C(0xb6c62d8eeefc815a)}},
+   {{ UINT64_C(0x8579966b41fcc780), UINT64_C(0x388777f146fe2946), UINT64_C(0x64642fad1b39c307)}}},
+  {{{ UINT64_C(0x4b685445adc9a542), UINT64_C(0xf41543cf667da199), UINT64_C(0x323f88e5c9450c59)}},
+   {{ UINT64_C(0xf34b40862b3c304c), UINT64_C(0x1c6712164d6d1770), UINT64_C(0x38b3b37b8166d332)}}},
+  {{{ UINT64_C(0xc643d0e2faa21551), UINT64_C(0x5943d43e995f0ef9), UINT64_C(0xb8a8a4cc07d48bfd)}},
+   {{ UINT64_C(0x355225b1b1f771cd), UINT64_C(0x77b0df58b5dbe6be), UINT64_C(0x190357abc3b39599)}}},
+  {{{ UINT64_C(0x488df57fb3da33b6), UINT64_C(0xcd0cd3c0bc249007), UINT64_C(0x963f689cd22034e7)}},
+   {{ UINT64_C(0x426769c4fc0bddd5), UINT64_C(0xeb349379452873f5), UINT64_C(0xd0674e34387e6ba9)}}},
+  {{{ UINT64_C(0xd22346c7e41ff4a9), UINT64_C(0x1633a5508544b21b), UINT64_C(0x751e090091ba9a1a)}},
+   {{ UINT64_C(0x17d1af49aaa16526), UINT64_C(0xe798277e47a00b02), UINT64_C(0x229527a9477d1bed)}}},
+  {{{ UINT64_C(0x631749e58395617a), UINT64_C(0xca1c72b3f5fb0103), UINT64_C(0xdbedca5a41b93732)}},
+   {{ UINT64_C(0x2b56a516fe54e552), UINT64_C(0x473d790eb7a94e07), UINT64_C(0x66e4f06b7b909d24)}}},
+  {{{ UINT64_C(0xf62a137d09bac701), UINT64_C(0x639677a3ac22b970), UINT64_C(0xbc6041cb14d88f75)}},
+   {{ UINT64_C(0x11ec733a42ac3eaf), UINT64_C(0x5bda91ce3ed85175), UINT64_C(0x9f336015b5e946e3)}}},
+  {{{ UINT64_C(0x868ad02e767aa1c2), UINT64_C(0x6c6d9efe37fdd895), UINT64_C(0x755af2a0912e81fa)}},
+   {{ UINT64_C(0xfb7138ec25aded9b), UINT64_C(0xc8ca99c5c361d9cf), UINT64_C(0xe9d19e54787386e2)}}},
+  {{{ UINT64_C(0x70e993053f4f9731), UINT64_C(0xfcc6d91ec3563a00), UINT64_C(0x6211677c5e8cb8b1)}},
+   {{ UINT64_C(0xbaf733efd5419e24), UINT64_C(0x9d14d112fc5b7b5d), UINT64_C(0x33d008345011c4f0)}}},
+  {{{ UINT64_C(0xf93ae94a99cbee9d), UINT64_C(0x2fc8fa43efd67979), UINT64_C(0x3de8321f17139c0c)}},
+   {{ UINT64_C(0x73595037601cadd9), UINT64_C(0x9c09eef97ce71761), UINT64_C(0xa9d889b7a0d467f7)}}},
+  {{{ UINT64_C(0x969bf42686ac314a), UINT64_C(0xe220ca2f9673c98d), UINT64_C(0x560852351c00e341)}},
+   {{ UINT64_C(0x477038e3bfa4236c), UINT64_C(0xc73cc2d19f4c3af5), UINT64_C(0x8f5ee5d9b1160041)}}},
+  {{{ UINT64_C(0xcba8e42442fcd761), UINT64_C(0xc29f34c47178a07b), UINT64_C(0x9f99db93e4a82300)}},
+   {{ UINT64_C(0x667bc13193badc78), UINT64_C(0xd7fb0846ab719aad), UINT64_C(0x87ba68777c1eccfd)}}},
+  {{{ UINT64_C(0x4af723fae81d9292), UINT64_C(0x552f03568a324b42), UINT64_C(0xa58056ab5f321718)}},
+   {{ UINT64_C(0xdb02b417c616db3d), UINT64_C(0x895c662a5ad8a8d3), UINT64_C(0x79ef4bd1848602a3)}}},
+  {{{ UINT64_C(0x7ac10da38e1d217e), UINT64_C(0x0e85e33997f448cc), UINT64_C(0xd3ec2e82127e70ac)}},
+   {{ UINT64_C(0x821461ee5ac3da99), UINT64_C(0x57ffa84c828ca5aa), UINT64_C(0xaf77583a84574ee6)}}},
+  {{{ UINT64_C(0xbd3bd9ffaf8638be), UINT64_C(0xa09ea0e7fb5aea8a), UINT64_C(0xe37a170ef2d75bd6)}},
+   {{ UINT64_C(0x02182dd4b7e41a36), UINT64_C(0x17493d34733cf594), UINT64_C(0x18bbd2255a91772b)}}},
+  {{{ UINT64_C(0xe89b337ef1c79971), UINT64_C(0x2cff87ae97b11513), UINT64_C(0xb02ce77d03354be8)}},
+   {{ UINT64_C(0xaebe03b5f947b16c), UINT64_C(0xf095b01dbce0620f), UINT64_C(0x13ac08e4c83e1575)}}},
+  {{{ UINT64_C(0xbe7c8aca4e330c44), UINT64_C(0x69794f9b379316f1), UINT64_C(0xc136276b24ded021)}},
+   {{ UINT64_C(0x18e006c82a43fa62), UINT64_C(0xda6a2b10a60c6af9), UINT64_C(0x9eeefecd78290520)}}},
+  {{{ UINT64_C(0x3a495a9eb9696a98), UINT64_C(0x3fcbe1ee677ae040), UINT64_C(0xde1d6028dac3e460)}},
+   {{ UINT64_C(0x20ccad35b281fd13), UINT64_C(0xbdb3116a745fd976), UINT64_C(0xa17c5c3b5f666ea0)}}},
+  {{{ UINT64_C(0x3b7b8d647bc1c1cb), UINT64_C(0x5eb2ebb928716df6), UINT64_C(0x20cdfe029396f665)}},
+   {{ UINT64_C(0x4eb73a19765d3680), UINT64_C(0x0d0afa8337979293), UINT64_C(0xca89dc945ff22a1f)}}},
+  {{{ UINT64_C(0x87a006cb6038dea0), UINT64_C(0x0fee192863331c3b), UINT64_C(0xa44d8790cad351e5)}},
+   {{ UINT64_C(0x35872c1ba0a7c4bb), UINT64_C(0x04e0b30cd78c67f6), UINT64_C(0x1045be14a00c8881)}}},
+  {{{ UINT64_C(0x5d5145ca34fcbf37), UINT64_C(0x43fdc14a282289b4), UINT64_C(0xafa60b5c0cdb1d0a)}},
+   {{ UINT64_C(0x336fb510ff15a6c9), UINT64_C(0x5486436765b9b376), UINT64_C(0x2b0fc99d7a6bcdf0)}}},
+  {{{ UINT64_C(0x8b9fce6c5f2d451e), UINT64_C(0x6a3ca4ccc0af546d), UINT64_C(0x9e955ec3dcd4c239)}},
+   {{ UINT64_C(0x5f3fceba7e306deb), UINT64_C(0xfc5ee1bd08370d19), UINT64_C(0x64fe646b6eb7162d)}}},
+  {{{ UINT64_C(0x475f7ae8703adff1), UINT64_C(0x832e039de4a4b97b), UINT64_C(0x9dd12a3a3aa4ce0a)}},
+   {{ UINT64_C(0xcf404afad6f11c8b), UINT64_C(0xaa784bc529beb363), UINT64_C(0x6c5f9b16ad46d26e)}}},
+  {{{ UINT64_C(0xe594d90430f00382), UINT64_C(0xf370654040d79f1f), UINT64_C(0xce08d54cd72f24fc)}},
+   {{ UINT64_C(0x84783e87f0ad9b02), UINT64_C(0xd2a1228bf4e22de7), UINT64_C(0xd1f9898b26f93675)}}},
+  {{{ UINT64_C(0x7e83779c12ddcd8c), UINT64_C(0x98ad53e75fe63724), UINT64_C(0xb5e3957707944fe0)}},
+   {{ UINT64_C(0xd87cdaa31f502300), UINT64_C(0x9eec260a827dbb00), UINT64_C(0xbddcebb3ba0aa2b8)}}},
+  {{{ UINT64_C(0x8564a270dbf81c74), UINT64_C(0x76227398dc27ec91), UINT64_C(0x01e6fef9c0380aee)}},
+   {{ UINT64_C(0xc9dada84c8598cb9), UINT64_C(0x0ec3bb62ee20a2e2), UINT64_C(0xa5f94ad3981cb87c)}}},
+  {{{ UINT64_C(0x14d1d578a73416b9), UINT64_C(0xdfd6d93079f9baf4), UINT64_C(0x91cccf217ca4fd22)}},
+   {{ UINT64_C(0x6e977081ce112e83), UINT64_C(0x6d67d4eee65766b5), UINT64_C(0x1374704b0f3ad75b)}}},
+  {{{ UINT64_C(0xaa323558847fec9a), UINT64_C(0x6d6131b7653afd39), UINT64_C(0x0e1c0ed74cc02e11)}},
+   {{ UINT64_C(0x2192bac25754aa08), UINT64_C(0xa914815e5a48917b), UINT64_C(0x771ddcb8f84c3b14)}}},
+  {{{ UINT64_C(0x077de431cbf8e2aa), UINT64_C(0xc4ca0147cae35cdc), UINT64_C(0x98f886760522543d)}},
+   {{ UINT64_C(0x5e9af8c8f4a691e2), UINT64_C(0xecf64cfcef0f297d), UINT64_C(0xfd1461939a3e023a)}}},
+  {{{ UINT64_C(0x449071cccc04e02a), UINT64_C(0xbe9c576e0540e59e), UINT64_C(0x3972c69fc4628ae2)}},
+   {{ UINT64_C(0xbf1588cb2e8c55c8), UINT64_C(0x9837e8538945f480), UINT64_C(0x973b38c5f7485c44)}}},
+  {{{ UINT64_C(0xcda0a89ac007d57a), UINT64_C(0x1c7c06e79e62c955), UINT64_C(0xe20039518bdf0aa7)}},
+   {{ UINT64_C(0x39112018a870a473), UINT64_C(0x84ed46ee67425cd8), UINT64_C(0xf0488853f53e9120)}}},
+  {{{ UINT64_C(0x97ad96545f21882f), UINT64_C(0xc76b4c7abd85da96), UINT64_C(0x0a206264c0fd035a)}},
+   {{ UINT64_C(0xc4705fb976d83f07), UINT64_C(0xa9e00315b00642e6), UINT64_C(0xb38c064b6db3d5b2)}}},
+  {{{ UINT64_C(0x6d1a91e0ab60dc3a), UINT64_C(0x11685f5404a25347), UINT64_C(0xa3ec04efdcdc4f8a)}},
+   {{ UINT64_C(0xf060c334ac882195), UINT64_C(0xc757b11d1afda0c9), UINT64_C(0x60f4efceb3dac33e)}}},
+  {{{ UINT64_C(0x5a79af84013a7aed), UINT64_C(0xe93b18c29eeb3a4a), UINT64_C(0xc169df4b6f6a0c62)}},
+   {{ UINT64_C(0x3bec17165e91b4b3), UINT64_C(0xb28a18393aa7395c), UINT64_C(0x8e1d0160e29b9ab4)}}},
+  {{{ UINT64_C(0x0ef0d03bd7b775cd), UINT64_C(0x0ca46ab7fcb4af62), UINT64_C(0xc44232a168541eb8)}},
+   {{ UINT64_C(0xec1d39f9f8b08b69), UINT64_C(0x7ffe95497cd6b9f5), UINT64_C(0x4b2a514875ddd399)}}},
+  {{{ UINT64_C(0x215ff52acb2067aa), UINT64_C(0x767f0fbae90f2e2c), UINT64_C(0x10de5d42915dc371)}},
+   {{ UINT64_C(0x0231ea16b2210210), UINT64_C(0xcfa05ea8eee83157), UINT64_C(0xeb5ee11872ea2999)}}},
+  {{{ UINT64_C(0xd694edd048ed9d24), UINT64_C(0xb389abe331f43d60), UINT64_C(0x2606dc9be71ae92c)}},
+   {{ UINT64_C(0x91faad7f7fbd942d), UINT64_C(0x3bfae5e439a92c28), UINT64_C(0xac42cc667add702a)}}},
+  {{{ UINT64_C(0xbfb5dc15543475a7), UINT64_C(0xa0bb3aeb529a3796), UINT64_C(0x909c38e5408572fb)}},
+   {{ UINT64_C(0x7d69e89e02ba93f9), UINT64_C(0x0bd6663590b43b53), UINT64_C(0xf33a390a1ccff5ee)}}},
+  {{{ UINT64_C(0x7d95c744acdae783), UINT64_C(0xcc0871e06b9bfef4), UINT64_C(0xcbbd3e8a9e4f9b14)}},
+   {{ UINT64_C(0x234742b01c1d0a13), UINT64_C(0xabd471c16281b9e9), UINT64_C(0x77a4a2fece513ee7)}}},
+  {{{ UINT64_C(0x93e28115a7b7a97f), UINT64_C(0x77cabfcc57375444), UINT64_C(0x27d7e219835a0ebf)}},
+   {{ UINT64_C(0xf1280c61ad0d0a1f), UINT64_C(0xed0e3a68f2b39aa8), UINT64_C(0x9288a319e96bf98f)}}},
+  {{{ UINT64_C(0x19c10813571b6026), UINT64_C(0xce693fc8e43516fc), UINT64_C(0xc542297fbb269ef6)}},
+   {{ UINT64_C(0xeb2de0bc8c1e6eaa), UINT64_C(0xc5d76bb95efab76b), UINT64_C(0xa0f5eb01160788e0)}}},
+  {{{ UINT64_C(0xe299f66f15592c52), UINT64_C(0xdaacc59f96eabd93), UINT64_C(0xb67074b846fc38d9)}},
+   {{ UINT64_C(0x3aac7ef28e478932), UINT64_C(0xc769bf95c4befe8e), UINT64_C(0xe70e015f50ac3d6f)}}},
+  {{{ UINT64_C(0x653614bc278b8068), UINT64_C(0x16c458b6179e6cd7), UINT64_C(0xc068f2b987ebda7a)}},
+   {{ UINT64_C(0x299eea997069e650), UINT64_C(0x62d2383df8e90b65), UINT64_C(0x0051c9768e24d577)}}},
+  {{{ UINT64_C(0xe9ddc873f71e8f33), UINT64_C(0x9ed2df8f69b3e520), UINT64_C(0x2d2ada04ea2b38c1)}},
+   {{ UINT64_C(0x312abf629f32e7b6), UINT64_C(0x625e9295971705ac), UINT64_C(0x599a79b7a245d3d3)}}},
+  {{{ UINT64_C(0x635cf59dfb3d585c), UINT64_C(0xa37ceaacfef32432), UINT64_C(0x05bd311ee36dcfe8)}},
+   {{ UINT64_C(0xaa8d47979764566f), UINT64_C(0x160dc3dc4f14368e), UINT64_C(0x54cbbf3a8e8c0d2a)}}},
+  {{{ UINT64_C(0x3e021f3a1054bfcb), UINT64_C(0x471bb290de878e2d), UINT64_C(0xc4c2581a6b298b4a)}},
+   {{ UINT64_C(0x8f66630ee71a6a09), UINT64_C(0x0fb1833c3ae90442), UINT64_C(0xd1195bada1e9c97d)}}},
+  {{{ UINT64_C(0x38b60479d6c51992), UINT64_C(0x87c473b2d40969f8), UINT64_C(0x4baceb9928c3349a)}},
+   {{ UINT64_C(0xe521143b744cd886), UINT64_C(0xdff9986f8949e45e), UINT64_C(0xb5716f755a015492)}}},
+  {{{ UINT64_C(0x657b195d536304e1), UINT64_C(0x3853cb9f2d5d1e89), UINT64_C(0x1ae3f6709bbcd137)}},
+   {{ UINT64_C(0xcb01a9bfa21c5629), UINT64_C(0xcba187cd4bcf54e8), UINT64_C(0x459d289a40d6e187)}}},
+  {{{ UINT64_C(0x11b7dd7e1263ccf8), UINT64_C(0xec95e3002d76f16c), UINT64_C(0xd4dcdf3ebe0376f4)}},
+   {{ UINT64_C(0xb7e08b3274eca1d1), UINT64_C(0x6b97296b7ca3761f), UINT64_C(0xfe7a4bc26bcf8e5f)}}},
+  {{{ UINT64_C(0xde6e054becd140ea), UINT64_C(0x55d98d113a77856f), UINT64_C(0x1174d8f998ed8c01)}},
+   {{ UINT64_C(0x36d6f0d7983fe065), UINT64_C(0x7e01577fb7ae7979), UINT64_C(0x4a4650b9b66dc4d7)}}},
+  {{{ UINT64_C(0x9d0f1f5d567dfddf), UINT64_C(0xe570c6fd841958d4), UINT64_C(0x18426e59737c4b66)}},
+   {{ UINT64_C(0x37524dd1404e3092), UINT64_C(0xec6782e9a178dad6), UINT64_C(0xaf51bfe84395ce4e)}}},
+  {{{ UINT64_C(0x0f9bc49069b627b8), UINT64_C(0xf94067e08bd8b4bd), UINT64_C(0x535502b620f3da67)}},
+   {{ UINT64_C(0xb4a05b440a14b721), UINT64_C(0xf706a684499e4a36), UINT64_C(0xa41f7df004014d62)}}},
+  {{{ UINT64_C(0xad9d79e789318893), UINT64_C(0x676238032d97a589), UINT64_C(0x741f73661513d10c)}},
+   {{ UINT64_C(0xbd25d06bbcb0e584), UINT64_C(0xccb66dc498164238), UINT64_C(0x97d1a6d1ad7e2ec0)}}},
+  {{{ UINT64_C(0x73b8f373008ee043), UINT64_C(0x51d46a0a627b0923), UINT64_C(0xef1d6104251c2ed3)}},
+   {{ UINT64_C(0x2c52fc664e963d93), UINT64_C(0xa79365e36d84b507), UINT64_C(0x30d4eb78a7b41fd3)}}},
+  {{{ UINT64_C(0xd3ebca5a143d305e), UINT64_C(0xebe4832d9b657a30), UINT64_C(0xb7a8f9baac0436ca)}},
+   {{ UINT64_C(0x4d059ea04d9a5fb5), UINT64_C(0x35fdd99fd8fded23), UINT64_C(0xfea75c4dea9b8391)}}},
+  {{{ UINT64_C(0x09a33f50c616f816), UINT64_C(0x963de9ba173e724a), UINT64_C(0x70e5423a016a26a3)}},
+   {{ UINT64_C(0xcb3fa7aed0ae43a4), UINT64_C(0xb6474fd90a87251c), UINT64_C(0xdf79523ca1f8d6a8)}}},
+  {{{ UINT64_C(0xc6fe003b5e4b0ff8), UINT64_C(0xb894fe5e5e3525ad), UINT64_C(0x167ba728147eefb3)}},
+   {{ UINT64_C(0xcfdeeb5ada53b31b), UINT64_C(0x07f9ab07c625926d), UINT64_C(0x96b847cbf4d56d85)}}},
+  {{{ UINT64_C(0x5f5790908c71ede7), UINT64_C(0x660a2d6172aa2923), UINT64_C(0x270df853c702e2ea)}},
+   {{ UINT64_C(0x4acff18ae4f8a2c0), UINT64_C(0x446f32d584ca8c51), UINT64_C(0x97aaf2daeabf6b1f)}}},
+  {{{ UINT64_C(0x083f909b112fb463), UINT64_C(0xb50b3fd00bfc89ff), UINT64_C(0x6a270daf3a40e186)}},
+   {{ UINT64_C(0x144f759156e2a8ae), UINT64_C(0xb3bcf655bfe0ef93), UINT64_C(0x0f1f8d93077277e0)}}},
+  {{{ UINT64_C(0x68c2d1b0e4e53669), UINT64_C(0xd9489c464888ef02), UINT64_C(0xd7bae776b759c8e2)}},
+   {{ UINT64_C(0xc89c993a1d1f9653), UINT64_C(0x6d9a7f777a489f8c), UINT64_C(0xdbde17e28f70fe56)}}},
+  {{{ UINT64_C(0xdb6af7f6b41d06d7), UINT64_C(0xc2f8ccad51374ba1), UINT64_C(0x91265403e01fa695)}},
+   {{ UINT64_C(0x1a24f66ace17225a), UINT64_C(0x7f1e60f39b439fea), UINT64_C(0xde7fa1a950489701)}}},
+  {{{ UINT64_C(0x793d5c6777f9fba8), UINT64_C(0x75010e2c9209445e), UINT64_C(0xe4a7e6cbbc287ffd)}},
+   {{ UINT64_C(0x648b5a4ea32b23b2), UINT64_C(0x8403d4e55bca6af7), UINT64_C(0x09bbffe62170dfc5)}}},
+  {{{ UINT64_C(0x4c67b2ac7835f267), UINT64_C(0x632cbe7014a1a458), UINT64_C(0x94d5c2b72545b0d7)}},
+   {{ UINT64_C(0x3b4192a043cc6b88), UINT64_C(0x481ed70c8320d1d9), UINT64_C(0xcb269f4997263877)}}},
+  {{{ UINT64_C(0x1cc9db2dc2aa5f36), UINT64_C(0x5ffeebd45b8aa477), UINT64_C(0x6f93de2642238140)}},
+   {{ UINT64_C(0x04da8e35fe117d96), UINT64_C(0xe394ccdc58bb2117), UINT64_C(0x450ca151b05e4db5)}}},
+  {{{ UINT64_C(0x352433d8ee283ca7), UINT64_C(0x96e545bae4d54cb5), UINT64_C(0x734241e82035af2d)}},
+   {{ UINT64_C(0x48c700aa00033691), UINT64_C(0x9e7948da51816333), UINT64_C(0xb28cb8970f1ad1f3)}}},
+  {{{ UINT64_C(0x24b3fe7cce7ff883), UINT64_C(0x7043990c2f6c0495), UINT64_C(0x97b49fdff68953a0)}},
+   {{ UINT64_C(0xd5313e78d4707d88), UINT64_C(0xcf9cb9c2e5b63421), UINT64_C(0x2bcb25ebd11dcc25)}}},
+  {{{ UINT64_C(0x49942681fb3ec751), UINT64_C(0x60c8558e0cb5b06e), UINT64_C(0xe8d87da5035c5450)}},
+   {{ UINT64_C(0x551df71c61bb60eb), UINT64_C(0x7d907a5fb328e063), UINT64_C(0x70cfa517c692f212)}}},
+  {{{ UINT64_C(0x314b7ffd9f5a591e), UINT64_C(0x753f56bd19364724), UINT64_C(0x8f59495ba96f94ac)}},
+   {{ UINT64_C(0x6d0db6aec87ec3e6), UINT64_C(0x43fa25f29900daaa), UINT64_C(0xe8a7717a7a0ca173)}}},
+  {{{ UINT64_C(0x4eaafabd09488136), UINT64_C(0x9b8d6c95418e49c6), UINT64_C(0xc71b0f900080ebb2)}},
+   {{ UINT64_C(0x3ab44012cf53a42f), UINT64_C(0xb2b824f69174a0a9), UINT64_C(0xb67dcc2bd9a364cb)}}},
+  {{{ UINT64_C(0x9e24991db207a84b), UINT64_C(0x6d00a42e61d40a26), UINT64_C(0x71768349ff02239a)}},
+   {{ UINT64_C(0xef33bec689b62849), UINT64_C(0xc5407a74074127b1), UINT64_C(0xb298adacf1ba1696)}}},
+  {{{ UINT64_C(0x235c836c10c27daa), UINT64_C(0x27306b0fdc69bd75), UINT64_C(0xd5873e9c3a941152)}},
+   {{ UINT64_C(0x8d8d9f7dd0fc8390), UINT64_C(0x00723e8d39d7c1c8), UINT64_C(0x4f1a2a9eecb7d85c)}}},
+  {{{ UINT64_C(0xb112eb055b90c771), UINT64_C(0x1712f529a6ab524c), UINT64_C(0x9da52a0b0b07da72)}},
+   {{ UINT64_C(0x3fac95cf980b35f6), UINT64_C(0x253ba6df8bbaea34), UINT64_C(0x66c12bf07cd59acd)}}},
+  {{{ UINT64_C(0x9be452cd0ef7ca7c), UINT64_C(0xde34dc82cad3de93), UINT64_C(0x29078cd61836d894)}},
+   {{ UINT64_C(0xe5fec0638ae8b507), UINT64_C(0xacdd83941d1b6565), UINT64_C(0xbab23d61681ced41)}}},
+  {{{ UINT64_C(0x43404815be2bb39c), UINT64_C(0xf055f8cd01921a6b), UINT64_C(0xc9121397f8f33061)}},
+   {{ UINT64_C(0xce9eea8dfc1810d4), UINT64_C(0x2beeb21614d0eacd), UINT64_C(0xe2db6a437a5e743c)}}},
+  {{{ UINT64_C(0x38d8d6ba237f6085), UINT64_C(0xd23beb3892ca2fca), UINT64_C(0xd9e18a4264847340)}},
+   {{ UINT64_C(0x93098bddeb004529), UINT64_C(0x0872a11cde8b3116), UINT64_C(0x580d6b1bd6a5f92f)}}},
+  {{{ UINT64_C(0x58c5efa4c547924e), UINT64_C(0xf5880505d0c3a8ab), UINT64_C(0x589ed6da788d6a4d)}},
+   {{ UINT64_C(0xc9193b035a3fd188), UINT64_C(0xb9245a58142c4a85), UINT64_C(0xa99b3351f61daa15)}}},
+  {{{ UINT64_C(0xb199afafb85f9fe7), UINT64_C(0x3300a91626cff3ab), UINT64_C(0x7f9941720462f5f8)}},
+   {{ UINT64_C(0x70b4ff938844fb03), UINT64_C(0x732bf2fad19808e7), UINT64_C(0xab5c659795e8fbd9)}}},
+  {{{ UINT64_C(0xefda0597d8628167), UINT64_C(0x78a81d28560cd71d), UINT64_C(0x949f1c0b9b5fa654)}},
+   {{ UINT64_C(0xc4058f500d5f81ba), UINT64_C(0x1d6bdc2df4dc02cf), UINT64_C(0xa21cb93e730f6798)}}},
+  {{{ UINT64_C(0xcc0b89ecee794ecd), UINT64_C(0x5898a03a0d47413b), UINT64_C(0x5bb902ba6f4e1e01)}},
+   {{ UINT64_C(0xaac0ca0ede788ae6), UINT64_C(0xf801bc88e65710bb), UINT64_C(0xd1a8e891e8a4c64b)}}},
+  {{{ UINT64_C(0xab84df1da2163a7e), UINT64_C(0xe0ce31007a11fe3c), UINT64_C(0x40d77670d5217a51)}},
+   {{ UINT64_C(0x5858db960651feea), UINT64_C(0x4ae6e0dbf25012f5), UINT64_C(0x98136d93b7d438f1)}}},
+  {{{ UINT64_C(0xab6665114aaf6276), UINT64_C(0xff437c2016162a33), UINT64_C(0xc5cc2b5f876ef7cd)}},
+   {{ UINT64_C(0x34debec2019479df), UINT64_C(0xb84ffde009462d63), UINT64_C(0xd23f4c4afd640cb9)}}},
+  {{{ UINT64_C(0xcea1608b1710ff57), UINT64_C(0x325cfc3024468c55), UINT64_C(0x7b8ed3b48969733a)}},
+   {{ UINT64_C(0xa2edf75ddaa14baf), UINT64_C(0x3a22637338f4a094), UINT64_C(0x83fb9e233d6094c2)}}},
+  {{{ UINT64_C(0xb88ce32b04d03f0b), UINT64_C(0x23568b13ed5aea89), UINT64_C(0x0e33c9684d80ec87)}},
+   {{ UINT64_C(0xeba4645bc2d92307), UINT64_C(0x573fc14f8fb18e04), UINT64_C(0x9d65938bddfa9b32)}}},
+  {{{ UINT64_C(0x26c201d6e540ab12), UINT64_C(0x6467ee56fdb9bf45), UINT64_C(0xb3b497207f87a192)}},
+   {{ UINT64_C(0xd9710a985e75d0c4), UINT64_C(0x8bcf36a935a37a83), UINT64_C(0xf4f4782308f9e8f1)}}},
+  {{{ UINT64_C(0x6b4c4252163d9e8a), UINT64_C(0x557b09c2e6ece58f), UINT64_C(0x536e361a3190675e)}},
+   {{ UINT64_C(0x728203cf97721c67), UINT64_C(0x1201af15b0033533), UINT64_C(0xab03486e2e1930cf)}}},
+  {{{ UINT64_C(0x04347c0af2984b0b), UINT64_C(0x1a03047e8b14b013), UINT64_C(0x222a95b056b31c34)}},
+   {{ UINT64_C(0x5f5e2dce8682bfd6), UINT64_C(0xfb30276a531df47a), UINT64_C(0x9ce29412f5f22930)}}},
+  {{{ UINT64_C(0xc87a160a80d01810), UINT64_C(0x9fda656add03150c), UINT64_C(0xcf23cb73ac97c7a5)}},
+   {{ UINT64_C(0xdf4fd2e1fac6fa21), UINT64_C(0x47496a383ac9890c), UINT64_C(0xdbb2858f803de0be)}}},
+  {{{ UINT64_C(0x421d43650269eff5), UINT64_C(0xd1dc049b50078703), UINT64_C(0x6fa75e9d7085f40d)}},
+   {{ UINT64_C(0xd24126ed6699fd07), UINT64_C(0x114ab9d29c2bfc5a), UINT64_C(0xed61a43e214f071c)}}},
+  {{{ UINT64_C(0xe4acff9c27f0bf10), UINT64_C(0xb8861ac353533c8c), UINT64_C(0x14e6574c29d6e994)}},
+   {{ UINT64_C(0xee9e0de248f43b1d), UINT64_C(0x28560d929b6498d3), UINT64_C(0xaa80892901e062ac)}}},
+  {{{ UINT64_C(0x391aa8a751eba815), UINT64_C(0x461c75a1453f4b98), UINT64_C(0x2d6c645ae917136a)}},
+   {{ UINT64_C(0xc12b531ae54aa5f4), UINT64_C(0x06c53c1d8c9e8014), UINT64_C(0x9f174da7bb5d1e7b)}}},
+  {{{ UINT64_C(0x1adbaddfe486225f), UINT64_C(0xf5ac0c1e142d36c8), UINT64_C(0xdb340a526d37be1b)}},
+   {{ UINT64_C(0x0a7ca9de956491b7), UINT64_C(0xb50753190b9f183c), UINT64_C(0x8193f7471fc460c8)}}},
+  {{{ UINT64_C(0x312cc82e4b70c7f8), UINT64_C(0x8cbaf2da37bbefa2), UINT64_C(0x78ddbcbb5bed85ef)}},
+   {{ UINT64_C(0x97439f72a3854960), UINT64_C(0x440d6e21c5ef4537), UINT64_C(0x1860dd57ef9ac09d)}}},
+  {{{ UINT64_C(0xea30bb07e85ee059), UINT64_C(0xdad6c80f653990a4), UINT64_C(0xbe1c901016eb2f8b)}},
+   {{ UINT64_C(0x7b8de97eaaab463b), UINT64_C(0x3308e124df6798b4), UINT64_C(0xb2be93ccf79083a6)}}},
+  {{{ UINT64_C(0xd89cfde04fca0244), UINT64_C(0x59cbfcae821482f7), UINT64_C(0x224f335aa895d2a7)}},
+   {{ UINT64_C(0x1aa8afbea66d0e27), UINT64_C(0x91b722be8bd4e0b4), UINT64_C(0x6abd57496022f8cb)}}},
+  {{{ UINT64_C(0x16547575465e3c05), UINT64_C(0xd3b7423dd9e4234e), UINT64_C(0xc560a032859f9e77)}},
+   {{ UINT64_C(0x36d0cc607458a025), UINT64_C(0xd645ccd9ff375944), UINT64_C(0xd6fcf3fa61c128e6)}}},
+  {{{ UINT64_C(0x91dd938a44c59767), UINT64_C(0xa9439fd8872a485e), UINT64_C(0x23e9fc56d8cc9234)}},
+   {{ UINT64_C(0x858ad7ef6b6d3bd8), UINT64_C(0xd92a5db7215ce5dd), UINT64_C(0x55906861e93e7a1a)}}},
+  {{{ UINT64_C(0xf54aa2411bf41ecb), UINT64_C(0x874688ef21b70007), UINT64_C(0xd4673f7e04903716)}},
+   {{ UINT64_C(0x6707f032e5bbd079), UINT64_C(0x1ba3d63d382ef7bd), UINT64_C(0x55acab6c44b57449)}}},
+  {{{ UINT64_C(0x12bcc9b4e2d74b23), UINT64_C(0xda3090691f38c523), UINT64_C(0x78ca6487e065b082)}},
+   {{ UINT64_C(0xf9d752df0fae43a4), UINT64_C(0xee78b6ceaf8389e5), UINT64_C(0x8fae0b5e65d8d5c4)}}},
+  {{{ UINT64_C(0x1981783f8efd80cc), UINT64_C(0x7dd33830c0b6a771), UINT64_C(0xcf95f51ca709f97e)}},
+   {{ UINT64_C(0x9a263c8926b72468), UINT64_C(0xddd3614c8ce678e5), UINT64_C(0x215ddcb729eb106f)}}},
+  {{{ UINT64_C(0x02eb43459fbb7abc), UINT64_C(0x8f98352c0fcc242d), UINT64_C(0x6081ff25aab4a235)}},
+   {{ UINT64_C(0x4d15d174571b73ca), UINT64_C(0xeae6a41f19db1c33), UINT64_C(0xf10ff4ef8b80b515)}}},
+  {{{ UINT64_C(0x1618aa4774ee3d23), UINT64_C(0xea2b971042c6103f), UINT64_C(0xff4c93c2eb8b76ea)}},
+   {{ UINT64_C(0xf98332271fd3723b), UINT64_C(0xc8a1f428f1aa0909), UINT64_C(0xc74cf9bf9568e584)}}},
+  {{{ UINT64_C(0x36ed76ee2e031887), UINT64_C(0x1fafefd670f41510), UINT64_C(0xec69ba6a14e9ae52)}},
+   {{ UINT64_C(0x2032f4aa565bc20a), UINT64_C(0x21a4a11ff42bc3ea), UINT64_C(0x5e65a13e259a7ee6)}}},
+  {{{ UINT64_C(0xc6cb26e3687f5ec2), UINT64_C(0x653cafe590a9a350), UINT64_C(0xa64de7cb2896daa4)}},
+   {{ UINT64_C(0xbefb12a36c77af8b), UINT64_C(0x95f6f80400942b1f), UINT64_C(0x78738f755b98efd8)}}},
+  {{{ UINT64_C(0x70d26b67ae6e7f39), UINT64_C(0xae32cd2c1244b237), UINT64_C(0x677351b3fad45113)}},
+   {{ UINT64_C(0xfc21b3470a709ab3), UINT64_C(0xd840a7427765ca70), UINT64_C(0xd82043e09156e6c8)}}},
+  {{{ UINT64_C(0x75c824f4e5e951e3), UINT64_C(0xac722fe051091206), UINT64_C(0xb7381dd63892b895)}},
+   {{ UINT64_C(0xe83208d213086cec), UINT64_C(0x40134bfff8f62894), UINT64_C(0x919b523f7b518a02)}}},
+  {{{ UINT64_C(0xf827bcbc60c99581), UINT64_C(0xa2d951004b070827), UINT64_C(0xf16695153d9b62b6)}},
+   {{ UINT64_C(0xd94cfeec81ccf911), UINT64_C(0x5e6eb69dad55c276), UINT64_C(0xa825559135aac09c)}}},
+  {{{ UINT64_C(0x02bb8c6e36c01fab), UINT64_C(0xb10132736cde0f63), UINT64_C(0x2db1e071bced4436)}},
+   {{ UINT64_C(0x85105db5fd7cbbfc), UINT64_C(0x50e9ac66e0cb743e), UINT64_C(0xe336031f4d8d025d)}}},
+  {{{ UINT64_C(0xd5565db71d83b370), UINT64_C(0xe031c978b7c1967f), UINT64_C(0xca888877f457b6bd)}},
+   {{ UINT64_C(0xe6989a3075fd87dc), UINT64_C(0x0a64b0f60acc7d01), UINT64_C(0xc194407634480428)}}},
+  {{{ UINT64_C(0x46773cacfb1ffbbf), UINT64_C(0xa8dbe70f4c1577a4), UINT64_C(0xf715258d1441196d)}},
+   {{ UINT64_C(0x6406deacc8746709), UINT64_C(0x4e7440f76654abda), UINT64_C(0x01f9b32c0426b8c1)}}},
+  {{{ UINT64_C(0x6dedeb2f2bbf7185), UINT64_C(0xb697fba8e4f0fe7b), UINT64_C(0x1968a32b908547af)}},
+   {{ UINT64_C(0x4ef33d3f6330983b), UINT64_C(0x49d2ccc75d487949), UINT64_C(0x37d305d64e5cd1d2)}}},
+  {{{ UINT64_C(0xe9b9bcd5919f7b68), UINT64_C(0x7c829669127314a8), UINT64_C(0x8c4d011d2bd62aaf)}},
+   {{ UINT64_C(0x08bf6a35dc5f9c31), UINT64_C(0xcb8a4fc7fa0ff87b), UINT64_C(0x5fd134c7d613599f)}}},
+  {{{ UINT64_C(0x0b96f49165f994e5), UINT64_C(0x122861e193bfde21), UINT64_C(0xaa084705851bba10)}},
+   {{ UINT64_C(0x59a45ca6d1a5fbff), UINT64_C(0x650424b9c859bfe0), UINT64_C(0xf3772eaf85bcad35)}}},
+  {{{ UINT64_C(0x42230378ab9bd5d7), UINT64_C(0x4f57976c05bc13c6), UINT64_C(0x9598f7368af583e1)}},
+   {{ UINT64_C(0xf002d34e4c0dd01c), UINT64_C(0xf9b004dd41ab75e0), UINT64_C(0x732cbecbcd235441)}}},
+  {{{ UINT64_C(0xc4d62e90df0b2d69), UINT64_C(0x660711c3ec2faf90), UINT64_C(0x4860937cb3215dd7)}},
+   {{ UINT64_C(0xc624390b8246e073), UINT64_C(0xf200a65b575a2723), UINT64_C(0xc63261b6551d2e3b)}}},
+  {{{ UINT64_C(0xb6db8443ab570622), UINT64_C(0xde7704e8159e4d22), UINT64_C(0x4c0776df6504d4b6)}},
+   {{ UINT64_C(0x9bb1a963cb0d72f8), UINT64_C(0x4769762346d8d8b0), UINT64_C(0x8e2b4a32c342020b)}}},
+  {{{ UINT64_C(0xffffac3afec4bc71), UINT64_C(0x7f419b5af396bdb0), UINT64_C(0xbc222e1e5567574f)}},
+   {{ UINT64_C(0x4b020e8963856e2b), UINT64_C(0xb33c82f22aa40e1e), UINT64_C(0x6983dc279133d90a)}}},
+  {{{ UINT64_C(0x7ab65be59c469f52), UINT64_C(0xc9d0e1ae5e17d7a8), UINT64_C(0xbb8b0c8234dffa33)}},
+   {{ UINT64_C(0x3ba6a2933b3b1741), UINT64_C(0x9c59adedbb985e75), UINT64_C(0xfe31ab3345296f93)}}},
+  {{{ UINT64_C(0x22dc643e0fb46e48), UINT64_C(0x00a4eeb576159825), UINT64_C(0x4f677cb286785388)}},
+   {{ UINT64_C(0x1fcd22b5035169c7), UINT64_C(0x9ae2b3a907abecfe), UINT64_C(0xe06d31a5fa552dcc)}}},
+  {{{ UINT64_C(0x439af5d6ec8ed98f), UINT64_C(0x14aa0e8edaa88ac9), UINT64_C(0x7bb7577c62c0ca84)}},
+   {{ UINT64_C(0x97b9b5992bf7fd1c), UINT64_C(0xc29bf6e2fcb5150e), UINT64_C(0x974e259260e9c698)}}},
+  {{{ UINT64_C(0x9e264a9812c3e3c6), UINT64_C(0x862cf328cbe05a39), UINT64_C(0xec7dc7977a4db763)}},
+   {{ UINT64_C(0x52babefceb885821), UINT64_C(0x780f0f80a44efb24), UINT64_C(0xe05150bddc9b59de)}}},
+  {{{ UINT64_C(0x273e270b10245982), UINT64_C(0x60bdf6f06ac74543), UINT64_C(0xc46c1fb776f2e628)}},
+   {{ UINT64_C(0x17c21b86a761cbca), UINT64_C(0x916d3da5baf2b562), UINT64_C(0xe6ae9890b6951ca0)}}},
+  {{{ UINT64_C(0x8b2328e040bf5379), UINT64_C(0xf0098813ae42ea60), UINT64_C(0x6748dca1501cd653)}},
+   {{ UINT64_C(0x43ae2e2b88418c66), UINT64_C(0xfed76bd617d813cd), UINT64_C(0x8ab73b4dad8eba25)}}},
+  {{{ UINT64_C(0x6f3e63762bb1e166), UINT64_C(0x45fc97052fc06388), UINT64_C(0xf8592e28b323d1ea)}},
+   {{ UINT64_C(0xf96361e852e37937), UINT64_C(0xa540a87050e19967), UINT64_C(0x6f7e9a5d7c16138f)}}},
+  {{{ UINT64_C(0xc751dcbc4961e17e), UINT64_C(0x36abaa9c4a7ef9dd), UINT64_C(0x37a6f24957fb5345)}},
+   {{ UINT64_C(0xa12c6b1027a30d2c), UINT64_C(0xbe1b54f333583b43), UINT64_C(0x5aaf22cf74b4e365)}}},
+  {{{ UINT64_C(0x295e3970e934f343), UINT64_C(0xc3da30a0ab760b00), UINT64_C(0xbc5d4c54d9315a6f)}},
+   {{ UINT64_C(0xfa3a36a407c57b99), UINT64_C(0x25c9f6fc99745941), UINT64_C(0x9259bc580b8719a9)}}},
+  {{{ UINT64_C(0x47d74fd862c9824b), UINT64_C(0x758fb2b35bfa895c), UINT64_C(0x0ae975e59e66ed63)}},
+   {{ UINT64_C(0xdfeb26eec1fa06f5), UINT64_C(0xa36dca3acd673e79), UINT64_C(0xa3fbd53863e80509)}}},
+  {{{ UINT64_C(0x3147d6f26931e327), UINT64_C(0x6e2398f39b67b544), UINT64_C(0x46e0e2daf7d89701)}},
+   {{ UINT64_C(0xab7183acbf6f4b25), UINT64_C(0x9309b253bf4149a0), UINT64_C(0xc7f0db4912bf9bff)}}},
+  {{{ UINT64_C(0xc79ef94bf7612bae), UINT64_C(0x9ad3aacb9cbb146f), UINT64_C(0xadb18ee5a8d6c7da)}},
+   {{ UINT64_C(0x82ce496ca0fd81b9), UINT64_C(0xfd89f9f2bfc72fe4), UINT64_C(0x705b2c3f7c96b85f)}}},
+  {{{ UINT64_C(0xa95571353eea9329), UINT64_C(0xd9b4bd4b195f9059), UINT64_C(0x05911f448b551c33)}},
+   {{ UINT64_C(0x71b1c0d4b6a99ae1), UINT64_C(0x8b1af7e7a7df6cb5), UINT64_C(0xf0cbe6d567da12f3)}}},
+  {{{ UINT64_C(0xbef9acfae82294ac), UINT64_C(0x5fab000857687a36), UINT64_C(0xc89936f13d034713)}},
+   {{ UINT64_C(0x225ec21ef35abc55), UINT64_C(0x157f038b0acf3a26), UINT64_C(0x4902a925be09f222)}}},
+  {{{ UINT64_C(0x405856c54bc6f14f), UINT64_C(0xea24a1ea5aa98829), UINT64_C(0xe5782038602c79b6)}},
+   {{ UINT64_C(0x834bfc2c73ca84f1), UINT64_C(0xd4a2aba5c4d6537f), UINT64_C(0xcedf70b9ca299f13)}}},
+  {{{ UINT64_C(0x06032d24413b7d20), UINT64_C(0x0efb567ba740a0fe), UINT64_C(0x9dd22dc25418bff6)}},
+   {{ UINT64_C(0xc25b98a3e49d4d35), UINT64_C(0xdd99ed25928dd464), UINT64_C(0xafbd5a48c3899312)}}},
+  {{{ UINT64_C(0xe6caa9102a2d5cf2), UINT64_C(0xc2718877af9bb8f6), UINT64_C(0x25b69db4eb5f44d2)}},
+   {{ UINT64_C(0x67be44b1fc4af7f0), UINT64_C(0xc3eac477063a25a5), UINT64_C(0x51d110b9617be74e)}}},
+  {{{ UINT64_C(0x4e31244d7010ff88), UINT64_C(0x1f4f8cc78c111159), UINT64_C(0x45be08e240aeb706)}},
+   {{ UINT64_C(0x889e67d3513f4d2b), UINT64_C(0x0b35e3cea6c2d4e3), UINT64_C(0xd99d39d30d0ed410)}}},
+  {{{ UINT64_C(0x9e11caaf3d73114d), UINT64_C(0x3fcdb343f0b89fa9), UINT64_C(0xa6c8cf80bed5a00f)}},
+   {{ UINT64_C(0x3928a8fbde4bd897), UINT64_C(0x3d3c42525617412b), UINT64_C(0xf001e3960ead2f60)}}},
+  {{{ UINT64_C(0xd201feeebfe47ab3), UINT64_C(0x623516a41180281d), UINT64_C(0x3ee51d7cd21f6b97)}},
+   {{ UINT64_C(0x169a626a2b8a6a4d), UINT64_C(0x18584edbb50890a5), UINT64_C(0x3e83d2f6f67f1a0f)}}},
+  {{{ UINT64_C(0x566b13f8ad6c6ff8), UINT64_C(0x87df27a80aea24b4), UINT64_C(0xe338374a0533848f)}},
+   {{ UINT64_C(0x2df8c77c6017bc1a), UINT64_C(0xfc60e8fe4fbf0680), UINT64_C(0x5f2d66e197096607)}}},
+  {{{ UINT64_C(0x4ede7263c7948408), UINT64_C(0xe5e0f64abb048e77), UINT64_C(0x7b16bfa62527190d)}},
+   {{ UINT64_C(0x28e66d07c48dee67), UINT64_C(0x3ac298c4b02f44e9), UINT64_C(0x711ff433fda97a63)}}},
+  {{{ UINT64_C(0x6ab7b498c23f4038), UINT64_C(0x9ebcd45300fe4daf), UINT64_C(0xa6203d5d3c8e7a8f)}},
+   {{ UINT64_C(0xb04cf1bb71aeddf8), UINT64_C(0xa5072e36c9ff10dd), UINT64_C(0xde8c3efdeec492e5)}}},
+  {{{ UINT64_C(0xc93745959d094d6f), UINT64_C(0x767fc4a9a5bec9bc), UINT64_C(0x3a6be60161e64e28)}},
+   {{ UINT64_C(0x1750daecccd81026), UINT64_C(0x20ae076860c7a2ac), UINT64_C(0x66db28c47a84b5b6)}}},
+  {{{ UINT64_C(0xd8241943d16c43e8), UINT64_C(0xac1f01a1980f9066), UINT64_C(0x4caa2db53717fe74)}},
+   {{ UINT64_C(0x81e712f35ad3a5d8), UINT64_C(0xbb75b5233a3c542f), UINT64_C(0xe9599fa6fa82179e)}}},
+  {{{ UINT64_C(0xabb9b6922b87610c), UINT64_C(0xef7317cc18091ba3), UINT64_C(0xd95cf6dc50dfb134)}},
+   {{ UINT64_C(0xdb50ee07f38ecd4a), UINT64_C(0x2e5c1d288724526e), UINT64_C(0xc711f87df90bef64)}}},
+  {{{ UINT64_C(0x72dea4cf7112207e), UINT64_C(0xd6b8323db15932aa), UINT64_C(0xf76dcf1a025a2472)}},
+   {{ UINT64_C(0xd8478a7dcd3b525d), UINT64_C(0x5eea5faa60a611d0), UINT64_C(0x5b9a1b499aab5d8a)}}},
+  {{{ UINT64_C(0x42be9842c796aa20), UINT64_C(0x554ac916f4f596b8), UINT64_C(0xa6e09d4a0697ee78)}},
+   {{ UINT64_C(0x4746f2c526b5903d), UINT64_C(0x837ff154a305dab2), UINT64_C(0x42f3926f536ff6e9)}}},
+  {{{ UINT64_C(0x3e6dfbeba8bcea0b), UINT64_C(0x4e63e3ad9fcb5ea6), UINT64_C(0xd81bd137b2eced23)}},
+   {{ UINT64_C(0x4d1ac529f3f2dd0d), UINT64_C(0x094a1bf1dfba916a), UINT64_C(0x8db38ec7366deb93)}}},
+  {{{ UINT64_C(0x91fa9cb02b0c96e3), UINT64_C(0x7b34b5126566cea6), UINT64_C(0x0205d93334454aeb)}},
+   {{ UINT64_C(0x613362095d5cb263), UINT64_C(0xc0ea2965b14b6e6a), UINT64_C(0x2e5b8a23fe01445d)}}},
+  {{{ UINT64_C(0x8abe6e021158f30f), UINT64_C(0xf13d84df52ff6479), UINT64_C(0x48af6c1006916763)}},
+   {{ UINT64_C(0xca7f32024100c80e), UINT64_C(0x96fa1cdcac6b59a9), UINT64_C(0x4ab5ea79810d8261)}}},
+  {{{ UINT64_C(0xebe9a7f563566c0f), UINT64_C(0xd1f75015f957b7d0), UINT64_C(0x7ae9b90d79a7edc6)}},
+   {{ UINT64_C(0x47964aa7bcd28e8a), UINT64_C(0x44f8754202e18099), UINT64_C(0xcde95b9fa6e8fb3b)}}},
+  {{{ UINT64_C(0xbc7a7c31ea88a667), UINT64_C(0x63e6fbe03099ca5d), UINT64_C(0x391aee7a987a23f6)}},
+   {{ UINT64_C(0x7626c5eb3a35a2f4), UINT64_C(0x9a44583dfc04cd79), UINT64_C(0x0c75bdd477fc77fa)}}},
+  {{{ UINT64_C(0x4879f125dbf14f1e), UINT64_C(0x6b931478eb77e6b0), UINT64_C(0x218856e8bb86a9e8)}},
+   {{ UINT64_C(0xc25297c35c1397d9), UINT64_C(0xc74231a18184641f), UINT64_C(0x5ff607a72a4a9bdf)}}},
+  {{{ UINT64_C(0x1a8ea74e5524422a), UINT64_C(0xeaaec24353363c2a), UINT64_C(0xa25d057d7afe255a)}},
+   {{ UINT64_C(0x820f4492446fd6f4), UINT64_C(0xf26f64e5ad00ae01), UINT64_C(0x2cc93b454cd96c07)}}},
+  {{{ UINT64_C(0xdbd98892b3e314ea), UINT64_C(0x7d16b66de8c95de7), UINT64_C(0x7c27dca256e3bf88)}},
+   {{ UINT64_C(0x7cab522c78136764), UINT64_C(0x0c9a27b0f8f79f4f), UINT64_C(0x4c4ad493e6eddc59)}}},
+  {{{ UINT64_C(0x6e7e93dfabd9c12a), UINT64_C(0x8d613d681511ee67), UINT64_C(0xc5aeaa822801f6bd)}},
+   {{ UINT64_C(0x5767005244573d47), UINT64_C(0xab5f2f3142f6537c), UINT64_C(0xb51672a7956ca813)}}},
+  {{{ UINT64_C(0x7c85155de90f1969), UINT64_C(0x5fcc501cfa7d7b35), UINT64_C(0x05875663c3c03286)}},
+   {{ UINT64_C(0x5a6b809008d4af7b), UINT64_C(0x86f905402d3a50a9), UINT64_C(0xd08dd6d9861593b6)}}},
+  {{{ UINT64_C(0xfd840d7b02fca1ea), UINT64_C(0xadcc26c521ff4374), UINT64_C(0x9245f9958cc6b1dd)}},
+   {{ UINT64_C(0x12d4c70113a8ae46), UINT64_C(0xcac6da6d3c7f4bfa), UINT64_C(0x8e1e034799a5a96a)}}},
+  {{{ UINT64_C(0xe617f3a2948b225b), UINT64_C(0xf9ab7a71562bb7a6), UINT64_C(0x717c82a545b72fd3)}},
+   {{ UINT64_C(0xd6e81046f5b20a84), UINT64_C(0x49b09d93490269f8), UINT64_C(0x57360dbf69c8b0f1)}}},
+  {{{ UINT64_C(0x829cd4cb5765b5ca), UINT64_C(0xc34a43d84537d057), UINT64_C(0xef37b1823d34a685)}},
+   {{ UINT64_C(0xe6c54d895f226e24), UINT64_C(0x34e615e6c23ff5b7), UINT64_C(0x93bf026961f56d9e)}}},
+  {{{ UINT64_C(0xe5e83ec92f5650f1), UINT64_C(0x3eddc384a2dee51d), UINT64_C(0x8b5960fa74b1082b)}},
+   {{ UINT64_C(0xc300b17e89452a66), UINT64_C(0x9ccb4caf1e84960c), UINT64_C(0x4bc3464241a08148)}}},
+  {{{ UINT64_C(0x3b9dd2807ed3ee1a), UINT64_C(0x84e2881af464355f), UINT64_C(0x3f4cb5bade8c360a)}},
+   {{ UINT64_C(0x46d3d7344a6d7eed), UINT64_C(0xee6069623ab56f84), UINT64_C(0x82daf75778b93b4b)}}},
+  {{{ UINT64_C(0x22b13e10d40404d2), UINT64_C(0xe69b6584932fddc3), UINT64_C(0x21026f26dbba314a)}},
+   {{ UINT64_C(0xb9637e38cf13a44e), UINT64_C(0xcf307d9f61a41871), UINT64_C(0x125376516d45a6f3)}}},
+  {{{ UINT64_C(0x16d68d84a429d3d2), UINT64_C(0xc2ef9b8158daf4d5), UINT64_C(0xec7fe1ef61423c15)}},
+   {{ UINT64_C(0x25e61ad8742fa535), UINT64_C(0x5127d852667874a3), UINT64_C(0x2628020da7eca041)}}},
+  {{{ UINT64_C(0x848a34f7110b4691), UINT64_C(0xb7637b5121f980f6), UINT64_C(0x9e4bfdc614191bc4)}},
+   {{ UINT64_C(0xcc6c6dd79e4cc612), UINT64_C(0xc74db99bf030fa32), UINT64_C(0xfc0d3b0c6f4b5c74)}}},
+};
+
+static const mzd_row192x2_t LK_3[] = {
+  {{{ UINT64_C(0x2ee637cd06f00878), UINT64_C(0x83de691082849931), UINT64_C(0x76ef555fa1ae11b0)}},
+   {{ UINT64_C(0x3df93eb8b10598bb), UINT64_C(0x8d1d46ac008e0a02), UINT64_C(0x53a38800439f170d)}}},
+  {{{ UINT64_C(0xf929f375583c505a), UINT64_C(0xabbe82439f3f29d3), UINT64_C(0x0fd06f74ee9ef0e6)}},
+   {{ UINT64_C(0x10dd6fe9ccdd2e3d), UINT64_C(0x70a99e9b8fdafb69), UINT64_C(0xd301d0d4a554ed06)}}},
+  {{{ UINT64_C(0x8f0e70474cda4023), UINT64_C(0xd98eed07f731e8a4), UINT64_C(0xb72e2681b2090174)}},
+   {{ UINT64_C(0xce56786ceb85c3ec), UINT64_C(0xb61242b38ff03bed), UINT64_C(0x92f8201f7e27a224)}}},
+  {{{ UINT64_C(0x1be590952432c23e), UINT64_C(0x16538ab19587513b), UINT64_C(0x40c418c2ac49f482)}},
+   {{ UINT64_C(0xf6b1f0f68c98a9b2), UINT64_C(0xfea8e0d88f3b641e), UINT64_C(0xadbcacbf6804c049)}}},
+  {{{ UINT64_C(0x24ce98e5d468107b), UINT64_C(0x4c6c94d286577292), UINT64_C(0x27946077b434343d)}},
+   {{ UINT64_C(0x31dcc287aa17628d), UINT64_C(0x11f1dcd78ca4d04f), UINT64_C(0x5e9a08bc88292046)}}},
+  {{{ UINT64_C(0x9ee20aabcb2baf0c), UINT64_C(0xee74eab4ac3fc032), UINT64_C(0x31e61433fbcd926d)}},
+   {{ UINT64_C(0x048ec833ba07bd9e), UINT64_C(0xf94684cdb896b2df), UINT64_C(0xeaa10f4168bbe472)}}},
+  {{{ UINT64_C(0x15e11074b2095d38), UINT64_C(0x2be0e2b691f333b0), UINT64_C(0x91b608225af99294)}},
+   {{ UINT64_C(0x7d4ac8056109df92), UINT64_C(0xeff33f5384f3e81e), UINT64_C(0x5adc1ac38c5628bb)}}},
+  {{{ UINT64_C(0x124512f1d5bc85ff), UINT64_C(0xe7662751ec8abe0a), UINT64_C(0xbc20f097712e6ded)}},
+   {{ UINT64_C(0x8a8468023e509edf), UINT64_C(0x422b772fd17e98aa), UINT64_C(0x6e8dab2cdf19c18d)}}},
+  {{{ UINT64_C(0x7975d6dcc532acc5), UINT64_C(0xf7915f1dc63f22d3), UINT64_C(0xb5b626afb9373c38)}},
+   {{ UINT64_C(0x574f6d143edec6b9), UINT64_C(0x16f37d9a606867db), UINT64_C(0x3bcd0c9cf1349900)}}},
+  {{{ UINT64_C(0x39c4d8bc2cb28baf), UINT64_C(0x1be53d1911073d80), UINT64_C(0x96ead496d6ba77c1)}},
+   {{ UINT64_C(0x68e223dc04ba513f), UINT64_C(0xdcfd18e009019dad), UINT64_C(0x774f3eab01ad174f)}}},
+  {{{ UINT64_C(0x1142cf13feb995fb), UINT64_C(0x3e40aa0a1a95db22), UINT64_C(0x48cc0e542c11476a)}},
+   {{ UINT64_C(0x55f7395e634c4c53), UINT64_C(0xe1373e5893494833), UINT64_C(0x771725b843a73e54)}}},
+  {{{ UINT64_C(0xfa6ad4be451a7fb2), UINT64_C(0xc873bf9cbf09c854), UINT64_C(0x4ffe72009d2a3d6d)}},
+   {{ UINT64_C(0x8200875bbbf9cf8f), UINT64_C(0x23e87555c7a3f373), UINT64_C(0x51fa6ae9f99a295f)}}},
+  {{{ UINT64_C(0x577ab19f11158d24), UINT64_C(0x7e8bad86eb147835), UINT64_C(0x3459e048e034bc52)}},
+   {{ UINT64_C(0x87efdf02b9e409ad), UINT64_C(0xbb1bf85244e88596), UINT64_C(0xda9bbd346104bc0e)}}},
+  {{{ UINT64_C(0x459be0f70185fd71), UINT64_C(0xb0a611b54ed555d5), UINT64_C(0x5ef0b904841a62fe)}},
+   {{ UINT64_C(0x5e531343e3bd5ecd), UINT64_C(0xefeb154906ed6b0f), UINT64_C(0x99908b2fa13acda0)}}},
+  {{{ UINT64_C(0x0eb7eb8dfeacac85), UINT64_C(0x1633933c1d2e0826), UINT64_C(0x7db0dc9c60961b83)}},
+   {{ UINT64_C(0x589e37ca8a3df8c3), UINT64_C(0x5c70425460a8de68), UINT64_C(0x96e47711e43ad753)}}},
+  {{{ UINT64_C(0xfa658433adaf299c), UINT64_C(0x806239ad1a792092), UINT64_C(0x1a254f896f85bdb4)}},
+   {{ UINT64_C(0x6b7eb568d7e32819), UINT64_C(0x9ff5bd786f65eb36), UINT64_C(0xe7da7a7be9cd4a54)}}},
+  {{{ UINT64_C(0x450bf4d1a9e170cc), UINT64_C(0x5220be6b02d9a308), UINT64_C(0x0c7590101872d407)}},
+   {{ UINT64_C(0xfdfe415e8adb8079), UINT64_C(0x3e564010b640692f), UINT64_C(0xfe66216bf818fc5b)}}},
+  {{{ UINT64_C(0x909ba4ec1a1fb943), UINT64_C(0xfb1bf2c499df2971), UINT64_C(0x91f2a4372ff487dc)}},
+   {{ UINT64_C(0xc53bdf8b93f89a82), UINT64_C(0xaa358e22471dc7f9), UINT64_C(0x9eaf94247dab22dd)}}},
+  {{{ UINT64_C(0xad3d552eb261e519), UINT64_C(0x357e5d608c53a530), UINT64_C(0x3003bfb46f82e573)}},
+   {{ UINT64_C(0x8c00119746f85efd), UINT64_C(0xade9c8907eb24fcb), UINT64_C(0xb1b6c68e67d9f9a6)}}},
+  {{{ UINT64_C(0x6389dd462ad5d114), UINT64_C(0xa6a46c780defe3d3), UINT64_C(0x64a4811618899a7d)}},
+   {{ UINT64_C(0x00b23495afd9de94), UINT64_C(0x249487fead25f9a8), UINT64_C(0xa676aa5445e7db62)}}},
+  {{{ UINT64_C(0x9e90835f7b2eea0a), UINT64_C(0x86ccd577511ebc8c), UINT64_C(0xf3c6b589bf448677)}},
+   {{ UINT64_C(0x2604a69f93ffb01b), UINT64_C(0xd918364e5c33b989), UINT64_C(0x4e0cc880f6f2cb28)}}},
+  {{{ UINT64_C(0x68a17afae6b21517), UINT64_C(0x5f0f78e0cb030ae3), UINT64_C(0xa91b0b4d7d1010c2)}},
+   {{ UINT64_C(0x4038ac62592dd1b0), UINT64_C(0xf30e744b70c3f81a), UINT64_C(0x1e54e775307864c1)}}},
+  {{{ UINT64_C(0xcec8f61c92e00558), UINT64_C(0xfda3540c94a598c4), UINT64_C(0xdf3d3b09d3507b9a)}},
+   {{ UINT64_C(0x51c785e9fdbbcfd6), UINT64_C(0xf39a074adf3abf0a), UINT64_C(0xdd01f9233f57480b)}}},
+  {{{ UINT64_C(0x640f1d775e7ced18), UINT64_C(0x663137ccfc897211), UINT64_C(0x1f37698646863d6a)}},
+   {{ UINT64_C(0xa972da29c2b48970), UINT64_C(0xffca3e1b26d10674), UINT64_C(0xda6aa5e241946719)}}},
+  {{{ UINT64_C(0xa52d6746d246eab1), UINT64_C(0x6a572dfaf4fdde87), UINT64_C(0x081a38826d20dc8b)}},
+   {{ UINT64_C(0xe3313bdbd80eb75e), UINT64_C(0xb87d668aee03a3da), UINT64_C(0x36407c4f3c6bd6aa)}}},
+  {{{ UINT64_C(0xb199657ba9d3cd25), UINT64_C(0x40e2bec80fd64449), UINT64_C(0x195a6c0f01b3bfff)}},
+   {{ UINT64_C(0x64cf594df6f40ac3), UINT64_C(0xed849013c31148fd), UINT64_C(0x236dc8246bb6cd27)}}},
+  {{{ UINT64_C(0x1cbbf0a55bdf5e74), UINT64_C(0x3708e9ec3ec8fc83), UINT64_C(0x0f9d9a421c102574)}},
+   {{ UINT64_C(0xfa79b2cfb04c4e5c), UINT64_C(0xde43abfe64abca99), UINT64_C(0xec87c7435535ad5b)}}},
+  {{{ UINT64_C(0x3c0f780d9d130b62), UINT64_C(0x455e13cd1f98acf6), UINT64_C(0xdca9791af627c4d0)}},
+   {{ UINT64_C(0xe6753898fc0b4ba5), UINT64_C(0x53828bc26b360e6c), UINT64_C(0xe7d301b7378fa3a8)}}},
+  {{{ UINT64_C(0x6a0b6ae7b6971f3f), UINT64_C(0xe56b6b2979070977), UINT64_C(0xea003965de322f79)}},
+   {{ UINT64_C(0xeeb535ca3308f288), UINT64_C(0xaab92d6adf391c64), UINT64_C(0xf39ac86374c09582)}}},
+  {{{ UINT64_C(0x0d43a02716d3cf4a), UINT64_C(0xbd424f74d3e1661c), UINT64_C(0xe2f14c81b6536456)}},
+   {{ UINT64_C(0x7596d2aa1966cea2), UINT64_C(0x49c557b010d89077), UINT64_C(0x397fa10b48f3cf5b)}}},
+  {{{ UINT64_C(0x6676a71249d8c0bf), UINT64_C(0x84f26b9fb8dd1eae), UINT64_C(0xa98f1fd9c29924cc)}},
+   {{ UINT64_C(0xa3ba86f86be250dc), UINT64_C(0x052cb40c645e5811), UINT64_C(0x2855f09cd3fb57d4)}}},
+  {{{ UINT64_C(0x1209627d24e32411), UINT64_C(0x3230caa6391c36f7), UINT64_C(0x87620ac87145c0f8)}},
+   {{ UINT64_C(0x2fd4d19952c45f3d), UINT64_C(0x054d7e0b10faa37d), UINT64_C(0xd044fdc82c7b38ba)}}},
+  {{{ UINT64_C(0x47dfebf160c2d23f), UINT64_C(0x3d38acc75f7077b9), UINT64_C(0x701d1a95c58c1175)}},
+   {{ UINT64_C(0x3e796bfbf39391e3), UINT64_C(0x6d0bfb9ed5a2812f), UINT64_C(0xb2184ec25c768651)}}},
+  {{{ UINT64_C(0x71ab2f625cd11a01), UINT64_C(0x476466a20d242002), UINT64_C(0x7f3b63cbbf565a83)}},
+   {{ UINT64_C(0x9afcc71d81b62204), UINT64_C(0xfecaff5744b09766), UINT64_C(0x53dd2cf2520dddf7)}}},
+  {{{ UINT64_C(0x3579bc7afc05d6ec), UINT64_C(0x6f447d94758de213), UINT64_C(0x02f427d326f56ea5)}},
+   {{ UINT64_C(0x8aa818c459177e55), UINT64_C(0xf29daab5cd110d65), UINT64_C(0x99fc927ce4e0eea4)}}},
+  {{{ UINT64_C(0x56ddc6317eb89558), UINT64_C(0xc254155d360f328d), UINT64_C(0x94db3376c9b93033)}},
+   {{ UINT64_C(0x583fca0a85733a88), UINT64_C(0xc3a60e60746fba62), UINT64_C(0x177c2e904484bf83)}}},
+  {{{ UINT64_C(0xc486095dfeb25dbc), UINT64_C(0x33637a1a14da11cf), UINT64_C(0xa44edbb2d5280d68)}},
+   {{ UINT64_C(0xff01d7a4136e9374), UINT64_C(0xa2a921ab6d48883f), UINT64_C(0x473fe7882a56a0de)}}},
+  {{{ UINT64_C(0x1de3d9af265216fb), UINT64_C(0xab68856842bd8e3e), UINT64_C(0xcde0cbea0fb723a2)}},
+   {{ UINT64_C(0xd6b78316ba4dea5c), UINT64_C(0x2722d6692456a1f6), UINT64_C(0x2d1c748aa48d7fee)}}},
+  {{{ UINT64_C(0x8abea48ec35ec662), UINT64_C(0x65f20764d7676a66), UINT64_C(0x30c2275bee9750f6)}},
+   {{ UINT64_C(0x4b1f4f66e2f593bc), UINT64_C(0x992fcd0bf75ff81f), UINT64_C(0xd6ebe7ff039268f6)}}},
+  {{{ UINT64_C(0x8d9fb7deacf87fd0), UINT64_C(0x8c6e00a93c985c07), UINT64_C(0xce824f0f2fa50c0d)}},
+   {{ UINT64_C(0x718b6b255a4e2fe2), UINT64_C(0x3240102d11d44030), UINT64_C(0x12358d3b48bd400f)}}},
+  {{{ UINT64_C(0x441478cecaf70d3b), UINT64_C(0xec1d18d6b92ce9d1), UINT64_C(0xf81d0c9986848d72)}},
+   {{ UINT64_C(0xd0bd4a3f389785b8), UINT64_C(0x60c78661376cbe20), UINT64_C(0x5a87db31060c4218)}}},
+  {{{ UINT64_C(0x3705547e2a54b8c0), UINT64_C(0xc8f354cdf91f2433), UINT64_C(0xe740d025f40b85ad)}},
+   {{ UINT64_C(0xfe45c5b1722f12d6), UINT64_C(0x94f7202ee59d8f51), UINT64_C(0x18af2206ee7cf068)}}},
+  {{{ UINT64_C(0x61f9e1c710df9b17), UINT64_C(0x8e33b4e2480a5e81), UINT64_C(0x3d793b57bf9d3962)}},
+   {{ UINT64_C(0xde612ede0dde382d), UINT64_C(0x729e4705c1dcb0ae), UINT64_C(0x44f58a021935e210)}}},
+  {{{ UINT64_C(0x92308c4eb828c176), UINT64_C(0x23a3bfdbd8bb81f8), UINT64_C(0xe4a8f6693891d0e3)}},
+   {{ UINT64_C(0xa9f2eea9f340d5c0), UINT64_C(0xe82ffd57c59df5db), UINT64_C(0x9f8c65e9077f02f8)}}},
+  {{{ UINT64_C(0x92efe3e4bd9af09f), UINT64_C(0x1cd3ce06fe55e6a9), UINT64_C(0x9334d11623a6fe58)}},
+   {{ UINT64_C(0x84ff152b7cc0890a), UINT64_C(0x6d5ebe589365c2b0), UINT64_C(0x01104face0ed754e)}}},
+  {{{ UINT64_C(0xb906853144638e33), UINT64_C(0x7399ee7066c99b7b), UINT64_C(0xddebbfdabcbb55e1)}},
+   {{ UINT64_C(0xd28e163b5dd9db51), UINT64_C(0xd36c08cdf26831f4), UINT64_C(0x3b5b3d39ea37da00)}}},
+  {{{ UINT64_C(0xb11c070baef4e1e5), UINT64_C(0x4cbde4ed66c1c7f9), UINT64_C(0xced726d137b460aa)}},
+   {{ UINT64_C(0x2a1b2abf2734de59), UINT64_C(0x03d897d14bf51e37), UINT64_C(0x2a61c19c27f8ad55)}}},
+  {{{ UINT64_C(0x1df49f6ac9ebffff), UINT64_C(0xbd974a71931c5a9f), UINT64_C(0x7ec34789437beee1)}},
+   {{ UINT64_C(0x042dd884026b0a81), UINT64_C(0x1f7102632c93e7a7), UINT64_C(0x0fc4da87c62df09e)}}},
+  {{{ UINT64_C(0x214ba35e63800394), UINT64_C(0x48b9a2fb1c1398bd), UINT64_C(0x986d24fb8f697911)}},
+   {{ UINT64_C(0x7d2953b58726ff83), UINT64_C(0xc5b20bb6e6a646ad), UINT64_C(0x8a057ad19d7b2845)}}},
+  {{{ UINT64_C(0x23a343beafd0bc68), UINT64_C(0x68d8e26814f6496a), UINT64_C(0x7d4ff1a0c54fdbd0)}},
+   {{ UINT64_C(0xa2f3c60370a8daef), UINT64_C(0x98ef8e8280c16cd5), UINT64_C(0x4c22e54387ecd1bb)}}},
+  {{{ UINT64_C(0x1e05c9a780659600), UINT64_C(0xd2cf7e5d4e2f4bea), UINT64_C(0x31f94d3befbb96b1)}},
+   {{ UINT64_C(0xe0fe77447a8f682b), UINT64_C(0x4ed06aee259ea763), UINT64_C(0x4ce651fcb00419ee)}}},
+  {{{ UINT64_C(0xed07138641febc82), UINT64_C(0x328133f2cb186dda), UINT64_C(0xf85a11721d0cf84f)}},
+   {{ UINT64_C(0x6fcad87ba901b54e), UINT64_C(0xddb0bc5382edca01), UINT64_C(0x818adfcf3f2fe10c)}}},
+  {{{ UINT64_C(0x7dd0ae5ba83c8eac), UINT64_C(0xc2624c5d908bb900), UINT64_C(0x975af8b55a32eca3)}},
+   {{ UINT64_C(0x319066d9557bf0a1), UINT64_C(0x2e78a4fc83e14d88), UINT64_C(0x40f70460aee486e5)}}},
+  {{{ UINT64_C(0xe53ca8c3870cbb81), UINT64_C(0x00a395d219d9d057), UINT64_C(0x14c2b3d49716e1b1)}},
+   {{ UINT64_C(0x7acf15da9ad7f957), UINT64_C(0x53dae360abd70a99), UINT64_C(0x8a8b92779bf151e9)}}},
+  {{{ UINT64_C(0xfcaa6813996fbff3), UINT64_C(0x9da3c9b840fc91ee), UINT64_C(0xc289ae86a6717afd)}},
+   {{ UINT64_C(0xf8ab379c1f28f413), UINT64_C(0x62a733bd196c32e6), UINT64_C(0x4371caca7110cd7e)}}},
+  {{{ UINT64_C(0xc86607e540a3f0d2), UINT64_C(0x87733e2a3ae6d90d), UINT64_C(0xe2c432dddce22201)}},
+   {{ UINT64_C(0x417307b11a9e4eea), UINT64_C(0xa8431dc54d6efdc0), UINT64_C(0xb83cae25c2b83b78)}}},
+  {{{ UINT64_C(0x67c68bdf9e6b676a), UINT64_C(0xbd2f981408018a33), UINT64_C(0x7dd3f63826404ba3)}},
+   {{ UINT64_C(0x7135d5a7684d7217), UINT64_C(0xcbe53f9b922906de), UINT64_C(0x56716954497df6de)}}},
+  {{{ UINT64_C(0x2fcf1d5852908548), UINT64_C(0x4dab5ed44bef20f9), UINT64_C(0x815bc99ff3859ee8)}},
+   {{ UINT64_C(0x198d9eebd4ca59df), UINT64_C(0x4b28254bc2b5cfcd), UINT64_C(0x5c831fb69ce64f2e)}}},
+  {{{ UINT64_C(0x787279658692f4f6), UINT64_C(0x99a1c26bf0932bf7), UINT64_C(0xa532a02b70d482f7)}},
+   {{ UINT64_C(0x428a8ef5cb695971), UINT64_C(0x2b063434678a66e0), UINT64_C(0x40192b55eb4265cf)}}},
+  {{{ UINT64_C(0x61ad887998ecde04), UINT64_C(0x48421c64d5537ede), UINT64_C(0xf8b4249b11b09faf)}},
+   {{ UINT64_C(0x7edf8e406bdc9eac), UINT64_C(0x30870aa4abbc4082), UINT64_C(0x1736fb7701029eca)}}},
+  {{{ UINT64_C(0xbcbe726429e81d44), UINT64_C(0x3dbec35a8d689740), UINT64_C(0x5f25317c45b805ee)}},
+   {{ UINT64_C(0x75da8eb6a0ef0cf7), UINT64_C(0xd01e3e7dce85de7c), UINT64_C(0x989c4ef1ab0e6652)}}},
+  {{{ UINT64_C(0xd0fd6f53d95bba49), UINT64_C(0x61fc11f277dbd2d8), UINT64_C(0x565cd697e3f77d33)}},
+   {{ UINT64_C(0x37ce6f5b1d381a3d), UINT64_C(0xf999d0556b503783), UINT64_C(0x00de6c1b98b3dd4c)}}},
+  {{{ UINT64_C(0x44720ab591aa8230), UINT64_C(0xd3f57785c143cd85), UINT64_C(0x603c843c1d3fa31e)}},
+   {{ UINT64_C(0x98191dfc8132db57), UINT64_C(0x96c3246bb0f68649), UINT64_C(0x888934b8a8ed34ac)}}},
+  {{{ UINT64_C(0xb4e6fd41de5ceb42), UINT64_C(0xff2b12742aefc536), UINT64_C(0x068e9b3900b097a7)}},
+   {{ UINT64_C(0xd380903ac5abc2f5), UINT64_C(0xdc4725b8b038006d), UINT64_C(0x7c6e210b3f637668)}}},
+  {{{ UINT64_C(0xbc1a071318d2cf54), UINT64_C(0x5f1c7b7f17e46132), UINT64_C(0xbe2e1b75c70d05a7)}},
+   {{ UINT64_C(0xcd39a28af017ba9c), UINT64_C(0x53cb82f2ddbf0833), UINT64_C(0xcca4f980951032d2)}}},
+  {{{ UINT64_C(0xae879547020bea31), UINT64_C(0xccadbf7a756f67a7), UINT64_C(0x78e2f26a26b1764d)}},
+   {{ UINT64_C(0x10157c2c364288cf), UINT64_C(0x403b9bfac4a1e45a), UINT64_C(0xa1c10b512b691315)}}},
+  {{{ UINT64_C(0x1a9f0da9e7b06caf), UINT64_C(0x4a44a005f31fd8e3), UINT64_C(0xb8dfb38dfd2e5a3a)}},
+   {{ UINT64_C(0x2e9063edd5b4e09c), UINT64_C(0x9139cf52de19e935), UINT64_C(0x0852a8fd2febbf1c)}}},
+  {{{ UINT64_C(0x1fa4f53cf3eecc0f), UINT64_C(0x1bcd250082b79b6e), UINT64_C(0x7093bce383c9377e)}},
+   {{ UINT64_C(0xe34efc81cc9b989d), UINT64_C(0x6ca6b42352f997e1), UINT64_C(0xa0d6cbc26b5be8f1)}}},
+  {{{ UINT64_C(0x007008aa4a57719c), UINT64_C(0x7c4e4c7430867416), UINT64_C(0xaa9fd72e98967637)}},
+   {{ UINT64_C(0x40116244da016608), UINT64_C(0x15156c3068d82060), UINT64_C(0x87ec9a24d7de6061)}}},
+  {{{ UINT64_C(0x3aeff35ed6d61bdc), UINT64_C(0x2cd186370e60bedc), UINT64_C(0xf43aedc49026f63c)}},
+   {{ UINT64_C(0x27a123109099757b), UINT64_C(0xcac8e1f7f422915c), UINT64_C(0xffd4c6550312581a)}}},
+  {{{ UINT64_C(0xede72b97390bdc0e), UINT64_C(0xf107094448b3896e), UINT64_C(0x1bf4874bcb26d7eb)}},
+   {{ UINT64_C(0xda4800b9b3635959), UINT64_C(0x022570a5a6b79a8e), UINT64_C(0xb327bce6eccc9f35)}}},
+  {{{ UINT64_C(0x58958f5efa8e0ab8), UINT64_C(0x85c5721d03e65f9c), UINT64_C(0x759a5c4a50d47219)}},
+   {{ UINT64_C(0x04de1dd285696f60), UINT64_C(0xf8108cf2f8d6fd13), UINT64_C(0x706756d7a2eb770f)}}},
+  {{{ UINT64_C(0x6127e18f8c9fd7a9), UINT64_C(0x59771da793763352), UINT64_C(0x96bde3e40355b9d6)}},
+   {{ UINT64_C(0x4da1c27a01a09574), UINT64_C(0x3e03beb7d2bc85aa), UINT64_C(0xcacdbc2c45cb2c9b)}}},
+  {{{ UINT64_C(0x6c3aa3b5bb64c7a7), UINT64_C(0x087f17862677c390), UINT64_C(0xa35e3745bfc4631f)}},
+   {{ UINT64_C(0xc5d5fb5a9ea80c73), UINT64_C(0xb38f337a4c74de91), UINT64_C(0xa0dc0e5f4d85f1d8)}}},
+  {{{ UINT64_C(0x82630356d3c9d82f), UINT64_C(0xa0f3e6e102a723cc), UINT64_C(0xd03971d35c50b0e7)}},
+   {{ UINT64_C(0x485c43988dad077b), UINT64_C(0xb119faef8fb4224e), UINT64_C(0x1503eeebf37b9c16)}}},
+  {{{ UINT64_C(0x03fe040345194c1a), UINT64_C(0x571e5268bf630d66), UINT64_C(0x2f4a64e1eafb0c84)}},
+   {{ UINT64_C(0xe1889628a30d7f00), UINT64_C(0x95b040db879f5f17), UINT64_C(0x4e9120f24f21f14b)}}},
+  {{{ UINT64_C(0x09ac3b593032e9a5), UINT64_C(0x72a4111f92173883), UINT64_C(0x519455c05c971fdd)}},
+   {{ UINT64_C(0xf3a5ec200c033710), UINT64_C(0xf2b668e3d78b9154), UINT64_C(0x4443efa854cb6c54)}}},
+  {{{ UINT64_C(0x9e5b3a1932e19ac6), UINT64_C(0x53bcdf4fb65cb0c3), UINT64_C(0xcfb455c107247ccf)}},
+   {{ UINT64_C(0xeb9b7567589c79b3), UINT64_C(0xb9f69935547fa188), UINT64_C(0xf5f65ddeb17a26e5)}}},
+  {{{ UINT64_C(0x9d4d681e0b27c62b), UINT64_C(0x3f7c39c7c99fa77b), UINT64_C(0x6e4dd1df86b312da)}},
+   {{ UINT64_C(0x744db2e746e1d2cf), UINT64_C(0x388a8e627f943df9), UINT64_C(0xe42cfdd3324da84a)}}},
+  {{{ UINT64_C(0x8a0603da3470416e), UINT64_C(0x00670811a370726e), UINT64_C(0xa6b991de8ab0d7ed)}},
+   {{ UINT64_C(0x415dc219a61da948), UINT64_C(0x34f4d57e4878beb7), UINT64_C(0x006dfbb657505233)}}},
+  {{{ UINT64_C(0x313894065e8ae81d), UINT64_C(0x351f441f5eec074b), UINT64_C(0x61491a9af477aaba)}},
+   {{ UINT64_C(0xed1f7f93fe9a8dd9), UINT64_C(0xe2edd5274b38ded6), UINT64_C(0x44a87711fb0c3b71)}}},
+  {{{ UINT64_C(0x2ac7c1c2178fe1a5), UINT64_C(0xd79df0e73b3bb247), UINT64_C(0x108411583e855299)}},
+   {{ UINT64_C(0x18f842dc840e7863), UINT64_C(0x28b2df4c55b1842f), UINT64_C(0x47a497d325360efd)}}},
+  {{{ UINT64_C(0x3ae404cf9ecb68d4), UINT64_C(0xcbfca82d3e451daf), UINT64_C(0xb0fccb40f8622a10)}},
+   {{ UINT64_C(0x15bacdbf15e611c7), UINT64_C(0x6d036fa2aedd037e), UINT64_C(0x53a223c9f08a91b6)}}},
+  {{{ UINT64_C(0xa51bf986797e8b6a), UINT64_C(0x820a8f3beb831ec4), UINT64_C(0xf93716ebe6ae64a5)}},
+   {{ UINT64_C(0x68a26a86c36aebae), UINT64_C(0x13bc53086ce0a885), UINT64_C(0x16549874ae1f56c9)}}},
+  {{{ UINT64_C(0x22a0b91488e6976d), UINT64_C(0xebd0bd69c293fd5a), UINT64_C(0x695fc29478a890aa)}},
+   {{ UINT64_C(0xcd9fc461bffaf1f1), UINT64_C(0x7b6585b37949b335), UINT64_C(0x2dc1c872683fa14b)}}},
+  {{{ UINT64_C(0x4a4702fc7e1220af), UINT64_C(0xcde3036edbdc8952), UINT64_C(0xf24cc01a9fed145b)}},
+   {{ UINT64_C(0x792703bf4e8f80a2), UINT64_C(0x2008aa3b91c8aca2), UINT64_C(0x79dcb548e968701d)}}},
+  {{{ UINT64_C(0x414c8372bf10a0f2), UINT64_C(0xd857998823ca419d), UINT64_C(0xcf72185f28d54953)}},
+   {{ UINT64_C(0x8d33fe7b98c06bae), UINT64_C(0xef0d83dcc88a7a00), UINT64_C(0x3885d9fead7d4f56)}}},
+  {{{ UINT64_C(0xaf6e3f5e3348d08c), UINT64_C(0xe74ce0e23b74d0c1), UINT64_C(0xd4b2e8415c891c58)}},
+   {{ UINT64_C(0x949db86fc40f8da8), UINT64_C(0xcdf86234e962885e), UINT64_C(0x52bc047c686e1d64)}}},
+  {{{ UINT64_C(0xfc6c6192d77615b7), UINT64_C(0x7e44be76170c3f86), UINT64_C(0xaa5a0624c6942005)}},
+   {{ UINT64_C(0x3bdece227058cf62), UINT64_C(0x5643bd5d9777f342), UINT64_C(0x15a192b58a2755c1)}}},
+  {{{ UINT64_C(0x29319ecd73bf3d46), UINT64_C(0xb918f9599c868a5f), UINT64_C(0xb5996cfdb15b0aa9)}},
+   {{ UINT64_C(0x7f6984474bb1bfda), UINT64_C(0x4502b728d9fe16dd), UINT64_C(0x54d999b5ba67a1b9)}}},
+  {{{ UINT64_C(0xd46b10ac00362af3), UINT64_C(0xd0103292d7afd343), UINT64_C(0x0fb1e64a98a579d6)}},
+   {{ UINT64_C(0x4940f0155a69021d), UINT64_C(0x37774b87e281b721), UINT64_C(0x5658735dae0d0bb8)}}},
+  {{{ UINT64_C(0xe58dcd0b8821d9c3), UINT64_C(0x94f51bb19f899115), UINT64_C(0xdf7fe9931e2283e6)}},
+   {{ UINT64_C(0x254d46cd4b322896), UINT64_C(0x5f626b9c0c25707b), UINT64_C(0xd528e7fc48586227)}}},
+  {{{ UINT64_C(0x2e42fa9e486e264c), UINT64_C(0x13d6b710601dc105), UINT64_C(0x319ec2f7aae26fdd)}},
+   {{ UINT64_C(0x14ea571d4b83744d), UINT64_C(0xdee1613af0602643), UINT64_C(0x81d3d3082a2fc7d3)}}},
+  {{{ UINT64_C(0xb8e1c8ea765f4319), UINT64_C(0xc202ba41c5080112), UINT64_C(0x9250caeeb020b374)}},
+   {{ UINT64_C(0x159ff446631ffcbb), UINT64_C(0x78bb88baebe7ee11), UINT64_C(0xe2eef62ee414e371)}}},
+  {{{ UINT64_C(0xfc33daccd588147e), UINT64_C(0x5213adfb9be7ccc5), UINT64_C(0xdb2e34c25e9a9a21)}},
+   {{ UINT64_C(0x0542e0adaccfa8d1), UINT64_C(0xa52772898fc625b9), UINT64_C(0xd0db08b3169d2f7c)}}},
+  {{{ UINT64_C(0x58f93fdc47c3f6bf), UINT64_C(0xc9ca4f9a395e7234), UINT64_C(0xbb1d4f9fe6bf0dc0)}},
+   {{ UINT64_C(0x7eeea2ef4924f0ed), UINT64_C(0xfb43d11fa6f75528), UINT64_C(0xc97b9e0c45be28bb)}}},
+  {{{ UINT64_C(0x4778494af7dad1e0), UINT64_C(0xebccce6195dedc23), UINT64_C(0xa3c5bcb57f4f549d)}},
+   {{ UINT64_C(0xec41ca780a2ddc46), UINT64_C(0x582856679637f4b2), UINT64_C(0xfb4dc45f15b67c15)}}},
+  {{{ UINT64_C(0xea187f5a5737ba77), UINT64_C(0xf6b681316d64a7d1), UINT64_C(0x755ba06707ad77ff)}},
+   {{ UINT64_C(0xf488ec9279559905), UINT64_C(0x9d1995d7f71fb8dd), UINT64_C(0xfe5721267210deb4)}}},
+  {{{ UINT64_C(0xe06b1f9013301732), UINT64_C(0xa3c58a3eb85a8b4f), UINT64_C(0x649d3db927dc3a87)}},
+   {{ UINT64_C(0x98e01a66d4570c1c), UINT64_C(0xf87550ce01358471), UINT64_C(0x800d0b35879c5c1a)}}},
+  {{{ UINT64_C(0x8a3d688bd9ebb4c8), UINT64_C(0xc2980022276e877e), UINT64_C(0xd2646b1d1989bec5)}},
+   {{ UINT64_C(0x1ae0c44d256a38e2), UINT64_C(0x0b2c70be9dbb00a9), UINT64_C(0x5ba1349a23649a25)}}},
+  {{{ UINT64_C(0xf14a623f909a3cac), UINT64_C(0xff7c182664fab103), UINT64_C(0x7747c72e93ceb26b)}},
+   {{ UINT64_C(0x48e53683311cb75b), UINT64_C(0x2b1ea2b084995727), UINT64_C(0xe717800c0be93804)}}},
+  {{{ UINT64_C(0x0d63daa6993aeb4f), UINT64_C(0x52c1fbfbbc6facea), UINT64_C(0xcd4502fe20c0b38e)}},
+   {{ UINT64_C(0xe9db35ae7d6afa75), UINT64_C(0x73f06b8f5f8e40f1), UINT64_C(0x318a6ff53a57dbe9)}}},
+  {{{ UINT64_C(0xfadd15dde95f1f3b), UINT64_C(0x0054a084b101343e), UINT64_C(0x2994cbb3be394ba7)}},
+   {{ UINT64_C(0x6730d600992ff045), UINT64_C(0x4df239cafb47a5ac), UINT64_C(0xb4efec6f0f33bbb2)}}},
+  {{{ UINT64_C(0xcd5da0a29cea4b88), UINT64_C(0x8ef2b7100f7e55d0), UINT64_C(0x6d2564ef44705653)}},
+   {{ UINT64_C(0xcba7b0eee7168aec), UINT64_C(0xc95e2fe7261ce739), UINT64_C(0x2650751a43145e79)}}},
+  {{{ UINT64_C(0x052438db3e9b6312), UINT64_C(0x91b8821574ea0317), UINT64_C(0x9aa71e8ec7d418b4)}},
+   {{ UINT64_C(0xbb2c1f9e6d151fe6), UINT64_C(0x57d218ca8259b450), UINT64_C(0x88de208a97f789c5)}}},
+  {{{ UINT64_C(0xec8d7f4e0774df63), UINT64_C(0x5af352eec49ecf8d), UINT64_C(0x05b37affab2ebeff)}},
+   {{ UINT64_C(0xcda78b9eef667d6c), UINT64_C(0x6aaebe9ebdbd180f), UINT64_C(0xeb6a452997eca825)}}},
+  {{{ UINT64_C(0x3032531167d431ca), UINT64_C(0x13bd952270833fdd), UINT64_C(0xbcd4eaead851c7b5)}},
+   {{ UINT64_C(0x652e35f4336fefbc), UINT64_C(0xeba17406223ae8ad), UINT64_C(0xac81ae4d59750ce1)}}},
+  {{{ UINT64_C(0x59370ac1c87f561a), UINT64_C(0xc9f6b9b7723e5f9f), UINT64_C(0xed1cb5ec4c11352a)}},
+   {{ UINT64_C(0xa6e4d1f47bddf21c), UINT64_C(0x48171a3351c8bc09), UINT64_C(0x50eb6006eff59576)}}},
+  {{{ UINT64_C(0x70872f885d31c6f3), UINT64_C(0x0810effa35d98c18), UINT64_C(0x84680e29a68488b6)}},
+   {{ UINT64_C(0x1d3420dcd1991922), UINT64_C(0x1fcd7e24e9449521), UINT64_C(0x597623ee48f11fda)}}},
+  {{{ UINT64_C(0x74886ffe9c7190f7), UINT64_C(0x4beb1c157add308b), UINT64_C(0x8ab28b81937b8075)}},
+   {{ UINT64_C(0x7d3ff973fb7cfc44), UINT64_C(0xbef51bfc6e22a7b2), UINT64_C(0x77d0b18777d8997f)}}},
+  {{{ UINT64_C(0x532418b0c342be53), UINT64_C(0xbc2845b84863b259), UINT64_C(0xcda2443202dc9aca)}},
+   {{ UINT64_C(0x079b4f17575a8ac2), UINT64_C(0xc4360d2e77bc3e1c), UINT64_C(0x7cb70d0f78477e7f)}}},
+  {{{ UINT64_C(0x4205280208bab732), UINT64_C(0xe3f7d9e7b622b1ac), UINT64_C(0xd18433d0c3fb2401)}},
+   {{ UINT64_C(0xa6b931282dcfd653), UINT64_C(0x09e3ef976a241f2b), UINT64_C(0x933983d8653a6c28)}}},
+  {{{ UINT64_C(0x89023a413f20390b), UINT64_C(0xb2ef1a067b9b6624), UINT64_C(0x73dea803c13390c9)}},
+   {{ UINT64_C(0x614d22789447b17d), UINT64_C(0x630c06632515d9ad), UINT64_C(0x2b69ab957a639a30)}}},
+  {{{ UINT64_C(0x4628422fc3166306), UINT64_C(0x06a62547f270b34c), UINT64_C(0xa92bfc0380cdf314)}},
+   {{ UINT64_C(0xfae0c17a40dd2861), UINT64_C(0xf0a94152cd7c1827), UINT64_C(0x4ce39b40d1e58dfe)}}},
+  {{{ UINT64_C(0x7176602137cdf00a), UINT64_C(0xe75cd69b0f55418a), UINT64_C(0x2bd045b0ff109b62)}},
+   {{ UINT64_C(0x4224a61ed129ecfe), UINT64_C(0xc46fb455fc061e49), UINT64_C(0x7319b06cdb9d5b81)}}},
+  {{{ UINT64_C(0x20a81d9325a4720c), UINT64_C(0xd52b8438d1e8dfc1), UINT64_C(0x407d857720e71533)}},
+   {{ UINT64_C(0x8ee930b5d5a680aa), UINT64_C(0x4204811d71c00168), UINT64_C(0xd34d17d8325bc536)}}},
+  {{{ UINT64_C(0x596955de2f294c83), UINT64_C(0x239d632217bdce8d), UINT64_C(0xd8cc25ad8dabd4cd)}},
+   {{ UINT64_C(0xeae3a4cafd34331f), UINT64_C(0xdde523a72935dcf2), UINT64_C(0x51d7ee8d59ee8caf)}}},
+  {{{ UINT64_C(0x01090ef7908f749c), UINT64_C(0x9b45492bb0159a4b), UINT64_C(0x54dab779dea7a06d)}},
+   {{ UINT64_C(0x47beb2166f55d9aa), UINT64_C(0x87fde743befbf95c), UINT64_C(0xc0b16230c2e3dc8e)}}},
+  {{{ UINT64_C(0xe879951c6fb6cb60), UINT64_C(0x711c14bba058eb11), UINT64_C(0x279c56d526503ca2)}},
+   {{ UINT64_C(0xb55b578ed024b51c), UINT64_C(0x70b3ef6e17741e74), UINT64_C(0x052b2867ab98848a)}}},
+  {{{ UINT64_C(0x59e4938241b37b83), UINT64_C(0x5fa0ddd78e96dd41), UINT64_C(0xea42ae5e4b296a70)}},
+   {{ UINT64_C(0x610f2e97b9be7b36), UINT64_C(0xcc94d27de4835873), UINT64_C(0xd96a9624f38ef701)}}},
+  {{{ UINT64_C(0x200659ebc9b6c0fb), UINT64_C(0xa519ac4df77f03b4), UINT64_C(0x5f3c6300ec513688)}},
+   {{ UINT64_C(0x2f0efc8dabef2b2d), UINT64_C(0x8859af86b4fb7849), UINT64_C(0x9783c8c69ea1d296)}}},
+  {{{ UINT64_C(0x1f9f6a1324fdafa7), UINT64_C(0x1ddaf46e1d2d99ba), UINT64_C(0x2c3d61035d9036b3)}},
+   {{ UINT64_C(0x5a9bc5e91223fa93), UINT64_C(0xfb95c77c2da70753), UINT64_C(0xbc349ca774f94393)}}},
+  {{{ UINT64_C(0x59aceafa41a012a8), UINT64_C(0x7ca2a3044b054cb8), UINT64_C(0x6b1d381f89e74b8b)}},
+   {{ UINT64_C(0xb149787658b75f14), UINT64_C(0x78b1211302f9c7c0), UINT64_C(0x16872ab6c00d46cb)}}},
+  {{{ UINT64_C(0x86740033717cf6eb), UINT64_C(0xf6596f55e04e5fdc), UINT64_C(0x05023a0950fead64)}},
+   {{ UINT64_C(0xfd8c5efe7e683f8d), UINT64_C(0xcf477fedd0f79e90), UINT64_C(0xde983fa4a3257df4)}}},
+  {{{ UINT64_C(0x64f9dcb9ac53b8da), UINT64_C(0xfb30fb87348b9b0c), UINT64_C(0x3336c8de7a2f024b)}},
+   {{ UINT64_C(0x700f69c255280f40), UINT64_C(0x413f0820f543abf8), UINT64_C(0xd4359ad2d717551f)}}},
+  {{{ UINT64_C(0xa92201d75b265fe3), UINT64_C(0x47e1a4f5739881fb), UINT64_C(0x12a07ec42ced7f10)}},
+   {{ UINT64_C(0x0d1352579f4a74e2), UINT64_C(0xaa0bcd65374d3ac0), UINT64_C(0x29d16d329a2ffc1f)}}},
+  {{{ UINT64_C(0x0ef7058ffccafccd), UINT64_C(0x38941d8833dfd6d2), UINT64_C(0x177a637d0141a803)}},
+   {{ UINT64_C(0xaded9e72cce16bb3), UINT64_C(0xb21279a83c54fae5), UINT64_C(0x1aa3b8be11099c5c)}}},
+  {{{ UINT64_C(0x110880bdd8353651), UINT64_C(0xb45cbe2825f01814), UINT64_C(0x1110af29f5f426ba)}},
+   {{ UINT64_C(0x883867504cf95a65), UINT64_C(0x4191bd38113bc594), UINT64_C(0xa1d93ca04e79a401)}}},
+  {{{ UINT64_C(0xa04c4df7cf919895), UINT64_C(0x13d63a3f6a3b9ad0), UINT64_C(0x43a2ab100e56a787)}},
+   {{ UINT64_C(0xf1f8ce749165da98), UINT64_C(0xdea60c4bedc0e2be), UINT64_C(0x2d71876f22deba04)}}},
+  {{{ UINT64_C(0xe3ab9ef74f8fa762), UINT64_C(0x85e1390bbb9f1ff0), UINT64_C(0x19dbf875dcc61bba)}},
+   {{ UINT64_C(0xabc55701d63c4676), UINT64_C(0x73bf83f33200f323), UINT64_C(0x287ec01dd7064f0a)}}},
+  {{{ UINT64_C(0x0099bc8b5429051e), UINT64_C(0xbbd8e075f452f351), UINT64_C(0xd38099eee90e6fab)}},
+   {{ UINT64_C(0x78504b280c564617), UINT64_C(0x6669c44909038161), UINT64_C(0xeec841c19a9099e3)}}},
+  {{{ UINT64_C(0x21574227cd56aad2), UINT64_C(0x8f2271e935aa5d3b), UINT64_C(0x8a20331e225d5f70)}},
+   {{ UINT64_C(0x9f70c6d038d2e21a), UINT64_C(0x368fdf2fbb7a6009), UINT64_C(0x37b8ac3632419962)}}},
+  {{{ UINT64_C(0x5a2fe308c6531fde), UINT64_C(0xc3ad4c6a71f08cbc), UINT64_C(0xfda4c3963c0de7dc)}},
+   {{ UINT64_C(0x9fb49c1f82376b97), UINT64_C(0xaf3718e178d42d95), UINT64_C(0x0d7ddadb66fd3886)}}},
+  {{{ UINT64_C(0xae1303974f938316), UINT64_C(0x046bbc9a1dea2790), UINT64_C(0x6c8aa3cbc1a37c9e)}},
+   {{ UINT64_C(0xbb17a5fc155fa740), UINT64_C(0x0b7042c31ce6be73), UINT64_C(0x3ad675eaf9a1b92d)}}},
+  {{{ UINT64_C(0x0350245ddb6eb25b), UINT64_C(0x215b649f08831467), UINT64_C(0xb72f5d57e9e3d35d)}},
+   {{ UINT64_C(0x949dd0a4a98a5402), UINT64_C(0x338225810d33a053), UINT64_C(0xad82b25e4c75976e)}}},
+  {{{ UINT64_C(0xc59a956c70c0a207), UINT64_C(0xa9442bef575f63cf), UINT64_C(0x760bb191c0291bba)}},
+   {{ UINT64_C(0x4236011845b4e53e), UINT64_C(0x83be4ed9e2080e30), UINT64_C(0x3ee33bcb4e5b99db)}}},
+  {{{ UINT64_C(0x9ba2b1e11e885efc), UINT64_C(0x9f85b9a866790383), UINT64_C(0xe73d9edd95e7b618)}},
+   {{ UINT64_C(0x22f5793eb80fcd2e), UINT64_C(0x8d434f716c6e874a), UINT64_C(0xb37d4630877e25df)}}},
+  {{{ UINT64_C(0xbd320f74234eec5c), UINT64_C(0xedf97d12d0afdca7), UINT64_C(0x1bf294f304d0379f)}},
+   {{ UINT64_C(0x8460d4815872442b), UINT64_C(0xc56fc8c02e354b25), UINT64_C(0xd0a57863cfa1e0ce)}}},
+  {{{ UINT64_C(0x97aa1a46eebedd7e), UINT64_C(0x210545ccdab9812f), UINT64_C(0x888b0fd92235b08c)}},
+   {{ UINT64_C(0x6ef5030583fd2f46), UINT64_C(0xbb322d518c97864d), UINT64_C(0xed04755004579126)}}},
+  {{{ UINT64_C(0x80a90254178aa709), UINT64_C(0x139f28a8108a782b), UINT64_C(0xe58806645c63b112)}},
+   {{ UINT64_C(0xcf358bafee2f0644), UINT64_C(0x509c5463c6770cb8), UINT64_C(0x7ac7bbd488153688)}}},
+  {{{ UINT64_C(0x3ebba729cdb8fd04), UINT64_C(0xca60ecb438aaee6f), UINT64_C(0x053c9bc3fcdac97a)}},
+   {{ UINT64_C(0x7cb94c5e69778c1c), UINT64_C(0xf4b5baedffad25ae), UINT64_C(0x5ced0ed1ed4e0fd0)}}},
+  {{{ UINT64_C(0x60fc38bdee323575), UINT64_C(0x7be7a0db2783c70f), UINT64_C(0xc0c51a72a36c70e1)}},
+   {{ UINT64_C(0x56fbd67ad0cb183a), UINT64_C(0xa65c204d358e69ed), UINT64_C(0x3ed324b11e0cd853)}}},
+  {{{ UINT64_C(0x5cf01c26a9a99865), UINT64_C(0x4590c09167f93587), UINT64_C(0xb221d967f1b65da6)}},
+   {{ UINT64_C(0xccc0cfdb65fc7316), UINT64_C(0xefe425b50e3d2124), UINT64_C(0xe06ebb3a02fb6895)}}},
+  {{{ UINT64_C(0x5c2fb229ecee66a4), UINT64_C(0x8be9891ef9d5320f), UINT64_C(0x0d03d7133c1002a5)}},
+   {{ UINT64_C(0x25d2f800fb1ae846), UINT64_C(0x0a6346bffcf1893e), UINT64_C(0x10c417d968de449a)}}},
+  {{{ UINT64_C(0xb4d6dc6cb400df12), UINT64_C(0x9055b4a54ca47390), UINT64_C(0x2d97fd491f0e87ac)}},
+   {{ UINT64_C(0xe156ad1aa3a06131), UINT64_C(0x04cfa2481c369388), UINT64_C(0x6e7fb80fdd10a9aa)}}},
+  {{{ UINT64_C(0x04a6e2a619ff968d), UINT64_C(0x68b3f5795168bd71), UINT64_C(0x173f7e773ddd166c)}},
+   {{ UINT64_C(0xae73c1363815e4b6), UINT64_C(0x65c020bb95826456), UINT64_C(0x24a819ba3e98ba12)}}},
+  {{{ UINT64_C(0x0ac780b7a594ffa0), UINT64_C(0xc5128b42ee343c68), UINT64_C(0xb328e818daed44cd)}},
+   {{ UINT64_C(0x6e76c291a6235438), UINT64_C(0xea0c76c424bb6a12), UINT64_C(0xae0ad200d74ff72b)}}},
+  {{{ UINT64_C(0x5e01eded7a8f9f75), UINT64_C(0x2fc11813ff37f4e2), UINT64_C(0x65017f2202d0e570)}},
+   {{ UINT64_C(0x6cc811a45e58152e), UINT64_C(0xa4bc287729074334), UINT64_C(0x9b7a7c6898bb05b4)}}},
+  {{{ UINT64_C(0xba670146c4969643), UINT64_C(0x9573e8a8cff609de), UINT64_C(0x68151b7e3fd55651)}},
+   {{ UINT64_C(0x4b1fb9775a382a46), UINT64_C(0xeed1bf828d7c62ef), UINT64_C(0xdf2fca93b5204eb5)}}},
+  {{{ UINT64_C(0xe4fe600c0f69ddc0), UINT64_C(0xbd0a3d5f6deed206), UINT64_C(0x474544e31f4240b8)}},
+   {{ UINT64_C(0x40d4bf99fa0310db), UINT64_C(0x9a41dded4551bd32), UINT64_C(0xe997a4970cf0c9ab)}}},
+  {{{ UINT64_C(0x8daa13f127611be5), UINT64_C(0xa0bfe8ff94c3b347), UINT64_C(0x33504cedf225b7f5)}},
+   {{ UINT64_C(0x2d8400b2a9ccef35), UINT64_C(0x09b769787e88aa32), UINT64_C(0x0e62f167b21463c7)}}},
+  {{{ UINT64_C(0x3ccfa1b4bd9358ed), UINT64_C(0x4ae31ec7a5e64f46), UINT64_C(0x2776e9b66a976e61)}},
+   {{ UINT64_C(0x4b75dd76d257167d), UINT64_C(0x6705fce0ef498670), UINT64_C(0x6f0dba5907d16395)}}},
+  {{{ UINT64_C(0xcf56150a71ec45c0), UINT64_C(0xf0c6097f1f0e6e3d), UINT64_C(0x9b551944019c73a5)}},
+   {{ UINT64_C(0xb422b5c7d4144154), UINT64_C(0x88b7f8300f6f3a07), UINT64_C(0x44465d48c9f73f88)}}},
+  {{{ UINT64_C(0x46e9d57dac1f85aa), UINT64_C(0x3cda081488048682), UINT64_C(0x3b6ebdf2077ec6b8)}},
+   {{ UINT64_C(0x7c33bab087506404), UINT64_C(0xafba2ea625273a51), UINT64_C(0x2d88f9e69c3bcfd0)}}},
+  {{{ UINT64_C(0x861e27ee7c7e15f8), UINT64_C(0xf2b8afc6c7fdf38c), UINT64_C(0x2f57236f125a47d4)}},
+   {{ UINT64_C(0xe7df02168d410c3e), UINT64_C(0x39e3a513c6758dcb), UINT64_C(0xbc2f6e2b64bf9508)}}},
+  {{{ UINT64_C(0xa661b1972a5fb091), UINT64_C(0x9b7b955e863e27b5), UINT64_C(0xae5ea83ee1831bb1)}},
+   {{ UINT64_C(0xa0f883dd4922b4a6), UINT64_C(0xe5539e910bcd3b59), UINT64_C(0xa73d08f757d60755)}}},
+  {{{ UINT64_C(0x5cdbf282754191d1), UINT64_C(0x9eb5f2629eb58a4e), UINT64_C(0x06ddb78daad0a0d4)}},
+   {{ UINT64_C(0xe3689d4294c01571), UINT64_C(0x5c295a4d3c9f5f72), UINT64_C(0xd825b4bb5dc37c03)}}},
+  {{{ UINT64_C(0xe11b0c2006dd47ad), UINT64_C(0xe493a5d89d4131b8), UINT64_C(0xff1059d8add8eb75)}},
+   {{ UINT64_C(0x2d9681a049c1baf8), UINT64_C(0x5a016d40e7eea3da), UINT64_C(0x98e1f352e2d7e58a)}}},
+  {{{ UINT64_C(0xd56b37d92e0863f8), UINT64_C(0x990c639e5669c3ba), UINT64_C(0x3cfdc0684233e9e6)}},
+   {{ UINT64_C(0xfce6e0d1fba81e99), UINT64_C(0x1098404ccd64cc2d), UINT64_C(0x430a7e1d4c5883bc)}}},
+  {{{ UINT64_C(0x98f2ecd8fe402c19), UINT64_C(0x4fff1aca76c94df1), UINT64_C(0x87830c3b76003380)}},
+   {{ UINT64_C(0x6ee7fc891cfc5b76), UINT64_C(0xe8a0283c41c87d8a), UINT64_C(0x3842081ca86f6b18)}}},
+  {{{ UINT64_C(0xcb0557b4fc4afbf0), UINT64_C(0xa0e617346fc1e42a), UINT64_C(0x02408846f8d5e619)}},
+   {{ UINT64_C(0x700e40931af7d1f0), UINT64_C(0x7b20513b7a72d0d3), UINT64_C(0x82b3377a60ce7157)}}},
+  {{{ UINT64_C(0x4493f0aef0d1632a), UINT64_C(0x062d2453014330d9), UINT64_C(0xfc870ebc2cc3b502)}},
+   {{ UINT64_C(0xe5aff352243a5afe), UINT64_C(0x37df19f4895c8ae2), UINT64_C(0x81734c15659081f7)}}},
+  {{{ UINT64_C(0x91c2891ef8d05476), UINT64_C(0xe4872af37e30a99a), UINT64_C(0xb5037fa9ed6cc8de)}},
+   {{ UINT64_C(0xc2dfaa8a84234346), UINT64_C(0xef49ceee50dc8831), UINT64_C(0x2e2af41581823f72)}}},
+  {{{ UINT64_C(0x667c849a80cb9815), UINT64_C(0x7b60b1a4221d108b), UINT64_C(0x45be31ced5d71505)}},
+   {{ UINT64_C(0xeee8a0856113ec2d), UINT64_C(0x229aca6c5c94a556), UINT64_C(0xe6cb2a0f72e0ada4)}}},
+  {{{ UINT64_C(0xb2756d16123b8420), UINT64_C(0x7b2b39b0d50ab333), UINT64_C(0xf1391c086180a208)}},
+   {{ UINT64_C(0xc49f747f31cfc198), UINT64_C(0x2e1745e545ffeb3f), UINT64_C(0x462ed995f6b4aabc)}}},
+  {{{ UINT64_C(0x66b3c9f746dd3b61), UINT64_C(0xcb9d3fd26f787032), UINT64_C(0x2282b86a3635a129)}},
+   {{ UINT64_C(0xce9fd927640f4187), UINT64_C(0x0af989057a4cee95), UINT64_C(0x1ed9b1e84022a5fd)}}},
+  {{{ UINT64_C(0xf4d71acbee9297df), UINT64_C(0x12652cc5f39779d6), UINT64_C(0x5855bdadc6a022b3)}},
+   {{ UINT64_C(0x429035a70c4101d2), UINT64_C(0x3dca3142440a3236), UINT64_C(0x0e73698bb8581b8a)}}},
+  {{{ UINT64_C(0x4c68ffb0e09db5f0), UINT64_C(0x7c9d250f248a97db), UINT64_C(0xa5d93c260ae40458)}},
+   {{ UINT64_C(0x6593e69c9f3596b4), UINT64_C(0x50002f2994353662), UINT64_C(0x23e4111fd5f5ff93)}}},
+  {{{ UINT64_C(0x801ac53214f4f685), UINT64_C(0x5d5be85d643c05ed), UINT64_C(0x94f2ccc435318b3f)}},
+   {{ UINT64_C(0x186dd3098aeb4506), UINT64_C(0x66d8c50041ba6b22), UINT64_C(0x7efe4491bb8dd652)}}},
+  {{{ UINT64_C(0x534cc86233226577), UINT64_C(0x9d0fa3842713e7a4), UINT64_C(0xe3b984901f1189d9)}},
+   {{ UINT64_C(0x0699a0ce12d20f72), UINT64_C(0x0cac1b573de7e031), UINT64_C(0x889736af74106c31)}}},
+  {{{ UINT64_C(0xafdd40ba5f9b4a68), UINT64_C(0x5cf864458040e7e4), UINT64_C(0x1f80f098ca91122d)}},
+   {{ UINT64_C(0xe2fdbb6618dcd5f6), UINT64_C(0xf3b80a5aeffcba5c), UINT64_C(0x350116586d46392e)}}},
+  {{{ UINT64_C(0x04a86648780121a0), UINT64_C(0xfc84e65bb7f53f45), UINT64_C(0x0caf768ca923701e)}},
+   {{ UINT64_C(0x208625f85c397b0a), UINT64_C(0x4791c11cf70715b7), UINT64_C(0xac70e0d0595e1b29)}}},
+  {{{ UINT64_C(0xa32de733aa4e52f4), UINT64_C(0xc207c0611fe76060), UINT64_C(0x06b425b3d6a52b0d)}},
+   {{ UINT64_C(0xe8e6797c92cd5834), UINT64_C(0x85bdd808f1068de0), UINT64_C(0x141fa3b000c06a53)}}},
+  {{{ UINT64_C(0xedff0f6a0ce9d5f2), UINT64_C(0x217fb84d44839763), UINT64_C(0x337e842b5561d547)}},
+   {{ UINT64_C(0xfe528869da1dd759), UINT64_C(0x90b66f5618245a0d), UINT64_C(0xd34ac3048497781a)}}},
+  {{{ UINT64_C(0x3e3d9ff1b4bf98e9), UINT64_C(0x472aef8c47aa1ab9), UINT64_C(0x916b7c8c565cb402)}},
+   {{ UINT64_C(0xc50a0629efd47274), UINT64_C(0xeaa7a384efbbba73), UINT64_C(0x9921893825d97aae)}}},
+  {{{ UINT64_C(0x77a92cfd7cd0503a), UINT64_C(0xd2fcc01b5bc17cc3), UINT64_C(0x7948dcec729500bd)}},
+   {{ UINT64_C(0xccafbff1a8b707cc), UINT64_C(0x3cdb9be13f809832), UINT64_C(0x19b7ded6174bd0f7)}}},
+  {{{ UINT64_C(0x76a1f494cde903b6), UINT64_C(0x878f8340bdeb9354), UINT64_C(0x755297ce307036e0)}},
+   {{ UINT64_C(0x350a376493b71215), UINT64_C(0x70ca78c4bbbf6461), UINT64_C(0x9543fae8f767a64e)}}},
+  {{{ UINT64_C(0x91bc8c52dda7e8d0), UINT64_C(0xbd1848d4e485f7ea), UINT64_C(0xce604ba3d93dbad3)}},
+   {{ UINT64_C(0xe4dfbe7688cd3492), UINT64_C(0xcd2b239edc917ab3), UINT64_C(0x35f720bd5a8be208)}}},
+  {{{ UINT64_C(0x7fe248947fd7139e), UINT64_C(0xc4ee3ab6fcfb5167), UINT64_C(0x51c7380dd9e46754)}},
+   {{ UINT64_C(0xfef2ad875c8804a9), UINT64_C(0x86783e54c0a40455), UINT64_C(0x1c1e664a1102a6c6)}}},
+  {{{ UINT64_C(0x7b261efb81f637d2), UINT64_C(0xfb1afcdd827e8674), UINT64_C(0xdd7b2fc6a64f7706)}},
+   {{ UINT64_C(0xec21aa4099c55f4d), UINT64_C(0x0d27d8d740765e81), UINT64_C(0xdf2cbe94599eaa4a)}}},
+  {{{ UINT64_C(0xe5963cc7da180c44), UINT64_C(0x7c4ae8b8a2892402), UINT64_C(0xe77df3336f542d2a)}},
+   {{ UINT64_C(0x076d98e4f4606f36), UINT64_C(0x65f3809afb99091a), UINT64_C(0x3594d4a962c47262)}}},
+  {{{ UINT64_C(0xc183efcbbce9c66a), UINT64_C(0x8f4a208327715197), UINT64_C(0x5cbba7e6c06deb80)}},
+   {{ UINT64_C(0xfd1bea75eb010724), UINT64_C(0x1d91cea3c6550916), UINT64_C(0xa43f433ac7722ed7)}}},
+  {{{ UINT64_C(0x94a3496295616daa), UINT64_C(0x53f60d6b0e9d8b6d), UINT64_C(0x6057ccef90505702)}},
+   {{ UINT64_C(0x45da7049d8c8a9f8), UINT64_C(0x5ffe05ce1c9fc73e), UINT64_C(0x24505dd7b6afb2fd)}}},
+  {{{ UINT64_C(0x6980e77aa8fa0a70), UINT64_C(0x3bf9448dc29a5c51), UINT64_C(0x3e9064e5af13fc26)}},
+   {{ UINT64_C(0x837a1ab5d2d73def), UINT64_C(0x911ac451f1a01792), UINT64_C(0x7dc9c8220808b10b)}}},
+  {{{ UINT64_C(0x167e73686d5cdd6d), UINT64_C(0xf214ecb16df015c4), UINT64_C(0x24cfcbf2d3b8aea8)}},
+   {{ UINT64_C(0x458b34ade37c8af9), UINT64_C(0xb95859cb6065269a), UINT64_C(0xd8a8ca20119332ac)}}},
+  {{{ UINT64_C(0xe84ec511efc184b7), UINT64_C(0x7399a20b86ef5e18), UINT64_C(0x64d8dad9b61fe41e)}},
+   {{ UINT64_C(0x2cbd6d334f12c699), UINT64_C(0x142f5eacdb9f3c35), UINT64_C(0x3555c4adba0861e7)}}},
+  {{{ UINT64_C(0x925f2a020cf87533), UINT64_C(0xdec5104013478fa9), UINT64_C(0x725bd7c6a87eacce)}},
+   {{ UINT64_C(0x561d6c47cea0a614), UINT64_C(0xa068effd0faa7bfb), UINT64_C(0x67b232a47d90c86e)}}},
+  {{{ UINT64_C(0x63778ece96ede3ec), UINT64_C(0x0bf3b5d541eef739), UINT64_C(0x82d4219621f10179)}},
+   {{ UINT64_C(0x1df2305fa18086a6), UINT64_C(0xc7f1eb7f279262ac), UINT64_C(0x9cfc897f545a0df1)}}},
+  {{{ UINT64_C(0x3f7454d1d55fb176), UINT64_C(0xd8e848b1a5bcbd24), UINT64_C(0xdc6ac3da143d54b4)}},
+   {{ UINT64_C(0x83a7677cde156a8f), UINT64_C(0x2b6bf032a4ec9092), UINT64_C(0xc6cbb3beba917408)}}},
+  {{{ UINT64_C(0xb636f7aa53e471b5), UINT64_C(0x961ea8154fda1485), UINT64_C(0xda0288deb33f2f87)}},
+   {{ UINT64_C(0x35e63a90c091a206), UINT64_C(0x21a370840d415cf2), UINT64_C(0x313e8262ae749c8d)}}},
+  {{{ UINT64_C(0x5a5dd3ab941aa207), UINT64_C(0x6bbb27b5ea7ce9bb), UINT64_C(0xe6b75c08f8c1ac76)}},
+   {{ UINT64_C(0x3013eeb2701cdd26), UINT64_C(0xa8c4b154f25bd58f), UINT64_C(0x88f2886fceecc4d3)}}},
+  {{{ UINT64_C(0xbdec5cf5a4ed704a), UINT64_C(0xf22138d19dfbbee6), UINT64_C(0xe62429296ebbcc1d)}},
+   {{ UINT64_C(0x7aeccee2c80a0b8f), UINT64_C(0x1e1b0eae28b1c8b2), UINT64_C(0xa6e8ced78a614683)}}},
+};
+
+#endif
+
+static const mzd_row192_t Li_0[] = {
+  {{ UINT64_C(0xa7c227bc00cf0b07), UINT64_C(0xba1608e6ee91781d), UINT64_C(0x0d9ec910b3851202)}},
+  {{ UINT64_C(0xc5993c0f1ffe60b6), UINT64_C(0x3abd7b47c1c97e35), UINT64_C(0x49168daa1cd6d4f7)}},
+  {{ UINT64_C(0xc640e121cdf4618c), UINT64_C(0xe1bba8c66e482369), UINT64_C(0xb8a02fe2f8b791e8)}},
+  {{ UINT64_C(0x8428d69ca739bc3b), UINT64_C(0x9753e3a34baf79ba), UINT64_C(0x8bb5e6213b51f44e)}},
+  {{ UINT64_C(0xf9cf6dac80870ba1), UINT64_C(0xc5e976ca6385a011), UINT64_C(0x9970a9c6a2e14dc1)}},
+  {{ UINT64_C(0x6042e510fcd3c582), UINT64_C(0x99167f64e02776fb), UINT64_C(0xee5b207c5eca2609)}},
+  {{ UINT64_C(0xb17706ca89b6a71a), UINT64_C(0x2f72927059c314d5), UINT64_C(0xbafdf7b587b16070)}},
+  {{ UINT64_C(0x7d1bfe75ad9ee8ad), UINT64_C(0xaf37781c96be3fc1), UINT64_C(0x36644169b62f0968)}},
+  {{ UINT64_C(0x715d7cfbc103407e), UINT64_C(0xb2f5961370b4d278), UINT64_C(0xfbc3a166945859d4)}},
+  {{ UINT64_C(0x381990d7a8187f3a), UINT64_C(0x69a1db2795575afd), UINT64_C(0x2b6ca455a12e3048)}},
+  {{ UINT64_C(0x5eca4f1ee0895b3c), UINT64_C(0x23116b574b35c04b), UINT64_C(0xb67ad9e43cd7945a)}},
+  {{ UINT64_C(0xe2522d657cd452c0), UINT64_C(0x9488a761e734d5c5), UINT64_C(0xca7b6a74931d0e26)}},
+  {{ UINT64_C(0xa14ba962af0a6cd6), UINT64_C(0x5d790032b6824538), UINT64_C(0x848e5aaef8eda3ad)}},
+  {{ UINT64_C(0x68377f7031177341), UINT64_C(0x06d1d0bef5274b46), UINT64_C(0xa8aef2bc51175982)}},
+  {{ UINT64_C(0x4dd628787c65a88f), UINT64_C(0xf00db57e2a5c7d6a), UINT64_C(0x5a2e3590ecc5e070)}},
+  {{ UINT64_C(0xed2394addf61085f), UINT64_C(0x390694de1fa0c0d9), UINT64_C(0x520e656a5ebebf9c)}},
+  {{ UINT64_C(0x465985eb2bdc1aef), UINT64_C(0x7f4c2f7d720dfa50), UINT64_C(0x18bb19ecb2ba623f)}},
+  {{ UINT64_C(0x9d813b469e25f815), UINT64_C(0xae714d83e6fcaf98), UINT64_C(0xd2ae41167e431c97)}},
+  {{ UINT64_C(0x9463a7da10457a0b), UINT64_C(0xb949e9367e8a0193), UINT64_C(0x678f567da0ef2540)}},
+  {{ UINT64_C(0x82ed01f482861ed7), UINT64_C(0x2b178780f0443c39), UINT64_C(0x00a2b86f095bd4d4)}},
+  {{ UINT64_C(0xdc3eceab81c654b6), UINT64_C(0xa2e41cf402528616), UINT64_C(0xe67ad94a4906d08d)}},
+  {{ UINT64_C(0x9c01fcdff9cdfdc4), UINT64_C(0xdd27b4076b0f3d8b), UINT64_C(0x303acf54f29c94bd)}},
+  {{ UINT64_C(0xef48b5177a9c3757), UINT64_C(0xc44b1a39b7e3fcad), UINT64_C(0x80092591bee3305b)}},
+  {{ UINT64_C(0x03c239a34f255632), UINT64_C(0xb2c04cfaebcd5d08), UINT64_C(0xb0d3252d2f4ff3d1)}},
+  {{ UINT64_C(0x6845cb03c1adf53a), UINT64_C(0xef73f2ae4b12fe61), UINT64_C(0x6a86a3e219457e5b)}},
+  {{ UINT64_C(0xb73e31f74cb95f2e), UINT64_C(0xa69643324d07adec), UINT64_C(0x6d3742dea401fbcf)}},
+  {{ UINT64_C(0xc8a6a8c4b1b40f0c), UINT64_C(0x048eee79aaae0829), UINT64_C(0xc6af2d9385697115)}},
+  {{ UINT64_C(0x34aced97f8fae259), UINT64_C(0x9187212525926b07), UINT64_C(0xc8ac3cb2c0b345ab)}},
+  {{ UINT64_C(0xfaf278bcb0ee1b29), UINT64_C(0xc24b5ad3c367c8ca), UINT64_C(0x15af2509229042c1)}},
+  {{ UINT64_C(0x942018cfca696dbb), UINT64_C(0x0fda1f3c0cfa4de7), UINT64_C(0x769f0272f35e1dc5)}},
+  {{ UINT64_C(0x3a5c6087317da280), UINT64_C(0x264c317185ce2d4b), UINT64_C(0x614becaa2d9e1556)}},
+  {{ UINT64_C(0x1a953b3276aa1407), UINT64_C(0x2ff963d5bb53ea09), UINT64_C(0x0f4275a76a2beea9)}},
+  {{ UINT64_C(0xea8b9b6699c1865b), UINT64_C(0x5e9383c44a998624), UINT64_C(0x5dcb99f84c5f1d3d)}},
+  {{ UINT64_C(0x4749b26e0c54dccf), UINT64_C(0x811e01d7e8599b4a), UINT64_C(0xf5cb135fa0204e31)}},
+  {{ UINT64_C(0xec9fbdeb3594d205), UINT64_C(0x766eeac625183f4e), UINT64_C(0xf12278e1faf70848)}},
+  {{ UINT64_C(0x650cb9dadca509e6), UINT64_C(0xcb2604412827b5d2), UINT64_C(0x9b7ccc3217ebe505)}},
+  {{ UINT64_C(0xa6a5da18d51c2df8), UINT64_C(0xb4ba95e2ea4e87c5), UINT64_C(0x711ada5daf733d86)}},
+  {{ UINT64_C(0xb1114c965d9d0a3e), UINT64_C(0xe0cddfabd68fa262), UINT64_C(0x052b0693a9d07444)}},
+  {{ UINT64_C(0x20743ed2013a6540), UINT64_C(0xfc2d2faf27ed718b), UINT64_C(0xfc21ac9af83c74fc)}},
+  {{ UINT64_C(0xfa74944d58fbc7d0), UINT64_C(0x3efa91de72254d91), UINT64_C(0x15ce333b6aa9a593)}},
+  {{ UINT64_C(0x9f614c2ff3a90a31), UINT64_C(0xa2a63004369c8862), UINT64_C(0xcda1c27ee5ed76e1)}},
+  {{ UINT64_C(0x20ececfd20787fb5), UINT64_C(0x6c26fd571aee8c93), UINT64_C(0xc5a56967cd5f9a36)}},
+  {{ UINT64_C(0xd7e43175e8c0c1ff), UINT64_C(0xc400618975da9d90), UINT64_C(0xd993716d67a37009)}},
+  {{ UINT64_C(0x8abcb08cf9caedb2), UINT64_C(0xd3ecd9196cdd1869), UINT64_C(0xfb8e2978f2b2cfed)}},
+  {{ UINT64_C(0xa156a789b896ae6e), UINT64_C(0x255da60b73606e69), UINT64_C(0xe11a065e83340056)}},
+  {{ UINT64_C(0xe015397a9efe3f19), UINT64_C(0xe458dbde816f56df), UINT64_C(0x5dc17ca8aa20ce5f)}},
+  {{ UINT64_C(0x31bf31ac6b0dbc53), UINT64_C(0xc266603d37537bb4), UINT64_C(0x32aefb3f5b3e1cd9)}},
+  {{ UINT64_C(0x0c622c93c178658c), UINT64_C(0xc5aa8a50bae1f8bc), UINT64_C(0x81dc925e3aaa25cc)}},
+  {{ UINT64_C(0xf20085e57713ee4b), UINT64_C(0x4ed7ccdbe02dfd6b), UINT64_C(0x7181c1f89e0e4839)}},
+  {{ UINT64_C(0x7bddf330671fb96f), UINT64_C(0x7175afb91b084c57), UINT64_C(0xf02cb7955a275f8b)}},
+  {{ UINT64_C(0x439703ee364164f0), UINT64_C(0x4c5e30682949c0cf), UINT64_C(0x24ff32e1b3b13800)}},
+  {{ UINT64_C(0xcc34ed6cf9492922), UINT64_C(0x413bd399dc132165), UINT64_C(0xa4793db641d55010)}},
+  {{ UINT64_C(0xd94e5311ed74e02b), UINT64_C(0xf4cedaf104e8d62a), UINT64_C(0xa2bfb224a7978274)}},
+  {{ UINT64_C(0xb7730d31d55df73b), UINT64_C(0xa3344d136e495f5d), UINT64_C(0x4743cff32c8ddba2)}},
+  {{ UINT64_C(0xd1311ebbcc981776), UINT64_C(0xdf44a231ea54db66), UINT64_C(0xe4e528447ef65eb9)}},
+  {{ UINT64_C(0xd4703e69b57f213f), UINT64_C(0x540bf4d2da2ad267), UINT64_C(0xa1878109fa2509ec)}},
+  {{ UINT64_C(0x515ead9223dc460f), UINT64_C(0x2e32657204f4972f), UINT64_C(0x3458f1604bb19410)}},
+  {{ UINT64_C(0xf37b7b706a2cd72d), UINT64_C(0x068c9a17593c6950), UINT64_C(0x14969b2153ec2402)}},
+  {{ UINT64_C(0x1981704434467ada), UINT64_C(0x917295bfba3403d0), UINT64_C(0x9575135ac4eba572)}},
+  {{ UINT64_C(0xdaac75f765244475), UINT64_C(0x134c4ae3a234a416), UINT64_C(0xc0776cffbee5b276)}},
+  {{ UINT64_C(0x212ed5eab78533b3), UINT64_C(0x612a5850c81ba54a), UINT64_C(0x1b482b120bd2e667)}},
+  {{ UINT64_C(0x05a177c9509c7c43), UINT64_C(0xce54e43aea49b4bd), UINT64_C(0xd06d962ccd03517f)}},
+  {{ UINT64_C(0xf5b49130b17ef307), UINT64_C(0x48e4dd2f4e47896b), UINT64_C(0xa8fb46261f770979)}},
+  {{ UINT64_C(0xacf8449525d3628a), UINT64_C(0x7bec1477d6e5eb3d), UINT64_C(0xe9ebd6a8a1a3b54c)}},
+  {{ UINT64_C(0x26716d02c4b2d031), UINT64_C(0xfa29d80f6cd482b6), UINT64_C(0x0a32c6f08c03ea8d)}},
+  {{ UINT64_C(0x893365ef1b8f7d67), UINT64_C(0x687e63380dc755b3), UINT64_C(0x6cea7cbe1d997df6)}},
+  {{ UINT64_C(0xcddfdcf0e7a9df2b), UINT64_C(0xe0e6ec24c6093c16), UINT64_C(0x79c42f2197060df2)}},
+  {{ UINT64_C(0xb0972b91d3f9a710), UINT64_C(0x2a3726c2f7f0b894), UINT64_C(0xf4f045540012a8c3)}},
+  {{ UINT64_C(0x853733b89ffddb96), UINT64_C(0xa7ce771d6cecf6cf), UINT64_C(0x07f78b04076710c1)}},
+  {{ UINT64_C(0x16daea6acb98e871), UINT64_C(0x98cd70ad1268e329), UINT64_C(0xc77c532b3eee9582)}},
+  {{ UINT64_C(0xc519b7843e0595af), UINT64_C(0xd0e4233d2a61e0b5), UINT64_C(0x29ab652719d1ff4d)}},
+  {{ UINT64_C(0xd2e2f796c9dc6207), UINT64_C(0xee35f899bd43e4e3), UINT64_C(0x39ffcb9e51b74177)}},
+  {{ UINT64_C(0x3bcd6a76ea3f7679), UINT64_C(0x613f52e7c121fca4), UINT64_C(0xbbb1b5f0548e9664)}},
+  {{ UINT64_C(0x9f2ca62e611ec3e0), UINT64_C(0x2df1fd75ec45773c), UINT64_C(0x50f6d9f362a164ef)}},
+  {{ UINT64_C(0x42971336c2b9ecd9), UINT64_C(0x9b661b7bcc104fd7), UINT64_C(0x327814f8d4506bec)}},
+  {{ UINT64_C(0x08828a909c1bab5a), UINT64_C(0xeb585bb393b116f7), UINT64_C(0x659865f96a46082f)}},
+  {{ UINT64_C(0x8099f0a6e74af083), UINT64_C(0x6bddae66cb157bd4), UINT64_C(0xf29c7fe7c71673bb)}},
+  {{ UINT64_C(0xff78db62f5ea0403), UINT64_C(0xaa55b22e126ead54), UINT64_C(0xc2dcaab52e531b49)}},
+  {{ UINT64_C(0x852def1943cd57f0), UINT64_C(0x40a9e1f6f8954a1f), UINT64_C(0xf7a1616c84a1dbcc)}},
+  {{ UINT64_C(0xf4bcce922c084d72), UINT64_C(0x0b8f15d55d42ed73), UINT64_C(0xf1a0f86a857d88d2)}},
+  {{ UINT64_C(0xe12dbd5463dab77f), UINT64_C(0xd513d31f414812bb), UINT64_C(0x2e73b08ba535c5a2)}},
+  {{ UINT64_C(0x8ee9b01f13df1bfc), UINT64_C(0xa3eb110143816805), UINT64_C(0x94f44d99f4d80730)}},
+  {{ UINT64_C(0x0192e2c09790a664), UINT64_C(0x3e763822775d7368), UINT64_C(0xfd065214eb0379f6)}},
+  {{ UINT64_C(0x6dacad4614cbe18d), UINT64_C(0x75685a19e7e95b36), UINT64_C(0xeac12d8f1f569f6d)}},
+  {{ UINT64_C(0xb6301536802815af), UINT64_C(0x476272e3ab43d8c7), UINT64_C(0x7fdb82dfb0d1a4a5)}},
+  {{ UINT64_C(0x3f23874430227755), UINT64_C(0x16388f3b1f8fd956), UINT64_C(0xb4d288b7a1217eed)}},
+  {{ UINT64_C(0x130440fc96deda47), UINT64_C(0xba425d2c5afbfa29), UINT64_C(0x0fa6961ac326150f)}},
+  {{ UINT64_C(0x1f01cb2ffee0457a), UINT64_C(0xe6904569761d0f31), UINT64_C(0x36fdf1a2899377a8)}},
+  {{ UINT64_C(0xa921324ca375c630), UINT64_C(0x739c11d4d85fc6e3), UINT64_C(0xb26b77aa1f9cc6d8)}},
+  {{ UINT64_C(0xe8bb47a0dc44fe7f), UINT64_C(0xf1217a0b2e32d230), UINT64_C(0x96025a8362636dc6)}},
+  {{ UINT64_C(0x2a696306d9a41cbf), UINT64_C(0x4f8c72accaff26a3), UINT64_C(0x0aa78c4b7c2b3cf2)}},
+  {{ UINT64_C(0xe3d195fd4d0fa1fb), UINT64_C(0x1aca0676cc29d949), UINT64_C(0xbaaf4112cea6de7d)}},
+  {{ UINT64_C(0x1de60aa4f3e36f17), UINT64_C(0x056aa465b6d3677e), UINT64_C(0xd378514e1ce0c668)}},
+  {{ UINT64_C(0xd8e5e68d32645915), UINT64_C(0x71cb92357aae7b22), UINT64_C(0x0492a9c2120bf555)}},
+  {{ UINT64_C(0xeeb1f8bdf836341e), UINT64_C(0xb0fcb577ca14626b), UINT64_C(0xfe240182b2c3d46d)}},
+  {{ UINT64_C(0xc6eb1c03fe0bf43a), UINT64_C(0x0f879c5f1eeabf37), UINT64_C(0x21f5063113485eb7)}},
+  {{ UINT64_C(0xaaa772fb7d92dd5d), UINT64_C(0xae1608c2a9f880f0), UINT64_C(0xa2756a738a1d52d1)}},
+  {{ UINT64_C(0x877c03db5498031b), UINT64_C(0xf0b212fbba2e14b6), UINT64_C(0x962e190ef31087bd)}},
+  {{ UINT64_C(0x027c660518d60567), UINT64_C(0x800a3821b6b2649d), UINT64_C(0xc3b238d17e35cefa)}},
+  {{ UINT64_C(0x2943e5e943febce8), UINT64_C(0x391b73d98920aeba), UINT64_C(0x82c8e5298f0b94f2)}},
+  {{ UINT64_C(0x3a3b6d74d66a773e), UINT64_C(0x394e7ad11f472728), UINT64_C(0x84253c29b2ea5341)}},
+  {{ UINT64_C(0x6c34589c205881f5), UINT64_C(0x8a4d1b42bc6c5d52), UINT64_C(0xa5c17df7e97e6f3a)}},
+  {{ UINT64_C(0x5c4482fda50efcbc), UINT64_C(0x633fef1a91c7478e), UINT64_C(0x274a72d09fc295c7)}},
+  {{ UINT64_C(0x2858b9aa51c7dabd), UINT64_C(0x5f52cb13f481eb03), UINT64_C(0xc1dc16d7bf7dadfa)}},
+  {{ UINT64_C(0x2dcf0bd0192c7a66), UINT64_C(0x7012bd9760f10694), UINT64_C(0x2775233ab16316bd)}},
+  {{ UINT64_C(0xc58ab34d2a9b178b), UINT64_C(0x4f4d120513a94730), UINT64_C(0x18429b6cdd388533)}},
+  {{ UINT64_C(0x2a55492ce9b76a50), UINT64_C(0xc57ed73a6e3b9095), UINT64_C(0xaf09ade78e337e30)}},
+  {{ UINT64_C(0xa1e07d85e25f7732), UINT64_C(0x56250839447c3560), UINT64_C(0x2842d5fa21a6ba3d)}},
+  {{ UINT64_C(0x9772c420ce60988f), UINT64_C(0x925ac83d7cc6f01d), UINT64_C(0xdaf74967c7c03290)}},
+  {{ UINT64_C(0xeb88686c569fb4af), UINT64_C(0x37e0b9ce8d237831), UINT64_C(0xe285e99a1329169c)}},
+  {{ UINT64_C(0xb7090648593f93ee), UINT64_C(0xfaf634556babe30f), UINT64_C(0x139e73c87c48d68b)}},
+  {{ UINT64_C(0xf2d640e899277062), UINT64_C(0x9c37f2d7510d2525), UINT64_C(0xd3252b1cfbc616af)}},
+  {{ UINT64_C(0xc305a195d227c37b), UINT64_C(0x409ad64864cc436c), UINT64_C(0xa7b5f0da6d568fd1)}},
+  {{ UINT64_C(0x04743c06a8257b0d), UINT64_C(0xfc8460683619c8f3), UINT64_C(0x4b2928959be0543f)}},
+  {{ UINT64_C(0x342d091b36c9d49d), UINT64_C(0x2dab878f8d05b863), UINT64_C(0x240d21be036067d9)}},
+  {{ UINT64_C(0x3f3067014ed65105), UINT64_C(0x1f5898890e25ccd7), UINT64_C(0xc93fe022131f0696)}},
+  {{ UINT64_C(0x6c5559349b6d865d), UINT64_C(0xecb3e4f57344bf3e), UINT64_C(0xc8bae09ef544a652)}},
+  {{ UINT64_C(0xc0a1abc3001e2033), UINT64_C(0xa8240f494ac055f2), UINT64_C(0xc00233335597eb62)}},
+  {{ UINT64_C(0xfe7a9c4b20c5dc44), UINT64_C(0xe61f29d5de7fff25), UINT64_C(0xbfe5787fef763883)}},
+  {{ UINT64_C(0x8abde64bf3225d69), UINT64_C(0x432aac4e5081361b), UINT64_C(0x7e53a00da08a6c3d)}},
+  {{ UINT64_C(0xd9e8483ee5dab466), UINT64_C(0x093ada06bbfc726d), UINT64_C(0xa834f67ae8103bc8)}},
+  {{ UINT64_C(0xbbc7551566f73223), UINT64_C(0x26117505c68ee19b), UINT64_C(0x6de20e2421ae8be4)}},
+  {{ UINT64_C(0x2a4d2176e89e56b2), UINT64_C(0xe2c8c314656d1986), UINT64_C(0xf49861b8b3e5c565)}},
+  {{ UINT64_C(0x3d867d03d5802970), UINT64_C(0x648a271638615ec7), UINT64_C(0x168ca8ecd5a80405)}},
+  {{ UINT64_C(0x307e25f5277788fd), UINT64_C(0xf200f4741babd14b), UINT64_C(0xa97d5ea1cb2e749e)}},
+  {{ UINT64_C(0xcb5182a09214948b), UINT64_C(0x09f37c1d8c0c976e), UINT64_C(0x2533431418dc6052)}},
+  {{ UINT64_C(0xabe6efcdf7c691a4), UINT64_C(0xcd4b24b7bc55ac72), UINT64_C(0x2089e750896aa651)}},
+  {{ UINT64_C(0x14ab9afb0a424c95), UINT64_C(0x350a915d93bec116), UINT64_C(0xbef7799de7aa34ea)}},
+  {{ UINT64_C(0xc32f7adba4f05f2f), UINT64_C(0x41b81c22709ba784), UINT64_C(0x2a586d21b3f459f2)}},
+  {{ UINT64_C(0xa4e269355f79f9f6), UINT64_C(0xfbb4b10876fbb9c8), UINT64_C(0x0288e2c4966f7c93)}},
+  {{ UINT64_C(0x4f48cc87c00eea6b), UINT64_C(0xe7acec1329ef268b), UINT64_C(0xd28a1af3c3ff099a)}},
+  {{ UINT64_C(0x89fb78acf786e3f3), UINT64_C(0x3147b196047a067a), UINT64_C(0x2251d993c919309d)}},
+  {{ UINT64_C(0xe297ff115275de0b), UINT64_C(0x62e52890aa309d50), UINT64_C(0xd77c0be973aa3c77)}},
+  {{ UINT64_C(0x1dca74b2ed506e9e), UINT64_C(0xcee98dd5448d93a3), UINT64_C(0x1fd3380484fe0ad4)}},
+  {{ UINT64_C(0x916398daddd6bf72), UINT64_C(0x288e775aed7e130d), UINT64_C(0x27a0d57d3a61a066)}},
+  {{ UINT64_C(0xf97b3a112b2e0df3), UINT64_C(0xf2621d80e670eb02), UINT64_C(0x5372f132c99c2845)}},
+  {{ UINT64_C(0x07649d049717398a), UINT64_C(0x5b6c8d7a2211c05e), UINT64_C(0x2847d600fce66eb1)}},
+  {{ UINT64_C(0xd20fc0d1219b294c), UINT64_C(0x417503337b213f48), UINT64_C(0x83dd58d4871415f8)}},
+  {{ UINT64_C(0xc53ffec0bdc5a391), UINT64_C(0x13fa9bd81259fa7e), UINT64_C(0x14c8b6291dc13ed1)}},
+  {{ UINT64_C(0xdb1964a166f4eaf5), UINT64_C(0xee95eb3f202bcb4a), UINT64_C(0xae2514a8f93ebbd3)}},
+  {{ UINT64_C(0x490a57219ab20fd6), UINT64_C(0xcdc2f5458fbb485d), UINT64_C(0x6bb2d16d2dbee0c3)}},
+  {{ UINT64_C(0x927c1b42a4de0569), UINT64_C(0x7a67087a1d0a6674), UINT64_C(0xfa8f71790f2390e0)}},
+  {{ UINT64_C(0x78321c3e7b83cb31), UINT64_C(0xf1cf8f15a93f5c13), UINT64_C(0xb7c50f63bbcdda00)}},
+  {{ UINT64_C(0x98bb520be2ffa2ed), UINT64_C(0x754e9a1704a01be6), UINT64_C(0x4c4d0043587ea817)}},
+  {{ UINT64_C(0x39f20823684c5ae3), UINT64_C(0xca78cb5ae616853f), UINT64_C(0x2bc84e68baa07ecc)}},
+  {{ UINT64_C(0xcfc2b8f2da46cc15), UINT64_C(0xb931067951a8ab4a), UINT64_C(0x15c77a9b200a2756)}},
+  {{ UINT64_C(0x3eefbbcfd6ca0e65), UINT64_C(0x8954940bd0999b8c), UINT64_C(0xe85c36e790589bb7)}},
+  {{ UINT64_C(0xd03dbab0cce2449a), UINT64_C(0x7112656909f29711), UINT64_C(0xf668005efd868449)}},
+  {{ UINT64_C(0x99a0fdbd962ec200), UINT64_C(0x5f23bcdb65a428f3), UINT64_C(0xdee5a50e37d66f48)}},
+  {{ UINT64_C(0x4b35d696968cc88f), UINT64_C(0x6916681502457108), UINT64_C(0xd107620734292ca1)}},
+  {{ UINT64_C(0xa4055b75be5b3b6c), UINT64_C(0x60dddfa974faab5b), UINT64_C(0x71df008a4eecfee0)}},
+  {{ UINT64_C(0xed599edeaa6232f7), UINT64_C(0x73765c931284738c), UINT64_C(0x0d03ffb8d84891b3)}},
+  {{ UINT64_C(0x973c2aa537b19d52), UINT64_C(0xcc1213726ed17566), UINT64_C(0x43c2dd6d5e43b7b6)}},
+  {{ UINT64_C(0x0d084d51e7d8916a), UINT64_C(0xfc5484448f6f0f96), UINT64_C(0xe624db60b3a95e84)}},
+  {{ UINT64_C(0x768d7a771f67a87d), UINT64_C(0x4c1e8e260a6ad928), UINT64_C(0x4bb59899fc4c9cdd)}},
+  {{ UINT64_C(0x68d7b9a4dcc2a45a), UINT64_C(0xa65378e6087be015), UINT64_C(0xebfec474cf5eb29d)}},
+  {{ UINT64_C(0xf80f1ca8cca59c4c), UINT64_C(0xe69d1f5e74853948), UINT64_C(0x2c05f09c5fc057e4)}},
+  {{ UINT64_C(0x0cf08ca379407d9b), UINT64_C(0x876a952ab5169fdb), UINT64_C(0x038b89cab7af2939)}},
+  {{ UINT64_C(0x810c078046cd3cec), UINT64_C(0x2c685e98c6e4d909), UINT64_C(0x9576887fc8a8e9ff)}},
+  {{ UINT64_C(0x491b5b16ac010c93), UINT64_C(0x47d88d6a4f68f091), UINT64_C(0x3e2678eaef878c65)}},
+  {{ UINT64_C(0x8c3463d9a8cdd343), UINT64_C(0xea7e3909b4939b90), UINT64_C(0x68897090f591b5d9)}},
+  {{ UINT64_C(0x10feddd5af6b52a3), UINT64_C(0x770de4bc7c5198aa), UINT64_C(0x91231e340b2c8006)}},
+  {{ UINT64_C(0x1010349728b1cf27), UINT64_C(0x531abdc3b52a097e), UINT64_C(0xa1fc6e4cc7f18a47)}},
+  {{ UINT64_C(0xff3f9f85fa48500d), UINT64_C(0x2af522c6d68072cb), UINT64_C(0xcaf0eed40d31b1ff)}},
+  {{ UINT64_C(0x467f667689a7b305), UINT64_C(0x8277f40c17ce2bca), UINT64_C(0x678cb6c16a5b1951)}},
+  {{ UINT64_C(0xf313bc26448f6ebd), UINT64_C(0x7a5ed9fea2e2edf5), UINT64_C(0x98148cbd683f0562)}},
+  {{ UINT64_C(0xc24237476825f3eb), UINT64_C(0x9384c0400185e225), UINT64_C(0xe7d11d89f2369198)}},
+  {{ UINT64_C(0x2a5703b264b2d0ac), UINT64_C(0x3adadc8cd03d438a), UINT64_C(0x5f74d3b884a22739)}},
+  {{ UINT64_C(0x1e2fbf7bbd059fb6), UINT64_C(0xf9c6fe2d648b5d29), UINT64_C(0xdec3be9e4a7c73dc)}},
+  {{ UINT64_C(0xb335cc4b3e3e7ab8), UINT64_C(0xd78e7c8bcb2fa752), UINT64_C(0xfdcb1cabd1ac7c54)}},
+  {{ UINT64_C(0x984c3710e1be0449), UINT64_C(0xa66f34dbf1dfc022), UINT64_C(0x123f00211419468a)}},
+  {{ UINT64_C(0xfdbf500b1e80e235), UINT64_C(0xb8d74fbaee6919bd), UINT64_C(0xa0c7c1872013ba7f)}},
+  {{ UINT64_C(0xeff3105fd08dcf35), UINT64_C(0x4ca16cf3937fec38), UINT64_C(0x0a082e1cd45c5f7d)}},
+  {{ UINT64_C(0x70789de67537519b), UINT64_C(0x83b88187d733e588), UINT64_C(0xb85dbb5a936f5a49)}},
+  {{ UINT64_C(0xf45b5978b2086049), UINT64_C(0xd090c839fb7f98a4), UINT64_C(0x09bc971d83044b1c)}},
+  {{ UINT64_C(0x536d6f7e2c76eea5), UINT64_C(0x1b9dd38bd581a03d), UINT64_C(0xac20da8b4f83ffbd)}},
+  {{ UINT64_C(0xaf67051a3dd742d5), UINT64_C(0xde49f88078b23607), UINT64_C(0x669ec7ef1b598185)}},
+  {{ UINT64_C(0x5f82c5503323fe53), UINT64_C(0x52feed55c91f7c6b), UINT64_C(0xf61229ef588da62e)}},
+  {{ UINT64_C(0x2d9ad45e5c7daa71), UINT64_C(0xb208ef59ea422448), UINT64_C(0x9341cf741958a4a2)}},
+  {{ UINT64_C(0x3ed5425ecd3cc477), UINT64_C(0x3cd686039c2c1750), UINT64_C(0x3244089a2842387d)}},
+  {{ UINT64_C(0x8a8d4c9b0296e8b3), UINT64_C(0xb49d9e99797d5508), UINT64_C(0x49c977e734c5b6b1)}},
+  {{ UINT64_C(0x9f24e9a571dc24b4), UINT64_C(0x35d027393ef5e4aa), UINT64_C(0x2051672668c6f3ab)}},
+  {{ UINT64_C(0xcff48868fb4668ed), UINT64_C(0x7e786531b7d01399), UINT64_C(0xd1a5c0d64456e892)}},
+  {{ UINT64_C(0x538e521f6aded101), UINT64_C(0x166c85e96efb61db), UINT64_C(0x22337634d40d8c9b)}},
+  {{ UINT64_C(0x545474bad8f12e13), UINT64_C(0x36037f01b73405bc), UINT64_C(0x54297cc231da5ab2)}},
+  {{ UINT64_C(0x0acb6ea41f7db378), UINT64_C(0x41eb9f98c4777940), UINT64_C(0x5666fc4523e2de8a)}},
+  {{ UINT64_C(0x5c6839a67cef7eec), UINT64_C(0xdafe6ac4e7bc9b61), UINT64_C(0xfafd40482fa0d37d)}},
+  {{ UINT64_C(0xd19b77971af31f43), UINT64_C(0x57dc8c6018693569), UINT64_C(0x077d3b497592349f)}},
+  {{ UINT64_C(0x3c410b592d943573), UINT64_C(0xc9eb7bed34dcf8a9), UINT64_C(0x113a05934f45e29f)}},
+  {{ UINT64_C(0x30b8e0aa008d299e), UINT64_C(0x0f96ad1f5bf234c3), UINT64_C(0xc75d93a5267cf304)}},
+  {{ UINT64_C(0x18503985afb02b2c), UINT64_C(0x28a7dba58b3d7260), UINT64_C(0x9d0252808cdcc061)}},
+  {{ UINT64_C(0x127345ba64889f6e), UINT64_C(0x5eaa665e298650ad), UINT64_C(0xcc8ffe933535a15f)}},
+};
+
+static const mzd_row192_t Li_1[] = {
+  {{ UINT64_C(0x934a3821903ed93f), UINT64_C(0x0c26b4244b2501e8), UINT64_C(0x93e4285150f7a551)}},
+  {{ UINT64_C(0x7021de0823f03935), UINT64_C(0xcadc055074c283ca), UINT64_C(0x027b4f12c3c6410d)}},
+  {{ UINT64_C(0xe6510b5c3d483a7e), UINT64_C(0x707dc683fb711029), UINT64_C(0x04deea10aead9fa0)}},
+  {{ UINT64_C(0x06ccd2a983915e85), UINT64_C(0x2ee25851ad5b2e39), UINT64_C(0xa7d21294fd9f2bf5)}},
+  {{ UINT64_C(0x36f29523df60300d), UINT64_C(0xf2393fd5a89cec90), UINT64_C(0x6225001ecb54d10e)}},
+  {{ UINT64_C(0x794b2692d5464b65), UINT64_C(0x16047eecc52ed347), UINT64_C(0xc144a19c871be934)}},
+  {{ UINT64_C(0x4a06c49861a321f6), UINT64_C(0xc7a7df6c7c9ac20b), UINT64_C(0x89ac9b0d65562760)}},
+  {{ UINT64_C(0x233a2974221564ca), UINT64_C(0xda44cdce7800bdde), UINT64_C(0x8a0e8f0d068b4320)}},
+  {{ UINT64_C(0x5145a39d82b3413d), UINT64_C(0x19861b539b604f31), UINT64_C(0xc5603ee1f10de49c)}},
+  {{ UINT64_C(0xf136d9fc684ce0d8), UINT64_C(0xa7f3464c6e057d5c), UINT64_C(0x9c0eaba1747a9c30)}},
+  {{ UINT64_C(0xd9cef1a487c92a93), UINT64_C(0xdb9fe50485874d31), UINT64_C(0xfd088f957375b06e)}},
+  {{ UINT64_C(0xb7f7f030f6d8c6cb), UINT64_C(0x7f7ffdb8c70b5053), UINT64_C(0x4e9f79bb0d7dfce6)}},
+  {{ UINT64_C(0x975efa84dafbade5), UINT64_C(0x6d158c731ec9e9f1), UINT64_C(0x4fcbe3827ba7a485)}},
+  {{ UINT64_C(0x96ad0869b0828572), UINT64_C(0xcd84f289c81a6f16), UINT64_C(0x4348fe8e245824d4)}},
+  {{ UINT64_C(0x75310bbf692d0265), UINT64_C(0x3eb9a3b61f161c98), UINT64_C(0x7310972111453ce0)}},
+  {{ UINT64_C(0xc5e82a43615b81f6), UINT64_C(0xb9a6826c44c63893), UINT64_C(0x66f04af52c9da086)}},
+  {{ UINT64_C(0x27ac0272e807281b), UINT64_C(0x114ab40a3a4a4867), UINT64_C(0xed5549083624e991)}},
+  {{ UINT64_C(0x483dc17b6bbb4310), UINT64_C(0x71e2cc6a02bd6f72), UINT64_C(0x4a7d4bf5d43078a7)}},
+  {{ UINT64_C(0x636eef451538a839), UINT64_C(0x2cb02b17ac3c4875), UINT64_C(0x9e4514545a180f84)}},
+  {{ UINT64_C(0xf9bf10467ffb59ed), UINT64_C(0x81aa056c540ab338), UINT64_C(0xa7b17413bf1014e2)}},
+  {{ UINT64_C(0xf62df9bb98e89554), UINT64_C(0x11f0b5a23b31032f), UINT64_C(0xdd3f5ccdee983aac)}},
+  {{ UINT64_C(0xf194cd8ac62e4cc3), UINT64_C(0xe196bb8472cbbc6c), UINT64_C(0x6f61e999e5c78a82)}},
+  {{ UINT64_C(0x0199cf434bc9d00c), UINT64_C(0xb19dce5f4f4672ed), UINT64_C(0x9ad78139439c874e)}},
+  {{ UINT64_C(0x35f7c060156ab8e0), UINT64_C(0x70d7d0cb466a5ac7), UINT64_C(0xa95c02d7e7a5503b)}},
+  {{ UINT64_C(0x3af740a3b4440701), UINT64_C(0xa14487b4eb09eec2), UINT64_C(0x9ca350290182a9b7)}},
+  {{ UINT64_C(0x59ae4b58a052721b), UINT64_C(0xe5def12f7f528e15), UINT64_C(0xd855b5c9c0dc6183)}},
+  {{ UINT64_C(0xe621aa5e162c9c7b), UINT64_C(0xe53920c40bbb0022), UINT64_C(0x2706d86666c0d887)}},
+  {{ UINT64_C(0x5f3f1145ed73dc99), UINT64_C(0x21ed9ca900fe8faa), UINT64_C(0x8ab41908904a2e86)}},
+  {{ UINT64_C(0xed1b6b89a3e8a475), UINT64_C(0xf5e4330c590b0707), UINT64_C(0x1ddd4b896d29f3e3)}},
+  {{ UINT64_C(0xcb0fbe773de21d46), UINT64_C(0x0e207fbcb3a2e575), UINT64_C(0xdf6830e86c287830)}},
+  {{ UINT64_C(0x834a5671e19ecdeb), UINT64_C(0x6a0c58d12a66a7f1), UINT64_C(0x5a43b07102db138a)}},
+  {{ UINT64_C(0x91d3eaac6d2296f7), UINT64_C(0x476ecc1206f55cbe), UINT64_C(0x0cf8098bcc417881)}},
+  {{ UINT64_C(0xaa94d6d8897a0261), UINT64_C(0xeced1c00fdfa1dff), UINT64_C(0x4c2596ca6eeb1fe1)}},
+  {{ UINT64_C(0xf85a080220895651), UINT64_C(0x6fe138edbf98bf71), UINT64_C(0xe2a95d720de88ed2)}},
+  {{ UINT64_C(0x1de13bb79f02a667), UINT64_C(0x7cb2313348ea24d1), UINT64_C(0xff2f655e6017b154)}},
+  {{ UINT64_C(0x362ae0ad5b76fa21), UINT64_C(0x15d69da4d1e5da6b), UINT64_C(0xe6d45f7bc42e8fe9)}},
+  {{ UINT64_C(0x8975097a171eca2b), UINT64_C(0xd94b3a97e25d679d), UINT64_C(0xe0733ee3112d0d27)}},
+  {{ UINT64_C(0xa18ceb08410c7c99), UINT64_C(0x74cd285a621985ee), UINT64_C(0xab6cb3e6b37ee0d6)}},
+  {{ UINT64_C(0xa2ad0eaaa5af781c), UINT64_C(0x91031bc84e92fc18), UINT64_C(0xdad1f9d3fe0b3f31)}},
+  {{ UINT64_C(0x2b3ef61fdc430309), UINT64_C(0x08acd1ce83b19a31), UINT64_C(0xc7d400f05ca1be2d)}},
+  {{ UINT64_C(0x55936386649f6856), UINT64_C(0xcdb2b86d6dcb7adf), UINT64_C(0x49846113d754eeed)}},
+  {{ UINT64_C(0xcc8eee8a61c72589), UINT64_C(0xaae943f1322c383a), UINT64_C(0xbd07aed477ea93dc)}},
+  {{ UINT64_C(0x6c0eb89e189a5252), UINT64_C(0x2ecdca6b0b3f7f99), UINT64_C(0xb873ca6b9acd1b33)}},
+  {{ UINT64_C(0x07bb6a369b6656c3), UINT64_C(0x444ca63e8c174402), UINT64_C(0x373777313348a5e4)}},
+  {{ UINT64_C(0xea63b12112ae1147), UINT64_C(0x9f0862ff0400e7ca), UINT64_C(0xeaabeb652622adbe)}},
+  {{ UINT64_C(0x9cb278067faa5023), UINT64_C(0x1028a61c5e04e45c), UINT64_C(0xf38d189085e451b0)}},
+  {{ UINT64_C(0x31b12a6ca8fbe805), UINT64_C(0x05b77812c98f77a8), UINT64_C(0x73e225aa7b2543aa)}},
+  {{ UINT64_C(0x54652329738d12e0), UINT64_C(0x666f186d2340cc36), UINT64_C(0xcd47af289342d319)}},
+  {{ UINT64_C(0x01a6f59d2af7288f), UINT64_C(0x32065e05f47433a5), UINT64_C(0xdd0aef4da9eae68f)}},
+  {{ UINT64_C(0x1d951cc55788462c), UINT64_C(0xa58222f56ba3fb55), UINT64_C(0x494cfd111afb130c)}},
+  {{ UINT64_C(0x1c636e497ce19c56), UINT64_C(0xa207c8db0d9ae86a), UINT64_C(0x068ea597db5ff00a)}},
+  {{ UINT64_C(0xb622e6db9993cf9e), UINT64_C(0x771a956a294f637a), UINT64_C(0x5eab8b9d609bad87)}},
+  {{ UINT64_C(0x2222aeeb3607d260), UINT64_C(0x32338c94d0c1e761), UINT64_C(0x048e5cc4ea20e56b)}},
+  {{ UINT64_C(0xc1fe72b403b83f9a), UINT64_C(0xf6da8e31f7a670fe), UINT64_C(0x7af27d2087ebd28e)}},
+  {{ UINT64_C(0xe9ab82483da0f637), UINT64_C(0xdb66524598dd4907), UINT64_C(0xc782cf8b5b289720)}},
+  {{ UINT64_C(0x12bf4f3fa30a19b3), UINT64_C(0x32211ebd642ebe9e), UINT64_C(0x89aa5348cc2d29a5)}},
+  {{ UINT64_C(0xd81e2800cd91857a), UINT64_C(0xb6a174baa41e76b9), UINT64_C(0xc0bedbdaf30b0b35)}},
+  {{ UINT64_C(0xddf71611d4adbb5c), UINT64_C(0xe3770a6b0f2958ec), UINT64_C(0xc404f017bb0bcaf4)}},
+  {{ UINT64_C(0xa56ff72487041541), UINT64_C(0xd8053b102ab06216), UINT64_C(0xc97d048285ba6635)}},
+  {{ UINT64_C(0x64d0fe03e99f1abf), UINT64_C(0xd22ce2802a2b027e), UINT64_C(0x9f815807473c5bd4)}},
+  {{ UINT64_C(0x407469c863d2572e), UINT64_C(0xd563abc7ffd44ae1), UINT64_C(0x462f84b4db3a2ad7)}},
+  {{ UINT64_C(0x2e4eb230d949cc3c), UINT64_C(0x2c0bae59742853a8), UINT64_C(0x036c10d5d2ab8059)}},
+  {{ UINT64_C(0x0833fd5b4c49bd8f), UINT64_C(0xc3411ebc8dc4de4d), UINT64_C(0x7d9bccc0060f88b0)}},
+  {{ UINT64_C(0x078071ff2e880265), UINT64_C(0x68087d8517e89a17), UINT64_C(0xc469f875e3714df4)}},
+  {{ UINT64_C(0x35480bc877872239), UINT64_C(0xc338963597ca3440), UINT64_C(0xcf9d6ce86d78f700)}},
+  {{ UINT64_C(0x0d9b53204ce4fed9), UINT64_C(0x62386183d6d21814), UINT64_C(0x1cfbb7ce858c8e06)}},
+  {{ UINT64_C(0x6d4336861d6bd923), UINT64_C(0xd15a5e75d29bf3d3), UINT64_C(0xc0e1e2812759dc51)}},
+  {{ UINT64_C(0x809160e2a854e9d5), UINT64_C(0xfd8bb9e6d81738e1), UINT64_C(0xf73e2d9983188096)}},
+  {{ UINT64_C(0x606e61f4855b05fe), UINT64_C(0x0dcc457c89561b3d), UINT64_C(0x0e1e557a38465d5a)}},
+  {{ UINT64_C(0xd7c508022923a59c), UINT64_C(0xd88d98ec83d3167f), UINT64_C(0x8d6dd56af6a88c6e)}},
+  {{ UINT64_C(0xe4bc5297eac11c99), UINT64_C(0x9112218c9a119515), UINT64_C(0xd4f52922bc4e23b7)}},
+  {{ UINT64_C(0x60e24ad356af53f1), UINT64_C(0x9cba26012d56f8db), UINT64_C(0x6c7fe7db805d3933)}},
+  {{ UINT64_C(0xb536fc772004299f), UINT64_C(0xfe38d740ac6a32f3), UINT64_C(0x3c8dfc98fcbf833b)}},
+  {{ UINT64_C(0x5469baefb0f5139a), UINT64_C(0xba68d9e7f9b95c90), UINT64_C(0xeca5e232db4ddac8)}},
+  {{ UINT64_C(0x70f542566fa062ef), UINT64_C(0xca275b7f6279d516), UINT64_C(0xd6c20835cfe712ae)}},
+  {{ UINT64_C(0x0ddfaa4b679ef56f), UINT64_C(0xe83930e2e1a88cbb), UINT64_C(0xad6ad93b59bc4207)}},
+  {{ UINT64_C(0x6fc9d90c011d17bd), UINT64_C(0x18f17961d63de67b), UINT64_C(0x5d9dad314f3dd297)}},
+  {{ UINT64_C(0x15e1b30e338e5ad1), UINT64_C(0xcd3df62d86d1ac30), UINT64_C(0xd503af3c0ce58291)}},
+  {{ UINT64_C(0x2025b1c5dd4e8368), UINT64_C(0x8474d9bffcd53524), UINT64_C(0x6ea1da97d4c980f8)}},
+  {{ UINT64_C(0x478025679a46879b), UINT64_C(0xe1335e6611d8d855), UINT64_C(0x6d16d9525a845e77)}},
+  {{ UINT64_C(0xe168b977cca1e9f1), UINT64_C(0x244a5f336cffd0b1), UINT64_C(0x1313029a0527282b)}},
+  {{ UINT64_C(0xcacee38b0ad441b4), UINT64_C(0xd4f5bdf7a30c40d6), UINT64_C(0x92896c89380e613d)}},
+  {{ UINT64_C(0xf427daf46f628a6d), UINT64_C(0xe26545b09f770864), UINT64_C(0x3c5a2271eaf61393)}},
+  {{ UINT64_C(0x2006c7fcc052c1b1), UINT64_C(0x50693d1d119d2980), UINT64_C(0x24066d9a3c10204a)}},
+  {{ UINT64_C(0xd39ffe508c7b1c8f), UINT64_C(0xc1a8d1f0f5c7c9c0), UINT64_C(0xc4430d29cdeee8dc)}},
+  {{ UINT64_C(0x604afa05da42523f), UINT64_C(0x8f1788e5aecf1a89), UINT64_C(0x6fc7dc88ff77afd1)}},
+  {{ UINT64_C(0x0058c9a9019f1f90), UINT64_C(0x1bcc212e4f0f68e9), UINT64_C(0x29a0ea202b767183)}},
+  {{ UINT64_C(0xaeebf114e5360c4d), UINT64_C(0xd0b9b2b38bfe9979), UINT64_C(0x06bf783c795ad7f9)}},
+  {{ UINT64_C(0x82a56aa703237f75), UINT64_C(0xe745d060802f8101), UINT64_C(0x536850fe71335504)}},
+  {{ UINT64_C(0xb10c2ebbac0f366f), UINT64_C(0xd41612d67c16fce1), UINT64_C(0xd37f2ac69d252297)}},
+  {{ UINT64_C(0x581a453bd0c07941), UINT64_C(0x08ee928d4e02262e), UINT64_C(0x95c3d31f6d38ac9b)}},
+  {{ UINT64_C(0xb5ed37cad1cc9029), UINT64_C(0xad22728bd3030f4d), UINT64_C(0x182fa40a97af1431)}},
+  {{ UINT64_C(0x29c83cf9b2f3a4b9), UINT64_C(0xd386998f1b5ba77b), UINT64_C(0x4f83d27f9642d627)}},
+  {{ UINT64_C(0x17017fd2c3a9a5ff), UINT64_C(0x75307fc3ff5b22a7), UINT64_C(0xf0fb5ceb3c52ce03)}},
+  {{ UINT64_C(0x4456b7f7e8d42901), UINT64_C(0x19ce2c6a3c20efef), UINT64_C(0x8beca8f0b52c491d)}},
+  {{ UINT64_C(0xf4fb97122736336e), UINT64_C(0x070e12c1e06c09fd), UINT64_C(0x883f66f1a8d782cd)}},
+  {{ UINT64_C(0xf2f1a4f5d133c148), UINT64_C(0xc1056e6fbf8a9844), UINT64_C(0x8df23f5e20231576)}},
+  {{ UINT64_C(0x1b343d970e5193ef), UINT64_C(0x7b83f2ef44934578), UINT64_C(0x7b8ad51c53d3a9d2)}},
+  {{ UINT64_C(0x10d6565af417cccd), UINT64_C(0x29dc05e9baec9245), UINT64_C(0x929e68b4114ddf27)}},
+  {{ UINT64_C(0xaee72ff7cb777565), UINT64_C(0x945eb48dd137d98e), UINT64_C(0x6c986a0f62a7e302)}},
+  {{ UINT64_C(0x1db3060d312a348a), UINT64_C(0x0552cfee6bb3220e), UINT64_C(0x36c925bc36445842)}},
+  {{ UINT64_C(0xfb0ee4f3fe6d4bcf), UINT64_C(0x8546a6d241b50bc6), UINT64_C(0x9493dfb4b57f8e22)}},
+  {{ UINT64_C(0x00d925633389252a), UINT64_C(0xb124d429252c35af), UINT64_C(0xe26edeb7e0497383)}},
+  {{ UINT64_C(0x325afcfc935666dd), UINT64_C(0x5a4360b52f7c2582), UINT64_C(0x2451d3846a1f701b)}},
+  {{ UINT64_C(0x19b30fb0cae7e562), UINT64_C(0xbd1190712e647c80), UINT64_C(0x23cf8a38075233bd)}},
+  {{ UINT64_C(0x1c423818c8258199), UINT64_C(0x4b55fa3faf708aea), UINT64_C(0x0773e3d3769b5051)}},
+  {{ UINT64_C(0x199fe665e559322d), UINT64_C(0x8f6c0f58443ee31b), UINT64_C(0x8919bab58d1599d1)}},
+  {{ UINT64_C(0x86d0e5818406d305), UINT64_C(0x326c74fbbc8a596a), UINT64_C(0x8c2952658ecfcaf5)}},
+  {{ UINT64_C(0x1dc8a0dfbfba45f5), UINT64_C(0x0ac910b14711f791), UINT64_C(0xbee201014f64b120)}},
+  {{ UINT64_C(0x63df486ff54ce395), UINT64_C(0xa471a44566b7b4a8), UINT64_C(0x4cbaff193f37a6f2)}},
+  {{ UINT64_C(0xeeb82cb52654a459), UINT64_C(0x3b06433908216209), UINT64_C(0x4ee0e066ae10f44c)}},
+  {{ UINT64_C(0x19caed559eb045b1), UINT64_C(0x08edeabf3a3e6174), UINT64_C(0xfe8ae1f43982f6ae)}},
+  {{ UINT64_C(0xbefdbe93d26791c9), UINT64_C(0x6cf733d9d13daa1c), UINT64_C(0xa9dd98aefb00f38c)}},
+  {{ UINT64_C(0x2caf3bf17e92c9b5), UINT64_C(0xefb22d86d0c9eef6), UINT64_C(0xa78e80a2d824b72f)}},
+  {{ UINT64_C(0xc90a0586db1e47b7), UINT64_C(0x1a21db29a35168c1), UINT64_C(0x55212830cd82ce99)}},
+  {{ UINT64_C(0xba963f458a904796), UINT64_C(0x513ef7fc0093fb18), UINT64_C(0x2aa61c5078b07e21)}},
+  {{ UINT64_C(0xa513d12e09882325), UINT64_C(0x39fac307604a8480), UINT64_C(0x9989b68210273c78)}},
+  {{ UINT64_C(0xd31a3175f822579e), UINT64_C(0xcbc2732908ac7377), UINT64_C(0x4453cfd6a1852157)}},
+  {{ UINT64_C(0x4776a82809500be8), UINT64_C(0x62d7c4ed48ef589a), UINT64_C(0x655d31ccf0e62380)}},
+  {{ UINT64_C(0x6fb836cec39f96c4), UINT64_C(0x7302b74db56cf0a5), UINT64_C(0x3ad9bc8e3543c422)}},
+  {{ UINT64_C(0x399ac3188735db7d), UINT64_C(0x2c91003a5ec24104), UINT64_C(0xbb35a3dd0df96cb7)}},
+  {{ UINT64_C(0xd1d075b3cafe9621), UINT64_C(0x251ee95824b8d0b5), UINT64_C(0x0573ddaff908147a)}},
+  {{ UINT64_C(0x1b9481870d88979f), UINT64_C(0x0cb99fd5e66160bc), UINT64_C(0x32b56e94d228b3f9)}},
+  {{ UINT64_C(0x4f1de51482fe2fe3), UINT64_C(0x21708363fa8ff7ec), UINT64_C(0x003fac32280f823b)}},
+  {{ UINT64_C(0x97c490c2a1e78b29), UINT64_C(0x194b6cd5ce1b3ed2), UINT64_C(0x8ddf660aa015e711)}},
+  {{ UINT64_C(0x61f55155453a216f), UINT64_C(0xc8ef72fff71a1668), UINT64_C(0x54c6cb783f9b1340)}},
+  {{ UINT64_C(0x225499aa566a8293), UINT64_C(0x538048e512608e47), UINT64_C(0x5e047d3847710c21)}},
+  {{ UINT64_C(0x09a75fcfdee91891), UINT64_C(0xd7028fce8e610588), UINT64_C(0xb271b59bd39b4f9c)}},
+  {{ UINT64_C(0x6e4075312f6de56f), UINT64_C(0x2f8650f4596c2fc1), UINT64_C(0xa70ea1a05592dc91)}},
+  {{ UINT64_C(0x829e85b59d920770), UINT64_C(0x367faad2433da1e9), UINT64_C(0x1ea8c416c6f99284)}},
+  {{ UINT64_C(0x5f7e4d2f331716a1), UINT64_C(0xf59e96dd135e78ef), UINT64_C(0xbb8ab639735beb66)}},
+  {{ UINT64_C(0xc8d02c88eb3379d3), UINT64_C(0x52db23b962afa4fc), UINT64_C(0x3ebe2a496a127583)}},
+  {{ UINT64_C(0x47f05dab15090903), UINT64_C(0x783f7fe0f362e76d), UINT64_C(0x6bdf5a403e95a93c)}},
+  {{ UINT64_C(0xca651848e20b6aca), UINT64_C(0x912cd732879f05c5), UINT64_C(0xf89187e252b2e9c3)}},
+  {{ UINT64_C(0x8ab41f59f8ff70ef), UINT64_C(0xb1881039a55bdd01), UINT64_C(0xd466b931703c4e3d)}},
+  {{ UINT64_C(0x5066db858fcce0bf), UINT64_C(0x7883f7dfb4bd99c0), UINT64_C(0x899da7ea5c1395e0)}},
+  {{ UINT64_C(0x9dbdbfc0fc616091), UINT64_C(0x90206c40940c9a79), UINT64_C(0x09b4a4d75d9b4984)}},
+  {{ UINT64_C(0x4fea43095b920e24), UINT64_C(0xbbe95b35a4ea2e86), UINT64_C(0x73aa7ddc2eb6831c)}},
+  {{ UINT64_C(0x59eb9ef386d2ab0a), UINT64_C(0x9021cc7987f88975), UINT64_C(0x1ce2f5364a8ddfd5)}},
+  {{ UINT64_C(0x9558d3b37eabf52b), UINT64_C(0xcd35eeab78c3b2c2), UINT64_C(0x5a9ad73292a845fa)}},
+  {{ UINT64_C(0xcfb492389a948f5e), UINT64_C(0xa20d92e52f99f096), UINT64_C(0xf771475a50c4f167)}},
+  {{ UINT64_C(0xc935880ea62fff94), UINT64_C(0x7fb0ed2c5c15d92e), UINT64_C(0xa57ba5d37b2fe5d8)}},
+  {{ UINT64_C(0x80454560afe73a48), UINT64_C(0x90d8d4482755fb9d), UINT64_C(0x4d8ef35ec02fbad7)}},
+  {{ UINT64_C(0x5a07204bb40f76b0), UINT64_C(0x18acc87e17431fcd), UINT64_C(0xcf1e18804df26608)}},
+  {{ UINT64_C(0xc4150273b956b635), UINT64_C(0xf00fce5bf39dc770), UINT64_C(0xe4ef319e8424fdbd)}},
+  {{ UINT64_C(0x9de5a28a0ece0ce4), UINT64_C(0xb237c24be8ae8853), UINT64_C(0x6ff8fcd92e4fc0aa)}},
+  {{ UINT64_C(0xd5d2e4466912e1ef), UINT64_C(0x8aded6c18a8b7795), UINT64_C(0x82a253f4555466a9)}},
+  {{ UINT64_C(0x8ce52694f3c1cfef), UINT64_C(0x4e3bbfc4715bf3c3), UINT64_C(0xa52009c2a77dec29)}},
+  {{ UINT64_C(0x33f1b1247eb32a54), UINT64_C(0xed0dceb7c34d6c40), UINT64_C(0x48ca5044b8107110)}},
+  {{ UINT64_C(0xd054ddb89f4675a8), UINT64_C(0xc3c75e40a1f9f06e), UINT64_C(0xb95d1fe883f4eea5)}},
+  {{ UINT64_C(0x7382ee6f72fa7242), UINT64_C(0x36a4b8c20f3b972e), UINT64_C(0xd4104199a4108b75)}},
+  {{ UINT64_C(0xa617cb34b69831af), UINT64_C(0xe32fe9998b4ae689), UINT64_C(0x9ed3dc066e22c72a)}},
+  {{ UINT64_C(0x615d5655fd52b634), UINT64_C(0xc18945c48b656912), UINT64_C(0x73cc51b76c3321ed)}},
+  {{ UINT64_C(0xbd7e7af5193ef189), UINT64_C(0x1e55dde4814a69e7), UINT64_C(0xa8c54cffe7aa3e82)}},
+  {{ UINT64_C(0x32565061efefb9bd), UINT64_C(0xf0f762051764f44b), UINT64_C(0x56b3360cd9b6fa0f)}},
+  {{ UINT64_C(0x9b448ddc595208f1), UINT64_C(0x654739c898639381), UINT64_C(0x49a82d7cbb5c00c1)}},
+  {{ UINT64_C(0x281b4dcdb2e4d0ac), UINT64_C(0x0f789d64ae1554ad), UINT64_C(0xcb27a6f3d6922157)}},
+  {{ UINT64_C(0x8e7dfd086aec17d8), UINT64_C(0xcaf396d372678563), UINT64_C(0x1289754fac4030f6)}},
+  {{ UINT64_C(0x9cbdb76afdef94a5), UINT64_C(0x33b292934a6bf1d5), UINT64_C(0x070649caec7887c8)}},
+  {{ UINT64_C(0xa1d4ca8efb1ac77f), UINT64_C(0x3d89391952a4490a), UINT64_C(0xbae205067d6f6b36)}},
+  {{ UINT64_C(0x53a12d2c798aca97), UINT64_C(0x5920ee03cd0fc1a8), UINT64_C(0x00bd2319e18f6d11)}},
+  {{ UINT64_C(0x1ebcd57a42a1e5b9), UINT64_C(0xb0ae811b026b03cd), UINT64_C(0x1864bb1529827f58)}},
+  {{ UINT64_C(0xdc9e92ab8a7b75ca), UINT64_C(0xb604782c3a3aa6ef), UINT64_C(0x52a50505d0861b52)}},
+  {{ UINT64_C(0xe877db25673120fe), UINT64_C(0xab49e71ad32d978a), UINT64_C(0xe11338a403760c9e)}},
+  {{ UINT64_C(0x433cab85116bf050), UINT64_C(0xb6d75d1d10e66cb0), UINT64_C(0x135f1b7a302794e1)}},
+  {{ UINT64_C(0x1eb381fcc0471c3b), UINT64_C(0xd129c35b933aac9d), UINT64_C(0x08d514b3aa1879df)}},
+  {{ UINT64_C(0x3a14cc1b8f58d6a6), UINT64_C(0x953047e466f63011), UINT64_C(0x543347954a4b3ac2)}},
+  {{ UINT64_C(0x1eceef29610a7754), UINT64_C(0x6573f4caa9e81653), UINT64_C(0x589afc47ab4f220a)}},
+  {{ UINT64_C(0x04429f2c9e620407), UINT64_C(0x27b85b7fde4d1acb), UINT64_C(0xe469b75a0ddc8dae)}},
+  {{ UINT64_C(0x2a2bd8cb080f514c), UINT64_C(0xc9b65823386c31d8), UINT64_C(0x148fa46f16148ad9)}},
+  {{ UINT64_C(0xed864520707706e4), UINT64_C(0x4f21be318c532445), UINT64_C(0x44ab019a717368a0)}},
+  {{ UINT64_C(0x34d41969f031d288), UINT64_C(0xf43f8179115a792b), UINT64_C(0xc5eaff38895f8e6d)}},
+  {{ UINT64_C(0xf42a522c90cd95e8), UINT64_C(0x9df739c2d7e41e76), UINT64_C(0x0c2d6891203c61e0)}},
+  {{ UINT64_C(0x708a686a11683637), UINT64_C(0x5879b5689c1faf42), UINT64_C(0x5e32ba0afe767263)}},
+  {{ UINT64_C(0xf4b6ee57a9889eb3), UINT64_C(0xe6865fe032337ab5), UINT64_C(0x91757d54faf7ab87)}},
+  {{ UINT64_C(0xd70cf30a78568c08), UINT64_C(0xfc50b9f22b74ee82), UINT64_C(0xbabf40e5e8ec9682)}},
+  {{ UINT64_C(0xb692a1199fbcb74c), UINT64_C(0x7096174be62bc53b), UINT64_C(0xf09cc2fdb9b7651f)}},
+  {{ UINT64_C(0xd5e060b6af0b60c9), UINT64_C(0xf1f77987ce979a30), UINT64_C(0xea12c41f8ca26be2)}},
+  {{ UINT64_C(0x6fbfb233dc5ba45b), UINT64_C(0x17ea0ca492aff0d8), UINT64_C(0xc78d466ed3697048)}},
+  {{ UINT64_C(0x9a4c324ea31284f7), UINT64_C(0x5108a84d504a68a3), UINT64_C(0x7d8739762eb5ba83)}},
+  {{ UINT64_C(0x6bfb089930265b78), UINT64_C(0xf7f59fe81ebae036), UINT64_C(0xc4e8c1d913a19d74)}},
+  {{ UINT64_C(0x3a066fb9fa5db16c), UINT64_C(0x87e880b5364bfb5c), UINT64_C(0xc6398523f9fe013a)}},
+  {{ UINT64_C(0x21e22f61df46925a), UINT64_C(0xa8e525ee4942acc9), UINT64_C(0xf45cff7d2b51da82)}},
+  {{ UINT64_C(0x1f4e70a45ed0ee71), UINT64_C(0x257c42f34a484607), UINT64_C(0xfc57548f22dde7c1)}},
+  {{ UINT64_C(0xcad01952310aa411), UINT64_C(0xf771c18e3bbb4f05), UINT64_C(0x6e87448d9029c8c2)}},
+  {{ UINT64_C(0x388e1357948cc6ba), UINT64_C(0x7811cb23b10701c9), UINT64_C(0xae8afb66ce0fcace)}},
+  {{ UINT64_C(0x165dc26b4b17cfaf), UINT64_C(0x414d42f36da1df4a), UINT64_C(0x3619fc517d35ef60)}},
+  {{ UINT64_C(0x83347b17e29042f8), UINT64_C(0xd3572663e2505afb), UINT64_C(0x9845ab7648eb689b)}},
+  {{ UINT64_C(0xe325e112090cdf00), UINT64_C(0x92bb4e7145e85a91), UINT64_C(0xd3f211b7414b6105)}},
+  {{ UINT64_C(0x285d2e3a419d0c46), UINT64_C(0x58da2660e7d45052), UINT64_C(0xa5c5f2cc550efc6c)}},
+  {{ UINT64_C(0x5d9dbe330a280ed0), UINT64_C(0x3a64dd2d40b23c66), UINT64_C(0x6d31beb251e79f44)}},
+  {{ UINT64_C(0xc70713be8369ad43), UINT64_C(0x754044691c92ad37), UINT64_C(0xd68f351056ba4b56)}},
+};
+
+static const mzd_row192_t Li_2[] = {
+  {{ UINT64_C(0x82062a9e501f1253), UINT64_C(0x1955a92ad4287023), UINT64_C(0x71b5486973d89ec3)}},
+  {{ UINT64_C(0x9674b7ed50b158a7), UINT64_C(0x8a90bf312c3ed2c6), UINT64_C(0x32de3b2fc9ae885d)}},
+  {{ UINT64_C(0x7758043a82985026), UINT64_C(0x2576e4ab74f2dd8c), UINT64_C(0xdf26d5d7c2f34350)}},
+  {{ UINT64_C(0x68bbb02d2fbbb2e5), UINT64_C(0x242b33da28c5d4e0), UINT64_C(0xdb2be3b50c91841a)}},
+  {{ UINT64_C(0x76a8cabb23272d54), UINT64_C(0xf60559d33efefb46), UINT64_C(0x0ce754b59bfc518c)}},
+  {{ UINT64_C(0x13b5598e45ca860e), UINT64_C(0x3485b22d40f753cc), UINT64_C(0x38b47cfee4fc2e77)}},
+  {{ UINT64_C(0xa4237b70af8b8d5e), UINT64_C(0x6280dbf521248a45), UINT64_C(0x70dc13a3a5bd9412)}},
+  {{ UINT64_C(0xc904ec7fe5cdaaad), UINT64_C(0xe5df3bdc9dd535bb), UINT64_C(0xd08c165d3af12b6c)}},
+  {{ UINT64_C(0x30983092789b6a36), UINT64_C(0xc082d8654b4fd477), UINT64_C(0xa63a5249863ab33b)}},
+  {{ UINT64_C(0xe632ddbb4f381483), UINT64_C(0xa82afd5ef8609b2c), UINT64_C(0x8c15b05bdf4520ed)}},
+  {{ UINT64_C(0xacb953d817c83e24), UINT64_C(0xa3c684292bcd6cd2), UINT64_C(0xfccf61f05a29cf60)}},
+  {{ UINT64_C(0x2d6efa959ec3a1e1), UINT64_C(0xd77461788ab32375), UINT64_C(0x880acb14c8cfd6af)}},
+  {{ UINT64_C(0x2a2dbed298a4d413), UINT64_C(0xe0fc693a2a949745), UINT64_C(0x5aee84087e2d188e)}},
+  {{ UINT64_C(0xdc189aed11887a71), UINT64_C(0x5c7df0d7b651dca0), UINT64_C(0x3b2777dfeca8a4de)}},
+  {{ UINT64_C(0x211bc5451380eaad), UINT64_C(0x06eb3166034188ae), UINT64_C(0xa26025114c935753)}},
+  {{ UINT64_C(0x785dd99567945ced), UINT64_C(0x63e6c19c3f4ee41e), UINT64_C(0x8888101fe677a9d3)}},
+  {{ UINT64_C(0x028d743755e53e3e), UINT64_C(0x37e57ba951895c1d), UINT64_C(0x46e859ac4ed244c8)}},
+  {{ UINT64_C(0x17db598bfa1e930e), UINT64_C(0xa53e48c8e16d2088), UINT64_C(0x2ae7df765c21e6ea)}},
+  {{ UINT64_C(0x1edae17f6b4b893a), UINT64_C(0xe4b39dc4d1fab64c), UINT64_C(0xd30b0f4d38776d05)}},
+  {{ UINT64_C(0xf9a79ad0e0ea5f15), UINT64_C(0xe817eede2308276f), UINT64_C(0xeff8f1ff294a9f39)}},
+  {{ UINT64_C(0x14977827b15943c6), UINT64_C(0x6e0b8f91a33b3752), UINT64_C(0xfdafce38652269ab)}},
+  {{ UINT64_C(0xdfaa434a5617bc71), UINT64_C(0x781421ed1b13be46), UINT64_C(0x373dfc34b60e85e6)}},
+  {{ UINT64_C(0x4faf81f3f2c958e0), UINT64_C(0x5449c35f038e3a41), UINT64_C(0x8aef2aab37f1cef7)}},
+  {{ UINT64_C(0xdf20df24e8014739), UINT64_C(0xfd520814b7e66113), UINT64_C(0x53e7daa1d8106fc8)}},
+  {{ UINT64_C(0xf26417ab8466a602), UINT64_C(0x07fbbf958d614cf6), UINT64_C(0x3a902d353e0a16ff)}},
+  {{ UINT64_C(0x3c243628c431f69e), UINT64_C(0x102061f2c9381ef7), UINT64_C(0xef21144d4f4d6917)}},
+  {{ UINT64_C(0x60fc53b5ca6e25e6), UINT64_C(0x42a2528cee02bd40), UINT64_C(0xc3f94e9aec5a03ff)}},
+  {{ UINT64_C(0x63e49e8cf2a95621), UINT64_C(0xc2d777ef023bc4b5), UINT64_C(0xfd42af73fa68a31f)}},
+  {{ UINT64_C(0x99dd9d65ba3141b2), UINT64_C(0x52428432b2236144), UINT64_C(0x7ca670ee421c20e9)}},
+  {{ UINT64_C(0xb0169ab2744a4c82), UINT64_C(0x8129b4e15d49d938), UINT64_C(0x3ac7d6f1c8c8341a)}},
+  {{ UINT64_C(0x170d4b9ed85428ac), UINT64_C(0xa6cea5019cf83333), UINT64_C(0x48c7d6c2c3a128e0)}},
+  {{ UINT64_C(0x2ad5552d0cbe0bb0), UINT64_C(0x7f4ee9109ab70cb1), UINT64_C(0x1d86f958b784a3c7)}},
+  {{ UINT64_C(0xf5adbd19285dd5e7), UINT64_C(0xd1010d24f7607a95), UINT64_C(0x3f779c08501d9841)}},
+  {{ UINT64_C(0x31911dc0f5d294c1), UINT64_C(0x233002ee04aee3b1), UINT64_C(0xe6fa98196867bad1)}},
+  {{ UINT64_C(0x19a7ed940644402b), UINT64_C(0x642a52c7ad56aef2), UINT64_C(0xadb215bb7409cc74)}},
+  {{ UINT64_C(0x716f79e1a095287c), UINT64_C(0x8c8c31e75554570a), UINT64_C(0x07bf19f195f6a182)}},
+  {{ UINT64_C(0x4479dce0872080b9), UINT64_C(0xeb02dffa970ebafb), UINT64_C(0x537d68356ba833ea)}},
+  {{ UINT64_C(0x9cd05d4523584198), UINT64_C(0x99626d633373ee80), UINT64_C(0xf6189dcdb2d14169)}},
+  {{ UINT64_C(0x7c0d53b257b0c4b9), UINT64_C(0xe5f9bde5d59c3daa), UINT64_C(0x49fca030658f0a2c)}},
+  {{ UINT64_C(0xe8c441e2fdb0ec5d), UINT64_C(0x1919e66d31903db0), UINT64_C(0x39094f8ebbcaf93c)}},
+  {{ UINT64_C(0x17a40958477fad7a), UINT64_C(0xc5873487f9aa1733), UINT64_C(0xc976632916ad1d64)}},
+  {{ UINT64_C(0xfd30117b8e60f6c9), UINT64_C(0xe3a1cb6c6fc6ac6e), UINT64_C(0x2e3f65f4387a5ae8)}},
+  {{ UINT64_C(0xee7bda11ce13ef07), UINT64_C(0x8199d8cd49ee4ce3), UINT64_C(0x94b54ac10b7f502f)}},
+  {{ UINT64_C(0x44bf411b61d57c56), UINT64_C(0x9c86fda30b84c777), UINT64_C(0x8b5f5592bb720a9f)}},
+  {{ UINT64_C(0x54aef3e515850743), UINT64_C(0xaf7ec294e5a3c40d), UINT64_C(0x06a1fc7efc03a117)}},
+  {{ UINT64_C(0x84dd44b70be9f886), UINT64_C(0x053390454adeb335), UINT64_C(0xb5a5b4d5577e100b)}},
+  {{ UINT64_C(0xcb173ffc1acf99bf), UINT64_C(0x24e56d391e7ad1a5), UINT64_C(0xdaf6a8541645282b)}},
+  {{ UINT64_C(0xf3d9efc9a5cd66de), UINT64_C(0xfa8f9239e2d74c0d), UINT64_C(0x4caff44e389a92e6)}},
+  {{ UINT64_C(0x06704f5d6b32e599), UINT64_C(0x89caaa162ea49172), UINT64_C(0xf5b375754d385050)}},
+  {{ UINT64_C(0x84526c5b03299722), UINT64_C(0x2ad2d494eae3def3), UINT64_C(0xa86c51a37afffb70)}},
+  {{ UINT64_C(0xe07e72608886de8c), UINT64_C(0x345f1e585325f707), UINT64_C(0xf666e6b1a9df66f7)}},
+  {{ UINT64_C(0x98291d5977d62ef2), UINT64_C(0xaf1c5cd680b12ba9), UINT64_C(0x306c9bb07785caca)}},
+  {{ UINT64_C(0xbb3191f53da69a83), UINT64_C(0x38e2a06ad840dc24), UINT64_C(0x48fce0f17cbdb075)}},
+  {{ UINT64_C(0x70e1a095df9d525e), UINT64_C(0x89c1ada4e1a94921), UINT64_C(0x5f3e8ad9e17897ec)}},
+  {{ UINT64_C(0x21613c34e95ed658), UINT64_C(0xf6dd36bd2403f8c5), UINT64_C(0x2e7a2b8f80ddebff)}},
+  {{ UINT64_C(0xdae9bfcb7e557b2d), UINT64_C(0x057e2c7cc2906e44), UINT64_C(0xb591ce3dfb97c662)}},
+  {{ UINT64_C(0xebdd0b35a669e279), UINT64_C(0x4be184b93d05a593), UINT64_C(0x9ca01480acbfa043)}},
+  {{ UINT64_C(0xdaf539e85080ceb4), UINT64_C(0xe9afee534dcadb9f), UINT64_C(0x9a43a3318d31025e)}},
+  {{ UINT64_C(0xfbed0da02f478fd8), UINT64_C(0x615f77807f3f8e77), UINT64_C(0xb7c3f5f8b2c946bc)}},
+  {{ UINT64_C(0x43cbe8f777f89241), UINT64_C(0x546836c35e72f47b), UINT64_C(0xaaf8175b4024a5c4)}},
+  {{ UINT64_C(0x7b970bed409d7fb5), UINT64_C(0x952986244ffb3dd9), UINT64_C(0x1ca7c7257915c8c3)}},
+  {{ UINT64_C(0xec3f064279d66c4f), UINT64_C(0xb002a82f0e271d38), UINT64_C(0x2f485f384bf412a5)}},
+  {{ UINT64_C(0x99113d0594ddd8ee), UINT64_C(0xe6e8e62d31a5bcf3), UINT64_C(0xdce802fa25164617)}},
+  {{ UINT64_C(0x0703d05310e2ad2f), UINT64_C(0xfaac34e618343cad), UINT64_C(0xf2d75aff7c568240)}},
+  {{ UINT64_C(0xc8271b6a689a8b95), UINT64_C(0x6ac14e4588203c31), UINT64_C(0x59afdcc2798eecb7)}},
+  {{ UINT64_C(0x3b7a5a1f38aacec3), UINT64_C(0x5cf56ffe3202383b), UINT64_C(0x17bdc12c0e788e77)}},
+  {{ UINT64_C(0x5b89845fa94bd6ba), UINT64_C(0xbbbeac26481beced), UINT64_C(0xc133b6023e5ea916)}},
+  {{ UINT64_C(0xdda1e7b14ba19064), UINT64_C(0x3ebb8cb5dfa202e1), UINT64_C(0xb99458b797458de6)}},
+  {{ UINT64_C(0x585234b8283be182), UINT64_C(0xa39bbff820d9e816), UINT64_C(0xfc82fdf533b6bc13)}},
+  {{ UINT64_C(0x1f88275ff3adc66f), UINT64_C(0x0461ccb5f2087e44), UINT64_C(0x8682cdeb77bad36c)}},
+  {{ UINT64_C(0x1e8e78482f8b3c88), UINT64_C(0x8fbe7f647d44f0c7), UINT64_C(0x07ef37fcdf9f0f94)}},
+  {{ UINT64_C(0x29ad9b4e1a5aa417), UINT64_C(0xa3a933a7205dff45), UINT64_C(0xd180a81ac7d23e6f)}},
+  {{ UINT64_C(0xc75e306424ddc2b0), UINT64_C(0x1af88897edb537a0), UINT64_C(0xcb1d9ec973888bde)}},
+  {{ UINT64_C(0x33039d33d23b7964), UINT64_C(0x391bb2e6eac0b32c), UINT64_C(0x6e1afb0ae481c020)}},
+  {{ UINT64_C(0x830c00eecf04238b), UINT64_C(0x58c982341aecba2d), UINT64_C(0x4e4cdbce4104f8b8)}},
+  {{ UINT64_C(0xa88b6fb703be1303), UINT64_C(0xb21729723d17fab6), UINT64_C(0xab8d4c17a52d8f06)}},
+  {{ UINT64_C(0x2427a3b3c58b3b7a), UINT64_C(0xfca52ede83c871eb), UINT64_C(0xffce854e0d0d9a4a)}},
+  {{ UINT64_C(0xe1a29f6a00823983), UINT64_C(0x518a171cf8073294), UINT64_C(0x6a41bdc448f0d22a)}},
+  {{ UINT64_C(0x9855d4123b8e20bf), UINT64_C(0x92543f3fbda13f84), UINT64_C(0x64174f5078ad5104)}},
+  {{ UINT64_C(0x96a98294eb552536), UINT64_C(0xa6d9e369b68757d7), UINT64_C(0x018e96c273113cef)}},
+  {{ UINT64_C(0xd9686255d211d5be), UINT64_C(0xfffdd7490f47f513), UINT64_C(0x69e21d4f83bce83d)}},
+  {{ UINT64_C(0xc414cfae911157d8), UINT64_C(0xbf7619802eb010e8), UINT64_C(0x668d28e5b2e0c965)}},
+  {{ UINT64_C(0x94ab8c80ab699c54), UINT64_C(0x9509307d1015451b), UINT64_C(0x2f30b322d2472700)}},
+  {{ UINT64_C(0x1573dcec84d93b7d), UINT64_C(0xf18ec21e8bea2f65), UINT64_C(0x717dd10d8fb1f244)}},
+  {{ UINT64_C(0x32421c61a346cc0d), UINT64_C(0x7e82c2e47e45cb61), UINT64_C(0xb11158bd7001f44f)}},
+  {{ UINT64_C(0x942ce5b7a8f5f528), UINT64_C(0x14731136bce606a0), UINT64_C(0x9bc3e40c45dadd3e)}},
+  {{ UINT64_C(0x3d9f2755baf90b6f), UINT64_C(0x2865c2bf19b0c3f4), UINT64_C(0x51f12cd03bb4e30b)}},
+  {{ UINT64_C(0x5b9228c946615fdf), UINT64_C(0xa311a2c8412de4c7), UINT64_C(0xb2a00dff4a8ebfb4)}},
+  {{ UINT64_C(0xcc523ba464410612), UINT64_C(0x4c58ca6b23fbffd8), UINT64_C(0x83525d958c0de937)}},
+  {{ UINT64_C(0x2cd00ef7ecf0ddad), UINT64_C(0xa93fd4284b0cb492), UINT64_C(0x6c0013caf75c3680)}},
+  {{ UINT64_C(0x2731dc4051ba9af2), UINT64_C(0xab504a258236b903), UINT64_C(0x77bb01423c264309)}},
+  {{ UINT64_C(0x724eab352ae44038), UINT64_C(0xdb1a6afcd5ab0318), UINT64_C(0x41ed969d1b749457)}},
+  {{ UINT64_C(0x6a0d7fce31e52ed0), UINT64_C(0x4ee89ae0c39970a5), UINT64_C(0x4e1ea76bc9df2c62)}},
+  {{ UINT64_C(0x47b14fcd79b08000), UINT64_C(0x702010bba91afa1c), UINT64_C(0x9ae7ae3eca37041d)}},
+  {{ UINT64_C(0xb9dfb337ec66b5ca), UINT64_C(0x777d0d2731b52fb2), UINT64_C(0x1af332ba60fbf084)}},
+  {{ UINT64_C(0xcf0601942dd86eda), UINT64_C(0x68d237f6111fe8ab), UINT64_C(0x105ec845c8098801)}},
+  {{ UINT64_C(0x9da375d8ad30f266), UINT64_C(0x717ba1beb84eed76), UINT64_C(0xc351875de25d4935)}},
+  {{ UINT64_C(0x4b434b0050b8867a), UINT64_C(0xc5049bc7cfc73663), UINT64_C(0x36e257b151a9c0b0)}},
+  {{ UINT64_C(0x1cd2165c5a2e1825), UINT64_C(0x93c6b27b061fae41), UINT64_C(0x845ab68ad36c5d7e)}},
+  {{ UINT64_C(0x4dc76f181df54cf1), UINT64_C(0xddf663500c253194), UINT64_C(0x5ce9f28c9e0f83d2)}},
+  {{ UINT64_C(0x6ca88bdb2b7e4cf8), UINT64_C(0xb0bbc880d5cd9f84), UINT64_C(0x2bb5a885ddfcdfee)}},
+  {{ UINT64_C(0x33e73924c4b95692), UINT64_C(0x66ba8ef1cf170a4f), UINT64_C(0x0fe9f53f5ae800e0)}},
+  {{ UINT64_C(0xe37784be6fe2f9c4), UINT64_C(0xbbdb2f50f10c5b12), UINT64_C(0x524277d9d2de0db4)}},
+  {{ UINT64_C(0xf1af69fb3c105818), UINT64_C(0xd70df1fb80281cc8), UINT64_C(0x435bf637bfa315fa)}},
+  {{ UINT64_C(0x70d1f0b32494d0ae), UINT64_C(0xca054820c83a4341), UINT64_C(0x7d366f6173bd17bb)}},
+  {{ UINT64_C(0x268d7c60072b5581), UINT64_C(0x1b666a406f4822a7), UINT64_C(0x41efbcd4549d528f)}},
+  {{ UINT64_C(0xdb36fabeecb76bec), UINT64_C(0xe596a3391df0808e), UINT64_C(0x50d4324f5e357627)}},
+  {{ UINT64_C(0xbd0cb53339c375b3), UINT64_C(0x4230f1252d94bcfb), UINT64_C(0x78fc98c2818a4e8e)}},
+  {{ UINT64_C(0xea0dc48f2f6d1daa), UINT64_C(0xe2b4aefcfbb7ede0), UINT64_C(0x7f12c8f59f73abb8)}},
+  {{ UINT64_C(0x9bcb43e4212b5f67), UINT64_C(0x00206f3044364c84), UINT64_C(0x19f5ce809fb4db7a)}},
+  {{ UINT64_C(0xdde25ea3084784fe), UINT64_C(0x48529cc525d17088), UINT64_C(0x2fe01de2c6f75795)}},
+  {{ UINT64_C(0x0a684f47fab3c477), UINT64_C(0x963c6b2e02ec2112), UINT64_C(0x7f803f5fbac84fcb)}},
+  {{ UINT64_C(0x931925f99b8bc9bc), UINT64_C(0x8b74cecc7b6de2c6), UINT64_C(0xa7e49bd7de1f690f)}},
+  {{ UINT64_C(0xdf62de55619184eb), UINT64_C(0x1142325294e9a4d8), UINT64_C(0x895355825fc4714c)}},
+  {{ UINT64_C(0x179705af7ba3feda), UINT64_C(0x4af926679df43cae), UINT64_C(0xfc8eaa3f9e1f890f)}},
+  {{ UINT64_C(0x1c1599b465bedb19), UINT64_C(0x70a78cb3e96544ce), UINT64_C(0x1d1b6ab71cc7a97d)}},
+  {{ UINT64_C(0xc132699df60bb14e), UINT64_C(0xd378f1f1b9c06d51), UINT64_C(0x60bf58ab829e954a)}},
+  {{ UINT64_C(0x229e57560ab69916), UINT64_C(0x58ac05e75f8131f5), UINT64_C(0x467c06b15581fe5d)}},
+  {{ UINT64_C(0x9ec4826933fdb416), UINT64_C(0x99e979523d027a4f), UINT64_C(0x3ffbe3f87b11e1f7)}},
+  {{ UINT64_C(0xf91ff7efd131067e), UINT64_C(0xdd9024fc35935153), UINT64_C(0x256c5fa5c71bb0fb)}},
+  {{ UINT64_C(0x2921bb47fc0f4d22), UINT64_C(0x1ca06319336019fb), UINT64_C(0x47dddbf295ed45e8)}},
+  {{ UINT64_C(0xae8fb7b73eed1503), UINT64_C(0x7aada03a6a66df6d), UINT64_C(0x5e29899ef81d7e61)}},
+  {{ UINT64_C(0xbb768b85787cf2c6), UINT64_C(0xbb8cf3da3c85b181), UINT64_C(0xc95d4a4b8d5bbf32)}},
+  {{ UINT64_C(0x79780c8907182760), UINT64_C(0xf158be93e61377e6), UINT64_C(0xc8cbb3ef9843c5b3)}},
+  {{ UINT64_C(0x447b66a762e47b84), UINT64_C(0x58cf45721aec59b7), UINT64_C(0xcda7794c2a61e2cd)}},
+  {{ UINT64_C(0xf3d9de579528d5ff), UINT64_C(0x31b3d28750bc2953), UINT64_C(0x278f12a16cccc4c5)}},
+  {{ UINT64_C(0x70d616e3eb0c4686), UINT64_C(0xd5ddf9a6e24da71d), UINT64_C(0x07dcaa8b5c917afe)}},
+  {{ UINT64_C(0x75fc8e3a470cb571), UINT64_C(0x74a8a34956d5d768), UINT64_C(0x89d6b1c1bbe1958b)}},
+  {{ UINT64_C(0xa6015b597733c699), UINT64_C(0xb17c5c990ff126e4), UINT64_C(0xb6dc347e4e34c574)}},
+  {{ UINT64_C(0xe85c9934f0fd2271), UINT64_C(0xbaca61a8e240d353), UINT64_C(0x84b1988485ed4067)}},
+  {{ UINT64_C(0x58a411358546ec8a), UINT64_C(0x6bfed74e445468b5), UINT64_C(0xe071920889585669)}},
+  {{ UINT64_C(0x2845dbc4f596f47b), UINT64_C(0x7a8785d8de112f88), UINT64_C(0x4f57837abf41e98c)}},
+  {{ UINT64_C(0xfde839191d684784), UINT64_C(0xd6ebe7792fe03e13), UINT64_C(0xdf7bfddcae57dcbe)}},
+  {{ UINT64_C(0xa3ec2ff6b580f5bf), UINT64_C(0xb370051973f87469), UINT64_C(0xad6e8970e794522b)}},
+  {{ UINT64_C(0xaae39949185ac9fb), UINT64_C(0xef23de3b0f8e5bbb), UINT64_C(0x818e9e6f0956a6d2)}},
+  {{ UINT64_C(0x6e9202c818d8aafd), UINT64_C(0x93256918438ff549), UINT64_C(0x2135c70013911ace)}},
+  {{ UINT64_C(0x4d907fd3e670f75c), UINT64_C(0xf73b38287f471712), UINT64_C(0x8c9ee973c5649056)}},
+  {{ UINT64_C(0x0a90c0f0b59aa20f), UINT64_C(0x74302327f70620f6), UINT64_C(0xf4be6bfe6dc73ad9)}},
+  {{ UINT64_C(0x6c85feb5b426f84f), UINT64_C(0xe72e025370233716), UINT64_C(0xa86874843d032320)}},
+  {{ UINT64_C(0xbccbcb4f659ec23f), UINT64_C(0xe1f4344119199f6e), UINT64_C(0x92b3467e70d72064)}},
+  {{ UINT64_C(0xd7593512db7c0854), UINT64_C(0x03235d679af453c8), UINT64_C(0x7b9f938f9fd82e11)}},
+  {{ UINT64_C(0x0166ce3352717584), UINT64_C(0xe42f79f31c7c3e4b), UINT64_C(0xa978d5dcf7287878)}},
+  {{ UINT64_C(0xdaa52e8f4c3ce78b), UINT64_C(0x2d77db97bdc4e01f), UINT64_C(0xa3a87e89e979d781)}},
+  {{ UINT64_C(0x5fb18b6c3e9b26ab), UINT64_C(0xa893d5a1beff86ae), UINT64_C(0x01b85fc08c95b8b1)}},
+  {{ UINT64_C(0x77a79330f1251a2a), UINT64_C(0x6d2b16a386f4a7f1), UINT64_C(0xe1a6e7f76e07e6d6)}},
+  {{ UINT64_C(0x5e6e39e2f96a49eb), UINT64_C(0x8e9d8c4650530b1b), UINT64_C(0x65beef9835b97968)}},
+  {{ UINT64_C(0x7854b84c113258d9), UINT64_C(0xa84531ec767f146a), UINT64_C(0xd88852b5c4acb710)}},
+  {{ UINT64_C(0x741af5ab375b55c7), UINT64_C(0xbbb626bc59096dfb), UINT64_C(0x6a376e13ce212c1d)}},
+  {{ UINT64_C(0x0ae1ae8d311bb5c7), UINT64_C(0x2e1b8611897730a1), UINT64_C(0x27026f117d0233bf)}},
+  {{ UINT64_C(0x548edd748d39d569), UINT64_C(0xfb218be14281f26d), UINT64_C(0x4941171ec315226c)}},
+  {{ UINT64_C(0xa7e44ff3d5ce705c), UINT64_C(0x385188953e4e368b), UINT64_C(0x7632d0f50291ec4f)}},
+  {{ UINT64_C(0x24d797bd0a7d7f6b), UINT64_C(0xd768a5130f0bcdb6), UINT64_C(0x49f45f24f89e0270)}},
+  {{ UINT64_C(0xca617a5e7bcee018), UINT64_C(0xfff5682be3798da4), UINT64_C(0x1885883991626a9f)}},
+  {{ UINT64_C(0x788c508632f53945), UINT64_C(0x7a2d505cdda61e1c), UINT64_C(0xf177acaeae854db0)}},
+  {{ UINT64_C(0x8e9df10640b747d3), UINT64_C(0x27f4054739362659), UINT64_C(0x27a6954e98df190b)}},
+  {{ UINT64_C(0x38305d571a6e5bb2), UINT64_C(0xcbed12ebc93de9b0), UINT64_C(0x255c9efe1b95b861)}},
+  {{ UINT64_C(0xa634d7f0bb81f590), UINT64_C(0x2708a60b868694be), UINT64_C(0xad668fbe3dbda68e)}},
+  {{ UINT64_C(0x810e60f7380ae44e), UINT64_C(0xe09dee00b3242b2f), UINT64_C(0xce6b58f4878fd3d0)}},
+  {{ UINT64_C(0x50a5786e57f4f4e4), UINT64_C(0x9fe63adb8d1ca0a6), UINT64_C(0x39b4c9b6b29e08d9)}},
+  {{ UINT64_C(0xc15956ad4d0cec66), UINT64_C(0xb9ae2936c9ab594d), UINT64_C(0x881f5200dce62a1b)}},
+  {{ UINT64_C(0x586486205317ddfa), UINT64_C(0xa6171e70040f9743), UINT64_C(0x17e4ce0d577716e3)}},
+  {{ UINT64_C(0x6845c597c702fd91), UINT64_C(0xa07f870ba0107a2f), UINT64_C(0x8cec222f73e91017)}},
+  {{ UINT64_C(0x3db0784b1a83d08d), UINT64_C(0x2fce011c88ea0d32), UINT64_C(0xf880333ce803f8ac)}},
+  {{ UINT64_C(0x41547615ad50d57b), UINT64_C(0xd543a3c5d95d9f1f), UINT64_C(0xe26b38af9d5cf313)}},
+  {{ UINT64_C(0x847cbd12a3a8256d), UINT64_C(0xe852d3744da42d7f), UINT64_C(0x46bb2b701f01642c)}},
+  {{ UINT64_C(0xa21c0f3dbad37c69), UINT64_C(0x5c2f89a646f39b0c), UINT64_C(0xa98ba99e30651ae4)}},
+  {{ UINT64_C(0x273bbca3cc779198), UINT64_C(0x0c9c59fa214cc061), UINT64_C(0x5e60be283cda29ea)}},
+  {{ UINT64_C(0xaa122264f4eecd09), UINT64_C(0x4ff039b7f9afe3b0), UINT64_C(0x6d8bd1ccdf7a36a0)}},
+  {{ UINT64_C(0x0c904335af4f41d5), UINT64_C(0xd28b66c7027bfc67), UINT64_C(0x97602527517883b7)}},
+  {{ UINT64_C(0x955c12f3dcd4b14a), UINT64_C(0xd06222e0c30e0364), UINT64_C(0x27ef197261c739ce)}},
+  {{ UINT64_C(0x331b8de73a68552e), UINT64_C(0x99571cc530945f55), UINT64_C(0x8cc1fb2f72f7cf5d)}},
+  {{ UINT64_C(0x05c0fe1fb5cf942f), UINT64_C(0x63042e2fdf5c6aa1), UINT64_C(0x0fde680eb225c96f)}},
+  {{ UINT64_C(0x9df87630daca3d73), UINT64_C(0x55f9479b3c89ff6e), UINT64_C(0x290f16b3c63e7b83)}},
+  {{ UINT64_C(0x38e5e1cffebd07e3), UINT64_C(0x8cdbddd341a697ff), UINT64_C(0xb8c0028bac24a58e)}},
+  {{ UINT64_C(0x053739bd4a12e6a6), UINT64_C(0x965cf66b2208de38), UINT64_C(0x2291d62348a33c03)}},
+  {{ UINT64_C(0x311c34eac1056fde), UINT64_C(0x18aeee1a52bd146c), UINT64_C(0x3c50a5303b147efa)}},
+  {{ UINT64_C(0x4f352ac391772285), UINT64_C(0x493c45e28f910c01), UINT64_C(0x3b251ce426a4654d)}},
+  {{ UINT64_C(0xa0797280daec9590), UINT64_C(0xf2452374c7a4fed6), UINT64_C(0x2e284dfc611c5143)}},
+  {{ UINT64_C(0x71d20793153851ea), UINT64_C(0x604a563b7810f688), UINT64_C(0xf5ea503b2e6d7c63)}},
+  {{ UINT64_C(0xf3b77c168585544f), UINT64_C(0xe9d6a7ca111a1e35), UINT64_C(0xfbc51a0ed005812f)}},
+  {{ UINT64_C(0x4e37c7c452108025), UINT64_C(0x1b49e607797849a6), UINT64_C(0xc7770260b5fd64c7)}},
+  {{ UINT64_C(0x504b7a69368460ff), UINT64_C(0xb317e235e2bd83ce), UINT64_C(0x730388db0057b2a8)}},
+  {{ UINT64_C(0x7370d4bde24926b9), UINT64_C(0xbc3a305096b5629e), UINT64_C(0x788821d73acda1de)}},
+  {{ UINT64_C(0x98c2b2e861f9b6dc), UINT64_C(0x83b83b695bafef29), UINT64_C(0xd74b0ad91f7ae6db)}},
+  {{ UINT64_C(0x0a05cd77d133057e), UINT64_C(0xa696f3daf37e6dd9), UINT64_C(0x7e4de0623657fef2)}},
+  {{ UINT64_C(0x7c1acbcd9cb2f468), UINT64_C(0x4f32ddcea27e4c16), UINT64_C(0x0417eaed4abfe311)}},
+  {{ UINT64_C(0x27733c3185955671), UINT64_C(0x6b5dd04e0c3a2bd2), UINT64_C(0x5734308ff776d0cd)}},
+  {{ UINT64_C(0xc601e0de438becf4), UINT64_C(0xca0af8c3a5b336c5), UINT64_C(0xa5128decad6872aa)}},
+  {{ UINT64_C(0xc40ab887fbc6e57e), UINT64_C(0xc2832c6d1e21f7ea), UINT64_C(0xa9eeaaa1e33f22ab)}},
+  {{ UINT64_C(0x0e472ccbd35f3e8c), UINT64_C(0xcb8a15aabb48cdeb), UINT64_C(0x4386ccc7fff37268)}},
+  {{ UINT64_C(0xc8292be3d7f59e64), UINT64_C(0xe0a5bcbdb35e7c43), UINT64_C(0x90ec39a8e4c1c970)}},
+  {{ UINT64_C(0xca90bc100b0d0b1f), UINT64_C(0x3e508c4fb3517395), UINT64_C(0xd6e723d5a3853b88)}},
+};
+
+static const mzd_row192_t Li_3[] = {
+  {{ UINT64_C(0x7b744aca5a17d575), UINT64_C(0xe8549c7fed24c7e6), UINT64_C(0xaeebd252513f83eb)}},
+  {{ UINT64_C(0x63a8a1d09695fa41), UINT64_C(0x6d65dfc7419ad91d), UINT64_C(0xd4c67eda8e56e064)}},
+  {{ UINT64_C(0xe6609cf3c62e1693), UINT64_C(0x35b7889e9fa63724), UINT64_C(0xbc12403e7188e07a)}},
+  {{ UINT64_C(0x9faca46a44f7d7f0), UINT64_C(0xe4c6ba0be2d2487d), UINT64_C(0x81910aed45a9fa35)}},
+  {{ UINT64_C(0xa6cfcfce0ccd0437), UINT64_C(0xcebe7caa8f2d5d6d), UINT64_C(0xd5ffffa462f78a2b)}},
+  {{ UINT64_C(0x87e48da3934405d0), UINT64_C(0xd4c0cf685949eab8), UINT64_C(0xc1790420bfa0afc6)}},
+  {{ UINT64_C(0x7dfb3a5ac86ab67e), UINT64_C(0x97602e3ac5a710a2), UINT64_C(0xa09dce9a607b453e)}},
+  {{ UINT64_C(0x39a5ad95a55c5bb3), UINT64_C(0x50fae8c585c0455c), UINT64_C(0xc7faec9d53e31468)}},
+  {{ UINT64_C(0xf040f46349f665b8), UINT64_C(0xcb24873eab8860f1), UINT64_C(0xc1e7aab79db20952)}},
+  {{ UINT64_C(0xaf48a02735c3cf73), UINT64_C(0xe37c6c679c54eb61), UINT64_C(0x96a4dda0ee732142)}},
+  {{ UINT64_C(0xf848832a28eb175e), UINT64_C(0xfef513c4a4b0fbfd), UINT64_C(0x17f2849420c69332)}},
+  {{ UINT64_C(0x486b71b50524f4ee), UINT64_C(0xad35d5873125876e), UINT64_C(0xb76d606cbbb33b93)}},
+  {{ UINT64_C(0x330c481353792841), UINT64_C(0x2d57997839742a49), UINT64_C(0xf4a7f0dcd7829abb)}},
+  {{ UINT64_C(0x373b56df25372e34), UINT64_C(0xfd25573cc4a9671a), UINT64_C(0xde3f0a129ddee958)}},
+  {{ UINT64_C(0x07a96eed1f047e99), UINT64_C(0x9fe8f3b992832288), UINT64_C(0x179b161105f26182)}},
+  {{ UINT64_C(0x893c289699c6daa9), UINT64_C(0x1efae919a5b599a6), UINT64_C(0x934e213de4575592)}},
+  {{ UINT64_C(0x6f938c648568bb9f), UINT64_C(0x24a6fffab46e49c7), UINT64_C(0xdc3e649d7ccf0b60)}},
+  {{ UINT64_C(0xba012a19928365b3), UINT64_C(0x049d851ae84f0c6a), UINT64_C(0xdb1496da7225fcce)}},
+  {{ UINT64_C(0xb34675968b1d4a08), UINT64_C(0xcacb7452c11cf159), UINT64_C(0x873771061fbeb528)}},
+  {{ UINT64_C(0x5503f4d07468f980), UINT64_C(0xb5683d771cc17196), UINT64_C(0x04240aa4c87fb90b)}},
+  {{ UINT64_C(0x107d648bbddbc141), UINT64_C(0x5e0cb02fe27cab8d), UINT64_C(0x758b6c7c681a56b3)}},
+  {{ UINT64_C(0xb59db1976cbae288), UINT64_C(0xed6dff97e1ae9fbf), UINT64_C(0x0eb314643d8232ff)}},
+  {{ UINT64_C(0x91737981cb0eab95), UINT64_C(0x8739bcd8fd078c3e), UINT64_C(0x6e6dea6070731d77)}},
+  {{ UINT64_C(0x87d2fdede8a447a7), UINT64_C(0x5df63b631186af7d), UINT64_C(0xcbe3d269c74e5e4e)}},
+  {{ UINT64_C(0xb2dee587b499977a), UINT64_C(0xd60e1224c391263d), UINT64_C(0x5101b3479c75c986)}},
+  {{ UINT64_C(0x243876f4167733af), UINT64_C(0xa3ad1a9163df56e7), UINT64_C(0xb4bfa2c94df43f13)}},
+  {{ UINT64_C(0x991ed621693aa2e8), UINT64_C(0xd43dfb0a7731f92d), UINT64_C(0xa89891be28e617c6)}},
+  {{ UINT64_C(0x7810983138cabdff), UINT64_C(0xc466c32f9d2e048f), UINT64_C(0xe74e1ea7e406b626)}},
+  {{ UINT64_C(0x053ec970500decbd), UINT64_C(0xd81ef7a8131daafb), UINT64_C(0x7597f84176bf06f7)}},
+  {{ UINT64_C(0xc7612c892877ebcd), UINT64_C(0xe67781e7f8b17479), UINT64_C(0x6f0d27c440d7e871)}},
+  {{ UINT64_C(0x63d0710b249d23f8), UINT64_C(0x3e9b20030a4e419e), UINT64_C(0xeff7e67be2a0046f)}},
+  {{ UINT64_C(0x52f3574c70849cf6), UINT64_C(0xf340ab19e34486a4), UINT64_C(0x65a19e7eefc3ed76)}},
+  {{ UINT64_C(0x2658d9112b2c1523), UINT64_C(0x789328437bdad8c2), UINT64_C(0x05240bbb95e873cf)}},
+  {{ UINT64_C(0x53bbc7309dcc6089), UINT64_C(0xd6c3d9fb0973f16e), UINT64_C(0x5791c0e26ab70121)}},
+  {{ UINT64_C(0xa7f5553f7aaf40f8), UINT64_C(0x1911afc94e46b4fb), UINT64_C(0xfaaad12257e27a28)}},
+  {{ UINT64_C(0xafc74725cd50bb34), UINT64_C(0xa3e1a6501363453f), UINT64_C(0x88dfa910e1a5eb56)}},
+  {{ UINT64_C(0xa029bb67be47b68d), UINT64_C(0xd656e6bdf0d8dc9e), UINT64_C(0x93aead450cb88c76)}},
+  {{ UINT64_C(0xd70c43ee73f7b8ac), UINT64_C(0x18c7a27be1113528), UINT64_C(0xdc8d59b3ec24df5a)}},
+  {{ UINT64_C(0xdd4ca5aff56eedb7), UINT64_C(0x425bac680681d0e5), UINT64_C(0x1e2ec96b2974f237)}},
+  {{ UINT64_C(0xefafc5dfd9dcae33), UINT64_C(0x9ac5c363b3060c9b), UINT64_C(0x3fe515de74d3deff)}},
+  {{ UINT64_C(0x8959c1c6cb818f75), UINT64_C(0x21007b8c9f31646c), UINT64_C(0x0dc916718c1d9f7e)}},
+  {{ UINT64_C(0x4c0d0a8680089292), UINT64_C(0x7b6d3dba2c40eafa), UINT64_C(0x037c1572a3dbee78)}},
+  {{ UINT64_C(0xd51c580b3a1225ba), UINT64_C(0xdfee11de14a4f4a5), UINT64_C(0x8055c337f2a092c9)}},
+  {{ UINT64_C(0x4869cbd2f4eafac2), UINT64_C(0xb887563911a552d8), UINT64_C(0x50269ddb5d09a8b1)}},
+  {{ UINT64_C(0x0ed1157ded1fe854), UINT64_C(0xd00c48a80b0601b8), UINT64_C(0x8d1df4b647ad7132)}},
+  {{ UINT64_C(0x31403c3e12537e18), UINT64_C(0x0401f3b48a6f7221), UINT64_C(0xa49ba582a8fe901c)}},
+  {{ UINT64_C(0x3709ff80deaf6d2c), UINT64_C(0x3c16210c22b44f81), UINT64_C(0xbdd3d0c9e6cb6a66)}},
+  {{ UINT64_C(0x32732c16b2b795b4), UINT64_C(0x1e330cb25bed9ee6), UINT64_C(0xb2b3fa20e0ed099e)}},
+  {{ UINT64_C(0x81f269c365a2e466), UINT64_C(0x9b4f664e1d909592), UINT64_C(0x41d00107449d25fa)}},
+  {{ UINT64_C(0x53e09d93bf650955), UINT64_C(0x2b3fa2ccb9bb4d1f), UINT64_C(0x462ea13e8c538de8)}},
+  {{ UINT64_C(0xcee387c4a60d5e7b), UINT64_C(0xac337e31b0affbb0), UINT64_C(0x8e2365399196ba1e)}},
+  {{ UINT64_C(0xb96c3f1d4d5c7a26), UINT64_C(0x439c9535c6280482), UINT64_C(0xad8bc52531dc6b91)}},
+  {{ UINT64_C(0xb6177033a828ec38), UINT64_C(0x80505f99a6bea001), UINT64_C(0xe67fc995eb992c30)}},
+  {{ UINT64_C(0x34706503d3a3a82e), UINT64_C(0x56fc809fe4a8e530), UINT64_C(0x41a6b56da4f3f3b5)}},
+  {{ UINT64_C(0x9689a1bfced15673), UINT64_C(0x4a79aab12eaedd86), UINT64_C(0x00137c103c711b33)}},
+  {{ UINT64_C(0x267eff05da294f9d), UINT64_C(0x17181de1f4fb0e7f), UINT64_C(0x95ec72c2a380c3ff)}},
+  {{ UINT64_C(0xe82614aa37181295), UINT64_C(0x5fe13330c3a23223), UINT64_C(0xa2b2fe1a450003f1)}},
+  {{ UINT64_C(0x9da5d472a076c41b), UINT64_C(0xfbd5305a2b049a0a), UINT64_C(0x062bb5e50bf2ea19)}},
+  {{ UINT64_C(0xa4011fd0c6db2b4f), UINT64_C(0x44cc6ce61d121b67), UINT64_C(0x513437655311d6a7)}},
+  {{ UINT64_C(0x9d8b3b4fb706ccc7), UINT64_C(0x0c3f87e9270218e6), UINT64_C(0x3de7bb21d0ab84db)}},
+  {{ UINT64_C(0x350e9777c4c5098e), UINT64_C(0xa4109c1eb777265b), UINT64_C(0xeb5c9cbff7b6d8c1)}},
+  {{ UINT64_C(0x9ec8ad130e646cb8), UINT64_C(0xa08f7fe7b39983b7), UINT64_C(0x393ba6ea074fecff)}},
+  {{ UINT64_C(0xe2a938d8e4de2e89), UINT64_C(0x365dabd2a266f8d9), UINT64_C(0x1aa4e296aad5f4e4)}},
+  {{ UINT64_C(0x99579e8d08313aa6), UINT64_C(0x3ab39448cf14c687), UINT64_C(0x3181d4d60739cf93)}},
+  {{ UINT64_C(0xa5eeb5a168177349), UINT64_C(0x93668321d40b2c14), UINT64_C(0x5c4762509734eb88)}},
+  {{ UINT64_C(0x2b061da89f5f32a1), UINT64_C(0x641973c86cba9457), UINT64_C(0x674cfbe847646804)}},
+  {{ UINT64_C(0x19997029a5edf218), UINT64_C(0xc54aa4a845ce7b0b), UINT64_C(0x11fb8012359a74a3)}},
+  {{ UINT64_C(0xcfefc4b76860fcb9), UINT64_C(0x0920149249308059), UINT64_C(0xdf1e259cf60884a1)}},
+  {{ UINT64_C(0x60661c544eb5899b), UINT64_C(0x1fe012d0f61ead06), UINT64_C(0xc697aedcdc98ed4a)}},
+  {{ UINT64_C(0xa8e6d8daddc7e6aa), UINT64_C(0x664d015e109a94d8), UINT64_C(0x325cdc0b486f266b)}},
+  {{ UINT64_C(0xca45b278ac363e89), UINT64_C(0xe5eb2055e6750a35), UINT64_C(0x1426bd4aedab14a6)}},
+  {{ UINT64_C(0x99231f77c7b16a4c), UINT64_C(0x3d1f0360d13c50f2), UINT64_C(0x7a7f7e1fe81ccef2)}},
+  {{ UINT64_C(0x841c523449026ee1), UINT64_C(0x066a0af08d1aa187), UINT64_C(0xf8ef7e720cab9a86)}},
+  {{ UINT64_C(0x4f7ee3ed80a914f0), UINT64_C(0x9a4d4cd895cd4da5), UINT64_C(0x9cafe2d4b90b0ffa)}},
+  {{ UINT64_C(0xa11e2b0c5df9d97a), UINT64_C(0x65ffce7d30a782ed), UINT64_C(0xf40ff1a632c1101b)}},
+  {{ UINT64_C(0x5560a37d7eaa11f2), UINT64_C(0x17270c16e1288392), UINT64_C(0x550633b1f8b1ca7d)}},
+  {{ UINT64_C(0x5d1054926cc5993d), UINT64_C(0xaf2200b1753f6a64), UINT64_C(0x45b90a955578c118)}},
+  {{ UINT64_C(0xc12c312fdd4305bf), UINT64_C(0x1e38eaceeef6336c), UINT64_C(0xed6128315cebef8c)}},
+  {{ UINT64_C(0x26db5b4254107534), UINT64_C(0x6418608044e26276), UINT64_C(0x923cd90921428fbb)}},
+  {{ UINT64_C(0xcd9bd79ce859a3f0), UINT64_C(0xc4fede007500d386), UINT64_C(0xcfe31c33f4999392)}},
+  {{ UINT64_C(0xc0a9419aae0e78ec), UINT64_C(0x3edb6ee00ababd77), UINT64_C(0x4368908a1b9693eb)}},
+  {{ UINT64_C(0xb388c29232db5e60), UINT64_C(0xb607256a55fa9a3e), UINT64_C(0xbe7a7cc6939f59ae)}},
+  {{ UINT64_C(0x584d8c38fc0f6876), UINT64_C(0x02fab2ed75cc4463), UINT64_C(0x2414fda12988f2a7)}},
+  {{ UINT64_C(0xb531323391d2a879), UINT64_C(0xb4dc6b06b555bb9c), UINT64_C(0x4c172d0018e1f9ce)}},
+  {{ UINT64_C(0x601e73792c3417b2), UINT64_C(0xa3c85d76166e6638), UINT64_C(0xf4aa23869c95d7ab)}},
+  {{ UINT64_C(0xad6927ab40251a69), UINT64_C(0x31a80efc16a0c49f), UINT64_C(0x35018a20729ec6a9)}},
+  {{ UINT64_C(0x1ee1c76443fd38bc), UINT64_C(0x92b8691db051f462), UINT64_C(0x1c452decd99d1568)}},
+  {{ UINT64_C(0x7323b49b4bed5ea9), UINT64_C(0x08b8e6ba6f72b5cd), UINT64_C(0xa0c662252061ad11)}},
+  {{ UINT64_C(0x6a44454545fb2021), UINT64_C(0xfd5cf912c882dda5), UINT64_C(0x9b8188d86e300771)}},
+  {{ UINT64_C(0xd85fefe9d1ee5ee3), UINT64_C(0x0aee0b83850e6255), UINT64_C(0x69e02293b0078660)}},
+  {{ UINT64_C(0x482e40918c0a0c18), UINT64_C(0x06fefbde0f851804), UINT64_C(0x6f44bc3b778da0b1)}},
+  {{ UINT64_C(0xac7fb13fc02eab10), UINT64_C(0x7d674457452d8be0), UINT64_C(0xa946875c50bf0a6c)}},
+  {{ UINT64_C(0xd6d524ca54d94a48), UINT64_C(0xf320f0797a56c415), UINT64_C(0x6512e0292014de3e)}},
+  {{ UINT64_C(0xee8e4efb7b2d0368), UINT64_C(0xc5473ae7d962958a), UINT64_C(0x9bae158ea27efb8a)}},
+  {{ UINT64_C(0xf37b603142cdf7cb), UINT64_C(0xec322b9bc408d597), UINT64_C(0x17b0c0b444ada909)}},
+  {{ UINT64_C(0x2873bbca9a7c2803), UINT64_C(0xbe51fbd7e4a7513d), UINT64_C(0xf65e86078fdb82a4)}},
+  {{ UINT64_C(0xbb38ecea626e1e03), UINT64_C(0x4eb2a5e588236a9b), UINT64_C(0x9d8350e23b5e0d5c)}},
+  {{ UINT64_C(0x83257ed60905b61f), UINT64_C(0xe2e180baf253c14a), UINT64_C(0x6529999c9dbd9d54)}},
+  {{ UINT64_C(0xb5906e041fa71772), UINT64_C(0x5a148de9e4756b78), UINT64_C(0xc0b0e7e79b7ae3ac)}},
+  {{ UINT64_C(0x27cded69e68d9e0c), UINT64_C(0x3f99e62c71f96d91), UINT64_C(0x02bc4b7c2fe0196c)}},
+  {{ UINT64_C(0x8a901fd6b873c50d), UINT64_C(0x11a7d54c4b53fb8e), UINT64_C(0xba2aa813647a73d3)}},
+  {{ UINT64_C(0xd35ea69685a2d17a), UINT64_C(0xe2fa7f4cc150d1f9), UINT64_C(0x11ea40bea51e82b6)}},
+  {{ UINT64_C(0xaf553b35c41e2884), UINT64_C(0x9c3fe6578e0341e8), UINT64_C(0x2ccc3e4b58b503ce)}},
+  {{ UINT64_C(0xf700165acdcf842b), UINT64_C(0x1cd18eb18a0bbc9f), UINT64_C(0x8d200f2bab7a8199)}},
+  {{ UINT64_C(0xc5f8e1347a09ae75), UINT64_C(0x43ac006790a2e9c5), UINT64_C(0x2e349ab8957d40b7)}},
+  {{ UINT64_C(0x40c46a860841c941), UINT64_C(0xc41bb7a9f98c2894), UINT64_C(0xc83f38e47dbafe10)}},
+  {{ UINT64_C(0x322713ecbce7119c), UINT64_C(0xb94ee310d8f0b7c7), UINT64_C(0xcfe484af544fdb01)}},
+  {{ UINT64_C(0x7465e7e375663119), UINT64_C(0x19df4c61c7a6b3c8), UINT64_C(0xe6bb42f95fb2584c)}},
+  {{ UINT64_C(0xbee47d32471f8410), UINT64_C(0xec388337c3a27bf3), UINT64_C(0x6a3f220c58a098ff)}},
+  {{ UINT64_C(0x9a03edbe4173a730), UINT64_C(0xf8d25eeaaa584518), UINT64_C(0x2dc22a39b1ea8f08)}},
+  {{ UINT64_C(0xd16faa1d96e4af43), UINT64_C(0xf4b4adfee862997d), UINT64_C(0xc3c63b1bcd8e207f)}},
+  {{ UINT64_C(0x8364bdccce32f482), UINT64_C(0x90d6a79924cd6d47), UINT64_C(0xbf19c31ab61bf644)}},
+  {{ UINT64_C(0xb2b7335253ea599d), UINT64_C(0x5433aa1d12aa7150), UINT64_C(0x6ed033d982a6babf)}},
+  {{ UINT64_C(0xcf76764b3ec70188), UINT64_C(0x4d7de9122c657c89), UINT64_C(0x8a851af5ed490102)}},
+  {{ UINT64_C(0xc085103b935f1203), UINT64_C(0xa52c5431712b8eb2), UINT64_C(0xd2c25933cc4767e6)}},
+  {{ UINT64_C(0x531790e7d5375eeb), UINT64_C(0x24a89d8f6e0bbe58), UINT64_C(0xf9c9fb3bc797ebf4)}},
+  {{ UINT64_C(0x9469d496d51993c4), UINT64_C(0x83a225b53552ddbe), UINT64_C(0x83fbee781aaec291)}},
+  {{ UINT64_C(0x6fb7f764e916a2c7), UINT64_C(0x88bc9e2c1ec6b307), UINT64_C(0x749ccfad4c469149)}},
+  {{ UINT64_C(0x60225ba58d0eb379), UINT64_C(0x58799c796ed37c26), UINT64_C(0x6ce21ac30bec5f2a)}},
+  {{ UINT64_C(0x730edf99e22b11fc), UINT64_C(0x6576cec6fb62718b), UINT64_C(0x9d11469782964bb2)}},
+  {{ UINT64_C(0xefa558ae98c10052), UINT64_C(0xa74e03cfe2ec6e7d), UINT64_C(0x3e32e70b558e1040)}},
+  {{ UINT64_C(0xd2aae275f9504eee), UINT64_C(0xb67e0fc3cf8c90dd), UINT64_C(0xd53334304bd56a26)}},
+  {{ UINT64_C(0xfb47feec9d0499f7), UINT64_C(0x9ea116445e19105b), UINT64_C(0xd7baee579822f102)}},
+  {{ UINT64_C(0xa27b298d937a7a09), UINT64_C(0x329738f5ad54baea), UINT64_C(0x3151a901e67762c8)}},
+  {{ UINT64_C(0x232ff4d6c0e50dd8), UINT64_C(0x54a40314230a51fa), UINT64_C(0x1bf2742deb74921f)}},
+  {{ UINT64_C(0xfcf7e8bbb1d42624), UINT64_C(0x27ed9ca6245429f2), UINT64_C(0xac8c5c00e22e1505)}},
+  {{ UINT64_C(0xb771d82458a7f04c), UINT64_C(0x25c2816a867ac014), UINT64_C(0x4e6e931ab688418f)}},
+  {{ UINT64_C(0x2d7e41f8f637a651), UINT64_C(0x2034419ba0a9206a), UINT64_C(0x24e001746134ce71)}},
+  {{ UINT64_C(0xb380f0bbb7346d7d), UINT64_C(0xc234d6790f14e4f9), UINT64_C(0x14ae5c9b604bfa00)}},
+  {{ UINT64_C(0x6f37d9df1d7c69cd), UINT64_C(0x12f5dee8e36bcd5c), UINT64_C(0xfe2d5705160b9c79)}},
+  {{ UINT64_C(0x892c7a8d93c730d0), UINT64_C(0xe871b3b6c2037c95), UINT64_C(0x3c284754f5d40069)}},
+  {{ UINT64_C(0x2f2294371b227586), UINT64_C(0x7d10d2f4082d8134), UINT64_C(0xa9c79b9233914e4d)}},
+  {{ UINT64_C(0xd32f93d5948e577e), UINT64_C(0x03de8d2f904c9682), UINT64_C(0xf29c613d4bb84743)}},
+  {{ UINT64_C(0x174089156c2ea19b), UINT64_C(0x693742ac6feee25e), UINT64_C(0xf073ffed68ac996e)}},
+  {{ UINT64_C(0x21c9e11bc5a70819), UINT64_C(0x5f4330d5ba640dac), UINT64_C(0x694e3554e194207a)}},
+  {{ UINT64_C(0x3ff988bc848785db), UINT64_C(0x9c69b467fb849276), UINT64_C(0xa20bacc8fd8690e0)}},
+  {{ UINT64_C(0xb8ee27755ee613a8), UINT64_C(0xbf02ee1def532b56), UINT64_C(0x18304995d7e2ab2a)}},
+  {{ UINT64_C(0xd70c77ceac719190), UINT64_C(0x4c8c151331c771e6), UINT64_C(0x9302f63cf13e7d65)}},
+  {{ UINT64_C(0x497719e4a0eb507f), UINT64_C(0xdb75c076f81a01ca), UINT64_C(0x7731f4ed9190137e)}},
+  {{ UINT64_C(0x2fbf8132c85c4724), UINT64_C(0x55be4c4b101e252f), UINT64_C(0x1c37628dd87a24af)}},
+  {{ UINT64_C(0x96c29832364bb5be), UINT64_C(0xd73c02ec82087b7f), UINT64_C(0x02f40862422b4710)}},
+  {{ UINT64_C(0x0a85f0da5a29bb05), UINT64_C(0x6daa9beca59e0505), UINT64_C(0xa57b26750e975036)}},
+  {{ UINT64_C(0xb9ee9fbc66a1f8d4), UINT64_C(0x7941b50f8b153291), UINT64_C(0x0a6157f8d814f2b1)}},
+  {{ UINT64_C(0x52fd206cead3c796), UINT64_C(0x8e9048bfb3d4db24), UINT64_C(0x2f22a7c6a29cdae4)}},
+  {{ UINT64_C(0x9bfbf404eb2eb2fd), UINT64_C(0x883c5026cae403de), UINT64_C(0x64fe8eb603ecd013)}},
+  {{ UINT64_C(0xe89e2c97b51594bb), UINT64_C(0x03be8d5edaad2a66), UINT64_C(0xe9e774fd856b4d97)}},
+  {{ UINT64_C(0xf884d73acbbd437f), UINT64_C(0x543bb9069fa084eb), UINT64_C(0xbff752f31674afe0)}},
+  {{ UINT64_C(0x0b2a018b995bebe2), UINT64_C(0xefe0b6de5c9cca4d), UINT64_C(0x31150a1683ed5b44)}},
+  {{ UINT64_C(0x3334228dca0da4f0), UINT64_C(0x99d5a580867b6775), UINT64_C(0x0f751a7e97e85ae4)}},
+  {{ UINT64_C(0x0db5c9e24e830897), UINT64_C(0x96590a7254f6adc0), UINT64_C(0xf33b20ace433d590)}},
+  {{ UINT64_C(0x7295422a7ec39f9c), UINT64_C(0x75a1b4e40efb73c7), UINT64_C(0xf1b964646768637d)}},
+  {{ UINT64_C(0xe0588952ca6f4634), UINT64_C(0x0c3a50d5a6162b62), UINT64_C(0xb92d08b8c75591b9)}},
+  {{ UINT64_C(0x75de838c26bcf7eb), UINT64_C(0xc88941b8f35a902a), UINT64_C(0xa43c37049d48127c)}},
+  {{ UINT64_C(0x65fb17993883c4bd), UINT64_C(0x500a47a1686a5c30), UINT64_C(0x9d8ad974a9393084)}},
+  {{ UINT64_C(0xce44ec530b97fb30), UINT64_C(0x7c349a232827b6e4), UINT64_C(0xb403fdb3624a28e2)}},
+  {{ UINT64_C(0x4cd85f44999d3eeb), UINT64_C(0x96c2a96a12c18a3e), UINT64_C(0xfae174d66fcafb31)}},
+  {{ UINT64_C(0x65a93abb1e1956fa), UINT64_C(0x7e80862051bbfc72), UINT64_C(0x3c84f5af1b9b2aaf)}},
+  {{ UINT64_C(0xa474c0a423e9fffd), UINT64_C(0x6da2fdae6543abbf), UINT64_C(0xbed4783e7f80466d)}},
+  {{ UINT64_C(0x527a2ee8a5bb446c), UINT64_C(0x54c648fb4d082865), UINT64_C(0x5a4f46f94c583f68)}},
+  {{ UINT64_C(0x92bb36d15e8fada2), UINT64_C(0xdd062887d40c12da), UINT64_C(0xbc4eaae328774507)}},
+  {{ UINT64_C(0x2868622a6e3dfece), UINT64_C(0xb7316c25ceaedb71), UINT64_C(0x76d58064a59b969e)}},
+  {{ UINT64_C(0xeeda4483de9ca57c), UINT64_C(0x85d61dfe57ad00c0), UINT64_C(0x06199b88c716a8b1)}},
+  {{ UINT64_C(0x7f9566031e45596b), UINT64_C(0x89eac533c013efe7), UINT64_C(0x47c34b3b8328f4ac)}},
+  {{ UINT64_C(0xd8a15200adfb54eb), UINT64_C(0x731a3898ca5dbdf0), UINT64_C(0xf8bbca5c959716f3)}},
+  {{ UINT64_C(0xe92f1d6a0869d8bc), UINT64_C(0x518f958c8fcd12f7), UINT64_C(0xda7af64bc29f0323)}},
+  {{ UINT64_C(0x62b1dd8a100f622e), UINT64_C(0x28b620f518e18d9d), UINT64_C(0xc57de53ac1a5bd1c)}},
+  {{ UINT64_C(0x2b4a13665101e7e2), UINT64_C(0x291e0b9cb994f8e4), UINT64_C(0x8e50b7c3545f263d)}},
+  {{ UINT64_C(0x74f2e86badc0430b), UINT64_C(0x7b36c7e652ea410a), UINT64_C(0x66344f0d3478917f)}},
+  {{ UINT64_C(0x9be59a74d2936dcc), UINT64_C(0x9b1baaa2d452aab8), UINT64_C(0x1769e797900be65d)}},
+  {{ UINT64_C(0x6c3fd72ccad49273), UINT64_C(0x8e72970e2c84436f), UINT64_C(0x4467cf70b9269275)}},
+  {{ UINT64_C(0xd1fbd2a639648dd0), UINT64_C(0xeef5b55db3b20370), UINT64_C(0x12fdd9d0ee277104)}},
+  {{ UINT64_C(0xb2799c1bc8a7047a), UINT64_C(0x23b377604240fe67), UINT64_C(0xfcdca765d4b537ed)}},
+  {{ UINT64_C(0xb5bcd0bdda4851b0), UINT64_C(0xbf44e59d42efddcd), UINT64_C(0x9abc5a149c1bcda9)}},
+  {{ UINT64_C(0xd217eedc5fb915c0), UINT64_C(0xcdf006e8f00de235), UINT64_C(0x74d29910e2944d1d)}},
+  {{ UINT64_C(0x85ac1c53598deb14), UINT64_C(0x916f8fb0860c92a9), UINT64_C(0x00c21fdea8111f41)}},
+  {{ UINT64_C(0x8b992db1ff9bcb14), UINT64_C(0xa4292c975dd62ca9), UINT64_C(0xc87b686d4b0a8389)}},
+  {{ UINT64_C(0x11fd3335cb440956), UINT64_C(0xa5dd970d8184979b), UINT64_C(0xdd69ab00dd5a83b0)}},
+  {{ UINT64_C(0x0bcf7064fe4f4688), UINT64_C(0x2e996236a23454da), UINT64_C(0xd501364b5cb8bb2e)}},
+  {{ UINT64_C(0xed84402ccf380632), UINT64_C(0x366a21ac19d602f7), UINT64_C(0xd5f88b696d82cda7)}},
+  {{ UINT64_C(0x24bc957c6efe51c7), UINT64_C(0xeb7fb2e329183fd5), UINT64_C(0x80c2dff8bafd6fea)}},
+  {{ UINT64_C(0x9150526127a120e1), UINT64_C(0x0c0cb8c2067b47ef), UINT64_C(0x04e7b563cd13addd)}},
+  {{ UINT64_C(0x54f0012ef914d584), UINT64_C(0x5b23b6ba21f7cf4d), UINT64_C(0x3f6a7483fa9188aa)}},
+  {{ UINT64_C(0xd463bf3941f6452c), UINT64_C(0x04407afb3cf1c892), UINT64_C(0x3c1170f0818317f7)}},
+  {{ UINT64_C(0xe6bfdd45eb6997c1), UINT64_C(0x36ba130e5eb65326), UINT64_C(0x537580bec0db36df)}},
+  {{ UINT64_C(0xb15c781220b651b7), UINT64_C(0xb9a9837fffcca323), UINT64_C(0x048254f36b409908)}},
+  {{ UINT64_C(0xd0f2e06b9afe7371), UINT64_C(0xbc0324d287c9acef), UINT64_C(0x00783d98c0f8b230)}},
+  {{ UINT64_C(0x64a83ac7574704cb), UINT64_C(0x763a3033fd17a40f), UINT64_C(0x7b437d31fc849383)}},
+  {{ UINT64_C(0xc208976713217094), UINT64_C(0xd62f34b307f00681), UINT64_C(0x3be43c68e91be243)}},
+  {{ UINT64_C(0xbe7920277271ff6f), UINT64_C(0x394018af0f52b1df), UINT64_C(0xc5399faa4989b8f3)}},
+  {{ UINT64_C(0xe20f5b8d7eaa1d84), UINT64_C(0x66a92d0fac0d9b44), UINT64_C(0x8b9b8984ea99caa0)}},
+  {{ UINT64_C(0x3db873e13d4d041c), UINT64_C(0xa1538eb031ffb5a6), UINT64_C(0xe7ac120ef11eea36)}},
+  {{ UINT64_C(0xd5b73b8db286b2de), UINT64_C(0x4e5b1ad3a2c6c752), UINT64_C(0x28ef42fd17da7c68)}},
+};
+
+static const mzd_row192_t K_0[] = {
+  {{ UINT64_C(0x9299b87cf67f4bc9), UINT64_C(0xec868d3b13a76cf8), UINT64_C(0xf80aee410c17428b)}},
+  {{ UINT64_C(0x87eecf7cb82d2b94), UINT64_C(0x45dccc2ed78b77d6), UINT64_C(0x37fef022879b006e)}},
+  {{ UINT64_C(0xafeacc3e531c679b), UINT64_C(0x7f39137662f9ece1), UINT64_C(0x57ec5b0217802f4b)}},
+  {{ UINT64_C(0x2b90158572e5967a), UINT64_C(0x14c39fa15cde164c), UINT64_C(0x4c1206440a2163ef)}},
+  {{ UINT64_C(0x8f311a1a2dbbd091), UINT64_C(0xa8eda1540d2742f5), UINT64_C(0x5322c2e387e70106)}},
+  {{ UINT64_C(0x2f34da5afa9ef2c1), UINT64_C(0xd4e6413d6a427510), UINT64_C(0x51205b690f008ad6)}},
+  {{ UINT64_C(0xe204c2102e651369), UINT64_C(0x5cdb4f57fa93732a), UINT64_C(0x7731c683590b476d)}},
+  {{ UINT64_C(0x26c76fc79940f2be), UINT64_C(0xa681e508c56fb812), UINT64_C(0xd164306bb784b593)}},
+  {{ UINT64_C(0xd4037d269ccbe69d), UINT64_C(0x1ed16f9af22463a6), UINT64_C(0x153fc04671ed6dfc)}},
+  {{ UINT64_C(0x5507bb929681f721), UINT64_C(0x4ce9688d3f355e78), UINT64_C(0x97985cf46bb81aee)}},
+  {{ UINT64_C(0x3fd93dea01a5796a), UINT64_C(0x1a142ded7a40deb4), UINT64_C(0xb869e6d742673873)}},
+  {{ UINT64_C(0xa83c419cb7966b58), UINT64_C(0xaae090cbba6da89e), UINT64_C(0x2133025257579e37)}},
+  {{ UINT64_C(0xd7428c3ab1eb624a), UINT64_C(0x5252493b2e722feb), UINT64_C(0x8561841a170a3d7b)}},
+  {{ UINT64_C(0xdf9873dec392c169), UINT64_C(0x033ff0cc68f9ccce), UINT64_C(0xd8ca17e07a1ee41d)}},
+  {{ UINT64_C(0xe88fdf66a263214a), UINT64_C(0xca7d4c39baf15fc7), UINT64_C(0x0fbd3c0368dc4148)}},
+  {{ UINT64_C(0xa9a810efbea3fbc8), UINT64_C(0x99abc464cd7e37b6), UINT64_C(0x8d4bba7c58b1236c)}},
+  {{ UINT64_C(0x65317147ffe2dafb), UINT64_C(0xa2a0541cef7df1d8), UINT64_C(0xa9dcbd28939954e1)}},
+  {{ UINT64_C(0xfd1b17d921279ceb), UINT64_C(0xdbbf19ff6ec5c70b), UINT64_C(0x45476ab94457a2c8)}},
+  {{ UINT64_C(0x7de526957c057582), UINT64_C(0x6e254de5888c677d), UINT64_C(0x97f7e7eaef571ddb)}},
+  {{ UINT64_C(0xde8656c771558c36), UINT64_C(0xa9f3f35eb9dec6bc), UINT64_C(0xb059f30dc34e91bc)}},
+  {{ UINT64_C(0x029ca78a2a6187bd), UINT64_C(0x40fc495f3e2625ac), UINT64_C(0xe03f90742e06ba30)}},
+  {{ UINT64_C(0x37fccc7279a731cc), UINT64_C(0x522a678e9eecf767), UINT64_C(0x77e9d7a04516afd3)}},
+  {{ UINT64_C(0xd585e0d1cae0a550), UINT64_C(0x0659336fc42f4d97), UINT64_C(0x5cf5cf49721ecc84)}},
+  {{ UINT64_C(0xec03f4acd47897ea), UINT64_C(0x49c5542fe769d1c8), UINT64_C(0x2e7fbac277abb290)}},
+  {{ UINT64_C(0x59ebea0a09d829f9), UINT64_C(0x30a58ee686fa2438), UINT64_C(0x1d608131d9961b51)}},
+  {{ UINT64_C(0x49a2bdc8653ab88c), UINT64_C(0xd9d31b57f83240f1), UINT64_C(0x769d9eea70b3dd23)}},
+  {{ UINT64_C(0xcbe13a62466a1a14), UINT64_C(0x3bd09c4996762803), UINT64_C(0x6b368eb3a28c4bd4)}},
+  {{ UINT64_C(0x491ef05fc4ca1cce), UINT64_C(0xae5bd6126f890c0b), UINT64_C(0xea8cc167ee2f0a80)}},
+  {{ UINT64_C(0x8f465ce33bb4a1cf), UINT64_C(0x402b167b95d4fcfd), UINT64_C(0xd4fcdf8c39b32437)}},
+  {{ UINT64_C(0x7ad8be7ac3089da5), UINT64_C(0xdb427d2d3214dee5), UINT64_C(0x704b6b4c564e8a8b)}},
+  {{ UINT64_C(0xaff387417b4eee0e), UINT64_C(0x622137cbfac36400), UINT64_C(0x9136d765c2d9d59f)}},
+  {{ UINT64_C(0x078e2ac9b120172a), UINT64_C(0x5aa7ed0059a238be), UINT64_C(0x240f2b1437cb20ed)}},
+  {{ UINT64_C(0x5ebcfddda0ab49c7), UINT64_C(0xae4e4a08cb577eff), UINT64_C(0x99752ab14b32eaae)}},
+  {{ UINT64_C(0x21475370e07d4a7e), UINT64_C(0xe926bb36aeebf1bc), UINT64_C(0xc8f700e989408499)}},
+  {{ UINT64_C(0x68f4d384c6e78ac0), UINT64_C(0xcef9406606812ff4), UINT64_C(0xe8d77df297931b2e)}},
+  {{ UINT64_C(0x831c652fe959700d), UINT64_C(0x95b84252e135eec9), UINT64_C(0xde3f54b25f6e3850)}},
+  {{ UINT64_C(0xbe3d827c4e206d3b), UINT64_C(0xb413fce36c88d1e1), UINT64_C(0x752f6d21d8a1e683)}},
+  {{ UINT64_C(0x7d5dd5a3205230d1), UINT64_C(0xfe97ada9f0cec547), UINT64_C(0x6f771997e504b955)}},
+  {{ UINT64_C(0x1fc0a09698254b70), UINT64_C(0x617c4bbf621cb0e4), UINT64_C(0x26ae6d7d2fcdedbc)}},
+  {{ UINT64_C(0xf5318791f459ef82), UINT64_C(0xc9b29ccab786fe39), UINT64_C(0x511187e08bfb3088)}},
+  {{ UINT64_C(0xb6cd632e5b5eb7a5), UINT64_C(0x9ab3b9bce172f955), UINT64_C(0x1cb7b02804e7f998)}},
+  {{ UINT64_C(0x156eda6acda68d56), UINT64_C(0x556b2caaece49d4e), UINT64_C(0x88f37aa232cabf93)}},
+  {{ UINT64_C(0x83e89003c708025e), UINT64_C(0x95c12ea9f86527f9), UINT64_C(0xa8f2561e0005d5b6)}},
+  {{ UINT64_C(0x0133b22e21397dcb), UINT64_C(0x4f6b0f31ddcda457), UINT64_C(0x9fe26412abdcd564)}},
+  {{ UINT64_C(0x97287d052c142baa), UINT64_C(0x7362711a04d8cf62), UINT64_C(0xba8fb57cb6858214)}},
+  {{ UINT64_C(0x5cba45cdca94e311), UINT64_C(0xd00243ec2f359fd4), UINT64_C(0x67721b73393795cc)}},
+  {{ UINT64_C(0xfa4e581419a8429f), UINT64_C(0x51cc4d2641cd7fb5), UINT64_C(0x4aa50b9115169741)}},
+  {{ UINT64_C(0x8073720499eec1dd), UINT64_C(0xc1736eba05ddaa67), UINT64_C(0x949fcf726c7e3fc6)}},
+  {{ UINT64_C(0xaaefacbdb03b0520), UINT64_C(0x4eae18b51f57b485), UINT64_C(0x1c309dc2b43b1e14)}},
+  {{ UINT64_C(0x2d0e75c4332be2ae), UINT64_C(0x9bab961aac3e515a), UINT64_C(0x14e9f79d6a147415)}},
+  {{ UINT64_C(0xe28ab91d10d656bc), UINT64_C(0x0c0cd78266f5f41f), UINT64_C(0x992dfdbfa3692d4d)}},
+  {{ UINT64_C(0xa8484a0baad374b5), UINT64_C(0xcff28f81db54303d), UINT64_C(0xb6542a8db78fbbd7)}},
+  {{ UINT64_C(0x20d2cbc23eec1d11), UINT64_C(0x520ce97600f2b2e6), UINT64_C(0x60bc6c16792d76cb)}},
+  {{ UINT64_C(0xbcb264bbbe9dc398), UINT64_C(0x10ec5303e3772dea), UINT64_C(0xc3a9d9feb5ac5667)}},
+  {{ UINT64_C(0x7277c3c0b7068162), UINT64_C(0x93a232ae7d36b965), UINT64_C(0xf9490fa4a372bb9c)}},
+  {{ UINT64_C(0x080faef8ff74c473), UINT64_C(0x73901d44c541c4dc), UINT64_C(0x410a56741ca6e3f1)}},
+  {{ UINT64_C(0x0cac99f1e61a6f95), UINT64_C(0xa9574ae6c5d1df26), UINT64_C(0x35946e2c2aebd44e)}},
+  {{ UINT64_C(0xec4a1e1a958529ce), UINT64_C(0x928e6782d8dbf188), UINT64_C(0xa82cc74b719cf131)}},
+  {{ UINT64_C(0xaf0e59552325887f), UINT64_C(0x877ac104d4b9c255), UINT64_C(0xb1b064d267445ded)}},
+  {{ UINT64_C(0x83565609392a1e08), UINT64_C(0x4920e3b326f63980), UINT64_C(0x6a8c7df9d00a39dc)}},
+  {{ UINT64_C(0x4d31a3b241c0176b), UINT64_C(0xe22fb7386923c9ad), UINT64_C(0x735c808495872ced)}},
+  {{ UINT64_C(0x8fc541f2d76e9efa), UINT64_C(0x6480e127416792b9), UINT64_C(0xc77ae642cfe7773b)}},
+  {{ UINT64_C(0x311fc26f1d9e620f), UINT64_C(0xe6e952418d34021f), UINT64_C(0x9b855e0ff0ab2afe)}},
+  {{ UINT64_C(0x28c65bb3e0f90874), UINT64_C(0x0c0fd92a10b4d327), UINT64_C(0xdabc34c0ecf7dff9)}},
+  {{ UINT64_C(0xf3616f8e3592dab3), UINT64_C(0xb077cc8a2d6b3cb5), UINT64_C(0xa4607df75b45f334)}},
+  {{ UINT64_C(0x9a943c4ffc4d2152), UINT64_C(0xaa8e5d6b7260886d), UINT64_C(0x25188efca6766742)}},
+  {{ UINT64_C(0xe3cc8e909c0ffc83), UINT64_C(0x3045b93fb8701973), UINT64_C(0x6553a71ee3f9ae12)}},
+  {{ UINT64_C(0x74b2b07228ed205f), UINT64_C(0x26c76f46fa04e94b), UINT64_C(0x53cdfdb7dd08e5e7)}},
+  {{ UINT64_C(0xa369651af9f4b041), UINT64_C(0xddda2aee18c47bf4), UINT64_C(0x6a178f32a828e8f7)}},
+  {{ UINT64_C(0xf09ff047aa1cbc97), UINT64_C(0xf1c9aa330cb2a54d), UINT64_C(0xe8497b988096c391)}},
+  {{ UINT64_C(0xb431d5791994a356), UINT64_C(0x26d8f08366f21e22), UINT64_C(0x2099c6c3ebeb4127)}},
+  {{ UINT64_C(0xd170382c4fdf68fb), UINT64_C(0x984d4c3bc9d41aef), UINT64_C(0x1505a2a4f0ae0878)}},
+  {{ UINT64_C(0xa8b5d32a64d3d0d9), UINT64_C(0xb098f077b60e7d4b), UINT64_C(0xd536b5e7f6bbf71f)}},
+  {{ UINT64_C(0xdedb798080669a18), UINT64_C(0x7f90affe0f7f233f), UINT64_C(0x4183fcd325fb00db)}},
+  {{ UINT64_C(0x7f2094bf7775e940), UINT64_C(0x1472b4b515ba9349), UINT64_C(0x561c2b0dbd9e5bb7)}},
+  {{ UINT64_C(0xa2ea965a654232b4), UINT64_C(0xe79f66aa36851c46), UINT64_C(0xf070d82a34267348)}},
+  {{ UINT64_C(0xacdd9ee2da0fa595), UINT64_C(0x0f6594026111f24f), UINT64_C(0xe658debf040088c3)}},
+  {{ UINT64_C(0x834cf499d4ff86f9), UINT64_C(0x941e4dcb74aa8d15), UINT64_C(0xcd469f7be3060a58)}},
+  {{ UINT64_C(0x65aa1a6d0860f366), UINT64_C(0xed3e359f76db6bd2), UINT64_C(0xf8b2b688899f2f82)}},
+  {{ UINT64_C(0x52ade51cf16f27d9), UINT64_C(0x95c4dddc57a8c5c0), UINT64_C(0xd2b406dfa2cd611b)}},
+  {{ UINT64_C(0xf67326172a9738c4), UINT64_C(0x33b787f770e4fdc6), UINT64_C(0x12ce43017386b22c)}},
+  {{ UINT64_C(0xb6b4383ea804ebaf), UINT64_C(0x048285949fab055c), UINT64_C(0xa4e4e08bd7428cea)}},
+  {{ UINT64_C(0x5d365de527c84524), UINT64_C(0x61253cfbb7ca30db), UINT64_C(0x43a0540b85e4b51c)}},
+  {{ UINT64_C(0xc92ccc921ebfe0c8), UINT64_C(0x204141fafa610cc3), UINT64_C(0xdad8bcc2cb69b48d)}},
+  {{ UINT64_C(0x2c80b39bf5e3f5eb), UINT64_C(0xa391bc593c2b3ff8), UINT64_C(0x98b14fc1b997fcaf)}},
+  {{ UINT64_C(0xa9187fda3b6d1e68), UINT64_C(0xe7dded8fa549e60f), UINT64_C(0x858d95588088018c)}},
+  {{ UINT64_C(0x16e5a7ffabe6c40a), UINT64_C(0x7686803591644afa), UINT64_C(0xf65d269c6db3c2c0)}},
+  {{ UINT64_C(0x5b4c84b6df8deb7d), UINT64_C(0x28cc58e86dd990d8), UINT64_C(0xe6c978270cf6e57c)}},
+  {{ UINT64_C(0x9f3a455d1ac5cf71), UINT64_C(0x2f48481453dac430), UINT64_C(0x30f7b2b86668cd79)}},
+  {{ UINT64_C(0x52509281da3de08d), UINT64_C(0x9226e3f7703c668e), UINT64_C(0x12ba01de2667c542)}},
+  {{ UINT64_C(0xcf912dbb43ed425d), UINT64_C(0x31e02256e9e19fd5), UINT64_C(0x000f2ae28764740b)}},
+  {{ UINT64_C(0x966245acd18543d9), UINT64_C(0x0827e963bb27afbe), UINT64_C(0x87eac0a528ef3062)}},
+  {{ UINT64_C(0x7ed35e0dc1902cd5), UINT64_C(0xd88cf4659c00a1da), UINT64_C(0xc4e84d38531ac5ad)}},
+  {{ UINT64_C(0x401e3145de9f0898), UINT64_C(0x02007e05aad35262), UINT64_C(0x81b528be520534c0)}},
+  {{ UINT64_C(0x52e9fcef1244b29a), UINT64_C(0xad3498baf98f5c9d), UINT64_C(0x2c6c52810e95acad)}},
+  {{ UINT64_C(0xa4cd270458f9d164), UINT64_C(0xe428bcbf503621ed), UINT64_C(0x381ffe5f77ef281e)}},
+  {{ UINT64_C(0x5535e8d42638770b), UINT64_C(0xce2dc575e0ea828b), UINT64_C(0xcafa6e27b751d6c6)}},
+  {{ UINT64_C(0x9143ea01cde2de5c), UINT64_C(0x956ed6f86de5f994), UINT64_C(0x53d35373e3dbdbc7)}},
+  {{ UINT64_C(0xbeedda7c48554f2a), UINT64_C(0x5ccf06a4d23f5816), UINT64_C(0x01f79a7a91d6493f)}},
+  {{ UINT64_C(0x4608821b76571dc6), UINT64_C(0x018214bdf499145f), UINT64_C(0xdbfc38c05b3961bc)}},
+  {{ UINT64_C(0x6477fbd5e3cbd889), UINT64_C(0xe4498bce62a422ed), UINT64_C(0x28825f412062f8c3)}},
+  {{ UINT64_C(0xd11b8ecb93549b01), UINT64_C(0x7f5cac223b16aced), UINT64_C(0xc9c7e7e9a2cd3883)}},
+  {{ UINT64_C(0x589a5b5552e024a7), UINT64_C(0x2c1df4851fa1437f), UINT64_C(0x4ecacb027827550b)}},
+  {{ UINT64_C(0x921d947945305be4), UINT64_C(0x9d22b93227f58d3e), UINT64_C(0xe13de01596ed4f14)}},
+  {{ UINT64_C(0x3c8f0d8df4107b96), UINT64_C(0x2e3bdbe8202f5c87), UINT64_C(0x58d0958c592c4e4f)}},
+  {{ UINT64_C(0x8cfc7a0746247cde), UINT64_C(0x7b1e62255ab6da71), UINT64_C(0xbf476cc61ae57987)}},
+  {{ UINT64_C(0x02c655f8b341c998), UINT64_C(0x2488b4b2eb31ecbf), UINT64_C(0xfb4b42d5bce1f9eb)}},
+  {{ UINT64_C(0x2642641607d0cf2e), UINT64_C(0x459ad2d31f507b36), UINT64_C(0x6ae7a3cc6421a562)}},
+  {{ UINT64_C(0x9fca89a2539b2067), UINT64_C(0x67685a2635bc59cf), UINT64_C(0xfb374e94f06232a2)}},
+  {{ UINT64_C(0x7eb240ac3a68ddad), UINT64_C(0xfde83d2addc1b40a), UINT64_C(0x2b15afa67f812107)}},
+  {{ UINT64_C(0x0a7aadf099cb84a5), UINT64_C(0x5ef5fbdd6a26409c), UINT64_C(0xf18ab8e3bf2b61df)}},
+  {{ UINT64_C(0x1daf6427826dd17c), UINT64_C(0xbd98690ebe16429d), UINT64_C(0x8794a59c41b71c3d)}},
+  {{ UINT64_C(0x785a42b0d1d1b6e3), UINT64_C(0xd61d0d87b49aa0c8), UINT64_C(0x6b221b4e347bcd25)}},
+  {{ UINT64_C(0xd4302bfe51d7924d), UINT64_C(0xdad8c2ab6eca95a6), UINT64_C(0x7766182f74eef01c)}},
+  {{ UINT64_C(0x274e25785f1b1983), UINT64_C(0xc173dd96fa6c971c), UINT64_C(0xbd7aafa086162266)}},
+  {{ UINT64_C(0x81a1bc67a4536b68), UINT64_C(0x38fb4b91bc27476f), UINT64_C(0x021c247d9851d333)}},
+  {{ UINT64_C(0x3a98e1fdd4357360), UINT64_C(0x862c6ead1e72e698), UINT64_C(0x2ad79cde250bed37)}},
+  {{ UINT64_C(0xf496e64f6c5fead2), UINT64_C(0x448b6a844c5f8d22), UINT64_C(0x2b9a5ef57b34f424)}},
+  {{ UINT64_C(0xe01814b97003bf5b), UINT64_C(0x85bb2fcdbcfeb009), UINT64_C(0x3676b0b8e05fe1af)}},
+  {{ UINT64_C(0x1c101cc930c8fb83), UINT64_C(0x6ec42ac75b7f7475), UINT64_C(0x07cd64371874ed17)}},
+  {{ UINT64_C(0x7b7dcdcf3939ea94), UINT64_C(0x88f8df3ccbc2524f), UINT64_C(0x63e35427383e3e94)}},
+  {{ UINT64_C(0x8b85f533fecc47bf), UINT64_C(0xe6697565dd994dd6), UINT64_C(0x41c1a67090891c14)}},
+  {{ UINT64_C(0xb09ec05cca3167f8), UINT64_C(0xfb349ebd3025b577), UINT64_C(0x5dec45d56470b7fe)}},
+  {{ UINT64_C(0x744dedd71ade45f3), UINT64_C(0xdaa8652c28884db4), UINT64_C(0xb30429da3bd54b43)}},
+  {{ UINT64_C(0x841ce8d5082e7223), UINT64_C(0x2f02099e1942f2bb), UINT64_C(0xc71e35b9966a2b2a)}},
+  {{ UINT64_C(0x88670bdc04be622a), UINT64_C(0xc3a05bed9b564e08), UINT64_C(0x7fb0447fec67b539)}},
+  {{ UINT64_C(0x50e2ba0b9b5921d4), UINT64_C(0x8cf35339f1119372), UINT64_C(0x3c50798930901939)}},
+  {{ UINT64_C(0x7f7837aed69ec47c), UINT64_C(0x44b36a723bb64bc3), UINT64_C(0x4c40fc79e8096686)}},
+  {{ UINT64_C(0x4c5b8b04de70fea7), UINT64_C(0x93b632b5f6ef276a), UINT64_C(0xf3f528959b7fec05)}},
+  {{ UINT64_C(0x2edacaf7bc1f2f26), UINT64_C(0x8490c05a6ce5a513), UINT64_C(0x34f02d683f4f29e5)}},
+  {{ UINT64_C(0xb132b54882c3c40e), UINT64_C(0x970fd58846e2ce13), UINT64_C(0x5bc8fe637ffdb513)}},
+  {{ UINT64_C(0x54472562d3c29dce), UINT64_C(0x8d90887fc4db9c13), UINT64_C(0x6222424c2eadedc6)}},
+  {{ UINT64_C(0xc7d8a16c4cf48a8d), UINT64_C(0xb636cd39f1af1344), UINT64_C(0x52f38bbb94ebe150)}},
+  {{ UINT64_C(0xaeccc688f4a34802), UINT64_C(0xc15d7f2c66402517), UINT64_C(0xb839131adbd07cb1)}},
+  {{ UINT64_C(0x5342ac063fa921ff), UINT64_C(0x603fd81a2ca4297c), UINT64_C(0x8b0788a533a5be73)}},
+  {{ UINT64_C(0xf6b4333be1d5f237), UINT64_C(0x65d00d9fe43ecce1), UINT64_C(0xd80c31823f3060c8)}},
+  {{ UINT64_C(0x8f7231edf600034f), UINT64_C(0x3fee10eecabfa30b), UINT64_C(0x29e48f1fd82637b6)}},
+  {{ UINT64_C(0x7b0ee0d6581fc70f), UINT64_C(0x6c6a92908c2d2c22), UINT64_C(0xe6117cb25f83fb51)}},
+  {{ UINT64_C(0x1d2ee130e7d91b56), UINT64_C(0x47d6d45bd49b7ec6), UINT64_C(0x29d1db228f5f5aae)}},
+  {{ UINT64_C(0xff82c9cfdf001056), UINT64_C(0x4cf1f99dcf3f88ec), UINT64_C(0x70c300c0dd93cb20)}},
+  {{ UINT64_C(0x2abd792c696f5c84), UINT64_C(0xa9efcdbcd0036255), UINT64_C(0xaf4130322d0c11db)}},
+  {{ UINT64_C(0x2578b212c03d02e8), UINT64_C(0x77fbe2651197cb26), UINT64_C(0xb2c71da0dfcc3b4d)}},
+  {{ UINT64_C(0x201c5307e5f01c34), UINT64_C(0xbbf94b14eed71702), UINT64_C(0xf52da1468d2fb46c)}},
+  {{ UINT64_C(0xd3d3d553a1a7ec54), UINT64_C(0x3f416fd4df6fcd87), UINT64_C(0x4c27616432a1077e)}},
+  {{ UINT64_C(0x07b8a9c64ecd191e), UINT64_C(0x1cac16ac1b21636a), UINT64_C(0x97882c7bec10b72d)}},
+  {{ UINT64_C(0xcae6452c1006c330), UINT64_C(0xb3ed847f822f7170), UINT64_C(0x29713235e38c3927)}},
+  {{ UINT64_C(0x0778bb7ffbe7f0c8), UINT64_C(0x6877f06851601d30), UINT64_C(0xb5445eb9d11d2d82)}},
+  {{ UINT64_C(0x4cf9fca69bb08f6e), UINT64_C(0x8919dff10adbd549), UINT64_C(0xf153f1a440d8110f)}},
+  {{ UINT64_C(0x28d8cd0f05737ab7), UINT64_C(0x14de7ecaeb0336b9), UINT64_C(0x1ccecf4cb0d216d5)}},
+  {{ UINT64_C(0xb66e979723bd0edd), UINT64_C(0x0fdb71fa1c6c9be9), UINT64_C(0x0cb189c3bd0f36c2)}},
+  {{ UINT64_C(0xaead1dbbfab7989a), UINT64_C(0x9bb05f7c19228d59), UINT64_C(0xd7c71f0ebae8c8d2)}},
+  {{ UINT64_C(0xae9cfbe9bd65d814), UINT64_C(0xa986f6e62b81a6a6), UINT64_C(0xfe2855239cad344b)}},
+  {{ UINT64_C(0xf805926da2b3946a), UINT64_C(0x348f5aec057fa866), UINT64_C(0xbc97f264c991aa1d)}},
+  {{ UINT64_C(0xb184bf135a1b444f), UINT64_C(0xdbd644d4edcb2842), UINT64_C(0x862303612a11d0a9)}},
+  {{ UINT64_C(0xbe9e39c232a47893), UINT64_C(0xf1ee151587244ae1), UINT64_C(0x0bb184682abfa658)}},
+  {{ UINT64_C(0xd74d2e10dd171943), UINT64_C(0x4312aa2c755bf484), UINT64_C(0x60e37659266a2b2e)}},
+  {{ UINT64_C(0xdf75de8b590eeadf), UINT64_C(0x867050ee0bfca5ba), UINT64_C(0x1159228f72f9c65e)}},
+  {{ UINT64_C(0x30d9d3d401315fec), UINT64_C(0x0c52cb9e78a1ba14), UINT64_C(0x6d46f8adac1557a7)}},
+  {{ UINT64_C(0x591397911284c285), UINT64_C(0x968d92a4e62e2c5a), UINT64_C(0xc3520f9c71502351)}},
+  {{ UINT64_C(0xc85300caa6d24042), UINT64_C(0xa6857b6924d4685f), UINT64_C(0x690e721624872eeb)}},
+  {{ UINT64_C(0x2017317ad8c0fc10), UINT64_C(0x3f94203f7236d6c6), UINT64_C(0x21950df8ebb71b28)}},
+  {{ UINT64_C(0x169dd1511c081ae7), UINT64_C(0xdd0be27a9d7e735d), UINT64_C(0x55f0a0b6f19b76f0)}},
+  {{ UINT64_C(0xdb163c547cf797ed), UINT64_C(0xf6571c6ef1e22fcd), UINT64_C(0xafe1b247aab929ee)}},
+  {{ UINT64_C(0x1f7d7146b9552999), UINT64_C(0x7dde8f4cee790008), UINT64_C(0x3ed0eeeba37f0494)}},
+  {{ UINT64_C(0xde1f6187486c258c), UINT64_C(0x0c95aaef9bdd5d87), UINT64_C(0x56e0fd2dec55d7b6)}},
+  {{ UINT64_C(0xdb5b684c887c5fb6), UINT64_C(0xe87bbff526636d54), UINT64_C(0xea94a97e13424579)}},
+  {{ UINT64_C(0xd3d36bd3a184320e), UINT64_C(0xf9a1bf6b6549250f), UINT64_C(0x609c54632cfa70c2)}},
+  {{ UINT64_C(0x592095c5fa6224a2), UINT64_C(0x153d27004bba98f8), UINT64_C(0xb4340eb89da20151)}},
+  {{ UINT64_C(0x1ccca14f292689bf), UINT64_C(0xd4fa2e32fb810bd4), UINT64_C(0xe07fd01c082499a7)}},
+  {{ UINT64_C(0xb6aa857a5e30f15d), UINT64_C(0x035572cfa61fd1e6), UINT64_C(0xdf7923b869dbedee)}},
+  {{ UINT64_C(0x4bc7eadbbd930bbd), UINT64_C(0xf55b14b8e300d788), UINT64_C(0x6c7c35272a1f8b1e)}},
+  {{ UINT64_C(0x0a3a4c192073fe1d), UINT64_C(0x212c21af1729d0c1), UINT64_C(0x02b8148241efa847)}},
+  {{ UINT64_C(0xfa6cd64cac039754), UINT64_C(0x00d7ea595e960ec5), UINT64_C(0x965a512a74ddb073)}},
+  {{ UINT64_C(0x64b23781f197ffde), UINT64_C(0x36fdb32e185af91c), UINT64_C(0x5b8717845c104734)}},
+  {{ UINT64_C(0x3389643178be5747), UINT64_C(0xeb58eb284b3dc40c), UINT64_C(0x064009bf82574652)}},
+  {{ UINT64_C(0x10bbcf4b5bcf673f), UINT64_C(0xd3c2ba34f53420be), UINT64_C(0x12faecb3ff2f44be)}},
+  {{ UINT64_C(0x62400ea91e469bb3), UINT64_C(0xf551b6583fb732c9), UINT64_C(0x324eee57559019bc)}},
+  {{ UINT64_C(0xf81fbedff243fda8), UINT64_C(0x8709d81149b016be), UINT64_C(0xd4ea33b10ad6784f)}},
+  {{ UINT64_C(0x3cb4fc54138d386d), UINT64_C(0x0f3a6f17eaf24cd6), UINT64_C(0xf4e1726e2119669e)}},
+  {{ UINT64_C(0x8564a972b50948c9), UINT64_C(0x676dcf67d6361dc1), UINT64_C(0x106c2c55df11f336)}},
+  {{ UINT64_C(0x41896ca6ad561865), UINT64_C(0xb8362a59ab5d23b6), UINT64_C(0x208e9e1bf4a1447d)}},
+  {{ UINT64_C(0x971ed4ea4156f5ee), UINT64_C(0xe7a0961c1cabbf64), UINT64_C(0x3c602437c84bed3e)}},
+  {{ UINT64_C(0x521aefb936a5e0ae), UINT64_C(0xe1fc4819fd263871), UINT64_C(0x90e2101bd052196d)}},
+  {{ UINT64_C(0x1b3a1c2c11be743f), UINT64_C(0x0b06ac7be4cc1179), UINT64_C(0xa3f7e4481c3a3b7d)}},
+  {{ UINT64_C(0x5b03d41e363201ad), UINT64_C(0xd555ca50fdd1691f), UINT64_C(0x66fe784463c1b6cd)}},
+  {{ UINT64_C(0x686d07d15a18f31e), UINT64_C(0x691c8c03c223e830), UINT64_C(0x0bb5013903f37e38)}},
+  {{ UINT64_C(0x3772d16a80f95f3d), UINT64_C(0xef55069f2f6311bf), UINT64_C(0x912a20c1158b5093)}},
+  {{ UINT64_C(0x5c3942886c2af3ff), UINT64_C(0x754da4930b7d1d94), UINT64_C(0x066e892e04215d38)}},
+  {{ UINT64_C(0x8820cf1761e4c38e), UINT64_C(0xc6714a471913c885), UINT64_C(0x18ae9ea6aebb5a70)}},
+  {{ UINT64_C(0x68f0854b5f26d78e), UINT64_C(0xb9042ff38cbaf77b), UINT64_C(0xcc5d10383fc06827)}},
+  {{ UINT64_C(0xbaf3543db77f064f), UINT64_C(0x3a0e29d8efa0cb40), UINT64_C(0x270ccdb10a7d03b9)}},
+  {{ UINT64_C(0xb4478208536a2a00), UINT64_C(0xa42e697557d3ef54), UINT64_C(0xc9da801787c51b3c)}},
+};
+
+static const mzd_row192_t Ki_0[] = {
+  {{ UINT64_C(0xc19b180074be7fe7), UINT64_C(0xfc593a4912eb26c4), UINT64_C(0x0a3b9e463673ae9d)}},
+  {{ UINT64_C(0x719870e6e061065c), UINT64_C(0xf3437c88ce2a1cdb), UINT64_C(0x114e315e1397dfdd)}},
+  {{ UINT64_C(0xd3ae43abdf90e16e), UINT64_C(0xbecb7c12dc6cf648), UINT64_C(0x6cf5cb79d6f03d78)}},
+  {{ UINT64_C(0xfc8be03486902d7d), UINT64_C(0x9fab6f19805263af), UINT64_C(0xd0b76410ac550ec0)}},
+  {{ UINT64_C(0xbacf70fc2839d100), UINT64_C(0x9a32c4eec86c7618), UINT64_C(0x3f67266743ca57f2)}},
+  {{ UINT64_C(0xf4d141b56671b664), UINT64_C(0xa65b859f42b815f0), UINT64_C(0x78a07054970efa07)}},
+  {{ UINT64_C(0x4d4b02022b5b195a), UINT64_C(0x0d9cdb518d398065), UINT64_C(0xe485bdd2267c61f4)}},
+  {{ UINT64_C(0x3f021d1e1608143c), UINT64_C(0x17679339094fed09), UINT64_C(0xba837f0eb37951d2)}},
+  {{ UINT64_C(0xec32732aacfebf50), UINT64_C(0x3b545adbea56859f), UINT64_C(0x7514178731c915b3)}},
+  {{ UINT64_C(0x3771b4d5f358e259), UINT64_C(0x3dde1d67deba05a9), UINT64_C(0xcb10d61638352b0f)}},
+  {{ UINT64_C(0xbaaac94fedd5c1b0), UINT64_C(0xafdfdfdb34d068fd), UINT64_C(0x10ff3e28a4d2e297)}},
+  {{ UINT64_C(0xd54dd1f2ee101d5f), UINT64_C(0x2563f71a86a0be61), UINT64_C(0x2e1f5c990017540f)}},
+  {{ UINT64_C(0xa708c4c3086961c8), UINT64_C(0x19f04278b92ca777), UINT64_C(0xb5ee2949d68007f1)}},
+  {{ UINT64_C(0xf715e7e320b89fc0), UINT64_C(0x897a1c8c48bd7cbf), UINT64_C(0xbf93d02111e57f95)}},
+  {{ UINT64_C(0x39fc6834da6641bc), UINT64_C(0x16acf94106b15df7), UINT64_C(0x0f40b62d556d4525)}},
+  {{ UINT64_C(0x73da6728338c8b52), UINT64_C(0x2a12bc0bd372c138), UINT64_C(0xb099e097a4f97d0a)}},
+  {{ UINT64_C(0xec574ea394ce924c), UINT64_C(0xb2368c23869be8fc), UINT64_C(0xa053c5b86721f8de)}},
+  {{ UINT64_C(0xaa355509b48f6774), UINT64_C(0x5fc9c3dae285856b), UINT64_C(0x22005b39a6fd5dc8)}},
+  {{ UINT64_C(0xc800e486aa9fc37e), UINT64_C(0x980003e2ab1bcfdd), UINT64_C(0xca859bc3e37f4787)}},
+  {{ UINT64_C(0xe723cfe4b4f5df47), UINT64_C(0x9f1890fe5f24031a), UINT64_C(0x45d6ced29cf51b55)}},
+  {{ UINT64_C(0xf941adf3bdb82e3e), UINT64_C(0x521557519cf25df0), UINT64_C(0x530163fcb0b96188)}},
+  {{ UINT64_C(0x62488b3540ca2e09), UINT64_C(0x217f0bc5e8db88e6), UINT64_C(0xcd112ba6cb419f31)}},
+  {{ UINT64_C(0x9c20f0ab6fdbf508), UINT64_C(0x1786ef1711a17c04), UINT64_C(0xff9aa68caa02a7c4)}},
+  {{ UINT64_C(0x3c1640f17335dc79), UINT64_C(0x9c5c594afe7691cd), UINT64_C(0x41035d1cc86c6d6e)}},
+  {{ UINT64_C(0x2ed2a723646d920a), UINT64_C(0x4e5fcaab0cb19309), UINT64_C(0x31d82140518ccaa6)}},
+  {{ UINT64_C(0x5287173bc6fd71da), UINT64_C(0x017e4c33b99e3cb4), UINT64_C(0x97e3bf04af047279)}},
+  {{ UINT64_C(0xef7bb139c62f7ab3), UINT64_C(0x5c67e5e4234049f4), UINT64_C(0x234d4462bc568c7b)}},
+  {{ UINT64_C(0xeeec838feaa1abc9), UINT64_C(0x7b35c1d2c62a8cd9), UINT64_C(0x70bcf8261543d77f)}},
+  {{ UINT64_C(0x05f7465e55175459), UINT64_C(0xaba7c45d7b8e6207), UINT64_C(0x06be60cd30b7e38c)}},
+  {{ UINT64_C(0x82b84bc49107b6fb), UINT64_C(0x48f4118e6bba630d), UINT64_C(0xdcd6b5cfb8d16570)}},
+  {{ UINT64_C(0xc29d111d94de1778), UINT64_C(0xbeb787993cab9012), UINT64_C(0x045d329cdb567b3f)}},
+  {{ UINT64_C(0x2c3b97b980c6fa72), UINT64_C(0x4409c86003349bc1), UINT64_C(0x1440899757c6ef36)}},
+  {{ UINT64_C(0xf99eec8c2319db54), UINT64_C(0x6af44d36ac30c2f1), UINT64_C(0x2834cc64bbcb9a11)}},
+  {{ UINT64_C(0x720ba7dabe2aee52), UINT64_C(0x1ce87d2d24a10c45), UINT64_C(0x5a19a041272a0fb1)}},
+  {{ UINT64_C(0xe6d2dccdd5d5a0e6), UINT64_C(0xd7b3fe0bcd9ed267), UINT64_C(0xb992564bb46505c6)}},
+  {{ UINT64_C(0xd48677ae2653a572), UINT64_C(0x6c0e8ae6c8b24b57), UINT64_C(0xd7e7473fd186696e)}},
+  {{ UINT64_C(0x8c72d0465c11dfa5), UINT64_C(0x29dc4b6d3019b7b8), UINT64_C(0xf2e6145564a2a557)}},
+  {{ UINT64_C(0xe9a364eef9ca2843), UINT64_C(0xd2a467ea5e1f87ff), UINT64_C(0xc3a497b8348404cd)}},
+  {{ UINT64_C(0xfd841103fd1a4699), UINT64_C(0xd449c41f6fb0dd4e), UINT64_C(0x0f7dcc8c4aac8b14)}},
+  {{ UINT64_C(0xf0185e70720af39b), UINT64_C(0xc98ad77018b48bdc), UINT64_C(0xc4638385b58452ca)}},
+  {{ UINT64_C(0x9f5b09cc04824cce), UINT64_C(0xad10b0ed73cd92e4), UINT64_C(0x4a9c67d449aa8612)}},
+  {{ UINT64_C(0x51be2aff78bfdc0e), UINT64_C(0x07881d9b2ca35c89), UINT64_C(0x0f5ae6e13ad94d6c)}},
+  {{ UINT64_C(0xe09ec263f64f3772), UINT64_C(0x02839871e2691b1c), UINT64_C(0xd77739aa95ecbd73)}},
+  {{ UINT64_C(0x101851945bd9ac00), UINT64_C(0x19a46b672d06c2c7), UINT64_C(0xb576fcbf7f3cc53a)}},
+  {{ UINT64_C(0x9e35f6c44735446f), UINT64_C(0x066982232900db07), UINT64_C(0x81370a3a73c5f856)}},
+  {{ UINT64_C(0xfbf9c575e952df1c), UINT64_C(0xc434f272320f23db), UINT64_C(0xcb2cc2f935b271df)}},
+  {{ UINT64_C(0x5171bcf0be8d6ebd), UINT64_C(0x431cf33c5f182c47), UINT64_C(0x6809c070f5e3344b)}},
+  {{ UINT64_C(0x3e0be4d76c863f86), UINT64_C(0x353e99ae5efeafe6), UINT64_C(0x250408e53ee0d15d)}},
+  {{ UINT64_C(0x1358918935f7fe55), UINT64_C(0x8bcad9bf68a79d92), UINT64_C(0xb58ffb8048d3ed23)}},
+  {{ UINT64_C(0x526bc9bee79042e9), UINT64_C(0x1847334891cbfdf7), UINT64_C(0x0fd459e69fd9664f)}},
+  {{ UINT64_C(0x7e54308c6ce6fcf5), UINT64_C(0xfe50448d1f5acab9), UINT64_C(0xff9eef6079711bec)}},
+  {{ UINT64_C(0xcf9437f9fa98fb04), UINT64_C(0x1060ef3c90e3d3d1), UINT64_C(0x98fd76655f293e78)}},
+  {{ UINT64_C(0x9b3b67bcfc11c4ce), UINT64_C(0xa7851cb7efd52fe2), UINT64_C(0x6f277ec9495ccbe2)}},
+  {{ UINT64_C(0x970590183e862d6b), UINT64_C(0xb4efc41eb634f64b), UINT64_C(0xab8a3b2f0c35fa67)}},
+  {{ UINT64_C(0xa8f1c12afe64a90e), UINT64_C(0x625a29b9d044547c), UINT64_C(0xcdb33d61a5b4a655)}},
+  {{ UINT64_C(0x4c7bc460334860cc), UINT64_C(0x0a46f199322a1911), UINT64_C(0x69a5786a2b34f5bb)}},
+  {{ UINT64_C(0x4ef4ada1d916b61b), UINT64_C(0xd98dc2d5259136b0), UINT64_C(0x70851de656cc941c)}},
+  {{ UINT64_C(0x5bd09f0dd7a7768b), UINT64_C(0x9fad315d98cbf1c4), UINT64_C(0x6ad08c70da6f16a8)}},
+  {{ UINT64_C(0xa2d9019f3abe0935), UINT64_C(0xc9915c8e82e0ff3a), UINT64_C(0x7b059195599c4863)}},
+  {{ UINT64_C(0xefa01d3ccc07d1ca), UINT64_C(0x89d2093a40edfd38), UINT64_C(0x7db6fc5d4bc56301)}},
+  {{ UINT64_C(0xdaa2efec630afb79), UINT64_C(0x87b6977bc35774f5), UINT64_C(0xfbbf8c8028939696)}},
+  {{ UINT64_C(0xdfdb0bbfeadd87c7), UINT64_C(0xab0e2c153e12d5e7), UINT64_C(0x2941a675e1546339)}},
+  {{ UINT64_C(0x13ff2cec7b2ca7e7), UINT64_C(0x95228ddcfab57566), UINT64_C(0xf2d6f66eb7c0b334)}},
+  {{ UINT64_C(0x72e2c571f2d302f3), UINT64_C(0x7ac006554f20cefc), UINT64_C(0x66565594ccbd05a0)}},
+  {{ UINT64_C(0xfc9f982369f7c1ee), UINT64_C(0x646c0a1b70361c20), UINT64_C(0x15afb42be5987e76)}},
+  {{ UINT64_C(0xf99b2a29ea7cd7f4), UINT64_C(0x2c86e33631717e0d), UINT64_C(0x4d8c7e072a8f1bd3)}},
+  {{ UINT64_C(0x28a6bfafc586d845), UINT64_C(0x2d3dcfbd3f6239d4), UINT64_C(0x05e2f5b555417718)}},
+  {{ UINT64_C(0xb125852fd51d4b6f), UINT64_C(0x20b090733c647303), UINT64_C(0x833d2dddb71b8664)}},
+  {{ UINT64_C(0x62fab6eddef8771e), UINT64_C(0x701c7a1366fa5673), UINT64_C(0x2392d7e925083745)}},
+  {{ UINT64_C(0x758a61c269e1c6a4), UINT64_C(0x6a2e1296d102dc7d), UINT64_C(0x0a8f79783c0cd768)}},
+  {{ UINT64_C(0x7bd39d080063876f), UINT64_C(0x29a663241fe7f5d6), UINT64_C(0x8aa2dff27d41b49d)}},
+  {{ UINT64_C(0x9ce640a778bd64ce), UINT64_C(0x1ecee71ddc8b5592), UINT64_C(0xde832e327e253aae)}},
+  {{ UINT64_C(0xae906171f479ed14), UINT64_C(0x849134a0c707ed6e), UINT64_C(0x4f779030f8a9f0e6)}},
+  {{ UINT64_C(0xf187e5436ae83124), UINT64_C(0x38c1e107ff9df573), UINT64_C(0x80586f4b2c155b8d)}},
+  {{ UINT64_C(0x9e44df251ae3ac3d), UINT64_C(0x2f0547450f2c4032), UINT64_C(0x71cc05b1f71ec0bf)}},
+  {{ UINT64_C(0xe9f9f092014a5936), UINT64_C(0xa767de8bec8ca4d0), UINT64_C(0x5acebd418af27bf2)}},
+  {{ UINT64_C(0x2f2f27b870388aae), UINT64_C(0x334f81d4f809469f), UINT64_C(0x89af6b152082a706)}},
+  {{ UINT64_C(0xe29415c84e85e1a8), UINT64_C(0x317ef5c405c69dcc), UINT64_C(0x15191e5ccb5a9f60)}},
+  {{ UINT64_C(0x453a244706ebb4f3), UINT64_C(0xe380bc32d7fe3a37), UINT64_C(0xe14dc1fbf2e7b6b6)}},
+  {{ UINT64_C(0xa099b478761d0357), UINT64_C(0x4008509af9fc553b), UINT64_C(0x76e01ee99307a079)}},
+  {{ UINT64_C(0x3da8aa0759d6f492), UINT64_C(0x5fbdd7b2c62e5be3), UINT64_C(0xc77bb6f3d6a3eee9)}},
+  {{ UINT64_C(0xe58759bb0dd01848), UINT64_C(0xa1f92ec91d5d80ad), UINT64_C(0x8848e8e8b5b44fb3)}},
+  {{ UINT64_C(0xe30939c160700348), UINT64_C(0x10d3fff141a3eeab), UINT64_C(0x3e00026af2892645)}},
+  {{ UINT64_C(0x32340f65dbc6e695), UINT64_C(0x98a871a053190805), UINT64_C(0x596fbd67bdc2f532)}},
+  {{ UINT64_C(0x0d4b713aede38464), UINT64_C(0xd6fb203f89cc81c5), UINT64_C(0x71d37cde603907af)}},
+  {{ UINT64_C(0xd75ea053f25fe8d5), UINT64_C(0xd30ca8e6babebde0), UINT64_C(0x226e0021779ba5d9)}},
+  {{ UINT64_C(0xfe72815b10307a06), UINT64_C(0x9e52bc36c04e7306), UINT64_C(0x71e544bb13d872e3)}},
+  {{ UINT64_C(0xb49afda842b806fa), UINT64_C(0x8cecb7daaf5e9078), UINT64_C(0xbd20ce201c8e995a)}},
+  {{ UINT64_C(0x26cf23a3cc7255d1), UINT64_C(0x9de3c4d83a5c2ed1), UINT64_C(0x9895e14df22b0304)}},
+  {{ UINT64_C(0x93f0d8c0c236ae1a), UINT64_C(0xc4fbec8c513763c7), UINT64_C(0x3e860a3170288e80)}},
+  {{ UINT64_C(0x71cda1a65e2686fe), UINT64_C(0x1db752355eecc5d5), UINT64_C(0x37589c369c4d7dc9)}},
+  {{ UINT64_C(0x8989be65a3da4f24), UINT64_C(0x8879febe77a10de4), UINT64_C(0xfbc889d17567d18b)}},
+  {{ UINT64_C(0x0e817f3149ba9e0a), UINT64_C(0x9f009ebd9bf57e9d), UINT64_C(0xfb255e5e47f25026)}},
+  {{ UINT64_C(0x337e691566b78ffc), UINT64_C(0xfb534c8abba9d245), UINT64_C(0xc7e5b08abded92b8)}},
+  {{ UINT64_C(0x635e1c2a264cc49d), UINT64_C(0xd82cb6da04e20045), UINT64_C(0xb6f11a510f4c3291)}},
+  {{ UINT64_C(0x76dfd34f7c0a17e2), UINT64_C(0x9c12790d32695899), UINT64_C(0xc37921ab3b047576)}},
+  {{ UINT64_C(0x4e7d14c057624a82), UINT64_C(0x0734f512d4a847a8), UINT64_C(0xd51ba1eb63648157)}},
+  {{ UINT64_C(0xb190627ad8b60562), UINT64_C(0xec6142b85f56e4da), UINT64_C(0x62d6a5c56bf00037)}},
+  {{ UINT64_C(0x16f615b14ccc5605), UINT64_C(0x039969952bd1145f), UINT64_C(0xa961352d74e35f5d)}},
+  {{ UINT64_C(0xc078d7414a796317), UINT64_C(0x473e78d01a5a5430), UINT64_C(0x15aa1c142e44695a)}},
+  {{ UINT64_C(0xf66bbb74c53bcb73), UINT64_C(0xbf625e19ebf1aaa1), UINT64_C(0x7f35f29ed9ed98bc)}},
+  {{ UINT64_C(0xbf88dc395880542b), UINT64_C(0xe628095c3f781b5e), UINT64_C(0x210535f7d0d486f9)}},
+  {{ UINT64_C(0x25e57d48e87be6d8), UINT64_C(0xbc044b7a34134b55), UINT64_C(0x986c2a2b85ea31b9)}},
+  {{ UINT64_C(0xe5313c7b63cd349a), UINT64_C(0x454452ac2c8ab0cc), UINT64_C(0x3a5d5721a24f68bc)}},
+  {{ UINT64_C(0xb9a5f4107a895055), UINT64_C(0x582e58ae5beb989f), UINT64_C(0x2c72bd12f22f29f0)}},
+  {{ UINT64_C(0xec367ec9d6695eec), UINT64_C(0xa3cd554dba84dd03), UINT64_C(0xc7069e4477ead237)}},
+  {{ UINT64_C(0x6585bbe6534464b8), UINT64_C(0x89cf94c4db646889), UINT64_C(0x2d93f64dedd614e0)}},
+  {{ UINT64_C(0x4bab52b18b6d4a6a), UINT64_C(0x6a27acf04bcda1fb), UINT64_C(0xc24243ece8b12f8f)}},
+  {{ UINT64_C(0xb0c9f5abcdc38639), UINT64_C(0x51435f232144af6e), UINT64_C(0x1aba54b1bd198890)}},
+  {{ UINT64_C(0x9fcd997462a7786f), UINT64_C(0x78d65c62f772c596), UINT64_C(0x180bd6cdf589d2af)}},
+  {{ UINT64_C(0xc41d11abce023b10), UINT64_C(0x8364034b518221db), UINT64_C(0x7d0786c9f2b99dca)}},
+  {{ UINT64_C(0x06fb81aca3a8b468), UINT64_C(0x0bda4c927ee0874a), UINT64_C(0x514fc0ad7ea23b80)}},
+  {{ UINT64_C(0x4d1f7d21552c30b4), UINT64_C(0xe78f9ff75f680172), UINT64_C(0x2a3c1ae3ee757d5d)}},
+  {{ UINT64_C(0x05cc61149b1bb57f), UINT64_C(0x6de65634e2d793a4), UINT64_C(0x0e099d9b20521f37)}},
+  {{ UINT64_C(0x4c7ed3e84c6b9c7b), UINT64_C(0xe1afc669792b651f), UINT64_C(0xab8372b03889bdaf)}},
+  {{ UINT64_C(0x77d57c6b7f19ae39), UINT64_C(0x57d018994ba35b44), UINT64_C(0x8cbbb3830fdbe6af)}},
+  {{ UINT64_C(0x87b1d9646fa7d33e), UINT64_C(0x30971b9ef1505b6b), UINT64_C(0x2f5b5b9d2ba36921)}},
+  {{ UINT64_C(0xf2a743284fadfe36), UINT64_C(0x231bed5c435408bf), UINT64_C(0x348513617e30f8dc)}},
+  {{ UINT64_C(0x054967c02cbc9df2), UINT64_C(0x7a7071f1eb9f0b97), UINT64_C(0x338f2ff8dbaa31b8)}},
+  {{ UINT64_C(0x06d8ec6534da324d), UINT64_C(0xb93cd7d4e61c43d0), UINT64_C(0x0de2595b521be05f)}},
+  {{ UINT64_C(0x78d100faa606d9ab), UINT64_C(0xaa5d4ebd227f2346), UINT64_C(0xf197f14e985f5101)}},
+  {{ UINT64_C(0xd024152788dd7cbd), UINT64_C(0x1636d94f647bfc79), UINT64_C(0x5a6a610304bdf0f4)}},
+  {{ UINT64_C(0x1d740fd365995923), UINT64_C(0xf45d004b4c592abb), UINT64_C(0x6048a9bc88440d48)}},
+  {{ UINT64_C(0xbfbb40eeeb77c455), UINT64_C(0xd8e22998d1df02fc), UINT64_C(0x26808c44d8371441)}},
+  {{ UINT64_C(0x8bd214f345399e4f), UINT64_C(0x617ea0b2ccedaf30), UINT64_C(0x2d9ad1929acc019f)}},
+  {{ UINT64_C(0x64361aa5f06be591), UINT64_C(0x846720adf6860faa), UINT64_C(0x09ff0b476e27a6c8)}},
+  {{ UINT64_C(0x2d2e5f70f7c48604), UINT64_C(0xbbeb55d2c875c612), UINT64_C(0xcfdfaeb3789b710d)}},
+  {{ UINT64_C(0x0b766c5c0cfcb25a), UINT64_C(0x61abdf28fcfe5e8f), UINT64_C(0x4d97aab7415c054c)}},
+  {{ UINT64_C(0x20abb4d027f78d8c), UINT64_C(0x9ef71b70c8a35640), UINT64_C(0x313d9d1e297700b9)}},
+  {{ UINT64_C(0xea8671c801c53c21), UINT64_C(0x5d33b221be591bd0), UINT64_C(0x9c550c86198496be)}},
+  {{ UINT64_C(0xb6cecb8fc36da665), UINT64_C(0x6065adbd5c7cd047), UINT64_C(0x3ae807eb5650401b)}},
+  {{ UINT64_C(0x239b6411cf0d7757), UINT64_C(0x18c7dd7ec93bdce4), UINT64_C(0x86e305735f513f96)}},
+  {{ UINT64_C(0x73dadd64a6d58e18), UINT64_C(0xeb4c0460b3ec8cb7), UINT64_C(0x50c175022775c384)}},
+  {{ UINT64_C(0xbd886521fed80e0f), UINT64_C(0xb63448234b8cf97b), UINT64_C(0xbd1964e21ff32d90)}},
+  {{ UINT64_C(0xce4523d01f3e696c), UINT64_C(0x5ba133093a8c693c), UINT64_C(0xf964bef99dc1d7b8)}},
+  {{ UINT64_C(0xc9c1bae83a5cf1f1), UINT64_C(0x913760b7050fd55e), UINT64_C(0x96d20b0c95abd83d)}},
+  {{ UINT64_C(0xd2fc413523caa10a), UINT64_C(0x539f594a73c06114), UINT64_C(0xdc787e53bd76d61f)}},
+  {{ UINT64_C(0x4996804eeb9a3c95), UINT64_C(0x5c30196898cbb6e7), UINT64_C(0xcdf2fb8e1bdac98e)}},
+  {{ UINT64_C(0xd81b96b80f02cd65), UINT64_C(0xd36422f65a2e6af9), UINT64_C(0xb313d4b2af1c673d)}},
+  {{ UINT64_C(0x23850c9a768c42db), UINT64_C(0x17bbeebaa6762d19), UINT64_C(0x777f82f1dc9f342d)}},
+  {{ UINT64_C(0xbc899918b996e87b), UINT64_C(0x3a88781948a88744), UINT64_C(0xf49dd4625bcd949c)}},
+  {{ UINT64_C(0x21e6c497d5f57e75), UINT64_C(0x61e318feb880919c), UINT64_C(0x7ca0ed95ff399719)}},
+  {{ UINT64_C(0xeac3692bf7c00ae3), UINT64_C(0xe09f89964bfacb8e), UINT64_C(0xfc63e8cbbcd1b128)}},
+  {{ UINT64_C(0x3bc15a5f783e406c), UINT64_C(0x93e364407e0e5bd2), UINT64_C(0x1c9d0199437b8e64)}},
+  {{ UINT64_C(0x727fb114a2ae1ba5), UINT64_C(0x439533f2c6909fee), UINT64_C(0x16db4eac3a848a89)}},
+  {{ UINT64_C(0xc7cbba7e0663955f), UINT64_C(0x48e05ba4ff3635d9), UINT64_C(0x6b05f496a956fc5e)}},
+  {{ UINT64_C(0xb4f0062287095460), UINT64_C(0x8dc3bcabe0edbdd3), UINT64_C(0x674d3f9b96e6ef4d)}},
+  {{ UINT64_C(0x49a8a9e117e266ac), UINT64_C(0xa41678b009aea7e1), UINT64_C(0x080bd74384a6d141)}},
+  {{ UINT64_C(0xaed43ee21dd446fe), UINT64_C(0x00a5135e850c0459), UINT64_C(0x45eb421b35ae25d0)}},
+  {{ UINT64_C(0x8e81acb53c85f762), UINT64_C(0x2c403c138ed03348), UINT64_C(0xcc1d6735e2fbb1e8)}},
+  {{ UINT64_C(0x99cc07f70d614c03), UINT64_C(0x84faab4a91b203aa), UINT64_C(0x1f421ed8c91d13ef)}},
+  {{ UINT64_C(0xef2be4540a9ccbcd), UINT64_C(0x3361ef795dcc4913), UINT64_C(0x888f01c6133661cb)}},
+  {{ UINT64_C(0x6cad996ce26bbe7e), UINT64_C(0x65598ff026d20120), UINT64_C(0x5b1e6f96322cf9f2)}},
+  {{ UINT64_C(0xc92a6da9473b55d6), UINT64_C(0xdef57322097c563a), UINT64_C(0xb561328f46251bd2)}},
+  {{ UINT64_C(0x0922e77de2f87ef7), UINT64_C(0xc51c416953413a83), UINT64_C(0x0e2db8e0d6fadf53)}},
+  {{ UINT64_C(0xb8714c99b0025d33), UINT64_C(0x15ac1e20c4d9342f), UINT64_C(0xcd6d35e3835b3aa0)}},
+  {{ UINT64_C(0x3d88a437d633b2ea), UINT64_C(0x97f0987f6f738a0f), UINT64_C(0x03c72ffb05c192eb)}},
+  {{ UINT64_C(0xd357a164b5470ef7), UINT64_C(0xad7ebdb8a4aea215), UINT64_C(0xebc01a1a7a8ad814)}},
+  {{ UINT64_C(0x429fcd19e124eb05), UINT64_C(0xceec2d82c3a7ef41), UINT64_C(0x1ce70351650be844)}},
+  {{ UINT64_C(0x4a654b72d1782ec5), UINT64_C(0x93ae668203386937), UINT64_C(0x59a68cb1bff40b58)}},
+  {{ UINT64_C(0xaa8249aa983f4c88), UINT64_C(0x9bd48b2f1bd36a15), UINT64_C(0xc9c1cf956852b3f3)}},
+  {{ UINT64_C(0xeba4de3be69cefe4), UINT64_C(0x2c994165a74433b5), UINT64_C(0x56070082a5207181)}},
+  {{ UINT64_C(0x93c96c0e2bac0ad8), UINT64_C(0xf765c46c76c62fe1), UINT64_C(0xc71757e6d1b51ac8)}},
+  {{ UINT64_C(0x8f93044824834789), UINT64_C(0x7b818759b3d399a1), UINT64_C(0xfa0c436fa05bd9b5)}},
+  {{ UINT64_C(0x0da628f0ff86120d), UINT64_C(0x214ab9757f601f8a), UINT64_C(0xc268d50e7474d83e)}},
+  {{ UINT64_C(0x36d214f9834cba62), UINT64_C(0x0149f395f2051c9a), UINT64_C(0x2fc8b26f09375cfc)}},
+  {{ UINT64_C(0x5bad959fc1295702), UINT64_C(0xc09acbfe57f5248a), UINT64_C(0x8814a57690297f80)}},
+  {{ UINT64_C(0xea44ac37d0e0cadd), UINT64_C(0x664514a39e7f2112), UINT64_C(0x20d3e7c67639b87f)}},
+  {{ UINT64_C(0xd5ff409de14fe37e), UINT64_C(0x6fa28f59ab09981d), UINT64_C(0xd2a3ac84e3197098)}},
+  {{ UINT64_C(0x58a9c4fcc81adf0b), UINT64_C(0x40d1f531b91a84e3), UINT64_C(0xba571694f59108e9)}},
+  {{ UINT64_C(0x26695259bdd4b0b7), UINT64_C(0x4010655aa16c9976), UINT64_C(0x8fdf12f610fc9caf)}},
+  {{ UINT64_C(0xef66eb316faa3f34), UINT64_C(0xfd3ef780c1d043c0), UINT64_C(0xf43cc7cb94a2df2d)}},
+  {{ UINT64_C(0xd2ff36e13d9da330), UINT64_C(0x4121314035d27ac3), UINT64_C(0x4d92884212676a5d)}},
+  {{ UINT64_C(0x13509b9a5796aadf), UINT64_C(0x5eedac3ae63c5c37), UINT64_C(0xb0cc20dd3559b55b)}},
+  {{ UINT64_C(0xf6957ba43657409c), UINT64_C(0x73db9a24e81ff07d), UINT64_C(0xd35fe92adff37d43)}},
+  {{ UINT64_C(0xd14a435c557719bb), UINT64_C(0xdba115c6a71216c8), UINT64_C(0x337075652a74d098)}},
+  {{ UINT64_C(0xcd5aa7739a923857), UINT64_C(0xa27c56c0ad8fbc05), UINT64_C(0x7483b1c671f5b1ca)}},
+  {{ UINT64_C(0x60b2550f8fe9b5bd), UINT64_C(0x40a7b65059718b07), UINT64_C(0xfe83a52c58112797)}},
+  {{ UINT64_C(0xbef34cae009b6bc1), UINT64_C(0x3d6e18fced1c3c78), UINT64_C(0x872b32165654e8ad)}},
+  {{ UINT64_C(0x6de93023e687d9b8), UINT64_C(0x33e135617ab9afbe), UINT64_C(0xb43592bb4eb76353)}},
+  {{ UINT64_C(0x11bd328a58b99398), UINT64_C(0x3c31d7c5e25b8762), UINT64_C(0xe35d46f6d498b928)}},
+  {{ UINT64_C(0xa46e4037888582ed), UINT64_C(0x77d7673fa7630832), UINT64_C(0x0aba798ddb426471)}},
+  {{ UINT64_C(0x3743509ea6b5c2df), UINT64_C(0xf25da38bcc22c089), UINT64_C(0x7bd2cd3ac19f782a)}},
+  {{ UINT64_C(0xc4ac9db37d8f14ce), UINT64_C(0xc1e9861131de5548), UINT64_C(0x65666d4d5341e5ee)}},
+  {{ UINT64_C(0x368110aa8fd578c6), UINT64_C(0xbf49cb485302e858), UINT64_C(0x836d515e902cb2b2)}},
+  {{ UINT64_C(0x4f91f695b147c8b8), UINT64_C(0x81aee2dc0089f4cc), UINT64_C(0x08ca238ac4bdf311)}},
+  {{ UINT64_C(0x4edede724c4737ae), UINT64_C(0x88593353b8ed5012), UINT64_C(0x5c257c847a98e2a0)}},
+  {{ UINT64_C(0xe3d4a2d46a2a20e3), UINT64_C(0x3127ea0e2950633e), UINT64_C(0x5d3b5625a0b8fe9e)}},
+  {{ UINT64_C(0x8f19654f33831118), UINT64_C(0x2118c0d10c4e5cd4), UINT64_C(0x9c47b22fc23d100a)}},
+  {{ UINT64_C(0x9b8abff29195ee32), UINT64_C(0x1b9df9cc1d1635b5), UINT64_C(0xacb2468080a4a15d)}},
+  {{ UINT64_C(0xc8264a8a139973c0), UINT64_C(0x2efb69f222b4ef06), UINT64_C(0x0a3ca49d504a8659)}},
+  {{ UINT64_C(0x1a2bb57b7f65e167), UINT64_C(0x2c823f5bcc430a98), UINT64_C(0x2bec4464f0224870)}},
+};
+
+/* K_0 | K_1 | ... | K_4, five packed rows per row */
+#if !defined(LOWMC_INTERLEAVED_LK)
+static const mzd_row192_t KS[] = {
+  {{ UINT64_C(0x9299b87cf67f4bc9), UINT64_C(0xec868d3b13a76cf8), UINT64_C(0xf80aee410c17428b)}},
+  {{ UINT64_C(0x9ae5e69ec165545a), UINT64_C(0x3ca38530bc80d381), UINT64_C(0xa4d4fc7eab33fe64)}},
+  {{ UINT64_C(0x8739d65b6b977e02), UINT64_C(0xde394bac13c9eaa9), UINT64_C(0x53fee3d81b3a0934)}},
+  {{ UINT64_C(0x49e6c95432a54cb1), UINT64_C(0xf0e42955a98079c8), UINT64_C(0x7d088d3010d25970)}},
+  {{ UINT64_C(0x3df93eb8b10598bb), UINT64_C(0x8d1d46ac008e0a02), UINT64_C(0x53a38800439f170d)}},
+  {{ UINT64_C(0x87eecf7cb82d2b94), UINT64_C(0x45dccc2ed78b77d6), UINT64_C(0x37fef022879b006e)}},
+  {{ UINT64_C(0x88c9cf6f76c21218), UINT64_C(0x1a6c5d1d198bbabb), UINT64_C(0x5a7ef99c31ad935a)}},
+  {{ UINT64_C(0x584848fee002bc02), UINT64_C(0x8428de93c94367a4), UINT64_C(0x26a69b85918178dd)}},
+  {{ UINT64_C(0xf9013be08477e9b1), UINT64_C(0xf0ffd4d2ed25cac5), UINT64_C(0xb97323c243fe64ce)}},
+  {{ UINT64_C(0x10dd6fe9ccdd2e3d), UINT64_C(0x70a99e9b8fdafb69), UINT64_C(0xd301d0d4a554ed06)}},
+  {{ UINT64_C(0xafeacc3e531c679b), UINT64_C(0x7f39137662f9ece1), UINT64_C(0x57ec5b0217802f4b)}},
+  {{ UINT64_C(0xc9d8619d8afc9b03), UINT64_C(0x62e3ff8a30fd63b6), UINT64_C(0x737ad5460073eae2)}},
+  {{ UINT64_C(0xa43131dfce44dad4), UINT64_C(0x938b3f6c41558468), UINT64_C(0x0a3a757e3180d18b)}},
+  {{ UINT64_C(0x6aade7a589ea5e21), UINT64_C(0x736b973cb48bf42c), UINT64_C(0xc43c0acefad7bbbb)}},
+  {{ UINT64_C(0xce56786ceb85c3ec), UINT64_C(0xb61242b38ff03bed), UINT64_C(0x92f8201f7e27a224)}},
+  {{ UINT64_C(0x2b90158572e5967a), UINT64_C(0x14c39fa15cde164c), UINT64_C(0x4c1206440a2163ef)}},
+  {{ UINT64_C(0x12dbc0de7665f72e), UINT64_C(0xf5b84c4ed665cd5f), UINT64_C(0x4a100a9bd3b7149d)}},
+  {{ UINT64_C(0x9eed9189ab8a0943), UINT64_C(0xc8d0d7a96316d7cd), UINT64_C(0xe2fcb450d9278207)}},
+  {{ UINT64_C(0x5bd92751f0fbe443), UINT64_C(0x8a707bce9f5713cd), UINT64_C(0x477c60fdb0509898)}},
+  {{ UINT64_C(0xf6b1f0f68c98a9b2), UINT64_C(0xfea8e0d88f3b641e), UINT64_C(0xadbcacbf6804c049)}},
+  {{ UINT64_C(0x8f311a1a2dbbd091), UINT64_C(0xa8eda1540d2742f5), UINT64_C(0x5322c2e387e70106)}},
+  {{ UINT64_C(0x55c467cda0bc9a76), UINT64_C(0xb8dd9de6787dca92), UINT64_C(0xdff4a2228638eba2)}},
+  {{ UINT64_C(0x5c720f3e0c024876), UINT64_C(0x8a018544b4706fbe), UINT64_C(0xc835a56a14875fdf)}},
+  {{ UINT64_C(0x1ba92519452e5abb), UINT64_C(0xed146217c650f312), UINT64_C(0x8981bdd2b47150dd)}},
+  {{ UINT64_C(0x31dcc287aa17628d), UINT64_C(0x11f1dcd78ca4d04f), UINT64_C(0x5e9a08bc88292046)}},
+  {{ UINT64_C(0x2f34da5afa9ef2c1), UINT64_C(0xd4e6413d6a427510), UINT64_C(0x51205b690f008ad6)}},
+  {{ UINT64_C(0x1297a6be0a59aa6b), UINT64_C(0xfcf36ca4474c54cf), UINT64_C(0xf607b60ccaa3874a)}},
+  {{ UINT64_C(0xe25215963ec1219c), UINT64_C(0xcb9d4aa72b400f4c), UINT64_C(0x35e24c1f00f8f7ec)}},
+  {{ UINT64_C(0x71f66673f59aa493), UINT64_C(0x8689b5a5ffe8ca20), UINT64_C(0x6c41bf530c4ba6c3)}},
+  {{ UINT64_C(0x048ec833ba07bd9e), UINT64_C(0xf94684cdb896b2df), UINT64_C(0xeaa10f4168bbe472)}},
+  {{ UINT64_C(0xe204c2102e651369), UINT64_C(0x5cdb4f57fa93732a), UINT64_C(0x7731c683590b476d)}},
+  {{ UINT64_C(0x4e26ec01edb61c5e), UINT64_C(0xcc02e1e572863c23), UINT64_C(0x1dd9f7782a1af251)}},
+  {{ UINT64_C(0x9071433ac0551e3f), UINT64_C(0x6ba1f6c3b626ca33), UINT64_C(0xf120fb7de11289df)}},
+  {{ UINT64_C(0x58fca072beed0fa6), UINT64_C(0xa1aac8b2f632650c), UINT64_C(0x31939679cbc35e90)}},
+  {{ UINT64_C(0x7d4ac8056109df92), UINT64_C(0xeff33f5384f3e81e), UINT64_C(0x5adc1ac38c5628bb)}},
+  {{ UINT64_C(0x26c76fc79940f2be), UINT64_C(0xa681e508c56fb812), UINT64_C(0xd164306bb784b593)}},
+  {{ UINT64_C(0xca18c46766b02aa4), UINT64_C(0xf310106b07978c72), UINT64_C(0x916e806c21a8a910)}},
+  {{ UINT64_C(0xc992f31cb9f45b5a), UINT64_C(0xfbdb4c23cc7c0a14), UINT64_C(0x3f8dd1e26d8a5774)}},
+  {{ UINT64_C(0x61a06b12ba23dda3), UINT64_C(0xe28a19fc629a243f), UINT64_C(0x42346ab34782e6da)}},
+  {{ UINT64_C(0x8a8468023e509edf), UINT64_C(0x422b772fd17e98aa), UINT64_C(0x6e8dab2cdf19c18d)}},
+  {{ UINT64_C(0xd4037d269ccbe69d), UINT64_C(0x1ed16f9af22463a6), UINT64_C(0x153fc04671ed6dfc)}},
+  {{ UINT64_C(0xf97d673ad0b64330), UINT64_C(0xbf156b267a99da80), UINT64_C(0x6a82b650059849cc)}},
+  {{ UINT64_C(0x5ec3400bcab26eaa), UINT64_C(0x9e5d9da7d344b62b), UINT64_C(0x6fba1f21d7fd73de)}},
+  {{ UINT64_C(0xf61b7bd2384e2085), UINT64_C(0xcbfad26d4ccb5082), UINT64_C(0x78aa63d630969990)}},
+  {{ UINT64_C(0x574f6d143edec6b9), UINT64_C(0x16f37d9a606867db), UINT64_C(0x3bcd0c9cf1349900)}},
+  {{ UINT64_C(0x5507bb929681f721), UINT64_C(0x4ce9688d3f355e78), UINT64_C(0x97985cf46bb81aee)}},
+  {{ UINT64_C(0x72015ee107be9fd4), UINT64_C(0x818ae137f553de73), UINT64_C(0xe692bedd876d7922)}},
+  {{ UINT64_C(0xf089c18aaa841693), UINT64_C(0x3c0e7d8886ccd7ab), UINT64_C(0x39b2ec874081ffb3)}},
+  {{ UINT64_C(0x15f9f2a4e2279d6a), UINT64_C(0x8ac4457f65a7ccde), UINT64_C(0x8f90a3b3b951d3c1)}},
+  {{ UINT64_C(0x68e223dc04ba513f), UINT64_C(0xdcfd18e009019dad), UINT64_C(0x774f3eab01ad174f)}},
+  {{ UINT64_C(0x3fd93dea01a5796a), UINT64_C(0x1a142ded7a40deb4), UINT64_C(0xb869e6d742673873)}},
+  {{ UINT64_C(0x3c3ffddfc5700456), UINT64_C(0x858ea548a1acd1a5), UINT64_C(0x60d719045b54affc)}},
+  {{ UINT64_C(0x960ac8d24642b9b4), UINT64_C(0x8c9d7ac6c9209540), UINT64_C(0xdac5def9c5f8cac6)}},
+  {{ UINT64_C(0xe3bb2ead52b2946d), UINT64_C(0x9141d2720cb1a05e), UINT64_C(0x3125b13c867f4ac5)}},
+  {{ UINT64_C(0x55f7395e634c4c53), UINT64_C(0xe1373e5893494833), UINT64_C(0x771725b843a73e54)}},
+  {{ UINT64_C(0xa83c419cb7966b58), UINT64_C(0xaae090cbba6da89e), UINT64_C(0x2133025257579e37)}},
+  {{ UINT64_C(0x90ada813a5bc5daf), UINT64_C(0xbaf821105d8dd72a), UINT64_C(0x4f90fa9cfdef8c71)}},
+  {{ UINT64_C(0xbb343d1228aaea4c), UINT64_C(0x2631164e147343a9), UINT64_C(0x655d34e8f3cd6c93)}},
+  {{ UINT64_C(0x5d61b5eac8fc94a0), UINT64_C(0x42d099ae8030209c), UINT64_C(0x6966a666677a3138)}},
+  {{ UINT64_C(0x8200875bbbf9cf8f), UINT64_C(0x23e87555c7a3f373), UINT64_C(0x51fa6ae9f99a295f)}},
+  {{ UINT64_C(0xd7428c3ab1eb624a), UINT64_C(0x5252493b2e722feb), UINT64_C(0x8561841a170a3d7b)}},
+  {{ UINT64_C(0x35673c7410e78c70), UINT64_C(0xa6aedb17714026f6), UINT64_C(0xde64072de5bbfa4d)}},
+  {{ UINT64_C(0x8eb52a89bf18cc63), UINT64_C(0xc7ca830b3180a5fb), UINT64_C(0xb728114acbf95028)}},
+  {{ UINT64_C(0x3bd2a6a611e41d0b), UINT64_C(0xd9db343acf57615d), UINT64_C(0xf3f8ec694abe2c56)}},
+  {{ UINT64_C(0x87efdf02b9e409ad), UINT64_C(0xbb1bf85244e88596), UINT64_C(0xda9bbd346104bc0e)}},
+  {{ UINT64_C(0xdf9873dec392c169), UINT64_C(0x033ff0cc68f9ccce), UINT64_C(0xd8ca17e07a1ee41d)}},
+  {{ UINT64_C(0xa0d6002e23cebc2c), UINT64_C(0x7deb3fa147635516), UINT64_C(0xc8909cbe11413e6b)}},
+  {{ UINT64_C(0x5066692780ac649d), UINT64_C(0x7e2f7e53c01d8dd0), UINT64_C(0xb9fd66599973d82d)}},
+  {{ UINT64_C(0xed2c4c2f22731a00), UINT64_C(0x00794d2241fe4c28), UINT64_C(0x7ce6c028337bd4c9)}},
+  {{ UINT64_C(0x5e531343e3bd5ecd), UINT64_C(0xefeb154906ed6b0f), UINT64_C(0x99908b2fa13acda0)}},
+  {{ UINT64_C(0xe88fdf66a263214a), UINT64_C(0xca7d4c39baf15fc7), UINT64_C(0x0fbd3c0368dc4148)}},
+  {{ UINT64_C(0x8167b5cbaeadd008), UINT64_C(0x0358c8db1d121d57), UINT64_C(0xb82cdb2acb778bd6)}},
+  {{ UINT64_C(0x8db0deeaf08e151a), UINT64_C(0x16d126f6d8badc77), UINT64_C(0xe076be04e50e4f13)}},
+  {{ UINT64_C(0x125600a0dd358814), UINT64_C(0xf98ef94237e3e065), UINT64_C(0x11da4e85c8d0295a)}},
+  {{ UINT64_C(0x589e37ca8a3df8c3), UINT64_C(0x5c70425460a8de68), UINT64_C(0x96e47711e43ad753)}},
+  {{ UINT64_C(0xa9a810efbea3fbc8), UINT64_C(0x99abc464cd7e37b6), UINT64_C(0x8d4bba7c58b1236c)}},
+  {{ UINT64_C(0x146c37a6d7469701), UINT64_C(0xd79b327ebb987299), UINT64_C(0x26ef890500d23f8f)}},
+  {{ UINT64_C(0x0731aa60ffe7fb0b), UINT64_C(0x67904e7d69c4dc78), UINT64_C(0xcfb5afbe503718a7)}},
+  {{ UINT64_C(0xcc0861068ec09215), UINT64_C(0x337bb7f64b95ea48), UINT64_C(0xf69cc100e29f86c3)}},
+  {{ UINT64_C(0x6b7eb568d7e32819), UINT64_C(0x9ff5bd786f65eb36), UINT64_C(0xe7da7a7be9cd4a54)}},
+  {{ UINT64_C(0x65317147ffe2dafb), UINT64_C(0xa2a0541cef7df1d8), UINT64_C(0xa9dcbd28939954e1)}},
+  {{ UINT64_C(0x8978d18a99fcb0d3), UINT64_C(0xd5fbb8869a982166), UINT64_C(0xdf8ad48692932ecb)}},
+  {{ UINT64_C(0x21d20779465c3373), UINT64_C(0x40a076ab4410ffe7), UINT64_C(0xde18f696af687735)}},
+  {{ UINT64_C(0x5cf7795f82910830), UINT64_C(0x0f334e4b11e10b98), UINT64_C(0x46c7375e57514bdc)}},
+  {{ UINT64_C(0xfdfe415e8adb8079), UINT64_C(0x3e564010b640692f), UINT64_C(0xfe66216bf818fc5b)}},
+  {{ UINT64_C(0xfd1b17d921279ceb), UINT64_C(0xdbbf19ff6ec5c70b), UINT64_C(0x45476ab94457a2c8)}},
+  {{ UINT64_C(0x5c36e363a838dc46), UINT64_C(0x32987790742d2068), UINT64_C(0x26b4ac9c042a3ba4)}},
+  {{ UINT64_C(0x954ec3413015d3e7), UINT64_C(0xbbaec6f274565e98), UINT64_C(0xac8b93b9a2634a45)}},
+  {{ UINT64_C(0x0dda6cc60cd9d811), UINT64_C(0xe3722f1e721c2e55), UINT64_C(0x3373904807e9cfa5)}},
+  {{ UINT64_C(0xc53bdf8b93f89a82), UINT64_C(0xaa358e22471dc7f9), UINT64_C(0x9eaf94247dab22dd)}},
+  {{ UINT64_C(0x7de526957c057582), UINT64_C(0x6e254de5888c677d), UINT64_C(0x97f7e7eaef571ddb)}},
+  {{ UINT64_C(0x1c475c13a53c2647), UINT64_C(0xa99ccb84ca982dc6), UINT64_C(0xc854f61e3289b623)}},
+  {{ UINT64_C(0xace17fbfc603e4e5), UINT64_C(0x8290a43e6ae98317), UINT64_C(0xd4d4557e493766a3)}},
+  {{ UINT64_C(0x420479c1ee4e9301), UINT64_C(0xc450a88a57d49846), UINT64_C(0xfe2d3cc0b19271f1)}},
+  {{ UINT64_C(0x8c00119746f85efd), UINT64_C(0xade9c8907eb24fcb), UINT64_C(0xb1b6c68e67d9f9a6)}},
+  {{ UINT64_C(0xde8656c771558c36), UINT64_C(0xa9f3f35eb9dec6bc), UINT64_C(0xb059f30dc34e91bc)}},
+  {{ UINT64_C(0x0d5322fb3edfb471), UINT64_C(0x8389a597122e0281), UINT64_C(0xf30aa95709838b18)}},
+  {{ UINT64_C(0x2e80116ca186f6be), UINT64_C(0xe950d52f9058e7fe), UINT64_C(0xd9d28f9d1b484d88)}},
+  {{ UINT64_C(0x133206f3bf92f106), UINT64_C(0x8d88d8fb75c63dff), UINT64_C(0x6c581d7f7ea996c2)}},
+  {{ UINT64_C(0x00b23495afd9de94), UINT64_C(0x249487fead25f9a8), UINT64_C(0xa676aa5445e7db62)}},
+  {{ UINT64_C(0x029ca78a2a6187bd), UINT64_C(0x40fc495f3e2625ac), UINT64_C(0xe03f90742e06ba30)}},
+  {{ UINT64_C(0xd65f6d1cc05b269c), UINT64_C(0x3da587bda92d8722), UINT64_C(0x95b6b4f4ee302626)}},
+  {{ UINT64_C(0x32072b233e36ee07), UINT64_C(0x0c122c79179ce66b), UINT64_C(0x342506068666ce02)}},
+  {{ UINT64_C(0x522e31457defb0ed), UINT64_C(0x807a812655341733), UINT64_C(0xfff373e454b791a5)}},
+  {{ UINT64_C(0x2604a69f93ffb01b), UINT64_C(0xd918364e5c33b989), UINT64_C(0x4e0cc880f6f2cb28)}},
+  {{ UINT64_C(0x37fccc7279a731cc), UINT64_C(0x522a678e9eecf767), UINT64_C(0x77e9d7a04516afd3)}},
+  {{ UINT64_C(0xbc03340154fb9aea), UINT64_C(0xb18b1a39231372bf), UINT64_C(0x8b99d4269e819678)}},
+  {{ UINT64_C(0xdb6a7ee5a29285b2), UINT64_C(0x99bbd769f194b61b), UINT64_C(0x1b051e986f00ae0d)}},
+  {{ UINT64_C(0x80bc6a25d51379b0), UINT64_C(0x739d5a87f102ac27), UINT64_C(0x61eb40998f8b0264)}},
+  {{ UINT64_C(0x4038ac62592dd1b0), UINT64_C(0xf30e744b70c3f81a), UINT64_C(0x1e54e775307864c1)}},
+  {{ UINT64_C(0xd585e0d1cae0a550), UINT64_C(0x0659336fc42f4d97), UINT64_C(0x5cf5cf49721ecc84)}},
+  {{ UINT64_C(0xa17b7132a9a51e3e), UINT64_C(0x1ba4e51f980d45fe), UINT64_C(0x9a5b9d02eabd06d1)}},
+  {{ UINT64_C(0x328cf03433e356fb), UINT64_C(0x561a1320a9762234), UINT64_C(0xabb659fe7012866a)}},
+  {{ UINT64_C(0x148e75bf9b1817eb), UINT64_C(0xd7c0362be0ae1739), UINT64_C(0xb50746c52bacf004)}},
+  {{ UINT64_C(0x51c785e9fdbbcfd6), UINT64_C(0xf39a074adf3abf0a), UINT64_C(0xdd01f9233f57480b)}},
+  {{ UINT64_C(0xec03f4acd47897ea), UINT64_C(0x49c5542fe769d1c8), UINT64_C(0x2e7fbac277abb290)}},
+  {{ UINT64_C(0x759902cfa5635bae), UINT64_C(0x9abaf3469c8ef3eb), UINT64_C(0x0f816d744e6c89ed)}},
+  {{ UINT64_C(0xf0caae77fd26b16f), UINT64_C(0x29281232b2edaaab), UINT64_C(0x998341fbf4447778)}},
+  {{ UINT64_C(0x82e73a1fd61e5645), UINT64_C(0x4001c0cbe7efe760), UINT64_C(0xbb290936d35aaa02)}},
+  {{ UINT64_C(0xa972da29c2b48970), UINT64_C(0xffca3e1b26d10674), UINT64_C(0xda6aa5e241946719)}},
+  {{ UINT64_C(0x59ebea0a09d829f9), UINT64_C(0x30a58ee686fa2438), UINT64_C(0x1d608131d9961b51)}},
+  {{ UINT64_C(0xf32ff36a20a51993), UINT64_C(0x7937273269c6cb8e), UINT64_C(0x7824bc0d936b936d)}},
+  {{ UINT64_C(0xf5e55f2463902885), UINT64_C(0xef973525b4f792d8), UINT64_C(0xda165be81f966fe8)}},
+  {{ UINT64_C(0x18c46b1e89e2d640), UINT64_C(0xbaef0dda1440495c), UINT64_C(0x16da9cff6b4ebdc7)}},
+  {{ UINT64_C(0xe3313bdbd80eb75e), UINT64_C(0xb87d668aee03a3da), UINT64_C(0x36407c4f3c6bd6aa)}},
+  {{ UINT64_C(0x49a2bdc8653ab88c), UINT64_C(0xd9d31b57f83240f1), UINT64_C(0x769d9eea70b3dd23)}},
+  {{ UINT64_C(0x1f96bf26b644d5ca), UINT64_C(0x8fad7f961cac1d4f), UINT64_C(0x80d21850cc392561)}},
+  {{ UINT64_C(0x93a00952445b798c), UINT64_C(0xc15e5e00eb2df8e9), UINT64_C(0x752de43c8d32eb73)}},
+  {{ UINT64_C(0x8de352785343e260), UINT64_C(0xc115173cbebfbf29), UINT64_C(0x20771da89864267d)}},
+  {{ UINT64_C(0x64cf594df6f40ac3), UINT64_C(0xed849013c31148fd), UINT64_C(0x236dc8246bb6cd27)}},
+  {{ UINT64_C(0xcbe13a62466a1a14), UINT64_C(0x3bd09c4996762803), UINT64_C(0x6b368eb3a28c4bd4)}},
+  {{ UINT64_C(0x146a4e5f085dd169), UINT64_C(0xd2f647adc1eb41b9), UINT64_C(0xf60271dd936c9dd7)}},
+  {{ UINT64_C(0xa93eede5cab2840b), UINT64_C(0x6780f6d3a5a181d2), UINT64_C(0x4d7bb37fba5489c8)}},
+  {{ UINT64_C(0xd57d6ed4d33ea2fe), UINT64_C(0xe216160767f9b6ba), UINT64_C(0x9f90905eca426b95)}},
+  {{ UINT64_C(0xfa79b2cfb04c4e5c), UINT64_C(0xde43abfe64abca99), UINT64_C(0xec87c7435535ad5b)}},
+  {{ UINT64_C(0x491ef05fc4ca1cce), UINT64_C(0xae5bd6126f890c0b), UINT64_C(0xea8cc167ee2f0a80)}},
+  {{ UINT64_C(0x71ed43ca6c8ea68d), UINT64_C(0xa9bcfecb0f0cdf0a), UINT64_C(0xc673c17541afb354)}},
+  {{ UINT64_C(0x30071f54f2cb1bf5), UINT64_C(0x998e04b45f9ceb73), UINT64_C(0x09d1d75ef711a5a6)}},
+  {{ UINT64_C(0xef4e33bc55b76739), UINT64_C(0x1e52c24d68d50453), UINT64_C(0xbbd025e8730514a3)}},
+  {{ UINT64_C(0xe6753898fc0b4ba5), UINT64_C(0x53828bc26b360e6c), UINT64_C(0xe7d301b7378fa3a8)}},
+  {{ UINT64_C(0x8f465ce33bb4a1cf), UINT64_C(0x402b167b95d4fcfd), UINT64_C(0xd4fcdf8c39b32437)}},
+  {{ UINT64_C(0x5695e89e40b4fb8b), UINT64_C(0x4aaeb80b5d058fd1), UINT64_C(0x28ce8f63ed8aaedd)}},
+  {{ UINT64_C(0x1c68c78d6bf96d06), UINT64_C(0x77fd20becefe9eb0), UINT64_C(0xc253c35fafe22ac3)}},
+  {{ UINT64_C(0x70cc7a9c5027f774), UINT64_C(0x15b3637a0d9d75a5), UINT64_C(0x74ed082efceebaf4)}},
+  {{ UINT64_C(0xeeb535ca3308f288), UINT64_C(0xaab92d6adf391c64), UINT64_C(0xf39ac86374c09582)}},
+  {{ UINT64_C(0x7ad8be7ac3089da5), UINT64_C(0xdb427d2d3214dee5), UINT64_C(0x704b6b4c564e8a8b)}},
+  {{ UINT64_C(0x60421cffc0e9d75e), UINT64_C(0x160a83ebda3bdc86), UINT64_C(0x230dd844b33dfbd8)}},
+  {{ UINT64_C(0x6aab6e799ae51d30), UINT64_C(0x6129366dabe03a92), UINT64_C(0xb80a0fdcf0670caa)}},
+  {{ UINT64_C(0x68ac06670b1b7106), UINT64_C(0xfcf8e4810bb7e838), UINT64_C(0xf5cf5d8b11596c88)}},
+  {{ UINT64_C(0x7596d2aa1966cea2), UINT64_C(0x49c557b010d89077), UINT64_C(0x397fa10b48f3cf5b)}},
+  {{ UINT64_C(0xaff387417b4eee0e), UINT64_C(0x622137cbfac36400), UINT64_C(0x9136d765c2d9d59f)}},
+  {{ UINT64_C(0xca672f1f9b4c59e8), UINT64_C(0x57900385647548f9), UINT64_C(0xac1717fb06de7dcc)}},
+  {{ UINT64_C(0x9485225001d71af8), UINT64_C(0xbc54f9d8a2cb3a3a), UINT64_C(0x3122637e9b969c82)}},
+  {{ UINT64_C(0x8579966b41fcc780), UINT64_C(0x388777f146fe2946), UINT64_C(0x64642fad1b39c307)}},
+  {{ UINT64_C(0xa3ba86f86be250dc), UINT64_C(0x052cb40c645e5811), UINT64_C(0x2855f09cd3fb57d4)}},
+  {{ UINT64_C(0x078e2ac9b120172a), UINT64_C(0x5aa7ed0059a238be), UINT64_C(0x240f2b1437cb20ed)}},
+  {{ UINT64_C(0x3142f1f19433da81), UINT64_C(0x470d346f8d004db1), UINT64_C(0xac7c814caf25c5df)}},
+  {{ UINT64_C(0x33ab64050029ef0a), UINT64_C(0xdf7690fc6b5a46c5), UINT64_C(0x1d5923e73f6c8914)}},
+  {{ UINT64_C(0xf34b40862b3c304c), UINT64_C(0x1c6712164d6d1770), UINT64_C(0x38b3b37b8166d332)}},
+  {{ UINT64_C(0x2fd4d19952c45f3d), UINT64_C(0x054d7e0b10faa37d), UINT64_C(0xd044fdc82c7b38ba)}},
+  {{ UINT64_C(0x5ebcfddda0ab49c7), UINT64_C(0xae4e4a08cb577eff), UINT64_C(0x99752ab14b32eaae)}},
+  {{ UINT64_C(0x2ee23b46bfa1b102), UINT64_C(0x7ec89ed241501b4b), UINT64_C(0x5c1576cfcb570cb9)}},
+  {{ UINT64_C(0xf026054413abc1be), UINT64_C(0x903e799205e70280), UINT64_C(0xe374e115e263d35e)}},
+  {{ UINT64_C(0x355225b1b1f771cd), UINT64_C(0x77b0df58b5dbe6be), UINT64_C(0x190357abc3b39599)}},
+  {{ UINT64_C(0x3e796bfbf39391e3), UINT64_C(0x6d0bfb9ed5a2812f), UINT64_C(0xb2184ec25c768651)}},
+  {{ UINT64_C(0x21475370e07d4a7e), UINT64_C(0xe926bb36aeebf1bc), UINT64_C(0xc8f700e989408499)}},
+  {{ UINT64_C(0x840f0fa71d7d58e6), UINT64_C(0x620d12303716db3e), UINT64_C(0x0fa235f84839fa13)}},
+  {{ UINT64_C(0xc544b14d05c5ecc5), UINT64_C(0xab19a239e947b9f3), UINT64_C(0xeb6f9cc3f17a8b90)}},
+  {{ UINT64_C(0x426769c4fc0bddd5), UINT64_C(0xeb349379452873f5), UINT64_C(0xd0674e34387e6ba9)}},
+  {{ UINT64_C(0x9afcc71d81b62204), UINT64_C(0xfecaff5744b09766), UINT64_C(0x53dd2cf2520dddf7)}},
+  {{ UINT64_C(0x68f4d384c6e78ac0), UINT64_C(0xcef9406606812ff4), UINT64_C(0xe8d77df297931b2e)}},
+  {{ UINT64_C(0xd71f9893762a3686), UINT64_C(0xf20f626d986cfe4a), UINT64_C(0xd66eeb7ba876286c)}},
+  {{ UINT64_C(0xce272eb86e209d0b), UINT64_C(0x22fb19658a917d40), UINT64_C(0x90be747b5f39ff17)}},
+  {{ UINT64_C(0x17d1af49aaa16526), UINT64_C(0xe798277e47a00b02), UINT64_C(0x229527a9477d1bed)}},
+  {{ UINT64_C(0x8aa818c459177e55), UINT64_C(0xf29daab5cd110d65), UINT64_C(0x99fc927ce4e0eea4)}},
+  {{ UINT64_C(0x831c652fe959700d), UINT64_C(0x95b84252e135eec9), UINT64_C(0xde3f54b25f6e3850)}},
+  {{ UINT64_C(0x0a5478610efc05ee), UINT64_C(0xf968e7191ea76ae6), UINT64_C(0x65dfce346d3806f5)}},
+  {{ UINT64_C(0xe4d3961654e3520c), UINT64_C(0x6901a40262b73b21), UINT64_C(0x6905d5b9f5de72c9)}},
+  {{ UINT64_C(0x2b56a516fe54e552), UINT64_C(0x473d790eb7a94e07), UINT64_C(0x66e4f06b7b909d24)}},
+  {{ UINT64_C(0x583fca0a85733a88), UINT64_C(0xc3a60e60746fba62), UINT64_C(0x177c2e904484bf83)}},
+  {{ UINT64_C(0xbe3d827c4e206d3b), UINT64_C(0xb413fce36c88d1e1), UINT64_C(0x752f6d21d8a1e683)}},
+  {{ UINT64_C(0x60cfa2927a965831), UINT64_C(0x665a73686f3c2941), UINT64_C(0x34351f8d9276c1b8)}},
+  {{ UINT64_C(0x98a97dcb14ce2e28), UINT64_C(0x73b90e5ea3621381), UINT64_C(0xd047f9f523bc089c)}},
+  {{ UINT64_C(0x11ec733a42ac3eaf), UINT64_C(0x5bda91ce3ed85175), UINT64_C(0x9f336015b5e946e3)}},
+  {{ UINT64_C(0xff01d7a4136e9374), UINT64_C(0xa2a921ab6d48883f), UINT64_C(0x473fe7882a56a0de)}},
+  {{ UINT64_C(0x7d5dd5a3205230d1), UINT64_C(0xfe97ada9f0cec547), UINT64_C(0x6f771997e504b955)}},
+  {{ UINT64_C(0x50702caa42f71d76), UINT64_C(0xd453375f68676550), UINT64_C(0x6be3a37033d6496d)}},
+  {{ UINT64_C(0xc2089acccd9b7d51), UINT64_C(0x51d95d974421252a), UINT64_C(0x0498ceae75cf626e)}},
+  {{ UINT64_C(0xfb7138ec25aded9b), UINT64_C(0xc8ca99c5c361d9cf), UINT64_C(0xe9d19e54787386e2)}},
+  {{ UINT64_C(0xd6b78316ba4dea5c), UINT64_C(0x2722d6692456a1f6), UINT64_C(0x2d1c748aa48d7fee)}},
+  {{ UINT64_C(0x1fc0a09698254b70), UINT64_C(0x617c4bbf621cb0e4), UINT64_C(0x26ae6d7d2fcdedbc)}},
+  {{ UINT64_C(0x6699b224a4d4cd3c), UINT64_C(0x4358f7b13d2cc25a), UINT64_C(0x62cbf3fc934cd6df)}},
+  {{ UINT64_C(0x81d1e8295ec6a012), UINT64_C(0x832bcdb5376705d3), UINT64_C(0xfa1e9ae89cacdd17)}},
+  {{ UINT64_C(0xbaf733efd5419e24), UINT64_C(0x9d14d112fc5b7b5d), UINT64_C(0x33d008345011c4f0)}},
+  {{ UINT64_C(0x4b1f4f66e2f593bc), UINT64_C(0x992fcd0bf75ff81f), UINT64_C(0xd6ebe7ff039268f6)}},
+  {{ UINT64_C(0xf5318791f459ef82), UINT64_C(0xc9b29ccab786fe39), UINT64_C(0x511187e08bfb3088)}},
+  {{ UINT64_C(0xade7303704715c3d), UINT64_C(0xa98dc776b89c35ac), UINT64_C(0xef24cb7619300112)}},
+  {{ UINT64_C(0x1ba07230961fd33f), UINT64_C(0xf3afc2c97674b7f6), UINT64_C(0xe15abf4fded9607c)}},
+  {{ UINT64_C(0x73595037601cadd9), UINT64_C(0x9c09eef97ce71761), UINT64_C(0xa9d889b7a0d467f7)}},
+  {{ UINT64_C(0x718b6b255a4e2fe2), UINT64_C(0x3240102d11d44030), UINT64_C(0x12358d3b48bd400f)}},
+  {{ UINT64_C(0xb6cd632e5b5eb7a5), UINT64_C(0x9ab3b9bce172f955), UINT64_C(0x1cb7b02804e7f998)}},
+  {{ UINT64_C(0x1e4b9315d4d7dea9), UINT64_C(0xb04c30c64c3cf406), UINT64_C(0xe1797de713cf0f4a)}},
+  {{ UINT64_C(0x42f6158396a798dd), UINT64_C(0xf234771f1d8ea7a5), UINT64_C(0xbc82ba1ef4f38a00)}},
+  {{ UINT64_C(0x477038e3bfa4236c), UINT64_C(0xc73cc2d19f4c3af5), UINT64_C(0x8f5ee5d9b1160041)}},
+  {{ UINT64_C(0xd0bd4a3f389785b8), UINT64_C(0x60c78661376cbe20), UINT64_C(0x5a87db31060c4218)}},
+  {{ UINT64_C(0x156eda6acda68d56), UINT64_C(0x556b2caaece49d4e), UINT64_C(0x88f37aa232cabf93)}},
+  {{ UINT64_C(0x21dd0504325d070d), UINT64_C(0xc7d61a4d7c62aa56), UINT64_C(0x491c5fd6f8185c61)}},
+  {{ UINT64_C(0xa37741b0a4e68ed9), UINT64_C(0x8e83f91db9b48c0e), UINT64_C(0x86fb6bb797c94a6b)}},
+  {{ UINT64_C(0x667bc13193badc78), UINT64_C(0xd7fb0846ab719aad), UINT64_C(0x87ba68777c1eccfd)}},
+  {{ UINT64_C(0xfe45c5b1722f12d6), UINT64_C(0x94f7202ee59d8f51), UINT64_C(0x18af2206ee7cf068)}},
+  {{ UINT64_C(0x83e89003c708025e), UINT64_C(0x95c12ea9f86527f9), UINT64_C(0xa8f2561e0005d5b6)}},
+  {{ UINT64_C(0xfa15063367b50cfc), UINT64_C(0x67ea9087a1992560), UINT64_C(0x1b694c752e0221b4)}},
+  {{ UINT64_C(0xb358db3464eadbf9), UINT64_C(0x2e0e4ecba33cbde5), UINT64_C(0x6066f3af4d002e7f)}},
+  {{ UINT64_C(0xdb02b417c616db3d), UINT64_C(0x895c662a5ad8a8d3), UINT64_C(0x79ef4bd1848602a3)}},
+  {{ UINT64_C(0xde612ede0dde382d), UINT64_C(0x729e4705c1dcb0ae), UINT64_C(0x44f58a021935e210)}},
+  {{ UINT64_C(0x0133b22e21397dcb), UINT64_C(0x4f6b0f31ddcda457), UINT64_C(0x9fe26412abdcd564)}},
+  {{ UINT64_C(0x9045e90900eeec64), UINT64_C(0xfe9777cd81ac1129), UINT64_C(0x63b8f428cdc45537)}},
+  {{ UINT64_C(0x7711abca9dcb1380), UINT64_C(0x29f57b29591f0b3a), UINT64_C(0xaf810c6a4dde8e9b)}},
+  {{ UINT64_C(0x821461ee5ac3da99), UINT64_C(0x57ffa84c828ca5aa), UINT64_C(0xaf77583a84574ee6)}},
+  {{ UINT64_C(0xa9f2eea9f340d5c0), UINT64_C(0xe82ffd57c59df5db), UINT64_C(0x9f8c65e9077f02f8)}},
+  {{ UINT64_C(0x97287d052c142baa), UINT64_C(0x7362711a04d8cf62), UINT64_C(0xba8fb57cb6858214)}},
+  {{ UINT64_C(0xc9d89d1f0c6470da), UINT64_C(0xa7e20f43062d2a01), UINT64_C(0x775dd20b795ca194)}},
+  {{ UINT64_C(0x6dc548fb07b6c9f7), UINT64_C(0x41e6ec72f395c9ab), UINT64_C(0x04fe5b3b37dc433d)}},
+  {{ UINT64_C(0x02182dd4b7e41a36), UINT64_C(0x17493d34733cf594), UINT64_C(0x18bbd2255a91772b)}},
+  {{ UINT64_C(0x84ff152b7cc0890a), UINT64_C(0x6d5ebe589365c2b0), UINT64_C(0x01104face0ed754e)}},
+  {{ UINT64_C(0x5cba45cdca94e311), UINT64_C(0xd00243ec2f359fd4), UINT64_C(0x67721b73393795cc)}},
+  {{ UINT64_C(0x9bf6e41e66b561db), UINT64_C(0x37ba2c0eedecf3f8), UINT64_C(0x9cff9ddda45b708e)}},
+  {{ UINT64_C(0x5e8dfddcf247d132), UINT64_C(0xbcbe7777c359d4e8), UINT64_C(0x8808e2c2e847cbbc)}},
+  {{ UINT64_C(0xaebe03b5f947b16c), UINT64_C(0xf095b01dbce0620f), UINT64_C(0x13ac08e4c83e1575)}},
+  {{ UINT64_C(0xd28e163b5dd9db51), UINT64_C(0xd36c08cdf26831f4), UINT64_C(0x3b5b3d39ea37da00)}},
+  {{ UINT64_C(0xfa4e581419a8429f), UINT64_C(0x51cc4d2641cd7fb5), UINT64_C(0x4aa50b9115169741)}},
+  {{ UINT64_C(0x5c7422104ee8e56a), UINT64_C(0xd3f4567659d12d3b), UINT64_C(0x607d6c5404f01f23)}},
+  {{ UINT64_C(0xb296892f8ba89a9f), UINT64_C(0x23161f740625eaec), UINT64_C(0x2d53246e27fc5583)}},
+  {{ UINT64_C(0x18e006c82a43fa62), UINT64_C(0xda6a2b10a60c6af9), UINT64_C(0x9eeefecd78290520)}},
+  {{ UINT64_C(0x2a1b2abf2734de59), UINT64_C(0x03d897d14bf51e37), UINT64_C(0x2a61c19c27f8ad55)}},
+  {{ UINT64_C(0x8073720499eec1dd), UINT64_C(0xc1736eba05ddaa67), UINT64_C(0x949fcf726c7e3fc6)}},
+  {{ UINT64_C(0xe911a07d029168f0), UINT64_C(0xa6c7b7c94603e10a), UINT64_C(0x687a886591579a51)}},
+  {{ UINT64_C(0x691095d222502491), UINT64_C(0x5bc0797164cc010a), UINT64_C(0xdb8ccedb882e8383)}},
+  {{ UINT64_C(0x20ccad35b281fd13), UINT64_C(0xbdb3116a745fd976), UINT64_C(0xa17c5c3b5f666ea0)}},
+  {{ UINT64_C(0x042dd884026b0a81), UINT64_C(0x1f7102632c93e7a7), UINT64_C(0x0fc4da87c62df09e)}},
+  {{ UINT64_C(0xaaefacbdb03b0520), UINT64_C(0x4eae18b51f57b485), UINT64_C(0x1c309dc2b43b1e14)}},
+  {{ UINT64_C(0xbd8a6fbdd0582112), UINT64_C(0x0dcb039b5501e0f5), UINT64_C(0xe438e6cd74acf0dc)}},
+  {{ UINT64_C(0x9efdb5505b0ecd27), UINT64_C(0xcd7b33d635f3dbd9), UINT64_C(0x905a0982fc915d3d)}},
+  {{ UINT64_C(0x4eb73a19765d3680), UINT64_C(0x0d0afa8337979293), UINT64_C(0xca89dc945ff22a1f)}},
+  {{ UINT64_C(0x7d2953b58726ff83), UINT64_C(0xc5b20bb6e6a646ad), UINT64_C(0x8a057ad19d7b2845)}},
+  {{ UINT64_C(0x2d0e75c4332be2ae), UINT64_C(0x9bab961aac3e515a), UINT64_C(0x14e9f79d6a147415)}},
+  {{ UINT64_C(0x7f132d3460b74a71), UINT64_C(0x807a11fa87d9d991), UINT64_C(0xada8fb91386be4f8)}},
+  {{ UINT64_C(0x422258db70d2af34), UINT64_C(0xa6c17dd8d9b3eaa7), UINT64_C(0x448b148bcac2d8e4)}},
+  {{ UINT64_C(0x35872c1ba0a7c4bb), UINT64_C(0x04e0b30cd78c67f6), UINT64_C(0x1045be14a00c8881)}},
+  {{ UINT64_C(0xa2f3c60370a8daef), UINT64_C(0x98ef8e8280c16cd5), UINT64_C(0x4c22e54387ecd1bb)}},
+  {{ UINT64_C(0xe28ab91d10d656bc), UINT64_C(0x0c0cd78266f5f41f), UINT64_C(0x992dfdbfa3692d4d)}},
+  {{ UINT64_C(0x6d66bb24d3606a73), UINT64_C(0x6d681a2c6b2ae131), UINT64_C(0x02738a823dbd5145)}},
+  {{ UINT64_C(0xb83166c9c83b0109), UINT64_C(0xe61d31951e929fbd), UINT64_C(0x8c853d2da6c4f224)}},
+  {{ UINT64_C(0x336fb510ff15a6c9), UINT64_C(0x5486436765b9b376), UINT64_C(0x2b0fc99d7a6bcdf0)}},
+  {{ UINT64_C(0xe0fe77447a8f682b), UINT64_C(0x4ed06aee259ea763), UINT64_C(0x4ce651fcb00419ee)}},
+  {{ UINT64_C(0xa8484a0baad374b5), UINT64_C(0xcff28f81db54303d), UINT64_C(0xb6542a8db78fbbd7)}},
+  {{ UINT64_C(0x6bbc9b3bf0c9720b), UINT64_C(0x09a5ff995b1a7439), UINT64_C(0xc03bdd5a2d98385d)}},
+  {{ UINT64_C(0x71d2508f68bcf5a9), UINT64_C(0x583927083c47b225), UINT64_C(0x354c6450eb75a442)}},
+  {{ UINT64_C(0x5f3fceba7e306deb), UINT64_C(0xfc5ee1bd08370d19), UINT64_C(0x64fe646b6eb7162d)}},
+  {{ UINT64_C(0x6fcad87ba901b54e), UINT64_C(0xddb0bc5382edca01), UINT64_C(0x818adfcf3f2fe10c)}},
+  {{ UINT64_C(0x20d2cbc23eec1d11), UINT64_C(0x520ce97600f2b2e6), UINT64_C(0x60bc6c16792d76cb)}},
+  {{ UINT64_C(0xfd23af5210fc424e), UINT64_C(0xa87beb32bba66dd7), UINT64_C(0x0411641dbbefee78)}},
+  {{ UINT64_C(0xec0ecbfe83575705), UINT64_C(0xc1dbb8ec19331d77), UINT64_C(0xe10c239af952c4fe)}},
+  {{ UINT64_C(0xcf404afad6f11c8b), UINT64_C(0xaa784bc529beb363), UINT64_C(0x6c5f9b16ad46d26e)}},
+  {{ UINT64_C(0x319066d9557bf0a1), UINT64_C(0x2e78a4fc83e14d88), UINT64_C(0x40f70460aee486e5)}},
+  {{ UINT64_C(0xbcb264bbbe9dc398), UINT64_C(0x10ec5303e3772dea), UINT64_C(0xc3a9d9feb5ac5667)}},
+  {{ UINT64_C(0x7b9c36831d0a4c59), UINT64_C(0xbafd76435d3d2c6b), UINT64_C(0xb728ad105175c0e1)}},
+  {{ UINT64_C(0x6f1a6051037ff538), UINT64_C(0xa26c4b1e9f361090), UINT64_C(0xd1021c0d2cf2fce3)}},
+  {{ UINT64_C(0x84783e87f0ad9b02), UINT64_C(0xd2a1228bf4e22de7), UINT64_C(0xd1f9898b26f93675)}},
+  {{ UINT64_C(0x7acf15da9ad7f957), UINT64_C(0x53dae360abd70a99), UINT64_C(0x8a8b92779bf151e9)}},
+  {{ UINT64_C(0x7277c3c0b7068162), UINT64_C(0x93a232ae7d36b965), UINT64_C(0xf9490fa4a372bb9c)}},
+  {{ UINT64_C(0x74b60d3f7666964f), UINT64_C(0x3cd9ebc5ca84473d), UINT64_C(0xd89e5477233d855c)}},
+  {{ UINT64_C(0xd1fe5d8cfc26845e), UINT64_C(0x9ab3b72303eb4c00), UINT64_C(0xf29a5833d3fbf5fe)}},
+  {{ UINT64_C(0xd87cdaa31f502300), UINT64_C(0x9eec260a827dbb00), UINT64_C(0xbddcebb3ba0aa2b8)}},
+  {{ UINT64_C(0xf8ab379c1f28f413), UINT64_C(0x62a733bd196c32e6), UINT64_C(0x4371caca7110cd7e)}},
+  {{ UINT64_C(0x080faef8ff74c473), UINT64_C(0x73901d44c541c4dc), UINT64_C(0x410a56741ca6e3f1)}},
+  {{ UINT64_C(0xee83ac111d0f1842), UINT64_C(0xc5aadf6d8deb4803), UINT64_C(0xb305bb717d0ecbbc)}},
+  {{ UINT64_C(0x8626c85b9e6c5e74), UINT64_C(0x203f969783f32d78), UINT64_C(0x4c236289e7f7f520)}},
+  {{ UINT64_C(0xc9dada84c8598cb9), UINT64_C(0x0ec3bb62ee20a2e2), UINT64_C(0xa5f94ad3981cb87c)}},
+  {{ UINT64_C(0x417307b11a9e4eea), UINT64_C(0xa8431dc54d6efdc0), UINT64_C(0xb83cae25c2b83b78)}},
+  {{ UINT64_C(0x0cac99f1e61a6f95), UINT64_C(0xa9574ae6c5d1df26), UINT64_C(0x35946e2c2aebd44e)}},
+  {{ UINT64_C(0x2c129868d931894a), UINT64_C(0xfb36afc270de4e46), UINT64_C(0x8a97444b8014a776)}},
+  {{ UINT64_C(0x95581375774c957b), UINT64_C(0xdb3776eb3db09264), UINT64_C(0x2b3c5df4fb8d2b74)}},
+  {{ UINT64_C(0x6e977081ce112e83), UINT64_C(0x6d67d4eee65766b5), UINT64_C(0x1374704b0f3ad75b)}},
+  {{ UINT64_C(0x7135d5a7684d7217), UINT64_C(0xcbe53f9b922906de), UINT64_C(0x56716954497df6de)}},
+  {{ UINT64_C(0xec4a1e1a958529ce), UINT64_C(0x928e6782d8dbf188), UINT64_C(0xa82cc74b719cf131)}},
+  {{ UINT64_C(0x4f52572e7977aae9), UINT64_C(0xbeff837e702315ca), UINT64_C(0x2197af31c2457400)}},
+  {{ UINT64_C(0xcfc8b7c0ce5f0d0b), UINT64_C(0xe6385b33d629e763), UINT64_C(0xd5112fe6b4a5ee72)}},
+  {{ UINT64_C(0x2192bac25754aa08), UINT64_C(0xa914815e5a48917b), UINT64_C(0x771ddcb8f84c3b14)}},
+  {{ UINT64_C(0x198d9eebd4ca59df), UINT64_C(0x4b28254bc2b5cfcd), UINT64_C(0x5c831fb69ce64f2e)}},
+  {{ UINT64_C(0xaf0e59552325887f), UINT64_C(0x877ac104d4b9c255), UINT64_C(0xb1b064d267445ded)}},
+  {{ UINT64_C(0x32a5c25d009569b9), UINT64_C(0x8d1c8314e96bd235), UINT64_C(0x4cd00dad862ac8a6)}},
+  {{ UINT64_C(0x280368d966a0beac), UINT64_C(0x45361b4730abf6ea), UINT64_C(0x602f3a46e6d97a2c)}},
+  {{ UINT64_C(0x5e9af8c8f4a691e2), UINT64_C(0xecf64cfcef0f297d), UINT64_C(0xfd1461939a3e023a)}},
+  {{ UINT64_C(0x428a8ef5cb695971), UINT64_C(0x2b063434678a66e0), UINT64_C(0x40192b55eb4265cf)}},
+  {{ UINT64_C(0x83565609392a1e08), UINT64_C(0x4920e3b326f63980), UINT64_C(0x6a8c7df9d00a39dc)}},
+  {{ UINT64_C(0xbd9774d974b7f7c7), UINT64_C(0x9cf2013e6dc7198c), UINT64_C(0x30c9a6a41684eb6c)}},
+  {{ UINT64_C(0x90b8bad8d464be7e), UINT64_C(0x3f6ae3b417740755), UINT64_C(0x0b196b516953eed6)}},
+  {{ UINT64_C(0xbf1588cb2e8c55c8), UINT64_C(0x9837e8538945f480), UINT64_C(0x973b38c5f7485c44)}},
+  {{ UINT64_C(0x7edf8e406bdc9eac), UINT64_C(0x30870aa4abbc4082), UINT64_C(0x1736fb7701029eca)}},
+  {{ UINT64_C(0x4d31a3b241c0176b), UINT64_C(0xe22fb7386923c9ad), UINT64_C(0x735c808495872ced)}},
+  {{ UINT64_C(0xdd1f9c1bf9953f0f), UINT64_C(0xcfb62466ac313aae), UINT64_C(0xcf47876e477e11ba)}},
+  {{ UINT64_C(0x9b55de8a1b5321cf), UINT64_C(0x057bb3d347682101), UINT64_C(0x34004ee544526865)}},
+  {{ UINT64_C(0x39112018a870a473), UINT64_C(0x84ed46ee67425cd8), UINT64_C(0xf0488853f53e9120)}},
+  {{ UINT64_C(0x75da8eb6a0ef0cf7), UINT64_C(0xd01e3e7dce85de7c), UINT64_C(0x989c4ef1ab0e6652)}},
+  {{ UINT64_C(0x8fc541f2d76e9efa), UINT64_C(0x6480e127416792b9), UINT64_C(0xc77ae642cfe7773b)}},
+  {{ UINT64_C(0x0e27bf6adddb019e), UINT64_C(0x57a57361191a9e6f), UINT64_C(0x76975db71ad73aaf)}},
+  {{ UINT64_C(0x60d22116912c2088), UINT64_C(0x73d09e53c6a364c6), UINT64_C(0xd4633c48b0858390)}},
+  {{ UINT64_C(0xc4705fb976d83f07), UINT64_C(0xa9e00315b00642e6), UINT64_C(0xb38c064b6db3d5b2)}},
+  {{ UINT64_C(0x37ce6f5b1d381a3d), UINT64_C(0xf999d0556b503783), UINT64_C(0x00de6c1b98b3dd4c)}},
+  {{ UINT64_C(0x311fc26f1d9e620f), UINT64_C(0xe6e952418d34021f), UINT64_C(0x9b855e0ff0ab2afe)}},
+  {{ UINT64_C(0x08ee50a386190de1), UINT64_C(0x7716944f5313fa56), UINT64_C(0x506592c4ce73acaf)}},
+  {{ UINT64_C(0xb22d328acaf240d0), UINT64_C(0xe28fde69f58b77f5), UINT64_C(0x1d7393bd17daa42e)}},
+  {{ UINT64_C(0xf060c334ac882195), UINT64_C(0xc757b11d1afda0c9), UINT64_C(0x60f4efceb3dac33e)}},
+  {{ UINT64_C(0x98191dfc8132db57), UINT64_C(0x96c3246bb0f68649), UINT64_C(0x888934b8a8ed34ac)}},
+  {{ UINT64_C(0x28c65bb3e0f90874), UINT64_C(0x0c0fd92a10b4d327), UINT64_C(0xdabc34c0ecf7dff9)}},
+  {{ UINT64_C(0xf403b653d72ff494), UINT64_C(0x471444a8199e9365), UINT64_C(0xedac4f263e9973ca)}},
+  {{ UINT64_C(0xca29fc5a302e3b4a), UINT64_C(0x0abad0a503e913b2), UINT64_C(0xbeb1f84ab1d1cf7c)}},
+  {{ UINT64_C(0x3bec17165e91b4b3), UINT64_C(0xb28a18393aa7395c), UINT64_C(0x8e1d0160e29b9ab4)}},
+  {{ UINT64_C(0xd380903ac5abc2f5), UINT64_C(0xdc4725b8b038006d), UINT64_C(0x7c6e210b3f637668)}},
+  {{ UINT64_C(0xf3616f8e3592dab3), UINT64_C(0xb077cc8a2d6b3cb5), UINT64_C(0xa4607df75b45f334)}},
+  {{ UINT64_C(0x5ea9b20aab81448b), UINT64_C(0x041c57e2ea1814b5), UINT64_C(0xfdb66dfd35ca07b2)}},
+  {{ UINT64_C(0xe3d69ad945cdefe7), UINT64_C(0x776a100dc7ed0a7d), UINT64_C(0x7e17771b590de9b3)}},
+  {{ UINT64_C(0xec1d39f9f8b08b69), UINT64_C(0x7ffe95497cd6b9f5), UINT64_C(0x4b2a514875ddd399)}},
+  {{ UINT64_C(0xcd39a28af017ba9c), UINT64_C(0x53cb82f2ddbf0833), UINT64_C(0xcca4f980951032d2)}},
+  {{ UINT64_C(0x9a943c4ffc4d2152), UINT64_C(0xaa8e5d6b7260886d), UINT64_C(0x25188efca6766742)}},
+  {{ UINT64_C(0xe9a83fbb149ee383), UINT64_C(0x21a833331899a4f3), UINT64_C(0xe50283e19f97b907)}},
+  {{ UINT64_C(0x9c051e3da16fe11c), UINT64_C(0x352f9b68ce3de2d4), UINT64_C(0x6bf18d418f9fa76a)}},
+  {{ UINT64_C(0x0231ea16b2210210), UINT64_C(0xcfa05ea8eee83157), UINT64_C(0xeb5ee11872ea2999)}},
+  {{ UINT64_C(0x10157c2c364288cf), UINT64_C(0x403b9bfac4a1e45a), UINT64_C(0xa1c10b512b691315)}},
+  {{ UINT64_C(0xe3cc8e909c0ffc83), UINT64_C(0x3045b93fb8701973), UINT64_C(0x6553a71ee3f9ae12)}},
+  {{ UINT64_C(0xcf041d91c9db4967), UINT64_C(0x8d5fcd76c0a334e2), UINT64_C(0xbd45800b67390338)}},
+  {{ UINT64_C(0x06a83ca926357ccd), UINT64_C(0x4b9c0d74488eda89), UINT64_C(0x9c6165ab60afbb5a)}},
+  {{ UINT64_C(0x91faad7f7fbd942d), UINT64_C(0x3bfae5e439a92c28), UINT64_C(0xac42cc667add702a)}},
+  {{ UINT64_C(0x2e9063edd5b4e09c), UINT64_C(0x9139cf52de19e935), UINT64_C(0x0852a8fd2febbf1c)}},
+  {{ UINT64_C(0x74b2b07228ed205f), UINT64_C(0x26c76f46fa04e94b), UINT64_C(0x53cdfdb7dd08e5e7)}},
+  {{ UINT64_C(0x00b90c135ba7acd8), UINT64_C(0x1be9adba21e5ca96), UINT64_C(0x751b5c5107ca14d0)}},
+  {{ UINT64_C(0xf453ad36dc56c551), UINT64_C(0x72eb2502cfdb963d), UINT64_C(0xf0ce0922546e1bf1)}},
+  {{ UINT64_C(0x7d69e89e02ba93f9), UINT64_C(0x0bd6663590b43b53), UINT64_C(0xf33a390a1ccff5ee)}},
+  {{ UINT64_C(0xe34efc81cc9b989d), UINT64_C(0x6ca6b42352f997e1), UINT64_C(0xa0d6cbc26b5be8f1)}},
+  {{ UINT64_C(0xa369651af9f4b041), UINT64_C(0xddda2aee18c47bf4), UINT64_C(0x6a178f32a828e8f7)}},
+  {{ UINT64_C(0x1ddf9a1eb1b60dbe), UINT64_C(0x784f9c4e457bbd53), UINT64_C(0xbe8c321a7c6c4c23)}},
+  {{ UINT64_C(0xda0ea9510265f6bf), UINT64_C(0x386e1a7ec0bc514f), UINT64_C(0xaf6d4641c8aff024)}},
+  {{ UINT64_C(0x234742b01c1d0a13), UINT64_C(0xabd471c16281b9e9), UINT64_C(0x77a4a2fece513ee7)}},
+  {{ UINT64_C(0x40116244da016608), UINT64_C(0x15156c3068d82060), UINT64_C(0x87ec9a24d7de6061)}},
+  {{ UINT64_C(0xf09ff047aa1cbc97), UINT64_C(0xf1c9aa330cb2a54d), UINT64_C(0xe8497b988096c391)}},
+  {{ UINT64_C(0x9d57f00af78fe826), UINT64_C(0xdfe0e10a76784f3e), UINT64_C(0x0fd190ac5087d77e)}},
+  {{ UINT64_C(0x0537521fc691bc4b), UINT64_C(0x0d3ca606a5b8a573), UINT64_C(0x64071f9a4f543376)}},
+  {{ UINT64_C(0xf1280c61ad0d0a1f), UINT64_C(0xed0e3a68f2b39aa8), UINT64_C(0x9288a319e96bf98f)}},
+  {{ UINT64_C(0x27a123109099757b), UINT64_C(0xcac8e1f7f422915c), UINT64_C(0xffd4c6550312581a)}},
+  {{ UINT64_C(0xb431d5791994a356), UINT64_C(0x26d8f08366f21e22), UINT64_C(0x2099c6c3ebeb4127)}},
+  {{ UINT64_C(0x1897229ff7e237e9), UINT64_C(0x79eb7ceceb2e5928), UINT64_C(0x4bfd228c59cf163f)}},
+  {{ UINT64_C(0x7206380d425ea2e8), UINT64_C(0xd4288880e06b5bfa), UINT64_C(0x30267b2508f7545f)}},
+  {{ UINT64_C(0xeb2de0bc8c1e6eaa), UINT64_C(0xc5d76bb95efab76b), UINT64_C(0xa0f5eb01160788e0)}},
+  {{ UINT64_C(0xda4800b9b3635959), UINT64_C(0x022570a5a6b79a8e), UINT64_C(0xb327bce6eccc9f35)}},
+  {{ UINT64_C(0xd170382c4fdf68fb), UINT64_C(0x984d4c3bc9d41aef), UINT64_C(0x1505a2a4f0ae0878)}},
+  {{ UINT64_C(0x295fd3fb89335c81), UINT64_C(0xac69ba7296a13fbe), UINT64_C(0x4ed6a9bd01b73ef0)}},
+  {{ UINT64_C(0x74317834dc57d774), UINT64_C(0xbfdaf9bd7b77ccf1), UINT64_C(0x9250bd9e12d37661)}},
+  {{ UINT64_C(0x3aac7ef28e478932), UINT64_C(0xc769bf95c4befe8e), UINT64_C(0xe70e015f50ac3d6f)}},
+  {{ UINT64_C(0x04de1dd285696f60), UINT64_C(0xf8108cf2f8d6fd13), UINT64_C(0x706756d7a2eb770f)}},
+  {{ UINT64_C(0xa8b5d32a64d3d0d9), UINT64_C(0xb098f077b60e7d4b), UINT64_C(0xd536b5e7f6bbf71f)}},
+  {{ UINT64_C(0x4d6b107feff64aa0), UINT64_C(0x8925b0e416752fb5), UINT64_C(0x65928f0ae5769a62)}},
+  {{ UINT64_C(0xca7133780f5df51e), UINT64_C(0xf5f2fe829a9f2890), UINT64_C(0x0c8a0aa51e4bfa3d)}},
+  {{ UINT64_C(0x299eea997069e650), UINT64_C(0x62d2383df8e90b65), UINT64_C(0x0051c9768e24d577)}},
+  {{ UINT64_C(0x4da1c27a01a09574), UINT64_C(0x3e03beb7d2bc85aa), UINT64_C(0xcacdbc2c45cb2c9b)}},
+  {{ UINT64_C(0xdedb798080669a18), UINT64_C(0x7f90affe0f7f233f), UINT64_C(0x4183fcd325fb00db)}},
+  {{ UINT64_C(0xa243bc13b0b35d78), UINT64_C(0xe7d88e7ba60e90ba), UINT64_C(0x7640a2ca4210b0c4)}},
+  {{ UINT64_C(0x3f90f6049dd95381), UINT64_C(0x0947558bd9695c62), UINT64_C(0xf636c7c7a4e15f0b)}},
+  {{ UINT64_C(0x312abf629f32e7b6), UINT64_C(0x625e9295971705ac), UINT64_C(0x599a79b7a245d3d3)}},
+  {{ UINT64_C(0xc5d5fb5a9ea80c73), UINT64_C(0xb38f337a4c74de91), UINT64_C(0xa0dc0e5f4d85f1d8)}},
+  {{ UINT64_C(0x7f2094bf7775e940), UINT64_C(0x1472b4b515ba9349), UINT64_C(0x561c2b0dbd9e5bb7)}},
+  {{ UINT64_C(0x6101bf433ce85c78), UINT64_C(0x606ebdde13b20d6b), UINT64_C(0x523fca2e2234f05f)}},
+  {{ UINT64_C(0x942c19c39bf470c5), UINT64_C(0x2ea11fa0e93de281), UINT64_C(0x4d9b72019872e96b)}},
+  {{ UINT64_C(0xaa8d47979764566f), UINT64_C(0x160dc3dc4f14368e), UINT64_C(0x54cbbf3a8e8c0d2a)}},
+  {{ UINT64_C(0x485c43988dad077b), UINT64_C(0xb119faef8fb4224e), UINT64_C(0x1503eeebf37b9c16)}},
+  {{ UINT64_C(0xa2ea965a654232b4), UINT64_C(0xe79f66aa36851c46), UINT64_C(0xf070d82a34267348)}},
+  {{ UINT64_C(0x71531ea213e0f2fe), UINT64_C(0x537d1b11974deb53), UINT64_C(0xc4287eb6d27594ab)}},
+  {{ UINT64_C(0xb561e77481eb073c), UINT64_C(0xda05a9e3545e887e), UINT64_C(0xcc4dc4edd9e0408a)}},
+  {{ UINT64_C(0x8f66630ee71a6a09), UINT64_C(0x0fb1833c3ae90442), UINT64_C(0xd1195bada1e9c97d)}},
+  {{ UINT64_C(0xe1889628a30d7f00), UINT64_C(0x95b040db879f5f17), UINT64_C(0x4e9120f24f21f14b)}},
+  {{ UINT64_C(0xacdd9ee2da0fa595), UINT64_C(0x0f6594026111f24f), UINT64_C(0xe658debf040088c3)}},
+  {{ UINT64_C(0x8d8ffb07a2b0ac3c), UINT64_C(0xca62c57ddd93a99d), UINT64_C(0xcb3953179c43abcc)}},
+  {{ UINT64_C(0x03af82818ea4abea), UINT64_C(0xe8a7fede1c00e7e5), UINT64_C(0x946ae207296e87f3)}},
+  {{ UINT64_C(0xe521143b744cd886), UINT64_C(0xdff9986f8949e45e), UINT64_C(0xb5716f755a015492)}},
+  {{ UINT64_C(0xf3a5ec200c033710), UINT64_C(0xf2b668e3d78b9154), UINT64_C(0x4443efa854cb6c54)}},
+  {{ UINT64_C(0x834cf499d4ff86f9), UINT64_C(0x941e4dcb74aa8d15), UINT64_C(0xcd469f7be3060a58)}},
+  {{ UINT64_C(0x95a67358e30a53cf), UINT64_C(0x5fd63655e87b41c8), UINT64_C(0x7e93ad28d2cb4e63)}},
+  {{ UINT64_C(0xcccf2a0e9056df56), UINT64_C(0x893a2d5e4e9be6a0), UINT64_C(0xb850c48e5223e7d9)}},
+  {{ UINT64_C(0xcb01a9bfa21c5629), UINT64_C(0xcba187cd4bcf54e8), UINT64_C(0x459d289a40d6e187)}},
+  {{ UINT64_C(0xeb9b7567589c79b3), UINT64_C(0xb9f69935547fa188), UINT64_C(0xf5f65ddeb17a26e5)}},
+  {{ UINT64_C(0x65aa1a6d0860f366), UINT64_C(0xed3e359f76db6bd2), UINT64_C(0xf8b2b688899f2f82)}},
+  {{ UINT64_C(0x43d2c2b4589c1b5e), UINT64_C(0xb3a490d4a59b8e6b), UINT64_C(0x7492b5d21ebb962c)}},
+  {{ UINT64_C(0x5e8f73e1acbc5f17), UINT64_C(0x8991941d4a8bde41), UINT64_C(0xbb8e890a7b230a9b)}},
+  {{ UINT64_C(0xb7e08b3274eca1d1), UINT64_C(0x6b97296b7ca3761f), UINT64_C(0xfe7a4bc26bcf8e5f)}},
+  {{ UINT64_C(0x744db2e746e1d2cf), UINT64_C(0x388a8e627f943df9), UINT64_C(0xe42cfdd3324da84a)}},
+  {{ UINT64_C(0x52ade51cf16f27d9), UINT64_C(0x95c4dddc57a8c5c0), UINT64_C(0xd2b406dfa2cd611b)}},
+  {{ UINT64_C(0xa7e7507270f129a9), UINT64_C(0xbaa9b94bbcf0ee1c), UINT64_C(0x00db31c825864057)}},
+  {{ UINT64_C(0x7fdf2c041fc65deb), UINT64_C(0xbcd1cd5d1c38f9e3), UINT64_C(0x875c3c86ba6fe472)}},
+  {{ UINT64_C(0x36d6f0d7983fe065), UINT64_C(0x7e01577fb7ae7979), UINT64_C(0x4a4650b9b66dc4d7)}},
+  {{ UINT64_C(0x415dc219a61da948), UINT64_C(0x34f4d57e4878beb7), UINT64_C(0x006dfbb657505233)}},
+  {{ UINT64_C(0xf67326172a9738c4), UINT64_C(0x33b787f770e4fdc6), UINT64_C(0x12ce43017386b22c)}},
+  {{ UINT64_C(0x521b1315300367d7), UINT64_C(0xdcd3366f6adfe56f), UINT64_C(0x626147e563422821)}},
+  {{ UINT64_C(0x03fc1041c0dd5136), UINT64_C(0x282ae54eaf6bf52b), UINT64_C(0x2ececce947188c00)}},
+  {{ UINT64_C(0x37524dd1404e3092), UINT64_C(0xec6782e9a178dad6), UINT64_C(0xaf51bfe84395ce4e)}},
+  {{ UINT64_C(0xed1f7f93fe9a8dd9), UINT64_C(0xe2edd5274b38ded6), UINT64_C(0x44a87711fb0c3b71)}},
+  {{ UINT64_C(0xb6b4383ea804ebaf), UINT64_C(0x048285949fab055c), UINT64_C(0xa4e4e08bd7428cea)}},
+  {{ UINT64_C(0xdd33bfb8768c38f0), UINT64_C(0x1f455cff2522b8cd), UINT64_C(0xfc16a3865846d968)}},
+  {{ UINT64_C(0xcf2bb96539a5cdb1), UINT64_C(0x01dc9fd9e47141af), UINT64_C(0xc9c663b7967ef7c0)}},
+  {{ UINT64_C(0xb4a05b440a14b721), UINT64_C(0xf706a684499e4a36), UINT64_C(0xa41f7df004014d62)}},
+  {{ UINT64_C(0x18f842dc840e7863), UINT64_C(0x28b2df4c55b1842f), UINT64_C(0x47a497d325360efd)}},
+  {{ UINT64_C(0x5d365de527c84524), UINT64_C(0x61253cfbb7ca30db), UINT64_C(0x43a0540b85e4b51c)}},
+  {{ UINT64_C(0x3132e5adb0964f80), UINT64_C(0x12ae8a8883538215), UINT64_C(0xf22775fa145d9808)}},
+  {{ UINT64_C(0x41162273ba9a3c10), UINT64_C(0x814a5df1b3e37f94), UINT64_C(0xc943da3b1a8e8573)}},
+  {{ UINT64_C(0xbd25d06bbcb0e584), UINT64_C(0xccb66dc498164238), UINT64_C(0x97d1a6d1ad7e2ec0)}},
+  {{ UINT64_C(0x15bacdbf15e611c7), UINT64_C(0x6d036fa2aedd037e), UINT64_C(0x53a223c9f08a91b6)}},
+  {{ UINT64_C(0xc92ccc921ebfe0c8), UINT64_C(0x204141fafa610cc3), UINT64_C(0xdad8bcc2cb69b48d)}},
+  {{ UINT64_C(0x06247042d914337b), UINT64_C(0x351b5f3de5afe550), UINT64_C(0x049c5f0be9bafe55)}},
+  {{ UINT64_C(0x2040ecd0e7225dcd), UINT64_C(0x72f6daaa298ec108), UINT64_C(0x2c0212a8530e4aff)}},
+  {{ UINT64_C(0x2c52fc664e963d93), UINT64_C(0xa79365e36d84b507), UINT64_C(0x30d4eb78a7b41fd3)}},
+  {{ UINT64_C(0x68a26a86c36aebae), UINT64_C(0x13bc53086ce0a885), UINT64_C(0x16549874ae1f56c9)}},
+  {{ UINT64_C(0x2c80b39bf5e3f5eb), UINT64_C(0xa391bc593c2b3ff8), UINT64_C(0x98b14fc1b997fcaf)}},
+  {{ UINT64_C(0x1686cfbf3f6869d1), UINT64_C(0xac04f7ad80df5118), UINT64_C(0xeace7941ab1bce64)}},
+  {{ UINT64_C(0xb524fa62adc6fae3), UINT64_C(0x50a34e879c223701), UINT64_C(0x3720480166cae044)}},
+  {{ UINT64_C(0x4d059ea04d9a5fb5), UINT64_C(0x35fdd99fd8fded23), UINT64_C(0xfea75c4dea9b8391)}},
+  {{ UINT64_C(0xcd9fc461bffaf1f1), UINT64_C(0x7b6585b37949b335), UINT64_C(0x2dc1c872683fa14b)}},
+  {{ UINT64_C(0xa9187fda3b6d1e68), UINT64_C(0xe7dded8fa549e60f), UINT64_C(0x858d95588088018c)}},
+  {{ UINT64_C(0xbb0ad4b2509d000a), UINT64_C(0xade3c294174d6cfd), UINT64_C(0x0ccfcc993eb25089)}},
+  {{ UINT64_C(0x5fc6ff3a5e9e39d8), UINT64_C(0x136220899552b62a), UINT64_C(0x8b5b22889b02a333)}},
+  {{ UINT64_C(0xcb3fa7aed0ae43a4), UINT64_C(0xb6474fd90a87251c), UINT64_C(0xdf79523ca1f8d6a8)}},
+  {{ UINT64_C(0x792703bf4e8f80a2), UINT64_C(0x2008aa3b91c8aca2), UINT64_C(0x79dcb548e968701d)}},
+  {{ UINT64_C(0x16e5a7ffabe6c40a), UINT64_C(0x7686803591644afa), UINT64_C(0xf65d269c6db3c2c0)}},
+  {{ UINT64_C(0xfb4ab9b8c76bfdf7), UINT64_C(0x06e41b8faea0fe60), UINT64_C(0xb92e4ecee7677f19)}},
+  {{ UINT64_C(0xe326136cb4b05f0f), UINT64_C(0x077a7efe29d2ad68), UINT64_C(0xb54dcc6ac204960e)}},
+  {{ UINT64_C(0xcfdeeb5ada53b31b), UINT64_C(0x07f9ab07c625926d), UINT64_C(0x96b847cbf4d56d85)}},
+  {{ UINT64_C(0x8d33fe7b98c06bae), UINT64_C(0xef0d83dcc88a7a00), UINT64_C(0x3885d9fead7d4f56)}},
+  {{ UINT64_C(0x5b4c84b6df8deb7d), UINT64_C(0x28cc58e86dd990d8), UINT64_C(0xe6c978270cf6e57c)}},
+  {{ UINT64_C(0x5b922df927644f33), UINT64_C(0x848a30602f1f9376), UINT64_C(0x61ca32d917cc6e76)}},
+  {{ UINT64_C(0x4f91771f9eca96f9), UINT64_C(0xa0613c9265ad976e), UINT64_C(0x62001cfa57373412)}},
+  {{ UINT64_C(0x4acff18ae4f8a2c0), UINT64_C(0x446f32d584ca8c51), UINT64_C(0x97aaf2daeabf6b1f)}},
+  {{ UINT64_C(0x949db86fc40f8da8), UINT64_C(0xcdf86234e962885e), UINT64_C(0x52bc047c686e1d64)}},
+  {{ UINT64_C(0x9f3a455d1ac5cf71), UINT64_C(0x2f48481453dac430), UINT64_C(0x30f7b2b86668cd79)}},
+  {{ UINT64_C(0xd07adc687bd7a618), UINT64_C(0xc176dd9a337d19a7), UINT64_C(0x2dcd9deccb1f839b)}},
+  {{ UINT64_C(0x1e545b46778afc38), UINT64_C(0xc50b3a49779fc780), UINT64_C(0xefa29d0a7dbe4d28)}},
+  {{ UINT64_C(0x144f759156e2a8ae), UINT64_C(0xb3bcf655bfe0ef93), UINT64_C(0x0f1f8d93077277e0)}},
+  {{ UINT64_C(0x3bdece227058cf62), UINT64_C(0x5643bd5d9777f342), UINT64_C(0x15a192b58a2755c1)}},
+  {{ UINT64_C(0x52509281da3de08d), UINT64_C(0x9226e3f7703c668e), UINT64_C(0x12ba01de2667c542)}},
+  {{ UINT64_C(0x134b135e3661374d), UINT64_C(0x29d30812bcf0e712), UINT64_C(0xd63fc1a08971a3dc)}},
+  {{ UINT64_C(0x34f2c91727499b85), UINT64_C(0xdd387b16324634f5), UINT64_C(0xa33a6cbf02150228)}},
+  {{ UINT64_C(0xc89c993a1d1f9653), UINT64_C(0x6d9a7f777a489f8c), UINT64_C(0xdbde17e28f70fe56)}},
+  {{ UINT64_C(0x7f6984474bb1bfda), UINT64_C(0x4502b728d9fe16dd), UINT64_C(0x54d999b5ba67a1b9)}},
+  {{ UINT64_C(0xcf912dbb43ed425d), UINT64_C(0x31e02256e9e19fd5), UINT64_C(0x000f2ae28764740b)}},
+  {{ UINT64_C(0x91e8c4fa079c50a0), UINT64_C(0xa7a776a4620ac746), UINT64_C(0x5dc335e3a9808dac)}},
+  {{ UINT64_C(0x3eb3d8365d3c82ec), UINT64_C(0x148b9f8fb0c83d90), UINT64_C(0x8f82a40d42e5425b)}},
+  {{ UINT64_C(0x1a24f66ace17225a), UINT64_C(0x7f1e60f39b439fea), UINT64_C(0xde7fa1a950489701)}},
+  {{ UINT64_C(0x4940f0155a69021d), UINT64_C(0x37774b87e281b721), UINT64_C(0x5658735dae0d0bb8)}},
+  {{ UINT64_C(0x966245acd18543d9), UINT64_C(0x0827e963bb27afbe), UINT64_C(0x87eac0a528ef3062)}},
+  {{ UINT64_C(0xb208e06587db6fdb), UINT64_C(0x36498041fafa426d), UINT64_C(0xd3822ee820e2c674)}},
+  {{ UINT64_C(0xbb08f92b73927ffa), UINT64_C(0x77ed4da2d2359ec1), UINT64_C(0xe3e7bf8e6c750f8d)}},
+  {{ UINT64_C(0x648b5a4ea32b23b2), UINT64_C(0x8403d4e55bca6af7), UINT64_C(0x09bbffe62170dfc5)}},
+  {{ UINT64_C(0x254d46cd4b322896), UINT64_C(0x5f626b9c0c25707b), UINT64_C(0xd528e7fc48586227)}},
+  {{ UINT64_C(0x7ed35e0dc1902cd5), UINT64_C(0xd88cf4659c00a1da), UINT64_C(0xc4e84d38531ac5ad)}},
+  {{ UINT64_C(0xb87f7830c645e3f0), UINT64_C(0xe81bc2e7ca2859c7), UINT64_C(0x14402b062501c8a8)}},
+  {{ UINT64_C(0xdad178dfaa795576), UINT64_C(0x3866815909d5a35b), UINT64_C(0xd237b8a25bbfd125)}},
+  {{ UINT64_C(0x3b4192a043cc6b88), UINT64_C(0x481ed70c8320d1d9), UINT64_C(0xcb269f4997263877)}},
+  {{ UINT64_C(0x14ea571d4b83744d), UINT64_C(0xdee1613af0602643), UINT64_C(0x81d3d3082a2fc7d3)}},
+  {{ UINT64_C(0x401e3145de9f0898), UINT64_C(0x02007e05aad35262), UINT64_C(0x81b528be520534c0)}},
+  {{ UINT64_C(0xad4653ff88447df1), UINT64_C(0x8f8e0a38b93f8ca1), UINT64_C(0xe58b433e35e3be84)}},
+  {{ UINT64_C(0x42933ea0a02db68c), UINT64_C(0xb719749d27c3bd5b), UINT64_C(0xd50071bbc6ae1b05)}},
+  {{ UINT64_C(0x04da8e35fe117d96), UINT64_C(0xe394ccdc58bb2117), UINT64_C(0x450ca151b05e4db5)}},
+  {{ UINT64_C(0x159ff446631ffcbb), UINT64_C(0x78bb88baebe7ee11), UINT64_C(0xe2eef62ee414e371)}},
+  {{ UINT64_C(0x52e9fcef1244b29a), UINT64_C(0xad3498baf98f5c9d), UINT64_C(0x2c6c52810e95acad)}},
+  {{ UINT64_C(0xe2592c4eb827f642), UINT64_C(0x1c5d5717bc388d70), UINT64_C(0x665f6e9c9c314622)}},
+  {{ UINT64_C(0x7b60e768f34aa317), UINT64_C(0xc135dc51a4e0bb70), UINT64_C(0x347b2a3f915f32fd)}},
+  {{ UINT64_C(0x48c700aa00033691), UINT64_C(0x9e7948da51816333), UINT64_C(0xb28cb8970f1ad1f3)}},
+  {{ UINT64_C(0x0542e0adaccfa8d1), UINT64_C(0xa52772898fc625b9), UINT64_C(0xd0db08b3169d2f7c)}},
+  {{ UINT64_C(0xa4cd270458f9d164), UINT64_C(0xe428bcbf503621ed), UINT64_C(0x381ffe5f77ef281e)}},
+  {{ UINT64_C(0xc16a60a8e5080935), UINT64_C(0x937ca34e031a4071), UINT64_C(0xb9fa722a61b06fc0)}},
+  {{ UINT64_C(0x01e3839e9f2bb352), UINT64_C(0x02f657484821c5c0), UINT64_C(0xda5af7598684f39f)}},
+  {{ UINT64_C(0xd5313e78d4707d88), UINT64_C(0xcf9cb9c2e5b63421), UINT64_C(0x2bcb25ebd11dcc25)}},
+  {{ UINT64_C(0x7eeea2ef4924f0ed), UINT64_C(0xfb43d11fa6f75528), UINT64_C(0xc97b9e0c45be28bb)}},
+  {{ UINT64_C(0x5535e8d42638770b), UINT64_C(0xce2dc575e0ea828b), UINT64_C(0xcafa6e27b751d6c6)}},
+  {{ UINT64_C(0x85f66224d5f5d595), UINT64_C(0x934a4f0dbb81e123), UINT64_C(0x3b7785b1ae3a07eb)}},
+  {{ UINT64_C(0xd9285e77c3011871), UINT64_C(0x67e5f379a84f145a), UINT64_C(0x799bd4be2bb54d07)}},
+  {{ UINT64_C(0x551df71c61bb60eb), UINT64_C(0x7d907a5fb328e063), UINT64_C(0x70cfa517c692f212)}},
+  {{ UINT64_C(0xec41ca780a2ddc46), UINT64_C(0x582856679637f4b2), UINT64_C(0xfb4dc45f15b67c15)}},
+  {{ UINT64_C(0x9143ea01cde2de5c), UINT64_C(0x956ed6f86de5f994), UINT64_C(0x53d35373e3dbdbc7)}},
+  {{ UINT64_C(0xf89011d93ca0155c), UINT64_C(0x0f9dfb5c0dfba9c9), UINT64_C(0x04715d3c7476ac17)}},
+  {{ UINT64_C(0xb7703bfe900ccb8f), UINT64_C(0xa41489681f6a99bb), UINT64_C(0x6fa76a50b6555b93)}},
+  {{ UINT64_C(0x6d0db6aec87ec3e6), UINT64_C(0x43fa25f29900daaa), UINT64_C(0xe8a7717a7a0ca173)}},
+  {{ UINT64_C(0xf488ec9279559905), UINT64_C(0x9d1995d7f71fb8dd), UINT64_C(0xfe5721267210deb4)}},
+  {{ UINT64_C(0xbeedda7c48554f2a), UINT64_C(0x5ccf06a4d23f5816), UINT64_C(0x01f79a7a91d6493f)}},
+  {{ UINT64_C(0xb693c110e768e0f5), UINT64_C(0x2d2f097b64e728fa), UINT64_C(0xcb7b187f03c5eb8a)}},
+  {{ UINT64_C(0xe735c402f57ca35a), UINT64_C(0xc1e34a3b59fd5cab), UINT64_C(0x095ba369c29a9218)}},
+  {{ UINT64_C(0x3ab44012cf53a42f), UINT64_C(0xb2b824f69174a0a9), UINT64_C(0xb67dcc2bd9a364cb)}},
+  {{ UINT64_C(0x98e01a66d4570c1c), UINT64_C(0xf87550ce01358471), UINT64_C(0x800d0b35879c5c1a)}},
+  {{ UINT64_C(0x4608821b76571dc6), UINT64_C(0x018214bdf499145f), UINT64_C(0xdbfc38c05b3961bc)}},
+  {{ UINT64_C(0x0e20055a5f5abef9), UINT64_C(0x07c096937263c350), UINT64_C(0x8c5631e8c2e10517)}},
+  {{ UINT64_C(0xe0eb25031e43bf18), UINT64_C(0xf6fcb64b2e204bcf), UINT64_C(0xc8aa611fa0e2c208)}},
+  {{ UINT64_C(0xef33bec689b62849), UINT64_C(0xc5407a74074127b1), UINT64_C(0xb298adacf1ba1696)}},
+  {{ UINT64_C(0x1ae0c44d256a38e2), UINT64_C(0x0b2c70be9dbb00a9), UINT64_C(0x5ba1349a23649a25)}},
+  {{ UINT64_C(0x6477fbd5e3cbd889), UINT64_C(0xe4498bce62a422ed), UINT64_C(0x28825f412062f8c3)}},
+  {{ UINT64_C(0x9d7e4dd63cf319b1), UINT64_C(0x35588d68bb82ed9e), UINT64_C(0xeae63e810dae9925)}},
+  {{ UINT64_C(0xf09bcef3577c1d6a), UINT64_C(0x1e1d5a528f07758a), UINT64_C(0xed7a299a3a64fca3)}},
+  {{ UINT64_C(0x8d8d9f7dd0fc8390), UINT64_C(0x00723e8d39d7c1c8), UINT64_C(0x4f1a2a9eecb7d85c)}},
+  {{ UINT64_C(0x48e53683311cb75b), UINT64_C(0x2b1ea2b084995727), UINT64_C(0xe717800c0be93804)}},
+  {{ UINT64_C(0xd11b8ecb93549b01), UINT64_C(0x7f5cac223b16aced), UINT64_C(0xc9c7e7e9a2cd3883)}},
+  {{ UINT64_C(0x0a661561eefa32b9), UINT64_C(0xc0ab810339f1bbd6), UINT64_C(0x781f823082a89345)}},
+  {{ UINT64_C(0x864da0aec19c1bdc), UINT64_C(0x21db1e2fc22d9879), UINT64_C(0xfb78903f4f0ac892)}},
+  {{ UINT64_C(0x3fac95cf980b35f6), UINT64_C(0x253ba6df8bbaea34), UINT64_C(0x66c12bf07cd59acd)}},
+  {{ UINT64_C(0xe9db35ae7d6afa75), UINT64_C(0x73f06b8f5f8e40f1), UINT64_C(0x318a6ff53a57dbe9)}},
+  {{ UINT64_C(0x589a5b5552e024a7), UINT64_C(0x2c1df4851fa1437f), UINT64_C(0x4ecacb027827550b)}},
+  {{ UINT64_C(0x09d41a252d53e531), UINT64_C(0x93f05724b87a799c), UINT64_C(0x3f6ed8fefb5c4e3f)}},
+  {{ UINT64_C(0x761e7f2918343540), UINT64_C(0xee9011560fc85abb), UINT64_C(0xfd84ed40f6bd37c3)}},
+  {{ UINT64_C(0xe5fec0638ae8b507), UINT64_C(0xacdd83941d1b6565), UINT64_C(0xbab23d61681ced41)}},
+  {{ UINT64_C(0x6730d600992ff045), UINT64_C(0x4df239cafb47a5ac), UINT64_C(0xb4efec6f0f33bbb2)}},
+  {{ UINT64_C(0x921d947945305be4), UINT64_C(0x9d22b93227f58d3e), UINT64_C(0xe13de01596ed4f14)}},
+  {{ UINT64_C(0x84c5732dd451adb3), UINT64_C(0x3acfbc024243098b), UINT64_C(0xb7d512e044e53ad4)}},
+  {{ UINT64_C(0x3b08f56c7ffac5ac), UINT64_C(0x4a952bb26fd94c7e), UINT64_C(0xfc98334aa02258e5)}},
+  {{ UINT64_C(0xce9eea8dfc1810d4), UINT64_C(0x2beeb21614d0eacd), UINT64_C(0xe2db6a437a5e743c)}},
+  {{ UINT64_C(0xcba7b0eee7168aec), UINT64_C(0xc95e2fe7261ce739), UINT64_C(0x2650751a43145e79)}},
+  {{ UINT64_C(0x3c8f0d8df4107b96), UINT64_C(0x2e3bdbe8202f5c87), UINT64_C(0x58d0958c592c4e4f)}},
+  {{ UINT64_C(0xda46d412bf2fd40b), UINT64_C(0x9a306f97d252f087), UINT64_C(0x016533832bb73c12)}},
+  {{ UINT64_C(0x4572dc0829bd6830), UINT64_C(0x10522e25d3a53163), UINT64_C(0xd7bb782ed7fd3735)}},
+  {{ UINT64_C(0x93098bddeb004529), UINT64_C(0x0872a11cde8b3116), UINT64_C(0x580d6b1bd6a5f92f)}},
+  {{ UINT64_C(0xbb2c1f9e6d151fe6), UINT64_C(0x57d218ca8259b450), UINT64_C(0x88de208a97f789c5)}},
+  {{ UINT64_C(0x8cfc7a0746247cde), UINT64_C(0x7b1e62255ab6da71), UINT64_C(0xbf476cc61ae57987)}},
+  {{ UINT64_C(0xa56049acf11f94a9), UINT64_C(0x031eabf9767f9ca2), UINT64_C(0x8332de01cc4197d0)}},
+  {{ UINT64_C(0x9b8c5e9ce722c4c3), UINT64_C(0xc08bc0ffb2f01279), UINT64_C(0x9c6841073a500a0a)}},
+  {{ UINT64_C(0xc9193b035a3fd188), UINT64_C(0xb9245a58142c4a85), UINT64_C(0xa99b3351f61daa15)}},
+  {{ UINT64_C(0xcda78b9eef667d6c), UINT64_C(0x6aaebe9ebdbd180f), UINT64_C(0xeb6a452997eca825)}},
+  {{ UINT64_C(0x02c655f8b341c998), UINT64_C(0x2488b4b2eb31ecbf), UINT64_C(0xfb4b42d5bce1f9eb)}},
+  {{ UINT64_C(0x6afc362da9a2a338), UINT64_C(0x9dfb8a903e20fd18), UINT64_C(0x3c847ce0c8da27e6)}},
+  {{ UINT64_C(0x232d514aad1b2b83), UINT64_C(0x0b03a912951792b3), UINT64_C(0xfb0757019d979f31)}},
+  {{ UINT64_C(0x70b4ff938844fb03), UINT64_C(0x732bf2fad19808e7), UINT64_C(0xab5c659795e8fbd9)}},
+  {{ UINT64_C(0x652e35f4336fefbc), UINT64_C(0xeba17406223ae8ad), UINT64_C(0xac81ae4d59750ce1)}},
+  {{ UINT64_C(0x2642641607d0cf2e), UINT64_C(0x459ad2d31f507b36), UINT64_C(0x6ae7a3cc6421a562)}},
+  {{ UINT64_C(0x57c3325791cea18c), UINT64_C(0x17fb996cbbb8a141), UINT64_C(0xb4fb3b493941e351)}},
+  {{ UINT64_C(0x5c5cc88a15114ca8), UINT64_C(0x86105b3cfd782eb7), UINT64_C(0xa9ab20ba4fb5c21d)}},
+  {{ UINT64_C(0xc4058f500d5f81ba), UINT64_C(0x1d6bdc2df4dc02cf), UINT64_C(0xa21cb93e730f6798)}},
+  {{ UINT64_C(0xa6e4d1f47bddf21c), UINT64_C(0x48171a3351c8bc09), UINT64_C(0x50eb6006eff59576)}},
+  {{ UINT64_C(0x9fca89a2539b2067), UINT64_C(0x67685a2635bc59cf), UINT64_C(0xfb374e94f06232a2)}},
+  {{ UINT64_C(0xdf81ce1f4b13d9f4), UINT64_C(0x532ccec3015c8db9), UINT64_C(0x20703a97d72e6b6e)}},
+  {{ UINT64_C(0x5e4919363377b780), UINT64_C(0x12c435dd6536c338), UINT64_C(0xa58868b1ddc2c5e7)}},
+  {{ UINT64_C(0xaac0ca0ede788ae6), UINT64_C(0xf801bc88e65710bb), UINT64_C(0xd1a8e891e8a4c64b)}},
+  {{ UINT64_C(0x1d3420dcd1991922), UINT64_C(0x1fcd7e24e9449521), UINT64_C(0x597623ee48f11fda)}},
+  {{ UINT64_C(0x7eb240ac3a68ddad), UINT64_C(0xfde83d2addc1b40a), UINT64_C(0x2b15afa67f812107)}},
+  {{ UINT64_C(0xb00c90298a15267b), UINT64_C(0x33b72b1858753c64), UINT64_C(0xec0bbd132372eb2e)}},
+  {{ UINT64_C(0xbc4008779cc4c72c), UINT64_C(0xf1e6c1ea7c0f2f0b), UINT64_C(0x0e9cccda524d2586)}},
+  {{ UINT64_C(0x5858db960651feea), UINT64_C(0x4ae6e0dbf25012f5), UINT64_C(0x98136d93b7d438f1)}},
+  {{ UINT64_C(0x7d3ff973fb7cfc44), UINT64_C(0xbef51bfc6e22a7b2), UINT64_C(0x77d0b18777d8997f)}},
+  {{ UINT64_C(0x0a7aadf099cb84a5), UINT64_C(0x5ef5fbdd6a26409c), UINT64_C(0xf18ab8e3bf2b61df)}},
+  {{ UINT64_C(0x5944a2720531cb18), UINT64_C(0xe15b6fbdc5c4f54b), UINT64_C(0x973126bf874a0124)}},
+  {{ UINT64_C(0xbf60814903dc9280), UINT64_C(0xdd01d8e7d13d3319), UINT64_C(0x51deb3d94b6b2f00)}},
+  {{ UINT64_C(0x34debec2019479df), UINT64_C(0xb84ffde009462d63), UINT64_C(0xd23f4c4afd640cb9)}},
+  {{ UINT64_C(0x079b4f17575a8ac2), UINT64_C(0xc4360d2e77bc3e1c), UINT64_C(0x7cb70d0f78477e7f)}},
+  {{ UINT64_C(0x1daf6427826dd17c), UINT64_C(0xbd98690ebe16429d), UINT64_C(0x8794a59c41b71c3d)}},
+  {{ UINT64_C(0x73fc05161897b41f), UINT64_C(0xe44ec9d776a74f3b), UINT64_C(0x9abd0d8ab2b16195)}},
+  {{ UINT64_C(0x82a87d422b30848c), UINT64_C(0x3cb2a26a4bf5d148), UINT64_C(0x19cb9948db95dc02)}},
+  {{ UINT64_C(0xa2edf75ddaa14baf), UINT64_C(0x3a22637338f4a094), UINT64_C(0x83fb9e233d6094c2)}},
+  {{ UINT64_C(0xa6b931282dcfd653), UINT64_C(0x09e3ef976a241f2b), UINT64_C(0x933983d8653a6c28)}},
+  {{ UINT64_C(0x785a42b0d1d1b6e3), UINT64_C(0xd61d0d87b49aa0c8), UINT64_C(0x6b221b4e347bcd25)}},
+  {{ UINT64_C(0x0c49914dc76b2a5e), UINT64_C(0x30682359f2dad1d1), UINT64_C(0x34d8831aa6359260)}},
+  {{ UINT64_C(0x4e42e435c4b6d914), UINT64_C(0x479013b5cb21c983), UINT64_C(0x75d365a7f6b025e1)}},
+  {{ UINT64_C(0xeba4645bc2d92307), UINT64_C(0x573fc14f8fb18e04), UINT64_C(0x9d65938bddfa9b32)}},
+  {{ UINT64_C(0x614d22789447b17d), UINT64_C(0x630c06632515d9ad), UINT64_C(0x2b69ab957a639a30)}},
+  {{ UINT64_C(0xd4302bfe51d7924d), UINT64_C(0xdad8c2ab6eca95a6), UINT64_C(0x7766182f74eef01c)}},
+  {{ UINT64_C(0x996d01ee564fc07e), UINT64_C(0xb78da4d726765d11), UINT64_C(0xbace3534a4a3b6f0)}},
+  {{ UINT64_C(0xef0785b092a4d486), UINT64_C(0xf1ed780716b59794), UINT64_C(0x114657ebf0c57b58)}},
+  {{ UINT64_C(0xd9710a985e75d0c4), UINT64_C(0x8bcf36a935a37a83), UINT64_C(0xf4f4782308f9e8f1)}},
+  {{ UINT64_C(0xfae0c17a40dd2861), UINT64_C(0xf0a94152cd7c1827), UINT64_C(0x4ce39b40d1e58dfe)}},
+  {{ UINT64_C(0x274e25785f1b1983), UINT64_C(0xc173dd96fa6c971c), UINT64_C(0xbd7aafa086162266)}},
+  {{ UINT64_C(0xfee370c87ec948e4), UINT64_C(0x5cacc03c13f7b34f), UINT64_C(0x302036725dd6d13a)}},
+  {{ UINT64_C(0xb5076b89fb4224e1), UINT64_C(0x3fecf382fedf671d), UINT64_C(0xc3ca9dd1e081282f)}},
+  {{ UINT64_C(0x728203cf97721c67), UINT64_C(0x1201af15b0033533), UINT64_C(0xab03486e2e1930cf)}},
+  {{ UINT64_C(0x4224a61ed129ecfe), UINT64_C(0xc46fb455fc061e49), UINT64_C(0x7319b06cdb9d5b81)}},
+  {{ UINT64_C(0x81a1bc67a4536b68), UINT64_C(0x38fb4b91bc27476f), UINT64_C(0x021c247d9851d333)}},
+  {{ UINT64_C(0x483c641d64cc1cf7), UINT64_C(0xc98c255c96448b48), UINT64_C(0x82696c22f8470127)}},
+  {{ UINT64_C(0xe081f4db71f14992), UINT64_C(0x3bd9dd40d826f35c), UINT64_C(0x91f2e2876dd206e0)}},
+  {{ UINT64_C(0x5f5e2dce8682bfd6), UINT64_C(0xfb30276a531df47a), UINT64_C(0x9ce29412f5f22930)}},
+  {{ UINT64_C(0x8ee930b5d5a680aa), UINT64_C(0x4204811d71c00168), UINT64_C(0xd34d17d8325bc536)}},
+  {{ UINT64_C(0x3a98e1fdd4357360), UINT64_C(0x862c6ead1e72e698), UINT64_C(0x2ad79cde250bed37)}},
+  {{ UINT64_C(0xb3601ffafcabe11f), UINT64_C(0xa7e01376b8625890), UINT64_C(0x9be10651c4ac7b54)}},
+  {{ UINT64_C(0x08957b81fd983474), UINT64_C(0xe2a55810c58a2745), UINT64_C(0x6fcdeef7ed9ffba3)}},
+  {{ UINT64_C(0xdf4fd2e1fac6fa21), UINT64_C(0x47496a383ac9890c), UINT64_C(0xdbb2858f803de0be)}},
+  {{ UINT64_C(0xeae3a4cafd34331f), UINT64_C(0xdde523a72935dcf2), UINT64_C(0x51d7ee8d59ee8caf)}},
+  {{ UINT64_C(0xf496e64f6c5fead2), UINT64_C(0x448b6a844c5f8d22), UINT64_C(0x2b9a5ef57b34f424)}},
+  {{ UINT64_C(0x93d17ea2f9495ebc), UINT64_C(0x2d1e6ad6739db9b5), UINT64_C(0x70ba4f83bf2436c3)}},
+  {{ UINT64_C(0x838b8ea7ec643390), UINT64_C(0xf204941430bc3b1f), UINT64_C(0xba8b0c9e28008b86)}},
+  {{ UINT64_C(0xd24126ed6699fd07), UINT64_C(0x114ab9d29c2bfc5a), UINT64_C(0xed61a43e214f071c)}},
+  {{ UINT64_C(0x47beb2166f55d9aa), UINT64_C(0x87fde743befbf95c), UINT64_C(0xc0b16230c2e3dc8e)}},
+  {{ UINT64_C(0xe01814b97003bf5b), UINT64_C(0x85bb2fcdbcfeb009), UINT64_C(0x3676b0b8e05fe1af)}},
+  {{ UINT64_C(0x52ed5885a8664005), UINT64_C(0x19827a35e2ece19e), UINT64_C(0x168121901e234dba)}},
+  {{ UINT64_C(0x5c6dd2030cd29a86), UINT64_C(0x6d1f2f046495def4), UINT64_C(0x856165f1b0bdfef8)}},
+  {{ UINT64_C(0xee9e0de248f43b1d), UINT64_C(0x28560d929b6498d3), UINT64_C(0xaa80892901e062ac)}},
+  {{ UINT64_C(0xb55b578ed024b51c), UINT64_C(0x70b3ef6e17741e74), UINT64_C(0x052b2867ab98848a)}},
+  {{ UINT64_C(0x1c101cc930c8fb83), UINT64_C(0x6ec42ac75b7f7475), UINT64_C(0x07cd64371874ed17)}},
+  {{ UINT64_C(0xa277c3bbde631708), UINT64_C(0x7b7f455be042ffb9), UINT64_C(0x29a8df2f84e6b1e8)}},
+  {{ UINT64_C(0x129453c27621cf7e), UINT64_C(0x4d22b636d8875957), UINT64_C(0xeb295e51dc42e2df)}},
+  {{ UINT64_C(0xc12b531ae54aa5f4), UINT64_C(0x06c53c1d8c9e8014), UINT64_C(0x9f174da7bb5d1e7b)}},
+  {{ UINT64_C(0x610f2e97b9be7b36), UINT64_C(0xcc94d27de4835873), UINT64_C(0xd96a9624f38ef701)}},
+  {{ UINT64_C(0x7b7dcdcf3939ea94), UINT64_C(0x88f8df3ccbc2524f), UINT64_C(0x63e35427383e3e94)}},
+  {{ UINT64_C(0x08bb0b11fbf2b2fc), UINT64_C(0x786a51c41d641da5), UINT64_C(0x5efa8ff74676da7e)}},
+  {{ UINT64_C(0x331b349c8ddf7970), UINT64_C(0xd9b39617a580dead), UINT64_C(0x0c714e552c776256)}},
+  {{ UINT64_C(0x0a7ca9de956491b7), UINT64_C(0xb50753190b9f183c), UINT64_C(0x8193f7471fc460c8)}},
+  {{ UINT64_C(0x2f0efc8dabef2b2d), UINT64_C(0x8859af86b4fb7849), UINT64_C(0x9783c8c69ea1d296)}},
+  {{ UINT64_C(0x8b85f533fecc47bf), UINT64_C(0xe6697565dd994dd6), UINT64_C(0x41c1a67090891c14)}},
+  {{ UINT64_C(0x3efd5221b3879ba7), UINT64_C(0x7445e6f3d90a4b0f), UINT64_C(0x13359adbf9c3b1ed)}},
+  {{ UINT64_C(0xcc4e2301473f90b1), UINT64_C(0x0a4ab5c95cb5e1bf), UINT64_C(0x26a3d38bcb628920)}},
+  {{ UINT64_C(0x97439f72a3854960), UINT64_C(0x440d6e21c5ef4537), UINT64_C(0x1860dd57ef9ac09d)}},
+  {{ UINT64_C(0x5a9bc5e91223fa93), UINT64_C(0xfb95c77c2da70753), UINT64_C(0xbc349ca774f94393)}},
+  {{ UINT64_C(0xb09ec05cca3167f8), UINT64_C(0xfb349ebd3025b577), UINT64_C(0x5dec45d56470b7fe)}},
+  {{ UINT64_C(0x7c6828c265dad065), UINT64_C(0x17b91dbd1f5a2745), UINT64_C(0x7b157e41e7e288e4)}},
+  {{ UINT64_C(0x5c469821c9a7808e), UINT64_C(0xda5c03daf167ea44), UINT64_C(0xe06c712a36795b26)}},
+  {{ UINT64_C(0x7b8de97eaaab463b), UINT64_C(0x3308e124df6798b4), UINT64_C(0xb2be93ccf79083a6)}},
+  {{ UINT64_C(0xb149787658b75f14), UINT64_C(0x78b1211302f9c7c0), UINT64_C(0x16872ab6c00d46cb)}},
+  {{ UINT64_C(0x744dedd71ade45f3), UINT64_C(0xdaa8652c28884db4), UINT64_C(0xb30429da3bd54b43)}},
+  {{ UINT64_C(0x7e0972c748998ca1), UINT64_C(0xcb295a540cd4af43), UINT64_C(0x7450c32e9734ace4)}},
+  {{ UINT64_C(0x6a3b95fa2eb62e11), UINT64_C(0x60cebc438a4ea61c), UINT64_C(0x1d25264a3cdcb8c0)}},
+  {{ UINT64_C(0x1aa8afbea66d0e27), UINT64_C(0x91b722be8bd4e0b4), UINT64_C(0x6abd57496022f8cb)}},
+  {{ UINT64_C(0xfd8c5efe7e683f8d), UINT64_C(0xcf477fedd0f79e90), UINT64_C(0xde983fa4a3257df4)}},
+  {{ UINT64_C(0x841ce8d5082e7223), UINT64_C(0x2f02099e1942f2bb), UINT64_C(0xc71e35b9966a2b2a)}},
+  {{ UINT64_C(0xf387ad466978cf01), UINT64_C(0x941f91f8306e1d4d), UINT64_C(0x5bdf9f2396ad11d6)}},
+  {{ UINT64_C(0x55a48456d6d6a5f8), UINT64_C(0xdf46f0c9675ebf9c), UINT64_C(0xefefe628ca11efff)}},
+  {{ UINT64_C(0x36d0cc607458a025), UINT64_C(0xd645ccd9ff375944), UINT64_C(0xd6fcf3fa61c128e6)}},
+  {{ UINT64_C(0x700f69c255280f40), UINT64_C(0x413f0820f543abf8), UINT64_C(0xd4359ad2d717551f)}},
+  {{ UINT64_C(0x88670bdc04be622a), UINT64_C(0xc3a05bed9b564e08), UINT64_C(0x7fb0447fec67b539)}},
+  {{ UINT64_C(0x2e9487453b860056), UINT64_C(0x1245b4149d71b6bd), UINT64_C(0x2852b1d1620baa01)}},
+  {{ UINT64_C(0x56c68933ac3adb22), UINT64_C(0x436e87677da61ab7), UINT64_C(0x55eb50e27149334e)}},
+  {{ UINT64_C(0x858ad7ef6b6d3bd8), UINT64_C(0xd92a5db7215ce5dd), UINT64_C(0x55906861e93e7a1a)}},
+  {{ UINT64_C(0x0d1352579f4a74e2), UINT64_C(0xaa0bcd65374d3ac0), UINT64_C(0x29d16d329a2ffc1f)}},
+  {{ UINT64_C(0x50e2ba0b9b5921d4), UINT64_C(0x8cf35339f1119372), UINT64_C(0x3c50798930901939)}},
+  {{ UINT64_C(0x248462aa465cf6e1), UINT64_C(0xb0f9f6417784a88d), UINT64_C(0x9fe89a84585fb727)}},
+  {{ UINT64_C(0x55edeb7a6e45c066), UINT64_C(0xe6ed278413d54a8e), UINT64_C(0x08934eda60f9fb84)}},
+  {{ UINT64_C(0x6707f032e5bbd079), UINT64_C(0x1ba3d63d382ef7bd), UINT64_C(0x55acab6c44b57449)}},
+  {{ UINT64_C(0xaded9e72cce16bb3), UINT64_C(0xb21279a83c54fae5), UINT64_C(0x1aa3b8be11099c5c)}},
+  {{ UINT64_C(0x7f7837aed69ec47c), UINT64_C(0x44b36a723bb64bc3), UINT64_C(0x4c40fc79e8096686)}},
+  {{ UINT64_C(0x0b16d0fa80f7ada7), UINT64_C(0x9721b2816e04a686), UINT64_C(0x0e231f8457aefee3)}},
+  {{ UINT64_C(0x99d1d3782301d6e1), UINT64_C(0x26ed888badc8bbc3), UINT64_C(0x0c4e42f52d078e42)}},
+  {{ UINT64_C(0xf9d752df0fae43a4), UINT64_C(0xee78b6ceaf8389e5), UINT64_C(0x8fae0b5e65d8d5c4)}},
+  {{ UINT64_C(0x883867504cf95a65), UINT64_C(0x4191bd38113bc594), UINT64_C(0xa1d93ca04e79a401)}},
+  {{ UINT64_C(0x4c5b8b04de70fea7), UINT64_C(0x93b632b5f6ef276a), UINT64_C(0xf3f528959b7fec05)}},
+  {{ UINT64_C(0x3284b29ae4feca79), UINT64_C(0x5696781c663ac390), UINT64_C(0x8827a0426f20e609)}},
+  {{ UINT64_C(0x53426f586dbf67d7), UINT64_C(0x4d8888233967b139), UINT64_C(0x1f7abf929b1123e7)}},
+  {{ UINT64_C(0x9a263c8926b72468), UINT64_C(0xddd3614c8ce678e5), UINT64_C(0x215ddcb729eb106f)}},
+  {{ UINT64_C(0xf1f8ce749165da98), UINT64_C(0xdea60c4bedc0e2be), UINT64_C(0x2d71876f22deba04)}},
+  {{ UINT64_C(0x2edacaf7bc1f2f26), UINT64_C(0x8490c05a6ce5a513), UINT64_C(0x34f02d683f4f29e5)}},
+  {{ UINT64_C(0xdbdc06d3207b58e7), UINT64_C(0x8f678f90142cd3c7), UINT64_C(0xf0023dca2ed2daf0)}},
+  {{ UINT64_C(0x0413ff69cc875553), UINT64_C(0xc375491c3f7bdc05), UINT64_C(0xb3c0642456dbce7e)}},
+  {{ UINT64_C(0x4d15d174571b73ca), UINT64_C(0xeae6a41f19db1c33), UINT64_C(0xf10ff4ef8b80b515)}},
+  {{ UINT64_C(0xabc55701d63c4676), UINT64_C(0x73bf83f33200f323), UINT64_C(0x287ec01dd7064f0a)}},
+  {{ UINT64_C(0xb132b54882c3c40e), UINT64_C(0x970fd58846e2ce13), UINT64_C(0x5bc8fe637ffdb513)}},
+  {{ UINT64_C(0xe6a8bf952c97bc3e), UINT64_C(0x9cd2164426c1b66b), UINT64_C(0x781fd055829cb7b6)}},
+  {{ UINT64_C(0xe1a0672c82d08ce0), UINT64_C(0x283452bc85623999), UINT64_C(0x273e756ca5043b1b)}},
+  {{ UINT64_C(0xf98332271fd3723b), UINT64_C(0xc8a1f428f1aa0909), UINT64_C(0xc74cf9bf9568e584)}},
+  {{ UINT64_C(0x78504b280c564617), UINT64_C(0x6669c44909038161), UINT64_C(0xeec841c19a9099e3)}},
+  {{ UINT64_C(0x54472562d3c29dce), UINT64_C(0x8d90887fc4db9c13), UINT64_C(0x6222424c2eadedc6)}},
+  {{ UINT64_C(0xe0c1672cd0d27db8), UINT64_C(0xfa8fd5654afb4aa4), UINT64_C(0x635fa40539707610)}},
+  {{ UINT64_C(0xadbc9ee98a45fb4e), UINT64_C(0x5cca52ae725236e2), UINT64_C(0xfe1c1526c519cab9)}},
+  {{ UINT64_C(0x2032f4aa565bc20a), UINT64_C(0x21a4a11ff42bc3ea), UINT64_C(0x5e65a13e259a7ee6)}},
+  {{ UINT64_C(0x9f70c6d038d2e21a), UINT64_C(0x368fdf2fbb7a6009), UINT64_C(0x37b8ac3632419962)}},
+  {{ UINT64_C(0xc7d8a16c4cf48a8d), UINT64_C(0xb636cd39f1af1344), UINT64_C(0x52f38bbb94ebe150)}},
+  {{ UINT64_C(0x28d66d08a7515d52), UINT64_C(0xf1bc61512a1631a8), UINT64_C(0x57e9dbb2bdbc5bc2)}},
+  {{ UINT64_C(0xcf87a6a13d807af6), UINT64_C(0x6a99c8e3fb316a0e), UINT64_C(0xaefb279e4ea4d5c9)}},
+  {{ UINT64_C(0xbefb12a36c77af8b), UINT64_C(0x95f6f80400942b1f), UINT64_C(0x78738f755b98efd8)}},
+  {{ UINT64_C(0x9fb49c1f82376b97), UINT64_C(0xaf3718e178d42d95), UINT64_C(0x0d7ddadb66fd3886)}},
+  {{ UINT64_C(0xaeccc688f4a34802), UINT64_C(0xc15d7f2c66402517), UINT64_C(0xb839131adbd07cb1)}},
+  {{ UINT64_C(0x1ba421b8373ddb28), UINT64_C(0x100a9da3685b31b1), UINT64_C(0xd55945dc6700603f)}},
+  {{ UINT64_C(0x7b79893ff6c806ed), UINT64_C(0x406a9e70fe32e605), UINT64_C(0x9cab7f87e0be3ea5)}},
+  {{ UINT64_C(0xfc21b3470a709ab3), UINT64_C(0xd840a7427765ca70), UINT64_C(0xd82043e09156e6c8)}},
+  {{ UINT64_C(0xbb17a5fc155fa740), UINT64_C(0x0b7042c31ce6be73), UINT64_C(0x3ad675eaf9a1b92d)}},
+  {{ UINT64_C(0x5342ac063fa921ff), UINT64_C(0x603fd81a2ca4297c), UINT64_C(0x8b0788a533a5be73)}},
+  {{ UINT64_C(0x5e133e53f62aec3e), UINT64_C(0x2c86781764120fc3), UINT64_C(0xe023368b660b6518)}},
+  {{ UINT64_C(0xe287e9e5d9aec316), UINT64_C(0x64a6a40e7fc8b465), UINT64_C(0x9c2c28477d87f255)}},
+  {{ UINT64_C(0xe83208d213086cec), UINT64_C(0x40134bfff8f62894), UINT64_C(0x919b523f7b518a02)}},
+  {{ UINT64_C(0x949dd0a4a98a5402), UINT64_C(0x338225810d33a053), UINT64_C(0xad82b25e4c75976e)}},
+  {{ UINT64_C(0xf6b4333be1d5f237), UINT64_C(0x65d00d9fe43ecce1), UINT64_C(0xd80c31823f3060c8)}},
+  {{ UINT64_C(0x02edb62eb26119a2), UINT64_C(0x9d374bc2d9f0fd3a), UINT64_C(0xe829e93962ecf4f5)}},
+  {{ UINT64_C(0xbca051bc16cd43e7), UINT64_C(0x0a68c68e8b0cc4c2), UINT64_C(0x8ffe34f6051615be)}},
+  {{ UINT64_C(0xd94cfeec81ccf911), UINT64_C(0x5e6eb69dad55c276), UINT64_C(0xa825559135aac09c)}},
+  {{ UINT64_C(0x4236011845b4e53e), UINT64_C(0x83be4ed9e2080e30), UINT64_C(0x3ee33bcb4e5b99db)}},
+  {{ UINT64_C(0x8f7231edf600034f), UINT64_C(0x3fee10eecabfa30b), UINT64_C(0x29e48f1fd82637b6)}},
+  {{ UINT64_C(0xcbcb6645f07486ef), UINT64_C(0x586fc33baffc0c8b), UINT64_C(0x873aa8ecba3e9921)}},
+  {{ UINT64_C(0x612b6aa78796a8e0), UINT64_C(0x0d9e40e7d4014bab), UINT64_C(0xdc56933c23daf737)}},
+  {{ UINT64_C(0x85105db5fd7cbbfc), UINT64_C(0x50e9ac66e0cb743e), UINT64_C(0xe336031f4d8d025d)}},
+  {{ UINT64_C(0x22f5793eb80fcd2e), UINT64_C(0x8d434f716c6e874a), UINT64_C(0xb37d4630877e25df)}},
+  {{ UINT64_C(0x7b0ee0d6581fc70f), UINT64_C(0x6c6a92908c2d2c22), UINT64_C(0xe6117cb25f83fb51)}},
+  {{ UINT64_C(0x3bf06fb788ea206c), UINT64_C(0x77498c08d69d8e92), UINT64_C(0x8852230688046009)}},
+  {{ UINT64_C(0xb9edd04f6ef45bca), UINT64_C(0xd27583780431619a), UINT64_C(0xc44e82d49e4c03a8)}},
+  {{ UINT64_C(0xe6989a3075fd87dc), UINT64_C(0x0a64b0f60acc7d01), UINT64_C(0xc194407634480428)}},
+  {{ UINT64_C(0x8460d4815872442b), UINT64_C(0xc56fc8c02e354b25), UINT64_C(0xd0a57863cfa1e0ce)}},
+  {{ UINT64_C(0x1d2ee130e7d91b56), UINT64_C(0x47d6d45bd49b7ec6), UINT64_C(0x29d1db228f5f5aae)}},
+  {{ UINT64_C(0x3ea2da1e9c28f615), UINT64_C(0x4e3370ae31bbfb0a), UINT64_C(0xb21d8771f3dcee2f)}},
+  {{ UINT64_C(0x4e0fed38c29ebc3a), UINT64_C(0xf5b96cf4aac28be9), UINT64_C(0x274a246fbef9f7a8)}},
+  {{ UINT64_C(0x6406deacc8746709), UINT64_C(0x4e7440f76654abda), UINT64_C(0x01f9b32c0426b8c1)}},
+  {{ UINT64_C(0x6ef5030583fd2f46), UINT64_C(0xbb322d518c97864d), UINT64_C(0xed04755004579126)}},
+  {{ UINT64_C(0xff82c9cfdf001056), UINT64_C(0x4cf1f99dcf3f88ec), UINT64_C(0x70c300c0dd93cb20)}},
+  {{ UINT64_C(0x4a266b9c4e1c0892), UINT64_C(0x179bd4bae6ba107f), UINT64_C(0x20d783852b6e39ad)}},
+  {{ UINT64_C(0x755ec02861584b93), UINT64_C(0x00af8a5769624739), UINT64_C(0x659602029b33f0b2)}},
+  {{ UINT64_C(0x4ef33d3f6330983b), UINT64_C(0x49d2ccc75d487949), UINT64_C(0x37d305d64e5cd1d2)}},
+  {{ UINT64_C(0xcf358bafee2f0644), UINT64_C(0x509c5463c6770cb8), UINT64_C(0x7ac7bbd488153688)}},
+  {{ UINT64_C(0x2abd792c696f5c84), UINT64_C(0xa9efcdbcd0036255), UINT64_C(0xaf4130322d0c11db)}},
+  {{ UINT64_C(0x2cdd73dc949d328d), UINT64_C(0x27ef47a9da049e31), UINT64_C(0x31e7861b2808738f)}},
+  {{ UINT64_C(0xaa37c7c177f004f4), UINT64_C(0xbe375b6fb4411bd6), UINT64_C(0x5786fdd5cffd2bb3)}},
+  {{ UINT64_C(0x08bf6a35dc5f9c31), UINT64_C(0xcb8a4fc7fa0ff87b), UINT64_C(0x5fd134c7d613599f)}},
+  {{ UINT64_C(0x7cb94c5e69778c1c), UINT64_C(0xf4b5baedffad25ae), UINT64_C(0x5ced0ed1ed4e0fd0)}},
+  {{ UINT64_C(0x2578b212c03d02e8), UINT64_C(0x77fbe2651197cb26), UINT64_C(0xb2c71da0dfcc3b4d)}},
+  {{ UINT64_C(0x02e070b60e7f9e4e), UINT64_C(0x837a804aa523415a), UINT64_C(0xa72e154ba51dd790)}},
+  {{ UINT64_C(0x759df765c5cab487), UINT64_C(0x29983a98aa8174d0), UINT64_C(0x7d87494fbbaba425)}},
+  {{ UINT64_C(0x59a45ca6d1a5fbff), UINT64_C(0x650424b9c859bfe0), UINT64_C(0xf3772eaf85bcad35)}},
+  {{ UINT64_C(0x56fbd67ad0cb183a), UINT64_C(0xa65c204d358e69ed), UINT64_C(0x3ed324b11e0cd853)}},
+  {{ UINT64_C(0x201c5307e5f01c34), UINT64_C(0xbbf94b14eed71702), UINT64_C(0xf52da1468d2fb46c)}},
+  {{ UINT64_C(0x0e9cb1a659e9a6c5), UINT64_C(0xf4bb694c8e96104d), UINT64_C(0xc8e855a9128d9bda)}},
+  {{ UINT64_C(0x70f6f11221ee306d), UINT64_C(0x9f4aaaa977491498), UINT64_C(0x897ec0f4826bb88a)}},
+  {{ UINT64_C(0xf002d34e4c0dd01c), UINT64_C(0xf9b004dd41ab75e0), UINT64_C(0x732cbecbcd235441)}},
+  {{ UINT64_C(0xccc0cfdb65fc7316), UINT64_C(0xefe425b50e3d2124), UINT64_C(0xe06ebb3a02fb6895)}},
+  {{ UINT64_C(0xd3d3d553a1a7ec54), UINT64_C(0x3f416fd4df6fcd87), UINT64_C(0x4c27616432a1077e)}},
+  {{ UINT64_C(0xbbc8d9e6aff63066), UINT64_C(0x125fe49c6e770391), UINT64_C(0xa9bacfea0b45f63c)}},
+  {{ UINT64_C(0xdd873a8f7ec7605b), UINT64_C(0xb19b95c025af0f00), UINT64_C(0x68f26b6939ec5438)}},
+  {{ UINT64_C(0xc624390b8246e073), UINT64_C(0xf200a65b575a2723), UINT64_C(0xc63261b6551d2e3b)}},
+  {{ UINT64_C(0x25d2f800fb1ae846), UINT64_C(0x0a6346bffcf1893e), UINT64_C(0x10c417d968de449a)}},
+  {{ UINT64_C(0x07b8a9c64ecd191e), UINT64_C(0x1cac16ac1b21636a), UINT64_C(0x97882c7bec10b72d)}},
+  {{ UINT64_C(0xec0f2313c3e7c24c), UINT64_C(0x203cbe5964c2ecd5), UINT64_C(0xdd0d1da943c78a6a)}},
+  {{ UINT64_C(0x20598d3c9c1b5b2c), UINT64_C(0x98aa83541d17d78f), UINT64_C(0x7367dde393359429)}},
+  {{ UINT64_C(0x9bb1a963cb0d72f8), UINT64_C(0x4769762346d8d8b0), UINT64_C(0x8e2b4a32c342020b)}},
+  {{ UINT64_C(0xe156ad1aa3a06131), UINT64_C(0x04cfa2481c369388), UINT64_C(0x6e7fb80fdd10a9aa)}},
+  {{ UINT64_C(0xcae6452c1006c330), UINT64_C(0xb3ed847f822f7170), UINT64_C(0x29713235e38c3927)}},
+  {{ UINT64_C(0xb2980ccc80b4cec6), UINT64_C(0xae03f12983eb5d81), UINT64_C(0x9e7f17821944daf8)}},
+  {{ UINT64_C(0xb2c0c9a6c956e152), UINT64_C(0x826c359499517143), UINT64_C(0x213d886777d449a7)}},
+  {{ UINT64_C(0x4b020e8963856e2b), UINT64_C(0xb33c82f22aa40e1e), UINT64_C(0x6983dc279133d90a)}},
+  {{ UINT64_C(0xae73c1363815e4b6), UINT64_C(0x65c020bb95826456), UINT64_C(0x24a819ba3e98ba12)}},
+  {{ UINT64_C(0x0778bb7ffbe7f0c8), UINT64_C(0x6877f06851601d30), UINT64_C(0xb5445eb9d11d2d82)}},
+  {{ UINT64_C(0x734c9f50c7a53b21), UINT64_C(0x2f9edc248faf30eb), UINT64_C(0x37d1e64150bb6197)}},
+  {{ UINT64_C(0x13e4ad5b7339fe9f), UINT64_C(0x9730df50af9a50a4), UINT64_C(0x9fa46a262bf6f850)}},
+  {{ UINT64_C(0x3ba6a2933b3b1741), UINT64_C(0x9c59adedbb985e75), UINT64_C(0xfe31ab3345296f93)}},
+  {{ UINT64_C(0x6e76c291a6235438), UINT64_C(0xea0c76c424bb6a12), UINT64_C(0xae0ad200d74ff72b)}},
+  {{ UINT64_C(0x4cf9fca69bb08f6e), UINT64_C(0x8919dff10adbd549), UINT64_C(0xf153f1a440d8110f)}},
+  {{ UINT64_C(0x1c6404ffc24c2f03), UINT64_C(0xeeee3dce7c24aac9), UINT64_C(0xf063ddbd454557f5)}},
+  {{ UINT64_C(0xbfa36fdaa1cc044b), UINT64_C(0x66830f207da2a22d), UINT64_C(0x0e2e06a8ec5115db)}},
+  {{ UINT64_C(0x1fcd22b5035169c7), UINT64_C(0x9ae2b3a907abecfe), UINT64_C(0xe06d31a5fa552dcc)}},
+  {{ UINT64_C(0x6cc811a45e58152e), UINT64_C(0xa4bc287729074334), UINT64_C(0x9b7a7c6898bb05b4)}},
+  {{ UINT64_C(0x28d8cd0f05737ab7), UINT64_C(0x14de7ecaeb0336b9), UINT64_C(0x1ccecf4cb0d216d5)}},
+  {{ UINT64_C(0x90aefdbf20b79802), UINT64_C(0x188ad0044efb5841), UINT64_C(0x805257a29ce868ea)}},
+  {{ UINT64_C(0x24357622ae73fe64), UINT64_C(0x251821e9823fd6c1), UINT64_C(0x2a9e9f541ebdc738)}},
+  {{ UINT64_C(0x97b9b5992bf7fd1c), UINT64_C(0xc29bf6e2fcb5150e), UINT64_C(0x974e259260e9c698)}},
+  {{ UINT64_C(0x4b1fb9775a382a46), UINT64_C(0xeed1bf828d7c62ef), UINT64_C(0xdf2fca93b5204eb5)}},
+  {{ UINT64_C(0xb66e979723bd0edd), UINT64_C(0x0fdb71fa1c6c9be9), UINT64_C(0x0cb189c3bd0f36c2)}},
+  {{ UINT64_C(0xf76d3a6867ac081e), UINT64_C(0x1c4305d6b8760db2), UINT64_C(0xcaa6f1a2aaeb2519)}},
+  {{ UINT64_C(0x1797d45364be3c90), UINT64_C(0xff881b74b441a844), UINT64_C(0xc84981ed948834ef)}},
+  {{ UINT64_C(0x52babefceb885821), UINT64_C(0x780f0f80a44efb24), UINT64_C(0xe05150bddc9b59de)}},
+  {{ UINT64_C(0x40d4bf99fa0310db), UINT64_C(0x9a41dded4551bd32), UINT64_C(0xe997a4970cf0c9ab)}},
+  {{ UINT64_C(0xaead1dbbfab7989a), UINT64_C(0x9bb05f7c19228d59), UINT64_C(0xd7c71f0ebae8c8d2)}},
+  {{ UINT64_C(0x5c95812d6305deda), UINT64_C(0x1ce4a9f0b2d66401), UINT64_C(0xdbd33f10d6515a69)}},
+  {{ UINT64_C(0x5c78c835d9936052), UINT64_C(0x1443860602030024), UINT64_C(0x9aa1493ce4f53fa4)}},
+  {{ UINT64_C(0x17c21b86a761cbca), UINT64_C(0x916d3da5baf2b562), UINT64_C(0xe6ae9890b6951ca0)}},
+  {{ UINT64_C(0x2d8400b2a9ccef35), UINT64_C(0x09b769787e88aa32), UINT64_C(0x0e62f167b21463c7)}},
+  {{ UINT64_C(0xae9cfbe9bd65d814), UINT64_C(0xa986f6e62b81a6a6), UINT64_C(0xfe2855239cad344b)}},
+  {{ UINT64_C(0xe65a8fd9efe04625), UINT64_C(0x9ab6b8d6122e415d), UINT64_C(0xd29622099bbae137)}},
+  {{ UINT64_C(0xcff9371e1dfc27fa), UINT64_C(0x1deb44454a4cdc78), UINT64_C(0xb3a84f8b170eb850)}},
+  {{ UINT64_C(0x43ae2e2b88418c66), UINT64_C(0xfed76bd617d813cd), UINT64_C(0x8ab73b4dad8eba25)}},
+  {{ UINT64_C(0x4b75dd76d257167d), UINT64_C(0x6705fce0ef498670), UINT64_C(0x6f0dba5907d16395)}},
+  {{ UINT64_C(0xf805926da2b3946a), UINT64_C(0x348f5aec057fa866), UINT64_C(0xbc97f264c991aa1d)}},
+  {{ UINT64_C(0xeccd53bab86b03b7), UINT64_C(0xcc7b8279dad939be), UINT64_C(0xce1ae35eca1b0813)}},
+  {{ UINT64_C(0x7ee34dbe925532b8), UINT64_C(0xd86c167dcd9057f6), UINT64_C(0x90225cff11a0691c)}},
+  {{ UINT64_C(0xf96361e852e37937), UINT64_C(0xa540a87050e19967), UINT64_C(0x6f7e9a5d7c16138f)}},
+  {{ UINT64_C(0xb422b5c7d4144154), UINT64_C(0x88b7f8300f6f3a07), UINT64_C(0x44465d48c9f73f88)}},
+  {{ UINT64_C(0xb184bf135a1b444f), UINT64_C(0xdbd644d4edcb2842), UINT64_C(0x862303612a11d0a9)}},
+  {{ UINT64_C(0x6bb15964208d2a61), UINT64_C(0x3be9c441d6b8f95b), UINT64_C(0x01c99386d824bf88)}},
+  {{ UINT64_C(0x988168be5a234893), UINT64_C(0x51b60e64786f9fc6), UINT64_C(0x8557af1741a8819d)}},
+  {{ UINT64_C(0xa12c6b1027a30d2c), UINT64_C(0xbe1b54f333583b43), UINT64_C(0x5aaf22cf74b4e365)}},
+  {{ UINT64_C(0x7c33bab087506404), UINT64_C(0xafba2ea625273a51), UINT64_C(0x2d88f9e69c3bcfd0)}},
+  {{ UINT64_C(0xbe9e39c232a47893), UINT64_C(0xf1ee151587244ae1), UINT64_C(0x0bb184682abfa658)}},
+  {{ UINT64_C(0x7fc66a92a2d9d4eb), UINT64_C(0xc93b50b3ddc4449f), UINT64_C(0x7413b7d956c5c492)}},
+  {{ UINT64_C(0xb2e2dec122e39cb0), UINT64_C(0x5ad96b7d0fa311e1), UINT64_C(0x9f1307e621101ca8)}},
+  {{ UINT64_C(0xfa3a36a407c57b99), UINT64_C(0x25c9f6fc99745941), UINT64_C(0x9259bc580b8719a9)}},
+  {{ UINT64_C(0xe7df02168d410c3e), UINT64_C(0x39e3a513c6758dcb), UINT64_C(0xbc2f6e2b64bf9508)}},
+  {{ UINT64_C(0xd74d2e10dd171943), UINT64_C(0x4312aa2c755bf484), UINT64_C(0x60e37659266a2b2e)}},
+  {{ UINT64_C(0x86d289e22f92cf42), UINT64_C(0xf2509ead05bf4e29), UINT64_C(0x92b31dee6b8e3020)}},
+  {{ UINT64_C(0x64680efebbb7b16e), UINT64_C(0x6fa6004ece920f3e), UINT64_C(0xd34193a3128f29df)}},
+  {{ UINT64_C(0xdfeb26eec1fa06f5), UINT64_C(0xa36dca3acd673e79), UINT64_C(0xa3fbd53863e80509)}},
+  {{ UINT64_C(0xa0f883dd4922b4a6), UINT64_C(0xe5539e910bcd3b59), UINT64_C(0xa73d08f757d60755)}},
+  {{ UINT64_C(0xdf75de8b590eeadf), UINT64_C(0x867050ee0bfca5ba), UINT64_C(0x1159228f72f9c65e)}},
+  {{ UINT64_C(0x4b7f7295b1698f94), UINT64_C(0xf14cfe39af85c4a2), UINT64_C(0xcbe15ba3564a459e)}},
+  {{ UINT64_C(0x18e2c413fdbc1910), UINT64_C(0xe808b64fcdc06c4e), UINT64_C(0x48482dbd3934d74b)}},
+  {{ UINT64_C(0xab7183acbf6f4b25), UINT64_C(0x9309b253bf4149a0), UINT64_C(0xc7f0db4912bf9bff)}},
+  {{ UINT64_C(0xe3689d4294c01571), UINT64_C(0x5c295a4d3c9f5f72), UINT64_C(0xd825b4bb5dc37c03)}},
+  {{ UINT64_C(0x30d9d3d401315fec), UINT64_C(0x0c52cb9e78a1ba14), UINT64_C(0x6d46f8adac1557a7)}},
+  {{ UINT64_C(0xf7697d8ab586fcc9), UINT64_C(0xfeadbae9442cde1c), UINT64_C(0x86f40dad157bc5a0)}},
+  {{ UINT64_C(0xdec48903babe878e), UINT64_C(0xe5a30a7fa3384c5e), UINT64_C(0xd64df59dd73d432c)}},
+  {{ UINT64_C(0x82ce496ca0fd81b9), UINT64_C(0xfd89f9f2bfc72fe4), UINT64_C(0x705b2c3f7c96b85f)}},
+  {{ UINT64_C(0x2d9681a049c1baf8), UINT64_C(0x5a016d40e7eea3da), UINT64_C(0x98e1f352e2d7e58a)}},
+  {{ UINT64_C(0x591397911284c285), UINT64_C(0x968d92a4e62e2c5a), UINT64_C(0xc3520f9c71502351)}},
+  {{ UINT64_C(0x71926f3135f29d1c), UINT64_C(0xf87d5cfa6919e284), UINT64_C(0x191fb7c511b230b9)}},
+  {{ UINT64_C(0x18739bbdc5fe09ea), UINT64_C(0xf93aba64d7ed87bc), UINT64_C(0xaf620ff7c7357f6d)}},
+  {{ UINT64_C(0x71b1c0d4b6a99ae1), UINT64_C(0x8b1af7e7a7df6cb5), UINT64_C(0xf0cbe6d567da12f3)}},
+  {{ UINT64_C(0xfce6e0d1fba81e99), UINT64_C(0x1098404ccd64cc2d), UINT64_C(0x430a7e1d4c5883bc)}},
+  {{ UINT64_C(0xc85300caa6d24042), UINT64_C(0xa6857b6924d4685f), UINT64_C(0x690e721624872eeb)}},
+  {{ UINT64_C(0x2ebe8037f70b8167), UINT64_C(0x248982c2cebf73ad), UINT64_C(0x3360bd523dc54f26)}},
+  {{ UINT64_C(0x9c72353435b1dfe0), UINT64_C(0x930169f8a25257e8), UINT64_C(0xd7f139a7fae26ac2)}},
+  {{ UINT64_C(0x225ec21ef35abc55), UINT64_C(0x157f038b0acf3a26), UINT64_C(0x4902a925be09f222)}},
+  {{ UINT64_C(0x6ee7fc891cfc5b76), UINT64_C(0xe8a0283c41c87d8a), UINT64_C(0x3842081ca86f6b18)}},
+  {{ UINT64_C(0x2017317ad8c0fc10), UINT64_C(0x3f94203f7236d6c6), UINT64_C(0x21950df8ebb71b28)}},
+  {{ UINT64_C(0x9416c2cccc56cdec), UINT64_C(0x7e7af3db1a1d7cbd), UINT64_C(0xb5fa0396aca98b7c)}},
+  {{ UINT64_C(0xe1374a755f1e1353), UINT64_C(0x30fbbc75064e7c7b), UINT64_C(0x16bf300cbf7011a7)}},
+  {{ UINT64_C(0x834bfc2c73ca84f1), UINT64_C(0xd4a2aba5c4d6537f), UINT64_C(0xcedf70b9ca299f13)}},
+  {{ UINT64_C(0x700e40931af7d1f0), UINT64_C(0x7b20513b7a72d0d3), UINT64_C(0x82b3377a60ce7157)}},
+  {{ UINT64_C(0x169dd1511c081ae7), UINT64_C(0xdd0be27a9d7e735d), UINT64_C(0x55f0a0b6f19b76f0)}},
+  {{ UINT64_C(0xf5f0a28c423f9029), UINT64_C(0xb846de96c2304c37), UINT64_C(0x5849c1105a6b591c)}},
+  {{ UINT64_C(0x5d8b59c1517faaf9), UINT64_C(0x13bd2b52507d9fed), UINT64_C(0x3cc55ded1ff094e3)}},
+  {{ UINT64_C(0xc25b98a3e49d4d35), UINT64_C(0xdd99ed25928dd464), UINT64_C(0xafbd5a48c3899312)}},
+  {{ UINT64_C(0xe5aff352243a5afe), UINT64_C(0x37df19f4895c8ae2), UINT64_C(0x81734c15659081f7)}},
+  {{ UINT64_C(0xdb163c547cf797ed), UINT64_C(0xf6571c6ef1e22fcd), UINT64_C(0xafe1b247aab929ee)}},
+  {{ UINT64_C(0xe3a853fdaef178db), UINT64_C(0xfd340e685452d974), UINT64_C(0x0cbf8a7f14dada9f)}},
+  {{ UINT64_C(0xd9f07ea5af852ad5), UINT64_C(0xaf7dd3a79d55cc39), UINT64_C(0x1b6bb3711a3c34fa)}},
+  {{ UINT64_C(0x67be44b1fc4af7f0), UINT64_C(0xc3eac477063a25a5), UINT64_C(0x51d110b9617be74e)}},
+  {{ UINT64_C(0xc2dfaa8a84234346), UINT64_C(0xef49ceee50dc8831), UINT64_C(0x2e2af41581823f72)}},
+  {{ UINT64_C(0x1f7d7146b9552999), UINT64_C(0x7dde8f4cee790008), UINT64_C(0x3ed0eeeba37f0494)}},
+  {{ UINT64_C(0x8e592695af6f2750), UINT64_C(0xe981a3525ef96e4f), UINT64_C(0x6fc5e6ced35c8033)}},
+  {{ UINT64_C(0x4dad77a2f7e2a642), UINT64_C(0xa0ad9bccaa386f28), UINT64_C(0x3e0dd84d9ce35164)}},
+  {{ UINT64_C(0x889e67d3513f4d2b), UINT64_C(0x0b35e3cea6c2d4e3), UINT64_C(0xd99d39d30d0ed410)}},
+  {{ UINT64_C(0xeee8a0856113ec2d), UINT64_C(0x229aca6c5c94a556), UINT64_C(0xe6cb2a0f72e0ada4)}},
+  {{ UINT64_C(0xde1f6187486c258c), UINT64_C(0x0c95aaef9bdd5d87), UINT64_C(0x56e0fd2dec55d7b6)}},
+  {{ UINT64_C(0x2e54176c3a11f938), UINT64_C(0x5f1833e82d3acb62), UINT64_C(0x9de09440128f2b0c)}},
+  {{ UINT64_C(0x9ff4c171dcde0453), UINT64_C(0xbc4f1991442ed67f), UINT64_C(0xcf01d65a3b08b81d)}},
+  {{ UINT64_C(0x3928a8fbde4bd897), UINT64_C(0x3d3c42525617412b), UINT64_C(0xf001e3960ead2f60)}},
+  {{ UINT64_C(0xc49f747f31cfc198), UINT64_C(0x2e1745e545ffeb3f), UINT64_C(0x462ed995f6b4aabc)}},
+  {{ UINT64_C(0xdb5b684c887c5fb6), UINT64_C(0xe87bbff526636d54), UINT64_C(0xea94a97e13424579)}},
+  {{ UINT64_C(0x52cfeccea098bf0a), UINT64_C(0x6f1dd3f417a1e25b), UINT64_C(0x341df93c89c514d5)}},
+  {{ UINT64_C(0x96c9b02660346e66), UINT64_C(0x0b5ca520c611ffa6), UINT64_C(0xc79810e9f0cb6463)}},
+  {{ UINT64_C(0x169a626a2b8a6a4d), UINT64_C(0x18584edbb50890a5), UINT64_C(0x3e83d2f6f67f1a0f)}},
+  {{ UINT64_C(0xce9fd927640f4187), UINT64_C(0x0af989057a4cee95), UINT64_C(0x1ed9b1e84022a5fd)}},
+  {{ UINT64_C(0xd3d36bd3a184320e), UINT64_C(0xf9a1bf6b6549250f), UINT64_C(0x609c54632cfa70c2)}},
+  {{ UINT64_C(0x4df287cdc2ffa77d), UINT64_C(0xbaeefdd01e97c239), UINT64_C(0xe35fa9f1b3b2b946)}},
+  {{ UINT64_C(0x0ddcf5a64305d7ef), UINT64_C(0xfd6f5690acc6042c), UINT64_C(0x7d82d553e1f7bfc5)}},
+  {{ UINT64_C(0x2df8c77c6017bc1a), UINT64_C(0xfc60e8fe4fbf0680), UINT64_C(0x5f2d66e197096607)}},
+  {{ UINT64_C(0x429035a70c4101d2), UINT64_C(0x3dca3142440a3236), UINT64_C(0x0e73698bb8581b8a)}},
+  {{ UINT64_C(0x592095c5fa6224a2), UINT64_C(0x153d27004bba98f8), UINT64_C(0xb4340eb89da20151)}},
+  {{ UINT64_C(0xbdc44d79e9a64e8c), UINT64_C(0x9773e2b5814d73c0), UINT64_C(0x54d03cf9625d8fc1)}},
+  {{ UINT64_C(0x951e52234e2928c1), UINT64_C(0x021db4f22f7313e5), UINT64_C(0x9e562cf87810444e)}},
+  {{ UINT64_C(0x28e66d07c48dee67), UINT64_C(0x3ac298c4b02f44e9), UINT64_C(0x711ff433fda97a63)}},
+  {{ UINT64_C(0x6593e69c9f3596b4), UINT64_C(0x50002f2994353662), UINT64_C(0x23e4111fd5f5ff93)}},
+  {{ UINT64_C(0x1ccca14f292689bf), UINT64_C(0xd4fa2e32fb810bd4), UINT64_C(0xe07fd01c082499a7)}},
+  {{ UINT64_C(0xaba671fb6e5e5f7c), UINT64_C(0x617fb15c47eeef17), UINT64_C(0x15974416bb107103)}},
+  {{ UINT64_C(0x692e4f6cb23843c0), UINT64_C(0xb07a0678ad812027), UINT64_C(0x6d11871c57abf0ad)}},
+  {{ UINT64_C(0xb04cf1bb71aeddf8), UINT64_C(0xa5072e36c9ff10dd), UINT64_C(0xde8c3efdeec492e5)}},
+  {{ UINT64_C(0x186dd3098aeb4506), UINT64_C(0x66d8c50041ba6b22), UINT64_C(0x7efe4491bb8dd652)}},
+  {{ UINT64_C(0xb6aa857a5e30f15d), UINT64_C(0x035572cfa61fd1e6), UINT64_C(0xdf7923b869dbedee)}},
+  {{ UINT64_C(0x4cf89f8d2164fb37), UINT64_C(0xab16f8a446635cd8), UINT64_C(0x509e14a4dfcb96e2)}},
+  {{ UINT64_C(0xaeb7f08a32f01300), UINT64_C(0x2c8987dd508489c2), UINT64_C(0x2cd22a25d7e420aa)}},
+  {{ UINT64_C(0x1750daecccd81026), UINT64_C(0x20ae076860c7a2ac), UINT64_C(0x66db28c47a84b5b6)}},
+  {{ UINT64_C(0x0699a0ce12d20f72), UINT64_C(0x0cac1b573de7e031), UINT64_C(0x889736af74106c31)}},
+  {{ UINT64_C(0x4bc7eadbbd930bbd), UINT64_C(0xf55b14b8e300d788), UINT64_C(0x6c7c35272a1f8b1e)}},
+  {{ UINT64_C(0x1b88125b5013a740), UINT64_C(0xdddf107915cc05a5), UINT64_C(0xe7763ec17616ab01)}},
+  {{ UINT64_C(0x7d24785aa31f2df3), UINT64_C(0x6741c51aa70e53e7), UINT64_C(0x086bff01777d2f2b)}},
+  {{ UINT64_C(0x81e712f35ad3a5d8), UINT64_C(0xbb75b5233a3c542f), UINT64_C(0xe9599fa6fa82179e)}},
+  {{ UINT64_C(0xe2fdbb6618dcd5f6), UINT64_C(0xf3b80a5aeffcba5c), UINT64_C(0x350116586d46392e)}},
+  {{ UINT64_C(0x0a3a4c192073fe1d), UINT64_C(0x212c21af1729d0c1), UINT64_C(0x02b8148241efa847)}},
+  {{ UINT64_C(0xda8a62fdcce4ad25), UINT64_C(0x019fd5abf4e0b6d6), UINT64_C(0xd25571ca58a0eb01)}},
+  {{ UINT64_C(0x84fe89bbfb587dcb), UINT64_C(0xd87dc0bccf92f467), UINT64_C(0x953c4b92cdbbab6a)}},
+  {{ UINT64_C(0xdb50ee07f38ecd4a), UINT64_C(0x2e5c1d288724526e), UINT64_C(0xc711f87df90bef64)}},
+  {{ UINT64_C(0x208625f85c397b0a), UINT64_C(0x4791c11cf70715b7), UINT64_C(0xac70e0d0595e1b29)}},
+  {{ UINT64_C(0xfa6cd64cac039754), UINT64_C(0x00d7ea595e960ec5), UINT64_C(0x965a512a74ddb073)}},
+  {{ UINT64_C(0x704125abdd9fdafd), UINT64_C(0xea5822a3e625c5a5), UINT64_C(0x41539607115a50a7)}},
+  {{ UINT64_C(0xb48c0dff4421cfa5), UINT64_C(0xc3aad8c63e2a10f2), UINT64_C(0x3e17f74f33f666e3)}},
+  {{ UINT64_C(0xd8478a7dcd3b525d), UINT64_C(0x5eea5faa60a611d0), UINT64_C(0x5b9a1b499aab5d8a)}},
+  {{ UINT64_C(0xe8e6797c92cd5834), UINT64_C(0x85bdd808f1068de0), UINT64_C(0x141fa3b000c06a53)}},
+  {{ UINT64_C(0x64b23781f197ffde), UINT64_C(0x36fdb32e185af91c), UINT64_C(0x5b8717845c104734)}},
+  {{ UINT64_C(0xf48a73ab9d456ea6), UINT64_C(0x6d2f70fc629a4660), UINT64_C(0x71e1f6a4f4df0d4e)}},
+  {{ UINT64_C(0x7f1879062de88b29), UINT64_C(0x3ce4a2233cd9b628), UINT64_C(0x192d658fb6f5e1f1)}},
+  {{ UINT64_C(0x4746f2c526b5903d), UINT64_C(0x837ff154a305dab2), UINT64_C(0x42f3926f536ff6e9)}},
+  {{ UINT64_C(0xfe528869da1dd759), UINT64_C(0x90b66f5618245a0d), UINT64_C(0xd34ac3048497781a)}},
+  {{ UINT64_C(0x3389643178be5747), UINT64_C(0xeb58eb284b3dc40c), UINT64_C(0x064009bf82574652)}},
+  {{ UINT64_C(0x0c9fe5315ac513ff), UINT64_C(0x00a06242ebc7dbf6), UINT64_C(0x3a4899ab68a6b3e8)}},
+  {{ UINT64_C(0x86ae38db557a9a53), UINT64_C(0x532225a8cd945338), UINT64_C(0x1b4fa002ce2f6d6f)}},
+  {{ UINT64_C(0x4d1ac529f3f2dd0d), UINT64_C(0x094a1bf1dfba916a), UINT64_C(0x8db38ec7366deb93)}},
+  {{ UINT64_C(0xc50a0629efd47274), UINT64_C(0xeaa7a384efbbba73), UINT64_C(0x9921893825d97aae)}},
+  {{ UINT64_C(0x10bbcf4b5bcf673f), UINT64_C(0xd3c2ba34f53420be), UINT64_C(0x12faecb3ff2f44be)}},
+  {{ UINT64_C(0x93acb15965a017af), UINT64_C(0x9fcb68bfb1b88f38), UINT64_C(0xc84810800341b712)}},
+  {{ UINT64_C(0xa1921590dd814b9f), UINT64_C(0x526c500a4529ba27), UINT64_C(0xb49748d1e39b9d71)}},
+  {{ UINT64_C(0x613362095d5cb263), UINT64_C(0xc0ea2965b14b6e6a), UINT64_C(0x2e5b8a23fe01445d)}},
+  {{ UINT64_C(0xccafbff1a8b707cc), UINT64_C(0x3cdb9be13f809832), UINT64_C(0x19b7ded6174bd0f7)}},
+  {{ UINT64_C(0x62400ea91e469bb3), UINT64_C(0xf551b6583fb732c9), UINT64_C(0x324eee57559019bc)}},
+  {{ UINT64_C(0xf93b3daad29fde9b), UINT64_C(0x15b376604e0320e1), UINT64_C(0x7c240f2fa00045b0)}},
+  {{ UINT64_C(0x6da0e61ed2a641aa), UINT64_C(0x01f846b929bb4a30), UINT64_C(0xe40cb009a1881e25)}},
+  {{ UINT64_C(0xca7f32024100c80e), UINT64_C(0x96fa1cdcac6b59a9), UINT64_C(0x4ab5ea79810d8261)}},
+  {{ UINT64_C(0x350a376493b71215), UINT64_C(0x70ca78c4bbbf6461), UINT64_C(0x9543fae8f767a64e)}},
+  {{ UINT64_C(0xf81fbedff243fda8), UINT64_C(0x8709d81149b016be), UINT64_C(0xd4ea33b10ad6784f)}},
+  {{ UINT64_C(0x6da37fcb59ce41aa), UINT64_C(0xed110355b906732f), UINT64_C(0x1ab2d63190e3a2e6)}},
+  {{ UINT64_C(0xa969e05ebe9b4671), UINT64_C(0x0dcde76643b88873), UINT64_C(0x1396e9c414bc1ec6)}},
+  {{ UINT64_C(0x47964aa7bcd28e8a), UINT64_C(0x44f8754202e18099), UINT64_C(0xcde95b9fa6e8fb3b)}},
+  {{ UINT64_C(0xe4dfbe7688cd3492), UINT64_C(0xcd2b239edc917ab3), UINT64_C(0x35f720bd5a8be208)}},
+  {{ UINT64_C(0x3cb4fc54138d386d), UINT64_C(0x0f3a6f17eaf24cd6), UINT64_C(0xf4e1726e2119669e)}},
+  {{ UINT64_C(0x8d9e88efe9ad66a6), UINT64_C(0x6570846ed5d0f10c), UINT64_C(0x3b41d13a6a7c3d6b)}},
+  {{ UINT64_C(0x99eefbc96c17702b), UINT64_C(0x29a7f286f2b0445a), UINT64_C(0x48e733dc81e48b4c)}},
+  {{ UINT64_C(0x7626c5eb3a35a2f4), UINT64_C(0x9a44583dfc04cd79), UINT64_C(0x0c75bdd477fc77fa)}},
+  {{ UINT64_C(0xfef2ad875c8804a9), UINT64_C(0x86783e54c0a40455), UINT64_C(0x1c1e664a1102a6c6)}},
+  {{ UINT64_C(0x8564a972b50948c9), UINT64_C(0x676dcf67d6361dc1), UINT64_C(0x106c2c55df11f336)}},
+  {{ UINT64_C(0x4f62c7aa44645f8b), UINT64_C(0xb0b44eee15db33f5), UINT64_C(0x9ed815b3662b0228)}},
+  {{ UINT64_C(0x9d8c28e538dd1080), UINT64_C(0x9049bf7476850ed1), UINT64_C(0x2e4f5da63b65815a)}},
+  {{ UINT64_C(0xc25297c35c1397d9), UINT64_C(0xc74231a18184641f), UINT64_C(0x5ff607a72a4a9bdf)}},
+  {{ UINT64_C(0xec21aa4099c55f4d), UINT64_C(0x0d27d8d740765e81), UINT64_C(0xdf2cbe94599eaa4a)}},
+  {{ UINT64_C(0x41896ca6ad561865), UINT64_C(0xb8362a59ab5d23b6), UINT64_C(0x208e9e1bf4a1447d)}},
+  {{ UINT64_C(0x5da80a0b82780ee7), UINT64_C(0x5e228e5910f295dc), UINT64_C(0x7db2959793635339)}},
+  {{ UINT64_C(0xfa1cd6ae1aae3456), UINT64_C(0xc1d601792ec30b80), UINT64_C(0xfd76f8dbd821d794)}},
+  {{ UINT64_C(0x820f4492446fd6f4), UINT64_C(0xf26f64e5ad00ae01), UINT64_C(0x2cc93b454cd96c07)}},
+  {{ UINT64_C(0x076d98e4f4606f36), UINT64_C(0x65f3809afb99091a), UINT64_C(0x3594d4a962c47262)}},
+  {{ UINT64_C(0x971ed4ea4156f5ee), UINT64_C(0xe7a0961c1cabbf64), UINT64_C(0x3c602437c84bed3e)}},
+  {{ UINT64_C(0xe113bcfe56351c97), UINT64_C(0x8a7d6ce89ea354dd), UINT64_C(0xa6491c02739e8b55)}},
+  {{ UINT64_C(0xbe34e33131619295), UINT64_C(0xb68857caf0407c48), UINT64_C(0x1b9a8064c4b90417)}},
+  {{ UINT64_C(0x7cab522c78136764), UINT64_C(0x0c9a27b0f8f79f4f), UINT64_C(0x4c4ad493e6eddc59)}},
+  {{ UINT64_C(0xfd1bea75eb010724), UINT64_C(0x1d91cea3c6550916), UINT64_C(0xa43f433ac7722ed7)}},
+  {{ UINT64_C(0x521aefb936a5e0ae), UINT64_C(0xe1fc4819fd263871), UINT64_C(0x90e2101bd052196d)}},
+  {{ UINT64_C(0x9b1a44505e35592b), UINT64_C(0xd9ce20780b8b2b43), UINT64_C(0x5966394ffa055ee7)}},
+  {{ UINT64_C(0xd492bcb38f6bf00b), UINT64_C(0x44b5cbcd5cc31c8e), UINT64_C(0x5e9b70d8da991013)}},
+  {{ UINT64_C(0x5767005244573d47), UINT64_C(0xab5f2f3142f6537c), UINT64_C(0xb51672a7956ca813)}},
+  {{ UINT64_C(0x45da7049d8c8a9f8), UINT64_C(0x5ffe05ce1c9fc73e), UINT64_C(0x24505dd7b6afb2fd)}},
+  {{ UINT64_C(0x1b3a1c2c11be743f), UINT64_C(0x0b06ac7be4cc1179), UINT64_C(0xa3f7e4481c3a3b7d)}},
+  {{ UINT64_C(0x3ac432b047776911), UINT64_C(0x22dde202bd2b025d), UINT64_C(0x411c85ed0fc02303)}},
+  {{ UINT64_C(0x85c873615778129e), UINT64_C(0xc31b84a6cb5886df), UINT64_C(0x08218e3dace42947)}},
+  {{ UINT64_C(0x5a6b809008d4af7b), UINT64_C(0x86f905402d3a50a9), UINT64_C(0xd08dd6d9861593b6)}},
+  {{ UINT64_C(0x837a1ab5d2d73def), UINT64_C(0x911ac451f1a01792), UINT64_C(0x7dc9c8220808b10b)}},
+  {{ UINT64_C(0x5b03d41e363201ad), UINT64_C(0xd555ca50fdd1691f), UINT64_C(0x66fe784463c1b6cd)}},
+  {{ UINT64_C(0xdb2943f481ad880d), UINT64_C(0xc65d9ee8f703cbc3), UINT64_C(0xb740f544e7330bca)}},
+  {{ UINT64_C(0x65975150f0fc4ec8), UINT64_C(0xb58fbee2bf004263), UINT64_C(0xb61a41c0c6db782d)}},
+  {{ UINT64_C(0x12d4c70113a8ae46), UINT64_C(0xcac6da6d3c7f4bfa), UINT64_C(0x8e1e034799a5a96a)}},
+  {{ UINT64_C(0x458b34ade37c8af9), UINT64_C(0xb95859cb6065269a), UINT64_C(0xd8a8ca20119332ac)}},
+  {{ UINT64_C(0x686d07d15a18f31e), UINT64_C(0x691c8c03c223e830), UINT64_C(0x0bb5013903f37e38)}},
+  {{ UINT64_C(0xa479dddf27f2129e), UINT64_C(0x8d1abba1db228a73), UINT64_C(0xeaf759eb1aa3ca2d)}},
+  {{ UINT64_C(0x9d94769567de0c38), UINT64_C(0x861a564bbdb29517), UINT64_C(0x78d483a8caa4d874)}},
+  {{ UINT64_C(0xd6e81046f5b20a84), UINT64_C(0x49b09d93490269f8), UINT64_C(0x57360dbf69c8b0f1)}},
+  {{ UINT64_C(0x2cbd6d334f12c699), UINT64_C(0x142f5eacdb9f3c35), UINT64_C(0x3555c4adba0861e7)}},
+  {{ UINT64_C(0x3772d16a80f95f3d), UINT64_C(0xef55069f2f6311bf), UINT64_C(0x912a20c1158b5093)}},
+  {{ UINT64_C(0xd38fdea3e084bde2), UINT64_C(0x8336e924b9f4be0c), UINT64_C(0xedaa7349022ea85e)}},
+  {{ UINT64_C(0x5e396c21759a7bdb), UINT64_C(0xa9ed4ace1d7d5d48), UINT64_C(0x90c2a2ff94d50733)}},
+  {{ UINT64_C(0xe6c54d895f226e24), UINT64_C(0x34e615e6c23ff5b7), UINT64_C(0x93bf026961f56d9e)}},
+  {{ UINT64_C(0x561d6c47cea0a614), UINT64_C(0xa068effd0faa7bfb), UINT64_C(0x67b232a47d90c86e)}},
+  {{ UINT64_C(0x5c3942886c2af3ff), UINT64_C(0x754da4930b7d1d94), UINT64_C(0x066e892e04215d38)}},
+  {{ UINT64_C(0x6b51c1d8dcae4078), UINT64_C(0x009344523725cf01), UINT64_C(0x2b6b4e97f7c53942)}},
+  {{ UINT64_C(0xc629c90e1c43aaea), UINT64_C(0xd74cc256d423f9ba), UINT64_C(0x78c913288ba2c843)}},
+  {{ UINT64_C(0xc300b17e89452a66), UINT64_C(0x9ccb4caf1e84960c), UINT64_C(0x4bc3464241a08148)}},
+  {{ UINT64_C(0x1df2305fa18086a6), UINT64_C(0xc7f1eb7f279262ac), UINT64_C(0x9cfc897f545a0df1)}},
+  {{ UINT64_C(0x8820cf1761e4c38e), UINT64_C(0xc6714a471913c885), UINT64_C(0x18ae9ea6aebb5a70)}},
+  {{ UINT64_C(0xc7098a08279bd2be), UINT64_C(0xa8405619d2b29931), UINT64_C(0x0bd8a669c92d8e6c)}},
+  {{ UINT64_C(0x2ddeb70c76737077), UINT64_C(0x324ca3a4c94dd41b), UINT64_C(0x16ff73e56cba8d3f)}},
+  {{ UINT64_C(0x46d3d7344a6d7eed), UINT64_C(0xee6069623ab56f84), UINT64_C(0x82daf75778b93b4b)}},
+  {{ UINT64_C(0x83a7677cde156a8f), UINT64_C(0x2b6bf032a4ec9092), UINT64_C(0xc6cbb3beba917408)}},
+  {{ UINT64_C(0x68f0854b5f26d78e), UINT64_C(0xb9042ff38cbaf77b), UINT64_C(0xcc5d10383fc06827)}},
+  {{ UINT64_C(0xddac0f2d524fd6e6), UINT64_C(0xef4bcada3ef67ab9), UINT64_C(0xf2341442a7641653)}},
+  {{ UINT64_C(0x1b95aa8dca522374), UINT64_C(0x32060ea8b71fd1a3), UINT64_C(0x52b164703f70c2d9)}},
+  {{ UINT64_C(0xb9637e38cf13a44e), UINT64_C(0xcf307d9f61a41871), UINT64_C(0x125376516d45a6f3)}},
+  {{ UINT64_C(0x35e63a90c091a206), UINT64_C(0x21a370840d415cf2), UINT64_C(0x313e8262ae749c8d)}},
+  {{ UINT64_C(0xbaf3543db77f064f), UINT64_C(0x3a0e29d8efa0cb40), UINT64_C(0x270ccdb10a7d03b9)}},
+  {{ UINT64_C(0x5675c6997ddc3655), UINT64_C(0x42a893624f94b6d2), UINT64_C(0x03a37af4cb7ae096)}},
+  {{ UINT64_C(0xbcf235da0bd515fe), UINT64_C(0xc4a218f5abc4b9e8), UINT64_C(0x1daa588fab35c007)}},
+  {{ UINT64_C(0x25e61ad8742fa535), UINT64_C(0x5127d852667874a3), UINT64_C(0x2628020da7eca041)}},
+  {{ UINT64_C(0x3013eeb2701cdd26), UINT64_C(0xa8c4b154f25bd58f), UINT64_C(0x88f2886fceecc4d3)}},
+  {{ UINT64_C(0xb4478208536a2a00), UINT64_C(0xa42e697557d3ef54), UINT64_C(0xc9da801787c51b3c)}},
+  {{ UINT64_C(0x79f290be0e32c595), UINT64_C(0xd5ac6758323ea1dc), UINT64_C(0xefc8835d6c6e19ba)}},
+  {{ UINT64_C(0x3fef73754b644e95), UINT64_C(0x6c466683d7ff228c), UINT64_C(0xad098f8a4e9eb4e1)}},
+  {{ UINT64_C(0xcc6c6dd79e4cc612), UINT64_C(0xc74db99bf030fa32), UINT64_C(0xfc0d3b0c6f4b5c74)}},
+  {{ UINT64_C(0x7aeccee2c80a0b8f), UINT64_C(0x1e1b0eae28b1c8b2), UINT64_C(0xa6e8ced78a614683)}},
+};
+#endif
+
+/* K_0^-1 | K_0^-1 * K_1 | ... | K_0^-1 * K_4, five packed rows per row */
+static const mzd_row192_t KiS[] = {
+  {{ UINT64_C(0xc19b180074be7fe7), UINT64_C(0xfc593a4912eb26c4), UINT64_C(0x0a3b9e463673ae9d)}},
+  {{ UINT64_C(0x94b752a5ddfae40a), UINT64_C(0x47bf04a93b65d060), UINT64_C(0x1a7cbd698a84a43e)}},
+  {{ UINT64_C(0x40536c8d48d0a943), UINT64_C(0x9b5dc39db1de1c27), UINT64_C(0x3d5d15d52db797df)}},
+  {{ UINT64_C(0xfc3eca7afffef93d), UINT64_C(0xec4cbd60c6615ffd), UINT64_C(0xeb17a50e9a45627f)}},
+  {{ UINT64_C(0x0680eabdf1264235), UINT64_C(0xae7a311d82736fad), UINT64_C(0xf1a34a9244f13fe5)}},
+  {{ UINT64_C(0x719870e6e061065c), UINT64_C(0xf3437c88ce2a1cdb), UINT64_C(0x114e315e1397dfdd)}},
+  {{ UINT64_C(0x09bed29e1b382586), UINT64_C(0x1ee28a5ac1347431), UINT64_C(0x0e945d1f39ba227b)}},
+  {{ UINT64_C(0x8c4fd4fda73b0b85), UINT64_C(0x08924b0711d040e5), UINT64_C(0xec5d9958dd826320)}},
+  {{ UINT64_C(0xcc6f4b844d20574b), UINT64_C(0xbedb46430edf66d5), UINT64_C(0xe273da45393826b2)}},
+  {{ UINT64_C(0x76caca608c0eac65), UINT64_C(0x07c629da5c13348b), UINT64_C(0xc41bcbdf8ec615c3)}},
+  {{ UINT64_C(0xd3ae43abdf90e16e), UINT64_C(0xbecb7c12dc6cf648), UINT64_C(0x6cf5cb79d6f03d78)}},
+  {{ UINT64_C(0x874ebc73ff185036), UINT64_C(0x968b796e11e9a3aa), UINT64_C(0xa727f8a2422534eb)}},
+  {{ UINT64_C(0xd9437d4814e8d8e5), UINT64_C(0x06e656981c5e36f1), UINT64_C(0x6577d4af9ef57fbb)}},
+  {{ UINT64_C(0x73294c95966b3d76), UINT64_C(0xe8dffe5a29dcf5f7), UINT64_C(0xd448a547d8f41dae)}},
+  {{ UINT64_C(0x721027786499fdde), UINT64_C(0x39b22373e8344642), UINT64_C(0x042975aeeb44e9f0)}},
+  {{ UINT64_C(0xfc8be03486902d7d), UINT64_C(0x9fab6f19805263af), UINT64_C(0xd0b76410ac550ec0)}},
+  {{ UINT64_C(0x49237503cdbbddd5), UINT64_C(0x98108bd7c76bda16), UINT64_C(0x2a0f2f7847e53df6)}},
+  {{ UINT64_C(0xed481fcdb42ee77e), UINT64_C(0x3ccae37d7472d824), UINT64_C(0x32943802916644b7)}},
+  {{ UINT64_C(0x69013b06ef3e4389), UINT64_C(0x6f9b54784cef2ecd), UINT64_C(0x4ca62ff95a1bbdb0)}},
+  {{ UINT64_C(0x2bed6a1cb4d4afdb), UINT64_C(0x45b0eacd253e8352), UINT64_C(0x1989585c17ea1688)}},
+  {{ UINT64_C(0xbacf70fc2839d100), UINT64_C(0x9a32c4eec86c7618), UINT64_C(0x3f67266743ca57f2)}},
+  {{ UINT64_C(0xda7240664c427893), UINT64_C(0xe797b20fb0ea2045), UINT64_C(0x8de13cae2e7b5bdf)}},
+  {{ UINT64_C(0x33a4dc1a26404950), UINT64_C(0x3fff0309b7efc90b), UINT64_C(0x153f5f18aa964a14)}},
+  {{ UINT64_C(0xfa44c68bbf657724), UINT64_C(0xb26f8d35c4509fab), UINT64_C(0x0bdfec77b98d4f55)}},
+  {{ UINT64_C(0x50b18e64fd51c1e5), UINT64_C(0xa0ac91c4c0d8e9db), UINT64_C(0xed9620c50b3fc0b2)}},
+  {{ UINT64_C(0xf4d141b56671b664), UINT64_C(0xa65b859f42b815f0), UINT64_C(0x78a07054970efa07)}},
+  {{ UINT64_C(0x5cd5291ca4dd4416), UINT64_C(0xc01293945a6a394b), UINT64_C(0xc9c4ea65c4377fc1)}},
+  {{ UINT64_C(0xa32746a9ac1f8faf), UINT64_C(0x98f278a7a39bcab0), UINT64_C(0x75f4ed8755e037a9)}},
+  {{ UINT64_C(0x8149f223abd56bef), UINT64_C(0x9bb3477095f110a6), UINT64_C(0xb2d4df54a29e7d36)}},
+  {{ UINT64_C(0xfc5a1df32bf44a0c), UINT64_C(0x26f877ac06a3869c), UINT64_C(0x3e90de5f56801499)}},
+  {{ UINT64_C(0x4d4b02022b5b195a), UINT64_C(0x0d9cdb518d398065), UINT64_C(0xe485bdd2267c61f4)}},
+  {{ UINT64_C(0x85dbb9901f240485), UINT64_C(0xfd4832e8b6d4b1ec), UINT64_C(0x5a9c85e3aead0f7d)}},
+  {{ UINT64_C(0x47422324bd6851b9), UINT64_C(0xb13e59d4b1bbc429), UINT64_C(0x701a085ac5b9b143)}},
+  {{ UINT64_C(0x47a7fd97a76b682c), UINT64_C(0x55c2213b1f257640), UINT64_C(0x1d22844e9bce87cd)}},
+  {{ UINT64_C(0x510f4074ed693282), UINT64_C(0x136135ef27272230), UINT64_C(0x65d2f61ad10c5796)}},
+  {{ UINT64_C(0x3f021d1e1608143c), UINT64_C(0x17679339094fed09), UINT64_C(0xba837f0eb37951d2)}},
+  {{ UINT64_C(0x22e540ae553a8f24), UINT64_C(0xd605ae036854b630), UINT64_C(0x3d738a0cf9dc8870)}},
+  {{ UINT64_C(0x12e48ba6c7ca8e92), UINT64_C(0x333aa26fd73f3644), UINT64_C(0xb48bfc9438942488)}},
+  {{ UINT64_C(0x681edea678259089), UINT64_C(0x593f8788a23ca3e7), UINT64_C(0x9d6c8cad240dea23)}},
+  {{ UINT64_C(0x5f3614b4c44bd43a), UINT64_C(0x411e301dbe79a5d9), UINT64_C(0xa21284024c2b7042)}},
+  {{ UINT64_C(0xec32732aacfebf50), UINT64_C(0x3b545adbea56859f), UINT64_C(0x7514178731c915b3)}},
+  {{ UINT64_C(0x591fe0e46c7b2f0d), UINT64_C(0x62f34c0fd8777f6d), UINT64_C(0x21214a2fd525fe9f)}},
+  {{ UINT64_C(0xc56377d390dbdf5a), UINT64_C(0x1fca1ff0843669e4), UINT64_C(0xe0d90e516bf4a716)}},
+  {{ UINT64_C(0x20652066f7837622), UINT64_C(0xbb5194b073e52f3c), UINT64_C(0x2a32978c60a50a84)}},
+  {{ UINT64_C(0xa9b927b96ca719d7), UINT64_C(0xab578f2f0a7d77e3), UINT64_C(0x4aa063ff0138e161)}},
+  {{ UINT64_C(0x3771b4d5f358e259), UINT64_C(0x3dde1d67deba05a9), UINT64_C(0xcb10d61638352b0f)}},
+  {{ UINT64_C(0x290ebb77a8e9d207), UINT64_C(0x505dab141b85ce87), UINT64_C(0xd10a42a8942e480b)}},
+  {{ UINT64_C(0x0f1ee4ff985b9a98), UINT64_C(0xa38dc8e96398ef1e), UINT64_C(0x6ad903bcfc9039bb)}},
+  {{ UINT64_C(0x2aa8756b922e5134), UINT64_C(0x07769f4ae1297692), UINT64_C(0x67f414801037ff2d)}},
+  {{ UINT64_C(0xd00f3ef89235f003), UINT64_C(0xa8b77284a14b4ef5), UINT64_C(0xf5c927f6e1a9b4af)}},
+  {{ UINT64_C(0xbaaac94fedd5c1b0), UINT64_C(0xafdfdfdb34d068fd), UINT64_C(0x10ff3e28a4d2e297)}},
+  {{ UINT64_C(0xdbf365025a1fb757), UINT64_C(0xc996e2cdc08b7d54), UINT64_C(0xed5031afb2e6e783)}},
+  {{ UINT64_C(0x4042e978b1ca1805), UINT64_C(0xa4d12ca70a852843), UINT64_C(0xb3f7bc46aa51c2df)}},
+  {{ UINT64_C(0xb57ade3446c3719d), UINT64_C(0xbbb14f1675d7f148), UINT64_C(0xe736f3c52c81f0ea)}},
+  {{ UINT64_C(0x14fc024c3969b51d), UINT64_C(0xda36a056d4301c38), UINT64_C(0xb162d130ea326226)}},
+  {{ UINT64_C(0xd54dd1f2ee101d5f), UINT64_C(0x2563f71a86a0be61), UINT64_C(0x2e1f5c990017540f)}},
+  {{ UINT64_C(0x980df219b2178555), UINT64_C(0x37377e0e843cf3e1), UINT64_C(0x3b64f94a817c1c3e)}},
+  {{ UINT64_C(0x888980f61ae808a8), UINT64_C(0xb925bb355f036233), UINT64_C(0x2975e039a87b02ff)}},
+  {{ UINT64_C(0x638dbc8a3a1bb256), UINT64_C(0x72a2a99b52c55641), UINT64_C(0xa5b02029aeba68e7)}},
+  {{ UINT64_C(0x6c70fa640f12bda1), UINT64_C(0xb039906127315f28), UINT64_C(0x40fba6b098be8ccc)}},
+  {{ UINT64_C(0xa708c4c3086961c8), UINT64_C(0x19f04278b92ca777), UINT64_C(0xb5ee2949d68007f1)}},
+  {{ UINT64_C(0x3407cb41b45a5681), UINT64_C(0xaf0a11410cfffd5e), UINT64_C(0xd1daa0282783c278)}},
+  {{ UINT64_C(0xe04dcb5407e0d38b), UINT64_C(0xd24c47e373d1faf9), UINT64_C(0xd563a1aad859e144)}},
+  {{ UINT64_C(0x7ac9353e859c27b2), UINT64_C(0x6479d0c112c639ee), UINT64_C(0x372fef41182e501d)}},
+  {{ UINT64_C(0x7b2393d9e410e816), UINT64_C(0x2f8c4a3cfa59c83c), UINT64_C(0xfa10b06e60003c86)}},
+  {{ UINT64_C(0xf715e7e320b89fc0), UINT64_C(0x897a1c8c48bd7cbf), UINT64_C(0xbf93d02111e57f95)}},
+  {{ UINT64_C(0x713e0b6b23a00e9a), UINT64_C(0x7f13e338e282be85), UINT64_C(0xa7fe286e3685b0a8)}},
+  {{ UINT64_C(0x711df08195710636), UINT64_C(0x1d256013a5765564), UINT64_C(0xd0adf456506b9847)}},
+  {{ UINT64_C(0x63631318f42a1004), UINT64_C(0x0ca7e32f47986276), UINT64_C(0x510ced873e98677a)}},
+  {{ UINT64_C(0xaa3c1dab5f58b20b), UINT64_C(0x85a33196a77311a4), UINT64_C(0x496436ac1e987179)}},
+  {{ UINT64_C(0x39fc6834da6641bc), UINT64_C(0x16acf94106b15df7), UINT64_C(0x0f40b62d556d4525)}},
+  {{ UINT64_C(0x548b32685f844892), UINT64_C(0x46086e70dece8420), UINT64_C(0x82be73fbf09119a2)}},
+  {{ UINT64_C(0x1ba59f6632aef05c), UINT64_C(0x8418c6144a6bca40), UINT64_C(0x5ee95ee015e5fcac)}},
+  {{ UINT64_C(0xd76cf27089f41505), UINT64_C(0x348e16b93b2b74b3), UINT64_C(0x56bf1403b312c35d)}},
+  {{ UINT64_C(0xbd3ac69918158408), UINT64_C(0xabb42020636e80a2), UINT64_C(0x900a83b878232f23)}},
+  {{ UINT64_C(0x73da6728338c8b52), UINT64_C(0x2a12bc0bd372c138), UINT64_C(0xb099e097a4f97d0a)}},
+  {{ UINT64_C(0xba7d5681172ed366), UINT64_C(0x3ede692ce424270d), UINT64_C(0xeaf5f8e9b62e441c)}},
+  {{ UINT64_C(0xcfe41fa65fe73764), UINT64_C(0xc71ff8616b6afda3), UINT64_C(0xd052655654bfb935)}},
+  {{ UINT64_C(0xd2ad23493602580b), UINT64_C(0xdeec688ec50b762a), UINT64_C(0xbb4616be1bb367e4)}},
+  {{ UINT64_C(0x0c423ae5577e6c5b), UINT64_C(0x45d45d2f1387355e), UINT64_C(0x7cdc8ba8ff8c4524)}},
+  {{ UINT64_C(0xec574ea394ce924c), UINT64_C(0xb2368c23869be8fc), UINT64_C(0xa053c5b86721f8de)}},
+  {{ UINT64_C(0xd335b28caf9a1d30), UINT64_C(0xc7fda4279cf109ae), UINT64_C(0x30dd9d6013aaa87d)}},
+  {{ UINT64_C(0xebd7966c373b4e13), UINT64_C(0x224efb0a07834127), UINT64_C(0x6b6f3c41b4f3501e)}},
+  {{ UINT64_C(0x846030759982d8ae), UINT64_C(0xf7b2fa4569c03a03), UINT64_C(0xf11619b13cbae44a)}},
+  {{ UINT64_C(0x4c2a230dd68fb5c5), UINT64_C(0xfc1e3d92e05af47a), UINT64_C(0xf5260f987a4fb0f0)}},
+  {{ UINT64_C(0xaa355509b48f6774), UINT64_C(0x5fc9c3dae285856b), UINT64_C(0x22005b39a6fd5dc8)}},
+  {{ UINT64_C(0xebde21e85f6bdfa3), UINT64_C(0x2c2444a6ecd6d373), UINT64_C(0xbcdaeab4d7d16e58)}},
+  {{ UINT64_C(0xb636091045e83f2f), UINT64_C(0xd7e9b97edab8f79d), UINT64_C(0x04baa51ada2e6876)}},
+  {{ UINT64_C(0x96d7ea8e099fdbef), UINT64_C(0xeb2328abc90bfc70), UINT64_C(0x52e1dc750f20a4b1)}},
+  {{ UINT64_C(0x60fb13b6f3a56f15), UINT64_C(0x42941c9b318c99af), UINT64_C(0xb7405bccbf34732f)}},
+  {{ UINT64_C(0xc800e486aa9fc37e), UINT64_C(0x980003e2ab1bcfdd), UINT64_C(0xca859bc3e37f4787)}},
+  {{ UINT64_C(0xdc41f212481bb4d7), UINT64_C(0x54436bb5dac5cd19), UINT64_C(0x481ef2808bab0310)}},
+  {{ UINT64_C(0xc547899c8414eba4), UINT64_C(0x8ab033047f51d43b), UINT64_C(0x895fa026bf86139d)}},
+  {{ UINT64_C(0xf63cef70c0be9796), UINT64_C(0x4346798af90385bc), UINT64_C(0x3c2b661a7dbe6ab5)}},
+  {{ UINT64_C(0x08a1c9f7954aff51), UINT64_C(0x23f487653f54e7ef), UINT64_C(0x0bc76e1620b967b2)}},
+  {{ UINT64_C(0xe723cfe4b4f5df47), UINT64_C(0x9f1890fe5f24031a), UINT64_C(0x45d6ced29cf51b55)}},
+  {{ UINT64_C(0xe752e929ad9f8289), UINT64_C(0x82958e0e9accd791), UINT64_C(0xbba9877f5208edb5)}},
+  {{ UINT64_C(0x1514240c170e3633), UINT64_C(0xac4e330317ba7e6d), UINT64_C(0x366ee16df7462e39)}},
+  {{ UINT64_C(0xde201056b0975562), UINT64_C(0xc4d0fa70c6286662), UINT64_C(0xd7bb1bab09d99708)}},
+  {{ UINT64_C(0x067986e0ebb720c8), UINT64_C(0x5a108ef0a7a90d55), UINT64_C(0xf034919bab1a7edb)}},
+  {{ UINT64_C(0xf941adf3bdb82e3e), UINT64_C(0x521557519cf25df0), UINT64_C(0x530163fcb0b96188)}},
+  {{ UINT64_C(0x64cba604cde973c0), UINT64_C(0x720e4f29986c14a9), UINT64_C(0x6c3b0dee8d7ad53e)}},
+  {{ UINT64_C(0x75c8c6906f0bf9cb), UINT64_C(0x3f9fe42ce4329fd1), UINT64_C(0xd4aa95fea6f4bab9)}},
+  {{ UINT64_C(0x716d11468d8dfe47), UINT64_C(0x1545d5c1afb48a22), UINT64_C(0x839ea18aa625c634)}},
+  {{ UINT64_C(0x1347e696f3337db2), UINT64_C(0xf98912a19ba7a4ab), UINT64_C(0x038fe477809bfefa)}},
+  {{ UINT64_C(0x62488b3540ca2e09), UINT64_C(0x217f0bc5e8db88e6), UINT64_C(0xcd112ba6cb419f31)}},
+  {{ UINT64_C(0xfa919d0a81fb6f03), UINT64_C(0x97a601a846ada584), UINT64_C(0x747eaf729113d50c)}},
+  {{ UINT64_C(0x96bce4734ba2e119), UINT64_C(0xb87a6845f15e7e5e), UINT64_C(0xb4497cb52604b7e3)}},
+  {{ UINT64_C(0x88ecb17f4652bd24), UINT64_C(0x6b6cf0e9bd0e42e6), UINT64_C(0x7c1f85c0ae417171)}},
+  {{ UINT64_C(0x0c43d27afc6cfe90), UINT64_C(0x20df57b7a99b47f2), UINT64_C(0xf54c6e4e92f51629)}},
+  {{ UINT64_C(0x9c20f0ab6fdbf508), UINT64_C(0x1786ef1711a17c04), UINT64_C(0xff9aa68caa02a7c4)}},
+  {{ UINT64_C(0xf9bbd7e069e7b8f0), UINT64_C(0x2ef6fbbdf049422a), UINT64_C(0xae285de75422ea47)}},
+  {{ UINT64_C(0x96605c9705994348), UINT64_C(0x8554a2201350c06c), UINT64_C(0xf6d840b4846b75f0)}},
+  {{ UINT64_C(0x1c6e517b79c1519d), UINT64_C(0x93c14e2dea40fb65), UINT64_C(0x0409c7219c572d11)}},
+  {{ UINT64_C(0x97aa9cfd2c83a68b), UINT64_C(0x5ce4bd15a80fda70), UINT64_C(0x096efbcefe8a92d3)}},
+  {{ UINT64_C(0x3c1640f17335dc79), UINT64_C(0x9c5c594afe7691cd), UINT64_C(0x41035d1cc86c6d6e)}},
+  {{ UINT64_C(0x00ef5e3fee3845d7), UINT64_C(0xa01b01918de004fb), UINT64_C(0xb771d5a3dfdd2423)}},
+  {{ UINT64_C(0x43ff0449ad149cdb), UINT64_C(0x93434e72d8f4a776), UINT64_C(0x050f1ace5c77520a)}},
+  {{ UINT64_C(0x7f60cd6432489377), UINT64_C(0x197ea589d99c77e0), UINT64_C(0xa8227ed119ef7a39)}},
+  {{ UINT64_C(0x0b1ca1a612fc2a59), UINT64_C(0x430386923fc4b183), UINT64_C(0x13d95beadada42ca)}},
+  {{ UINT64_C(0x2ed2a723646d920a), UINT64_C(0x4e5fcaab0cb19309), UINT64_C(0x31d82140518ccaa6)}},
+  {{ UINT64_C(0x557641bda4ae22dc), UINT64_C(0x105fa471dee83a5d), UINT64_C(0x1c7e64033dcc0245)}},
+  {{ UINT64_C(0x852565d043a0fa72), UINT64_C(0x9ec2f6caa8b82583), UINT64_C(0xea0eda943448e300)}},
+  {{ UINT64_C(0x1a3cbef18b906359), UINT64_C(0xe5f1eafe3930e3bb), UINT64_C(0xcf88693f83ddb239)}},
+  {{ UINT64_C(0xbed2525bb724db4a), UINT64_C(0x13379f41357ed05a), UINT64_C(0xa088233ff394246b)}},
+  {{ UINT64_C(0x5287173bc6fd71da), UINT64_C(0x017e4c33b99e3cb4), UINT64_C(0x97e3bf04af047279)}},
+  {{ UINT64_C(0xf746945d7214281a), UINT64_C(0x3bbe1fd19d991835), UINT64_C(0xc68aab2ce2ac0c38)}},
+  {{ UINT64_C(0x0b93399f59e66766), UINT64_C(0x38f13acdadedda74), UINT64_C(0xa292ed6e8f6c9017)}},
+  {{ UINT64_C(0xaee5b7d55430767b), UINT64_C(0xee4246985bd11571), UINT64_C(0x196b9c421c4af173)}},
+  {{ UINT64_C(0x0b2042c56ae1a422), UINT64_C(0xafcc94609a2c089a), UINT64_C(0x51218ca4a30aac97)}},
+  {{ UINT64_C(0xef7bb139c62f7ab3), UINT64_C(0x5c67e5e4234049f4), UINT64_C(0x234d4462bc568c7b)}},
+  {{ UINT64_C(0xd78869dc4d53c898), UINT64_C(0xc112d02a6c2b5f6b), UINT64_C(0x5edd270dbbce3974)}},
+  {{ UINT64_C(0xacfe3ab5885b31ab), UINT64_C(0xba76ac5df385bee1), UINT64_C(0xb032d2c30feb19a9)}},
+  {{ UINT64_C(0x65b22a7b0bfcd2b3), UINT64_C(0x41c5ee7891264e3a), UINT64_C(0x5e41a719446103c5)}},
+  {{ UINT64_C(0xcf9e931383e33d61), UINT64_C(0x216a4aa392a62328), UINT64_C(0xb4ea7adea00c2e61)}},
+  {{ UINT64_C(0xeeec838feaa1abc9), UINT64_C(0x7b35c1d2c62a8cd9), UINT64_C(0x70bcf8261543d77f)}},
+  {{ UINT64_C(0x32f76ba7b36001d6), UINT64_C(0x81a36cbaa3604f02), UINT64_C(0xd3cbb193a041e6eb)}},
+  {{ UINT64_C(0x13b7d0974ddedc31), UINT64_C(0xbc0c80072eff10f1), UINT64_C(0x4213f2a80cde5381)}},
+  {{ UINT64_C(0x1fe2c966681e5c3d), UINT64_C(0xfa3f8487887a5252), UINT64_C(0x996c1d22addab1cc)}},
+  {{ UINT64_C(0x9a909f987410aaa1), UINT64_C(0xccb890d0ff6f19ef), UINT64_C(0x98fa79d8e4872c37)}},
+  {{ UINT64_C(0x05f7465e55175459), UINT64_C(0xaba7c45d7b8e6207), UINT64_C(0x06be60cd30b7e38c)}},
+  {{ UINT64_C(0x13f8c260ff556aba), UINT64_C(0x8342f65bd43c2d58), UINT64_C(0xf70b1a006198e292)}},
+  {{ UINT64_C(0xc92b159cb61367d8), UINT64_C(0x7df22e78ec8a761a), UINT64_C(0xc1727471b74399ea)}},
+  {{ UINT64_C(0xc8b14166442ec964), UINT64_C(0xcd946f1cce578f2b), UINT64_C(0x6c5e7fcddc277fb4)}},
+  {{ UINT64_C(0x2fae798f73ebdf8b), UINT64_C(0xcf848946e29d2469), UINT64_C(0xf9008850bfcfb416)}},
+  {{ UINT64_C(0x82b84bc49107b6fb), UINT64_C(0x48f4118e6bba630d), UINT64_C(0xdcd6b5cfb8d16570)}},
+  {{ UINT64_C(0x598fdf59e3dc8b9a), UINT64_C(0x15844175fc4c9662), UINT64_C(0x6253cf8ba4136115)}},
+  {{ UINT64_C(0x278cb92dd4489aac), UINT64_C(0xc32be751e63b2386), UINT64_C(0x08c5ea83aa56376c)}},
+  {{ UINT64_C(0xe6bc40f946e68f57), UINT64_C(0x1a18e55f5b53ae08), UINT64_C(0x5d9eef06ebab10c6)}},
+  {{ UINT64_C(0xb9fe43bfeda4bb25), UINT64_C(0x447409051a070e6d), UINT64_C(0x42bc65b3c1b3aa07)}},
+  {{ UINT64_C(0xc29d111d94de1778), UINT64_C(0xbeb787993cab9012), UINT64_C(0x045d329cdb567b3f)}},
+  {{ UINT64_C(0xcad62d407aaac538), UINT64_C(0xd278490ca8c7c28b), UINT64_C(0xac709160adf48cbd)}},
+  {{ UINT64_C(0xb35f131cc379fd3a), UINT64_C(0xf0aa7da06214a73f), UINT64_C(0xac4efacc6a0019f3)}},
+  {{ UINT64_C(0xa75c83e48f810bb7), UINT64_C(0x3d74064d66882662), UINT64_C(0xb54d5bb2484c52e6)}},
+  {{ UINT64_C(0xa6b9f742cbe88759), UINT64_C(0xd585fa9aead7d917), UINT64_C(0xebae6e09b14c95f1)}},
+  {{ UINT64_C(0x2c3b97b980c6fa72), UINT64_C(0x4409c86003349bc1), UINT64_C(0x1440899757c6ef36)}},
+  {{ UINT64_C(0x2a7eaeb1aa8a16a2), UINT64_C(0xf197b8ca352109db), UINT64_C(0x2a372f0d8fc00d27)}},
+  {{ UINT64_C(0xb2c3efc367b54390), UINT64_C(0x65008eace710476e), UINT64_C(0x11b9ad979e169d15)}},
+  {{ UINT64_C(0x4c225c369b6b666a), UINT64_C(0x0c2ab82284dac60d), UINT64_C(0xf75e43434c63038e)}},
+  {{ UINT64_C(0x649e948deaaf7d48), UINT64_C(0x171f0ab33cada90e), UINT64_C(0x51ca17ca624a0432)}},
+  {{ UINT64_C(0xf99eec8c2319db54), UINT64_C(0x6af44d36ac30c2f1), UINT64_C(0x2834cc64bbcb9a11)}},
+  {{ UINT64_C(0xad5c7fbfe850279a), UINT64_C(0xc0ece521677c77a6), UINT64_C(0xdd734e70342a1fe5)}},
+  {{ UINT64_C(0xfc7a5219ad412e66), UINT64_C(0xa394e062f0b0e508), UINT64_C(0x5cccab9f0897afd5)}},
+  {{ UINT64_C(0x9806bc5a4869555a), UINT64_C(0xa9730432a7ae6c4d), UINT64_C(0x4782d23b37fc58ba)}},
+  {{ UINT64_C(0x30c76bb5f39047a2), UINT64_C(0x0049c7ae3bf2dec0), UINT64_C(0xd00581846ae0ba4e)}},
+  {{ UINT64_C(0x720ba7dabe2aee52), UINT64_C(0x1ce87d2d24a10c45), UINT64_C(0x5a19a041272a0fb1)}},
+  {{ UINT64_C(0xb66eb1e72dd5447a), UINT64_C(0x878b9856bba021cb), UINT64_C(0xa13e012d7df3fcb9)}},
+  {{ UINT64_C(0xa39481b76722e0ad), UINT64_C(0xb0d2a9e128920c1e), UINT64_C(0xa2407b1976eee518)}},
+  {{ UINT64_C(0x87ee8a4ba6ccbc0c), UINT64_C(0x242d7f0670c2a46e), UINT64_C(0x87679a64d71d04bc)}},
+  {{ UINT64_C(0xac2ffa2f57270d6f), UINT64_C(0xc81007cce58564c2), UINT64_C(0x82ec5b455723dbaa)}},
+  {{ UINT64_C(0xe6d2dccdd5d5a0e6), UINT64_C(0xd7b3fe0bcd9ed267), UINT64_C(0xb992564bb46505c6)}},
+  {{ UINT64_C(0x74130f7eec9c761a), UINT64_C(0xa8197edbed9bb039), UINT64_C(0x549b111716a74451)}},
+  {{ UINT64_C(0xcaf5356bed34dddd), UINT64_C(0x152c43c8daf01c32), UINT64_C(0x931f4737b1f6ad76)}},
+  {{ UINT64_C(0xa2b66b2c78f05cc3), UINT64_C(0x6d61a06c61a0de51), UINT64_C(0x6c035ddb721db913)}},
+  {{ UINT64_C(0x340855472e70bedf), UINT64_C(0x226e996d697786f6), UINT64_C(0x5b9375cf64d42d8f)}},
+  {{ UINT64_C(0xd48677ae2653a572), UINT64_C(0x6c0e8ae6c8b24b57), UINT64_C(0xd7e7473fd186696e)}},
+  {{ UINT64_C(0x9bfd8770e65f614b), UINT64_C(0x8fbf6fbff73e8f87), UINT64_C(0xe4a156ee1bc6c746)}},
+  {{ UINT64_C(0x818e371a424ea9ab), UINT64_C(0xf47a4569b1eff483), UINT64_C(0xfcba4c90916952fe)}},
+  {{ UINT64_C(0xb3a23652ccc1c422), UINT64_C(0x76edb7bff6aa0821), UINT64_C(0x78ca9244a8964bb7)}},
+  {{ UINT64_C(0xc910bf8513f2ff5f), UINT64_C(0x95872bb3be500af8), UINT64_C(0x0d3a13e9c2041667)}},
+  {{ UINT64_C(0x8c72d0465c11dfa5), UINT64_C(0x29dc4b6d3019b7b8), UINT64_C(0xf2e6145564a2a557)}},
+  {{ UINT64_C(0x19bd788c8da2293a), UINT64_C(0x3fb2456a90274e1e), UINT64_C(0x53e46a6e6903cdb3)}},
+  {{ UINT64_C(0xcae218c33806f9c3), UINT64_C(0x539b905eff479ef2), UINT64_C(0x3a859b13c8565881)}},
+  {{ UINT64_C(0x715f5d2ea46cc2ff), UINT64_C(0xc3e63e2b596471c0), UINT64_C(0x1bb773a76b1ec0eb)}},
+  {{ UINT64_C(0xa490a529fbb200c7), UINT64_C(0x7cf85dcd60a6a2a2), UINT64_C(0xecf5377a6baa1428)}},
+  {{ UINT64_C(0xe9a364eef9ca2843), UINT64_C(0xd2a467ea5e1f87ff), UINT64_C(0xc3a497b8348404cd)}},
+  {{ UINT64_C(0xbff97286438d3120), UINT64_C(0x2da26c0dfc45f587), UINT64_C(0xb16484ee21adef58)}},
+  {{ UINT64_C(0x5890b730e7340387), UINT64_C(0x5580a6fe220025c9), UINT64_C(0x0c433c5dbf8da5c0)}},
+  {{ UINT64_C(0xc107cd6683b36a3e), UINT64_C(0x8ded52cdb95649fa), UINT64_C(0x217a8ed9b8b30662)}},
+  {{ UINT64_C(0x2856b89cc0cc65b8), UINT64_C(0x5a99d653f8fe113d), UINT64_C(0x9bb4c7bf407a93c0)}},
+  {{ UINT64_C(0xfd841103fd1a4699), UINT64_C(0xd449c41f6fb0dd4e), UINT64_C(0x0f7dcc8c4aac8b14)}},
+  {{ UINT64_C(0xf3c74f1dfb9f9a59), UINT64_C(0xd5f16788c448cc13), UINT64_C(0x3e77ce365d19e6af)}},
+  {{ UINT64_C(0x07b23a4f25f0c8dd), UINT64_C(0x3939b138dcd832cd), UINT64_C(0x4be632108384f3ae)}},
+  {{ UINT64_C(0xac16addbd48a3bc8), UINT64_C(0x2ced56f79a97a781), UINT64_C(0x53e1f5777eea50a2)}},
+  {{ UINT64_C(0x24fe758ed751d1d2), UINT64_C(0x1b02a5a038d1c4a9), UINT64_C(0x16d8ccb22c5abcb5)}},
+  {{ UINT64_C(0xf0185e70720af39b), UINT64_C(0xc98ad77018b48bdc), UINT64_C(0xc4638385b58452ca)}},
+  {{ UINT64_C(0x92519d7a3180002a), UINT64_C(0x1b39a0cca832c88e), UINT64_C(0x66c10c96b4e2e665)}},
+  {{ UINT64_C(0x7dce8a0addb8551e), UINT64_C(0x1fb0fec50be8d831), UINT64_C(0x61eb3c06f98e5e17)}},
+  {{ UINT64_C(0x2f53d5ac327e7026), UINT64_C(0x1ffdadfb5bf6830f), UINT64_C(0xf8585c6047007dcd)}},
+  {{ UINT64_C(0xba8c6bcc66876802), UINT64_C(0x7960334e0ccc8968), UINT64_C(0xad9300e98585b2c5)}},
+  {{ UINT64_C(0x9f5b09cc04824cce), UINT64_C(0xad10b0ed73cd92e4), UINT64_C(0x4a9c67d449aa8612)}},
+  {{ UINT64_C(0x767c3678d549d77f), UINT64_C(0x79762a3a6159008c), UINT64_C(0x346e3f49a818c003)}},
+  {{ UINT64_C(0x3082af3f6c19d463), UINT64_C(0x53b4e0bf7663b5eb), UINT64_C(0x0c88d625eea48fda)}},
+  {{ UINT64_C(0xf13681d4c6f0bdfb), UINT64_C(0xe2bb8a1379a0b893), UINT64_C(0xc485c63a8b6103e3)}},
+  {{ UINT64_C(0xfff864ffe746c9ee), UINT64_C(0xece00f60ed8e5eac), UINT64_C(0xb430f13e530fcf8f)}},
+  {{ UINT64_C(0x51be2aff78bfdc0e), UINT64_C(0x07881d9b2ca35c89), UINT64_C(0x0f5ae6e13ad94d6c)}},
+  {{ UINT64_C(0xad767203336b4567), UINT64_C(0x68c2d93eacb1128e), UINT64_C(0x5d60d3e08574f541)}},
+  {{ UINT64_C(0x56faad3e86c5c4f0), UINT64_C(0x43e110736180b0b1), UINT64_C(0x4437c87da1178392)}},
+  {{ UINT64_C(0x74453948d2323afd), UINT64_C(0x52a1fdcb8e0534b5), UINT64_C(0x0cc4c8d67dc1f378)}},
+  {{ UINT64_C(0xc85110bd5bbff601), UINT64_C(0xcba0a5740a68797d), UINT64_C(0xc317eab387362b62)}},
+  {{ UINT64_C(0xe09ec263f64f3772), UINT64_C(0x02839871e2691b1c), UINT64_C(0xd77739aa95ecbd73)}},
+  {{ UINT64_C(0x50f3f59025702760), UINT64_C(0x4c899da2a1a2531f), UINT64_C(0x9e72023268090ad7)}},
+  {{ UINT64_C(0x9f359aa094644bd7), UINT64_C(0x4dc4cb09e6edf4d1), UINT64_C(0x1dafe60ee3b1a5d3)}},
+  {{ UINT64_C(0xecea4f3c3ae5fc20), UINT64_C(0x8fe55d0b6cd9c1e0), UINT64_C(0x872189b230e6bec4)}},
+  {{ UINT64_C(0xdb9cc69c3e947907), UINT64_C(0x09144aaecdfbe35a), UINT64_C(0x0249884530ce76b5)}},
+  {{ UINT64_C(0x101851945bd9ac00), UINT64_C(0x19a46b672d06c2c7), UINT64_C(0xb576fcbf7f3cc53a)}},
+  {{ UINT64_C(0xf33e3e87c160ec1c), UINT64_C(0x01d2453d5c376d4e), UINT64_C(0x7589cfc18f73b3c5)}},
+  {{ UINT64_C(0xb6e1f8bedd5e5098), UINT64_C(0x9a338fca3224b300), UINT64_C(0xe8862cdfccaf706d)}},
+  {{ UINT64_C(0x2d2f42969494cbcb), UINT64_C(0x9cfa3172eb18d1a2), UINT64_C(0xa3e8a7301dc6a589)}},
+  {{ UINT64_C(0x3c22d5a91ebb7d00), UINT64_C(0xdcc22c998d2be760), UINT64_C(0x2184e476af4ef216)}},
+  {{ UINT64_C(0x9e35f6c44735446f), UINT64_C(0x066982232900db07), UINT64_C(0x81370a3a73c5f856)}},
+  {{ UINT64_C(0x3fc0af991129fc69), UINT64_C(0x34ac62dccd88cff6), UINT64_C(0xfdf708b463a335a3)}},
+  {{ UINT64_C(0x573bb4c4e1ff6624), UINT64_C(0xb3b4edc8a3ba2bd5), UINT64_C(0x39d7a3829a8108f5)}},
+  {{ UINT64_C(0xee1bd6492eba26a7), UINT64_C(0x2a585b12bb224246), UINT64_C(0x7d6446b43d89d3cc)}},
+  {{ UINT64_C(0x24cddb289f5bde9d), UINT64_C(0x4ac9e316b9a33e09), UINT64_C(0xc8bdcdeae84c4375)}},
+  {{ UINT64_C(0xfbf9c575e952df1c), UINT64_C(0xc434f272320f23db), UINT64_C(0xcb2cc2f935b271df)}},
+  {{ UINT64_C(0x9b4f342d9b6a4aa8), UINT64_C(0xce9cab24bfb7517c), UINT64_C(0x52d957b644792107)}},
+  {{ UINT64_C(0x40c467cf19b037a6), UINT64_C(0x060e89200e4c0b74), UINT64_C(0xa7410a6734375575)}},
+  {{ UINT64_C(0x4f707d00c90a494b), UINT64_C(0x1fc4bfd42193aa08), UINT64_C(0x184a82b587909b8b)}},
+  {{ UINT64_C(0x4ca36dc3ab0e6a42), UINT64_C(0x01dadcd1659a7591), UINT64_C(0x539d3be36e8da342)}},
+  {{ UINT64_C(0x5171bcf0be8d6ebd), UINT64_C(0x431cf33c5f182c47), UINT64_C(0x6809c070f5e3344b)}},
+  {{ UINT64_C(0xae5cf7b27aac494d), UINT64_C(0xff00f03aee92d497), UINT64_C(0x534910658e4d1402)}},
+  {{ UINT64_C(0xa13afe596e391a18), UINT64_C(0xe1fe21059651866e), UINT64_C(0x3e51a00364cdf9e8)}},
+  {{ UINT64_C(0x1f30673f5e8d580f), UINT64_C(0x312adae3f27b70d7), UINT64_C(0xa62d813b6eb9864a)}},
+  {{ UINT64_C(0x1dfe78ede838be79), UINT64_C(0x3c54d4d82379bbc3), UINT64_C(0xfbe76aaf4439b0d6)}},
+  {{ UINT64_C(0x3e0be4d76c863f86), UINT64_C(0x353e99ae5efeafe6), UINT64_C(0x250408e53ee0d15d)}},
+  {{ UINT64_C(0xdcc96cba6cd308d6), UINT64_C(0x3de8828f10c6e27a), UINT64_C(0xed660905cabe936a)}},
+  {{ UINT64_C(0xe8a30b2e8cdf12f7), UINT64_C(0x88566c6b7d459f05), UINT64_C(0x329cc6cdffdc9bae)}},
+  {{ UINT64_C(0x20540cf2ab57d7d8), UINT64_C(0xc8991d32d267ac2b), UINT64_C(0x56ab27224d9761a2)}},
+  {{ UINT64_C(0x87607946ef058767), UINT64_C(0x9e67728cb22ac638), UINT64_C(0x42d0650e940df772)}},
+  {{ UINT64_C(0x1358918935f7fe55), UINT64_C(0x8bcad9bf68a79d92), UINT64_C(0xb58ffb8048d3ed23)}},
+  {{ UINT64_C(0xfbb4424b7e82b010), UINT64_C(0x0060879e997747df), UINT64_C(0x42e9768f96e70224)}},
+  {{ UINT64_C(0xa82da436e1177747), UINT64_C(0x6f6a681de4d21c5f), UINT64_C(0x88abca0d0e49758a)}},
+  {{ UINT64_C(0x1c6c425a2ca6531d), UINT64_C(0x5f9c28d7491a4343), UINT64_C(0x5e519726f385bb62)}},
+  {{ UINT64_C(0x4d20bafa3bb3f897), UINT64_C(0x3a51bedb18f4e742), UINT64_C(0x800bb7975e7913aa)}},
+  {{ UINT64_C(0x526bc9bee79042e9), UINT64_C(0x1847334891cbfdf7), UINT64_C(0x0fd459e69fd9664f)}},
+  {{ UINT64_C(0xd3e23333c5cf7660), UINT64_C(0x9388ae13f64d1db4), UINT64_C(0x35531baaf04d3b5b)}},
+  {{ UINT64_C(0xc727c15e1cda76fc), UINT64_C(0x68e5cc607ecdf009), UINT64_C(0x6a3e9d28c4b56b3f)}},
+  {{ UINT64_C(0x58fe578ba4a911d8), UINT64_C(0x477e9d688f65e453), UINT64_C(0xa2c6671d96974b07)}},
+  {{ UINT64_C(0x637377c2b4ccbb52), UINT64_C(0x92660c935364d943), UINT64_C(0x851f9994bcbd3240)}},
+  {{ UINT64_C(0x7e54308c6ce6fcf5), UINT64_C(0xfe50448d1f5acab9), UINT64_C(0xff9eef6079711bec)}},
+  {{ UINT64_C(0xc2c4dd36572dd00f), UINT64_C(0xbb6095326c3cc9ad), UINT64_C(0x9a6faf1f8791c45e)}},
+  {{ UINT64_C(0x9fc03871e84b8962), UINT64_C(0xc66544928cab5e1b), UINT64_C(0x820ffcc1a902c25a)}},
+  {{ UINT64_C(0x105dde1bc3139203), UINT64_C(0x3055f5739d0ca006), UINT64_C(0x06cb64fa7c6ff3c0)}},
+  {{ UINT64_C(0xe7a82a89008e2788), UINT64_C(0xa010a5366f72300c), UINT64_C(0x8c477d3997974719)}},
+  {{ UINT64_C(0xcf9437f9fa98fb04), UINT64_C(0x1060ef3c90e3d3d1), UINT64_C(0x98fd76655f293e78)}},
+  {{ UINT64_C(0xce9789025ff1df7b), UINT64_C(0xca2d571aef3a8892), UINT64_C(0xe953082fd78f36df)}},
+  {{ UINT64_C(0xdaa4ba77f9f3c54e), UINT64_C(0x74d0b9f009a9e953), UINT64_C(0xa1e9754f3d03e523)}},
+  {{ UINT64_C(0x1d4564e287f08eb3), UINT64_C(0xb4704da719fba5f6), UINT64_C(0x69ceb8ce97d12292)}},
+  {{ UINT64_C(0x7e00d47725cd028d), UINT64_C(0xa885928f70e919ea), UINT64_C(0x12563950d4c5a221)}},
+  {{ UINT64_C(0x9b3b67bcfc11c4ce), UINT64_C(0xa7851cb7efd52fe2), UINT64_C(0x6f277ec9495ccbe2)}},
+  {{ UINT64_C(0xf2ca8e898f464503), UINT64_C(0x4ab70d0347c68178), UINT64_C(0x3b64636db8d53368)}},
+  {{ UINT64_C(0xcaf5cde2e3b24956), UINT64_C(0xa773cd7712c6225d), UINT64_C(0xc8c6ad6fdcd632f5)}},
+  {{ UINT64_C(0xeed61b00c3d6ab7f), UINT64_C(0xa01db66651fc8a5e), UINT64_C(0x18b32fd47dabee31)}},
+  {{ UINT64_C(0x4f2ceb5f2f630440), UINT64_C(0x28944c58b65cb308), UINT64_C(0x8bb6b30d74fdeea7)}},
+  {{ UINT64_C(0x970590183e862d6b), UINT64_C(0xb4efc41eb634f64b), UINT64_C(0xab8a3b2f0c35fa67)}},
+  {{ UINT64_C(0xf11c963a69466ba2), UINT64_C(0x7b2f9ed5e92d9225), UINT64_C(0x83d760f1c63942ee)}},
+  {{ UINT64_C(0x27497012d7c8bdd9), UINT64_C(0x1a2b24bdfc339435), UINT64_C(0xa42182d74ca034f7)}},
+  {{ UINT64_C(0x7f66389b36dfe6e7), UINT64_C(0x036df355d54ae6e4), UINT64_C(0xf211e4de06150e0a)}},
+  {{ UINT64_C(0x36505e462f8a79ae), UINT64_C(0xf48d9bf254041dbf), UINT64_C(0x896aab5fba85e4cd)}},
+  {{ UINT64_C(0xa8f1c12afe64a90e), UINT64_C(0x625a29b9d044547c), UINT64_C(0xcdb33d61a5b4a655)}},
+  {{ UINT64_C(0x3efa0caf57ce26cc), UINT64_C(0x3430f3a1bc8c2c02), UINT64_C(0xf018b902ad1960d9)}},
+  {{ UINT64_C(0x6efb8ee913ad1fce), UINT64_C(0x2c986556e5abb49f), UINT64_C(0x3d6c9f0736e1c033)}},
+  {{ UINT64_C(0x0ad940b889af867a), UINT64_C(0x12ee28c4b19953f5), UINT64_C(0x8403449b8ea19bec)}},
+  {{ UINT64_C(0x593799e810ac876b), UINT64_C(0x2f9e7997d3dadff3), UINT64_C(0xe42478329f010d16)}},
+  {{ UINT64_C(0x4c7bc460334860cc), UINT64_C(0x0a46f199322a1911), UINT64_C(0x69a5786a2b34f5bb)}},
+  {{ UINT64_C(0x5753f3e6734b5fab), UINT64_C(0x4bae265258f3bb24), UINT64_C(0x40b28922040d7bbc)}},
+  {{ UINT64_C(0xa7cc991215721c58), UINT64_C(0x537624fb056fe410), UINT64_C(0xcf42deeb868fef07)}},
+  {{ UINT64_C(0x29a2f31b13289b43), UINT64_C(0x42d562bd7a901588), UINT64_C(0x48d6b35f9e7d6d71)}},
+  {{ UINT64_C(0xde9f7d71e9c8c7a9), UINT64_C(0xc4b4d6c7b6ebdd12), UINT64_C(0xde57faed4389d9f4)}},
+  {{ UINT64_C(0x4ef4ada1d916b61b), UINT64_C(0xd98dc2d5259136b0), UINT64_C(0x70851de656cc941c)}},
+  {{ UINT64_C(0x0014d7ee0c3703e5), UINT64_C(0x035e375a56ce3895), UINT64_C(0x562876ce8f2cbf9e)}},
+  {{ UINT64_C(0xa47eaaec23b7d37c), UINT64_C(0x0a7a86151d41304f), UINT64_C(0xefa97edbb01f674f)}},
+  {{ UINT64_C(0x4e7e4f0835df124c), UINT64_C(0x5fa30831dbdf6bce), UINT64_C(0xfcaf74b95e2ca855)}},
+  {{ UINT64_C(0x25e129a246104d12), UINT64_C(0x308c14eda43a94a5), UINT64_C(0x8df9412adf0c73df)}},
+  {{ UINT64_C(0x5bd09f0dd7a7768b), UINT64_C(0x9fad315d98cbf1c4), UINT64_C(0x6ad08c70da6f16a8)}},
+  {{ UINT64_C(0xb18186c04f9796f4), UINT64_C(0x726603b7f2c77675), UINT64_C(0x09f1c3244fa820cb)}},
+  {{ UINT64_C(0x04b31193a803cc13), UINT64_C(0xbc254e6c10d4454d), UINT64_C(0x6b5a39483f818bff)}},
+  {{ UINT64_C(0xd5d068a4a49290ad), UINT64_C(0x355a92fe5e3ca823), UINT64_C(0x091bf087d5228eaa)}},
+  {{ UINT64_C(0xaca727810717d935), UINT64_C(0xf6aee0edb7d185ff), UINT64_C(0x425abcbeee565f4d)}},
+  {{ UINT64_C(0xa2d9019f3abe0935), UINT64_C(0xc9915c8e82e0ff3a), UINT64_C(0x7b059195599c4863)}},
+  {{ UINT64_C(0x6e62dbc7b4ca1566), UINT64_C(0x7d7576b5a384e9e0), UINT64_C(0x00a783aa182986fa)}},
+  {{ UINT64_C(0x4bf4f51f894f3796), UINT64_C(0xf8b496798b55c661), UINT64_C(0x9c319d34742c1084)}},
+  {{ UINT64_C(0x4c7a3a2a0fd7fc65), UINT64_C(0x437c2f8a670e7ea3), UINT64_C(0x222c50ee92a0e2d2)}},
+  {{ UINT64_C(0x2a231a3c6f3d497f), UINT64_C(0xf2ff149c9e667739), UINT64_C(0x329fa21fe4f1f005)}},
+  {{ UINT64_C(0xefa01d3ccc07d1ca), UINT64_C(0x89d2093a40edfd38), UINT64_C(0x7db6fc5d4bc56301)}},
+  {{ UINT64_C(0xaf27ca2e7e1fc09d), UINT64_C(0x38f7e5b3835b4a02), UINT64_C(0xc82e750b20da2abd)}},
+  {{ UINT64_C(0x3ed27ecce0042713), UINT64_C(0xe5ca12d331208a5a), UINT64_C(0xa8c191d4d674a04f)}},
+  {{ UINT64_C(0x41c3da903527258a), UINT64_C(0xad6c1ced38f1cc0c), UINT64_C(0x174c4cfe9ffe7466)}},
+  {{ UINT64_C(0x356a24a70cb22868), UINT64_C(0x1b40780a99ccf802), UINT64_C(0xa24ca520fd1a9923)}},
+  {{ UINT64_C(0xdaa2efec630afb79), UINT64_C(0x87b6977bc35774f5), UINT64_C(0xfbbf8c8028939696)}},
+  {{ UINT64_C(0x12ee23925cd011c2), UINT64_C(0xe9e99e7a5791f0ac), UINT64_C(0xfdc14cc47b9bcc5c)}},
+  {{ UINT64_C(0xe677c987e1f4e5a0), UINT64_C(0x90421f33b1a78947), UINT64_C(0x6094dc1b9c2056b5)}},
+  {{ UINT64_C(0x37752e6783156d04), UINT64_C(0xffb801211d74eafe), UINT64_C(0xa1e2473e0c830c47)}},
+  {{ UINT64_C(0x880b5b1516da152b), UINT64_C(0x94d65453b89d1e0c), UINT64_C(0x8ff67c88e0073c9f)}},
+  {{ UINT64_C(0xdfdb0bbfeadd87c7), UINT64_C(0xab0e2c153e12d5e7), UINT64_C(0x2941a675e1546339)}},
+  {{ UINT64_C(0x5477d0dc4303f51d), UINT64_C(0x81284fb25f35ecb4), UINT64_C(0xd2bf13fceee615b8)}},
+  {{ UINT64_C(0xaf32adcde74cb265), UINT64_C(0xace65f3570413811), UINT64_C(0xa7e64bf381de42ed)}},
+  {{ UINT64_C(0x861461c3ec0a8a2d), UINT64_C(0x48e46d00f533c7c4), UINT64_C(0x4c2d6fb3a513d26d)}},
+  {{ UINT64_C(0xc9a5c78d12679de9), UINT64_C(0xc34132148a643ee0), UINT64_C(0x275098bee67c4fbb)}},
+  {{ UINT64_C(0x13ff2cec7b2ca7e7), UINT64_C(0x95228ddcfab57566), UINT64_C(0xf2d6f66eb7c0b334)}},
+  {{ UINT64_C(0x196bc50d9514670c), UINT64_C(0x976a32b3bedc62d6), UINT64_C(0x24d4b49745226717)}},
+  {{ UINT64_C(0x035e115c0b25ec6b), UINT64_C(0xeea264003bb5811b), UINT64_C(0x2b5b0a16b66771ac)}},
+  {{ UINT64_C(0x209054b4145bf3cd), UINT64_C(0x164849a71d8ea135), UINT64_C(0xb420a29de09104b7)}},
+  {{ UINT64_C(0x6632c259be9aea04), UINT64_C(0xce5c1b1e079d8458), UINT64_C(0x0562347a9ec619c0)}},
+  {{ UINT64_C(0x72e2c571f2d302f3), UINT64_C(0x7ac006554f20cefc), UINT64_C(0x66565594ccbd05a0)}},
+  {{ UINT64_C(0x1b29c91816d3dcd3), UINT64_C(0xab0db162f8136baf), UINT64_C(0xc5b1fedee860b3f7)}},
+  {{ UINT64_C(0x576c6ea987c107b9), UINT64_C(0x14173934bbd4d98e), UINT64_C(0xc76286bfe2a15abe)}},
+  {{ UINT64_C(0x4fd4414cd1a9aad5), UINT64_C(0x3db702f8fce09253), UINT64_C(0x094123e6267604d4)}},
+  {{ UINT64_C(0xb5ba9d57f0e49b81), UINT64_C(0x6ec8eb5d15dd3ceb), UINT64_C(0x3c95c4d3389c95ff)}},
+  {{ UINT64_C(0xfc9f982369f7c1ee), UINT64_C(0x646c0a1b70361c20), UINT64_C(0x15afb42be5987e76)}},
+  {{ UINT64_C(0xfdaafe644259dfa2), UINT64_C(0x044150048828d81a), UINT64_C(0xfb54f112f02deb5f)}},
+  {{ UINT64_C(0xc8fe6cc6432d51b2), UINT64_C(0xba5911153046e5a8), UINT64_C(0xfbc4c61add390e9c)}},
+  {{ UINT64_C(0x7e4d7da021d3c8d5), UINT64_C(0x20c36a16dae9a961), UINT64_C(0x7933b6e4e7e97226)}},
+  {{ UINT64_C(0x461c53a748fada4b), UINT64_C(0xd1475a91f6a845e1), UINT64_C(0x80779b9e8166fdad)}},
+  {{ UINT64_C(0xf99b2a29ea7cd7f4), UINT64_C(0x2c86e33631717e0d), UINT64_C(0x4d8c7e072a8f1bd3)}},
+  {{ UINT64_C(0x8828af5948adb843), UINT64_C(0x5225106e781fb73a), UINT64_C(0xe92e79a3fadeb92e)}},
+  {{ UINT64_C(0xbb1f70c19cd894aa), UINT64_C(0xae1073053f03dab9), UINT64_C(0xc79f5836e071a178)}},
+  {{ UINT64_C(0x09f2012db10520cf), UINT64_C(0x3fcc51820742c14d), UINT64_C(0x9bfe2af079e25f8f)}},
+  {{ UINT64_C(0xeecb557e394b520f), UINT64_C(0x4bc20fbad7a65839), UINT64_C(0xd0cf834f1fda5a8e)}},
+  {{ UINT64_C(0x28a6bfafc586d845), UINT64_C(0x2d3dcfbd3f6239d4), UINT64_C(0x05e2f5b555417718)}},
+  {{ UINT64_C(0x0425ecea2f877a44), UINT64_C(0x645bc04eceaefa0f), UINT64_C(0xd67aee182071160b)}},
+  {{ UINT64_C(0x4c9297723c47ded7), UINT64_C(0xb96fdf7154041bbb), UINT64_C(0x08c8e96f7a70e644)}},
+  {{ UINT64_C(0x1bcc4e7ec154871b), UINT64_C(0x5514306fea40ec43), UINT64_C(0xf344b59befe0023c)}},
+  {{ UINT64_C(0xc2174dfadccd8c33), UINT64_C(0xfcbfd4f93f6476c3), UINT64_C(0xe40ea1dcd62329ef)}},
+  {{ UINT64_C(0xb125852fd51d4b6f), UINT64_C(0x20b090733c647303), UINT64_C(0x833d2dddb71b8664)}},
+  {{ UINT64_C(0xbb6d9949f3d806a6), UINT64_C(0x519d06b57623a152), UINT64_C(0x135e0fe63dd90a88)}},
+  {{ UINT64_C(0x75d071b57b026565), UINT64_C(0x5c525e64638e88de), UINT64_C(0x78292aa8d9bf4c0e)}},
+  {{ UINT64_C(0x59a0e4354755e21c), UINT64_C(0xc11df16751dd2716), UINT64_C(0x2051771152a17626)}},
+  {{ UINT64_C(0x33d87e40276756a7), UINT64_C(0xd7bd917389d21483), UINT64_C(0x5d676591305c6ea7)}},
+  {{ UINT64_C(0x62fab6eddef8771e), UINT64_C(0x701c7a1366fa5673), UINT64_C(0x2392d7e925083745)}},
+  {{ UINT64_C(0x782186a9d8b1ebc6), UINT64_C(0x6a0379c57aa94b76), UINT64_C(0x8959bc9d71a09612)}},
+  {{ UINT64_C(0x68ab3a54007a213f), UINT64_C(0x4aaaa6f5aa8338a1), UINT64_C(0x62674ed5fbf90beb)}},
+  {{ UINT64_C(0xf63bc8f927a03da7), UINT64_C(0xc63c0491bad804f9), UINT64_C(0x6dcec59ec99963a9)}},
+  {{ UINT64_C(0x0d5de6bef52c0312), UINT64_C(0xe704d79c94695e7f), UINT64_C(0x33f6ac47a7b506c9)}},
+  {{ UINT64_C(0x758a61c269e1c6a4), UINT64_C(0x6a2e1296d102dc7d), UINT64_C(0x0a8f79783c0cd768)}},
+  {{ UINT64_C(0xaa5d716af37fd33a), UINT64_C(0x3f5f38824f04ced9), UINT64_C(0x8b79ac78a41db0a7)}},
+  {{ UINT64_C(0x32aaf153ec361a98), UINT64_C(0x9df5c6198112d894), UINT64_C(0x2a70e1a0fd4bdb01)}},
+  {{ UINT64_C(0xc67ccb290970ea93), UINT64_C(0xb840a1877a08d67d), UINT64_C(0x927d58eb973512bc)}},
+  {{ UINT64_C(0xb89f93054b8875a6), UINT64_C(0x5319f6aca1f6b513), UINT64_C(0x6659e5e6f4036ead)}},
+  {{ UINT64_C(0x7bd39d080063876f), UINT64_C(0x29a663241fe7f5d6), UINT64_C(0x8aa2dff27d41b49d)}},
+  {{ UINT64_C(0x6e2a16be7e6d03d8), UINT64_C(0x79c81625d13f8cff), UINT64_C(0x6381efcf58986c19)}},
+  {{ UINT64_C(0x4f6be3471fa80a42), UINT64_C(0x567e64d28680ec9a), UINT64_C(0x254ff4a7045faf0c)}},
+  {{ UINT64_C(0xd247fef070f03357), UINT64_C(0x5c936f3a7cf5a89e), UINT64_C(0x8424d94242f8e06f)}},
+  {{ UINT64_C(0x2b0a6c05c147fc7c), UINT64_C(0xa79ebb2ddf4dadbd), UINT64_C(0xe8824afb5017f3d8)}},
+  {{ UINT64_C(0x9ce640a778bd64ce), UINT64_C(0x1ecee71ddc8b5592), UINT64_C(0xde832e327e253aae)}},
+  {{ UINT64_C(0x2550892d850c8a00), UINT64_C(0x6b1ba8395fec1736), UINT64_C(0xcf5e34a026d742c9)}},
+  {{ UINT64_C(0xa3dcfebe87b5560c), UINT64_C(0x90a3b3fefb6074d1), UINT64_C(0xb2e633cd2365f2a9)}},
+  {{ UINT64_C(0x4d33670364ba3c16), UINT64_C(0xad3d4a84d7ff616e), UINT64_C(0x797d886fbaa4a2b8)}},
+  {{ UINT64_C(0xdec6da6f1afad32e), UINT64_C(0x4d8be65951679b38), UINT64_C(0xdd193730fa0136ea)}},
+  {{ UINT64_C(0xae906171f479ed14), UINT64_C(0x849134a0c707ed6e), UINT64_C(0x4f779030f8a9f0e6)}},
+  {{ UINT64_C(0x16f739a2689e4b45), UINT64_C(0xe4a23e08a1620ca9), UINT64_C(0xab467f109d50f8ff)}},
+  {{ UINT64_C(0x001e89d9541ad429), UINT64_C(0x4b90ee95f658754e), UINT64_C(0xff9ea8978b15e16f)}},
+  {{ UINT64_C(0x6809adf4d1a4b876), UINT64_C(0xf77da1462e349f81), UINT64_C(0xd8d401f4035ca6c3)}},
+  {{ UINT64_C(0x23953ca5786127c2), UINT64_C(0x9309b4df63ae07d5), UINT64_C(0x329f956344a9ed0e)}},
+  {{ UINT64_C(0xf187e5436ae83124), UINT64_C(0x38c1e107ff9df573), UINT64_C(0x80586f4b2c155b8d)}},
+  {{ UINT64_C(0xa4e3a32943943b55), UINT64_C(0xc452014261b51d24), UINT64_C(0x14a5d92dce2cd7f9)}},
+  {{ UINT64_C(0x77d0598b71b2e772), UINT64_C(0x687f6c0014552775), UINT64_C(0x8c9f9d9b139d2ab3)}},
+  {{ UINT64_C(0xd037ed696a7f6152), UINT64_C(0xfbd4b5b92cf16107), UINT64_C(0xe9e3ab7181da9a4d)}},
+  {{ UINT64_C(0x9baef033199c4565), UINT64_C(0xfb2155ce65007c4b), UINT64_C(0xab20ffd8ef5f91a9)}},
+  {{ UINT64_C(0x9e44df251ae3ac3d), UINT64_C(0x2f0547450f2c4032), UINT64_C(0x71cc05b1f71ec0bf)}},
+  {{ UINT64_C(0x1f57c345d12238fe), UINT64_C(0x44ab3ae3d646ca46), UINT64_C(0x1772a9f400b2126c)}},
+  {{ UINT64_C(0xe8cbef09aceb8766), UINT64_C(0x0e8be53893dfcf2b), UINT64_C(0xb8074b3b92ef2aca)}},
+  {{ UINT64_C(0xc61ab03634dacc58), UINT64_C(0x2b50f3b2cec926aa), UINT64_C(0x4af62ea3f36b1be5)}},
+  {{ UINT64_C(0x5ff4c76cc8351fe2), UINT64_C(0x5d10b2a2bdf9ed4c), UINT64_C(0x32f3bc766eb2084e)}},
+  {{ UINT64_C(0xe9f9f092014a5936), UINT64_C(0xa767de8bec8ca4d0), UINT64_C(0x5acebd418af27bf2)}},
+  {{ UINT64_C(0x489ff25129be8bf6), UINT64_C(0x4ee0ff3b4a2bc662), UINT64_C(0x0628cb0cff65a731)}},
+  {{ UINT64_C(0x13fb886a1a3d103a), UINT64_C(0xa97ead61ef773a4e), UINT64_C(0xf6a8c81b9216b720)}},
+  {{ UINT64_C(0x69d783abb5871355), UINT64_C(0x05befe64d56bca40), UINT64_C(0x2e8b918dd8858b28)}},
+  {{ UINT64_C(0xc8f6f0b0b4baad11), UINT64_C(0x1ad7cb5faa83cf2b), UINT64_C(0xcb9b194092af6e57)}},
+  {{ UINT64_C(0x2f2f27b870388aae), UINT64_C(0x334f81d4f809469f), UINT64_C(0x89af6b152082a706)}},
+  {{ UINT64_C(0xca2116249b21ef9c), UINT64_C(0x109a243187ff61f6), UINT64_C(0x35e71a67157926dc)}},
+  {{ UINT64_C(0x16f93b3b86851a0a), UINT64_C(0x40c2f135ebbe6d34), UINT64_C(0xd20e66211fb08fef)}},
+  {{ UINT64_C(0x88a52f02ff01ec5b), UINT64_C(0xde43c4b0acf757b5), UINT64_C(0xa5e7a7374c01d8ce)}},
+  {{ UINT64_C(0xa213719c74c592c9), UINT64_C(0x6be72962092f37f7), UINT64_C(0x40b3c40bdf81d087)}},
+  {{ UINT64_C(0xe29415c84e85e1a8), UINT64_C(0x317ef5c405c69dcc), UINT64_C(0x15191e5ccb5a9f60)}},
+  {{ UINT64_C(0x06185e71ada44a1d), UINT64_C(0x42b9b000d623731d), UINT64_C(0x9ef503f9179eac7a)}},
+  {{ UINT64_C(0x9dd1421a6a3963a7), UINT64_C(0x877f3ae3aa17d808), UINT64_C(0x75e8c9262c936a88)}},
+  {{ UINT64_C(0xda5e5ab1b9ed0a7f), UINT64_C(0x8e47ee0eac8fce1f), UINT64_C(0x6b09cb13e88e2f79)}},
+  {{ UINT64_C(0xcf18c1afcf24dae5), UINT64_C(0xaf8c3987fe4ede1f), UINT64_C(0xae7445215551d6fb)}},
+  {{ UINT64_C(0x453a244706ebb4f3), UINT64_C(0xe380bc32d7fe3a37), UINT64_C(0xe14dc1fbf2e7b6b6)}},
+  {{ UINT64_C(0x4525d590dc2d015e), UINT64_C(0xe9103f305d0bdfd6), UINT64_C(0xfab83b17e6cc07ff)}},
+  {{ UINT64_C(0x598a293b0c5bbe08), UINT64_C(0xf7255107d2f8380e), UINT64_C(0xedcabf16e17879d9)}},
+  {{ UINT64_C(0x4778a7223b46d99f), UINT64_C(0xc1d32ed00a90f164), UINT64_C(0xdd5b6996d712f17c)}},
+  {{ UINT64_C(0x54caf3fc53635395), UINT64_C(0x4dd494925b33ddb5), UINT64_C(0x529c15d94acd6d5d)}},
+  {{ UINT64_C(0xa099b478761d0357), UINT64_C(0x4008509af9fc553b), UINT64_C(0x76e01ee99307a079)}},
+  {{ UINT64_C(0x9938cf5bbe501404), UINT64_C(0x8564d3293ebc1a44), UINT64_C(0x6267504cec85fead)}},
+  {{ UINT64_C(0x52356d178db30f2d), UINT64_C(0xf80e7753dda2a173), UINT64_C(0x04f2a5605337912f)}},
+  {{ UINT64_C(0x300c26b7f65c804f), UINT64_C(0x9d0a3eace7306369), UINT64_C(0x004578d70ebed403)}},
+  {{ UINT64_C(0x3fac180dcb5635a6), UINT64_C(0x32e0f2f908be2c48), UINT64_C(0x472ca83840afb87d)}},
+  {{ UINT64_C(0x3da8aa0759d6f492), UINT64_C(0x5fbdd7b2c62e5be3), UINT64_C(0xc77bb6f3d6a3eee9)}},
+  {{ UINT64_C(0xdc83541a329eb3d0), UINT64_C(0x8039430eb4c8f76c), UINT64_C(0x1f80c443edff5810)}},
+  {{ UINT64_C(0x177583aaf14f90ad), UINT64_C(0x539b98ac15d86534), UINT64_C(0x4e37110b0ca0878f)}},
+  {{ UINT64_C(0x19548e3468a3105d), UINT64_C(0xdee7ce701cbc7428), UINT64_C(0x8f93af1af039187f)}},
+  {{ UINT64_C(0x5676c5af77d0a45d), UINT64_C(0x45ecbc0439872454), UINT64_C(0xb85ff76e70042df8)}},
+  {{ UINT64_C(0xe58759bb0dd01848), UINT64_C(0xa1f92ec91d5d80ad), UINT64_C(0x8848e8e8b5b44fb3)}},
+  {{ UINT64_C(0xca96a81b91a4f17e), UINT64_C(0xee599970775f7f8e), UINT64_C(0x3c11850c3f4e8d10)}},
+  {{ UINT64_C(0xd1c3c692e7a3182d), UINT64_C(0x10598891add22323), UINT64_C(0xc8f6ff4c8f85b5ce)}},
+  {{ UINT64_C(0x0a217953026eddf8), UINT64_C(0x19a955c48416b023), UINT64_C(0xb0ec9ec6dcd03d31)}},
+  {{ UINT64_C(0x3d416fc5d04727c0), UINT64_C(0x6be89db42ef1fa02), UINT64_C(0x2cc51ac1791a034f)}},
+  {{ UINT64_C(0xe30939c160700348), UINT64_C(0x10d3fff141a3eeab), UINT64_C(0x3e00026af2892645)}},
+  {{ UINT64_C(0xd5f17717717299b5), UINT64_C(0xacb6f9b6eaa004a3), UINT64_C(0xb8f609e61423393f)}},
+  {{ UINT64_C(0x9427101493021bab), UINT64_C(0xf452b8bda0fff7bb), UINT64_C(0xfffc803009076d0d)}},
+  {{ UINT64_C(0xc33cbd478d2f1fba), UINT64_C(0x0a9bc9d340626b5a), UINT64_C(0xdba690b0ef353ad4)}},
+  {{ UINT64_C(0xa6232b78d8b103b2), UINT64_C(0x79961fc8df7a0d8f), UINT64_C(0xe6226afbb9ee067a)}},
+  {{ UINT64_C(0x32340f65dbc6e695), UINT64_C(0x98a871a053190805), UINT64_C(0x596fbd67bdc2f532)}},
+  {{ UINT64_C(0xbc3bd9cc7d4f829f), UINT64_C(0xe9a6ec0075053ba6), UINT64_C(0x876e9249e82e7291)}},
+  {{ UINT64_C(0xd65f7d29a795b89b), UINT64_C(0x660fd83de529bf59), UINT64_C(0x58148032c5801e86)}},
+  {{ UINT64_C(0x58b56cda8f5ca2c4), UINT64_C(0x344e4d65590678a7), UINT64_C(0x196b3b3bfeb18c63)}},
+  {{ UINT64_C(0xb644d0b2bbbfdd71), UINT64_C(0x3af7d90b087aba1b), UINT64_C(0xd6fdd1636d2ccedc)}},
+  {{ UINT64_C(0x0d4b713aede38464), UINT64_C(0xd6fb203f89cc81c5), UINT64_C(0x71d37cde603907af)}},
+  {{ UINT64_C(0x0bc119a5eabf709a), UINT64_C(0x77b92f943e8326fc), UINT64_C(0xe43a1665d50c8e43)}},
+  {{ UINT64_C(0x69c783fc1c29b025), UINT64_C(0x75991a6e06aae755), UINT64_C(0x89a9873b6cd6cc60)}},
+  {{ UINT64_C(0xd731c3039e60ad8a), UINT64_C(0x3581f0bb073ff13e), UINT64_C(0x5574d714c8e40a47)}},
+  {{ UINT64_C(0xdf13b24a0eb73b99), UINT64_C(0x336ab0eae020212a), UINT64_C(0x3e5dbcc9996934f8)}},
+  {{ UINT64_C(0xd75ea053f25fe8d5), UINT64_C(0xd30ca8e6babebde0), UINT64_C(0x226e0021779ba5d9)}},
+  {{ UINT64_C(0xbf7d42d9edaeeb2e), UINT64_C(0x3ddce631faf3669a), UINT64_C(0x10a6b3ac84e2ad3b)}},
+  {{ UINT64_C(0x1223dd8afe93ef05), UINT64_C(0xcad6925b53785b88), UINT64_C(0xc0471a903190a11f)}},
+  {{ UINT64_C(0x43e0a6c5df2de0db), UINT64_C(0xa366384fab3f5344), UINT64_C(0xada1ff9e15f33b9c)}},
+  {{ UINT64_C(0x0ffafb9e8c508452), UINT64_C(0x32cda2b1f8d0948e), UINT64_C(0x14a97bbb6e0c1e67)}},
+  {{ UINT64_C(0xfe72815b10307a06), UINT64_C(0x9e52bc36c04e7306), UINT64_C(0x71e544bb13d872e3)}},
+  {{ UINT64_C(0x89105a4b4d87b90b), UINT64_C(0xb2fca59c7bc8b98a), UINT64_C(0x6daec61d6a9b38b9)}},
+  {{ UINT64_C(0x9babb2a3bc8cb91c), UINT64_C(0x4e763c8becea7de9), UINT64_C(0x11f385c3fe86c09d)}},
+  {{ UINT64_C(0xbd782f3c450b1aef), UINT64_C(0xef4034f26b0464c5), UINT64_C(0x245446cd2d75af5b)}},
+  {{ UINT64_C(0x69cdeaf34c3fa70b), UINT64_C(0xf2a08764befe2013), UINT64_C(0x4f1f6a77745afec6)}},
+  {{ UINT64_C(0xb49afda842b806fa), UINT64_C(0x8cecb7daaf5e9078), UINT64_C(0xbd20ce201c8e995a)}},
+  {{ UINT64_C(0xdf7dc3626db57d27), UINT64_C(0xd3c4965c2554d6f2), UINT64_C(0xb144ae40c81bf620)}},
+  {{ UINT64_C(0x4159263a086304df), UINT64_C(0x3a25e142d91307fb), UINT64_C(0x74611d916264551a)}},
+  {{ UINT64_C(0x57bfdbfabe368b51), UINT64_C(0xf8f809e79a3b74d8), UINT64_C(0x945ce1e27d0b7cdb)}},
+  {{ UINT64_C(0x65160189703c656d), UINT64_C(0xb8ae4aef9ef57b53), UINT64_C(0x863f5e19f2c2772c)}},
+  {{ UINT64_C(0x26cf23a3cc7255d1), UINT64_C(0x9de3c4d83a5c2ed1), UINT64_C(0x9895e14df22b0304)}},
+  {{ UINT64_C(0x153b5a8562774afa), UINT64_C(0x1168dd5541441c57), UINT64_C(0xfd6edb0667621dc2)}},
+  {{ UINT64_C(0x4b02ff5791c4b922), UINT64_C(0x23327dbc2615a30f), UINT64_C(0x7452b2c46c8ced9f)}},
+  {{ UINT64_C(0xf37ad1470d745345), UINT64_C(0xc4aa85ebe6d15c21), UINT64_C(0x0aed55f1681c9337)}},
+  {{ UINT64_C(0xe2011e45c17e28d8), UINT64_C(0x49bdf8f939d7fe4b), UINT64_C(0x6d93bc6aad55b0e8)}},
+  {{ UINT64_C(0x93f0d8c0c236ae1a), UINT64_C(0xc4fbec8c513763c7), UINT64_C(0x3e860a3170288e80)}},
+  {{ UINT64_C(0x4486656f7ce501d8), UINT64_C(0xa854dd489bf6a960), UINT64_C(0x816691b7b486722c)}},
+  {{ UINT64_C(0xb71c53779bc920d7), UINT64_C(0x5f95fa1e4797d01b), UINT64_C(0x32a5f68ed61f4a53)}},
+  {{ UINT64_C(0x2c48018c3c13cc9c), UINT64_C(0x4a43565f5033664f), UINT64_C(0x03aff56846c4a4da)}},
+  {{ UINT64_C(0x3d4b4d63b32f51ce), UINT64_C(0xf3960dda5380abf0), UINT64_C(0xd0589b7cfaeec229)}},
+  {{ UINT64_C(0x71cda1a65e2686fe), UINT64_C(0x1db752355eecc5d5), UINT64_C(0x37589c369c4d7dc9)}},
+  {{ UINT64_C(0x4572297305cda198), UINT64_C(0xf5f1c5d77884160d), UINT64_C(0x04854eb351601539)}},
+  {{ UINT64_C(0x41430667ced5814f), UINT64_C(0x5c42257a56aefe9f), UINT64_C(0x00709341a6e26c9c)}},
+  {{ UINT64_C(0x867bb09d21ea9616), UINT64_C(0x39a0d041d2117ee4), UINT64_C(0x16c3f38ba1c33291)}},
+  {{ UINT64_C(0xb27102bd010a38dd), UINT64_C(0xa2e2d119128cbfac), UINT64_C(0xa6c49dffc84a0ef6)}},
+  {{ UINT64_C(0x8989be65a3da4f24), UINT64_C(0x8879febe77a10de4), UINT64_C(0xfbc889d17567d18b)}},
+  {{ UINT64_C(0xf3f9c949da544c2e), UINT64_C(0x3f10609fde305191), UINT64_C(0xf0273962e1035fc8)}},
+  {{ UINT64_C(0x8902eb4f4e03578d), UINT64_C(0xbf6430f03a28799d), UINT64_C(0xddf43b06e9ed6cbd)}},
+  {{ UINT64_C(0xba9cdec811851ebb), UINT64_C(0x1daa843e0358babc), UINT64_C(0xdd38806fd8611121)}},
+  {{ UINT64_C(0x728b0abbd1670179), UINT64_C(0x07aa6ba237fec3eb), UINT64_C(0x3882b7b7819829e3)}},
+  {{ UINT64_C(0x0e817f3149ba9e0a), UINT64_C(0x9f009ebd9bf57e9d), UINT64_C(0xfb255e5e47f25026)}},
+  {{ UINT64_C(0x153f44b80c0ea9c3), UINT64_C(0x4e5c8659421b89ab), UINT64_C(0x9748430d257f1293)}},
+  {{ UINT64_C(0x35670c8bc5b70380), UINT64_C(0x5790ddc96239d7c6), UINT64_C(0x39253da24cbb81ea)}},
+  {{ UINT64_C(0xee408a62b46dedf4), UINT64_C(0xa41353a17049fe28), UINT64_C(0xcce54360d4c24f00)}},
+  {{ UINT64_C(0x884f500d7873e652), UINT64_C(0x6966877930473d96), UINT64_C(0xdfc79fac9ba11182)}},
+  {{ UINT64_C(0x337e691566b78ffc), UINT64_C(0xfb534c8abba9d245), UINT64_C(0xc7e5b08abded92b8)}},
+  {{ UINT64_C(0x6eed83e14f5ba9fd), UINT64_C(0xf2f6b5cb229ebc28), UINT64_C(0xef4a24906b7d19ed)}},
+  {{ UINT64_C(0x6917ed9a7f2e4221), UINT64_C(0xa7bd9c32365fdc3c), UINT64_C(0x0c13b65fd345b056)}},
+  {{ UINT64_C(0x34b5e0fc2c820229), UINT64_C(0xd073ca53372e6784), UINT64_C(0xa1941c161c615e04)}},
+  {{ UINT64_C(0x0e001d22738e61f5), UINT64_C(0x2f5b88530d27042b), UINT64_C(0x3a7fe39cd292f775)}},
+  {{ UINT64_C(0x635e1c2a264cc49d), UINT64_C(0xd82cb6da04e20045), UINT64_C(0xb6f11a510f4c3291)}},
+  {{ UINT64_C(0x8961ed55afafee25), UINT64_C(0x03c6f6d90a2220db), UINT64_C(0x52453671d3287782)}},
+  {{ UINT64_C(0xfbc668f2460d46b3), UINT64_C(0x30696481a5bdeaff), UINT64_C(0xb7e74c28dee5f488)}},
+  {{ UINT64_C(0xfdc57ae82a1b0034), UINT64_C(0x5582ea804541eb3a), UINT64_C(0xe0b606b75c09b72f)}},
+  {{ UINT64_C(0xc0269688cbe9893d), UINT64_C(0x592b07a66ef2893a), UINT64_C(0x1ac3304631a80416)}},
+  {{ UINT64_C(0x76dfd34f7c0a17e2), UINT64_C(0x9c12790d32695899), UINT64_C(0xc37921ab3b047576)}},
+  {{ UINT64_C(0x478f5b92da0da6b6), UINT64_C(0x15ee3ef093bd55de), UINT64_C(0x8afca635568407e7)}},
+  {{ UINT64_C(0x228de393d67b0cbe), UINT64_C(0x84689135a9cbcc29), UINT64_C(0x2100de762a9efb7c)}},
+  {{ UINT64_C(0x2169268ea5b7c9ca), UINT64_C(0x6dbeb19401484c44), UINT64_C(0x132007b91041fb42)}},
+  {{ UINT64_C(0xce5d4870af6b708d), UINT64_C(0xa584d18fb1a254b5), UINT64_C(0xec6fc474eb6248e2)}},
+  {{ UINT64_C(0x4e7d14c057624a82), UINT64_C(0x0734f512d4a847a8), UINT64_C(0xd51ba1eb63648157)}},
+  {{ UINT64_C(0xdbe73e9f0d7569d2), UINT64_C(0xc7238cd56de97385), UINT64_C(0xbded1d82af347a8b)}},
+  {{ UINT64_C(0xbe38a73d09e59d54), UINT64_C(0xd140ada63fe8021b), UINT64_C(0x8acdbd92c4dee3b7)}},
+  {{ UINT64_C(0x17c313c5691e8b1b), UINT64_C(0x3cdff0b54e892608), UINT64_C(0x1723f57aa7b87d43)}},
+  {{ UINT64_C(0x63d4e82a003335a5), UINT64_C(0x92ee0249b491184f), UINT64_C(0xb6de1cf8c1972487)}},
+  {{ UINT64_C(0xb190627ad8b60562), UINT64_C(0xec6142b85f56e4da), UINT64_C(0x62d6a5c56bf00037)}},
+  {{ UINT64_C(0xf0adfae1104d66c1), UINT64_C(0xea080a237e925439), UINT64_C(0x4865cfef13e6dd52)}},
+  {{ UINT64_C(0xb02dd319d3e4af4c), UINT64_C(0xc814a153e01e6b86), UINT64_C(0x17d39d42725dc7b7)}},
+  {{ UINT64_C(0x0bb4c0013cd57780), UINT64_C(0xb9a916b55b5959fa), UINT64_C(0xa0dc143b25daa6a7)}},
+  {{ UINT64_C(0xe0e1080f92e9b6fc), UINT64_C(0x7f388742a2fcbd83), UINT64_C(0xd1d6173f9899f918)}},
+  {{ UINT64_C(0x16f615b14ccc5605), UINT64_C(0x039969952bd1145f), UINT64_C(0xa961352d74e35f5d)}},
+  {{ UINT64_C(0x3a312157010b11f6), UINT64_C(0x0da797a88914236b), UINT64_C(0x78895c1a04e6e57e)}},
+  {{ UINT64_C(0x66316d5cc60d6ba0), UINT64_C(0x2a350fda200060aa), UINT64_C(0xa4c8f202ca5224d8)}},
+  {{ UINT64_C(0x0bdb3a4d4ce1881a), UINT64_C(0xe4338103f1df37a0), UINT64_C(0xea7b16d40236abf6)}},
+  {{ UINT64_C(0xa7218370eb4d8930), UINT64_C(0x960706e07a3f4956), UINT64_C(0x46914a32369327b9)}},
+  {{ UINT64_C(0xc078d7414a796317), UINT64_C(0x473e78d01a5a5430), UINT64_C(0x15aa1c142e44695a)}},
+  {{ UINT64_C(0x8b5500a365c02170), UINT64_C(0xf59d25fdec663438), UINT64_C(0x9f4a4466d75143d5)}},
+  {{ UINT64_C(0xa01978a65b879a66), UINT64_C(0x731dbd2ebf2dc049), UINT64_C(0x654c9a7c66e4fb22)}},
+  {{ UINT64_C(0x3ea1d63fa2af4bcc), UINT64_C(0x2e3ff753fde2587b), UINT64_C(0xf5fc1284211c8932)}},
+  {{ UINT64_C(0x6ef711b3a1b6e3a3), UINT64_C(0x01afbb43ebe704f3), UINT64_C(0x21064e4920722217)}},
+  {{ UINT64_C(0xf66bbb74c53bcb73), UINT64_C(0xbf625e19ebf1aaa1), UINT64_C(0x7f35f29ed9ed98bc)}},
+  {{ UINT64_C(0x06351da2111aed1d), UINT64_C(0x199f3ca8fe61311b), UINT64_C(0x2d41a55b941c7c0d)}},
+  {{ UINT64_C(0xb396e4d01249b357), UINT64_C(0xbc7635f21743ea2f), UINT64_C(0xf0854ee1def2dc2b)}},
+  {{ UINT64_C(0x2256085f41210c82), UINT64_C(0x83d78d020a70ac4b), UINT64_C(0x39a69e6cb26ede72)}},
+  {{ UINT64_C(0x6fd3ad0ab35e33c7), UINT64_C(0xf60d0bfc163bd722), UINT64_C(0x6cb9822ce29003ec)}},
+  {{ UINT64_C(0xbf88dc395880542b), UINT64_C(0xe628095c3f781b5e), UINT64_C(0x210535f7d0d486f9)}},
+  {{ UINT64_C(0xe401f4966f052077), UINT64_C(0xc958a1669c5eeb08), UINT64_C(0x15e2c7ed90bd81ad)}},
+  {{ UINT64_C(0xabd17b2a0d333766), UINT64_C(0x477cbe97e994b822), UINT64_C(0x8179ad7d3b2c5025)}},
+  {{ UINT64_C(0xa50aa42d5141407d), UINT64_C(0x4b7d46a15076f53a), UINT64_C(0x62209a655f8471f8)}},
+  {{ UINT64_C(0x7d76f651e0902b56), UINT64_C(0xc98ff0cdc4e00a47), UINT64_C(0xc3f667f326213e35)}},
+  {{ UINT64_C(0x25e57d48e87be6d8), UINT64_C(0xbc044b7a34134b55), UINT64_C(0x986c2a2b85ea31b9)}},
+  {{ UINT64_C(0xfb52bbf5460022ee), UINT64_C(0xc3b2d241ebcdec7c), UINT64_C(0x51ee2e9b60a219b8)}},
+  {{ UINT64_C(0xdcd25a0f33054e01), UINT64_C(0xb89eeee781c73527), UINT64_C(0x7e1827503e5c39b6)}},
+  {{ UINT64_C(0xb20017f4f45e0ca5), UINT64_C(0x2761cb7983850195), UINT64_C(0xf3160a85915ddab6)}},
+  {{ UINT64_C(0x089444156734f4ed), UINT64_C(0xf0c7a33da603df6b), UINT64_C(0x715ae235a46feeae)}},
+  {{ UINT64_C(0xe5313c7b63cd349a), UINT64_C(0x454452ac2c8ab0cc), UINT64_C(0x3a5d5721a24f68bc)}},
+  {{ UINT64_C(0xd946309e71a2c235), UINT64_C(0xae90b9e48bded9af), UINT64_C(0x0e8b2dbe0b62e62e)}},
+  {{ UINT64_C(0xcede2b544aac9a30), UINT64_C(0x6787daa8fcb9832f), UINT64_C(0x1742f5b2e5acc414)}},
+  {{ UINT64_C(0x9965f0fc3516780a), UINT64_C(0x3d50de1a66255f32), UINT64_C(0x5ae86255bc34f31a)}},
+  {{ UINT64_C(0xad161cdf8023e6e1), UINT64_C(0x13b2b6aef8ed12ba), UINT64_C(0x8de8d135a864df63)}},
+  {{ UINT64_C(0xb9a5f4107a895055), UINT64_C(0x582e58ae5beb989f), UINT64_C(0x2c72bd12f22f29f0)}},
+  {{ UINT64_C(0x9e9cc77550aaee69), UINT64_C(0xe97ce8263302886e), UINT64_C(0x1e2061b1f0f78a89)}},
+  {{ UINT64_C(0xb6ea80fc40bdec31), UINT64_C(0x3fb185babd5af056), UINT64_C(0x156ee1a9fc25b727)}},
+  {{ UINT64_C(0x100cd13305932ddd), UINT64_C(0x014f823931068ccb), UINT64_C(0xb5f7521c0774915f)}},
+  {{ UINT64_C(0xbc015df486c1871d), UINT64_C(0x603157bddac8bc57), UINT64_C(0x87e51d0f8539a2eb)}},
+  {{ UINT64_C(0xec367ec9d6695eec), UINT64_C(0xa3cd554dba84dd03), UINT64_C(0xc7069e4477ead237)}},
+  {{ UINT64_C(0x77ac0ab8cd2002ff), UINT64_C(0x2e9281a733d036f8), UINT64_C(0xddcb34b58e0957bb)}},
+  {{ UINT64_C(0x516be2dccbb60edc), UINT64_C(0x15f6f8a2b07e7005), UINT64_C(0xc930550501ee75d5)}},
+  {{ UINT64_C(0xfea29d308f286030), UINT64_C(0x4d03c6185199b016), UINT64_C(0xfa76bed81b15771a)}},
+  {{ UINT64_C(0xa5b10ac9c25355b7), UINT64_C(0x260ed36223a99599), UINT64_C(0x9f47b40f8d16a9fc)}},
+  {{ UINT64_C(0x6585bbe6534464b8), UINT64_C(0x89cf94c4db646889), UINT64_C(0x2d93f64dedd614e0)}},
+  {{ UINT64_C(0x1b1d1f6ed795e5cc), UINT64_C(0x66ef695bd09d2354), UINT64_C(0x23a678a47e9b3a43)}},
+  {{ UINT64_C(0x1ab9e030e8a0d205), UINT64_C(0x6ac74847cd08d950), UINT64_C(0x95122c4520b07c47)}},
+  {{ UINT64_C(0x6d8de8cdd60d9b09), UINT64_C(0xdcf05a368e2411ba), UINT64_C(0x0f35f6bf2df78ac3)}},
+  {{ UINT64_C(0xb92c28e2340d6888), UINT64_C(0xac127153454964b1), UINT64_C(0x88b7ccdddf721cec)}},
+  {{ UINT64_C(0x4bab52b18b6d4a6a), UINT64_C(0x6a27acf04bcda1fb), UINT64_C(0xc24243ece8b12f8f)}},
+  {{ UINT64_C(0x69fdcc09308ff318), UINT64_C(0x533ed561eef66466), UINT64_C(0x533cc4bc6e6d250a)}},
+  {{ UINT64_C(0x80a91b174230804f), UINT64_C(0x9c4dd66ba839ba61), UINT64_C(0xc48662ce106b9810)}},
+  {{ UINT64_C(0x2889768ff1a08277), UINT64_C(0xaafab71722b15fc5), UINT64_C(0x9e362208d33bc2d7)}},
+  {{ UINT64_C(0xf8160bc00fcf8da6), UINT64_C(0x49af91fbe52496f7), UINT64_C(0x1576a18f175ee99e)}},
+  {{ UINT64_C(0xb0c9f5abcdc38639), UINT64_C(0x51435f232144af6e), UINT64_C(0x1aba54b1bd198890)}},
+  {{ UINT64_C(0x1cfbf204a3e4f2ec), UINT64_C(0x6dc18d79ed965cf0), UINT64_C(0xd70c4a14bd2682e1)}},
+  {{ UINT64_C(0x267bad7dd3a4826b), UINT64_C(0x9aab519f953004ac), UINT64_C(0x28bc0d34d32be6a0)}},
+  {{ UINT64_C(0xa47a1786302ae48e), UINT64_C(0xa70e2feeafa3b675), UINT64_C(0x84635bf2186528f2)}},
+  {{ UINT64_C(0x22e40a303739e2ff), UINT64_C(0x10ce8e165a4eb50a), UINT64_C(0x073f82ad732d31bc)}},
+  {{ UINT64_C(0x9fcd997462a7786f), UINT64_C(0x78d65c62f772c596), UINT64_C(0x180bd6cdf589d2af)}},
+  {{ UINT64_C(0x4d274606848b8338), UINT64_C(0x7ac6fbf1dedb3899), UINT64_C(0xaaf2d730170b8dde)}},
+  {{ UINT64_C(0x975af13086d69812), UINT64_C(0xd75b1f9da5c3d069), UINT64_C(0xff373889d298e8a0)}},
+  {{ UINT64_C(0xea0ff2bf74f98e24), UINT64_C(0xf2a11d75583b9242), UINT64_C(0x1faeebd967bfc2bd)}},
+  {{ UINT64_C(0x7df729d654018f3a), UINT64_C(0xe64941de842f6f30), UINT64_C(0xdb640588aae6dfb2)}},
+  {{ UINT64_C(0xc41d11abce023b10), UINT64_C(0x8364034b518221db), UINT64_C(0x7d0786c9f2b99dca)}},
+  {{ UINT64_C(0xe2c0e7a53cfaa551), UINT64_C(0x8d5ae4977eabee19), UINT64_C(0x7eca92228d0ff179)}},
+  {{ UINT64_C(0x2870d307e5e7d38c), UINT64_C(0x8512f9e8cf181fda), UINT64_C(0x6c6b6d481bb6bde9)}},
+  {{ UINT64_C(0x05f1421932fbc7fb), UINT64_C(0xcfea00c0e3a967f5), UINT64_C(0x671b91e5b4827b4a)}},
+  {{ UINT64_C(0xbca0b0ae9abe9838), UINT64_C(0x6871bfd488c63ff6), UINT64_C(0x6e90e5102eb8f79e)}},
+  {{ UINT64_C(0x06fb81aca3a8b468), UINT64_C(0x0bda4c927ee0874a), UINT64_C(0x514fc0ad7ea23b80)}},
+  {{ UINT64_C(0xaa74a33892d9170c), UINT64_C(0x788fe9057df68301), UINT64_C(0x142f31c01951778f)}},
+  {{ UINT64_C(0x9fbc269c2484cd89), UINT64_C(0x6f31794bd2601a39), UINT64_C(0xf0b4659c965a0551)}},
+  {{ UINT64_C(0xc4b955b036241a5e), UINT64_C(0x7065c0bb4e5ffe23), UINT64_C(0x81fc7a10b6088e1e)}},
+  {{ UINT64_C(0x6956f5d3ad7d1ef5), UINT64_C(0xdf0f87129dfda8ea), UINT64_C(0xc890a49658fee15e)}},
+  {{ UINT64_C(0x4d1f7d21552c30b4), UINT64_C(0xe78f9ff75f680172), UINT64_C(0x2a3c1ae3ee757d5d)}},
+  {{ UINT64_C(0xae50069b0e6971bb), UINT64_C(0x7a5f56d9b3022023), UINT64_C(0xdc116cbebd94e8c0)}},
+  {{ UINT64_C(0x09259b03a4fb271c), UINT64_C(0x6642912f14f514d9), UINT64_C(0x92030735f2ec234c)}},
+  {{ UINT64_C(0xb45655c4c1beffce), UINT64_C(0x73639e4637fbe1cc), UINT64_C(0xc9464043f63da89c)}},
+  {{ UINT64_C(0xa0cf234a0b685db7), UINT64_C(0xa299bf1f7a387bfa), UINT64_C(0x9b03c658f4e6daf1)}},
+  {{ UINT64_C(0x05cc61149b1bb57f), UINT64_C(0x6de65634e2d793a4), UINT64_C(0x0e099d9b20521f37)}},
+  {{ UINT64_C(0x991c5635a7bbfab2), UINT64_C(0x6a06300486b8716f), UINT64_C(0xd9d7990e1a612752)}},
+  {{ UINT64_C(0x3bcabea1326b79a9), UINT64_C(0x43cf1a26d17cfd0d), UINT64_C(0x73fc7c7e1dd3c2c9)}},
+  {{ UINT64_C(0xbd3afab726d1b640), UINT64_C(0x646e6fe7939038d8), UINT64_C(0x6b4ad15774aaf71e)}},
+  {{ UINT64_C(0x78635c45fa477bd9), UINT64_C(0x2529ea548fa31ec9), UINT64_C(0xc8e385dbc4882256)}},
+  {{ UINT64_C(0x4c7ed3e84c6b9c7b), UINT64_C(0xe1afc669792b651f), UINT64_C(0xab8372b03889bdaf)}},
+  {{ UINT64_C(0x95fda31af6126618), UINT64_C(0x799fc2ccd3583ad8), UINT64_C(0x7f41416561152039)}},
+  {{ UINT64_C(0x314576f86f1b783e), UINT64_C(0xf9d83c0b2e9bdcdc), UINT64_C(0x850f8ee4483641fc)}},
+  {{ UINT64_C(0x8a87e8c643b9df9b), UINT64_C(0x4fc42c96891d9cda), UINT64_C(0x2e094c7a5dcd6a37)}},
+  {{ UINT64_C(0xb4d0aba77901200d), UINT64_C(0xb07253ea40e102d6), UINT64_C(0x11ee3fae99675a1e)}},
+  {{ UINT64_C(0x77d57c6b7f19ae39), UINT64_C(0x57d018994ba35b44), UINT64_C(0x8cbbb3830fdbe6af)}},
+  {{ UINT64_C(0x1066ad6b823368c1), UINT64_C(0x401fe0b57193300f), UINT64_C(0x8879af22e244b819)}},
+  {{ UINT64_C(0xd40f1f2b5958ced8), UINT64_C(0xfbff4c584bc2ea42), UINT64_C(0x55fc7c356ac78c9b)}},
+  {{ UINT64_C(0x8a69227f24001df7), UINT64_C(0x1e38ba91d53a0d80), UINT64_C(0x94c2c761b7e3a45a)}},
+  {{ UINT64_C(0xdd8ae7d5967f807e), UINT64_C(0xc3ca00b01feba307), UINT64_C(0xdb56f4c93b033c6b)}},
+  {{ UINT64_C(0x87b1d9646fa7d33e), UINT64_C(0x30971b9ef1505b6b), UINT64_C(0x2f5b5b9d2ba36921)}},
+  {{ UINT64_C(0x2e08d61376f4f2d2), UINT64_C(0x4f104d5792b695d2), UINT64_C(0x8d6629c9ad5b2298)}},
+  {{ UINT64_C(0xa58f93c1ea56a898), UINT64_C(0x97c33b87cbf5eab3), UINT64_C(0xdf8394a1366009b6)}},
+  {{ UINT64_C(0x742bcb0683ee3bd6), UINT64_C(0xbba951a0442fd59e), UINT64_C(0x3a59992bf483c478)}},
+  {{ UINT64_C(0x4d4e1846380c842b), UINT64_C(0xab44e7ee0ab309a3), UINT64_C(0x53271cc47213af28)}},
+  {{ UINT64_C(0xf2a743284fadfe36), UINT64_C(0x231bed5c435408bf), UINT64_C(0x348513617e30f8dc)}},
+  {{ UINT64_C(0xd326a85cd6de6425), UINT64_C(0xe4beddb39e3ad120), UINT64_C(0x28907ed8cf1fae7e)}},
+  {{ UINT64_C(0xfa84c7eeb7cf2187), UINT64_C(0x268a7911c7f863bb), UINT64_C(0x8f4da62d7c711e95)}},
+  {{ UINT64_C(0xea500b9e3c9f5cfe), UINT64_C(0x4df425b23ab84743), UINT64_C(0x53ca0226dab1e9d4)}},
+  {{ UINT64_C(0x8a85e494bde840c5), UINT64_C(0x1179518085560603), UINT64_C(0x3855527387412f47)}},
+  {{ UINT64_C(0x054967c02cbc9df2), UINT64_C(0x7a7071f1eb9f0b97), UINT64_C(0x338f2ff8dbaa31b8)}},
+  {{ UINT64_C(0x6622737531038a9f), UINT64_C(0x14a9597dc6022cd1), UINT64_C(0x7997aca2ec142120)}},
+  {{ UINT64_C(0xf80ed917881a6cc3), UINT64_C(0xb5c4b989fc59c4f5), UINT64_C(0xcdd5105c04da951e)}},
+  {{ UINT64_C(0xc9cf8d6dfa9ceb98), UINT64_C(0xe97e45c617439139), UINT64_C(0x6ff1fe887d4ab4b3)}},
+  {{ UINT64_C(0x729b6e9b2ab4ff1d), UINT64_C(0x65eff28ec7625bf9), UINT64_C(0x550438c2b670a7e6)}},
+  {{ UINT64_C(0x06d8ec6534da324d), UINT64_C(0xb93cd7d4e61c43d0), UINT64_C(0x0de2595b521be05f)}},
+  {{ UINT64_C(0xdcc1077df28cec6a), UINT64_C(0xea58dad7b752058b), UINT64_C(0xd7765c825e9ccd97)}},
+  {{ UINT64_C(0xb68925e74bb19518), UINT64_C(0x43ff311394262df8), UINT64_C(0x7f9f65e9000420e6)}},
+  {{ UINT64_C(0xaaa74eaaa246015e), UINT64_C(0x3a3f708a5d8e4712), UINT64_C(0x05a50d1e85b45691)}},
+  {{ UINT64_C(0x89587affb3d63c63), UINT64_C(0x99728e1797c6d0f4), UINT64_C(0x86053cb98dd3a5c3)}},
+  {{ UINT64_C(0x78d100faa606d9ab), UINT64_C(0xaa5d4ebd227f2346), UINT64_C(0xf197f14e985f5101)}},
+  {{ UINT64_C(0x37f573a164108702), UINT64_C(0x676d38e2e7e0f23f), UINT64_C(0x317862eb4210f620)}},
+  {{ UINT64_C(0xdce764ec79c539c7), UINT64_C(0x6741b40d2daca3bc), UINT64_C(0xafd7d50748038b1e)}},
+  {{ UINT64_C(0x3f0882aa6fafe69e), UINT64_C(0x116964b209a5c672), UINT64_C(0x630a3bd1c9f7636b)}},
+  {{ UINT64_C(0x43ba1cbf993e8828), UINT64_C(0x3311febdc651f242), UINT64_C(0x6add554d7857e19b)}},
+  {{ UINT64_C(0xd024152788dd7cbd), UINT64_C(0x1636d94f647bfc79), UINT64_C(0x5a6a610304bdf0f4)}},
+  {{ UINT64_C(0xab8b92272f8ef480), UINT64_C(0x6c457a735750490a), UINT64_C(0xcf3161145a0158ea)}},
+  {{ UINT64_C(0x90aa39dd1fd32470), UINT64_C(0xdaf1319fdf230e7d), UINT64_C(0x6fd44d2960869079)}},
+  {{ UINT64_C(0x1ca8fe4598871ddc), UINT64_C(0xfa3c3f067154d7a4), UINT64_C(0xfab30bb7d90689e6)}},
+  {{ UINT64_C(0xed1e6dd1fa4c5d4e), UINT64_C(0x1498216f1612cb26), UINT64_C(0x8e0ee6f4d3bc7a84)}},
+  {{ UINT64_C(0x1d740fd365995923), UINT64_C(0xf45d004b4c592abb), UINT64_C(0x6048a9bc88440d48)}},
+  {{ UINT64_C(0xeef2001006f26dbd), UINT64_C(0x1b536bf05fd606ad), UINT64_C(0x06b067293881ec21)}},
+  {{ UINT64_C(0x446470f208184255), UINT64_C(0x26c348a22d592081), UINT64_C(0xd72f3eef0520dbd6)}},
+  {{ UINT64_C(0x15555d7f3f02b22f), UINT64_C(0x79ac0365fac6aef5), UINT64_C(0x474a10f3a6e64cad)}},
+  {{ UINT64_C(0x6dbd3578b39d80e3), UINT64_C(0xc3e265cd4df24ba0), UINT64_C(0x2be63ac2974d4ad6)}},
+  {{ UINT64_C(0xbfbb40eeeb77c455), UINT64_C(0xd8e22998d1df02fc), UINT64_C(0x26808c44d8371441)}},
+  {{ UINT64_C(0x50438ed07deb914c), UINT64_C(0x505cd1dd1fd1d7f8), UINT64_C(0x06cf7a68f2c4fe54)}},
+  {{ UINT64_C(0x5ab2af86194e0d67), UINT64_C(0xaaf5507553e331d7), UINT64_C(0x697ae82a61bd587b)}},
+  {{ UINT64_C(0x40429b1294471afc), UINT64_C(0xe6a75e11fd808e81), UINT64_C(0x87c8b11d4ac061fe)}},
+  {{ UINT64_C(0x7c809d78b9c01053), UINT64_C(0xdfe53852add5b804), UINT64_C(0x8cf73810b6af73d4)}},
+  {{ UINT64_C(0x8bd214f345399e4f), UINT64_C(0x617ea0b2ccedaf30), UINT64_C(0x2d9ad1929acc019f)}},
+  {{ UINT64_C(0x25751bfaa685ce40), UINT64_C(0xc9c5faf460385f76), UINT64_C(0x40488f67b720f824)}},
+  {{ UINT64_C(0xdc94145c220c3d28), UINT64_C(0x3bb270c385af6ab3), UINT64_C(0x09618ba05b9f7376)}},
+  {{ UINT64_C(0xdf51ba01b023fae7), UINT64_C(0xdb9873719ce65160), UINT64_C(0xb527cc84df524204)}},
+  {{ UINT64_C(0x8ad86639530855fe), UINT64_C(0x90df1d18f22ba4ec), UINT64_C(0x311e2c897e6ef8cc)}},
+  {{ UINT64_C(0x64361aa5f06be591), UINT64_C(0x846720adf6860faa), UINT64_C(0x09ff0b476e27a6c8)}},
+  {{ UINT64_C(0x9937dcff5da56a36), UINT64_C(0x6939c2c9d4510604), UINT64_C(0x7f22cd061da8254c)}},
+  {{ UINT64_C(0xa5a45e3d2777a931), UINT64_C(0xf6101ee7a212c869), UINT64_C(0x8d350f464891a989)}},
+  {{ UINT64_C(0x057e5b7f5f2b8ca6), UINT64_C(0xbf059c225fff106a), UINT64_C(0xc4797726332c7b05)}},
+  {{ UINT64_C(0x23c0932ae865d0ec), UINT64_C(0x904408f5edae3164), UINT64_C(0x06df3d9c6e605043)}},
+  {{ UINT64_C(0x2d2e5f70f7c48604), UINT64_C(0xbbeb55d2c875c612), UINT64_C(0xcfdfaeb3789b710d)}},
+  {{ UINT64_C(0x76f5467f3b700884), UINT64_C(0xc32574a3cc9e08dc), UINT64_C(0x7abd776f288c9664)}},
+  {{ UINT64_C(0xf9682bd98e7765cc), UINT64_C(0x113ff95ec9210e56), UINT64_C(0xf70b3e98838edee6)}},
+  {{ UINT64_C(0x8ccc879947a330c4), UINT64_C(0xa77bec4d16226ebc), UINT64_C(0x709e7a1298fcd977)}},
+  {{ UINT64_C(0x635c768814110b00), UINT64_C(0xb4eb7e4aaa148600), UINT64_C(0xd30377095bb402bc)}},
+  {{ UINT64_C(0x0b766c5c0cfcb25a), UINT64_C(0x61abdf28fcfe5e8f), UINT64_C(0x4d97aab7415c054c)}},
+  {{ UINT64_C(0x18d071d5b77cafe4), UINT64_C(0xbc0605922d489a09), UINT64_C(0x31c4ac992d34b9d3)}},
+  {{ UINT64_C(0x464bce09b85c9c9c), UINT64_C(0x7cde68a348120dfc), UINT64_C(0x4e0b8dfa6f3818da)}},
+  {{ UINT64_C(0xca6066100fdb5854), UINT64_C(0x730c24e1a4633546), UINT64_C(0x744eed297b0c3f86)}},
+  {{ UINT64_C(0xbd66d40d30b77806), UINT64_C(0x5b05a72540704894), UINT64_C(0xecfe9c55fb770a61)}},
+  {{ UINT64_C(0x20abb4d027f78d8c), UINT64_C(0x9ef71b70c8a35640), UINT64_C(0x313d9d1e297700b9)}},
+  {{ UINT64_C(0x8bbfbd8df5f3ecb4), UINT64_C(0xc3fad1ba1b1e85d5), UINT64_C(0xcc636fb8f13c7681)}},
+  {{ UINT64_C(0x0dd8634b5c62bd91), UINT64_C(0xbc93872b0a806b0e), UINT64_C(0x14843784006d978b)}},
+  {{ UINT64_C(0xfe7a3911824d9da1), UINT64_C(0x93560432ee800e5c), UINT64_C(0xf5505882e22b9e44)}},
+  {{ UINT64_C(0xb66b79f1b2f99919), UINT64_C(0x2b535f6215e6ff0c), UINT64_C(0xc1ae9a419aef00ac)}},
+  {{ UINT64_C(0xea8671c801c53c21), UINT64_C(0x5d33b221be591bd0), UINT64_C(0x9c550c86198496be)}},
+  {{ UINT64_C(0x06f3a6731e8ff1b4), UINT64_C(0xc585d5b5b93215df), UINT64_C(0x14c49a962a172774)}},
+  {{ UINT64_C(0x455a7591cccc3dbf), UINT64_C(0xa3e6d4bbd37dd43b), UINT64_C(0x15c3d3403606d793)}},
+  {{ UINT64_C(0x9b2ba2d5fe8924ef), UINT64_C(0xa1376ec790f16763), UINT64_C(0x9ed95e0bdcc38d98)}},
+  {{ UINT64_C(0x506b8ef682491bd8), UINT64_C(0xa0c5f92780289418), UINT64_C(0xbc27c37936fae740)}},
+  {{ UINT64_C(0xb6cecb8fc36da665), UINT64_C(0x6065adbd5c7cd047), UINT64_C(0x3ae807eb5650401b)}},
+  {{ UINT64_C(0x9a2eb7c86a5139f0), UINT64_C(0x74d04aabff5d8bab), UINT64_C(0x1cb2c2794be04997)}},
+  {{ UINT64_C(0x305cb423c9888b9c), UINT64_C(0x5482c561bb8102af), UINT64_C(0x36bf30d8c3b15bc9)}},
+  {{ UINT64_C(0xabee0423704acce3), UINT64_C(0xe7339ff652e2e2c7), UINT64_C(0x99698114b810a024)}},
+  {{ UINT64_C(0x536c30d50ab28b34), UINT64_C(0xa17a80c28930fbe7), UINT64_C(0xc1483363be31b242)}},
+  {{ UINT64_C(0x239b6411cf0d7757), UINT64_C(0x18c7dd7ec93bdce4), UINT64_C(0x86e305735f513f96)}},
+  {{ UINT64_C(0x6beeb287c1859ecc), UINT64_C(0xa4884597511e8d09), UINT64_C(0x4e2b828c85c9657e)}},
+  {{ UINT64_C(0x072c98c09c9fc44c), UINT64_C(0x5a41baaedaa55525), UINT64_C(0x2d268b11c91de68d)}},
+  {{ UINT64_C(0xefa51c6489506080), UINT64_C(0xcdcf7f446fa5bcf9), UINT64_C(0xf604600457978958)}},
+  {{ UINT64_C(0xa39f89c8bfb27c6b), UINT64_C(0xe55cffe106788abf), UINT64_C(0x70e08c5b49cdfa68)}},
+  {{ UINT64_C(0x73dadd64a6d58e18), UINT64_C(0xeb4c0460b3ec8cb7), UINT64_C(0x50c175022775c384)}},
+  {{ UINT64_C(0xf5ea6d4a4245619e), UINT64_C(0x12d2901ee761b6c4), UINT64_C(0x9bbf42b8b6ac2ab4)}},
+  {{ UINT64_C(0x0fd25cd785dc0ac8), UINT64_C(0xb2bdfa194b639079), UINT64_C(0xc7a9ebb8da166276)}},
+  {{ UINT64_C(0x80098932aac674b1), UINT64_C(0xfc009b9caa2d35f7), UINT64_C(0x0362c56c84b29623)}},
+  {{ UINT64_C(0xabbd14784cb385d7), UINT64_C(0xb0b30396606299f4), UINT64_C(0x4e1b755d22d1b4f5)}},
+  {{ UINT64_C(0xbd886521fed80e0f), UINT64_C(0xb63448234b8cf97b), UINT64_C(0xbd1964e21ff32d90)}},
+  {{ UINT64_C(0xae245674dfae9619), UINT64_C(0x98938bc163b196c7), UINT64_C(0x425e6ba79aa559f6)}},
+  {{ UINT64_C(0xdae1146a587e5de0), UINT64_C(0xffb97f5af190d705), UINT64_C(0x2301b1865077b3d7)}},
+  {{ UINT64_C(0x6b10971e8b5aacdc), UINT64_C(0x75c263f75d83f5f1), UINT64_C(0x1072e2ab2a7051de)}},
+  {{ UINT64_C(0x56c7fc0b3434b54a), UINT64_C(0xa38598111e8b667c), UINT64_C(0x81b5d96d318e3995)}},
+  {{ UINT64_C(0xce4523d01f3e696c), UINT64_C(0x5ba133093a8c693c), UINT64_C(0xf964bef99dc1d7b8)}},
+  {{ UINT64_C(0x3a7d7e70d56404be), UINT64_C(0xd31a29e5cd5f8215), UINT64_C(0x1b29ace8ba890c73)}},
+  {{ UINT64_C(0xd05891b4265eb129), UINT64_C(0x7cd44c55b9a7b068), UINT64_C(0x56ecf1336a404d4f)}},
+  {{ UINT64_C(0x64b8ebc4daa3424d), UINT64_C(0x13c962cd62f136ab), UINT64_C(0x4c72aa759a3ebc9f)}},
+  {{ UINT64_C(0x3105f1af2f72476f), UINT64_C(0x2f9a1380d8310d45), UINT64_C(0x793270b2474f2454)}},
+  {{ UINT64_C(0xc9c1bae83a5cf1f1), UINT64_C(0x913760b7050fd55e), UINT64_C(0x96d20b0c95abd83d)}},
+  {{ UINT64_C(0x23275610c905431c), UINT64_C(0xa7ab70e708c39c77), UINT64_C(0x645041a9ad86a559)}},
+  {{ UINT64_C(0x4bd7ff276223df0c), UINT64_C(0x8e69e5427bd1d3ae), UINT64_C(0xb1cc3fac879b467f)}},
+  {{ UINT64_C(0x3e5b6a79f0b3cb1b), UINT64_C(0x25063695cd00da87), UINT64_C(0xcc18954880fe0667)}},
+  {{ UINT64_C(0xf6ce44ef72782ac7), UINT64_C(0x978f0c83b5853319), UINT64_C(0x25ee61bb18dad5cd)}},
+  {{ UINT64_C(0xd2fc413523caa10a), UINT64_C(0x539f594a73c06114), UINT64_C(0xdc787e53bd76d61f)}},
+  {{ UINT64_C(0xc2563b7ebb957a7a), UINT64_C(0x5bcbf7d4a3da1a0d), UINT64_C(0x89ba31c5c3e0acb1)}},
+  {{ UINT64_C(0x215270f2277b7e97), UINT64_C(0x74e10fa5f0c8d8e6), UINT64_C(0xe5155e722fefde38)}},
+  {{ UINT64_C(0x8ad025192b5249f8), UINT64_C(0x4fa94e2f5eb47836), UINT64_C(0x74d15ef0b2f2a254)}},
+  {{ UINT64_C(0x54f33e196747d2c3), UINT64_C(0xd5d474554ee2541c), UINT64_C(0xf7f667f81d285a79)}},
+  {{ UINT64_C(0x4996804eeb9a3c95), UINT64_C(0x5c30196898cbb6e7), UINT64_C(0xcdf2fb8e1bdac98e)}},
+  {{ UINT64_C(0xb548703feb5ec949), UINT64_C(0x6693dff73ce81195), UINT64_C(0x00e3d7d1707c78e6)}},
+  {{ UINT64_C(0x70c3f84f15423d4c), UINT64_C(0x1a18b0c3df7ccdc2), UINT64_C(0x651b7ced8f99fd7b)}},
+  {{ UINT64_C(0x7c70adde6cd64bcb), UINT64_C(0x3548235335852c90), UINT64_C(0x4a13436a074025f8)}},
+  {{ UINT64_C(0xf4155a2de0721136), UINT64_C(0x1883b252eb023044), UINT64_C(0x2f371a856d6d5053)}},
+  {{ UINT64_C(0xd81b96b80f02cd65), UINT64_C(0xd36422f65a2e6af9), UINT64_C(0xb313d4b2af1c673d)}},
+  {{ UINT64_C(0xe2bbeaa3d7fb6c39), UINT64_C(0x9b78034113895ec5), UINT64_C(0x79912be1dcd68437)}},
+  {{ UINT64_C(0x2a68130bbc3b0cd0), UINT64_C(0x78d638860c513e0f), UINT64_C(0x1fc4c1e617ffd6bd)}},
+  {{ UINT64_C(0x7944baf23b4bdaac), UINT64_C(0xc232d183dce5f134), UINT64_C(0x8e413cc3ec5ac34b)}},
+  {{ UINT64_C(0x2333298d1bb36063), UINT64_C(0x62de5f7e2b047472), UINT64_C(0xd28db633036a5efa)}},
+  {{ UINT64_C(0x23850c9a768c42db), UINT64_C(0x17bbeebaa6762d19), UINT64_C(0x777f82f1dc9f342d)}},
+  {{ UINT64_C(0xd697272b35f2b8b1), UINT64_C(0xb355ccf8ca77ca17), UINT64_C(0x4f5a25ea0165ce7d)}},
+  {{ UINT64_C(0x73c7e9dce953d4c7), UINT64_C(0x3cff05894d9543aa), UINT64_C(0x86d59736c7e1752d)}},
+  {{ UINT64_C(0x7f72a997b07f48fa), UINT64_C(0xba36c80cf9855ebb), UINT64_C(0x15a33479b1a39b83)}},
+  {{ UINT64_C(0xe56e2156ebe157da), UINT64_C(0xc6102353fedfa792), UINT64_C(0x9a68ad0bb155a61f)}},
+  {{ UINT64_C(0xbc899918b996e87b), UINT64_C(0x3a88781948a88744), UINT64_C(0xf49dd4625bcd949c)}},
+  {{ UINT64_C(0xf533ab22e8f0a07c), UINT64_C(0x9ac77ff54d564a80), UINT64_C(0x35226c658a81b513)}},
+  {{ UINT64_C(0x93fdf0ca6fac889b), UINT64_C(0xe9197cf0f1eb4888), UINT64_C(0xdc22526185851d59)}},
+  {{ UINT64_C(0x84f9f0c413283760), UINT64_C(0xefecc18e72b9215c), UINT64_C(0x55df7d5c921fffdc)}},
+  {{ UINT64_C(0xad6424c012e6516e), UINT64_C(0x59e8712e32b0d5f0), UINT64_C(0x093090e211d9a78c)}},
+  {{ UINT64_C(0x21e6c497d5f57e75), UINT64_C(0x61e318feb880919c), UINT64_C(0x7ca0ed95ff399719)}},
+  {{ UINT64_C(0x3b6e692319840e0b), UINT64_C(0x2501d4bdace6f40b), UINT64_C(0x4d730010c843fdeb)}},
+  {{ UINT64_C(0x6a7f4650d8dead73), UINT64_C(0x69d20c5369a759d3), UINT64_C(0xa5ade2d0b1944166)}},
+  {{ UINT64_C(0xb2149514928b9307), UINT64_C(0xd8f64bdfcd20031b), UINT64_C(0xe2736e21f3922c9a)}},
+  {{ UINT64_C(0xc17b1a7d9e229850), UINT64_C(0xe775b8181f7d2828), UINT64_C(0x3d72f8f6f8d59da2)}},
+  {{ UINT64_C(0xeac3692bf7c00ae3), UINT64_C(0xe09f89964bfacb8e), UINT64_C(0xfc63e8cbbcd1b128)}},
+  {{ UINT64_C(0x095e48de471c3dec), UINT64_C(0xc568398d4c05cc21), UINT64_C(0x48831a2dba722d4d)}},
+  {{ UINT64_C(0x211ebf34832d4420), UINT64_C(0x89989bcb1c103453), UINT64_C(0xce82c5e422d23623)}},
+  {{ UINT64_C(0x24bcdc4d405d163c), UINT64_C(0xe029ff1846ef4c3c), UINT64_C(0x911b7a7d6680e601)}},
+  {{ UINT64_C(0x9bcf01174a3a3743), UINT64_C(0x0cd5472bedbcad48), UINT64_C(0xc8cdf9013e18bbb7)}},
+  {{ UINT64_C(0x3bc15a5f783e406c), UINT64_C(0x93e364407e0e5bd2), UINT64_C(0x1c9d0199437b8e64)}},
+  {{ UINT64_C(0x0020f68cb37abe4d), UINT64_C(0x32195e111222b3e9), UINT64_C(0x58c6aa7eb5da87e4)}},
+  {{ UINT64_C(0x4381f86a4a1821ac), UINT64_C(0x49927a3a947641ff), UINT64_C(0xa55f5dded34b90c6)}},
+  {{ UINT64_C(0xb3608e02221c47c5), UINT64_C(0xf1383674432e6a8b), UINT64_C(0x59ffb1a45006bf74)}},
+  {{ UINT64_C(0x86afa965860692d3), UINT64_C(0x567853c197f4bcfe), UINT64_C(0xe35b08f0e1d0919f)}},
+  {{ UINT64_C(0x727fb114a2ae1ba5), UINT64_C(0x439533f2c6909fee), UINT64_C(0x16db4eac3a848a89)}},
+  {{ UINT64_C(0x2528d928e57fb910), UINT64_C(0xe57dbe59b89e18f6), UINT64_C(0xe587bd36c4bfcee3)}},
+  {{ UINT64_C(0xb1d74c6f9dffccce), UINT64_C(0x98fab3f06efb75f5), UINT64_C(0xa718f4efdae0b488)}},
+  {{ UINT64_C(0x9776001d3327d34d), UINT64_C(0x3b90d336bd19ab57), UINT64_C(0x15ad24663ddfa5ac)}},
+  {{ UINT64_C(0xc4e672c53f89eb5b), UINT64_C(0x4ea0507496bef963), UINT64_C(0x27907b1480a2cabc)}},
+  {{ UINT64_C(0xc7cbba7e0663955f), UINT64_C(0x48e05ba4ff3635d9), UINT64_C(0x6b05f496a956fc5e)}},
+  {{ UINT64_C(0x8428c833540a24a2), UINT64_C(0x904298a85a2a113c), UINT64_C(0x803400310d9efb98)}},
+  {{ UINT64_C(0x22a910029bba163c), UINT64_C(0x57d047c16b4dc7c6), UINT64_C(0xcf68e770850ff6f9)}},
+  {{ UINT64_C(0x4697563c10d086bb), UINT64_C(0x2bc0c0e2d313be6f), UINT64_C(0xf188b014a04c3536)}},
+  {{ UINT64_C(0xa7f7f57582cd80f3), UINT64_C(0x6e251720618cc2dc), UINT64_C(0x2561debd22a6a98e)}},
+  {{ UINT64_C(0xb4f0062287095460), UINT64_C(0x8dc3bcabe0edbdd3), UINT64_C(0x674d3f9b96e6ef4d)}},
+  {{ UINT64_C(0x53531b6d324342f9), UINT64_C(0xc3004d9a156c669a), UINT64_C(0x43c8ebccf9540893)}},
+  {{ UINT64_C(0x3f61da141e4b4cea), UINT64_C(0xe3a7588f814a7217), UINT64_C(0x6142c09d406fa612)}},
+  {{ UINT64_C(0xe9993157391cdd00), UINT64_C(0x440e65ab42dd2784), UINT64_C(0x676603db43ba944e)}},
+  {{ UINT64_C(0x7295ef04809c11f0), UINT64_C(0x2242961ac883221e), UINT64_C(0x99804835ad490fa2)}},
+  {{ UINT64_C(0x49a8a9e117e266ac), UINT64_C(0xa41678b009aea7e1), UINT64_C(0x080bd74384a6d141)}},
+  {{ UINT64_C(0x314806d8604bd365), UINT64_C(0xac5b891aa6c94f9f), UINT64_C(0x063cab7cbaa0c057)}},
+  {{ UINT64_C(0x531f26d369b3831a), UINT64_C(0xfcbce8d6da08a7fc), UINT64_C(0xda5dc59b0e932af8)}},
+  {{ UINT64_C(0x64c1f0e7ce42ad27), UINT64_C(0x6d9ecb9c6a3b8e70), UINT64_C(0xa7649225a64e2eae)}},
+  {{ UINT64_C(0xa2d916f97cebfc14), UINT64_C(0x5f986b0c6de1bda1), UINT64_C(0xd66406c456d99b81)}},
+  {{ UINT64_C(0xaed43ee21dd446fe), UINT64_C(0x00a5135e850c0459), UINT64_C(0x45eb421b35ae25d0)}},
+  {{ UINT64_C(0xa9697185dfa25ca9), UINT64_C(0xb1e5286fb51438a1), UINT64_C(0xa0dd0c014ee45453)}},
+  {{ UINT64_C(0x923dac70d8d91043), UINT64_C(0xc6919ecc231d418d), UINT64_C(0xd06a822da12c8cff)}},
+  {{ UINT64_C(0xaf11ea4a1fb5394f), UINT64_C(0x60371ef647200554), UINT64_C(0xb9a56d87f2c49226)}},
+  {{ UINT64_C(0x4668fefb258b7833), UINT64_C(0xc761785c85e660c2), UINT64_C(0x56b611b6351a9f97)}},
+  {{ UINT64_C(0x8e81acb53c85f762), UINT64_C(0x2c403c138ed03348), UINT64_C(0xcc1d6735e2fbb1e8)}},
+  {{ UINT64_C(0xf473264a105540a4), UINT64_C(0xe5d012894696091a), UINT64_C(0x6051df9d4dd90a06)}},
+  {{ UINT64_C(0x8934e2f0c9d62b6e), UINT64_C(0x559f23666b7853e1), UINT64_C(0x12e5265fc55f8bef)}},
+  {{ UINT64_C(0x82bcfae4a00d2bf0), UINT64_C(0xa2e3bef3596ab31d), UINT64_C(0x432935ac49073667)}},
+  {{ UINT64_C(0x2a0b147fff7baca9), UINT64_C(0x7770dfc780f0c57a), UINT64_C(0x5e6c4d75506306ee)}},
+  {{ UINT64_C(0x99cc07f70d614c03), UINT64_C(0x84faab4a91b203aa), UINT64_C(0x1f421ed8c91d13ef)}},
+  {{ UINT64_C(0x0138b81f800a6446), UINT64_C(0x3f5133b9b6e82dee), UINT64_C(0xb33c036e9faa26c8)}},
+  {{ UINT64_C(0x4a45738111f53b7f), UINT64_C(0x1ac91a5638ac7c5b), UINT64_C(0xc37d456e75c53c17)}},
+  {{ UINT64_C(0x899fec147f5fd363), UINT64_C(0x262bd516b7a3115c), UINT64_C(0x89a58531b270eae7)}},
+  {{ UINT64_C(0x61864d8d49277435), UINT64_C(0xc1bcf74c6b8f3196), UINT64_C(0x377a379ec1272806)}},
+  {{ UINT64_C(0xef2be4540a9ccbcd), UINT64_C(0x3361ef795dcc4913), UINT64_C(0x888f01c6133661cb)}},
+  {{ UINT64_C(0x95bb7b99034853c9), UINT64_C(0x112ba1dc3c85d48f), UINT64_C(0x3b99beb1f47f9077)}},
+  {{ UINT64_C(0x23c8facb14f0a813), UINT64_C(0x59b0960cbf3be7c9), UINT64_C(0x07d74bb66119ed07)}},
+  {{ UINT64_C(0x073111f83eab7a73), UINT64_C(0x4ad7ed98634fd7ad), UINT64_C(0x7a345031afa83718)}},
+  {{ UINT64_C(0xd24c09661dda6141), UINT64_C(0x353ee721d1ac40fc), UINT64_C(0xc3d48bbc67221c4a)}},
+  {{ UINT64_C(0x6cad996ce26bbe7e), UINT64_C(0x65598ff026d20120), UINT64_C(0x5b1e6f96322cf9f2)}},
+  {{ UINT64_C(0x0fea5e6819cf0b52), UINT64_C(0x49a7bb3a56a45a11), UINT64_C(0xd15d972d252edf49)}},
+  {{ UINT64_C(0xead6f1a2833039fc), UINT64_C(0x768f1208be120113), UINT64_C(0x8dfc250fbeeb3106)}},
+  {{ UINT64_C(0xa5177023f7024dcd), UINT64_C(0x5c6f48100f884593), UINT64_C(0x9f2b29f6eb565111)}},
+  {{ UINT64_C(0xf0001ad672041ea9), UINT64_C(0x4ac4a185ebee404a), UINT64_C(0xf2cfad01ca44c0d4)}},
+  {{ UINT64_C(0xc92a6da9473b55d6), UINT64_C(0xdef57322097c563a), UINT64_C(0xb561328f46251bd2)}},
+  {{ UINT64_C(0xb2560c216c6c8791), UINT64_C(0x65cb2c370fe845e1), UINT64_C(0x6389c11e6a680406)}},
+  {{ UINT64_C(0x9634a91702046305), UINT64_C(0xba26e9cc98fdf347), UINT64_C(0x78d338b074143e29)}},
+  {{ UINT64_C(0xe2a42fc139b83960), UINT64_C(0x0312cef3899ef13b), UINT64_C(0x85a27e3eb75b5081)}},
+  {{ UINT64_C(0x38a1ff8346c0277e), UINT64_C(0x3c17dc1685ffdf39), UINT64_C(0xb54557f7b84bf00b)}},
+  {{ UINT64_C(0x0922e77de2f87ef7), UINT64_C(0xc51c416953413a83), UINT64_C(0x0e2db8e0d6fadf53)}},
+  {{ UINT64_C(0x56f4f5413193f793), UINT64_C(0xcc1b2f583d436dc1), UINT64_C(0x7825e180c7d08f03)}},
+  {{ UINT64_C(0xe8fe8148e27e871b), UINT64_C(0x29d238745a209ce4), UINT64_C(0x7790f8c3e5823d02)}},
+  {{ UINT64_C(0xe95e8a5b13e98cfe), UINT64_C(0x49951db478a1dee7), UINT64_C(0x4933cd4d55867813)}},
+  {{ UINT64_C(0xe8f9bd0c04f12cc7), UINT64_C(0x3404000e65fb2055), UINT64_C(0x74f6a3dccdc0549c)}},
+  {{ UINT64_C(0xb8714c99b0025d33), UINT64_C(0x15ac1e20c4d9342f), UINT64_C(0xcd6d35e3835b3aa0)}},
+  {{ UINT64_C(0xffa657a6bea3272e), UINT64_C(0x585f69c27a71ccde), UINT64_C(0x4cc1b3e759659e00)}},
+  {{ UINT64_C(0xc9088aeb571cd5eb), UINT64_C(0x72c66bd5d100b70e), UINT64_C(0x26361eb53e8d6cfb)}},
+  {{ UINT64_C(0xe8e48bb00f6a8f7d), UINT64_C(0x56f4da493d059231), UINT64_C(0xb2f6a465f8658703)}},
+  {{ UINT64_C(0x686a02061d6645bb), UINT64_C(0xccae88f774a4c2c4), UINT64_C(0xbd52b2f890490bc7)}},
+  {{ UINT64_C(0x3d88a437d633b2ea), UINT64_C(0x97f0987f6f738a0f), UINT64_C(0x03c72ffb05c192eb)}},
+  {{ UINT64_C(0x3f583f98095fdc2b), UINT64_C(0xcd69d3094955a77e), UINT64_C(0x08ba37e69f603c64)}},
+  {{ UINT64_C(0x5f92c3c283936672), UINT64_C(0x3ae41171f49f3fa4), UINT64_C(0xd4c0adbc865911fc)}},
+  {{ UINT64_C(0x65e2a13d2a04d53f), UINT64_C(0x2ebd29fb05b559c5), UINT64_C(0xae58f472991567f5)}},
+  {{ UINT64_C(0x933f077a7745c99b), UINT64_C(0x795171e5ed23b92c), UINT64_C(0x060801daebfbbf88)}},
+  {{ UINT64_C(0xd357a164b5470ef7), UINT64_C(0xad7ebdb8a4aea215), UINT64_C(0xebc01a1a7a8ad814)}},
+  {{ UINT64_C(0x59ca9d9fbf581f31), UINT64_C(0xa2db116828390c45), UINT64_C(0xbe8aabd598ac5688)}},
+  {{ UINT64_C(0x10c75b5517249835), UINT64_C(0xb45e7759222dd11d), UINT64_C(0x12a8c83f23b5f439)}},
+  {{ UINT64_C(0x5cf59659b46d4695), UINT64_C(0x038add79831cc950), UINT64_C(0x4f9c351f5d7c0b20)}},
+  {{ UINT64_C(0x11a1a78e91da1636), UINT64_C(0xe3c0b607d205893d), UINT64_C(0x299f23aaf4c16190)}},
+  {{ UINT64_C(0x429fcd19e124eb05), UINT64_C(0xceec2d82c3a7ef41), UINT64_C(0x1ce70351650be844)}},
+  {{ UINT64_C(0x1f50493c4c088ec0), UINT64_C(0x79a44534f121322a), UINT64_C(0x79cb7a17356c1f5e)}},
+  {{ UINT64_C(0x8b663ca6d4130829), UINT64_C(0xe8a3af5e358e9d17), UINT64_C(0xbe7b9efe8f46831c)}},
+  {{ UINT64_C(0xbf24d9edb3c772be), UINT64_C(0x3f46b5a62297aee7), UINT64_C(0x4422d3181a596421)}},
+  {{ UINT64_C(0xc12a6d863ec686ab), UINT64_C(0xa687006275fcf991), UINT64_C(0x9c297bb82ea299bf)}},
+  {{ UINT64_C(0x4a654b72d1782ec5), UINT64_C(0x93ae668203386937), UINT64_C(0x59a68cb1bff40b58)}},
+  {{ UINT64_C(0xb644bf45e6f4c65f), UINT64_C(0xcb3669213803a8cc), UINT64_C(0x8b8af66430b3d45b)}},
+  {{ UINT64_C(0x6f04c9f147cd47df), UINT64_C(0xa5da64bc27d69b8f), UINT64_C(0xbc456cae7a0dc766)}},
+  {{ UINT64_C(0x2ea53577ebef86a8), UINT64_C(0x5dacfe52e27bb72b), UINT64_C(0x3c474436551ab8bf)}},
+  {{ UINT64_C(0xe608a90f59e0f240), UINT64_C(0x0503801ccd1114ae), UINT64_C(0xb5e6853624a7a148)}},
+  {{ UINT64_C(0xaa8249aa983f4c88), UINT64_C(0x9bd48b2f1bd36a15), UINT64_C(0xc9c1cf956852b3f3)}},
+  {{ UINT64_C(0x924dc91d5f399e0a), UINT64_C(0xd392ad50abd65945), UINT64_C(0x24e31103771add69)}},
+  {{ UINT64_C(0xbd1569b87bf52b67), UINT64_C(0xef79f3a00ad7337d), UINT64_C(0x214138fbc704db42)}},
+  {{ UINT64_C(0x95eeafe290c0cfd6), UINT64_C(0xf0a5d1abdea3d381), UINT64_C(0x4778d2af7b63d158)}},
+  {{ UINT64_C(0x8a330e28ea53e933), UINT64_C(0x652f2399b2e78a5f), UINT64_C(0xa2ec7d76c8c57d74)}},
+  {{ UINT64_C(0xeba4de3be69cefe4), UINT64_C(0x2c994165a74433b5), UINT64_C(0x56070082a5207181)}},
+  {{ UINT64_C(0x3ce7ebdb52a6cc71), UINT64_C(0xbd11ed13fd3b97c2), UINT64_C(0xf138ae4516b7cc5b)}},
+  {{ UINT64_C(0x363b6f09bd9082ad), UINT64_C(0x262038b204fb64d8), UINT64_C(0x2def0da04ccbe267)}},
+  {{ UINT64_C(0xf704d689f59b92e2), UINT64_C(0xab4a0c9a0c21f9b0), UINT64_C(0xa426267bd292e7a3)}},
+  {{ UINT64_C(0x571b967fbdf9e54e), UINT64_C(0xb6fc0605249d1a02), UINT64_C(0xe53b5fe7e66fda3f)}},
+  {{ UINT64_C(0x93c96c0e2bac0ad8), UINT64_C(0xf765c46c76c62fe1), UINT64_C(0xc71757e6d1b51ac8)}},
+  {{ UINT64_C(0xd37f6ccf054a94e9), UINT64_C(0x4a6f45377e0e2e21), UINT64_C(0x701e2673d0873166)}},
+  {{ UINT64_C(0x9bc01bf4a7da90bb), UINT64_C(0x09b7d533075b3b9f), UINT64_C(0xc13832009c9708bb)}},
+  {{ UINT64_C(0x19c0c6b1032e7f26), UINT64_C(0xc7385e11fdaec2be), UINT64_C(0x29b7197480f3a453)}},
+  {{ UINT64_C(0x62dc4cc5a6b4fa40), UINT64_C(0xfba88ef2f9890e93), UINT64_C(0x23695ec039df49da)}},
+  {{ UINT64_C(0x8f93044824834789), UINT64_C(0x7b818759b3d399a1), UINT64_C(0xfa0c436fa05bd9b5)}},
+  {{ UINT64_C(0x21e1e545b1a3c844), UINT64_C(0x92036a997865d9d6), UINT64_C(0xf032bc50ba7c612e)}},
+  {{ UINT64_C(0xa427005ef75ab9c5), UINT64_C(0x045a68e841a4fc09), UINT64_C(0x9912ad47b4e49a60)}},
+  {{ UINT64_C(0x8b92cded5e34a4e1), UINT64_C(0xe4aadc96a75ba2e9), UINT64_C(0xcf185c921ae5be7d)}},
+  {{ UINT64_C(0xf6fe6e76b47bcd47), UINT64_C(0x6ee1b04417115e10), UINT64_C(0xa3a17564f0d31722)}},
+  {{ UINT64_C(0x0da628f0ff86120d), UINT64_C(0x214ab9757f601f8a), UINT64_C(0xc268d50e7474d83e)}},
+  {{ UINT64_C(0x61e0ea5e50a19c59), UINT64_C(0x9a623a882ba37eae), UINT64_C(0x542d66eddd35c07b)}},
+  {{ UINT64_C(0x80d5f39696c165b7), UINT64_C(0xeab36904450d4e69), UINT64_C(0xd8532a1c7fb3d3da)}},
+  {{ UINT64_C(0xd60b1bbac41fa9bf), UINT64_C(0xcf3ad684894bcd42), UINT64_C(0xa22fac1de255710c)}},
+  {{ UINT64_C(0xe226090092d77471), UINT64_C(0xfceba99e51339aaa), UINT64_C(0xa67e26e2f799f9ea)}},
+  {{ UINT64_C(0x36d214f9834cba62), UINT64_C(0x0149f395f2051c9a), UINT64_C(0x2fc8b26f09375cfc)}},
+  {{ UINT64_C(0x2b2b8d141bf4f447), UINT64_C(0xca88da0683b98ef3), UINT64_C(0x8fa5d67d2a4a8a84)}},
+  {{ UINT64_C(0xd8757f64dd977ecc), UINT64_C(0xdb508762c0b48793), UINT64_C(0xb0c0b24ad3f2c879)}},
+  {{ UINT64_C(0xb34525e1f6466016), UINT64_C(0xa6a018f66e25bf48), UINT64_C(0xa151e862d8819199)}},
+  {{ UINT64_C(0x9302539f2c1b9274), UINT64_C(0xa0cfa71d20a2c9ba), UINT64_C(0x3aba93c51f17fe92)}},
+  {{ UINT64_C(0x5bad959fc1295702), UINT64_C(0xc09acbfe57f5248a), UINT64_C(0x8814a57690297f80)}},
+  {{ UINT64_C(0xf38865f2ee13340b), UINT64_C(0x088f7863675f5175), UINT64_C(0xe56b40b3ce1c5223)}},
+  {{ UINT64_C(0xe5f0755693f38329), UINT64_C(0x5630c2b5aef1ce5e), UINT64_C(0x5c701e20a0b8e5b9)}},
+  {{ UINT64_C(0xa200f5ffa002fcff), UINT64_C(0xfdfffaea6c0ad1e9), UINT64_C(0xd64cdff4d78a7952)}},
+  {{ UINT64_C(0x2494ab53f44a24e2), UINT64_C(0x1ac1e203ab061024), UINT64_C(0x4ee63b2c73413350)}},
+  {{ UINT64_C(0xea44ac37d0e0cadd), UINT64_C(0x664514a39e7f2112), UINT64_C(0x20d3e7c67639b87f)}},
+  {{ UINT64_C(0x9cd23ccfc9775bed), UINT64_C(0x79a9ad0b2608c4cd), UINT64_C(0x518a55a944025846)}},
+  {{ UINT64_C(0x5b918fcfd844cf2e), UINT64_C(0xed423ec8c64b4b55), UINT64_C(0x2850da11ac3a75e5)}},
+  {{ UINT64_C(0x38be5820371cec3f), UINT64_C(0xd61b59c78339b042), UINT64_C(0xe1a9c0ec1a2e1013)}},
+  {{ UINT64_C(0x086c3ece395d3336), UINT64_C(0x30ffbe0097d6cdcd), UINT64_C(0x716e06a83e493de6)}},
+  {{ UINT64_C(0xd5ff409de14fe37e), UINT64_C(0x6fa28f59ab09981d), UINT64_C(0xd2a3ac84e3197098)}},
+  {{ UINT64_C(0x14e6cd90461e1301), UINT64_C(0x0e6b9708069ff201), UINT64_C(0x5b4521bd3f1c8ffe)}},
+  {{ UINT64_C(0x7a976636742976ec), UINT64_C(0x7e5ae07ff517d0ea), UINT64_C(0x15424925e7c8aad7)}},
+  {{ UINT64_C(0x1e24ad150f8fdd76), UINT64_C(0xbc4d3c06a701a81d), UINT64_C(0x92048c7e7e569e6f)}},
+  {{ UINT64_C(0x3180d2f37ba82791), UINT64_C(0x6a13aa786bc0de34), UINT64_C(0x5ad62bb7fc40cbed)}},
+  {{ UINT64_C(0x58a9c4fcc81adf0b), UINT64_C(0x40d1f531b91a84e3), UINT64_C(0xba571694f59108e9)}},
+  {{ UINT64_C(0xf39d451887247ff6), UINT64_C(0x7830dde48d56f618), UINT64_C(0x4b50b8ead80b379c)}},
+  {{ UINT64_C(0x21dcc05c485afbb3), UINT64_C(0xfe7498ae0b8eb63e), UINT64_C(0x5397dff6cac581b9)}},
+  {{ UINT64_C(0x6ed4b11ec082055f), UINT64_C(0x99c5e4aae8200952), UINT64_C(0xd5ce802993a320e7)}},
+  {{ UINT64_C(0x097f2451e6434502), UINT64_C(0xaddf488182eb1701), UINT64_C(0xbfdda9b9cceba8ec)}},
+  {{ UINT64_C(0x26695259bdd4b0b7), UINT64_C(0x4010655aa16c9976), UINT64_C(0x8fdf12f610fc9caf)}},
+  {{ UINT64_C(0xf5871f90844d2b52), UINT64_C(0x811f03d9fd72dd09), UINT64_C(0x349da4ee77a3b826)}},
+  {{ UINT64_C(0xe55b0abc5ec9c727), UINT64_C(0xb746919b5db8a4b1), UINT64_C(0x9e31357dd2a2b7f6)}},
+  {{ UINT64_C(0xe39f76a0f9eebe2c), UINT64_C(0xd53a43fab1a7c862), UINT64_C(0x5ff0d800f1991bd7)}},
+  {{ UINT64_C(0x6139907fed182571), UINT64_C(0x3b184aa9231494ac), UINT64_C(0x20627f43cf6b0bf4)}},
+  {{ UINT64_C(0xef66eb316faa3f34), UINT64_C(0xfd3ef780c1d043c0), UINT64_C(0xf43cc7cb94a2df2d)}},
+  {{ UINT64_C(0x8fcc85267b3ae913), UINT64_C(0x10b200f568ea34e3), UINT64_C(0x211d482e0ddf4725)}},
+  {{ UINT64_C(0x606196256f3565c2), UINT64_C(0x665d940ee1791c7a), UINT64_C(0x3dabeafc278b93fd)}},
+  {{ UINT64_C(0x593b90d515fff95a), UINT64_C(0x00705e7db6e87101), UINT64_C(0x34208931e02e8ee4)}},
+  {{ UINT64_C(0x3bb7355a4df123d0), UINT64_C(0x0762b70649be98f1), UINT64_C(0xc2e5e7fa82f84cd7)}},
+  {{ UINT64_C(0xd2ff36e13d9da330), UINT64_C(0x4121314035d27ac3), UINT64_C(0x4d92884212676a5d)}},
+  {{ UINT64_C(0x00793f50e04796d7), UINT64_C(0x9054abeb5bfd5f98), UINT64_C(0x9a5747d6c99db82a)}},
+  {{ UINT64_C(0x7f3411fb1c75c056), UINT64_C(0xddc773735bf889f4), UINT64_C(0x5836f8976f59d4cb)}},
+  {{ UINT64_C(0x2a57886d6f576269), UINT64_C(0xc0918807aac7a652), UINT64_C(0xea0bd337bb89a0f0)}},
+  {{ UINT64_C(0x6281cfc66576d335), UINT64_C(0x70d4ef7c07668534), UINT64_C(0x405029799886c7f0)}},
+  {{ UINT64_C(0x13509b9a5796aadf), UINT64_C(0x5eedac3ae63c5c37), UINT64_C(0xb0cc20dd3559b55b)}},
+  {{ UINT64_C(0xf0eaa5b690a7099d), UINT64_C(0x1c5abe615e487399), UINT64_C(0x98ae74d390003d9a)}},
+  {{ UINT64_C(0xe5b23a2bda7f3831), UINT64_C(0x296180d72f3abac7), UINT64_C(0x96b178956bd8ef0d)}},
+  {{ UINT64_C(0x0b965886b944021e), UINT64_C(0x21b187d632d24a83), UINT64_C(0x28a147b3763da360)}},
+  {{ UINT64_C(0x4e8e6637fb1fa32c), UINT64_C(0x88846c5d994fa8b0), UINT64_C(0x148cffec31956c13)}},
+  {{ UINT64_C(0xf6957ba43657409c), UINT64_C(0x73db9a24e81ff07d), UINT64_C(0xd35fe92adff37d43)}},
+  {{ UINT64_C(0x7de53a0365714523), UINT64_C(0x0fde4d92183bf4ce), UINT64_C(0xf50eb4b067cc92f7)}},
+  {{ UINT64_C(0x1651814c3cdc7e44), UINT64_C(0xd6d4b6b40d7ffdbe), UINT64_C(0xadf49856bb9e9f3a)}},
+  {{ UINT64_C(0x3801015eaace86e0), UINT64_C(0x9356a36420f4c8c7), UINT64_C(0x07766df9408d1bb2)}},
+  {{ UINT64_C(0x99f9996df6574291), UINT64_C(0x4e59a2f5938fc356), UINT64_C(0x3c7712587845974e)}},
+  {{ UINT64_C(0xd14a435c557719bb), UINT64_C(0xdba115c6a71216c8), UINT64_C(0x337075652a74d098)}},
+  {{ UINT64_C(0xe13aee217dedd993), UINT64_C(0x061c16185f552306), UINT64_C(0x10f4d450732a9727)}},
+  {{ UINT64_C(0x1c7778a7aa919e9c), UINT64_C(0x86c3174376319c4d), UINT64_C(0xde82b364737f8370)}},
+  {{ UINT64_C(0x01d943456d07d8b9), UINT64_C(0xd40ec83aa74ae3ba), UINT64_C(0x008970cac9b72be4)}},
+  {{ UINT64_C(0x89e11353be65d4f1), UINT64_C(0xb63bcae617c4cd73), UINT64_C(0x0e8e43e15578b34c)}},
+  {{ UINT64_C(0xcd5aa7739a923857), UINT64_C(0xa27c56c0ad8fbc05), UINT64_C(0x7483b1c671f5b1ca)}},
+  {{ UINT64_C(0xd2e63630d92d2ca4), UINT64_C(0x5eff0b9940f7d856), UINT64_C(0xfa9c473e148bb446)}},
+  {{ UINT64_C(0x2f75b451a687dcc3), UINT64_C(0x06bc9ddd6a2ad18e), UINT64_C(0xa07a3fc452a98ace)}},
+  {{ UINT64_C(0x1540ceb1e2dde176), UINT64_C(0xde3f7270dd213427), UINT64_C(0xf119c278504b9f26)}},
+  {{ UINT64_C(0xd289af23b64b8433), UINT64_C(0xa8397369f0b596e8), UINT64_C(0xb0828a1e5815bb92)}},
+  {{ UINT64_C(0x60b2550f8fe9b5bd), UINT64_C(0x40a7b65059718b07), UINT64_C(0xfe83a52c58112797)}},
+  {{ UINT64_C(0xc947597e3edb895d), UINT64_C(0x0a5feb44fab35ab9), UINT64_C(0xf258cc2ff156771a)}},
+  {{ UINT64_C(0x1c455595b12eb8cd), UINT64_C(0xaddad1f96d4b573b), UINT64_C(0xda9a9d316810d3de)}},
+  {{ UINT64_C(0xe37186398bbf95da), UINT64_C(0xc506dc6c90d123bc), UINT64_C(0xb49e08d206a354af)}},
+  {{ UINT64_C(0xae337569c2a6117d), UINT64_C(0x10bac64cf01d07af), UINT64_C(0x0390e02dee44b224)}},
+  {{ UINT64_C(0xbef34cae009b6bc1), UINT64_C(0x3d6e18fced1c3c78), UINT64_C(0x872b32165654e8ad)}},
+  {{ UINT64_C(0x75e2b1fa1e97e70d), UINT64_C(0x3a4b98b7f9efbc51), UINT64_C(0x347f7a6e9bacae7c)}},
+  {{ UINT64_C(0xe968c5694754a6d8), UINT64_C(0xbcd3464beb483616), UINT64_C(0x53bebb5f48c0e7b3)}},
+  {{ UINT64_C(0xd520a45552be838f), UINT64_C(0x6cd3b35ee4386ec3), UINT64_C(0xcf42a670e2dc114e)}},
+  {{ UINT64_C(0x0085b329cd8d4445), UINT64_C(0x9d19f27fe19b3bbf), UINT64_C(0xd52d5cb6e7ad7253)}},
+  {{ UINT64_C(0x6de93023e687d9b8), UINT64_C(0x33e135617ab9afbe), UINT64_C(0xb43592bb4eb76353)}},
+  {{ UINT64_C(0xfea1d7ada2640552), UINT64_C(0x4985080d2bcf4abd), UINT64_C(0xe9b723ac18240b7f)}},
+  {{ UINT64_C(0xdc56a0c1b02fdb9e), UINT64_C(0xe1808afb8c9740c7), UINT64_C(0x01a47459b453312b)}},
+  {{ UINT64_C(0x9e908d262e371448), UINT64_C(0x6c2bcf100669e610), UINT64_C(0xe7856e09389b79ad)}},
+  {{ UINT64_C(0xfb8ae323d7951d16), UINT64_C(0xb48f800382f4e09d), UINT64_C(0x659beaaede57d132)}},
+  {{ UINT64_C(0x11bd328a58b99398), UINT64_C(0x3c31d7c5e25b8762), UINT64_C(0xe35d46f6d498b928)}},
+  {{ UINT64_C(0x6d86fb27abbfc1b1), UINT64_C(0xc8ef4dda40cfac2e), UINT64_C(0xa628226f845d4bbe)}},
+  {{ UINT64_C(0xf73383e46ffccc7b), UINT64_C(0xe534cdd187078826), UINT64_C(0x19e9fd9a2bffabd4)}},
+  {{ UINT64_C(0xb32d899c2b052d73), UINT64_C(0x81b23e9b814a68c6), UINT64_C(0xedc6377b9d102bf1)}},
+  {{ UINT64_C(0xae065f6e1fd06882), UINT64_C(0x511b9d72272d0ccc), UINT64_C(0x66349cc31c1b6052)}},
+  {{ UINT64_C(0xa46e4037888582ed), UINT64_C(0x77d7673fa7630832), UINT64_C(0x0aba798ddb426471)}},
+  {{ UINT64_C(0x2243cb7b0ab34ff6), UINT64_C(0x0a095f4701f925b8), UINT64_C(0xc873f5cb5627f860)}},
+  {{ UINT64_C(0xec2036ecf16304d3), UINT64_C(0x4596156fb9f26650), UINT64_C(0x98834759e996f446)}},
+  {{ UINT64_C(0x1c88287ba69807a0), UINT64_C(0x97b4eb5151529687), UINT64_C(0x17daf5c3b4fa69fd)}},
+  {{ UINT64_C(0x2d88b1d60f741995), UINT64_C(0x46ca14622e9662ec), UINT64_C(0x23a3308f8397dfd2)}},
+  {{ UINT64_C(0x3743509ea6b5c2df), UINT64_C(0xf25da38bcc22c089), UINT64_C(0x7bd2cd3ac19f782a)}},
+  {{ UINT64_C(0xb67c5d1febbde8df), UINT64_C(0xbbc87583583708d2), UINT64_C(0x0079c74eec70dd2e)}},
+  {{ UINT64_C(0x511ab65303bc6cec), UINT64_C(0xdf79d06df6082873), UINT64_C(0x92d9aa775f5d2693)}},
+  {{ UINT64_C(0xac846bec8c52abb5), UINT64_C(0x4ab7941bffd3706f), UINT64_C(0x23769e1c2ca4f959)}},
+  {{ UINT64_C(0xe05caeefe83beb22), UINT64_C(0x9e0c5652eb318358), UINT64_C(0x603179ebef6a2c20)}},
+  {{ UINT64_C(0xc4ac9db37d8f14ce), UINT64_C(0xc1e9861131de5548), UINT64_C(0x65666d4d5341e5ee)}},
+  {{ UINT64_C(0x1695e149562932bc), UINT64_C(0xfb58c01905dbe6c7), UINT64_C(0x44f43282354b9508)}},
+  {{ UINT64_C(0x011f6ee239b2322c), UINT64_C(0x14ca6853a13d5c3f), UINT64_C(0x22cdfe92ad64fcca)}},
+  {{ UINT64_C(0xe749f1d277c3af29), UINT64_C(0x3c3041c4e81bd8c6), UINT64_C(0xa3b2eff4ebbfe98c)}},
+  {{ UINT64_C(0xdf6faf95f00f17d9), UINT64_C(0x24cd394f2298b7a6), UINT64_C(0x19905d56c1972b9d)}},
+  {{ UINT64_C(0x368110aa8fd578c6), UINT64_C(0xbf49cb485302e858), UINT64_C(0x836d515e902cb2b2)}},
+  {{ UINT64_C(0x4b0f43fa8a98b066), UINT64_C(0xda906db7fdbc1959), UINT64_C(0x6652972b14e5fc35)}},
+  {{ UINT64_C(0xe981129b1f18b070), UINT64_C(0xd64eaac2f0305ffd), UINT64_C(0xab81dbce9026faca)}},
+  {{ UINT64_C(0xcf9f6bf34288cc83), UINT64_C(0x026772abcedb8d6c), UINT64_C(0x54e884a416435bbf)}},
+  {{ UINT64_C(0x1b336e4e2ba15c94), UINT64_C(0x2300253b300b6898), UINT64_C(0xc8496be5429cd30f)}},
+  {{ UINT64_C(0x4f91f695b147c8b8), UINT64_C(0x81aee2dc0089f4cc), UINT64_C(0x08ca238ac4bdf311)}},
+  {{ UINT64_C(0xccc9ff940f3609f2), UINT64_C(0xf350b5aa2315647f), UINT64_C(0x67ca084976a4ebb5)}},
+  {{ UINT64_C(0x8e03c091a5aa2bc5), UINT64_C(0x8b8096d9a3f74391), UINT64_C(0x468e86a12ed4e054)}},
+  {{ UINT64_C(0x281ae7da6063840b), UINT64_C(0x384b42314e7d0ddb), UINT64_C(0xfcd93da60615336d)}},
+  {{ UINT64_C(0xcee29ff574bfb3c2), UINT64_C(0x39d05a29f223601d), UINT64_C(0x82b813a528939d9a)}},
+  {{ UINT64_C(0x4edede724c4737ae), UINT64_C(0x88593353b8ed5012), UINT64_C(0x5c257c847a98e2a0)}},
+  {{ UINT64_C(0x22171a6dfc2d0a03), UINT64_C(0x688f725a2abe05ad), UINT64_C(0x3c7e2efe70607010)}},
+  {{ UINT64_C(0xac6b463996a3215d), UINT64_C(0x5d4f5d3f3bb5cbde), UINT64_C(0x319f900569ad0555)}},
+  {{ UINT64_C(0x9dc1da6dcba387ec), UINT64_C(0x3326294f2fce5968), UINT64_C(0x23747165898bd2f2)}},
+  {{ UINT64_C(0x2d0e10194eb3879c), UINT64_C(0xb0a95fb038e4615a), UINT64_C(0x47c5f78786a9c68f)}},
+  {{ UINT64_C(0xe3d4a2d46a2a20e3), UINT64_C(0x3127ea0e2950633e), UINT64_C(0x5d3b5625a0b8fe9e)}},
+  {{ UINT64_C(0xfd1a334953ddbe68), UINT64_C(0x8663130c81da6d96), UINT64_C(0xc073ad92cb088d64)}},
+  {{ UINT64_C(0xd2aa4a2dd5385d25), UINT64_C(0x2916f87b441ef712), UINT64_C(0x991ad17e948253c3)}},
+  {{ UINT64_C(0x053ad9bb8deefe52), UINT64_C(0xf3fdb4b1da99dc5c), UINT64_C(0xbcf0637008288664)}},
+  {{ UINT64_C(0x761c135f07661136), UINT64_C(0xfcf7326368028198), UINT64_C(0xfa9fcb539457942f)}},
+  {{ UINT64_C(0x8f19654f33831118), UINT64_C(0x2118c0d10c4e5cd4), UINT64_C(0x9c47b22fc23d100a)}},
+  {{ UINT64_C(0xdb3d4be39931a0e4), UINT64_C(0x743fea396ae8621f), UINT64_C(0x7efd5f8c3b24603a)}},
+  {{ UINT64_C(0x8df946c383b92370), UINT64_C(0x720945a361406d77), UINT64_C(0x43764004fb524a45)}},
+  {{ UINT64_C(0x16ff308f469e8c60), UINT64_C(0x7de36d6b5146edb4), UINT64_C(0xe4142d8f30bf2eed)}},
+  {{ UINT64_C(0x3dc1d6d1cd122a8d), UINT64_C(0x917e3195ceba8fda), UINT64_C(0x00772ebac984ba89)}},
+  {{ UINT64_C(0x9b8abff29195ee32), UINT64_C(0x1b9df9cc1d1635b5), UINT64_C(0xacb2468080a4a15d)}},
+  {{ UINT64_C(0x277cec2b41c0b45b), UINT64_C(0x55e028ed29b1c292), UINT64_C(0xc486ae9cb6d1b3d7)}},
+  {{ UINT64_C(0x707570e8d457208b), UINT64_C(0x0928534d4cfb17e6), UINT64_C(0x7eeb8cc1bc426751)}},
+  {{ UINT64_C(0x540d427771ee4a7f), UINT64_C(0xebc3e4aaf92c0495), UINT64_C(0x2aa32fb6c8f0adfe)}},
+  {{ UINT64_C(0x3d55fab3825ff115), UINT64_C(0x418cff3651743498), UINT64_C(0x58d91085cec87a3c)}},
+  {{ UINT64_C(0xc8264a8a139973c0), UINT64_C(0x2efb69f222b4ef06), UINT64_C(0x0a3ca49d504a8659)}},
+  {{ UINT64_C(0x5db595bdcf0900fb), UINT64_C(0x3fe8ebbe215c1ae8), UINT64_C(0x69dcbebf45b5cd2d)}},
+  {{ UINT64_C(0xd230683f3a7ab13e), UINT64_C(0xbed673b346aedcce), UINT64_C(0xdaec0e1f208834cc)}},
+  {{ UINT64_C(0x6a9503be21450f05), UINT64_C(0x71f924fdc0f1a0b1), UINT64_C(0x3607627908590ea9)}},
+  {{ UINT64_C(0x4852f9a4d48dbe5a), UINT64_C(0xeeed52807e65bbb8), UINT64_C(0x24835dc8598df4e8)}},
+  {{ UINT64_C(0x1a2bb57b7f65e167), UINT64_C(0x2c823f5bcc430a98), UINT64_C(0x2bec4464f0224870)}},
+  {{ UINT64_C(0x83b4de517448d367), UINT64_C(0x42e9ff3b5a7e12dd), UINT64_C(0xd447583b98db2578)}},
+  {{ UINT64_C(0x461c42ef0a90c17e), UINT64_C(0x25db32cc545a59f5), UINT64_C(0x7f3d64f1de80263e)}},
+  {{ UINT64_C(0x236e314cbb2e7afd), UINT64_C(0xf044c5721ce9a11e), UINT64_C(0x00246e8461414e50)}},
+  {{ UINT64_C(0xb73c34acae0a710d), UINT64_C(0xb4a875795d739d0d), UINT64_C(0xb48686065e488671)}},
+};
+
+static const mzd_local_t C_0[] = {
+  {{ UINT64_C(0xb53251fceb206d2e), UINT64_C(0x2b51d1dfda5884bf), UINT64_C(0x236652d3ddaebb20), UINT64_C(0x0000000000000000) }}};
+
+static const mzd_local_t C_1[] = {
+  {{ UINT64_C(0xa6d14ed04a6f9215), UINT64_C(0xb6adf5094e0915cb), UINT64_C(0xc8728b78e5359369), UINT64_C(0x0000000000000000) }}};
+
+static const mzd_local_t C_2[] = {
+  {{ UINT64_C(0x2b16a425c3eab45c), UINT64_C(0x7294c2dddaa4a51a), UINT64_C(0x341de7613209f6bd), UINT64_C(0x0000000000000000) }}};
+
+static const mzd_local_t C_3[] = {
+  {{ UINT64_C(0xbad54e23b07d26a0), UINT64_C(0xb69b792eac205fbd), UINT64_C(0x04cc8a0bb2285b17), UINT64_C(0x0000000000000000) }}};
+
+static const lowmc_packed_round_t rounds[4] = {
+  {
+#if defined(LOWMC_INTERLEAVED_LK)
+    LK_0, Li_0, C_0
+#else
+    K_1, L_0, Li_0, C_0
+#endif
+  },
+  {
+#if defined(LOWMC_INTERLEAVED_LK)
+    LK_1, Li_1, C_1
+#else
+    K_2, L_1, Li_1, C_1
+#endif
+  },
+  {
+#if defined(LOWMC_INTERLEAVED_LK)
+    LK_2, Li_2, C_2
+#else
+    K_3, L_2, Li_2, C_2
+#endif
+  },
+  {
+#if defined(LOWMC_INTERLEAVED_LK)
+    LK_3, Li_3, C_3
+#else
+    K_4, L_3, Li_3, C_3
+#endif
+  },
+};
+
+const lowmc_packed_t lowmc_192_192_4 = {
+  K_0,
+  Ki_0,
+  rounds,
+#if !defined(LOWMC_INTERLEAVED_LK)
+  KS,
+#endif
+  KiS,
+};
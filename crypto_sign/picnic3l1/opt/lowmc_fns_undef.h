@@ -10,11 +10,15 @@
 #undef ADDMUL
 #undef COPY
 #undef LOWMC_INSTANCE
+#undef LOWMC_ROUND
 #undef LOWMC_N
 #undef LOWMC_R
 #undef LOWMC_M
 #undef LOWMC_PARTIAL
 #undef MUL
+#undef MUL_LK
+#undef MUL_KS
+#undef MUL_KIS
 #undef MUL_MC
 #undef ADDMUL_R
 #undef MUL_Z
@@ -21,16 +21,21 @@ void N_LOWMC(lowmc_key_t const* lowmc_key, mzd_local_t const* p, mzd_local_t* c)
   COPY(x, p);
   ADDMUL(x, lowmc_key, LOWMC_INSTANCE.k0_matrix);
 
-  lowmc_round_t const* round = LOWMC_INSTANCE.rounds;
+  LOWMC_ROUND const* round = LOWMC_INSTANCE.rounds;
   for (unsigned i = 0; i < LOWMC_R; ++i, ++round) {
 #if defined(RECORD_STATE)
     COPY(state[i].state, x);
 #endif
     SBOX(x);
 
+#if defined(MUL_LK)
+    MUL_LK(y, x, lowmc_key, round->lk_matrix);
+    XOR(x, y, round->constant);
+#else
     MUL(y, x, round->l_matrix);
     XOR(x, y, round->constant);
     ADDMUL(x, lowmc_key, round->k_matrix);
+#endif
   }
 
 #if defined(RECORD_STATE)
@@ -14,13 +14,26 @@ void N_LOWMC(lowmc_key_t* lowmc_key, randomTape_t* tapes) {
   mzd_local_t x[((LOWMC_N) + 255) / 256] = {{{0, 0, 0, 0}}};
   mzd_local_t y[((LOWMC_N) + 255) / 256];
   mzd_local_t key0[((LOWMC_N) + 255) / 256];
+#if defined(MUL_KIS)
+  mzd_local_t round_keys[LOWMC_R + 1];
+#endif
 
   COPY(key0, lowmc_key);
+#if defined(MUL_KIS)
+  // lowmc_key = key0 * K_0^-1 and all round keys lowmc_key * K_i in one multiplication
+  MUL_KIS(round_keys, key0, LOWMC_INSTANCE.kis_matrix);
+  COPY(lowmc_key, round_keys);
+#else
   MUL(lowmc_key, key0, LOWMC_INSTANCE.ki0_matrix);
+#endif
 
-  lowmc_round_t const* round = &LOWMC_INSTANCE.rounds[LOWMC_R - 1];
+  LOWMC_ROUND const* round = &LOWMC_INSTANCE.rounds[LOWMC_R - 1];
   for (unsigned r = 0; r < LOWMC_R; ++r, round--) {
+#if defined(MUL_KIS)
+    XOR(x, x, &round_keys[LOWMC_R - r]);
+#else
     ADDMUL(x, lowmc_key, round->k_matrix);
+#endif
     MUL(y, x, round->li_matrix);
 
     // recover input masks from tapes, only in first round we use the key as input
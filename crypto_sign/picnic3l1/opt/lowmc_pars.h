@@ -51,4 +51,37 @@ typedef struct {
   const lowmc_round_t* rounds;
 } lowmc_t;
 
+/**
+ * LowMC round with full Sbox layer and packed matrices (n <= 192)
+ *
+ * If LOWMC_INTERLEAVED_LK is defined, the linear layer and the round key matrix are stored with
+ * interleaved rows (lk_matrix[i].l is row i of L, lk_matrix[i].k row i of K).
+ */
+typedef struct {
+#if defined(LOWMC_INTERLEAVED_LK)
+  const mzd_row192x2_t* lk_matrix;
+#else
+  const mzd_row192_t* k_matrix;
+  const mzd_row192_t* l_matrix;
+#endif
+  const mzd_row192_t* li_matrix;
+  const mzd_local_t* constant;
+} lowmc_packed_round_t;
+
+/**
+ * LowMC definition with full Sbox layer and packed matrices (n <= 192)
+ *
+ * ks_matrix and kis_matrix stack the round key matrices horizontally (r + 1 packed rows per row),
+ * so that all round keys are computed with one multiplication.
+ */
+typedef struct {
+  const mzd_row192_t* k0_matrix;  // K_0
+  const mzd_row192_t* ki0_matrix; // inverse of K_0
+  const lowmc_packed_round_t* rounds;
+#if !defined(LOWMC_INTERLEAVED_LK)
+  const mzd_row192_t* ks_matrix; // K_0 | K_1 | ... | K_r
+#endif
+  const mzd_row192_t* kis_matrix; // K_0^-1 | K_0^-1 * K_1 | ... | K_0^-1 * K_r
+} lowmc_packed_t;
+
 #endif
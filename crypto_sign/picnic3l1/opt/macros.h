@@ -261,6 +261,25 @@ ATTR_CONST ATTR_ARTIFICIAL static inline uint32_t clz(uint32_t x) {
 }
 #endif
 
+/* helper functions to compute number of trailing zeroes */
+#if GNUC_CHECK(4, 7) || __has_builtin(__builtin_ctzll)
+ATTR_CONST ATTR_ARTIFICIAL static inline uint32_t ctz64(uint64_t x) {
+  return x ? __builtin_ctzll(x) : 64;
+}
+#else
+ATTR_CONST ATTR_ARTIFICIAL static inline uint32_t ctz64(uint64_t x) {
+  if (!x) {
+    return 64;
+  }
+
+  uint32_t n = 0;
+  for (; !(x & 1); x >>= 1) {
+    ++n;
+  }
+  return n;
+}
+#endif
+
 ATTR_CONST ATTR_ARTIFICIAL static inline uint32_t ceil_log2(uint32_t x) {
   if (!x) {
     return 0;
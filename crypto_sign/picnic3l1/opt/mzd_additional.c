@@ -22,6 +22,9 @@
 #endif
 
 static_assert(((sizeof(mzd_local_t) + 0x1f) & ~0x1f) == 32, "sizeof mzd_local_t not supported");
+static_assert(sizeof(mzd_row192_t) == 24, "sizeof mzd_row192_t not supported");
+static_assert(sizeof(mzd_row192x2_t) == 2 * sizeof(mzd_row192_t),
+              "sizeof mzd_row192x2_t not supported");
 
 /* implementation of copy */
 
@@ -306,6 +309,179 @@ void mzd_mul_v_uint64_192(mzd_local_t* c, mzd_local_t const* v, mzd_local_t cons
   mzd_addmul_v_uint64_192(c, v, A);
 }
 
+/* implementation of mzd_mul_v for packed rows */
+
+/* c ^= the rows of A selected by the lowest bits of idx; A advances by stride words per row */
+static inline const word* mzd_addmul_word_uint64_packed(word* c, word idx, unsigned int rows,
+                                                        const word* A, const unsigned int stride) {
+  for (; rows; --rows, idx >>= 1, A += stride) {
+    const word mask = -(idx & 1);
+    c[0] ^= A[0] & mask;
+    c[1] ^= A[1] & mask;
+    c[2] ^= A[2] & mask;
+  }
+  return A;
+}
+
+/* c ^= the rows of A.l selected by vidx and the rows of A.k selected by widx */
+static inline const word* mzd_addmul2_word_uint64_packed(word* c, word vidx, word widx,
+                                                         unsigned int rows, const word* A) {
+  for (; rows; --rows, vidx >>= 1, widx >>= 1, A += 6) {
+    const word vmask = -(vidx & 1);
+    const word wmask = -(widx & 1);
+    c[0] ^= (A[0] & vmask) ^ (A[3] & wmask);
+    c[1] ^= (A[1] & vmask) ^ (A[4] & wmask);
+    c[2] ^= (A[2] & vmask) ^ (A[5] & wmask);
+  }
+  return A;
+}
+
+/* c ^= the rows of five stacked packed matrices selected by the lowest bits of idx */
+static inline const word* mzd_addmul_word_uint64_packed_5(word* c, word idx, unsigned int rows,
+                                                          const word* A) {
+  for (; rows; --rows, idx >>= 1, A += 15) {
+    const word mask = -(idx & 1);
+    for (unsigned int i = 0; i < 15; ++i) {
+      c[i] ^= A[i] & mask;
+    }
+  }
+  return A;
+}
+
+static void mzd_store_uint64_packed_5(mzd_local_t* c, const word* cw) {
+  for (unsigned int j = 0; j < 5; ++j) {
+    block_t* cblock = BLOCK(c, j);
+    memcpy(cblock->w64, &cw[3 * j], 3 * sizeof(word));
+    cblock->w64[3] = 0;
+  }
+}
+
+/* 129 columns: only the top bit of the first word is part of the vector */
+static inline void mzd_addmul_v_uint64_129_rows(word* c, const word* v, const word* A,
+                                                const unsigned int stride) {
+  A = mzd_addmul_word_uint64_packed(c, v[0] >> 63, 1, A, stride);
+  A = mzd_addmul_word_uint64_packed(c, v[1], 64, A, stride);
+  mzd_addmul_word_uint64_packed(c, v[2], 64, A, stride);
+}
+
+static inline void mzd_addmul_v_uint64_192_rows(word* c, const word* v, const word* A,
+                                                const unsigned int stride) {
+  for (unsigned int w = 0; w < 3; ++w) {
+    A = mzd_addmul_word_uint64_packed(c, v[w], 64, A, stride);
+  }
+}
+
+void mzd_addmul_v_uint64_129_packed(mzd_local_t* c, mzd_local_t const* v, mzd_row192_t const* A) {
+  block_t* cblock = BLOCK(c, 0);
+  word cw[3]      = {cblock->w64[0], cblock->w64[1], cblock->w64[2]};
+
+  mzd_addmul_v_uint64_129_rows(cw, CONST_BLOCK(v, 0)->w64, A->w64, 3);
+  memcpy(cblock->w64, cw, sizeof(cw));
+}
+
+void mzd_mul_v_uint64_129_packed(mzd_local_t* c, mzd_local_t const* v, mzd_row192_t const* A) {
+  block_t* cblock = BLOCK(c, 0);
+  word cw[3]      = {0, 0, 0};
+
+  mzd_addmul_v_uint64_129_rows(cw, CONST_BLOCK(v, 0)->w64, A->w64, 3);
+  memcpy(cblock->w64, cw, sizeof(cw));
+}
+
+void mzd_addmul_v_uint64_192_packed(mzd_local_t* c, mzd_local_t const* v, mzd_row192_t const* A) {
+  block_t* cblock = BLOCK(c, 0);
+  word cw[3]      = {cblock->w64[0], cblock->w64[1], cblock->w64[2]};
+
+  mzd_addmul_v_uint64_192_rows(cw, CONST_BLOCK(v, 0)->w64, A->w64, 3);
+  memcpy(cblock->w64, cw, sizeof(cw));
+}
+
+void mzd_mul_v_uint64_192_packed(mzd_local_t* c, mzd_local_t const* v, mzd_row192_t const* A) {
+  block_t* cblock = BLOCK(c, 0);
+  word cw[3]      = {0, 0, 0};
+
+  mzd_addmul_v_uint64_192_rows(cw, CONST_BLOCK(v, 0)->w64, A->w64, 3);
+  memcpy(cblock->w64, cw, sizeof(cw));
+}
+
+void mzd_mul_v2_uint64_129_packed(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* w,
+                                  mzd_row192x2_t const* A) {
+  const word* vptr = CONST_BLOCK(v, 0)->w64;
+  const word* wptr = CONST_BLOCK(w, 0)->w64;
+  const word* Aptr = A->l.w64;
+  word cw[3]       = {0, 0, 0};
+
+  Aptr = mzd_addmul2_word_uint64_packed(cw, vptr[0] >> 63, wptr[0] >> 63, 1, Aptr);
+  Aptr = mzd_addmul2_word_uint64_packed(cw, vptr[1], wptr[1], 64, Aptr);
+  mzd_addmul2_word_uint64_packed(cw, vptr[2], wptr[2], 64, Aptr);
+  memcpy(BLOCK(c, 0)->w64, cw, sizeof(cw));
+}
+
+void mzd_mul_v2_uint64_192_packed(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* w,
+                                  mzd_row192x2_t const* A) {
+  const word* vptr = CONST_BLOCK(v, 0)->w64;
+  const word* wptr = CONST_BLOCK(w, 0)->w64;
+  const word* Aptr = A->l.w64;
+  word cw[3]       = {0, 0, 0};
+
+  for (unsigned int i = 0; i < 3; ++i) {
+    Aptr = mzd_addmul2_word_uint64_packed(cw, vptr[i], wptr[i], 64, Aptr);
+  }
+  memcpy(BLOCK(c, 0)->w64, cw, sizeof(cw));
+}
+
+void mzd_mul_v_uint64_129_645_packed(mzd_local_t* c, mzd_local_t const* v,
+                                     mzd_row192_t const* A) {
+  const word* vptr = CONST_BLOCK(v, 0)->w64;
+  const word* Aptr = A->w64;
+  word cw[15]      = {0};
+
+  Aptr = mzd_addmul_word_uint64_packed_5(cw, vptr[0] >> 63, 1, Aptr);
+  Aptr = mzd_addmul_word_uint64_packed_5(cw, vptr[1], 64, Aptr);
+  mzd_addmul_word_uint64_packed_5(cw, vptr[2], 64, Aptr);
+  mzd_store_uint64_packed_5(c, cw);
+}
+
+void mzd_mul_v_uint64_192_960_packed(mzd_local_t* c, mzd_local_t const* v,
+                                     mzd_row192_t const* A) {
+  const word* vptr = CONST_BLOCK(v, 0)->w64;
+  const word* Aptr = A->w64;
+  word cw[15]      = {0};
+
+  for (unsigned int i = 0; i < 3; ++i) {
+    Aptr = mzd_addmul_word_uint64_packed_5(cw, vptr[i], 64, Aptr);
+  }
+  mzd_store_uint64_packed_5(c, cw);
+}
+
+void mzd_addmul_v_uint64_255(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* A) {
+  block_t* cblock       = BLOCK(c, 0);
+  const word* vptr      = CONST_BLOCK(v, 0)->w64;
+  const block_t* Ablock = CONST_BLOCK(A, 0);
+
+  {
+    // bit 0 is not part of the vector
+    word idx = (*vptr) >> 1;
+    for (unsigned int i = sizeof(word) * 8 - 1; i; --i, idx >>= 1, ++Ablock) {
+      const uint64_t mask = -(idx & 1);
+      mzd_xor_mask_uint64_block(cblock, Ablock, mask, 4);
+    }
+    vptr++;
+  }
+
+  for (unsigned int w = 3; w; --w, ++vptr) {
+    word idx = *vptr;
+    for (unsigned int i = sizeof(word) * 8; i; --i, idx >>= 1, ++Ablock) {
+      const uint64_t mask = -(idx & 1);
+      mzd_xor_mask_uint64_block(cblock, Ablock, mask, 4);
+    }
+  }
+}
+
+void mzd_mul_v_uint64_255(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* A) {
+  clear_uint64_block(BLOCK(c, 0), 4);
+  mzd_addmul_v_uint64_255(c, v, A);
+}
+
 void mzd_addmul_v_uint64_256(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* A) {
   block_t* cblock       = BLOCK(c, 0);
   const word* vptr      = CONST_BLOCK(v, 0)->w64;
@@ -35,6 +35,25 @@ typedef union {
  */
 typedef block_t mzd_local_t;
 
+/**
+ * Packed matrix rows for matrices with 129 to 192 columns
+ *
+ * A row holds the same three words as a row of mzd_local_t, but without the unused fourth word and
+ * without the 32 byte alignment, so a matrix takes 24 instead of 32 bytes per row.
+ */
+typedef struct {
+  word w64[3];
+} mzd_row192_t;
+
+/**
+ * Two packed matrices with interleaved rows: row i of the second matrix directly follows row i of
+ * the first one, so that both matrices are read in a single linear pass.
+ */
+typedef struct {
+  mzd_row192_t l;
+  mzd_row192_t k;
+} mzd_row192x2_t;
+
 void mzd_copy_uint64_128(mzd_local_t* dst, mzd_local_t const* src) ATTR_NONNULL;
 void mzd_copy_uint64_192(mzd_local_t* dst, mzd_local_t const* src) ATTR_NONNULL;
 void mzd_copy_uint64_256(mzd_local_t* dst, mzd_local_t const* src) ATTR_NONNULL;
@@ -122,6 +141,7 @@ void mzd_rotate_right_uint64_256(mzd_local_t* res, const mzd_local_t* val, unsig
 void mzd_mul_v_uint64_128(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* At) ATTR_NONNULL;
 void mzd_mul_v_uint64_129(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* At) ATTR_NONNULL;
 void mzd_mul_v_uint64_192(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* At) ATTR_NONNULL;
+void mzd_mul_v_uint64_255(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* At) ATTR_NONNULL;
 void mzd_mul_v_uint64_256(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* At) ATTR_NONNULL;
 void mzd_mul_v_uint64_128_640(mzd_local_t* c, mzd_local_t const* v,
                               mzd_local_t const* At) ATTR_NONNULL;
@@ -200,6 +220,8 @@ void mzd_addmul_v_uint64_129(mzd_local_t* c, mzd_local_t const* v,
                              mzd_local_t const* A) ATTR_NONNULL;
 void mzd_addmul_v_uint64_192(mzd_local_t* c, mzd_local_t const* v,
                              mzd_local_t const* A) ATTR_NONNULL;
+void mzd_addmul_v_uint64_255(mzd_local_t* c, mzd_local_t const* v,
+                             mzd_local_t const* A) ATTR_NONNULL;
 void mzd_addmul_v_uint64_256(mzd_local_t* c, mzd_local_t const* v,
                              mzd_local_t const* A) ATTR_NONNULL;
 void mzd_addmul_v_s128_128(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* A) ATTR_NONNULL;
@@ -211,6 +233,35 @@ void mzd_addmul_v_s256_129(mzd_local_t* c, mzd_local_t const* v, mzd_local_t con
 void mzd_addmul_v_s256_192(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* A) ATTR_NONNULL;
 void mzd_addmul_v_s256_256(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* A) ATTR_NONNULL;
 
+/**
+ * Compute (c +) v * A for matrices with packed rows.
+ */
+void mzd_addmul_v_uint64_129_packed(mzd_local_t* c, mzd_local_t const* v,
+                                    mzd_row192_t const* A) ATTR_NONNULL;
+void mzd_mul_v_uint64_129_packed(mzd_local_t* c, mzd_local_t const* v,
+                                 mzd_row192_t const* A) ATTR_NONNULL;
+void mzd_addmul_v_uint64_192_packed(mzd_local_t* c, mzd_local_t const* v,
+                                    mzd_row192_t const* A) ATTR_NONNULL;
+void mzd_mul_v_uint64_192_packed(mzd_local_t* c, mzd_local_t const* v,
+                                 mzd_row192_t const* A) ATTR_NONNULL;
+
+/**
+ * Compute c = v * A.l + w * A.k in one pass over interleaved matrices.
+ */
+void mzd_mul_v2_uint64_129_packed(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* w,
+                                  mzd_row192x2_t const* A) ATTR_NONNULL;
+void mzd_mul_v2_uint64_192_packed(mzd_local_t* c, mzd_local_t const* v, mzd_local_t const* w,
+                                  mzd_row192x2_t const* A) ATTR_NONNULL;
+
+/**
+ * Compute v * A for five horizontally stacked matrices with packed rows; c consists of five
+ * vectors.
+ */
+void mzd_mul_v_uint64_129_645_packed(mzd_local_t* c, mzd_local_t const* v,
+                                     mzd_row192_t const* A) ATTR_NONNULL;
+void mzd_mul_v_uint64_192_960_packed(mzd_local_t* c, mzd_local_t const* v,
+                                     mzd_row192_t const* A) ATTR_NONNULL;
+
 /**
  * Shuffle vector x according to info in mask. Needed for OLLE optimiztaions.
  */
@@ -18,6 +18,7 @@
 #include "picnic3_impl.h"
 #include "picnic_instances.h"
 #include "randomness.h"
+#include "verify_cache.h"
 
 // Public and private keys are serialized as follows:
 // - public key: instance || C || p
@@ -184,6 +185,150 @@ int PICNIC_CALLING_CONVENTION picnic_validate_keypair(const picnic_privatekey_t*
   return memcmp(buffer, pk_c, output_size);
 }
 
+static void clear_extra_bits(uint8_t* dst, size_t num_bits) {
+  const size_t num_extra_bits = num_bits % 8;
+  if (num_extra_bits) {
+    dst[(num_bits + 7) / 8 - 1] &= UINT8_C(0xff) << (8 - num_extra_bits);
+  }
+}
+
+int PICNIC_CALLING_CONVENTION picnic_keygen_batch(picnic_params_t param, picnic_publickey_t* pks,
+                                                  picnic_privatekey_t* sks, size_t count) {
+  if ((!pks || !sks) && count) {
+    return -1;
+  }
+
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return -1;
+  }
+
+  if (!instance->impls.lowmc_batch) {
+    for (size_t i = 0; i < count; ++i) {
+      if (picnic_keygen(param, &pks[i], &sks[i])) {
+        return -1;
+      }
+    }
+    return 0;
+  }
+
+  const size_t input_size  = instance->input_size;
+  const size_t output_size = instance->output_size;
+
+  mzd_local_t plaintexts[LOWMC_BITSLICED_BLOCKS];
+  mzd_local_t privkeys[LOWMC_BITSLICED_BLOCKS];
+  mzd_local_t ciphertexts[LOWMC_BITSLICED_BLOCKS];
+  uint8_t randomness[LOWMC_BITSLICED_BLOCKS * (MAX_LOWMC_BLOCK_SIZE * 2)];
+
+  int ret = 0;
+  while (count) {
+    const size_t chunk = MIN(count, (size_t)LOWMC_BITSLICED_BLOCKS);
+
+    // one call to the RNG for all secret keys and plaintexts of this chunk
+    if (rand_bytes(randomness, chunk * (input_size + output_size))) {
+      ret = -1;
+      break;
+    }
+
+    const uint8_t* r = randomness;
+    for (size_t i = 0; i < chunk; ++i, r += input_size + output_size) {
+      picnic_privatekey_t* sk = &sks[i];
+      uint8_t* sk_sk          = SK_SK(sk);
+      uint8_t* sk_pt          = SK_PT(sk);
+
+      sk->data[0] = param;
+      memcpy(sk_sk, r, input_size);
+      clear_extra_bits(sk_sk, instance->lowmc.k);
+      memcpy(sk_pt, r + input_size, output_size);
+      clear_extra_bits(sk_pt, instance->lowmc.n);
+
+      mzd_from_char_array(&privkeys[i], sk_sk, input_size);
+      mzd_from_char_array(&plaintexts[i], sk_pt, output_size);
+    }
+
+    // encrypt all plaintexts under their secret keys at once
+    instance->impls.lowmc_batch(privkeys, plaintexts, ciphertexts, chunk);
+
+    for (size_t i = 0; i < chunk; ++i) {
+      picnic_privatekey_t* sk = &sks[i];
+      picnic_publickey_t* pk  = &pks[i];
+
+      pk->data[0] = param;
+      memcpy(PK_PT(pk), SK_PT(sk), output_size);
+      mzd_to_char_array(PK_C(pk), &ciphertexts[i], output_size);
+      memcpy(SK_C(sk), PK_C(pk), output_size);
+    }
+
+    pks += chunk;
+    sks += chunk;
+    count -= chunk;
+  }
+
+  memset(randomness, 0, sizeof(randomness));
+  memset(privkeys, 0, sizeof(privkeys));
+  return ret;
+}
+
+int PICNIC_CALLING_CONVENTION picnic_validate_keypair_batch(const picnic_privatekey_t* sks,
+                                                            const picnic_publickey_t* pks,
+                                                            size_t count, int* results) {
+  if ((!sks || !pks || !results) && count) {
+    return -1;
+  }
+
+  mzd_local_t plaintexts[LOWMC_BITSLICED_BLOCKS];
+  mzd_local_t privkeys[LOWMC_BITSLICED_BLOCKS];
+  mzd_local_t ciphertexts[LOWMC_BITSLICED_BLOCKS];
+
+  int ret = 0;
+  for (size_t offset = 0; offset < count;) {
+    // collect a run of key pairs for the same parameter set
+    const picnic_params_t param       = sks[offset].data[0];
+    const picnic_instance_t* instance = picnic_instance_get(param);
+    if (!instance || !instance->impls.lowmc_batch) {
+      results[offset] = picnic_validate_keypair(&sks[offset], &pks[offset]) ? -1 : 0;
+      ret |= results[offset];
+      ++offset;
+      continue;
+    }
+
+    const size_t input_size  = instance->input_size;
+    const size_t output_size = instance->output_size;
+
+    size_t chunk = 0;
+    for (; chunk < LOWMC_BITSLICED_BLOCKS && offset + chunk < count &&
+           sks[offset + chunk].data[0] == param;
+         ++chunk) {
+      const picnic_privatekey_t* sk = &sks[offset + chunk];
+      mzd_from_char_array(&privkeys[chunk], SK_SK(sk), input_size);
+      mzd_from_char_array(&plaintexts[chunk], SK_PT(sk), output_size);
+    }
+
+    // compute all public keys at once
+    instance->impls.lowmc_batch(privkeys, plaintexts, ciphertexts, chunk);
+
+    for (size_t i = 0; i < chunk; ++i, ++offset) {
+      const picnic_privatekey_t* sk = &sks[offset];
+      const picnic_publickey_t* pk  = &pks[offset];
+
+      uint8_t buffer[MAX_LOWMC_BLOCK_SIZE];
+      mzd_to_char_array(buffer, &ciphertexts[i], output_size);
+
+      // check param, plaintext and ciphertext
+      results[offset] = (param != pk->data[0] ||
+                         memcmp(SK_PT(sk), PK_PT(pk), output_size) != 0 ||
+                         memcmp(SK_C(sk), PK_C(pk), output_size) != 0 ||
+                         memcmp(buffer, PK_C(pk), output_size) != 0)
+                            ? -1
+                            : 0;
+      ret |= results[offset];
+    }
+  }
+
+  memset(privkeys, 0, sizeof(privkeys));
+  return ret;
+}
+
 int PICNIC_CALLING_CONVENTION picnic_sign(const picnic_privatekey_t* sk, const uint8_t* message,
                                           size_t message_len, uint8_t* signature,
                                           size_t* signature_len) {
@@ -207,6 +352,51 @@ int PICNIC_CALLING_CONVENTION picnic_sign(const picnic_privatekey_t* sk, const u
   return impl_sign_picnic3(sk_pt, sk_sk, sk_c, message, message_len, signature, signature_len);
 }
 
+int PICNIC_CALLING_CONVENTION picnic_sign_batch(const picnic_privatekey_t* sk,
+                                                const uint8_t* const* messages,
+                                                const size_t* message_lens,
+                                                uint8_t* const* signatures,
+                                                size_t* signature_lens, int* statuses,
+                                                size_t count) {
+  if (statuses) {
+    for (size_t i = 0; i < count; ++i) {
+      statuses[i] = -1;
+    }
+  }
+  if (!sk || ((!messages || !message_lens || !signatures || !signature_lens) && count)) {
+    return -1;
+  }
+
+  const picnic_params_t param       = sk->data[0];
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance) {
+    return -1;
+  }
+
+  const size_t output_size = instance->output_size;
+  const size_t input_size  = instance->input_size;
+
+  const uint8_t* sk_sk = SK_SK(sk);
+  const uint8_t* sk_c  = SK_C(sk);
+  const uint8_t* sk_pt = SK_PT(sk);
+
+  // one signature after the other; a failing message does not stop the others
+  int ret = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const int status = (!signatures[i] || impl_sign_picnic3(sk_pt, sk_sk, sk_c, messages[i],
+                                                            message_lens[i], signatures[i],
+                                                            &signature_lens[i]))
+                           ? -1
+                           : 0;
+    if (statuses) {
+      statuses[i] = status;
+    }
+    ret |= status;
+  }
+
+  return ret;
+}
+
 int PICNIC_CALLING_CONVENTION picnic_verify(const picnic_publickey_t* pk, const uint8_t* message,
                                             size_t message_len, const uint8_t* signature,
                                             size_t signature_len) {
@@ -225,7 +415,34 @@ int PICNIC_CALLING_CONVENTION picnic_verify(const picnic_publickey_t* pk, const
   const uint8_t* pk_c  = PK_C(pk);
   const uint8_t* pk_pt = PK_PT(pk);
 
-  return impl_verify_picnic3(pk_pt, pk_c, message, message_len, signature, signature_len);
+  uint8_t cache_key[VERIFY_CACHE_KEY_SIZE];
+  const int use_cache = verify_cache_enabled();
+  if (use_cache) {
+    verify_cache_key(cache_key, pk->data, picnic_get_public_key_size(param), message, message_len,
+                     signature, signature_len);
+    if (verify_cache_lookup(cache_key)) {
+      return 0;
+    }
+  }
+
+  const int ret =
+      impl_verify_picnic3(pk_pt, pk_c, message, message_len, signature, signature_len);
+  if (use_cache && !ret) {
+    verify_cache_insert(cache_key);
+  }
+  return ret;
+}
+
+int PICNIC_CALLING_CONVENTION picnic_verify_cache_init(size_t capacity) {
+  return verify_cache_init(capacity);
+}
+
+int PICNIC_CALLING_CONVENTION picnic_verify_cache_stats(picnic_verify_cache_stats_t* stats) {
+  if (!stats) {
+    return -1;
+  }
+
+  return verify_cache_stats(&stats->hits, &stats->misses, &stats->entries, &stats->capacity);
 }
 
 const char* PICNIC_CALLING_CONVENTION picnic_get_param_name(picnic_params_t parameters) {
@@ -158,6 +158,37 @@ PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign(const picnic_privatekey_
                                                         const uint8_t* message, size_t message_len,
                                                         uint8_t* signature, size_t* signature_len);
 
+/**
+ * Batch signature function.
+ * Signs count messages with the same private key. The key is parsed once for
+ * the whole batch. Each signature is the same as the one returned by
+ * picnic_sign() for the message. The messages are signed one after the other:
+ * the four-lane Keccak hashes the parties and tree nodes of one signature,
+ * not several signatures at once. A message that cannot be signed does not
+ * stop the others; its status is set to -1.
+ *
+ * @param[in] sk      The signer's private key.
+ * @param[in] messages Array of count messages to be signed.
+ * @param[in] message_lens Array of the count message lengths, in bytes.
+ * @param[out] signatures Array of count buffers to hold the signatures, see picnic_sign().
+ * @param[in,out] signature_lens Array of the count signature buffer lengths. On
+ * success, each is set to the number of bytes written to the corresponding buffer.
+ * @param[out] statuses Array of count statuses, or NULL. Each is set to 0 if
+ * the corresponding message was signed, or to -1 otherwise.
+ * @param[in] count The number of messages.
+ *
+ * @return Returns 0 if all messages were signed, or a nonzero value if at least
+ * one message could not be signed.
+ *
+ * @see picnic_sign()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign_batch(const picnic_privatekey_t* sk,
+                                                              const uint8_t* const* messages,
+                                                              const size_t* message_lens,
+                                                              uint8_t* const* signatures,
+                                                              size_t* signature_lens,
+                                                              int* statuses, size_t count);
+
 /**
  * Get the number of bytes required to hold a signature.
  *
@@ -261,6 +292,43 @@ PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_read_private_key(picnic_priva
 PICNIC_EXPORT int PICNIC_CALLING_CONVENTION
 picnic_validate_keypair(const picnic_privatekey_t* privatekey, const picnic_publickey_t* publickey);
 
+/**
+ * Batch key generation function.
+ * Generates count public and private key pairs for the specified parameter set. The
+ * public keys are computed with a bitsliced LowMC implementation that encrypts many
+ * blocks at once, which is considerably faster than calling picnic_keygen() count times.
+ *
+ * @param[in]  parameters The parameter set to use when generating the keys.
+ * @param[out] pks        Array of count public keys to be populated.
+ * @param[out] sks        Array of count private keys to be populated.
+ * @param[in]  count      The number of key pairs to generate.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error.
+ *
+ * @see picnic_keygen()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_keygen_batch(picnic_params_t parameters,
+                                                                picnic_publickey_t* pks,
+                                                                picnic_privatekey_t* sks,
+                                                                size_t count);
+
+/**
+ * Check that many key pairs are valid.
+ *
+ * @param[in]  privatekeys Array of count private keys to check
+ * @param[in]  publickeys  Array of count public keys to check
+ * @param[in]  count       The number of key pairs
+ * @param[out] results     Array of count entries, set to 0 if the corresponding key pair
+ *                         is valid and to a nonzero value otherwise
+ *
+ * @return Returns 0 if all key pairs are valid, or a nonzero value otherwise
+ *
+ * @see picnic_validate_keypair()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_validate_keypair_batch(
+    const picnic_privatekey_t* privatekeys, const picnic_publickey_t* publickeys, size_t count,
+    int* results);
+
 /**
  * Clear data of a private key.
  *
@@ -278,6 +346,43 @@ PICNIC_EXPORT void PICNIC_CALLING_CONVENTION picnic_clear_private_key(picnic_pri
 PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sk_to_pk(const picnic_privatekey_t* privatekey,
                                                             picnic_publickey_t* publickey);
 
+/** Counters of the verification cache */
+typedef struct {
+  uint64_t hits;   /* calls of picnic_verify answered from the cache */
+  uint64_t misses; /* calls of picnic_verify that ran the verification */
+  size_t entries;  /* currently cached signatures */
+  size_t capacity; /* maximum number of cached signatures */
+} picnic_verify_cache_stats_t;
+
+/**
+ * Enable the cache of verified signatures.
+ *
+ * If enabled, picnic_verify() first looks up a hash of the public key, the message and the
+ * signature, and returns success without verifying if the same tuple was verified successfully
+ * before. Only successful verifications are added. The cache is bounded and shared by all
+ * threads. It is only available if the library is compiled with PICNIC_VERIFY_CACHE.
+ *
+ * @param[in] capacity The number of cached signatures, rounded up to a multiple of 4. Calling
+ *                     this function again clears the cache and its counters; a capacity of 0
+ *                     disables the cache.
+ *
+ * @return Returns 0 on success, or a nonzero value if the cache could not be allocated or is
+ *         not available.
+ *
+ * @see picnic_verify_cache_stats()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_verify_cache_init(size_t capacity);
+
+/**
+ * Get the counters of the verification cache.
+ *
+ * @param[out] stats The counters since the last call of picnic_verify_cache_init()
+ *
+ * @return Returns 0 on success, or a nonzero value if the cache is not available.
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION
+picnic_verify_cache_stats(picnic_verify_cache_stats_t* stats);
+
 #ifdef __cplusplus
 }
 #endif
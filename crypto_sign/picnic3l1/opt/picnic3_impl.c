@@ -19,6 +19,7 @@
 
 #include "io.h"
 #include "kdf_shake.h"
+#include "kdf_shake_x4.h"
 #include "lowmc.h"
 #include "macros.h"
 #include "picnic.h"
@@ -35,11 +36,34 @@ static uint32_t numBytes(uint32_t numBits) {
 }
 
 static void createRandomTapes(randomTape_t* tapes, uint8_t** seeds, uint8_t* salt, size_t t) {
-  hash_context ctx;
-
   tapes->pos     = 0;
   tapes->aux_pos = 0;
 
+#if defined(KECCAK_X4_AVX2)
+  if (hash_x4_available()) {
+    hash_context_x4 ctx;
+    const uint16_t round_x4[4] = {t, t, t, t};
+
+    /* the tapes of four parties at once */
+    for (size_t i = 0; i < PICNIC_NUM_PARTIES; i += 4) {
+      const uint16_t party_x4[4] = {i, i + 1, i + 2, i + 3};
+      uint8_t* const tapes_x4[4] = {tapes->tape[i], tapes->tape[i + 1], tapes->tape[i + 2],
+                                    tapes->tape[i + 3]};
+
+      hash_init_x4(&ctx, PICNIC_DIGEST_SIZE);
+      hash_update_x4(&ctx, (const uint8_t* const*)&seeds[i], PICNIC_SEED_SIZE);
+      hash_update_x4_1(&ctx, salt, PICNIC_SALT_SIZE);
+      hash_update_x4_uint16_le(&ctx, round_x4);
+      hash_update_x4_uint16_le(&ctx, party_x4);
+      hash_final_x4(&ctx);
+
+      hash_squeeze_x4(&ctx, tapes_x4, PICNIC_TAPE_SIZE);
+    }
+    return;
+  }
+#endif
+
+  hash_context ctx;
   for (size_t i = 0; i < PICNIC_NUM_PARTIES; i++) {
     hash_init(&ctx, PICNIC_DIGEST_SIZE);
 
@@ -73,7 +97,7 @@ static void computeAuxTape(randomTape_t* tapes, uint8_t* input_masks) {
   tapes->aux_pos = 0;
   memset(tapes->aux_bits, 0, PICNIC_VIEW_SIZE);
 
-  lowmc_compute_aux_implementation_f lowmc_aux_impl = lowmc_compute_aux_uint64_lowmc_129_129_4;
+  lowmc_compute_aux_implementation_f lowmc_aux_impl = LOWMC_AUX_IMPL;
   // Perform LowMC evaluation and fix AND masks for all AND gates
   lowmc_aux_impl(lowmc_key, tapes);
 
@@ -115,6 +139,42 @@ static void commit_h(uint8_t* digest, const party_commitments_t* C) {
   hash_squeeze(&ctx, digest, PICNIC_DIGEST_SIZE);
 }
 
+/* Compute C[t][j] of all parties except the last one, whose commitment also covers the aux bits.
+ * With a four-lane Keccak, the commitments are computed for four parties at once. */
+static void commit_parties(party_commitments_t* C, uint8_t** seeds, const uint8_t* salt,
+                           size_t t) {
+  const size_t last = PICNIC_NUM_PARTIES - 1;
+
+#if defined(KECCAK_X4_AVX2)
+  if (hash_x4_available()) {
+    const uint16_t round_x4[4] = {t, t, t, t};
+    uint8_t unused[PICNIC_DIGEST_SIZE];
+    hash_context_x4 ctx;
+
+    for (size_t j = 0; j < last; j += 4) {
+      /* the fourth lane of the last group commits to the last party without aux bits and is
+       * discarded */
+      const uint16_t party_x4[4] = {j, j + 1, j + 2, j + 3};
+      uint8_t* const digests_x4[4] = {C->hashes[j], C->hashes[j + 1], C->hashes[j + 2],
+                                      j + 3 < last ? C->hashes[j + 3] : unused};
+
+      hash_init_x4(&ctx, PICNIC_DIGEST_SIZE);
+      hash_update_x4(&ctx, (const uint8_t* const*)&seeds[j], PICNIC_SEED_SIZE);
+      hash_update_x4_1(&ctx, salt, PICNIC_SALT_SIZE);
+      hash_update_x4_uint16_le(&ctx, round_x4);
+      hash_update_x4_uint16_le(&ctx, party_x4);
+      hash_final_x4(&ctx);
+      hash_squeeze_x4(&ctx, digests_x4, PICNIC_DIGEST_SIZE);
+    }
+    return;
+  }
+#endif
+
+  for (size_t j = 0; j < last; j++) {
+    commit(C->hashes[j], seeds[j], NULL, salt, t, j);
+  }
+}
+
 // Commit to the views for one parallel rep
 static void commit_v(uint8_t* digest, const uint8_t* input, const msgs_t* msgs) {
   hash_context ctx;
@@ -303,7 +363,7 @@ static int verify_picnic3(signature2_t* sig, const uint8_t* pubKey, const uint8_
   int ret           = reconstructRoundSeeds(&iSeedsTree, sig->challengeC, PICNIC_NUM_OPENED_ROUNDS,
                                   sig->iSeedInfo, sig->iSeedInfoLen, sig->salt, 0);
   const size_t last = PICNIC_NUM_PARTIES - 1;
-  lowmc_simulate_online_f simulateOnline = lowmc_simulate_online_uint64_129_43;
+  lowmc_simulate_online_f simulateOnline = LOWMC_SIMULATE_ONLINE_IMPL;
 
   party_commitments_t C;
   round_commitments_t Ch;
@@ -355,60 +415,49 @@ static int verify_picnic3(signature2_t* sig, const uint8_t* pubKey, const uint8_
 
     if (!contains(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
       /* We're given iSeed, have expanded the seeds, compute aux from scratch so we can comnpte
-       * Com[t] */
+       * Com[t]. There is no view to commit to. */
       computeAuxTape(&tape, NULL);
-      for (size_t j = 0; j < last; j++) {
-        commit(C.hashes[j], getLeaf(&seed, j), NULL, sig->salt, t, j);
-      }
+      commit_parties(&C, getLeaves(&seed), sig->salt, t);
       commit(C.hashes[last], getLeaf(&seed, last), tape.aux_bits, sig->salt, t, last);
-      /* after we have checked the tape, we do not need it anymore for this opened iteration */
-    } else {
-      /* We're given all seeds and aux bits, execpt for the unopened
-       * party, we get their commitment */
-      size_t unopened = sig->challengeP[indexOf(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)];
-      for (size_t j = 0; j < last; j++) {
-        commit(C.hashes[j], getLeaf(&seed, j), NULL, sig->salt, t, j);
-      }
-      if (last != unopened) {
-        commit(C.hashes[last], getLeaf(&seed, last), sig->proofs[proof_index].aux, sig->salt, t,
-               last);
-      }
+      commit_h(Ch.hashes[t], &C);
+      Cv_hashes[t] = NULL;
+      continue;
+    }
 
-      memcpy(C.hashes[unopened], sig->proofs[proof_index].C, PICNIC_DIGEST_SIZE);
+    /* We're given all seeds and aux bits, execpt for the unopened
+     * party, we get their commitment */
+    size_t unopened = sig->challengeP[indexOf(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)];
+    commit_parties(&C, getLeaves(&seed), sig->salt, t);
+    if (last != unopened) {
+      commit(C.hashes[last], getLeaf(&seed, last), sig->proofs[proof_index].aux, sig->salt, t,
+             last);
     }
-    /* hash commitments every four iterations if possible, for the last few do single commitments
-     */
+
+    memcpy(C.hashes[unopened], sig->proofs[proof_index].C, PICNIC_DIGEST_SIZE);
     commit_h(Ch.hashes[t], &C);
 
-    /* Commit to the views */
-    if (!contains(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
-      Cv_hashes[t] = NULL;
-    }
-    if (contains(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)) {
-      /* 2. When t is in C, we have everything we need to re-compute the view, as an honest signer
-       * would.
-       * We simulate the MPC with one fewer party; the unopned party's values are all set to zero.
-       */
-      size_t unopened = sig->challengeP[indexOf(sig->challengeC, PICNIC_NUM_OPENED_ROUNDS, t)];
-      uint8_t* input  = sig->proofs[proof_index].input;
-      setAuxBits(&tape, sig->proofs[proof_index].aux);
-      memset(tape.tape[unopened], 0, 2 * PICNIC_VIEW_SIZE);
-      memcpy(msgs.msgs[unopened], sig->proofs[proof_index].msgs, PICNIC_VIEW_SIZE);
-      mzd_from_char_array(m_maskedKey, input, PICNIC_INPUT_SIZE);
-      msgs.unopened = unopened;
-      msgs.pos      = 0;
-      ret           = simulateOnline(m_maskedKey, &tape, &msgs, m_plaintext, pubKey);
+    /* 2. When t is in C, we have everything we need to re-compute the view, as an honest signer
+     * would.
+     * We simulate the MPC with one fewer party; the unopned party's values are all set to zero.
+     */
+    uint8_t* input = sig->proofs[proof_index].input;
+    setAuxBits(&tape, sig->proofs[proof_index].aux);
+    memset(tape.tape[unopened], 0, 2 * PICNIC_VIEW_SIZE);
+    memcpy(msgs.msgs[unopened], sig->proofs[proof_index].msgs, PICNIC_VIEW_SIZE);
+    mzd_from_char_array(m_maskedKey, input, PICNIC_INPUT_SIZE);
+    msgs.unopened = unopened;
+    msgs.pos      = 0;
+    ret           = simulateOnline(m_maskedKey, &tape, &msgs, m_plaintext, pubKey);
 
-      if (ret != 0) {
+    if (ret != 0) {
 #if !defined(NDEBUG)
-        printf("MPC simulation failed for round " SIZET_FMT ", signature invalid\n", t);
+      printf("MPC simulation failed for round " SIZET_FMT ", signature invalid\n", t);
 #endif
-        ret = -1;
-        goto Exit;
-      }
-      commit_v(Cv.hashes[t], sig->proofs[proof_index].input, &msgs);
-      proof_index++;
+      ret = -1;
+      goto Exit;
     }
+    commit_v(Cv.hashes[t], sig->proofs[proof_index].input, &msgs);
+    proof_index++;
   }
 
   size_t missingLeavesSize = PICNIC_NUM_ROUNDS - PICNIC_NUM_OPENED_ROUNDS;
@@ -479,7 +528,7 @@ static int sign_picnic3(const uint8_t* privateKey, const uint8_t* pubKey, const
   tree_t seed;
   parties_seed_tree_storage_t seedTreeStorage;
 
-  lowmc_simulate_online_f simulateOnline = lowmc_simulate_online_uint64_129_43;
+  lowmc_simulate_online_f simulateOnline = LOWMC_SIMULATE_ONLINE_IMPL;
   uint8_t input[PICNIC_INPUT_SIZE];
   msgs_t msgs;
 
@@ -500,9 +549,7 @@ static int sign_picnic3(const uint8_t* privateKey, const uint8_t* pubKey, const
     computeAuxTape(&tape, input);
     /* Commit to seeds and aux bits */
     const size_t last = PICNIC_NUM_PARTIES - 1;
-    for (size_t j = 0; j < last; j++) {
-      commit(C.hashes[j], getLeaf(&seed, j), NULL, sig->salt, t, j);
-    }
+    commit_parties(&C, getLeaves(&seed), sig->salt, t);
     commit(C.hashes[last], getLeaf(&seed, last), tape.aux_bits, sig->salt, t, last);
 
     /* Simulate the online phase of the MPC */
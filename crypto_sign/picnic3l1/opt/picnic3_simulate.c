@@ -140,9 +140,41 @@
     XOR(statein, t2, t0);                                                                          \
   } while (0)
 
+#if !defined(NO_UINT64_FALLBACK)
+#define IMPL uint64
+#if defined(PICNIC3_L5)
+#include "lowmc_255_255_4.h"
+
+static void picnic3_mpc_sbox_uint64_lowmc_255_255_4(mzd_local_t* statein, randomTape_t* tapes,
+                                                    msgs_t* msgs) {
+
+  picnic3_mpc_sbox_bitsliced(LOWMC_255_255_4_N, mzd_xor_uint64_256, mzd_and_uint64_256,
+                             mzd_shift_left_uint64_256, mzd_shift_right_uint64_256,
+                             mask_255_255_85_a, mask_255_255_85_b, mask_255_255_85_c);
+}
+
+/* PICNIC3_L5_FS */
+#include "lowmc_255_255_4_fns_uint64.h"
+#undef SIM_ONLINE
+#define SIM_ONLINE lowmc_simulate_online_uint64_255_85
+#elif defined(PICNIC3_L3)
+#include "lowmc_192_192_4.h"
+
+static void picnic3_mpc_sbox_uint64_lowmc_192_192_4(mzd_local_t* statein, randomTape_t* tapes,
+                                                    msgs_t* msgs) {
+
+  picnic3_mpc_sbox_bitsliced(LOWMC_192_192_4_N, mzd_xor_uint64_192, mzd_and_uint64_192,
+                             mzd_shift_left_uint64_192, mzd_shift_right_uint64_192,
+                             mask_192_192_64_a, mask_192_192_64_b, mask_192_192_64_c);
+}
+
+/* PICNIC3_L3_FS */
+#include "lowmc_192_192_4_fns_uint64.h"
+#undef SIM_ONLINE
+#define SIM_ONLINE lowmc_simulate_online_uint64_192_64
+#else
 #include "lowmc_129_129_4.h"
 
-#if !defined(NO_UINT64_FALLBACK)
 static void picnic3_mpc_sbox_uint64_lowmc_129_129_4(mzd_local_t* statein, randomTape_t* tapes,
                                                     msgs_t* msgs) {
 
@@ -151,11 +183,11 @@ static void picnic3_mpc_sbox_uint64_lowmc_129_129_4(mzd_local_t* statein, random
                              mask_129_129_43_a, mask_129_129_43_b, mask_129_129_43_c);
 }
 
-#define IMPL uint64
 /* PICNIC3_L1_FS */
 #include "lowmc_129_129_4_fns_uint64.h"
 #undef SIM_ONLINE
 #define SIM_ONLINE lowmc_simulate_online_uint64_129_43
+#endif
 #include "picnic3_simulate.c.i"
 
 #undef IMPL
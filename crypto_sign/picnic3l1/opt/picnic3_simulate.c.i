@@ -24,16 +24,32 @@ int SIM_ONLINE(mzd_local_t* maskedKey, randomTape_t* tapes, msgs_t* msgs,
 
   //  MPC_MUL(temp, maskedKey, LOWMC_INSTANCE.k0_matrix,
   //          mask_shares); // roundKey = maskedKey * KMatrix[0]
+#if defined(MUL_KS)
+  // all round keys in one multiplication
+  mzd_local_t round_keys[LOWMC_R + 1];
+  MUL_KS(round_keys, maskedKey, LOWMC_INSTANCE.ks_matrix);
+  XOR(state, round_keys, plaintext);
+#else
   MUL(temp, maskedKey, LOWMC_INSTANCE.k0_matrix);
   XOR(state, temp, plaintext);
+#endif
 
   for (uint32_t r = 0; r < LOWMC_R; r++) {
     mpc_sbox(state, tapes, msgs);
     // MPC_MUL(state, state, LOWMC_INSTANCE.rounds[r].l_matrix,
     //        mask_shares); // state = state * LMatrix (r-1)
+#if defined(MUL_LK)
+    MUL_LK(temp, state, maskedKey, LOWMC_INSTANCE.rounds[r].lk_matrix);
+    XOR(state, temp, LOWMC_INSTANCE.rounds[r].constant);
+#elif defined(MUL_KS)
+    MUL(temp, state, LOWMC_INSTANCE.rounds[r].l_matrix);
+    XOR(state, temp, LOWMC_INSTANCE.rounds[r].constant);
+    XOR(state, state, &round_keys[r + 1]);
+#else
     MUL(temp, state, LOWMC_INSTANCE.rounds[r].l_matrix);
     XOR(state, temp, LOWMC_INSTANCE.rounds[r].constant);
     ADDMUL(state, maskedKey, LOWMC_INSTANCE.rounds[r].k_matrix);
+#endif
   }
 
   /* check that the output is correct */
@@ -21,5 +21,9 @@ typedef int (*lowmc_simulate_online_f)(mzd_local_t* maskedKey, randomTape_t* tap
                                        const mzd_local_t* plaintext, const uint8_t* pubKey);
 int lowmc_simulate_online_uint64_129_43(mzd_local_t* maskedKey, randomTape_t* tapes, msgs_t* msgs,
                                         const mzd_local_t* plaintext, const uint8_t* pubKey);
+int lowmc_simulate_online_uint64_192_64(mzd_local_t* maskedKey, randomTape_t* tapes, msgs_t* msgs,
+                                        const mzd_local_t* plaintext, const uint8_t* pubKey);
+int lowmc_simulate_online_uint64_255_85(mzd_local_t* maskedKey, randomTape_t* tapes, msgs_t* msgs,
+                                        const mzd_local_t* plaintext, const uint8_t* pubKey);
 
 #endif
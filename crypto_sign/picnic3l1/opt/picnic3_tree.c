@@ -16,6 +16,7 @@
 
 #include "endian_compat.h"
 #include "kdf_shake.h"
+#include "kdf_shake_x4.h"
 #include "picnic.h"
 #include "picnic3_tree.h"
 #include "picnic3_types.h"
@@ -173,34 +174,88 @@ static void hashSeed(uint8_t* digest, const uint8_t* inputSeed, uint8_t* salt, u
   hash_squeeze(&ctx, digest, 2 * PICNIC_SEED_SIZE);
 }
 
-static void expandSeeds(tree_t* tree, uint8_t* salt, size_t repIndex) {
-  uint8_t tmp[2 * MAX_SEED_SIZE_BYTES];
-
-  /* Walk the tree, expanding seeds where possible. Compute children of
-   * non-leaf nodes. */
-  size_t lastNonLeaf = getParent(tree->numNodes - 1);
-  for (size_t i = 0; i <= lastNonLeaf; i++) {
-    if (!tree->haveNode[i]) {
-      continue;
+/* Hashes the seeds of up to four nodes into digests[0..3], at once with a four-lane Keccak. */
+static void hashSeeds(uint8_t (*digests)[2 * MAX_SEED_SIZE_BYTES], tree_t* tree, uint8_t* salt,
+                      size_t repIndex, const size_t* batch, size_t count) {
+#if defined(KECCAK_X4_AVX2)
+  if (hash_x4_available()) {
+    const uint8_t* seeds_x4[4];
+    uint8_t* digests_x4[4];
+    uint16_t rep_x4[4];
+    uint16_t node_x4[4];
+
+    /* unused lanes repeat the first node */
+    for (size_t k = 0; k < 4; k++) {
+      const size_t i = batch[k < count ? k : 0];
+      seeds_x4[k]    = tree->nodes[i];
+      digests_x4[k]  = digests[k];
+      rep_x4[k]      = repIndex;
+      node_x4[k]     = i;
     }
 
-    hashSeed(tmp, tree->nodes[i], salt, HASH_PREFIX_1, repIndex, i);
+    hash_context_x4 ctx;
+    hash_init_prefix_x4(&ctx, PICNIC_DIGEST_SIZE, HASH_PREFIX_1);
+    hash_update_x4(&ctx, seeds_x4, PICNIC_SEED_SIZE);
+    hash_update_x4_1(&ctx, salt, PICNIC_SALT_SIZE);
+    hash_update_x4_uint16_le(&ctx, rep_x4);
+    hash_update_x4_uint16_le(&ctx, node_x4);
+    hash_final_x4(&ctx);
+    hash_squeeze_x4(&ctx, digests_x4, 2 * PICNIC_SEED_SIZE);
+    return;
+  }
+#endif
+
+  for (size_t k = 0; k < count; k++) {
+    hashSeed(digests[k], tree->nodes[batch[k]], salt, HASH_PREFIX_1, repIndex, batch[k]);
+  }
+}
+
+/* Hashes the seeds of up to four nodes and stores the children. */
+static void expandSeedsBatch(tree_t* tree, uint8_t* salt, size_t repIndex, const size_t* batch,
+                             size_t count) {
+  uint8_t tmp[4][2 * MAX_SEED_SIZE_BYTES];
+  hashSeeds(tmp, tree, salt, repIndex, batch, count);
+
+  for (size_t k = 0; k < count; k++) {
+    const size_t i = batch[k];
 
     if (!tree->haveNode[2 * i + 1]) {
       /* left child = H_left(seed_i || salt || t || i) */
-      memcpy(tree->nodes[2 * i + 1], tmp, PICNIC_SEED_SIZE);
+      memcpy(tree->nodes[2 * i + 1], tmp[k], PICNIC_SEED_SIZE);
       tree->haveNode[2 * i + 1] = 1;
     }
 
     /* The last non-leaf node will only have a left child when there are an odd number of leaves */
     if (exists(tree, 2 * i + 2) && !tree->haveNode[2 * i + 2]) {
       /* right child = H_right(seed_i || salt || t || i)  */
-      memcpy(tree->nodes[2 * i + 2], tmp + PICNIC_SEED_SIZE, PICNIC_SEED_SIZE);
+      memcpy(tree->nodes[2 * i + 2], tmp[k] + PICNIC_SEED_SIZE, PICNIC_SEED_SIZE);
       tree->haveNode[2 * i + 2] = 1;
     }
   }
 }
 
+static void expandSeeds(tree_t* tree, uint8_t* salt, size_t repIndex) {
+  size_t batch[4];
+  size_t count = 0;
+
+  /* Walk the tree, expanding seeds where possible. Compute children of
+   * non-leaf nodes. Nodes are collected in batches of four, and a batch is
+   * expanded before the first child of one of its nodes is visited. */
+  size_t lastNonLeaf = getParent(tree->numNodes - 1);
+  for (size_t i = 0; i <= lastNonLeaf; i++) {
+    if (count && (count == 4 || i >= 2 * batch[0] + 1)) {
+      expandSeedsBatch(tree, salt, repIndex, batch, count);
+      count = 0;
+    }
+    if (tree->haveNode[i]) {
+      batch[count++] = i;
+    }
+  }
+  if (count) {
+    expandSeedsBatch(tree, salt, repIndex, batch, count);
+  }
+}
+
 void generatePartySeeds(tree_t* tree, parties_seed_tree_storage_t* storage, uint8_t* rootSeed,
                         uint8_t* salt, size_t repIndex) {
   createPartySeedTree(tree, storage);
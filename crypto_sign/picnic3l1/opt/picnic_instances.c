@@ -8,6 +8,7 @@
  */
 
 #include "picnic_instances.h"
+#include "picnic_params.h"
 
 // instance handling
 
@@ -21,10 +22,8 @@
 
 // L1, L3, and L5 instances with full Sbox layer
 #include "lowmc_129_129_4.h"
-#define lowmc_parameters_192_192_4                                                                 \
-  { 0, 0, 0, 0 }
-#define lowmc_parameters_255_255_4                                                                 \
-  { 0, 0, 0, 0 }
+#include "lowmc_192_192_4.h"
+#include "lowmc_255_255_4.h"
 
 #define ENABLE_ZKBPP(x)                                                                            \
   { 0, 0, 0, 0 }
@@ -32,7 +31,7 @@
 #define ENABLE_KKW(x) x
 
 #define NULL_FNS                                                                                   \
-  { NULL, NULL, NULL }
+  { NULL, NULL, NULL, NULL }
 
 static picnic_instance_t instances[PARAMETER_SET_MAX_INDEX] = {
     {{0, 0, 0, 0}, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, PARAMETER_SET_INVALID, NULL_FNS},
@@ -75,9 +74,15 @@ static bool create_instance(picnic_instance_t* pp) {
     return false;
   }
 
-  pp->impls.lowmc                 = &lowmc_uint64_lowmc_129_129_4;
-  pp->impls.lowmc_aux             = &lowmc_compute_aux_uint64_lowmc_129_129_4;
-  pp->impls.lowmc_simulate_online = &lowmc_simulate_online_uint64_129_43;
+  // the KKW engine is compiled for a single parameter set
+  if (pp->params != PICNIC3_PARAMETER_SET) {
+    return false;
+  }
+
+  pp->impls.lowmc                 = &LOWMC_IMPL;
+  pp->impls.lowmc_batch           = &LOWMC_BATCH_IMPL;
+  pp->impls.lowmc_aux             = &LOWMC_AUX_IMPL;
+  pp->impls.lowmc_simulate_online = &LOWMC_SIMULATE_ONLINE_IMPL;
 
   return true;
 }
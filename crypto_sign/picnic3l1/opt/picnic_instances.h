@@ -40,6 +40,7 @@ typedef struct picnic_instance_t {
 
   struct {
     lowmc_implementation_f lowmc;
+    lowmc_batch_implementation_f lowmc_batch;
     lowmc_compute_aux_implementation_f lowmc_aux;
     lowmc_simulate_online_f lowmc_simulate_online;
   } impls;
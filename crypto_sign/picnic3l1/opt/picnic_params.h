@@ -2,6 +2,56 @@
 #ifndef PICNIC_PARAMS_H
 #define PICNIC_PARAMS_H
 
+/*
+ * The KKW engine (picnic3_impl.c, picnic3_simulate.c, picnic3_tree.c) is specialized at compile
+ * time for one parameter set: Picnic3-L1 by default, Picnic3-L3 with -DPICNIC3_L3 and Picnic3-L5
+ * with -DPICNIC3_L5. All sizes below are constants so that loops can be unrolled and all buffers
+ * live on the stack.
+ */
+#if defined(PICNIC3_L5)
+#define PICNIC3_PARAMETER_SET Picnic3_L5
+#define PICNIC_SALT_SIZE 32
+#define PICNIC_DIGEST_SIZE 64
+#define PICNIC_SEED_SIZE 32
+#define PICNIC_NUM_ROUNDS 601
+#define PICNIC_NUM_ROUNDS_LOG2 10
+#define PICNIC_NUM_OPENED_ROUNDS 68
+#define PICNIC_NUM_PARTIES 16
+#define PICNIC_NUM_PARTIES_LOG2 4
+#define PICNIC_INPUT_SIZE 32
+#define PICNIC_OUTPUT_SIZE 32
+#define PICNIC_VIEW_SIZE 128
+#define PICNIC_ROUND_TREE_NUM_NODES 1624
+#define PICNIC_ROUND_TREE_MAX_REVEALED_NODES (PICNIC_NUM_OPENED_ROUNDS * 4) // tau * log(M/tau)
+#define LOWMC_N 255
+#define LOWMC_M 85
+#define LOWMC_IMPL lowmc_uint64_lowmc_255_255_4
+#define LOWMC_BATCH_IMPL lowmc_bitsliced_uint64_lowmc_255_255_4
+#define LOWMC_AUX_IMPL lowmc_compute_aux_uint64_lowmc_255_255_4
+#define LOWMC_SIMULATE_ONLINE_IMPL lowmc_simulate_online_uint64_255_85
+#elif defined(PICNIC3_L3)
+#define PICNIC3_PARAMETER_SET Picnic3_L3
+#define PICNIC_SALT_SIZE 32
+#define PICNIC_DIGEST_SIZE 48
+#define PICNIC_SEED_SIZE 24
+#define PICNIC_NUM_ROUNDS 419
+#define PICNIC_NUM_ROUNDS_LOG2 9
+#define PICNIC_NUM_OPENED_ROUNDS 52
+#define PICNIC_NUM_PARTIES 16
+#define PICNIC_NUM_PARTIES_LOG2 4
+#define PICNIC_INPUT_SIZE 24
+#define PICNIC_OUTPUT_SIZE 24
+#define PICNIC_VIEW_SIZE 96
+#define PICNIC_ROUND_TREE_NUM_NODES 930
+#define PICNIC_ROUND_TREE_MAX_REVEALED_NODES (PICNIC_NUM_OPENED_ROUNDS * 4) // tau * log(M/tau)
+#define LOWMC_N 192
+#define LOWMC_M 64
+#define LOWMC_IMPL lowmc_uint64_lowmc_192_192_4
+#define LOWMC_BATCH_IMPL lowmc_bitsliced_uint64_lowmc_192_192_4
+#define LOWMC_AUX_IMPL lowmc_compute_aux_uint64_lowmc_192_192_4
+#define LOWMC_SIMULATE_ONLINE_IMPL lowmc_simulate_online_uint64_192_64
+#else
+#define PICNIC3_PARAMETER_SET Picnic3_L1
 #define PICNIC_SALT_SIZE 32
 #define PICNIC_DIGEST_SIZE 32
 #define PICNIC_SEED_SIZE 16
@@ -13,15 +63,20 @@
 #define PICNIC_INPUT_SIZE 17
 #define PICNIC_OUTPUT_SIZE 17
 #define PICNIC_VIEW_SIZE 65
-#define PICNIC_TAPE_SIZE (2 * PICNIC_VIEW_SIZE)
-#define PICNIC_AUX_SIZE PICNIC_VIEW_SIZE
 #define PICNIC_ROUND_TREE_NUM_NODES 505
 #define PICNIC_ROUND_TREE_MAX_REVEALED_NODES (PICNIC_NUM_OPENED_ROUNDS * 3) // tau * log(M/tau)
+#define LOWMC_N 129
+#define LOWMC_M 43
+#define LOWMC_IMPL lowmc_uint64_lowmc_129_129_4
+#define LOWMC_BATCH_IMPL lowmc_bitsliced_uint64_lowmc_129_129_4
+#define LOWMC_AUX_IMPL lowmc_compute_aux_uint64_lowmc_129_129_4
+#define LOWMC_SIMULATE_ONLINE_IMPL lowmc_simulate_online_uint64_129_43
+#endif
+#define PICNIC_TAPE_SIZE (2 * PICNIC_VIEW_SIZE)
+#define PICNIC_AUX_SIZE PICNIC_VIEW_SIZE
 #define PICNIC_PARTY_TREE_NUM_NODES 31
 // at most log(depth) seeds needed to reveal all but one party
 #define PICNIC_PARTY_TREE_MAX_REVEALED_NODES (PICNIC_NUM_PARTIES_LOG2)
-#define LOWMC_N 129
-#define LOWMC_M 43
 #define LOWMC_K LOWMC_N
 #define LOWMC_R 4
 
@@ -4,5 +4,11 @@
 #include "api.h"
 #endif
 
+#if defined(PICNIC3_L5)
+#define PICNIC_INSTANCE Picnic3_L5
+#elif defined(PICNIC3_L3)
+#define PICNIC_INSTANCE Picnic3_L3
+#else
 #define PICNIC_INSTANCE Picnic3_L1
+#endif
 #include "sign.c.i"
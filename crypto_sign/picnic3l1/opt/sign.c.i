@@ -37,8 +37,8 @@ int crypto_sign_keypair(unsigned char* pk, unsigned char* sk) {
   return 0;
 }
 
-int crypto_sign(unsigned char* sm, size_t* smlen, const unsigned char* m,
-                size_t mlen, const unsigned char* sk) {
+int crypto_sign_signature(unsigned char* sig, size_t* siglen, const unsigned char* m,
+                          size_t mlen, const unsigned char* sk) {
   /* the first byte encodes the parameter set and is public */
   picnic_declassify(&sk[0], sizeof(unsigned char));
   if (sk[0] != PICNIC_INSTANCE) {
@@ -46,10 +46,9 @@ int crypto_sign(unsigned char* sm, size_t* smlen, const unsigned char* m,
   }
 
   size_t signature_len = PICNIC_SIGNATURE_SIZE(PICNIC_INSTANCE);
-  uint32_t len         = 0;
 
 #if !defined(SUPERCOP)
-  assert(signature_len + sizeof(len) == CRYPTO_BYTES);
+  assert(signature_len + sizeof(uint32_t) == CRYPTO_BYTES);
 #endif
 
   picnic_privatekey_t psk;
@@ -58,7 +57,36 @@ int crypto_sign(unsigned char* sm, size_t* smlen, const unsigned char* m,
     return ret;
   }
 
-  ret = picnic_sign(&psk, m, mlen, sm + sizeof(len) + mlen, &signature_len);
+  ret = picnic_sign(&psk, m, mlen, sig, &signature_len);
+  if (ret) {
+    return ret;
+  }
+
+  *siglen = signature_len;
+  return 0;
+}
+
+int crypto_sign_verify(const unsigned char* sig, size_t siglen, const unsigned char* m,
+                       size_t mlen, const unsigned char* pk) {
+  if (pk[0] != PICNIC_INSTANCE) {
+    return -3;
+  }
+
+  picnic_publickey_t ppk;
+  int ret = picnic_read_public_key(&ppk, pk, PICNIC_PUBLIC_KEY_SIZE(PICNIC_INSTANCE));
+  if (ret < 0) {
+    return ret;
+  }
+
+  return picnic_verify(&ppk, m, mlen, sig, siglen);
+}
+
+int crypto_sign(unsigned char* sm, size_t* smlen, const unsigned char* m,
+                size_t mlen, const unsigned char* sk) {
+  size_t signature_len = 0;
+  uint32_t len         = 0;
+
+  int ret = crypto_sign_signature(sm + sizeof(len) + mlen, &signature_len, m, mlen, sk);
   if (ret) {
     return ret;
   }
@@ -77,10 +105,6 @@ int crypto_sign(unsigned char* sm, size_t* smlen, const unsigned char* m,
 
 int crypto_sign_open(unsigned char* m, size_t* mlen, const unsigned char* sm,
                      size_t smlen, const unsigned char* pk) {
-  if (pk[0] != PICNIC_INSTANCE) {
-    return -3;
-  }
-
   uint32_t signature_len;
   memcpy(&signature_len, sm, sizeof(signature_len));
   signature_len = le32toh(signature_len);
@@ -93,13 +117,7 @@ int crypto_sign_open(unsigned char* m, size_t* mlen, const unsigned char* sm,
   const uint8_t* message   = sm + sizeof(signature_len);
   const uint8_t* sig       = sm + sizeof(signature_len) + message_len;
 
-  picnic_publickey_t ppk;
-  int ret = picnic_read_public_key(&ppk, pk, PICNIC_PUBLIC_KEY_SIZE(PICNIC_INSTANCE));
-  if (ret < 0) {
-    return ret;
-  }
-
-  ret = picnic_verify(&ppk, message, message_len, sig, signature_len);
+  int ret = crypto_sign_verify(sig, signature_len, message, message_len, pk);
   if (ret) {
     return ret;
   }
@@ -16,12 +16,15 @@
 #include "../picnic.h"
 
 #include <inttypes.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
 typedef struct {
   uint64_t keygen, sign, verify, size, max_size;
+  /* hardware counters of signing and verification */
+  timing_counters_t sign_counters, verify_counters;
 } timing_and_size_t;
 
 static void print_timings(timing_and_size_t* timings, unsigned int iter) {
@@ -31,6 +34,71 @@ static void print_timings(timing_and_size_t* timings, unsigned int iter) {
   }
 }
 
+static int compare_uint64(const void* a, const void* b) {
+  const uint64_t x = *(const uint64_t*)a;
+  const uint64_t y = *(const uint64_t*)b;
+  return (x > y) - (x < y);
+}
+
+/* median of one counter over all iterations, or 0 if it was not available in every iteration */
+static uint64_t counter_median(const timing_and_size_t* timings, unsigned int iter, size_t offset,
+                               unsigned int counter, uint64_t* values) {
+  for (unsigned int i = 0; i < iter; i++) {
+    const timing_counters_t* c = (const timing_counters_t*)((const uint8_t*)&timings[i] + offset);
+    if (!(c->available & (1u << counter))) {
+      return 0;
+    }
+    values[i] = c->values[counter];
+  }
+  qsort(values, iter, sizeof(*values), compare_uint64);
+  return values[iter / 2];
+}
+
+/* Prints the medians of the hardware counters as comment lines after the timings. A high IPC
+ * indicates a compute-bound operation, many L1/LLC misses per instruction a cache-bound one. */
+static void print_counters(const timing_and_size_t* timings, unsigned int iter) {
+  static const struct {
+    const char* name;
+    size_t offset;
+  } ops[] = {
+      {"sign", offsetof(timing_and_size_t, sign_counters)},
+      {"verify", offsetof(timing_and_size_t, verify_counters)},
+  };
+
+  uint64_t* values = calloc(iter, sizeof(uint64_t));
+  if (!iter || !values) {
+    free(values);
+    return;
+  }
+
+  printf("# op");
+  for (unsigned int c = 0; c < TIMING_COUNTER_MAX; c++) {
+    printf(",%s", timing_counter_name(c));
+  }
+  printf(",ipc\n");
+
+  for (size_t o = 0; o < sizeof(ops) / sizeof(ops[0]); o++) {
+    uint64_t medians[TIMING_COUNTER_MAX];
+    printf("# %s", ops[o].name);
+    for (unsigned int c = 0; c < TIMING_COUNTER_MAX; c++) {
+      medians[c] = counter_median(timings, iter, ops[o].offset, c, values);
+      if (medians[c]) {
+        printf(",%" PRIu64, medians[c]);
+      } else {
+        printf(",-");
+      }
+    }
+    if (medians[TIMING_COUNTER_CYCLES] && medians[TIMING_COUNTER_INSTRUCTIONS]) {
+      printf(",%.2f\n",
+             (double)medians[TIMING_COUNTER_INSTRUCTIONS] / medians[TIMING_COUNTER_CYCLES]);
+    } else {
+      printf(",-\n");
+    }
+  }
+
+  free(values);
+}
+
 static void bench_sign_and_verify(const bench_options_t* options) {
   static const uint8_t m[] = {1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 16,
                               17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
@@ -51,6 +119,10 @@ static void bench_sign_and_verify(const bench_options_t* options) {
     return;
   }
 
+  timing_counters_t start_counters, end_counters;
+  /* if no hardware counter is available, only the timings are reported */
+  const bool have_counters = timing_read_counters(&ctx, &start_counters);
+
   for (unsigned int i = 0; i != options->iter; ++i) {
     timing_and_size_t* timing = &timings[i];
     timing->max_size          = max_signature_size;
@@ -69,17 +141,23 @@ static void bench_sign_and_verify(const bench_options_t* options) {
     start_time        = timing_read(&ctx);
 
     size_t siglen = max_signature_size;
+    timing_read_counters(&ctx, &start_counters);
     if (!picnic_sign(&private_key, m, sizeof(m), sig, &siglen)) {
+      timing_read_counters(&ctx, &end_counters);
       tmp_time     = timing_read(&ctx);
       timing->sign = tmp_time - start_time;
       timing->size = siglen;
-      start_time   = timing_read(&ctx);
+      timing_counters_sub(&timing->sign_counters, &end_counters, &start_counters);
+      start_time = timing_read(&ctx);
 
+      timing_read_counters(&ctx, &start_counters);
       if (picnic_verify(&public_key, m, sizeof(m), sig, siglen)) {
         printf("picnic_verify: failed\n");
       }
+      timing_read_counters(&ctx, &end_counters);
       tmp_time       = timing_read(&ctx);
       timing->verify = tmp_time - start_time;
+      timing_counters_sub(&timing->verify_counters, &end_counters, &start_counters);
     } else {
       printf("picnic_sign: failed\n");
     }
@@ -87,6 +165,9 @@ static void bench_sign_and_verify(const bench_options_t* options) {
 
   timing_close(&ctx);
   print_timings(timings, options->iter);
+  if (have_counters) {
+    print_counters(timings, options->iter);
+  }
 
   free(timings);
 }
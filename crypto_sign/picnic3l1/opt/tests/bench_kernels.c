@@ -0,0 +1,251 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+/* Microbenchmarks for the kernels of the KKW signer.
+ *
+ * The translation units containing the kernels are included directly, so that static functions
+ * such as the S-box layers and expandSeeds can be called in isolation. Every kernel runs on inputs
+ * of the shape used during signing (LowMC matrices, random tapes and messages of the selected
+ * parameter set, full seed and commitment trees). Each sample times a batch of calls; the median
+ * over all samples is reported as ns/call and cycles/call. */
+
+#include "../lowmc.c"
+#include "../picnic3_simulate.c"
+#include "../picnic3_tree.c"
+
+#include "bench_timing.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if defined(PICNIC3_L5)
+#define BENCH_ADDMUL mzd_addmul_v_uint64_255
+#define BENCH_SBOX_AUX sbox_aux_uint64_lowmc_255_255_4
+#define BENCH_MPC_SBOX picnic3_mpc_sbox_uint64_lowmc_255_255_4
+#define BENCH_LOWMC lowmc_255_255_4
+#define BENCH_N LOWMC_255_255_4_N
+#elif defined(PICNIC3_L3)
+#define BENCH_ADDMUL mzd_addmul_v_uint64_192_packed
+#define BENCH_SBOX_AUX sbox_aux_uint64_lowmc_192_192_4
+#define BENCH_MPC_SBOX picnic3_mpc_sbox_uint64_lowmc_192_192_4
+#define BENCH_LOWMC lowmc_192_192_4
+#define BENCH_N LOWMC_192_192_4_N
+#else
+#define BENCH_ADDMUL mzd_addmul_v_uint64_129_packed
+#define BENCH_SBOX_AUX sbox_aux_uint64_lowmc_129_129_4
+#define BENCH_MPC_SBOX picnic3_mpc_sbox_uint64_lowmc_129_129_4
+#define BENCH_LOWMC lowmc_129_129_4
+#define BENCH_N LOWMC_129_129_4_N
+#endif
+
+#define BENCH_STR(x) BENCH_STR_(x)
+#define BENCH_STR_(x) #x
+
+/* SHAKE128 rate */
+#define SHAKE128_BLOCK_SIZE 168
+
+static timing_context_t timing;
+
+static uint64_t cycles_read(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return timing_read(&timing);
+#endif
+}
+
+static uint64_t ns_read(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * UINT64_C(1000000000) + (uint64_t)ts.tv_nsec;
+}
+
+/* Kernel state, filled with random data once */
+
+static mzd_local_t state[1], state_out[1], vector[1];
+static randomTape_t tapes;
+static msgs_t msgs;
+static uint8_t salt[PICNIC_SALT_SIZE];
+static uint8_t root_seed[PICNIC_SEED_SIZE];
+static hash_context shake;
+static uint8_t squeeze_out[SHAKE128_BLOCK_SIZE];
+static tree_t tree;
+static round_seed_tree_storage_t seed_storage;
+static round_commitment_tree_storage_t commitment_storage;
+static uint8_t leaves[PICNIC_NUM_ROUNDS][PICNIC_DIGEST_SIZE];
+static uint8_t* leaf_ptrs[PICNIC_NUM_ROUNDS];
+
+static void random_bytes(uint8_t* dst, size_t len) {
+  for (size_t i = 0; i < len; ++i) {
+    dst[i] = (uint8_t)rand();
+  }
+}
+
+static void random_vector(mzd_local_t* v) {
+  uint8_t buf[PICNIC_INPUT_SIZE];
+  random_bytes(buf, sizeof(buf));
+  mzd_from_char_array(v, buf, sizeof(buf));
+}
+
+static void setup_nop(void) {}
+
+/* the S-box layers advance the tape and message positions */
+static void setup_tapes(void) {
+  tapes.pos     = 0;
+  tapes.aux_pos = 0;
+  msgs.pos      = 0;
+}
+
+static void setup_shake(void) {
+  hash_init(&shake, PICNIC_DIGEST_SIZE);
+  hash_update(&shake, salt, sizeof(salt));
+  hash_final(&shake);
+}
+
+static void setup_seed_tree(void) {
+  createRoundSeedTree(&tree, &seed_storage);
+  memcpy(tree.nodes[0], root_seed, PICNIC_SEED_SIZE);
+  tree.haveNode[0] = 1;
+}
+
+static void setup_commitment_tree(void) {
+  createRoundCommitmentTree(&tree, &commitment_storage);
+}
+
+static void run_addmul(void) {
+  BENCH_ADDMUL(state, vector, BENCH_LOWMC.k0_matrix);
+}
+
+static void run_from_bitstream(void) {
+  bitstream_t bs = {{tapes.tape[0]}, 0};
+  mzd_from_bitstream(&bs, state_out, (BENCH_N + 63) / (sizeof(uint64_t) * 8), BENCH_N);
+}
+
+static void run_mpc_sbox(void) {
+  tapes.pos = 0;
+  msgs.pos  = 0;
+  BENCH_MPC_SBOX(state, &tapes, &msgs);
+}
+
+static void run_sbox_aux(void) {
+  tapes.pos     = 0;
+  tapes.aux_pos = 0;
+  BENCH_SBOX_AUX(state, state_out, &tapes);
+}
+
+static void run_shake_squeeze(void) {
+  hash_squeeze(&shake, squeeze_out, sizeof(squeeze_out));
+}
+
+static void run_expand_seeds(void) {
+  expandSeeds(&tree, salt, 0);
+}
+
+static void run_merkle_tree(void) {
+  buildMerkleTree(&tree, leaf_ptrs, salt);
+}
+
+typedef struct {
+  const char* name;
+  /* calls per sample; kernels that consume their input run once after every setup */
+  unsigned int batch;
+  void (*setup)(void);
+  void (*run)(void);
+} kernel_t;
+
+static const kernel_t kernels[] = {
+    {BENCH_STR(BENCH_ADDMUL), 1024, setup_nop, run_addmul},
+    {"mzd_from_bitstream", 1024, setup_tapes, run_from_bitstream},
+    {"picnic3_mpc_sbox_bitsliced", 64, setup_tapes, run_mpc_sbox},
+    {BENCH_STR(BENCH_SBOX_AUX), 256, setup_tapes, run_sbox_aux},
+    {"shake128_squeeze_block", 256, setup_shake, run_shake_squeeze},
+    {"expandSeeds", 1, setup_seed_tree, run_expand_seeds},
+    {"buildMerkleTree", 1, setup_commitment_tree, run_merkle_tree},
+};
+
+static int compare_uint64(const void* a, const void* b) {
+  const uint64_t x = *(const uint64_t*)a;
+  const uint64_t y = *(const uint64_t*)b;
+  return (x > y) - (x < y);
+}
+
+static void bench_kernel(const kernel_t* kernel, unsigned int iter, uint64_t* ns, uint64_t* cycles) {
+  /* warm-up */
+  kernel->setup();
+  for (unsigned int j = 0; j < kernel->batch; ++j) {
+    kernel->run();
+  }
+
+  for (unsigned int i = 0; i < iter; ++i) {
+    kernel->setup();
+    const uint64_t start_ns     = ns_read();
+    const uint64_t start_cycles = cycles_read();
+    for (unsigned int j = 0; j < kernel->batch; ++j) {
+      kernel->run();
+    }
+    cycles[i] = cycles_read() - start_cycles;
+    ns[i]     = ns_read() - start_ns;
+  }
+
+  qsort(ns, iter, sizeof(*ns), compare_uint64);
+  qsort(cycles, iter, sizeof(*cycles), compare_uint64);
+}
+
+int main(int argc, char** argv) {
+  unsigned int iter = 101;
+  if (argc > 2 || (argc == 2 && (iter = strtoul(argv[1], NULL, 10)) == 0)) {
+    printf("usage: %s [samples]\n", argv[0]);
+    return -1;
+  }
+
+  if (!timing_init(&timing)) {
+    printf("Failed to initialize timing functionality.\n");
+    return -1;
+  }
+
+  srand(0);
+  random_vector(state);
+  random_vector(state_out);
+  random_vector(vector);
+  random_bytes((uint8_t*)tapes.tape, sizeof(tapes.tape));
+  random_bytes(tapes.parity_tapes, sizeof(tapes.parity_tapes));
+  random_bytes((uint8_t*)msgs.msgs, sizeof(msgs.msgs));
+  msgs.unopened = -1;
+  random_bytes(salt, sizeof(salt));
+  random_bytes(root_seed, sizeof(root_seed));
+  random_bytes((uint8_t*)leaves, sizeof(leaves));
+  for (unsigned int i = 0; i < PICNIC_NUM_ROUNDS; ++i) {
+    leaf_ptrs[i] = leaves[i];
+  }
+
+  uint64_t* ns     = calloc(iter, sizeof(uint64_t));
+  uint64_t* cycles = calloc(iter, sizeof(uint64_t));
+  if (!ns || !cycles) {
+    printf("Failed to allocate memory.\n");
+    return -1;
+  }
+
+  printf("%-40s %12s %14s\n", "kernel", "ns/call", "cycles/call");
+  for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); ++k) {
+    bench_kernel(&kernels[k], iter, ns, cycles);
+    printf("%-40s %12.1f %14.1f\n", kernels[k].name, (double)ns[iter / 2] / kernels[k].batch,
+           (double)cycles[iter / 2] / kernels[k].batch);
+  }
+
+  timing_close(&timing);
+  free(cycles);
+  free(ns);
+  return 0;
+}
@@ -192,8 +192,108 @@ static bool perf_init(timing_context_t* ctx) {
   ctx->data.fd = fd;
   return true;
 }
+
+static void counters_init(timing_context_t* ctx) {
+  static const struct {
+    uint32_t type;
+    uint64_t config;
+  } events[TIMING_COUNTER_MAX] = {
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+      /* usually the misses of the last level cache */
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+  };
+
+  /* The events are opened separately, so that unsupported ones can be skipped. If the PMU has
+   * fewer counters than events, the kernel multiplexes them and the values are scaled. */
+  for (unsigned int i = 0; i < TIMING_COUNTER_MAX; ++i) {
+    struct perf_event_attr pea;
+    memset(&pea, 0, sizeof(pea));
+
+    pea.size           = sizeof(pea);
+    pea.type           = events[i].type;
+    pea.config         = events[i].config;
+    pea.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    pea.exclude_kernel = 1;
+    pea.exclude_hv     = 1;
+
+    ctx->counter_fds[i] = perf_event_open(&pea, 0, -1, -1, 0);
+  }
+}
+
+static void counters_close(timing_context_t* ctx) {
+  for (unsigned int i = 0; i < TIMING_COUNTER_MAX; ++i) {
+    if (ctx->counter_fds[i] != -1) {
+      close(ctx->counter_fds[i]);
+      ctx->counter_fds[i] = -1;
+    }
+  }
+}
+
+bool timing_read_counters(timing_context_t* ctx, timing_counters_t* counters) {
+  counters->available = 0;
+  for (unsigned int i = 0; i < TIMING_COUNTER_MAX; ++i) {
+    /* value, time enabled, time running */
+    uint64_t data[3];
+    counters->values[i] = 0;
+    if (ctx->counter_fds[i] == -1 ||
+        read(ctx->counter_fds[i], data, sizeof(data)) != sizeof(data) || !data[2]) {
+      continue;
+    }
+
+    counters->values[i] =
+        data[1] == data[2] ? data[0] : (uint64_t)((double)data[0] * data[1] / data[2]);
+    counters->available |= 1u << i;
+  }
+
+  return counters->available != 0;
+}
+#else
+static void counters_init(timing_context_t* ctx) {
+  for (unsigned int i = 0; i < TIMING_COUNTER_MAX; ++i) {
+    ctx->counter_fds[i] = -1;
+  }
+}
+
+static void counters_close(timing_context_t* ctx) {
+  (void)ctx;
+}
+
+bool timing_read_counters(timing_context_t* ctx, timing_counters_t* counters) {
+  (void)ctx;
+  counters->available = 0;
+  return false;
+}
 #endif
 
+void timing_counters_sub(timing_counters_t* diff, const timing_counters_t* end,
+                         const timing_counters_t* start) {
+  diff->available = end->available & start->available;
+  for (unsigned int i = 0; i < TIMING_COUNTER_MAX; ++i) {
+    diff->values[i] = (diff->available & (1u << i)) ? end->values[i] - start->values[i] : 0;
+  }
+}
+
+const char* timing_counter_name(timing_counter_t counter) {
+  switch (counter) {
+  case TIMING_COUNTER_CYCLES:
+    return "cycles";
+  case TIMING_COUNTER_INSTRUCTIONS:
+    return "instructions";
+  case TIMING_COUNTER_L1D_MISSES:
+    return "l1d_misses";
+  case TIMING_COUNTER_LLC_MISSES:
+    return "llc_misses";
+  case TIMING_COUNTER_BRANCH_MISSES:
+    return "branch_misses";
+  default:
+    return "unknown";
+  }
+}
+
 static void clock_close(timing_context_t* ctx) {
   (void)ctx;
 }
@@ -210,6 +310,7 @@ static bool clock_init(timing_context_t* ctx) {
 }
 
 bool timing_init(timing_context_t* ctx) {
+  counters_init(ctx);
 #if defined(__linux__) && defined(__aarch64__)
   if (armv8_init(ctx)) {
     return true;
@@ -222,3 +323,8 @@ bool timing_init(timing_context_t* ctx) {
 #endif
   return clock_init(ctx);
 }
+
+void timing_close(timing_context_t* ctx) {
+  counters_close(ctx);
+  ctx->close(ctx);
+}
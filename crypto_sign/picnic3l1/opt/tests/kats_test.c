@@ -15,6 +15,18 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* The L1 file holds the official known answers, the L3 and L5 files regression vectors */
+#if defined(PICNIC3_L5)
+#define PICNIC3_TEST_PARAMETER_SET Picnic3_L5
+#define PICNIC3_TEST_KAT_FILE "./tests/kat_picnic3_l5.txt"
+#elif defined(PICNIC3_L3)
+#define PICNIC3_TEST_PARAMETER_SET Picnic3_L3
+#define PICNIC3_TEST_KAT_FILE "./tests/kat_picnic3_l3.txt"
+#else
+#define PICNIC3_TEST_PARAMETER_SET Picnic3_L1
+#define PICNIC3_TEST_KAT_FILE "./tests/kat_picnic3_l1.txt"
+#endif
+
 typedef struct {
   size_t mlen;
   uint8_t *msg;
@@ -260,16 +272,291 @@ static int run_test_vectors_from_file(const char *path, size_t pks,
 
   return (vectors_run && vectors_succeeded == vectors_run) ? 1 : 0;
 }
-static int picnic3_test_vector_L1(void) {
-  return run_test_vectors_from_file("./tests/kat_picnic3_l1.txt",
-                                    PICNIC_PUBLIC_KEY_SIZE(Picnic3_L1),
-                                    PICNIC_PRIVATE_KEY_SIZE(Picnic3_L1));
+static int picnic3_test_vector(void) {
+  return run_test_vectors_from_file(PICNIC3_TEST_KAT_FILE,
+                                    PICNIC_PUBLIC_KEY_SIZE(PICNIC3_TEST_PARAMETER_SET),
+                                    PICNIC_PRIVATE_KEY_SIZE(PICNIC3_TEST_PARAMETER_SET));
+}
+
+static int picnic3_test_sign_verify(void) {
+  const uint8_t msg[] = "message to sign";
+  picnic_publickey_t pk;
+  picnic_privatekey_t sk;
+  size_t signature_len = PICNIC_SIGNATURE_SIZE(PICNIC3_TEST_PARAMETER_SET);
+  uint8_t *signature = malloc(signature_len);
+  int ok = 0;
+
+  if (!signature) {
+    goto err;
+  }
+
+  if (picnic_keygen(PICNIC3_TEST_PARAMETER_SET, &pk, &sk) != 0) {
+    printf("Unable to generate key pair.\n");
+    goto err;
+  }
+
+  if (picnic_sign(&sk, msg, sizeof(msg), signature, &signature_len) != 0) {
+    printf("Unable to sign.\n");
+    goto err;
+  }
+
+  if (picnic_verify(&pk, msg, sizeof(msg), signature, signature_len) != 0) {
+    printf("Signature does not verify.\n");
+    goto err;
+  }
+
+  signature[signature_len / 2] ^= 0x01;
+  if (picnic_verify(&pk, msg, sizeof(msg), signature, signature_len) == 0) {
+    printf("Modified signature verifies.\n");
+    goto err;
+  }
+
+  ok = 1;
+
+err:
+  free(signature);
+  return ok;
+}
+
+static int picnic3_test_keygen_batch(void) {
+  /* more keys than one bitsliced pass handles */
+  const size_t count = 300;
+  picnic_publickey_t *pks = calloc(count, sizeof(*pks));
+  picnic_privatekey_t *sks = calloc(count, sizeof(*sks));
+  int *results = calloc(count, sizeof(*results));
+  int ok = 0;
+
+  if (!pks || !sks || !results) {
+    goto err;
+  }
+
+  if (picnic_keygen_batch(PICNIC3_TEST_PARAMETER_SET, pks, sks, count) != 0) {
+    printf("Unable to generate key pairs in batch.\n");
+    goto err;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    picnic_publickey_t pk;
+    if (picnic_sk_to_pk(&sks[i], &pk) != 0 ||
+        memcmp(&pk, &pks[i], PICNIC_PUBLIC_KEY_SIZE(PICNIC3_TEST_PARAMETER_SET)) != 0 ||
+        picnic_validate_keypair(&sks[i], &pks[i]) != 0) {
+      printf("Batch key pair %zu does not match.\n", i);
+      goto err;
+    }
+  }
+
+  if (picnic_validate_keypair_batch(sks, pks, count, results) != 0) {
+    printf("Batch key pairs do not validate.\n");
+    goto err;
+  }
+
+  /* break one public key, only its result may change */
+  pks[count - 7].data[1] ^= 0x01;
+  if (picnic_validate_keypair_batch(sks, pks, count, results) == 0) {
+    printf("Broken key pair validates.\n");
+    goto err;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if ((results[i] != 0) != (i == count - 7)) {
+      printf("Wrong batch validation result for key pair %zu.\n", i);
+      goto err;
+    }
+  }
+
+  ok = 1;
+
+err:
+  free(results);
+  free(sks);
+  free(pks);
+  return ok;
+}
+
+static int picnic3_test_sign_batch(void) {
+  const size_t count      = 3;
+  const size_t max_siglen = PICNIC_SIGNATURE_SIZE(PICNIC3_TEST_PARAMETER_SET);
+  const uint8_t msgs[3][32] = {{0x01}, {0x02}, {0x03}};
+  const uint8_t* messages[3];
+  size_t message_lens[3];
+  uint8_t* signatures[3];
+  size_t signature_lens[3];
+  int statuses[3];
+  uint8_t* buffer = calloc(count + 1, max_siglen);
+  picnic_publickey_t pk;
+  picnic_privatekey_t sk;
+  int ok = 0;
+
+  if (!buffer) {
+    goto err;
+  }
+
+  if (picnic_keygen(PICNIC3_TEST_PARAMETER_SET, &pk, &sk) != 0) {
+    printf("Unable to generate key pair.\n");
+    goto err;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    messages[i]       = msgs[i];
+    message_lens[i]   = sizeof(msgs[i]) - i;
+    signatures[i]     = buffer + i * max_siglen;
+    signature_lens[i] = max_siglen;
+  }
+
+  if (picnic_sign_batch(&sk, messages, message_lens, signatures, signature_lens, statuses,
+                        count) != 0 ||
+      statuses[0] || statuses[1] || statuses[2]) {
+    printf("Unable to sign messages in batch.\n");
+    goto err;
+  }
+
+  /* signing is deterministic, so every signature equals the one of picnic_sign */
+  for (size_t i = 0; i < count; ++i) {
+    uint8_t* signature   = buffer + count * max_siglen;
+    size_t signature_len = max_siglen;
+    if (picnic_sign(&sk, messages[i], message_lens[i], signature, &signature_len) != 0 ||
+        signature_len != signature_lens[i] ||
+        memcmp(signature, signatures[i], signature_len) != 0) {
+      printf("Batch signature %zu does not match.\n", i);
+      goto err;
+    }
+    if (picnic_verify(&pk, messages[i], message_lens[i], signatures[i], signature_lens[i]) != 0) {
+      printf("Batch signature %zu does not verify.\n", i);
+      goto err;
+    }
+  }
+
+  /* a failing message is reported by its status and does not stop the others */
+  signatures[1] = NULL;
+  for (size_t i = 0; i < count; ++i) {
+    signature_lens[i] = max_siglen;
+  }
+  if (picnic_sign_batch(&sk, messages, message_lens, signatures, signature_lens, statuses,
+                        count) == 0 ||
+      statuses[0] != 0 || statuses[1] != -1 || statuses[2] != 0 ||
+      picnic_verify(&pk, messages[0], message_lens[0], signatures[0], signature_lens[0]) != 0 ||
+      picnic_verify(&pk, messages[2], message_lens[2], signatures[2], signature_lens[2]) != 0) {
+    printf("Batch signing did not report the failing message.\n");
+    goto err;
+  }
+
+  ok = 1;
+
+err:
+  free(buffer);
+  return ok;
+}
+
+static int picnic3_test_verify_cache(void) {
+#if defined(PICNIC_VERIFY_CACHE)
+  /* one more signature than the cache holds */
+  const size_t count      = 5;
+  const size_t max_siglen = PICNIC_SIGNATURE_SIZE(PICNIC3_TEST_PARAMETER_SET);
+  const uint8_t msgs[5][16] = {{0x01}, {0x02}, {0x03}, {0x04}, {0x05}};
+  const uint8_t* messages[5];
+  size_t message_lens[5];
+  uint8_t* signatures[5];
+  size_t signature_lens[5];
+  uint8_t* buffer = calloc(count, max_siglen);
+  picnic_verify_cache_stats_t stats;
+  picnic_publickey_t pk;
+  picnic_privatekey_t sk;
+  int ok = 0;
+
+  if (!buffer) {
+    goto err;
+  }
+
+  if (picnic_keygen(PICNIC3_TEST_PARAMETER_SET, &pk, &sk) != 0) {
+    printf("Unable to generate key pair.\n");
+    goto err;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    messages[i]       = msgs[i];
+    message_lens[i]   = sizeof(msgs[i]);
+    signatures[i]     = buffer + i * max_siglen;
+    signature_lens[i] = max_siglen;
+  }
+
+  if (picnic_sign_batch(&sk, messages, message_lens, signatures, signature_lens, NULL,
+                        count) != 0) {
+    printf("Unable to sign messages in batch.\n");
+    goto err;
+  }
+
+  if (picnic_verify_cache_init(3) != 0) {
+    printf("Unable to enable the verification cache.\n");
+    goto err;
+  }
+
+  /* miss, then hit */
+  if (picnic_verify(&pk, messages[0], message_lens[0], signatures[0], signature_lens[0]) != 0 ||
+      picnic_verify(&pk, messages[0], message_lens[0], signatures[0], signature_lens[0]) != 0 ||
+      picnic_verify_cache_stats(&stats) != 0 || stats.hits != 1 || stats.misses != 1 ||
+      stats.entries != 1 || stats.capacity != 4) {
+    printf("Unexpected verification cache hits or misses.\n");
+    goto err;
+  }
+
+  /* failed verifications are not cached */
+  signatures[0][signature_lens[0] / 2] ^= 0x01;
+  if (picnic_verify(&pk, messages[0], message_lens[0], signatures[0], signature_lens[0]) == 0 ||
+      picnic_verify(&pk, messages[0], message_lens[0], signatures[0], signature_lens[0]) == 0 ||
+      picnic_verify_cache_stats(&stats) != 0 || stats.hits != 1 || stats.misses != 3 ||
+      stats.entries != 1) {
+    printf("Failed verification was cached.\n");
+    goto err;
+  }
+  signatures[0][signature_lens[0] / 2] ^= 0x01;
+
+  /* the same signature for a different message is not a hit */
+  if (picnic_verify(&pk, messages[1], message_lens[1], signatures[0], signature_lens[0]) == 0) {
+    printf("Signature verifies for a different message.\n");
+    goto err;
+  }
+
+  for (size_t i = 1; i < count; ++i) {
+    if (picnic_verify(&pk, messages[i], message_lens[i], signatures[i], signature_lens[i]) != 0) {
+      printf("Signature %zu does not verify.\n", i);
+      goto err;
+    }
+  }
+  if (picnic_verify_cache_stats(&stats) != 0 || stats.entries > stats.capacity) {
+    printf("Verification cache exceeds its capacity.\n");
+    goto err;
+  }
+
+  if (picnic_verify_cache_init(0) != 0 || picnic_verify_cache_stats(&stats) != 0 ||
+      stats.capacity != 0 || stats.entries != 0 ||
+      picnic_verify(&pk, messages[0], message_lens[0], signatures[0], signature_lens[0]) != 0 ||
+      picnic_verify_cache_stats(&stats) != 0 || stats.hits != 0 || stats.misses != 0) {
+    printf("Unable to disable the verification cache.\n");
+    goto err;
+  }
+
+  ok = 1;
+
+err:
+  free(buffer);
+  return ok;
+#else
+  picnic_verify_cache_stats_t stats;
+  if (picnic_verify_cache_init(16) == 0 || picnic_verify_cache_stats(&stats) == 0) {
+    printf("Verification cache enabled without PICNIC_VERIFY_CACHE.\n");
+    return 0;
+  }
+  return 1;
+#endif
 }
 
 typedef int (*test_fn_t)(void);
 
 static const test_fn_t tests[] = {
-    picnic3_test_vector_L1,
+    picnic3_test_vector,
+    picnic3_test_sign_verify,
+    picnic3_test_keygen_batch,
+    picnic3_test_sign_batch,
+    picnic3_test_verify_cache,
 };
 
 static const size_t num_tests = sizeof(tests) / sizeof(tests[0]);
@@ -0,0 +1,192 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+#include "verify_cache.h"
+
+#if defined(PICNIC_VERIFY_CACHE)
+#include "kdf_shake.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* domain separation of the cache key from all hashes of the signature scheme */
+#define VERIFY_CACHE_KEY_PREFIX 0xca
+
+typedef struct {
+  uint8_t key[VERIFY_CACHE_KEY_SIZE];
+  uint8_t valid;
+} verify_cache_entry_t;
+
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static verify_cache_entry_t* cache_entries;
+/* per set: the way replaced next */
+static uint8_t* cache_next;
+static size_t cache_sets;
+static size_t cache_used;
+static uint64_t cache_hits;
+static uint64_t cache_misses;
+
+int verify_cache_init(size_t capacity) {
+  const size_t sets = (capacity + VERIFY_CACHE_WAYS - 1) / VERIFY_CACHE_WAYS;
+  verify_cache_entry_t* entries = NULL;
+  uint8_t* next                 = NULL;
+  if (sets) {
+    entries = calloc(sets * VERIFY_CACHE_WAYS, sizeof(*entries));
+    next    = calloc(sets, sizeof(*next));
+    if (!entries || !next) {
+      free(entries);
+      free(next);
+      return -1;
+    }
+  }
+
+  pthread_mutex_lock(&cache_lock);
+  verify_cache_entry_t* old_entries = cache_entries;
+  uint8_t* old_next                 = cache_next;
+  cache_entries                     = entries;
+  cache_next                        = next;
+  cache_sets                        = sets;
+  cache_used                        = 0;
+  cache_hits                        = 0;
+  cache_misses                      = 0;
+  pthread_mutex_unlock(&cache_lock);
+
+  free(old_entries);
+  free(old_next);
+  return 0;
+}
+
+int verify_cache_enabled(void) {
+  pthread_mutex_lock(&cache_lock);
+  const int enabled = cache_sets != 0;
+  pthread_mutex_unlock(&cache_lock);
+  return enabled;
+}
+
+static void hash_update_size_le(hash_context* ctx, size_t size) {
+  uint8_t size_le[8];
+  for (unsigned int i = 0; i < sizeof(size_le); ++i) {
+    size_le[i] = (uint8_t)((uint64_t)size >> (8 * i));
+  }
+  hash_update(ctx, size_le, sizeof(size_le));
+}
+
+void verify_cache_key(uint8_t* key, const uint8_t* pk, size_t pk_len, const uint8_t* message,
+                      size_t message_len, const uint8_t* signature, size_t signature_len) {
+  hash_context ctx;
+  /* any digest size other than 32 selects SHAKE256 */
+  hash_init_prefix(&ctx, 2 * VERIFY_CACHE_KEY_SIZE, VERIFY_CACHE_KEY_PREFIX);
+  hash_update(&ctx, pk, pk_len);
+  hash_update_size_le(&ctx, message_len);
+  hash_update(&ctx, message, message_len);
+  hash_update_size_le(&ctx, signature_len);
+  hash_update(&ctx, signature, signature_len);
+  hash_final(&ctx);
+  hash_squeeze(&ctx, key, VERIFY_CACHE_KEY_SIZE);
+  hash_clear(&ctx);
+}
+
+/* the key is uniformly distributed, so its first bytes select the set */
+static size_t key_set(const uint8_t* key) {
+  uint64_t index = 0;
+  for (unsigned int i = 0; i < sizeof(index); ++i) {
+    index |= (uint64_t)key[i] << (8 * i);
+  }
+  return (size_t)(index % cache_sets);
+}
+
+static verify_cache_entry_t* find_entry(const uint8_t* key) {
+  verify_cache_entry_t* set = &cache_entries[key_set(key) * VERIFY_CACHE_WAYS];
+  for (unsigned int way = 0; way < VERIFY_CACHE_WAYS; ++way) {
+    if (set[way].valid && !memcmp(set[way].key, key, VERIFY_CACHE_KEY_SIZE)) {
+      return &set[way];
+    }
+  }
+  return NULL;
+}
+
+int verify_cache_lookup(const uint8_t* key) {
+  int hit = 0;
+  pthread_mutex_lock(&cache_lock);
+  if (cache_sets) {
+    hit = find_entry(key) != NULL;
+    if (hit) {
+      ++cache_hits;
+    } else {
+      ++cache_misses;
+    }
+  }
+  pthread_mutex_unlock(&cache_lock);
+  return hit;
+}
+
+void verify_cache_insert(const uint8_t* key) {
+  pthread_mutex_lock(&cache_lock);
+  /* another thread may have verified the same tuple in the meantime */
+  if (cache_sets && !find_entry(key)) {
+    const size_t set        = key_set(key);
+    verify_cache_entry_t* e = &cache_entries[set * VERIFY_CACHE_WAYS + cache_next[set]];
+    cache_next[set]         = (cache_next[set] + 1) % VERIFY_CACHE_WAYS;
+    if (!e->valid) {
+      ++cache_used;
+    }
+    memcpy(e->key, key, VERIFY_CACHE_KEY_SIZE);
+    e->valid = 1;
+  }
+  pthread_mutex_unlock(&cache_lock);
+}
+
+int verify_cache_stats(uint64_t* hits, uint64_t* misses, size_t* entries, size_t* capacity) {
+  pthread_mutex_lock(&cache_lock);
+  *hits     = cache_hits;
+  *misses   = cache_misses;
+  *entries  = cache_used;
+  *capacity = cache_sets * VERIFY_CACHE_WAYS;
+  pthread_mutex_unlock(&cache_lock);
+  return 0;
+}
+#else
+int verify_cache_init(size_t capacity) {
+  (void)capacity;
+  return -1;
+}
+
+int verify_cache_enabled(void) {
+  return 0;
+}
+
+void verify_cache_key(uint8_t* key, const uint8_t* pk, size_t pk_len, const uint8_t* message,
+                      size_t message_len, const uint8_t* signature, size_t signature_len) {
+  (void)key;
+  (void)pk;
+  (void)pk_len;
+  (void)message;
+  (void)message_len;
+  (void)signature;
+  (void)signature_len;
+}
+
+int verify_cache_lookup(const uint8_t* key) {
+  (void)key;
+  return 0;
+}
+
+void verify_cache_insert(const uint8_t* key) {
+  (void)key;
+}
+
+int verify_cache_stats(uint64_t* hits, uint64_t* misses, size_t* entries, size_t* capacity) {
+  (void)hits;
+  (void)misses;
+  (void)entries;
+  (void)capacity;
+  return -1;
+}
+#endif
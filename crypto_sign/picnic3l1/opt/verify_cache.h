@@ -0,0 +1,39 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+#ifndef VERIFY_CACHE_H
+#define VERIFY_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Bounded cache of successfully verified (public key, message, signature) tuples, identified by
+ * a SHAKE256 hash of the tuple. The cache is a set-associative table with VERIFY_CACHE_WAYS
+ * entries per set, replaced round-robin, protected by a single mutex. It is only available if
+ * compiled with PICNIC_VERIFY_CACHE (requires POSIX threads); otherwise it is never enabled. */
+
+#define VERIFY_CACHE_KEY_SIZE 32
+#define VERIFY_CACHE_WAYS 4
+
+/**
+ * (Re)initialize the cache with room for capacity entries, rounded up to a multiple of
+ * VERIFY_CACHE_WAYS. All entries and counters are cleared; a capacity of 0 disables the cache.
+ */
+int verify_cache_init(size_t capacity);
+int verify_cache_enabled(void);
+void verify_cache_key(uint8_t* key, const uint8_t* pk, size_t pk_len, const uint8_t* message,
+                      size_t message_len, const uint8_t* signature, size_t signature_len);
+/**
+ * Look up a key and count the hit or miss. Returns 1 if the key is cached.
+ */
+int verify_cache_lookup(const uint8_t* key);
+void verify_cache_insert(const uint8_t* key);
+int verify_cache_stats(uint64_t* hits, uint64_t* misses, size_t* entries, size_t* capacity);
+
+#endif
@@ -15,5 +15,11 @@ int crypto_sign(unsigned char* sm, size_t* smlen, const unsigned char* m,
                 size_t mlen, const unsigned char* sk);
 int crypto_sign_open(unsigned char* m, size_t* mlen, const unsigned char* sm,
                      size_t smlen, const unsigned char* pk);
+/* Detached signatures: the signature (at most CRYPTO_BYTES - 4 bytes) is written to and read from
+ * a separate buffer and the message is not copied. */
+int crypto_sign_signature(unsigned char* sig, size_t* siglen, const unsigned char* m,
+                          size_t mlen, const unsigned char* sk);
+int crypto_sign_verify(const unsigned char* sig, size_t siglen, const unsigned char* m,
+                       size_t mlen, const unsigned char* pk);
 
 #endif
@@ -175,6 +175,153 @@ PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign(const picnic_privatekey_
  */
 PICNIC_EXPORT size_t PICNIC_CALLING_CONVENTION picnic_signature_size(picnic_params_t parameters);
 
+/**
+ * Get the number of bytes of the context required by picnic_sign_begin().
+ *
+ * @param[in] parameters The parameter set.
+ *
+ * @return The context size in bytes, or 0 if the parameter set is not supported.
+ *
+ * @see picnic_sign_begin()
+ */
+PICNIC_EXPORT size_t PICNIC_CALLING_CONVENTION
+picnic_sign_context_size(picnic_params_t parameters);
+
+/**
+ * Start a signature that is computed step by step.
+ * The signature is computed by calling picnic_sign_step() until it returns 0,
+ * and obtained with picnic_sign_finish(). Each step simulates a single ZKB++
+ * round, so signing can be interleaved with other work without threads. Every
+ * round is simulated three times, as in picnic_sign(), so a signature takes
+ * three times the number of rounds steps. The resulting signature is identical
+ * to the one created by picnic_sign(). No memory is allocated.
+ *
+ * The private key is copied into the context. The message and the signature
+ * buffer must stay valid and must not be modified until picnic_sign_finish()
+ * returns.
+ *
+ * @param[out] context The signing state, aligned to 8 bytes.
+ * @param[in] context_len The size of the context, at least
+ * picnic_sign_context_size() bytes.
+ * @param[in] sk      The signer's private key.
+ * @param[in] message The message to be signed.
+ * @param[in] message_len The length of the message, in bytes.
+ * @param[out] signature A buffer to hold the signature, see picnic_sign().
+ * @param[in] signature_len The length of the provided signature buffer, at
+ * least picnic_signature_size() bytes.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error.
+ *
+ * @see picnic_sign_step(), picnic_sign_finish()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign_begin(void* context, size_t context_len,
+                                                              const picnic_privatekey_t* sk,
+                                                              const uint8_t* message,
+                                                              size_t message_len,
+                                                              uint8_t* signature,
+                                                              size_t signature_len);
+
+/**
+ * Perform the next step of a signature started with picnic_sign_begin().
+ *
+ * @param[in,out] context The signing state.
+ *
+ * @return Returns 1 if more steps are required, 0 if the signature is
+ * complete and picnic_sign_finish() can be called, or -1 on error.
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign_step(void* context);
+
+/**
+ * Finish a signature computed with picnic_sign_step() and clear the secret
+ * values in the context.
+ *
+ * @param[in,out] context The signing state.
+ * @param[out] signature_len The number of bytes written to the signature buffer.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error or
+ * that not all steps were performed.
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_sign_finish(void* context,
+                                                               size_t* signature_len);
+
+/**
+ * Get the number of bytes of a presigned entry, see picnic_presign().
+ *
+ * @param[in] parameters The parameter set.
+ *
+ * @return The entry size in bytes, or 0 if the parameter set is not supported.
+ */
+PICNIC_EXPORT size_t PICNIC_CALLING_CONVENTION picnic_presign_size(picnic_params_t parameters);
+
+/**
+ * Precompute the message independent part of a randomized signature.
+ * Salt and seeds are drawn at random instead of being derived from the
+ * message. Every ZKB++ round is evaluated once, and the views, seeds and
+ * commitments of all parties are stored in the entry together with the
+ * challenge hash over output shares and commitments. picnic_sign_presigned()
+ * then only has to hash the message and copy the challenged views into the
+ * signature. Keeping a pool of entries that is refilled in the background
+ * moves the LowMC evaluations out of the signing path.
+ *
+ * Entries contain secret values and are bound to the key pair. Each entry can
+ * only be used for a single signature.
+ *
+ * @param[in] sk The signer's private key.
+ * @param[out] presign The entry, aligned to 8 bytes.
+ * @param[in] presign_len The size of the entry, at least picnic_presign_size() bytes.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error.
+ *
+ * @see picnic_sign_presigned()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION picnic_presign(const picnic_privatekey_t* sk,
+                                                           void* presign, size_t presign_len);
+
+/**
+ * Precompute an entry in deterministic mode for a message known in advance.
+ * Salt and seeds are derived from the private key and the message as in
+ * picnic_sign(), so picnic_sign_presigned() with the same message produces the
+ * signature of picnic_sign() byte for byte. The entry is bound to the message:
+ * picnic_sign_presigned() rejects it for any other message, since opening the
+ * same seeds for two challenges would reveal the private key.
+ *
+ * @param[in] sk The signer's private key.
+ * @param[in] message The message to be signed.
+ * @param[in] message_len The length of the message, in bytes.
+ * @param[out] presign The entry, aligned to 8 bytes.
+ * @param[in] presign_len The size of the entry, at least picnic_presign_size() bytes.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error.
+ *
+ * @see picnic_presign()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION
+picnic_presign_deterministic(const picnic_privatekey_t* sk, const uint8_t* message,
+                             size_t message_len, void* presign, size_t presign_len);
+
+/**
+ * Sign a message with an entry computed by picnic_presign().
+ * The entry is cleared, also if signing fails. The signature is randomized and
+ * verifies with picnic_verify().
+ *
+ * @param[in] sk      The signer's private key, the same as for picnic_presign().
+ * @param[in,out] presign The entry.
+ * @param[in] presign_len The size of the entry.
+ * @param[in] message The message to be signed.
+ * @param[in] message_len The length of the message, in bytes.
+ * @param[out] signature A buffer to hold the signature, see picnic_sign().
+ * @param[in,out] signature_len The length of the provided signature buffer.
+ * On success, this is set to the number of bytes written to the signature buffer.
+ *
+ * @return Returns 0 for success, or a nonzero value indicating an error.
+ *
+ * @see picnic_presign()
+ */
+PICNIC_EXPORT int PICNIC_CALLING_CONVENTION
+picnic_sign_presigned(const picnic_privatekey_t* sk, void* presign, size_t presign_len,
+                      const uint8_t* message, size_t message_len, uint8_t* signature,
+                      size_t* signature_len);
+
 /**
  * Verification function.
  * Verifies a signature is valid with respect to a public key and message.
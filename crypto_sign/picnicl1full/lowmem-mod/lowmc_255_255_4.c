@@ -0,0 +1,3664 @@
+
+#include <stddef.h>
+
+#include "lowmc_255_255_4.h"
+
+static const mzd_local_t L_0[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0xb03b6f3ce10531ba), UINT64_C(0x7aaa352163fa29c4), UINT64_C(0x816ce4925e91153a), UINT64_C(0x2b92c85196fca5fa) }},
+  {{ UINT64_C(0x12706c4dadea2d0c), UINT64_C(0xe3ab31e8f0b4c880), UINT64_C(0xee9e16334196fe31), UINT64_C(0x83626951677f9dda) }},
+  {{ UINT64_C(0x7c9984193b5ddb06), UINT64_C(0xcd8aed4116c7ee9a), UINT64_C(0xf62257add0e395a3), UINT64_C(0x6c12daa60528234e) }},
+  {{ UINT64_C(0xc034b092d767474a), UINT64_C(0xa023b66ca077d3e0), UINT64_C(0x37f78a8ac337953b), UINT64_C(0xc8f59cf4fd233c7b) }},
+  {{ UINT64_C(0xb764f03852153542), UINT64_C(0xb24783788fe189d5), UINT64_C(0x577c83f7a03c1c35), UINT64_C(0x730c9dbaadd7eb11) }},
+  {{ UINT64_C(0x2b489d25e9fa08c2), UINT64_C(0x69c38cc6712f5026), UINT64_C(0x4c611d6588c09e8e), UINT64_C(0xfec74fab8a2ce225) }},
+  {{ UINT64_C(0xb4e093a1fd545bb0), UINT64_C(0x6020ee668e2c0fff), UINT64_C(0x3a0e888c03857709), UINT64_C(0x64c64ad0f93871af) }},
+  {{ UINT64_C(0x9b1574ce7cac56ca), UINT64_C(0xa42ec7ed0f31ca1e), UINT64_C(0x02de9d6aa59d3ce6), UINT64_C(0x8b3f4fe7d1f0f45f) }},
+  {{ UINT64_C(0x55befb22c6b439e0), UINT64_C(0xa82f84a274984410), UINT64_C(0x24863e4d3e054d4c), UINT64_C(0xd8a15272677b0970) }},
+  {{ UINT64_C(0x048c0700bb3f6fb2), UINT64_C(0x907ff1402af67686), UINT64_C(0x549445b6338a76e8), UINT64_C(0x4f723d1e94f27700) }},
+  {{ UINT64_C(0x91fb1568d874467e), UINT64_C(0xd6267b5f288f2c18), UINT64_C(0xb595eaff1fb95066), UINT64_C(0xa655233b0e485034) }},
+  {{ UINT64_C(0x19dfced1d3e33824), UINT64_C(0x54d7e12a4018f715), UINT64_C(0x4c1f25cded337796), UINT64_C(0x9b8eb48ad8316f51) }},
+  {{ UINT64_C(0xeb5b01b0d84f6dee), UINT64_C(0x91f08a753b8bba77), UINT64_C(0x1b4be38be24d3c47), UINT64_C(0xcda0d274d20b3ba9) }},
+  {{ UINT64_C(0x5daa0bf3665bf0d4), UINT64_C(0xce475bda9a262fee), UINT64_C(0xdb677d3dda00314e), UINT64_C(0x27eaf9fba375485a) }},
+  {{ UINT64_C(0x8ccd2ca944457626), UINT64_C(0xd2fecc51e2e9446d), UINT64_C(0x0e3ecb1156dfb7ab), UINT64_C(0x3facae990f879852) }},
+  {{ UINT64_C(0x712254faef761e4c), UINT64_C(0x514a038189c70a19), UINT64_C(0x17dd98bbc46737b4), UINT64_C(0x31a8fafd9457fd6d) }},
+  {{ UINT64_C(0xd02c501a2959c8a6), UINT64_C(0x990d4d1cba79a787), UINT64_C(0xd583fbac11a418ab), UINT64_C(0x29b97c81c6e01789) }},
+  {{ UINT64_C(0x5c2c97d34a017858), UINT64_C(0x1647e92b55573954), UINT64_C(0x4e527f047cb8e328), UINT64_C(0xbea724aee70efe35) }},
+  {{ UINT64_C(0x01f47506a9413d60), UINT64_C(0xbf39179ce5737991), UINT64_C(0x51c2ffc8f4a8a071), UINT64_C(0xbb59ae51afd8c830) }},
+  {{ UINT64_C(0xd4975b9f50ac65aa), UINT64_C(0xaeaaedf90cc53d5d), UINT64_C(0xe715c5a43fe5281e), UINT64_C(0x2576ab2b73129121) }},
+  {{ UINT64_C(0x06a87f9dc01ac924), UINT64_C(0xfd6a276ab0039268), UINT64_C(0xec4e32112f6551c5), UINT64_C(0x5fef355cbcbb9ff6) }},
+  {{ UINT64_C(0x71c5878b2a5ad472), UINT64_C(0x688c054af18904d4), UINT64_C(0x7b13539b95b2963c), UINT64_C(0x8b28e388a4384581) }},
+  {{ UINT64_C(0x0b6b938397c5cd24), UINT64_C(0x001458df434ac03b), UINT64_C(0x5c4b19b002139f3b), UINT64_C(0xdaee3f58c2644579) }},
+  {{ UINT64_C(0x3c05f393dc638ccc), UINT64_C(0xb003efc13ab0d894), UINT64_C(0x07435ef510239aaa), UINT64_C(0x7d23e2260a058b41) }},
+  {{ UINT64_C(0x7611e067163ada02), UINT64_C(0x6ee42a6fcec8aece), UINT64_C(0xef879a190ec90907), UINT64_C(0x36cd0867fd18c150) }},
+  {{ UINT64_C(0x9594bab45e0d1470), UINT64_C(0xabfe9e057dfa1a7c), UINT64_C(0x58971a8f57b12edf), UINT64_C(0x59326a2180efbdae) }},
+  {{ UINT64_C(0x9943e75bc1ea8d30), UINT64_C(0xfeea37e4181bb161), UINT64_C(0x2b5cd00d9591744f), UINT64_C(0xef97b1a6c7359562) }},
+  {{ UINT64_C(0x9f82be7f571329f6), UINT64_C(0xcfebdd9de70e82f8), UINT64_C(0xfa3929bec25ffdea), UINT64_C(0xee3fe583666f9d5d) }},
+  {{ UINT64_C(0xadc94a5db61a6728), UINT64_C(0x42ef6c097cfc66fd), UINT64_C(0xbdd650f491862e3f), UINT64_C(0xbc07b970076ec775) }},
+  {{ UINT64_C(0x1d9759b0c0413b04), UINT64_C(0xcef752074f92594c), UINT64_C(0xa0d6416f5a2a84fa), UINT64_C(0x5931ce5082c8f12a) }},
+  {{ UINT64_C(0x2c969589ed29747e), UINT64_C(0xe99568adfe5325ca), UINT64_C(0x135451608219729d), UINT64_C(0x8d5c010937b481ca) }},
+  {{ UINT64_C(0xbca70635e5bb5894), UINT64_C(0xdfb9e8ff149d4013), UINT64_C(0x8229f582adc7daf1), UINT64_C(0x658cd82dc3117216) }},
+  {{ UINT64_C(0xc3c84fa1cd752976), UINT64_C(0x8d6c9ef6bf0ad176), UINT64_C(0x01bab126a4e4685f), UINT64_C(0x331d71dafe2ce519) }},
+  {{ UINT64_C(0x6c8d6dcb7b10e050), UINT64_C(0x93756e8f806f1ea4), UINT64_C(0xaf404373b3ef448e), UINT64_C(0x871104a09de2a4e1) }},
+  {{ UINT64_C(0xec3bcc565ba647ea), UINT64_C(0x9e00f0bb797780fd), UINT64_C(0xabf085eb74152dd7), UINT64_C(0xa1a25eaa2c0633ec) }},
+  {{ UINT64_C(0xc054ed93a123ba0c), UINT64_C(0x6ff97472c42c7e4c), UINT64_C(0xc427e11a5024de46), UINT64_C(0x753d7dfe2cdac1d7) }},
+  {{ UINT64_C(0xbee0ce8b28bacdca), UINT64_C(0x83817160b92f7f8b), UINT64_C(0xf73b2ac409f24a09), UINT64_C(0x38203a70f91679d1) }},
+  {{ UINT64_C(0x4d24865de958b30e), UINT64_C(0x02ed8103477b88e2), UINT64_C(0x0b064a4dc518e6d2), UINT64_C(0x4bd75f34566acd25) }},
+  {{ UINT64_C(0x57b2bfb1158ced98), UINT64_C(0x0c8e630fbb630dbd), UINT64_C(0xfaf03ba27b336282), UINT64_C(0xc535d0dfb6741abd) }},
+  {{ UINT64_C(0xcb5fecb35cd95bee), UINT64_C(0x969dc5c80472fb65), UINT64_C(0x42419732450d9279), UINT64_C(0x62f085b7fe1709a5) }},
+  {{ UINT64_C(0x4e7d3521152f85a0), UINT64_C(0xda2578e7c2d0deda), UINT64_C(0xe76eb10d15053dff), UINT64_C(0x20e2bcf4486a5343) }},
+  {{ UINT64_C(0x91a215385e8d997a), UINT64_C(0x4bfc230210208a4b), UINT64_C(0xc3aeb6fc50f13427), UINT64_C(0x632d4e06cc1a8b73) }},
+  {{ UINT64_C(0x06b67ee9939fb6ce), UINT64_C(0x7a51ef46e7fec7ae), UINT64_C(0x1a1a3d0534ea3335), UINT64_C(0x6dd4377537c1a905) }},
+  {{ UINT64_C(0x8fcf67d4eac27ed2), UINT64_C(0xc1428f3cb0208008), UINT64_C(0xd5ba788e31543446), UINT64_C(0x28b4eb7300e7d0c9) }},
+  {{ UINT64_C(0x58beae7593ba796e), UINT64_C(0x20846f2f781341cb), UINT64_C(0x592cc911e0044198), UINT64_C(0xd62ccde81b453d30) }},
+  {{ UINT64_C(0xc19769013df1f8c8), UINT64_C(0x850f3529732d58c7), UINT64_C(0xe6c41edfdebe4999), UINT64_C(0xcb6110e9063a73d9) }},
+  {{ UINT64_C(0xe4d648a05ba0a0ea), UINT64_C(0x95cdbdc4cf1c73cc), UINT64_C(0x48b872f4c115569a), UINT64_C(0x751f3bc1dbe441bf) }},
+  {{ UINT64_C(0xf0af0807ee7d6354), UINT64_C(0x279f65f7e560f2e1), UINT64_C(0xcdc63d11f5e1d629), UINT64_C(0x0974be6362ec58c1) }},
+  {{ UINT64_C(0xe13ea642dca18c18), UINT64_C(0x886f4646cf85fe9a), UINT64_C(0x93148e2523fea949), UINT64_C(0xbd67522b28cc4e5f) }},
+  {{ UINT64_C(0x562070fb39bda826), UINT64_C(0x5042ca48346f8207), UINT64_C(0x1e5345131a5bb0f7), UINT64_C(0xc28077b11c13d71a) }},
+  {{ UINT64_C(0x6689bb94b94ffa8c), UINT64_C(0xaab39336577f469b), UINT64_C(0x8ec7b9a59a4c1a94), UINT64_C(0xf88fdb042a549ae3) }},
+  {{ UINT64_C(0x5ca767e40a83bee4), UINT64_C(0x14bc92c266997d6b), UINT64_C(0x0d21101f6cf89b9a), UINT64_C(0xe9a4e5b9e7188e2d) }},
+  {{ UINT64_C(0x0a24e70f8a0a2948), UINT64_C(0x80667b539c7cfba2), UINT64_C(0xb6553ffcf886240c), UINT64_C(0x62b3af453bb40da8) }},
+  {{ UINT64_C(0x1870f202bc032db0), UINT64_C(0x340101e94f87b2c5), UINT64_C(0x31a00bf4a01f6fd3), UINT64_C(0xde8073742a9af41f) }},
+  {{ UINT64_C(0xc734b9f99047f5f2), UINT64_C(0x1463d61e5e947c2a), UINT64_C(0x347427137ef68fb9), UINT64_C(0xc3f2bc4340e31163) }},
+  {{ UINT64_C(0x501cbad3d74f84be), UINT64_C(0x236d3b9e7a2657a0), UINT64_C(0xfafea4fa96f9bc07), UINT64_C(0x037e3ef67420e0da) }},
+  {{ UINT64_C(0x21173ba28f94c7d6), UINT64_C(0x1ec96f698c250e3d), UINT64_C(0x18c882d3a84b1e8f), UINT64_C(0xa5db5163dd6a0318) }},
+  {{ UINT64_C(0x001f959a52b7a190), UINT64_C(0x4d99f58f7e67f632), UINT64_C(0xb1ef35e8945ed237), UINT64_C(0x06cbd05a4c7855e1) }},
+  {{ UINT64_C(0x8e8b922d617bee44), UINT64_C(0xaeed98695d6d5c28), UINT64_C(0x12ecceda1675601b), UINT64_C(0x714e474bccfa5278) }},
+  {{ UINT64_C(0x99b8ca231a8ed33e), UINT64_C(0xae30a315622b70ea), UINT64_C(0xb9d1a2c574df1bd0), UINT64_C(0x18ef87fd8dbb93dd) }},
+  {{ UINT64_C(0x08fc4ce94a103a10), UINT64_C(0xc897d33c9c3dd0a5), UINT64_C(0x7d90ba0abf94910c), UINT64_C(0xe91111836d47571a) }},
+  {{ UINT64_C(0x1ae3520099b98324), UINT64_C(0xef1e9e07ee125060), UINT64_C(0xbfd6814261ee3911), UINT64_C(0x87827367faf6f2d9) }},
+  {{ UINT64_C(0xfa4b774af6006c78), UINT64_C(0x3a8fd332c33a1e57), UINT64_C(0x31a053ae74b481cf), UINT64_C(0x0fb69d7ae4ee0fb0) }},
+  {{ UINT64_C(0xef7dcd02b76793f6), UINT64_C(0x30335e5795b0db12), UINT64_C(0xa73117ebce746f12), UINT64_C(0xc91813bc638f2f91) }},
+  {{ UINT64_C(0x4a20e626408fd39a), UINT64_C(0x8f833563ae44694e), UINT64_C(0xb2e9abfb83aa4d08), UINT64_C(0xbe0a2f255dd3e7bd) }},
+  {{ UINT64_C(0x42915d0dafeffd2c), UINT64_C(0x89782670c65ae50b), UINT64_C(0x9c9231626ed3bea9), UINT64_C(0xccc488178df8ba40) }},
+  {{ UINT64_C(0x50623a08b6559b36), UINT64_C(0xd8b8d3e8fbdd0f96), UINT64_C(0xa40c0182fa3ede51), UINT64_C(0x6d2e6e78a9ef2ed3) }},
+  {{ UINT64_C(0x473c6ac4eb691906), UINT64_C(0x91db4bdfe3d39808), UINT64_C(0x79e692435d114f88), UINT64_C(0x2799a2d0e303d5e9) }},
+  {{ UINT64_C(0x5723ec98eaf2db18), UINT64_C(0xfe9a0f453cd5d6ed), UINT64_C(0x91dbb3a1674b1c5b), UINT64_C(0x5aa1743a03dcb948) }},
+  {{ UINT64_C(0x9881e9579829ae2c), UINT64_C(0x61fee8509b120bd8), UINT64_C(0x397cb6408b617414), UINT64_C(0xfb207404b7b7ea7b) }},
+  {{ UINT64_C(0x279be4bf042ebf68), UINT64_C(0x73c845bff98adede), UINT64_C(0x8354ae04821fe615), UINT64_C(0xb88979c0032e41dc) }},
+  {{ UINT64_C(0x3f0c7f026e5b46d6), UINT64_C(0xcbd5d35f5a825f9c), UINT64_C(0xe44f113f6da9673d), UINT64_C(0xb10dccd5d37380f6) }},
+  {{ UINT64_C(0x330adb43587072a4), UINT64_C(0x03fb118c3f653183), UINT64_C(0x4af7253462b2c31f), UINT64_C(0xd789b9ef8cb2cdb5) }},
+  {{ UINT64_C(0x31c008d642e0603e), UINT64_C(0xb19757d2c9448a77), UINT64_C(0x3976abe9a678fefa), UINT64_C(0x12b17a0f73d27d82) }},
+  {{ UINT64_C(0xb20e8db15ab92104), UINT64_C(0x2e8f493d47a9fe4e), UINT64_C(0x179c5ab17b4c2018), UINT64_C(0xf5f9fe4970898bef) }},
+  {{ UINT64_C(0x9904d5811a82b8a6), UINT64_C(0x39acd3354c19be0c), UINT64_C(0xbb611d1de09cb129), UINT64_C(0xdd90b331c6d8a4b8) }},
+  {{ UINT64_C(0xdd4be5f3012a2040), UINT64_C(0x76a6342afc929159), UINT64_C(0x192cac60afd91120), UINT64_C(0x316ba7c88594d910) }},
+  {{ UINT64_C(0x81e07aeb45be2aa4), UINT64_C(0x4971d9428865e9d3), UINT64_C(0xc2303cc7e80eb5ad), UINT64_C(0xdcc9c5432aabe1e0) }},
+  {{ UINT64_C(0x0ac0c76f6185bc32), UINT64_C(0x70aaba95caaaf2b8), UINT64_C(0xfdef99526fa7dd3c), UINT64_C(0x9c6744cc63759db3) }},
+  {{ UINT64_C(0x5e8d9efc6b7de3de), UINT64_C(0xbac96ecf8513f0c5), UINT64_C(0x086e753121d38dd0), UINT64_C(0xe6c8ed46401eb9a5) }},
+  {{ UINT64_C(0x49392d6087cabab6), UINT64_C(0x9d2e339df30c8fd5), UINT64_C(0x045a3c6858c27d38), UINT64_C(0x5201c7d59ee100d2) }},
+  {{ UINT64_C(0x350819385246a330), UINT64_C(0x500bd95095bb9b63), UINT64_C(0xf87531960641a3e9), UINT64_C(0x82d79f341a6c2b30) }},
+  {{ UINT64_C(0x0a67568faba63272), UINT64_C(0x21ffaf2f5e76ad0c), UINT64_C(0x1e2310474c0ba878), UINT64_C(0xaa5c80a6e60b371a) }},
+  {{ UINT64_C(0xc9cec9966e2fc59e), UINT64_C(0x140bb11451d8d55a), UINT64_C(0xde31fdb2d126bc96), UINT64_C(0x7e82b1b8e0206587) }},
+  {{ UINT64_C(0xc8fe06ea923b2d8e), UINT64_C(0x43e87170b3df6e34), UINT64_C(0x428a703b9f3bc763), UINT64_C(0x6cee8b55191bfbaf) }},
+  {{ UINT64_C(0x6930ddf7b01bdaf8), UINT64_C(0x92de74341995ca5b), UINT64_C(0xcc395b03fa50be13), UINT64_C(0xc9835a2f92e7973f) }},
+  {{ UINT64_C(0x3511bcf99fdddf22), UINT64_C(0xfcad096ea159f960), UINT64_C(0x4a09b0268ad91de8), UINT64_C(0x8fede8ad52d4ed6c) }},
+  {{ UINT64_C(0x95d2104b0edeeb26), UINT64_C(0xd812c88fd5ae8317), UINT64_C(0xf0faffbd27d0f336), UINT64_C(0xd1dfae10664f2ab3) }},
+  {{ UINT64_C(0x54b59403b646d9a6), UINT64_C(0x2dd06501a7b287dc), UINT64_C(0xd9c95be0561d3578), UINT64_C(0x9cd4c0bc67c7f174) }},
+  {{ UINT64_C(0xa60f9bb282eb93c2), UINT64_C(0xcb6cdc08470e081c), UINT64_C(0x8c7d606c869f11e5), UINT64_C(0xad027547f828f456) }},
+  {{ UINT64_C(0xa224b5ab54c0e636), UINT64_C(0x5f65f26e53eb5092), UINT64_C(0x88dd06ed59d7203c), UINT64_C(0x2527d799c09aa266) }},
+  {{ UINT64_C(0xf5e06aef181620ec), UINT64_C(0xf1716b79c09bada6), UINT64_C(0xb86b5bebcb387701), UINT64_C(0x6de4a4dac4eeb2f8) }},
+  {{ UINT64_C(0x662e7567e82f9a58), UINT64_C(0xff1946d5d9fd8074), UINT64_C(0x60f9f84035b9db9c), UINT64_C(0x2262d9965397e622) }},
+  {{ UINT64_C(0xc9aada2ff8169bd8), UINT64_C(0x8a39ffa06c9e47b2), UINT64_C(0x1fbda626647378ae), UINT64_C(0x24ad57dd4973e20c) }},
+  {{ UINT64_C(0x959d05dc766de708), UINT64_C(0xa7a800faddef348d), UINT64_C(0xd4bd253081779902), UINT64_C(0x5fc091a5f3e74fc0) }},
+  {{ UINT64_C(0x391c51e8166b1c32), UINT64_C(0x6089e98bba5cab24), UINT64_C(0x3cb27a1a5f7e7189), UINT64_C(0xf589ad7732155fd5) }},
+  {{ UINT64_C(0x55c6b7f95437ff94), UINT64_C(0x5dea13f369a992e6), UINT64_C(0xc65c9bc1da397a45), UINT64_C(0xaff8b074939cdbf6) }},
+  {{ UINT64_C(0x1d6693dff4711878), UINT64_C(0xd0a2d5a02e1adb64), UINT64_C(0x816b0402cf7c7392), UINT64_C(0xb04ad624aeb5c268) }},
+  {{ UINT64_C(0x5df7f4dc06565c50), UINT64_C(0xefc3efceed11429b), UINT64_C(0x610a776546f6089b), UINT64_C(0xab18aaedb24f530f) }},
+  {{ UINT64_C(0x24fa54561e4fe53e), UINT64_C(0x4c389951340c008e), UINT64_C(0x32c6e9d1e69477cd), UINT64_C(0xfcca9a267504ca4d) }},
+  {{ UINT64_C(0xffeadb9dfdb765fa), UINT64_C(0xb2aa8c470a49c195), UINT64_C(0x2c0989eab0214f30), UINT64_C(0x919cf1b97626e699) }},
+  {{ UINT64_C(0xea8bef2224d133ba), UINT64_C(0x326bd12ccf8cae18), UINT64_C(0x472ed5fe9e2f1b28), UINT64_C(0xfc7deed9b5b1011f) }},
+  {{ UINT64_C(0xdadc1e3b578ac004), UINT64_C(0x4444a3fb2ebdc5f9), UINT64_C(0x1435a022bbc2aa71), UINT64_C(0xb2c7e7d3aeefc0f6) }},
+  {{ UINT64_C(0x80eb13e378587af6), UINT64_C(0x42a69d6423661644), UINT64_C(0xcf1f1cc7f10200ed), UINT64_C(0xcc5d439c004baae2) }},
+  {{ UINT64_C(0x063fa1be68065476), UINT64_C(0x0dbf9c16fbbc5051), UINT64_C(0xae6b4c0c7d32ee2a), UINT64_C(0xae739d9686cffb72) }},
+  {{ UINT64_C(0x85d72b3a91678506), UINT64_C(0x6901772d8100a9f7), UINT64_C(0xaf21e38722197d7c), UINT64_C(0x7e6757ee74e0411d) }},
+  {{ UINT64_C(0x2f1bf7397c9aa204), UINT64_C(0x1ab5aa8e83a000e3), UINT64_C(0xb0b16df723a3dd9c), UINT64_C(0x31b467b6ba9e9035) }},
+  {{ UINT64_C(0xeb604dc7411a560e), UINT64_C(0x3f5efb5b257836e2), UINT64_C(0x8e01538ad5a8bba2), UINT64_C(0x4b0faecfa0357dfe) }},
+  {{ UINT64_C(0xd8e74620d35aee98), UINT64_C(0x13b95bea70eb3c09), UINT64_C(0x615085b5665e5083), UINT64_C(0xf85f7b854f6b2e6b) }},
+  {{ UINT64_C(0x5046ef59e04e274c), UINT64_C(0x337b61829b0dc185), UINT64_C(0xddecd6e7398baf2a), UINT64_C(0x962184e292c6ae1e) }},
+  {{ UINT64_C(0x51000c26f7d18ab4), UINT64_C(0xac2b43b53cbfd134), UINT64_C(0xe591884848645186), UINT64_C(0x95215fff40f4af53) }},
+  {{ UINT64_C(0x01581ead6c014d48), UINT64_C(0xf20007eb388c6dc2), UINT64_C(0x8f1581cfa275ee52), UINT64_C(0x5897f460d18d96bf) }},
+  {{ UINT64_C(0xa368b859869321ec), UINT64_C(0x146852910597aa54), UINT64_C(0x07ad350ce309ae31), UINT64_C(0x8b8b6c72c7ff7a07) }},
+  {{ UINT64_C(0x3f4755aa81ed669c), UINT64_C(0x42cd95f72c56f0ff), UINT64_C(0x167d5dc25622c0c9), UINT64_C(0xb164399e4e7b7420) }},
+  {{ UINT64_C(0xfc39ccba4178d358), UINT64_C(0xa35af1cfbfc1fe7c), UINT64_C(0x1b97139f3fbce267), UINT64_C(0x2da984b0d1bbda88) }},
+  {{ UINT64_C(0xfdbf85418515f2de), UINT64_C(0xf63c351229689ae2), UINT64_C(0x8f1e8e043955020a), UINT64_C(0x337c18c0b82bc566) }},
+  {{ UINT64_C(0x82379a29e6de21fe), UINT64_C(0x21717e1f5814f443), UINT64_C(0x3bccf50e4a0a8cee), UINT64_C(0x42f8548b6c7a696f) }},
+  {{ UINT64_C(0x2f322f7f5b4461a2), UINT64_C(0x7a026613ed655de8), UINT64_C(0xeace271262c03e9e), UINT64_C(0x1a6a21abf033ecb3) }},
+  {{ UINT64_C(0x1267bad0746c2208), UINT64_C(0x55f09c4aa767d584), UINT64_C(0xa2af57bb761befd7), UINT64_C(0x0d56a3598df849a6) }},
+  {{ UINT64_C(0x7463a008e771ca18), UINT64_C(0xc1015650a9da666b), UINT64_C(0x78625293012c60f5), UINT64_C(0x6bf73c3beef2e503) }},
+  {{ UINT64_C(0xd0822ed50ec9f370), UINT64_C(0xbb02c77db74958af), UINT64_C(0x066e023c0b1fbb7e), UINT64_C(0xa853cd90f8f4342a) }},
+  {{ UINT64_C(0xc95930b8622cf650), UINT64_C(0xd87d4cabdc2eab9b), UINT64_C(0xd6d8821420efa7ce), UINT64_C(0x61fa93a58f33e836) }},
+  {{ UINT64_C(0xb3276f0cccf99330), UINT64_C(0x4e11303b8c0573b9), UINT64_C(0x7645bce1d8a473ce), UINT64_C(0x476a7e8a69ee3dab) }},
+  {{ UINT64_C(0x43d73a4fb139f4ee), UINT64_C(0xade44861ed2a0490), UINT64_C(0xdf45a2415408cc7a), UINT64_C(0x6acb239275216134) }},
+  {{ UINT64_C(0x582e23313d3b7346), UINT64_C(0x63d09fdfe3568115), UINT64_C(0x67df48ec0b2fc47f), UINT64_C(0x7f62a6f8548e6421) }},
+  {{ UINT64_C(0xd430eca1640aac5e), UINT64_C(0xf633e4f6d2a42ee9), UINT64_C(0x001ba49130866c9c), UINT64_C(0xe9a85d83890eead2) }},
+  {{ UINT64_C(0x5bb2baac6090faea), UINT64_C(0x7ac92daaffae519e), UINT64_C(0x521a17a3e3a09bc9), UINT64_C(0xaa00f0fbc47a6957) }},
+  {{ UINT64_C(0x5e1f7d38ef516e62), UINT64_C(0xd5603403279a5585), UINT64_C(0x5fad4feba4c215c2), UINT64_C(0xad5d6572ac2fe294) }},
+  {{ UINT64_C(0xdbd295003caa1108), UINT64_C(0xebf9fafb8d85b1d5), UINT64_C(0x20bb413ad4cded5d), UINT64_C(0xb7f59b70d5703943) }},
+  {{ UINT64_C(0xdc2e194e8339a6d0), UINT64_C(0x0deec425488db83c), UINT64_C(0x7a7455dc6c496aef), UINT64_C(0x2e9cc04eea5fb583) }},
+  {{ UINT64_C(0x7037dc3396e874fc), UINT64_C(0x0b885868e30ab6a7), UINT64_C(0xb5bb505b8f28b84e), UINT64_C(0xe781f6b82455d80b) }},
+  {{ UINT64_C(0xbb00d48577210a66), UINT64_C(0x5827e11471ff320a), UINT64_C(0x32177abdad52dafc), UINT64_C(0x533b94ba3df593b6) }},
+  {{ UINT64_C(0xacc63824f1e9cfd6), UINT64_C(0xdc570cddefecbc3b), UINT64_C(0xef0664fd883bcb3f), UINT64_C(0xc5cc5dd8157ef2d7) }},
+  {{ UINT64_C(0x5ad2bdf7a310995c), UINT64_C(0x549ff0558c2b95de), UINT64_C(0xf1cb3437d9396044), UINT64_C(0x7af1b13903315492) }},
+  {{ UINT64_C(0x6180ae158176bde0), UINT64_C(0xa271e58d59665a17), UINT64_C(0x7d4e398d34cd3194), UINT64_C(0x26efe14606df3d98) }},
+  {{ UINT64_C(0x82d0866c1b28c046), UINT64_C(0xdc2c00519db3563c), UINT64_C(0xe626f963483f4974), UINT64_C(0xa993c6b8f32344f2) }},
+  {{ UINT64_C(0xe94a7070f40c498e), UINT64_C(0x4009f29da24cc239), UINT64_C(0x4557e1d6e3ccca4f), UINT64_C(0x92356ca9a05f2462) }},
+  {{ UINT64_C(0x2809264222fd934e), UINT64_C(0xa042bf493b98c840), UINT64_C(0xd44f2143a97f24eb), UINT64_C(0x099665dfd9ca1127) }},
+  {{ UINT64_C(0x9ec35bfed62ded22), UINT64_C(0x4dc06d317e310b16), UINT64_C(0x34c5715b5adcef10), UINT64_C(0x54a2ec0a0ef741cb) }},
+  {{ UINT64_C(0x2bbff3086ffa6880), UINT64_C(0x3e704afca235aa9f), UINT64_C(0x405881d46a7fa032), UINT64_C(0x239a0f93eec6e720) }},
+  {{ UINT64_C(0x3badb1f434f8e210), UINT64_C(0x8e6c582fb87a1fb1), UINT64_C(0x990a10972a1eefd4), UINT64_C(0x05994387a20a39c5) }},
+  {{ UINT64_C(0x6bc4204564f8b0da), UINT64_C(0x5e9f85f9950d2572), UINT64_C(0x830ba3af21f6a61e), UINT64_C(0x3ac7d00430dbd8f0) }},
+  {{ UINT64_C(0xcaca5be98657e546), UINT64_C(0x56268bcf6ac9a300), UINT64_C(0x137a344681a4bf43), UINT64_C(0x5e310bd7ea8fab09) }},
+  {{ UINT64_C(0x51745cf651cd5a3a), UINT64_C(0x393e0d9bab8d7737), UINT64_C(0x5eff7d8736eb8c59), UINT64_C(0x4f1c2871bd3c0e52) }},
+  {{ UINT64_C(0xf6862616a598b9c0), UINT64_C(0xd7fe037b8080915b), UINT64_C(0x55155c91f96c8bfb), UINT64_C(0x8f8086c41458b75c) }},
+  {{ UINT64_C(0xff6b62122dc41cb0), UINT64_C(0xc4ea821cd529d401), UINT64_C(0x90a0606af5390340), UINT64_C(0xdb8db63fce7f1ce0) }},
+  {{ UINT64_C(0x7ed49028bb91c5fa), UINT64_C(0x40c329ebda13ccb9), UINT64_C(0x35c8db3aa173f3a9), UINT64_C(0x1341578da6812d02) }},
+  {{ UINT64_C(0x2c845fab497a65ae), UINT64_C(0x0370f0e443eac519), UINT64_C(0xa0c71c771593638e), UINT64_C(0x57f77f99a337254e) }},
+  {{ UINT64_C(0x6fdb5b6d4330178a), UINT64_C(0x2477779931a2149d), UINT64_C(0x41eaf69471d40b8d), UINT64_C(0xe0be42c636390716) }},
+  {{ UINT64_C(0x0df7b90e6dd2633e), UINT64_C(0x2f886075c780f969), UINT64_C(0x6b6bf4237c004685), UINT64_C(0xe3118e9f5513b8a5) }},
+  {{ UINT64_C(0x62ef03af5675c9a4), UINT64_C(0x532d72e0e7b3ade9), UINT64_C(0x13efb95a1b291776), UINT64_C(0xdd5141389fac9d5b) }},
+  {{ UINT64_C(0xe6949ba0c4efc35e), UINT64_C(0xb6ccec7741fd730e), UINT64_C(0x7e40df0969e60b8d), UINT64_C(0x0951c8b066062a8d) }},
+  {{ UINT64_C(0x41d7e9825fb1fe70), UINT64_C(0x9bb84371e1837c80), UINT64_C(0xa86f8780f8fc4151), UINT64_C(0xe83da08b9f5ca870) }},
+  {{ UINT64_C(0x0b811d13413e8d1e), UINT64_C(0xefd48f90ad986a57), UINT64_C(0xf3cf9d3bd89a00ab), UINT64_C(0x0c5518a675f73332) }},
+  {{ UINT64_C(0x9bd53e6e685a10fc), UINT64_C(0x7d276bb8ea86b042), UINT64_C(0x4ddab6c319eec194), UINT64_C(0x1f358aa11d8334ee) }},
+  {{ UINT64_C(0x20275904e33bc4d6), UINT64_C(0xf25bcb9f0d9f5923), UINT64_C(0xedc02a6e313ffb9b), UINT64_C(0x72f30e7f3a2d3f90) }},
+  {{ UINT64_C(0x97f864f778559a40), UINT64_C(0x19efc69cd5228905), UINT64_C(0xb6d473c0003e7a01), UINT64_C(0x35c2a38aab60ec72) }},
+  {{ UINT64_C(0x20ffec81a67b0b98), UINT64_C(0x5a8d3114ecef229a), UINT64_C(0x90c3299f9586526a), UINT64_C(0x0910c2f26b2fab01) }},
+  {{ UINT64_C(0xc7b415e72b1b29bc), UINT64_C(0x8cfaf38ef002e7bc), UINT64_C(0xcb391966ab134718), UINT64_C(0x6e62ab9f025117ba) }},
+  {{ UINT64_C(0x9969835f256347c6), UINT64_C(0xdcb28078a17d8aec), UINT64_C(0xd430635c13966fba), UINT64_C(0xd47eab2929def42c) }},
+  {{ UINT64_C(0x9b089b9a5b6bf590), UINT64_C(0xb5cf8ba57db5ca59), UINT64_C(0x3126ff7e12ea3076), UINT64_C(0xfa1e4e30ba1b8db6) }},
+  {{ UINT64_C(0x064c315ac83647d0), UINT64_C(0x3c43176acfe49596), UINT64_C(0x30d92e0e7a1ded96), UINT64_C(0x8d861129a1089eba) }},
+  {{ UINT64_C(0x165f18e10d0444dc), UINT64_C(0x1303593b3f669388), UINT64_C(0x1637b04f323e83aa), UINT64_C(0x57856647a733f951) }},
+  {{ UINT64_C(0x7348c46f20327dfa), UINT64_C(0x75cd82d2fb454407), UINT64_C(0x02492e018c69cfa3), UINT64_C(0x0c2016d22ac7439e) }},
+  {{ UINT64_C(0xd8847c0b82915878), UINT64_C(0xad5bc9319a49e052), UINT64_C(0xf71ae05ff8143d9d), UINT64_C(0xfb0fc7d14d7a0592) }},
+  {{ UINT64_C(0x50dff9c9fe58d97c), UINT64_C(0xbe6c2476ac669bbe), UINT64_C(0xfea9d300f668c1e9), UINT64_C(0x72e60cd03aa1ed5d) }},
+  {{ UINT64_C(0xe97edf096df738c2), UINT64_C(0xab34e17f50183bbf), UINT64_C(0x4143e13fc735b852), UINT64_C(0x26eb169ded77425c) }},
+  {{ UINT64_C(0xb64914e4aa642068), UINT64_C(0x7dc2b6cd1212feae), UINT64_C(0x2a7a250e513917e3), UINT64_C(0xd9174ee3746a9038) }},
+  {{ UINT64_C(0x37b99516d190d33a), UINT64_C(0x53d4a038f6fa250d), UINT64_C(0xd55ad75b3c074f52), UINT64_C(0x0b7976f7728f5b69) }},
+  {{ UINT64_C(0x7812b0a32fba6404), UINT64_C(0xdff1a30ad9456f34), UINT64_C(0xf091d3cada90e607), UINT64_C(0x86d1aead1e7bbcc4) }},
+  {{ UINT64_C(0x269895c9972553ba), UINT64_C(0x7e5091c23c3fd5b9), UINT64_C(0xd8ce530dad71ca0b), UINT64_C(0xf42b735c2ef6be1f) }},
+  {{ UINT64_C(0xd972a930204e246c), UINT64_C(0x50d863325a57b122), UINT64_C(0x5dcb310de743a5e0), UINT64_C(0x9d42e5d8acce1e59) }},
+  {{ UINT64_C(0x4bc88a6f4903b6de), UINT64_C(0x1e91d8544d21837d), UINT64_C(0xf2f60fcadb53e9ee), UINT64_C(0xcb953624d639c2eb) }},
+  {{ UINT64_C(0x9c199395e5353292), UINT64_C(0x120c89312e0e7ed2), UINT64_C(0x624f0493f826f0b9), UINT64_C(0x991accdbd65c9be0) }},
+  {{ UINT64_C(0x091e0d5440cf65f8), UINT64_C(0x3dc23412d63689da), UINT64_C(0xdd6bd3352adf1bce), UINT64_C(0x2555f66f2e1f53dc) }},
+  {{ UINT64_C(0x3212420aa061a944), UINT64_C(0x82990b96e39a9827), UINT64_C(0x9a7a555d9e00557a), UINT64_C(0x85b83a8ed7d8ffe8) }},
+  {{ UINT64_C(0x4017dcdf072cb736), UINT64_C(0x43627474bd696df9), UINT64_C(0x3d81587eb7185821), UINT64_C(0x510d02437a84a79e) }},
+  {{ UINT64_C(0x7c4bd252dedfdbbe), UINT64_C(0x5f98b1fd3b4fe02e), UINT64_C(0x64897ea6df807147), UINT64_C(0x11004e9c1a7ed961) }},
+  {{ UINT64_C(0x68ca553d39f8df12), UINT64_C(0xf3e66b3b684b2517), UINT64_C(0x4e039f35e51b2775), UINT64_C(0x25daf9fc8914819d) }},
+  {{ UINT64_C(0x6ff7318a385c7172), UINT64_C(0x5a2e1a3542cf4f73), UINT64_C(0x75c8685a658cceaa), UINT64_C(0xaca50f68dd17e697) }},
+  {{ UINT64_C(0x152828847e909a2e), UINT64_C(0xd5fc7fef323c4ed9), UINT64_C(0x6e8625dfdbc2dd18), UINT64_C(0x71e9e16e68e8f88c) }},
+  {{ UINT64_C(0xb824a0e00c754df6), UINT64_C(0xa01a496bb1de8486), UINT64_C(0x586b99b1ac591770), UINT64_C(0x6aa6b539357c5859) }},
+  {{ UINT64_C(0x3a9e224788c24210), UINT64_C(0xeb95d7f432127233), UINT64_C(0xc3068b80101d2745), UINT64_C(0x931027c6be369152) }},
+  {{ UINT64_C(0x8eb5a9190527aa2c), UINT64_C(0xe9da148baafee291), UINT64_C(0x10bb70fcef1a501e), UINT64_C(0x323ab15c77306d1e) }},
+  {{ UINT64_C(0xf1b9628b37be908a), UINT64_C(0x49ffdf223031ff6c), UINT64_C(0x38fe0fd89546671c), UINT64_C(0xdc7c48fabc314366) }},
+  {{ UINT64_C(0x6dbc65d2308d00f4), UINT64_C(0x8c9c0321120545ba), UINT64_C(0x5f1bfa4364ae87c9), UINT64_C(0x157dc166656fd364) }},
+  {{ UINT64_C(0x46a5ecb81b99365a), UINT64_C(0x1e0455b362b9be14), UINT64_C(0x2c3f92ce8276e285), UINT64_C(0x9f8bb551c8a11be0) }},
+  {{ UINT64_C(0x7c9e783a287eecb0), UINT64_C(0xd4ebefe488005619), UINT64_C(0xe26353e1e38ea18b), UINT64_C(0xf195f6df1fb4192f) }},
+  {{ UINT64_C(0xcf51a9580cd0db22), UINT64_C(0x6cd39729ca5dbfde), UINT64_C(0x7c8e07c98677d4ba), UINT64_C(0xccf2c4cd714e773a) }},
+  {{ UINT64_C(0x477a3f0c57f4d9d0), UINT64_C(0x206e1f6605c5357c), UINT64_C(0x37d172cb118369f5), UINT64_C(0x94387c8895ff01d6) }},
+  {{ UINT64_C(0xa07fa582ec471122), UINT64_C(0x0f7ef80e440c9ea2), UINT64_C(0x04d451c396f83d4c), UINT64_C(0xc17082af26b4618a) }},
+  {{ UINT64_C(0xec42da835f38e8f2), UINT64_C(0x60bbef7ffb4b5b38), UINT64_C(0x5b68c92d88599cd3), UINT64_C(0x5cefd3f0f91329a8) }},
+  {{ UINT64_C(0xa17fd90efd1b1fc6), UINT64_C(0x437a4096467e4fde), UINT64_C(0x9cfc3a7062dc9da9), UINT64_C(0x73292f673021c9fe) }},
+  {{ UINT64_C(0x4fe44b1d962b3ace), UINT64_C(0xe940e131d469efde), UINT64_C(0xd77ea7933867d873), UINT64_C(0x181e2a994f0b8923) }},
+  {{ UINT64_C(0xc17f926a470893c6), UINT64_C(0x90832fe3e031de5a), UINT64_C(0x9ebb2e5f46372563), UINT64_C(0x8c71266dbc03dddf) }},
+  {{ UINT64_C(0x082e3f3f0a79b140), UINT64_C(0x4ea91b688578ebb9), UINT64_C(0x5c2c0cc79b8fd749), UINT64_C(0xf546c3c480d4b04d) }},
+  {{ UINT64_C(0x15bdbceabef16c9a), UINT64_C(0x976cafca720e052c), UINT64_C(0x55ffd624b828acc6), UINT64_C(0x2f58886648fd57f0) }},
+  {{ UINT64_C(0x8ee454523ca2b792), UINT64_C(0xac90c916cb003674), UINT64_C(0x0f796a2762ba1d77), UINT64_C(0xc7a3d567838b32a6) }},
+  {{ UINT64_C(0x902344663bb26622), UINT64_C(0x24696a2444d048a3), UINT64_C(0xd3541b5bb26d5a0d), UINT64_C(0xde4b3253ada37e27) }},
+  {{ UINT64_C(0xbd14471f516b4190), UINT64_C(0x0aa0707b2e08faab), UINT64_C(0xe15e45c4f36e12e2), UINT64_C(0x63f61f10cc03ce5e) }},
+  {{ UINT64_C(0x4111f03627fe64c6), UINT64_C(0xd660cb0370e0e4e3), UINT64_C(0x8f5127151171d955), UINT64_C(0x8ba71fd6dc3c3822) }},
+  {{ UINT64_C(0x64fd738e9d238d90), UINT64_C(0x20198cacabcd1e44), UINT64_C(0x9a2ba402a6ca9aa5), UINT64_C(0x8f5d63a0ae0ed8be) }},
+  {{ UINT64_C(0xde06ece3f9561c6c), UINT64_C(0x1aa5dd8459f7cb23), UINT64_C(0x72ada309ccf56890), UINT64_C(0x8b44e9372aa26f10) }},
+  {{ UINT64_C(0xb45107ca4e7373b0), UINT64_C(0x9dbdf0430a09e385), UINT64_C(0x6abb3de57a562a65), UINT64_C(0x4b562b0ebe6bca0a) }},
+  {{ UINT64_C(0xde3d19601390b98e), UINT64_C(0x7daee9af8814b55a), UINT64_C(0x4ab56ff162860ae7), UINT64_C(0xb0896c817dc93245) }},
+  {{ UINT64_C(0x48340ec56c0c47c2), UINT64_C(0xca02c69fc8d9d253), UINT64_C(0x84d405cc427c7724), UINT64_C(0x4c9d22f9218f85e2) }},
+  {{ UINT64_C(0x48cdcf815da97786), UINT64_C(0x5ced94e8dba8947b), UINT64_C(0xb6c6b510e29c37c5), UINT64_C(0xdacd2429b3e3a64a) }},
+  {{ UINT64_C(0x2133fcafbbf6c8f0), UINT64_C(0x93642c63d676e878), UINT64_C(0xcea8ad0c21b2ed24), UINT64_C(0xaea9c2a548be50e2) }},
+  {{ UINT64_C(0x05cdc155322032a6), UINT64_C(0xfc3d4ddeaa56f015), UINT64_C(0xd3e3fb539e534ce5), UINT64_C(0x92076bf6fa1eb064) }},
+  {{ UINT64_C(0x8984b4c64afe35ae), UINT64_C(0xdd60f17f7fcc36b5), UINT64_C(0x9178dfbed37544c8), UINT64_C(0x19eae067568bac29) }},
+  {{ UINT64_C(0xa166d788554ddbbe), UINT64_C(0x5441089c20e56f34), UINT64_C(0xe5d047024af9fb69), UINT64_C(0x55af54b8be7afaf9) }},
+  {{ UINT64_C(0xe7b9e743620a8c28), UINT64_C(0xafa00217cc0def27), UINT64_C(0x00b776a695865b5d), UINT64_C(0xf737e75331788863) }},
+  {{ UINT64_C(0x5cdc77803bf44648), UINT64_C(0xac2a135941c539a7), UINT64_C(0xf0ed9eb27e32e865), UINT64_C(0x5c68f9971bd44faf) }},
+  {{ UINT64_C(0x974902af381584fc), UINT64_C(0x14a385ead5c636f8), UINT64_C(0x8c61b648a003cdc6), UINT64_C(0xc60e29e849238373) }},
+  {{ UINT64_C(0xdc711a492062fd4c), UINT64_C(0xed40891f033e0581), UINT64_C(0x834096ac7f8485bc), UINT64_C(0xc6f8475446657d0f) }},
+  {{ UINT64_C(0xf95a0d8c1526fe68), UINT64_C(0x5e797a40fa324936), UINT64_C(0x65e93a247501dd15), UINT64_C(0xa013fdd711615d3d) }},
+  {{ UINT64_C(0x71ca6f911fa53926), UINT64_C(0x537de3e1ce9e4404), UINT64_C(0x4f68443158ef5c66), UINT64_C(0x0e2c97dc11ef9829) }},
+  {{ UINT64_C(0x88471bf02d2a3606), UINT64_C(0x7f6d0c8f83a7a64a), UINT64_C(0x01c5e7332ed0aa98), UINT64_C(0x0aa84d3816d3c57b) }},
+  {{ UINT64_C(0x2a67b566d3cad9f2), UINT64_C(0xee9979d6b3797064), UINT64_C(0xc62afde41ae2ef0c), UINT64_C(0x4e122ccfe67f4095) }},
+  {{ UINT64_C(0xff65ebc5d6c3307c), UINT64_C(0x9563cab1fed623d6), UINT64_C(0x233d2daf80b2f61b), UINT64_C(0xde56bf86f743787f) }},
+  {{ UINT64_C(0xf0854468770af570), UINT64_C(0x23733c5373b02f10), UINT64_C(0x58362b09484e26f9), UINT64_C(0x97410db2680d1b2b) }},
+  {{ UINT64_C(0xfd5e34e8cb875602), UINT64_C(0x46f60dd9c9c47f97), UINT64_C(0x9cda218d6243f664), UINT64_C(0x72f19bcfe487d561) }},
+  {{ UINT64_C(0xeb94913435e8fd82), UINT64_C(0xfc5faeb66033bb7a), UINT64_C(0xe414fc943a77a92a), UINT64_C(0xd02c928b1c22bb32) }},
+  {{ UINT64_C(0x212fad31251d390c), UINT64_C(0x7295255c7242a2bb), UINT64_C(0x4686fdf0ae1abba8), UINT64_C(0x716c7cc27e8cc177) }},
+  {{ UINT64_C(0xb14411af7b38cf9c), UINT64_C(0x402f703bf958433c), UINT64_C(0x4b1a6d8bf9357147), UINT64_C(0xcaaaebcbaf8ed603) }},
+  {{ UINT64_C(0x6c25bdf8b86422ce), UINT64_C(0x4019463f4644ecfd), UINT64_C(0xead8692e03927c0c), UINT64_C(0xbc95de405ffad462) }},
+  {{ UINT64_C(0xef3acf7dcfab1fda), UINT64_C(0x11b156d25043986e), UINT64_C(0xce0a49816ef04e34), UINT64_C(0x693ae0709b3c514e) }},
+  {{ UINT64_C(0xa7c5ac2a180e7d26), UINT64_C(0x051e7ed3bd25de94), UINT64_C(0x35a2ebe97272cb65), UINT64_C(0x99d8e3e1a65f14c5) }},
+  {{ UINT64_C(0x7749e9f3a1e164e0), UINT64_C(0xc68f5fbcd0c5de46), UINT64_C(0x2d05269d5d77b43e), UINT64_C(0xc3c0915d0bb259cf) }},
+  {{ UINT64_C(0x7b2d53034b26aa12), UINT64_C(0x8eb93a20093b924b), UINT64_C(0x36b641cb5b9e9e5e), UINT64_C(0x197b415950448901) }},
+  {{ UINT64_C(0x550bf2bff32ef262), UINT64_C(0xe4ccb70c3379f074), UINT64_C(0xae4f9e31c30ebe9c), UINT64_C(0x2fb181af3c98151f) }},
+  {{ UINT64_C(0x490d77ab399cdafc), UINT64_C(0x648228ee9f911898), UINT64_C(0x5ef8fc871cff5e5e), UINT64_C(0x0f5c0c64c9925ca9) }},
+  {{ UINT64_C(0x12ce9060cc5cb4fe), UINT64_C(0xac2fdcd66cace4b2), UINT64_C(0x606531285de86720), UINT64_C(0xe54f4d1360970ce8) }},
+  {{ UINT64_C(0xb44b9d61e9959f12), UINT64_C(0xb748868a2cf25082), UINT64_C(0xa86ef6027abcc37f), UINT64_C(0x0ba4103e2cea4133) }},
+  {{ UINT64_C(0xe5caed7a296239ce), UINT64_C(0x8b64d8378bce6457), UINT64_C(0x29e131c6bfcc29f1), UINT64_C(0x0e5cbfd13eb12c45) }},
+  {{ UINT64_C(0xbfbf4a8ec620d59a), UINT64_C(0xfec97bb2c0191578), UINT64_C(0x26032dd4ce72d48a), UINT64_C(0xe99dfaf4559a98f0) }},
+  {{ UINT64_C(0xaf8b76e5a353a49e), UINT64_C(0xf05796090cabf2c0), UINT64_C(0x3792f7c6fb6a8618), UINT64_C(0x02686045d851a069) }},
+  {{ UINT64_C(0xa9a435153d4ebba4), UINT64_C(0x582855da78e2301e), UINT64_C(0x40fde35ef253ba54), UINT64_C(0x79ea48ffe587feee) }},
+  {{ UINT64_C(0x3610d97a745bd58a), UINT64_C(0x18120e9d35960024), UINT64_C(0x57c09fe7bc83574e), UINT64_C(0x745eae5d233733eb) }},
+  {{ UINT64_C(0x9185ff6fc1788386), UINT64_C(0xd020bf733ad6ccfb), UINT64_C(0x808c8c11ec462173), UINT64_C(0xc1003a978fcb99b1) }},
+  {{ UINT64_C(0x461eb798edf765d4), UINT64_C(0x687ca4096ddc6546), UINT64_C(0x9a6c6a68bdb05dfb), UINT64_C(0x170f084bf4cf6748) }},
+  {{ UINT64_C(0x0d94bcc7e2c8592a), UINT64_C(0x902c582c998e874c), UINT64_C(0x0027cf4a01670b6a), UINT64_C(0x4682f902ae847b1d) }},
+  {{ UINT64_C(0x7b5476ed92d81382), UINT64_C(0xd40cff72748ba26d), UINT64_C(0xabad787bfde4ee10), UINT64_C(0x212b432e653afc17) }},
+  {{ UINT64_C(0x2427b316e35549ee), UINT64_C(0xdca1157270e69241), UINT64_C(0x35ee7fa30abca457), UINT64_C(0x25ad677c7d574e72) }},
+  {{ UINT64_C(0x0191983a59145c0a), UINT64_C(0xbc02d75c62c4bcb5), UINT64_C(0x820cf2aec391c2fb), UINT64_C(0x64189fc867e6e6f6) }},
+  {{ UINT64_C(0x09c707661a18d956), UINT64_C(0x3cdab057bb319842), UINT64_C(0x7f872e88de195904), UINT64_C(0xfb4532f762b5bbe4) }},
+  {{ UINT64_C(0xa04345e8bac549a8), UINT64_C(0x8370075ca6b4affc), UINT64_C(0xa83fd63020bfa67d), UINT64_C(0xd4a1bb710ab6dbd7) }},
+  {{ UINT64_C(0x43a75d30bb39c508), UINT64_C(0x04e13dedaddf63e9), UINT64_C(0xc6338343805fb0e1), UINT64_C(0x9e0ac63515b8bb84) }},
+  {{ UINT64_C(0x047155d12e565c92), UINT64_C(0xabcf6f28e5226523), UINT64_C(0x46d0e82b05a2513d), UINT64_C(0x0551f828a5592334) }},
+  {{ UINT64_C(0xb7e0fb4571e0f718), UINT64_C(0x26ad1506b9ae24cc), UINT64_C(0x47f6423b4754710e), UINT64_C(0x424a1eb166533dd8) }},
+  {{ UINT64_C(0xcda6a0852d7c8c16), UINT64_C(0x51d58da66238a795), UINT64_C(0xd7cf3224be167422), UINT64_C(0x5ed1d3103a578aed) }},
+  {{ UINT64_C(0x5c6be0f99651919a), UINT64_C(0xfa063b8c91108bbf), UINT64_C(0x11f741db093d2fce), UINT64_C(0xa28e391e72310986) }},
+  {{ UINT64_C(0xcc7ec906901b3080), UINT64_C(0x3c14ed4535ebd2af), UINT64_C(0x95a3eeda1a2191bf), UINT64_C(0xbc6b485ed94e7f79) }},
+  {{ UINT64_C(0x7d18fb4ea8d9335a), UINT64_C(0x722003f639f2082e), UINT64_C(0xf1cc6f415a318dda), UINT64_C(0x690bb16b863034b1) }},
+  {{ UINT64_C(0xf93ac38de90e2fa2), UINT64_C(0x23f1d839933f7989), UINT64_C(0x43b007562456a60c), UINT64_C(0x5e1452b06f77218d) }},
+};
+
+static const mzd_local_t L_1[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0xa8041ceeb1547656), UINT64_C(0x669efc5b3fdeb021), UINT64_C(0x6fb9295542735193), UINT64_C(0xe420909bb8726590) }},
+  {{ UINT64_C(0xbf07b0ec2f6de944), UINT64_C(0xfb584120308e5dd1), UINT64_C(0x284f6788d23bd2f1), UINT64_C(0x8524de39e3f2af96) }},
+  {{ UINT64_C(0x7d0a92c56c93430e), UINT64_C(0x77a428745ca4c244), UINT64_C(0xe90d7f4452bd25d4), UINT64_C(0x8598f462e3a1922a) }},
+  {{ UINT64_C(0x32e1f54be0516670), UINT64_C(0x4c86003b43faac72), UINT64_C(0x8c24b4873965c017), UINT64_C(0xf81a782538a530ec) }},
+  {{ UINT64_C(0xe885dd74fb61f1e2), UINT64_C(0x34811fe5a9d0187a), UINT64_C(0xe17383febf8feb8c), UINT64_C(0xa6979114d2da608e) }},
+  {{ UINT64_C(0x731416e149945280), UINT64_C(0x169716a65ab774d6), UINT64_C(0x44db586bf91423e4), UINT64_C(0x028fcee41a5fbff4) }},
+  {{ UINT64_C(0xca8255480974c568), UINT64_C(0xf09e4ae363b9a508), UINT64_C(0x3777020c168bb6f0), UINT64_C(0x23518457dbfbd875) }},
+  {{ UINT64_C(0xfb5dd08889761826), UINT64_C(0xf96aaf8b91f77e42), UINT64_C(0x50f0389c0cd37ac2), UINT64_C(0x0149c7d263e02d87) }},
+  {{ UINT64_C(0x10f6d02fcc04852c), UINT64_C(0x514d49aebc68f35e), UINT64_C(0x04b90aa9ba817ccd), UINT64_C(0x4c2c21c278b566d1) }},
+  {{ UINT64_C(0x3f2126f9a387ff1a), UINT64_C(0x4dc6bd8e289d2ab0), UINT64_C(0x70341ba057981021), UINT64_C(0xcb8f5972e3f66df9) }},
+  {{ UINT64_C(0xf33bab5cd1e3011c), UINT64_C(0x6192ece5a2f3bf03), UINT64_C(0xbe5744bcefb830ee), UINT64_C(0xd0e2674514b0bace) }},
+  {{ UINT64_C(0xdddc1e9d19bf00ee), UINT64_C(0xf425e73510b49629), UINT64_C(0x13789437bb19136d), UINT64_C(0x80ffe678938c811f) }},
+  {{ UINT64_C(0xd574b081fc99a192), UINT64_C(0x43989ddfd122abdd), UINT64_C(0x18bf8629933c49f4), UINT64_C(0xf8e4451f6398bc91) }},
+  {{ UINT64_C(0x6861eb29b45b9cb8), UINT64_C(0xb6562934e8672df6), UINT64_C(0xffb52be7b97844af), UINT64_C(0xa9b8e1230a44672f) }},
+  {{ UINT64_C(0x08e77c8aa4f11584), UINT64_C(0x9a2f7bbac24f33b8), UINT64_C(0xb08d65405417becb), UINT64_C(0x8678f507c880f9ca) }},
+  {{ UINT64_C(0xe142a2b80da66ef0), UINT64_C(0xa7a10bc5d23ddb50), UINT64_C(0xa3545fe3313da706), UINT64_C(0x11a551f3c730841d) }},
+  {{ UINT64_C(0x301ec821da1e5f5a), UINT64_C(0x919ee120f9e1da3f), UINT64_C(0x773d9b9fadb5ab88), UINT64_C(0x8aa7f24b38260ee5) }},
+  {{ UINT64_C(0x3cd6e9d0f66ed020), UINT64_C(0xa78834107dfd5790), UINT64_C(0xf989b6986df74ce7), UINT64_C(0x93deaebe2b371571) }},
+  {{ UINT64_C(0xe65416d56b548f0c), UINT64_C(0x10d7901f2927f92b), UINT64_C(0x280bb6b426a69927), UINT64_C(0xa951abe7726f7900) }},
+  {{ UINT64_C(0x7e692a547fb8cd8c), UINT64_C(0x567c2923b65cd65a), UINT64_C(0xb20b707b78e0fb04), UINT64_C(0x6dc5e009a7bfd57b) }},
+  {{ UINT64_C(0x7e51820a302e8968), UINT64_C(0xe75e1070d48f94df), UINT64_C(0x48c43187c1374d15), UINT64_C(0x9b3c8d74bf77a618) }},
+  {{ UINT64_C(0x0956b243a68962f2), UINT64_C(0x976647f60ff8ca29), UINT64_C(0x261466ff2ea7345c), UINT64_C(0xb65671c7ca3e40b8) }},
+  {{ UINT64_C(0x3d222a124abf8dca), UINT64_C(0x9612da34dd00a35f), UINT64_C(0x629f122a421a0d14), UINT64_C(0x0469915817abf956) }},
+  {{ UINT64_C(0x55abc2229876f014), UINT64_C(0x6320545e235e35d8), UINT64_C(0xa0941e2ad69d9037), UINT64_C(0xcbde777a80daac0c) }},
+  {{ UINT64_C(0x573dedb2bf7e2f4c), UINT64_C(0xc14f9eabbd208574), UINT64_C(0x372821f9bae60fd8), UINT64_C(0x1d368a5253cfc8ba) }},
+  {{ UINT64_C(0x2761a555aa340d4a), UINT64_C(0x70c00ba1e93d9b5d), UINT64_C(0x60e1d0dc43474fb7), UINT64_C(0x04cd94898fa78e1c) }},
+  {{ UINT64_C(0x5a26849e18fd565a), UINT64_C(0x7e5dc7474e6a10d1), UINT64_C(0xeae3edd80828c1e8), UINT64_C(0x20e914cf222f5796) }},
+  {{ UINT64_C(0xd797d550cf65875e), UINT64_C(0x1214baaadd51676b), UINT64_C(0xc80cb1d1334e6d0a), UINT64_C(0x9bee28da5b98693a) }},
+  {{ UINT64_C(0x87171644ca0e2080), UINT64_C(0x218123876d3ff6a1), UINT64_C(0x545c81c20e2b9a92), UINT64_C(0xc16f7c9fced5ebd2) }},
+  {{ UINT64_C(0x3a4d78d7245aab86), UINT64_C(0xf71a84d7435affed), UINT64_C(0x8d3131e942c3861b), UINT64_C(0x35284cef5deaf2e9) }},
+  {{ UINT64_C(0x4d675dd683c0a6ca), UINT64_C(0x367c76646eb78108), UINT64_C(0xcd00d25093ca8e15), UINT64_C(0x51a4385d38c24545) }},
+  {{ UINT64_C(0xe0cbf94387b97622), UINT64_C(0x65ea90e4f6a846c9), UINT64_C(0x36159eb35137c835), UINT64_C(0x771034f9895f01ca) }},
+  {{ UINT64_C(0xcbdb5f898fe98c52), UINT64_C(0x4817c99ef33602e6), UINT64_C(0x5c3028e8a6bd09a2), UINT64_C(0x578d44ca07c4ccd9) }},
+  {{ UINT64_C(0x85ca5a21b2393c2a), UINT64_C(0x6eba3dfb966957fb), UINT64_C(0x9d5faca7ca3d6322), UINT64_C(0x74f8ef68836a616d) }},
+  {{ UINT64_C(0xaf0735e8764e51f0), UINT64_C(0x68bfd40ca8110757), UINT64_C(0x6095c489cd95ecea), UINT64_C(0x569d8b5f53642e52) }},
+  {{ UINT64_C(0xea3dfabec7f79608), UINT64_C(0x7db5995e7835e31c), UINT64_C(0xdcb34e464aec3863), UINT64_C(0x13fc0ea2154b1d1c) }},
+  {{ UINT64_C(0xfe8d305c27189ff4), UINT64_C(0xdcb764d2180fced8), UINT64_C(0x617159e2121489d7), UINT64_C(0xcc065c6ed78c6bcb) }},
+  {{ UINT64_C(0x7eff0ff4bfe2f22a), UINT64_C(0x9e80196e5538901a), UINT64_C(0xa1549499ea33bc73), UINT64_C(0x98eaf3593c55b5d9) }},
+  {{ UINT64_C(0x8e369bd008e7098e), UINT64_C(0x6131e4d95a3c622e), UINT64_C(0x664a55ef5257260f), UINT64_C(0xb617df6ed3f60b23) }},
+  {{ UINT64_C(0x507ce8f349e4866c), UINT64_C(0x181d28535b65780c), UINT64_C(0xf5c50cc159158e60), UINT64_C(0xca13ecc648f5389a) }},
+  {{ UINT64_C(0x6434ee5d55f6bf84), UINT64_C(0x715e268ca4611ad8), UINT64_C(0xfb9108969d73483c), UINT64_C(0x4f7a8b8a874041fb) }},
+  {{ UINT64_C(0xd3b941232806f154), UINT64_C(0x318d46b0d15934b1), UINT64_C(0x6592901a8b07f498), UINT64_C(0x805a6b318ebb7562) }},
+  {{ UINT64_C(0x06d3a9738a6e2a7c), UINT64_C(0x9d4572a3ed9a57b6), UINT64_C(0xdec66d04e3e30d0a), UINT64_C(0xae6999f4941c0096) }},
+  {{ UINT64_C(0xbf910fe94e4e28c0), UINT64_C(0x55783de6a867ea8b), UINT64_C(0xf1eda49518c498e0), UINT64_C(0xdb007bc920c8b3d0) }},
+  {{ UINT64_C(0xfa52bf122c45d554), UINT64_C(0xd3c2ade7ab59cd58), UINT64_C(0xefbf77e5fa199d67), UINT64_C(0xf8115bdf8236567b) }},
+  {{ UINT64_C(0x156ef08aeb812324), UINT64_C(0x7d00addf57f3e75e), UINT64_C(0xafa7f2682510f614), UINT64_C(0x31c3f3fd3d558558) }},
+  {{ UINT64_C(0x1ad07708737a8736), UINT64_C(0x01df07b586c943df), UINT64_C(0x3b9fc9ca0efc1a0a), UINT64_C(0x191cab812b8af101) }},
+  {{ UINT64_C(0x03f63ea50965e566), UINT64_C(0x732b542cc80aebcf), UINT64_C(0x72597f27eb8b46d4), UINT64_C(0x7f1a7a8e999961b7) }},
+  {{ UINT64_C(0x797893fe21bafab2), UINT64_C(0xa063ab9c4acd0e88), UINT64_C(0xb3fa733da7e955f6), UINT64_C(0x902ea662dac60450) }},
+  {{ UINT64_C(0x29182d7a415f0b3a), UINT64_C(0x2f19d0a8a0c8bf46), UINT64_C(0x918567eea3b4c12a), UINT64_C(0x526fa0af6760293f) }},
+  {{ UINT64_C(0x5054ace7bcb2afba), UINT64_C(0xe59f446454c08170), UINT64_C(0xbb4cd3578c4421d3), UINT64_C(0x519a85d627fd73d2) }},
+  {{ UINT64_C(0x625f171b511eb5ec), UINT64_C(0xbfcf457578ebfe3a), UINT64_C(0x87a00c7f0f3f3c99), UINT64_C(0x0993e33289ddacfc) }},
+  {{ UINT64_C(0x3269c67b2e3a2b8c), UINT64_C(0x4f5d23215972f2e5), UINT64_C(0xf8dd89e3fe831a7b), UINT64_C(0x5d8275d7e421f3a4) }},
+  {{ UINT64_C(0x2cdc1d925332a1d8), UINT64_C(0xee8b1c416eec067d), UINT64_C(0x8954c3e3bc17ac5a), UINT64_C(0x9b17cbdd9a1e51d6) }},
+  {{ UINT64_C(0xcb6882e232a5e39a), UINT64_C(0x93c5c6b555521cda), UINT64_C(0x362cbf6f0f029b7a), UINT64_C(0x5c21787511bedacb) }},
+  {{ UINT64_C(0xb88e9833c8733046), UINT64_C(0xc20ea1c1e7c132fa), UINT64_C(0xfc26dd08e725e3c6), UINT64_C(0x99d4d0e648f4da05) }},
+  {{ UINT64_C(0x53b7abf31b9189c2), UINT64_C(0x739d6d3d73334c0d), UINT64_C(0x56de7d4e8fc8d4cf), UINT64_C(0x968177b098838190) }},
+  {{ UINT64_C(0x5f443bb55591a18c), UINT64_C(0x745a6e2c0e658a2d), UINT64_C(0xbeebd958b38e56fe), UINT64_C(0xdec2e570f624b2e5) }},
+  {{ UINT64_C(0x4a9d1f0bd3cf3974), UINT64_C(0x264ce43fd7d7bbe9), UINT64_C(0xad2774a88e241a2c), UINT64_C(0x22229d1402aab202) }},
+  {{ UINT64_C(0x2aa1b2310a5a8188), UINT64_C(0x2deca1c2ab47f6f9), UINT64_C(0xa1cebc1807703c55), UINT64_C(0xaf581cfe8f90a46d) }},
+  {{ UINT64_C(0xac17e8d9d2fa8db2), UINT64_C(0xbf5d14d2b79748ba), UINT64_C(0x8f388702364f067d), UINT64_C(0xf211aa675c91f00e) }},
+  {{ UINT64_C(0x54e63e8d92c5067a), UINT64_C(0x99606376798584cc), UINT64_C(0xee5b0ccd35d627f4), UINT64_C(0x580e72cf9c4d6bab) }},
+  {{ UINT64_C(0x6513ca9da92f7406), UINT64_C(0x8566e3a7d9acd335), UINT64_C(0xfc23394bfb8f4ce3), UINT64_C(0xcdde1be16600f767) }},
+  {{ UINT64_C(0x7280708430b7094e), UINT64_C(0x67b5bb577bae52af), UINT64_C(0x6ab7594eb2a877ba), UINT64_C(0x767e58ac2b87833f) }},
+  {{ UINT64_C(0x1ef874c5904f5d28), UINT64_C(0x28f6ee30249e740d), UINT64_C(0x69ab1bf1a4dd6c15), UINT64_C(0x50fad986c02900f0) }},
+  {{ UINT64_C(0xa89ed8e6481d9bc0), UINT64_C(0xb25e8cdc6c8797a3), UINT64_C(0xeeedfda8b9099bc7), UINT64_C(0x864d77f235782423) }},
+  {{ UINT64_C(0xb3a0aa584dffd82a), UINT64_C(0x0779dd50b8b3831e), UINT64_C(0x9139f5a4c3f9a115), UINT64_C(0xe83e1499e58afc8a) }},
+  {{ UINT64_C(0xbc150b3891f4ec30), UINT64_C(0x22d464296cd1ba31), UINT64_C(0x0d765d311115ba02), UINT64_C(0xd11485000b50f9d0) }},
+  {{ UINT64_C(0x9baa47e639329f18), UINT64_C(0x8cb718fe700ac8dd), UINT64_C(0x235c0f186efb09a5), UINT64_C(0xe212865a7cb8e68d) }},
+  {{ UINT64_C(0x7bebc1d2fa3ae426), UINT64_C(0x9c7684fcede4b190), UINT64_C(0x1c2a25890be80671), UINT64_C(0x4020c157a30b1868) }},
+  {{ UINT64_C(0x4e50aecaed5fb880), UINT64_C(0x3198763191ea7453), UINT64_C(0x3a98f9f7af0a55c4), UINT64_C(0xfa0f0c6b9e2fb686) }},
+  {{ UINT64_C(0x2c87ce466724b4d8), UINT64_C(0xf0e8a00dfa4ba6d1), UINT64_C(0x29346eb3e1e5009e), UINT64_C(0x6c1473b3de4888e8) }},
+  {{ UINT64_C(0xf94d77e8c640f3b8), UINT64_C(0xc5868bee9ea1b64a), UINT64_C(0xc9dcd7c977d71ad1), UINT64_C(0x8c64580aa7d2cde6) }},
+  {{ UINT64_C(0xa801f2b72d3ac020), UINT64_C(0x537648038d3d67d9), UINT64_C(0xf496d53df9d24339), UINT64_C(0xd9f62137b59c7cc6) }},
+  {{ UINT64_C(0xd2705c5f532e8ef4), UINT64_C(0x7e30c234da603fc7), UINT64_C(0x9586785c987299f0), UINT64_C(0x413d8dc306f4b7ca) }},
+  {{ UINT64_C(0x9fab0213305c30da), UINT64_C(0xbcf1a289ead3ea39), UINT64_C(0xdb0df2e34fbff973), UINT64_C(0x657237bddde1ccfd) }},
+  {{ UINT64_C(0x5f4ab032504751ac), UINT64_C(0x35deb9ff3c736cc7), UINT64_C(0x1652db387cbbe0a5), UINT64_C(0xea400db9076416c4) }},
+  {{ UINT64_C(0x3968bb3f8c8adcc2), UINT64_C(0x30117167537c674c), UINT64_C(0x8667ef1a62fa967a), UINT64_C(0xdebe4fee68471969) }},
+  {{ UINT64_C(0x5a3fdde8145cbc48), UINT64_C(0x8aa7b4044ff254a2), UINT64_C(0x630f18ae6a7f9148), UINT64_C(0x7614e32d192dda83) }},
+  {{ UINT64_C(0x5b11eee33d5c657e), UINT64_C(0x1612f2adecc4582a), UINT64_C(0x54c411bc3e5c1f59), UINT64_C(0x4c42e9d10b692913) }},
+  {{ UINT64_C(0x64ecec3701192a68), UINT64_C(0x436aa50d08d9c519), UINT64_C(0xb333256286721be3), UINT64_C(0x026f887ad5588d77) }},
+  {{ UINT64_C(0xaf3f6e17091ce6e2), UINT64_C(0x09c0b5d90e3de27a), UINT64_C(0x19c0f719db9db2ed), UINT64_C(0x638ffdc7ef38508e) }},
+  {{ UINT64_C(0x62b5bd9319123bc6), UINT64_C(0xfe5f5b05f462e214), UINT64_C(0x1a11400aa7e41ae2), UINT64_C(0xd0e56a17b8611550) }},
+  {{ UINT64_C(0xd558648a15fb53ea), UINT64_C(0xd1dc5645e1565be5), UINT64_C(0x321f5150c06a9d94), UINT64_C(0xc75b4013e8b547af) }},
+  {{ UINT64_C(0xd7d243c3275fbfaa), UINT64_C(0x6d8ca4f165a4be0c), UINT64_C(0x5d4619d9f39c3b5f), UINT64_C(0x1cc52bfcffe2dc6c) }},
+  {{ UINT64_C(0x9be153f44d06aaaa), UINT64_C(0x6dc3e0837c6c1538), UINT64_C(0x2ed3ebdfb26db137), UINT64_C(0x7d9368328a080d28) }},
+  {{ UINT64_C(0x8068ac895c0b11c8), UINT64_C(0xdb5230d98b0b5a8e), UINT64_C(0xd35272b2eb350923), UINT64_C(0x4e3bde9c0877fb8e) }},
+  {{ UINT64_C(0xbd04cafc85620ac4), UINT64_C(0xe84c7b3af420c1f3), UINT64_C(0x13040ac2a5523b3c), UINT64_C(0xe2970d50df025261) }},
+  {{ UINT64_C(0xab2b79eff2869c50), UINT64_C(0x3e282d1be65e9a9b), UINT64_C(0x1211484dd5eb85c3), UINT64_C(0xc11995300237ca93) }},
+  {{ UINT64_C(0x3fb22c24e87a4772), UINT64_C(0xe1132a10563483df), UINT64_C(0xe1ae3c6aca65388c), UINT64_C(0xe9c71b3c16416325) }},
+  {{ UINT64_C(0x625b52bd283bff44), UINT64_C(0x2684b5c416ec3b7a), UINT64_C(0xdbbe9937560168de), UINT64_C(0xfb93fa9131dd92d7) }},
+  {{ UINT64_C(0xfd257c58c2cfbbe8), UINT64_C(0x08d9a362480fba09), UINT64_C(0xf670046b7db0848d), UINT64_C(0x11cae740bc0c9783) }},
+  {{ UINT64_C(0x5cf97d252205b19a), UINT64_C(0xb0121e9d8f985353), UINT64_C(0x5c8ed7e189b59152), UINT64_C(0x46c1417c982ad846) }},
+  {{ UINT64_C(0x373bf1907f89dcd2), UINT64_C(0x20986d9635842f66), UINT64_C(0xaa0b4bcd0ca96a07), UINT64_C(0x613654c7304fff92) }},
+  {{ UINT64_C(0x3676b2e41a562e4e), UINT64_C(0xbba38792248748f6), UINT64_C(0xfbbbfb0f16d087e8), UINT64_C(0x09eb044e267bf7c7) }},
+  {{ UINT64_C(0xed9866a7e3fbd2fe), UINT64_C(0x11cfa9e70581758c), UINT64_C(0x96210f9cd1643f20), UINT64_C(0xc8127b6822e1260c) }},
+  {{ UINT64_C(0xb2c04141c98c1a10), UINT64_C(0xfe524a51e5da91fe), UINT64_C(0xdfc512cadf8a3e0f), UINT64_C(0xd448da124bd53281) }},
+  {{ UINT64_C(0x81d963fa50777d76), UINT64_C(0xc14303ce66d3e808), UINT64_C(0x4ecd94e5482dc936), UINT64_C(0x188af67a1a190470) }},
+  {{ UINT64_C(0xdb0b93b57c6119cc), UINT64_C(0x4f3593d52d2f6404), UINT64_C(0x2b3fb0f4b71e5284), UINT64_C(0x9db95ca1f70e18c8) }},
+  {{ UINT64_C(0xb462ce41a64bf1a6), UINT64_C(0x30848b1b86eb6443), UINT64_C(0x5172f4147dbd5ce9), UINT64_C(0xa21c53dfcf7d81cc) }},
+  {{ UINT64_C(0x052182b5f970e2ea), UINT64_C(0x756c7c79b53e1388), UINT64_C(0x1117b941cba2c0d0), UINT64_C(0xce502b318a1cfd53) }},
+  {{ UINT64_C(0x3639b88dd72a4bd8), UINT64_C(0x2071069f8e4e0c95), UINT64_C(0x6bb64f4fa8da1dac), UINT64_C(0x6856729b0864cb53) }},
+  {{ UINT64_C(0x8a85dd1d8e70123c), UINT64_C(0xfdacf65868bac167), UINT64_C(0x6b1f640abf115148), UINT64_C(0xf0ff9fcbd8f2680a) }},
+  {{ UINT64_C(0xeaa8169f6f0b2ea4), UINT64_C(0xf889389626763c44), UINT64_C(0x70d19054c7e6fadb), UINT64_C(0x255df4d1343f3054) }},
+  {{ UINT64_C(0xbbb23d71a55c405c), UINT64_C(0x74ff7598f8c8c21d), UINT64_C(0x61c1603b00eeb081), UINT64_C(0x90496c4a35de5055) }},
+  {{ UINT64_C(0xc84801292b8f9af4), UINT64_C(0xb774e7fac20f305e), UINT64_C(0x9a651de22f163254), UINT64_C(0x89ecf61074b81844) }},
+  {{ UINT64_C(0x62d6e52007be8a64), UINT64_C(0xe975c4872fed6e06), UINT64_C(0xb11bded3517c72fa), UINT64_C(0xaecf764092d94974) }},
+  {{ UINT64_C(0x662678d69e45eb0c), UINT64_C(0xf9de6bd680869664), UINT64_C(0x59d5fe4fb8ed125d), UINT64_C(0xbf5f5e9dd205e757) }},
+  {{ UINT64_C(0xf2eec265e174d974), UINT64_C(0xbbbaf79e1e47d073), UINT64_C(0x41eed29b39d75a59), UINT64_C(0x7a362d4daa175d6f) }},
+  {{ UINT64_C(0x1be4fd4398a702ac), UINT64_C(0x84234c460d3ae7e4), UINT64_C(0x85895879f8128e77), UINT64_C(0xeee862314086be31) }},
+  {{ UINT64_C(0x7c482b0833a5ee12), UINT64_C(0x7674a463d2b49fbb), UINT64_C(0x952a49d23558f5ac), UINT64_C(0x717b4a022165fd37) }},
+  {{ UINT64_C(0xadab54f378a18630), UINT64_C(0x61fb08dd3561a8b8), UINT64_C(0x34651078f7ffcc49), UINT64_C(0x1b9a2b3beb8ecaca) }},
+  {{ UINT64_C(0x0d3a2990f0bcbd0e), UINT64_C(0x73cb15f7ce48b48e), UINT64_C(0x3d19d5f2ccc5543e), UINT64_C(0xe4de934ec9de2c3e) }},
+  {{ UINT64_C(0x09d98d46b9662100), UINT64_C(0x39f52b1125225b03), UINT64_C(0x158702a8306cddd5), UINT64_C(0xcdedbb12d45733eb) }},
+  {{ UINT64_C(0x2d5fefe09cf52ad2), UINT64_C(0xdd2c0289148f9233), UINT64_C(0x9f6dec3f4a1cb346), UINT64_C(0x127dfea691ae0267) }},
+  {{ UINT64_C(0x457342045ad70294), UINT64_C(0x46aeb6b13d978bc3), UINT64_C(0x07fac5a968ae09f9), UINT64_C(0xa3f61bc633240859) }},
+  {{ UINT64_C(0xdb41696fd91a047a), UINT64_C(0xaa2bf3b9a968c48d), UINT64_C(0x08c3bb1039155976), UINT64_C(0xbb4d5c4c89d0d9a6) }},
+  {{ UINT64_C(0xc9c499585a213820), UINT64_C(0xfd738610c2ec6ffe), UINT64_C(0x78d7b517f4f5bf8b), UINT64_C(0x83b6cee5a902a8ee) }},
+  {{ UINT64_C(0x19f3c0018a2abedc), UINT64_C(0xa663d3969dfc52f7), UINT64_C(0xbcfa8e1463dbf248), UINT64_C(0x9abd30aec2c44796) }},
+  {{ UINT64_C(0x8eb7823f5fe1a278), UINT64_C(0xffaa7cdef73c9783), UINT64_C(0xa19a9b1aba0adbf9), UINT64_C(0x68d016aa99b19945) }},
+  {{ UINT64_C(0xe8bd2411f6041d8a), UINT64_C(0x496d7f325edd1329), UINT64_C(0xd6ce9c5b4c4fd778), UINT64_C(0xf613100c4e9c562a) }},
+  {{ UINT64_C(0x7ec8fad2a72be75e), UINT64_C(0xcff4add4beab80e2), UINT64_C(0x5351ce4f008275ba), UINT64_C(0xc704675b25b88262) }},
+  {{ UINT64_C(0xee61d45655dab22a), UINT64_C(0x80c5275ac45d49dd), UINT64_C(0x12161477ec65f3ab), UINT64_C(0xdca244b8848d64a0) }},
+  {{ UINT64_C(0xa126aa79ff4ced16), UINT64_C(0xf4703bff338e75e4), UINT64_C(0x4374ec954780b91d), UINT64_C(0x09c6b8bf9fccab46) }},
+  {{ UINT64_C(0xffe00f62cba9d850), UINT64_C(0x4279a348f14c50c0), UINT64_C(0x4403455b10c35226), UINT64_C(0x688fe646f13bc317) }},
+  {{ UINT64_C(0x85da431eeee0ffce), UINT64_C(0x5ad78fd19901abd1), UINT64_C(0xbe0b900d8a709e1b), UINT64_C(0x45fba1fd1a741e79) }},
+  {{ UINT64_C(0x32f8ee5e0b91101a), UINT64_C(0xe2dbaf372b146961), UINT64_C(0xe42de5d1d172f12e), UINT64_C(0xbdc2ef49598322b9) }},
+  {{ UINT64_C(0x1f0ad1e0a2d73d0e), UINT64_C(0x943b6a0934e88e52), UINT64_C(0xc187921b7c1e1a4f), UINT64_C(0x9a8de35880e5beda) }},
+  {{ UINT64_C(0x2011a700fbc318da), UINT64_C(0x2529ecdb2fe65dfd), UINT64_C(0x87d7795a6a7e48a9), UINT64_C(0x3d249d6ca26e9884) }},
+  {{ UINT64_C(0x17b54d8d8aaa18b0), UINT64_C(0xc31f962f981976a6), UINT64_C(0x81a0ad20b7169c29), UINT64_C(0xcb59b9d4290b7883) }},
+  {{ UINT64_C(0xe038b5736a7b726e), UINT64_C(0x6fe7e64a905d1d31), UINT64_C(0xf2240e6519234793), UINT64_C(0x1955c85e6fe94c91) }},
+  {{ UINT64_C(0x8672f451d40b8d3a), UINT64_C(0xc6a1d8e3cb300510), UINT64_C(0x1d8ab58a1f78da84), UINT64_C(0x7cd7d9d6c30c6b4c) }},
+  {{ UINT64_C(0x2d356ae3fd142e08), UINT64_C(0xa5b63ce856ea0fcb), UINT64_C(0x7038b680303bc3fe), UINT64_C(0xd22ee6451494befc) }},
+  {{ UINT64_C(0x7735758b76dfc14a), UINT64_C(0xe0e03b7b67c563bb), UINT64_C(0xbad309ba1bbb662b), UINT64_C(0xa5cd5d540e4b618f) }},
+  {{ UINT64_C(0xd25049ba20a921a6), UINT64_C(0xc6ca92bf74e25c69), UINT64_C(0x7aebfa0c94cb2f7b), UINT64_C(0x00d342921385bbfb) }},
+  {{ UINT64_C(0x8a7576707afcb58a), UINT64_C(0x080fa7eee0e536a8), UINT64_C(0x98d2b985a6133de9), UINT64_C(0x4ddfc186d2e40270) }},
+  {{ UINT64_C(0x5293b78c91c0a760), UINT64_C(0x7420918e699eebd9), UINT64_C(0x787ef410d77bd583), UINT64_C(0x6d2b44282fb6757f) }},
+  {{ UINT64_C(0xabae3cef5e8fd83c), UINT64_C(0x971dc12c20e9506f), UINT64_C(0x32ac03b75c36b97f), UINT64_C(0xc5783e93d5b6df36) }},
+  {{ UINT64_C(0x29f90e6328dee996), UINT64_C(0x1226a5271dade033), UINT64_C(0xdf9833bcbe9b023a), UINT64_C(0x59cffda1e2c83527) }},
+  {{ UINT64_C(0x70683d2b925b92e0), UINT64_C(0x4908a633265091e6), UINT64_C(0xfa1d433da6cee67c), UINT64_C(0x349a96d16ad9abd3) }},
+  {{ UINT64_C(0xbdd3d49182a435e8), UINT64_C(0x7b5afcf515f1bf37), UINT64_C(0xc57beb076c85d3f3), UINT64_C(0x2d84bd5e412bb124) }},
+  {{ UINT64_C(0x6dcf66ad4325d0d6), UINT64_C(0x50097995af0028be), UINT64_C(0x74f3f713ec0d14b0), UINT64_C(0x96ad9525fdf4f785) }},
+  {{ UINT64_C(0xf6aa288a9df2b63e), UINT64_C(0x103f590c6fb17d86), UINT64_C(0x2296570b2c3a1768), UINT64_C(0xb8bcf96238fb7b7c) }},
+  {{ UINT64_C(0x81de1b3d496478dc), UINT64_C(0x46b4df447a562e4d), UINT64_C(0xacfa499faa0b997d), UINT64_C(0x5c6533c9954e9a74) }},
+  {{ UINT64_C(0xf77ed85e74e40ad4), UINT64_C(0xc9b81ca302777d1a), UINT64_C(0xf834aecf95a402e6), UINT64_C(0x92e491db8b0c7dd9) }},
+  {{ UINT64_C(0xad4faf3cd271812e), UINT64_C(0xd14b44f05c7ac2e2), UINT64_C(0x39928c1753683e1d), UINT64_C(0x1fa5074987666347) }},
+  {{ UINT64_C(0x146c64920887f370), UINT64_C(0x232052857db7624c), UINT64_C(0xbb05975b5b7e0320), UINT64_C(0xb2b0899209fd8024) }},
+  {{ UINT64_C(0x880434553351ed1c), UINT64_C(0x39ce7872e00a89ab), UINT64_C(0x67eeceadbf6ae556), UINT64_C(0xf83fa5ea31df68f5) }},
+  {{ UINT64_C(0x2d78bf9cc141efa8), UINT64_C(0xfdd08bf6b14de4c4), UINT64_C(0x9ba291143e89b529), UINT64_C(0x8355d24a6ef3c21d) }},
+  {{ UINT64_C(0xfb07a6dd383c8ad6), UINT64_C(0xd6ac98376c6cb687), UINT64_C(0xd9d5092062d943ce), UINT64_C(0x971057d957322cc5) }},
+  {{ UINT64_C(0x025bd2df2c45a030), UINT64_C(0x082ac186bee86167), UINT64_C(0x4179730e7c1ab581), UINT64_C(0xe04792b0b104b7e1) }},
+  {{ UINT64_C(0x933af7d453548e96), UINT64_C(0x7b77d18cc8f8aa88), UINT64_C(0x1e689275a4808372), UINT64_C(0xfcc671f88d1cf304) }},
+  {{ UINT64_C(0xdd4ffe19bbcccd96), UINT64_C(0x24c723c82eed5afa), UINT64_C(0x587b5989de955402), UINT64_C(0x0fc1c73947feb5e6) }},
+  {{ UINT64_C(0x9f7b7580c8de1408), UINT64_C(0x857dd70a99720716), UINT64_C(0xf456e0ea596b797c), UINT64_C(0xc442031858d13580) }},
+  {{ UINT64_C(0xfa56194e2719cce6), UINT64_C(0xcbfdf4b20fc3c551), UINT64_C(0x05e42f73c3569d25), UINT64_C(0x72b69737d97e1da6) }},
+  {{ UINT64_C(0x32e10a0f0078db2e), UINT64_C(0xd44563f7d94aef6d), UINT64_C(0xd5587ed237fae2d1), UINT64_C(0x33ba7ad6d9d916ca) }},
+  {{ UINT64_C(0x8298698041a4d41e), UINT64_C(0xf0c8abdf552602b3), UINT64_C(0x49e6e18aa1bfc78c), UINT64_C(0xd6d8867d0ed1fa33) }},
+  {{ UINT64_C(0xdba303ad063d8980), UINT64_C(0x340e4b189c3fe412), UINT64_C(0x82508fecdfc42782), UINT64_C(0x31ccdabdc71d0f0a) }},
+  {{ UINT64_C(0x243dd40badc60f92), UINT64_C(0x0dddeceaadde4aa6), UINT64_C(0x3e000305853f515b), UINT64_C(0x7519391bfa1e9c8d) }},
+  {{ UINT64_C(0xb83db33be1b46e4a), UINT64_C(0xb63ee81ce6d0272b), UINT64_C(0x5db7f3a44dcdc706), UINT64_C(0xfc478434ea8b3be5) }},
+  {{ UINT64_C(0xc79bbf117ce2c610), UINT64_C(0x8dd09158bfa34a43), UINT64_C(0xb793050edb2ac0a8), UINT64_C(0x8846ac21407cbf33) }},
+  {{ UINT64_C(0x44d749c4a7dd8822), UINT64_C(0xe31b1278caf96325), UINT64_C(0x7e4eda02e4d9087c), UINT64_C(0x3bb65575aa4474bb) }},
+  {{ UINT64_C(0xfaef197513ca5d7c), UINT64_C(0x6db8d6579a87ceb7), UINT64_C(0xab88bc62f33cb875), UINT64_C(0xf0ee28f9563bf777) }},
+  {{ UINT64_C(0x68de22a266504724), UINT64_C(0x13d48ddabb7b82cb), UINT64_C(0x64d357a2d99c492e), UINT64_C(0xfa60d0dc44359cdf) }},
+  {{ UINT64_C(0xc2c06bb535b43f4a), UINT64_C(0xe6ab34b69420aa93), UINT64_C(0xbcecfcf222c4dec8), UINT64_C(0x930e55c1101a0378) }},
+  {{ UINT64_C(0x7dff5990272844b0), UINT64_C(0x1632c23360d299d3), UINT64_C(0x85c94f8bc44d46e0), UINT64_C(0x06d6e3e48070cfd1) }},
+  {{ UINT64_C(0xb574253d8c27d8a8), UINT64_C(0x63130309141c1f6e), UINT64_C(0x6a02488e2075121c), UINT64_C(0xb34d4a80634b4040) }},
+  {{ UINT64_C(0x7b86d14ab3957444), UINT64_C(0xf50b38e462f787a9), UINT64_C(0x277b76ba01fd47c2), UINT64_C(0xf7dc9e12c90c8dc7) }},
+  {{ UINT64_C(0x865c44b6e2200ef6), UINT64_C(0x75db585a49780312), UINT64_C(0x85a5f38158566c65), UINT64_C(0x56e20065277ca1d5) }},
+  {{ UINT64_C(0x1742f29ff0987668), UINT64_C(0x182f8c3ad4af8f92), UINT64_C(0x8e2909c199ca1f11), UINT64_C(0xdc116a94ee3f50ea) }},
+  {{ UINT64_C(0x5651251e5aeecd7a), UINT64_C(0xb983e1bb36b14331), UINT64_C(0xf45826786189cf8e), UINT64_C(0xa1ddbd4db715aebd) }},
+  {{ UINT64_C(0x68e26a4ecb0b4ebc), UINT64_C(0xdc01717f812a7fc7), UINT64_C(0x53de07b06e93b2d9), UINT64_C(0x9ecd6b689df614e9) }},
+  {{ UINT64_C(0xfa76b22cdddd735a), UINT64_C(0xe5ca40b52b9d93f2), UINT64_C(0x373814b6dc1cc29e), UINT64_C(0x444f79035e02144f) }},
+  {{ UINT64_C(0x68eebf1c949025a2), UINT64_C(0xc66c78fdb9f1a9aa), UINT64_C(0x772477bcf5fd02c0), UINT64_C(0x8be74582ea7b9ec0) }},
+  {{ UINT64_C(0xe358d7b21920d712), UINT64_C(0x72249afb6b2e6e30), UINT64_C(0x0cbcbd4adc1a6f4b), UINT64_C(0x036eb64c8471ae7d) }},
+  {{ UINT64_C(0xddaf10715eef2b1e), UINT64_C(0xaa0f9bd25f3262c7), UINT64_C(0x7f6d074c8d25c462), UINT64_C(0x047373e568886a7f) }},
+  {{ UINT64_C(0xbc17d04db3065e08), UINT64_C(0x072219341a110ad6), UINT64_C(0x0858c54a31be4a99), UINT64_C(0x412f1d6c87cad749) }},
+  {{ UINT64_C(0xa243931cd71c695a), UINT64_C(0x203c6d6af15fa196), UINT64_C(0x511d85ae9a9d38e0), UINT64_C(0xf706b0d72cfcec90) }},
+  {{ UINT64_C(0xdb55055d01c98614), UINT64_C(0x2b0ffae0c49ab892), UINT64_C(0x59f093512d037137), UINT64_C(0xff742c887d8f19a1) }},
+  {{ UINT64_C(0x89739ead13df268a), UINT64_C(0xecdf187de05a44ab), UINT64_C(0x2f85e51721c52416), UINT64_C(0x850a9fdcdc466846) }},
+  {{ UINT64_C(0xf56caeace676b69a), UINT64_C(0x08f6e2770bb367ed), UINT64_C(0x08a665051dcc72d9), UINT64_C(0x426bbc8c3a925083) }},
+  {{ UINT64_C(0xdaab4847bd53c668), UINT64_C(0x2540039c7678efaa), UINT64_C(0x161dd27a7792d235), UINT64_C(0x9997cb581f84806d) }},
+  {{ UINT64_C(0xa3c67b41a4d8a692), UINT64_C(0xbd5e58b617321776), UINT64_C(0xe4f3b284a0ee532a), UINT64_C(0x1991440da134795a) }},
+  {{ UINT64_C(0x36b994b05ebd74ba), UINT64_C(0xbdde2b084c4458f7), UINT64_C(0xe1bda822a398c739), UINT64_C(0x12d74dd9d172f9fc) }},
+  {{ UINT64_C(0xaa0e73cac3d60590), UINT64_C(0x704b5f20c9670733), UINT64_C(0xe85e91e78c819be6), UINT64_C(0xcbc8beceb69743ed) }},
+  {{ UINT64_C(0xe784c00eb5dd031e), UINT64_C(0xe73ad747d6f136bb), UINT64_C(0x8962dae06ad12654), UINT64_C(0x4064a85603f4ee33) }},
+  {{ UINT64_C(0x553229e2bbbe9528), UINT64_C(0xcebb52d86e1126f9), UINT64_C(0x23440126ea1f1424), UINT64_C(0x2ec8c40b50c8f6cc) }},
+  {{ UINT64_C(0xd616d0c13578626c), UINT64_C(0x72e9c9014bb939bc), UINT64_C(0x78d1b881457c9b1f), UINT64_C(0x60ebc8f06e7424d2) }},
+  {{ UINT64_C(0x3b0039c115271300), UINT64_C(0xd8fd5d157f5f13ee), UINT64_C(0xb2245dcfada258b8), UINT64_C(0xf701b6d14c652f83) }},
+  {{ UINT64_C(0x8701850e2763e9ee), UINT64_C(0xb07dcb2902dee2ba), UINT64_C(0x50c86a1ee0c053c1), UINT64_C(0xb2f5b3ae0521ad5c) }},
+  {{ UINT64_C(0x62e495847246f71c), UINT64_C(0x5756063576b6fe52), UINT64_C(0xb50ade920134bc90), UINT64_C(0x90da6855ae4fdb96) }},
+  {{ UINT64_C(0x810064c9b3dbb99a), UINT64_C(0x31e71d0d00ea3160), UINT64_C(0xd809ac4b3f32a2fe), UINT64_C(0xb397a9eef4db96e7) }},
+  {{ UINT64_C(0x154a029671617312), UINT64_C(0xad4f0c30742c6979), UINT64_C(0x10d4e2c4b314f07a), UINT64_C(0xe26ebaa0f01f16d9) }},
+  {{ UINT64_C(0x4a89bb30352c0802), UINT64_C(0xacb3cf3fb0b9ce89), UINT64_C(0xe83694eae7a34199), UINT64_C(0x089c53e38db73209) }},
+  {{ UINT64_C(0xa68abbd83dffa962), UINT64_C(0xc5038b159a22fc72), UINT64_C(0x5fa06bebd5a0b819), UINT64_C(0xa225bb26e34bee1c) }},
+  {{ UINT64_C(0xa32e3792313e6284), UINT64_C(0x7532113dda906f2a), UINT64_C(0xfd885609bdf129e5), UINT64_C(0x5d501590bdea55ad) }},
+  {{ UINT64_C(0x99e02ffacdda1fca), UINT64_C(0x9fe8f2f0888d60cb), UINT64_C(0xa0684ef8a8980dd1), UINT64_C(0xf995964b05d37f57) }},
+  {{ UINT64_C(0xd1e24fd2e3df245a), UINT64_C(0x7653804c5458c3e7), UINT64_C(0x67e73badf4506ef3), UINT64_C(0xa6eede2f4bb9eb0d) }},
+  {{ UINT64_C(0x350e69881c03be2a), UINT64_C(0xa30987abb7aa4d79), UINT64_C(0xbdac8a7ed5387d27), UINT64_C(0x1597ae785fb59082) }},
+  {{ UINT64_C(0x74214e091c3281aa), UINT64_C(0xdb7a8050c9e29f65), UINT64_C(0x38dbd5a9dd4ab7cc), UINT64_C(0xca5a417063c9a517) }},
+  {{ UINT64_C(0x332fb48e9a53b076), UINT64_C(0x17f8b3f766bf6460), UINT64_C(0x9c9d5ae6b915522d), UINT64_C(0x4a4cd2217cc5ad66) }},
+  {{ UINT64_C(0x552d4226fa49736e), UINT64_C(0x510a5032c2e92194), UINT64_C(0x0e4b52e47e97ad70), UINT64_C(0x2385d1e2a3aa06f2) }},
+  {{ UINT64_C(0xe247bfe3fd3bf44a), UINT64_C(0x1fa618de266131b7), UINT64_C(0xd81a549d6f63d845), UINT64_C(0x5126d449a2329ac7) }},
+  {{ UINT64_C(0xd53ee5efe4f6bafc), UINT64_C(0x9154ebb4b97f9f6d), UINT64_C(0x9b9a3bacda670913), UINT64_C(0xb8f5f90ba5fe3994) }},
+  {{ UINT64_C(0xe8cf5b9d6b3526b0), UINT64_C(0xa76ff4e981ddd5fa), UINT64_C(0x15f9ba5ec2d19467), UINT64_C(0x13ed2b8bb68e0f5d) }},
+  {{ UINT64_C(0x51d2df187c550c46), UINT64_C(0xb0ed58b412d0020d), UINT64_C(0x642dac8bd97d764d), UINT64_C(0x3467e20bd92bb0a4) }},
+  {{ UINT64_C(0xd9567830956a1340), UINT64_C(0x3bcd6af03706b1ae), UINT64_C(0x80119b797764086a), UINT64_C(0xe9233152fb3da71f) }},
+  {{ UINT64_C(0xfbcdbbc529ba0d42), UINT64_C(0x5166ad4900001ef4), UINT64_C(0x186d9d3736d8780b), UINT64_C(0x49e6fbab2be7c6a8) }},
+  {{ UINT64_C(0x356fe297d4c55cb0), UINT64_C(0x68cffa48e8631f87), UINT64_C(0xbd464c51800dd625), UINT64_C(0x662caca0886d335b) }},
+  {{ UINT64_C(0x762327f7f6f9d9fc), UINT64_C(0x7bcf2a8eac42a45c), UINT64_C(0x6baa16efb361bf8b), UINT64_C(0xd9758a1e05003aea) }},
+  {{ UINT64_C(0x0d494f4b45cde3e8), UINT64_C(0x3c22d22128370e17), UINT64_C(0xf9c218a6c1a9e7c6), UINT64_C(0x8b904a8f47797f1b) }},
+  {{ UINT64_C(0xc0db8b520e32dbc4), UINT64_C(0xefd8a82b9e76da76), UINT64_C(0x24acaccc45247f87), UINT64_C(0x5e5a71112ccae9a3) }},
+  {{ UINT64_C(0x5666427e31731eee), UINT64_C(0x6e10c80ecfa12121), UINT64_C(0x9b049beda3b80770), UINT64_C(0x4c922788d7bd134a) }},
+  {{ UINT64_C(0xbb1c8d47eed9d40c), UINT64_C(0x9621a56f7e7c1b11), UINT64_C(0x2e15f234297414c8), UINT64_C(0xceb232335d607af7) }},
+  {{ UINT64_C(0xb3bd0c7d8a7a89a4), UINT64_C(0xb346a10ca08f2913), UINT64_C(0xd75f509a5ecec672), UINT64_C(0x934e67ad5816636c) }},
+  {{ UINT64_C(0x51ff0cad160d265a), UINT64_C(0x67d6744bfd1286c6), UINT64_C(0xd3a2c7ad7405ea67), UINT64_C(0xb537caa9a5f49df8) }},
+  {{ UINT64_C(0xcf4ba0117c668f12), UINT64_C(0x49468b7a7e83aa5b), UINT64_C(0xa94a94cee647f636), UINT64_C(0x8f14b742d903f290) }},
+  {{ UINT64_C(0xa337372304b705f8), UINT64_C(0xc78ddfab4eedd259), UINT64_C(0xd41a0ab1a65c0279), UINT64_C(0xd696f073d3e003c8) }},
+  {{ UINT64_C(0x002d2752e8b11ca8), UINT64_C(0xcc2472446ff76ae6), UINT64_C(0x6a20f0ac273297b2), UINT64_C(0x976eaabdf60d0a51) }},
+  {{ UINT64_C(0x7b52868682df2966), UINT64_C(0x34f1e8dbcece2c08), UINT64_C(0xc524b1301a09fd95), UINT64_C(0x9d50044eb79c35ec) }},
+  {{ UINT64_C(0x9dac83af64a3d4e0), UINT64_C(0x0ce18ec95a6649e4), UINT64_C(0x077f69fde8732760), UINT64_C(0x7377d36b22e4e803) }},
+  {{ UINT64_C(0xc751741208b0a1f4), UINT64_C(0x6da53a07acc5d7d2), UINT64_C(0x3e55c9fb6ba951be), UINT64_C(0x7e2d9ec01cdcc85c) }},
+  {{ UINT64_C(0x268a826ea5ed989e), UINT64_C(0xbdf4782ed6ca96f7), UINT64_C(0x038cfcd568ebd312), UINT64_C(0x6c92d932cf839203) }},
+  {{ UINT64_C(0x75d43bf7b83087ae), UINT64_C(0x4bb1943dea543b27), UINT64_C(0x2539821c7fd3e3d8), UINT64_C(0xf12644f3bac5b421) }},
+  {{ UINT64_C(0x31b85d5597a70f4e), UINT64_C(0x31df18f5067eb334), UINT64_C(0x521e4ccc8ee7060a), UINT64_C(0x4b239c18d98b342d) }},
+  {{ UINT64_C(0x9605c6b4eee692ae), UINT64_C(0x828db2808d678485), UINT64_C(0x5c8242a65fbc9f6f), UINT64_C(0xb6002a9c4d475146) }},
+  {{ UINT64_C(0x79c6aed37e917bba), UINT64_C(0x3e90b0c1b0a9ae62), UINT64_C(0x53e6825665d150c6), UINT64_C(0x13bb101edfdc1fc3) }},
+  {{ UINT64_C(0xcdd57553b58e4d8c), UINT64_C(0x20180c43dd412be0), UINT64_C(0xe5e95b890c783838), UINT64_C(0xda6fc90acad7804c) }},
+  {{ UINT64_C(0xf1a0b2387dfc130e), UINT64_C(0x700b3ac66f627e28), UINT64_C(0x8c4079f648835560), UINT64_C(0xc88fe95ddec2d1c9) }},
+  {{ UINT64_C(0x2d8b43844dc3d45c), UINT64_C(0x43d1e4327d0e3677), UINT64_C(0xe0441082a65f3a96), UINT64_C(0x40a314ca7ca7e686) }},
+  {{ UINT64_C(0x739d181d423dba4a), UINT64_C(0xd72d783f4809dc40), UINT64_C(0x250b4b64be4120bc), UINT64_C(0xf8656c7be7df4055) }},
+  {{ UINT64_C(0xcd1f3f475f3fb94e), UINT64_C(0xb577ec89ab19b710), UINT64_C(0xcf0b0a8081672b9b), UINT64_C(0xd2c2e27d364cec92) }},
+  {{ UINT64_C(0x7701612d3cca10b0), UINT64_C(0xb85adb03130dd0f6), UINT64_C(0xe0e221cbc16878fe), UINT64_C(0x3633b1cfa731debd) }},
+  {{ UINT64_C(0x72f124f15119a30c), UINT64_C(0xbfc73abb98e0243f), UINT64_C(0xeb92aaf180b3f9d2), UINT64_C(0x0e97bc80d89e0fa7) }},
+  {{ UINT64_C(0xacd732b3de622e54), UINT64_C(0xa3e2cb38a5ed181a), UINT64_C(0xffd75bff2cd6895b), UINT64_C(0xd95d9b97e8599971) }},
+  {{ UINT64_C(0x68e534615d4191d0), UINT64_C(0x73145a84a6dd99e1), UINT64_C(0xfab29f02afd672a1), UINT64_C(0x823b83d6d0041123) }},
+  {{ UINT64_C(0x4dfb76b4a5bf1616), UINT64_C(0xe91e06ec5dd16d45), UINT64_C(0x95bea9b79f510747), UINT64_C(0x54f44a5e0644576d) }},
+  {{ UINT64_C(0x23e75d82727113f6), UINT64_C(0xeece20733c5fbf72), UINT64_C(0x5c1faf877c1342b1), UINT64_C(0x282684c6bdea489a) }},
+  {{ UINT64_C(0x517799b72b97fff4), UINT64_C(0xeb95c5387d4ae0ee), UINT64_C(0xd260147fb029924c), UINT64_C(0x6b0716b48880972e) }},
+  {{ UINT64_C(0x0ca9a9526f549366), UINT64_C(0x739695b96e5de7fa), UINT64_C(0xe64e5c5b2b8a31c0), UINT64_C(0x4b5e9e339b4fb042) }},
+  {{ UINT64_C(0x01f6277de19a77ac), UINT64_C(0xf650500b1069611f), UINT64_C(0xd7abaa1dea651ec4), UINT64_C(0xaa4c1955fd9e7f08) }},
+  {{ UINT64_C(0x828f18c4bb54d630), UINT64_C(0x93ec228b6916fac1), UINT64_C(0xdbc413f3203e787b), UINT64_C(0x1192b9da9c4e1347) }},
+  {{ UINT64_C(0x821370983ce4a780), UINT64_C(0x6609c073d1d8a9b6), UINT64_C(0xdbdfd7418c5bdac3), UINT64_C(0x8a67eb8a513a4909) }},
+  {{ UINT64_C(0x1dec0c2a0185414c), UINT64_C(0x0c7d89e6ed21ccc1), UINT64_C(0x047e774e79e5f880), UINT64_C(0x77b5f2d42ae6bf81) }},
+  {{ UINT64_C(0xef76f2a10d37c28a), UINT64_C(0xf6bbc68d68cb352c), UINT64_C(0x6724a7b168edd0de), UINT64_C(0x0ed3d362dc48a37c) }},
+  {{ UINT64_C(0xb438c4ea1e1847e4), UINT64_C(0xcb9cd8f0d7c8ef5f), UINT64_C(0xe741eb0859d2ea20), UINT64_C(0x7515e1d733c35e48) }},
+  {{ UINT64_C(0x0c32dbeaefffc388), UINT64_C(0x6d0eb7c6020331e8), UINT64_C(0x4924575a9c0410dc), UINT64_C(0x0a5b48da49f951f1) }},
+  {{ UINT64_C(0x1210e8ad41a55a0c), UINT64_C(0xa68ed6c4989be62a), UINT64_C(0x5375cac4a69452d4), UINT64_C(0x6ed8324e6bc24836) }},
+  {{ UINT64_C(0xb0d1c3dd4ece1d00), UINT64_C(0xc9dd4f1e9cdda7a3), UINT64_C(0x54ad7ea32d9ad4cb), UINT64_C(0x152707a7e427eb40) }},
+  {{ UINT64_C(0xf4c7329f37bf1440), UINT64_C(0xaf0ada4716147b6d), UINT64_C(0x94fb9dc9314bbe3b), UINT64_C(0x9f43a92fcc7c1067) }},
+  {{ UINT64_C(0x7b097cc000104df0), UINT64_C(0x3a5b073ec7e23829), UINT64_C(0x4c468e790ef955be), UINT64_C(0x2f878436adbad8fa) }},
+  {{ UINT64_C(0x8376682c4d2cc7d8), UINT64_C(0x5a6587682499310b), UINT64_C(0x5d8662a30147c235), UINT64_C(0xc05afbf96d498e2e) }},
+  {{ UINT64_C(0xc5d63095d3df3cfc), UINT64_C(0x8a26dfcf5d396f1a), UINT64_C(0x42ecb0b31ebd1db5), UINT64_C(0x0727dbac9fd36e05) }},
+  {{ UINT64_C(0x5d47a4e4389208b6), UINT64_C(0x94ea2ab90c4b1f5a), UINT64_C(0x7eb204faa5a0e5dc), UINT64_C(0x3f41767c3d793a18) }},
+  {{ UINT64_C(0x828cb371d5919f9e), UINT64_C(0xdc985e3f462eacab), UINT64_C(0x2b61ed56d903e768), UINT64_C(0xf82007c9a47631dc) }},
+};
+
+static const mzd_local_t L_2[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0xeffcdb74f18797e6), UINT64_C(0x7c2281a4ee8ae589), UINT64_C(0xc753ca47bc369278), UINT64_C(0xf9a6350a33d829cd) }},
+  {{ UINT64_C(0x7e21327980115a78), UINT64_C(0x59229b2d2ec214df), UINT64_C(0xf852beae4f85aae4), UINT64_C(0x9a46dd115ba4fa69) }},
+  {{ UINT64_C(0xff1b569ea14be2de), UINT64_C(0x070cf2698f96f35a), UINT64_C(0xe85b8f91a19bc8b3), UINT64_C(0x8531f995accfb54b) }},
+  {{ UINT64_C(0x24fdd86a2c6efc8c), UINT64_C(0xbd94c90587426721), UINT64_C(0xc5e29170e39012bd), UINT64_C(0xea70b17bee039170) }},
+  {{ UINT64_C(0xf9e643bfc03d4ee4), UINT64_C(0xab28c1fbed125061), UINT64_C(0x5b2f0349a1c6cad9), UINT64_C(0xa7be5cba13797fa4) }},
+  {{ UINT64_C(0x8f292d6518931b98), UINT64_C(0xb0c84e0ad8222a13), UINT64_C(0x8005191fdab8ec77), UINT64_C(0x86ca96b4314acaf7) }},
+  {{ UINT64_C(0x91bf06ea197dce3a), UINT64_C(0xab899707c6bb0049), UINT64_C(0x9262717484c17b61), UINT64_C(0xf29098dc005972ea) }},
+  {{ UINT64_C(0x83e9bf5124c117fc), UINT64_C(0x45bb3fc646b4def9), UINT64_C(0x8e6890c616fdc344), UINT64_C(0x97c6d4b30d149b24) }},
+  {{ UINT64_C(0xc431d55a0673e2fe), UINT64_C(0x9eb0512f2291e32e), UINT64_C(0x54e5fad1cbf752e1), UINT64_C(0x0dcab11083e7f7d7) }},
+  {{ UINT64_C(0x2225c2eb74f04efa), UINT64_C(0x7ee33a71616c19ac), UINT64_C(0x3615e8ef81599340), UINT64_C(0x768d3233689e55f7) }},
+  {{ UINT64_C(0xb0cd0ec2e084c90e), UINT64_C(0x6182ed3d7d98f3ac), UINT64_C(0x21b20bffe7a40a93), UINT64_C(0x8dd5aa86404ae0f3) }},
+  {{ UINT64_C(0xb48f873e92e3bc20), UINT64_C(0x8aa36050ca4d25fb), UINT64_C(0x1ca9882c7bd7fad5), UINT64_C(0x6fd463024992619a) }},
+  {{ UINT64_C(0x1f40a171546624a6), UINT64_C(0xf64e6775c866a89c), UINT64_C(0x4a41b89304c6bdfd), UINT64_C(0xae9c1b93f58472c6) }},
+  {{ UINT64_C(0xf5d6095c96ca9c90), UINT64_C(0xa5b518ea6f283442), UINT64_C(0x82c1e53e162835af), UINT64_C(0x3f57f477d57809a9) }},
+  {{ UINT64_C(0xc4d9f21710aa07c8), UINT64_C(0xfcef182618623c14), UINT64_C(0x63d540cf9d0e5ad9), UINT64_C(0xff8e71e2fe230601) }},
+  {{ UINT64_C(0x619a259dc922c8b8), UINT64_C(0x5d067ea7c783eee5), UINT64_C(0xa19d85380a4b8310), UINT64_C(0x1d8542caeddd3bda) }},
+  {{ UINT64_C(0xf3b5bd2555fb1598), UINT64_C(0x427a62524458de77), UINT64_C(0xa765ebbde7700b86), UINT64_C(0x969298ea7771b3df) }},
+  {{ UINT64_C(0xfe2fe8b665c9156e), UINT64_C(0x28205958842a109f), UINT64_C(0x353a34da2bd1fa2c), UINT64_C(0x4937470866920c69) }},
+  {{ UINT64_C(0x47a0fa3eb16302f0), UINT64_C(0x0fdfcac5b37c3567), UINT64_C(0xa72111a0de8d289b), UINT64_C(0x954fce01c4fb0314) }},
+  {{ UINT64_C(0x68bd57058e3a0ee8), UINT64_C(0xc53a9ff38a625d47), UINT64_C(0x66e99724a907b6b6), UINT64_C(0x37a224f967e6f234) }},
+  {{ UINT64_C(0x0d52ae9d893e4e26), UINT64_C(0x5cbf2c335dd867b2), UINT64_C(0x397af6df9b45035f), UINT64_C(0xf6e43621e5d6aa0f) }},
+  {{ UINT64_C(0x83c77a445485b6f2), UINT64_C(0xde7df78968390e09), UINT64_C(0xa022d76172f5513f), UINT64_C(0xa6e60e2c20b88aa7) }},
+  {{ UINT64_C(0xa99ea4fd512ae634), UINT64_C(0xc0f0b7a0338cee27), UINT64_C(0x00d6439e4a6937d4), UINT64_C(0x8f34f841cbf909aa) }},
+  {{ UINT64_C(0x37d3e01046b480f6), UINT64_C(0xbe1de66b9e2a1c38), UINT64_C(0x1f02d4c1e093e2cc), UINT64_C(0x0564075d90502fa1) }},
+  {{ UINT64_C(0x5eec2aa47d6b4506), UINT64_C(0x38c5919a5f15d8f9), UINT64_C(0xea1d5368ecba3eca), UINT64_C(0xb1e7705b0db2884a) }},
+  {{ UINT64_C(0x99aa84f4ac905a0e), UINT64_C(0xf87f83533ef9e063), UINT64_C(0xd45d178174bd367b), UINT64_C(0xe79d5907704e2781) }},
+  {{ UINT64_C(0xb9fcd7bf01012cbc), UINT64_C(0xf1bfec731abe6084), UINT64_C(0x5fa7274b496f1c1f), UINT64_C(0xe806174ad2d8b0bb) }},
+  {{ UINT64_C(0x910704fc91e3d6f2), UINT64_C(0xcee64e686ae98c28), UINT64_C(0xd03a2cc8a6103c34), UINT64_C(0xcd57a8ec4fe35383) }},
+  {{ UINT64_C(0xe3e64fdf90236920), UINT64_C(0x05a0e265c5a1ed99), UINT64_C(0x570ad838aade1a3f), UINT64_C(0x727eda3053e4fa18) }},
+  {{ UINT64_C(0x203b6a039cb41192), UINT64_C(0x027d817c946e2b02), UINT64_C(0x98681ad450a9916a), UINT64_C(0x546a50e46780e54c) }},
+  {{ UINT64_C(0x29120e890b61869e), UINT64_C(0x90cc257d6f8899e0), UINT64_C(0xf4acc13992e039e5), UINT64_C(0xc5d2dfbf77b5d8d1) }},
+  {{ UINT64_C(0x966dd8bec71be33e), UINT64_C(0x488f4cae192f0341), UINT64_C(0xd40856132a2d3ee8), UINT64_C(0x3e158c6a51f734a2) }},
+  {{ UINT64_C(0x2545f75e70ce8c5c), UINT64_C(0xb820ba6beebddf89), UINT64_C(0x3ba714650ad9cce5), UINT64_C(0xd76f9db2ae0aaeaf) }},
+  {{ UINT64_C(0x7b2f064732483e50), UINT64_C(0x65d6f5cbd0f5540a), UINT64_C(0x0562c4c162d027d6), UINT64_C(0xfc8de2833cdb278d) }},
+  {{ UINT64_C(0xcd2404feed7b0ad6), UINT64_C(0x9b86f68dc12e9e81), UINT64_C(0xc32196c6ea6bb715), UINT64_C(0x77694d053634b8fa) }},
+  {{ UINT64_C(0x5f02ecc7b87a55d6), UINT64_C(0xf6e0b532b1172e12), UINT64_C(0x038f59bf9a6478ee), UINT64_C(0x6db6730963e95b25) }},
+  {{ UINT64_C(0xb17f370130fdd6a4), UINT64_C(0xbf25a7dd421877a1), UINT64_C(0x2c5ff8033dd2e622), UINT64_C(0x88fe69d2b3d63818) }},
+  {{ UINT64_C(0xc83c838687e65720), UINT64_C(0x38f14722e7190679), UINT64_C(0xeb3167d1ab91e161), UINT64_C(0x5ac23d275f06cbef) }},
+  {{ UINT64_C(0x9a5d668a18fc6fde), UINT64_C(0xa0c56d23ea98b7d2), UINT64_C(0x273cba48c5e86bec), UINT64_C(0x99691390cc9db06c) }},
+  {{ UINT64_C(0x1bff4abc00e7ff46), UINT64_C(0x72395ed6f62f03ba), UINT64_C(0x4f93309d3eb134cb), UINT64_C(0x022618359ca63106) }},
+  {{ UINT64_C(0xb7631a2d923fe98e), UINT64_C(0xacd4dc13fc532c95), UINT64_C(0x968d1094b8a122ab), UINT64_C(0x4be27bb0f2c28981) }},
+  {{ UINT64_C(0x4b12f7db6f6eb148), UINT64_C(0x9bb07806f11252aa), UINT64_C(0x4cedd7377f7d7951), UINT64_C(0xd72769c9c34da121) }},
+  {{ UINT64_C(0x7264a20923ccf44e), UINT64_C(0xf9455a4ecdc242f6), UINT64_C(0x6a05801114397d84), UINT64_C(0xc6524e55a9cefc32) }},
+  {{ UINT64_C(0x87b19cf28a11f7e2), UINT64_C(0xed4f68de547c01ef), UINT64_C(0xddbf46d167df2b16), UINT64_C(0x6b8b4e09789d8fa6) }},
+  {{ UINT64_C(0x9cb48cc5b077caf0), UINT64_C(0x000eb1897b678093), UINT64_C(0x91089ad75b2e60cc), UINT64_C(0xd936509287dc69f6) }},
+  {{ UINT64_C(0x42ee52ccbbb57a1c), UINT64_C(0x16c3c3c191ed4a8e), UINT64_C(0xb72be1ec936e9aff), UINT64_C(0x56d2cd4076dad9fb) }},
+  {{ UINT64_C(0xbf501db309be7cf2), UINT64_C(0x85568f571cafd0c1), UINT64_C(0x13cdaa215efb80e2), UINT64_C(0x0e8ebb691f6b6411) }},
+  {{ UINT64_C(0xcb689fab6bbc7ffc), UINT64_C(0x05c1ae5902adb684), UINT64_C(0x0c9851dc4feaebed), UINT64_C(0x127dab9b7dd1ce44) }},
+  {{ UINT64_C(0x71855dee36910962), UINT64_C(0x3f5f9806e2749bd1), UINT64_C(0x7fd214d1b8774834), UINT64_C(0x771ff6ee03b6afeb) }},
+  {{ UINT64_C(0xb9add2f66500606e), UINT64_C(0x239dfad1df286835), UINT64_C(0x3e94781ac048c23b), UINT64_C(0xae5f7932cf48e1ce) }},
+  {{ UINT64_C(0x495340a2e2020ee2), UINT64_C(0x200fab88dea2a59c), UINT64_C(0xe2de975e120d6480), UINT64_C(0x11945af49d33a410) }},
+  {{ UINT64_C(0x96faa3a8f3d55e24), UINT64_C(0x651344d2da5bfdf2), UINT64_C(0xdf238093f05b8b2f), UINT64_C(0xb819209e064a83fc) }},
+  {{ UINT64_C(0x1fdd11c6bd4eda86), UINT64_C(0x0e344f2982cfe5e3), UINT64_C(0x5661a1e808d8c74c), UINT64_C(0xc10bfa5265f06367) }},
+  {{ UINT64_C(0x11c39cb704523426), UINT64_C(0x8b29cd21af15ecf4), UINT64_C(0xb0eb44cc75b5b3e5), UINT64_C(0xbec69ad4344678fd) }},
+  {{ UINT64_C(0x3405760f959c6066), UINT64_C(0x29de65e523c342da), UINT64_C(0x6c8687b759d90355), UINT64_C(0xf3a4d2acb9ba16d7) }},
+  {{ UINT64_C(0x711db128b61b0a8e), UINT64_C(0xda4e41a4aeade744), UINT64_C(0xabe91e01f76adc54), UINT64_C(0xcea06d39a0074b75) }},
+  {{ UINT64_C(0x215dec262a949746), UINT64_C(0x300d7ae367f2a780), UINT64_C(0x09a0a84c0a639f8c), UINT64_C(0x626f7d408f00070b) }},
+  {{ UINT64_C(0x2dceff5cf6c3561c), UINT64_C(0x564927e293f6405c), UINT64_C(0xcd4f9e04b96a751b), UINT64_C(0xdc14a6eee0691121) }},
+  {{ UINT64_C(0x05848cdddf2e291c), UINT64_C(0x8c48158d4ca70953), UINT64_C(0xc069d0b6a2095fe1), UINT64_C(0xdc9bbf4a24212627) }},
+  {{ UINT64_C(0x147def38d3672f14), UINT64_C(0xfc0d564104fb5460), UINT64_C(0xf21a2e97a276ffb0), UINT64_C(0x8fa72be35d7403f7) }},
+  {{ UINT64_C(0xc142004a14d7f6bc), UINT64_C(0xd0fc5e659f5f172b), UINT64_C(0x5ae959110e71f43b), UINT64_C(0x6e308cd03f42d0d2) }},
+  {{ UINT64_C(0x07d4bcacba217d26), UINT64_C(0xb38e0b51fb10de5b), UINT64_C(0x8be7394d135dcbd9), UINT64_C(0xcaeeb89f233a651b) }},
+  {{ UINT64_C(0x5a433dbcfab27d00), UINT64_C(0xf7eb9532074276ea), UINT64_C(0x53af6df1c316fe66), UINT64_C(0xb7217fccfef4e232) }},
+  {{ UINT64_C(0xf6d4a279114e0d46), UINT64_C(0xc952281c5fd919f9), UINT64_C(0x5bf92cce13adc00e), UINT64_C(0x5432ab31b1170e04) }},
+  {{ UINT64_C(0x90136dcb2f6b3380), UINT64_C(0x964555bcd7e6f814), UINT64_C(0xe76c263fcc2cf510), UINT64_C(0x442e4efafc251bb9) }},
+  {{ UINT64_C(0x1805d06fb4c3ebf4), UINT64_C(0x0bedc8de2800cf44), UINT64_C(0x7c00a7af7c767723), UINT64_C(0xeb0b63309cdf579f) }},
+  {{ UINT64_C(0x9c2406238727fd3c), UINT64_C(0xeee701ae6b6bb1ab), UINT64_C(0xc03b1b1a8e3172ba), UINT64_C(0x56a48ebcb22acc03) }},
+  {{ UINT64_C(0x9539a2cf979c7038), UINT64_C(0x0787e087f6f147af), UINT64_C(0x897f5b290110ef27), UINT64_C(0xa676ea7cd29bd75a) }},
+  {{ UINT64_C(0x55c803bd0187f492), UINT64_C(0xbed35e7142e80033), UINT64_C(0x2c87470e9d228156), UINT64_C(0xf00fa4e67329b638) }},
+  {{ UINT64_C(0xcc11dec7edb66a7c), UINT64_C(0x6bdb4322c99e67b4), UINT64_C(0x54e4eb79539d8b5a), UINT64_C(0x01849f141144161d) }},
+  {{ UINT64_C(0xbe51a978031e89d4), UINT64_C(0x852e939c7e09c01c), UINT64_C(0xef5bf1efdf795278), UINT64_C(0x000538e77e7f7075) }},
+  {{ UINT64_C(0xd36d59dd52c98f02), UINT64_C(0xb8eef1427f46a7cd), UINT64_C(0xee3c84dc24006210), UINT64_C(0xb9f3701d26ccbcc7) }},
+  {{ UINT64_C(0xdcbcf3c83b7e2494), UINT64_C(0x9535e6b4211ef895), UINT64_C(0xda94562cb5a27b0c), UINT64_C(0x10b37bb7c4b19bb6) }},
+  {{ UINT64_C(0x60623f031d1520f2), UINT64_C(0x280fc537ee3d405c), UINT64_C(0x4a6419c2d786ecc3), UINT64_C(0xfdd04672b25b3f7b) }},
+  {{ UINT64_C(0x556bd80c79c7dcbc), UINT64_C(0xfd84ace2c3c3a850), UINT64_C(0x935dce77bfe9aca2), UINT64_C(0x6a4c67db4c915b77) }},
+  {{ UINT64_C(0x37c7e92f7e262d06), UINT64_C(0x2346f6f87304f9cf), UINT64_C(0xcc5217b3599f88d7), UINT64_C(0x8499a012bcfc6ec6) }},
+  {{ UINT64_C(0x3c77d9855099167e), UINT64_C(0x31539f98891f1e2c), UINT64_C(0xc445f6b0b8c5b5f4), UINT64_C(0x6c4d34fe8e3f5ec9) }},
+  {{ UINT64_C(0xe05d700e71c12fd6), UINT64_C(0x4e9a52763d1862ee), UINT64_C(0x0c14f06c326a33cb), UINT64_C(0x386ce8d695e3af07) }},
+  {{ UINT64_C(0x595eb0893915048e), UINT64_C(0xa93275ba2462b144), UINT64_C(0xd885ab89672f45a5), UINT64_C(0xc81744b01e5e69ef) }},
+  {{ UINT64_C(0x54b7a43c885609f6), UINT64_C(0x44c20bdfc7ccb2e1), UINT64_C(0x39ee63524191d669), UINT64_C(0x719db0cac87b4c78) }},
+  {{ UINT64_C(0x77f509ee1223026a), UINT64_C(0x697e880ab4560dad), UINT64_C(0x1c8fb8e61c0fee52), UINT64_C(0xe7f6c949604f6550) }},
+  {{ UINT64_C(0xbc10c71de73aafd6), UINT64_C(0x6be8ea13d1f1cb0d), UINT64_C(0x0ec3dcc732960a19), UINT64_C(0xe7086d626479b155) }},
+  {{ UINT64_C(0x98cad7188199b47a), UINT64_C(0x5596ba7eb60f231b), UINT64_C(0x3d08671b8081bdcb), UINT64_C(0x810e483ccf662c01) }},
+  {{ UINT64_C(0x8761d09b030a2e42), UINT64_C(0xff4ff7c44a38d1f3), UINT64_C(0x91e05ca39a4aa8da), UINT64_C(0x1e014af561c2a68c) }},
+  {{ UINT64_C(0x45370b1ebe046dc0), UINT64_C(0xbcd9d9ae9233bac0), UINT64_C(0x73fcd17b7f3a7594), UINT64_C(0x5aa61ac0c504df47) }},
+  {{ UINT64_C(0xca7be54ec6e479b4), UINT64_C(0x9ead653025b806b4), UINT64_C(0xf362d468323aa9f0), UINT64_C(0x7a1d039a7cf434cc) }},
+  {{ UINT64_C(0x2619fe9cd3c4b19a), UINT64_C(0x27c264b67ba85d80), UINT64_C(0xb4d81daac4be18d2), UINT64_C(0x7d6750b05b187381) }},
+  {{ UINT64_C(0x0fbf91442ea244a0), UINT64_C(0xf95f83329d4958dc), UINT64_C(0x23ebbec3ba2d2521), UINT64_C(0x79086928968a5d4b) }},
+  {{ UINT64_C(0x57f5a063c89dd9ea), UINT64_C(0xfc76604ad244be01), UINT64_C(0x853fbb1dd7c52bf3), UINT64_C(0x54229caa023c506d) }},
+  {{ UINT64_C(0x28318d2f9c84fed0), UINT64_C(0x985202362cce179a), UINT64_C(0x9f4fa6325e47c1a3), UINT64_C(0x7658d63f7e91ed22) }},
+  {{ UINT64_C(0x790ba2555a2d3b78), UINT64_C(0xb7f6fb6b7ee56252), UINT64_C(0x3611d60a5aa11781), UINT64_C(0x6f015a6442651725) }},
+  {{ UINT64_C(0x0add134874121594), UINT64_C(0xba69136689db3563), UINT64_C(0x6d0ec5de5d0967a3), UINT64_C(0xc3ca65b10401c5ff) }},
+  {{ UINT64_C(0xf11024ce2de9663c), UINT64_C(0x8f7e2ec25384758c), UINT64_C(0x6aab756fcd1587b7), UINT64_C(0x8f37a104518de1a5) }},
+  {{ UINT64_C(0xea1bb9bf5cf784a6), UINT64_C(0x0a351acc11cbd46d), UINT64_C(0x709bc544128c28de), UINT64_C(0xef3f1f1b4119ff5f) }},
+  {{ UINT64_C(0xd16577ccd650dc0e), UINT64_C(0xf4ea51395b2f88b2), UINT64_C(0xe6260400af59b557), UINT64_C(0x72e364c66532742b) }},
+  {{ UINT64_C(0x1b75b6525b17bafc), UINT64_C(0x9dd43d9f52482c73), UINT64_C(0xd9256e250684a0c4), UINT64_C(0x1eab35ebf5bd959d) }},
+  {{ UINT64_C(0x1a58419c7aa2b822), UINT64_C(0xfd9b5448eef03f63), UINT64_C(0x49dd4f02babe6b1a), UINT64_C(0xb5b03398afd63a1c) }},
+  {{ UINT64_C(0x72aba9d1be6acf34), UINT64_C(0x93b6fe001e0898a7), UINT64_C(0xc9c0843d88c17b6c), UINT64_C(0x5f6c95546476f310) }},
+  {{ UINT64_C(0x6664892025010dd2), UINT64_C(0xe11f378f2b32ed09), UINT64_C(0x903d10192e73c7e5), UINT64_C(0x65e83f36d2f7cf53) }},
+  {{ UINT64_C(0x5fa55fc6aa33ddae), UINT64_C(0x986ecaa89a47a8a3), UINT64_C(0x0bed50cdf3fc815a), UINT64_C(0xea890b8af3f460ab) }},
+  {{ UINT64_C(0x184c4f611f809c3c), UINT64_C(0xd641a18bcc838e1d), UINT64_C(0x7b9fb2ada8851929), UINT64_C(0x65be74348550f419) }},
+  {{ UINT64_C(0x39b96a0932246fb8), UINT64_C(0x2908d070720f4967), UINT64_C(0x3bf11bfcf932d492), UINT64_C(0xbb08f2647cc15371) }},
+  {{ UINT64_C(0x6a1e5a3fde309d60), UINT64_C(0xf1fc014a22c73a35), UINT64_C(0x0cff2302f7b3bd06), UINT64_C(0x2c23ba494404ed36) }},
+  {{ UINT64_C(0x65306a611a89cede), UINT64_C(0x8343aec3901a6d07), UINT64_C(0xbaf9ecd7960c663f), UINT64_C(0xfb0ef5b401f64b60) }},
+  {{ UINT64_C(0x1a1e4a2a96ed29f0), UINT64_C(0x3ab581a04ae79508), UINT64_C(0xe2a2290c4820e330), UINT64_C(0x08056aff7bf9c4cf) }},
+  {{ UINT64_C(0x10ad6f754c046534), UINT64_C(0x125dc50d7f19b39d), UINT64_C(0x3fc52ce5f6bca917), UINT64_C(0xd9a85adbe0af0d79) }},
+  {{ UINT64_C(0x9743b47de4ce0730), UINT64_C(0x296022a39eafc771), UINT64_C(0x07512fe2a16f6777), UINT64_C(0xb52864684222a3af) }},
+  {{ UINT64_C(0x9950b67d577648b6), UINT64_C(0x5570bfb0303c78d4), UINT64_C(0x5c79419c08f5cdf0), UINT64_C(0x93972493e6ff8cce) }},
+  {{ UINT64_C(0x3c0bc1f565194652), UINT64_C(0x1336eb74cde95aa5), UINT64_C(0x58f036f0dee515b7), UINT64_C(0xae75478d53aad8a1) }},
+  {{ UINT64_C(0x33541b1a99a25eb0), UINT64_C(0x1ce483bcabca5046), UINT64_C(0x20da5654ac5085ac), UINT64_C(0xd45af4a70de34c69) }},
+  {{ UINT64_C(0x28bf7839e3a5b3d6), UINT64_C(0x4b21f51b24087cb6), UINT64_C(0x5391c40957890e3f), UINT64_C(0xee844fb479ed9caf) }},
+  {{ UINT64_C(0x1458c8206259c550), UINT64_C(0x9fedbf2e27965eb5), UINT64_C(0x29f48f02e7c01cf4), UINT64_C(0xb00cb73c56a6f399) }},
+  {{ UINT64_C(0xe5131048fde2487e), UINT64_C(0x899c6f52e5c3cc14), UINT64_C(0xae5c48f83e585135), UINT64_C(0xb2c51d8933a06511) }},
+  {{ UINT64_C(0x0e6ff4db6a5f9e46), UINT64_C(0x65df67c65023bb85), UINT64_C(0xf0f632a161582d0c), UINT64_C(0xced513a484ceb268) }},
+  {{ UINT64_C(0x65f622d174ecd27a), UINT64_C(0xe450fd068161e84e), UINT64_C(0x26733ae25ea5acd3), UINT64_C(0x5a865a8c787e7ee6) }},
+  {{ UINT64_C(0xb238977ed20bbf00), UINT64_C(0xf938242bfb4b6982), UINT64_C(0x9795f0e0b813cdd3), UINT64_C(0x4e5f1bf704b78246) }},
+  {{ UINT64_C(0xc81acc19d778e104), UINT64_C(0xc47ae09cf86289ef), UINT64_C(0x8ce9e9a3bbcd0238), UINT64_C(0x236035707367c256) }},
+  {{ UINT64_C(0x9550857f76c30c28), UINT64_C(0x2fd6ddaa77a6a46b), UINT64_C(0xc30f4d0bf129e0b5), UINT64_C(0xbe2d9655d733a0d5) }},
+  {{ UINT64_C(0x320e5a2c2184f0fa), UINT64_C(0x3c4dbd0a0bcaad3b), UINT64_C(0xff63e850ed853bd5), UINT64_C(0x8b25ad2817e13f1d) }},
+  {{ UINT64_C(0xf841aedc13e03aca), UINT64_C(0x863822509400cec0), UINT64_C(0x55bee20b374653eb), UINT64_C(0x55f871c75819efea) }},
+  {{ UINT64_C(0x9bee781dd8557cb0), UINT64_C(0x996c4dfbd84c7300), UINT64_C(0x9df141bf307de87e), UINT64_C(0x5407901b6797eccd) }},
+  {{ UINT64_C(0xffcb6a3ecd0b57da), UINT64_C(0x20733b6712ac48af), UINT64_C(0xdf05a19ab0c3a242), UINT64_C(0xf4aed1858468287f) }},
+  {{ UINT64_C(0xa48a468b00d2d592), UINT64_C(0x845ba4eb02e28f38), UINT64_C(0x64c3863687d279c1), UINT64_C(0xa7d810a34471c3c2) }},
+  {{ UINT64_C(0x973a902beaa361d2), UINT64_C(0xb0c5fca400b6767b), UINT64_C(0x83256ba45c5beeb6), UINT64_C(0xb7f4272bb2fb2420) }},
+  {{ UINT64_C(0xe9ea2a3daabfd096), UINT64_C(0x0920963413912a73), UINT64_C(0xd61d8cba0700f491), UINT64_C(0x75dc30898f7e3287) }},
+  {{ UINT64_C(0x1837f246ed132eec), UINT64_C(0xc9941f391b5e06ec), UINT64_C(0x08cc8649cc820d68), UINT64_C(0x650d0526bc6cc5f6) }},
+  {{ UINT64_C(0xf716c5fd3675ba7c), UINT64_C(0x3102b6657888c0cd), UINT64_C(0xd6e6c9af747feea2), UINT64_C(0xe6b350af5ecb3686) }},
+  {{ UINT64_C(0xc66ab78b060d35e2), UINT64_C(0x9d6c430362054ed1), UINT64_C(0x9833ea7614731925), UINT64_C(0xdaa401c1e0a696c1) }},
+  {{ UINT64_C(0xbdb49bc7c87bb6a6), UINT64_C(0x006bef5c2dd669af), UINT64_C(0xdc9eb70d9e843d36), UINT64_C(0xee64725e6ee6d124) }},
+  {{ UINT64_C(0xb216551c2f413218), UINT64_C(0x013da882dea87d1b), UINT64_C(0x71f790dfe0181add), UINT64_C(0x3be51704ffde28d3) }},
+  {{ UINT64_C(0xf6743d818d0bc46e), UINT64_C(0xa708d77c22f846a3), UINT64_C(0x1c39c363ea355278), UINT64_C(0x2bbb35845a9cdb8f) }},
+  {{ UINT64_C(0x368514a072956b9c), UINT64_C(0x24c457d1f1a20295), UINT64_C(0x291b43cef09391d8), UINT64_C(0x06e4b7daf1c8ed42) }},
+  {{ UINT64_C(0x8b4f38fda900e14a), UINT64_C(0x2510ec4a5d58a0f6), UINT64_C(0xeb1b320c927aea40), UINT64_C(0x8caacbb95c2bc677) }},
+  {{ UINT64_C(0x5729988fd5823f3c), UINT64_C(0xfdc40c5aa3cd90d8), UINT64_C(0x3a986517a3a9f7ff), UINT64_C(0x9223cefb93b3be65) }},
+  {{ UINT64_C(0x121d6e276a70a612), UINT64_C(0xc0c6988865e544b9), UINT64_C(0x5f729bc1967cd37d), UINT64_C(0x5cf8307381662b73) }},
+  {{ UINT64_C(0xd97d693fa3a97c16), UINT64_C(0x3096b04b36aa3a61), UINT64_C(0xec6c15d027d19ad1), UINT64_C(0x63e31720de80a686) }},
+  {{ UINT64_C(0x2a8742cada71eae0), UINT64_C(0x269a19cdb4019a49), UINT64_C(0x19181ea31201eba1), UINT64_C(0x5b61695410670aed) }},
+  {{ UINT64_C(0x053614d23773bf62), UINT64_C(0x191f9d0abbf3f87d), UINT64_C(0xdf161559f4f215a5), UINT64_C(0x8e97c53db858c0e1) }},
+  {{ UINT64_C(0x9ef528bbe07dbd5e), UINT64_C(0x10a1b96933c15497), UINT64_C(0x0a798f77e74f0ccd), UINT64_C(0x465efae6c7e51993) }},
+  {{ UINT64_C(0x11235269413d2024), UINT64_C(0x3b51b842d8871936), UINT64_C(0x5c00c9bc3f87734c), UINT64_C(0x878fac16fb3544b3) }},
+  {{ UINT64_C(0x0fc7bc6c8cf6ed46), UINT64_C(0x449942c7df85ed3a), UINT64_C(0x44f40316a2ee732b), UINT64_C(0x554ab6d76057abb5) }},
+  {{ UINT64_C(0xe42cec006238bae2), UINT64_C(0xc4a3638533a6ba20), UINT64_C(0x06056ae0964909fe), UINT64_C(0x578f80a8ac5e77be) }},
+  {{ UINT64_C(0xd3920a96529f912e), UINT64_C(0xd82636f48d758a72), UINT64_C(0xb181d3f07c4b5ff3), UINT64_C(0x09648c99a2f5e2df) }},
+  {{ UINT64_C(0x619757c5bdc5fe5e), UINT64_C(0x8ad870aa018afb73), UINT64_C(0xd8db183800352b2a), UINT64_C(0xb3924a77d494b7ed) }},
+  {{ UINT64_C(0xca13770177d4bcb2), UINT64_C(0xb5d311511356031e), UINT64_C(0xe4841c099543221d), UINT64_C(0xc2a92018c2244538) }},
+  {{ UINT64_C(0x6586aff775e0bd54), UINT64_C(0xa24e751522f81dc8), UINT64_C(0x31a67ecd114f3c29), UINT64_C(0x5f7d579528d54c8c) }},
+  {{ UINT64_C(0x555536a8623810ec), UINT64_C(0x43372f0018880440), UINT64_C(0x0a8d58d2313a9cb8), UINT64_C(0x5f72736458433a3a) }},
+  {{ UINT64_C(0x161c0cb4c77f2d6a), UINT64_C(0xcdd831347ee3c79a), UINT64_C(0x3e6cee393e1ec026), UINT64_C(0x51bbfd3ab616dcd6) }},
+  {{ UINT64_C(0xacc72a2c902fb3ce), UINT64_C(0x1edb6dd7733757b7), UINT64_C(0x867b793c24d2ace7), UINT64_C(0x67dc2a946ba9c1da) }},
+  {{ UINT64_C(0x07fdb1f22e82ed68), UINT64_C(0xd22074c8df1f8622), UINT64_C(0x334d234aa27c4e70), UINT64_C(0xa7e82068ae674d45) }},
+  {{ UINT64_C(0x87dc2a22489e78a4), UINT64_C(0x4ec117b4c7a627d2), UINT64_C(0x118981993da993a7), UINT64_C(0x136598c9d35125be) }},
+  {{ UINT64_C(0xd35a2f93f531bd2a), UINT64_C(0x4ea0f82f78662ee3), UINT64_C(0xf885c3818ebb3039), UINT64_C(0x3d54b47f62435936) }},
+  {{ UINT64_C(0x3cf4e382f153d91e), UINT64_C(0x12b24ccf74d89298), UINT64_C(0x65588c5d44b96854), UINT64_C(0xb90408f096297963) }},
+  {{ UINT64_C(0x27cffcd9d2cf0e54), UINT64_C(0x1ce1cd39198f6f1a), UINT64_C(0x8b8ee8f61529aa18), UINT64_C(0x95b0f76e5b321c02) }},
+  {{ UINT64_C(0x32816e86aa094f0a), UINT64_C(0xaab527ae0ec4609e), UINT64_C(0xe72b3402a53e1730), UINT64_C(0x8653c7371ad7f3f0) }},
+  {{ UINT64_C(0x22bf7e3e45a23c58), UINT64_C(0x7200c300355c1831), UINT64_C(0x0add9fa43bef8c25), UINT64_C(0x94dcce1ed84f4713) }},
+  {{ UINT64_C(0xed3ed778d4c6f9d6), UINT64_C(0x0883d49ce9f83bc6), UINT64_C(0xf3465101522cbd65), UINT64_C(0x0a385af5453719df) }},
+  {{ UINT64_C(0x14027cfb56b4a2a6), UINT64_C(0xa1362c3be32ffc20), UINT64_C(0x7ae4c1819ef7df8e), UINT64_C(0xc1000103cccdb709) }},
+  {{ UINT64_C(0x73d38b04f407c2ce), UINT64_C(0x6605a4fcb2336f97), UINT64_C(0x5a18b0c1dd4e1d84), UINT64_C(0x67298a68957c4915) }},
+  {{ UINT64_C(0xe27b2215520ed4b2), UINT64_C(0x6433940001a6ea81), UINT64_C(0x04ae9bfd93d3e193), UINT64_C(0xe2aae85cc931e41d) }},
+  {{ UINT64_C(0x67234718d84b8a1c), UINT64_C(0xe4121621657afbb9), UINT64_C(0xc4a67c4371ff30f2), UINT64_C(0xafc5f9f2a5603a5a) }},
+  {{ UINT64_C(0xb3ed6cedf79e7d06), UINT64_C(0x7e3b5c0b08bf6ee4), UINT64_C(0x5de2a1c35f370b1c), UINT64_C(0xf0a7ee94c3db3293) }},
+  {{ UINT64_C(0x53d538cafe73bb2c), UINT64_C(0x1b19fb854abd127d), UINT64_C(0x997b088158a8cf72), UINT64_C(0x773e5bcfd23dc37e) }},
+  {{ UINT64_C(0x1236417081c8d1c8), UINT64_C(0x0f0cfb3c4d2076a2), UINT64_C(0xb3bcfca8572511a1), UINT64_C(0xbf972c928fd88724) }},
+  {{ UINT64_C(0x2ceeb351574fbf08), UINT64_C(0xd6c3eeb1d38b405b), UINT64_C(0xf60710fe883e5384), UINT64_C(0x3afe022263fbec16) }},
+  {{ UINT64_C(0x568d713ebf0c7518), UINT64_C(0xe0460919002ba23d), UINT64_C(0xa16083b9b4c59eee), UINT64_C(0xc1a73189082a2ac3) }},
+  {{ UINT64_C(0x3a2c18e19f96e136), UINT64_C(0x62b77c1dde07adc2), UINT64_C(0x3842bb6500db3d1c), UINT64_C(0xb87590e7337a532f) }},
+  {{ UINT64_C(0xa135aa72a372bf1a), UINT64_C(0x6d4db6f3245d0bd3), UINT64_C(0x908e0c811c728b51), UINT64_C(0x3ca464ef4cfec55a) }},
+  {{ UINT64_C(0x5edbf7bbafa9230a), UINT64_C(0x186907e643a2dc90), UINT64_C(0xd737890dec4432ce), UINT64_C(0x22caa71c257b7b26) }},
+  {{ UINT64_C(0x38b696236dd811e0), UINT64_C(0x01d3da03d0f034aa), UINT64_C(0x9db21ed2011f1e98), UINT64_C(0x29b8b0bb9800aa9a) }},
+  {{ UINT64_C(0xbb76bcb9eea6ff56), UINT64_C(0xf82dc47651f8925a), UINT64_C(0xebe8996b67f0d94b), UINT64_C(0xe78175261dd4d16a) }},
+  {{ UINT64_C(0x3af629da6afc76d2), UINT64_C(0x63b973d4ebbb660a), UINT64_C(0xa2672c88b8955998), UINT64_C(0xb8978546bfddc7e3) }},
+  {{ UINT64_C(0x36f7513e48a25ee2), UINT64_C(0x565174f26b277cf7), UINT64_C(0x2508e633ee7bd98e), UINT64_C(0x1fd23b362ac89aa2) }},
+  {{ UINT64_C(0xca94039b6d02c1ca), UINT64_C(0xea87df7d6b1ee77d), UINT64_C(0xc2734294a875fc88), UINT64_C(0xb9e80c5c17eb1a62) }},
+  {{ UINT64_C(0xba75c2e7ac44f2fc), UINT64_C(0x8a0a0ddbbddc7c5e), UINT64_C(0xd1e3e0ab92b07611), UINT64_C(0x51d2144b2e64827c) }},
+  {{ UINT64_C(0xf279e838b74caf0e), UINT64_C(0x7bb2fa5a25d97f22), UINT64_C(0x2697ff5b1504659d), UINT64_C(0x0c537d8260352a13) }},
+  {{ UINT64_C(0x3237f7b45102730e), UINT64_C(0xc1aab2784fa9aa73), UINT64_C(0xdb77963c4a75f9a3), UINT64_C(0x28bf45f865eafb21) }},
+  {{ UINT64_C(0xd24a09d2ba8645de), UINT64_C(0x136f5063782d766f), UINT64_C(0x66b4211d21efed3d), UINT64_C(0x98fd0839f8ffac83) }},
+  {{ UINT64_C(0x9f048a8b700e5280), UINT64_C(0x3d917fefb7082faa), UINT64_C(0x25672fbfd40fc613), UINT64_C(0xcf28b16597acaaf2) }},
+  {{ UINT64_C(0xe9ea7b06f1219c00), UINT64_C(0x703049309b21aa05), UINT64_C(0x31f61e4de718f0e8), UINT64_C(0xd1574012d41695da) }},
+  {{ UINT64_C(0x210f016a55658720), UINT64_C(0x0330e7178835c6fc), UINT64_C(0xbbe7f2de492853ae), UINT64_C(0x9e6931f64e0fd54c) }},
+  {{ UINT64_C(0x707335cfd1ad50b6), UINT64_C(0x818ffa6813336a35), UINT64_C(0xb2a6ae3c898d7fb3), UINT64_C(0xdbf3ea90f68f2d0a) }},
+  {{ UINT64_C(0xdbc455029b0f4a54), UINT64_C(0x029522bc64b1347c), UINT64_C(0x9177b58f02d3456f), UINT64_C(0x054c8af0bbca4843) }},
+  {{ UINT64_C(0x987c5a89ff2a8c4a), UINT64_C(0x86250e20daadf9f4), UINT64_C(0x9300ce11885c0c26), UINT64_C(0x8b3833783dd9edc3) }},
+  {{ UINT64_C(0xfed7275ceb8a0148), UINT64_C(0x41812e5ac65e8656), UINT64_C(0x8846fc9a668d4ff8), UINT64_C(0x0dc6a1f6520fc083) }},
+  {{ UINT64_C(0x4932abd8673cd0ea), UINT64_C(0x8d3c9c02bc96242d), UINT64_C(0xa361bc14419c5a1a), UINT64_C(0x6099446fadb594a8) }},
+  {{ UINT64_C(0x80522451df64deb2), UINT64_C(0xa7edd2a7e47db101), UINT64_C(0xf62357aeec1a480c), UINT64_C(0xc3ccea4f8ad61bf4) }},
+  {{ UINT64_C(0x33a423463601a010), UINT64_C(0xbbf1e7f576a10857), UINT64_C(0xf8496b8c1b06919d), UINT64_C(0x6dc45c529c45f694) }},
+  {{ UINT64_C(0x086559061a559186), UINT64_C(0x23922ef40f7ac29e), UINT64_C(0x5928c9fb37dc5912), UINT64_C(0x472beb94594acb88) }},
+  {{ UINT64_C(0x34317a9e932c1aa4), UINT64_C(0x3b04625f41fb3451), UINT64_C(0x898c2b5856614955), UINT64_C(0x3640014f9216d786) }},
+  {{ UINT64_C(0xef0eb535ea9469c6), UINT64_C(0x32b0fa995d623902), UINT64_C(0x45db78b499ca1484), UINT64_C(0x3ba6ca0ae250f537) }},
+  {{ UINT64_C(0x315658a01500e71a), UINT64_C(0xd098942d3898b54c), UINT64_C(0x76054cb430fcaddb), UINT64_C(0xdde09eca6a8c4d58) }},
+  {{ UINT64_C(0x3f6f11fc5ac2a666), UINT64_C(0x36753da2f81641a6), UINT64_C(0x0e0ba7e0aeb2a524), UINT64_C(0x8124f7f4f36ce1f7) }},
+  {{ UINT64_C(0xfb03eb9db4b12a1e), UINT64_C(0xfe0c699909fdfff0), UINT64_C(0x086e00249bd4a66b), UINT64_C(0x32816b94fe877703) }},
+  {{ UINT64_C(0x8652cbc3b3f7e7ec), UINT64_C(0x248ebe1c85693a3b), UINT64_C(0x40520285934fa37a), UINT64_C(0x558d4ec4332d9ed4) }},
+  {{ UINT64_C(0xa834037455d722a8), UINT64_C(0x28ceda39476f716c), UINT64_C(0xcac0b8e76bdb0c98), UINT64_C(0x36a24b2e2f118799) }},
+  {{ UINT64_C(0xbc9b4d21e0edeffe), UINT64_C(0xfde4ef0ce57690dc), UINT64_C(0x27f9551bf7e75a52), UINT64_C(0xa875deddabbf55d8) }},
+  {{ UINT64_C(0xde80aed7826ec464), UINT64_C(0xdf2dd8d092019671), UINT64_C(0x38fb9ba2a6271d04), UINT64_C(0xea63abb72e8e7f62) }},
+  {{ UINT64_C(0x84243b0d61c3a416), UINT64_C(0x0dc61b4b8a4f7ecc), UINT64_C(0x2cb056d5c7bc1eb6), UINT64_C(0xbd04e71b2fcbb85d) }},
+  {{ UINT64_C(0x164338e024083b0c), UINT64_C(0xaf0246a3fbb6a2f9), UINT64_C(0xfbe24c5d01cb7f69), UINT64_C(0x18e0a1ed56795b0f) }},
+  {{ UINT64_C(0x2bdbc6ffb38c5782), UINT64_C(0xe8513ab726386e66), UINT64_C(0x55bf19b60a29d317), UINT64_C(0xfe2a8357fa099075) }},
+  {{ UINT64_C(0xbb7a095adb817d0c), UINT64_C(0x489a62ec870fe107), UINT64_C(0x8627e8ffd080695b), UINT64_C(0x82dc7c946ea0b721) }},
+  {{ UINT64_C(0xb5f32c89185dd4cc), UINT64_C(0x80a0727822c7d23a), UINT64_C(0xbd7ae9bd3c54e631), UINT64_C(0x1ed8fbd40b9aa4c4) }},
+  {{ UINT64_C(0xab2619ca8e19a82a), UINT64_C(0x8d3b8036c7f68133), UINT64_C(0xc371ae20bc7a63c5), UINT64_C(0x6c7cc55159df7660) }},
+  {{ UINT64_C(0x254621b361bd4292), UINT64_C(0x7a2dab4c60c12a27), UINT64_C(0x27af24bdda7ca7cf), UINT64_C(0x0aed5b417a39e264) }},
+  {{ UINT64_C(0x85389d0b0590692e), UINT64_C(0xc7387f0271959531), UINT64_C(0x61c68c6d55871c7d), UINT64_C(0x61f1d90c64ed3129) }},
+  {{ UINT64_C(0x88715c2e76f196de), UINT64_C(0x02aaab3babe86371), UINT64_C(0x7e450e2a6d3a917d), UINT64_C(0x18f015660f4109a6) }},
+  {{ UINT64_C(0xc70b5f7b7d50561c), UINT64_C(0x3e4baa444b001290), UINT64_C(0x285519f22f4bc825), UINT64_C(0x0132193ca0380af1) }},
+  {{ UINT64_C(0x5fb967304b12d79c), UINT64_C(0x0c73bb47423004c3), UINT64_C(0xcd8281ef0d025fd9), UINT64_C(0x75858f95b10b737e) }},
+  {{ UINT64_C(0xcf86773a21c6780c), UINT64_C(0x9226d424f2e665ee), UINT64_C(0x9c2a4778ce6b749f), UINT64_C(0xa9e5bdb6fedcd6ea) }},
+  {{ UINT64_C(0x6b06d4d5cb6d034e), UINT64_C(0x627c650cb997e857), UINT64_C(0x584afef9997c2708), UINT64_C(0xa0ed0ba030f0e51e) }},
+  {{ UINT64_C(0x86e62426e19752c4), UINT64_C(0x609b162fa8de7d51), UINT64_C(0xf270a5333e51ddf8), UINT64_C(0x384e867979cc2bf8) }},
+  {{ UINT64_C(0x3ce6286e56fbfbe8), UINT64_C(0x3aa90b71f83cf953), UINT64_C(0xa29b6a06fb39e71f), UINT64_C(0x4bc024240dec484d) }},
+  {{ UINT64_C(0xd6e0e87728fcedea), UINT64_C(0x480f3be3648947af), UINT64_C(0x4bc965b21c26d8d4), UINT64_C(0xe84d13e14c85e6a3) }},
+  {{ UINT64_C(0xd010fc8642d934e2), UINT64_C(0x9f728ed52e55fc8f), UINT64_C(0xa136683ff0cc511e), UINT64_C(0xf364b663ae55af0c) }},
+  {{ UINT64_C(0xb4fd1418965f4bf2), UINT64_C(0x9c76834a41807c2b), UINT64_C(0x319337f518b1061d), UINT64_C(0xef1c96183a8fbdbd) }},
+  {{ UINT64_C(0x089c4a36fbb842de), UINT64_C(0xab64272fdc186201), UINT64_C(0xaeb44fc6e49f2685), UINT64_C(0xbb9bb9a5507a6832) }},
+  {{ UINT64_C(0x19ee639d292f114a), UINT64_C(0x8c87c85938bfa386), UINT64_C(0x1e1f5fd431870adb), UINT64_C(0x7eaaf8ddf0068201) }},
+  {{ UINT64_C(0xed9eb220abcf475e), UINT64_C(0xaefac0f3522cde63), UINT64_C(0xc895ee415a2d03a1), UINT64_C(0x1faa423ec5579fca) }},
+  {{ UINT64_C(0x77e1d7f7957428da), UINT64_C(0x27a54369bd851f93), UINT64_C(0x38befc3b83e8b390), UINT64_C(0x53428869b4d48c88) }},
+  {{ UINT64_C(0x0a76d9c0f6350578), UINT64_C(0xf7f5a8a914746245), UINT64_C(0xacd93af24e112672), UINT64_C(0xb6e1f6a57d29a94e) }},
+  {{ UINT64_C(0x7d2fdbdc173d698c), UINT64_C(0xedb4f13b8127cf05), UINT64_C(0xfe0a57b96fb692d3), UINT64_C(0x6cbbc0fb862d71fe) }},
+  {{ UINT64_C(0xcbf8f7aca2fe9faa), UINT64_C(0xaec743539d2f688d), UINT64_C(0x5c27bbd157d28788), UINT64_C(0xf03512551ddb3671) }},
+  {{ UINT64_C(0xa7e7b157deb21644), UINT64_C(0xcbaaafcab94db7b3), UINT64_C(0x54e0ad2308276d23), UINT64_C(0x90a7dd4c69117da9) }},
+  {{ UINT64_C(0xbafc11645479a882), UINT64_C(0x921569e8e2fd599e), UINT64_C(0x2a2905cbe3d85da6), UINT64_C(0x4f19535657858b65) }},
+  {{ UINT64_C(0x06119b9ea7b861a2), UINT64_C(0x864062141167c8c8), UINT64_C(0x7371fb7a534f4fb3), UINT64_C(0x829de28be8ec27ba) }},
+  {{ UINT64_C(0x4c6b0ebc8fb0d156), UINT64_C(0x5fb4ad7280d21954), UINT64_C(0xabb9b609978a0e22), UINT64_C(0xc12aa67042007a07) }},
+  {{ UINT64_C(0xdef65026a0ed2c22), UINT64_C(0x2e01437f8a252716), UINT64_C(0xde3175023ed197a3), UINT64_C(0x67df0990e468de57) }},
+  {{ UINT64_C(0x0e198492c8c6f4d2), UINT64_C(0x2b0c38c5cc530b40), UINT64_C(0x7a1b21aaa6d4cec4), UINT64_C(0x9a657988ce9a919b) }},
+  {{ UINT64_C(0x551ae9c314bd3c3c), UINT64_C(0x3045e83352aec294), UINT64_C(0x13b9044a1ee797d0), UINT64_C(0xb7e545e16bc24f07) }},
+  {{ UINT64_C(0x9cce637eaa3547de), UINT64_C(0x680acb3013aa3d70), UINT64_C(0xf8628503125cea18), UINT64_C(0x2110117764ab5559) }},
+  {{ UINT64_C(0xbb61598c2924820a), UINT64_C(0x61504a3a0de7dd3f), UINT64_C(0x1954066f7df60bf1), UINT64_C(0xeec31c0e96e11cac) }},
+  {{ UINT64_C(0xb1c15ae3d71cd2f6), UINT64_C(0x733dcf5313df3321), UINT64_C(0xea4d8e8d6629822e), UINT64_C(0xf7c7ce6d83edfa11) }},
+  {{ UINT64_C(0x70a4ee54078bf080), UINT64_C(0xb25fca403ffd27f9), UINT64_C(0xbb577670a6e03845), UINT64_C(0x711f3a4ed0561776) }},
+  {{ UINT64_C(0xa080e63f0a6ff68e), UINT64_C(0xd45860a53a153e51), UINT64_C(0xe80045a074b20a6d), UINT64_C(0x4f2c672396efa335) }},
+  {{ UINT64_C(0x1de91c919c84ed18), UINT64_C(0x0ad70a5dc04430d0), UINT64_C(0x1502c52a0f68858e), UINT64_C(0xa423fb1214a38051) }},
+  {{ UINT64_C(0xca46abef1917f848), UINT64_C(0x725b7ec578b198cf), UINT64_C(0xe84f7a57d73d70d4), UINT64_C(0x3916ae9b11c456df) }},
+  {{ UINT64_C(0xc450e0622c2080c2), UINT64_C(0xfe885e6c4327d10b), UINT64_C(0xe003a3f93efa1a7b), UINT64_C(0x908fdb0213ba4406) }},
+  {{ UINT64_C(0xe909a642255aa50e), UINT64_C(0xf164f6135ff15e68), UINT64_C(0x7649f2d53ce14c6a), UINT64_C(0x5502f5b0582f1d12) }},
+  {{ UINT64_C(0x39a1b94e2e4c5b66), UINT64_C(0xfdf29edac3c3c67c), UINT64_C(0x30728716c7e15ef9), UINT64_C(0xc9327cc6033c5617) }},
+  {{ UINT64_C(0x231c29e351534556), UINT64_C(0x57c837a263153f4e), UINT64_C(0xba37a09e7ca43ef5), UINT64_C(0x7ed3e5bfe57c90f5) }},
+  {{ UINT64_C(0xf1a01b82402c4ee0), UINT64_C(0x63abaaef47de0114), UINT64_C(0x97211d2a7a24a0c2), UINT64_C(0xfe1129fa77ff5a97) }},
+  {{ UINT64_C(0xeedd1f38e8c92ae6), UINT64_C(0x4a4577c91ae9bf62), UINT64_C(0x25013c36fc69372c), UINT64_C(0xa8dc466099cd6860) }},
+  {{ UINT64_C(0x276a336234523336), UINT64_C(0xc66e82309ba4494f), UINT64_C(0xc3872f5c00ffe59d), UINT64_C(0xad211f138f10bbec) }},
+  {{ UINT64_C(0x6e5ce4e0f90501a6), UINT64_C(0x42a0be23af8757e6), UINT64_C(0xfdc1d86b01cb56b6), UINT64_C(0x49663a11dfc5e6e8) }},
+  {{ UINT64_C(0x08f9a646d86c709a), UINT64_C(0xc89d726e991efd24), UINT64_C(0x4ee17505c4acb87d), UINT64_C(0x78c2df8382f91f44) }},
+  {{ UINT64_C(0xa707482543150980), UINT64_C(0xfe9e27a4ddbf2a7e), UINT64_C(0x63cf28ed2b182998), UINT64_C(0x7a80305268e83f4a) }},
+  {{ UINT64_C(0x9f5b8cf0e1f3c2c0), UINT64_C(0x2e6e103b7348428e), UINT64_C(0xb790dcda0c80f6e2), UINT64_C(0x4b658d7a30fbb22f) }},
+  {{ UINT64_C(0x7ebc8bb544e27ab6), UINT64_C(0x332c839ae88063c7), UINT64_C(0xcb24066f8c8b5bd2), UINT64_C(0x00d954848a74e0b4) }},
+  {{ UINT64_C(0x05a16cb1022e2a46), UINT64_C(0x0f22653813852d12), UINT64_C(0x6134824c6fc99f95), UINT64_C(0x151645f9bd9692ea) }},
+  {{ UINT64_C(0x053c57fa558fdcf0), UINT64_C(0x07eac2ad6c778355), UINT64_C(0xd346eaec412b284b), UINT64_C(0x6c152b6590d7571b) }},
+  {{ UINT64_C(0x557e52e93ce53ec8), UINT64_C(0x12f91146d6a5a095), UINT64_C(0x551dbb145c92affd), UINT64_C(0x2e0cb4323fa7d831) }},
+  {{ UINT64_C(0x28750b09a7a3a656), UINT64_C(0x5d0d4e9a38978433), UINT64_C(0x78ff314d33a01e8d), UINT64_C(0xc0a761b9c13fc6e0) }},
+  {{ UINT64_C(0x1433c3330c143158), UINT64_C(0xdf445b81ca38389f), UINT64_C(0x794a4e27623a005b), UINT64_C(0x1b840a7c261812e9) }},
+  {{ UINT64_C(0x314ce8249e114c36), UINT64_C(0xaf0528edeb649b70), UINT64_C(0xa4a9961f71c27ae9), UINT64_C(0x1e6f98702339a01a) }},
+};
+
+static const mzd_local_t L_3[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0x99d5d25b7f19a1bc), UINT64_C(0xa619ff9e13186bb9), UINT64_C(0xee6a5170c80219ff), UINT64_C(0x644f20c69e238d45) }},
+  {{ UINT64_C(0xa9cb90154825c06c), UINT64_C(0x19ddbddc5320fcca), UINT64_C(0x34c0bd45fa5b7d06), UINT64_C(0xa729aebf5027bcf5) }},
+  {{ UINT64_C(0xafcf9c600187de66), UINT64_C(0xf50679683a794fb5), UINT64_C(0x01aecef73c3c870d), UINT64_C(0x81e45f0a100e0110) }},
+  {{ UINT64_C(0x01b5f1629f9c1640), UINT64_C(0x7d034609228c594e), UINT64_C(0xed5525a3218ec5b3), UINT64_C(0x8f51f878bc870c8a) }},
+  {{ UINT64_C(0xb6965a95674fa28e), UINT64_C(0xd46310aa7b6f12da), UINT64_C(0xec1e74ca5f286a02), UINT64_C(0x9c65dbb3bd1b9168) }},
+  {{ UINT64_C(0x9bb5a3b7e290638c), UINT64_C(0x2a9b0681d6b9d0f2), UINT64_C(0xaba77c21d6f81ceb), UINT64_C(0x4fa3f68a2931d0f2) }},
+  {{ UINT64_C(0x88d509769e7afef2), UINT64_C(0xcf131c3c3877fcdc), UINT64_C(0x0909e1a3cdc966a1), UINT64_C(0xb1d5de32c1d15188) }},
+  {{ UINT64_C(0x90dfa3b14cfbfd80), UINT64_C(0xecea4a83d4b348a0), UINT64_C(0xe01c75ea23ab8512), UINT64_C(0x36b6fbb767eb3c4c) }},
+  {{ UINT64_C(0xa07ebdcbdb726740), UINT64_C(0x0906eeacfc0fd290), UINT64_C(0x3a920b43e2defdff), UINT64_C(0x92c4c4874637b954) }},
+  {{ UINT64_C(0x2eab5201dfbf3ae6), UINT64_C(0x9da1f868009062c7), UINT64_C(0x5e58d2ffc184bc9d), UINT64_C(0x4e0dac749c42c142) }},
+  {{ UINT64_C(0xe79d3275f40b18fe), UINT64_C(0xe8269e619fd11d85), UINT64_C(0xe71028699f71c83c), UINT64_C(0x31635cd995dd6807) }},
+  {{ UINT64_C(0x3c9cbf2843f3f66e), UINT64_C(0xe08d05cd6b1b6265), UINT64_C(0x68a50e6ea650d35d), UINT64_C(0x4f23cbf561564658) }},
+  {{ UINT64_C(0x2143b9e7435cbba2), UINT64_C(0xb166eed2a63372c7), UINT64_C(0xafe5725402f466c2), UINT64_C(0xaf227293a4d6a4db) }},
+  {{ UINT64_C(0xd45775cad3e357e4), UINT64_C(0x44f1d4517633b76c), UINT64_C(0xda3dab1e1ec9f1cd), UINT64_C(0x80c4f75d4cf8b972) }},
+  {{ UINT64_C(0xd76e984fe0030bee), UINT64_C(0x636e5399b45a5953), UINT64_C(0x6d018e968a5e9cca), UINT64_C(0xa6a275b07bbde98e) }},
+  {{ UINT64_C(0xd1c3ea7301ae99dc), UINT64_C(0xb7f2272e46413f62), UINT64_C(0xfe96597518e4c23b), UINT64_C(0x3a1246c5b79fd156) }},
+  {{ UINT64_C(0x72b207c07c4b80aa), UINT64_C(0x3ced1529f79e4c38), UINT64_C(0xc3be3c3aefea4480), UINT64_C(0xe038cbf10d43ab13) }},
+  {{ UINT64_C(0x37a48ef4e198a8a2), UINT64_C(0x31de69b61d7bd8fd), UINT64_C(0x4a219130248b1b6b), UINT64_C(0x2b08420e801e2cb4) }},
+  {{ UINT64_C(0x952ae22f475fca6e), UINT64_C(0xd5eab202900d7421), UINT64_C(0x47665c2b5cbdcb30), UINT64_C(0xd98a95f1a35f94ba) }},
+  {{ UINT64_C(0x72ec54140e069f98), UINT64_C(0xf067ca724f83a129), UINT64_C(0x00200e3cf169eea7), UINT64_C(0x2e4e39905d54d816) }},
+  {{ UINT64_C(0xb2e98c75ec1f02ce), UINT64_C(0x0e3ea0c13bf7d729), UINT64_C(0x8c334e20ddfa9865), UINT64_C(0x5cf7f45e1e545596) }},
+  {{ UINT64_C(0x16bef0eed5a52eae), UINT64_C(0x97eee5005762b057), UINT64_C(0x32feb26d596b1551), UINT64_C(0x0fac3cf68999221b) }},
+  {{ UINT64_C(0x9d722e55a40c5148), UINT64_C(0x655c101797f975c6), UINT64_C(0x3c4ff0f5413c74ad), UINT64_C(0x2afb0879db3ee68a) }},
+  {{ UINT64_C(0x05c49d89f5075168), UINT64_C(0xf9493fa7fdc338bc), UINT64_C(0xc7b824b8c94a5085), UINT64_C(0x736fdc81c8ba6f32) }},
+  {{ UINT64_C(0x3b64c2c8ce33a1aa), UINT64_C(0x3d147b5100f2384e), UINT64_C(0x73dc67f4a0f1dce1), UINT64_C(0x658016cf2c3ede37) }},
+  {{ UINT64_C(0x7c298ffe7a80766e), UINT64_C(0xfdeea1048efd77fd), UINT64_C(0x02ff6f10a87fab61), UINT64_C(0xa572f3ee4605be71) }},
+  {{ UINT64_C(0x86da4dac22a077c4), UINT64_C(0x747dd4dc934a63d7), UINT64_C(0x82712093576c5fd7), UINT64_C(0x55b1f7f9afaf5abd) }},
+  {{ UINT64_C(0x6eed05850d684c9e), UINT64_C(0x70ceb4213e3d01d9), UINT64_C(0x7e93a4430b67c9ea), UINT64_C(0x5220b5ffa53af303) }},
+  {{ UINT64_C(0xcb8a384707f387d6), UINT64_C(0xe9944c2a0e826bfe), UINT64_C(0xd3d8b8452857ad24), UINT64_C(0x908bd23d2409a2cc) }},
+  {{ UINT64_C(0x235ed1d562246438), UINT64_C(0x48b58e25337e0790), UINT64_C(0x3053a5cd829150c6), UINT64_C(0x3344fb41642456b9) }},
+  {{ UINT64_C(0x8cfdddd5ca2a2976), UINT64_C(0xcced77b604b9e95a), UINT64_C(0xde46cfe0e4fc93a4), UINT64_C(0xdf94e48f90fbf331) }},
+  {{ UINT64_C(0x8cbd0038c3dd6c54), UINT64_C(0xfbf51dd9ee9423dd), UINT64_C(0x580b96b60cb0f2d5), UINT64_C(0xd6f3b133f33de7b5) }},
+  {{ UINT64_C(0xb4f62c7355f986e6), UINT64_C(0xfac5dfe693eb72bc), UINT64_C(0x794e31daa5752aad), UINT64_C(0xd5872d94d01a8e68) }},
+  {{ UINT64_C(0x1be61e52cfe58be8), UINT64_C(0x92daef66c64dab94), UINT64_C(0x72db2de6e1f04418), UINT64_C(0xc10e37d1e0404425) }},
+  {{ UINT64_C(0xa3c462e21c73a570), UINT64_C(0xa07ee0f13fa71462), UINT64_C(0x0faa3b271cefd73f), UINT64_C(0xfe09f2ef9e91a7eb) }},
+  {{ UINT64_C(0xd8a500fa39f4fe60), UINT64_C(0x255171e00da1824d), UINT64_C(0x2bd06f71d37ae6b7), UINT64_C(0x0b18a2a5c94d2de3) }},
+  {{ UINT64_C(0xf97d8445a51620a8), UINT64_C(0x1b501d4fe99f86f2), UINT64_C(0xbfc22fa0803e58e8), UINT64_C(0x403d904182eff0d6) }},
+  {{ UINT64_C(0x539b173d0528f082), UINT64_C(0x0f1931d92ac29def), UINT64_C(0x9bfb4789b8a240cd), UINT64_C(0x344f6c01e003671d) }},
+  {{ UINT64_C(0x1d3272b41c1de548), UINT64_C(0x2f77b76aa96ec347), UINT64_C(0x3129ce6d6071952b), UINT64_C(0xaf81d10a5ba22afe) }},
+  {{ UINT64_C(0xf447eed3ad52593a), UINT64_C(0x3a3164253ea1b260), UINT64_C(0x9acb3a6323f6f0be), UINT64_C(0xb7ddd96e003e5c36) }},
+  {{ UINT64_C(0xa1895cabb5cdba12), UINT64_C(0x49b4d61ad0614b56), UINT64_C(0x94e33af155e4edc4), UINT64_C(0x05a820eaefaf46c6) }},
+  {{ UINT64_C(0x3babb57b0a831a00), UINT64_C(0x564ca11bc580488b), UINT64_C(0x618d149b431b05f7), UINT64_C(0xe2920e7fc5d379a4) }},
+  {{ UINT64_C(0x71c2ba894ff1d194), UINT64_C(0x2a2172cac0faf696), UINT64_C(0xee2f2326a2cef9a3), UINT64_C(0x6a5179553bbf7bc9) }},
+  {{ UINT64_C(0x65b760a4e35ec778), UINT64_C(0x771292bbe3415015), UINT64_C(0xb2fa1abe92580ae2), UINT64_C(0xee88e85661a279f0) }},
+  {{ UINT64_C(0x06eda7b1ecb86890), UINT64_C(0x62c5def2d60d04cd), UINT64_C(0x81f20e8724bd49e7), UINT64_C(0x81a110beb2983dfe) }},
+  {{ UINT64_C(0xadcb63122750100c), UINT64_C(0x734c15881e5054d3), UINT64_C(0xec5d33baad4cc0b4), UINT64_C(0x6803c793c7557589) }},
+  {{ UINT64_C(0x59735bf1aef1a304), UINT64_C(0xf62ddfeab3b4b3fb), UINT64_C(0xb57200d2b24a7a43), UINT64_C(0x074f0b3c175207c7) }},
+  {{ UINT64_C(0xc3b6151f00fd389a), UINT64_C(0x250091604c7e89b4), UINT64_C(0x852ebe5c7cb21beb), UINT64_C(0x9a051e07b8d27885) }},
+  {{ UINT64_C(0xc95c1926f5ed76e2), UINT64_C(0x992aa6d38d1e950e), UINT64_C(0x65e64424907bb77f), UINT64_C(0x2a92bbbada22a41c) }},
+  {{ UINT64_C(0x302337d9e0262252), UINT64_C(0xef019b7fcc03a3e2), UINT64_C(0x3d23011ad490327b), UINT64_C(0x16d67e42377af10d) }},
+  {{ UINT64_C(0xc878b56cdf353f6c), UINT64_C(0x544ed68f864aff7a), UINT64_C(0xda8f14c3df1b7f37), UINT64_C(0xcb7381dbdd5ade17) }},
+  {{ UINT64_C(0xa0fa54726744c6d0), UINT64_C(0x577478afd2fcbc1c), UINT64_C(0xbcef7cb6518cc630), UINT64_C(0x13b65f87747ae6ff) }},
+  {{ UINT64_C(0x39da512a0a56ce0c), UINT64_C(0x6410b1b3ae1343d3), UINT64_C(0xd043bf6a3db43fa3), UINT64_C(0xdcb5a6536b6da899) }},
+  {{ UINT64_C(0xc8f6781a71866cc0), UINT64_C(0xa65cb9624af87b1b), UINT64_C(0x8b24aeccfd10b1f3), UINT64_C(0xc2cef7453aace50f) }},
+  {{ UINT64_C(0xb9e67ff49fcf7af0), UINT64_C(0xd2c67c522f9ad74b), UINT64_C(0xcf562f841e522bcc), UINT64_C(0xb42bd4977dfaaf82) }},
+  {{ UINT64_C(0x22426368a7d06f06), UINT64_C(0x6c49fbb6e285ef91), UINT64_C(0x53af36086e27ec93), UINT64_C(0x5c868d9ca02d1142) }},
+  {{ UINT64_C(0xbb61a40420e88a3a), UINT64_C(0xedc41c6c2bb94d1f), UINT64_C(0xf1e6a776a13748aa), UINT64_C(0x7f6d4a9d961ab44e) }},
+  {{ UINT64_C(0xa8db1f8e92e90e3a), UINT64_C(0x68b62f33cf96f02b), UINT64_C(0x1eb2d061083374a1), UINT64_C(0xcd85e72b5809703f) }},
+  {{ UINT64_C(0xd277f656b1f6e74a), UINT64_C(0xc8239251cb5311e6), UINT64_C(0x41c7171284609ea5), UINT64_C(0x6f46f4346f2589ba) }},
+  {{ UINT64_C(0xa94d07b4298c9202), UINT64_C(0x02502428948c01f1), UINT64_C(0xbddc57c63aab80b4), UINT64_C(0xcd33423dd76b3b21) }},
+  {{ UINT64_C(0xfd3e08e701758938), UINT64_C(0x4403901c6734991a), UINT64_C(0xc76eb9322933a829), UINT64_C(0xc9850135ade3f1ed) }},
+  {{ UINT64_C(0x35add520d0cf9386), UINT64_C(0x01befd50fe6e4159), UINT64_C(0x35a79a4f0ed13d19), UINT64_C(0xbdade28b0d5a9c4d) }},
+  {{ UINT64_C(0x3a6913d77e1e2532), UINT64_C(0x0ed52a1fea457d2c), UINT64_C(0x25da2d9acda2b578), UINT64_C(0xb2281aedbf60585d) }},
+  {{ UINT64_C(0xddbbce9e984b75d6), UINT64_C(0x5a6025a33ca86bb3), UINT64_C(0xadc2b44c3b65a853), UINT64_C(0x5c7acdaec85e73ce) }},
+  {{ UINT64_C(0x862c8dddb039336e), UINT64_C(0xfbf9db17768489a1), UINT64_C(0x322f9852beef2201), UINT64_C(0xc07942f5b2a11f01) }},
+  {{ UINT64_C(0x69f31d0e7fc2f194), UINT64_C(0x4196119f86c2881f), UINT64_C(0x0f0fc004872370b5), UINT64_C(0x721d4e37963956fb) }},
+  {{ UINT64_C(0xe73f8af228ac9366), UINT64_C(0x8d7db913c0d51092), UINT64_C(0x7f922d17346a492d), UINT64_C(0x305087f79690db0b) }},
+  {{ UINT64_C(0x60eb3e53c163bf04), UINT64_C(0x2690909e02d75ac3), UINT64_C(0xced370608eeb85d1), UINT64_C(0x0c6d7ec10b956623) }},
+  {{ UINT64_C(0xa7a2302815467f9a), UINT64_C(0xd0164f74bf5a796c), UINT64_C(0xa55576e5636ae184), UINT64_C(0x086161738b3ef4eb) }},
+  {{ UINT64_C(0x85fcd2096a72d060), UINT64_C(0x48806fc4e8e05ba2), UINT64_C(0xb442f6e39f323a92), UINT64_C(0x5dd782f422670900) }},
+  {{ UINT64_C(0x9c7dc908c68eb7fa), UINT64_C(0x6a535a27e8e0c1b8), UINT64_C(0x1a9adf41509985b8), UINT64_C(0x239ec1a3fbaf8aca) }},
+  {{ UINT64_C(0x2d9f3553fa63609a), UINT64_C(0xeb14f469f4fac110), UINT64_C(0xc627db9d35ff9ede), UINT64_C(0xe09d13a6b4e515d1) }},
+  {{ UINT64_C(0xfd34b01afb4b5ca8), UINT64_C(0xaff2d92957a0fa92), UINT64_C(0x4bc8f894a4e1dc3b), UINT64_C(0x8030351e160a97f3) }},
+  {{ UINT64_C(0xd768c2e29bf2d182), UINT64_C(0x726cf9d6af8cb58a), UINT64_C(0x7d8ba77add61638f), UINT64_C(0x7d0880448e7c57cb) }},
+  {{ UINT64_C(0x457cb4f24ed8565a), UINT64_C(0x71363b88a70c7e1f), UINT64_C(0xf069f511f7c0f718), UINT64_C(0xf72394fd109cf289) }},
+  {{ UINT64_C(0xd3e0090e7096d2be), UINT64_C(0x7a4fa3c2151ac2a1), UINT64_C(0x39dee92dc43931df), UINT64_C(0xfe840a6e11672152) }},
+  {{ UINT64_C(0xcc460e35708494e8), UINT64_C(0x2d0108987914d91f), UINT64_C(0x4188c977b69668af), UINT64_C(0x6d6cb811f2ec24eb) }},
+  {{ UINT64_C(0x80ff78612fb4b012), UINT64_C(0x1fa348d2c8e1e88a), UINT64_C(0x98586b3b7c678d65), UINT64_C(0x7816e3ab2c134205) }},
+  {{ UINT64_C(0x5e5637b7d20326e0), UINT64_C(0x08708558aa28df05), UINT64_C(0x5cc0a5a1336113cc), UINT64_C(0x35cce5ba4041a7af) }},
+  {{ UINT64_C(0x40ec9acdfe5de546), UINT64_C(0x080c0cb76ac9c745), UINT64_C(0x1a009c081d38c006), UINT64_C(0x4c994802196f3c36) }},
+  {{ UINT64_C(0x73b12f922828386c), UINT64_C(0xba371f3682d8dcc5), UINT64_C(0xc4f9f5f0f730726a), UINT64_C(0x6669fb598b9c1391) }},
+  {{ UINT64_C(0xc005673ba088dd94), UINT64_C(0x5990090a76591109), UINT64_C(0x15306ddb99b99ec1), UINT64_C(0xd487bc5fee7280be) }},
+  {{ UINT64_C(0xa3b3c557f500dcdc), UINT64_C(0x3e5dafa3c8edada4), UINT64_C(0x79d8da4a67887843), UINT64_C(0xb9d241e60c965300) }},
+  {{ UINT64_C(0x9f971fe5598689ea), UINT64_C(0x0072ff9f95b2370a), UINT64_C(0x140bb92838b3b6bf), UINT64_C(0xe55d7ccd0c75844d) }},
+  {{ UINT64_C(0xd64cb0aedc117b2c), UINT64_C(0x30f4138016f71726), UINT64_C(0x8fc2f0c4e9924f51), UINT64_C(0x6d52768beea8e251) }},
+  {{ UINT64_C(0xb6565022c101d082), UINT64_C(0xaf21e64529d1c4a9), UINT64_C(0xeb9edb9e2b8150f2), UINT64_C(0xb2f7cacfac08f317) }},
+  {{ UINT64_C(0xa77b7e3c362b343e), UINT64_C(0x9fd2c3ef70b1f237), UINT64_C(0x08ae7f6b8c76882c), UINT64_C(0xa8cb8ed4eba20509) }},
+  {{ UINT64_C(0x176720045eaa8108), UINT64_C(0x750e81ec4641772b), UINT64_C(0x82b4d0082088fb7c), UINT64_C(0x581ff8af991b5ea7) }},
+  {{ UINT64_C(0x76fe30d4e4c1ff6e), UINT64_C(0xe2f6f1ebbf2d2db8), UINT64_C(0x6c481a4287e16999), UINT64_C(0x75d75c7223cc3534) }},
+  {{ UINT64_C(0x8359eac3885ed0dc), UINT64_C(0xeee5354596786b2b), UINT64_C(0xd29332bab22adedf), UINT64_C(0x7060c82e1604551a) }},
+  {{ UINT64_C(0xd2d433b8f5766ff8), UINT64_C(0xb89b6a7fdcea1db7), UINT64_C(0xaf3122251615f8ba), UINT64_C(0x3fdca1fe14a72306) }},
+  {{ UINT64_C(0xf5edbd6749763668), UINT64_C(0x572386d4305937e5), UINT64_C(0x491078fedf349041), UINT64_C(0x9823d07825063327) }},
+  {{ UINT64_C(0xa96090820c6ff3b6), UINT64_C(0xd517fb2f327f883c), UINT64_C(0x7bbb7289b977bdd9), UINT64_C(0xe1f223cb4a3a6283) }},
+  {{ UINT64_C(0x9a0dd1b92421f062), UINT64_C(0x54379de48e0e2f40), UINT64_C(0xa32fadb65716a4af), UINT64_C(0x376c2a4f4d3097ce) }},
+  {{ UINT64_C(0xb14fd57af8f97292), UINT64_C(0x0362c04642d5f83d), UINT64_C(0xfa049007bb859996), UINT64_C(0xe8cc5b1b38de1c83) }},
+  {{ UINT64_C(0xe5040b3f232260e4), UINT64_C(0x0c764774eed3b1eb), UINT64_C(0x9ee120899a2e6318), UINT64_C(0xc35bba9a0741f25b) }},
+  {{ UINT64_C(0xefd29f2658e9fab6), UINT64_C(0x62719c1e634e5f01), UINT64_C(0xf039b0ff874af298), UINT64_C(0x5687dea8b2f1b5dc) }},
+  {{ UINT64_C(0x657dc6b0f60b2d2e), UINT64_C(0x845edef8b954b06d), UINT64_C(0xa3596d7a0088d25e), UINT64_C(0x49b916bdaa774819) }},
+  {{ UINT64_C(0x63fcbf45534a73fe), UINT64_C(0x30f2497576d78626), UINT64_C(0xc64e9b654911c50f), UINT64_C(0x98a5a70eee4e8dce) }},
+  {{ UINT64_C(0xe74b482d3d9ae3a0), UINT64_C(0xca6eb4c45d88e085), UINT64_C(0x6f2167b663cee989), UINT64_C(0x3a10c63d4805dc0e) }},
+  {{ UINT64_C(0x8a274a41bfbf0696), UINT64_C(0xaeda2a058db0f58f), UINT64_C(0x99d503c43355cbf8), UINT64_C(0xedbde4a1615f7d30) }},
+  {{ UINT64_C(0x4b88cf64f9c48ad0), UINT64_C(0x80be23cb740a4dd8), UINT64_C(0xc8f65fee8c362f23), UINT64_C(0x1cb042d816b9c3eb) }},
+  {{ UINT64_C(0xb214de27729065fa), UINT64_C(0xff3e1be233ee7639), UINT64_C(0x0763a0709ed094f1), UINT64_C(0x55bb4d23ffd7a6cf) }},
+  {{ UINT64_C(0x1ff93b9abead27e2), UINT64_C(0xa43d5122e22244f1), UINT64_C(0x5c00e4891fe9f157), UINT64_C(0xcc5c431e22dd8bda) }},
+  {{ UINT64_C(0x85259feb22d74f1a), UINT64_C(0xac2371dcd7af05c4), UINT64_C(0xb3eceb2650b31697), UINT64_C(0x1d17206a4f896ee6) }},
+  {{ UINT64_C(0x316eef1edc1470f4), UINT64_C(0x79547805a2edf624), UINT64_C(0x6b6890d207034cf8), UINT64_C(0x089b2645915d0fa7) }},
+  {{ UINT64_C(0x17ac116a23a22e18), UINT64_C(0x4a984aa97790c637), UINT64_C(0xacfcbd3d711485a1), UINT64_C(0x9f1e29f72350a40c) }},
+  {{ UINT64_C(0x58c5d89a9fec8848), UINT64_C(0xdacc1b7753188252), UINT64_C(0x306ec45fa5fb4122), UINT64_C(0xc151842724a4e15c) }},
+  {{ UINT64_C(0x793e69b450789c2e), UINT64_C(0xf4999e955e559d97), UINT64_C(0x1f25adfc59a65594), UINT64_C(0x16850fafbbe7782b) }},
+  {{ UINT64_C(0x676d6fae3518d67c), UINT64_C(0xb8d43028d066191d), UINT64_C(0x18f6dd0b785dfd4d), UINT64_C(0xf44abfb4e74753b4) }},
+  {{ UINT64_C(0x1ca9dad53d97b84a), UINT64_C(0x6e3cd6444e52eb0c), UINT64_C(0x27214ae04e276e81), UINT64_C(0x5ed8d720c0802cae) }},
+  {{ UINT64_C(0x4cb3a06d6db4cc92), UINT64_C(0x0d698023f727a1e8), UINT64_C(0x235d5f4798e9af91), UINT64_C(0x272e46f1da1cfe43) }},
+  {{ UINT64_C(0xc4c523009ee8db34), UINT64_C(0x90567f3e0d73372b), UINT64_C(0xbcee4fc6e5133996), UINT64_C(0x2aec46af7808ae94) }},
+  {{ UINT64_C(0x2b580aa35bf07efe), UINT64_C(0xc934f9774b78d54f), UINT64_C(0x3908fd9697c59cb7), UINT64_C(0xa8c2fbd966341dda) }},
+  {{ UINT64_C(0x000b48046b35a0dc), UINT64_C(0x81c002156b44512b), UINT64_C(0xe538c2468dadce7c), UINT64_C(0xb0dc47f3f73525b4) }},
+  {{ UINT64_C(0xc0ca567f636a32b2), UINT64_C(0x4829733d0c17d11d), UINT64_C(0x8102f2d81deb3838), UINT64_C(0x3ed69e82bba4be3c) }},
+  {{ UINT64_C(0x5f2cf666a889901c), UINT64_C(0x48e58f4f8c252bd2), UINT64_C(0x22ef04bd88c6bd33), UINT64_C(0xa95aca43537a3ed7) }},
+  {{ UINT64_C(0xe6053e3ba0ec80be), UINT64_C(0xd47cd8270ae2ba64), UINT64_C(0x0e1715fa17c4ce6e), UINT64_C(0x2c4fc822eefbadb1) }},
+  {{ UINT64_C(0x3c01f0d25ce146e6), UINT64_C(0x177ff07bd0312e24), UINT64_C(0xb4dcaed5fa0fb566), UINT64_C(0x6f1c4acef04b03cd) }},
+  {{ UINT64_C(0x3c11a07e572fa266), UINT64_C(0x81692d04970225e5), UINT64_C(0x98e29fc6a3051d89), UINT64_C(0xdd1d2fc2e94f229a) }},
+  {{ UINT64_C(0x8b463a7fc75b460c), UINT64_C(0x640849abead6ddd0), UINT64_C(0xf2d4c3b129f07d4c), UINT64_C(0x3c5d021a7f6d3482) }},
+  {{ UINT64_C(0x9f3c8fbfdf87e9c2), UINT64_C(0x8018c8a66d507a71), UINT64_C(0xcab0851815d71664), UINT64_C(0x82a780d4e2e6a88f) }},
+  {{ UINT64_C(0xe9de18d54fa5448a), UINT64_C(0xf7cca8b49203e778), UINT64_C(0x30a54c9c90ca3f55), UINT64_C(0xf38e6e6420ad5d3a) }},
+  {{ UINT64_C(0x7d87330c85aae05e), UINT64_C(0x3cb2418879fb2ea2), UINT64_C(0x5f7892766dab23d2), UINT64_C(0xb0683418c6d9bad5) }},
+  {{ UINT64_C(0x642b9b832721e420), UINT64_C(0x6db833681fcc8462), UINT64_C(0xbacb88e78cc131f2), UINT64_C(0xe8ca0b302d697908) }},
+  {{ UINT64_C(0xdf535e23eb279886), UINT64_C(0x4fe259595250bbe4), UINT64_C(0x3d6c6aca0a4ae901), UINT64_C(0x808e3619a3570fcd) }},
+  {{ UINT64_C(0x17750344f146e76c), UINT64_C(0x57a960ac5102661e), UINT64_C(0x77837aca6d5e702a), UINT64_C(0xf41cf817ca4895dc) }},
+  {{ UINT64_C(0xd744deeb8e7f2892), UINT64_C(0x29604e739d36e6d2), UINT64_C(0xed9372daab964975), UINT64_C(0xb2f53ed6340a7653) }},
+  {{ UINT64_C(0x0b24428b0189ddfe), UINT64_C(0x8a45caa6a2b6e1b5), UINT64_C(0xd444b0d1bbbba2a3), UINT64_C(0x95e71f26ed529281) }},
+  {{ UINT64_C(0x7c9f0d20ea8882fa), UINT64_C(0xb32e9a42ac50ed44), UINT64_C(0xfd59b3b95c9f5dbf), UINT64_C(0x679079f8301e59dd) }},
+  {{ UINT64_C(0x0819e6dbd78e9a3e), UINT64_C(0x2ec72c56476f3b1c), UINT64_C(0x2caee5b44b6f8d35), UINT64_C(0xfb80f6c6fcc67185) }},
+  {{ UINT64_C(0xad7b3100b2f64dd8), UINT64_C(0x1ec9288dbacde9ac), UINT64_C(0xd4f4e9c008c64dc6), UINT64_C(0x79e928b5d6bf1e98) }},
+  {{ UINT64_C(0x37b317a5318e5d1a), UINT64_C(0x9459747081a70055), UINT64_C(0xc4c978c5b3c51f9a), UINT64_C(0x846d782dd680068f) }},
+  {{ UINT64_C(0x5561d74ee1b003f4), UINT64_C(0x6a602607ceb6577e), UINT64_C(0x68d44cfdc4540279), UINT64_C(0xde318834f75e594b) }},
+  {{ UINT64_C(0xe0dbb0d64b061704), UINT64_C(0x1e4b9272c5205ad1), UINT64_C(0x5a6baff5d54283ba), UINT64_C(0xb19cac9ff8bb35c7) }},
+  {{ UINT64_C(0xb0e3e7705a35d372), UINT64_C(0x7e774db9d36ff237), UINT64_C(0x9885f24cfe8b2974), UINT64_C(0xcbc6a9b523df254d) }},
+  {{ UINT64_C(0x89c7e41a929e729e), UINT64_C(0x96243502f1e5fbe7), UINT64_C(0x671dde7f027fad56), UINT64_C(0x752a6b5eeaa283cf) }},
+  {{ UINT64_C(0x02db1656f298cae2), UINT64_C(0xe3efea8c60547cf6), UINT64_C(0x98590a14ace7bb92), UINT64_C(0x214744ecf8137475) }},
+  {{ UINT64_C(0x925bbf6298e645be), UINT64_C(0x2a71b774bd73c391), UINT64_C(0x9562438fe4aa8425), UINT64_C(0x3136e7186ce3f700) }},
+  {{ UINT64_C(0xe64bc9fe2c9db480), UINT64_C(0x92999b4e70717d9f), UINT64_C(0x55a85a9123210cbf), UINT64_C(0x2fa503d7586a8d70) }},
+  {{ UINT64_C(0x1b535ada100c78ce), UINT64_C(0x5945637bd5e56d94), UINT64_C(0xe9dace728848b5b5), UINT64_C(0x8d9e12a0c0808f86) }},
+  {{ UINT64_C(0x318b654adbe4963c), UINT64_C(0xa4594d7257afd823), UINT64_C(0xdf810b1a068b06a2), UINT64_C(0x3eecc1d939bb5b93) }},
+  {{ UINT64_C(0x92fcd130b712bb62), UINT64_C(0xfffdf4a5bcb9dc24), UINT64_C(0xaafc0c0ed8278d12), UINT64_C(0x71cb088b5f6ed010) }},
+  {{ UINT64_C(0x24c202734cba8c6e), UINT64_C(0x21e994ed1242298b), UINT64_C(0x345599ef7d7ac9f7), UINT64_C(0x011dcec8b9e86f13) }},
+  {{ UINT64_C(0x1d9878e4d74b03a8), UINT64_C(0x15744554bff6b134), UINT64_C(0x415ac114051deccd), UINT64_C(0x8d650e3df5321d98) }},
+  {{ UINT64_C(0x6dfff3058b6f0702), UINT64_C(0xd8ab2f906eb632aa), UINT64_C(0x34998b7874a762ea), UINT64_C(0x882f90d8cdc5987c) }},
+  {{ UINT64_C(0x9ffa1b808e2c0c42), UINT64_C(0x098e99d21be18172), UINT64_C(0x2c202b05a77e0223), UINT64_C(0x3c04c5044675db21) }},
+  {{ UINT64_C(0x6fcda7da1d1fb210), UINT64_C(0xd6626a607fec5aef), UINT64_C(0xa11c3b195cea0131), UINT64_C(0x573bf578120ea619) }},
+  {{ UINT64_C(0xa06a70d024843c7a), UINT64_C(0xb31a9e8dd9d5a139), UINT64_C(0x2908b46ad55b0bc7), UINT64_C(0xef1a1f4e0fbcf3d7) }},
+  {{ UINT64_C(0x55de98bc8bb99d60), UINT64_C(0x21994987927fc23a), UINT64_C(0x8f4c5d9fecde346b), UINT64_C(0x1fc381b616233a18) }},
+  {{ UINT64_C(0x9b013fa6aad01cc0), UINT64_C(0xabc0c66e2069c72a), UINT64_C(0x7575d1653918da72), UINT64_C(0xca50fcc4f2a8674f) }},
+  {{ UINT64_C(0x2d9ff58b71da611c), UINT64_C(0xa31d3e0f023cf8d4), UINT64_C(0xb08c70b4109839d7), UINT64_C(0x91a3b680fb58ee7f) }},
+  {{ UINT64_C(0x51d70fb04b1740e8), UINT64_C(0xa5f33c4d41e07f3d), UINT64_C(0x07da6494b376adaf), UINT64_C(0x734807bdf8919374) }},
+  {{ UINT64_C(0x2abd3033e39084c0), UINT64_C(0x2f3f4c92da87d7dc), UINT64_C(0x34ee0e371a9aa567), UINT64_C(0x53f4630db3a53fda) }},
+  {{ UINT64_C(0xc864abb0113a8f3e), UINT64_C(0x7eb7b0bc60ec1f51), UINT64_C(0xa700feca068eca96), UINT64_C(0x00936798a40bd972) }},
+  {{ UINT64_C(0x4d5ad0dcd6095a72), UINT64_C(0xc02bd0ed70c4a70f), UINT64_C(0x72d9d5b93caefc63), UINT64_C(0x5f7891754247d746) }},
+  {{ UINT64_C(0x315fe88d1f2ce4ee), UINT64_C(0xd05900c3d9a2d0f1), UINT64_C(0xed62922c5f7ce175), UINT64_C(0xab30abd4093d08c6) }},
+  {{ UINT64_C(0x54a44f4769d8ff64), UINT64_C(0xe30be9b2236530f3), UINT64_C(0xac9ce637d2275bd3), UINT64_C(0x1f353c331d4a4515) }},
+  {{ UINT64_C(0x19eaaee398364790), UINT64_C(0x6a7a3dfe3353dff6), UINT64_C(0x9367c45480b3ef9e), UINT64_C(0x71dcf99cc2bcdcc4) }},
+  {{ UINT64_C(0x83b698ad672e896e), UINT64_C(0x12b7fc1d4144e50c), UINT64_C(0xdffb8cbe5cda4827), UINT64_C(0x5356aab303174247) }},
+  {{ UINT64_C(0x098ce40a9ee21536), UINT64_C(0xacad0cce554796ee), UINT64_C(0xe4c724e48d94f8ea), UINT64_C(0x557179d89806804f) }},
+  {{ UINT64_C(0xf921e6918580ed9c), UINT64_C(0x7f2577e8165aaf22), UINT64_C(0x7ea5a89954ae795c), UINT64_C(0x3518089f5cecbe30) }},
+  {{ UINT64_C(0xad9fd853e06ab45a), UINT64_C(0x89ce2507eb474952), UINT64_C(0x06fdeb41f1dd10b1), UINT64_C(0xcb8a67df29506706) }},
+  {{ UINT64_C(0x306dffe4da9ce756), UINT64_C(0x015adfc9e4495d43), UINT64_C(0x39b925e017ca4880), UINT64_C(0x638c3ca367b73228) }},
+  {{ UINT64_C(0x394e32764ac3eefe), UINT64_C(0xeb0f56a738dceca2), UINT64_C(0x13a418f54898e53e), UINT64_C(0x2350e44a5eec7a3b) }},
+  {{ UINT64_C(0x537b91a798241b96), UINT64_C(0xa2ea69370a7c40a4), UINT64_C(0x5ddda94750e90d38), UINT64_C(0x7312cce5b5ef0a6a) }},
+  {{ UINT64_C(0xefea12c230f4df48), UINT64_C(0x4421a1c071d9a876), UINT64_C(0x376288c172c2660c), UINT64_C(0xbc9b3cda42a9b15a) }},
+  {{ UINT64_C(0x4a50bbf05acf3e0e), UINT64_C(0x0937b517b0717320), UINT64_C(0xb64104b2c7700e1e), UINT64_C(0xd07b3398606266b3) }},
+  {{ UINT64_C(0xbb63089daffc2efc), UINT64_C(0xea985f25dd3d70d1), UINT64_C(0x7ee3b5a411ced609), UINT64_C(0x44f0f3796b8d5a33) }},
+  {{ UINT64_C(0x1e87b9aff9ec5542), UINT64_C(0xdfe3d3c6e307c508), UINT64_C(0xbb6b73495fd0ded9), UINT64_C(0xc81e2c6868182737) }},
+  {{ UINT64_C(0x5ff49b0d8f08abd2), UINT64_C(0x418f20f0968a2787), UINT64_C(0x3ef9114b2c7a9b94), UINT64_C(0x6a2adb08d884688a) }},
+  {{ UINT64_C(0xfb4386ed5eebe706), UINT64_C(0x8cea16051e4a2382), UINT64_C(0xe444da0fc12a254c), UINT64_C(0x23c87fe8a3773581) }},
+  {{ UINT64_C(0xf81e0c999ba26fce), UINT64_C(0x5fb0691efac63c67), UINT64_C(0x8d60e81e5b8a892e), UINT64_C(0x4fce93c16a548fa4) }},
+  {{ UINT64_C(0x71d2725ae04ee1b4), UINT64_C(0x0e374545a8200384), UINT64_C(0x4c96afe11c77a0e7), UINT64_C(0x4fccd1a0d094fbab) }},
+  {{ UINT64_C(0xd30d73dc4c7bf104), UINT64_C(0xa5bf8001a5529883), UINT64_C(0x428af60ccca7eb0c), UINT64_C(0xc06e995e8926a86c) }},
+  {{ UINT64_C(0xfd7270546c8e2fa8), UINT64_C(0xf4aac1b8476e81e0), UINT64_C(0xd7019a1bb5ca71c0), UINT64_C(0x56100490a2e9fd38) }},
+  {{ UINT64_C(0x2e3eabfe7ec19dfa), UINT64_C(0x1ee03086c4fa392d), UINT64_C(0xf95843ff664b8833), UINT64_C(0x28b2aef711d0c311) }},
+  {{ UINT64_C(0x6e859b2100b46be4), UINT64_C(0x030641a7883525da), UINT64_C(0x39b718026c28d29f), UINT64_C(0x11e21a207a5c4254) }},
+  {{ UINT64_C(0x7c9edcd4658c7416), UINT64_C(0x57b455b814943730), UINT64_C(0x088d1e6271b00eb5), UINT64_C(0xa48da62cdf7ec244) }},
+  {{ UINT64_C(0x7b1a4150bd212c7e), UINT64_C(0x26ec20c271cf4a5e), UINT64_C(0x623cb22c65890f7d), UINT64_C(0x7819a9b4b26ec5d2) }},
+  {{ UINT64_C(0x566d63d92d931114), UINT64_C(0x3ef075b2e1926c38), UINT64_C(0x7e8fde198b10351e), UINT64_C(0x7f1336d264e91665) }},
+  {{ UINT64_C(0x4c1ac209058bb6e8), UINT64_C(0x89eeee7126d95d66), UINT64_C(0xaf784117425ef359), UINT64_C(0x42dad7c2290a5c9f) }},
+  {{ UINT64_C(0x483398410a917e52), UINT64_C(0xb4d55d35c3deda09), UINT64_C(0x9fe699bd4df7d09b), UINT64_C(0x9280e337ec59cc90) }},
+  {{ UINT64_C(0x3ba2107e716de016), UINT64_C(0xe68cce21483b6d70), UINT64_C(0x3860c6915d7bbbd7), UINT64_C(0xc02441eff1a51137) }},
+  {{ UINT64_C(0xdc27834ffd1ffce2), UINT64_C(0x256ce890c4eb5f87), UINT64_C(0x3906e2e14baefa69), UINT64_C(0x37d1e8eb0adf883a) }},
+  {{ UINT64_C(0x82ba339eb67fd7ba), UINT64_C(0x121011364d5bb058), UINT64_C(0xb03cf8ee9b22e485), UINT64_C(0x2952ce41c0536530) }},
+  {{ UINT64_C(0xc671ef1d775a9cba), UINT64_C(0x34ed2747582b9a4d), UINT64_C(0x1302cab04918e686), UINT64_C(0xdff3053f26db0f63) }},
+  {{ UINT64_C(0x9c85bde6eeabc67a), UINT64_C(0xabc58abc130c296f), UINT64_C(0x9c333d4f1f4b2b8d), UINT64_C(0x226dc0c721185a28) }},
+  {{ UINT64_C(0x121527de476fb032), UINT64_C(0xc0ff059166dd548c), UINT64_C(0xf44469ad1098141a), UINT64_C(0x1894be7c358f3f7e) }},
+  {{ UINT64_C(0x6dcf090fce9f13b0), UINT64_C(0x171bf97aa5e77ceb), UINT64_C(0xc88a3874bd5bc90f), UINT64_C(0xa38ac68598fdf8e3) }},
+  {{ UINT64_C(0x24e899e81a9bc228), UINT64_C(0x312122dc3130f2bd), UINT64_C(0x4075b89d4fd167d4), UINT64_C(0xda4b2cf1fa744dd4) }},
+  {{ UINT64_C(0x2df535ff46ac4e6a), UINT64_C(0x86fbc5443dda2614), UINT64_C(0x2b47926d83232d7e), UINT64_C(0x75d5a7cd8feb5140) }},
+  {{ UINT64_C(0x0cd4bf7e004c18c2), UINT64_C(0x7f502155d7c72ff2), UINT64_C(0xc69eece1824e8df8), UINT64_C(0x5b3c7481aa372283) }},
+  {{ UINT64_C(0xc2255f69605e2786), UINT64_C(0x90d9a140af373399), UINT64_C(0x42431d723b965e21), UINT64_C(0x969c8ea216cd4c56) }},
+  {{ UINT64_C(0xa1ec32326f1772d6), UINT64_C(0x9c847720c2321fb0), UINT64_C(0xb03bfb0b7b6eecae), UINT64_C(0x257378e43c280c0e) }},
+  {{ UINT64_C(0xf8baf74a92e4c840), UINT64_C(0xdd8cb33da9a6712c), UINT64_C(0x1d4d255e6a866fe3), UINT64_C(0x0b1a2a71fe1e8ff3) }},
+  {{ UINT64_C(0xdd0437c3eed04948), UINT64_C(0x521658e53ad53ae4), UINT64_C(0x2f845da3953805f9), UINT64_C(0x94423c2bb0845278) }},
+  {{ UINT64_C(0x72c27243faf0d6d8), UINT64_C(0x24c8588e4d9d8408), UINT64_C(0xf20da92d6940fea9), UINT64_C(0x791b012bd9d21b02) }},
+  {{ UINT64_C(0x9db2ee9cf3bd2146), UINT64_C(0xb06ac60e5b22aca5), UINT64_C(0xb6d4ad5139fda057), UINT64_C(0x7d37e75c6b6331df) }},
+  {{ UINT64_C(0xf674b7da26a373a6), UINT64_C(0xb44cedd4f3e53403), UINT64_C(0x12e312f110f046e5), UINT64_C(0x321756c54174b881) }},
+  {{ UINT64_C(0x1082c12b9bcc0fd2), UINT64_C(0x22862387468ff556), UINT64_C(0xad16d9ebc262e5d4), UINT64_C(0xb8737121f2c839d3) }},
+  {{ UINT64_C(0x9cd7158a4727421e), UINT64_C(0x220cc92fe5e8088e), UINT64_C(0xae95d9ca0779673a), UINT64_C(0x89cddd04a502dae8) }},
+  {{ UINT64_C(0x2ba444f37a3ee91a), UINT64_C(0xed3cb35493c4f06b), UINT64_C(0xbe773803d98da904), UINT64_C(0x3a5338269fbbda8a) }},
+  {{ UINT64_C(0x7bc79fcd6090d4ec), UINT64_C(0x06f09ed737919ffc), UINT64_C(0x9697694c06d87d84), UINT64_C(0x9fecbeeb0cbe251d) }},
+  {{ UINT64_C(0xc269f045c9fdfe4a), UINT64_C(0xae83a8bfb2b34e08), UINT64_C(0xad62a3c32578a970), UINT64_C(0x3ed2b3327bda6a54) }},
+  {{ UINT64_C(0xfdf8e33b630823ea), UINT64_C(0xdd37b31c258f0c93), UINT64_C(0x0b62c739db04d987), UINT64_C(0x823d17afb1fe910a) }},
+  {{ UINT64_C(0x66aada7fa1040f3e), UINT64_C(0x850ddca5613dc06f), UINT64_C(0x9415ea59f97be097), UINT64_C(0x166a07f89ca3cb7b) }},
+  {{ UINT64_C(0xe333e8c49f12b482), UINT64_C(0xafaf886b1353bd9c), UINT64_C(0xbd5cdd3e4caaa314), UINT64_C(0x6021a14e510708fd) }},
+  {{ UINT64_C(0xa6ec548d77bfd2d8), UINT64_C(0x6f4191be2366c4fc), UINT64_C(0xe22bf641a02924bb), UINT64_C(0x94fbbcc34518ab1f) }},
+  {{ UINT64_C(0x9f6cc273006bd194), UINT64_C(0x021edb92a445dffc), UINT64_C(0xb4ab81a4d8bc02a7), UINT64_C(0x1ab815f758f3613c) }},
+  {{ UINT64_C(0x4be1fc4d627c926c), UINT64_C(0x4823ca2a0eb874bc), UINT64_C(0x7659a8b0892492c1), UINT64_C(0x02f46f874506bfa6) }},
+  {{ UINT64_C(0xdb65a9576243ed58), UINT64_C(0xac7cf737594b4e63), UINT64_C(0x807f5376d7791ac8), UINT64_C(0x80b07adc0618c384) }},
+  {{ UINT64_C(0x43a31fbdfd865836), UINT64_C(0x360a3344450fdd91), UINT64_C(0xd88c9a5139c05944), UINT64_C(0xe3e444a6a60fc47f) }},
+  {{ UINT64_C(0x6ced355b605cf95e), UINT64_C(0x5e95c903cce7d2fd), UINT64_C(0xf60a3f43788df88b), UINT64_C(0xea2de1c39c4884cb) }},
+  {{ UINT64_C(0xd33b2bf8ca6f475c), UINT64_C(0xe9b63fde8ff530eb), UINT64_C(0x974b4a7ff1dbdce6), UINT64_C(0x6d4b2101ef03523c) }},
+  {{ UINT64_C(0xa4084a3f33b38ca6), UINT64_C(0x4b17652b06ff0d97), UINT64_C(0xf2ccffa27ddb7b9b), UINT64_C(0x63049185d85fd2ed) }},
+  {{ UINT64_C(0xff8ce3baefca841a), UINT64_C(0xc1aa7660ba962cfc), UINT64_C(0x162d679f1537a2fe), UINT64_C(0x94145e781514198a) }},
+  {{ UINT64_C(0x718fb18beb9d8ede), UINT64_C(0x26e571a70909b309), UINT64_C(0x323815f941663cdb), UINT64_C(0xdbff4aafe768219f) }},
+  {{ UINT64_C(0x6b264e625007525a), UINT64_C(0x07095f52ee393853), UINT64_C(0xac8621f1d4aa0bc4), UINT64_C(0xcb29b7dbddef4ccc) }},
+  {{ UINT64_C(0xf81aa308b6b6c5b2), UINT64_C(0xd14840a85f75ac43), UINT64_C(0x534227345c23d520), UINT64_C(0x82ed3a52365bf099) }},
+  {{ UINT64_C(0xb5d07ac17a98e332), UINT64_C(0x3008092720068160), UINT64_C(0x654c68ef78101fe1), UINT64_C(0xa55395cf461fb715) }},
+  {{ UINT64_C(0xe84f502fa908a8aa), UINT64_C(0x249d34383f0ff06b), UINT64_C(0x516cccc74f7dae10), UINT64_C(0x8c036aee694c15ba) }},
+  {{ UINT64_C(0x092df725d47669ae), UINT64_C(0x783c818e28d76f28), UINT64_C(0xd51ba3ec3155796c), UINT64_C(0x8892858ab4923abd) }},
+  {{ UINT64_C(0x3ee41ac5ab4d7c70), UINT64_C(0x2c61c77191a0c25c), UINT64_C(0x4cc2de451fd2eaf7), UINT64_C(0xa58a0299bfdf8e64) }},
+  {{ UINT64_C(0x8a94dbe89b599c50), UINT64_C(0x1354484b9511be1b), UINT64_C(0xd09e8ea7df74e886), UINT64_C(0x91378849d11c7866) }},
+  {{ UINT64_C(0x7c536a94b163821c), UINT64_C(0x9dc3177a6bc95aee), UINT64_C(0xd3daebb9a25d31bf), UINT64_C(0x8c0059af284c5a7a) }},
+  {{ UINT64_C(0x9b55be2fc4e0a94a), UINT64_C(0x978917a631af2a34), UINT64_C(0x9b6ab95cf7922611), UINT64_C(0x74ae61c6a2d15d85) }},
+  {{ UINT64_C(0xf3259ea862544c2c), UINT64_C(0xc9f9baf0a9bec470), UINT64_C(0x195513b2c2f25e44), UINT64_C(0xbf4960d6be66ce70) }},
+  {{ UINT64_C(0x2386dfa6a66596f4), UINT64_C(0xde911e92a5c13468), UINT64_C(0xeb25fe70d6add7b2), UINT64_C(0x094a92213fc5ffd5) }},
+  {{ UINT64_C(0xc63f69d63dd26d66), UINT64_C(0xed7369838e2652d0), UINT64_C(0x86d21e3e3217060c), UINT64_C(0x035851e374ff289e) }},
+  {{ UINT64_C(0xc043fa40e20f9fdc), UINT64_C(0x2836f2dcc57dc41d), UINT64_C(0x4cb7b7ab54933e1a), UINT64_C(0xa302416adf834449) }},
+  {{ UINT64_C(0xaf91de748e14b216), UINT64_C(0xd478da4fe0af5f79), UINT64_C(0x92a5350a6d1d8bfc), UINT64_C(0x43f4e62bba66150b) }},
+  {{ UINT64_C(0xdc1e95660bf65b32), UINT64_C(0x35ead0b9de19794a), UINT64_C(0xe30cc25e9e8ed426), UINT64_C(0xf949bcc2b8efb932) }},
+  {{ UINT64_C(0x56839595a5b1e8b6), UINT64_C(0xc726f1fa87354677), UINT64_C(0x7c5e4ac8380f0967), UINT64_C(0xc036738e44f01f4d) }},
+  {{ UINT64_C(0x68294161394e9c6a), UINT64_C(0x77ca309a2d374287), UINT64_C(0xe84bd24255a5f2df), UINT64_C(0x711fff8de4cfe8cf) }},
+  {{ UINT64_C(0xb2e93d9d9fcbfaac), UINT64_C(0x03f46393e7ecf70c), UINT64_C(0xdecb5ea80f1592da), UINT64_C(0x715286e5b4dedc3a) }},
+  {{ UINT64_C(0xda4753017736a4a6), UINT64_C(0x0de597f9f6461915), UINT64_C(0xa922f73489601c92), UINT64_C(0xe8e1b140eca4b20f) }},
+  {{ UINT64_C(0x8d7db4e580ac3b64), UINT64_C(0x1ada670a683fd009), UINT64_C(0x57a0e1017d660052), UINT64_C(0xd906011c42e3041f) }},
+  {{ UINT64_C(0xa89bea346824fb4e), UINT64_C(0xa9fc459bbb62455f), UINT64_C(0x9af7a0ba99ab01a3), UINT64_C(0x84f3296b6d1572ec) }},
+  {{ UINT64_C(0xa6d79b319287be30), UINT64_C(0x0adf18ca7382aeef), UINT64_C(0xc99a8d607e702cad), UINT64_C(0xc615d5e1293c6ffb) }},
+  {{ UINT64_C(0x14956b8fb6afb78e), UINT64_C(0x014fc77e44b9452c), UINT64_C(0x31049ee7e9ae3e83), UINT64_C(0xa17280af9522fef3) }},
+  {{ UINT64_C(0x9aafd1c8f7e54c3c), UINT64_C(0x103f220a44a8bec1), UINT64_C(0x6b9fb61ef0501e0d), UINT64_C(0xf63320cd72b576bf) }},
+  {{ UINT64_C(0xfa54ccf53e50699c), UINT64_C(0x0f30121fd3a15b9d), UINT64_C(0x8312d708671630b7), UINT64_C(0xb1f5e6151ebdde09) }},
+  {{ UINT64_C(0x52bd093f93f984e4), UINT64_C(0x3256adccea80be8c), UINT64_C(0x40972979ea890bd7), UINT64_C(0x06fd2a99ee003e4d) }},
+  {{ UINT64_C(0x7fed73270d2de592), UINT64_C(0x2412b39662786ecd), UINT64_C(0x2d8ca612bac7b388), UINT64_C(0x6e38899ccdf89e47) }},
+  {{ UINT64_C(0xeeb3ff30349ca33a), UINT64_C(0xc876112c3f86e15d), UINT64_C(0x046fc7d2a695a789), UINT64_C(0xdcf72d2610fc0396) }},
+  {{ UINT64_C(0x3ad475dde3235574), UINT64_C(0x2dd44e231aa20114), UINT64_C(0xb6f07606aa81fba7), UINT64_C(0xc25c340e4e020041) }},
+  {{ UINT64_C(0x13b5e99101b543d8), UINT64_C(0x56fc77a47fcf2f7e), UINT64_C(0x9dae38bd32bb76be), UINT64_C(0x43b50f63f3f7266b) }},
+  {{ UINT64_C(0xd35a722f0b52eae8), UINT64_C(0xd8fbd3cec1c4c7f9), UINT64_C(0x7a680ebcb932e32f), UINT64_C(0xfac74f5150c815bf) }},
+  {{ UINT64_C(0x90d92635dc8b1442), UINT64_C(0x3d4c9f4ca30a57cf), UINT64_C(0x136336706a6026e6), UINT64_C(0x091e2445dc508ffa) }},
+  {{ UINT64_C(0x78e01ec9f9f05de6), UINT64_C(0x24c2e7482536a8b4), UINT64_C(0x766168b3f4326a81), UINT64_C(0x0f1c87b0153060ad) }},
+  {{ UINT64_C(0x525e7c1dccde2e04), UINT64_C(0x036ec1c7ea91b63f), UINT64_C(0xf19180fdd9ea8047), UINT64_C(0xaef5755f876bcbae) }},
+  {{ UINT64_C(0x18d0cfedcd40402e), UINT64_C(0x1a296c7dab4ed060), UINT64_C(0x167e130a7674847f), UINT64_C(0xe4a73d27e6e4ff1d) }},
+  {{ UINT64_C(0x0294b466085e2c42), UINT64_C(0x38959b5e0db3054e), UINT64_C(0x90aa743db2e5f9cf), UINT64_C(0x7951398f3c864caf) }},
+  {{ UINT64_C(0x539b48db3ff49b6e), UINT64_C(0xe351f01bc676c766), UINT64_C(0x304b362c692554c1), UINT64_C(0x445da3a8bc192082) }},
+};
+
+static const mzd_local_t Li_0[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0x40268aa24c44b202), UINT64_C(0x9b1faefa8198fd3e), UINT64_C(0x5eeaf15a1c2d1904), UINT64_C(0x114d2180a5af2044) }},
+  {{ UINT64_C(0xfed9f37e58e7ac0a), UINT64_C(0x294402372dfb463a), UINT64_C(0x849b015670bd16b5), UINT64_C(0x3285c340385174f2) }},
+  {{ UINT64_C(0xe1a1b13070e65af2), UINT64_C(0x4a21ad6a036fb564), UINT64_C(0x9873575e54c12e99), UINT64_C(0xb09c3ccd0007390d) }},
+  {{ UINT64_C(0x28f02d6a4170be14), UINT64_C(0x472f9db12113a669), UINT64_C(0xd218b85a488618b1), UINT64_C(0xc630b2cb84e70e19) }},
+  {{ UINT64_C(0x40e69ce920c0edc0), UINT64_C(0x473d35963e113951), UINT64_C(0xe3e0ec4604964914), UINT64_C(0xe586a15849508b91) }},
+  {{ UINT64_C(0xec35e160d80370f0), UINT64_C(0xf08e18cae0145b1e), UINT64_C(0x8e07190963bdbab1), UINT64_C(0xc1535f5a4c10ac1c) }},
+  {{ UINT64_C(0x32e5113a7096dcfc), UINT64_C(0xf21b99ff0a2a63c8), UINT64_C(0xcab79b4b1559a0a9), UINT64_C(0xec5c1e82b713f16a) }},
+  {{ UINT64_C(0x9e46b4ae81a2341e), UINT64_C(0x929d8280c23241ef), UINT64_C(0xdef76c62a9cfb6dc), UINT64_C(0xffc02dec61468cab) }},
+  {{ UINT64_C(0x25a3cd684d14b842), UINT64_C(0xc115e7e903b0e937), UINT64_C(0xcf5ddf5ad6c783f5), UINT64_C(0x6cc0f8afcf4d9248) }},
+  {{ UINT64_C(0x1dfba8ee3b1928fe), UINT64_C(0xc941219c3d447774), UINT64_C(0x7aacf3fe4a54b615), UINT64_C(0xae801aab74623c9d) }},
+  {{ UINT64_C(0xc23967280718429a), UINT64_C(0x4ab958236bc9b014), UINT64_C(0xe19f87b03ed7c9ce), UINT64_C(0xfd45740111e8114f) }},
+  {{ UINT64_C(0x6fd31de6bf8d6142), UINT64_C(0xfdc6f611e8deaffb), UINT64_C(0xb17c2ac86e2bf488), UINT64_C(0x868d2aac09cf23ee) }},
+  {{ UINT64_C(0x6993b90346106714), UINT64_C(0x12ccc4d1a100bcaa), UINT64_C(0xd239beecddf7eba0), UINT64_C(0x706389d543012de7) }},
+  {{ UINT64_C(0x8d5c322488ab3aca), UINT64_C(0x4638b243af2710e8), UINT64_C(0xdb4a89987581bcc7), UINT64_C(0xc585d584cab9137c) }},
+  {{ UINT64_C(0xbecb9ff218333f48), UINT64_C(0xc1a0b918f3008fe6), UINT64_C(0xf82f19aae9139699), UINT64_C(0xa7f21c0aebda471a) }},
+  {{ UINT64_C(0x86fa4b063156b5d4), UINT64_C(0x99f08d8c4d80903c), UINT64_C(0x22cdd9a2b5a59bf6), UINT64_C(0x8b99b18c6e9dec8d) }},
+  {{ UINT64_C(0x529a5814c27f4f6a), UINT64_C(0x7ee7c880e209eefc), UINT64_C(0x180fb8a0632f84ce), UINT64_C(0x7153fe147112b5f5) }},
+  {{ UINT64_C(0xd845c1f1bfe14278), UINT64_C(0xfc426d517fe3f2b0), UINT64_C(0x0119ae97bfa9ae97), UINT64_C(0x07c10ab7e5c7dfb1) }},
+  {{ UINT64_C(0x5e560c758304f2c2), UINT64_C(0x59d8ab5fc5f1b94f), UINT64_C(0x1e74cd560bfde67a), UINT64_C(0x2d71622177c83e0f) }},
+  {{ UINT64_C(0xc121a922dc92f81a), UINT64_C(0xbf0e770c4a821c6a), UINT64_C(0xab44b3b65772fcf9), UINT64_C(0x754fcf8159de76af) }},
+  {{ UINT64_C(0x5f0236f2836283b8), UINT64_C(0xb13af78b47c63eff), UINT64_C(0x06d5b262437870a6), UINT64_C(0x3e28d284a696e7e5) }},
+  {{ UINT64_C(0xc3712361aef2e9cc), UINT64_C(0xf430e63c67dc15be), UINT64_C(0x22f008f9bcc970fa), UINT64_C(0x7f4a89497b5c33c1) }},
+  {{ UINT64_C(0x861e757dcb460c18), UINT64_C(0x0237ccca1339687c), UINT64_C(0xb9ef66b2a9fd3975), UINT64_C(0xee3597efeacc6b52) }},
+  {{ UINT64_C(0x1c0d6b0b04751b52), UINT64_C(0x0b4cda61799834f7), UINT64_C(0xc0ca00584b1588ea), UINT64_C(0x8190970181fec270) }},
+  {{ UINT64_C(0x7974669dc91d5010), UINT64_C(0x66d414f6a84e23e6), UINT64_C(0x733caaaffde4b94a), UINT64_C(0xa8a7a5f6aac95023) }},
+  {{ UINT64_C(0x5291896aef6e4638), UINT64_C(0x9ea6ae0849872fd3), UINT64_C(0x1959f7db65537d0e), UINT64_C(0xc476c9ae21b20a5f) }},
+  {{ UINT64_C(0xa2146cb11cb7b380), UINT64_C(0x26dfaf3402961e1d), UINT64_C(0x2b029989fbe7bfac), UINT64_C(0xce339a0776c76441) }},
+  {{ UINT64_C(0x34f55c14f168307a), UINT64_C(0xebd430d83b2dc4aa), UINT64_C(0x55cea7155bcf7082), UINT64_C(0x46cda2f3cd0b9eea) }},
+  {{ UINT64_C(0xca6853adb623e7c6), UINT64_C(0x87bed317a59a9718), UINT64_C(0x9b1a279be74ef695), UINT64_C(0xfb1adf56f049d30b) }},
+  {{ UINT64_C(0xeaf8751469bcbb76), UINT64_C(0x33f010c39a192290), UINT64_C(0x49683977f30aa86f), UINT64_C(0xe84a0d1a331ac86a) }},
+  {{ UINT64_C(0xb43419109674edfe), UINT64_C(0x087e9060b4fbf0f1), UINT64_C(0x2045b76799c96264), UINT64_C(0x5fca97296afc7658) }},
+  {{ UINT64_C(0xac87b1c7174ddea0), UINT64_C(0x2339ceac660cdb14), UINT64_C(0x05ac34ccd405ec36), UINT64_C(0x99a1486a9e47c743) }},
+  {{ UINT64_C(0x2c0bbb71094b76b4), UINT64_C(0x291a308da468e581), UINT64_C(0xa12134c35261cbe3), UINT64_C(0x35cd5e9a08508d85) }},
+  {{ UINT64_C(0x9953d5d108a91462), UINT64_C(0x9d25702c3d415242), UINT64_C(0xb3d8c98ac78f6179), UINT64_C(0xae4aae769e4dda1c) }},
+  {{ UINT64_C(0x8888dc3244d0f590), UINT64_C(0x969c30753416ccfc), UINT64_C(0xec26b2f2a662094b), UINT64_C(0xb10ca1b9cca8b58c) }},
+  {{ UINT64_C(0x949ec6c1d2489074), UINT64_C(0x815378f0ab0b890b), UINT64_C(0xdc3784e25368893d), UINT64_C(0x10066c1b529e558c) }},
+  {{ UINT64_C(0xa82a431648b996e0), UINT64_C(0x19010a8018e25941), UINT64_C(0xdf78102bb1a2a0b0), UINT64_C(0x705dfcab1227438a) }},
+  {{ UINT64_C(0x086df527f215bf08), UINT64_C(0xf600e78d85dca75d), UINT64_C(0x53237629239de6b3), UINT64_C(0x07d5c696fe1f6da3) }},
+  {{ UINT64_C(0xbc9e491c4b6abb04), UINT64_C(0x4b6eeee96d73460c), UINT64_C(0xb9113e7378560563), UINT64_C(0x95159380d8d7b18d) }},
+  {{ UINT64_C(0x98539b9ac4e3de44), UINT64_C(0x360f7f6d6f0c9b40), UINT64_C(0x5660edeebefaac67), UINT64_C(0xfb81d6aa3548d10e) }},
+  {{ UINT64_C(0xc6d89c25dea1d618), UINT64_C(0x4fbfa8bfdf29c016), UINT64_C(0x12059752f18374af), UINT64_C(0xd3cbbb6c317ded3c) }},
+  {{ UINT64_C(0x2344d301de7f8e0c), UINT64_C(0x728d368d364fb425), UINT64_C(0x7c069770f2499ad7), UINT64_C(0x3ac2fecb124423b9) }},
+  {{ UINT64_C(0xc26dc5fa96613fac), UINT64_C(0x7c8c6256164a7571), UINT64_C(0xfc96de5e3fbe6f03), UINT64_C(0xb9679b7c802919d8) }},
+  {{ UINT64_C(0xda803d8c68f24514), UINT64_C(0xe0bb7946333e495a), UINT64_C(0xbeeb76b044c315b7), UINT64_C(0xff41318a1754a5e8) }},
+  {{ UINT64_C(0xbdb4f86080407288), UINT64_C(0x1b277ae5c622625c), UINT64_C(0x782f8e1eca9999c6), UINT64_C(0x2b5996d26f21ee33) }},
+  {{ UINT64_C(0xc48962a6ff5674f8), UINT64_C(0x9994c7226242130a), UINT64_C(0xc8d5a26f5e799acd), UINT64_C(0xdbaf9bf11c6e6675) }},
+  {{ UINT64_C(0xb0555dd9e5b34e6e), UINT64_C(0xdd77a90071f27112), UINT64_C(0x0e98ab4fd378ef8c), UINT64_C(0x910e3526bc9233fa) }},
+  {{ UINT64_C(0xc153237c6815180c), UINT64_C(0xcc1ec4a7e23e1e00), UINT64_C(0xb451e1225c152684), UINT64_C(0x0efd2218106f107e) }},
+  {{ UINT64_C(0x53df1ec10827e5da), UINT64_C(0x93ada39e5710152c), UINT64_C(0x98d85fd2b4f1d14d), UINT64_C(0x211f680eef84bb40) }},
+  {{ UINT64_C(0x0efaa1fc9e4bf384), UINT64_C(0x44d5164c4881a897), UINT64_C(0x5f16dee889456b08), UINT64_C(0xa83c61d3883a7941) }},
+  {{ UINT64_C(0x4c5027828335d026), UINT64_C(0xb5db6fa0eb1dd107), UINT64_C(0x02ef5404a7276fd8), UINT64_C(0x00a98807b7fbc72a) }},
+  {{ UINT64_C(0x41425c511bfdf83e), UINT64_C(0x631bdf571af55b4e), UINT64_C(0x7c747ba77ddf81c6), UINT64_C(0xb9b286bbcaa6911d) }},
+  {{ UINT64_C(0xaeaa30fc6c38d088), UINT64_C(0x213f7e376ce316af), UINT64_C(0xd3edba6a3ddbdbb6), UINT64_C(0xdeac4e07a1f0b5ed) }},
+  {{ UINT64_C(0x09baad981f531ac2), UINT64_C(0x5de6b68208db1ce8), UINT64_C(0xdfa3a2ac53c24220), UINT64_C(0xbf7df63856c7d636) }},
+  {{ UINT64_C(0x713e2628f7ea00ba), UINT64_C(0xbb4badb2d9b639ff), UINT64_C(0xebfcae9183c73e3b), UINT64_C(0x57fe8e461b9e19b2) }},
+  {{ UINT64_C(0x9db6097f7200e442), UINT64_C(0x1dd3640aa0483b07), UINT64_C(0xb4adf8cc8e8167a8), UINT64_C(0xea9c007743c27c85) }},
+  {{ UINT64_C(0x38eda3c29b95efc2), UINT64_C(0x73a21604def491c0), UINT64_C(0x356d6beffd1c6323), UINT64_C(0x14f1649bc23faaa4) }},
+  {{ UINT64_C(0x8949a05e99e68e3a), UINT64_C(0xc9187915d13316cd), UINT64_C(0x1b352f7b715face9), UINT64_C(0xe2c271f5d38bb7d3) }},
+  {{ UINT64_C(0xdea4f372c694e95c), UINT64_C(0xee4a8b21be4f96a4), UINT64_C(0x46455dc91f6c5e8a), UINT64_C(0x6bcac8ea3d3efe9e) }},
+  {{ UINT64_C(0xc49a378e68f96286), UINT64_C(0x88f672150e9abf56), UINT64_C(0x794f35399c16f048), UINT64_C(0xfd7259171cef8242) }},
+  {{ UINT64_C(0xf1546fd036bbd20e), UINT64_C(0xed678b0c4707ab02), UINT64_C(0x740a4d4e4e9e23e7), UINT64_C(0x828e53b84d811b90) }},
+  {{ UINT64_C(0xfcba25adf8634fc0), UINT64_C(0xe4c16444befd1642), UINT64_C(0xbdc5b864d848d4c5), UINT64_C(0xa38501dc463bafa4) }},
+  {{ UINT64_C(0x48d2c194eb2fab6c), UINT64_C(0xc27ccba2937a3349), UINT64_C(0x03134728940d044e), UINT64_C(0xa0e58776ee1fb9fe) }},
+  {{ UINT64_C(0xba38e7b9eed8569a), UINT64_C(0x9590e21722bf6072), UINT64_C(0x1990e30c511bdbf1), UINT64_C(0x335e43b34be7437e) }},
+  {{ UINT64_C(0x4741062bdb4cf964), UINT64_C(0xe6517bf7634c4dc4), UINT64_C(0x5ec835af5c54aa9f), UINT64_C(0xdf3a07587dda40d5) }},
+  {{ UINT64_C(0x9f0cc16192477240), UINT64_C(0xfa10df40a1f16899), UINT64_C(0x7eddb32d263d6b55), UINT64_C(0x06310c34ea6af7ac) }},
+  {{ UINT64_C(0x002754ae6617a614), UINT64_C(0x89c67d9b32509476), UINT64_C(0xedbee1dfb4fbaa6c), UINT64_C(0x63a088712d25b7a3) }},
+  {{ UINT64_C(0x08f2e3d4b176c1a2), UINT64_C(0xe97f6f5940fbea68), UINT64_C(0x67f8bfa7f1c321cf), UINT64_C(0x7007aa3b227609a9) }},
+  {{ UINT64_C(0xec76b3499be85316), UINT64_C(0x53f9ca270d93af35), UINT64_C(0x69939da5ab12879a), UINT64_C(0x95910ba5d2e1ef56) }},
+  {{ UINT64_C(0x749507db4c532f0a), UINT64_C(0xc2baf5b7bf79256b), UINT64_C(0xe2dd9a9fed812d2d), UINT64_C(0x15f27dc8bee214da) }},
+  {{ UINT64_C(0x2a4e5a000821b70e), UINT64_C(0x0a7b6b316146a11c), UINT64_C(0x48eb4a37675dedb4), UINT64_C(0xa52d99aea9ed33f8) }},
+  {{ UINT64_C(0x6e2d08991f67dbd4), UINT64_C(0x2cd23ebb2d6ffdd5), UINT64_C(0x7ed01ccac44ffc8b), UINT64_C(0xb6f8a2493f5ace6e) }},
+  {{ UINT64_C(0x1e4c311a066302ac), UINT64_C(0x34b29128a500ca09), UINT64_C(0x456950fbcf3c1caa), UINT64_C(0x6a337c5380fe63db) }},
+  {{ UINT64_C(0x932d01379bad9bc8), UINT64_C(0x45ac008e816196f9), UINT64_C(0x498b249756f71d3c), UINT64_C(0x6d07e147a8f43c82) }},
+  {{ UINT64_C(0xfe06664726aa2be2), UINT64_C(0x3e968d51ea3f3b27), UINT64_C(0xa238fe09edc97e7e), UINT64_C(0xa1f355a546f90a98) }},
+  {{ UINT64_C(0x99b60e2bb772e110), UINT64_C(0xf6487233aa22b14e), UINT64_C(0xea9d16972d7898ab), UINT64_C(0x5ffaf5269c035209) }},
+  {{ UINT64_C(0x5237c8b8fe3f6f44), UINT64_C(0x48a4c0da70cbf3fe), UINT64_C(0x8ccee02b1e3da62b), UINT64_C(0xfb7352d1ef810109) }},
+  {{ UINT64_C(0x4a6ded598ac3c35e), UINT64_C(0x943e96b20f42338b), UINT64_C(0xd064d521038a6307), UINT64_C(0xa6360a7b53632876) }},
+  {{ UINT64_C(0xb77cb6c6d08eca16), UINT64_C(0xc8ebe1cf5c020582), UINT64_C(0x83b6c20a8781e2cb), UINT64_C(0x640bcdbd049cfcff) }},
+  {{ UINT64_C(0x33c07d6dbd660a64), UINT64_C(0xc607841aba2ef9d5), UINT64_C(0x1cd55d7e158d32cf), UINT64_C(0xd6b7d7afb0d9d602) }},
+  {{ UINT64_C(0xe6681a296bcb3ed4), UINT64_C(0x75f0355447efe2ec), UINT64_C(0x0effbf63627553fa), UINT64_C(0x682abad9255a99a5) }},
+  {{ UINT64_C(0x5433117bd0b78b9c), UINT64_C(0x763d6625a0cd9d80), UINT64_C(0xaf6fbbf216bb4971), UINT64_C(0x176cf3bf7c9b9831) }},
+  {{ UINT64_C(0x032cf5fc53f4efc6), UINT64_C(0x4d220f2ddff3d511), UINT64_C(0xad438a96928cf2ea), UINT64_C(0x69013af97d6641d6) }},
+  {{ UINT64_C(0x3c1d68e96716ed60), UINT64_C(0xba9fc47bfac209f1), UINT64_C(0xfb4be81e1c4d6d06), UINT64_C(0xaa8e6783ed32a19c) }},
+  {{ UINT64_C(0xeb1a0aaa25b8d66e), UINT64_C(0x7eb66694250df831), UINT64_C(0x9be2a1a9261758fd), UINT64_C(0xce7af1eb9718c2e3) }},
+  {{ UINT64_C(0x6bbc459d44c55db6), UINT64_C(0xd7026cc46973390c), UINT64_C(0x1e9207e80dd66c23), UINT64_C(0x386be2a9140708a8) }},
+  {{ UINT64_C(0xc124763f3f118b26), UINT64_C(0x021bb93b4cbd3bf7), UINT64_C(0xad347d45e4b28f1c), UINT64_C(0x6c555430b8079a47) }},
+  {{ UINT64_C(0x614e83a08160517e), UINT64_C(0x955486b3816c9a7f), UINT64_C(0xe2c8060c5ab3d69c), UINT64_C(0x3d2390b49ab2c2bc) }},
+  {{ UINT64_C(0x14e1cd2247162db0), UINT64_C(0xa6b1540d24dab663), UINT64_C(0xdef1706f900f9852), UINT64_C(0x6c8359e077da75ff) }},
+  {{ UINT64_C(0x95084f33c36147dc), UINT64_C(0xa761412f3b23d055), UINT64_C(0x70e2dfab186a0226), UINT64_C(0xd2af8b04864a1fc2) }},
+  {{ UINT64_C(0xc6f3783cdfb505bc), UINT64_C(0x9b51c531f2b438ed), UINT64_C(0xffee122afb6d56c6), UINT64_C(0x421af0089e70cb10) }},
+  {{ UINT64_C(0xa08f70d548181478), UINT64_C(0xad4159f0ccfc31b9), UINT64_C(0x61d9e2452b2e5d80), UINT64_C(0x9e05df666144b47f) }},
+  {{ UINT64_C(0xf734d2dd5d2f26fe), UINT64_C(0x04a073cf68ccf316), UINT64_C(0x0feef48887f7b515), UINT64_C(0x170188347edb2bfa) }},
+  {{ UINT64_C(0x88ccde0102a410b6), UINT64_C(0xf8aa9c587f31cfa3), UINT64_C(0x34519dc5fb3efd30), UINT64_C(0x0abec0bc87449aba) }},
+  {{ UINT64_C(0x138a35c023b2153c), UINT64_C(0x9f09384265408ce2), UINT64_C(0x32ec0403af35975d), UINT64_C(0x3b642ff9cc1f561b) }},
+  {{ UINT64_C(0x17693df66999e92a), UINT64_C(0x7a354336220a347d), UINT64_C(0x4a06db8235091d49), UINT64_C(0x8ff94c60f4dfa079) }},
+  {{ UINT64_C(0x63a496bf92ee7d96), UINT64_C(0xf1054fd5148f4c53), UINT64_C(0xf4f86f8c3ec4bc7e), UINT64_C(0x34fc4becdea99696) }},
+  {{ UINT64_C(0x02f6093d6e9e4aae), UINT64_C(0xb02afba70071768a), UINT64_C(0x7f427b4c0c037bfc), UINT64_C(0x049b656e2f43cf42) }},
+  {{ UINT64_C(0xc7350abe69f8f556), UINT64_C(0xd0a694bead6a8948), UINT64_C(0x0ab95517b9ba2f72), UINT64_C(0x9f2e66959cdc7b0e) }},
+  {{ UINT64_C(0x558453b9971fb3d6), UINT64_C(0x38fe026b798b6fd3), UINT64_C(0x44462a91117b893d), UINT64_C(0x1e087e5d9759ebe8) }},
+  {{ UINT64_C(0x29e0a3f5bdc57c96), UINT64_C(0xd83eb1d2a3317fd2), UINT64_C(0x9cb9754a1203fe45), UINT64_C(0x8fb779e93d473fd0) }},
+  {{ UINT64_C(0x7baaff933129a516), UINT64_C(0xdd843600faffc640), UINT64_C(0xc5b4f48e3c4a2ba7), UINT64_C(0x9e9089ae6bb4158d) }},
+  {{ UINT64_C(0x87c7d51bc8deb304), UINT64_C(0x686ec3ed042847c7), UINT64_C(0xe17f7ae2bafabe1d), UINT64_C(0xce2cfea55a1ff6fe) }},
+  {{ UINT64_C(0x9b1b5402e9e2acb0), UINT64_C(0x31b8441b7ae62516), UINT64_C(0xa3d00a989a3102dc), UINT64_C(0x8f5d37acd512320d) }},
+  {{ UINT64_C(0x0a382d6b310f0d46), UINT64_C(0x853203eda3137b15), UINT64_C(0x2c3633081d160f49), UINT64_C(0x91cc0cdeab9cd3d5) }},
+  {{ UINT64_C(0xd2c0aa4e7280acd4), UINT64_C(0xba480a49bddb1824), UINT64_C(0x33fcc258d04d5c44), UINT64_C(0x36f650c5ca45fc10) }},
+  {{ UINT64_C(0x2a9b9636ae9ec224), UINT64_C(0x3f552dc73c77aa31), UINT64_C(0x0626de03387ea69f), UINT64_C(0x05f18e492faa6fac) }},
+  {{ UINT64_C(0x9615bdcdbaec40a8), UINT64_C(0x3c254dca41382989), UINT64_C(0xe6bc679d65ffab31), UINT64_C(0xbdc1d44273b80445) }},
+  {{ UINT64_C(0xdab09276f81a0a60), UINT64_C(0xd98487bc8c2c935a), UINT64_C(0xb4da0e1df7c75003), UINT64_C(0xb13dbbb0b328ed15) }},
+  {{ UINT64_C(0xfdd74543686b3330), UINT64_C(0xa231f1cba3850899), UINT64_C(0x1f0f6af36c1332c2), UINT64_C(0x73c279c1d7f23a36) }},
+  {{ UINT64_C(0xf0e93eab8165269c), UINT64_C(0x22c0c17c7e3ebdff), UINT64_C(0x348dbf42dd81593d), UINT64_C(0xc7d95e63f94cc216) }},
+  {{ UINT64_C(0xb68d4dcd38965aae), UINT64_C(0x066ae1a8d2792f40), UINT64_C(0xe291e1b6e714afd8), UINT64_C(0x6cd41a4da83340dd) }},
+  {{ UINT64_C(0x341fb52937de4730), UINT64_C(0xe57e6965f0f5149f), UINT64_C(0x1894aa2265669bc0), UINT64_C(0x5e88a105478d951c) }},
+  {{ UINT64_C(0xc766bdbf73c1e3b0), UINT64_C(0xdfdbeb6439a26452), UINT64_C(0x15ce463eff63480f), UINT64_C(0xa16a4baa3a9e2dc2) }},
+  {{ UINT64_C(0x8e052016f99a5fdc), UINT64_C(0x2ccc6fecda8b3663), UINT64_C(0x2c3f81457c3f960a), UINT64_C(0xcca729a55598f91c) }},
+  {{ UINT64_C(0x9887ea6c61bd825e), UINT64_C(0x51b72ec5be170c35), UINT64_C(0xe5d41c86dd36a7a6), UINT64_C(0xd1e49e62c7c6a9ab) }},
+  {{ UINT64_C(0xc8d6a42322520aea), UINT64_C(0xc81c6e3bd1430e38), UINT64_C(0xcb7c99170d2309f0), UINT64_C(0xcc871480cec2356c) }},
+  {{ UINT64_C(0xfb05b7d9cb5efa3a), UINT64_C(0x8b41e5d693135986), UINT64_C(0x08aaa6351d89dd46), UINT64_C(0xb1d532cb69d48525) }},
+  {{ UINT64_C(0x64af833bc8afb2f0), UINT64_C(0xf93c439b0a32fa6d), UINT64_C(0xd6e931a8e14a7676), UINT64_C(0x7e74ee525cc33235) }},
+  {{ UINT64_C(0xb90b73faf2bfd306), UINT64_C(0xd238810096a621e3), UINT64_C(0x0ef6595fc6e5644d), UINT64_C(0x70abbcc16ecc81aa) }},
+  {{ UINT64_C(0xfc1dedfbd1e422ee), UINT64_C(0x4b5b34f920d1edd9), UINT64_C(0x75b792639377f2d6), UINT64_C(0x377ff2c277fdb2bc) }},
+  {{ UINT64_C(0xff9a4fdd76345e5e), UINT64_C(0x5fe6b5612eee95de), UINT64_C(0xb95635ccc8e15958), UINT64_C(0x46bf498ab939c0c4) }},
+  {{ UINT64_C(0x415c1f0b72c8bd1a), UINT64_C(0x75d86e268f1f2e73), UINT64_C(0x99fbe988a7325139), UINT64_C(0x2596267a9ae72a10) }},
+  {{ UINT64_C(0xd5875fcbef027f36), UINT64_C(0x2ceb7327134a34fd), UINT64_C(0xccc98576302b15d0), UINT64_C(0x6fa63a9c521d0149) }},
+  {{ UINT64_C(0x08538a07efa36c4c), UINT64_C(0x672255476f981853), UINT64_C(0xd034c46f13b7109a), UINT64_C(0xc0ce634f724ae3a9) }},
+  {{ UINT64_C(0xf1cf6bcd2b464d78), UINT64_C(0x58a6e2ff1ee4c0ee), UINT64_C(0xcacf47d8435027d5), UINT64_C(0x7e3f619decf6572b) }},
+  {{ UINT64_C(0x40d9996a3b899504), UINT64_C(0x17b8fd77699812f2), UINT64_C(0xabbb6aab4f4d69f3), UINT64_C(0x1d63695a496fb91f) }},
+  {{ UINT64_C(0x54109185458d19da), UINT64_C(0xfd5f308d5a3cd05c), UINT64_C(0x38d570e5cc3c4f6a), UINT64_C(0x966430c778cbd104) }},
+  {{ UINT64_C(0xab5fb7888e66bfb0), UINT64_C(0xa92c7b8297c11c2d), UINT64_C(0xb248464d07dde490), UINT64_C(0xc383c7cabe73738a) }},
+  {{ UINT64_C(0xf22c58d0e0530688), UINT64_C(0x343cb09c8d2a5e2a), UINT64_C(0x993f4f3e90b60b43), UINT64_C(0xec94fbd625ccf997) }},
+  {{ UINT64_C(0x2670186304c38bc6), UINT64_C(0x885f9c8715cdba11), UINT64_C(0x92d5457156faf3a4), UINT64_C(0xdd03b801e16a81dd) }},
+  {{ UINT64_C(0xd68afb479e6141de), UINT64_C(0x63433c916e559cce), UINT64_C(0xe508083bd6b2edc7), UINT64_C(0xebfda0d97ddc1402) }},
+  {{ UINT64_C(0x9660b989f871525e), UINT64_C(0x323a608cb88d341f), UINT64_C(0xafa0d3a17001de0e), UINT64_C(0x184e68f4eea4eb5f) }},
+  {{ UINT64_C(0x2d29add4030479f2), UINT64_C(0x8a088aa951ce7571), UINT64_C(0x262bdc43076d3157), UINT64_C(0x54938d6b64996281) }},
+  {{ UINT64_C(0x1e0bd17e3b317440), UINT64_C(0x0e9fc9e8cd729f2e), UINT64_C(0x8c8494fbda407e2e), UINT64_C(0xf4e93374ce9ef9bf) }},
+  {{ UINT64_C(0xd216703fd5fafef6), UINT64_C(0x3f605439fbfcf70b), UINT64_C(0x971dcac961d6aa03), UINT64_C(0xe5fb320173745658) }},
+  {{ UINT64_C(0xb300dd44427dd5ee), UINT64_C(0xd93bbfa8ee1248e9), UINT64_C(0x5e99639b9de79d96), UINT64_C(0xfc0881711b42d68f) }},
+  {{ UINT64_C(0x1235dc2c9a0ff146), UINT64_C(0x4edb03f9e892b8d6), UINT64_C(0x10bf95aac240df27), UINT64_C(0xf9a952a7bfd9852c) }},
+  {{ UINT64_C(0xe5cff68b45b2410c), UINT64_C(0x9be6052d3792fa88), UINT64_C(0xf853b0224d6333cb), UINT64_C(0xc14ddeda8cd5cd7a) }},
+  {{ UINT64_C(0xdc9548156e66b69e), UINT64_C(0xfec48d95b673e18a), UINT64_C(0x77d75c5e09d3d0d6), UINT64_C(0x83bb4afb6aaa92f3) }},
+  {{ UINT64_C(0x171144bc21f087b0), UINT64_C(0x79444591184b1b7f), UINT64_C(0x47e97fc84090ec4c), UINT64_C(0x79c24a32de7c1507) }},
+  {{ UINT64_C(0x868149a8ef90ece6), UINT64_C(0x05d0371fdd7eeafd), UINT64_C(0x17375033b8144659), UINT64_C(0x9d253209242e4213) }},
+  {{ UINT64_C(0x309c141e247c984a), UINT64_C(0x7c15f529b1886e87), UINT64_C(0x4d77569213dac28e), UINT64_C(0x07cde1fa39173154) }},
+  {{ UINT64_C(0xf41fc37e9b65a5e2), UINT64_C(0xd1af9577fe02f03e), UINT64_C(0x0acbf3ea60bdc28e), UINT64_C(0x90d15a6645831633) }},
+  {{ UINT64_C(0x9ea6d366407037da), UINT64_C(0x2d1465caf84a0256), UINT64_C(0x9b658cbed0b054e7), UINT64_C(0x4edb4df813a6dbaa) }},
+  {{ UINT64_C(0xa5e659656ed5366c), UINT64_C(0xb8b69b52e5af400d), UINT64_C(0xafbbd2a0fc626661), UINT64_C(0x76bc30a0f92166b7) }},
+  {{ UINT64_C(0x0fd74581512af56a), UINT64_C(0x6ecc7100e09fd9c7), UINT64_C(0x99e455630948b17c), UINT64_C(0x8eae8b129af5c864) }},
+  {{ UINT64_C(0xf2a0cc56f28fa608), UINT64_C(0xa61541487692db96), UINT64_C(0xc3bc7a802fe93844), UINT64_C(0x45f92b9b6af3534a) }},
+  {{ UINT64_C(0x1f7a1179715bbe52), UINT64_C(0xbfa54db0064ef963), UINT64_C(0x0eb1dbd0d31ecb1d), UINT64_C(0x4d9929d77b03e566) }},
+  {{ UINT64_C(0x8eb761da04256530), UINT64_C(0xd64eaffc8067bcff), UINT64_C(0xb757f968e8db89c3), UINT64_C(0xabb5f823ec257bb3) }},
+  {{ UINT64_C(0xaf2b2eb83c241914), UINT64_C(0x8aa50deb43934fe2), UINT64_C(0x4ec68fb1bca9f57c), UINT64_C(0xbaabc10bbd9bab95) }},
+  {{ UINT64_C(0x0fd3f2058732197c), UINT64_C(0xba2eeb8db26a6f47), UINT64_C(0x39143e9f369b3c50), UINT64_C(0x503439a56fdf5a94) }},
+  {{ UINT64_C(0x499ed09038c12714), UINT64_C(0xe7bd647f061ae2d8), UINT64_C(0x762c9301e06a94b0), UINT64_C(0x6f2aef3359d67de8) }},
+  {{ UINT64_C(0xbbfea67b54bdf770), UINT64_C(0xce4d36adcf8474d6), UINT64_C(0x081d0b2c5bd59e2d), UINT64_C(0xb5c6507667f9f26d) }},
+  {{ UINT64_C(0x1dcf136b7c7bd8b4), UINT64_C(0xcd5751d57cb7e143), UINT64_C(0xe5f62bda32658812), UINT64_C(0x419ad3cb752d5f54) }},
+  {{ UINT64_C(0x727938c76ffc396a), UINT64_C(0x97e630cd9e4269cd), UINT64_C(0xc44d6ecf096a1c06), UINT64_C(0x72206e4f1835e624) }},
+  {{ UINT64_C(0xd2f034c9a9adf4f4), UINT64_C(0x40db55cbfc4d1353), UINT64_C(0x80cb3731bf6e49bd), UINT64_C(0xc9bdf0d5d186e18b) }},
+  {{ UINT64_C(0xff9be251bac12556), UINT64_C(0xdfc85fb2c5357399), UINT64_C(0xc885acf51d7b6a3d), UINT64_C(0x7735d72499588382) }},
+  {{ UINT64_C(0x808b865a6800f176), UINT64_C(0x1bb11017debb482c), UINT64_C(0x6d3e1b347875b4e9), UINT64_C(0xfb81ecff0866c581) }},
+  {{ UINT64_C(0x186eeb470ee7210a), UINT64_C(0x6511360f60209ebc), UINT64_C(0x188ef8ef4d5917e6), UINT64_C(0x95b0486db7ae5735) }},
+  {{ UINT64_C(0xfb41283dbb9b8bea), UINT64_C(0x3fe89393e152926e), UINT64_C(0x1d4fd1f86827b2de), UINT64_C(0xcc5351c512147505) }},
+  {{ UINT64_C(0xe9095a7dffd0ec9a), UINT64_C(0x2c1c63b7f495eabc), UINT64_C(0x66f6d1791adf17ef), UINT64_C(0x9afb4d51ce384541) }},
+  {{ UINT64_C(0xeddc65f2125c69ee), UINT64_C(0x21582b7f4bc8191b), UINT64_C(0x1c50c3527a9d2a32), UINT64_C(0x6a67a2dd023020bd) }},
+  {{ UINT64_C(0x9ba370f0364e682c), UINT64_C(0x14ced781e28ba26f), UINT64_C(0xb610d0068dc0ae3a), UINT64_C(0x925c0eb6140e20ca) }},
+  {{ UINT64_C(0x9fb4a88f3d20f484), UINT64_C(0x7cf7715b15ed74b4), UINT64_C(0x0fe1936ee61a32c6), UINT64_C(0x01c4cfb5a8bd9ada) }},
+  {{ UINT64_C(0x37efba01f4b10d72), UINT64_C(0x873ede6dbe390810), UINT64_C(0x9e4965a5fa62cd8c), UINT64_C(0x5f827b727f0be2a4) }},
+  {{ UINT64_C(0x98d3f868db54bd44), UINT64_C(0x5f89ce902c647cdb), UINT64_C(0xc9ba54466bf829b5), UINT64_C(0x36d75e4907dda125) }},
+  {{ UINT64_C(0x071e71fa2bb31996), UINT64_C(0xcf69c48dec9d56bd), UINT64_C(0x5478c337e6e99b90), UINT64_C(0x02367bef1c8b4ec6) }},
+  {{ UINT64_C(0x4eef90956e58880a), UINT64_C(0xce5448abd4bd8bc4), UINT64_C(0xc4d836aa21cb23c7), UINT64_C(0x3a54d4861468d291) }},
+  {{ UINT64_C(0xb359d1552f1f8fc8), UINT64_C(0x665dfd816ca02b2c), UINT64_C(0x72647637cae25d3b), UINT64_C(0x98f5d9dc78bf27fd) }},
+  {{ UINT64_C(0x1fcdc87a609607c8), UINT64_C(0x8e15551715066768), UINT64_C(0x671205451ecaf318), UINT64_C(0x5c490b30aef5a285) }},
+  {{ UINT64_C(0x16489defb69da928), UINT64_C(0x09558620de44bd80), UINT64_C(0xe0ad6b326f0c4b73), UINT64_C(0x352575e08cdceef3) }},
+  {{ UINT64_C(0x6f035ac08e345fde), UINT64_C(0xcf55cf4307650ab0), UINT64_C(0x649416624efbf3e2), UINT64_C(0x373206c5d2f61fb9) }},
+  {{ UINT64_C(0xa5af0717bc2a7dbc), UINT64_C(0xc137f0d0af21a8d6), UINT64_C(0xac81a8ac82335607), UINT64_C(0xe77dac5f38d79b61) }},
+  {{ UINT64_C(0xc6d925e52bbbffe8), UINT64_C(0x2d20b9b7572f0da9), UINT64_C(0x3ef8090edbfb1ec7), UINT64_C(0x3f0b8db4ea3b4f2b) }},
+  {{ UINT64_C(0x72643a163440025a), UINT64_C(0xdf00f693e5c6ddbf), UINT64_C(0x00b54730d55f579a), UINT64_C(0x84574ec16a8fd03a) }},
+  {{ UINT64_C(0xad48b10546cf82bc), UINT64_C(0xfdd06772a6e2b6c0), UINT64_C(0xc35662d56357dd97), UINT64_C(0xc31e4c4fc0ad6e53) }},
+  {{ UINT64_C(0xee672bd836cd982e), UINT64_C(0xcf340add065c9c7e), UINT64_C(0x29e14af792fd95bf), UINT64_C(0x9ec727ffbc864fa7) }},
+  {{ UINT64_C(0x5d198454f7d39104), UINT64_C(0x2e0cd638e14e1b5f), UINT64_C(0x57883f72b030db5b), UINT64_C(0x57534514f8aab9f7) }},
+  {{ UINT64_C(0xeadc370acfd457d8), UINT64_C(0x3bfde84324b8199f), UINT64_C(0xe85af812e47b65b3), UINT64_C(0x4374a2cf9a11e069) }},
+  {{ UINT64_C(0xd87afa5a03ef9d94), UINT64_C(0x34ea39305f649c12), UINT64_C(0xc00f0e6827917de2), UINT64_C(0x2aacfd8a3470ef65) }},
+  {{ UINT64_C(0x5ce87f1472acf236), UINT64_C(0x2cf0cccd66ccef32), UINT64_C(0x57dcc9976ba3de6f), UINT64_C(0x02b8a58c73051412) }},
+  {{ UINT64_C(0x362dca50e25fd144), UINT64_C(0x932dcffa9f1aa943), UINT64_C(0x962436a497e49002), UINT64_C(0x8fd55be5c1ccd789) }},
+  {{ UINT64_C(0xdc25a1cdb84bc1aa), UINT64_C(0x032fe1bdcca4bac5), UINT64_C(0x28e881e68390bd1d), UINT64_C(0xedbf27cb13f286aa) }},
+  {{ UINT64_C(0xd73b371e50d2178c), UINT64_C(0xd0f4b45a2d9c71c1), UINT64_C(0x2ee9fd0efb0ce9ff), UINT64_C(0xb5f2ba77adcf1526) }},
+  {{ UINT64_C(0x9fff31ede41af12c), UINT64_C(0x07985526cdd5274f), UINT64_C(0x767a9007991bf0c7), UINT64_C(0x2525414b781df657) }},
+  {{ UINT64_C(0x0a9faeee2725d40a), UINT64_C(0x7327ace63f7c1f30), UINT64_C(0x4dd6d89aad1ff2bd), UINT64_C(0xcfc257e287913a11) }},
+  {{ UINT64_C(0xa80e004b40549c0c), UINT64_C(0xb544779ba853d193), UINT64_C(0x4291c0366939760c), UINT64_C(0xb25963b66c601199) }},
+  {{ UINT64_C(0xa2b115339e76c8ba), UINT64_C(0x4b23627631cce79b), UINT64_C(0x83443f6e05d83c2a), UINT64_C(0x6b531f52c7855b08) }},
+  {{ UINT64_C(0xcdd50a82a162a880), UINT64_C(0x3968eeccd5c3c656), UINT64_C(0xce2857f0f8957ae5), UINT64_C(0x9748c31591227297) }},
+  {{ UINT64_C(0x24992519ceb8c108), UINT64_C(0x7930f79958c97b14), UINT64_C(0xb9fc991e3551f875), UINT64_C(0x5533cc5234ded7ba) }},
+  {{ UINT64_C(0xa712aac41f51b074), UINT64_C(0xd0407458ebc9b14b), UINT64_C(0x9674ad87d3320976), UINT64_C(0x9cbd1168b49944c9) }},
+  {{ UINT64_C(0x93faf82140086988), UINT64_C(0x8de4821a8ca4d11f), UINT64_C(0x55bccb4952ef04aa), UINT64_C(0x2fb329d66c904ec9) }},
+  {{ UINT64_C(0x560e8b01fe34e632), UINT64_C(0x3d76344288216e65), UINT64_C(0x815e7bccabab17d0), UINT64_C(0x7edeab8922c33168) }},
+  {{ UINT64_C(0xa04e59b9cd063d5a), UINT64_C(0xc4806cd5d1f5dd11), UINT64_C(0xba3e6b3495a41eeb), UINT64_C(0x3b4e3e1c916d4359) }},
+  {{ UINT64_C(0x398661d77dea337a), UINT64_C(0x202515edbec8f2e8), UINT64_C(0x9be0ce25da37d910), UINT64_C(0xb2e7e091ee2fa596) }},
+  {{ UINT64_C(0xff82871c9716e916), UINT64_C(0x13f74d54517a8772), UINT64_C(0x6238469b59686b7e), UINT64_C(0x0c58e70cbad7d4f3) }},
+  {{ UINT64_C(0x233607b6af57a012), UINT64_C(0xb3d6af4178aa902d), UINT64_C(0x6a19874fbdf77e37), UINT64_C(0x0c3ca4826d6a3cdb) }},
+  {{ UINT64_C(0x51af404bed91e200), UINT64_C(0x988d8f875b1d6a47), UINT64_C(0x5f658c2cf9721929), UINT64_C(0x89bd04ac5ab9de2d) }},
+  {{ UINT64_C(0x8058deaf9ba366c0), UINT64_C(0xa539990b067d4ef7), UINT64_C(0xf1bef1ccbd30fb95), UINT64_C(0x5a32d895fc48955f) }},
+  {{ UINT64_C(0x4370833a74b8bd20), UINT64_C(0x053b4f1692ffca8f), UINT64_C(0x6893bbd74de8429b), UINT64_C(0x06cebfeec8b9d22e) }},
+  {{ UINT64_C(0x8bfe0eb431b5c7c0), UINT64_C(0x8afeddddfbf605e2), UINT64_C(0xaa49bf97de411829), UINT64_C(0x3933a12d5b2336a4) }},
+  {{ UINT64_C(0xddb1b9e3772b35f4), UINT64_C(0x1806b8288cfc18f9), UINT64_C(0xe1eb76207e16bc07), UINT64_C(0x6bbc047ab10c93ce) }},
+  {{ UINT64_C(0x5a7aa0c2977c33e0), UINT64_C(0x17b9db41da402032), UINT64_C(0xc23c2198976a8a84), UINT64_C(0x0adde07a7e683920) }},
+  {{ UINT64_C(0xf941614e1166e98e), UINT64_C(0x6bff000bcf0bc349), UINT64_C(0xff753518ecf52dee), UINT64_C(0x872ef74da1f18096) }},
+  {{ UINT64_C(0xfe49f73dd5aa310a), UINT64_C(0x56fd40d9b5c4647b), UINT64_C(0x69ee1916bed80269), UINT64_C(0xfb055d560e1ec7f6) }},
+  {{ UINT64_C(0xd6659fc8ec81e212), UINT64_C(0xc4f22edf30d3496f), UINT64_C(0x7bf4b238ed404116), UINT64_C(0x0c0f12454cd39f85) }},
+  {{ UINT64_C(0x660f20621cdf4df2), UINT64_C(0xd1f2d0ecae8c8d04), UINT64_C(0x5f32d14311eb3572), UINT64_C(0x5f4fedcec3f29863) }},
+  {{ UINT64_C(0xce1f73a07a96b84a), UINT64_C(0x5c50bdb1d89f765e), UINT64_C(0xe0b809d815984936), UINT64_C(0x990068ad3daed422) }},
+  {{ UINT64_C(0xbc599fd5f18e589a), UINT64_C(0x6369ead0c8b7fc99), UINT64_C(0x5c39bd22e5fa70c3), UINT64_C(0xd14dfc699f5a72a6) }},
+  {{ UINT64_C(0x3505fb67fc80fd6c), UINT64_C(0x2940c81375e6061f), UINT64_C(0xc6d6227e3e8c97e6), UINT64_C(0x8d22fc1cd1d7d200) }},
+  {{ UINT64_C(0xdc7e0b91824baaf6), UINT64_C(0x1afcbf28546fc7f5), UINT64_C(0x5239efc86b654802), UINT64_C(0xa0babbcf4ef95ed7) }},
+  {{ UINT64_C(0x448718ccf54e032a), UINT64_C(0x7fac713af8075d67), UINT64_C(0x1575edb75eb9ff8a), UINT64_C(0xf5b7d72830145994) }},
+  {{ UINT64_C(0xdd178c2e62628bf6), UINT64_C(0x742e9fe3ce6dc185), UINT64_C(0xdc3a1d385321ab9d), UINT64_C(0x723702359e7bc392) }},
+  {{ UINT64_C(0xf6d00d46f10248f0), UINT64_C(0x0f86779efd8c19c7), UINT64_C(0x6c5b6516e79100f9), UINT64_C(0x08b6e23728a53775) }},
+  {{ UINT64_C(0xbb828295bc69f5e0), UINT64_C(0x5c6d53c96dee1455), UINT64_C(0x6cc8052d477a2458), UINT64_C(0xeea8e1664e7702eb) }},
+  {{ UINT64_C(0x9d6c4d327899778e), UINT64_C(0x7bf5e1587941d2dd), UINT64_C(0x9806b9534b6344f9), UINT64_C(0xb66a15279021b88c) }},
+  {{ UINT64_C(0x1f7c793149639038), UINT64_C(0x294d3f358f6e1a3e), UINT64_C(0x413fb23c62ab278b), UINT64_C(0x15c2ed3d2792eebf) }},
+  {{ UINT64_C(0x4cb47be142668908), UINT64_C(0x2c479308b47227ac), UINT64_C(0x5d780ced389d2169), UINT64_C(0x07cabd8499ff6b6a) }},
+  {{ UINT64_C(0x4d781bb0bcee5dce), UINT64_C(0x7e3d2d10cfc1f44e), UINT64_C(0x49738c5084dbd8d2), UINT64_C(0x53f181461703e98b) }},
+  {{ UINT64_C(0x2a89bd7f68e2651c), UINT64_C(0x2dbb59c13dd04bc4), UINT64_C(0x7108cdc46af366d2), UINT64_C(0xc888d2d1ff6d7ab4) }},
+  {{ UINT64_C(0xf46a5b94128e8a1c), UINT64_C(0xfe965bdadfb4b266), UINT64_C(0xbed84c2b8ca12e8d), UINT64_C(0xa584455484acd01c) }},
+  {{ UINT64_C(0x59348b406115bc1e), UINT64_C(0xb8c251676af05cd6), UINT64_C(0xaef30b29fb1fde08), UINT64_C(0x0ac0843a492af68f) }},
+  {{ UINT64_C(0x226351ddae0dc994), UINT64_C(0x2ceb0622b043a43b), UINT64_C(0xfd2cb5abd875a0d4), UINT64_C(0x594b8c7b12f9b890) }},
+  {{ UINT64_C(0x091d39cf6b34d68a), UINT64_C(0x665b3937e853c15e), UINT64_C(0xfe687157d33b23cb), UINT64_C(0xe3f261bda8790874) }},
+  {{ UINT64_C(0x9ff3a7bd284e8b9a), UINT64_C(0x87cdc39a6b3abf4f), UINT64_C(0x771c88d5a54029bf), UINT64_C(0xf579bf11957282ee) }},
+  {{ UINT64_C(0x70a93e0b248bcb36), UINT64_C(0xa3f742ffec5bd9a5), UINT64_C(0xf83528c1f19b79df), UINT64_C(0x6eedd31038959af5) }},
+  {{ UINT64_C(0x0c482a1ade633586), UINT64_C(0xca2bd630d72d78b8), UINT64_C(0x1a4090c7bd27c089), UINT64_C(0xbe8519f6a34900cf) }},
+  {{ UINT64_C(0xc5303ff2e70a809a), UINT64_C(0xdb8aa5517b3c5563), UINT64_C(0xe8bb26edea7d6f59), UINT64_C(0x64661cae34685c17) }},
+  {{ UINT64_C(0xf6aa5a250e75e7b6), UINT64_C(0xfbf1ff897385d779), UINT64_C(0x02869c4e5a3309fe), UINT64_C(0x212d88cc7d7edcff) }},
+  {{ UINT64_C(0x98a56dc37a0eeeda), UINT64_C(0x967118d2534eccee), UINT64_C(0x29e22be68ce22601), UINT64_C(0xe491fe12da06841d) }},
+  {{ UINT64_C(0xefc0551100f53fa6), UINT64_C(0xa4908d9043683482), UINT64_C(0xb779c4ab4e6ff48a), UINT64_C(0xdb73cc9cd484e076) }},
+  {{ UINT64_C(0xab63c536b63972f8), UINT64_C(0xcdce6e9a22d4de9c), UINT64_C(0xfbe569438d59bb66), UINT64_C(0xe8c2d27fd0381c00) }},
+  {{ UINT64_C(0x6786b50a89dc0694), UINT64_C(0x96ece8c779068e7a), UINT64_C(0xa4e823b4b17a7197), UINT64_C(0x38bb7ac769caad9d) }},
+  {{ UINT64_C(0x1ec891883ddf2362), UINT64_C(0x654862a409aba40e), UINT64_C(0x142ed1ead234b17f), UINT64_C(0x80d004ef82fb10fd) }},
+  {{ UINT64_C(0x38046e43087ad4ec), UINT64_C(0xfef5a54241eb921e), UINT64_C(0x829830213aceabc3), UINT64_C(0x0eda06e52e00dc46) }},
+  {{ UINT64_C(0x6b3cc8d8206eda5a), UINT64_C(0xac3bd4f04dce0aef), UINT64_C(0xb439caffecfa58c5), UINT64_C(0x209ce65851a14249) }},
+  {{ UINT64_C(0xdff8cae4052512de), UINT64_C(0x0620b981c3ba052d), UINT64_C(0x0c745e76c6da83c1), UINT64_C(0x00a3a8d77d3ea517) }},
+  {{ UINT64_C(0x46c55281b25bb8c2), UINT64_C(0xf4a610bcca2e6302), UINT64_C(0xe2ebb9ceba1fbfd8), UINT64_C(0x8441ecc3414c7ef5) }},
+  {{ UINT64_C(0x87680920c0a031f6), UINT64_C(0x07cdafee4165ef79), UINT64_C(0x76085688d0218b40), UINT64_C(0x61af42ecc1f6148e) }},
+  {{ UINT64_C(0x4e43f7d167fd7f76), UINT64_C(0xecb9a6fa853703be), UINT64_C(0x19946cc9880f9539), UINT64_C(0x00c8590d3ae0df35) }},
+  {{ UINT64_C(0x9c753b4bd02cf538), UINT64_C(0x2000b97dff678e93), UINT64_C(0x4b00b9febdbf7e50), UINT64_C(0x207c63a369b33a84) }},
+  {{ UINT64_C(0x9415b6f1ad8dfe48), UINT64_C(0x5ffc2650ea0853dd), UINT64_C(0x734a3e3aad00900d), UINT64_C(0x0ea3d7c4d1510e18) }},
+  {{ UINT64_C(0xc50de0ba1fb86628), UINT64_C(0xc7a4aac39e69eb63), UINT64_C(0x5fea33052a0bbff6), UINT64_C(0x27cdf07432e46292) }},
+  {{ UINT64_C(0x7d6a67c57f7f656a), UINT64_C(0xf40718562b925419), UINT64_C(0x5a2ee948f9a6bb76), UINT64_C(0x2dabbc53343d5ec3) }},
+  {{ UINT64_C(0x91e3740944bec482), UINT64_C(0xccf81c5b75ae506c), UINT64_C(0x0cf128b232035692), UINT64_C(0x04afe59baeddfd0b) }},
+  {{ UINT64_C(0x5e8cfcb3abcdc926), UINT64_C(0xc402d4b291105086), UINT64_C(0x681e50479f431892), UINT64_C(0xd99c752a0107230d) }},
+  {{ UINT64_C(0x0f5f86eda579ffd4), UINT64_C(0x5230e9cfa446b100), UINT64_C(0x762875ec0542f0b1), UINT64_C(0x8313b0e56e8eb45e) }},
+  {{ UINT64_C(0xdb015b58290de134), UINT64_C(0xdfc7a40ae0642991), UINT64_C(0x2207059baa461fe5), UINT64_C(0x6dd693fa7bb348d4) }},
+  {{ UINT64_C(0x35d1770d5db4d7d4), UINT64_C(0xe55ec067c25d77ff), UINT64_C(0x2d72d0f37caa859e), UINT64_C(0xfed762a9b6265ac6) }},
+  {{ UINT64_C(0x6f33d543620563c2), UINT64_C(0x15e2e52870178a8f), UINT64_C(0x2c1bd656d7a6ae16), UINT64_C(0x141535ca4f8d1e75) }},
+  {{ UINT64_C(0x46e14975474c6aca), UINT64_C(0x1c0db7282bb8cfbb), UINT64_C(0x7f8776ec3cbabf43), UINT64_C(0xde52386162b80571) }},
+  {{ UINT64_C(0x939c4d582191999c), UINT64_C(0x821429206531759f), UINT64_C(0x300f154b49179765), UINT64_C(0xa942392c8f1f908d) }},
+  {{ UINT64_C(0x193bb7703ef1093a), UINT64_C(0x564734d55428ca95), UINT64_C(0x0228bc18fb02a7bb), UINT64_C(0x50b128f12810864c) }},
+  {{ UINT64_C(0x8c016234401869d0), UINT64_C(0x32fd0e871e372613), UINT64_C(0xe05939b5d4efb009), UINT64_C(0xcd576dc265dbcd46) }},
+};
+
+static const mzd_local_t Li_1[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0x381b22013a717332), UINT64_C(0xedcef4b02ca84c42), UINT64_C(0x9b9d4acb3f1e8a8b), UINT64_C(0x93c74044942a9d65) }},
+  {{ UINT64_C(0xe31b7f3becf64c66), UINT64_C(0x510dcf5e5969c26c), UINT64_C(0xf70963cb64157bdc), UINT64_C(0x1bdee4ad3cf8d0d1) }},
+  {{ UINT64_C(0x7f9776761b54a18c), UINT64_C(0x0f16415b95c98a76), UINT64_C(0xcdfdc9690755ccc4), UINT64_C(0x8b2e24f5c76e17c8) }},
+  {{ UINT64_C(0x3b744fd3c37c7868), UINT64_C(0x3b310b1db6b1d637), UINT64_C(0xd79b11795f66cc30), UINT64_C(0x793700ac09b4dbaa) }},
+  {{ UINT64_C(0x43f395c7967eeb4a), UINT64_C(0x9f49beafcc164941), UINT64_C(0x638c0895694fb7e5), UINT64_C(0xe492dfac8cd52321) }},
+  {{ UINT64_C(0x306543e88755c200), UINT64_C(0x5cd92a57bcf78cd1), UINT64_C(0x9b806b0d942d0c69), UINT64_C(0x5731c81ecfb8c5a7) }},
+  {{ UINT64_C(0xe8b47464b3cb3b02), UINT64_C(0xa8f5c5f5c60e0e7e), UINT64_C(0xe79e048ca71da27c), UINT64_C(0x7f64a4c78b9d3324) }},
+  {{ UINT64_C(0x91f8eaec6b3356d2), UINT64_C(0x10ac8d691de01eb3), UINT64_C(0xa17649cf98061404), UINT64_C(0xa9d23714aee16e5f) }},
+  {{ UINT64_C(0x62e58856d1a44250), UINT64_C(0xddb42a6a3df1cec1), UINT64_C(0x6e57832fb78b56fb), UINT64_C(0xa8025cd391d99721) }},
+  {{ UINT64_C(0x440a432ac34b8bf2), UINT64_C(0x2a372d1850fb84dc), UINT64_C(0x7542981f3e011e42), UINT64_C(0xbc93c67499fa7a7f) }},
+  {{ UINT64_C(0x6aec811a8b9758ca), UINT64_C(0xde9fa8e0c9b0f131), UINT64_C(0x931ce1d32ff0cbaf), UINT64_C(0xe79f6fd42b5b61c2) }},
+  {{ UINT64_C(0x765664b3fbcbdb10), UINT64_C(0x5fab0de19efaa61b), UINT64_C(0x3c2327d5d5806844), UINT64_C(0xc5ea7206f49700fd) }},
+  {{ UINT64_C(0xbf65ed6526030204), UINT64_C(0x4394cef29cd13502), UINT64_C(0x4b7fc2fb83823fe3), UINT64_C(0x5a125ab4fc76887c) }},
+  {{ UINT64_C(0x605044439b9dd5ca), UINT64_C(0x1921858f3a6cfb36), UINT64_C(0x7305a74bfc0f424e), UINT64_C(0xcc85a750c9c34b57) }},
+  {{ UINT64_C(0x43896859c1820f68), UINT64_C(0x95caca634ee01944), UINT64_C(0xfad377d80abf89ef), UINT64_C(0x13c5c1bad99eccf5) }},
+  {{ UINT64_C(0x4e6f2d3948493508), UINT64_C(0xe5798b6d6ac5b2d2), UINT64_C(0x3016e96dd9fdcc05), UINT64_C(0xdb47acfaca4ffcd3) }},
+  {{ UINT64_C(0x84dc1ed0d9f92902), UINT64_C(0x064be0a748ee1c4d), UINT64_C(0xbf277500663fdc84), UINT64_C(0x4e47ed4eac9ae71b) }},
+  {{ UINT64_C(0xc465d3d922a37f94), UINT64_C(0x16f7a82249a3e1fb), UINT64_C(0x486e870164924fc6), UINT64_C(0x2b3f101c4410f7e6) }},
+  {{ UINT64_C(0xbf3ea778e7a56014), UINT64_C(0x69bf46e74a84a4e6), UINT64_C(0x9707e6077a8952ae), UINT64_C(0x5cc8694a25fcbc77) }},
+  {{ UINT64_C(0xe60a03d9ac238cb4), UINT64_C(0xd981d52c58d46828), UINT64_C(0x12788dfe559f48ef), UINT64_C(0xeb9a6b823e63cb61) }},
+  {{ UINT64_C(0xc9cc888046e2e8e2), UINT64_C(0x49a2cd616e77f5b7), UINT64_C(0x755caa27b1a6d7d1), UINT64_C(0x84050d036fe54b02) }},
+  {{ UINT64_C(0xc1f251edfe9d2be0), UINT64_C(0x655b38dc6a1b13f9), UINT64_C(0x8bb0fce94e2a36e2), UINT64_C(0x63312a65abe88e5d) }},
+  {{ UINT64_C(0xcb5ca707c4ae6c8c), UINT64_C(0x22e7ad5a699c3e8b), UINT64_C(0xc8dfd88b0c118a0a), UINT64_C(0x8e7270db270f3600) }},
+  {{ UINT64_C(0xbdcddf557f6e2d9c), UINT64_C(0x320e729baf9418bd), UINT64_C(0xe6f858082feb9f73), UINT64_C(0x1bddd1e0992d3669) }},
+  {{ UINT64_C(0x8ca7a8bd43f20328), UINT64_C(0xef6140ac07416679), UINT64_C(0xf301c5d58732b8b5), UINT64_C(0xb106271fc49a6f4a) }},
+  {{ UINT64_C(0xb0a7d1845c0f6c2e), UINT64_C(0x8864436433d577f0), UINT64_C(0xac75a161b05cd80a), UINT64_C(0x2cf7895daac53785) }},
+  {{ UINT64_C(0xdfb8b0b1175248fe), UINT64_C(0xdd3fa7570087bf1d), UINT64_C(0x2755286366b2887e), UINT64_C(0x96c5970979305399) }},
+  {{ UINT64_C(0x7a0038af07b1b9fc), UINT64_C(0xe26d76e7bd8ea34c), UINT64_C(0x7355418fd2c1c9c0), UINT64_C(0xab729eb3b7b70b4e) }},
+  {{ UINT64_C(0xef8519fb11f6f42a), UINT64_C(0x4c8cba80c516e5e9), UINT64_C(0x1f22eceb79db9873), UINT64_C(0x498850ef42715e9c) }},
+  {{ UINT64_C(0x6c74ffa821a3ee0c), UINT64_C(0xf7694d0187f6dc19), UINT64_C(0x8b7c0d66b3dae3b4), UINT64_C(0x2cc88e1250ebf396) }},
+  {{ UINT64_C(0x15deebe286f2e740), UINT64_C(0xb2a4f1e71f04ee37), UINT64_C(0x08c4919f18200037), UINT64_C(0xfb53312db5cdfcea) }},
+  {{ UINT64_C(0x0e005333c05a684a), UINT64_C(0x6aa02540cdc76d65), UINT64_C(0x317fff6f7ec06ac2), UINT64_C(0x64116dfba7036c3f) }},
+  {{ UINT64_C(0xd4525cc5a5fd0254), UINT64_C(0x6a68d5d79ba1b4e8), UINT64_C(0x921475fafeeba6e2), UINT64_C(0x4067dffb1064b3ff) }},
+  {{ UINT64_C(0x411e2ab88090342e), UINT64_C(0x1773170aac6ca176), UINT64_C(0x83afda9fddfdf359), UINT64_C(0x6612e5e06b2ea7c1) }},
+  {{ UINT64_C(0x2ec1bccd02fff6ba), UINT64_C(0x39b28814238b4ced), UINT64_C(0x756a5a84616fc4de), UINT64_C(0x4db5247dc611c999) }},
+  {{ UINT64_C(0xe14db82b68685004), UINT64_C(0xaefe63f08e2bd44e), UINT64_C(0xbc0c962e1b1b98b2), UINT64_C(0xcfb712899bd80da7) }},
+  {{ UINT64_C(0x954943b89be29db4), UINT64_C(0xd6f8162a232be5dd), UINT64_C(0xdbee85bd95971d7e), UINT64_C(0x72ac1663307af5a6) }},
+  {{ UINT64_C(0x460f6ba4e27b23b8), UINT64_C(0xbab325dc38f0e0b5), UINT64_C(0x5bac2545bcaf70e4), UINT64_C(0x96b0227cea9925a1) }},
+  {{ UINT64_C(0x8a2417d88abd7de0), UINT64_C(0x6f68e6a6eb1f38ed), UINT64_C(0x534dfe27868c225d), UINT64_C(0x095dac0f1dbae29a) }},
+  {{ UINT64_C(0xa1f9f37f0e02a98c), UINT64_C(0xa4e58c4bcf7a0ac4), UINT64_C(0x6dbee20c3620037e), UINT64_C(0x5c854682d4b5ff8d) }},
+  {{ UINT64_C(0x5ce99fd38059597a), UINT64_C(0x2f0cc57e7d22cb89), UINT64_C(0x8d4156181f2e07f9), UINT64_C(0x346180da19b7cdb5) }},
+  {{ UINT64_C(0x6e21387be5d9c61c), UINT64_C(0x888db5a2ca7c9c9a), UINT64_C(0x2ffb44f483ada53e), UINT64_C(0x10313ab24e53bae8) }},
+  {{ UINT64_C(0xe259d3b2b7a02476), UINT64_C(0x8b85f81530ab5d94), UINT64_C(0xa4134fb0b2c45df3), UINT64_C(0xcab17ef225e2d458) }},
+  {{ UINT64_C(0x4970ed7d5251de9a), UINT64_C(0x808f24cb022a16e7), UINT64_C(0x0c6d2051ee14f7e1), UINT64_C(0x6e0407c186c01227) }},
+  {{ UINT64_C(0xa81a6efa8a0cdcde), UINT64_C(0xa47f9fec8d2c0e1e), UINT64_C(0x8615b4fa5b215350), UINT64_C(0x4fa771690bf301ed) }},
+  {{ UINT64_C(0x425b82b8eaf252f6), UINT64_C(0x505b51fc205c45b7), UINT64_C(0x0d2ac90e1f3b642a), UINT64_C(0x4efe80dca7e3f10f) }},
+  {{ UINT64_C(0xc64f63e0e3ff1f3a), UINT64_C(0xd5c2980918f68d90), UINT64_C(0xe2a58541010c30fa), UINT64_C(0x7e9b6ac1ad2eacda) }},
+  {{ UINT64_C(0x799447a92bdb7eaa), UINT64_C(0x3b76d16a6f53f8b7), UINT64_C(0xbe88efb86df453d5), UINT64_C(0xfc7311c6d716d3db) }},
+  {{ UINT64_C(0x7f54c36d33278a28), UINT64_C(0x884bb2057d201107), UINT64_C(0xcd068d5a9a1abcfa), UINT64_C(0x2c6f3d51dfb46519) }},
+  {{ UINT64_C(0x3afd7d9776d3f560), UINT64_C(0x546d8730d31edd89), UINT64_C(0x262c7cb262c599db), UINT64_C(0xbf55227721a379a4) }},
+  {{ UINT64_C(0xf753679dd7fcbffa), UINT64_C(0xac67c32a1a3d2491), UINT64_C(0x457f52dee5017d2d), UINT64_C(0x254b109568c83951) }},
+  {{ UINT64_C(0xbac402df735b8ea2), UINT64_C(0xa6b260b2201293e6), UINT64_C(0xcced68f30ec0e547), UINT64_C(0xdb3015885b52c89c) }},
+  {{ UINT64_C(0x575e89a23a532fae), UINT64_C(0x60d2472ea15474d0), UINT64_C(0x60ddfaa32c0c5f51), UINT64_C(0x7056e2f7df00dafa) }},
+  {{ UINT64_C(0xe7930f2266c0419e), UINT64_C(0x02b34b4e727c6ead), UINT64_C(0x040f2c34573c1379), UINT64_C(0xb51ca4def41efc9f) }},
+  {{ UINT64_C(0x0d395dd44adbae82), UINT64_C(0x142d70173bfe60ea), UINT64_C(0xabfc57c6f6e43678), UINT64_C(0xb3edb47ca2cee329) }},
+  {{ UINT64_C(0x854380021ae77aec), UINT64_C(0xf15aa1a1df3a3ab2), UINT64_C(0x7e7725ff9ffcfa09), UINT64_C(0xe92d60f5339d2f1c) }},
+  {{ UINT64_C(0x8ea41cf2554d9128), UINT64_C(0x8867b4fcd7d60b53), UINT64_C(0x5c090b9e4aa1bcdd), UINT64_C(0x56f454a0af60b0bd) }},
+  {{ UINT64_C(0x75f534b3fd705610), UINT64_C(0x340e5d2e7efad32f), UINT64_C(0xa125dd8122d75e01), UINT64_C(0xc60df34b23018617) }},
+  {{ UINT64_C(0xe0f19eeedd70a2ec), UINT64_C(0x8b7115c2a7abdb69), UINT64_C(0x70da5b249eff7801), UINT64_C(0x513a7bfe1c3894fb) }},
+  {{ UINT64_C(0x0487d087827d56ec), UINT64_C(0xe0916f87d945166b), UINT64_C(0xe10c8cf066ede1db), UINT64_C(0xe233c12054008d79) }},
+  {{ UINT64_C(0x4ef2a30f0cb4a012), UINT64_C(0xa4a619317f3e695c), UINT64_C(0xca5655c36cc33dd1), UINT64_C(0x04f66ac30ce4f1f9) }},
+  {{ UINT64_C(0xb531cf78742c1672), UINT64_C(0x3d6b6802583136be), UINT64_C(0x0889d555e932e17a), UINT64_C(0x6e456afeb1a34eca) }},
+  {{ UINT64_C(0xe8e865cfbee15964), UINT64_C(0xfb998af9c98dcfe6), UINT64_C(0x39bdcf528168bc06), UINT64_C(0xf575392a3b637d82) }},
+  {{ UINT64_C(0x2c010d3039b2a2b8), UINT64_C(0xcbd683d4c2f75a92), UINT64_C(0xf3ccd67be10f1032), UINT64_C(0x737afb62ebb42164) }},
+  {{ UINT64_C(0xf9206caf87d9fe2a), UINT64_C(0x818d016ea2b1cdcc), UINT64_C(0xa3ef43f90bdb19e2), UINT64_C(0x92743cb3ca3bd965) }},
+  {{ UINT64_C(0xb27d8f8e8be9e0ea), UINT64_C(0x6d982e5f187cc977), UINT64_C(0xb68d9840897cb2db), UINT64_C(0x5db37b1e1ced4963) }},
+  {{ UINT64_C(0xbaa0bb6034727bce), UINT64_C(0x503babe59e8c9e0a), UINT64_C(0xb38f419b3d495209), UINT64_C(0x31d50322cfb2b9b0) }},
+  {{ UINT64_C(0x8c2d948114f9b7ba), UINT64_C(0xe77341ff6875becc), UINT64_C(0x5a572f0b9723038d), UINT64_C(0xc459cb70318a5ca8) }},
+  {{ UINT64_C(0xee8fb0d0c6e9ce46), UINT64_C(0x2ad87ed94bbe5c6f), UINT64_C(0x0a42950da8ea70a6), UINT64_C(0xa50c754083d7b88a) }},
+  {{ UINT64_C(0x7107f98585107ec0), UINT64_C(0x5c8a428f70205e8f), UINT64_C(0x562c5a233a411aa0), UINT64_C(0x22b502112ae15d70) }},
+  {{ UINT64_C(0x2de53a7fb554febe), UINT64_C(0x61a426fc76f203db), UINT64_C(0x2d39c9995747a506), UINT64_C(0xb9cccaa8af9268b9) }},
+  {{ UINT64_C(0xb46655b3ac4dcb16), UINT64_C(0x6ef5e116b08b20b9), UINT64_C(0xf314e88b84164f3d), UINT64_C(0x7a09ac0014602d4e) }},
+  {{ UINT64_C(0x7b645b9cfceab716), UINT64_C(0x105ef8b5b6724ed2), UINT64_C(0x9b77edb1ad31e005), UINT64_C(0x5656a10bf17719d1) }},
+  {{ UINT64_C(0x4dc302579c701b56), UINT64_C(0xd60362b97ec9683e), UINT64_C(0x40c11afe66c5ee38), UINT64_C(0xd1bd7590399bddbb) }},
+  {{ UINT64_C(0xcb88db80da077b4c), UINT64_C(0xa39bca03f04cd5ac), UINT64_C(0x83090aa778436ec5), UINT64_C(0x8eb04f6ac624fa8c) }},
+  {{ UINT64_C(0xb756c2577b2a900e), UINT64_C(0x8342550fc0d402c8), UINT64_C(0xbe10d7514159c172), UINT64_C(0xf6bf13b8afe664a0) }},
+  {{ UINT64_C(0xa63560aa4a83e9d4), UINT64_C(0x3ba55caee1f6fcd3), UINT64_C(0x43fabd894f28a9b7), UINT64_C(0xc4b881cda4c6af6f) }},
+  {{ UINT64_C(0x8423ba8e85f02912), UINT64_C(0x3943f4e45d9b69d3), UINT64_C(0xd8e74ccdb3c27ce4), UINT64_C(0xccd5e951c7eff5d3) }},
+  {{ UINT64_C(0x1a28d93188069b4a), UINT64_C(0x802cf094975c691c), UINT64_C(0x32cee9593c2d6c6a), UINT64_C(0x17c3ef5546466488) }},
+  {{ UINT64_C(0x34532bf5801337a0), UINT64_C(0x0b5b527a1738c810), UINT64_C(0x13d5cb29d29d7815), UINT64_C(0xd7ecfbc141ede3a3) }},
+  {{ UINT64_C(0x8e2f353a9c9a246c), UINT64_C(0xb498e948e20a619c), UINT64_C(0xd562912a5aca4625), UINT64_C(0x16a2fa89252de909) }},
+  {{ UINT64_C(0xd51e69e5301de75c), UINT64_C(0xac5570ff24a3641c), UINT64_C(0xd2291a6459e3262d), UINT64_C(0x2a9524a544c429a8) }},
+  {{ UINT64_C(0x2d955de2de38b134), UINT64_C(0x863d02979e733a1b), UINT64_C(0x6aa21e2760cf9703), UINT64_C(0xacd5aa17737d09ee) }},
+  {{ UINT64_C(0x52e32f0ae5b72a04), UINT64_C(0x5bcc9e15366263e5), UINT64_C(0x448f2881902996c5), UINT64_C(0x66e69e0455249d07) }},
+  {{ UINT64_C(0x03d4bd891dbc6130), UINT64_C(0x250e6b0e63fc7624), UINT64_C(0x45caa76cb8a18fa2), UINT64_C(0xd4f9c1db5a5acd35) }},
+  {{ UINT64_C(0xe673c14422d74f16), UINT64_C(0x1e43ec8bdca55a48), UINT64_C(0x70b8a04c214cc100), UINT64_C(0x6e458a3366d2fd79) }},
+  {{ UINT64_C(0x329a3c7f82164308), UINT64_C(0x199863ca9e5e5e5c), UINT64_C(0x294d1c6bd90934e3), UINT64_C(0x1c9f9505a104149c) }},
+  {{ UINT64_C(0xff0ef3822407a324), UINT64_C(0x6cc07e389c00d6d8), UINT64_C(0x0036ef2142bc59b9), UINT64_C(0xb7eb5f160b5ec347) }},
+  {{ UINT64_C(0x9672f8dadd178fc8), UINT64_C(0x9ee06c628804f102), UINT64_C(0x6ae42cc626f99d7d), UINT64_C(0x9235abac704a06d5) }},
+  {{ UINT64_C(0x6f2588cdfff43afa), UINT64_C(0x5c653dcfa8bcdd3b), UINT64_C(0x8dbfb0ff034ae1cc), UINT64_C(0x1ac6b995f28e1568) }},
+  {{ UINT64_C(0x493f61f067a696ee), UINT64_C(0x7462d3cfceb008c7), UINT64_C(0x8ce1fa54b0b1d662), UINT64_C(0xa050531bd634b241) }},
+  {{ UINT64_C(0x6e14ab1cf296c156), UINT64_C(0xefe4486e8052b588), UINT64_C(0x7239024bd48bf530), UINT64_C(0x4c6caf3a594536e8) }},
+  {{ UINT64_C(0x4dc4bd5d2ea52e40), UINT64_C(0x09a98bd4db832a23), UINT64_C(0xd2e3e2f2b872c114), UINT64_C(0xf06da77c2463dd57) }},
+  {{ UINT64_C(0xc3a0c125d320216c), UINT64_C(0x8fc3d33936224e80), UINT64_C(0xd476b2cb3b3f5eb1), UINT64_C(0xda34ae5c21f51bba) }},
+  {{ UINT64_C(0xea914d3fa4f748c6), UINT64_C(0x0e0b293822eed471), UINT64_C(0xed173ccd62249968), UINT64_C(0xf7ed073f8f3330ee) }},
+  {{ UINT64_C(0xcff95a8c648ee482), UINT64_C(0x390205e2f7e4338e), UINT64_C(0x1d47b3aa9a99385e), UINT64_C(0x6b29a7d74b4de80f) }},
+  {{ UINT64_C(0xaca4b946e4512392), UINT64_C(0x2e8f15770353ac28), UINT64_C(0x2bc06964c05560f6), UINT64_C(0x81658529fb5faeaa) }},
+  {{ UINT64_C(0x0913673edb311920), UINT64_C(0x3090bc57d3c54af1), UINT64_C(0xd38d93322eb25685), UINT64_C(0x5371605991a17ec2) }},
+  {{ UINT64_C(0x0ef9237ee2856348), UINT64_C(0xddd3fa22a4922f21), UINT64_C(0x9501682c1ff08e92), UINT64_C(0xeecb63a6c6cc48cf) }},
+  {{ UINT64_C(0xdba7975d6f939e62), UINT64_C(0x101729fd1df59f06), UINT64_C(0xf437bcc091bb5899), UINT64_C(0x32a26bec37eae810) }},
+  {{ UINT64_C(0x693838de6314f21a), UINT64_C(0x21329365d642cadc), UINT64_C(0x1aae04016ee486ac), UINT64_C(0xe4ccdab995c43acc) }},
+  {{ UINT64_C(0xa2af4626530c9b7e), UINT64_C(0x90ce7aa76cce90d7), UINT64_C(0x48abc9029fa5e872), UINT64_C(0x42572bf6908a8864) }},
+  {{ UINT64_C(0x5e33279f968b0a84), UINT64_C(0x153860c22b034336), UINT64_C(0x5351910e26e9728e), UINT64_C(0x242559d996c0c4ea) }},
+  {{ UINT64_C(0xd2c80c83f92a91a4), UINT64_C(0xd80f4dacfce3233f), UINT64_C(0xdf3d6a94a2e72b0a), UINT64_C(0x69fff1f326ee5152) }},
+  {{ UINT64_C(0x5dce1201d400bf6c), UINT64_C(0xf84b5cd6c5ef0508), UINT64_C(0x4ba87d682a1a80fc), UINT64_C(0xd452805329251618) }},
+  {{ UINT64_C(0xafaa5c344737acf6), UINT64_C(0xab63b0e753d39488), UINT64_C(0x003ec435c65505c1), UINT64_C(0x031827b0940c277b) }},
+  {{ UINT64_C(0x89faaa54bfc76772), UINT64_C(0x6d913a816d08617e), UINT64_C(0x1d66a15f3da74cfb), UINT64_C(0x69ac50bfd8e19e06) }},
+  {{ UINT64_C(0x41b0a8fbc1bb2688), UINT64_C(0x3000b37ccf4e735e), UINT64_C(0x789ab88a0fd97736), UINT64_C(0x7586b1ce005916ed) }},
+  {{ UINT64_C(0xd1aaffe910d26b0e), UINT64_C(0x205871d85819e347), UINT64_C(0xcaa73be6ba1238b4), UINT64_C(0xec04f6bcda5d140a) }},
+  {{ UINT64_C(0x88aa858c3c0d4078), UINT64_C(0x45b1896d902b16ba), UINT64_C(0x8fd5c6165d4548bc), UINT64_C(0xb9de775fe6b5f2b1) }},
+  {{ UINT64_C(0xa35b1cb2fcf382b4), UINT64_C(0x8197bf9dd2fb0ea5), UINT64_C(0x837cb22ccbd68741), UINT64_C(0x90cd20cc575cbee5) }},
+  {{ UINT64_C(0xf6a255266b1b0bbe), UINT64_C(0xf1951b7cf0b34de8), UINT64_C(0x0bc2f002f8150af3), UINT64_C(0x68e98cf5de6689de) }},
+  {{ UINT64_C(0x4cddc7c553c8c482), UINT64_C(0x5cfb5a665cb08ef0), UINT64_C(0x317df4d0cd76dd41), UINT64_C(0x6e504f04822125fa) }},
+  {{ UINT64_C(0x829539ecf1ad1200), UINT64_C(0xab2415b7514df0fe), UINT64_C(0x4a80bb0884958482), UINT64_C(0xca3811b799b727c9) }},
+  {{ UINT64_C(0x04da96308fb385a6), UINT64_C(0xb3902e35637d2bc2), UINT64_C(0xa0c1ad64a99cfea6), UINT64_C(0x992027f73601430e) }},
+  {{ UINT64_C(0x6eb53a1b34024796), UINT64_C(0xe6e1cc684b0d9298), UINT64_C(0x801d132998105142), UINT64_C(0x724d885726802032) }},
+  {{ UINT64_C(0xecd4ced87037a6b2), UINT64_C(0xf454360f6f47e9d8), UINT64_C(0x544d106db449caa7), UINT64_C(0x1f72a67ff16ac962) }},
+  {{ UINT64_C(0x9e3b06519f42de98), UINT64_C(0x7d6eb11d1fb4ade6), UINT64_C(0x8b7b9da0de902e6a), UINT64_C(0xf98809a167328896) }},
+  {{ UINT64_C(0x96a7531dd61df204), UINT64_C(0xfa53627228273445), UINT64_C(0x4170fe26cfeecb50), UINT64_C(0xe19e68ba6f7d2783) }},
+  {{ UINT64_C(0x6259115f8e04fcdc), UINT64_C(0x1b3d04f4c5a20dbc), UINT64_C(0xb441d1e4ecb8ef04), UINT64_C(0x206301f80c134f9b) }},
+  {{ UINT64_C(0xc4c58ab7f6bddff2), UINT64_C(0x2d22d4e4af4e7ed3), UINT64_C(0xed7d6efda2d19544), UINT64_C(0x5db8f6dd1749a960) }},
+  {{ UINT64_C(0xe1dbacd970f9e1d2), UINT64_C(0x9fbe2c68c9ab98b6), UINT64_C(0x35094231c40ced49), UINT64_C(0xd630a4bcc806727b) }},
+  {{ UINT64_C(0x7bf3a960cf961840), UINT64_C(0x590163184e5a1676), UINT64_C(0x6b7be49e9e38eddf), UINT64_C(0xa5afcb5cb4981df1) }},
+  {{ UINT64_C(0x9f8b44078764f152), UINT64_C(0x9db21dd2bc55f080), UINT64_C(0xe77c9038bc18ec67), UINT64_C(0x19af48bb6f67599b) }},
+  {{ UINT64_C(0xd777927779ca8a8e), UINT64_C(0xb76d98d6b3ad2a82), UINT64_C(0x5a7c97455f22d654), UINT64_C(0x7bb9d1ad216557c6) }},
+  {{ UINT64_C(0xde88f83996fa6994), UINT64_C(0x1e3305b35679b17b), UINT64_C(0xf2a5fd92d8dc5d78), UINT64_C(0x716cc8cfaf1dade2) }},
+  {{ UINT64_C(0xec5f1b295b17e856), UINT64_C(0x4068e7757f18f675), UINT64_C(0x55bcc152e16b2597), UINT64_C(0x11a6eecede976c53) }},
+  {{ UINT64_C(0x876f3da3dd83b9be), UINT64_C(0x3926b8d2bb6c5361), UINT64_C(0x8acdf8c2808c7a86), UINT64_C(0x35fc136be6f055ac) }},
+  {{ UINT64_C(0x3d41d4e1d9ab4c60), UINT64_C(0x4e98df03abcf4e34), UINT64_C(0x91ca16baa1233d0d), UINT64_C(0x85d7dceb33e246de) }},
+  {{ UINT64_C(0x89e563b7cc2fd1a8), UINT64_C(0x0ae756985ab88acf), UINT64_C(0x29cc09dc585d373f), UINT64_C(0x3ecd3e49f01e8bef) }},
+  {{ UINT64_C(0x9f30fd9eebe56608), UINT64_C(0xbf1c79676b3aed24), UINT64_C(0xef556453eea93508), UINT64_C(0x393ff7bc7d6928b4) }},
+  {{ UINT64_C(0xb6e1f324d2744280), UINT64_C(0xc9e534cbec76bee2), UINT64_C(0xff172bdddd9c0b10), UINT64_C(0x6aa52d244c06d3db) }},
+  {{ UINT64_C(0x7044a907feeb12a8), UINT64_C(0x8dd3cf699d8b412c), UINT64_C(0x0b129bbbd8478315), UINT64_C(0x18bd2d992173a22d) }},
+  {{ UINT64_C(0x4bf7a11d4357a462), UINT64_C(0x5c14c6c8bc3eac17), UINT64_C(0x263a1a7d613bc824), UINT64_C(0xa776a6f476e8e4d5) }},
+  {{ UINT64_C(0x4a5b0befca19a928), UINT64_C(0x827e89e46eb12fce), UINT64_C(0x4b28fb4119d5937b), UINT64_C(0xb9e686a80482744c) }},
+  {{ UINT64_C(0xe373d529aeb809de), UINT64_C(0x80da9afce5b72329), UINT64_C(0x67517bc0deabdb18), UINT64_C(0xe23e2113fff11949) }},
+  {{ UINT64_C(0x76177b6b5880c728), UINT64_C(0x43cc6c76c79bf451), UINT64_C(0x8e2bed8a91b5400d), UINT64_C(0x9ef30277ddf9cff4) }},
+  {{ UINT64_C(0xe0d1469c537e4674), UINT64_C(0x48e513d164bbb192), UINT64_C(0x4c8ed4af44abe777), UINT64_C(0x9c974190e9a83b61) }},
+  {{ UINT64_C(0x300bcdeb9b92b464), UINT64_C(0x27c57fcc0a9f5d1f), UINT64_C(0xe928adabfe285030), UINT64_C(0x5b284253b8ec1235) }},
+  {{ UINT64_C(0xd745cfc0afca8724), UINT64_C(0xb5606a886a270030), UINT64_C(0x77db94db7b6f4889), UINT64_C(0x9a95c7f4d2ef594d) }},
+  {{ UINT64_C(0xc9246e78b839583e), UINT64_C(0xf9790a7e3919cc9b), UINT64_C(0x6a8ebf297d5c9da7), UINT64_C(0xcee8c21e8dd716e3) }},
+  {{ UINT64_C(0x72e14b126449bc78), UINT64_C(0xc07fc6d53ed2c4d1), UINT64_C(0x3ef0aa63d4c5c16a), UINT64_C(0x67a522e922520699) }},
+  {{ UINT64_C(0x3da2edb8a36f4926), UINT64_C(0xd40b771464e6428b), UINT64_C(0xb00d3b26128b485f), UINT64_C(0x9b2c2b75806c3783) }},
+  {{ UINT64_C(0x906b6075d081e142), UINT64_C(0x00bd5842b730b492), UINT64_C(0x79f935f47c99dc82), UINT64_C(0x52f12a7af321fe28) }},
+  {{ UINT64_C(0x61fecad0bb564016), UINT64_C(0x798ea0017b8716b3), UINT64_C(0x91a4166e9bb9cb85), UINT64_C(0xb07624b9c17b988a) }},
+  {{ UINT64_C(0x4a9a35adee62da5a), UINT64_C(0x469421d99f785058), UINT64_C(0xb2aeed65af50c407), UINT64_C(0xbfbc2da2ba649002) }},
+  {{ UINT64_C(0x9bb89729503add80), UINT64_C(0xfd162bab93cb7b4a), UINT64_C(0xf9870d52acd9c093), UINT64_C(0x3aea8a25532ce8b2) }},
+  {{ UINT64_C(0x6f7ac563539fe5d6), UINT64_C(0x38be75190b91c428), UINT64_C(0x4c574273d940196f), UINT64_C(0xa0c607b8085e2f42) }},
+  {{ UINT64_C(0x2b12d141f06e63ac), UINT64_C(0x2c584b087af090af), UINT64_C(0xb6331cb1b4bd0944), UINT64_C(0x3de910f603ef0e75) }},
+  {{ UINT64_C(0x1d79638d9216c5d0), UINT64_C(0xb71e1e0abb3a1522), UINT64_C(0x9fbb31059acf381d), UINT64_C(0xa89f05e6bd4dc928) }},
+  {{ UINT64_C(0xda705ca1411c62c6), UINT64_C(0x31e23c961784ca37), UINT64_C(0x91fb132b737b56b8), UINT64_C(0x3b0fb6fe03d32060) }},
+  {{ UINT64_C(0x647b536b58e58770), UINT64_C(0x6330176b9f4a180a), UINT64_C(0xc8bc33e2fd12e863), UINT64_C(0xf791b0d508adae91) }},
+  {{ UINT64_C(0x07d968872e10a1fc), UINT64_C(0xc8e194a35107e807), UINT64_C(0x5e14b62077369565), UINT64_C(0xc902280c5050b290) }},
+  {{ UINT64_C(0xebd4ca3472ff959e), UINT64_C(0x3b18b82d972bf38a), UINT64_C(0x6a3fa54639131145), UINT64_C(0xb98b32df09c1fd3b) }},
+  {{ UINT64_C(0xd4e75fe48d26a624), UINT64_C(0xa9fdfe2ca138fee5), UINT64_C(0xd26e4816c47c7960), UINT64_C(0x1aee37366a268f4c) }},
+  {{ UINT64_C(0x619d5dd9d0b555a4), UINT64_C(0x90b0fbf403fe57c7), UINT64_C(0xddced016282c0649), UINT64_C(0xbe9eaff37b59c459) }},
+  {{ UINT64_C(0xba25e40f3b717ac6), UINT64_C(0x4c8296a51043dadc), UINT64_C(0x51d5f5ac5edde14e), UINT64_C(0x7c71cc5df2a88660) }},
+  {{ UINT64_C(0x413d433966070efa), UINT64_C(0x2813e82f865b5662), UINT64_C(0x6903aa5a5655548c), UINT64_C(0xebffaf16ef8dd91e) }},
+  {{ UINT64_C(0x6b436b46f864b4c6), UINT64_C(0xc71edb5c45fc6f45), UINT64_C(0xebdd2ded0095defc), UINT64_C(0x1db001d9a1d4be3b) }},
+  {{ UINT64_C(0x6ede1582c02726a6), UINT64_C(0x23bd6d3e7552b58e), UINT64_C(0xddca5cf4394a8a3a), UINT64_C(0x37c4ea089338c70e) }},
+  {{ UINT64_C(0x2077d626511e5420), UINT64_C(0xce0aaa29ee6913ff), UINT64_C(0xb3108dcd91aaf789), UINT64_C(0x9be2093bfd9145c5) }},
+  {{ UINT64_C(0xf52397ee49ddc008), UINT64_C(0x8efe3ed9f4baa16a), UINT64_C(0xfc495d46d9427e11), UINT64_C(0x9ee5490d6876fdb3) }},
+  {{ UINT64_C(0xfb1dc455807914fe), UINT64_C(0xd537008d66a1f026), UINT64_C(0x28badc3d4a6673e4), UINT64_C(0x493693c10f119c18) }},
+  {{ UINT64_C(0x92c1b6ba1720e22a), UINT64_C(0x3f7098d0d2b5cf71), UINT64_C(0x602e7ff640a75bfb), UINT64_C(0x9852abfc1a0f001f) }},
+  {{ UINT64_C(0xdfb11ea887bb8100), UINT64_C(0x7d74f34caef053ad), UINT64_C(0x1676a928a7954ee2), UINT64_C(0x124e688e45a9a4bd) }},
+  {{ UINT64_C(0x796036b16057d026), UINT64_C(0x897981699a4f81fc), UINT64_C(0xb938c7cbdbe05de3), UINT64_C(0x3cc581d954b08d36) }},
+  {{ UINT64_C(0x62564bb3ec92cd9e), UINT64_C(0xdcabecf2f50aa61e), UINT64_C(0x2eb79cf7cad3e72a), UINT64_C(0x94c56b99e52b93a8) }},
+  {{ UINT64_C(0x625df5cd6e32f908), UINT64_C(0x4c31368f7045dc37), UINT64_C(0x1c888278a783f61b), UINT64_C(0xb1d4e6af2edc50f6) }},
+  {{ UINT64_C(0xe40d5a72d97ad33a), UINT64_C(0xc0a677dd5d90195f), UINT64_C(0xf135db62d2d9795e), UINT64_C(0x3661066cbff28757) }},
+  {{ UINT64_C(0x6c3c34f07cbdde88), UINT64_C(0x2f266365e736ef87), UINT64_C(0x6126b6013a700ae1), UINT64_C(0x003074dd8dc36d5d) }},
+  {{ UINT64_C(0xc0e898907ef01e7e), UINT64_C(0x1701a3f8e69a75a0), UINT64_C(0x086adf4f5b1b5cbf), UINT64_C(0xe2c40b6728258616) }},
+  {{ UINT64_C(0xe2c741900fd8b60c), UINT64_C(0x89eab275a4c08149), UINT64_C(0x3a275766bb981e2a), UINT64_C(0x7a92746d76c74844) }},
+  {{ UINT64_C(0xd53d913ddca5f85c), UINT64_C(0x100361af49980bc3), UINT64_C(0x4f4b7c1f6f2553fc), UINT64_C(0xab74fb1a3b3d2c03) }},
+  {{ UINT64_C(0x51fbe7b3405d27e6), UINT64_C(0x2c2786810bb8696f), UINT64_C(0x995ba5da4f0ea0be), UINT64_C(0xd035969f564a731f) }},
+  {{ UINT64_C(0x28c188277afa745c), UINT64_C(0x87b8b0e6e94a7b67), UINT64_C(0x1a86798e9c5b6b1a), UINT64_C(0xdfa8b512e4918b12) }},
+  {{ UINT64_C(0x3dcd4a19267469e6), UINT64_C(0xf1e4fba93ded95f0), UINT64_C(0xc2889956edcc6b4c), UINT64_C(0xbaf854bb8bd29d86) }},
+  {{ UINT64_C(0x2e44a805401e18b4), UINT64_C(0x4adea4776451cb38), UINT64_C(0x1447fd88b2205eed), UINT64_C(0xb4d9510d9860b671) }},
+  {{ UINT64_C(0x19e8e9170682fc3c), UINT64_C(0x90736cc4f0c889e1), UINT64_C(0xad34d69c16d44685), UINT64_C(0xf08f9207cec6081a) }},
+  {{ UINT64_C(0x9655b2ca14026208), UINT64_C(0x5a6abd8d08f99379), UINT64_C(0xd32d729ebb453aca), UINT64_C(0x305ab3268099a3c2) }},
+  {{ UINT64_C(0x999dc7d436b4940a), UINT64_C(0x281e0bfc9326e7f5), UINT64_C(0xa42f28698eed9ac0), UINT64_C(0x92fac968773d4d2a) }},
+  {{ UINT64_C(0x6706b6001f6cf6d0), UINT64_C(0x60477bdc833f57ac), UINT64_C(0x09d9851f3b35ceaf), UINT64_C(0x53f1917c268b0fb0) }},
+  {{ UINT64_C(0xa4feef6c8f44e982), UINT64_C(0xc85fae4103819daa), UINT64_C(0x6c1e437961ec71ff), UINT64_C(0xd386fcd43ee61b52) }},
+  {{ UINT64_C(0xdf484e45a47fc62a), UINT64_C(0x1a510f4e969edf30), UINT64_C(0xaef840a6a6788fc4), UINT64_C(0x1c67a0a464b16d35) }},
+  {{ UINT64_C(0xb31102f2c1a39e14), UINT64_C(0xb2a2bfb4842a58c5), UINT64_C(0xcb4d0e9f9386acc8), UINT64_C(0x3a5af428e524c37b) }},
+  {{ UINT64_C(0x44b7a27ba4d3c506), UINT64_C(0xfd7d1a040fec6b76), UINT64_C(0x2300ca8e8a2abd91), UINT64_C(0xcffb5142d1e857cf) }},
+  {{ UINT64_C(0x00038c651dad163e), UINT64_C(0x6df3c1a0b771b711), UINT64_C(0x106d16d615b195ba), UINT64_C(0xf07d7a5bb4e1919b) }},
+  {{ UINT64_C(0x5681d85d0bb51034), UINT64_C(0xdad66279ba77d47e), UINT64_C(0x77d42b1f7ff9e259), UINT64_C(0xcf1755abcb80fa83) }},
+  {{ UINT64_C(0xa5a473c2b2c080d6), UINT64_C(0x1a6483274d4d0419), UINT64_C(0xf1e9e499d94b7e71), UINT64_C(0x3e05bad36f021bd9) }},
+  {{ UINT64_C(0x16bd6499b9cffdd2), UINT64_C(0x56172d49a66c6f9f), UINT64_C(0x493a82537f43b605), UINT64_C(0x426bfb3f76909c3e) }},
+  {{ UINT64_C(0x3fa7589391f5395e), UINT64_C(0xaaaa24f6b151e009), UINT64_C(0x70bb30c52de2bafa), UINT64_C(0x41335fedfd0d8827) }},
+  {{ UINT64_C(0x72f7ee620527100a), UINT64_C(0x5a01d6052777fa95), UINT64_C(0xc83c26591aef2aa1), UINT64_C(0x96a703085ccdab7d) }},
+  {{ UINT64_C(0x0b276c07684a085a), UINT64_C(0x58facf8889fed057), UINT64_C(0xb506203710823d50), UINT64_C(0xe3c0744b8aaf3016) }},
+  {{ UINT64_C(0x2815e415837ba1e6), UINT64_C(0xd418b709764deaf0), UINT64_C(0x7c1f202ddde35bef), UINT64_C(0x706050e966afd6fb) }},
+  {{ UINT64_C(0xb544572bb97d8f7a), UINT64_C(0x2055ec001f536902), UINT64_C(0x6e49055b4183d894), UINT64_C(0x7e9a6639a5c12d4f) }},
+  {{ UINT64_C(0x7ac01a983407fb00), UINT64_C(0x6b8d2f85a1e8dca2), UINT64_C(0x8b3c1ad1e2bcdcea), UINT64_C(0x3443386fa7af3934) }},
+  {{ UINT64_C(0x6bb6740d4a01fa18), UINT64_C(0x464b280e4e5bd78c), UINT64_C(0x319687772d55dd09), UINT64_C(0x51a90f165513f151) }},
+  {{ UINT64_C(0xe5f822b67b88773e), UINT64_C(0x974a45753dc0e2a9), UINT64_C(0x831e214904697172), UINT64_C(0xe832ba309b316fd8) }},
+  {{ UINT64_C(0xc7dd3ae0f908fe26), UINT64_C(0x874d8ae8c53364d4), UINT64_C(0xc1df9aa81b899f84), UINT64_C(0x94ca0acaec80f77c) }},
+  {{ UINT64_C(0x3749ac6ee05e6802), UINT64_C(0x7b59716db6b2e66a), UINT64_C(0x49e3fd48ae83b7b9), UINT64_C(0xc140edcdf8ef6826) }},
+  {{ UINT64_C(0x46f0cc6a338d9b04), UINT64_C(0xa8cb85dd42ea6642), UINT64_C(0x68c45ab4099006ab), UINT64_C(0xa0c7b2ce526ff299) }},
+  {{ UINT64_C(0x64706a10809ac980), UINT64_C(0x495f8e323986d880), UINT64_C(0xf4368794f1f28369), UINT64_C(0xea2ebe80e81bb433) }},
+  {{ UINT64_C(0x9011e92ec04e8cfa), UINT64_C(0xb41d05fec489f13a), UINT64_C(0x46d822e30e6dad3f), UINT64_C(0xe6233fff319f791d) }},
+  {{ UINT64_C(0x805965bab64cb1d2), UINT64_C(0xf6c7766c9cbf4f50), UINT64_C(0x6fa8e435ee71bf68), UINT64_C(0x5543cf5b64aba190) }},
+  {{ UINT64_C(0x3dc2ac1aa6ce7f2e), UINT64_C(0x936e44ac1a25ab42), UINT64_C(0xc8cd05c3cc8871b3), UINT64_C(0x4693f10b5beb7e81) }},
+  {{ UINT64_C(0xc65b242e6e2cca56), UINT64_C(0xa8278a39cb24440a), UINT64_C(0x15596dbb4a791bb7), UINT64_C(0xf304c9bee0b7be49) }},
+  {{ UINT64_C(0x4ed9715f73183aae), UINT64_C(0xbbc4f5e335194b40), UINT64_C(0xf9d85a0df9034d31), UINT64_C(0x4d8ada5a0bb3d394) }},
+  {{ UINT64_C(0x67c01f35b839e3ba), UINT64_C(0x6dde115e8e9137e0), UINT64_C(0x6c9460a79ea774c8), UINT64_C(0xb251e2645551172a) }},
+  {{ UINT64_C(0x252faaeb456b3de2), UINT64_C(0x6a7dd556ebff498e), UINT64_C(0xfd7807c432b22d84), UINT64_C(0x050c0334a58a081d) }},
+  {{ UINT64_C(0x3337ac9b5a5273b6), UINT64_C(0xe8cb29ebd9fdd824), UINT64_C(0x8ca65fa5375561cf), UINT64_C(0x7d83059e619becb0) }},
+  {{ UINT64_C(0x91ca559186312e18), UINT64_C(0x03f7e6a3326f20f8), UINT64_C(0x497705a424fde810), UINT64_C(0x3b70d5058141fc48) }},
+  {{ UINT64_C(0xd699c9b235ad59dc), UINT64_C(0xa34ce454543921ee), UINT64_C(0x549af36b3f5ac3ee), UINT64_C(0xb325e9a4ccd3e5df) }},
+  {{ UINT64_C(0xc6e2d1cbe55fa63e), UINT64_C(0xc9f9fa2db3d392ae), UINT64_C(0xc1e327f87ccf70ab), UINT64_C(0xe54b57bfc74a7b38) }},
+  {{ UINT64_C(0x9a5e00326a6722ba), UINT64_C(0xca468ac4493cfb4a), UINT64_C(0xe9619729277d9611), UINT64_C(0x97509c91ecdc44b3) }},
+  {{ UINT64_C(0x13c449b154c6940a), UINT64_C(0xc39d9ed0de5d56db), UINT64_C(0x4f4a316adbd20821), UINT64_C(0x1fdd33ca4992c66c) }},
+  {{ UINT64_C(0x245e6228489b6ea2), UINT64_C(0x6058994d4d071f25), UINT64_C(0x13a1511480f9542c), UINT64_C(0x18bd6746dc4b9395) }},
+  {{ UINT64_C(0x98af1603836a3e14), UINT64_C(0x90ed1b58be0c784e), UINT64_C(0x95664b9de37eea6a), UINT64_C(0xe940d7cff147d2e1) }},
+  {{ UINT64_C(0x3af62fdaf1a46db6), UINT64_C(0x8e0ed31b4ffccf14), UINT64_C(0xcba1bcf31bf04493), UINT64_C(0x3ec6f7b9e32e345d) }},
+  {{ UINT64_C(0xcf8cf7f5054bd358), UINT64_C(0x2a89f32efe1e5bb6), UINT64_C(0x923387f1a621ec79), UINT64_C(0x00fe44652fc92ce4) }},
+  {{ UINT64_C(0xd3cd561020ec4204), UINT64_C(0x1d3a4cc58eebe9ab), UINT64_C(0xbabbbfa393858633), UINT64_C(0x93dbd0e5dd7eeede) }},
+  {{ UINT64_C(0x0e7518a354962500), UINT64_C(0xc09a26a4383608f8), UINT64_C(0xeb1c2264610713e1), UINT64_C(0x88b3ddb625d7a80b) }},
+  {{ UINT64_C(0x7829238b8bda9044), UINT64_C(0x059b43c065f68de8), UINT64_C(0xfbab37f44d9fdcbd), UINT64_C(0x8b02d9bf67d8e708) }},
+  {{ UINT64_C(0x88991ecb1d773c44), UINT64_C(0x671454679170563e), UINT64_C(0xa806375851fa6ac0), UINT64_C(0x33cc529383e3e6a8) }},
+  {{ UINT64_C(0xb3f4a946d5c9efaa), UINT64_C(0x92fee77e5efec6cc), UINT64_C(0x2713e6fadbe9c774), UINT64_C(0x280a290ce614769a) }},
+  {{ UINT64_C(0x6f7a7177e62ea74e), UINT64_C(0xd319e044ea918f5c), UINT64_C(0xc1c4ddd7cb82c568), UINT64_C(0xc0352d054c558513) }},
+  {{ UINT64_C(0x798110ed0660dcb2), UINT64_C(0x4548c2ee2a72d73c), UINT64_C(0x1f97f69ca13c322e), UINT64_C(0x76db511ce12fb422) }},
+  {{ UINT64_C(0x78d1b8973a77fe2a), UINT64_C(0xdafb50ce52de61c6), UINT64_C(0x303237f8b8a6f47a), UINT64_C(0x88ba30b405f54a08) }},
+  {{ UINT64_C(0x41e2edb8ee7c62a2), UINT64_C(0x62d28520bb6b6c47), UINT64_C(0xa82296e6e84ecddf), UINT64_C(0x834d5b5d7676203e) }},
+  {{ UINT64_C(0x74bf6c1ba711cb88), UINT64_C(0xec63ab59fa72f27a), UINT64_C(0xa6973cfa2f5eec11), UINT64_C(0x2509a66016b7bfd5) }},
+  {{ UINT64_C(0x3a878b753abf2ee2), UINT64_C(0x0a3eb8d67117a796), UINT64_C(0x8b3a5ea789991be7), UINT64_C(0x8efe33c81d1ac513) }},
+  {{ UINT64_C(0x429accd2da321e8e), UINT64_C(0x27e1c090f981e802), UINT64_C(0xc29addfda3eea9de), UINT64_C(0x4736f649e8dd2122) }},
+  {{ UINT64_C(0x7ccc963cdac82a08), UINT64_C(0xf25519275058e17d), UINT64_C(0x63b395c709fc09b3), UINT64_C(0x7c065433d2b7f2c1) }},
+  {{ UINT64_C(0x9c2a5ffc2d74afac), UINT64_C(0xe2decc71118adebc), UINT64_C(0x1892f28dfa0a4f00), UINT64_C(0x28ef8a7890a4face) }},
+  {{ UINT64_C(0x8a20e549df6b8374), UINT64_C(0x6d5bace66d1bb46d), UINT64_C(0xd9fb8c806f26569f), UINT64_C(0x7a11b75ae6a58308) }},
+  {{ UINT64_C(0x87b76c0cb253259c), UINT64_C(0x0b8a16aeb5365b53), UINT64_C(0xadf1b74ffa7679c6), UINT64_C(0xaa4a9077b20b2bb5) }},
+  {{ UINT64_C(0x92c8ba4b11595a26), UINT64_C(0x8ed9281024cb3e38), UINT64_C(0x9aa8073bee4c6c81), UINT64_C(0xa10e664fe8732504) }},
+  {{ UINT64_C(0x9b0e355ccd0a480c), UINT64_C(0xa5e40d60f28fc2e6), UINT64_C(0x8badf0cbe1c80e46), UINT64_C(0xeb5e7b77fa32cf42) }},
+  {{ UINT64_C(0x231be834342fa72c), UINT64_C(0x42a04d5da8cbf9fb), UINT64_C(0xfd5cf2c1326223c7), UINT64_C(0xc0a19ff477f55ae0) }},
+  {{ UINT64_C(0xefb168dd8058ffe8), UINT64_C(0x0a02034e22535a8d), UINT64_C(0x7d26c958374ef32a), UINT64_C(0x11057b7a8db9832f) }},
+  {{ UINT64_C(0x0a8d4ee133edceda), UINT64_C(0xc3d48c5753d64575), UINT64_C(0xc4c12a986566c955), UINT64_C(0xadc4c03032f7fdbd) }},
+  {{ UINT64_C(0x266e7fa6c4f42de0), UINT64_C(0xdbaa2e74efe6e087), UINT64_C(0xf104c93d8832736d), UINT64_C(0x6cb80eb89041f015) }},
+  {{ UINT64_C(0x7a7ee6615bd0de12), UINT64_C(0x1f124ba32b32c90f), UINT64_C(0x2aab9a7c54abedf1), UINT64_C(0x0828379bf0cf7ea4) }},
+  {{ UINT64_C(0x581b0fcdea05897e), UINT64_C(0xeb3c3adc74d16176), UINT64_C(0x94185da26c9b5ca7), UINT64_C(0x2ae70052d3fd352b) }},
+  {{ UINT64_C(0x54df92995431adb4), UINT64_C(0x3099e9532d45db1c), UINT64_C(0xa851d1b9219e2bca), UINT64_C(0xef077e07128390ae) }},
+  {{ UINT64_C(0x1a9a139063c4df2c), UINT64_C(0x1fe7105e3cbc9066), UINT64_C(0xdd6fe3378baa4960), UINT64_C(0x85a9c57e715c46b3) }},
+  {{ UINT64_C(0x2bbfd7623418a44a), UINT64_C(0x49885680007a1107), UINT64_C(0x172bfb34506fca97), UINT64_C(0x1e72e2635f0abff2) }},
+  {{ UINT64_C(0xbe4830cc1e36eb96), UINT64_C(0x65da4f99c36a2e6f), UINT64_C(0x041b2f4435b867ef), UINT64_C(0xa468289099f6ef7c) }},
+  {{ UINT64_C(0x05de9f519dbbdf2a), UINT64_C(0xc9b86c515ec0faa6), UINT64_C(0x1a4f365d86e61e89), UINT64_C(0xe9cd7a66b420a1f1) }},
+  {{ UINT64_C(0xc2cfa1cbb0f06e3a), UINT64_C(0x461623de3cf94f24), UINT64_C(0x3b6754e973ccd09e), UINT64_C(0x13c2d10fba7d6d05) }},
+  {{ UINT64_C(0xe857d194c94fafe4), UINT64_C(0xaeb9df2b4c5c43f8), UINT64_C(0x67d54364ad782cbe), UINT64_C(0x6451749a9975270f) }},
+  {{ UINT64_C(0x2bcf6330325c0f52), UINT64_C(0x32dfc6bb517dfd00), UINT64_C(0x2c2a53aa1a82b998), UINT64_C(0x80e5af9c6999fbeb) }},
+  {{ UINT64_C(0x091bec56612c0f94), UINT64_C(0x4865e330906b1fbc), UINT64_C(0x8a5a9662854ac38d), UINT64_C(0x1a579439c4946077) }},
+  {{ UINT64_C(0x7a874234a1a91dc6), UINT64_C(0x808327fb08a45c7d), UINT64_C(0xe29f64aa409cb5da), UINT64_C(0xd546ec6fc2730e16) }},
+  {{ UINT64_C(0x9f7705b15fddea76), UINT64_C(0x7fbf397983fe11ee), UINT64_C(0x25b4f9e2e716944b), UINT64_C(0x139e53c53c708bb3) }},
+  {{ UINT64_C(0xaa54804a4121fffe), UINT64_C(0xf85938a89853498d), UINT64_C(0xac525bd370e41e5e), UINT64_C(0x4e7140f7637ae278) }},
+  {{ UINT64_C(0x6042b3f58e00b76e), UINT64_C(0xabdc10173572af24), UINT64_C(0x0c5f8cbe4d359b64), UINT64_C(0x7385b471484f003a) }},
+};
+
+static const mzd_local_t Li_2[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0x1a4c9d11d0f68922), UINT64_C(0x9f0f4f29ea7727a3), UINT64_C(0xb5cd27a341428ba3), UINT64_C(0x6a2457c0576d0052) }},
+  {{ UINT64_C(0x56587886fb9064a2), UINT64_C(0xf85a9a2554062737), UINT64_C(0x90c5bb926dab2b96), UINT64_C(0x6bd202c597fdcd33) }},
+  {{ UINT64_C(0x7e8a6c246321a25a), UINT64_C(0x21608d1175ec40c1), UINT64_C(0x8ccbdac8cf4489d1), UINT64_C(0x49b05817bc5994bf) }},
+  {{ UINT64_C(0x9dac02cc99ad1328), UINT64_C(0x9d17c8cd860f4e52), UINT64_C(0xa94c4b092c2c4a3b), UINT64_C(0x9a021ecc3853e6d2) }},
+  {{ UINT64_C(0xe53ccaba58c3a3aa), UINT64_C(0xd93635634d30844c), UINT64_C(0x7ebc45b2fc6dd66d), UINT64_C(0xf34de77dc312279f) }},
+  {{ UINT64_C(0x92d503b69046e32e), UINT64_C(0xf21cdd2de0eeccbc), UINT64_C(0xbb9eaa8dcfd8f9a6), UINT64_C(0xf1f933695dce7b31) }},
+  {{ UINT64_C(0x21b41d12ab9f7818), UINT64_C(0xc8d3001e5204c6d0), UINT64_C(0x0291a45d07298800), UINT64_C(0x9d22e476fc2ef910) }},
+  {{ UINT64_C(0x803e4364aaf727b0), UINT64_C(0xafe9d25aef2c0349), UINT64_C(0x1195c0f244d66e3f), UINT64_C(0xda1db51d37476ea1) }},
+  {{ UINT64_C(0x21c96e1246af403a), UINT64_C(0xdf1783d7bbdcd8b4), UINT64_C(0xe1f3abbfdfb82108), UINT64_C(0xdca2ef816fa5d814) }},
+  {{ UINT64_C(0x3aa6d973f37687ba), UINT64_C(0xfb622deaf7c9c337), UINT64_C(0xd27f9cb632580689), UINT64_C(0x545ed6f152589694) }},
+  {{ UINT64_C(0x2cc02f84b07a185c), UINT64_C(0xde7092e3250c6d01), UINT64_C(0xabe5bc4849d08069), UINT64_C(0x4fb1dd8ad4273dae) }},
+  {{ UINT64_C(0x650240ca504e513a), UINT64_C(0x3704816696e6e986), UINT64_C(0x50200d96ffcccc4c), UINT64_C(0x48de17c64688e6fd) }},
+  {{ UINT64_C(0xdc862627db5425bc), UINT64_C(0xd140cf475bc651ff), UINT64_C(0x6d74b83dcef4600f), UINT64_C(0xd8a1d586524f7da5) }},
+  {{ UINT64_C(0x778cb9f7ebe522ca), UINT64_C(0x0cb57a4cb4ec6cb9), UINT64_C(0xf32602a7d877a73e), UINT64_C(0xa6539eda8e653335) }},
+  {{ UINT64_C(0xcf28e4f95184305c), UINT64_C(0x401df23ea994f875), UINT64_C(0x1990b417e58d394b), UINT64_C(0x1604628da3510f8d) }},
+  {{ UINT64_C(0xafd89aa884ec30ba), UINT64_C(0xbcec5143d16d1adb), UINT64_C(0x84d27551f0660265), UINT64_C(0xb3dd9ef6ddb15dab) }},
+  {{ UINT64_C(0xd0d7a31d4604f6b0), UINT64_C(0xb5a5afa82c9ddcb5), UINT64_C(0xebab763ced234334), UINT64_C(0x778a06456d9c9843) }},
+  {{ UINT64_C(0xe937d0e0fcb9d96a), UINT64_C(0x187cc7e766262333), UINT64_C(0x69d5cffa82aeb998), UINT64_C(0x3ec5b7eeac9375a8) }},
+  {{ UINT64_C(0xe57ec5e64b323878), UINT64_C(0xcc1bc044b1274069), UINT64_C(0xe93c20d568ee66e1), UINT64_C(0x57b2668732518486) }},
+  {{ UINT64_C(0xac00e00e8ec87304), UINT64_C(0x01c8ed08c3cd91f2), UINT64_C(0x8a2d7918a064eef4), UINT64_C(0x4e7c23946f23518f) }},
+  {{ UINT64_C(0xad1a6992157f0c3e), UINT64_C(0x1427bb18864111e2), UINT64_C(0x6fc4ae3391701dc0), UINT64_C(0x251f869b636bb207) }},
+  {{ UINT64_C(0x20d1a6f2ce1b786a), UINT64_C(0xcbc4b53658729a59), UINT64_C(0xe878cdf05218c984), UINT64_C(0x01bb2ea91b082513) }},
+  {{ UINT64_C(0xb6c40be0f2922e26), UINT64_C(0x56d25205b7526bfb), UINT64_C(0x411ede715d3e9a0f), UINT64_C(0x86c59d13dbbcbf20) }},
+  {{ UINT64_C(0x4654c183bdc968a4), UINT64_C(0xf4798149b93a77ee), UINT64_C(0xd4dbf552559bfa51), UINT64_C(0x4f2e807d1395727c) }},
+  {{ UINT64_C(0x7a39cef83df79d2c), UINT64_C(0x6a2d77a5dacbfab7), UINT64_C(0x374c6ada17a6c401), UINT64_C(0xd4b40753065ccd35) }},
+  {{ UINT64_C(0xc020afe2d5614cda), UINT64_C(0xd7cf735da9a8b0cb), UINT64_C(0xb6e3d593e34fe92c), UINT64_C(0xe07d8e491cebc021) }},
+  {{ UINT64_C(0x4d54c4575e478920), UINT64_C(0x2ddc553ac9763f5e), UINT64_C(0xa582a76b5d8aaa28), UINT64_C(0xf0b6461abde9f4e9) }},
+  {{ UINT64_C(0x019d45a0d38c82c2), UINT64_C(0xb112d8e3fb56f4e0), UINT64_C(0xcde6f8270ae9d7a4), UINT64_C(0xabc8f524e1d9c20c) }},
+  {{ UINT64_C(0xe30aab600b2f8ec0), UINT64_C(0xb942bd769b2a660c), UINT64_C(0x65b64c47321e2dc6), UINT64_C(0x1939a75744ed8a5b) }},
+  {{ UINT64_C(0x095c64f19f6286f2), UINT64_C(0xffc54c0f443fe19c), UINT64_C(0xefb99ce30cb6a1cd), UINT64_C(0x7f3afc526907b1f6) }},
+  {{ UINT64_C(0x007d8b9386886cc8), UINT64_C(0xfc08ce6ccb6d14d6), UINT64_C(0xe4243d6cbbba4b3a), UINT64_C(0x98e8c7855e9bc9c3) }},
+  {{ UINT64_C(0x97d9b6ee646e731c), UINT64_C(0x8ac09ced2108674a), UINT64_C(0xac75242640f8efb6), UINT64_C(0x70937f4fb21abcfa) }},
+  {{ UINT64_C(0xfd7b30543f265364), UINT64_C(0x6efa48426df215e0), UINT64_C(0x966b9d9afc55de59), UINT64_C(0xeca397fb32ed8681) }},
+  {{ UINT64_C(0x77aa17694b04c65e), UINT64_C(0xc1c06aa5ba61e9e9), UINT64_C(0x7c7d86210f3c3f65), UINT64_C(0xad91da29eaadeea2) }},
+  {{ UINT64_C(0x5155ebe9c6edc360), UINT64_C(0x9c9b7a0ba571fab2), UINT64_C(0x5782ef9f2963ab79), UINT64_C(0xb9fe35cc97b1d412) }},
+  {{ UINT64_C(0x2a4a0617faefc57e), UINT64_C(0xf5ca843104e7cbb4), UINT64_C(0x2e8dfd9400e3a91a), UINT64_C(0x3b9d1e396fe44f6d) }},
+  {{ UINT64_C(0xe634412aa361d794), UINT64_C(0xad70e11157ca603a), UINT64_C(0x4e8d5d9fd974a356), UINT64_C(0xeeffc1f0d59f6dd8) }},
+  {{ UINT64_C(0x08944ae86675e616), UINT64_C(0x913475cfe4cbdb72), UINT64_C(0xafbad276811208ee), UINT64_C(0xa02bc943bba5ac1c) }},
+  {{ UINT64_C(0x1b256bec4ba7ac98), UINT64_C(0xe5f17d8c1f8fcb67), UINT64_C(0x9d3a16c74c80b2e3), UINT64_C(0x472d25020aeadf37) }},
+  {{ UINT64_C(0xb1d7206c06870318), UINT64_C(0x51d0678332ede6f1), UINT64_C(0x9bbe849cdeb1a6f4), UINT64_C(0x9f1916dda2f42eb3) }},
+  {{ UINT64_C(0xd51080ce8fa2f73c), UINT64_C(0x4608ea025b412d1a), UINT64_C(0xb5bf0b4de504828c), UINT64_C(0x7f879a8a2d5a2a8a) }},
+  {{ UINT64_C(0xb58e75ce829b2988), UINT64_C(0xf35903a8a8daa283), UINT64_C(0x2a01466f49d7d14b), UINT64_C(0x2b999b9235f9dbb0) }},
+  {{ UINT64_C(0x340b728a9f9b8aa6), UINT64_C(0x9b157ae1e753d5ab), UINT64_C(0xc312a6486b47e96e), UINT64_C(0xaa57d9fe308cc652) }},
+  {{ UINT64_C(0x05fea40b07bfbc72), UINT64_C(0xc9213108c3cad5a9), UINT64_C(0xb6f2391ffd75f898), UINT64_C(0x17721f2519517358) }},
+  {{ UINT64_C(0x1ff90a89122c0528), UINT64_C(0x66b2d3a005fd957f), UINT64_C(0x846dc0cd698d9a59), UINT64_C(0x87fee582749feb03) }},
+  {{ UINT64_C(0xfcdfc45cedde2bf2), UINT64_C(0x54e2024730ebbce8), UINT64_C(0xe5c224289a95c373), UINT64_C(0x1184442e362751a6) }},
+  {{ UINT64_C(0xaa72391a2188d754), UINT64_C(0x02cb9c14e7aeb701), UINT64_C(0x473edd849f92b027), UINT64_C(0x816c0c98a4add65e) }},
+  {{ UINT64_C(0xbb13d59eb8bb2ab4), UINT64_C(0x66042df367923233), UINT64_C(0xc00db2b38ee26b89), UINT64_C(0xdd2e44bebdc79d7e) }},
+  {{ UINT64_C(0x154aba05b8672afe), UINT64_C(0xc89a42633a9f3f2e), UINT64_C(0x3575c7cfd3fe46eb), UINT64_C(0xac57cecab29adbbb) }},
+  {{ UINT64_C(0x13342ae60c37ad92), UINT64_C(0x905b76d2fbfdfd32), UINT64_C(0x182c8e2979e53ef6), UINT64_C(0xbc3fd9f2fa2eb614) }},
+  {{ UINT64_C(0x6961b14b98579c30), UINT64_C(0x278982333817bdab), UINT64_C(0x698766774060a532), UINT64_C(0x2982bf60a633eec0) }},
+  {{ UINT64_C(0x3d1685f24d6ce132), UINT64_C(0xca453c62240d619e), UINT64_C(0xd9bb2c089657c089), UINT64_C(0xf13a90cc58fcd92d) }},
+  {{ UINT64_C(0xf8da560b2c9df22e), UINT64_C(0x8727966e7c313d64), UINT64_C(0x0366e282eb36238a), UINT64_C(0x85b515034127c8a1) }},
+  {{ UINT64_C(0xf9bf9f3eb3020fa8), UINT64_C(0x56f7270f9edb219b), UINT64_C(0xdf718f42bd13d0ad), UINT64_C(0x54474c563147688a) }},
+  {{ UINT64_C(0xb10034efafdafefe), UINT64_C(0x80c7451875a1ebea), UINT64_C(0xdcdf6b28b5c3fe8f), UINT64_C(0x4e89f254a5e763fb) }},
+  {{ UINT64_C(0xde153b0c56c4c59c), UINT64_C(0x41888ddc3c491b61), UINT64_C(0x7d4509b9ba760a37), UINT64_C(0x86baf3c9efaa3850) }},
+  {{ UINT64_C(0x14bfdac670510246), UINT64_C(0xb667e927ddbe3275), UINT64_C(0x7cfc5485c15da0f7), UINT64_C(0xfb13d43e6418f7b6) }},
+  {{ UINT64_C(0x0186820697fdd4e4), UINT64_C(0x4623c42e642c39e8), UINT64_C(0xe3e040124d185dbb), UINT64_C(0x95dbbade29c48979) }},
+  {{ UINT64_C(0x2b5f48a596d467c8), UINT64_C(0x2d060e0185c6ca53), UINT64_C(0xe66b207ad99bf459), UINT64_C(0x1405ea286b855488) }},
+  {{ UINT64_C(0x3015337505623b6c), UINT64_C(0x1ab06732e3cf3e64), UINT64_C(0xfd5ac4beddcef8d9), UINT64_C(0x3d6f87ace0d72e00) }},
+  {{ UINT64_C(0x8c8b7283e4ea5d8e), UINT64_C(0x7153e2fee41a0456), UINT64_C(0xeccce65cbacadaad), UINT64_C(0x24e1ed14e6881983) }},
+  {{ UINT64_C(0x3314a381d6d97012), UINT64_C(0xecb5bc415f5733dc), UINT64_C(0x79c9cde1f780b9a5), UINT64_C(0x1e432d3221ec5c41) }},
+  {{ UINT64_C(0xae852ddc576bcb7e), UINT64_C(0xf8c992b851c9af95), UINT64_C(0x2f9fd0496709ab9e), UINT64_C(0x364135e3a4b8f0b0) }},
+  {{ UINT64_C(0xaea1ab45059423d4), UINT64_C(0x15853d3bace7a980), UINT64_C(0xd301e1b6aad4af31), UINT64_C(0xfdbab73162cc6833) }},
+  {{ UINT64_C(0x78ddd62ea68f7bb4), UINT64_C(0xde9c59f40ecc83e9), UINT64_C(0x8d7c318a0e877b48), UINT64_C(0xd7f48961aea8f76a) }},
+  {{ UINT64_C(0x63641618674b9148), UINT64_C(0x828e8d29161655d9), UINT64_C(0xc44b2a5e6a569a3a), UINT64_C(0xe74e576f05048ff0) }},
+  {{ UINT64_C(0x2276c252fe116cf0), UINT64_C(0x6449212c8dc11333), UINT64_C(0xc5a5fb34649e1ca8), UINT64_C(0x7b3a191d7dc36589) }},
+  {{ UINT64_C(0xec66a9f557242d32), UINT64_C(0x3891636976edf259), UINT64_C(0x8e6925bb0be1b7ec), UINT64_C(0xbc97e231ddbe0c5a) }},
+  {{ UINT64_C(0xce352f33c193ab64), UINT64_C(0xbaf2de3d915a744b), UINT64_C(0x716be35ad7a1b9c2), UINT64_C(0xfc607fd6a163b44c) }},
+  {{ UINT64_C(0xc8e1005b22bbbf5e), UINT64_C(0xfaa45dcb9bd65679), UINT64_C(0x1727652afd7d932b), UINT64_C(0xfc35a290b63300aa) }},
+  {{ UINT64_C(0x0686ed482242bc38), UINT64_C(0x21513b991a1cdec4), UINT64_C(0xf5ebbb3298667f8c), UINT64_C(0xae7a89ca1ddd905e) }},
+  {{ UINT64_C(0xcff2e0295da50ba0), UINT64_C(0xd8803833e201007f), UINT64_C(0xd062559aececb14c), UINT64_C(0x3c508b0ce189f3b9) }},
+  {{ UINT64_C(0x45466a977ded5f8e), UINT64_C(0xe499261c074f5b1a), UINT64_C(0xa550b5f1625a492d), UINT64_C(0xeff4096c723b9aac) }},
+  {{ UINT64_C(0xb80fd1793df92360), UINT64_C(0x83ceb3c46406f473), UINT64_C(0x3dba6a7077b23e93), UINT64_C(0xd46cee4cf517cf0c) }},
+  {{ UINT64_C(0xa0f37a736eaa3652), UINT64_C(0x6da86a01a89a5ed1), UINT64_C(0x915d0f05dcbe18d5), UINT64_C(0xc48b0a38947e83b7) }},
+  {{ UINT64_C(0x47b5af0b78316ccc), UINT64_C(0xbd1fb23a8cfd45cd), UINT64_C(0x215b41d1efd0cf1c), UINT64_C(0xd5c5b6c7487a52e9) }},
+  {{ UINT64_C(0xcfad1812512431a4), UINT64_C(0x65070bda3dbe498e), UINT64_C(0x958403eb1ad31652), UINT64_C(0x32f5c5727af02e54) }},
+  {{ UINT64_C(0xf3153ddd22beeb74), UINT64_C(0x3ab8514c7ddd5e0b), UINT64_C(0x31e688435dca8746), UINT64_C(0x8b51293f18416e1e) }},
+  {{ UINT64_C(0xe2c934135960bab8), UINT64_C(0x80c9d462a138fa79), UINT64_C(0xf3d24298280da457), UINT64_C(0x0cd44d211d8fa02d) }},
+  {{ UINT64_C(0x92d527b8de6cbcb2), UINT64_C(0xb5c807b00370a037), UINT64_C(0xd63a1c931523eabc), UINT64_C(0x16719fd418300ff5) }},
+  {{ UINT64_C(0xebaabfcee6518cfe), UINT64_C(0xc1a79dd5eac51459), UINT64_C(0x032115daf1cf2753), UINT64_C(0x7bfec514102d6be8) }},
+  {{ UINT64_C(0xdafa5fb1f54b0864), UINT64_C(0x9da46fc21e403cae), UINT64_C(0xe9edfbe8fa61d0a1), UINT64_C(0xda2ec28f6872d4f5) }},
+  {{ UINT64_C(0x2d4c080474b1ed3c), UINT64_C(0x0c2269af11e37011), UINT64_C(0x530fb3ff9846aed1), UINT64_C(0xb6522de52e9a1d73) }},
+  {{ UINT64_C(0xe65e02db122e2268), UINT64_C(0x90ecf5b178b650b9), UINT64_C(0xa83218dbc1e52fdd), UINT64_C(0x9a1792f7b8cebfe5) }},
+  {{ UINT64_C(0x28fd81c8069ffb44), UINT64_C(0x14c4c80da0f20b85), UINT64_C(0x37ebbb38ab33bdc8), UINT64_C(0x0d4e6e1a847ad44c) }},
+  {{ UINT64_C(0x0e930e347526924c), UINT64_C(0x80c53f610a071f63), UINT64_C(0x2a144094030961d7), UINT64_C(0x6dfd13b51dd38c17) }},
+  {{ UINT64_C(0x83fac64ea1be6726), UINT64_C(0xae87b27cf6ea3048), UINT64_C(0xf393d80b61d90499), UINT64_C(0x84abba63cfb90944) }},
+  {{ UINT64_C(0x99c5c8b2f0033ade), UINT64_C(0xeba36599021a3557), UINT64_C(0x06812cb013e446f4), UINT64_C(0xd614e9f0663c083e) }},
+  {{ UINT64_C(0x6312eb725db25fde), UINT64_C(0xd8fffc0bfb72260f), UINT64_C(0x869996596eaf48a1), UINT64_C(0x4968127c282c5372) }},
+  {{ UINT64_C(0x4ad38b35d38a928a), UINT64_C(0xfe52c12d3d9d33f8), UINT64_C(0x4e9ab8456b4cf33f), UINT64_C(0x2067bd3d6d02b5e0) }},
+  {{ UINT64_C(0x88dbe1e7ec2372b8), UINT64_C(0x8e25c168cc1e37f7), UINT64_C(0xb1bc85341d6c8bb4), UINT64_C(0xcfc99ee2dd0102c4) }},
+  {{ UINT64_C(0x02e63849c9d89274), UINT64_C(0x9ca86ef7344b84af), UINT64_C(0xdf576adf19fb9695), UINT64_C(0x2ad342e02812603c) }},
+  {{ UINT64_C(0xa350cd7e6e9ee6ec), UINT64_C(0xa183e8eb54000bfa), UINT64_C(0xb8ebd61180d71c97), UINT64_C(0x8e3b41aeb5411f51) }},
+  {{ UINT64_C(0xdede0a4fc72636b0), UINT64_C(0xd57d3cdaa56e706e), UINT64_C(0x5d32c05034995023), UINT64_C(0xda4cd36505396157) }},
+  {{ UINT64_C(0xb8a921b9930bd348), UINT64_C(0x90baa46e1abaa1e9), UINT64_C(0xfe609cf347b7d87d), UINT64_C(0x336ca62f91eee1eb) }},
+  {{ UINT64_C(0x07c37132f20fedb4), UINT64_C(0x7175b35d09435407), UINT64_C(0x68928e1a4810ba36), UINT64_C(0x3388588481464706) }},
+  {{ UINT64_C(0x79e725b3804f31a6), UINT64_C(0x7a9160f7027e2cc4), UINT64_C(0x1a8b4014c8d358de), UINT64_C(0x2c5a4350232b3b1c) }},
+  {{ UINT64_C(0xe70822fce6dbb742), UINT64_C(0x331c2c5253bffbe5), UINT64_C(0x468620e2f034688c), UINT64_C(0xa469a6d8d8609412) }},
+  {{ UINT64_C(0x31ed18ecfb639394), UINT64_C(0xb7f50d1ead893310), UINT64_C(0x08df72158638ae06), UINT64_C(0x70045b54f72c9c95) }},
+  {{ UINT64_C(0x20161fca3a4ad116), UINT64_C(0xecfd27631eb4cc76), UINT64_C(0xdf38c916cc9c1c37), UINT64_C(0x233619c9c7cda3fa) }},
+  {{ UINT64_C(0x64047214cdfc5496), UINT64_C(0xfba309943fa93936), UINT64_C(0x9fb13eb986fb304e), UINT64_C(0xf1656820c7e86c0b) }},
+  {{ UINT64_C(0xb26d0a18997e538e), UINT64_C(0x09f15b81c8e5ebf1), UINT64_C(0x4e7f94ef72ec0121), UINT64_C(0x0c6d9ad24d85beec) }},
+  {{ UINT64_C(0x7e32a2366335e292), UINT64_C(0x59f74b94760cc16d), UINT64_C(0x1cd04e73e94bde79), UINT64_C(0x0dd536f0f35e5e1f) }},
+  {{ UINT64_C(0x760eaf30bdea398a), UINT64_C(0xd0f489cb02f1a2aa), UINT64_C(0x05a760151e057c31), UINT64_C(0xb9075033fd2d53f6) }},
+  {{ UINT64_C(0x673d8175da6035d6), UINT64_C(0xf90e3c7d1c0477e2), UINT64_C(0x2de9de3df6403e48), UINT64_C(0xbf297eaca5aa6cf9) }},
+  {{ UINT64_C(0x2c315e75ebbaae12), UINT64_C(0x0d25c06e300f4ab7), UINT64_C(0xc62f0fb4f71090b1), UINT64_C(0xdd37f7043c711d7a) }},
+  {{ UINT64_C(0x56f80bb8c13946f6), UINT64_C(0x4ba32b2dd01f0706), UINT64_C(0x27f07c6538cb47bf), UINT64_C(0x9adc2489e7b1d3c4) }},
+  {{ UINT64_C(0x939c621ae1eb55ea), UINT64_C(0x70ae3651185c2ad7), UINT64_C(0x4d5552bfe8454363), UINT64_C(0x7637a59b9cdf2fbc) }},
+  {{ UINT64_C(0x1527b9309e43ec18), UINT64_C(0xb346156706585246), UINT64_C(0x43edc36c5cbf29b6), UINT64_C(0xd4eed189a969c299) }},
+  {{ UINT64_C(0x2d5f99460624e022), UINT64_C(0x03ef3847d64b2f66), UINT64_C(0xb1d9a696b82eaa0c), UINT64_C(0xc5901039fc09f204) }},
+  {{ UINT64_C(0xf488e23006c54cf2), UINT64_C(0xba0000a90004aa2a), UINT64_C(0xddf55c82accff593), UINT64_C(0xa86afa3998c930ef) }},
+  {{ UINT64_C(0xbe7e2686bf06dbb0), UINT64_C(0x8b385ae82fedce6d), UINT64_C(0xa5818a41afcdf41a), UINT64_C(0x2acf9c3e6b206824) }},
+  {{ UINT64_C(0x4ac9f65bf11471fc), UINT64_C(0x9eed69dfb1d3d3b5), UINT64_C(0x78259bce39f0fb77), UINT64_C(0x33777208c681ce7e) }},
+  {{ UINT64_C(0x95885998790c4312), UINT64_C(0x5d3e7fce179d46d4), UINT64_C(0x8226d33edf7b2254), UINT64_C(0xedc38728a2a34864) }},
+  {{ UINT64_C(0x1ad23d926d9ea5e2), UINT64_C(0x5cd5648488c06a07), UINT64_C(0xb13940c5c5946a21), UINT64_C(0x0b8a1384e845e997) }},
+  {{ UINT64_C(0xbc648095ca923cb4), UINT64_C(0x2a40fe353a290e2d), UINT64_C(0x4bc4349ef8119cbc), UINT64_C(0x351cc47551e5be6b) }},
+  {{ UINT64_C(0xd92aaec0abd0cf98), UINT64_C(0x803a3b85a0a58c3c), UINT64_C(0x700742f5e22bab9e), UINT64_C(0x65716f6f11682a6d) }},
+  {{ UINT64_C(0x2d8786d1217c8dfa), UINT64_C(0xb8176e23954cabfb), UINT64_C(0x98cf67d55bf9fe18), UINT64_C(0x3eca96768b442dd8) }},
+  {{ UINT64_C(0xcc5cb203f546b396), UINT64_C(0x36be437d06d12d77), UINT64_C(0x326f58e7e20509a3), UINT64_C(0xd1b50bf5776d544f) }},
+  {{ UINT64_C(0xcd27cb1b299265e2), UINT64_C(0x457acebadfa34211), UINT64_C(0xb2d86540d21aa8b2), UINT64_C(0x93cdcb8759c562d5) }},
+  {{ UINT64_C(0x0d758927811702e2), UINT64_C(0xfb16daf78077aada), UINT64_C(0xdb32fc286c0a6477), UINT64_C(0xabfe75a432db0cac) }},
+  {{ UINT64_C(0x9b7bf6da88b8fde6), UINT64_C(0xe84a67765950ded2), UINT64_C(0x6dc37cf1565cff92), UINT64_C(0x108e4d4baa501c2d) }},
+  {{ UINT64_C(0xcb9f94f18c34c31a), UINT64_C(0xa14de3530a804802), UINT64_C(0x3be1c0c4fc49a7bc), UINT64_C(0xfc1a729bde11e836) }},
+  {{ UINT64_C(0xcbf0435f706ad2a8), UINT64_C(0x6a5fd4d07fce57fc), UINT64_C(0xc93f5757d0d8f8d4), UINT64_C(0x0edc2330db861318) }},
+  {{ UINT64_C(0x5ad5ee0eb980e956), UINT64_C(0xa7c61850e857a768), UINT64_C(0x3f5f52a19ee19999), UINT64_C(0xc6be8db504e23758) }},
+  {{ UINT64_C(0xc968922ff5b6a7f2), UINT64_C(0x21295391249ea0e2), UINT64_C(0xf1fe9bca8760dab3), UINT64_C(0x98193cf55751a92f) }},
+  {{ UINT64_C(0x5ce6f6b551e2a942), UINT64_C(0x599fa4ce6f562dae), UINT64_C(0x0825bbbcc3845946), UINT64_C(0xe26cb8da3f0a80c0) }},
+  {{ UINT64_C(0xc5734d3593fbb1b0), UINT64_C(0xf7e2169933b9a9b0), UINT64_C(0x9cbde596858e9c0d), UINT64_C(0x05359182325a6890) }},
+  {{ UINT64_C(0x41cafcf0bb46ebde), UINT64_C(0x4707b36a77045ab9), UINT64_C(0x799f24d89e614da3), UINT64_C(0x25c5489153eba610) }},
+  {{ UINT64_C(0xadfd881ecbf3c9ba), UINT64_C(0x960ec9f6f1e4be24), UINT64_C(0xfea1817f435c3699), UINT64_C(0x7b17125a9fcaf50f) }},
+  {{ UINT64_C(0xadc90d2a01b97cec), UINT64_C(0x163b5727416c6f78), UINT64_C(0xc831d286691e1dae), UINT64_C(0xb08aefd3b07f2e27) }},
+  {{ UINT64_C(0x344993375dcdb56a), UINT64_C(0x1799b8c93506c29d), UINT64_C(0xb39a809d946da567), UINT64_C(0x353574a162d5691b) }},
+  {{ UINT64_C(0x42560b31120cac38), UINT64_C(0xcfb92b694c505448), UINT64_C(0xd6ae3696e19f4afb), UINT64_C(0xaf2eb16f4cd13d1d) }},
+  {{ UINT64_C(0x0715401057dcfba2), UINT64_C(0xff4a82350e3fca5b), UINT64_C(0x8f4a87fc8b306336), UINT64_C(0x9162ce4a541b4d60) }},
+  {{ UINT64_C(0x411c19f96ab3b79a), UINT64_C(0x290d52f3b34c7917), UINT64_C(0x966be4752f039853), UINT64_C(0x9775e080f47397c5) }},
+  {{ UINT64_C(0xf7fc2f2795920306), UINT64_C(0x1be2b33fd5ac5b24), UINT64_C(0xa26b6f15ee84af02), UINT64_C(0xd7ba7bc233a87e27) }},
+  {{ UINT64_C(0xe43c42431c6e3206), UINT64_C(0x00f4f0655fbb2ee7), UINT64_C(0x0422ae7574bed1a1), UINT64_C(0x6e22e877d6483b8e) }},
+  {{ UINT64_C(0x0b205c846d14b092), UINT64_C(0xfa92d4ed1007b119), UINT64_C(0x975087bdde8e6feb), UINT64_C(0x028ab95cedd2cebc) }},
+  {{ UINT64_C(0xba98a6cbce9aadda), UINT64_C(0xe94b20a80cf6b8b2), UINT64_C(0x341dffa5b784d0e6), UINT64_C(0x0657e32fd111bd78) }},
+  {{ UINT64_C(0xdb9d391b988d5c1c), UINT64_C(0xe4183fa3df19ac5f), UINT64_C(0x7ee1aaae2e36791e), UINT64_C(0x2188e558b9d2ab14) }},
+  {{ UINT64_C(0xa6196286ed4adb00), UINT64_C(0x8a1e455927bec863), UINT64_C(0x61b65a155736b9b3), UINT64_C(0x3e906d9c1bf64916) }},
+  {{ UINT64_C(0x175ac1119f6e33ce), UINT64_C(0x26bba22d2b84bb52), UINT64_C(0xb32904d9dd97e40d), UINT64_C(0xe179ad18c9e94fe3) }},
+  {{ UINT64_C(0xdc3ab1de4127cab8), UINT64_C(0x41331e8046010776), UINT64_C(0xee51702d6c91bb7b), UINT64_C(0x119c9190be0f16fa) }},
+  {{ UINT64_C(0x30c4cb0be93b5730), UINT64_C(0x2fb0f3066cb5a8a4), UINT64_C(0x3db899ec5ca85f33), UINT64_C(0x0d19cc64ea3601a6) }},
+  {{ UINT64_C(0x6ecc0f413f8a5450), UINT64_C(0xe7b25642936070a1), UINT64_C(0x8d2fdbf26110e506), UINT64_C(0x1b22d51a93533462) }},
+  {{ UINT64_C(0xea4f5eb3075ca19e), UINT64_C(0x0bf6f21708a9c066), UINT64_C(0x7ca9a3375f13a09f), UINT64_C(0x25754423cf2504d5) }},
+  {{ UINT64_C(0x371820ab90b57ac2), UINT64_C(0x3f3fe61291065d0a), UINT64_C(0xad57430694ce55a9), UINT64_C(0x169650f01d8138ef) }},
+  {{ UINT64_C(0xb0812c2374c2035c), UINT64_C(0xb9f22e8d7b64c05c), UINT64_C(0x975aec78eaae801b), UINT64_C(0x1275113239f9e844) }},
+  {{ UINT64_C(0xb17f93a07dd3734a), UINT64_C(0x4221b9d6bb96481c), UINT64_C(0x9f67516a01e3599f), UINT64_C(0x47e1d94097b0c22d) }},
+  {{ UINT64_C(0x0b2eb40f907057f8), UINT64_C(0x52d2094b33e3601c), UINT64_C(0x76d53d28e20ff104), UINT64_C(0x5aa51e89f4151f1f) }},
+  {{ UINT64_C(0x19f444d0ad3c36f6), UINT64_C(0xf9dce0b6a8f58c88), UINT64_C(0xee5c6b02e90c0091), UINT64_C(0x55ed34a49f2d37ef) }},
+  {{ UINT64_C(0xed75c406c7ca25d8), UINT64_C(0xb20867b4718b39d8), UINT64_C(0xd965255a9242881a), UINT64_C(0x8782a1e504f59119) }},
+  {{ UINT64_C(0x95e6ee62da2bc230), UINT64_C(0xfdc68b7d594919fd), UINT64_C(0xcf2ef85b15093f19), UINT64_C(0x3047879749786785) }},
+  {{ UINT64_C(0x4860a148e265e58e), UINT64_C(0x1eab1285a630113f), UINT64_C(0x28fa244c56578ad3), UINT64_C(0x8821e66ee2343549) }},
+  {{ UINT64_C(0x067a1d791c6ad5c4), UINT64_C(0x7d29abc6f259a3dd), UINT64_C(0xb761feab633b6a22), UINT64_C(0xedacdf3c045c9dd4) }},
+  {{ UINT64_C(0xc66ed616b87eed46), UINT64_C(0x9c65b971d97c5f02), UINT64_C(0x112c1f07cd2848e0), UINT64_C(0xcdfdf72dcaa71c27) }},
+  {{ UINT64_C(0x7b523149746c4270), UINT64_C(0xf32c3567bb5b16c3), UINT64_C(0xd1ce4f2fe76f495c), UINT64_C(0xec5a52d62edba03f) }},
+  {{ UINT64_C(0x950f409204996500), UINT64_C(0x30c034a7a717fc67), UINT64_C(0x1268d33207c42696), UINT64_C(0xd791cadafb2f0e8b) }},
+  {{ UINT64_C(0xd401dc8ffbdcda36), UINT64_C(0x77037ac37d02e775), UINT64_C(0xed1c7ccbb5e861c7), UINT64_C(0xba7cdf0389ad4fdc) }},
+  {{ UINT64_C(0x6fb4ac41112d02b0), UINT64_C(0xe42924eb7564c763), UINT64_C(0x2e2cefe6bd13fe8d), UINT64_C(0x52b90e98ea1569e0) }},
+  {{ UINT64_C(0x4da7c5ae582d52cc), UINT64_C(0x54798af0575b172b), UINT64_C(0x5c65b1ec80df9aea), UINT64_C(0xa49400c8ee3ee22a) }},
+  {{ UINT64_C(0x74b1910ef7cdb8cc), UINT64_C(0x53a8f3e1f2f671e5), UINT64_C(0xefc63f30157e5455), UINT64_C(0x6e294b3f5679cfec) }},
+  {{ UINT64_C(0xa734ce1e3dfeb22a), UINT64_C(0x38f5d9cf0ce8765d), UINT64_C(0x3d6e4680c8fc2e72), UINT64_C(0xd313939e3b4f3a18) }},
+  {{ UINT64_C(0xb43d2d6ead153dfc), UINT64_C(0x2389fc419a56c640), UINT64_C(0x896780bedabe6bc0), UINT64_C(0x773ede85d3ab03fa) }},
+  {{ UINT64_C(0x4c116776733c23ec), UINT64_C(0x99f116f9fc353a14), UINT64_C(0x134c7e68a228c4cf), UINT64_C(0x7d6faf4057cb4e1f) }},
+  {{ UINT64_C(0xbf4bca2454526260), UINT64_C(0x0b07b8477e62e86f), UINT64_C(0x8c59ec0baa543b60), UINT64_C(0x183c6cd069f050c0) }},
+  {{ UINT64_C(0xec6a1ecd05412592), UINT64_C(0xe854aee05bade29f), UINT64_C(0xdd45467f598f269b), UINT64_C(0xe07a8f5f588ef2c0) }},
+  {{ UINT64_C(0x26409da8e7562578), UINT64_C(0x8849a13924bee1e0), UINT64_C(0xa3954a0587341367), UINT64_C(0x1f3b708642e0d82b) }},
+  {{ UINT64_C(0xfe89b9d386d142ca), UINT64_C(0x0eae92ce4b00e32f), UINT64_C(0x8404d5a5a5c0973e), UINT64_C(0x8eb1671f8cc214c1) }},
+  {{ UINT64_C(0x429f736e33045978), UINT64_C(0x45ca4bb523151360), UINT64_C(0x00de2c353410177c), UINT64_C(0xfb08f66260b1aec4) }},
+  {{ UINT64_C(0x186914582b1d1e42), UINT64_C(0xb8aa115f0ad63b37), UINT64_C(0x97da908040de9160), UINT64_C(0x128cec4771f7ffb2) }},
+  {{ UINT64_C(0x4043e55aa9a09c40), UINT64_C(0x3e0ed8ee12608ea1), UINT64_C(0xc5032ce533cc5595), UINT64_C(0x45d2cb0ea1bbac1e) }},
+  {{ UINT64_C(0x167ed5f0c06d2518), UINT64_C(0x9859076c720f21ce), UINT64_C(0x23fadf7875c9fff2), UINT64_C(0x586b5505002a8997) }},
+  {{ UINT64_C(0xe09ce3267504eee2), UINT64_C(0x56c46094d9c322e2), UINT64_C(0x90444fa5f8445e14), UINT64_C(0xbe2321aeae6cc79c) }},
+  {{ UINT64_C(0x11ce218a3f3bf742), UINT64_C(0x1d61222a0acd0b2c), UINT64_C(0x4882629a5a6b5afe), UINT64_C(0x8435de66dc1e2931) }},
+  {{ UINT64_C(0x9ef4f9bc54e2663c), UINT64_C(0x01285757e8294a11), UINT64_C(0xd1d0a5b3f7f54999), UINT64_C(0xa0867af12fed40a2) }},
+  {{ UINT64_C(0x96c0359cf60e60f8), UINT64_C(0xbbb71d7a27a9b37f), UINT64_C(0xe8d9574e62378afc), UINT64_C(0x22cdf2890703f3d0) }},
+  {{ UINT64_C(0x9f58ba71e97843d6), UINT64_C(0x6f247d8fe2173f55), UINT64_C(0xc2c9321a6dc61e9d), UINT64_C(0xaf1837f6bd45f4c0) }},
+  {{ UINT64_C(0x468e33826b6fcebe), UINT64_C(0xd575356c1c40dec5), UINT64_C(0x46a6e44f2486c8ad), UINT64_C(0x2e8c01511b62f500) }},
+  {{ UINT64_C(0xf17a35a59e90efb4), UINT64_C(0xf887d30bbd1d6b2b), UINT64_C(0x151a208651ce464e), UINT64_C(0xf92ae72273644f74) }},
+  {{ UINT64_C(0xf9d1d8a201a5b9bc), UINT64_C(0x588ac454c07803f2), UINT64_C(0x58a71866e7fe2334), UINT64_C(0x392111223f83cd1d) }},
+  {{ UINT64_C(0xe6700072cc03b16c), UINT64_C(0xb016cc565d24db1a), UINT64_C(0x30d1cbcee3899bdd), UINT64_C(0x6c844f1efcde40ee) }},
+  {{ UINT64_C(0x3ba9084df0d18922), UINT64_C(0x8361f95638530610), UINT64_C(0x1c0b72b4cf29f4f4), UINT64_C(0x2a5d6a2933dc842f) }},
+  {{ UINT64_C(0x5aaa07e2b38cb64e), UINT64_C(0x9a796757ee65d38f), UINT64_C(0xe22e7e39eecd6573), UINT64_C(0xddd90d1797dff6cd) }},
+  {{ UINT64_C(0xf2a3a5346d967860), UINT64_C(0xd6fca79b113104d1), UINT64_C(0x0846d1f154f67e48), UINT64_C(0xd479c15645c6be8a) }},
+  {{ UINT64_C(0x78ae091b94316316), UINT64_C(0x58da67de7bb71846), UINT64_C(0xfdf2168d1cc8bb3f), UINT64_C(0x7efd23b4e8a14f16) }},
+  {{ UINT64_C(0xd33c2a6d2b3153f8), UINT64_C(0x21148486ecdfa844), UINT64_C(0x2f14552f0ef480de), UINT64_C(0xd0f917c79f34b119) }},
+  {{ UINT64_C(0xafc548587415726e), UINT64_C(0x943a005cefa77677), UINT64_C(0xa86ec0d2c6d427c3), UINT64_C(0x8dcfef03dafa8b21) }},
+  {{ UINT64_C(0x8a416c5cc64322f2), UINT64_C(0x4dfe8e5f5a390660), UINT64_C(0x7b1025ef7b3e3649), UINT64_C(0x19efad64bf06f5d9) }},
+  {{ UINT64_C(0x5ed3d39ecad73f6e), UINT64_C(0xf6d827a918f86177), UINT64_C(0x49baf4ec5387547e), UINT64_C(0x533333cb37da1e2a) }},
+  {{ UINT64_C(0xfa8d4954d3adac74), UINT64_C(0x4376b30be36da9be), UINT64_C(0x4a76f619ca8df358), UINT64_C(0xe483feed95eeb0a1) }},
+  {{ UINT64_C(0x9572917e61591456), UINT64_C(0x3325279c96b8f448), UINT64_C(0xe95a182bc7588263), UINT64_C(0x5de12bec2f0d2fbe) }},
+  {{ UINT64_C(0x06f3b26192a64546), UINT64_C(0x8eb5896b303dfb7c), UINT64_C(0xdf5a51125e5d32c5), UINT64_C(0xec57d3b0ae72defe) }},
+  {{ UINT64_C(0x509ef79dd8a9f8bc), UINT64_C(0x579036e786a8b3d5), UINT64_C(0xb8b6aa4db69df732), UINT64_C(0x76d284230796327b) }},
+  {{ UINT64_C(0xe3264b21c3ea7670), UINT64_C(0x775f5c0c0ba4bae3), UINT64_C(0xae5988a78f7f13b1), UINT64_C(0x1815a7bc1ba4f951) }},
+  {{ UINT64_C(0x3bb02efda9da567e), UINT64_C(0x77c78ae9ff9760e9), UINT64_C(0x72bb21646618ec99), UINT64_C(0xe59a87b17ef46081) }},
+  {{ UINT64_C(0xcfb6f39cbf35ea90), UINT64_C(0x769f9874d3ae4be8), UINT64_C(0xc0686d779b96a5a9), UINT64_C(0x4502950bc80635b1) }},
+  {{ UINT64_C(0xec768d6ba9830960), UINT64_C(0xd1eef5ff450ad1f9), UINT64_C(0x5dd9d32b7821e668), UINT64_C(0xff30001a75d4a961) }},
+  {{ UINT64_C(0x02d4275f6388382e), UINT64_C(0xe76968abf8795525), UINT64_C(0x87a96f6aa6470f1c), UINT64_C(0xf423a551b8bc1bd7) }},
+  {{ UINT64_C(0xd01701f3a3b14574), UINT64_C(0x9f2eaed4ee8b4954), UINT64_C(0x13a78e5d81d1e210), UINT64_C(0x4b44ad2f91779371) }},
+  {{ UINT64_C(0x185336ba47d3d928), UINT64_C(0x81efe85bdb6b5388), UINT64_C(0xffae8b6e5788c0f9), UINT64_C(0x4dd8b233cc8660c2) }},
+  {{ UINT64_C(0xfb30bff03f3b4b18), UINT64_C(0xccc4437dffad284e), UINT64_C(0xfc0c5e22f9401a61), UINT64_C(0x936de88b2ece90c3) }},
+  {{ UINT64_C(0x3e562441e5fe5c78), UINT64_C(0xb35db1e2f88b7bc7), UINT64_C(0x35a9952db6602d53), UINT64_C(0xfcce965e2050183f) }},
+  {{ UINT64_C(0x3a258b38425944d8), UINT64_C(0x2851d6d18d41a83a), UINT64_C(0xe057f1db8bc8a31d), UINT64_C(0xdd4446308291987f) }},
+  {{ UINT64_C(0x06aab8f15a023c6e), UINT64_C(0xcd25c048fa309ad5), UINT64_C(0x0647d6fb7164312f), UINT64_C(0xe5e7b6cb25c86598) }},
+  {{ UINT64_C(0x76b1a49b244827cc), UINT64_C(0x29093d81253902f2), UINT64_C(0x55bc208f17207b72), UINT64_C(0x36b289743608d489) }},
+  {{ UINT64_C(0xf723e47ec0b5a20e), UINT64_C(0xd4c6588f9874a87f), UINT64_C(0x2ac31b3c5364c3e7), UINT64_C(0x6e8675d82068c3d1) }},
+  {{ UINT64_C(0x71cefbc51901d7b2), UINT64_C(0x308cb3e4a41d27ed), UINT64_C(0x6ee07fd78fc0ecc6), UINT64_C(0x407d73e9ec14e98f) }},
+  {{ UINT64_C(0x7e256d7deccdc288), UINT64_C(0xb10dae659a1749c6), UINT64_C(0x8028612683e42259), UINT64_C(0x548af601da4ae03d) }},
+  {{ UINT64_C(0x7d1436821e56406a), UINT64_C(0xb2bdcfd12aa46d62), UINT64_C(0x3938af3b06ec093d), UINT64_C(0x8771802cb1586882) }},
+  {{ UINT64_C(0xa7788c3292761a84), UINT64_C(0x9095298e98873745), UINT64_C(0x8cdbbb54dacbd831), UINT64_C(0xafb6451dad552928) }},
+  {{ UINT64_C(0x3b9cdf2e3bbbe5cc), UINT64_C(0x9e73b3869d9d9e39), UINT64_C(0xe2e2bc5c5d2b1209), UINT64_C(0x0ffc8f82aa6ea7ff) }},
+  {{ UINT64_C(0x113d8197404f9ea4), UINT64_C(0x6813f497d0aa348e), UINT64_C(0x4d201e76b3c0b7f7), UINT64_C(0x015a11937030ae2b) }},
+  {{ UINT64_C(0x3a5b0ae87347d514), UINT64_C(0x97e73edeeca187d1), UINT64_C(0x004ebe9f5688e052), UINT64_C(0x86d9d9587f0d735a) }},
+  {{ UINT64_C(0x834a0d887abffd84), UINT64_C(0xafd91a8ecf87cb1e), UINT64_C(0xae9c4bbb5bcb3794), UINT64_C(0x51558da987b2dafd) }},
+  {{ UINT64_C(0xe9e8f6c5d27b1230), UINT64_C(0x9017e56199e513a7), UINT64_C(0x91ff6fdbefb1f8d9), UINT64_C(0x6e74de180cad39ea) }},
+  {{ UINT64_C(0xec08c4072da0428a), UINT64_C(0x2a05861775587912), UINT64_C(0x91eee3c863ce4fa2), UINT64_C(0x44cb7d838be5bf8f) }},
+  {{ UINT64_C(0x78f61530debd518c), UINT64_C(0x82b5b844820e4872), UINT64_C(0x892c591fcf34cc80), UINT64_C(0xd4bd52642460ac6f) }},
+  {{ UINT64_C(0xfec68a0a8664b58e), UINT64_C(0x6a2547535230b221), UINT64_C(0x52d105f95a96f560), UINT64_C(0x3c7f5c42f3579165) }},
+  {{ UINT64_C(0x392e684ac7f7d714), UINT64_C(0xb2dd4c1b26a6c26c), UINT64_C(0x2a8a63ac6acdb236), UINT64_C(0x7c26ca723fd65d5d) }},
+  {{ UINT64_C(0x1e8c78b8cd60eee4), UINT64_C(0xe1a3133740a3d5eb), UINT64_C(0x3c2d28192c978348), UINT64_C(0x33ece00ba96b3c8e) }},
+  {{ UINT64_C(0xeacfb25deb830818), UINT64_C(0xade97e931790580d), UINT64_C(0xb43f7aeb02c330ca), UINT64_C(0x245ca296fc50c624) }},
+  {{ UINT64_C(0x863e110191dda75c), UINT64_C(0x90a645231de1f383), UINT64_C(0xddf93423839e4539), UINT64_C(0x921073c257feea4b) }},
+  {{ UINT64_C(0xb1dcd7708c7579a6), UINT64_C(0xb53db86e430b1a7d), UINT64_C(0x9498e1bbd901501a), UINT64_C(0x8127ad29837e1bc5) }},
+  {{ UINT64_C(0xe5e28f716f2e6a24), UINT64_C(0x9e9200044c778650), UINT64_C(0xf34b8bdeb0c88e18), UINT64_C(0xb667ffec6510419f) }},
+  {{ UINT64_C(0x72dda4406efcf334), UINT64_C(0xcb957eac78ecd5d8), UINT64_C(0xd3981d5bb528f089), UINT64_C(0x37c3838a929d44ec) }},
+  {{ UINT64_C(0x93dd3ae655e932d2), UINT64_C(0x54e27d7e44af541e), UINT64_C(0x84ffe461a62ac2f8), UINT64_C(0xf5e1e33c9ae36623) }},
+  {{ UINT64_C(0x1c7435f8375e4918), UINT64_C(0xe110eb51a7e81fa9), UINT64_C(0xc501081978561c97), UINT64_C(0x8c2de1ade612c7f1) }},
+  {{ UINT64_C(0x2b73df08e6a15038), UINT64_C(0xddd4c2c2e28d3c54), UINT64_C(0xc459da8d05e0c335), UINT64_C(0x1f5929a1f8141bca) }},
+  {{ UINT64_C(0x049af0619296512c), UINT64_C(0x964712928219a567), UINT64_C(0xf36aa7530e69545f), UINT64_C(0x1c0f00ed22878ba2) }},
+  {{ UINT64_C(0x41b7db3f2efbff76), UINT64_C(0x3f173a087e099fad), UINT64_C(0x468262b4bd5cfc37), UINT64_C(0xa0acdac988fa49f9) }},
+  {{ UINT64_C(0xdad23dc9b7d9ac44), UINT64_C(0x76361bf77e967f27), UINT64_C(0xfc42723b127598e8), UINT64_C(0x2fcf3fcce2ed9390) }},
+  {{ UINT64_C(0x8bffc964945345b2), UINT64_C(0x806d942409a1106c), UINT64_C(0x404a7423f3d6b3ed), UINT64_C(0x21c5ebabb4151cd2) }},
+  {{ UINT64_C(0x1b1ad8a79c390d62), UINT64_C(0xfddb722973ab3a18), UINT64_C(0xc07833c9946a7dd4), UINT64_C(0x413367bbdb482fd8) }},
+  {{ UINT64_C(0x771c2ba1fb26580e), UINT64_C(0xc996bab051ead727), UINT64_C(0x576cc5a4e679c682), UINT64_C(0xc726aca9f81fe075) }},
+  {{ UINT64_C(0x6265b7f33ce4674e), UINT64_C(0x32b9a54f01419503), UINT64_C(0xa86636fdb133b68b), UINT64_C(0x3fbbf8061eb43b18) }},
+  {{ UINT64_C(0x296025a3e644fa82), UINT64_C(0x34bb65135d7308fe), UINT64_C(0xafb4a6a5cee168f0), UINT64_C(0x513e5bf6901f06f2) }},
+  {{ UINT64_C(0x9694c42ee950d992), UINT64_C(0x536b328f4c5972a1), UINT64_C(0x4117e0c91437739a), UINT64_C(0xcac0ff89555da4ee) }},
+  {{ UINT64_C(0xd9480b00dee396fc), UINT64_C(0x8bb4d730eb667122), UINT64_C(0x1a3183d217cfdaaa), UINT64_C(0x61aa88b376cce5b1) }},
+  {{ UINT64_C(0x38230bce63e05676), UINT64_C(0x37275f133712e87c), UINT64_C(0x22a10b360dbc7bf5), UINT64_C(0x079d82d460f7d879) }},
+  {{ UINT64_C(0x4162567fe3d17240), UINT64_C(0xe9c8dc3185c59195), UINT64_C(0x20d6f09f1792acec), UINT64_C(0x1764ad8b82715041) }},
+  {{ UINT64_C(0x7e54e46c14a75352), UINT64_C(0x0251b146d47a6e62), UINT64_C(0x508f2c3bcde964e9), UINT64_C(0x9adb2d5b78bb4d2a) }},
+  {{ UINT64_C(0x6a7311603d3deaae), UINT64_C(0x9a053aec3ae627c9), UINT64_C(0xae8450b8a57fba13), UINT64_C(0xebe6bd58a47e77a4) }},
+  {{ UINT64_C(0x1011eeabb7d1acb0), UINT64_C(0xa8f604686b7df4bf), UINT64_C(0xa8901169fa4c78e4), UINT64_C(0xe6e74cf5a0e7c7d0) }},
+  {{ UINT64_C(0x6c6bb52f798d4736), UINT64_C(0xcd642db554c93a8d), UINT64_C(0x2a1b73ea031fe1ee), UINT64_C(0x462f409852a9c07f) }},
+  {{ UINT64_C(0x3fcc1c5c7d0bdf08), UINT64_C(0xbd1380a723a385b5), UINT64_C(0x0801808b6fa3b568), UINT64_C(0x0db035ce23f12b4c) }},
+  {{ UINT64_C(0xb3257bff5bf1d9fe), UINT64_C(0x73e185b874f7b4c4), UINT64_C(0xef1bb08d45885a9e), UINT64_C(0x26a311127beb46ac) }},
+  {{ UINT64_C(0x971448fab858e458), UINT64_C(0xa08741546b34385a), UINT64_C(0xcdf25a25d19aca99), UINT64_C(0x24aeae21f911355a) }},
+  {{ UINT64_C(0x829bb3512474c08e), UINT64_C(0xea0295e7ede77d49), UINT64_C(0x8caf51931b95c175), UINT64_C(0x9386e36ebb7c7b5c) }},
+  {{ UINT64_C(0x6120a2774a60b632), UINT64_C(0x18eb379cbc1918c4), UINT64_C(0x28f329c225e53a7e), UINT64_C(0x64f187d631734ce1) }},
+  {{ UINT64_C(0x40dc700035d21e0c), UINT64_C(0x2686bf12afefd199), UINT64_C(0xad4114e63bcd2a18), UINT64_C(0x7e11a94dd6aa97be) }},
+  {{ UINT64_C(0xf55e755b77c2d432), UINT64_C(0xc8bd22d6c5272c05), UINT64_C(0x762c7984bd412a45), UINT64_C(0xc08cf63eafc54ac8) }},
+  {{ UINT64_C(0xd35043c84674a9fc), UINT64_C(0x265be830f2c40ffb), UINT64_C(0x90bdaeaba2bf01ae), UINT64_C(0xca936090d66f2880) }},
+  {{ UINT64_C(0x44a4d1425485ac92), UINT64_C(0x034dcbe2b290341b), UINT64_C(0x9fe95290ceef6cb7), UINT64_C(0xedce9e202e9839da) }},
+  {{ UINT64_C(0x70f0002f08555c98), UINT64_C(0x69a5cfe8f0933f3d), UINT64_C(0x25ed1a187c21f131), UINT64_C(0x5ed1b35ea2ec0a18) }},
+};
+
+static const mzd_local_t Li_3[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0x4776b07d2a3b77c6), UINT64_C(0x2625e0cccd681ea4), UINT64_C(0x0498b183897f1daa), UINT64_C(0x696c2d1de7d5bf11) }},
+  {{ UINT64_C(0xa0a1dd4b4ac9b66c), UINT64_C(0x8848f16dfaaa2ace), UINT64_C(0x1d9aab183fabbf97), UINT64_C(0x35e9a8c62ee152bd) }},
+  {{ UINT64_C(0xe8db4e71d3433ca2), UINT64_C(0x66f839ba59c0db3d), UINT64_C(0xae3e38a3d471d575), UINT64_C(0xb92d71927373d0da) }},
+  {{ UINT64_C(0x50446968f0525042), UINT64_C(0xb8ae472cc3dcc0f2), UINT64_C(0xb32724dd8df27b15), UINT64_C(0x92c270aa27e96edd) }},
+  {{ UINT64_C(0x67056423731818a4), UINT64_C(0x167177a922ac3edf), UINT64_C(0x3d90a26d94b62e5a), UINT64_C(0xf6f8f352c832b053) }},
+  {{ UINT64_C(0x084703322e543d9c), UINT64_C(0xd8c6e043a65c3788), UINT64_C(0x60b04f4def237be8), UINT64_C(0x4094ab297eade9f7) }},
+  {{ UINT64_C(0x90c4f7a6dff6256c), UINT64_C(0x8fb20b130f27f74f), UINT64_C(0x11a1a5d3edcb672c), UINT64_C(0xe04cf27d0d2fd444) }},
+  {{ UINT64_C(0x13881ef2adcfe5d0), UINT64_C(0x168557c638d34772), UINT64_C(0x5b37d663ef7cd344), UINT64_C(0xff8e1dce66b25b06) }},
+  {{ UINT64_C(0xab9043df09599f3a), UINT64_C(0xa8ed5664a8e0991d), UINT64_C(0xf810f8129e2c5670), UINT64_C(0xfb83e4800df5cdc6) }},
+  {{ UINT64_C(0x1f46d0434b7df12a), UINT64_C(0x7e824b8930cf441d), UINT64_C(0x714ba58e25142cde), UINT64_C(0x9872b1dde341c28b) }},
+  {{ UINT64_C(0x698253b7b0293fce), UINT64_C(0x16d5eff93345e009), UINT64_C(0xe594a8a4a3b0f1a8), UINT64_C(0xa88f49fa7dff77bd) }},
+  {{ UINT64_C(0xcc693bd2f65838fa), UINT64_C(0xebebcbd3ed935371), UINT64_C(0xc8d7696c41e14787), UINT64_C(0xe4c9b32045482b2e) }},
+  {{ UINT64_C(0xcd7f4e09d5684270), UINT64_C(0xf60321d25e00b6d2), UINT64_C(0x13d4135db1d75c95), UINT64_C(0x2d0b331ced988f75) }},
+  {{ UINT64_C(0xa485572c801751f0), UINT64_C(0x5464172a3aadac63), UINT64_C(0x1b156edb15b5ddae), UINT64_C(0xd6784a3a3d2ef415) }},
+  {{ UINT64_C(0x2a9e6a2dc6db379a), UINT64_C(0xf6d690fded7f4cdf), UINT64_C(0x369f832538200f3f), UINT64_C(0x33518f8c84fe7e15) }},
+  {{ UINT64_C(0x45455c84abea80b8), UINT64_C(0x8a5d9c6095c5824b), UINT64_C(0x9153a09b68351fb9), UINT64_C(0x6ccf06f13fe19a23) }},
+  {{ UINT64_C(0x37ec28b170b6da06), UINT64_C(0x9979dbc7c6e91142), UINT64_C(0x74208a838eb8f15f), UINT64_C(0x96c451af6c134cdc) }},
+  {{ UINT64_C(0x5b5864e8a724a2f4), UINT64_C(0x3ac9537a55d59c5b), UINT64_C(0x6dc673f5854c302b), UINT64_C(0x5c2e4ee8c6908d12) }},
+  {{ UINT64_C(0x2356005301952234), UINT64_C(0x719134256fd4d37c), UINT64_C(0xad095282331bb03f), UINT64_C(0x2f8da08687b7ba09) }},
+  {{ UINT64_C(0xf699ddfeb93e774c), UINT64_C(0xe650391e119e9b72), UINT64_C(0x89ec6e9c1d33d192), UINT64_C(0xd1be060fc8b74e33) }},
+  {{ UINT64_C(0xc20ad26368eaedfa), UINT64_C(0x29e42be7dee5f0d9), UINT64_C(0xbc07ef5deca956bd), UINT64_C(0x1b2e1e32d133d6d7) }},
+  {{ UINT64_C(0xc3fe8dfdb148d946), UINT64_C(0xca94a046046facd9), UINT64_C(0xba1c67b1a6408e06), UINT64_C(0x87181764874f7d5f) }},
+  {{ UINT64_C(0x701e276a45fc4b0e), UINT64_C(0x2c2394171df6437d), UINT64_C(0x5df337ff5b2adbd0), UINT64_C(0xb6140337124405f2) }},
+  {{ UINT64_C(0xc710c4b8f64641f2), UINT64_C(0x4ef1d9041b43bebf), UINT64_C(0x9c4ed5da5da6aaaf), UINT64_C(0x2e64b12be19f5204) }},
+  {{ UINT64_C(0x6a4df79d6d4b20ea), UINT64_C(0x4c3e79174d0fe970), UINT64_C(0x9c23b109a47c851e), UINT64_C(0xf5f3538902f3c629) }},
+  {{ UINT64_C(0x2197b5fbd707c842), UINT64_C(0x6732c23c2180055a), UINT64_C(0xedbb4e1be9f97b55), UINT64_C(0x2abdc2308d2b9205) }},
+  {{ UINT64_C(0x7cc6f9b360b6fe6c), UINT64_C(0x60c64494885575b3), UINT64_C(0xb39b34efdebf0d47), UINT64_C(0x7548110a9465c0d9) }},
+  {{ UINT64_C(0xdceb2dbd2e88166e), UINT64_C(0x7f770644a62d646c), UINT64_C(0x7db4074d3bc51e5f), UINT64_C(0xc56dc73b4e825ddf) }},
+  {{ UINT64_C(0x423583d8c50eda64), UINT64_C(0x2056bb97528919f1), UINT64_C(0xbec65a625abe4cd6), UINT64_C(0x6acab6a14351c3aa) }},
+  {{ UINT64_C(0xe20fc241d5802bec), UINT64_C(0x7e810c269c874805), UINT64_C(0x7099e075682daf8c), UINT64_C(0xa3147a1856ca5a86) }},
+  {{ UINT64_C(0x09ef6aa6e2be5c88), UINT64_C(0x8d3eadca89677905), UINT64_C(0x80b7d0a5b7cb150c), UINT64_C(0xd65ecbc123485b2a) }},
+  {{ UINT64_C(0x5a03848622b96312), UINT64_C(0x1acfcec267c415ca), UINT64_C(0x3d0a057fa5e775c8), UINT64_C(0x66aadf319f4e15e9) }},
+  {{ UINT64_C(0xa2a59ca38f5d0850), UINT64_C(0x465f792630245f79), UINT64_C(0x71f1c872998a2e55), UINT64_C(0x0df284214a8ab846) }},
+  {{ UINT64_C(0x6403d4545caeb96a), UINT64_C(0xe04ca33125b90df8), UINT64_C(0x0980d9355d06b008), UINT64_C(0x83e6cb848919b217) }},
+  {{ UINT64_C(0xbe94698ef332f294), UINT64_C(0x62711d72942e80e3), UINT64_C(0x06d99e8bfd6c4c57), UINT64_C(0x6fd88fc27063d6ff) }},
+  {{ UINT64_C(0x178c6e1c057a5378), UINT64_C(0x0a6f24ceeed3e9ab), UINT64_C(0xfce7acc599b9811c), UINT64_C(0x44fabc93317873ca) }},
+  {{ UINT64_C(0x2bac90fcc3179d60), UINT64_C(0x93453d941e03811a), UINT64_C(0xb722b7139ca18f46), UINT64_C(0x160a13a4b84a993f) }},
+  {{ UINT64_C(0x1a6c83444975535c), UINT64_C(0x1c92c9c267f25a44), UINT64_C(0xbd319df3d1b7177c), UINT64_C(0x10959b8a0c70e596) }},
+  {{ UINT64_C(0x634ba978b4f4c374), UINT64_C(0xc27479dacb162c6d), UINT64_C(0xad0aeeb8afec8a78), UINT64_C(0xad8359501f223e1f) }},
+  {{ UINT64_C(0x39aec9cd53a3128e), UINT64_C(0x0afcc1267f393c8a), UINT64_C(0x0e9f7eb8c74a63d2), UINT64_C(0xed91405f8cf138b3) }},
+  {{ UINT64_C(0x4ed8545b5e278e60), UINT64_C(0x309b02a804df0f8e), UINT64_C(0x9f7d61fe535b992b), UINT64_C(0x5088f7580031ae48) }},
+  {{ UINT64_C(0x2be458a9b0a524ea), UINT64_C(0xb300f50e991c8187), UINT64_C(0xe4311a8ed4952744), UINT64_C(0x7c1beab891b7fcdf) }},
+  {{ UINT64_C(0xf3a3bac1c837d2fc), UINT64_C(0x4d12afcf7e1844ff), UINT64_C(0xeb9abe5152cc607b), UINT64_C(0x2496afc6d2ce9e75) }},
+  {{ UINT64_C(0xe594b1f047821a10), UINT64_C(0x1f82868ee3328cd2), UINT64_C(0x29ed745722dc3aeb), UINT64_C(0x73cabf438d339f2f) }},
+  {{ UINT64_C(0xc6457be400788e44), UINT64_C(0x39afb9b8129a5662), UINT64_C(0xf404c7fc64fcb4f3), UINT64_C(0x04909165f42680e3) }},
+  {{ UINT64_C(0x6aa2e832fe15e4dc), UINT64_C(0x06dec5785e764e32), UINT64_C(0xfe6aa8a33ba4fcf4), UINT64_C(0xd734746aa2b9ce6d) }},
+  {{ UINT64_C(0xaaaa29c30437741e), UINT64_C(0x06cecc22a0dd850f), UINT64_C(0x75b45574cb2bf430), UINT64_C(0x726c2128db14b4f0) }},
+  {{ UINT64_C(0x0c0b24984e724432), UINT64_C(0x78b12ed16fbf5881), UINT64_C(0xf6b5be9becda982b), UINT64_C(0x63732a5018147dee) }},
+  {{ UINT64_C(0x86333d132741519a), UINT64_C(0x08e2c414c330ea6c), UINT64_C(0x153bcf390429faee), UINT64_C(0x0dccea21377b5ed4) }},
+  {{ UINT64_C(0xea5383593397e0e2), UINT64_C(0x2e83563fce0f7388), UINT64_C(0x407626b02e76a4b8), UINT64_C(0xbddc3362965a4e57) }},
+  {{ UINT64_C(0x3cd84e165aa0f50a), UINT64_C(0x9fa8d4460ead7cc8), UINT64_C(0x9b6ace8fc30216be), UINT64_C(0xabf6470f4ab23c06) }},
+  {{ UINT64_C(0x504af7f237f770d6), UINT64_C(0x2c0edcd493487dc3), UINT64_C(0x2238e7c6f8421c48), UINT64_C(0x5f7b793c5964e160) }},
+  {{ UINT64_C(0x0b0f6fb15501bd5a), UINT64_C(0x348f8927f27bc306), UINT64_C(0x41e1f6dc489a9352), UINT64_C(0xe586d0f5419abf58) }},
+  {{ UINT64_C(0x83aaad1b9f06ec08), UINT64_C(0xe274a62c32ca8b47), UINT64_C(0xbd458d53569c52de), UINT64_C(0x31ca9280fb938ba3) }},
+  {{ UINT64_C(0x4e63fc9358ad1666), UINT64_C(0x1415ecfb0b8b7028), UINT64_C(0x54cae48754d41852), UINT64_C(0xaf9ee7e8adfd959d) }},
+  {{ UINT64_C(0xad5bfebbac83ca80), UINT64_C(0xda4a71ac5ac6fa3f), UINT64_C(0xc6f15ba8f43221d2), UINT64_C(0xcb060be9fe327cfe) }},
+  {{ UINT64_C(0x6a3edf40f9f2b734), UINT64_C(0x3a13b70bf35b1993), UINT64_C(0x1bb12fbf62d92a6c), UINT64_C(0x8ca4fe0a85bc005a) }},
+  {{ UINT64_C(0x001951b184c07e4c), UINT64_C(0x09eb42728c6ffe02), UINT64_C(0x4a2ec6349578c203), UINT64_C(0xdc647ef29061055f) }},
+  {{ UINT64_C(0x9e3a8901092da46a), UINT64_C(0x2c325f247d69dfbe), UINT64_C(0x743d27c2022c706b), UINT64_C(0x267ed59cbca942cc) }},
+  {{ UINT64_C(0x01db966b31105f1a), UINT64_C(0xfa8dd016ea998252), UINT64_C(0x773a48997b52a4b8), UINT64_C(0x96e5394b3cbf0ef6) }},
+  {{ UINT64_C(0xcc680f4f6314f3e4), UINT64_C(0x73a2a6c3ddc31389), UINT64_C(0x5113ae201245d397), UINT64_C(0x0b5635ccb15d6f7f) }},
+  {{ UINT64_C(0xebca4a31c7951ade), UINT64_C(0xffd15b2a68578491), UINT64_C(0x4477c23320e89fb8), UINT64_C(0xbbd7156bb94505e8) }},
+  {{ UINT64_C(0x9fc77f4710e382ce), UINT64_C(0x464c6f3a9bca2ec0), UINT64_C(0x9c2fa59bfc93e165), UINT64_C(0xa70a4317588683c3) }},
+  {{ UINT64_C(0x5cf9f060ec4eb5ae), UINT64_C(0xaa0ce3c9370b8d0d), UINT64_C(0x385c8dcd3abe2daf), UINT64_C(0xb8d96aab064191c8) }},
+  {{ UINT64_C(0x2cde0b3d058ad6a4), UINT64_C(0x2566cdc014a8df80), UINT64_C(0x35ba4d1ed2467809), UINT64_C(0x5b2d3d6b75541a1d) }},
+  {{ UINT64_C(0xe66b04395e40d37c), UINT64_C(0x2a9a539e2e53df67), UINT64_C(0x9fea355036533655), UINT64_C(0x8ceb67db75ac62ec) }},
+  {{ UINT64_C(0x3adccb2ff846da58), UINT64_C(0x6f4e1ea25241c106), UINT64_C(0x1df6a02fc4334422), UINT64_C(0x6ae720f7839e8f2e) }},
+  {{ UINT64_C(0x31dd599b67689418), UINT64_C(0x56a2a406536019e0), UINT64_C(0x0e9824a9533a6563), UINT64_C(0x6fe366c6e92fe652) }},
+  {{ UINT64_C(0x91a724538153f0f2), UINT64_C(0x441503cee64ead5c), UINT64_C(0xc5ff7ee275469cc0), UINT64_C(0x8c6a05b06147bbf5) }},
+  {{ UINT64_C(0x84604dc74181af2e), UINT64_C(0xc5d118f79d411034), UINT64_C(0x2abae9c12c0dd6ef), UINT64_C(0x82538c33e6304815) }},
+  {{ UINT64_C(0x910d8cf4d11447d2), UINT64_C(0xc13161aa33fa1d1c), UINT64_C(0xa5831b2626f9dc28), UINT64_C(0xdb3ed2cf62a813af) }},
+  {{ UINT64_C(0x89830d97bf685e62), UINT64_C(0x9e6e072857b0a7bd), UINT64_C(0xa2f953e6960e4538), UINT64_C(0xe17a3d74ebf921e3) }},
+  {{ UINT64_C(0x32607902ff04c096), UINT64_C(0x078d80fc7df7d23a), UINT64_C(0x13308afdad6a61c6), UINT64_C(0x284628d6667d2050) }},
+  {{ UINT64_C(0x6d989fdbc0c32e8e), UINT64_C(0xc09544d0141d38e6), UINT64_C(0x2b01bce83a1a2965), UINT64_C(0xcf0d08c762b41f94) }},
+  {{ UINT64_C(0xd7889be8976408de), UINT64_C(0x88bfe8d7182cb96e), UINT64_C(0xc7f0ead359d1daf9), UINT64_C(0x4b8d83d6856f4684) }},
+  {{ UINT64_C(0x61a9c8a0cd1578f6), UINT64_C(0xca13dbed175bc5f1), UINT64_C(0x9941b2463b321ff2), UINT64_C(0xbe9378cfaf983420) }},
+  {{ UINT64_C(0x360ea4144b9fdf20), UINT64_C(0x1a10fab6aeb89472), UINT64_C(0x6654992c7ae75637), UINT64_C(0x7147d9aada0486de) }},
+  {{ UINT64_C(0x27d1e3b31c32e570), UINT64_C(0xa8a479b5c0998fff), UINT64_C(0x7afc1bb9c3c16aa5), UINT64_C(0x911a8b8007164b69) }},
+  {{ UINT64_C(0x9ff6ed0835d0434e), UINT64_C(0x418220be95be1556), UINT64_C(0x3f25107c058f5f43), UINT64_C(0xa2805191bbfe40a2) }},
+  {{ UINT64_C(0x73051563f1e68f3e), UINT64_C(0x8968379249d204de), UINT64_C(0x3fab672f7754bec3), UINT64_C(0xb046d767b01d5473) }},
+  {{ UINT64_C(0x5c5353a8eeafe5fe), UINT64_C(0x90b18ddf629cbcab), UINT64_C(0x9f811e436a39a574), UINT64_C(0x6d9ad4c1c4ff151a) }},
+  {{ UINT64_C(0x4edeaa800db39852), UINT64_C(0xafa38d58087ab80a), UINT64_C(0xa3ec0b2b2c9b0b01), UINT64_C(0x2a48e6895abc0048) }},
+  {{ UINT64_C(0x3b4624d3196c7a02), UINT64_C(0x1ab9a1dbb9a69148), UINT64_C(0x25117ba95968fa04), UINT64_C(0xe4e06b9921885954) }},
+  {{ UINT64_C(0x1015e51f13d8e2c6), UINT64_C(0x2f23bcb501545356), UINT64_C(0xf097defb6d451e8e), UINT64_C(0xb563fa06fe8b9d2d) }},
+  {{ UINT64_C(0x5b86198e9c090464), UINT64_C(0x9678fa6e11602e7f), UINT64_C(0xb1795a5ed66e23f0), UINT64_C(0xcac30b4d0b6492b3) }},
+  {{ UINT64_C(0xb388e21940e16c44), UINT64_C(0xa5acd6fdddb06e43), UINT64_C(0xebc0d21ab6a38179), UINT64_C(0xfe94b0a3205396cd) }},
+  {{ UINT64_C(0xf02bd8e462f791b2), UINT64_C(0x889cb975cd2a92f1), UINT64_C(0xad56f5b8860e0dfa), UINT64_C(0xe3045499aba59590) }},
+  {{ UINT64_C(0x379aaf254e951b04), UINT64_C(0xc66c4f3ade8ef674), UINT64_C(0x9dcbd67f7b15bc08), UINT64_C(0xa20104b63207a16f) }},
+  {{ UINT64_C(0x67a1a60eded47be0), UINT64_C(0xf46053af3e45fd61), UINT64_C(0xf6876c718a3ea1f1), UINT64_C(0x7cac95432bcfde91) }},
+  {{ UINT64_C(0x8785eca81f627512), UINT64_C(0x124d413c55e52623), UINT64_C(0x7cce2f8be8e6607e), UINT64_C(0x311eece23f05dbcc) }},
+  {{ UINT64_C(0x356d7943bc756a82), UINT64_C(0x28bbdbbef368ee4d), UINT64_C(0x1be41d14465b7d74), UINT64_C(0xdaf971c694797241) }},
+  {{ UINT64_C(0x52e1485d6293b3f4), UINT64_C(0x87e3cbf969d390e2), UINT64_C(0xd9174f272789646d), UINT64_C(0x9c1f9d50f516c02d) }},
+  {{ UINT64_C(0xe30f9a96fb896710), UINT64_C(0x34350f54b160b0a7), UINT64_C(0x1107ded7b525de69), UINT64_C(0x0f8d61cf99a6a0c6) }},
+  {{ UINT64_C(0x81563f78d3a2ec1e), UINT64_C(0xce78f5bd928f3633), UINT64_C(0xb78bc81657bbf4fe), UINT64_C(0xc039dcacc8c43fe4) }},
+  {{ UINT64_C(0x0f1e19c3b8ec1bb4), UINT64_C(0x911024d01b02676d), UINT64_C(0xfb500328cbe42a4c), UINT64_C(0xb11181a1d9523f59) }},
+  {{ UINT64_C(0x7ac51ef322b5159a), UINT64_C(0xb459528cb93482c0), UINT64_C(0xa6503ddd8a21dd37), UINT64_C(0x66470f33c47e15c4) }},
+  {{ UINT64_C(0x6270e0a9577a99de), UINT64_C(0xee79dfb133af93f2), UINT64_C(0x5a882aea7cfb6ad5), UINT64_C(0xe46ccae75c596877) }},
+  {{ UINT64_C(0x117c72c9ea657064), UINT64_C(0x6f6c070cc1673db2), UINT64_C(0xdce1c8065ffb5f77), UINT64_C(0x7a13406ba9343c29) }},
+  {{ UINT64_C(0x1d2bea5a7ff19ffe), UINT64_C(0xbdab517a3019ab90), UINT64_C(0xc4c605b1fc651db7), UINT64_C(0xa969f3bd640c2344) }},
+  {{ UINT64_C(0xfcc13794ee389bc0), UINT64_C(0xc73f9dd72a1b0f4d), UINT64_C(0x3a451c3fe471c1c6), UINT64_C(0x601d6e6c78441bdc) }},
+  {{ UINT64_C(0x469ac640eaa90c16), UINT64_C(0x98534ef45fb9ab99), UINT64_C(0x38a0339fe4e4fd7a), UINT64_C(0x3401ec6c9875b687) }},
+  {{ UINT64_C(0x13eefa80ca649016), UINT64_C(0xb1cb45c23e17baa5), UINT64_C(0x36b8bc99f39f2170), UINT64_C(0x90f6c88b262b4078) }},
+  {{ UINT64_C(0x2b61c1559ae22442), UINT64_C(0xc0d107af3bab55cc), UINT64_C(0x476d44992b1af0fb), UINT64_C(0xf103ce55128044cd) }},
+  {{ UINT64_C(0xd1eec12700a9e4dc), UINT64_C(0x2c9ad0efcf1511c9), UINT64_C(0x6ba7bab3c463f9b5), UINT64_C(0xbedc128d1f8ae2f5) }},
+  {{ UINT64_C(0xbe0911372322943a), UINT64_C(0x7c578ecaec0636d8), UINT64_C(0xe4133ee81a222778), UINT64_C(0x04074b443628d9e2) }},
+  {{ UINT64_C(0x597a8bb50be0812c), UINT64_C(0x5462a65d4a76a9b1), UINT64_C(0x30889f25f0053d2e), UINT64_C(0xd4d6813fe6052bb6) }},
+  {{ UINT64_C(0xacec9f2e220db1e0), UINT64_C(0x7fae23d2f544c642), UINT64_C(0x15ae9b965355384c), UINT64_C(0xb15ed505703b4128) }},
+  {{ UINT64_C(0xf6edd2b3efa07062), UINT64_C(0xabed887735f4e881), UINT64_C(0x5f86f3cc57932c5d), UINT64_C(0x8d1fb2d59e5cc9b9) }},
+  {{ UINT64_C(0x4fc05c2b3ff99a92), UINT64_C(0x90e4c7e2e40ebaee), UINT64_C(0x8e55fb9fd4f60b83), UINT64_C(0x44e1304ad226ee79) }},
+  {{ UINT64_C(0x1bff32db09bbf1f0), UINT64_C(0xc4dc0f5b265a296d), UINT64_C(0x8b33c665788bfbac), UINT64_C(0xb4094140bc0f5d98) }},
+  {{ UINT64_C(0xee530e5c6f2855f2), UINT64_C(0x916d4abfb8d8ac59), UINT64_C(0xb6c0985a17bb658a), UINT64_C(0x117135bc9ee40f4d) }},
+  {{ UINT64_C(0x53201ee906c673a4), UINT64_C(0x3dc149d655b13577), UINT64_C(0x787423708c477e10), UINT64_C(0x305f478f854e64d8) }},
+  {{ UINT64_C(0xf7fa810b072d1086), UINT64_C(0xba6b6bea66cbd5e7), UINT64_C(0xea64c0b67c4daf02), UINT64_C(0x28a1ee25d3825d86) }},
+  {{ UINT64_C(0x897aee5933d018c2), UINT64_C(0x22714eba828d910e), UINT64_C(0x18883937d8550567), UINT64_C(0xe3c519afaf5a3222) }},
+  {{ UINT64_C(0x678224830413b5c0), UINT64_C(0x12a162dd2bb76a30), UINT64_C(0x7ae3e3fade5df359), UINT64_C(0x4f8e1372a443939d) }},
+  {{ UINT64_C(0x3337f429b2467ff0), UINT64_C(0x6d309f1771e795bf), UINT64_C(0x265d24ca000b0a25), UINT64_C(0x90a380d0503596f9) }},
+  {{ UINT64_C(0x6c7e1f71448d8bd8), UINT64_C(0x0e2d263a42f25323), UINT64_C(0x4a7568757f78a174), UINT64_C(0xfed2f86a295d8625) }},
+  {{ UINT64_C(0x6a75d32fc8f4e2d8), UINT64_C(0x83d1efbbc58538d6), UINT64_C(0x9f51bc99e40a9ff2), UINT64_C(0x084ebd0f28d780f6) }},
+  {{ UINT64_C(0x3aa40f87525e1930), UINT64_C(0x27a6cc898641af8e), UINT64_C(0xd92d11fea1f14871), UINT64_C(0x27581737cb6ea25a) }},
+  {{ UINT64_C(0x380a06345342e5ca), UINT64_C(0x9055ad0b4f1b0a11), UINT64_C(0x83f7f22821e0f6b6), UINT64_C(0xa7aca8f15cf0c907) }},
+  {{ UINT64_C(0xfd16fe7a2168c138), UINT64_C(0x45a18556cad50339), UINT64_C(0x515f9c6e95bfb8d3), UINT64_C(0x38e6b2ac20c19044) }},
+  {{ UINT64_C(0xbcd16fb417ae01a4), UINT64_C(0x0923caec038e06c9), UINT64_C(0xf0a498aa201dfa6f), UINT64_C(0x01ef8982a3aeb24f) }},
+  {{ UINT64_C(0x0ce35cc6777167ba), UINT64_C(0x596d901daa294747), UINT64_C(0x841afca655a77406), UINT64_C(0x0993dac1b048479b) }},
+  {{ UINT64_C(0xe9d1f56e5e9ce4fe), UINT64_C(0x12853a3db7832cab), UINT64_C(0xc30fbec812c6f332), UINT64_C(0x52d145b042169e0f) }},
+  {{ UINT64_C(0x56f18303adacee02), UINT64_C(0x4dd91cd41ac1b735), UINT64_C(0xcdd493e19aee8ad3), UINT64_C(0x308000d41fd21e69) }},
+  {{ UINT64_C(0x52e79621e1e392b4), UINT64_C(0x9d72841883e14900), UINT64_C(0xeacdebee518ae275), UINT64_C(0x40d9baf6c2ab2766) }},
+  {{ UINT64_C(0x086354b3a5cdca6c), UINT64_C(0x7ec954688d15b37f), UINT64_C(0xec32a81b1ed0be74), UINT64_C(0x9fa764b3da7a6db6) }},
+  {{ UINT64_C(0x484414294e6f2c78), UINT64_C(0x9a9d59e512c3a44d), UINT64_C(0xbdf4ba1f73ac1fef), UINT64_C(0xe750959759825b25) }},
+  {{ UINT64_C(0xe57dd6ec996a8bb8), UINT64_C(0xfa321b8917923ee7), UINT64_C(0xe2be3fb393132e1c), UINT64_C(0x97534391b72f389d) }},
+  {{ UINT64_C(0xfd4b9ff32a80ab34), UINT64_C(0xc17a262b708cb08e), UINT64_C(0xe9a690385f409b1e), UINT64_C(0x4df0049e4a185af3) }},
+  {{ UINT64_C(0x27a2b4c1868e1f10), UINT64_C(0x79e97d6f246995b0), UINT64_C(0x345e827c275e5229), UINT64_C(0x79592ce981609ee3) }},
+  {{ UINT64_C(0x872b9d2225f31f34), UINT64_C(0xeb56552ccb60390b), UINT64_C(0xbcca5b9ab2d6d694), UINT64_C(0xdcfd62621929a263) }},
+  {{ UINT64_C(0x1d347859376152f6), UINT64_C(0x42845baca4291a38), UINT64_C(0x4e9e2a25a57542c4), UINT64_C(0x6f516a89c7b41dfd) }},
+  {{ UINT64_C(0x6c5cd135ad3333dc), UINT64_C(0xf9f3035fa84ac918), UINT64_C(0xa8b37743080a1ec0), UINT64_C(0xd0cd1c2edb2b01e2) }},
+  {{ UINT64_C(0xe42b346235338a70), UINT64_C(0x5a9fd6d11ae0ddb8), UINT64_C(0xa26dd135c54220c3), UINT64_C(0x19151666f2bd79fb) }},
+  {{ UINT64_C(0x4b21d927f675964c), UINT64_C(0x13bef02826f290b1), UINT64_C(0x9dbf051338a7deef), UINT64_C(0x5ba32921e0fd31eb) }},
+  {{ UINT64_C(0xfe8c4df7e3975136), UINT64_C(0x47fb51084ca31697), UINT64_C(0xc8324941e79fa268), UINT64_C(0x8e3b40f97ef2d149) }},
+  {{ UINT64_C(0xb79fc77cec051488), UINT64_C(0x97d6aaab1fbf809d), UINT64_C(0x05a997fd76522c8d), UINT64_C(0xce3584895e91b24d) }},
+  {{ UINT64_C(0xb9c06fb0814be672), UINT64_C(0x0734861d2893411f), UINT64_C(0xecbe6bbcc7eb6396), UINT64_C(0xaa6179835ad3c1c0) }},
+  {{ UINT64_C(0x32b07fac1671abe6), UINT64_C(0xf1f8642dad2d3525), UINT64_C(0xc80e023987585dca), UINT64_C(0x86379ca33fc68f7c) }},
+  {{ UINT64_C(0xd67cdd4409a63ad4), UINT64_C(0x5e0ec9b98ad6a686), UINT64_C(0x74de266686c5ca4b), UINT64_C(0xce9c65378d7ec55a) }},
+  {{ UINT64_C(0xfd2a23e524b190e2), UINT64_C(0x75112dead3d0d84f), UINT64_C(0x2f6697e9f97d322d), UINT64_C(0xa9821f6ae26d5b13) }},
+  {{ UINT64_C(0xf68c714161b41564), UINT64_C(0xbd80a3ce413a9a65), UINT64_C(0xa3f54274a0c1c043), UINT64_C(0xde7c0654d2f0f202) }},
+  {{ UINT64_C(0x742157cce1e18ce4), UINT64_C(0x21888c91885dc505), UINT64_C(0x7131b0a117c647b4), UINT64_C(0x90fd464782f31757) }},
+  {{ UINT64_C(0xe99875beb4d83086), UINT64_C(0x5c42134b25bc7cf2), UINT64_C(0xdcee4b95794c2b63), UINT64_C(0xda9f6e543b1f8edc) }},
+  {{ UINT64_C(0xd7fa986d463590be), UINT64_C(0xe11b0d10d908cf33), UINT64_C(0xa91b699f215393ad), UINT64_C(0x99eb57f5380216c3) }},
+  {{ UINT64_C(0x1e5eb9843a771972), UINT64_C(0xbf225c902e5abaca), UINT64_C(0xca2120ba571ffe5a), UINT64_C(0x2ef5d383ca19b6d7) }},
+  {{ UINT64_C(0x9ece728180aac706), UINT64_C(0xf9b03a1e8e710a0e), UINT64_C(0x165cf48363a799e5), UINT64_C(0xb0f761827c60ff53) }},
+  {{ UINT64_C(0x2a0f5281894f76f6), UINT64_C(0x545b099e4af08c87), UINT64_C(0x2e16693120b909f6), UINT64_C(0x5a2ad4ebabb68f4e) }},
+  {{ UINT64_C(0x023a0310258b2f2e), UINT64_C(0x114fa246ef5595f3), UINT64_C(0x4aa68d38ea728d27), UINT64_C(0x964bce7cedab65f8) }},
+  {{ UINT64_C(0x23f7f052c2ae029a), UINT64_C(0x66e5dfd79a274cb2), UINT64_C(0x0b83f5abe9f1f5d9), UINT64_C(0xe9f3018086bed876) }},
+  {{ UINT64_C(0x109d7234398dd8c4), UINT64_C(0x20c67c2935744525), UINT64_C(0x063fa8515ec69d53), UINT64_C(0x7cecf80c5906813e) }},
+  {{ UINT64_C(0x107ddef9a04d0d1e), UINT64_C(0xfccdc70ac8c61f95), UINT64_C(0x4c064b402752af0b), UINT64_C(0xd2f551fa6c7ab74f) }},
+  {{ UINT64_C(0x4b4f8cc4e80567f0), UINT64_C(0x71a0061b514f56f0), UINT64_C(0x58312eb398d51a6a), UINT64_C(0x6f38c14801381009) }},
+  {{ UINT64_C(0xb395e47adc8eb376), UINT64_C(0x86ca3e2f6e7948f8), UINT64_C(0x63f7e170a308ec61), UINT64_C(0xaafef49c20f685d6) }},
+  {{ UINT64_C(0x7852792a95f9e43a), UINT64_C(0x4c9ef34fcf077682), UINT64_C(0x0b219a5a7c1e31c0), UINT64_C(0xfbab9a7609c20fce) }},
+  {{ UINT64_C(0xe811bd71e90dc1c8), UINT64_C(0xc842eee91be18301), UINT64_C(0xa689a3bdf91e9624), UINT64_C(0x9d453d0af09e3fe3) }},
+  {{ UINT64_C(0xdb3a2a41610e5548), UINT64_C(0x874a97bfe6ef4700), UINT64_C(0x804fff28a8f8b64c), UINT64_C(0x88fa787837935cd4) }},
+  {{ UINT64_C(0xa4b711f612aa15fe), UINT64_C(0xbb275077176dbcbe), UINT64_C(0xf372bdd8802ba544), UINT64_C(0x0da4f2a86ceea1ab) }},
+  {{ UINT64_C(0x6fa4db3dc3ea1712), UINT64_C(0x1a3c47fcf266fc86), UINT64_C(0x87590ee805de70e0), UINT64_C(0x894cdac96208ac5a) }},
+  {{ UINT64_C(0xa667d77baacd3d5a), UINT64_C(0x86093cded117ff3e), UINT64_C(0x70d48fab0d167536), UINT64_C(0x272ba916d37f5930) }},
+  {{ UINT64_C(0x3b77485970d34784), UINT64_C(0x1e3c3403342e2b4e), UINT64_C(0x760c50d317c75d6a), UINT64_C(0x463d1edf8d0b0305) }},
+  {{ UINT64_C(0xfb7057c3d70ab1e2), UINT64_C(0x32efc7325687420b), UINT64_C(0x1026d65028107f1e), UINT64_C(0x40e329aded8721fe) }},
+  {{ UINT64_C(0xcd2106a69990b4a8), UINT64_C(0x365e494c3e90ffc0), UINT64_C(0x686f2d37c4d38d05), UINT64_C(0xcc13854968e9fd4a) }},
+  {{ UINT64_C(0xd9ec60d2f1878f4e), UINT64_C(0xf2421b768b16756c), UINT64_C(0xb9f71ea9d7b2507d), UINT64_C(0x8d94ce84a7c42adf) }},
+  {{ UINT64_C(0x77229bb86ed666f4), UINT64_C(0x3216f94839cf6b28), UINT64_C(0x3b69489c69e442ec), UINT64_C(0xec4dde0d4d654a10) }},
+  {{ UINT64_C(0xede687c05f50e46a), UINT64_C(0x48607b29dfbad372), UINT64_C(0xb240316739d2c959), UINT64_C(0xec06f2be99e48fdd) }},
+  {{ UINT64_C(0x84165748e018f68e), UINT64_C(0x548de818f3149dfa), UINT64_C(0x61984416efaff58c), UINT64_C(0x01cf18df3ee72cbd) }},
+  {{ UINT64_C(0x941695cff2f9eb7a), UINT64_C(0x02db2a1226109d7f), UINT64_C(0x32a5eb63fe568b7b), UINT64_C(0x77b187b4bb2a8cef) }},
+  {{ UINT64_C(0x02935216b20298fc), UINT64_C(0xa9ee6105cc97250c), UINT64_C(0x330c865aeceeda67), UINT64_C(0x945ba726496581b6) }},
+  {{ UINT64_C(0x166139093046c1dc), UINT64_C(0x1e7721292b1ffd50), UINT64_C(0x945c8162b3541c1b), UINT64_C(0x9b82ff69d6b840b5) }},
+  {{ UINT64_C(0x48fe3ffe3890a036), UINT64_C(0x4665a9f4c9322539), UINT64_C(0x7895f3c610818772), UINT64_C(0x307fccc287286491) }},
+  {{ UINT64_C(0x809c4712922e3356), UINT64_C(0xf928ec6d31f6f6e2), UINT64_C(0x2a528d089d6c8d8b), UINT64_C(0xe0f23adaae8cf9f5) }},
+  {{ UINT64_C(0x4c4fa933ea31fa66), UINT64_C(0x4b7d82300f3e9c05), UINT64_C(0x79598f4a5cf4d868), UINT64_C(0x97a3773646ff45a4) }},
+  {{ UINT64_C(0x9f84794c3de71658), UINT64_C(0x528fa4f77450ec41), UINT64_C(0xc17ac5f386fadb1a), UINT64_C(0x1d9adce282e92a4a) }},
+  {{ UINT64_C(0x9224cb5ed1a90772), UINT64_C(0xc28421e8bebda5b3), UINT64_C(0x8f5c6ca54f452a1b), UINT64_C(0xa791a2268294837d) }},
+  {{ UINT64_C(0xad11b651d9bba13e), UINT64_C(0x7e049a1a945f4a71), UINT64_C(0x64b9b607ac6a9a9b), UINT64_C(0x35b18fc8f8f458ad) }},
+  {{ UINT64_C(0x7c360aacd287054a), UINT64_C(0x40020a43dbddbb80), UINT64_C(0xaecd80553e71e6f8), UINT64_C(0x3e4b67ea1b849432) }},
+  {{ UINT64_C(0x5c84289f48b310ee), UINT64_C(0x9a8c9d3008833ec7), UINT64_C(0xb2ace7ee4f630a0d), UINT64_C(0xec772cbfceb1d452) }},
+  {{ UINT64_C(0xf79f7f8ea87e1916), UINT64_C(0x4e4781c578b50050), UINT64_C(0xe049d92c226fe768), UINT64_C(0x68acbb8f155f56ef) }},
+  {{ UINT64_C(0x8a6d73f3a9018fd0), UINT64_C(0x07f4560ce6e5c41b), UINT64_C(0x773c9b1e0f5748a9), UINT64_C(0xce525176d11416f1) }},
+  {{ UINT64_C(0xee0ff29c2ccb2df4), UINT64_C(0x16e4086ca669f051), UINT64_C(0x3ddaa9a1ef917699), UINT64_C(0x521d635431431449) }},
+  {{ UINT64_C(0x5b7215bf6a1cbf28), UINT64_C(0x1eafa9cc82a6c629), UINT64_C(0x6318a058b26a93fa), UINT64_C(0x9003fec3c1788cb1) }},
+  {{ UINT64_C(0xc5db6691a0f548ec), UINT64_C(0x079e309cd97bbb03), UINT64_C(0x411726fbfa282ce8), UINT64_C(0xcf9a2e732781e0ed) }},
+  {{ UINT64_C(0xbd6910e6df8fcc82), UINT64_C(0x6e6a7992819c70ee), UINT64_C(0x13a166a3fba30e59), UINT64_C(0x6723a0e80ce90faa) }},
+  {{ UINT64_C(0x2967f73a38f7dbb8), UINT64_C(0x5c00af6064c941f9), UINT64_C(0x0c58a37cec899fb8), UINT64_C(0xbd13be8379d43752) }},
+  {{ UINT64_C(0x937a580a898b2a2a), UINT64_C(0xaa158352b87609fd), UINT64_C(0xa6384595851b4c89), UINT64_C(0x89e766305c030bdb) }},
+  {{ UINT64_C(0x66a8c7fefaeb219e), UINT64_C(0x8a9a204eb118c407), UINT64_C(0x1a22ed744e318fe7), UINT64_C(0x19a0f3f761614624) }},
+  {{ UINT64_C(0x1b89c4dd6fb11214), UINT64_C(0xea15ca1e375a2541), UINT64_C(0xe5c61d1d0fa47008), UINT64_C(0x364cf13697885541) }},
+  {{ UINT64_C(0xd83b50d416cf5dc4), UINT64_C(0x3846d53ecba9fac1), UINT64_C(0x7e034c98c880752f), UINT64_C(0x89632baf40516cc8) }},
+  {{ UINT64_C(0xc37c2a8c8059cc32), UINT64_C(0x7b3f8d13dce27534), UINT64_C(0x1f2d212ab68f5a06), UINT64_C(0x960173c07884d575) }},
+  {{ UINT64_C(0xbfe39226ebebea16), UINT64_C(0xc0f6d05ffe72e8c2), UINT64_C(0xb6fb0b7ceedb9543), UINT64_C(0xb0c940ec724b66b6) }},
+  {{ UINT64_C(0x2754cf60d02c8008), UINT64_C(0x3d5fa567e8b44d96), UINT64_C(0x84a73d63b1e810b6), UINT64_C(0x0acd83ecfc5f61b7) }},
+  {{ UINT64_C(0x189c257b97154a86), UINT64_C(0xaef32b9f575804ce), UINT64_C(0x38199f66d33bc15d), UINT64_C(0x83487953559c9d9c) }},
+  {{ UINT64_C(0xd410205d73ee49ce), UINT64_C(0xab6d980e87194809), UINT64_C(0x147e3ac60a3ca5c6), UINT64_C(0x75a2d2fede55ba23) }},
+  {{ UINT64_C(0x8ee3fdc60de4facc), UINT64_C(0x8ec977ef7f470d09), UINT64_C(0xd87dc5407ab95cb2), UINT64_C(0x184b7d4af1613b79) }},
+  {{ UINT64_C(0x38f7c3647df4cf08), UINT64_C(0x78e374da2bff686f), UINT64_C(0xd2a1c56d248e17bf), UINT64_C(0x6d7e7af6bda6717e) }},
+  {{ UINT64_C(0xb9c2285541296cde), UINT64_C(0x5d5675e889715797), UINT64_C(0xe423317327008dd9), UINT64_C(0xffeeafd52a7360bb) }},
+  {{ UINT64_C(0x56d79582b6ea6e4a), UINT64_C(0xe3edaacb00372a4c), UINT64_C(0xe20007127c4ae0a7), UINT64_C(0xce93f24ceb1525c7) }},
+  {{ UINT64_C(0x62ee63bf2c1a3af2), UINT64_C(0x65842e5266bef5e7), UINT64_C(0x9b9bf7ed63ad428b), UINT64_C(0x830a7705e2f08cec) }},
+  {{ UINT64_C(0x9a434fe4fa2490da), UINT64_C(0xa52255354a6d4301), UINT64_C(0x5359c58e5883af16), UINT64_C(0x9433865d65bed352) }},
+  {{ UINT64_C(0xd46c98a9a840a788), UINT64_C(0x2dcca28157756750), UINT64_C(0xc2cf0b160ec1cc6f), UINT64_C(0x245e89d547ecec60) }},
+  {{ UINT64_C(0x90b9f302855378ea), UINT64_C(0x3bfe602724229527), UINT64_C(0x4293e58094185bb9), UINT64_C(0xa8f6c50d8b37fa49) }},
+  {{ UINT64_C(0xf329cc7087b8e74c), UINT64_C(0xa5fe9d1980f1274f), UINT64_C(0x90de21dda6f252c1), UINT64_C(0x5bdc1ca79075a388) }},
+  {{ UINT64_C(0xe71e6ce143c33f26), UINT64_C(0x7b05b0d5a4d1d9ad), UINT64_C(0x981c7e8fa7c81a6b), UINT64_C(0x650ac29c3541f13a) }},
+  {{ UINT64_C(0xbfbdab5301b81664), UINT64_C(0xe7a7d3f5883a65a1), UINT64_C(0x092584ae2326241b), UINT64_C(0xd8b1be451c9e459c) }},
+  {{ UINT64_C(0xd271ec7697a8e188), UINT64_C(0x1c9b2082df9b4efe), UINT64_C(0x8f7577a40847a3e9), UINT64_C(0xb61445b62bfb8d32) }},
+  {{ UINT64_C(0x3cd02990c9616734), UINT64_C(0xf31210a084cfdb77), UINT64_C(0xd3e767f9c2750791), UINT64_C(0x4d9fbcc47187afd5) }},
+  {{ UINT64_C(0x020c03f7e689f054), UINT64_C(0x3cb39cb4e57a72e5), UINT64_C(0x85f2f49a3d07099c), UINT64_C(0x6ba2c6cfdc08da1b) }},
+  {{ UINT64_C(0x04e94e03858eb7dc), UINT64_C(0x6c48cae885a84c36), UINT64_C(0x8aa2f5cf2de4deea), UINT64_C(0xa801fec5433fc38e) }},
+  {{ UINT64_C(0x9f5f4e4aedbcf9c6), UINT64_C(0x0e90d341892c3e1e), UINT64_C(0x9b1edbabd83efd94), UINT64_C(0xf45f1423ddb9f65b) }},
+  {{ UINT64_C(0x49fd79383387777c), UINT64_C(0x4edc1e9ac45893ab), UINT64_C(0x35b633f7c4a65ca3), UINT64_C(0x2510ccf5da646380) }},
+  {{ UINT64_C(0xd033fff69e99c1e4), UINT64_C(0xca2bd51bea130617), UINT64_C(0xaa791ab03036a780), UINT64_C(0xd74ee0b2ffcaa32d) }},
+  {{ UINT64_C(0x3ee6b1def5fc7c54), UINT64_C(0xfdbf28a62af3513e), UINT64_C(0x9dc988f39de07d9a), UINT64_C(0xa3595366ab6d195c) }},
+  {{ UINT64_C(0xd4593d1ffe7f1b5e), UINT64_C(0x093055977b746bbb), UINT64_C(0x071efe63b4eefb34), UINT64_C(0xcf92375560f64781) }},
+  {{ UINT64_C(0x1a898ebf4f0159a6), UINT64_C(0x23a6d6f5e6e887fb), UINT64_C(0x75848cee0e730376), UINT64_C(0x4544f64fcba4a0df) }},
+  {{ UINT64_C(0x95372cc57ef95872), UINT64_C(0x3e8ae380c45745ba), UINT64_C(0xf7234b19bad4f740), UINT64_C(0x4f3949214a68eed4) }},
+  {{ UINT64_C(0x0197c4be1981f7d4), UINT64_C(0x3fb58c1fb55d14b6), UINT64_C(0x8357ba42b4809dc0), UINT64_C(0xa5b6545d8aeea881) }},
+  {{ UINT64_C(0x384dbc7addbb6388), UINT64_C(0x5c7668d01b75c29c), UINT64_C(0x5ce0b2fdcaad449c), UINT64_C(0x5c5fb406ab909438) }},
+  {{ UINT64_C(0x29e795c8187e50b4), UINT64_C(0xb176216e043b7ed8), UINT64_C(0xc5113419070db3f2), UINT64_C(0xe207e1bdab6539bb) }},
+  {{ UINT64_C(0xd971b1fa3371da7a), UINT64_C(0x830dd43305c3515a), UINT64_C(0x3fbcadb56fb14b0e), UINT64_C(0xbfe251f8861de01c) }},
+  {{ UINT64_C(0x56925c4059c34ec6), UINT64_C(0x969f4c91d1d1483d), UINT64_C(0xda863426606423e7), UINT64_C(0x16955466b128610b) }},
+  {{ UINT64_C(0x95653f7a434f8a36), UINT64_C(0x0e5260630885540e), UINT64_C(0xd55d2dadbf2a07f1), UINT64_C(0x5b6a919dae96492a) }},
+  {{ UINT64_C(0x82473347d982133c), UINT64_C(0x74d460899d2caf25), UINT64_C(0x7a4c09c78bb899d6), UINT64_C(0x555ae1f3fda8108a) }},
+  {{ UINT64_C(0x318e38bb2af3e41a), UINT64_C(0x0fc155f705557bbf), UINT64_C(0x03ab19fa18fb8fa0), UINT64_C(0xcdb6ec62c69141ea) }},
+  {{ UINT64_C(0x45813f27d12c1980), UINT64_C(0xf3a5e9921e69914f), UINT64_C(0x64be3d55dee6ba29), UINT64_C(0xac7f47508d925c38) }},
+  {{ UINT64_C(0xa169c531ca202562), UINT64_C(0xa28f16d286294efc), UINT64_C(0xa275f9d08d541154), UINT64_C(0xd53b1f4b0235ddcc) }},
+  {{ UINT64_C(0x4872169c59604376), UINT64_C(0x0daa50c9007390ed), UINT64_C(0x79b50a40c060a067), UINT64_C(0x156169ba8c225a8c) }},
+  {{ UINT64_C(0x6570232411ddae9c), UINT64_C(0x46cc5aadba6d08d8), UINT64_C(0xbc34ad5b8f042c6b), UINT64_C(0xbb2b1f9a8c95e863) }},
+  {{ UINT64_C(0x4e012c60d139abec), UINT64_C(0xc2e0f98405ced29f), UINT64_C(0xeb07a2fbc1df9670), UINT64_C(0xbd6170840c0517f4) }},
+  {{ UINT64_C(0xcbd07045b64664c6), UINT64_C(0x2175cd9505af2c3a), UINT64_C(0xb08213d7efa70cfc), UINT64_C(0xf732ad478c380b9d) }},
+  {{ UINT64_C(0xaa5aecc28e953748), UINT64_C(0x3ec228a8f7b5f47d), UINT64_C(0xccc3edfc73f7942e), UINT64_C(0x90274090b82aa90b) }},
+  {{ UINT64_C(0xb2fbd87156951664), UINT64_C(0x79ece23e877b51b9), UINT64_C(0xa170df91aed98eab), UINT64_C(0x176169fd8c395252) }},
+  {{ UINT64_C(0xee2fd0616b2ce82a), UINT64_C(0x1ed8d1559e56b46a), UINT64_C(0x6ebef2c406c7a1d6), UINT64_C(0xc254f82ebfcd99bb) }},
+  {{ UINT64_C(0xe6b743576b195264), UINT64_C(0xd01515c2b2b34136), UINT64_C(0x6b16dd20a99103c3), UINT64_C(0xfa2761d6fa8006ff) }},
+  {{ UINT64_C(0xd4248b03647ea410), UINT64_C(0x80ae98515b7261b0), UINT64_C(0x597fe05abea266dd), UINT64_C(0x6428eb8bf0fadace) }},
+  {{ UINT64_C(0x9924a6ee158557fa), UINT64_C(0x04d12d51be169339), UINT64_C(0x19c4563fddae6d3a), UINT64_C(0xf8c7049265c7a493) }},
+  {{ UINT64_C(0x18cf3beb2fd7ce78), UINT64_C(0xcde30071149480ac), UINT64_C(0xb72029da45a96fc3), UINT64_C(0xcee04da115248da4) }},
+  {{ UINT64_C(0x92ccbe49192e9f26), UINT64_C(0x53abfc9b57ac3ddd), UINT64_C(0x190484c630d780cc), UINT64_C(0xe49ad1c093ef77ef) }},
+  {{ UINT64_C(0xce67c6393054c344), UINT64_C(0xccec58072bfdda7a), UINT64_C(0x7628525d4e83cfae), UINT64_C(0x0f8dc6e5a0ba2557) }},
+  {{ UINT64_C(0x9d42d8fb5c06e748), UINT64_C(0x1ad3e1db7f4841ea), UINT64_C(0xd27efa1d691d67b5), UINT64_C(0x113410744b10aac0) }},
+  {{ UINT64_C(0x7ba0ddd66d6b9c00), UINT64_C(0x3e6038e99704209a), UINT64_C(0x79d694c4a97d39ad), UINT64_C(0xce681a0591a680ba) }},
+  {{ UINT64_C(0xad1f61d3513855d0), UINT64_C(0x8926cf7ad4be7e72), UINT64_C(0x4edaad550077ffd9), UINT64_C(0xb5574a9b182005c9) }},
+  {{ UINT64_C(0x2e6b9a2206b9d252), UINT64_C(0x7d154833f0701404), UINT64_C(0x306cca6826775976), UINT64_C(0xec48ffff8f92e1af) }},
+  {{ UINT64_C(0x38d3de5696ecaafc), UINT64_C(0xe81608a92261deb1), UINT64_C(0x1191525b97733ddd), UINT64_C(0xa95ea1812591e95c) }},
+  {{ UINT64_C(0x8178e5693ec7669a), UINT64_C(0x7de5b81d8460075f), UINT64_C(0x8976358630939a4d), UINT64_C(0x200fd3347931542e) }},
+  {{ UINT64_C(0x46413e44bd49516a), UINT64_C(0xeb80d94b141c832a), UINT64_C(0x8fd6594e62ecafec), UINT64_C(0x1db8e0d0260f5e45) }},
+  {{ UINT64_C(0x45627f3af6bb08e8), UINT64_C(0x0da8e16a871ad006), UINT64_C(0xaf82ed52ce40835b), UINT64_C(0x54c172b8fbb810ae) }},
+  {{ UINT64_C(0x6baf2722df7b8532), UINT64_C(0xdcbb94a13d129b60), UINT64_C(0x64a851c0bc85f910), UINT64_C(0x762cb586e5ca0e8e) }},
+  {{ UINT64_C(0xfb60876ba37663b8), UINT64_C(0x40fc966b2ee19692), UINT64_C(0x4057c8152201a932), UINT64_C(0xe2e4c232ff70d76e) }},
+  {{ UINT64_C(0xf59ef02e820191a0), UINT64_C(0xf76cc0b173cd2f05), UINT64_C(0x586d40be9fd1d699), UINT64_C(0x97b37dcd46e6497a) }},
+  {{ UINT64_C(0x352215f812df4448), UINT64_C(0x4c1c2aec27d9da49), UINT64_C(0x75e3cbc6e5c31cde), UINT64_C(0x9216fa9f47a96dc3) }},
+  {{ UINT64_C(0x030b84bb81556538), UINT64_C(0x00db09cd7d22fe95), UINT64_C(0xc2800d81a3fe38fc), UINT64_C(0x84927be957ae1fa4) }},
+  {{ UINT64_C(0xf44135ed5f3ce04e), UINT64_C(0x410a974084e69553), UINT64_C(0x202d558d3f1d8b34), UINT64_C(0xe274a45b2da7e934) }},
+  {{ UINT64_C(0xd6fc1989968df4f0), UINT64_C(0x9419e2aa1a831101), UINT64_C(0x4d7eee2145ac3597), UINT64_C(0xa1ee62cc36a6bbe6) }},
+};
+
+
+static const mzd_local_t K_0[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0x6bc203bd14b26fd2), UINT64_C(0xa653e7ee07e8a06c), UINT64_C(0x9e3d863efb1ce44b), UINT64_C(0x0b226a93c84a47cb) }},
+  {{ UINT64_C(0xe4d8494e0e94dd38), UINT64_C(0xbde8e3608a8f6f07), UINT64_C(0xdf0ad995ea73321d), UINT64_C(0xff52f6dee5ad5244) }},
+  {{ UINT64_C(0x9c0037da76c3656e), UINT64_C(0xf6c64d6233a50aed), UINT64_C(0xa90a9182757a390b), UINT64_C(0x43066805af4483c3) }},
+  {{ UINT64_C(0xf3014751cad514b2), UINT64_C(0xb43a2466072e1d2b), UINT64_C(0xb405617b28a60ac5), UINT64_C(0xfb391e9d1fb65aac) }},
+  {{ UINT64_C(0x53774987ab9ca110), UINT64_C(0x6394f956caa1b268), UINT64_C(0xeacd9f1cca014c25), UINT64_C(0x0f72ec56c72bd75a) }},
+  {{ UINT64_C(0x1f25f330ff036c04), UINT64_C(0xbcb15430d80cbd87), UINT64_C(0xdb780a9523da1ff6), UINT64_C(0x42aaa6f701975905) }},
+  {{ UINT64_C(0xe948e048cdfe3ca2), UINT64_C(0xf607734ab40d60da), UINT64_C(0xe07a4a370f27fadd), UINT64_C(0x2d5b67560d1c1fd3) }},
+  {{ UINT64_C(0x82659086c29e8c70), UINT64_C(0x0af6091e1d9886c3), UINT64_C(0xd8fdf1db1e7f610e), UINT64_C(0xc12446dc69b7a0df) }},
+  {{ UINT64_C(0xafc1580965e763c8), UINT64_C(0x6714944ba54db1ed), UINT64_C(0x4e581c18c6e60a1e), UINT64_C(0xdef0890b95716cd0) }},
+  {{ UINT64_C(0xadb9b580dff07fe6), UINT64_C(0x1706b9e84b9fef41), UINT64_C(0xf4bc4d4c06aaed8d), UINT64_C(0x3a6b1413f37041d5) }},
+  {{ UINT64_C(0xdd46191d59f74e90), UINT64_C(0x932b512cf6e572ad), UINT64_C(0x0c11a691ddd00b86), UINT64_C(0x1ace4cc9d858add3) }},
+  {{ UINT64_C(0x71d68177635c65a8), UINT64_C(0x516d5b5c698d8f67), UINT64_C(0x8a836751c08919a6), UINT64_C(0x24976125549c8d56) }},
+  {{ UINT64_C(0x449049be646058c6), UINT64_C(0x15892e4a7a2f333f), UINT64_C(0xeb4e7171724eb864), UINT64_C(0x1b78e3327b6002d3) }},
+  {{ UINT64_C(0xe324cc732ac12444), UINT64_C(0x1c9a0131c7d50b7f), UINT64_C(0x2f58936470f8ac06), UINT64_C(0x930e0106fbe24aba) }},
+  {{ UINT64_C(0xce275eacf1b80d52), UINT64_C(0xbf1a91486381ae28), UINT64_C(0x6ab2ec3766ebc532), UINT64_C(0xff30054eb8cb6b74) }},
+  {{ UINT64_C(0x24b42d7ab4c32b9a), UINT64_C(0x52417cdc012dd739), UINT64_C(0x0d1f57567e770daa), UINT64_C(0x2bae08349130b8aa) }},
+  {{ UINT64_C(0x76e6526acab11f4e), UINT64_C(0xfa7b26d96e071551), UINT64_C(0x56a6f0a14bef099f), UINT64_C(0x5468a2bbac7179b2) }},
+  {{ UINT64_C(0x9ab19ff62dd8f488), UINT64_C(0x9ca5f4804b9892ad), UINT64_C(0xa72ed34209c1e4af), UINT64_C(0xbeb4bee93f3307ae) }},
+  {{ UINT64_C(0xb28dde73a5d84bb8), UINT64_C(0x579c2b343648c057), UINT64_C(0x57e2a27778e95df5), UINT64_C(0xab7261b513e9e4e4) }},
+  {{ UINT64_C(0xabbb67f3f1e03fd4), UINT64_C(0xca4b88238928e858), UINT64_C(0x63234378ad32e6e8), UINT64_C(0xac437c53a3d93fc5) }},
+  {{ UINT64_C(0x994f0708d8a773ae), UINT64_C(0xb065cbcc5a59a257), UINT64_C(0xc6f257c4ba2b8c9e), UINT64_C(0x3992c461eb8ed463) }},
+  {{ UINT64_C(0x70ccf84761a93958), UINT64_C(0x6df534f81ac8c672), UINT64_C(0x0fefe27642a29f05), UINT64_C(0x1ad168c787ab180e) }},
+  {{ UINT64_C(0xc5f4f0447c0ca65c), UINT64_C(0x9967a3c659793804), UINT64_C(0x9ab28b5c66d3491d), UINT64_C(0x457068e2d1158635) }},
+  {{ UINT64_C(0x3faaa9b4a2a4527a), UINT64_C(0x6d49f2a384c8ee57), UINT64_C(0x76448f3877208982), UINT64_C(0xb32ba341a8a0c0b1) }},
+  {{ UINT64_C(0x3e2d3293c206f33a), UINT64_C(0x8be763c8b2765246), UINT64_C(0xdde4e75ba15fe8f8), UINT64_C(0xa5179a6e4a984070) }},
+  {{ UINT64_C(0x43ad03baf125129e), UINT64_C(0xbe52739fd2d24100), UINT64_C(0x47d0de2e9a0a92db), UINT64_C(0xa4e0d75e156ec7cf) }},
+  {{ UINT64_C(0x3983dedde0290444), UINT64_C(0x81ce5262b7f50ded), UINT64_C(0x3513fedddbc200eb), UINT64_C(0xc33a14c10fe34379) }},
+  {{ UINT64_C(0xfc2f0ffe0cf7a41e), UINT64_C(0xa57ce6eebaa22230), UINT64_C(0x6d8a875ab1ba13a3), UINT64_C(0x44571716e5699937) }},
+  {{ UINT64_C(0xeda77f565cecc2c8), UINT64_C(0xe9a1c7b46970613d), UINT64_C(0x71f73c795909718d), UINT64_C(0x67c6ddc2eabf154c) }},
+  {{ UINT64_C(0xca2ebf4afb956d74), UINT64_C(0x4d3eb8024b6221c2), UINT64_C(0x7c0d4d8f636f9078), UINT64_C(0xa44556daa880f750) }},
+  {{ UINT64_C(0xce7b3d68f5b75c62), UINT64_C(0xf4a2365693082304), UINT64_C(0x8053e82bf88dd42d), UINT64_C(0xb6ab5a3e94211b56) }},
+  {{ UINT64_C(0x4020c289c698adfc), UINT64_C(0x17e5e39e7ae64f63), UINT64_C(0x1a40f24979520843), UINT64_C(0x440afe113d5e7e47) }},
+  {{ UINT64_C(0x7cfcc02d96aec62c), UINT64_C(0xbf22aea47d38603b), UINT64_C(0xe1eb2c482d4ef8f5), UINT64_C(0x29e72114e4785923) }},
+  {{ UINT64_C(0xe2540ef56506627e), UINT64_C(0x668638270c846aab), UINT64_C(0x0e670d8cc7962836), UINT64_C(0x08a7de73a3e16cc7) }},
+  {{ UINT64_C(0x89d3a2763da7d58a), UINT64_C(0x12480d5b35fef30c), UINT64_C(0x7fbef6751e9502c8), UINT64_C(0x1972d7e9037da0d3) }},
+  {{ UINT64_C(0xee206bceed834822), UINT64_C(0x4447d4589410ca4f), UINT64_C(0xd13f9863c4173f7e), UINT64_C(0x88eaceb8e9fddb55) }},
+  {{ UINT64_C(0x38b2ed5d2072f2b4), UINT64_C(0x0c6fee16f852e45a), UINT64_C(0xb5927cd27ca7caa1), UINT64_C(0xf60e079041dc6a32) }},
+  {{ UINT64_C(0xccd891f66b40f36a), UINT64_C(0x1426bbf3f6008250), UINT64_C(0x8617bc51d222920c), UINT64_C(0xb13f39e78ca06fca) }},
+  {{ UINT64_C(0xbdd8d82906e4383e), UINT64_C(0x53755cccb46b498d), UINT64_C(0x7b28794d0ec1e2d7), UINT64_C(0x6a7c299985311745) }},
+  {{ UINT64_C(0x0a405ca67227e81a), UINT64_C(0x2acf9c38d742092b), UINT64_C(0xacf23da8c720ac4c), UINT64_C(0x2ab9b39be61c302a) }},
+  {{ UINT64_C(0xdad48984a056b0fc), UINT64_C(0x13f689acad171f7c), UINT64_C(0x34c0c55e728a691d), UINT64_C(0x658a8f16060d87f6) }},
+  {{ UINT64_C(0xd0130352a6864c8c), UINT64_C(0x7f68de7f2c33ec5a), UINT64_C(0xe53c4eb067162103), UINT64_C(0x00a47ef407646753) }},
+  {{ UINT64_C(0x600e2c68c644d93c), UINT64_C(0x75189c8dbe307ac8), UINT64_C(0xf5bb6974184fb410), UINT64_C(0xe6a7280440f3081d) }},
+  {{ UINT64_C(0xadfef5901b02b050), UINT64_C(0x8fe10bb744b4ced6), UINT64_C(0x29b3e7e4e20abb75), UINT64_C(0xc8dfc072690b0211) }},
+  {{ UINT64_C(0x328ee90749a41ce8), UINT64_C(0x5f06647f2b34e162), UINT64_C(0x67addca81e7a24cf), UINT64_C(0x045fb0f45888907a) }},
+  {{ UINT64_C(0x1a5cdc25a63dda54), UINT64_C(0x403d208d664c0542), UINT64_C(0xd21a65810d5bc7a3), UINT64_C(0x949248033ff61da6) }},
+  {{ UINT64_C(0x18ab8b5958c83afc), UINT64_C(0x2f1c7de65c1cbce3), UINT64_C(0x5feca80be6548939), UINT64_C(0x4677e1d7e4f74fb2) }},
+  {{ UINT64_C(0x3f3c38276cfb6cfc), UINT64_C(0x3c9eb9900fb64131), UINT64_C(0x68d7080e322eb8e6), UINT64_C(0x7166383d80078313) }},
+  {{ UINT64_C(0xfb4fe14c4fbe6e0a), UINT64_C(0x1802b7fc4f342e56), UINT64_C(0xe8f34eec0d2cdae1), UINT64_C(0x6d63b7865c6f46fa) }},
+  {{ UINT64_C(0x1e1980e6c6976a1a), UINT64_C(0xdb1824471df5dbe1), UINT64_C(0x7ad20b171853e475), UINT64_C(0xabcf322ae43a87a8) }},
+  {{ UINT64_C(0x2c5c9d6bb191a24a), UINT64_C(0x9ccce7c5eff799ec), UINT64_C(0xe7f182a3abc1564c), UINT64_C(0x366bd676106c144e) }},
+  {{ UINT64_C(0x99772119e4dbf710), UINT64_C(0x41a37ccf98b8b8b5), UINT64_C(0xa87eec0944ee40ae), UINT64_C(0xdaea2ee0e990441c) }},
+  {{ UINT64_C(0x364bd47cae1453b8), UINT64_C(0x54d67e056e8c0561), UINT64_C(0xefcf818f81e31df8), UINT64_C(0x365e88f251c35fec) }},
+  {{ UINT64_C(0xd7edff0da5906fc2), UINT64_C(0x20282ab21cc3cdc2), UINT64_C(0x2c4c64581e37ed9c), UINT64_C(0x4e494a36a5596830) }},
+  {{ UINT64_C(0xddbc028e3deb0cee), UINT64_C(0x12c7ff0fd4aea247), UINT64_C(0xe0ce008e5faa0f81), UINT64_C(0x76a7cb45027917ac) }},
+  {{ UINT64_C(0xc88d9b0c8d69849e), UINT64_C(0xe3a1e9eb29856106), UINT64_C(0x6b6ed028e1d7332e), UINT64_C(0x305dcd681261a7dc) }},
+  {{ UINT64_C(0x381f1aec17a8ce5a), UINT64_C(0x459de8329abe90db), UINT64_C(0x22b4896846d9ab67), UINT64_C(0xe74fa6ea104c6800) }},
+  {{ UINT64_C(0xda3bab03da65215e), UINT64_C(0x93a56ecd102cfe63), UINT64_C(0x84b49b8f5e66af3c), UINT64_C(0x2d9a829048ecfdb2) }},
+  {{ UINT64_C(0x6eb434acda3d275e), UINT64_C(0x85aede19816095ba), UINT64_C(0x85503af11fd71001), UINT64_C(0x4f9506a4c3e9b644) }},
+  {{ UINT64_C(0xd6d58ab38ca06128), UINT64_C(0x460808b4697eaf09), UINT64_C(0xbeff7f5241d9682f), UINT64_C(0x4671e49470e41757) }},
+  {{ UINT64_C(0x5aeb31b99dc179e0), UINT64_C(0x9ca73f8ea75cad93), UINT64_C(0x68d47b3834be626d), UINT64_C(0x96c7fb79518adae7) }},
+  {{ UINT64_C(0x9f1bb2411443f202), UINT64_C(0x90fd3de366059390), UINT64_C(0xc89dc9fc323e8ec3), UINT64_C(0x119779f95bd278bc) }},
+  {{ UINT64_C(0xf2e6595ff6d4bcc0), UINT64_C(0x328107ee1a24ceca), UINT64_C(0x17ae567ee2e4af9a), UINT64_C(0xb21f05b2d0d5d1a9) }},
+  {{ UINT64_C(0x351cc065cbc7f04c), UINT64_C(0xb81fed2e3cc9b476), UINT64_C(0x856852d64b0a7fb3), UINT64_C(0x2b4d29a3f210bca8) }},
+  {{ UINT64_C(0x18141aa2170b7b9a), UINT64_C(0x1ba23cfb3a2212ea), UINT64_C(0x2cf208a8dd26875d), UINT64_C(0xb037e67f680b802c) }},
+  {{ UINT64_C(0x3ab650a5ed843ac8), UINT64_C(0x681e26f5ab14bc36), UINT64_C(0x3994966bee2fbe2a), UINT64_C(0xc912a434e5e44f3a) }},
+  {{ UINT64_C(0x703ed12cdd56ca6a), UINT64_C(0xafba568165be05f2), UINT64_C(0x557b0a79b4069a5f), UINT64_C(0x7d4600e7fb1bdcd0) }},
+  {{ UINT64_C(0x702029e82a3ee626), UINT64_C(0xf1cae911767b7613), UINT64_C(0xe114a7860db98f0d), UINT64_C(0x7c46da783dfa2143) }},
+  {{ UINT64_C(0x35e945aa743cf7c6), UINT64_C(0x00eb85e1a9993394), UINT64_C(0xd53a4034434d8b7c), UINT64_C(0xb6666694ad0f5782) }},
+  {{ UINT64_C(0xa90518693aaef88c), UINT64_C(0x5bef9716b28b9a6c), UINT64_C(0xb14375eaa6fec4ac), UINT64_C(0x034bad453ac0e520) }},
+  {{ UINT64_C(0x1eae0a3efa6cd92a), UINT64_C(0x005f2a654da5aefd), UINT64_C(0x87d370fcacc80e1a), UINT64_C(0x35ae5cbbd831ef89) }},
+  {{ UINT64_C(0xf93987ce44cb688a), UINT64_C(0x55ab7a7429c353a7), UINT64_C(0x5f4c444f95cc7a05), UINT64_C(0x6c826cfcf3a60fc9) }},
+  {{ UINT64_C(0x4acb2bb2e50301a2), UINT64_C(0xcb6cddb8c4d1468c), UINT64_C(0x80d4d9d7fdf0831e), UINT64_C(0xcd71eb9206668b7f) }},
+  {{ UINT64_C(0xeeb718dd26baa882), UINT64_C(0x40502feb82d0619a), UINT64_C(0xa8791d9f1f52ee37), UINT64_C(0xc0394b57a25c6e82) }},
+  {{ UINT64_C(0x5a7ab56ac9482b66), UINT64_C(0x000e738c8903d830), UINT64_C(0xad5187d5fa232b11), UINT64_C(0xf8123c5230ee8963) }},
+  {{ UINT64_C(0x295ed1621a83f0aa), UINT64_C(0x2925d5ecb332ee40), UINT64_C(0x56c6c751fb8c788c), UINT64_C(0x41bbbd741f557c3a) }},
+  {{ UINT64_C(0xb54ab1b71fe4e050), UINT64_C(0x3d0c7c366793dfc6), UINT64_C(0x89da979c75b399ef), UINT64_C(0x0ce883e8eafe1e90) }},
+  {{ UINT64_C(0x84cdc2af7883d414), UINT64_C(0x148174e880adf6cf), UINT64_C(0x90f84cdce8c6bf05), UINT64_C(0x5b93c3fe8a07d59c) }},
+  {{ UINT64_C(0xf80997ae4e00b95e), UINT64_C(0x8d62ae4113bab1e4), UINT64_C(0x8d781b2a529c931a), UINT64_C(0x2477f06cac36f22b) }},
+  {{ UINT64_C(0x761e8eb6c7468062), UINT64_C(0xacd02835ed99b828), UINT64_C(0xb9b733d87580298b), UINT64_C(0x0cc7b6328a8183a4) }},
+  {{ UINT64_C(0xd9a450be129b48ee), UINT64_C(0x2df600b84c4aa824), UINT64_C(0xe1ef59bafe9d5491), UINT64_C(0xde59f296afbd788d) }},
+  {{ UINT64_C(0x574e60d2afec2d4e), UINT64_C(0xcf53bc058d528f8c), UINT64_C(0x35105c4783e0b71b), UINT64_C(0x813773d6a1116e98) }},
+  {{ UINT64_C(0xa54708276ce4d66a), UINT64_C(0xe0bae00d8d2a0ab6), UINT64_C(0xf362ad6c92fa3059), UINT64_C(0x9736598db43151f6) }},
+  {{ UINT64_C(0x7b1ba87cf86a9e1a), UINT64_C(0x0baf07c7c0222996), UINT64_C(0xdf664b75eec6e296), UINT64_C(0xdc04297b7bdb73f2) }},
+  {{ UINT64_C(0xb3502e3cb2bc78b6), UINT64_C(0x7092e0abf7c9b8c0), UINT64_C(0x33f0af6704f3b277), UINT64_C(0x0897967ce9fac47a) }},
+  {{ UINT64_C(0xd47ed60b5438b6c4), UINT64_C(0x834a37d49b7e9d67), UINT64_C(0x3151c1c74e2a3c65), UINT64_C(0x1cbe36c5468ff71f) }},
+  {{ UINT64_C(0xfbde0de5093e0316), UINT64_C(0x5c2ead7b714e6703), UINT64_C(0x70f473d92e1f5fe4), UINT64_C(0xc49139d55822e89b) }},
+  {{ UINT64_C(0xc8c2264f47546184), UINT64_C(0xb815a625cdfb1d70), UINT64_C(0x4b9b7dd2d056974a), UINT64_C(0x98c2496290bb2226) }},
+  {{ UINT64_C(0x5db5d3ab78c7c160), UINT64_C(0xa23e72f0aada148e), UINT64_C(0x5a59299340ffbbfb), UINT64_C(0x8e448d2331f620db) }},
+  {{ UINT64_C(0xb8051b0ccf1f2e1a), UINT64_C(0x467cf3f090380660), UINT64_C(0x60d622c2c1247ec7), UINT64_C(0xb8fa9eed2cd383f9) }},
+  {{ UINT64_C(0x48d60987ab26fab8), UINT64_C(0x7388c81335e703bb), UINT64_C(0x02e171ca920d0700), UINT64_C(0xbaabf13a52301e0d) }},
+  {{ UINT64_C(0x7b73c5c06c3c81e4), UINT64_C(0x35ad03c9efc6f824), UINT64_C(0x7186bccca4ddcf98), UINT64_C(0xad114e486f432b11) }},
+  {{ UINT64_C(0xeb64713234d75334), UINT64_C(0xadf11bb7dab908fd), UINT64_C(0x7aed69da5318d317), UINT64_C(0xf5e1703419656890) }},
+  {{ UINT64_C(0x3e6e94268f31ec48), UINT64_C(0xa0c5b916761bd810), UINT64_C(0x1bd99a1ee80a8cb7), UINT64_C(0x3de9364cbefa10e3) }},
+  {{ UINT64_C(0x9d62c1d492abd2f0), UINT64_C(0x78e9b0381caed8fd), UINT64_C(0xc7b9b7fb6c02b3eb), UINT64_C(0x83904cb6d5ebe3c6) }},
+  {{ UINT64_C(0xd2719c09fd0611f0), UINT64_C(0x09e38f662e371681), UINT64_C(0x6dd8609b4a2a1e3e), UINT64_C(0x682c67256cd117fb) }},
+  {{ UINT64_C(0x404c3bef27c62de6), UINT64_C(0xb649858a4a9c20ad), UINT64_C(0xb1dc01053dca64d0), UINT64_C(0x71de88b27c3e4acd) }},
+  {{ UINT64_C(0xa18e076d0ae66544), UINT64_C(0xc1891bd035008e47), UINT64_C(0x0868e98a931810af), UINT64_C(0x877698ea604890d8) }},
+  {{ UINT64_C(0x0934133b06c5b968), UINT64_C(0xfd575f5d265abade), UINT64_C(0x8884c70422549989), UINT64_C(0x6babdf4f83320bd3) }},
+  {{ UINT64_C(0x964c61a76c07d93a), UINT64_C(0x200a5aa60eb933be), UINT64_C(0xd94d430c1fe48c20), UINT64_C(0x7881579c9605c357) }},
+  {{ UINT64_C(0xf00cc89deae6c0d8), UINT64_C(0xad11f4d56503a41d), UINT64_C(0x2e761da7edf3e3aa), UINT64_C(0x0b338d8b3bce749a) }},
+  {{ UINT64_C(0x334d13ad0feca4d0), UINT64_C(0x186db002b420f957), UINT64_C(0xcae24b13156f4201), UINT64_C(0x63f390641599f68b) }},
+  {{ UINT64_C(0x9201b3049274c0d4), UINT64_C(0xdc3bf97f9afd4c81), UINT64_C(0x0665e2a28e263c97), UINT64_C(0xc544879d77c09732) }},
+  {{ UINT64_C(0x8d5acee01c8eb1e4), UINT64_C(0x95f9b71a249d3f72), UINT64_C(0x48f9c99363af1d45), UINT64_C(0x06fa62317ad0b089) }},
+  {{ UINT64_C(0xbb1a06856113c9dc), UINT64_C(0x86556faa3ae44297), UINT64_C(0xe841ecf180b25e25), UINT64_C(0xd4da2219adda3c40) }},
+  {{ UINT64_C(0x8bae53b086461bfa), UINT64_C(0x4d39784953478324), UINT64_C(0x7a673ac7d658e95c), UINT64_C(0xb2681ab960494b4d) }},
+  {{ UINT64_C(0xd5484b9885a8ef3e), UINT64_C(0xb9273bd692d19e89), UINT64_C(0x9a882e03ec129b70), UINT64_C(0x6959e4098e998d00) }},
+  {{ UINT64_C(0xd02fd8d8e3b02c4a), UINT64_C(0xc3ad91cd1826e72e), UINT64_C(0x43b19789ea74b4ef), UINT64_C(0xd2539f60e3b2253e) }},
+  {{ UINT64_C(0xb59396c003f1d942), UINT64_C(0xbe4b679651a8e1dc), UINT64_C(0xdcbd58752e33a92a), UINT64_C(0xbd3d65881e124d57) }},
+  {{ UINT64_C(0x5c77761cfdff5ece), UINT64_C(0x9915828c3de48fc1), UINT64_C(0x04e78d5c5bbf1213), UINT64_C(0xb32ce926fb4f076e) }},
+  {{ UINT64_C(0x3f3a7681d5114270), UINT64_C(0x6cad55a446b0ae35), UINT64_C(0x9fd53aa9ed5d350f), UINT64_C(0x5d391d0d7d4aa25d) }},
+  {{ UINT64_C(0x8324f82810aa4f3e), UINT64_C(0xb0d9e3ee65be4bf4), UINT64_C(0x6f6083c81a929081), UINT64_C(0xdb0e964eaa234537) }},
+  {{ UINT64_C(0x6cebd0d75ceec61c), UINT64_C(0x27bd7e522c6079f4), UINT64_C(0x1485753e53c492cc), UINT64_C(0x3eafa85541e62f80) }},
+  {{ UINT64_C(0xc3e322fb146613b2), UINT64_C(0xa8752d5a9dbb36f9), UINT64_C(0x0f3c50cb106aacb7), UINT64_C(0x39376392ca96f921) }},
+  {{ UINT64_C(0xc26916e79c7e56a2), UINT64_C(0x585ca47214dd1b3c), UINT64_C(0x01ddef81e1006094), UINT64_C(0xb81f6efe9ab7354b) }},
+  {{ UINT64_C(0x68d1337bb7ccec92), UINT64_C(0x12c1ed4f43f2ca64), UINT64_C(0xa8a39e05de68127d), UINT64_C(0x6b2b6ad6ed5ea096) }},
+  {{ UINT64_C(0x391764099a1eb180), UINT64_C(0x0f608202565699c2), UINT64_C(0x8e1e795ccd80ce15), UINT64_C(0x4fe2f18860deda0e) }},
+  {{ UINT64_C(0x5c5b18a1bd9cb6ea), UINT64_C(0x696be393ee6f72f3), UINT64_C(0x12096ccd2991bcf4), UINT64_C(0x5ee4239ae5c1a678) }},
+  {{ UINT64_C(0x39bad09cdbf17526), UINT64_C(0x409011618b63d551), UINT64_C(0x71fb564691f29407), UINT64_C(0x7cd569fd9ce30f8c) }},
+  {{ UINT64_C(0x98ef35449f80f802), UINT64_C(0x537e0c8c2b9b23f2), UINT64_C(0xa2794ddce7fa219e), UINT64_C(0x62c06570725748ea) }},
+  {{ UINT64_C(0x91e1f492a697a834), UINT64_C(0x7a1a2d28d5051fa1), UINT64_C(0x82401f9e314b6717), UINT64_C(0x5868d9caa11e0136) }},
+  {{ UINT64_C(0xcb9ed77191286506), UINT64_C(0x3e5a664b67f116e5), UINT64_C(0x3e66eb46c5fef8ef), UINT64_C(0x17d265165d61bd77) }},
+  {{ UINT64_C(0x1db920a19461cb16), UINT64_C(0x27d3324539d82709), UINT64_C(0x6c174e72c649246b), UINT64_C(0xa840de6c094fa3fc) }},
+  {{ UINT64_C(0xe5268f9b3dfbf2e0), UINT64_C(0x672c0eb7fecd7c8f), UINT64_C(0x32fd10a229b0cc44), UINT64_C(0xc0b8d0c829b72742) }},
+  {{ UINT64_C(0x1b4bc3413e4333fc), UINT64_C(0x5373b1bdd23ee012), UINT64_C(0xbaeba60302b831fc), UINT64_C(0x948183560580bb3f) }},
+  {{ UINT64_C(0x825c51cd3b743c88), UINT64_C(0x8a2ea4e9d3b1cc40), UINT64_C(0x394ca4e1c040078f), UINT64_C(0x636ff2df4ddaf416) }},
+  {{ UINT64_C(0x6cbaf2ef200633e6), UINT64_C(0xc0e98dd8dab77f31), UINT64_C(0xa2d8b0718054b391), UINT64_C(0xdade04a01813860e) }},
+  {{ UINT64_C(0xda1073c42ee56df4), UINT64_C(0xadcf1183cab8b130), UINT64_C(0x44b97f97b9437fed), UINT64_C(0xb4024c488b5b4381) }},
+  {{ UINT64_C(0x41c8092006d43354), UINT64_C(0xed35321fbe188c05), UINT64_C(0x79d8188aba32af3d), UINT64_C(0xf33061783227697f) }},
+  {{ UINT64_C(0xe48c3ce93f60cfb2), UINT64_C(0x7d360788837bcbc9), UINT64_C(0x04b2b50b647f4dc5), UINT64_C(0xfc9415812058f921) }},
+  {{ UINT64_C(0x1a50114981812018), UINT64_C(0xc59c978a92542654), UINT64_C(0x617dcd0bc934c694), UINT64_C(0xda2c509cd8ce9b02) }},
+  {{ UINT64_C(0xe430311e4407304e), UINT64_C(0x67077aad6d5724bb), UINT64_C(0x0f978be60e610d4c), UINT64_C(0xf6ea5db56e9adc55) }},
+  {{ UINT64_C(0xdfae0aae5c5a233a), UINT64_C(0x5b90b344fc1626a2), UINT64_C(0xe604af2e7d055346), UINT64_C(0xf57802c9313efd20) }},
+  {{ UINT64_C(0x6541324ccd683962), UINT64_C(0x905383874b20a7dc), UINT64_C(0xf51a25acd8ec498d), UINT64_C(0x2e9e4b803a44563c) }},
+  {{ UINT64_C(0x287dccf1ebf3de68), UINT64_C(0xfd7a928c5b1c1a2b), UINT64_C(0x814357e15d4b0fb0), UINT64_C(0x1a9c6803bd3ff77f) }},
+  {{ UINT64_C(0x122d49965656db94), UINT64_C(0x874c78c4623d1bd7), UINT64_C(0xf30cced0573aeb3c), UINT64_C(0xff0e2562244f05b8) }},
+  {{ UINT64_C(0x9d065bfe4767d834), UINT64_C(0x0d70f7e141d0d5ea), UINT64_C(0x507263c39c1c3ece), UINT64_C(0x071dacbc31c54ff7) }},
+  {{ UINT64_C(0x011d202090fde400), UINT64_C(0x8dd5f3eb751bba77), UINT64_C(0x6e2403f6d67afe24), UINT64_C(0x2f1bf536ece5859a) }},
+  {{ UINT64_C(0xc9c666604a4b67b4), UINT64_C(0xe0d0c26b4a1ac70b), UINT64_C(0x3a5adf5b76d007d4), UINT64_C(0xca334fd44590f64e) }},
+  {{ UINT64_C(0x55f3c66ee0384ebe), UINT64_C(0x77cb5b12e24c1a16), UINT64_C(0xe78d10c56ee4edd6), UINT64_C(0x9726101382be3cf0) }},
+  {{ UINT64_C(0x47ce2585690b536a), UINT64_C(0x1a3f395c48e5a63a), UINT64_C(0xa49dfc77221d1428), UINT64_C(0xdcd634ff6aa4750a) }},
+  {{ UINT64_C(0xcd179dd3545f8896), UINT64_C(0xc38148b0471391d2), UINT64_C(0xcbfe75c2a868e229), UINT64_C(0x4ffe9f34764d07c3) }},
+  {{ UINT64_C(0x73b1fc044197b1b2), UINT64_C(0xc5378d8d7663c9f5), UINT64_C(0xe135fa1e82dd77bb), UINT64_C(0x224d809ef310ee6c) }},
+  {{ UINT64_C(0xb4346e8bf930e7a6), UINT64_C(0x8fbde6672d8caa74), UINT64_C(0xbfd29ab0412cda5c), UINT64_C(0x294bdc8fad8b50fa) }},
+  {{ UINT64_C(0x5628f81f594b15b8), UINT64_C(0xb729a8cae103434c), UINT64_C(0xe42c43f448102261), UINT64_C(0xce0bd442c3d6fb72) }},
+  {{ UINT64_C(0xe2d845c81071b120), UINT64_C(0x14db532a9c2f5ef8), UINT64_C(0x90eddc11ce09bab5), UINT64_C(0x61c71fe8599ee069) }},
+  {{ UINT64_C(0xeb90e8af5b848eba), UINT64_C(0xc1b0e884abaf4069), UINT64_C(0x901d78d6858f62da), UINT64_C(0x9c5196d350d09232) }},
+  {{ UINT64_C(0x28ff1b9d7b9aa458), UINT64_C(0x650e87681a6e6a4b), UINT64_C(0xf3956abddced1081), UINT64_C(0x158f5bdbb9f554a0) }},
+  {{ UINT64_C(0x9b41e122af30b3b0), UINT64_C(0xea52c97c30f3bca9), UINT64_C(0x95c8c5d7f66f5008), UINT64_C(0xb99a2b57ea4da29a) }},
+  {{ UINT64_C(0x7a03f94f475c733a), UINT64_C(0x85270e45559c3113), UINT64_C(0xf00b5d0510f394db), UINT64_C(0x2d31b3b71a998f69) }},
+  {{ UINT64_C(0x499c7fa0d6c9f0cc), UINT64_C(0xe8f6e364c7dfd4e1), UINT64_C(0x6d8405e1f7991c27), UINT64_C(0x5c53b641626d51ff) }},
+  {{ UINT64_C(0x60c6c040843d0e78), UINT64_C(0xdd0ecf1c09041666), UINT64_C(0xfe7c1628df2bb3f3), UINT64_C(0xed36f819acecb0a5) }},
+  {{ UINT64_C(0x97b58830b5e24b1c), UINT64_C(0x32b50b9a47a8540a), UINT64_C(0x76b44de566fefbfe), UINT64_C(0xcdcb4f0bb7f1e160) }},
+  {{ UINT64_C(0xb5f22101ac0b9626), UINT64_C(0xe971bca341bd7ae7), UINT64_C(0x14e056258c49dcca), UINT64_C(0x68c8127c98f7248f) }},
+  {{ UINT64_C(0xa59b2830a827b422), UINT64_C(0x47a838ddde41f967), UINT64_C(0x4b61ed40cc7a426e), UINT64_C(0x814e571d1ceb1e6f) }},
+  {{ UINT64_C(0x906bf036535fd392), UINT64_C(0x964227b66c939542), UINT64_C(0x13db48b5553f6e97), UINT64_C(0xe8006aa849aecc1e) }},
+  {{ UINT64_C(0xd528efadaa7d081e), UINT64_C(0xf3a65c332c2ecdae), UINT64_C(0x4792254ccd332907), UINT64_C(0xe23496f656d08179) }},
+  {{ UINT64_C(0x449914b9f42d6a78), UINT64_C(0x162606739ca1aea8), UINT64_C(0x081d0a1a43376398), UINT64_C(0x1db9e252ceaabb93) }},
+  {{ UINT64_C(0xa8b112a28e00c65e), UINT64_C(0xfef3fb8afbeac23c), UINT64_C(0x061c735e28738bf1), UINT64_C(0xc7a9e38f9d62a3c5) }},
+  {{ UINT64_C(0xa1115c57ccce4f22), UINT64_C(0xb5aa6445ae652579), UINT64_C(0x63299a450c8f3ea4), UINT64_C(0xb3f7c76e605f9c15) }},
+  {{ UINT64_C(0x111b9a1c17d8d34c), UINT64_C(0x3e942a26f3d40134), UINT64_C(0x0d65fce90ebe043c), UINT64_C(0x4496201941531f88) }},
+  {{ UINT64_C(0x7416919654c90df0), UINT64_C(0xdec28113fb86f17a), UINT64_C(0x8a537a1c87320673), UINT64_C(0x229e7a12d2c7820b) }},
+  {{ UINT64_C(0x106a88c8d781a7c4), UINT64_C(0xdf2e505ac73c27ab), UINT64_C(0x251094362b32c564), UINT64_C(0xfb7ca1f908014c97) }},
+  {{ UINT64_C(0x99f197d752d4485c), UINT64_C(0x5bb40793dd4ca921), UINT64_C(0x9b8c7ddde92a3e96), UINT64_C(0x1dffe6326dd3b5b1) }},
+  {{ UINT64_C(0xa6ae153800a11cf8), UINT64_C(0x0e3a7a5720e86088), UINT64_C(0xc93d293d6e9d29f7), UINT64_C(0x06e58b0ab7cce7ef) }},
+  {{ UINT64_C(0x7c3bba5cdf9ebc0a), UINT64_C(0x6f6dbc1f5f6bd6c6), UINT64_C(0x7618aa2fcfd6af9f), UINT64_C(0xc282705a7acf76a6) }},
+  {{ UINT64_C(0x43d1992e86f81996), UINT64_C(0xbf0f554a450de714), UINT64_C(0x3bdb19ed40218808), UINT64_C(0xe1f5861b43d69eae) }},
+  {{ UINT64_C(0xf69b183b4f2e75f4), UINT64_C(0x7811a307eb916ef1), UINT64_C(0x6d56d4f5ace6c34a), UINT64_C(0x90bf815cfc8e8e73) }},
+  {{ UINT64_C(0xc5913d3dbf54a974), UINT64_C(0x5b45a021e14ef992), UINT64_C(0x72401d662762f9e3), UINT64_C(0x4121f2ac061d2b9c) }},
+  {{ UINT64_C(0xfc8b4838c9d50646), UINT64_C(0x1fc88cc9f26454c8), UINT64_C(0xbc929b0762a1cc4d), UINT64_C(0x97b26f2d098b0460) }},
+  {{ UINT64_C(0x6bbaa4990f316042), UINT64_C(0x7da076f08c405b3a), UINT64_C(0x5df901e071117c42), UINT64_C(0x1d206565adf821ba) }},
+  {{ UINT64_C(0xf3d347bce651c0f2), UINT64_C(0x76ea6cb393e8433e), UINT64_C(0x3923b4708e8cd523), UINT64_C(0x8b708e607036cc7c) }},
+  {{ UINT64_C(0xb33afc947756c9c0), UINT64_C(0x2878033693084c5a), UINT64_C(0x2a79b70016d1f3b3), UINT64_C(0xce029d4df4786667) }},
+  {{ UINT64_C(0x3b87b0beb67483f8), UINT64_C(0x2f79512bc9e9f1d3), UINT64_C(0x6d84e250fbd7f2ec), UINT64_C(0x5f410560ed5c045d) }},
+  {{ UINT64_C(0xa4dff8602d64bc86), UINT64_C(0x416c4016ba8b8736), UINT64_C(0xbc6d93b796de1b97), UINT64_C(0x75dd86cddd31dfc8) }},
+  {{ UINT64_C(0x125a41ba047866bc), UINT64_C(0xbde146cbe4ea039c), UINT64_C(0x8345f5af4cc7da4b), UINT64_C(0x2febcad55fcc92e9) }},
+  {{ UINT64_C(0xb09ee08dca4d0b38), UINT64_C(0x153b26deafaa7a3e), UINT64_C(0x553a6d87b1fbbb9c), UINT64_C(0x76166eb978235140) }},
+  {{ UINT64_C(0xee43b76e3c23cdf6), UINT64_C(0x5b3a22a52f73cbc2), UINT64_C(0xe8df74416d6be52e), UINT64_C(0x6b9c2b16a9db6ef9) }},
+  {{ UINT64_C(0xfa1256be60aafe44), UINT64_C(0xf074e8f06e92b48d), UINT64_C(0xf5bbd94b5cec0638), UINT64_C(0x09fcf557a4b10151) }},
+  {{ UINT64_C(0x38d98d5fdf2d2178), UINT64_C(0x2793d1f637070523), UINT64_C(0xf642fe9a3529f471), UINT64_C(0x9af30c452d6b09bb) }},
+  {{ UINT64_C(0xefa6b75efe099094), UINT64_C(0x9acb0c6725cb2d03), UINT64_C(0xe3c50c2bb7701e93), UINT64_C(0x25b93f2781ef7332) }},
+  {{ UINT64_C(0xe61b75c735890956), UINT64_C(0x2c3614c8a4a066cf), UINT64_C(0x92ea3bea7f2c2ded), UINT64_C(0x162a3622ea79f778) }},
+  {{ UINT64_C(0xdebadfc367dc4736), UINT64_C(0x5f5fa5df6aff492b), UINT64_C(0xa46faf5a2ceec409), UINT64_C(0x9f60e1df14863fbd) }},
+  {{ UINT64_C(0xa786cc34f27f93b2), UINT64_C(0x3bf026e4cbf11def), UINT64_C(0xd0d08e0502768d2d), UINT64_C(0xf578b8d6931bb480) }},
+  {{ UINT64_C(0x508df9a0087b5286), UINT64_C(0xfa2f85125c276f97), UINT64_C(0x7c11b4d929d78c3c), UINT64_C(0xd14375871ad0ec8d) }},
+  {{ UINT64_C(0x8c550c36a5743832), UINT64_C(0x1901a709ebc03696), UINT64_C(0x484aa29f77a7f140), UINT64_C(0x201a651e07e187d1) }},
+  {{ UINT64_C(0x207071ad7bbb059e), UINT64_C(0xab28e4030a2b1cd7), UINT64_C(0x6c09d3bc04c09cfa), UINT64_C(0x7927689da73daed7) }},
+  {{ UINT64_C(0x45f52fafe28ff3ac), UINT64_C(0x7c959c7b02949f82), UINT64_C(0xe4ecf0b344005082), UINT64_C(0xf02984860e199445) }},
+  {{ UINT64_C(0x0c42557c0a1bf0d4), UINT64_C(0x7742ae13df41fde1), UINT64_C(0xcb03d4a3e93bce48), UINT64_C(0x42ba739c40b42ec9) }},
+  {{ UINT64_C(0xc4f457bae9bcb3ac), UINT64_C(0x939bc2308786bede), UINT64_C(0xa3d964ca53cd6fa4), UINT64_C(0x60f45e92ae624498) }},
+  {{ UINT64_C(0x220f576492ee5420), UINT64_C(0x48559916d59a5d94), UINT64_C(0xaf8c97bd5a410e54), UINT64_C(0x3f0e92696cebb2b1) }},
+  {{ UINT64_C(0x578ea2e57c18895c), UINT64_C(0x6fa302be35e0220b), UINT64_C(0x483c1179321968e3), UINT64_C(0x35ba22628a7739a7) }},
+  {{ UINT64_C(0xe1d541feefa2ea48), UINT64_C(0xfebe87fa39315ba9), UINT64_C(0x54c3d4ec275229e6), UINT64_C(0xaaed87a76b3e6578) }},
+  {{ UINT64_C(0x42f709905e96750a), UINT64_C(0x098e4664cf1c4677), UINT64_C(0x7dc8197071a50c95), UINT64_C(0xe4a527a27ef45a00) }},
+  {{ UINT64_C(0x7ec09fa68744a688), UINT64_C(0x17811b8b79184ed4), UINT64_C(0x9d1f512a0f4e7e83), UINT64_C(0x152889b30bdd00e2) }},
+  {{ UINT64_C(0x904c977d4646e2c6), UINT64_C(0xe9f7367f5af875a3), UINT64_C(0xf9a497ef617bf2d2), UINT64_C(0xf423324672e43e92) }},
+  {{ UINT64_C(0x0c1b66b824f65c92), UINT64_C(0x3fda70b0e3734bc3), UINT64_C(0x661351436cc8eb95), UINT64_C(0x5904d79ebc93c3d2) }},
+  {{ UINT64_C(0x62648c2422c87d90), UINT64_C(0xead5e442105962a1), UINT64_C(0x48d434044022af6f), UINT64_C(0x9b39cf23f0b83e3d) }},
+  {{ UINT64_C(0xb198d292b80c7a00), UINT64_C(0xa88b9173679cedb4), UINT64_C(0xa677115c2c7d0770), UINT64_C(0x57bbed0113373aae) }},
+  {{ UINT64_C(0xc892f8120aee281c), UINT64_C(0x07e650114f761325), UINT64_C(0xd90dcc2c5cbe9f8b), UINT64_C(0xd14daf5217ee1191) }},
+  {{ UINT64_C(0xa280abe4fc62d6ba), UINT64_C(0x28ecf01bf311a4ac), UINT64_C(0x40d96b2b64ed1f72), UINT64_C(0xbfce52f08d6c2c7c) }},
+  {{ UINT64_C(0xd72fbbba6123095a), UINT64_C(0x67271138030ccbca), UINT64_C(0xde7de0bd21547ec2), UINT64_C(0x4122626b94c0240a) }},
+  {{ UINT64_C(0x384cdbeeac5019c2), UINT64_C(0x597818aff6d362d4), UINT64_C(0xccf41c66f56e8f64), UINT64_C(0x10e42ca425a0dc88) }},
+  {{ UINT64_C(0xd78b1f1ed28a728a), UINT64_C(0xaefae03f1ded6488), UINT64_C(0xe346c528f9d11057), UINT64_C(0xb99eba813ad9b9b9) }},
+  {{ UINT64_C(0xaff81e60f25def18), UINT64_C(0x65c575cd6cb20f0a), UINT64_C(0x69995a3eb8160826), UINT64_C(0xab8b6355d333280d) }},
+  {{ UINT64_C(0xb6b54e5eaf37c714), UINT64_C(0xeb02c43d5d0b8868), UINT64_C(0xeece82011f70a226), UINT64_C(0xd858498d3154ab7d) }},
+  {{ UINT64_C(0xdd9b733af0fa9614), UINT64_C(0x4e0dab048a9e019b), UINT64_C(0xcc1d251b1fc05c9f), UINT64_C(0xbc370d88753ceb13) }},
+  {{ UINT64_C(0xc98b1127e154e176), UINT64_C(0x172e38bae233dc28), UINT64_C(0x9434311389789247), UINT64_C(0xebdfaf32f09d818f) }},
+  {{ UINT64_C(0x6df119d4a9a9b970), UINT64_C(0xb8c2aaf7557482b9), UINT64_C(0x8fdf07302dc72891), UINT64_C(0x1ec8beccd61792e9) }},
+  {{ UINT64_C(0xb5e841838d22be38), UINT64_C(0xad6820ba797e2b25), UINT64_C(0x86b4e823384ef94d), UINT64_C(0xdee13987eb3c11d7) }},
+  {{ UINT64_C(0x4203bbe68a4cc080), UINT64_C(0x8cad7152a1886018), UINT64_C(0x96037928fe8ae248), UINT64_C(0xf78af744f3656393) }},
+  {{ UINT64_C(0xa065b509dea429a8), UINT64_C(0x8f9c5d1995c79740), UINT64_C(0xa6799fe5bd3d8dd5), UINT64_C(0xc1dab6e58401f9ff) }},
+  {{ UINT64_C(0x3dfa790c4f39a5f4), UINT64_C(0x421ee487a6b58f4b), UINT64_C(0x428280a0b40025cf), UINT64_C(0x522de8dabaa80bc9) }},
+  {{ UINT64_C(0x56c09ce2a6ef4892), UINT64_C(0xaa56c26734a76c8e), UINT64_C(0x5680dec9b4e3b4eb), UINT64_C(0x0f10c51bcda1fe03) }},
+  {{ UINT64_C(0x48fe887891f9ccc0), UINT64_C(0x9eb3a3b6cdc5e1fc), UINT64_C(0xff692e4b3751379a), UINT64_C(0x979561cc18859564) }},
+  {{ UINT64_C(0x4b735237f0514a20), UINT64_C(0x65f4146ed332f369), UINT64_C(0x0966ea8be68d4302), UINT64_C(0x76d8380399d16c93) }},
+  {{ UINT64_C(0x93fc505a79fbbac8), UINT64_C(0x21ee317454b264ed), UINT64_C(0x6039665c68747073), UINT64_C(0xd2a7f4aa9220a487) }},
+  {{ UINT64_C(0x0eb27e506a0be07e), UINT64_C(0x5234f6559e96ca16), UINT64_C(0xb31cb1aa898ef605), UINT64_C(0xdbaa374201dd7419) }},
+  {{ UINT64_C(0xabf06ca3cd0fbe52), UINT64_C(0x130aa8205036df32), UINT64_C(0xff7551fd90a38516), UINT64_C(0xd8127e778a0add73) }},
+  {{ UINT64_C(0x69bf7865dc67d456), UINT64_C(0xa933990de4bba9fb), UINT64_C(0x61388194032e71cc), UINT64_C(0x3d7da1b4e14c9249) }},
+  {{ UINT64_C(0x80752306f2ef1f48), UINT64_C(0xe0dca0133aeb1b48), UINT64_C(0x8c3ca638d7b80c4f), UINT64_C(0xd0f301de96300067) }},
+  {{ UINT64_C(0x9dc982bbc9dbe814), UINT64_C(0xfce6d8fd87a5dabb), UINT64_C(0x86cdba4762500baf), UINT64_C(0x46d5e5474d129418) }},
+  {{ UINT64_C(0x9218ffcd54dde26a), UINT64_C(0xd6c610d747a68ed5), UINT64_C(0xd429222baf2204de), UINT64_C(0xba53a0159f9b38a8) }},
+  {{ UINT64_C(0x4b9f7064fd6b6b36), UINT64_C(0xf16b6a35d71082ee), UINT64_C(0xa14c3a249eb42930), UINT64_C(0x568eb395e8b0d14d) }},
+  {{ UINT64_C(0x3b5f2bd88af7b4a2), UINT64_C(0xf32c998ac015d7a3), UINT64_C(0x2ecdeff621e2f2d3), UINT64_C(0x0b33f93df75d6ce8) }},
+  {{ UINT64_C(0xfef899ed8666a5d0), UINT64_C(0xeed4bd1772302622), UINT64_C(0xfc67c5b98bc1e55d), UINT64_C(0x05fb0fef1900934b) }},
+  {{ UINT64_C(0xead2f3374c141e1c), UINT64_C(0x50e5cc35cd7bfe50), UINT64_C(0x5f68572627197663), UINT64_C(0xcb21ff15a102da4c) }},
+  {{ UINT64_C(0xe7f6103af969e622), UINT64_C(0x62c6571fc17947e6), UINT64_C(0x04e11715435a739a), UINT64_C(0xf0172bb879171d26) }},
+  {{ UINT64_C(0x258a8b07dbcccef0), UINT64_C(0xd22c73647b662614), UINT64_C(0xe95055d81833db92), UINT64_C(0x51e9159914fdc2ef) }},
+  {{ UINT64_C(0xcf37499abe3ae914), UINT64_C(0xbe5a57fd5c5f723b), UINT64_C(0xf95fc5df2a792f0b), UINT64_C(0xcb02dab9f20b0fc5) }},
+  {{ UINT64_C(0x270c2c216121a114), UINT64_C(0x9af95c36f76edb8c), UINT64_C(0x57422848e3ac2f62), UINT64_C(0xb2f136b5c7a73eb4) }},
+  {{ UINT64_C(0x3989418adfd890c0), UINT64_C(0xdec05a564b2fb7b0), UINT64_C(0xb0d6a0c50f571246), UINT64_C(0xe6ae00a029f8b2b5) }},
+  {{ UINT64_C(0x19d40c6364cd9a00), UINT64_C(0xfdcee115ccb1096c), UINT64_C(0x17eb0eb0c009e9ff), UINT64_C(0x8f6e6080875b6422) }},
+  {{ UINT64_C(0xc7f3fd6f86b610d6), UINT64_C(0x77ccb6eb3d56dbc7), UINT64_C(0x370c6836aae08d6a), UINT64_C(0xcbde08740dd961cb) }},
+  {{ UINT64_C(0xe86eec4f93138428), UINT64_C(0x867ce0ddcfbc8c63), UINT64_C(0x1606b0ba70c15847), UINT64_C(0x9514a250c6008fd1) }},
+  {{ UINT64_C(0xed7de59e828c396c), UINT64_C(0x86f7999b1b186215), UINT64_C(0xf862d25c9f97bf46), UINT64_C(0x066a8a1c6e84bf41) }},
+  {{ UINT64_C(0x64f6cdb102835824), UINT64_C(0xe937b4c39d9fe14a), UINT64_C(0x13646255752cfde8), UINT64_C(0x44ba1ce60f24f84e) }},
+  {{ UINT64_C(0x2e1b6d3edf7bf0d4), UINT64_C(0x1f68324d2fb00a4f), UINT64_C(0x184870b076634dcf), UINT64_C(0x028fdb7fa9ee8df2) }},
+  {{ UINT64_C(0x579731b0a45d9754), UINT64_C(0x09a8d087dcd45070), UINT64_C(0xae2184ef37d60334), UINT64_C(0xc19ffd93f7cd9be7) }},
+  {{ UINT64_C(0xc9c8885dca093a8e), UINT64_C(0xd0524ae5516f58a3), UINT64_C(0xd161b654f40ce38b), UINT64_C(0x8cb220996be3740c) }},
+  {{ UINT64_C(0x2577680e0d7e811a), UINT64_C(0x9752e86784d2f620), UINT64_C(0xbfead5ba012e08ba), UINT64_C(0x3d82da2f7ea07c79) }},
+  {{ UINT64_C(0x9b98c3099622a05e), UINT64_C(0x98e70234fc806a65), UINT64_C(0xc39303e00a072219), UINT64_C(0xea56f93584e9d25f) }},
+  {{ UINT64_C(0xda81a2c8feefd0f8), UINT64_C(0x2f0ab91261114cf0), UINT64_C(0xbb61610452343346), UINT64_C(0xda2a9219dc98693a) }},
+  {{ UINT64_C(0x416408af67cf7bd4), UINT64_C(0xc0506aaeb46fea60), UINT64_C(0xdff95f2792f4c2f9), UINT64_C(0xca0f49dc3e4b64f0) }},
+  {{ UINT64_C(0x08701e487930871a), UINT64_C(0xabccb52f048bc687), UINT64_C(0x13f16487d9bc5454), UINT64_C(0xe45790478c84046a) }},
+  {{ UINT64_C(0x3faefdbab8b648cc), UINT64_C(0xb381e4765b69f8b9), UINT64_C(0x576a51a3fc9b186d), UINT64_C(0xb771e47c345a6533) }},
+  {{ UINT64_C(0x6c393be8f972c232), UINT64_C(0xa3f87a789d561535), UINT64_C(0x7ffc20a01b4d31fa), UINT64_C(0x1bfdbcc682bc7eae) }},
+  {{ UINT64_C(0x23da7dfd354d6c9c), UINT64_C(0x0eb33889d09352f7), UINT64_C(0xc852f391ff941954), UINT64_C(0xc22fd8f1522b66c3) }},
+  {{ UINT64_C(0xbf24659c8a4dd724), UINT64_C(0x0220effe579ede4d), UINT64_C(0xf9f8bc6f38303094), UINT64_C(0x0e2368d0e014cfd3) }},
+  {{ UINT64_C(0x33aa60363fd7eaaa), UINT64_C(0xe27f2cfa099ad1d9), UINT64_C(0x936a410ed1fe6510), UINT64_C(0xa213fd4fc42e62bb) }},
+  {{ UINT64_C(0xe3bc9ae516205e86), UINT64_C(0x804b7dc34a2aff76), UINT64_C(0x542fefc881f3bdbd), UINT64_C(0x5672a7276eda21c8) }},
+  {{ UINT64_C(0x1856c4f8d88f1780), UINT64_C(0x8f8124afafbfa07d), UINT64_C(0x130bb11b1b8b7d92), UINT64_C(0xafd9f4d0d4235a6d) }},
+  {{ UINT64_C(0x63172f3e47b89358), UINT64_C(0x49ff310c1ef8d6de), UINT64_C(0xeaa0ffc4b2eedc6d), UINT64_C(0x3441616cebc3af5f) }},
+  {{ UINT64_C(0xae96c72d13161b8c), UINT64_C(0x76bc011d4cfebaa8), UINT64_C(0xb98c74c1a6749230), UINT64_C(0xfa4328012cabd787) }},
+  {{ UINT64_C(0xbe4f21532e20829e), UINT64_C(0x0990e7db83e0d2ff), UINT64_C(0x1b99183d4b8e7951), UINT64_C(0x5b4f1c6c7e9af459) }},
+};
+
+static const mzd_local_t K_1[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0x34abfd4fed792b7a), UINT64_C(0x69ed28268cc388a3), UINT64_C(0x9e4fbdf217ae540f), UINT64_C(0x95a42aded96dc5e2) }},
+  {{ UINT64_C(0x1a3f421fb4b87fcc), UINT64_C(0xe44a75f1a2dcb30e), UINT64_C(0xf0ffe5d95d70901e), UINT64_C(0x49a26142401d811d) }},
+  {{ UINT64_C(0x7476d885cd3130a2), UINT64_C(0xaab990b6796d430e), UINT64_C(0x66b730d0f8332bb1), UINT64_C(0xefaf1607fbaf4475) }},
+  {{ UINT64_C(0x4b208777bb2e3b0c), UINT64_C(0xc88bd373917162ea), UINT64_C(0x28bcbe8ee3d5bfc9), UINT64_C(0xd0060935ab02168d) }},
+  {{ UINT64_C(0x1e0d2a169b3b8eda), UINT64_C(0xd3990a5528a6e5c8), UINT64_C(0x7aa67a9cbc458bd3), UINT64_C(0x81777ce1eed7d002) }},
+  {{ UINT64_C(0x117bdab68cd44c1e), UINT64_C(0xde8489c9625a00dd), UINT64_C(0x153782aadd94bb04), UINT64_C(0x0801a965237f0969) }},
+  {{ UINT64_C(0x2cf49ed710368eb6), UINT64_C(0xd20213dee00356ef), UINT64_C(0xb337c825a43a5785), UINT64_C(0x4c4ad039dcc1d443) }},
+  {{ UINT64_C(0xdaa98ebbb4b27660), UINT64_C(0x37bfd17b827c2a63), UINT64_C(0x556f3e2f787b90b6), UINT64_C(0xf56e5640616b19c1) }},
+  {{ UINT64_C(0xfba04382e66e0820), UINT64_C(0x3c7b4e346f045d63), UINT64_C(0xd7fe3a322dba5c32), UINT64_C(0xfd60a663c6afd5e2) }},
+  {{ UINT64_C(0x000cefd01724071e), UINT64_C(0x43e18cb03160bf78), UINT64_C(0x736cffdcfd5f1a49), UINT64_C(0xba8862fd39e64c0e) }},
+  {{ UINT64_C(0x8e3bf5040b93ab68), UINT64_C(0x7e7f6a198b95d4a7), UINT64_C(0x4cdf0920bcb57c75), UINT64_C(0xf501823aa262103d) }},
+  {{ UINT64_C(0x89d98f454e7649aa), UINT64_C(0x9452bfc5888e8bd8), UINT64_C(0xdd234db2484850dc), UINT64_C(0xaf74dc9f694202b3) }},
+  {{ UINT64_C(0x95981a29b2cc3386), UINT64_C(0x964b57175f2a6c3a), UINT64_C(0x5787a301d02f3381), UINT64_C(0x4ded0b688859de20) }},
+  {{ UINT64_C(0x2ef58a7c8a3b08c2), UINT64_C(0x60f978e45dd6414f), UINT64_C(0xa4b91dc37a345e5e), UINT64_C(0x7896549e3344a657) }},
+  {{ UINT64_C(0x6e5c963e8f44292c), UINT64_C(0x4d7c25a63a7831cb), UINT64_C(0x67e84c10d8f5fe9c), UINT64_C(0x9e2d4b20b49109b3) }},
+  {{ UINT64_C(0x11eddf422aed60ca), UINT64_C(0xea96b61d963ecc99), UINT64_C(0x3ddd85b6083c7580), UINT64_C(0x18a20023499fa7d5) }},
+  {{ UINT64_C(0x7820c276341c9d6a), UINT64_C(0xdc05475b67d74475), UINT64_C(0x2713e03c9bea3619), UINT64_C(0x13d7a67c29b63dee) }},
+  {{ UINT64_C(0x55c8ddd8baf2a50e), UINT64_C(0x3fbf804255b260b6), UINT64_C(0x3b869e5bbaa93e37), UINT64_C(0x1bcc5e5d0a2b8edb) }},
+  {{ UINT64_C(0x34ec71d9915f536e), UINT64_C(0x31292fc44cd7023d), UINT64_C(0xaa9a23f63d0c1de9), UINT64_C(0xbdf97a7b5de3ec8a) }},
+  {{ UINT64_C(0x072ae0b79c99c4f4), UINT64_C(0xe460a87f537f335a), UINT64_C(0x24edc8b24dddf5ad), UINT64_C(0xfa10717369f20790) }},
+  {{ UINT64_C(0xe8714b9c2adcbd22), UINT64_C(0x5d3b1957a698a905), UINT64_C(0x15942b33c89499db), UINT64_C(0x8473803a0d48b436) }},
+  {{ UINT64_C(0x80d1f50b65db46f6), UINT64_C(0x0479cc23513eb599), UINT64_C(0x55cf60318e4cff99), UINT64_C(0x39ee476bf4ee0968) }},
+  {{ UINT64_C(0xf4dc63abc87b67a4), UINT64_C(0xc376b5acc9c2b409), UINT64_C(0xc7f1dc7d55df4762), UINT64_C(0xa908c9b007914945) }},
+  {{ UINT64_C(0x5d5ab3c9b0e80e62), UINT64_C(0xd2dc40b365beef8a), UINT64_C(0xb71af62fac1f9ef4), UINT64_C(0x24a619e5ec96df22) }},
+  {{ UINT64_C(0x6e47f85c3c1c13b8), UINT64_C(0x7384e11d07c11869), UINT64_C(0x344171d3c7e3adc3), UINT64_C(0xca14641138da9da3) }},
+  {{ UINT64_C(0x75006d414f416dbc), UINT64_C(0xabd2bf7326539b43), UINT64_C(0x682d298fbc26e0af), UINT64_C(0xebb503d522facada) }},
+  {{ UINT64_C(0xe5002f12d16d800e), UINT64_C(0xb9530a2752c4580e), UINT64_C(0xf18247351fb11447), UINT64_C(0x6dbfaf9a33777bb5) }},
+  {{ UINT64_C(0xec4586aa95bd3e12), UINT64_C(0x819a56f5c15947c8), UINT64_C(0x44f85cf0028e94b1), UINT64_C(0x70c684852d76f7cb) }},
+  {{ UINT64_C(0x30cdea456f6804f6), UINT64_C(0x3e4f54421c750129), UINT64_C(0x9f7f86e84c184d28), UINT64_C(0xf2da177bc2c90be9) }},
+  {{ UINT64_C(0x7e648fe7b78ed25c), UINT64_C(0xdd4e557ec43eb689), UINT64_C(0xa6384739b12d785c), UINT64_C(0x2ea2d659a0bd798d) }},
+  {{ UINT64_C(0xd4c8fc962b478262), UINT64_C(0xb02c4493b27caa45), UINT64_C(0xc492d73fad6064a8), UINT64_C(0xf375cb7825d74bd1) }},
+  {{ UINT64_C(0x5e06cc6b8b82c466), UINT64_C(0x5d590d50322e1126), UINT64_C(0xe348db47f07cc053), UINT64_C(0xc31ec3ad243bf2d5) }},
+  {{ UINT64_C(0x1ef950bde07b309a), UINT64_C(0xe438d2bebba0bb22), UINT64_C(0xd193de2bc5d2689a), UINT64_C(0xdd443e167d477804) }},
+  {{ UINT64_C(0x0ab5839519313cbc), UINT64_C(0x7f1e465f323168a7), UINT64_C(0xa2bac5b30da3d562), UINT64_C(0x0c848005ba1863f5) }},
+  {{ UINT64_C(0x43d9d66f1ab6e1ac), UINT64_C(0xe709c127c9161a37), UINT64_C(0x3c040731fec39e11), UINT64_C(0x8fa0f568159555c1) }},
+  {{ UINT64_C(0xcfbc35caf36740d6), UINT64_C(0x192a7ff5ce02976b), UINT64_C(0x8f6259f1ec4943ab), UINT64_C(0x5d7331cdc19bf4ad) }},
+  {{ UINT64_C(0x69e86a38f899eff4), UINT64_C(0xa04062064fc1f1f3), UINT64_C(0x9ddb62e4cc660e5e), UINT64_C(0x2a71f91b519341a6) }},
+  {{ UINT64_C(0x4713b3191645383e), UINT64_C(0x312197bba7b3ea15), UINT64_C(0xe0ee96e96112bb31), UINT64_C(0x02082502a79321ca) }},
+  {{ UINT64_C(0x4d658b37274d974a), UINT64_C(0xa82366d0512fee47), UINT64_C(0xfeb7db048329fd4c), UINT64_C(0x75f594476779dcb5) }},
+  {{ UINT64_C(0xfe82e9e41b2fad50), UINT64_C(0x33f4ba30b15ffad3), UINT64_C(0x35a6f40983415518), UINT64_C(0x0ea10f611798cd8b) }},
+  {{ UINT64_C(0x66fa965489908f90), UINT64_C(0x4f59cd8e175cf17d), UINT64_C(0xf19f1a148c55db90), UINT64_C(0xb0d0e191a5dea532) }},
+  {{ UINT64_C(0x8dfe28a6c7b255ca), UINT64_C(0xb4bfa019488b4145), UINT64_C(0x04c7694b10cc66e5), UINT64_C(0xf2e978200f83e3da) }},
+  {{ UINT64_C(0x2d87a0fd3211d1de), UINT64_C(0xf0621862a6cc7ab5), UINT64_C(0xc2370ceb370d76fc), UINT64_C(0x9bd52ef80b797f4f) }},
+  {{ UINT64_C(0x31e0f826d10ad20a), UINT64_C(0x11cb85937c80c401), UINT64_C(0x79b02450b96eb5db), UINT64_C(0x73e90144d2b22f40) }},
+  {{ UINT64_C(0xa2e9f6a1ac1a5010), UINT64_C(0x5c0c4409ee8a1280), UINT64_C(0x553e4835057ee425), UINT64_C(0x8c1e65f811fbe5aa) }},
+  {{ UINT64_C(0x202b982f8ee47202), UINT64_C(0xacfb5b39421578e3), UINT64_C(0x23e0455f945321b3), UINT64_C(0x341b68b8f6772ac2) }},
+  {{ UINT64_C(0x93eb39a3cf2fb576), UINT64_C(0x446d17f6f740b8d2), UINT64_C(0x25c33afe33041aa6), UINT64_C(0x47b1906c9a0ff31e) }},
+  {{ UINT64_C(0xc56839a1fb8a6f86), UINT64_C(0x21c700e87bbeb652), UINT64_C(0xee9f5a6979768be9), UINT64_C(0x8b7d48986e90fea1) }},
+  {{ UINT64_C(0x250adbbd566c6568), UINT64_C(0x515ec3df7d0dd152), UINT64_C(0x5f5ae39c05cc6ca5), UINT64_C(0x902e458685b61a66) }},
+  {{ UINT64_C(0x3cf4fa5257db7d0e), UINT64_C(0xbdcc97738b965ab6), UINT64_C(0x3c92a080ccfb39e3), UINT64_C(0x8fc5685ec215e2ca) }},
+  {{ UINT64_C(0xd6bb56f98ed4e8ce), UINT64_C(0x2f440dde3d30f1a1), UINT64_C(0x7e2e84aa5a138f5e), UINT64_C(0x0017e647af554552) }},
+  {{ UINT64_C(0x3e025d4d9de66bb6), UINT64_C(0x59ec12156eb3b283), UINT64_C(0xc53e4190069e5937), UINT64_C(0x68415bb26c7e68b9) }},
+  {{ UINT64_C(0xda43505bef181226), UINT64_C(0xb231ca2aff5284cd), UINT64_C(0xfc20c7b2d7b00132), UINT64_C(0xe2643aeedc9e0c06) }},
+  {{ UINT64_C(0xbb9aace047e77458), UINT64_C(0x8c8c779959429b47), UINT64_C(0x94f7700fb9ee293b), UINT64_C(0x63bb10e77ef29503) }},
+  {{ UINT64_C(0x597c17363c5302ac), UINT64_C(0xfa2395432225d1ec), UINT64_C(0x713000e20e96704e), UINT64_C(0x00ef24d23a25398a) }},
+  {{ UINT64_C(0x7553783e4cf40dde), UINT64_C(0xc38825ce0a1d557f), UINT64_C(0xdb0673b3f548d78a), UINT64_C(0x0989324fd28bd615) }},
+  {{ UINT64_C(0xdb9a3121694401de), UINT64_C(0x665aeebacea4e537), UINT64_C(0x0b80af1d040a24f2), UINT64_C(0x03bbca22462d1b86) }},
+  {{ UINT64_C(0xc6470e43643f6e9e), UINT64_C(0xf42f22180577d850), UINT64_C(0xa897d0857d146f8f), UINT64_C(0xb31e57ddab00caf3) }},
+  {{ UINT64_C(0x20d8779a4a0e4bd2), UINT64_C(0x3807f0ca3b9dc458), UINT64_C(0xc4091faf3a4809ae), UINT64_C(0xa17671ad87bd2844) }},
+  {{ UINT64_C(0xa50d68184df115be), UINT64_C(0x885665727b832e80), UINT64_C(0x0c4baaa7e6312996), UINT64_C(0x40e913a7b8863af8) }},
+  {{ UINT64_C(0xfaebc63479001946), UINT64_C(0x4885f419cc186791), UINT64_C(0x8e14f22f0632b843), UINT64_C(0x54fb8f755325db3c) }},
+  {{ UINT64_C(0xf69e391ea5512ebc), UINT64_C(0x085927a836aeb6fe), UINT64_C(0xce4e6d8ef378f912), UINT64_C(0xcbae0b9aab027742) }},
+  {{ UINT64_C(0x78d864dd3a75707e), UINT64_C(0x4570cfe3640899ac), UINT64_C(0xee350c3b84a80301), UINT64_C(0x6ca71d91d3d99582) }},
+  {{ UINT64_C(0x8402d55467a99f48), UINT64_C(0xa91b41c2facdfbd7), UINT64_C(0x8ef06548ae67cc46), UINT64_C(0x79995ea84a9ff42f) }},
+  {{ UINT64_C(0x63ea410a5248408a), UINT64_C(0x64d5c6c6e2c0861c), UINT64_C(0x4f1ca22029acd3de), UINT64_C(0x0a8f1889da9aaf7b) }},
+  {{ UINT64_C(0xf672f4d81b00b758), UINT64_C(0x504e0ddfec991f03), UINT64_C(0x9633990fecb848ea), UINT64_C(0x8f8556923eb379ce) }},
+  {{ UINT64_C(0xc30e36dde09fe214), UINT64_C(0xf120ccd65987c2cb), UINT64_C(0xd051c77a168d10e6), UINT64_C(0xfa086e458242a29d) }},
+  {{ UINT64_C(0x1d254a94213572ca), UINT64_C(0x8dcd498c3ada11fe), UINT64_C(0xcf161185c1575feb), UINT64_C(0xc918f77f1e46b2a3) }},
+  {{ UINT64_C(0x6b75a75efbc59176), UINT64_C(0x35ac0d48011c8dcc), UINT64_C(0x16bc614294c9d54a), UINT64_C(0xb218c113e7ac0ecc) }},
+  {{ UINT64_C(0xa61ee6872890e834), UINT64_C(0x39c8cc051531f058), UINT64_C(0xc57ebd80cecefdcb), UINT64_C(0x10f2057e466390b0) }},
+  {{ UINT64_C(0xdb8baddbd329da76), UINT64_C(0x14fc77fb1c1d3159), UINT64_C(0xbd8c8eb9cd8b9375), UINT64_C(0x46cf47136f7a023d) }},
+  {{ UINT64_C(0x4b5b266852488efc), UINT64_C(0x785a13d6c0cc4607), UINT64_C(0x442167646b2bb353), UINT64_C(0xad4cc484c50d1429) }},
+  {{ UINT64_C(0x1dc5f38ff1e16aa8), UINT64_C(0x540c0a2f5729b003), UINT64_C(0x7acee4fd21ab6db7), UINT64_C(0x2f7c83c64016c0ae) }},
+  {{ UINT64_C(0x3f632148937e4e0e), UINT64_C(0x41af36ef8892a901), UINT64_C(0x03773de6eaee1993), UINT64_C(0x0075e25057b0f98e) }},
+  {{ UINT64_C(0x904cd8d6aaef036c), UINT64_C(0x5cf2277a61d51d58), UINT64_C(0xc38897a29e150929), UINT64_C(0xd19a2861df86b7c4) }},
+  {{ UINT64_C(0x1ec700b12d5c92b2), UINT64_C(0xb10129fcb0a78599), UINT64_C(0xba41a28573cfb903), UINT64_C(0xceeeb62d17592aaf) }},
+  {{ UINT64_C(0x41712acf5835586e), UINT64_C(0xc81661612508a1fe), UINT64_C(0x73519d101942c112), UINT64_C(0x511415d1e18953d5) }},
+  {{ UINT64_C(0x0ab30580c8a4786c), UINT64_C(0x5652c3827a824f2f), UINT64_C(0x6ce0bb888e43481c), UINT64_C(0x63fe720a2caa5c26) }},
+  {{ UINT64_C(0x394976277fe67230), UINT64_C(0xb1525c62aa0dc854), UINT64_C(0x50eae0d0e082647c), UINT64_C(0xf8589a74a017eff0) }},
+  {{ UINT64_C(0xdbd63b2bbe2f35da), UINT64_C(0xf37a8de25a6c5282), UINT64_C(0x75859eecb7ad54e7), UINT64_C(0x38154624bde878d0) }},
+  {{ UINT64_C(0x595748b4c311660a), UINT64_C(0xcabef5c7cca3d22f), UINT64_C(0x5a0c04568f0cc7c2), UINT64_C(0x5c29043d781921a7) }},
+  {{ UINT64_C(0xf4e57e4ab4566a0c), UINT64_C(0x46cd10e7bba2c933), UINT64_C(0x45e1d0b996bfd9e3), UINT64_C(0x38100b4706fe2397) }},
+  {{ UINT64_C(0xf84614efc7530012), UINT64_C(0xbbcf21653054bfa5), UINT64_C(0x3a536a3956bc71a9), UINT64_C(0xb64ab8c2136ae3fa) }},
+  {{ UINT64_C(0xbfd4afebf3f959e2), UINT64_C(0x5b53af22fc7570f3), UINT64_C(0x0bac9298c769dca2), UINT64_C(0x01b0535377fc7500) }},
+  {{ UINT64_C(0x0d974c67aaab0598), UINT64_C(0x157e1ecceead6e5d), UINT64_C(0x241b766cbc060a76), UINT64_C(0x629a3dc87655a706) }},
+  {{ UINT64_C(0xceebbe49c474e282), UINT64_C(0xc508aedb83d29bbc), UINT64_C(0xe9930e5b390b001b), UINT64_C(0x2a98b5e6aa21fbbc) }},
+  {{ UINT64_C(0x404788e7bfce4e42), UINT64_C(0x6347925c8be5c269), UINT64_C(0xbc59ec1712562bb8), UINT64_C(0xd680fa7f34ac26ae) }},
+  {{ UINT64_C(0x90b589c7e43abb7a), UINT64_C(0x5f87def832533c54), UINT64_C(0xc666e77bab00cca4), UINT64_C(0xfe0a102539fd9c85) }},
+  {{ UINT64_C(0x9b01ef99964f2570), UINT64_C(0xe7ffbd88c62905b7), UINT64_C(0xfd0fb28eb85c045b), UINT64_C(0xeedfeb19d8662193) }},
+  {{ UINT64_C(0x2aa79e8a596b5100), UINT64_C(0x1df64d2555faec4a), UINT64_C(0x08b4d8a54ce20aaf), UINT64_C(0x31c4eed6030358a2) }},
+  {{ UINT64_C(0xc3b7dc1593aaf106), UINT64_C(0x611080e9d8ffb8e7), UINT64_C(0xd662ad6084bbf92b), UINT64_C(0x874546cd1942aa40) }},
+  {{ UINT64_C(0x4c55ee5685adea70), UINT64_C(0xfacd461c80d9acff), UINT64_C(0xfce501e4c6da43bf), UINT64_C(0x4598f654fe669815) }},
+  {{ UINT64_C(0x1fc77986a9d021b0), UINT64_C(0x79261a5b7c4415d1), UINT64_C(0x2a9e13b3ed751c99), UINT64_C(0xa9d6668b5e213e35) }},
+  {{ UINT64_C(0x6e2a1f640dc07fea), UINT64_C(0x8214d29e27d836ae), UINT64_C(0xe2bcb2e1b4984b63), UINT64_C(0x9ac71d243ddac1f9) }},
+  {{ UINT64_C(0xa347004adb0f63ec), UINT64_C(0x7a92916e2f94776c), UINT64_C(0x71e02bf17cb40251), UINT64_C(0x4bd12f6a6849dec2) }},
+  {{ UINT64_C(0xa61424d1df876c22), UINT64_C(0x218fd567f54a4e16), UINT64_C(0x31771aaa350a2788), UINT64_C(0x873dd3ad263a1f32) }},
+  {{ UINT64_C(0xbea99885ab92ce52), UINT64_C(0x499152c1885c4858), UINT64_C(0xb32fd660fb4999db), UINT64_C(0x9319235f91f994bf) }},
+  {{ UINT64_C(0x156cb6707d96c5a0), UINT64_C(0xdc24da3a6d272fd6), UINT64_C(0x6831282d6c5904fc), UINT64_C(0x13f72bb992fabb2e) }},
+  {{ UINT64_C(0xc6488ae408bf1664), UINT64_C(0xb77913ced1e9698c), UINT64_C(0xadbb239d12dfa607), UINT64_C(0xe1d3ca2ff256db08) }},
+  {{ UINT64_C(0xc9ba261a68158760), UINT64_C(0xd25ea2941310a111), UINT64_C(0x64182a4665fe48f3), UINT64_C(0x6f09276029fe98c5) }},
+  {{ UINT64_C(0x52eca07900b150ea), UINT64_C(0xa4b43e88b9c30b5e), UINT64_C(0x7c7fba7eb0f06dea), UINT64_C(0xadbda9dc41e4d726) }},
+  {{ UINT64_C(0xa7f43ce05a70c88a), UINT64_C(0x40d80418212c927d), UINT64_C(0xb775fd429dbdd77f), UINT64_C(0x8f7371f0022e11af) }},
+  {{ UINT64_C(0x066dbd8118662626), UINT64_C(0x276eaf31de91a674), UINT64_C(0x0edff1743c402d81), UINT64_C(0x7a1845770bb39a95) }},
+  {{ UINT64_C(0xa410f9e39c718daa), UINT64_C(0x74f893cb46f4521e), UINT64_C(0xda47deba8edcca28), UINT64_C(0x8efe2723db6b4435) }},
+  {{ UINT64_C(0x6c7d9c75f9d8356c), UINT64_C(0xf15d61bca8eadc03), UINT64_C(0x91c7433439d80533), UINT64_C(0xfdcebf82651b6195) }},
+  {{ UINT64_C(0xe879c6d3efc0e4b2), UINT64_C(0xe21954c3feb13a0a), UINT64_C(0x5015d1c6d3346338), UINT64_C(0x15a7538e0ae40df5) }},
+  {{ UINT64_C(0x9264fe5b93105bf8), UINT64_C(0xd185918096367601), UINT64_C(0x63d8872376ca410d), UINT64_C(0x5f6851e2c7bd7c6d) }},
+  {{ UINT64_C(0x08470a881dfc282e), UINT64_C(0x2222021f7202a12c), UINT64_C(0xac0d498a488a0b69), UINT64_C(0xa025814c3cc9325c) }},
+  {{ UINT64_C(0xa4b6dc4671073f6a), UINT64_C(0x64347d70bc8e0f42), UINT64_C(0xe4559dd45bbacfad), UINT64_C(0xbd8afe4e8d4a2fda) }},
+  {{ UINT64_C(0x5cedbd4fd0ab9e14), UINT64_C(0x4afc387c334b3bf0), UINT64_C(0xb7d6fe47b184774f), UINT64_C(0x28c982188648ae10) }},
+  {{ UINT64_C(0xe325ebd1caec4b96), UINT64_C(0x0058be7c756cb35a), UINT64_C(0x9b86f09c19dbd297), UINT64_C(0xc4d56ce543398b60) }},
+  {{ UINT64_C(0xc9fcd22bedd7cfec), UINT64_C(0xd5bb3490b77b344f), UINT64_C(0x204e712b9b27bbdb), UINT64_C(0xee1ed15b10ccc28c) }},
+  {{ UINT64_C(0x3076714ab4073266), UINT64_C(0x5530bb2e6c00452b), UINT64_C(0xf4eafcaeabe0a641), UINT64_C(0x3dbeda708c09f00c) }},
+  {{ UINT64_C(0x24c9230b9277d416), UINT64_C(0x01c227d211c03a8b), UINT64_C(0xd70b558b71676562), UINT64_C(0xa0b6fc2479fc54f8) }},
+  {{ UINT64_C(0x0281f77d5f3f58e6), UINT64_C(0x9376e44bc05398ed), UINT64_C(0xf7325d108f69e1a9), UINT64_C(0x87aaccaa4ded93f2) }},
+  {{ UINT64_C(0x115e7137d41d8a02), UINT64_C(0xcd04b13d00a0285a), UINT64_C(0xecc655fd105befbb), UINT64_C(0x71fd63afcc7e68f7) }},
+  {{ UINT64_C(0x21b7d9587b1080a4), UINT64_C(0xa8d222baa7caee20), UINT64_C(0xcf676d15322046a0), UINT64_C(0x3f8794d7bb434b71) }},
+  {{ UINT64_C(0xdc7e6ca32e6715d8), UINT64_C(0xc5e76f593bbbd703), UINT64_C(0xe2416d24b8b336b5), UINT64_C(0x0313b5308616cc10) }},
+  {{ UINT64_C(0x72619bcdebd36b02), UINT64_C(0x66c8ce128cc749e2), UINT64_C(0xe344ff301a69a43e), UINT64_C(0x5e53bc463e52530d) }},
+  {{ UINT64_C(0x052c38d369c47562), UINT64_C(0xde7716352f4b78b2), UINT64_C(0x2b2ab0953f7a3703), UINT64_C(0xe9f5b83a0e7ee66c) }},
+  {{ UINT64_C(0x0a98608a20af74ea), UINT64_C(0xff09f27deeed9051), UINT64_C(0x17ed74537f613d1f), UINT64_C(0x42ac55dfbc53dafd) }},
+  {{ UINT64_C(0xa52447892bb0df5c), UINT64_C(0xcc5e6225863e0bbf), UINT64_C(0x6a1233c7220a26ae), UINT64_C(0xebe2139ee59c6a72) }},
+  {{ UINT64_C(0x2fff85c162aa17a6), UINT64_C(0x956a1f51ba588b63), UINT64_C(0x925a9c8a6b040f34), UINT64_C(0xd680621d528907f3) }},
+  {{ UINT64_C(0x600211383672a2f4), UINT64_C(0x9de888459218696d), UINT64_C(0x785cf85f88aeff8c), UINT64_C(0x92aca0adafa1cb20) }},
+  {{ UINT64_C(0x5edcc47ddbe2fdaa), UINT64_C(0x9fbaf65559e8c3cc), UINT64_C(0x7ba4668b9e02deaa), UINT64_C(0x3a67fe7e737c91b3) }},
+  {{ UINT64_C(0x99378414ccec0020), UINT64_C(0x065d599c298200ec), UINT64_C(0x9d7df4ab2a680830), UINT64_C(0x7375c87453cc7dab) }},
+  {{ UINT64_C(0x5741365cb3b41fd8), UINT64_C(0x8fac7ed85705be34), UINT64_C(0x8a16708b020641d2), UINT64_C(0xe2c28bfb883df437) }},
+  {{ UINT64_C(0x998470d5be88482e), UINT64_C(0x8bf2015f28cbca3e), UINT64_C(0x4596f98d5f39ba09), UINT64_C(0x2aa7f99ac0f93ebb) }},
+  {{ UINT64_C(0x8417514b2ac87ec2), UINT64_C(0x85aaf720bf5be21e), UINT64_C(0xc7c83388346ca22e), UINT64_C(0xf5a3d8d5a5d7deb6) }},
+  {{ UINT64_C(0x821fb6e2178d095a), UINT64_C(0x1563ecbfb7ad6d67), UINT64_C(0xc9fde60c6af7c24b), UINT64_C(0x4c8bba5f3146be11) }},
+  {{ UINT64_C(0x91507b13eef6fb60), UINT64_C(0x81bdf15a2f1b256d), UINT64_C(0xddc4775d67716356), UINT64_C(0xae1dcb7c1e2a6230) }},
+  {{ UINT64_C(0x3ee262e7e9cde118), UINT64_C(0xe5f11ff9bc7a2fd4), UINT64_C(0x0e42e68ebd2617fb), UINT64_C(0xe68d069990b41385) }},
+  {{ UINT64_C(0x0b3569f0445b1f3e), UINT64_C(0xf1af9366afbd38b4), UINT64_C(0xa39ef3d16549ab6a), UINT64_C(0x04e1ec80ed1179a9) }},
+  {{ UINT64_C(0x871a3db5b9b72e0a), UINT64_C(0xa9ba20462589f728), UINT64_C(0xf76ee03ff16b2173), UINT64_C(0xa6fb941699033386) }},
+  {{ UINT64_C(0x6dccd913916f5b3c), UINT64_C(0xfb735b4d0a115818), UINT64_C(0x19716dc19910a42b), UINT64_C(0x65f59c50f218bdd0) }},
+  {{ UINT64_C(0x281f2a0b547f0962), UINT64_C(0x3381807a1a45f500), UINT64_C(0x0cc5e6be3ab369b5), UINT64_C(0xdd20a3ee1868087c) }},
+  {{ UINT64_C(0xe7e737da43dee288), UINT64_C(0xa75ec2d544170d38), UINT64_C(0xa71286f7dc1ad759), UINT64_C(0xaf969549dd345a0c) }},
+  {{ UINT64_C(0x254fb52f76897ae6), UINT64_C(0x1868db56a847d7a0), UINT64_C(0xc12ed1dd0e62fe3e), UINT64_C(0x6a404be2ed7a92fd) }},
+  {{ UINT64_C(0xbe34f8728ba84e64), UINT64_C(0xe258e30fbf12d792), UINT64_C(0xc8cf94ed7c650ff6), UINT64_C(0x636adbe150f84954) }},
+  {{ UINT64_C(0xa7015ec63e2af93a), UINT64_C(0x75eaeeb2c4d34532), UINT64_C(0xa41345d31899428e), UINT64_C(0x856231d61b4796a8) }},
+  {{ UINT64_C(0xafa15c992a884e20), UINT64_C(0xc4fdeb10a1053ccc), UINT64_C(0xe3e06b52f9d574cc), UINT64_C(0xba628b308a9b166f) }},
+  {{ UINT64_C(0x66c809033ae39bea), UINT64_C(0xaf781dbe804685c5), UINT64_C(0x87ae0739f98eee78), UINT64_C(0x7f99606cfd988cf5) }},
+  {{ UINT64_C(0xe2575ace858f3bc6), UINT64_C(0x43aa4b5328d05aae), UINT64_C(0x9e8ec29948474210), UINT64_C(0xbbcda5f1a192a992) }},
+  {{ UINT64_C(0xc45c23795d1ad6f4), UINT64_C(0x8201d75a8a054c63), UINT64_C(0xd6e5fdc1145c0ebf), UINT64_C(0x8bfd39de1277ff08) }},
+  {{ UINT64_C(0x4c1aaf0a05252248), UINT64_C(0x9e87b1200680bca8), UINT64_C(0x18c8dda774c925cf), UINT64_C(0x941d85c34798d2ac) }},
+  {{ UINT64_C(0xeea31af34b85d3be), UINT64_C(0x52b050971faae00b), UINT64_C(0xe16eab4203a32775), UINT64_C(0x0a743ade69d906f1) }},
+  {{ UINT64_C(0x2e1b9c40b4501326), UINT64_C(0x14f4c878be33f2a5), UINT64_C(0xf90471f7474acdbf), UINT64_C(0x8b7a0f4a17f4d217) }},
+  {{ UINT64_C(0xf57fa90bb71525a8), UINT64_C(0x649782213ab9d783), UINT64_C(0xc2c636ae663c9907), UINT64_C(0x457e477098cb65e9) }},
+  {{ UINT64_C(0x08d0a8053f2e2186), UINT64_C(0xbd115a3a07e6951f), UINT64_C(0xc69972bd4b274138), UINT64_C(0xd6deb91835653343) }},
+  {{ UINT64_C(0x714253793a80bac6), UINT64_C(0xc907c5602b4056dd), UINT64_C(0xf85601ae44e32f48), UINT64_C(0xa990a985615e89fa) }},
+  {{ UINT64_C(0xabbd197abaf93be4), UINT64_C(0xfecd90b897fb2946), UINT64_C(0xb029ba29b16d0d5b), UINT64_C(0x5bdd310b0f0aa412) }},
+  {{ UINT64_C(0x634719837d483e3e), UINT64_C(0xeaef1ca936c2d940), UINT64_C(0xc2a7394f92fa91fa), UINT64_C(0xa0fc57f2bcd266dd) }},
+  {{ UINT64_C(0x8cd69effb439871c), UINT64_C(0xb9c2968377ffcee5), UINT64_C(0xa5c21d96be76f51c), UINT64_C(0xadbe1171ab54c71c) }},
+  {{ UINT64_C(0xdcc91efafceb5640), UINT64_C(0xfe7ca7b3a7635f2b), UINT64_C(0x7eef337761593c14), UINT64_C(0x2d500583b5327a2e) }},
+  {{ UINT64_C(0x8b43f9f965b8528a), UINT64_C(0x45c7376deeb92e2b), UINT64_C(0xcb2ce924fe5d59fa), UINT64_C(0x1f8ba64ee1de4e0c) }},
+  {{ UINT64_C(0x928d05168bf9a970), UINT64_C(0xd981435bd36adeea), UINT64_C(0x68b84ddd0421b927), UINT64_C(0x3ef1785139bb95d2) }},
+  {{ UINT64_C(0x3ed08db1f045f43e), UINT64_C(0xf63d26cf7803add5), UINT64_C(0x3fa1a1a43191d18c), UINT64_C(0xa2c9184d7f766518) }},
+  {{ UINT64_C(0x02d4f3fb8f31f2b0), UINT64_C(0x7ba36f79b0b652ee), UINT64_C(0xfafc30bffd31f2d3), UINT64_C(0x52e754ffbf64973d) }},
+  {{ UINT64_C(0xcbf799806c37606a), UINT64_C(0x2d5ae7ff1d3b5938), UINT64_C(0xfc8378a196e12d4f), UINT64_C(0x67125ab9e82985e4) }},
+  {{ UINT64_C(0xef3b019ce7cae76a), UINT64_C(0x7e96348c5ed645d0), UINT64_C(0x69f5de49d69d46a9), UINT64_C(0x5c982326eaa32fdf) }},
+  {{ UINT64_C(0xbeee07ebb10db4d0), UINT64_C(0x02f0e2b4f99e007e), UINT64_C(0x890218e48b50f1a7), UINT64_C(0xa02e37aa1a831594) }},
+  {{ UINT64_C(0x15255efc655e08b6), UINT64_C(0xf7342362d42fb571), UINT64_C(0x34af6c209de4624e), UINT64_C(0xc3af7cb13fe538f5) }},
+  {{ UINT64_C(0x674c321ec72d9776), UINT64_C(0xeea0dfb9aaf173dd), UINT64_C(0x6de23fed45c8c0cf), UINT64_C(0x304b1eb7157ce425) }},
+  {{ UINT64_C(0x4d318f027fc18e76), UINT64_C(0xfeb476adbd3502eb), UINT64_C(0x7d41ba1c15f4a836), UINT64_C(0x232a8a7f18230093) }},
+  {{ UINT64_C(0x75e1c8d9db2c801e), UINT64_C(0x3d8726733224ea73), UINT64_C(0x616da48fca5178f6), UINT64_C(0xd5de3bfa886e6fd4) }},
+  {{ UINT64_C(0x0095188b64156fc6), UINT64_C(0xac81b7bbd0c9ed0d), UINT64_C(0xef353b9e03b1b49e), UINT64_C(0x4b15ef12ade117fb) }},
+  {{ UINT64_C(0xe7200e9f1b70a74e), UINT64_C(0x249ea62142be52ed), UINT64_C(0x42d6ea37add70b85), UINT64_C(0x4ac7e640b2b7d5d1) }},
+  {{ UINT64_C(0x03cc382639bed930), UINT64_C(0x1a0c43175d1a25a9), UINT64_C(0x4e2f691cedc42c8c), UINT64_C(0x436f7f48342e4406) }},
+  {{ UINT64_C(0x783aba32ef773324), UINT64_C(0x02138cfd975e1159), UINT64_C(0xa7f729d0a0af2d05), UINT64_C(0x3f32122b8792c2a3) }},
+  {{ UINT64_C(0x6b5c4caf4f455424), UINT64_C(0xae902203a8b64045), UINT64_C(0x26695a573cb423cf), UINT64_C(0x5286c62e8d5e882c) }},
+  {{ UINT64_C(0x5fa741c8065ac02a), UINT64_C(0x6ce7ad00945d083a), UINT64_C(0x9e29e52bb3d438da), UINT64_C(0xba371d0de8d5cc53) }},
+  {{ UINT64_C(0xd97a476670ef03e0), UINT64_C(0x2dd0267066ff632a), UINT64_C(0x8f662a7d9d0a6573), UINT64_C(0xd30e78d4ca1807ca) }},
+  {{ UINT64_C(0x474823a137e69da8), UINT64_C(0xf43a04556c24dfd3), UINT64_C(0x8eb7d3371c8725a9), UINT64_C(0x07c2429f96f725bd) }},
+  {{ UINT64_C(0xb570c07e1e604dcc), UINT64_C(0xb612f8e3b78dc82f), UINT64_C(0xf32dd4272c5d51a0), UINT64_C(0x099660929c67ec98) }},
+  {{ UINT64_C(0x1d05b228f7584ddc), UINT64_C(0x6b09ddda1506cd48), UINT64_C(0x9d6f634a68fbf2a5), UINT64_C(0xe7f28826426fa672) }},
+  {{ UINT64_C(0xcb7183a26cca8350), UINT64_C(0x05d08c6e6cf07a12), UINT64_C(0x51ed5f9027fc9e9a), UINT64_C(0xa8fdd484abf86609) }},
+  {{ UINT64_C(0x7d9ed1a50bf022c6), UINT64_C(0x8e352a8b09d2f4e1), UINT64_C(0x8899d4e9f77447c8), UINT64_C(0x6afe1175ee4d8a18) }},
+  {{ UINT64_C(0x83245b02308ab7e2), UINT64_C(0xd1d92c7adc21f4b2), UINT64_C(0x6b7d45486e0393a1), UINT64_C(0x458ca1fef1a5a6ea) }},
+  {{ UINT64_C(0xf18e488f25a564c4), UINT64_C(0xa089e1f95d7a964e), UINT64_C(0x492bc7f5b93692b1), UINT64_C(0x21bc08263b3f7035) }},
+  {{ UINT64_C(0x92c7fd530aa98ba8), UINT64_C(0xb59f9f2e2aaaccfd), UINT64_C(0x6eb4aa4ca627318d), UINT64_C(0xad04ddf82ca7da3f) }},
+  {{ UINT64_C(0xbae779fa8fa1c35a), UINT64_C(0xe0e830aefbc837bf), UINT64_C(0x25c05899500bf7c7), UINT64_C(0x2d88f9f974304f1c) }},
+  {{ UINT64_C(0xb0d220ad368c3656), UINT64_C(0x9c23439cab9f3ccf), UINT64_C(0x3d117905057b625f), UINT64_C(0x37a5c95af4f142b6) }},
+  {{ UINT64_C(0x0a4a5c312b8f7648), UINT64_C(0x668912f608522212), UINT64_C(0xe568c3e56cd927b3), UINT64_C(0xa2fe958f74690223) }},
+  {{ UINT64_C(0x2f05c3437927ec46), UINT64_C(0x7f6ab8ba5f68e9ab), UINT64_C(0x614354a2b316b510), UINT64_C(0xc09362df75799bf5) }},
+  {{ UINT64_C(0x14b575db19edea08), UINT64_C(0xdf7f797cb0b49ef4), UINT64_C(0x2c17050e488c1b42), UINT64_C(0x1b5859d4c8f597f2) }},
+  {{ UINT64_C(0xc2035c80384e15c2), UINT64_C(0x7442c287c4ee0e86), UINT64_C(0x954da9f2ca32cf73), UINT64_C(0x2e82b363d1fce22f) }},
+  {{ UINT64_C(0xcefc05fa8a9c746c), UINT64_C(0x3d368e9cf6de8c79), UINT64_C(0x0f59f22eee365bee), UINT64_C(0xcccf9607e3e6fa65) }},
+  {{ UINT64_C(0x064612299f0f5958), UINT64_C(0xc465b6750b9c64ab), UINT64_C(0x3b72b5911ba0d985), UINT64_C(0xed72a2106e852021) }},
+  {{ UINT64_C(0x038a63892e3c8862), UINT64_C(0xf17d2f9d99504a91), UINT64_C(0x3213a6d7ea9b2d5b), UINT64_C(0xfe52043fa50e3dc0) }},
+  {{ UINT64_C(0x32071bcb20a9b9d6), UINT64_C(0x0b536a718c3b8494), UINT64_C(0x72e0da6eac6902a6), UINT64_C(0x72a6e0f0e13f5129) }},
+  {{ UINT64_C(0x56af52cee56c601c), UINT64_C(0x13a0fa2958a042f2), UINT64_C(0x14f505541f78b45c), UINT64_C(0xddd9113cd2cb6289) }},
+  {{ UINT64_C(0x0538c513c65cefae), UINT64_C(0x4916e189f9679322), UINT64_C(0x99494a7e941d1edc), UINT64_C(0x20a23abd7732e949) }},
+  {{ UINT64_C(0x10d0e73c9461af6c), UINT64_C(0xcbcb5d2947b4953b), UINT64_C(0x8dc5a5b847e35aaf), UINT64_C(0x36d2bf736553ebd6) }},
+  {{ UINT64_C(0xa7278a2b9a9cbbfa), UINT64_C(0x9fff8642e079aada), UINT64_C(0x833e1114bc0eb29a), UINT64_C(0x7b424e543451c679) }},
+  {{ UINT64_C(0x4ce3925e45b43e0a), UINT64_C(0x40986bad2471ba42), UINT64_C(0x4fd1ac7640954518), UINT64_C(0x7ed6632ff9f915fb) }},
+  {{ UINT64_C(0x6c4f38f80903568e), UINT64_C(0xc74d0a14bebb6a91), UINT64_C(0x537d3f3488bd9e3f), UINT64_C(0x0eda865dc6bb30d4) }},
+  {{ UINT64_C(0x1f5f700b90edfc2a), UINT64_C(0xd3088f8182448419), UINT64_C(0x9c6478594bf9a934), UINT64_C(0xc9f27ddbd125385b) }},
+  {{ UINT64_C(0xd208b6b692726ed8), UINT64_C(0xaa685ed2223210e8), UINT64_C(0x8d3c37434fa73dc1), UINT64_C(0x5e7c77a0ad35c904) }},
+  {{ UINT64_C(0x5df9d3f2272e944a), UINT64_C(0xdf6bde6bae80c1f2), UINT64_C(0xe62913d95c39c307), UINT64_C(0xdc8ba0f40d4862a5) }},
+  {{ UINT64_C(0x9834ba2c66a7df92), UINT64_C(0x72807a5c2af40e7c), UINT64_C(0xdee1ae4d9825c4f1), UINT64_C(0x900d33a3358ca7b7) }},
+  {{ UINT64_C(0xe42cac1c8ac1f2a0), UINT64_C(0xcd73d5f4c8c01eae), UINT64_C(0x85b8a48a40a3f459), UINT64_C(0x7b0b30cfa1c3688b) }},
+  {{ UINT64_C(0x064472db871c2dd2), UINT64_C(0xae6dbe240d51a9d9), UINT64_C(0x13cc9bd56e4a6d28), UINT64_C(0xa23986fd35863fcc) }},
+  {{ UINT64_C(0xc14ad959c91dcba6), UINT64_C(0x65c25b1beda241cf), UINT64_C(0x6cc752358fae20d5), UINT64_C(0xe5bb15e52f62addc) }},
+  {{ UINT64_C(0x2e5f904fed551af6), UINT64_C(0xf747914c2b1e7707), UINT64_C(0x80c51cfcd89ca949), UINT64_C(0x5c3bcd78097029e0) }},
+  {{ UINT64_C(0x5fe0c5bed89f31d4), UINT64_C(0x6c8f0cec6272743d), UINT64_C(0x756b886b9c4a72fc), UINT64_C(0x7ccc7e5b7f66e5ff) }},
+  {{ UINT64_C(0x24ac94d6adabefbe), UINT64_C(0xc2f1cc3d206873f7), UINT64_C(0xd2436d3e4ad68eee), UINT64_C(0x5fe0031933052705) }},
+  {{ UINT64_C(0x6d93b3d7a3d4da54), UINT64_C(0x4eb9a88fafaaeb55), UINT64_C(0xe7dc00195dca440a), UINT64_C(0xa537d06d977de7e1) }},
+  {{ UINT64_C(0x6a3fbdb7ae0c146e), UINT64_C(0xb1b9e8048b4f77b6), UINT64_C(0xb416d3d367714d9e), UINT64_C(0xe88fe8bcbaec4288) }},
+  {{ UINT64_C(0x5c8b0d4b5757f62a), UINT64_C(0xce6e2912fa29127a), UINT64_C(0x1ce31438664e8774), UINT64_C(0xb9e8ef13746e0abd) }},
+  {{ UINT64_C(0x87c4a38794a16a30), UINT64_C(0xcb17f9b383199cfb), UINT64_C(0xee299fdfc6d57749), UINT64_C(0x44d609ba67bda4b7) }},
+  {{ UINT64_C(0x683574c735a25fcc), UINT64_C(0x5fe8f0e38afc32d6), UINT64_C(0xb7137dc4bb825c58), UINT64_C(0x9cde93d15bf1d8fb) }},
+  {{ UINT64_C(0xd79e7db98749869a), UINT64_C(0xdb62582df7baab91), UINT64_C(0x76ef29238e4539ce), UINT64_C(0x5f3dc322b771d42c) }},
+  {{ UINT64_C(0xb70400f8e63b4230), UINT64_C(0x99a5fe8ab0d2c2fe), UINT64_C(0x309d52fbd52c11e0), UINT64_C(0xe120288e56e118f0) }},
+  {{ UINT64_C(0x0d63ed2bfa2380dc), UINT64_C(0xc878ca7bcabb07d6), UINT64_C(0xd09b316fb24ab017), UINT64_C(0xe196d476aed3dccc) }},
+  {{ UINT64_C(0x026da5845eb87912), UINT64_C(0xbe7e6b58abe35601), UINT64_C(0x655706b0c9f0353a), UINT64_C(0x6dd9e27a2116b676) }},
+  {{ UINT64_C(0xb8c41476f3bad8b4), UINT64_C(0xb48083628f3dfc47), UINT64_C(0x028fbd0ce7bd16fd), UINT64_C(0xcb93d24322da0a60) }},
+  {{ UINT64_C(0x370b1dbe02723a74), UINT64_C(0xc3cfe71861014240), UINT64_C(0xa564aeec067680eb), UINT64_C(0x748501182bdeed4d) }},
+  {{ UINT64_C(0x222f89acd52de492), UINT64_C(0xb42b648ec561a207), UINT64_C(0xe87f16e52c4c008c), UINT64_C(0x6ed20b3ebf66d91d) }},
+  {{ UINT64_C(0x5769e10219bd0dbc), UINT64_C(0xd6eb2109a929d30b), UINT64_C(0x3600ea8e163c5a3a), UINT64_C(0x86d115e38b99fe74) }},
+  {{ UINT64_C(0x410a9c2d49426d0e), UINT64_C(0x34c31d55de3c6886), UINT64_C(0x02c9d4b2138c2452), UINT64_C(0x45807b802e24ad25) }},
+  {{ UINT64_C(0x0c805ba6e60be46a), UINT64_C(0x8d2b4b2f1f7ea3c0), UINT64_C(0xd9c384d7c377489e), UINT64_C(0x14cd52b0ce78221c) }},
+  {{ UINT64_C(0xf8d69816f0211ef6), UINT64_C(0x0a88e25abc0437f6), UINT64_C(0xe1bc4c12a16603ec), UINT64_C(0x43e0eb2fb7779315) }},
+  {{ UINT64_C(0x5c2ec9de7b65f96a), UINT64_C(0xa11fb10ab8c105da), UINT64_C(0xae322c9a42cd0c2c), UINT64_C(0x37c5b77a611485f0) }},
+  {{ UINT64_C(0xac709ac58fb7eee4), UINT64_C(0x129d446d23d3fb74), UINT64_C(0x2412f49e637378c5), UINT64_C(0x30d866a4e4a07f3f) }},
+  {{ UINT64_C(0x9096d7f9011a2d5e), UINT64_C(0x471831af5a74a731), UINT64_C(0x37c900b737bdd250), UINT64_C(0x7b3d97c8cb2a85be) }},
+  {{ UINT64_C(0x83225add88323eb6), UINT64_C(0xe6bec6231a8176e7), UINT64_C(0x0e21e3a6cfa72a41), UINT64_C(0x2ea698b3bb3cf603) }},
+  {{ UINT64_C(0xed95c746610aaf32), UINT64_C(0x91aef5a2459d5d93), UINT64_C(0xcf5c32d57360c728), UINT64_C(0xcc5350c31bf7526f) }},
+  {{ UINT64_C(0x4a4716b180ecc6c2), UINT64_C(0x9261400b0220c2e5), UINT64_C(0xb028c7a09fcc789c), UINT64_C(0x22df730eb6d2f860) }},
+  {{ UINT64_C(0xb95df5a4367cd838), UINT64_C(0xe650ee13033337e8), UINT64_C(0x9f47c6c7bfb5a85d), UINT64_C(0x26b5be33adc08a53) }},
+  {{ UINT64_C(0x5d3e9c684e326318), UINT64_C(0x345ea3e2bd03e19b), UINT64_C(0xba6dde8794b6775a), UINT64_C(0x092b7962a59e069b) }},
+  {{ UINT64_C(0xeb72554275051dac), UINT64_C(0x89fc2665c8fa69cc), UINT64_C(0x8851113b9420676a), UINT64_C(0xbd287f0fa0a86439) }},
+  {{ UINT64_C(0xcc5b6bb39fe9c6f6), UINT64_C(0x2b9620d985d3bf61), UINT64_C(0xa4778f459ca41bff), UINT64_C(0xdc897ad2d9fcf219) }},
+  {{ UINT64_C(0xe6d53c1ee345cae2), UINT64_C(0xf0dd395d68e3fbab), UINT64_C(0xb9ec9269fb0071ad), UINT64_C(0x0f507a767e2d5480) }},
+  {{ UINT64_C(0x0adfc298833ed866), UINT64_C(0x04789a1641c5b9b4), UINT64_C(0x5adfee2a64f29535), UINT64_C(0x5795a2a9c7ba11b4) }},
+  {{ UINT64_C(0xd74b46c3ec48c2c6), UINT64_C(0xb3ce2eb16bf35b7d), UINT64_C(0x71d2a4f861b5c5d5), UINT64_C(0xc46035eeaa913c77) }},
+  {{ UINT64_C(0xee64c0be3d74cece), UINT64_C(0xf84d3a041f5dcbb9), UINT64_C(0x0b7bc4151c9dddc2), UINT64_C(0xa4444a3dbf8b3340) }},
+  {{ UINT64_C(0x5ab0f598fa97a602), UINT64_C(0xe2b0fb40ac92060b), UINT64_C(0x7636f3c0dd98074a), UINT64_C(0x7d0bad046756a446) }},
+  {{ UINT64_C(0x46939d02f84c765e), UINT64_C(0x87d1a1d674692da3), UINT64_C(0x6d061d6d882432ef), UINT64_C(0xfb18d9b745975e35) }},
+  {{ UINT64_C(0xd5567b630b1ed5d4), UINT64_C(0x5ed666e38793ee28), UINT64_C(0xbbab1919840114c9), UINT64_C(0x81f988b5291318e5) }},
+  {{ UINT64_C(0xd46776b47ce94a64), UINT64_C(0xf665bb363e57b373), UINT64_C(0xb9b46b185edc1008), UINT64_C(0x52418196bcfd0e8c) }},
+  {{ UINT64_C(0x1eef266d7b7eb8a0), UINT64_C(0xedff995c0f35f047), UINT64_C(0x0bd9f17ddd24d3aa), UINT64_C(0xd426b53e58115c1a) }},
+  {{ UINT64_C(0x315e41c6097b34d2), UINT64_C(0x3b1ad6a3b7d0d3c7), UINT64_C(0x10b4a70b8f82b84e), UINT64_C(0x704570c473cee203) }},
+  {{ UINT64_C(0x2b9c6e2afcd82712), UINT64_C(0x312114d1c6931621), UINT64_C(0xd61f40afc7bce176), UINT64_C(0xe0f662613c4dfbc0) }},
+  {{ UINT64_C(0xf392dc780c9a3564), UINT64_C(0x06cce9ac71b22f73), UINT64_C(0x676ca61df5567109), UINT64_C(0x015773889980186c) }},
+  {{ UINT64_C(0xde8d81a590f00954), UINT64_C(0xe03c6ebb4017e604), UINT64_C(0xae02480087fd5e3b), UINT64_C(0x61cf3654bda05c4f) }},
+  {{ UINT64_C(0x046aad8f426c685c), UINT64_C(0x7ec905b4111fd17b), UINT64_C(0x494201598c92943a), UINT64_C(0xf456174d0af9990c) }},
+  {{ UINT64_C(0x1dddd20155595d58), UINT64_C(0x98fb31b802fc03aa), UINT64_C(0xcacbb13d396e736d), UINT64_C(0x94f3fc00de66f818) }},
+  {{ UINT64_C(0xd8d1ca3ee8b2e584), UINT64_C(0xb07e8a94ca3d03b1), UINT64_C(0xb3aff569fc0f23cf), UINT64_C(0x4800c8985fb06564) }},
+  {{ UINT64_C(0x7b6ea191b88bb69c), UINT64_C(0xb3bd04448a2e7dbb), UINT64_C(0xbe594a28c4f933fe), UINT64_C(0x6edfec93979888e5) }},
+  {{ UINT64_C(0x19aecb1e8d3e47f2), UINT64_C(0xe87386dc40f83884), UINT64_C(0x80c2b1d2a525ae7f), UINT64_C(0xccd38557df5ca883) }},
+  {{ UINT64_C(0xc379d13a6df2c854), UINT64_C(0xa016b77a1006e1c5), UINT64_C(0xbefac3344836def4), UINT64_C(0xf74671e90ed7b85d) }},
+  {{ UINT64_C(0xe877ffe9966e40de), UINT64_C(0x0a26e5937e6c9b4e), UINT64_C(0x0a1510b37617675e), UINT64_C(0xe409412140c67017) }},
+  {{ UINT64_C(0xa92d061b62e642cc), UINT64_C(0x2a22b96d17fabd71), UINT64_C(0x33f576ec72f3ae6e), UINT64_C(0xd2db1c12096d1094) }},
+  {{ UINT64_C(0x15d629c7d9623268), UINT64_C(0x46540e1d2f1ba081), UINT64_C(0xb632866459c453a6), UINT64_C(0xe10fc20688d1016b) }},
+  {{ UINT64_C(0xa8ee3cb8f7241e90), UINT64_C(0x6d7d74cc1965ab22), UINT64_C(0xf491d179373f41e3), UINT64_C(0xc5023aa71fa367eb) }},
+};
+
+static const mzd_local_t K_2[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0xfee0f0f93541e880), UINT64_C(0x6a7ce9f5800de8d1), UINT64_C(0x830a69b2a18b7f07), UINT64_C(0x3537a22d5149aec8) }},
+  {{ UINT64_C(0x5e1b2bdf1ee61c32), UINT64_C(0xa0a1e3b66f2c5524), UINT64_C(0x0790ecf180ebbc58), UINT64_C(0x30d0860a0575a919) }},
+  {{ UINT64_C(0x385cd047b3912dba), UINT64_C(0xf7899bd88fc05a83), UINT64_C(0xbbda953c8e95f598), UINT64_C(0x513838f55ede8269) }},
+  {{ UINT64_C(0xc8327f340f1d4fea), UINT64_C(0x39f7e9a981a55181), UINT64_C(0x04fb0eb8bb26f4c0), UINT64_C(0x1fd623efc7fb1b07) }},
+  {{ UINT64_C(0xb30976fd25ea3206), UINT64_C(0x47b03f0ec4e24e8c), UINT64_C(0x5c723006c37b3730), UINT64_C(0x694940c8b8cb5c36) }},
+  {{ UINT64_C(0xf0cb02f3281a4584), UINT64_C(0x1d52ca41ea1a06ac), UINT64_C(0x523c37fdbd69d722), UINT64_C(0x7659a86490833f4d) }},
+  {{ UINT64_C(0x29d54af4059c27e4), UINT64_C(0x424ac5471fd43100), UINT64_C(0xc81be0bbfd6d2d0b), UINT64_C(0xb9f7e85d65e5dc2c) }},
+  {{ UINT64_C(0x93089107296febd4), UINT64_C(0x46e16080c6ac377b), UINT64_C(0x713c8d0d57113e8a), UINT64_C(0xd08c52102600ba77) }},
+  {{ UINT64_C(0x8e6bd24bf51338ca), UINT64_C(0x0b3e12743403e942), UINT64_C(0x7d890db936cb1cb9), UINT64_C(0x03b283c6c56ba96d) }},
+  {{ UINT64_C(0xf84885601fc9f2ee), UINT64_C(0x6f6f9002075e9024), UINT64_C(0x36d9005ce9243956), UINT64_C(0xe6b47698910652bd) }},
+  {{ UINT64_C(0xe30dd92b98f69d4e), UINT64_C(0xed366d27e006847f), UINT64_C(0x64194742d6f30281), UINT64_C(0x29e0dfac3d9978cf) }},
+  {{ UINT64_C(0xe928b6e44a28bd2e), UINT64_C(0x91c85afc43ec7ca0), UINT64_C(0xd7d086608823ae6d), UINT64_C(0xaa7d03d65ce4c021) }},
+  {{ UINT64_C(0x6e19a2a7ca6adc7c), UINT64_C(0x08849dc46c7d3a5d), UINT64_C(0xb60a11a09f211e2b), UINT64_C(0x0fc76171af5aa596) }},
+  {{ UINT64_C(0x808d91dcbe4a1b00), UINT64_C(0x594dfbcec35ef149), UINT64_C(0x973ada504dac0b3c), UINT64_C(0x1cf00331d518ab9a) }},
+  {{ UINT64_C(0x81afea76aa01c16c), UINT64_C(0x05cfc71f2f97493e), UINT64_C(0xc9f2a713c96284e2), UINT64_C(0x19db914b01cedbe5) }},
+  {{ UINT64_C(0x3415dba5d70c1bce), UINT64_C(0x93e01c1026a930b7), UINT64_C(0x96e18e76cde46fe1), UINT64_C(0x9bf5b832d0f6453a) }},
+  {{ UINT64_C(0xb017792d4173f426), UINT64_C(0x5b1e3b3e0220d6c3), UINT64_C(0x71e959db8602ea01), UINT64_C(0x49b1b744edd329be) }},
+  {{ UINT64_C(0x96d528f341c09958), UINT64_C(0xd24a6fd893c19afe), UINT64_C(0xa29ceba06c277270), UINT64_C(0xdc49b2efde650be7) }},
+  {{ UINT64_C(0xe303bb988c44351e), UINT64_C(0xb51ac76fc48c8bc9), UINT64_C(0xca6ac3c410be238c), UINT64_C(0x34fe8f3c90c03e4b) }},
+  {{ UINT64_C(0x12bda8acab80a222), UINT64_C(0xcbec586354e81112), UINT64_C(0x925437c22e86c9d3), UINT64_C(0x44733dd35ee4f4d4) }},
+  {{ UINT64_C(0x9402e91a9670336c), UINT64_C(0x51be8ec88d22d49b), UINT64_C(0x8dc94bb612b55156), UINT64_C(0x134c9f3eff4157f1) }},
+  {{ UINT64_C(0xfc77fdae9903dcc0), UINT64_C(0xebff64a0893e83c3), UINT64_C(0x415e4022465b64a8), UINT64_C(0x0427bd1b6798e138) }},
+  {{ UINT64_C(0x23c28a2e380e02cc), UINT64_C(0xb48f5311e67a8246), UINT64_C(0x13f75b8e86a1dc4b), UINT64_C(0xcf73c2c70bf3b810) }},
+  {{ UINT64_C(0x6b45dbf24ecac8c2), UINT64_C(0x8267d9ba12b0e00e), UINT64_C(0xb4d0241c425259bb), UINT64_C(0x86051a3814b2d893) }},
+  {{ UINT64_C(0xf185225df1abda62), UINT64_C(0x42bec63b3795556c), UINT64_C(0x59db9cb95b25143c), UINT64_C(0x74bf1d1828811760) }},
+  {{ UINT64_C(0x11621d5fb8281c02), UINT64_C(0x0bfdfa4cfae711af), UINT64_C(0x5ad1852292486f89), UINT64_C(0x31d0285f3fe0aee0) }},
+  {{ UINT64_C(0x0f5ba2f5f881232a), UINT64_C(0x7efff766fd44d9b7), UINT64_C(0xac4f153d7340f0e4), UINT64_C(0x92a91720a08205a0) }},
+  {{ UINT64_C(0x5226d188a7e91998), UINT64_C(0x69eb597fe248ded2), UINT64_C(0xdc3ac93d595fa77e), UINT64_C(0xf854f04a7141c26f) }},
+  {{ UINT64_C(0x7da7335c676eb36e), UINT64_C(0xdaa29fe94792aff3), UINT64_C(0x4e8176062fa6cd1b), UINT64_C(0x9628c7e5cac89740) }},
+  {{ UINT64_C(0x67bc667444b89a58), UINT64_C(0x87885fcb76be13f1), UINT64_C(0x7aa087247cd64fb8), UINT64_C(0x893941bbc258fd68) }},
+  {{ UINT64_C(0xee7ab13182320714), UINT64_C(0x78fffe07b705a3b4), UINT64_C(0xcf9548cc65eff9f0), UINT64_C(0x4ff394a9f1184bcc) }},
+  {{ UINT64_C(0xea8dd1a3749c0aee), UINT64_C(0x7e2ffb0b0aa8dff8), UINT64_C(0x805a9cb64d343fa0), UINT64_C(0x2e41fea4959499e0) }},
+  {{ UINT64_C(0x6df05aec55ed92a2), UINT64_C(0xb099707c3e2e0597), UINT64_C(0xe2f4b8b39bc20870), UINT64_C(0x4b061a971ee473f4) }},
+  {{ UINT64_C(0x3a3c19649f4cb568), UINT64_C(0x0da4a579f5bae110), UINT64_C(0xab9e7b0ab3f76981), UINT64_C(0xa701a1279985ccae) }},
+  {{ UINT64_C(0x9aced3fee94c8a36), UINT64_C(0x275fde3e409efd50), UINT64_C(0x53430e22276309ad), UINT64_C(0xabcba10d6fefd7e6) }},
+  {{ UINT64_C(0x43e10547cb76b1c0), UINT64_C(0x1d3e6eb782191a3f), UINT64_C(0xdc84dbdcd70b4602), UINT64_C(0xcd8df2db1e5032d9) }},
+  {{ UINT64_C(0x410425085fd1f2aa), UINT64_C(0x3435b60a7a749795), UINT64_C(0x68384f3f07e5064e), UINT64_C(0xb7915fc312c6af7a) }},
+  {{ UINT64_C(0x59319f902c490e74), UINT64_C(0xaf820ffa0ae588ab), UINT64_C(0xec202229b503617e), UINT64_C(0x272db428023e7ae3) }},
+  {{ UINT64_C(0x89401537962aa942), UINT64_C(0xfc0a1f496c18bf89), UINT64_C(0x34dc748b064c6d58), UINT64_C(0x9aca23f5d6129a87) }},
+  {{ UINT64_C(0x7b18952f90d44096), UINT64_C(0xef91c27b2eccc91d), UINT64_C(0xb5bdf7a9bc5760a1), UINT64_C(0xb51c74df6935a113) }},
+  {{ UINT64_C(0x3666bcd62681deb4), UINT64_C(0x6c2fa712240b8098), UINT64_C(0x92025f09ad126fc3), UINT64_C(0x8a5f7d8bf5331b92) }},
+  {{ UINT64_C(0xc993edbeec65f6d4), UINT64_C(0xf2cb7085536d68b2), UINT64_C(0x7a6a424440ed97ca), UINT64_C(0x1f8788586eba25da) }},
+  {{ UINT64_C(0x5f4bcebd7db54d58), UINT64_C(0xd0e9e19aefae3709), UINT64_C(0x9d6ea9279463f30e), UINT64_C(0x586c142f949b9eaa) }},
+  {{ UINT64_C(0x34dc37e8acce3af2), UINT64_C(0x81f0927ef2f2a331), UINT64_C(0xa1f1749e57630bd4), UINT64_C(0x4c427050e0c07d0b) }},
+  {{ UINT64_C(0xe2c374e0db81e976), UINT64_C(0xcced6382ab0a8ca2), UINT64_C(0x83eaf1fd65cd5920), UINT64_C(0x51fd787c6543b683) }},
+  {{ UINT64_C(0x6c7e5c999d9b8194), UINT64_C(0x2a02b7b0586d2173), UINT64_C(0xc7672715f7e2056f), UINT64_C(0xc385a9be7e16b173) }},
+  {{ UINT64_C(0x91ab1f6288524c42), UINT64_C(0x8751b9438102af3b), UINT64_C(0x98203335d6452a60), UINT64_C(0x6f20e72c52e16339) }},
+  {{ UINT64_C(0xdce2ac994e614b50), UINT64_C(0xa945835de3478704), UINT64_C(0x23fd004fb122a5e9), UINT64_C(0xed6aab14067f4125) }},
+  {{ UINT64_C(0x7fe187315d76b46e), UINT64_C(0xcafa7ff0d3023ee5), UINT64_C(0x1fed716946c652ef), UINT64_C(0x1259740af5483a6d) }},
+  {{ UINT64_C(0x396cc8ec6cde481a), UINT64_C(0x31c1a869f94cca62), UINT64_C(0xaa2735bf8f61407d), UINT64_C(0x16e04c6bce5c6180) }},
+  {{ UINT64_C(0xe4289803e17f7f44), UINT64_C(0xfdd490dc69b05e55), UINT64_C(0xaa72069a5818f2a6), UINT64_C(0xfb38c2e0dcc12a7e) }},
+  {{ UINT64_C(0xa67f55b9f786dc5a), UINT64_C(0xb356cd6c1a8c8daf), UINT64_C(0xf6509a883ca1e7ab), UINT64_C(0x1524e1efcea0d88d) }},
+  {{ UINT64_C(0x856f70cb6f8b53f6), UINT64_C(0xa44d22f970377248), UINT64_C(0x31f41fe547de0d71), UINT64_C(0x94c83d4cf8167a74) }},
+  {{ UINT64_C(0xfd58c2e4c587a200), UINT64_C(0xc72a310f877fef4e), UINT64_C(0xb025cb510aa985d6), UINT64_C(0x4bd303b7e4bb9793) }},
+  {{ UINT64_C(0xd5848730bed819ae), UINT64_C(0x9e3c06183c5050af), UINT64_C(0xeab249349262f9ac), UINT64_C(0xcf6fbd1ebe0843e9) }},
+  {{ UINT64_C(0x8176defaaff19d3a), UINT64_C(0x30ea9693eabdf8d0), UINT64_C(0xc15b8934146c9737), UINT64_C(0xca45b716d0eb38c7) }},
+  {{ UINT64_C(0x1d54a525596ef140), UINT64_C(0x77a54789ade38114), UINT64_C(0xbef6b5982a5e7d3c), UINT64_C(0xeb49c9b9f56c2904) }},
+  {{ UINT64_C(0xe9d9d9df0e5f2130), UINT64_C(0xcb38b291e032d0fa), UINT64_C(0x9a631d7638e845cf), UINT64_C(0x1e8fd15ecc767791) }},
+  {{ UINT64_C(0x9970daae61568a08), UINT64_C(0x48a1877f12cdc4fd), UINT64_C(0xd6fecb810fd9f374), UINT64_C(0xd8b97124fe3d72a6) }},
+  {{ UINT64_C(0xa7e5711e6902b088), UINT64_C(0xa8c3aaa2d866b43c), UINT64_C(0x1726faa19305cd40), UINT64_C(0x42ef1bd55166e1dd) }},
+  {{ UINT64_C(0x3bda23891b97ab0e), UINT64_C(0xa160d7bcdb5ba9e0), UINT64_C(0x8b0b6f5a847e9f6f), UINT64_C(0xb3f1a74e874277fc) }},
+  {{ UINT64_C(0xb31190c00cbae42a), UINT64_C(0x154b53c09f9cd681), UINT64_C(0x82263a8a3403de55), UINT64_C(0x675e28d4439c371a) }},
+  {{ UINT64_C(0xe8d105a124ebc6d6), UINT64_C(0xccf22cb98f03bc42), UINT64_C(0xaae5d5b54bb50895), UINT64_C(0x11b8565ce0da685f) }},
+  {{ UINT64_C(0x2b2d78163dc44b24), UINT64_C(0x0a882d6ffff9b48f), UINT64_C(0xcb6085da1a7de25c), UINT64_C(0x1d6429f639b94c65) }},
+  {{ UINT64_C(0xdf285b1a049575d2), UINT64_C(0x75962353cc51987f), UINT64_C(0x8c1c54720923ba89), UINT64_C(0xb69e6fcffd885783) }},
+  {{ UINT64_C(0xb782fa7b903019da), UINT64_C(0xa32565665eea3c0f), UINT64_C(0xf1a3648c09e9ea21), UINT64_C(0xd71e02e733a259cf) }},
+  {{ UINT64_C(0x0e8e6f7d335cfcc4), UINT64_C(0x2d57a30405f8e496), UINT64_C(0xe3305348efddf960), UINT64_C(0x213f0d828123b1e5) }},
+  {{ UINT64_C(0xbeabd03e5d9291aa), UINT64_C(0x885d0cbfa32de543), UINT64_C(0x82e8c8ddf47d29d4), UINT64_C(0x5cb6993ead81e441) }},
+  {{ UINT64_C(0xcf2c9d762a0b0a82), UINT64_C(0xb511fdc201090ed9), UINT64_C(0x14694d7dd3d03ae1), UINT64_C(0xba6f662d91f890c2) }},
+  {{ UINT64_C(0x35619daa0eaaf93c), UINT64_C(0x2dcf927c48cb3ddb), UINT64_C(0x05a27beb511283b1), UINT64_C(0x7e8f613c0597cb4b) }},
+  {{ UINT64_C(0x198d6aab5b47b664), UINT64_C(0xe6354ce443e69de3), UINT64_C(0x429714953f5da7c6), UINT64_C(0x58db6e27e87cc6d7) }},
+  {{ UINT64_C(0x071705db1c6c8768), UINT64_C(0xabd4ec4aca14dbb5), UINT64_C(0xc6c6cea716fa2b46), UINT64_C(0xc59b5313f9a220c6) }},
+  {{ UINT64_C(0x002b4e6b37da42b2), UINT64_C(0x042b3cd3c1e1c5ec), UINT64_C(0xe8d652ff23dccef5), UINT64_C(0x83b7a8ac84eeee08) }},
+  {{ UINT64_C(0x3116f97d6e71c320), UINT64_C(0xc9862160944823a1), UINT64_C(0x5b271b08a26e72f9), UINT64_C(0x1f6327738c777498) }},
+  {{ UINT64_C(0x9da63481d80d5f2c), UINT64_C(0xe04884e88e3ed4f0), UINT64_C(0x280875bd7bfca95b), UINT64_C(0xfdba1d8cbaba7778) }},
+  {{ UINT64_C(0xea289d372a6d7182), UINT64_C(0xc517de683b5773d5), UINT64_C(0x90122c56b072787f), UINT64_C(0xf9a5398a98186b5d) }},
+  {{ UINT64_C(0xd68da0e8495a2a58), UINT64_C(0xd8c053cdebdef0ce), UINT64_C(0xaf0290aa9f0a21fb), UINT64_C(0xd20674d969bd3a86) }},
+  {{ UINT64_C(0xf2e83e3af85573fe), UINT64_C(0xbfb3cd761c8925d7), UINT64_C(0xdb5aabe1263db42b), UINT64_C(0x840cd0e8c6fc1f5b) }},
+  {{ UINT64_C(0x0456ae0242669e36), UINT64_C(0xaad988695c358753), UINT64_C(0xe4357d18100be41d), UINT64_C(0x955104c9d3d9c28f) }},
+  {{ UINT64_C(0x83adadd2d12b9e00), UINT64_C(0x4d829b4ec6e5ba01), UINT64_C(0x5f53de53aaec56c4), UINT64_C(0xb03c988ae8f3f0bf) }},
+  {{ UINT64_C(0x79a54cdddb2bb312), UINT64_C(0x9f8a413992cdf0d5), UINT64_C(0x1ed88027599c32b3), UINT64_C(0x20cee8b369327bfa) }},
+  {{ UINT64_C(0x2d236bfcd690ead2), UINT64_C(0xc648fd84b809e066), UINT64_C(0xbb55e187b680c775), UINT64_C(0xc4b18e9fc954bc47) }},
+  {{ UINT64_C(0x93eab2d9c6492c86), UINT64_C(0x1698cb79c017c266), UINT64_C(0x4e60e84f78e210a8), UINT64_C(0xdd086bd128bbf060) }},
+  {{ UINT64_C(0x38bd8714088cc432), UINT64_C(0x2afedc82c1dbe290), UINT64_C(0x7af3809742a53b68), UINT64_C(0xfb7269157bb257cb) }},
+  {{ UINT64_C(0x11952b6e5fe2f294), UINT64_C(0x58b6a3d7978f7a87), UINT64_C(0x9e6f441aeff747f3), UINT64_C(0xd51866ec8349f7cf) }},
+  {{ UINT64_C(0x88f3b25cacae48b8), UINT64_C(0xda577e213bc26d27), UINT64_C(0x2318838b8f7a4b7f), UINT64_C(0x07e27fdd423427df) }},
+  {{ UINT64_C(0x76373515b5dedb8a), UINT64_C(0x61516149ba8a3976), UINT64_C(0xa1939c96451d8f57), UINT64_C(0x0afac24f64f8a32d) }},
+  {{ UINT64_C(0x55cf46b9aa5610be), UINT64_C(0x4b8b6c9b47e3cff1), UINT64_C(0x6e8b42dee355775d), UINT64_C(0x4c979b8e93b65132) }},
+  {{ UINT64_C(0x660d47704889ba86), UINT64_C(0xb34f2563311f7029), UINT64_C(0x8f5b608b8057b992), UINT64_C(0x67912dfc9f1701de) }},
+  {{ UINT64_C(0x70017e9cc31593c6), UINT64_C(0x1bc0f2d295c936aa), UINT64_C(0x102b4104b1e2d9c6), UINT64_C(0x39fac94e8b981540) }},
+  {{ UINT64_C(0xa2bbdd3aef1dce68), UINT64_C(0x83d65eaa579a9f4c), UINT64_C(0x07a46716befa80ea), UINT64_C(0x3ae3d4445c098bbb) }},
+  {{ UINT64_C(0x0d8b526a4c7c5c66), UINT64_C(0xa5db445339d91a85), UINT64_C(0x77c5849e7c9bba7a), UINT64_C(0x78f29dd290a4b914) }},
+  {{ UINT64_C(0x7c5377d88b2d3ffe), UINT64_C(0xece8b82c36f7f22b), UINT64_C(0xb3df15ad6d1b9a75), UINT64_C(0xb8c1d38afd1284b5) }},
+  {{ UINT64_C(0x663bd424aa959cba), UINT64_C(0x32c586c430a92c2b), UINT64_C(0x119a438ba4ce4400), UINT64_C(0x4c9010279d56da90) }},
+  {{ UINT64_C(0xd9fd7a0179bfa36e), UINT64_C(0x80bb57b1154bf610), UINT64_C(0xf97308890333e507), UINT64_C(0x3706254ab54f0737) }},
+  {{ UINT64_C(0xd75830f4e2b8fa8e), UINT64_C(0x337c9fdc8ef4dd3e), UINT64_C(0x854044c99dc7bc72), UINT64_C(0x1b6d156d650fd1f2) }},
+  {{ UINT64_C(0xfa4af16e36bc920e), UINT64_C(0x0f1a3096bc870087), UINT64_C(0x832659c5a18abcbc), UINT64_C(0x1df0cafce5bccc08) }},
+  {{ UINT64_C(0x07b0e75003d644a6), UINT64_C(0x74130c2ea344f364), UINT64_C(0x33aff5317c5552ad), UINT64_C(0x230fa5bce56b346b) }},
+  {{ UINT64_C(0x97d4c11cfeff692e), UINT64_C(0x6e1ec66eb7dbf5bf), UINT64_C(0x433a14dab5596771), UINT64_C(0x8ad7c0a93d94f4dc) }},
+  {{ UINT64_C(0xc70389bdde9c9420), UINT64_C(0xa86fe52c5f8001c6), UINT64_C(0x64f86c56d3682a28), UINT64_C(0x400dfc3663a5809d) }},
+  {{ UINT64_C(0x584081118511e382), UINT64_C(0x8ea2dee7b9b10266), UINT64_C(0x1b96d154cd9b4052), UINT64_C(0x60608f512ff9a9c1) }},
+  {{ UINT64_C(0x810dc8b27000cd9e), UINT64_C(0x00d3899e70e9a8ad), UINT64_C(0x3cee23701ca82100), UINT64_C(0x38a8b16c0f0b3d7b) }},
+  {{ UINT64_C(0x5c8a625d6e7da622), UINT64_C(0x3d93c944e37c836c), UINT64_C(0x9207a302897aa391), UINT64_C(0xa129fafd38c505da) }},
+  {{ UINT64_C(0x0a742892d2b22b60), UINT64_C(0xf09b95991e0267bc), UINT64_C(0x6b2287b3630453ea), UINT64_C(0xfec36966d6b900c7) }},
+  {{ UINT64_C(0x9fd4ee3a06475032), UINT64_C(0x129bf634d4d127a4), UINT64_C(0x6141c0e109892f03), UINT64_C(0x31f23563be408528) }},
+  {{ UINT64_C(0x59ba85e07271c3d2), UINT64_C(0xacc2ef79bd84b7a9), UINT64_C(0xbfe4474ad3b0bb35), UINT64_C(0x0809ad309806c3fc) }},
+  {{ UINT64_C(0x1cb1fa958f07e5e8), UINT64_C(0x9737ce16ce72ae2d), UINT64_C(0x7c59a0bad9b71395), UINT64_C(0x154c9f5bc30f00df) }},
+  {{ UINT64_C(0xbd8b853933a27fbc), UINT64_C(0x2ee8feb67b25a62a), UINT64_C(0xe6ea5719078ab5ee), UINT64_C(0x18d5e1c69ab977a2) }},
+  {{ UINT64_C(0xbdd6b1029dd6af1e), UINT64_C(0xfea1360dda01917e), UINT64_C(0x511c4de3dbf6c0c8), UINT64_C(0x72ff15d93e7d60fc) }},
+  {{ UINT64_C(0x641ff011291e2f6e), UINT64_C(0x294f4c534345a837), UINT64_C(0x5bf9ab50c09e8b12), UINT64_C(0x953bc446b58c5cbb) }},
+  {{ UINT64_C(0x37070b20818a9b62), UINT64_C(0x30b5f6aed97942f3), UINT64_C(0xe0f9284f3507f3e2), UINT64_C(0xb825aa42f00d698a) }},
+  {{ UINT64_C(0x55b5e29df7612316), UINT64_C(0x2c6f52bdc717e68b), UINT64_C(0xf82ca1c9a04b01e4), UINT64_C(0xabc50e3d2848db53) }},
+  {{ UINT64_C(0xb1b8037bf41a7c20), UINT64_C(0x5f41e073931a936b), UINT64_C(0x00bcf0cf2f7168b4), UINT64_C(0x2db3de64f2c471fb) }},
+  {{ UINT64_C(0x71e3dceb3e03d7ac), UINT64_C(0xa1696c2e095f7299), UINT64_C(0x8b89fd134d692e69), UINT64_C(0xe8d52ef0a91fab5c) }},
+  {{ UINT64_C(0xdc11cd821bbac648), UINT64_C(0x935f274701b40c83), UINT64_C(0x7fd6c50d2dbaf693), UINT64_C(0x47dc4df9d6d23563) }},
+  {{ UINT64_C(0x5d9ea97430c169c8), UINT64_C(0x68a3f5689e3782df), UINT64_C(0x909d73d26441eeb4), UINT64_C(0x12f6c065375fb76e) }},
+  {{ UINT64_C(0x08a5dff12d5ba69c), UINT64_C(0xdf78adf4c28520f8), UINT64_C(0x03d054b3e4a28ff9), UINT64_C(0x861360ba2ff78570) }},
+  {{ UINT64_C(0xab1ce7ce175a4bce), UINT64_C(0xb738f4fb81449d35), UINT64_C(0xa9f80238934f19f0), UINT64_C(0xce89fde10c83b0d6) }},
+  {{ UINT64_C(0xa69cace586c63e90), UINT64_C(0x2dc9310a520d93e6), UINT64_C(0xceed140e8d5fe2e8), UINT64_C(0x34fe72dbb5536773) }},
+  {{ UINT64_C(0x36aa157ac37c27ba), UINT64_C(0xc94030f53695f1db), UINT64_C(0x133f06eb479a39a2), UINT64_C(0xb052314f02009c10) }},
+  {{ UINT64_C(0xf66b2ab023016158), UINT64_C(0x13f2fc13a6a9d10a), UINT64_C(0x96fdec97d3f97852), UINT64_C(0x79450b1d517d589e) }},
+  {{ UINT64_C(0xa5342ac68fe07fca), UINT64_C(0x1c8f27b651f6df78), UINT64_C(0xba108153469b98f6), UINT64_C(0xf2acdb769f066060) }},
+  {{ UINT64_C(0xb5f4dfd529981e82), UINT64_C(0xe8f89f68acc9779b), UINT64_C(0xee2c6f679254182a), UINT64_C(0x92323625eb783ada) }},
+  {{ UINT64_C(0x425acce7571d6ea8), UINT64_C(0x3dae9bb506efd05e), UINT64_C(0xd0dc735314db1926), UINT64_C(0x53adb2100108e8ed) }},
+  {{ UINT64_C(0xd057d16f425faf4c), UINT64_C(0xad6685a9b9a0c65c), UINT64_C(0x4f74466eef741056), UINT64_C(0xf84407f45c3dd01f) }},
+  {{ UINT64_C(0xb77f06886bc00fa2), UINT64_C(0x9ccdb759d4a6784c), UINT64_C(0xf6464450f71a4682), UINT64_C(0x9e5fea682c381d2f) }},
+  {{ UINT64_C(0xfc6d3d5d9217cdee), UINT64_C(0x115f15f5405e2fe1), UINT64_C(0x66bf948c52c31600), UINT64_C(0x1b840da0ee01021f) }},
+  {{ UINT64_C(0x3a379157a8fed2b2), UINT64_C(0xaef4476c444ebac1), UINT64_C(0x8c84a85bd5219ba7), UINT64_C(0xd6c8e98575bca39c) }},
+  {{ UINT64_C(0x67a4218fd016e54c), UINT64_C(0x4b4f3e62f614036f), UINT64_C(0x1c9b0eab35938135), UINT64_C(0x020225155503f423) }},
+  {{ UINT64_C(0x1f08a7f6b6f0646a), UINT64_C(0x4d0d09a4e26e47e7), UINT64_C(0x1dbe2d4a4b3b2eea), UINT64_C(0x55de7c2442745c1b) }},
+  {{ UINT64_C(0xc5b2e26b43b2b282), UINT64_C(0xef576e619f38aa29), UINT64_C(0xb72f7bdb01b27c71), UINT64_C(0xfd85f061e6b42f7a) }},
+  {{ UINT64_C(0xf09c8409f01248f8), UINT64_C(0xb3a48a0829424f72), UINT64_C(0xf325f60e9b085eae), UINT64_C(0x2fa9b647b7971178) }},
+  {{ UINT64_C(0x09980181ad5a9f14), UINT64_C(0x0ff46e61a862bc4f), UINT64_C(0x621f013316824f74), UINT64_C(0xe1188b4ca0be9de6) }},
+  {{ UINT64_C(0x55596c2c656785dc), UINT64_C(0xe9cb5ce0cebddba5), UINT64_C(0x5e20cf773bb77617), UINT64_C(0x4497b958dba6d8ab) }},
+  {{ UINT64_C(0xc891f4f339a7357e), UINT64_C(0x80660801e71e10af), UINT64_C(0xf265bee2da567cef), UINT64_C(0xa81616218d798844) }},
+  {{ UINT64_C(0x4cefd4a3169e79e4), UINT64_C(0x83b61f9a6a09d3e9), UINT64_C(0xeee7ada7bfdd6615), UINT64_C(0x0c5d13ccddc4c416) }},
+  {{ UINT64_C(0x882b60ff9e7d61a2), UINT64_C(0x7e8eb98cf4065f6f), UINT64_C(0x8377bfed7e34e776), UINT64_C(0x1d550b01f66f46a5) }},
+  {{ UINT64_C(0x5d9b47f49a22e820), UINT64_C(0xc6a118ff8d978fd2), UINT64_C(0xe4b5e0d2b44eca93), UINT64_C(0x64469ef29a38fad9) }},
+  {{ UINT64_C(0x4a98d60543631cb6), UINT64_C(0xa16adde9afa7d244), UINT64_C(0x5ec077e7d104c54f), UINT64_C(0xc333a5712ec2c911) }},
+  {{ UINT64_C(0xd54e9525c70dd6d8), UINT64_C(0xb2af356231c8b620), UINT64_C(0xd874be7b11c1ccb8), UINT64_C(0x222678f497395a94) }},
+  {{ UINT64_C(0x64f07b07256d2d9e), UINT64_C(0x473c295271237896), UINT64_C(0x42208208fb1e0eb9), UINT64_C(0x92e3bd53a7658b17) }},
+  {{ UINT64_C(0xaa3e6ba2ab479072), UINT64_C(0x6278ad818adaafae), UINT64_C(0x1ab0289b2d4fb262), UINT64_C(0x19b72d8f775aed51) }},
+  {{ UINT64_C(0xb09a7270392dc04c), UINT64_C(0x743c441d1b8cee30), UINT64_C(0x5e05af6785221a51), UINT64_C(0x4a11f4eadb296938) }},
+  {{ UINT64_C(0x832db88a84f24bf8), UINT64_C(0xfa5728238949835b), UINT64_C(0xf39abad940cb6d5c), UINT64_C(0x16326bef7741f183) }},
+  {{ UINT64_C(0xeaeacc9b7e74d808), UINT64_C(0x89ceafecbf69f772), UINT64_C(0xb9b50ceeec8ac016), UINT64_C(0x5e36f5ddb294f48f) }},
+  {{ UINT64_C(0xe8612ba709b52e8c), UINT64_C(0x7eea5690a050e3d3), UINT64_C(0x0f02047c2fca0657), UINT64_C(0xa4812497c805c84a) }},
+  {{ UINT64_C(0x544af1858c51dd0e), UINT64_C(0xcabf3aade4547ba8), UINT64_C(0xa4076c383f20f3fe), UINT64_C(0x89a170cba43ae183) }},
+  {{ UINT64_C(0x533b59b56cb8003a), UINT64_C(0x7f142d986ee2c025), UINT64_C(0xa66ff9dfe6a7ee76), UINT64_C(0xa8a6ea8b91644132) }},
+  {{ UINT64_C(0xe59b78ac27868060), UINT64_C(0xc1cfbf71745e8892), UINT64_C(0x154cb14d17750c79), UINT64_C(0x4851b6ed602427e0) }},
+  {{ UINT64_C(0xcec9f38216458904), UINT64_C(0xb87a9c10c3bf5376), UINT64_C(0x7be63d8f180c6314), UINT64_C(0x94765dfef12fc612) }},
+  {{ UINT64_C(0x122fb36351bc4766), UINT64_C(0xe24ee7817685c8b5), UINT64_C(0xeae3e65e33353234), UINT64_C(0x2993d318ba644a7d) }},
+  {{ UINT64_C(0x2cfa54423f6a59ce), UINT64_C(0xe72f7fef3c1d5969), UINT64_C(0x47aa2cc8f2c908f6), UINT64_C(0x45b1b4368b5880c1) }},
+  {{ UINT64_C(0x463099fd16accc88), UINT64_C(0x715d294db22a67d8), UINT64_C(0x730707299330d492), UINT64_C(0x735fe7db89d47899) }},
+  {{ UINT64_C(0x6f537bbb166d20c6), UINT64_C(0xdb5f483b0e498b4d), UINT64_C(0x567eb4c4cb1e783e), UINT64_C(0x36581a93c8b0bec6) }},
+  {{ UINT64_C(0xbdc7db61590ea7a0), UINT64_C(0xe9d562c694bd239d), UINT64_C(0xbe00db4d84a314a8), UINT64_C(0x682a218bac606dae) }},
+  {{ UINT64_C(0x4293b774e7ff32b6), UINT64_C(0x1e6d2fe68e166ae0), UINT64_C(0xf94c487cb7df0dc8), UINT64_C(0x9247a21f463a9c2d) }},
+  {{ UINT64_C(0x8278ba165fd5f27c), UINT64_C(0x0753fc55e95e848d), UINT64_C(0xae34e91bc4fb1ec1), UINT64_C(0x446c061ca316f616) }},
+  {{ UINT64_C(0xbb662fc120731e26), UINT64_C(0xb5cef681d2e173ed), UINT64_C(0x0dcb74be06c6b824), UINT64_C(0xf572e6cf30e2b503) }},
+  {{ UINT64_C(0xaf12dd50ccd3d476), UINT64_C(0x35fabf06fea3d064), UINT64_C(0xdeda407a946976d2), UINT64_C(0xa971a556c584424b) }},
+  {{ UINT64_C(0xf6063ceedde40f88), UINT64_C(0xf429d0da809fdfd6), UINT64_C(0xa0170dfac33edfbc), UINT64_C(0x668ecd23c161501c) }},
+  {{ UINT64_C(0xb8101718074fd7f4), UINT64_C(0x3ca28d663ff27451), UINT64_C(0x69b6c44d266d152d), UINT64_C(0xd85f48257d175ea8) }},
+  {{ UINT64_C(0x9bb3bc906501a2a2), UINT64_C(0xa5f3b86482b52098), UINT64_C(0x232e86e0cab84665), UINT64_C(0x0e3b81c992b323cf) }},
+  {{ UINT64_C(0x080f77479f0c9a18), UINT64_C(0x826798952add5289), UINT64_C(0xdb46b693de23a56a), UINT64_C(0xd9648473fb165c63) }},
+  {{ UINT64_C(0xdf3b72e13dc09ece), UINT64_C(0xf62c0a9acfb77600), UINT64_C(0xbb3e57c1a9e03d0d), UINT64_C(0xf3c51331d979bfc0) }},
+  {{ UINT64_C(0x8739dd2263c1e4ba), UINT64_C(0x2f3b02b9b4f9ab9b), UINT64_C(0x6266c59833a2a2ef), UINT64_C(0x44e8b56e453da52a) }},
+  {{ UINT64_C(0xd00cf9b85049feda), UINT64_C(0x3640b4f4d832a893), UINT64_C(0x507deb5682adf07e), UINT64_C(0x6692ee38f87b5a79) }},
+  {{ UINT64_C(0x3cd1e8df891253d4), UINT64_C(0xed86c5bced908c17), UINT64_C(0x6c21be4e79e72a7b), UINT64_C(0x0f6fa290432d0ecb) }},
+  {{ UINT64_C(0x212ee3a10925aad0), UINT64_C(0xfb5d4055f58e42ec), UINT64_C(0xb7f6f46e81829e4a), UINT64_C(0xd710e29036aef0a8) }},
+  {{ UINT64_C(0x8ceb4b9cf640564a), UINT64_C(0x3750474dcf67baed), UINT64_C(0xad7e08ea3f920306), UINT64_C(0xc90c363d4e4e2c90) }},
+  {{ UINT64_C(0xc6fd4f271428970e), UINT64_C(0xeea37799fb9b03fc), UINT64_C(0x8a86fcfb1bc78c55), UINT64_C(0x6ed5bc11197b3312) }},
+  {{ UINT64_C(0x0e93eaecd7d188ec), UINT64_C(0x054b4584a5438253), UINT64_C(0xa6830a3bd3f695be), UINT64_C(0xc5602e1de76df7ba) }},
+  {{ UINT64_C(0x80d8c0bb047ab1f4), UINT64_C(0x0204f29278c672bf), UINT64_C(0x11a7a2084d4d39b7), UINT64_C(0x2888e993a4bc544a) }},
+  {{ UINT64_C(0x551b1e659c522bc8), UINT64_C(0x8136d877932c74b0), UINT64_C(0x081d69e7450a03f9), UINT64_C(0x4f3dcd9e95aa0687) }},
+  {{ UINT64_C(0x7ef843fd1199e5dc), UINT64_C(0xff97acdab358c8e9), UINT64_C(0xc1e2f75ea4644015), UINT64_C(0x23da64cf15653586) }},
+  {{ UINT64_C(0x6c9b8a8d1a4bf5b8), UINT64_C(0x8c6b73fb350a3754), UINT64_C(0x10ff3aab5a47f4c0), UINT64_C(0x727593f660ad4dbc) }},
+  {{ UINT64_C(0x3907f9cc0fd640c6), UINT64_C(0x382d8806fe155248), UINT64_C(0x5762d4c3dff3e370), UINT64_C(0x7a0ac522be06208c) }},
+  {{ UINT64_C(0xe7820991766e74c0), UINT64_C(0xacd0d49ef8bda783), UINT64_C(0xe36ab0ca5ad6fc1b), UINT64_C(0xe26d6466c1970870) }},
+  {{ UINT64_C(0x87a2110031de6524), UINT64_C(0x402c540b98f35e9d), UINT64_C(0x50e4ad0736da1435), UINT64_C(0x5423515077d3a41f) }},
+  {{ UINT64_C(0x671077e6e009645a), UINT64_C(0x5ef226374be47dac), UINT64_C(0x79cb7d47c4dfe452), UINT64_C(0xdb48d34aa40393b7) }},
+  {{ UINT64_C(0xe23828ccd51a95f0), UINT64_C(0xe3abfe71d1576436), UINT64_C(0xa062f5bf50f7d0fb), UINT64_C(0xc4f21ffbd7c8a38c) }},
+  {{ UINT64_C(0x88c82630dd8badae), UINT64_C(0x680779bc32929b7d), UINT64_C(0xdc6cf1162fd161d0), UINT64_C(0x145a31a3fbf76b15) }},
+  {{ UINT64_C(0x189e4f5fc357ac60), UINT64_C(0xf42063fd1d0fa3ce), UINT64_C(0x2bf950aee02fa0fc), UINT64_C(0x037c42f7b4423509) }},
+  {{ UINT64_C(0x7c32f7626addab74), UINT64_C(0x7edf82c50a29db0b), UINT64_C(0x535149cd511f5000), UINT64_C(0x167b924e989e1ba5) }},
+  {{ UINT64_C(0x3a4030cedc98988e), UINT64_C(0xebe21c0564b446b8), UINT64_C(0x3c145d1cc9463992), UINT64_C(0xf854c528ca894ed7) }},
+  {{ UINT64_C(0xf2e7c7231f07eed8), UINT64_C(0x6495e26c7ca5d0c3), UINT64_C(0x2f690546662f3f5c), UINT64_C(0x2923fc855fee2716) }},
+  {{ UINT64_C(0x5306909f31bfeba8), UINT64_C(0x4a7b02d114613d51), UINT64_C(0x53d5b1a59f925f44), UINT64_C(0x047488da84ffa38d) }},
+  {{ UINT64_C(0x6d7781b905bb19ac), UINT64_C(0x60a583721dfdc952), UINT64_C(0x5fb2e291e8029c40), UINT64_C(0x6a5e62caf584c65c) }},
+  {{ UINT64_C(0x4b86a170b3cc591a), UINT64_C(0x1a985b31c153f14e), UINT64_C(0x44896e951afb7413), UINT64_C(0x7cd184c09c5c6158) }},
+  {{ UINT64_C(0xb47aa8ac9df3dc4a), UINT64_C(0x04476b45074ccb90), UINT64_C(0x0526bce28814c032), UINT64_C(0xc495ac9d72e045ec) }},
+  {{ UINT64_C(0x00dc241db9502db6), UINT64_C(0x95b2af01ab9af234), UINT64_C(0x8b6a7adfca1f3d2e), UINT64_C(0x02b3f9143ed85744) }},
+  {{ UINT64_C(0xe64d582a8ca23a16), UINT64_C(0x36f74d4051c39166), UINT64_C(0x5614bc7ee9c31645), UINT64_C(0xbf953f2f47729294) }},
+  {{ UINT64_C(0x6763ea2526cd0f16), UINT64_C(0xdbd6a9ae25948fbc), UINT64_C(0xa6409ee95a4d6c9d), UINT64_C(0x5a693af3bae9ce6f) }},
+  {{ UINT64_C(0x8ffdd9a32314e4a2), UINT64_C(0x8a4f7d8f23eb44db), UINT64_C(0x3da33ab405a71e39), UINT64_C(0x992c0675d196c471) }},
+  {{ UINT64_C(0x0f41fb144df497bc), UINT64_C(0x3b41984d7b6023e3), UINT64_C(0xb5a2e3181376b781), UINT64_C(0x4f86ff3fbca2066a) }},
+  {{ UINT64_C(0x2dc874221ae402f8), UINT64_C(0xf409a5057e4a928e), UINT64_C(0x0ab6797315a90b7f), UINT64_C(0x1160687b22d41b8b) }},
+  {{ UINT64_C(0x66e597fa22877022), UINT64_C(0x3cd3e810e201661b), UINT64_C(0xd700279636b969e7), UINT64_C(0xbdf7cb75dbdb7243) }},
+  {{ UINT64_C(0xc7f0b3111345a328), UINT64_C(0x3cf7b929994707f3), UINT64_C(0xda08e57073dcce1b), UINT64_C(0x1756e82bddc18f7b) }},
+  {{ UINT64_C(0xb33ec4e2b80c232a), UINT64_C(0xb144cc1fdcbb17a9), UINT64_C(0xdfe3240969f79bc7), UINT64_C(0xb3c99628d4cebfb3) }},
+  {{ UINT64_C(0x366be072e76b70e0), UINT64_C(0xdf36319bf7d3c200), UINT64_C(0xfb367277b8f05520), UINT64_C(0x7cd5b47085abacf6) }},
+  {{ UINT64_C(0xd94bf638ba9ac7da), UINT64_C(0xaee4fc9355ddb8c1), UINT64_C(0x28e1bb5bf2ed9448), UINT64_C(0x5b86c9bef7439f31) }},
+  {{ UINT64_C(0xe5dc94120f34f5bc), UINT64_C(0xd7a1e1b62bc752f7), UINT64_C(0x4276d4b8c9a908d5), UINT64_C(0x3868f90a45ac4634) }},
+  {{ UINT64_C(0x6f5e0429d558ff8a), UINT64_C(0x7d07570d34386bb2), UINT64_C(0x5169765d22f43122), UINT64_C(0xaff6fc5e38670b42) }},
+  {{ UINT64_C(0xa83f89b44a49383e), UINT64_C(0x29932c9b032fdf94), UINT64_C(0x9b9df20d434507f3), UINT64_C(0x009ec13836db6173) }},
+  {{ UINT64_C(0xb15e88e5cf598fc4), UINT64_C(0x0216808a0f7440c6), UINT64_C(0x320bf8154859053c), UINT64_C(0x81b597a998c4223c) }},
+  {{ UINT64_C(0x9870903e459effb4), UINT64_C(0x2c7d713d57b432e9), UINT64_C(0x9a3278d656eb91ab), UINT64_C(0xdfbdbd0a9124b76c) }},
+  {{ UINT64_C(0xf456300ef1572abc), UINT64_C(0x683c33da9e06e30a), UINT64_C(0x1444ad6ea0391829), UINT64_C(0xeaf2953ed4ff8250) }},
+  {{ UINT64_C(0x5a6d7c6daeb1596e), UINT64_C(0xf5b09d055c212d96), UINT64_C(0x912ae744e3ecd71f), UINT64_C(0x232d217021bef69f) }},
+  {{ UINT64_C(0x838074e047a3f030), UINT64_C(0x315403c616b2c840), UINT64_C(0x8bb818eddad2b469), UINT64_C(0x804bcc7afc8d7473) }},
+  {{ UINT64_C(0xd49a6bc5c2786530), UINT64_C(0xa226dde771ec0899), UINT64_C(0x6c4fde0559c2ef72), UINT64_C(0xb4686276223dc411) }},
+  {{ UINT64_C(0xb5fa49e568bbf72e), UINT64_C(0xec97a9cb9084cd86), UINT64_C(0x4abe2e3290684542), UINT64_C(0x6b8a0968adeb58a7) }},
+  {{ UINT64_C(0x153b05a7e1251604), UINT64_C(0x68bfdd75f73d7d90), UINT64_C(0xbc3d7439820d7fca), UINT64_C(0xd60bc361e8a7714e) }},
+  {{ UINT64_C(0x7faf9cd02e588b6e), UINT64_C(0x6ba6b96ff0c036a7), UINT64_C(0x61568b3d98f0f6b2), UINT64_C(0x1a95cd22c1d83fb2) }},
+  {{ UINT64_C(0x5e2065a58d38d576), UINT64_C(0xae3e8a547b986b2b), UINT64_C(0x50fb23230f725034), UINT64_C(0xa5c0f88fa2a71313) }},
+  {{ UINT64_C(0x64755c1077f53e68), UINT64_C(0x2125cae500a054a8), UINT64_C(0xa1a679beaa739698), UINT64_C(0x08752c4d6eb6b11c) }},
+  {{ UINT64_C(0x6179b4488c526b92), UINT64_C(0xd9d5731c664f43bd), UINT64_C(0xc0ba51d081791933), UINT64_C(0x35dd1579b6e0f3e6) }},
+  {{ UINT64_C(0xdb886d3c061117b4), UINT64_C(0x40178ed4c3be45f6), UINT64_C(0x21b1236bb5b9df09), UINT64_C(0x8f8d1f3a45dea5f2) }},
+  {{ UINT64_C(0xf36a279b0ea5bb4e), UINT64_C(0x239e83af86caddae), UINT64_C(0x6aa11a2be3de4647), UINT64_C(0xcb27d64e5cb82b8b) }},
+  {{ UINT64_C(0x822fe6742e4dc366), UINT64_C(0x32c823f1a820cc34), UINT64_C(0xbffca7d8f4d412f5), UINT64_C(0x3d3b176f6bb36e35) }},
+  {{ UINT64_C(0x349b1374034fbfb4), UINT64_C(0x10b9d7da684469d4), UINT64_C(0x5742f8dafeb95023), UINT64_C(0xfb8aa16d0f0e9964) }},
+  {{ UINT64_C(0xca01774de0944f76), UINT64_C(0x04597930ea5fcd1e), UINT64_C(0x12d158897cd010ff), UINT64_C(0x19a740d15a7a6c2c) }},
+  {{ UINT64_C(0x858c8096f45fecea), UINT64_C(0x8a2c4f68170a458b), UINT64_C(0x75f7952ce9f5fa96), UINT64_C(0x66942721b89edc48) }},
+  {{ UINT64_C(0x0b33c0d68b45d32e), UINT64_C(0x2bd7ef5b12c073dc), UINT64_C(0xca9bf693b0ad1dd8), UINT64_C(0xad2ad0d7f116bdf5) }},
+  {{ UINT64_C(0x2ff394835dc326f4), UINT64_C(0x2e38b59810503ae0), UINT64_C(0xe10a596be6392acd), UINT64_C(0x221136b0bf53aca3) }},
+  {{ UINT64_C(0x4f41ef68da0e8b18), UINT64_C(0x7c0eba8a4a01bde5), UINT64_C(0x5d72106d573bcddf), UINT64_C(0x81f2f701c4f155ac) }},
+  {{ UINT64_C(0x15eae4bb8bb32356), UINT64_C(0xd26ccc19753392fd), UINT64_C(0xc5daad5279ee2787), UINT64_C(0x3cc32c5fa0e6a676) }},
+  {{ UINT64_C(0xc1909de5fdadac72), UINT64_C(0x07f53f0d86528df2), UINT64_C(0xde858958ad9188b8), UINT64_C(0x1da92db7392137f8) }},
+  {{ UINT64_C(0xc08012fc08c30c36), UINT64_C(0x14656b9d63042fe5), UINT64_C(0xdc33006df64202dc), UINT64_C(0x5ff150e25352921b) }},
+  {{ UINT64_C(0x3a730b6cb32530d0), UINT64_C(0xe8b05383555adfe8), UINT64_C(0x161c93b752f7d934), UINT64_C(0x4b9201696f12f945) }},
+  {{ UINT64_C(0x15f2dec9c876b700), UINT64_C(0x1d47b15bcf4d89a7), UINT64_C(0x1d80cec3a40fcb16), UINT64_C(0x37464049907d70eb) }},
+  {{ UINT64_C(0xd06b2e13a16510de), UINT64_C(0xf15675a03bda040b), UINT64_C(0x46bad53a8711e2cc), UINT64_C(0x7070bd1587116a49) }},
+  {{ UINT64_C(0x31a6283629136e9c), UINT64_C(0x9b2fee5a4bb9eb16), UINT64_C(0x520c8ba975a65f99), UINT64_C(0xa4deedf2d8c9f71a) }},
+  {{ UINT64_C(0xf32e05768c108f30), UINT64_C(0xe9ea938302be55a4), UINT64_C(0x606d24cfcfca8f95), UINT64_C(0x0f3c48ca6c48d628) }},
+  {{ UINT64_C(0x1a2711831b8abe0a), UINT64_C(0x4bcd9279771e41eb), UINT64_C(0x2ae0d0a26f8cc409), UINT64_C(0xde88119c16d63979) }},
+  {{ UINT64_C(0x4e708304fc2c6980), UINT64_C(0x8f8ddbbc1a3c8394), UINT64_C(0x2a150b07bf4def38), UINT64_C(0x4801332d7d4e4b5b) }},
+  {{ UINT64_C(0x1e8c4c24a1dfbc7a), UINT64_C(0x08a182995cda11bd), UINT64_C(0xe6bd839f7f2ae82d), UINT64_C(0xa27c25aaccea8c7e) }},
+  {{ UINT64_C(0xd87cb473f408fac4), UINT64_C(0xef85af9f9ef1951e), UINT64_C(0x41e51855e0d81fbe), UINT64_C(0x5e969e13a961ab4f) }},
+  {{ UINT64_C(0x84f81b2a1a752fd8), UINT64_C(0xf567397c95b6448d), UINT64_C(0xad87ae8c427e76e4), UINT64_C(0x02a07d50d59d65ac) }},
+  {{ UINT64_C(0x4581b54e8e5cbe02), UINT64_C(0x486ac19a45e22a46), UINT64_C(0x547cefacc7a5f538), UINT64_C(0xbc1d2f354a355dc8) }},
+  {{ UINT64_C(0x200bbec85af847ea), UINT64_C(0xb4658b46dac47112), UINT64_C(0x25351f0d6bc9bc0e), UINT64_C(0xa367f639ca0d7d6c) }},
+  {{ UINT64_C(0x91935a36695b96f2), UINT64_C(0xf75db6de4c2c4a4e), UINT64_C(0x029d92ffa743cddc), UINT64_C(0x460abbc1added8bc) }},
+  {{ UINT64_C(0x87f5c41b4f7a7210), UINT64_C(0x0f49aae3e700e450), UINT64_C(0x7fdbd6e32949af8c), UINT64_C(0xf54036290378d0af) }},
+  {{ UINT64_C(0xfc88f2d0790f70bc), UINT64_C(0x20bd8c6723cdfb4b), UINT64_C(0x59293bb983f060c2), UINT64_C(0x81fa32263ecef53b) }},
+  {{ UINT64_C(0xee73b6eea1de8df4), UINT64_C(0x4f086ed5ea2005ca), UINT64_C(0x21eb86af99d2c93f), UINT64_C(0x51c69af7efe32d0d) }},
+  {{ UINT64_C(0x5f4e6891eb4e8334), UINT64_C(0x761a420e212e7adc), UINT64_C(0x7fa4da1a2846fba1), UINT64_C(0xe64f019511b95fa9) }},
+  {{ UINT64_C(0x100fff4cb890d710), UINT64_C(0xb460d48600633ba8), UINT64_C(0x4d8a7c0d33993976), UINT64_C(0x13a2fc6d18e9c26f) }},
+  {{ UINT64_C(0xca0b9addbe6e8a74), UINT64_C(0xc130372c9d3cb38d), UINT64_C(0x6d5406d0fd385da7), UINT64_C(0x11564272e9e78165) }},
+  {{ UINT64_C(0x1b9b45fec7e05850), UINT64_C(0x65b0a0d52ae1183e), UINT64_C(0x8d0c0fa2ae0b6be4), UINT64_C(0x5151bb1bc671fdf2) }},
+  {{ UINT64_C(0xf31f68032620299c), UINT64_C(0xe0570a9ec8ed97c6), UINT64_C(0x4fea54a6b39f69f8), UINT64_C(0x6c25c6ddb843388d) }},
+  {{ UINT64_C(0x2ab431bb1b3e54da), UINT64_C(0x37d6973f24d69751), UINT64_C(0x607a5ecfad783d86), UINT64_C(0x521710fef252f65c) }},
+  {{ UINT64_C(0x86d3590cbd4284f8), UINT64_C(0x71bc5492c10ec4b6), UINT64_C(0xbcf27f9aaec30d1c), UINT64_C(0xdee6be8cd590d388) }},
+  {{ UINT64_C(0xa64bd40a2552ce26), UINT64_C(0xf38e1fdcdc495530), UINT64_C(0xe3db9fdd7cbaded7), UINT64_C(0xd37b583d2221db52) }},
+  {{ UINT64_C(0xbd1c5cd33761d0e4), UINT64_C(0x33aaa9af9d6655ba), UINT64_C(0x30ceb7f8c0680436), UINT64_C(0xb6ad530001ef6b10) }},
+  {{ UINT64_C(0x0d8def4ac4d10952), UINT64_C(0x5514533edfa6acd1), UINT64_C(0x76fe932b4777d4ad), UINT64_C(0x795ab76e7fea7e7f) }},
+  {{ UINT64_C(0x307276656d9849b4), UINT64_C(0x31014d4c94e13eb2), UINT64_C(0x29bbfe26ee27f964), UINT64_C(0x4cf0cdfd7aa11db9) }},
+  {{ UINT64_C(0xaea4e98617222f32), UINT64_C(0x46d37446d922950b), UINT64_C(0xa0d6de44fb2786fc), UINT64_C(0x39b9ce37a19b3820) }},
+};
+
+static const mzd_local_t K_3[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0xc5f2170d39bce682), UINT64_C(0xfaa8b0be4110dbac), UINT64_C(0x0ddf2a439ca8b258), UINT64_C(0x1a7f4310c9efdd5e) }},
+  {{ UINT64_C(0xf870f22e740ab8f0), UINT64_C(0x681fefc5f3660fab), UINT64_C(0x929fc2b76e8c6ecd), UINT64_C(0xc6af41e923ed34c4) }},
+  {{ UINT64_C(0x51a778cdb66530ea), UINT64_C(0xe998bab05a29f209), UINT64_C(0x9eddd3d9ebcc23f2), UINT64_C(0xb0c3e07c30024163) }},
+  {{ UINT64_C(0x67f6620d59d8f45e), UINT64_C(0x15dad0360025d9bb), UINT64_C(0x491b1b7c233c5dd0), UINT64_C(0x322e8cb976f07dd6) }},
+  {{ UINT64_C(0xcf497957a87b3170), UINT64_C(0x610dc85e9fae8ae3), UINT64_C(0x3ff5762bbe77f320), UINT64_C(0xc21deaec10dd344c) }},
+  {{ UINT64_C(0x3a15d52c9a080b82), UINT64_C(0xb0b1b2fba9650584), UINT64_C(0x68424dcae0487dd0), UINT64_C(0x2bfa4d65cc1f7dd5) }},
+  {{ UINT64_C(0x358b2aefc5b984ee), UINT64_C(0x3234155a96e34060), UINT64_C(0x1c400a8ff5030499), UINT64_C(0xeb5aa580335449fc) }},
+  {{ UINT64_C(0x8744a986f7af1414), UINT64_C(0xcd8bf6675dcb2a76), UINT64_C(0x0f84856a9a0a7d24), UINT64_C(0x24d46e7f36f71902) }},
+  {{ UINT64_C(0x38914bda45b0f7a2), UINT64_C(0x7cc673091d122e9c), UINT64_C(0x6dc8adffbb9e9234), UINT64_C(0x67178aa63cc7478a) }},
+  {{ UINT64_C(0xadc5a39e9c3b5290), UINT64_C(0x0fb43c2e0e407b8f), UINT64_C(0xb5692fa03fb7caf8), UINT64_C(0xe3bdd95809fe772d) }},
+  {{ UINT64_C(0x1bc3d9898ab525ba), UINT64_C(0x35e3d89d529d4104), UINT64_C(0x7df2a94d781021fa), UINT64_C(0x4c559b1925645457) }},
+  {{ UINT64_C(0x8a8b60a05bc6994c), UINT64_C(0x19466a03b3fa8c0f), UINT64_C(0x830cdf560b9fd7f1), UINT64_C(0xec4077456e864edb) }},
+  {{ UINT64_C(0x2f01f254e680c494), UINT64_C(0x3e6c1670a98fa69f), UINT64_C(0xe83b15fda7476be5), UINT64_C(0xa2fd6bd0ee4c49cd) }},
+  {{ UINT64_C(0x335eb23a144ce68e), UINT64_C(0x64ab716c27811993), UINT64_C(0x0e8c21ea2aec9d72), UINT64_C(0xc4ab37b33401730d) }},
+  {{ UINT64_C(0x5979a407d92b173c), UINT64_C(0x528fb08f399829c2), UINT64_C(0xe591b37399b76e21), UINT64_C(0x287c456656679e5b) }},
+  {{ UINT64_C(0xd58f5dfbfaa46b9a), UINT64_C(0xc63265b7b5f30886), UINT64_C(0xacca753f6fa4473c), UINT64_C(0xee34043fb0749697) }},
+  {{ UINT64_C(0x8c3b0faafce6b2e8), UINT64_C(0xcf40ea5ef551b39e), UINT64_C(0x601704b5eceb84ad), UINT64_C(0xe46337f1fe6893c6) }},
+  {{ UINT64_C(0xdd59934f6173c8f6), UINT64_C(0xa5d96a4ae2de732d), UINT64_C(0x90caf7b11124504b), UINT64_C(0x258698eb571d3ed6) }},
+  {{ UINT64_C(0x4f982c67aa9d5bfc), UINT64_C(0xac677b63462f932f), UINT64_C(0xee9e3cfd3a794f7c), UINT64_C(0xe6a902eb34cc177a) }},
+  {{ UINT64_C(0x0960804474df3624), UINT64_C(0xa6cf1f4237c3615e), UINT64_C(0x5880c57d27656f0d), UINT64_C(0x7720ff8890e0ad4c) }},
+  {{ UINT64_C(0xf6a36f66775409e8), UINT64_C(0xa7fe04640cd7660e), UINT64_C(0x586cb899c33f4d14), UINT64_C(0x273889881295b3d2) }},
+  {{ UINT64_C(0x7058890f87059236), UINT64_C(0x74fe5e3e079db857), UINT64_C(0x265175f7bf8d253e), UINT64_C(0xd5b1e2e94ff0d130) }},
+  {{ UINT64_C(0xce31909eaf7307e8), UINT64_C(0x5d65068020e3f887), UINT64_C(0x0e31ac26c35f4626), UINT64_C(0xb9dfb70a0b5ddc4c) }},
+  {{ UINT64_C(0x46b79a34b41e359a), UINT64_C(0x7787734faffdb753), UINT64_C(0x7fd92916994545c4), UINT64_C(0x03f6e8d89910e54b) }},
+  {{ UINT64_C(0xe070b5a62c71ccb6), UINT64_C(0x14c1922687f657ec), UINT64_C(0x73028e2fbbfc3893), UINT64_C(0xc1153eaec63cce8c) }},
+  {{ UINT64_C(0x10e71af8cf9dd160), UINT64_C(0x0fbee1fa6bd01ef8), UINT64_C(0xa386c8a21296c5f8), UINT64_C(0x8cd6ca75615350b8) }},
+  {{ UINT64_C(0x6f35a03dff1aa8ca), UINT64_C(0x22dc0cf26242ba8f), UINT64_C(0x52e0c2cd4e1b19c6), UINT64_C(0xf07fe73637af54b5) }},
+  {{ UINT64_C(0xbd475f3e60d42e56), UINT64_C(0xf47fe0de792a1b6b), UINT64_C(0x7ce7e4d9d41fff96), UINT64_C(0x195e337ee46add38) }},
+  {{ UINT64_C(0x63469e10f177c60a), UINT64_C(0xc65c646a3301bc77), UINT64_C(0x604e3dd159d0d008), UINT64_C(0x4b725c8fe717f744) }},
+  {{ UINT64_C(0xa5cd52934919c530), UINT64_C(0x49cd636752802d5d), UINT64_C(0x518641646dd63d4c), UINT64_C(0x9efef8555cc9d383) }},
+  {{ UINT64_C(0xeff80747ad8c49a8), UINT64_C(0xfd26b512e63e9a75), UINT64_C(0x00ce729c002ec2a6), UINT64_C(0x2098358f5efa8c16) }},
+  {{ UINT64_C(0x4850add828033b76), UINT64_C(0xd41e25baefeee5b1), UINT64_C(0x06e56bdc60031256), UINT64_C(0x20b1b3c4f41c4315) }},
+  {{ UINT64_C(0xf8bcbc088732c6f8), UINT64_C(0x6a440e70d83c3aa9), UINT64_C(0xb6aa8c60fc9f42d7), UINT64_C(0x1cabfed495604cde) }},
+  {{ UINT64_C(0x82084c559a493816), UINT64_C(0xa7bd2e54fa98fa91), UINT64_C(0x4708d225bc62b6e3), UINT64_C(0x586581597d44c1c4) }},
+  {{ UINT64_C(0xecc02f7a3ac804d2), UINT64_C(0x3b81aad627d5e49f), UINT64_C(0x60931c7d2636832b), UINT64_C(0x60b2055e47a4b95a) }},
+  {{ UINT64_C(0xa4d20599fe10e47c), UINT64_C(0x59ccb6235b7af78d), UINT64_C(0xc7951f288b2fc586), UINT64_C(0x8b2fd26cf3e1ecd7) }},
+  {{ UINT64_C(0x8fb763c40b9020fc), UINT64_C(0xfee03d8150f639a1), UINT64_C(0x91a9689aea64c3c3), UINT64_C(0x8ac240d4f00594ed) }},
+  {{ UINT64_C(0xc7999f0248ca4268), UINT64_C(0x7410824d198c95f5), UINT64_C(0xd2f5aa16a884b4f8), UINT64_C(0xd4a20fb155abffc0) }},
+  {{ UINT64_C(0xb374abc8478c2456), UINT64_C(0xf6f57a658953c33b), UINT64_C(0x105f673b551deafe), UINT64_C(0x31c6762f9f9fdacf) }},
+  {{ UINT64_C(0x4c8d7f8d1c19f30e), UINT64_C(0x062ee19f68fd3bef), UINT64_C(0xed25fce62ccbe19c), UINT64_C(0x599f320d7767d45d) }},
+  {{ UINT64_C(0x869cba7e44d13522), UINT64_C(0xed226aec05f1c559), UINT64_C(0x837da682eca4d153), UINT64_C(0x72b24b1e82986f80) }},
+  {{ UINT64_C(0x612a78140642b296), UINT64_C(0x7625521b725db442), UINT64_C(0x02a45054b398a3cd), UINT64_C(0x7567fb45d907536a) }},
+  {{ UINT64_C(0x7d51f9961f2e0f3c), UINT64_C(0x8362c20022bca192), UINT64_C(0xefb7e34b6d3a8966), UINT64_C(0x6100aae3ba4286df) }},
+  {{ UINT64_C(0x14a707386dfc5a82), UINT64_C(0x4be97e99f45b37d0), UINT64_C(0x08a3069f53484188), UINT64_C(0xed0079e2b83c056b) }},
+  {{ UINT64_C(0xd68e242e341746dc), UINT64_C(0x2ef7b0837fc78f41), UINT64_C(0xde4d87fc32e65b64), UINT64_C(0x9025c1acbae3052c) }},
+  {{ UINT64_C(0x1dc343cc0b09b556), UINT64_C(0x937dea831d93bf11), UINT64_C(0x3a2ec66116997b22), UINT64_C(0x8dcdb2c1f7439657) }},
+  {{ UINT64_C(0xd7d2c1b5373dd6f8), UINT64_C(0x4fe2c761b15b89fe), UINT64_C(0x731a39abb41fff20), UINT64_C(0x3c5a020fb39d3805) }},
+  {{ UINT64_C(0x8069d10a33224e34), UINT64_C(0x9668d54fa5467ca4), UINT64_C(0xead314fd19161af0), UINT64_C(0x631e400a01ace4d5) }},
+  {{ UINT64_C(0x784c798a15033214), UINT64_C(0x94acfa44e2477ef8), UINT64_C(0x581a70805bdd6d23), UINT64_C(0x63b5d9f3b03c2367) }},
+  {{ UINT64_C(0xd8bee9087c80278e), UINT64_C(0xae276465433514f9), UINT64_C(0x1ca109351fe96681), UINT64_C(0x566648ca3b13e2df) }},
+  {{ UINT64_C(0xa62de4834ca64370), UINT64_C(0x0487a0e253dd0db7), UINT64_C(0x6a2e035c0db1c1b9), UINT64_C(0x01a3d8fb4836d320) }},
+  {{ UINT64_C(0x5b5d7b2c3b740f08), UINT64_C(0x6a7c2fcabd14e39f), UINT64_C(0xc32f51816a0a539b), UINT64_C(0x0f0d77b03a3e2ab3) }},
+  {{ UINT64_C(0x0efb5c7ab6630f96), UINT64_C(0x95d6b28a553125b9), UINT64_C(0x5febf4dd23129480), UINT64_C(0x91fb8b4965a6a294) }},
+  {{ UINT64_C(0x2ce168d09458db12), UINT64_C(0x2a5da6cf83321f54), UINT64_C(0x99114d7e49d3053d), UINT64_C(0xe255e286af2b86c3) }},
+  {{ UINT64_C(0xd113a508223929d2), UINT64_C(0xc13958c0e9d179d2), UINT64_C(0x459a34b943742e75), UINT64_C(0x5a82393aa89df64d) }},
+  {{ UINT64_C(0x4ad9022c82ba4458), UINT64_C(0x678f5b45c6dbd5e2), UINT64_C(0xe7f1d36b2556bb00), UINT64_C(0x745b5ab490b58511) }},
+  {{ UINT64_C(0xf2f3f60b1af4a15c), UINT64_C(0x747b00f685f8226f), UINT64_C(0x5449d70b6aa8c926), UINT64_C(0xab0af6007f3c5534) }},
+  {{ UINT64_C(0x58f3be85612c5a7c), UINT64_C(0x842f529631158e71), UINT64_C(0x9eec1249672cd0bd), UINT64_C(0x88c384b1c3b44205) }},
+  {{ UINT64_C(0x44a482fdab5bd32a), UINT64_C(0x33fce5bea46dbfe4), UINT64_C(0xff1e8e4a006d8db4), UINT64_C(0x3ca956a7efb9bb9c) }},
+  {{ UINT64_C(0xbe6b8cdac8bc2f42), UINT64_C(0xa18457065d097c6d), UINT64_C(0xdb67a772113bd62f), UINT64_C(0x8c655931cd31dc7c) }},
+  {{ UINT64_C(0x05b00db8ca97acc4), UINT64_C(0x907b8c780185bc6f), UINT64_C(0x169da870cb6a07ed), UINT64_C(0x7169b72d7007bb4b) }},
+  {{ UINT64_C(0xe146e6a13d3b97d8), UINT64_C(0x78e8e81f7751552e), UINT64_C(0x3f845b292d5c9bfe), UINT64_C(0x90d5526979806c84) }},
+  {{ UINT64_C(0x35916ffc50c4e5a8), UINT64_C(0x110c7db1e0390ce8), UINT64_C(0x6dd0c92a12d03c64), UINT64_C(0x840bf1927f90bc75) }},
+  {{ UINT64_C(0x6546a547c316808c), UINT64_C(0xc366ba65ef2eeaff), UINT64_C(0xbc438e5c4d4b322a), UINT64_C(0x04108ce05a589fc5) }},
+  {{ UINT64_C(0x34dc51cb3a5f1be2), UINT64_C(0xc45e49e066c87fff), UINT64_C(0x64addf1a5fe0f75e), UINT64_C(0x23cc20f05bbf8899) }},
+  {{ UINT64_C(0xbd62e820a6f7465a), UINT64_C(0x57ccd41ba50b733a), UINT64_C(0x07079e06fe477872), UINT64_C(0x0b1b30c80a835603) }},
+  {{ UINT64_C(0x9ec7e6a52b3e29c0), UINT64_C(0xfe83d33e665c3e77), UINT64_C(0x61287d44223a4045), UINT64_C(0x77a4e4dc8f94972c) }},
+  {{ UINT64_C(0x3b2b2cf84d4bd3c2), UINT64_C(0x0358f2e462b135ff), UINT64_C(0xea6bcaf6cac761c2), UINT64_C(0xef8feb71d3fde056) }},
+  {{ UINT64_C(0x80e481cfbbfc67dc), UINT64_C(0x93800b38d9eb9c26), UINT64_C(0xb403a4262307fcee), UINT64_C(0xdc1e348e7d72c591) }},
+  {{ UINT64_C(0xc85dff36db6f149c), UINT64_C(0xf88e64b5f52aeff6), UINT64_C(0xf6be8720b7059aeb), UINT64_C(0xad80b89bc5a20b81) }},
+  {{ UINT64_C(0x2312ffda6f38a10c), UINT64_C(0x22c1838559a9d2d4), UINT64_C(0x2965ff2af9fe917b), UINT64_C(0x5f54bd6e418fee08) }},
+  {{ UINT64_C(0x562e3ec81fce37bc), UINT64_C(0x36a858e73ba69d8e), UINT64_C(0x8413787173503c10), UINT64_C(0xc695fe95a427152a) }},
+  {{ UINT64_C(0xe90312bb83af25e0), UINT64_C(0x0b1a8d02fedee5cd), UINT64_C(0xf64af896522dbd05), UINT64_C(0xd510caf66f35f8a9) }},
+  {{ UINT64_C(0x0663161b6d847326), UINT64_C(0xe2f554db7bde6b89), UINT64_C(0x715ab2dc8fbc4875), UINT64_C(0x0f330a68701776f7) }},
+  {{ UINT64_C(0x2787244edc101f36), UINT64_C(0xfe49e5c075950c02), UINT64_C(0xac6d351373dfe863), UINT64_C(0x3ee114ab49cc5c9a) }},
+  {{ UINT64_C(0x617f41f8f8f3b30e), UINT64_C(0x2ed5731f9aa3d2ed), UINT64_C(0xeea8aca38a3f4b99), UINT64_C(0x2740680f76e2b945) }},
+  {{ UINT64_C(0xea3edc8b560504d2), UINT64_C(0x95db4c5a49f5f012), UINT64_C(0xffc795957f6a9643), UINT64_C(0xdbb8064c2c14a419) }},
+  {{ UINT64_C(0xe245def175ff773a), UINT64_C(0xa030dd672e29cc88), UINT64_C(0x8a7b7c4765290ca7), UINT64_C(0x187633e9bbbc16f4) }},
+  {{ UINT64_C(0xf5a52b9e852d94a4), UINT64_C(0x62495f5ef1846c1d), UINT64_C(0x96508e7947188c69), UINT64_C(0x0b95eeda641f00f6) }},
+  {{ UINT64_C(0x8878d22eae0cde20), UINT64_C(0xf5c27b417b62b347), UINT64_C(0x3549e4d60d5c9301), UINT64_C(0x783c89d0852b853f) }},
+  {{ UINT64_C(0x4664f51f0942bf30), UINT64_C(0x477938bafa3c6f81), UINT64_C(0x444ab8ab4dfe2ded), UINT64_C(0xf661d6abab6550ce) }},
+  {{ UINT64_C(0x6e818bb0b72458c4), UINT64_C(0xacfa2024e3179458), UINT64_C(0x4f4e3ad1c8b6a494), UINT64_C(0x75fd3288238944bf) }},
+  {{ UINT64_C(0x77524c5865f9ee40), UINT64_C(0x9b983c5cf1505843), UINT64_C(0x5810bd3a60ba6d77), UINT64_C(0xd95a4696450f72f6) }},
+  {{ UINT64_C(0xa0d4cde17b92e2f6), UINT64_C(0xfcd1b77d79d5be9e), UINT64_C(0x9118c00a1199f788), UINT64_C(0xf862799707db6c01) }},
+  {{ UINT64_C(0x512d693f77a45692), UINT64_C(0x9b221b4b25637246), UINT64_C(0x10060651ddbc2763), UINT64_C(0xe8488dcad14b618b) }},
+  {{ UINT64_C(0xea026f1a6bba7d34), UINT64_C(0xe8bc7e49bfbc9c4e), UINT64_C(0x5143688d230a1e3d), UINT64_C(0x0b1224a9190fad44) }},
+  {{ UINT64_C(0x1728c21d54d28a14), UINT64_C(0x1154f0e218edb320), UINT64_C(0x83bd6f975f2d429b), UINT64_C(0x1a1b70e05f939ded) }},
+  {{ UINT64_C(0x52c0f16c102f52e8), UINT64_C(0x15adb05977f36bf2), UINT64_C(0xd3004106306228fc), UINT64_C(0x9140a28c93cad2e7) }},
+  {{ UINT64_C(0xc0c45f0983971e84), UINT64_C(0x28e3a9b4faf1cab1), UINT64_C(0xc3a90f258b782b4c), UINT64_C(0x727b9b0dbd596aa6) }},
+  {{ UINT64_C(0x77d63371fcce6a9e), UINT64_C(0x6720b33842fb79c9), UINT64_C(0x38d9b7a8d97acabc), UINT64_C(0x2a1948f9638e13af) }},
+  {{ UINT64_C(0x981e5145aa783f9a), UINT64_C(0xc126be22d77d64f8), UINT64_C(0xcbade79ab42568a3), UINT64_C(0xae77221cc344ec0a) }},
+  {{ UINT64_C(0xa569a72f3a5415c8), UINT64_C(0x5209df52a6d548b1), UINT64_C(0xf5deeb38e21ae44a), UINT64_C(0xbdb30daa6eedadaa) }},
+  {{ UINT64_C(0xc63b197d8fb0f914), UINT64_C(0xced948ddcce79d42), UINT64_C(0x96fc43731f6e40dd), UINT64_C(0x8d360b9968d00502) }},
+  {{ UINT64_C(0xe1e63d52e580477c), UINT64_C(0x12e0c21b9ceebbd7), UINT64_C(0xa60db99c5f05e594), UINT64_C(0xcbd381f1cc328239) }},
+  {{ UINT64_C(0xb9c175c9632cad7a), UINT64_C(0x0f80f43569998978), UINT64_C(0x8bda51ca1e5c60be), UINT64_C(0xfde1cd7392192e00) }},
+  {{ UINT64_C(0xac052f08e810b460), UINT64_C(0x465778b5ff36a07e), UINT64_C(0x713d92f9248b47e4), UINT64_C(0x28f71989797dc74d) }},
+  {{ UINT64_C(0xea51c852590e0dea), UINT64_C(0xfc75187bb512662b), UINT64_C(0xe777cea7df115dee), UINT64_C(0xfb6a8cc9d1bcb56e) }},
+  {{ UINT64_C(0x868d913767978150), UINT64_C(0x5bf3be4863fb440f), UINT64_C(0xf7dca4dead3b0c90), UINT64_C(0x6bb52186f59f58b6) }},
+  {{ UINT64_C(0x87b4323b3746c60c), UINT64_C(0x46c65bc7a756bd6d), UINT64_C(0xc9e996a7c1079862), UINT64_C(0xd277c694e075ce79) }},
+  {{ UINT64_C(0xa9c644380b94d98a), UINT64_C(0x1d33326600ac9a36), UINT64_C(0xadfdf56a0237d223), UINT64_C(0xf17551644bd930f2) }},
+  {{ UINT64_C(0x945dd64e74701b2a), UINT64_C(0x2ea57223d8a09e82), UINT64_C(0xa105401d2cf7475c), UINT64_C(0xb16f5dddced274f0) }},
+  {{ UINT64_C(0x1b1c8464e3d1e8d0), UINT64_C(0xd4d1104a2f6219f8), UINT64_C(0x3adf5128c51afffd), UINT64_C(0x95684801e929e9e3) }},
+  {{ UINT64_C(0x924fd5bf3c52e4ea), UINT64_C(0xe2305effc6b0b9e0), UINT64_C(0xb606b8aedcdc3607), UINT64_C(0x58ba8243be981af9) }},
+  {{ UINT64_C(0xf794abc622982ac2), UINT64_C(0x99ab66dc6e05e645), UINT64_C(0x87514d797893d84f), UINT64_C(0xc347205922fe1c1b) }},
+  {{ UINT64_C(0x824fd20ac0f6a140), UINT64_C(0x49399104bc913dc8), UINT64_C(0xa527160ba97879b1), UINT64_C(0xa48e53c405351ac6) }},
+  {{ UINT64_C(0x5e0a9f1682b2b0b4), UINT64_C(0x65e1fc07312d23e6), UINT64_C(0x3cf4f86db1b741a5), UINT64_C(0x739d5cf2bf740a21) }},
+  {{ UINT64_C(0x7cdc905bbbd5159c), UINT64_C(0xd0605fba85476488), UINT64_C(0x6589c383df848ff3), UINT64_C(0xfdbf95e7a257ac25) }},
+  {{ UINT64_C(0xed94343644b2d978), UINT64_C(0x57e6bfecaebd6ab5), UINT64_C(0xf4f8378a37df638c), UINT64_C(0xffc3edcd0e0bd7b1) }},
+  {{ UINT64_C(0xda5809dbe900fd2c), UINT64_C(0x5c0bf21f7583b074), UINT64_C(0x0718aa7b88f0ab8a), UINT64_C(0xf1dcb8ea0a1ad4ee) }},
+  {{ UINT64_C(0xd1e12459b915920e), UINT64_C(0xe7f99138549fee92), UINT64_C(0xf06f0aae9dc9c61c), UINT64_C(0x1706d61f86b0fa02) }},
+  {{ UINT64_C(0x3a4edd3a7f94fd06), UINT64_C(0x12f1273318f1cbaf), UINT64_C(0x87623f692d5cd960), UINT64_C(0x476a817a16dcf20d) }},
+  {{ UINT64_C(0x255749d0c2595034), UINT64_C(0xe41eb3174ad516df), UINT64_C(0x53a76f5db60bc25b), UINT64_C(0x70d8d1ef386937b1) }},
+  {{ UINT64_C(0xa31479f296f265fe), UINT64_C(0x10eb078d5aea682c), UINT64_C(0x9980520f8412ffc7), UINT64_C(0xc7374f99a5670627) }},
+  {{ UINT64_C(0x9f338ac10c1610b6), UINT64_C(0xa6d58c196e82330f), UINT64_C(0xa10e2e3a14d69df3), UINT64_C(0x5a313792dd28310a) }},
+  {{ UINT64_C(0x2e04b819d6d30526), UINT64_C(0x58623a3d3fea7d22), UINT64_C(0x6b044dee53d94d45), UINT64_C(0xe543eaffc8ab7753) }},
+  {{ UINT64_C(0xcc603ee16104755a), UINT64_C(0x6e4f9edcfe7ad3dc), UINT64_C(0x78441ad04746f5f7), UINT64_C(0xfe3993860155b1b7) }},
+  {{ UINT64_C(0x72418f49e30577e6), UINT64_C(0x8864737df4c7f23d), UINT64_C(0xddca743a2f021bed), UINT64_C(0x831de422c85a94c8) }},
+  {{ UINT64_C(0xe15475e8c92a420a), UINT64_C(0x04e4e164a42d66e6), UINT64_C(0x5ccf829559c82975), UINT64_C(0xa98f18f0b5f203b3) }},
+  {{ UINT64_C(0x89898fa9ea18ed78), UINT64_C(0xba8262e16340ea82), UINT64_C(0xf523b6470b9de1bd), UINT64_C(0xcfaaaa7258e03544) }},
+  {{ UINT64_C(0x8c0771ffe152539a), UINT64_C(0xae2edc2acf59c92e), UINT64_C(0xa6048b781a26ce64), UINT64_C(0x2940776e894defc7) }},
+  {{ UINT64_C(0x8d6c211cec9d9a16), UINT64_C(0x55a10e1ecda7c527), UINT64_C(0x0c455b51adeeed5e), UINT64_C(0xdb2c3b557162fea3) }},
+  {{ UINT64_C(0xbf8df7ca6438c81a), UINT64_C(0x7db4f31bfcf2ce18), UINT64_C(0x2e051ff11898317a), UINT64_C(0xa3a4e87f673b2ccc) }},
+  {{ UINT64_C(0x9a7ef9986ef6805c), UINT64_C(0xd38ff1aaaa8e2914), UINT64_C(0x5b2bae84bb90c1bf), UINT64_C(0x042e293c67e41e8c) }},
+  {{ UINT64_C(0x9fa07189ba95b904), UINT64_C(0xdd7fdc0f2c5aa87f), UINT64_C(0x3b07d534637297f3), UINT64_C(0x66e88cd7234cc7ed) }},
+  {{ UINT64_C(0x6632adcf021d9d10), UINT64_C(0xcdd91071b8b19fe3), UINT64_C(0xcc9f9da998d646f5), UINT64_C(0x86e925a2a221f4af) }},
+  {{ UINT64_C(0x0cd68f861d30af42), UINT64_C(0xeb8e054966d4f930), UINT64_C(0xd4b226ac9fef9033), UINT64_C(0xedfaeb799bcc7dd1) }},
+  {{ UINT64_C(0xc22d727a52c3b378), UINT64_C(0xf9d645a9323a17e1), UINT64_C(0xc0a0a3f581210493), UINT64_C(0xe8176ea7b9c11bbc) }},
+  {{ UINT64_C(0xd21a90dc6f9d6a34), UINT64_C(0xb546ec1ff4cee48c), UINT64_C(0x884441c42e476bd7), UINT64_C(0xcd70d225ef36e634) }},
+  {{ UINT64_C(0xfa70294b277ab256), UINT64_C(0x7f3d52acf1fc3080), UINT64_C(0xc565a156044f21c4), UINT64_C(0xf690719bb995a825) }},
+  {{ UINT64_C(0x92b76305be903a08), UINT64_C(0x76e5b6806e3339b8), UINT64_C(0x4c7ee504cfb5bd6a), UINT64_C(0x73bca2d1ae685fc2) }},
+  {{ UINT64_C(0x5584c8f8398f7202), UINT64_C(0x8f0bddad35418fee), UINT64_C(0x07e95c1cd9c892e3), UINT64_C(0xbefa967458cb991c) }},
+  {{ UINT64_C(0x41dd1e394b451016), UINT64_C(0xa9b02cce38b9e8ac), UINT64_C(0x3868b07d8195584a), UINT64_C(0x1ade13c5e48358d6) }},
+  {{ UINT64_C(0x07b1273d73c9e964), UINT64_C(0x20e8d35e5c67b0c0), UINT64_C(0x053c9c8eff21d289), UINT64_C(0xf9d730d0ff623f5d) }},
+  {{ UINT64_C(0x04f25dd2bc9377f4), UINT64_C(0xa533a87dba27dd3e), UINT64_C(0xc0ce0474a194a2af), UINT64_C(0xd37078a91a49cd59) }},
+  {{ UINT64_C(0x5e712ca0a279e040), UINT64_C(0x5480ae0ca20674a9), UINT64_C(0x82255ca16b463177), UINT64_C(0xf558ac2fad489387) }},
+  {{ UINT64_C(0xf16b7e31c94c1b4e), UINT64_C(0xed41ba36c44f9c25), UINT64_C(0xc54a4e9b46cad61e), UINT64_C(0x7877b81a4d7c2e4a) }},
+  {{ UINT64_C(0x784030facf879ca8), UINT64_C(0x17b80d044f8337c7), UINT64_C(0x93732fb82420b816), UINT64_C(0x2783860aae59afb2) }},
+  {{ UINT64_C(0x6d278cf2b37a70fe), UINT64_C(0x2a7d00c9eae8ee7c), UINT64_C(0x01371cf13fb4554c), UINT64_C(0x3b4256ab5b7d2e72) }},
+  {{ UINT64_C(0xdc88fe8b8d6e15f6), UINT64_C(0x9b01bbb168f6328d), UINT64_C(0x1ae89527aacb8d6f), UINT64_C(0xd6dd0ea02e0a206e) }},
+  {{ UINT64_C(0x6d3674446ed08432), UINT64_C(0xbb0ece25c991f941), UINT64_C(0x8d76ad2d2156acf0), UINT64_C(0x926a1712de6c236a) }},
+  {{ UINT64_C(0xe23797b91de28d2a), UINT64_C(0xdfd29dba59a1e0df), UINT64_C(0xd9c7c3c2a4555f38), UINT64_C(0x5e9f576cbadd17c0) }},
+  {{ UINT64_C(0xb07803cb41b65c3c), UINT64_C(0x73e6f0f4b17f8062), UINT64_C(0xcc2394f6ceeefd1a), UINT64_C(0xaed7db929a416737) }},
+  {{ UINT64_C(0xe94984554bf24f96), UINT64_C(0x90f1909d0f4087a2), UINT64_C(0xec349324e442eeb3), UINT64_C(0x35b99f08bdc79e54) }},
+  {{ UINT64_C(0x82a75110caab8eac), UINT64_C(0x75773d39c6e6abf6), UINT64_C(0x9403623aa3cbde7d), UINT64_C(0x51e57d51885f64d7) }},
+  {{ UINT64_C(0xa864231fbe285b70), UINT64_C(0x5ba83fed7246d1f3), UINT64_C(0x61a1bb7c1825acf1), UINT64_C(0x7a9a7e9d05456c65) }},
+  {{ UINT64_C(0xd4cf5c2c6419d99a), UINT64_C(0xb66cc3c4e08527cd), UINT64_C(0xeafea6aba9b47a17), UINT64_C(0x8e0d5eeef2890395) }},
+  {{ UINT64_C(0x592c9e1065bf6912), UINT64_C(0x5f5c231c1e6e930f), UINT64_C(0xec057068afa390d3), UINT64_C(0xf931d03863942103) }},
+  {{ UINT64_C(0xb1f3857537d3ef68), UINT64_C(0xee0bbd2a4b49dad7), UINT64_C(0xab11ec954fda69ae), UINT64_C(0xeaf6409fb721a746) }},
+  {{ UINT64_C(0x3663b48000d8fc06), UINT64_C(0x7de64f951b3734ab), UINT64_C(0xe03c409a84ebfd75), UINT64_C(0xacd527370d3ac286) }},
+  {{ UINT64_C(0x6aed6477e868085c), UINT64_C(0x0a14e9db77dca6e5), UINT64_C(0x604085f355c2b028), UINT64_C(0x2fcae51e3d40f84b) }},
+  {{ UINT64_C(0xe32034c8ccda0c3a), UINT64_C(0x56f9ec8607530e43), UINT64_C(0x4760f0085033d245), UINT64_C(0x7a9d938ff5ab53fc) }},
+  {{ UINT64_C(0x68f447504ea43052), UINT64_C(0x209c83c68d2c4814), UINT64_C(0xec514e5232d37075), UINT64_C(0x67b799b1b2aa60e5) }},
+  {{ UINT64_C(0x9efe9c16183ba980), UINT64_C(0x98b4dfc90a5a0df1), UINT64_C(0x440afb6749c819c8), UINT64_C(0xfa49b69c0ebb715f) }},
+  {{ UINT64_C(0x75c239ca20c84c2e), UINT64_C(0xba86b66e0e622eef), UINT64_C(0x0da39f89e2dc2140), UINT64_C(0x8f6be0c471c81125) }},
+  {{ UINT64_C(0xbc7ca8274a920cc8), UINT64_C(0xe8515d4712cbcf13), UINT64_C(0x3a64f3bbf0550611), UINT64_C(0xc3f15180ca7dd1ef) }},
+  {{ UINT64_C(0xa111822abb2cb582), UINT64_C(0x42a0a3896ab81de8), UINT64_C(0x1ac93aaa46496767), UINT64_C(0x17e4e8308b536945) }},
+  {{ UINT64_C(0x9bdeb8b0eeec522e), UINT64_C(0xc151fd70e07de54b), UINT64_C(0xbad78c34aece56b2), UINT64_C(0x3dba35b64ad48fdb) }},
+  {{ UINT64_C(0xee784833d3742538), UINT64_C(0x011ae0083616b244), UINT64_C(0xeb655d046d29cdf5), UINT64_C(0xa5fc6945dc721c60) }},
+  {{ UINT64_C(0xffd847d9f2aab5d0), UINT64_C(0x16947e1703d396ca), UINT64_C(0x8f02b8ac35e65ea3), UINT64_C(0x0238e15ce3eb488b) }},
+  {{ UINT64_C(0x9f45ff3ee1eb8ff6), UINT64_C(0xaff5f6300625daae), UINT64_C(0xca01290ae656f579), UINT64_C(0x0fc4190a02c7e660) }},
+  {{ UINT64_C(0x1a4bc7009f6e8492), UINT64_C(0xb95f2b42069e1144), UINT64_C(0x5b1c74bbd42860f5), UINT64_C(0x5140cf9b801003b1) }},
+  {{ UINT64_C(0xb6ea860e3fd77616), UINT64_C(0xd2f36cceca1ce632), UINT64_C(0x911bbcaf819c9bc2), UINT64_C(0xd446949d56339c06) }},
+  {{ UINT64_C(0xccbc7303cc1265aa), UINT64_C(0x10ad8ac41495a81e), UINT64_C(0x9e882c2436367de2), UINT64_C(0xda4b934f91d57ea0) }},
+  {{ UINT64_C(0x4a4edeaeeed9cd04), UINT64_C(0xf3976111896b495a), UINT64_C(0x95eefaefff12e2f7), UINT64_C(0x42dd90ef7933e870) }},
+  {{ UINT64_C(0x396fc9a4da661662), UINT64_C(0xa8d99796b3302651), UINT64_C(0xbc13290470733125), UINT64_C(0x6d5a3bf7d87e56d9) }},
+  {{ UINT64_C(0x75adf52622d3e8dc), UINT64_C(0x1ce778895ed9a47c), UINT64_C(0xa9f466a504d027b7), UINT64_C(0xee6e3028ac1b4d4d) }},
+  {{ UINT64_C(0xa776a1ec82c652ce), UINT64_C(0xbab0f13f31a9f6b2), UINT64_C(0xd03384bd4a9a1ef1), UINT64_C(0xfebb2e86707e79a8) }},
+  {{ UINT64_C(0x9fd16212cad3179c), UINT64_C(0x9ebd7e77d0c5a3c2), UINT64_C(0xfdc292eb7cc6de77), UINT64_C(0x0ddfb8d005bc6bb7) }},
+  {{ UINT64_C(0x5f522eac048c1594), UINT64_C(0xe2cd880d29c9f1fa), UINT64_C(0x62207d1e1b100c09), UINT64_C(0xa9e844290a7b1256) }},
+  {{ UINT64_C(0x240009d09a1ada24), UINT64_C(0x9e391ea8471f978e), UINT64_C(0x78c7fd3d75af5494), UINT64_C(0x1251e3d2dd1caaf6) }},
+  {{ UINT64_C(0xd5b7c5f4a52e8afc), UINT64_C(0xb04e0e8073c20c7c), UINT64_C(0x9e6b26c4a55872d7), UINT64_C(0x97918e46adf8967a) }},
+  {{ UINT64_C(0x2178fe4ee416fc3c), UINT64_C(0x248f01a26075758b), UINT64_C(0xdd74f54909afb1d1), UINT64_C(0xda2d88c8b7788646) }},
+  {{ UINT64_C(0xb60dfb9dc519eb52), UINT64_C(0x86b75bf362d91d66), UINT64_C(0x1a2838ede56f4bd7), UINT64_C(0xb0015a9fe481fe17) }},
+  {{ UINT64_C(0xb0342cad40176e10), UINT64_C(0x02438a47dbfbbc97), UINT64_C(0x4d7b82c5c0bf8642), UINT64_C(0x65285725030da83e) }},
+  {{ UINT64_C(0x0b32ef0dab72605c), UINT64_C(0xb852ad5083716dae), UINT64_C(0x1af421bcbdb9c33a), UINT64_C(0xc2715bf085994ac3) }},
+  {{ UINT64_C(0xa56b74f10ff07e2c), UINT64_C(0xde35d9ff42a87d6b), UINT64_C(0x52db03468e2acaeb), UINT64_C(0xc473c096847b603f) }},
+  {{ UINT64_C(0xca0b4c334325baa6), UINT64_C(0xbf50511e2f1e67af), UINT64_C(0x62b65af8df474043), UINT64_C(0x3ed26fd1b6b5a65a) }},
+  {{ UINT64_C(0xb710a8ee8785c366), UINT64_C(0xa147782e91f8304e), UINT64_C(0x683c62edda9e4098), UINT64_C(0xe5c3158688770606) }},
+  {{ UINT64_C(0x3367697643020fa8), UINT64_C(0xd19393bb818db192), UINT64_C(0x2659a4c8b653c3e2), UINT64_C(0xb5c499af35a4552c) }},
+  {{ UINT64_C(0x2372859150df6c98), UINT64_C(0xa0b4282ee7f9dd6f), UINT64_C(0xc0a9f4e5a00c9ce1), UINT64_C(0xb27f61e510fb2f62) }},
+  {{ UINT64_C(0x8cc7c2beecc719ae), UINT64_C(0x4babc4f826bccad3), UINT64_C(0xdbd0fe6263f348b5), UINT64_C(0x382ef024781affbb) }},
+  {{ UINT64_C(0x2b4356684ac7f782), UINT64_C(0x6f6f87c9d48a8b3d), UINT64_C(0xb190e1778087f1df), UINT64_C(0xaf073a8dcddfab07) }},
+  {{ UINT64_C(0x3a5eaf682a8dfaa4), UINT64_C(0x812c321b77858047), UINT64_C(0x7b1d37c5bd062493), UINT64_C(0x42d9d9dca8f34795) }},
+  {{ UINT64_C(0x1a2ace76a0f02346), UINT64_C(0x73d4f9dc49ee4984), UINT64_C(0xfd322f58e967dd01), UINT64_C(0x44bc5e19d33f7492) }},
+  {{ UINT64_C(0x99019772513be608), UINT64_C(0x8382a9bff48eea89), UINT64_C(0xc44eb243a6d46d42), UINT64_C(0x39d14afb47a2337a) }},
+  {{ UINT64_C(0xa6b0d9aee19ade20), UINT64_C(0x182466b3077f6a84), UINT64_C(0x72824840c82d4867), UINT64_C(0xfaef13125f93cc3d) }},
+  {{ UINT64_C(0x9ddd76c34358baee), UINT64_C(0x7a2f938b38a2b971), UINT64_C(0x56187933305bf4f2), UINT64_C(0x1c9b08a0f5361938) }},
+  {{ UINT64_C(0x11c333324b73256c), UINT64_C(0x9773276ccc7072f9), UINT64_C(0xc0d8895091ce1974), UINT64_C(0x77451c34f3b813aa) }},
+  {{ UINT64_C(0x057a2f77f1a6aeec), UINT64_C(0x0ca9715e266ddeb7), UINT64_C(0x6f20cae7d4c02617), UINT64_C(0xae8ccc24fd053ef1) }},
+  {{ UINT64_C(0x3f7bfe940c207200), UINT64_C(0x795fbb6c6e675ea2), UINT64_C(0x7a6f21e2031c870d), UINT64_C(0x02e29194dbc5ea50) }},
+  {{ UINT64_C(0x5394cbcebb7e5f6a), UINT64_C(0x37592d730ffe1be3), UINT64_C(0x0815d0d03fa370cc), UINT64_C(0xcf9f54c01e0ffcec) }},
+  {{ UINT64_C(0x78c0953587a0980c), UINT64_C(0xf507d6fe637deee5), UINT64_C(0x1d84e2fdd0223d0e), UINT64_C(0x7d1a2cd06659d129) }},
+  {{ UINT64_C(0xe5ee4ff940833550), UINT64_C(0x5aa0eddce7ea4672), UINT64_C(0x5ce4dffd14888d0a), UINT64_C(0x3690cd1a0076ef3e) }},
+  {{ UINT64_C(0x66831e6b90068e3e), UINT64_C(0x2212cd5f90f68414), UINT64_C(0x6a66d0c05aa349e6), UINT64_C(0x9cd09dae43d46d85) }},
+  {{ UINT64_C(0x472395e0c6e1dc58), UINT64_C(0x4b2129ddc67e4d29), UINT64_C(0x288ec29f65add8bc), UINT64_C(0xc1c59c9a9cfec16c) }},
+  {{ UINT64_C(0xa30edccb798a66de), UINT64_C(0xbcb3dfdcce10cc03), UINT64_C(0x10c965a86db65cbf), UINT64_C(0xb9b4df2a2f9117e1) }},
+  {{ UINT64_C(0xec5ca399a8192216), UINT64_C(0x90ededce5c10c06b), UINT64_C(0x936efde0548ece0f), UINT64_C(0xb72b2270db1173eb) }},
+  {{ UINT64_C(0xa222fe0e20119e98), UINT64_C(0x4d96fccaf73e2b2d), UINT64_C(0x163ce656e4750e39), UINT64_C(0x9f33725693d98388) }},
+  {{ UINT64_C(0xbf35ce0d3854a9a6), UINT64_C(0xcfb2359721b66b8d), UINT64_C(0x70017bdbee8b91ef), UINT64_C(0xe02cf945c6207579) }},
+  {{ UINT64_C(0xf8a8ee71447be9b0), UINT64_C(0x1ed70ffa62c77b1f), UINT64_C(0x625d924c40627420), UINT64_C(0x6c76a867237c2894) }},
+  {{ UINT64_C(0xee08443e8ba900fe), UINT64_C(0x1ffa0b55d762628b), UINT64_C(0x4adaf7eb11a92d40), UINT64_C(0x67d7bedd4385c373) }},
+  {{ UINT64_C(0x18d63a44c892f4c2), UINT64_C(0xfc92a406bdd29575), UINT64_C(0x6707a166f7524ebe), UINT64_C(0x3b8a6c8c775a9aec) }},
+  {{ UINT64_C(0xc631f731fa894796), UINT64_C(0x1bd095b0a817e049), UINT64_C(0x6bc95818c2a121a9), UINT64_C(0xbb4f3757777aba0b) }},
+  {{ UINT64_C(0xc32f52edf92498da), UINT64_C(0x9669141aa6c1e9b3), UINT64_C(0x24c0e8f44ea9bb31), UINT64_C(0x66ce0a6324940a2b) }},
+  {{ UINT64_C(0x50709fbfcf190706), UINT64_C(0x72d8dd32d57c4f7a), UINT64_C(0x4316014c9431bb8c), UINT64_C(0x8f23749a5ae7d8c0) }},
+  {{ UINT64_C(0x9ef28d26f71de0a0), UINT64_C(0xc8bc076a67c0a618), UINT64_C(0x9a1259ec1b0494ff), UINT64_C(0x049586c6f565e1e6) }},
+  {{ UINT64_C(0x4fb842f4f1cc9916), UINT64_C(0x5ba45b4bcda0f68d), UINT64_C(0x266fabbafe4ac1ed), UINT64_C(0xf2ab5ecdf5518584) }},
+  {{ UINT64_C(0x8c0348dfd509a30c), UINT64_C(0xe9d786481b174839), UINT64_C(0x7fa4dcf0aaf20ed2), UINT64_C(0xf8f3cd0260fbd9e7) }},
+  {{ UINT64_C(0x72fbeed9672f081c), UINT64_C(0x0768539fd049a72c), UINT64_C(0xd8611dac33819724), UINT64_C(0x5851b96de036874c) }},
+  {{ UINT64_C(0xa6b6fa21dc8c8f74), UINT64_C(0xcadf0badd667b6f0), UINT64_C(0x8ead87db1549fa1a), UINT64_C(0x5f37d949b1121bfa) }},
+  {{ UINT64_C(0x0763af344829f348), UINT64_C(0x640ee2d9da51a75a), UINT64_C(0x78d1b08194d5a5b8), UINT64_C(0x5e3808c32f87b6e9) }},
+  {{ UINT64_C(0x2598771f5ef42c52), UINT64_C(0x710e3e5f96b80d94), UINT64_C(0x881627eb05c6b9d5), UINT64_C(0x5896ba0a2dc6a179) }},
+  {{ UINT64_C(0x4eba56749bb8142c), UINT64_C(0x7f5e5a152af6dda1), UINT64_C(0x008f7db7e72c7126), UINT64_C(0xd9c43e316af09551) }},
+  {{ UINT64_C(0xab77afa337e5af92), UINT64_C(0xd747baff8d995591), UINT64_C(0xbbe295970508d6f2), UINT64_C(0x6a1a1b56ac832bcd) }},
+  {{ UINT64_C(0x9a8e00e2789f5d3a), UINT64_C(0x4757442e882088f8), UINT64_C(0x7559f644a50c04ae), UINT64_C(0xf99c23928104f00e) }},
+  {{ UINT64_C(0xbdacc17bf9995502), UINT64_C(0xf4d4ca2b3590192d), UINT64_C(0x7c1a1b9534240768), UINT64_C(0xae7c92364d30ceaf) }},
+  {{ UINT64_C(0x690f80fb86dea176), UINT64_C(0x8dd05621af51e5b6), UINT64_C(0x3b9e396c9a18fe29), UINT64_C(0xdbc8b5fdb65c3f89) }},
+  {{ UINT64_C(0x7959651e63050746), UINT64_C(0x529bab43d7a297a9), UINT64_C(0xffcaf2f56930cd3f), UINT64_C(0x9d6821fe0bd7dce3) }},
+  {{ UINT64_C(0x1c3d2f096a704746), UINT64_C(0x1017c40376afca70), UINT64_C(0xda30b9bb681c4fbe), UINT64_C(0xaf27c371aca704eb) }},
+  {{ UINT64_C(0x483ad1a073366e94), UINT64_C(0x623c7facf1ec006f), UINT64_C(0x2a3a055a772d95cf), UINT64_C(0x3c0607282f9be135) }},
+  {{ UINT64_C(0x8004344d52882cea), UINT64_C(0x7dec44ff7f5c90ca), UINT64_C(0x2c603bf2d153565c), UINT64_C(0xc99463d370e93287) }},
+  {{ UINT64_C(0x133e1f68d4866b28), UINT64_C(0xaa93000e878db63b), UINT64_C(0xfa861fe3bb1e19f3), UINT64_C(0xdbb3328f436f6a7a) }},
+  {{ UINT64_C(0x06f1f0968466c608), UINT64_C(0x256df5b3f74302cc), UINT64_C(0xff1fbb9fada0b575), UINT64_C(0x19b6603a08217380) }},
+  {{ UINT64_C(0x1515a00cd57e11a4), UINT64_C(0x532faf5d47f0c8bf), UINT64_C(0x930bb898b2981e27), UINT64_C(0xd69531fad839ff47) }},
+  {{ UINT64_C(0xc816114132f87b0e), UINT64_C(0x2bd89fbea422e029), UINT64_C(0xa79906f5d4d9cb93), UINT64_C(0x1c5c81ee3016eb80) }},
+  {{ UINT64_C(0xede21f4b49fd9e8c), UINT64_C(0x794f0aff61775f97), UINT64_C(0x11e68a1f3ddbbe1a), UINT64_C(0x868ab22691309b2a) }},
+  {{ UINT64_C(0xa54b818d01a006a8), UINT64_C(0x6d96fea00cbfe054), UINT64_C(0xfac70c4539568ad3), UINT64_C(0xfe3e526a6d515e1e) }},
+  {{ UINT64_C(0xc2c010362d2e4802), UINT64_C(0x4dbafd7d484c8f0b), UINT64_C(0x99785e592b405bbc), UINT64_C(0xb7221d7b37631832) }},
+  {{ UINT64_C(0xb534c9351b917372), UINT64_C(0xe0a617ca8d7fb52e), UINT64_C(0xf59d96a1e0dc7444), UINT64_C(0x9067130105c61a1c) }},
+  {{ UINT64_C(0xd1f8729e0c5845a4), UINT64_C(0x61d464399b624907), UINT64_C(0xdf23e930a4933193), UINT64_C(0xcc381ee858565f9d) }},
+  {{ UINT64_C(0x2d8e63c6fb489eb4), UINT64_C(0xac4c919e1c8acac7), UINT64_C(0x5d53ff934ecf80e3), UINT64_C(0x05074a77449b40aa) }},
+  {{ UINT64_C(0xd64787880afa24f2), UINT64_C(0x967538cbee72a3ab), UINT64_C(0x1ca4ecc040b2e39a), UINT64_C(0xf15144bdf63e44d3) }},
+  {{ UINT64_C(0x61ecaf0a7a4f4d24), UINT64_C(0xf5345a0e7ed20295), UINT64_C(0x871e5711f6d8eed8), UINT64_C(0x8cf01ef41434acbd) }},
+  {{ UINT64_C(0xeb49d7a1cd01dbb8), UINT64_C(0x92ada707486eb9e5), UINT64_C(0x70ea0ff680522036), UINT64_C(0x996db071a2480e9a) }},
+  {{ UINT64_C(0xb4fa9d23ea26454a), UINT64_C(0xe7654401cde99c8d), UINT64_C(0xf9a9e5c38ce55346), UINT64_C(0xddefcf575ff7957a) }},
+  {{ UINT64_C(0xa9e7a1060ca36870), UINT64_C(0x0de9b4ab460e4200), UINT64_C(0xe53ba5ce5a5de124), UINT64_C(0xf03a7b7b94c16cea) }},
+  {{ UINT64_C(0x199a4b2a123aa414), UINT64_C(0x2bc5be675d1e8e68), UINT64_C(0xbcfe87eee2687b72), UINT64_C(0x9fea131436705eb7) }},
+  {{ UINT64_C(0xe92ae473f8b3bf8c), UINT64_C(0x2e0fcee0949ab294), UINT64_C(0xb5d8cd95ad991e5c), UINT64_C(0xb458f112cba358fc) }},
+  {{ UINT64_C(0x2c9a0f0f42cc8cd6), UINT64_C(0xd7557d5e4d9466cc), UINT64_C(0x42cd27d9b02361e7), UINT64_C(0x3221dcd7f63c619d) }},
+  {{ UINT64_C(0x40a80f90313ba842), UINT64_C(0x1ce4285816dc821d), UINT64_C(0xec35c23e8300f663), UINT64_C(0x9b049999a101aa52) }},
+  {{ UINT64_C(0x601f84b6d4117096), UINT64_C(0xe7c2ae23f2fb9c4b), UINT64_C(0x2f4f0474dc9451f8), UINT64_C(0x4fb40005970a290c) }},
+  {{ UINT64_C(0x8d7df2b3945bb352), UINT64_C(0x9117655f6a4fbd49), UINT64_C(0x1abffcad75780113), UINT64_C(0x236533cb5cc73805) }},
+  {{ UINT64_C(0x64bef9e405e17308), UINT64_C(0x8030cf62a47f75e1), UINT64_C(0x0901460078e7577e), UINT64_C(0x15dd9c83f39ef4e9) }},
+  {{ UINT64_C(0x2c487263071384c2), UINT64_C(0x9780caeda398dd7b), UINT64_C(0xae5b542e89ce0e68), UINT64_C(0xe5076d53f40177c7) }},
+  {{ UINT64_C(0x164a60ad63bc5738), UINT64_C(0xe7a8017626671bab), UINT64_C(0x7a977bdd667d08b7), UINT64_C(0xa49fe02d521c3a10) }},
+  {{ UINT64_C(0x1625126c967ca812), UINT64_C(0xc1633e3cf0a22ff0), UINT64_C(0x98d614e8fba94e9c), UINT64_C(0x4d1138dba398d6d2) }},
+  {{ UINT64_C(0xba6b73084f51f2d6), UINT64_C(0xaa729d220da4d958), UINT64_C(0x6d8bbaf22cb396cb), UINT64_C(0x08e3bd52a5135227) }},
+  {{ UINT64_C(0xb72b1af22ef1c70a), UINT64_C(0x80757af56f1948d1), UINT64_C(0x52b3b265cd630d86), UINT64_C(0x97a993f3269ede18) }},
+  {{ UINT64_C(0x3a34b0f621fb27c4), UINT64_C(0xb654437cd00f2732), UINT64_C(0x67d9b13024724949), UINT64_C(0xed697808f0e6eaf9) }},
+  {{ UINT64_C(0x9c9f0457a73f4668), UINT64_C(0x18d13563528abe20), UINT64_C(0x45df9b32ad063d99), UINT64_C(0x94a99bef0aba0824) }},
+  {{ UINT64_C(0x5aba8439907c8c52), UINT64_C(0x7fb478707b1e397a), UINT64_C(0x5ed458012083ab63), UINT64_C(0xa5f2da6b95c843c1) }},
+  {{ UINT64_C(0x070819094e5ad59c), UINT64_C(0x71d5b74ac6da1e08), UINT64_C(0x5c54a0fa72de9269), UINT64_C(0x49dd722700432f90) }},
+  {{ UINT64_C(0xb94b15ba82ef81c4), UINT64_C(0x16c62255f050c9f3), UINT64_C(0xb474380f03930259), UINT64_C(0x483442a9490b2e3e) }},
+  {{ UINT64_C(0xe5fe4f12f324fe70), UINT64_C(0xa6efea676d7e79c8), UINT64_C(0xf5d419a8a21fb672), UINT64_C(0x8bc03483e0a7d6e9) }},
+  {{ UINT64_C(0x1c3d709bc2753372), UINT64_C(0x9f990da057a4584f), UINT64_C(0xd3a20c26ebec8241), UINT64_C(0x1aac1ecdaa3196c6) }},
+};
+
+static const mzd_local_t K_4[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0xa209d4d4cf756394), UINT64_C(0xa297ee7c0b0e7da1), UINT64_C(0x90a6fe9074a39c90), UINT64_C(0xf2565af93b6adc94) }},
+  {{ UINT64_C(0x3924490ad4212b68), UINT64_C(0x0deeb42b799e83ea), UINT64_C(0x99a4e405d49aa251), UINT64_C(0x07346de5902505ca) }},
+  {{ UINT64_C(0xf2886375cfce7672), UINT64_C(0x60f921a209d1b674), UINT64_C(0x01f3a46dd812abd0), UINT64_C(0x1b70cc71b675d138) }},
+  {{ UINT64_C(0x71039ad12d9ce754), UINT64_C(0xc968c238912b9bad), UINT64_C(0xdd03664284533eab), UINT64_C(0x3f8091d188750f67) }},
+  {{ UINT64_C(0x7e4acce4cc606e62), UINT64_C(0x639aac84d791a071), UINT64_C(0x599c928543b37be2), UINT64_C(0x4de44f4e92420ec8) }},
+  {{ UINT64_C(0x05ad1af09e1d6dba), UINT64_C(0x35e8307a0c74c587), UINT64_C(0x1248332eaf8d097a), UINT64_C(0x7d731e436c16f41d) }},
+  {{ UINT64_C(0xedbcb30508a23d16), UINT64_C(0xba175a369b559bf6), UINT64_C(0x7300c8c7ea01a261), UINT64_C(0xfe032272f1cb8cc5) }},
+  {{ UINT64_C(0xd7c9572b3b7b6f38), UINT64_C(0x64480a87ab5b103d), UINT64_C(0x6b3e706f8fbb5de2), UINT64_C(0x3b3a935718f4fcd5) }},
+  {{ UINT64_C(0x9f2ea5158ed7c906), UINT64_C(0xab9d7f824285fed5), UINT64_C(0x06065ee6b59aaeaa), UINT64_C(0x9b79d7375d7408db) }},
+  {{ UINT64_C(0x38625f483f473606), UINT64_C(0x3e8b99a7a2c9884b), UINT64_C(0x912607932fa52215), UINT64_C(0x1d20c8defb275905) }},
+  {{ UINT64_C(0xb51203170d23c672), UINT64_C(0x55e21c9c281912ee), UINT64_C(0x5509466c8f2a5e5b), UINT64_C(0xf684bad4a225e1a3) }},
+  {{ UINT64_C(0x445fb99b3e71877c), UINT64_C(0x290a199744fe683d), UINT64_C(0x8959acaf93c981b1), UINT64_C(0x00822053cd02d253) }},
+  {{ UINT64_C(0x82a42326a7b9552a), UINT64_C(0x7c83a7559b6919c7), UINT64_C(0x5f74757363d7e591), UINT64_C(0xd6c85217bf3ebf75) }},
+  {{ UINT64_C(0x33d287504bfc4222), UINT64_C(0xe631b84543e8ea12), UINT64_C(0xcb4cdfc6b905b536), UINT64_C(0x617fa7f9070a6b43) }},
+  {{ UINT64_C(0x30e440782ef6c940), UINT64_C(0xb69457262a12b1f7), UINT64_C(0x332e5f4a92115b2b), UINT64_C(0x1a3b2b35c1fc6545) }},
+  {{ UINT64_C(0x49ff0d7012ca3d48), UINT64_C(0x162eab7b0ac2cd17), UINT64_C(0x0e33ff1905fcda06), UINT64_C(0x35c3a97af486a389) }},
+  {{ UINT64_C(0x85a3372d33051c1a), UINT64_C(0xb62aba67615e0b40), UINT64_C(0x790da179d6813b52), UINT64_C(0x057bc0760a28b741) }},
+  {{ UINT64_C(0x2850d6a1d459b59e), UINT64_C(0xb4aa5d8b855bbd5c), UINT64_C(0x4856ccdab56b4301), UINT64_C(0xe084149c051351dc) }},
+  {{ UINT64_C(0xf6fcc56083c784c8), UINT64_C(0xaaae1980551fbf10), UINT64_C(0x1dd68595954d348a), UINT64_C(0x46db7a9fe1f08f3f) }},
+  {{ UINT64_C(0x99502099c7fb1b88), UINT64_C(0x7fd30fcaa4a4a281), UINT64_C(0xb728858325fffbca), UINT64_C(0x11ec049c91e050c1) }},
+  {{ UINT64_C(0x6066c60eed7ec868), UINT64_C(0x3931bb22521e676f), UINT64_C(0x84eae4ab23d657d2), UINT64_C(0x09b28a6bc969a1f9) }},
+  {{ UINT64_C(0x7c253f85fe2fbff8), UINT64_C(0x2d183444ab185f89), UINT64_C(0xa7687e248436274f), UINT64_C(0x1c6897240c14be5d) }},
+  {{ UINT64_C(0x2f61a03f669fd09a), UINT64_C(0x6a089fdb65d8c9c2), UINT64_C(0x2e8bfe4784b18f4d), UINT64_C(0x6102ccaaaccd97d0) }},
+  {{ UINT64_C(0x2c7b77660e09ab64), UINT64_C(0x9791e026461519dc), UINT64_C(0x98926a48ad067fd4), UINT64_C(0x86fa50e7ccf9cc50) }},
+  {{ UINT64_C(0x23eeb8e5c8a1891a), UINT64_C(0xb28e3ddbebc23234), UINT64_C(0x4976d3a1b146d5a5), UINT64_C(0xfb9a81cdd8117ed4) }},
+  {{ UINT64_C(0x10ad704e20fa7bd4), UINT64_C(0x6dba266c26325acb), UINT64_C(0xb4a7701ade5a7ed2), UINT64_C(0x0acf0c8beca70c12) }},
+  {{ UINT64_C(0xab1e0b6dc9105094), UINT64_C(0x418ddf13d890ca45), UINT64_C(0x2ffcfe9332d1a934), UINT64_C(0xf750d695b47a7343) }},
+  {{ UINT64_C(0xe50c8005929a6470), UINT64_C(0x2507cfc8dc7e4483), UINT64_C(0xa93e522d64ae8d89), UINT64_C(0x4808e002c065cf2d) }},
+  {{ UINT64_C(0x6747d8286650410a), UINT64_C(0x5550c7b7991f975c), UINT64_C(0xbb836227f024c263), UINT64_C(0xc0480ea1436b1176) }},
+  {{ UINT64_C(0x57b72d249f6992fa), UINT64_C(0x9d9a4baaa040375c), UINT64_C(0xa0487835c7ff231d), UINT64_C(0x45b0237ceb620e42) }},
+  {{ UINT64_C(0x9e153f00ed315d50), UINT64_C(0x946df563f309be44), UINT64_C(0xeaed23a8b3ed318d), UINT64_C(0xd1acdea913ecbb9a) }},
+  {{ UINT64_C(0x1311939a8a5e126c), UINT64_C(0x7a4e22950e21c29a), UINT64_C(0xb9512943ef990d4c), UINT64_C(0xff6bb1df411876ab) }},
+  {{ UINT64_C(0xcf6b7c2669f38cce), UINT64_C(0xda5c98b1be338682), UINT64_C(0xbb068ecabbfcdceb), UINT64_C(0xb186692a9c58a7b4) }},
+  {{ UINT64_C(0x337f429071807286), UINT64_C(0xc1a0fed45bbc7a50), UINT64_C(0x28ad5609152be788), UINT64_C(0xc6d9bd1035932515) }},
+  {{ UINT64_C(0x7bf37d21272fc30e), UINT64_C(0x0b98159a344abd6b), UINT64_C(0xd67c73b5b5d86d09), UINT64_C(0xa0fe16f6260fd06f) }},
+  {{ UINT64_C(0x9f432a0f0cd1c60a), UINT64_C(0xf838ff309921fd3c), UINT64_C(0x068473c494afb063), UINT64_C(0x7cc8cd36d02bff9e) }},
+  {{ UINT64_C(0x6f8ab519f254a930), UINT64_C(0x6a2db06e6840d207), UINT64_C(0x2d3d8682177d2455), UINT64_C(0x534402a8112fcdbb) }},
+  {{ UINT64_C(0x9de88dc00a9821a0), UINT64_C(0xc7f34867dc21ef56), UINT64_C(0x0c0bad5aa8ebae74), UINT64_C(0xac5a30ee1f1f2298) }},
+  {{ UINT64_C(0x550ec4efd0cb5ea8), UINT64_C(0x5825244553d28b90), UINT64_C(0x3af3d351748db8ac), UINT64_C(0x934c64b9b1170c1b) }},
+  {{ UINT64_C(0xf1ce9a055595e096), UINT64_C(0x55aadf000c3aaa65), UINT64_C(0x93fbd6bf8d3cf354), UINT64_C(0x8e7c21d2caee970d) }},
+  {{ UINT64_C(0x9b13aed81a2d4170), UINT64_C(0x97c0f803e486e0f4), UINT64_C(0x8fcf85c3b7b72657), UINT64_C(0x32c8d13cb5e1f599) }},
+  {{ UINT64_C(0xce63bb6e92fb787a), UINT64_C(0xdf34ea569e3372d0), UINT64_C(0xbb9e74f5c16a8df8), UINT64_C(0x07e3bffe023edc5e) }},
+  {{ UINT64_C(0x8eb453e1e496013c), UINT64_C(0xe390f59c03a9a835), UINT64_C(0xdcf692e31fe30c25), UINT64_C(0xa9e17487d4687b88) }},
+  {{ UINT64_C(0xe4bbf5a05d3d405a), UINT64_C(0x66aad41f89959236), UINT64_C(0xfdfadb6d9891fbbe), UINT64_C(0xe6b9b2549d669f17) }},
+  {{ UINT64_C(0x0175c8ab559c03a6), UINT64_C(0x425f785f414185e1), UINT64_C(0xc2a756278a89b52e), UINT64_C(0xf862c61dcac9ea90) }},
+  {{ UINT64_C(0x30af7a5fe2cfb6fc), UINT64_C(0xa7e3d27a355f76b5), UINT64_C(0x31579fea1f83826f), UINT64_C(0x9bb527f4d53b7c1d) }},
+  {{ UINT64_C(0xa35739f4eb0b4f2c), UINT64_C(0xc6b1bef3b6c151cf), UINT64_C(0xa888f1b1a9b28d6f), UINT64_C(0x5112f13ad1f4d812) }},
+  {{ UINT64_C(0x031b09feed59d180), UINT64_C(0xe044fc243b71375f), UINT64_C(0x1395257584c55c29), UINT64_C(0x07d760194751534b) }},
+  {{ UINT64_C(0x30880e0b1db83a78), UINT64_C(0x5224f901de055a3c), UINT64_C(0x74e5cef30f53f338), UINT64_C(0x4a9d2c45f3f1786b) }},
+  {{ UINT64_C(0xc99e36c2157f304e), UINT64_C(0x7ed442a78ba98545), UINT64_C(0x216bece63e1c22e3), UINT64_C(0xeb993888eeedda61) }},
+  {{ UINT64_C(0x23b008cb5d2cd3e6), UINT64_C(0x65c44e8d19b115e1), UINT64_C(0x87c001141f09003f), UINT64_C(0x567bc304a0c68c41) }},
+  {{ UINT64_C(0xc81fb0408c54828c), UINT64_C(0x59cb78307bbf184f), UINT64_C(0xeaf3b00f884eac6a), UINT64_C(0x6e3453de6e190b82) }},
+  {{ UINT64_C(0x9c0b9495229987a4), UINT64_C(0xb5f41851a59b1f38), UINT64_C(0x62eb3cb1c7c43c9b), UINT64_C(0x9366b83c6f520227) }},
+  {{ UINT64_C(0x7605ddd6265dec64), UINT64_C(0xa24892043828f6ae), UINT64_C(0xaf95f8ab9010f24a), UINT64_C(0x889e63102093d280) }},
+  {{ UINT64_C(0x2abd547ff7ce6fb0), UINT64_C(0x8bbacb0aeef896b2), UINT64_C(0x7250b8850be8abc3), UINT64_C(0x30e87f3d9cb02f53) }},
+  {{ UINT64_C(0x77eea578d717e330), UINT64_C(0xac00df4f02ed2d09), UINT64_C(0xba821005f23db2b2), UINT64_C(0x7bcd44742f2097fa) }},
+  {{ UINT64_C(0x2580f89f6e2b1876), UINT64_C(0xb84831db3697fcf3), UINT64_C(0x89fc1f888e742103), UINT64_C(0x599c24e9011aa2f3) }},
+  {{ UINT64_C(0x9b818b06671a498e), UINT64_C(0xe8425fe705684710), UINT64_C(0x04a1bc8b39f1cd77), UINT64_C(0xb6a3215e73d00642) }},
+  {{ UINT64_C(0x4c9059b39500903e), UINT64_C(0xe0c52191206de76c), UINT64_C(0x76ea49afb87e7edb), UINT64_C(0x4a6e7c90a53a0147) }},
+  {{ UINT64_C(0x58c1278be81891ce), UINT64_C(0x596b8b790b9baee2), UINT64_C(0x0286d4b67ba06f96), UINT64_C(0xc3fafa73f7953601) }},
+  {{ UINT64_C(0xee356c31388dada8), UINT64_C(0x38ef4b2601d3c0f9), UINT64_C(0x989df1c706e4e060), UINT64_C(0xcff50531892664f0) }},
+  {{ UINT64_C(0x8beab2e57558dff4), UINT64_C(0x0ef05814cb3ae108), UINT64_C(0x3257d6dbc58ab65e), UINT64_C(0x0315cfaff831968a) }},
+  {{ UINT64_C(0x6bdcc74a9ad455ac), UINT64_C(0xa23414b96f127692), UINT64_C(0xaefbfccbb9a3e6ab), UINT64_C(0x6751831d30cdc5c0) }},
+  {{ UINT64_C(0x01b10fbb0e57aafc), UINT64_C(0xee0ac8520edc7bdc), UINT64_C(0x4ac3aa14a3391840), UINT64_C(0x9c7ea847752b20d9) }},
+  {{ UINT64_C(0x41d6c0cc6031a6dc), UINT64_C(0x6a34fcbd4e45f279), UINT64_C(0xf03756880f8797cc), UINT64_C(0x2a7614add54f3950) }},
+  {{ UINT64_C(0xa59b3cce7fe7ac88), UINT64_C(0x1cb5ffbaa0adec25), UINT64_C(0x7e639ae9ea5904ce), UINT64_C(0xb1c3fad101c4e7e9) }},
+  {{ UINT64_C(0xb89ef75082131fbc), UINT64_C(0x96a99b4b2d9da85a), UINT64_C(0x9b92ea9f653f41ac), UINT64_C(0x12b47b30c147b63b) }},
+  {{ UINT64_C(0xa306b0327620ecb4), UINT64_C(0x7a3a39709fdf73db), UINT64_C(0xaff5034e0daccafb), UINT64_C(0xe3cb053816174c32) }},
+  {{ UINT64_C(0x6af45ff8159f6c42), UINT64_C(0xc690d213c19ce267), UINT64_C(0xd1e872e581e4a98d), UINT64_C(0x1977690925387ad1) }},
+  {{ UINT64_C(0x5ec4a9bb68aab526), UINT64_C(0x63cb286f00f19097), UINT64_C(0x967f5fa8096afc4e), UINT64_C(0x0edd1f94dce5ca4b) }},
+  {{ UINT64_C(0x7e79bd4748ca21fc), UINT64_C(0xe1e6c21cf543381f), UINT64_C(0xb57bd11f7a211beb), UINT64_C(0xdf85d327246fde38) }},
+  {{ UINT64_C(0x8f708d5c306e9678), UINT64_C(0x751adc94dbf8e328), UINT64_C(0x3014c48fb297dff3), UINT64_C(0x818387ea5fe51e93) }},
+  {{ UINT64_C(0xaab1ebd8429279e6), UINT64_C(0x49851009ba81abb4), UINT64_C(0x58d5fcbf46d02cc1), UINT64_C(0x59cb5c8ea2a8ecef) }},
+  {{ UINT64_C(0xefd990593777abd0), UINT64_C(0xf75577469f87f2ac), UINT64_C(0x83f2241acc6124b4), UINT64_C(0xe8478709113067cb) }},
+  {{ UINT64_C(0xf15491e4d8d2ebda), UINT64_C(0xb510b09bfefefb4d), UINT64_C(0xc893fc927eef9dbd), UINT64_C(0x1715b531a3ab1087) }},
+  {{ UINT64_C(0x2b8bb54db29539e6), UINT64_C(0xeaf3fb9147c29158), UINT64_C(0x6bac8834e04309b8), UINT64_C(0x38ef73ff93d5084c) }},
+  {{ UINT64_C(0x7dd8273c48ee2e46), UINT64_C(0x37732bb73b1e4176), UINT64_C(0x3c491ec8922f2cf6), UINT64_C(0x0af2068d03edc5be) }},
+  {{ UINT64_C(0x813e0f375d45ea3e), UINT64_C(0x3bd40b09b3d63de6), UINT64_C(0x3135f02617c85972), UINT64_C(0x15d629a14ada9174) }},
+  {{ UINT64_C(0xcb90b77200d29b02), UINT64_C(0x52aa54ded26b91fd), UINT64_C(0x2f502acb62cb3646), UINT64_C(0x9fc59f8f01cc2616) }},
+  {{ UINT64_C(0x38bd59bb357e59a4), UINT64_C(0x3ecc726d3d24b79e), UINT64_C(0x821ac01b1d4a0e21), UINT64_C(0x3a3f19cc19bce129) }},
+  {{ UINT64_C(0x02b2c8052cdacb4c), UINT64_C(0x0d00daa5a6daa90f), UINT64_C(0xe57ef1f3761bdc6c), UINT64_C(0x446bfe00b67b883d) }},
+  {{ UINT64_C(0xcbe443bdcf78e444), UINT64_C(0x36d5534b9fbcb3f2), UINT64_C(0x848d0988f1598b8e), UINT64_C(0x1268efcb0987c628) }},
+  {{ UINT64_C(0x3438c4edee715118), UINT64_C(0x79eb843cc01563d1), UINT64_C(0xd10d831844cf9648), UINT64_C(0xdc834de3f2376961) }},
+  {{ UINT64_C(0x0ac907420c6e97a8), UINT64_C(0x09378eddbbe82561), UINT64_C(0x9e1533a4bd00e2f8), UINT64_C(0x7663cd35794ae54b) }},
+  {{ UINT64_C(0x593bf5adea17756c), UINT64_C(0xe814d2b51b34d94d), UINT64_C(0x1dd4d96a37be0997), UINT64_C(0x36db5d5a07cee094) }},
+  {{ UINT64_C(0x7b34f82fd06264b4), UINT64_C(0x17b8282492f1c7c7), UINT64_C(0x5c985bcfb0f062fc), UINT64_C(0xdd18de96c6c5f093) }},
+  {{ UINT64_C(0xbd22571ad2ce2234), UINT64_C(0x8e8ce8156a02eac0), UINT64_C(0xb633b1968a97de5a), UINT64_C(0x31daa49817617371) }},
+  {{ UINT64_C(0x67fcf96c66b24efa), UINT64_C(0xc0c4335fae9a0a9d), UINT64_C(0x10ffa4215204f488), UINT64_C(0xc4f9ae85640f53a9) }},
+  {{ UINT64_C(0x0591d38caecd09e0), UINT64_C(0x21df7d54b218b7ab), UINT64_C(0x4a4745e45d784ada), UINT64_C(0xa82c2dffb5c0c530) }},
+  {{ UINT64_C(0xa102e9fe6c04d5de), UINT64_C(0x5e96549d73f25f30), UINT64_C(0xcfd14896235ed108), UINT64_C(0x1aba09b76ed940e7) }},
+  {{ UINT64_C(0x39a45d84ce7e2a3a), UINT64_C(0xa8f8462766a22d72), UINT64_C(0x4edd158a76173485), UINT64_C(0x6fb8bb5bb9a06c56) }},
+  {{ UINT64_C(0x1d5c819918af1dca), UINT64_C(0xa15b35c353e1d87c), UINT64_C(0x0e42f20d92e45e40), UINT64_C(0x9c7b5d543851bb69) }},
+  {{ UINT64_C(0x7bd7a54124c0ab4a), UINT64_C(0x3db7c76b93662b65), UINT64_C(0xa1485a9cf858805d), UINT64_C(0xb64eb7e3ba97a186) }},
+  {{ UINT64_C(0x5f4cba88c3d510bc), UINT64_C(0xef8946ca66a94ac7), UINT64_C(0x8cc051c6403b7d50), UINT64_C(0xecf2a412c63dc077) }},
+  {{ UINT64_C(0x46482b4cf902be7a), UINT64_C(0x1137798fb6006205), UINT64_C(0xd3171acb03e874fa), UINT64_C(0x6e2fb1d59c9b75a9) }},
+  {{ UINT64_C(0xcaaef0a54ac5531e), UINT64_C(0x3858019a50f1ff92), UINT64_C(0x1f169b76591ab826), UINT64_C(0x7a1105a25b7b4411) }},
+  {{ UINT64_C(0x14218d452ce4b1f6), UINT64_C(0xa445390e12c3f224), UINT64_C(0x9022c6935af92d17), UINT64_C(0x47dc1bb07dddbc51) }},
+  {{ UINT64_C(0x6714312f571d1b9c), UINT64_C(0x1f06067eb097812c), UINT64_C(0x8b41406250a7651a), UINT64_C(0xf432151e01c8a4d1) }},
+  {{ UINT64_C(0x91c6b1be1811de46), UINT64_C(0x444e3c3c544e52b6), UINT64_C(0x8d6e867525daa320), UINT64_C(0xa1d58adde1167487) }},
+  {{ UINT64_C(0x65f891016ed4270c), UINT64_C(0x8e0cb4530410ba16), UINT64_C(0xb8ec279e5103af9d), UINT64_C(0xbe6b2bbf6b8fc3a2) }},
+  {{ UINT64_C(0xaf023da5d8896f84), UINT64_C(0x417441141aafb933), UINT64_C(0xd10b4646d17c4861), UINT64_C(0xb89ba8744699cd95) }},
+  {{ UINT64_C(0x1f61d3a0f5690d06), UINT64_C(0xcc6ed75f019a868c), UINT64_C(0x0f77f0585832c727), UINT64_C(0x014e98a20e5a40bc) }},
+  {{ UINT64_C(0xc405d00586009522), UINT64_C(0x39b13a005707e254), UINT64_C(0xc4c1fa532d3f5fb1), UINT64_C(0xdd67718d9419a79b) }},
+  {{ UINT64_C(0x081f9b132885b334), UINT64_C(0x1c7cc4d62666b0cb), UINT64_C(0xd8b4f6333c0226ce), UINT64_C(0xef0f5f4c8ccc5813) }},
+  {{ UINT64_C(0x2505b0bf44711536), UINT64_C(0x1d3f0451e1adfe5f), UINT64_C(0x1c4d4bdbc6020e83), UINT64_C(0xc7f11313a28af31e) }},
+  {{ UINT64_C(0x3d97cdb2673cbef6), UINT64_C(0x41431d312658440d), UINT64_C(0x75fae784fa546484), UINT64_C(0xa68ec2c601c7a14a) }},
+  {{ UINT64_C(0x4085fc983cf37518), UINT64_C(0xb80b54ab9deb51ea), UINT64_C(0x9ef7cc6d295cfd2e), UINT64_C(0xde73b9e331a4eb7b) }},
+  {{ UINT64_C(0xd247e9e1fcdd745a), UINT64_C(0xe59d3e4b599abb67), UINT64_C(0x26efae33963752b1), UINT64_C(0x4786008875f7e6fa) }},
+  {{ UINT64_C(0xf745948b96fa4670), UINT64_C(0xe15bd2ac482e5ff0), UINT64_C(0xd031935be8a0ca9e), UINT64_C(0x311cd244f44200af) }},
+  {{ UINT64_C(0xf1fdc885e19091be), UINT64_C(0x48c203af659d9876), UINT64_C(0xf97f3933595aa53a), UINT64_C(0x857b3b0c127673cc) }},
+  {{ UINT64_C(0xc512952bacda1c9c), UINT64_C(0x6227a7bc2bdb7fe9), UINT64_C(0xd455eb71dba5982e), UINT64_C(0xcc4c5578e5f989cb) }},
+  {{ UINT64_C(0x17a4f972a71e60ee), UINT64_C(0x15179116d4570420), UINT64_C(0x5a0680866291bbdc), UINT64_C(0x87016c98b63038e1) }},
+  {{ UINT64_C(0xdf693610d25aa44a), UINT64_C(0xf50ebd25eebdd93e), UINT64_C(0x34b54c1ebe59df25), UINT64_C(0x70c94ea636958210) }},
+  {{ UINT64_C(0x375a479d72e740ea), UINT64_C(0x602708fc4a97e8fd), UINT64_C(0x66ed3f6c6f2d1404), UINT64_C(0x841640da57624b37) }},
+  {{ UINT64_C(0x0c54e5e566b16e56), UINT64_C(0x73b3e4338c57d4d3), UINT64_C(0x4efd762e3442e373), UINT64_C(0x6605f6359d55d4f7) }},
+  {{ UINT64_C(0xe828fdca42a5a9ea), UINT64_C(0x9b1402a85a76bfc3), UINT64_C(0x28a90959a63d8f52), UINT64_C(0x05b087774f269ec2) }},
+  {{ UINT64_C(0x5ffe384c32b48696), UINT64_C(0xbd14d24ae25b39fa), UINT64_C(0xcc1c9a1ae2b591d0), UINT64_C(0xd305eaff01e3348a) }},
+  {{ UINT64_C(0x86f4a15a876f8222), UINT64_C(0x6e1c530628ec3886), UINT64_C(0xea9838dce9d80a66), UINT64_C(0xd3b60702b046ff52) }},
+  {{ UINT64_C(0xd10b1bdda7479190), UINT64_C(0x7ccd57a2355ed08f), UINT64_C(0xd1bb02b9c68a125f), UINT64_C(0x5ba591edb91db570) }},
+  {{ UINT64_C(0xb175a78b6e62260a), UINT64_C(0x70036867f4988d9e), UINT64_C(0xd1bb90480e463c98), UINT64_C(0x6d03747c78da5811) }},
+  {{ UINT64_C(0x66bad8a41e34e934), UINT64_C(0xaa86d525910f49d2), UINT64_C(0x1d2fcbd67b81538d), UINT64_C(0xc25b07d8b879cb58) }},
+  {{ UINT64_C(0x2f85ffd638676d12), UINT64_C(0xabafa38dc5b1ae30), UINT64_C(0xad1701e60045b834), UINT64_C(0x0de7b640f6e81883) }},
+  {{ UINT64_C(0x71f14fa7babecad6), UINT64_C(0x998cb000a5072d13), UINT64_C(0x96dc2b6d962c9bcc), UINT64_C(0x8783f35b0183584a) }},
+  {{ UINT64_C(0x663fc29563e26f1a), UINT64_C(0x64ab8f92979d679b), UINT64_C(0xdef8d197eee0ec4f), UINT64_C(0xb44c8c41739bdbf5) }},
+  {{ UINT64_C(0xcb794c14b4013fde), UINT64_C(0x3f903b3e3aef7740), UINT64_C(0xe0543ceed6b1ca50), UINT64_C(0xe4a2ade0e88f4950) }},
+  {{ UINT64_C(0x9557b94dc47da322), UINT64_C(0x5754fcd4ca31f488), UINT64_C(0xe07ab68ea9dc0f00), UINT64_C(0x14419315884acc85) }},
+  {{ UINT64_C(0x867f693ec50d7884), UINT64_C(0x0f28d956dc3e2b43), UINT64_C(0xa8999c9451a981b4), UINT64_C(0x6dfe5be3aecf9fd9) }},
+  {{ UINT64_C(0xcf7e38333fff89e0), UINT64_C(0x0a9098645df35fdc), UINT64_C(0x97678e3e851e5535), UINT64_C(0x174e4aece6e22388) }},
+  {{ UINT64_C(0x03891fee71e68e9c), UINT64_C(0xb90a52bafeba5dbf), UINT64_C(0xe1aa889973e220d0), UINT64_C(0x1e805f75c333626b) }},
+  {{ UINT64_C(0x6fc28da769505fee), UINT64_C(0xc90ba0e1509defed), UINT64_C(0xacf5f7b7cbcadcf5), UINT64_C(0x34fe68b12d37ccaf) }},
+  {{ UINT64_C(0xb48a41a0c677da76), UINT64_C(0x1ce74e1e4aae568b), UINT64_C(0xd2f1c4011bdb656a), UINT64_C(0x0b34b7736676c9d0) }},
+  {{ UINT64_C(0x3cd4aa0350d825f4), UINT64_C(0x7949b30c0a7554c4), UINT64_C(0x0bbbd5db3d02bb23), UINT64_C(0x3afe4e99fec42ced) }},
+  {{ UINT64_C(0x14f094c72a8dac2a), UINT64_C(0x61fd6d784ce6b06a), UINT64_C(0xf9e732cbd71bc9b0), UINT64_C(0x90b9f42b78d0cfbb) }},
+  {{ UINT64_C(0x45c8df7d746344f0), UINT64_C(0x8e84b000323381df), UINT64_C(0xf75417264b2c6b01), UINT64_C(0xcd2bec55a7d78d40) }},
+  {{ UINT64_C(0xc638fb35d5a3af36), UINT64_C(0xbb475565975d7dd2), UINT64_C(0xeca8435cb345b592), UINT64_C(0x787f27b02259f564) }},
+  {{ UINT64_C(0xc528552b06ebc278), UINT64_C(0x33dce11bbb8f1f67), UINT64_C(0xddb72c1eb615a04f), UINT64_C(0x969597d972ba2a1d) }},
+  {{ UINT64_C(0x35a9f9df85b5105e), UINT64_C(0x0eadac8602caf77c), UINT64_C(0x12348374d37dc557), UINT64_C(0x95a20cee1774844d) }},
+  {{ UINT64_C(0xb77111dacb3c41f4), UINT64_C(0x68a6ae9045629ab9), UINT64_C(0x07080fc0662f4e21), UINT64_C(0xc36806ea17087344) }},
+  {{ UINT64_C(0x34aca8691e9ac7a6), UINT64_C(0x6b4dfc991c851d2a), UINT64_C(0x6d1f4f74f2a96b02), UINT64_C(0x0634b06b0b8fc6c3) }},
+  {{ UINT64_C(0x47c26889893696d6), UINT64_C(0xdf408b08398177f5), UINT64_C(0x87331bb82fa89c27), UINT64_C(0xd3e17c0c6d238cc2) }},
+  {{ UINT64_C(0x067f2544bcb74650), UINT64_C(0xf1d4c6ca72ff3ca5), UINT64_C(0xd232b80cb0a338c2), UINT64_C(0xc80692221a5fad07) }},
+  {{ UINT64_C(0xfe0ec034b27e02b0), UINT64_C(0xffe3fbfdfb90cc1d), UINT64_C(0xa453192fffa30c14), UINT64_C(0x09b2818ba583e99d) }},
+  {{ UINT64_C(0x68becef1eb058a84), UINT64_C(0xa71adf1a56e95dab), UINT64_C(0x1b22741794ca7b39), UINT64_C(0x92f9ffa1980579c2) }},
+  {{ UINT64_C(0x6948848356fff106), UINT64_C(0x9c1b8a71c58de8b4), UINT64_C(0x462d273321128c12), UINT64_C(0x5602d9a8dc9d56cd) }},
+  {{ UINT64_C(0xb72f7f8c414db22c), UINT64_C(0x7a0affa3c461dc0f), UINT64_C(0x4dd3e39e5cd10252), UINT64_C(0x4e2ad5d8b94871db) }},
+  {{ UINT64_C(0x76e6612e874fda50), UINT64_C(0xe2e7ab677c180d86), UINT64_C(0xe4f7bb6a7053fe7d), UINT64_C(0x49a6d60386f91025) }},
+  {{ UINT64_C(0xbff0bb4b5e8f05bc), UINT64_C(0x0168e8d503ae7747), UINT64_C(0xe12b57bbddf9db22), UINT64_C(0xfddc5fc7e6ff7441) }},
+  {{ UINT64_C(0xa7c18868a7c6822a), UINT64_C(0x7039fd46bd0200af), UINT64_C(0xd30b5bca94bf4739), UINT64_C(0x84fcee683d4b54c3) }},
+  {{ UINT64_C(0x0f9315fd1cc8f8b4), UINT64_C(0xdcab0944e3bdea4c), UINT64_C(0x7b3b00b54629fc68), UINT64_C(0x171e24bfa464bece) }},
+  {{ UINT64_C(0x34c72c53ad961822), UINT64_C(0xac4164e0bca93fcc), UINT64_C(0x07ae7851efba5730), UINT64_C(0x1ca52704598b0018) }},
+  {{ UINT64_C(0x2b8a9cb2e989e63c), UINT64_C(0xae6e33b49fe2341d), UINT64_C(0x69bd5b8f3694754e), UINT64_C(0x66f881e97f9d1926) }},
+  {{ UINT64_C(0x0eac7db3821da65a), UINT64_C(0x0aff9cd84a0dd2f8), UINT64_C(0x2aa2393efb995e47), UINT64_C(0x4964e1de8e21d13b) }},
+  {{ UINT64_C(0x3a7ad542330ef28a), UINT64_C(0x7265ba45eec8e6bc), UINT64_C(0xf7a770d457faf944), UINT64_C(0xeddf3fe45544c20a) }},
+  {{ UINT64_C(0xcb03dfa40b0055ee), UINT64_C(0x6999960250655f1e), UINT64_C(0xdab22c7ae9ec32e1), UINT64_C(0x25af67c77fb7a9d9) }},
+  {{ UINT64_C(0xbcf3d2e9d5872782), UINT64_C(0x1a96093e73d277d4), UINT64_C(0xbb9db6e3b02598b3), UINT64_C(0x892537fd4a50eee1) }},
+  {{ UINT64_C(0x1c035eaf2ee03996), UINT64_C(0x2e4ecde39dff13ad), UINT64_C(0x790b855ae45e3c5e), UINT64_C(0x3eadd53e2d4ed7ab) }},
+  {{ UINT64_C(0x1270fdcb7b37afec), UINT64_C(0x8ec78432f3e084f2), UINT64_C(0xfcfa19369b94bcc4), UINT64_C(0x0a58fd4fe0be5ea3) }},
+  {{ UINT64_C(0x0b6399b309b23302), UINT64_C(0x0384835d398fff1f), UINT64_C(0x21efb6a8309cc96d), UINT64_C(0x03baa86f6b3c3fde) }},
+  {{ UINT64_C(0xba037fe6092416e0), UINT64_C(0xc9670be43bd198e9), UINT64_C(0x98463da01d8d1044), UINT64_C(0x280796497f237093) }},
+  {{ UINT64_C(0x575e1b22c8eeac4a), UINT64_C(0x59130a43b8c78ce7), UINT64_C(0xbb3fe9621cea65bb), UINT64_C(0xf6cc4aa01652ad13) }},
+  {{ UINT64_C(0x52e819b85a3abece), UINT64_C(0x484b20847f228824), UINT64_C(0x2541721428c71507), UINT64_C(0x7141fef945ca4678) }},
+  {{ UINT64_C(0x44dcea3f0ba584d8), UINT64_C(0x243f62d00abb759a), UINT64_C(0x228e5e527258bde3), UINT64_C(0xd436206155f431b5) }},
+  {{ UINT64_C(0xd89d832ba06839e2), UINT64_C(0x414ac6f392165e44), UINT64_C(0xd7eb5bcc03a85509), UINT64_C(0x98ce8313656dbcb7) }},
+  {{ UINT64_C(0xe747dc42ac8b307e), UINT64_C(0xfee5b792589811b7), UINT64_C(0xd246ddc38e15e45d), UINT64_C(0xc0347a48fe4f7c69) }},
+  {{ UINT64_C(0xa0c25fd83a00b57a), UINT64_C(0xafc639f23e993f2b), UINT64_C(0xfb1fa11e28500923), UINT64_C(0x939aaa60bb7ef9f7) }},
+  {{ UINT64_C(0x54c5191144dd30ec), UINT64_C(0x0bc5e592c57bcd8b), UINT64_C(0x434a483e863cbbbc), UINT64_C(0xff6742dadf8d5b78) }},
+  {{ UINT64_C(0x984d0a86b2472d56), UINT64_C(0x2356357b634847e5), UINT64_C(0x496df7088444e9e2), UINT64_C(0x09f2c923ae8ace90) }},
+  {{ UINT64_C(0xbecd758556c9b24e), UINT64_C(0xec54bd07818a8082), UINT64_C(0xc795c99308e6bc93), UINT64_C(0x4c9143a2be456ad7) }},
+  {{ UINT64_C(0xe0f0bf8963a12012), UINT64_C(0x29b71542bc85e892), UINT64_C(0xc647f31d57cdd977), UINT64_C(0x0186d4a8cdb6a9ae) }},
+  {{ UINT64_C(0x5228d9547db01cd8), UINT64_C(0xf8effdb981b200ca), UINT64_C(0x4d6446c0a4d22375), UINT64_C(0xcb862e5a29c55b2c) }},
+  {{ UINT64_C(0x06b30c5949ba8e50), UINT64_C(0x372c77075176c6b2), UINT64_C(0xada78e594c8ca120), UINT64_C(0x19878767bd8b3523) }},
+  {{ UINT64_C(0x4cabf9f3eafee638), UINT64_C(0x5a6a5d37e3ffb586), UINT64_C(0x2cc7aa13b6cd3013), UINT64_C(0x872b5de7179dd27a) }},
+  {{ UINT64_C(0x66c961b8257add56), UINT64_C(0x2622583f90a01362), UINT64_C(0x4679f102ef8f8b97), UINT64_C(0xaf551f03f1105b8f) }},
+  {{ UINT64_C(0x953a6b995a0cb0ac), UINT64_C(0xad849a132a405888), UINT64_C(0x848705be2bd87f34), UINT64_C(0x1c3e6f009defd7ef) }},
+  {{ UINT64_C(0xb4dc815ce605d25a), UINT64_C(0x2782ccd45dc34179), UINT64_C(0x13d2c69ec9a2f510), UINT64_C(0xa64732c1f741028b) }},
+  {{ UINT64_C(0xc4bf3c36f9e97658), UINT64_C(0xabeee4145eeb4fbc), UINT64_C(0xd9d0fb3db662a0e8), UINT64_C(0xc731c28015281026) }},
+  {{ UINT64_C(0x26395e75994a8e2e), UINT64_C(0x18a71509041fb396), UINT64_C(0x099529caf6fc7d46), UINT64_C(0x3b09bbbd070f6e87) }},
+  {{ UINT64_C(0xca00c96a65a59260), UINT64_C(0x1b8803981dcbab16), UINT64_C(0x3133289f4e5ba69f), UINT64_C(0xac1fa0ae7f2fc01e) }},
+  {{ UINT64_C(0xe13372aaf284823e), UINT64_C(0xcddfc8d6ed6577cd), UINT64_C(0x3f4aeeee3f66ffac), UINT64_C(0xdeb813ade351dedb) }},
+  {{ UINT64_C(0xd46521ddaea7d29e), UINT64_C(0xe2d3120ca9b655e5), UINT64_C(0x51c752f84f833d12), UINT64_C(0x87233eeef6b58abe) }},
+  {{ UINT64_C(0xa8ac92ce528c2a20), UINT64_C(0xd862dd43882331fb), UINT64_C(0xea3827f366937b78), UINT64_C(0xa69b6059d6a3b14e) }},
+  {{ UINT64_C(0x6ab5cf25d70a4dc2), UINT64_C(0xa04ba34bf4e2a9df), UINT64_C(0xa76d26d402b00f55), UINT64_C(0x381ac4f56a3c75d4) }},
+  {{ UINT64_C(0x99f67d2eb98e81a2), UINT64_C(0xcc1ae3df364d7005), UINT64_C(0x4dc39e22ad5f82e9), UINT64_C(0xa6505a7c2ce9d44b) }},
+  {{ UINT64_C(0x6935f978f2498148), UINT64_C(0x4b13f214fe95bebd), UINT64_C(0x3c0a0a25627ee16b), UINT64_C(0xb66d97def7207ca0) }},
+  {{ UINT64_C(0x69c7afe8b14d77d6), UINT64_C(0x4a1513ae4e1629f4), UINT64_C(0x4c8d6d3e6bc83a66), UINT64_C(0x715990052911a1df) }},
+  {{ UINT64_C(0x125665b042a26d84), UINT64_C(0xd37b270ce5beb1aa), UINT64_C(0xd967141e31048075), UINT64_C(0xe08071889f90eaf8) }},
+  {{ UINT64_C(0x962217206645a1ac), UINT64_C(0x28015615d3e31e73), UINT64_C(0xce23db5ff9ab184e), UINT64_C(0x14e4136c5600fd48) }},
+  {{ UINT64_C(0xc17f07269ba0b57e), UINT64_C(0x257ce869ac24e23c), UINT64_C(0x85859efb14400681), UINT64_C(0xcc5f67057f27f6ee) }},
+  {{ UINT64_C(0x0d39aaff0d20a76e), UINT64_C(0x338363f13811deaa), UINT64_C(0x5c971b37cc6d4f2a), UINT64_C(0x65ef6518a4b8cbc9) }},
+  {{ UINT64_C(0x4a4c9a9e34470ed6), UINT64_C(0x65faf74bf69e6cfc), UINT64_C(0xb92a9a523441fd41), UINT64_C(0x2d25676488f581b8) }},
+  {{ UINT64_C(0x0a5308f5f81dc960), UINT64_C(0xe95973d564ba9545), UINT64_C(0x35aae974408b7be1), UINT64_C(0x2679727d6f94a26f) }},
+  {{ UINT64_C(0x5db1725d8ec58cfa), UINT64_C(0xfef7f7b794696b74), UINT64_C(0xc7dc7b9e721a2f22), UINT64_C(0x4d144cb0a43f681b) }},
+  {{ UINT64_C(0x7bcfbed7b9de8b7e), UINT64_C(0x6201a6e04e4a6a21), UINT64_C(0x714eaa5d0ef67a54), UINT64_C(0x06350e7c3d22f362) }},
+  {{ UINT64_C(0x407f333b0582431a), UINT64_C(0xfafd05ebdfba4e65), UINT64_C(0xd433550a7131edf1), UINT64_C(0x30d49a29f1486f33) }},
+  {{ UINT64_C(0x27585efbc51409fe), UINT64_C(0xe70fa680fcfd1435), UINT64_C(0xb2e5e4497753f724), UINT64_C(0x761e689c2a2c6f41) }},
+  {{ UINT64_C(0xc953eb5bc667476c), UINT64_C(0xf80946aa700739e7), UINT64_C(0xaa9794d68956dfb1), UINT64_C(0x101122355b3fc6a7) }},
+  {{ UINT64_C(0xe6a5ccc44e2c4a6a), UINT64_C(0x57e49e92709796f4), UINT64_C(0x20a402208f8bf0e4), UINT64_C(0x7927d5e070613964) }},
+  {{ UINT64_C(0xe2d4b2d53c5fc43c), UINT64_C(0xd5430bcd5fa53b75), UINT64_C(0xc9ba6831a5d42258), UINT64_C(0x488da36e691c229a) }},
+  {{ UINT64_C(0x3f3164648862697a), UINT64_C(0x064fa72943cdd5df), UINT64_C(0xa26ea9f484517af8), UINT64_C(0xc8b607bddad133f5) }},
+  {{ UINT64_C(0xc4c4fe711558d966), UINT64_C(0xd32b7ddae26d29e6), UINT64_C(0xda0ed531aad54afd), UINT64_C(0xf7348c716298fcdc) }},
+  {{ UINT64_C(0x986f628d7b2f8214), UINT64_C(0x03a7112b2b3e63e6), UINT64_C(0x65243a5800419e94), UINT64_C(0x16b14215ddccaeba) }},
+  {{ UINT64_C(0x1dc88f17aa60ef36), UINT64_C(0x1496c14a9f2d6391), UINT64_C(0x06d2760b252fff01), UINT64_C(0xa6a7e814f54a0bd5) }},
+  {{ UINT64_C(0x69700ba058038b42), UINT64_C(0x73c883c34be08280), UINT64_C(0x34ce641416d5c5f7), UINT64_C(0x4a1f4a11eca2e90f) }},
+  {{ UINT64_C(0x58a6ffd36ce3b020), UINT64_C(0x982b30a7725b193a), UINT64_C(0x9a98ad3767340fc5), UINT64_C(0xdafd9235cbddb35c) }},
+  {{ UINT64_C(0x1fe485e1375d12fe), UINT64_C(0xb1b9af93803c8393), UINT64_C(0xab7a43bcd2e42678), UINT64_C(0x369509db84679b26) }},
+  {{ UINT64_C(0xed2c0b44949e9c6c), UINT64_C(0x848e739360df8b18), UINT64_C(0x6095eaf386f0c8cd), UINT64_C(0x828c4bbd62ae3069) }},
+  {{ UINT64_C(0x8a59589f68d68e96), UINT64_C(0x6ce784a0c3aa0dad), UINT64_C(0x3902dc03a9ebf97b), UINT64_C(0xc087159cd8d43c19) }},
+  {{ UINT64_C(0xfb893cf78f2f1bb0), UINT64_C(0x7517c3d7576952f2), UINT64_C(0xf94a5499e68cf84d), UINT64_C(0xf1c50f17c2bb2275) }},
+  {{ UINT64_C(0x94d617e96cd7f26a), UINT64_C(0x33f404f476667a2b), UINT64_C(0x7b00794b02ba4c82), UINT64_C(0x3f89b456a86001ad) }},
+  {{ UINT64_C(0x7b0186bcdaf81356), UINT64_C(0x2010803f48958ca6), UINT64_C(0xfac9d75cb1016853), UINT64_C(0xab23e2e1f84f2ebb) }},
+  {{ UINT64_C(0x89c9bc0c9e0fc6c0), UINT64_C(0xc175445e5328eedd), UINT64_C(0x3cd96d89b00e51c0), UINT64_C(0x748437f2d8cfd489) }},
+  {{ UINT64_C(0xd278459885fe7c58), UINT64_C(0x7789efcc91bfe875), UINT64_C(0x756ef5af7e91758b), UINT64_C(0xf49988cbcba29f49) }},
+  {{ UINT64_C(0x36a597a2eafb1d74), UINT64_C(0xdea22312d5b859ab), UINT64_C(0x62cf64d5a4e49150), UINT64_C(0x61dc3e6a30fcf01e) }},
+  {{ UINT64_C(0xfbfe592cbf29d330), UINT64_C(0x807811bcd9e424f1), UINT64_C(0xf27e8f6f6137dbc0), UINT64_C(0x46dc3d413d62e609) }},
+  {{ UINT64_C(0x51dec20946922382), UINT64_C(0x1ddf2e9d0d58b8a9), UINT64_C(0xc3c21bf0de6b9833), UINT64_C(0xeece2e0bab3bf15e) }},
+  {{ UINT64_C(0x99c8e0d976554c76), UINT64_C(0x35719e8fbf029bc7), UINT64_C(0x81cfd29c292dc488), UINT64_C(0xc76d4019294fd8b0) }},
+  {{ UINT64_C(0x4773437648e35e8c), UINT64_C(0xfec476cf50d91d30), UINT64_C(0x9b6e3f06e29c105e), UINT64_C(0x6541cc27f67d84c0) }},
+  {{ UINT64_C(0x9bc0033a5e735ee4), UINT64_C(0x4f4d6e391f2bd88d), UINT64_C(0x47d4c7328c969877), UINT64_C(0xe3a530b596e42f3b) }},
+  {{ UINT64_C(0x0adacf3a9b00c426), UINT64_C(0x4868dd4805da0a4b), UINT64_C(0xa14d3220a2b87a4a), UINT64_C(0x4063fd65aa467ab4) }},
+  {{ UINT64_C(0x7fa3a4bbca5da9d4), UINT64_C(0xd0a18fe8ca1870e2), UINT64_C(0x64b4fd9fdb3f8e25), UINT64_C(0xcaa884f46a645b0f) }},
+  {{ UINT64_C(0x333c9e04ea9bd6d8), UINT64_C(0x3b5deb7fe7d92cf1), UINT64_C(0xf764460f853d20a2), UINT64_C(0xcdaf263e31c21f44) }},
+  {{ UINT64_C(0x89b4a8079ba00096), UINT64_C(0x025dc288dd3b9997), UINT64_C(0xae0f73279897f026), UINT64_C(0x2146f1fd2d859b4d) }},
+  {{ UINT64_C(0x63da72ba04d45ff0), UINT64_C(0x819b3fbee365acd3), UINT64_C(0x4cabac6f4aa386ac), UINT64_C(0xd1da9da8dcac51d7) }},
+  {{ UINT64_C(0x05f08be14e9fef02), UINT64_C(0xb4f8b4d7cb6c75be), UINT64_C(0xb2942900b2352c20), UINT64_C(0xaf39445aca63f21a) }},
+  {{ UINT64_C(0xecfebc4686621e64), UINT64_C(0x2df79c67759fbfb6), UINT64_C(0x5d1790336d26a7f1), UINT64_C(0x52392761062e8ab9) }},
+  {{ UINT64_C(0x08d9874192d7bc6e), UINT64_C(0x5051629e12c00cab), UINT64_C(0xb031fee9ed800986), UINT64_C(0x1c29c67adf9a2538) }},
+  {{ UINT64_C(0xbbb55a45a9e12740), UINT64_C(0x75f9ec5c0787c257), UINT64_C(0x12c1a608e49814d2), UINT64_C(0xc0137508ca47a91b) }},
+  {{ UINT64_C(0x813faa0c99fc1656), UINT64_C(0xef58bcc73cc120de), UINT64_C(0xfb76b241af0a5bf7), UINT64_C(0x4c329a7142524a3f) }},
+  {{ UINT64_C(0x212a0b983f243374), UINT64_C(0x9e301e866c3f1315), UINT64_C(0x5c62964b1ac1babc), UINT64_C(0x2f86184e000049b0) }},
+  {{ UINT64_C(0x77402e061de4b8fa), UINT64_C(0x24610d80a2cdd616), UINT64_C(0xa411f7fe786fa8d0), UINT64_C(0xdf295547e34834ef) }},
+  {{ UINT64_C(0x2e0dddde8f4a9cde), UINT64_C(0xae0c16a17dc11eae), UINT64_C(0x13c1361b30ecac9e), UINT64_C(0x5ad9a07758dfd1ad) }},
+  {{ UINT64_C(0x7a65f6cbc8078ac8), UINT64_C(0x67630c704b5e3aee), UINT64_C(0x85034aa530dc2517), UINT64_C(0x9b073f1a4c1d29f6) }},
+  {{ UINT64_C(0xf063d3bef01e146a), UINT64_C(0xdc47e726ee4e2756), UINT64_C(0x3e74e508b5211caf), UINT64_C(0x46f5dfc8f00bcf24) }},
+  {{ UINT64_C(0xe6f201b1082d69da), UINT64_C(0x289b1246881db165), UINT64_C(0x6797838e222b6c5b), UINT64_C(0x42d5d3cd33c20940) }},
+  {{ UINT64_C(0xa209fabfcefb4080), UINT64_C(0x89c1f0587505503a), UINT64_C(0x60a3e651d0c414e1), UINT64_C(0xb3cd594200575f25) }},
+  {{ UINT64_C(0x1138024bb6f3c3be), UINT64_C(0x2b7b4b9515db9ee8), UINT64_C(0xd1c5cd72e961ffc9), UINT64_C(0xa76e2b70de5fbad2) }},
+  {{ UINT64_C(0x2675a53207e33f10), UINT64_C(0x41e004bace37bf7f), UINT64_C(0x0d285b0650296262), UINT64_C(0xa201fd01c5acc2b2) }},
+  {{ UINT64_C(0x4572de39e0e513bc), UINT64_C(0x34dd57e6d4d2424e), UINT64_C(0xbc03cb5c0cc8711e), UINT64_C(0x889090a3eb76f248) }},
+  {{ UINT64_C(0x39abe3e9da4e7326), UINT64_C(0x251a88af67088207), UINT64_C(0xa83e901b3238d0d6), UINT64_C(0x10c3c36e13ddb864) }},
+  {{ UINT64_C(0x98739172a3ee3238), UINT64_C(0x3221081ff4cd8990), UINT64_C(0xc85154e17ea239a8), UINT64_C(0xd817a7e77d088768) }},
+  {{ UINT64_C(0x503fcffe8e2c6fe0), UINT64_C(0x0e58b90598ca9565), UINT64_C(0x74e5b4a30f1d8666), UINT64_C(0xfc100acaa8c028c9) }},
+  {{ UINT64_C(0x9ce1859258589b70), UINT64_C(0x475db55fac0a0028), UINT64_C(0x13a305a232a53c19), UINT64_C(0x7b6b7674051ef908) }},
+  {{ UINT64_C(0x27143f9c2c6007ca), UINT64_C(0xfa3b9444f9dcb815), UINT64_C(0x844765c8ea2bebcb), UINT64_C(0x0afb51cef6595a5e) }},
+  {{ UINT64_C(0xc90154694a958808), UINT64_C(0x93d6f851df4888ee), UINT64_C(0x3fa049fae3034d55), UINT64_C(0xf4de66f07786cfc3) }},
+  {{ UINT64_C(0xfa9d6f77e71580e8), UINT64_C(0x219808ded5469873), UINT64_C(0x4073a532ed627bc4), UINT64_C(0x255fc77363a8aeae) }},
+  {{ UINT64_C(0xfdab775424525706), UINT64_C(0x6665212a76207e3b), UINT64_C(0xcba63df3cc5bc2f4), UINT64_C(0x6990dd4ec6b5a061) }},
+  {{ UINT64_C(0xc42e40e741a80034), UINT64_C(0x788eb49a475b054d), UINT64_C(0x59b513041b6a0723), UINT64_C(0x4ba4bba3a7fedf3a) }},
+  {{ UINT64_C(0xba72fc6901ea329e), UINT64_C(0x20a5656d0746b685), UINT64_C(0xe25ab44c92506020), UINT64_C(0x13160bcc5355b785) }},
+  {{ UINT64_C(0xebf331445e1f1570), UINT64_C(0x6e270f089d28e74d), UINT64_C(0x36a533991f3be26a), UINT64_C(0xf4d9911b75b047b1) }},
+  {{ UINT64_C(0xfd0bc56f210c84fe), UINT64_C(0xd95ac447df492ef4), UINT64_C(0xf92e68cb1e24660d), UINT64_C(0xe66aabe5d9b96e6b) }},
+  {{ UINT64_C(0x37e33303ec134b16), UINT64_C(0x2bd88bd8919efb15), UINT64_C(0x391b9612f0451513), UINT64_C(0x7a7e63ba790104ab) }},
+  {{ UINT64_C(0x458d69300c92b38c), UINT64_C(0x6fc7839efb09c12e), UINT64_C(0xfb154df1149ec947), UINT64_C(0xe7f383372a774a18) }},
+  {{ UINT64_C(0x177a116a90960f52), UINT64_C(0xbf1a9acf8742a742), UINT64_C(0xa09ee8143a1d1a54), UINT64_C(0x7b97850dbd3b14b1) }},
+  {{ UINT64_C(0x51237b939a3a2ed4), UINT64_C(0x37c73de3743993fc), UINT64_C(0x8f80eff5ca865d6e), UINT64_C(0xb107fd4bebd57ff8) }},
+  {{ UINT64_C(0xd79552ca35b01e04), UINT64_C(0x6df9500be4ee1a1f), UINT64_C(0xd0a3bb2e092d2f7f), UINT64_C(0x30e35cf18fe8dc70) }},
+};
+
+static const mzd_local_t Ki_0[] = {
+  {{ UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) }},
+  {{ UINT64_C(0x4687db1c86b91a20), UINT64_C(0x7debf02c01d67fcd), UINT64_C(0x2cc71506e13feb0f), UINT64_C(0xc90a2a382b56b1a3) }},
+  {{ UINT64_C(0x964daa9215500830), UINT64_C(0x0df03d90e83f7734), UINT64_C(0xb784f8a0e446fcda), UINT64_C(0x0d3d07045990cf08) }},
+  {{ UINT64_C(0x052789467ce8f29e), UINT64_C(0x4ccd0b8038f7ed9d), UINT64_C(0xc3270c1f030410be), UINT64_C(0x92dc0346abe4c862) }},
+  {{ UINT64_C(0xe6f89f5438828356), UINT64_C(0x1bf750bdff97e1b6), UINT64_C(0xf6f012396c8027dc), UINT64_C(0x6bab1232a99297ac) }},
+  {{ UINT64_C(0xf8b2a62e002b6698), UINT64_C(0x94c3af4a7331dd40), UINT64_C(0x047fbfef68e71b11), UINT64_C(0x66188dd10cc3085f) }},
+  {{ UINT64_C(0x55ee7eedfe4db1b4), UINT64_C(0x3bbcb88858a7c011), UINT64_C(0x739d7cf0d584b664), UINT64_C(0x0f0de64d973e0cca) }},
+  {{ UINT64_C(0x12f284c703c3eb54), UINT64_C(0x19f9c3fa25fbd0d5), UINT64_C(0x581fb588f84659c2), UINT64_C(0x75c0869fff3f252b) }},
+  {{ UINT64_C(0xa1cfc4dd6de89bb2), UINT64_C(0xc836237ea3b0e78b), UINT64_C(0x9426ac6eb9b37dfa), UINT64_C(0xfce3ea93295bb205) }},
+  {{ UINT64_C(0xd5ca9d0483d47014), UINT64_C(0x889f7b80b3d4bb43), UINT64_C(0x7dfa202f0c8e59ea), UINT64_C(0x14e70a4c124e3505) }},
+  {{ UINT64_C(0xcf8c672b73a31f00), UINT64_C(0x34508a23ed579469), UINT64_C(0x9fa1cbb39fc1c951), UINT64_C(0x272116f6798942e1) }},
+  {{ UINT64_C(0xc19bd44d2f3b0b16), UINT64_C(0xbfd991cdfa6c1188), UINT64_C(0x3530c177522a9376), UINT64_C(0x0997dfd65f51cb2b) }},
+  {{ UINT64_C(0x1d44b719983e09ae), UINT64_C(0xbd37deae77e6265d), UINT64_C(0x4bafb8bf6b09f62e), UINT64_C(0xbd7b5edd2546acfc) }},
+  {{ UINT64_C(0x9695dc459701847c), UINT64_C(0xbe1c424b14601721), UINT64_C(0x71afdfb91ebedc12), UINT64_C(0xb32f7412ccd06b96) }},
+  {{ UINT64_C(0x59e48f1bb3bf2370), UINT64_C(0x4a55b8f6a0b266ac), UINT64_C(0x231e284fb2727139), UINT64_C(0x553be864b1f97933) }},
+  {{ UINT64_C(0x65d5c1ac9d4688b2), UINT64_C(0x1dd2b863b6396558), UINT64_C(0x815e726db8b46dd1), UINT64_C(0x8c530766e9b89f98) }},
+  {{ UINT64_C(0x580d3cbb5be4b026), UINT64_C(0x0dbd766f807ac611), UINT64_C(0x5be819720c3285ce), UINT64_C(0x6025cd18ee9686c1) }},
+  {{ UINT64_C(0xc057893b34a081ec), UINT64_C(0x9178bf9790ff00a8), UINT64_C(0x2528b01e72c89372), UINT64_C(0x6a139cfef0bee4dc) }},
+  {{ UINT64_C(0xc51d53201e26a9be), UINT64_C(0xf9a0cd5160353ba4), UINT64_C(0x1c7d3011717c8335), UINT64_C(0x43cb26a4a6656a99) }},
+  {{ UINT64_C(0xfe782c9ade8a0286), UINT64_C(0x6ac402e85abe5e32), UINT64_C(0x53409e74eeef535d), UINT64_C(0xe146b1d8b63394d0) }},
+  {{ UINT64_C(0xa1912b75e0ef4266), UINT64_C(0xc37ad0d198877a37), UINT64_C(0xf5117019bb89bdac), UINT64_C(0x1f0cda4ebde18c88) }},
+  {{ UINT64_C(0x6605600ff1c0c9ac), UINT64_C(0x072721c7d9f4fa1c), UINT64_C(0x7cd3d0faddc52099), UINT64_C(0x42bddb3e506e2399) }},
+  {{ UINT64_C(0x0e40ed94bcc36c58), UINT64_C(0x3c5a4b3a608277f1), UINT64_C(0x8aa1035d3c54406b), UINT64_C(0xafe25e8f88ed8dfd) }},
+  {{ UINT64_C(0xaa5bf2217d8137c6), UINT64_C(0xc715dff8637cb48a), UINT64_C(0xcd08cd5ac6560daf), UINT64_C(0xc3cddda7860eb78a) }},
+  {{ UINT64_C(0x650b55873440a7fc), UINT64_C(0xa02c89a4bbe4979e), UINT64_C(0x127ef5890dcef830), UINT64_C(0x48eed2b1e5112351) }},
+  {{ UINT64_C(0x16735cffdafb6fce), UINT64_C(0x3f3d5b329333a36e), UINT64_C(0x229e4291c595f647), UINT64_C(0x5fd22eefe574e0de) }},
+  {{ UINT64_C(0x562ef1617fa824c0), UINT64_C(0xe8c9a54df2916685), UINT64_C(0xf4ecc5b1e715ab6b), UINT64_C(0xb39cbf512ad708dc) }},
+  {{ UINT64_C(0x7c4a5461f9e46ae0), UINT64_C(0xd6d7c072b7bcde49), UINT64_C(0x7f76f31a4fd95335), UINT64_C(0x1c88d3d022b247a2) }},
+  {{ UINT64_C(0x276bf96d10195268), UINT64_C(0xea8a27d96f69361c), UINT64_C(0xbe4c94bf1cada5d7), UINT64_C(0x627e0b793d6d90ef) }},
+  {{ UINT64_C(0x07e57155822901e4), UINT64_C(0x98d8297ae54d5970), UINT64_C(0x57b94258e81282f9), UINT64_C(0xfc95d1c297d93690) }},
+  {{ UINT64_C(0x80cb564e5cd54338), UINT64_C(0xb5ed33ff5c25d811), UINT64_C(0x483cc2580d68573c), UINT64_C(0xce6ee1e2e49bb54c) }},
+  {{ UINT64_C(0x41ecdf15794fdb8c), UINT64_C(0x2aa22d0407a8ab4e), UINT64_C(0x42b67698631be4be), UINT64_C(0xece611d56c1e7b4a) }},
+  {{ UINT64_C(0x9fab793d10447b9c), UINT64_C(0xf63e1317be6bb079), UINT64_C(0x4908f378df7654a2), UINT64_C(0x544093389e46b5dd) }},
+  {{ UINT64_C(0xd32d8dbf3f876a1a), UINT64_C(0xc27653ba9c3ef61a), UINT64_C(0x57716b9bd3d6bf4a), UINT64_C(0x8a53e1b34c6fd68e) }},
+  {{ UINT64_C(0x3bcb11425a8d6832), UINT64_C(0xcc8241e7785e89d3), UINT64_C(0x1cbaad659512ba38), UINT64_C(0xc14235170da65b54) }},
+  {{ UINT64_C(0x9c63c090d0b844e4), UINT64_C(0x9dc29f4bcfbbf21d), UINT64_C(0x252f064646149e23), UINT64_C(0x9d1f27f4b8a18e5b) }},
+  {{ UINT64_C(0x2df3ab79d77bf434), UINT64_C(0x5372d05c0ed36708), UINT64_C(0x524c11a660689815), UINT64_C(0x9b510414f65a2071) }},
+  {{ UINT64_C(0xbaf4061f7a1b7792), UINT64_C(0x5eb8e71be8b9ad05), UINT64_C(0x003c2ec77ec99772), UINT64_C(0xb619415c4c506bd2) }},
+  {{ UINT64_C(0x0a9221709ca0e8fa), UINT64_C(0x9011f9675c077a0e), UINT64_C(0x515d4e77fe999eb7), UINT64_C(0x11cf7f8da6153687) }},
+  {{ UINT64_C(0x9f5839f2e4b72d64), UINT64_C(0x25df04640c2e813c), UINT64_C(0x7d78b48822d94f94), UINT64_C(0xc22665673060c96a) }},
+  {{ UINT64_C(0x22a2480d292f80b6), UINT64_C(0x91a62f90f8b93d63), UINT64_C(0xc95b58a5fc9dfa4c), UINT64_C(0xc7de488f1c81f592) }},
+  {{ UINT64_C(0xaec0ec0058082278), UINT64_C(0xf565ddd0c55fa07f), UINT64_C(0x57e68aae33553318), UINT64_C(0xb4bbd2d9514635e8) }},
+  {{ UINT64_C(0xc313511f7a644d66), UINT64_C(0x8f57315702a87699), UINT64_C(0xde0f86bac817d28d), UINT64_C(0xcaac7616bff6a158) }},
+  {{ UINT64_C(0x636521d8da171556), UINT64_C(0x335026519a24bb1c), UINT64_C(0xa4b8b6f00b4eab32), UINT64_C(0x45dd99641ec96cdc) }},
+  {{ UINT64_C(0x4fee8b3d151510d6), UINT64_C(0x4d50cddf134c40be), UINT64_C(0xa09f90fab6f0f456), UINT64_C(0x8feca5cb17d31794) }},
+  {{ UINT64_C(0x634caa68109762a2), UINT64_C(0x013381ba942aedbb), UINT64_C(0xccc63ff6450b8960), UINT64_C(0x67eb09ae7478ccc7) }},
+  {{ UINT64_C(0x5b26e9145e25dbaa), UINT64_C(0x9a2e8aa9252e2cda), UINT64_C(0x168bf87278bfe811), UINT64_C(0xdb3c4fc79df7fb24) }},
+  {{ UINT64_C(0x2de023aba93eb706), UINT64_C(0x718d7bc645d30f61), UINT64_C(0x14611743d47b7aaf), UINT64_C(0xef21e9c42ccfd1e8) }},
+  {{ UINT64_C(0x6fb35e3ccf60052a), UINT64_C(0x17be9dc926b55224), UINT64_C(0xeb9a733b5a16e5fd), UINT64_C(0x2315de4ec5a1c423) }},
+  {{ UINT64_C(0x4567ee6a7389ad64), UINT64_C(0x99c145edd394ced6), UINT64_C(0x02a32c3aa3d9e8f7), UINT64_C(0x63c752965e277c5d) }},
+  {{ UINT64_C(0x7078129a5ab1bbde), UINT64_C(0x50c3cc7923c85cf6), UINT64_C(0x47b352cf777aeaa7), UINT64_C(0x33b10ff19208a2ab) }},
+  {{ UINT64_C(0x33666f9536d63284), UINT64_C(0x1bdecf642fda19d7), UINT64_C(0x77e12492b07a7e64), UINT64_C(0x79a1eb65fc833fd5) }},
+  {{ UINT64_C(0x61e151cee4de17ba), UINT64_C(0x88b6573d17476a4e), UINT64_C(0x68266fc58b438236), UINT64_C(0x493a728bb4b22677) }},
+  {{ UINT64_C(0x4ea9077d754e97ae), UINT64_C(0xdd0a38732306d3a3), UINT64_C(0x15870595ec7eabed), UINT64_C(0xa6628432aecf20c7) }},
+  {{ UINT64_C(0x23864d356f78f41a), UINT64_C(0xd9c8bcdccb865947), UINT64_C(0x709f6d3fa05f349e), UINT64_C(0xe807d49f3b97a868) }},
+  {{ UINT64_C(0x44d941c02730c5b0), UINT64_C(0xecb084016375f066), UINT64_C(0x11019219e2958a3a), UINT64_C(0x8c5e3bc62ea4e576) }},
+  {{ UINT64_C(0x73bc5bba5483d842), UINT64_C(0xd56e6e75703607be), UINT64_C(0x3047f4ad18cb2d0d), UINT64_C(0x78ec6f0745196252) }},
+  {{ UINT64_C(0x276814cd8d370852), UINT64_C(0x8b9ecbd32873d73a), UINT64_C(0x8b658fc72e77a9fe), UINT64_C(0xe61afeb7ebc3d5a5) }},
+  {{ UINT64_C(0x517d2475561c0d8c), UINT64_C(0x84709e74ee507c80), UINT64_C(0x42cbdcc94c1c596a), UINT64_C(0xc6fa2a8f5f205acb) }},
+  {{ UINT64_C(0xedc3f4f27c378a00), UINT64_C(0xa5d53b082aaa558c), UINT64_C(0x3315564158327b7a), UINT64_C(0x19474550678c3ea7) }},
+  {{ UINT64_C(0xd7fc1e12a6599ca6), UINT64_C(0xadbfeb3ac6345d16), UINT64_C(0x8c0943479e0c1a19), UINT64_C(0xc1241143dee3086d) }},
+  {{ UINT64_C(0x9ae38640b885c834), UINT64_C(0x62fbc45dd150bcbf), UINT64_C(0x121e29b404d014d9), UINT64_C(0xd5cdc292e109139a) }},
+  {{ UINT64_C(0xbe3555ea9724169a), UINT64_C(0x71e4643cdab13bf0), UINT64_C(0xd8d78c1d525d7d9f), UINT64_C(0x285b05de35fdf5fc) }},
+  {{ UINT64_C(0x36a264bb5d8cfd08), UINT64_C(0x9935d1ddd3981f2f), UINT64_C(0x341ae87c3c0a9b03), UINT64_C(0x99ecc97275fd0968) }},
+  {{ UINT64_C(0x5f42e206402e3e9a), UINT64_C(0xa424eab57665706a), UINT64_C(0x4b0f66b0940d2dc2), UINT64_C(0x898df58dd6a47239) }},
+  {{ UINT64_C(0xba9efd03231632f6), UINT64_C(0x99ccdb290c4b1f96), UINT64_C(0x29c79002cd2c364d), UINT64_C(0x414aff0c01e2c460) }},
+  {{ UINT64_C(0x1d3ceec5ca103c76), UINT64_C(0x7f29a7d6e4a533b9), UINT64_C(0xd93604dd08b59449), UINT64_C(0x1ea9a1c4ca386f44) }},
+  {{ UINT64_C(0x37bb885804f9df38), UINT64_C(0x995e182ae7cda449), UINT64_C(0xe6427f2f55fbef6a), UINT64_C(0xa751f76cf19451fb) }},
+  {{ UINT64_C(0xa697b21f5561bea4), UINT64_C(0x2639cfd5ac7bc53f), UINT64_C(0x17996966de44bf42), UINT64_C(0xef18db8c56f9e00a) }},
+  {{ UINT64_C(0xd3a951648c6b8058), UINT64_C(0x38a898b6f81564ce), UINT64_C(0x45c336ff47d95f46), UINT64_C(0x0c21393c14c6e8a7) }},
+  {{ UINT64_C(0xbcef01cab7a54736), UINT64_C(0x0441941349412465), UINT64_C(0xb67563461866c4c6), UINT64_C(0x72f3085d00a22ada) }},
+  {{ UINT64_C(0x8a15747dbd39090c), UINT64_C(0x9325e92d7c67bb64), UINT64_C(0x64771512fba790e6), UINT64_C(0x257e6219b4c40ddb) }},
+  {{ UINT64_C(0xc9b4f7044ad2a58c), UINT64_C(0xb89d930e6e744ce4), UINT64_C(0x28c739f66a516cc5), UINT64_C(0x2bbab07853dd3f51) }},
+  {{ UINT64_C(0x433a3cb77314e2b2), UINT64_C(0x08f457d127ba08d0), UINT64_C(0xbd0cb3c397b82165), UINT64_C(0xb69dac439ef16879) }},
+  {{ UINT64_C(0xa63e16c7f18b61f6), UINT64_C(0xcb27bc1c5604e54e), UINT64_C(0x7c9ba5b97b104781), UINT64_C(0x1c7cc32c93c37f68) }},
+  {{ UINT64_C(0x6bd39220bc1a4a6a), UINT64_C(0x2a015501e1163bfc), UINT64_C(0x4f599d10c334955b), UINT64_C(0x3cb95c0deed71717) }},
+  {{ UINT64_C(0xb953abf915236350), UINT64_C(0x484999013140ca93), UINT64_C(0x95db6c0d32813aff), UINT64_C(0xd1b544f16f7feb46) }},
+  {{ UINT64_C(0x81c813e4e2406fde), UINT64_C(0xb50d8a594f450681), UINT64_C(0x2ba8ca5450009cf0), UINT64_C(0xbd4300e9d67c0f1d) }},
+  {{ UINT64_C(0xc725aad4e990a834), UINT64_C(0x14c63d4718603581), UINT64_C(0xd926d3fc48a8c272), UINT64_C(0x2b85dff0f7997da1) }},
+  {{ UINT64_C(0x4c1c46d9cba0f94a), UINT64_C(0xedd25f11c82af116), UINT64_C(0x46d4dceadfcc869e), UINT64_C(0xdff8d193cd6fd7d3) }},
+  {{ UINT64_C(0x8f294caf8533ef18), UINT64_C(0xea2e173f22143379), UINT64_C(0xe001fc24bbb1559c), UINT64_C(0x9084269c8ac51cfb) }},
+  {{ UINT64_C(0x04bfe249f42be218), UINT64_C(0xccf1954d944f44fd), UINT64_C(0x5d88e7a39f477856), UINT64_C(0xcebc49ed1a338017) }},
+  {{ UINT64_C(0x01e0491c0fd919bc), UINT64_C(0x2ad2ab2e67063824), UINT64_C(0xc9ff25ffae1fde4a), UINT64_C(0x844e46a9f79a4538) }},
+  {{ UINT64_C(0x0f4a4b2f1359fd10), UINT64_C(0x50d665488072929b), UINT64_C(0x571819a30fe8835a), UINT64_C(0x5b25f3d9cf36717d) }},
+  {{ UINT64_C(0x182a01d16b86a3e6), UINT64_C(0xc223c01323b4a513), UINT64_C(0x775c4dc8b7a9fdcd), UINT64_C(0x241414f434c29c7d) }},
+  {{ UINT64_C(0x8b27c418cae3f5da), UINT64_C(0x45bfa1059680e3cd), UINT64_C(0xc22c28d8a061f061), UINT64_C(0x52aaa380594c4684) }},
+  {{ UINT64_C(0xd8f79c0ebbbcaac0), UINT64_C(0x9be49858e9653dc3), UINT64_C(0xdd7ffb0934ac50ba), UINT64_C(0x55772b67a532b722) }},
+  {{ UINT64_C(0x61fa771c8bd90dac), UINT64_C(0x08e831e366d76e18), UINT64_C(0x84a467fd3b1d67ac), UINT64_C(0xe77429c1450a058b) }},
+  {{ UINT64_C(0x07ea9898d8b65aa2), UINT64_C(0x21e1c36f53506f07), UINT64_C(0x81aeda120652c23e), UINT64_C(0xa7601e082607275b) }},
+  {{ UINT64_C(0x62b0bdcb782347d4), UINT64_C(0xd504e5cbe27ceeae), UINT64_C(0x3ad5190cfb721627), UINT64_C(0xeabeeef7c336a72d) }},
+  {{ UINT64_C(0xe03f8ebffe573a3e), UINT64_C(0x2bb28279b3144a24), UINT64_C(0x586347e5ed024c31), UINT64_C(0x0f54601ddd6a5188) }},
+  {{ UINT64_C(0xc6715734eaea75f6), UINT64_C(0x4b4dec1e5c8cff1c), UINT64_C(0xa87b1af8afafe24e), UINT64_C(0x94d3b10c18f43eda) }},
+  {{ UINT64_C(0x0327cbdcb9cda9c4), UINT64_C(0x9a528a02846097c6), UINT64_C(0x824fb207d4d91e4c), UINT64_C(0xd176b4e85c15c000) }},
+  {{ UINT64_C(0x811bd606ef8612b2), UINT64_C(0x93b1879d10f0ed1d), UINT64_C(0xb85617dc6ed334bd), UINT64_C(0x4dd242675b21ce29) }},
+  {{ UINT64_C(0x6ca6262e5bbaf3ec), UINT64_C(0xb75a39578cb87e70), UINT64_C(0xec57abc97e1aadf4), UINT64_C(0xac6604cce8cbe71e) }},
+  {{ UINT64_C(0x3cae732dd15d9810), UINT64_C(0x102aae641f72469f), UINT64_C(0x80501414fb5d6d56), UINT64_C(0xc3ef1b8fa6b1a5b2) }},
+  {{ UINT64_C(0x6643c927d3c8d55a), UINT64_C(0x2cda35ab7b73c376), UINT64_C(0x590c852ec26335dc), UINT64_C(0x900aa53b3cbc7735) }},
+  {{ UINT64_C(0x06fbb23a5075482c), UINT64_C(0x4851a87b06c633bb), UINT64_C(0x18775e3713778f42), UINT64_C(0x6356da272f8816eb) }},
+  {{ UINT64_C(0x1e1b1655d9f9d4b4), UINT64_C(0xf0a9d9b462df4529), UINT64_C(0x00b1affea1ed29c4), UINT64_C(0xee7aa79df7807896) }},
+  {{ UINT64_C(0xbb8921b55e30a21e), UINT64_C(0x8168eedd5db51516), UINT64_C(0xe47eae3c1b11bd91), UINT64_C(0x007acc2366b066b7) }},
+  {{ UINT64_C(0x82bc282319d51db4), UINT64_C(0x78a4a1dd8291e27d), UINT64_C(0x5207cc2081ac4450), UINT64_C(0x7de23ccaa4c893f6) }},
+  {{ UINT64_C(0xcd2060ffa3a85f00), UINT64_C(0x693a96c7c9645c95), UINT64_C(0x9def89794e63911d), UINT64_C(0x95aee66724e14d5e) }},
+  {{ UINT64_C(0x57bc35bc7a12c6ec), UINT64_C(0xbba4ead397aabf76), UINT64_C(0x99574c723dae71d4), UINT64_C(0x809f2e2f20971ebb) }},
+  {{ UINT64_C(0xb5cd28cf9a18a830), UINT64_C(0x54671087dcb5e8f4), UINT64_C(0x4a4947ccd7d3cb31), UINT64_C(0x29ac671af7c9ea48) }},
+  {{ UINT64_C(0x3caf3b45426f9912), UINT64_C(0xc18a1627e0842d6e), UINT64_C(0x1c9104c8c4a0ed9c), UINT64_C(0x2974b05e39d37eb5) }},
+  {{ UINT64_C(0x2dc8b42e1b41ec1e), UINT64_C(0x8988172544e31856), UINT64_C(0xc9ba357656842578), UINT64_C(0x05e7007510942c7e) }},
+  {{ UINT64_C(0xe9dc0c1f3393e306), UINT64_C(0x23430b9edb8c8608), UINT64_C(0x3d95a2ec52567107), UINT64_C(0xc080ed51fc6daef4) }},
+  {{ UINT64_C(0x74583458d418f0f6), UINT64_C(0x5e82e5315a37fbc8), UINT64_C(0xcd4aa80740e6ba01), UINT64_C(0x00d4a01f3a833c24) }},
+  {{ UINT64_C(0xd8fa573fa94d972a), UINT64_C(0x7a6f229751add85e), UINT64_C(0x15c8f15f189c5f52), UINT64_C(0x0352db57b574f974) }},
+  {{ UINT64_C(0xd0ccc129d4576b36), UINT64_C(0x077482d30dd972e7), UINT64_C(0xb4569cc9838e5da5), UINT64_C(0x41c1564a24d253d5) }},
+  {{ UINT64_C(0x09090fb4d460dd5c), UINT64_C(0x5b2248511ac84aab), UINT64_C(0x4417b6e2bc6ee8f5), UINT64_C(0x6793bb77616ad43d) }},
+  {{ UINT64_C(0x1d2a098851d6cb4a), UINT64_C(0x8576eeff12318ad1), UINT64_C(0x2a82d257be3c3a83), UINT64_C(0x1835a2bc0bb712ca) }},
+  {{ UINT64_C(0x697a5d6541030afa), UINT64_C(0xf85b09ae96396ef9), UINT64_C(0x7a46a51409e695ef), UINT64_C(0x8365cb500e1e6f51) }},
+  {{ UINT64_C(0x62e6b60da99c50f8), UINT64_C(0x5026ec73b234dae3), UINT64_C(0x7d4114f0ec89fd8b), UINT64_C(0x8d62ca5920b1fb0c) }},
+  {{ UINT64_C(0xbeeef4708e25c5d6), UINT64_C(0xafd74fd9e3dac8f5), UINT64_C(0x42a42efe4606c628), UINT64_C(0x583864ca277e5dc0) }},
+  {{ UINT64_C(0x9689b8bcd0a3f0c0), UINT64_C(0x9a9efb16e81bdc3f), UINT64_C(0xc9696f90dfce85c3), UINT64_C(0x1721c70471b9d35f) }},
+  {{ UINT64_C(0xda6e57f47abc01b0), UINT64_C(0x642cc6141c605d39), UINT64_C(0x911168b24e5f2672), UINT64_C(0xdd5ffa640a91f2ba) }},
+  {{ UINT64_C(0xe215cf22c9034628), UINT64_C(0xaeb558548e203a0c), UINT64_C(0x98d74f408e72ba86), UINT64_C(0xb28730dad08f102a) }},
+  {{ UINT64_C(0xb80ab798a295de1c), UINT64_C(0xb535f99737ceed32), UINT64_C(0x4759ff53871bf571), UINT64_C(0x324fdf94ee7a2b96) }},
+  {{ UINT64_C(0x25cf52531da6d5d2), UINT64_C(0x55c932fffe82f928), UINT64_C(0xde05f6a83332e36b), UINT64_C(0x1a6f9918cd9877c6) }},
+  {{ UINT64_C(0xbdb4c637bfd7f6fa), UINT64_C(0x55f89194f5b4e58c), UINT64_C(0xb0f9f4f1d26524a7), UINT64_C(0x14ac6cadd55ac291) }},
+  {{ UINT64_C(0xf6fda7e0136d8026), UINT64_C(0x6f6d0fccf20f4f67), UINT64_C(0x61e5fc8aa64a73d2), UINT64_C(0xa68425121ac38acb) }},
+  {{ UINT64_C(0xa5e8cf36e13ef2a2), UINT64_C(0x87cf7102f3119e25), UINT64_C(0x517db47cb5e86950), UINT64_C(0xab50b5acf2de4b9b) }},
+  {{ UINT64_C(0xcf23b0c8db62c02a), UINT64_C(0xf4ae03c4d8c42710), UINT64_C(0x46e9f5501c7506fb), UINT64_C(0x882d787892355ef8) }},
+  {{ UINT64_C(0xbdedb77a49f503a2), UINT64_C(0xd6cbb46cb6813b90), UINT64_C(0xd7149a12fde060ba), UINT64_C(0xddb94f8d1b16656e) }},
+  {{ UINT64_C(0x69db0183ff366de0), UINT64_C(0x2c46fe9c0fb52cb5), UINT64_C(0x753d5f3c7fda7e97), UINT64_C(0x7f59b9cb3b9467b8) }},
+  {{ UINT64_C(0x7398ce81a842c6ce), UINT64_C(0x3aef8d1aa4d443cd), UINT64_C(0x064a4de6ca738c87), UINT64_C(0xf0f09adbac0ff675) }},
+  {{ UINT64_C(0xe1955376c8ee3f3a), UINT64_C(0xa0c85f5768b16343), UINT64_C(0xd9002787b66b99a6), UINT64_C(0xad0390ca42ad244c) }},
+  {{ UINT64_C(0x29011b2c3bdfaa6e), UINT64_C(0x26eeb3e014b2ce03), UINT64_C(0x6f98c6cfd3dfc8cd), UINT64_C(0xb05502260ce772d6) }},
+  {{ UINT64_C(0xc9618fd2f7d1c52c), UINT64_C(0xcc9af0ea81120e3a), UINT64_C(0xe0390e798f38fab6), UINT64_C(0x977dde92db12dde9) }},
+  {{ UINT64_C(0x0c2667223b401b2a), UINT64_C(0xb1387a1a39a4d98b), UINT64_C(0xaddc12478c64186f), UINT64_C(0xb700a7e9401da715) }},
+  {{ UINT64_C(0xb585cb78623d2d16), UINT64_C(0x35e3b00f1202a76b), UINT64_C(0x5dee47c4c15cfba4), UINT64_C(0x91e052a72b781980) }},
+  {{ UINT64_C(0x9b2915e4044a008e), UINT64_C(0x2a26960efcdf253d), UINT64_C(0x8c52c2d7840eb082), UINT64_C(0xd841ea68e124653a) }},
+  {{ UINT64_C(0x190c04f08a7be5a2), UINT64_C(0x533b0a47ecf420d4), UINT64_C(0x257cb169266c5821), UINT64_C(0xd42d18537b984bd9) }},
+  {{ UINT64_C(0x2a5f96a8a6217f7a), UINT64_C(0x4d5f16a7b35fc86e), UINT64_C(0x246f00dcbd32c52c), UINT64_C(0xaee502160358f575) }},
+  {{ UINT64_C(0x395c5aec164abcdc), UINT64_C(0x56fd7ddd34194286), UINT64_C(0xcf5520977a93438f), UINT64_C(0x6bb6e65e0312a59e) }},
+  {{ UINT64_C(0x97dd684fdf75f9c6), UINT64_C(0xf97253d79be8dafe), UINT64_C(0x3c70fb97ccbf7ad3), UINT64_C(0xf61aeabf5f3f70a3) }},
+  {{ UINT64_C(0x63548a31f8527bf8), UINT64_C(0x8dde48e538aa925c), UINT64_C(0xea64cf928c895f40), UINT64_C(0xd85be7e854d05d43) }},
+  {{ UINT64_C(0x1fec90f1fc863186), UINT64_C(0x3847efd2dd6bde6c), UINT64_C(0xf6e2bf4ccb49bcb8), UINT64_C(0x355bfe21e761a2fd) }},
+  {{ UINT64_C(0x27dd33a17bfc14e8), UINT64_C(0xa7f1620b8f0c2094), UINT64_C(0x15985b3882e24374), UINT64_C(0xdec3ca72f1fcd6b4) }},
+  {{ UINT64_C(0x2054ac83ca6140e2), UINT64_C(0xfd14638b8507da92), UINT64_C(0x92dbb5c70f37b956), UINT64_C(0x68cdbb5145560653) }},
+  {{ UINT64_C(0x47ca7e275034a23a), UINT64_C(0x56013590d43c1a52), UINT64_C(0x04c57567a6734753), UINT64_C(0x40a4165c7f33efc0) }},
+  {{ UINT64_C(0x48d0ba1b8742d1c0), UINT64_C(0xb6455e7076985445), UINT64_C(0x6ccde6afd3c7362e), UINT64_C(0xbdd71fa57de32ed1) }},
+  {{ UINT64_C(0x7686f536232201fa), UINT64_C(0x43d52e4734350577), UINT64_C(0x2e357f64ba5f7f2d), UINT64_C(0x09dfced6435685e8) }},
+  {{ UINT64_C(0x7c47142c17d45c9a), UINT64_C(0xd37f2e473710b794), UINT64_C(0xfbbaaedb469d5768), UINT64_C(0xed31fbb67e6914c3) }},
+  {{ UINT64_C(0x98afa45f21d3ffbc), UINT64_C(0xd7ef5f1384f4da2f), UINT64_C(0x02dba1491f6b0602), UINT64_C(0xc62d1becb504e986) }},
+  {{ UINT64_C(0x0618c12d90749bf4), UINT64_C(0x882586b50cfd61b5), UINT64_C(0x22ce697a36c9649f), UINT64_C(0xf6800c3f8209f8df) }},
+  {{ UINT64_C(0x5f15210a67e6998e), UINT64_C(0x141b7358a0207d31), UINT64_C(0x135c7529b2d4246c), UINT64_C(0x7cbb7d9b45b784b3) }},
+  {{ UINT64_C(0xb051c5ee1d5963a4), UINT64_C(0x95b69dcbf252bddd), UINT64_C(0x64395441c9cea1b7), UINT64_C(0x127e28f95dd0a3a5) }},
+  {{ UINT64_C(0x68150a0439188268), UINT64_C(0x1ca774848721e840), UINT64_C(0xf5aa6c0d9a076b11), UINT64_C(0x03e652803fe72eb5) }},
+  {{ UINT64_C(0x991679ecceca8510), UINT64_C(0x8f7c7e0fc3d7dbe3), UINT64_C(0x6790d8cf7ef43010), UINT64_C(0x613f3e9696956127) }},
+  {{ UINT64_C(0xa8dea968298411b4), UINT64_C(0xef7e2896986416a2), UINT64_C(0x574f9201c58bba42), UINT64_C(0xf06b944e8e81dbe3) }},
+  {{ UINT64_C(0x6ee49566d81838c6), UINT64_C(0xd059a62e7a7575fc), UINT64_C(0x817f20b2c56ecac1), UINT64_C(0xb8f9b6333ec91d31) }},
+  {{ UINT64_C(0x269bc05d2302ac24), UINT64_C(0x25c090293ff4a0ce), UINT64_C(0xb99e754134cad17a), UINT64_C(0xbaabc9e57c10304c) }},
+  {{ UINT64_C(0x9db056d0b4d28b86), UINT64_C(0xc9d2b0bb70bd3176), UINT64_C(0x40878bbc241020b3), UINT64_C(0xa04c90a9fe76a955) }},
+  {{ UINT64_C(0xfa5056724fcb146e), UINT64_C(0x431169121c7561ac), UINT64_C(0xcec32ea60eaba585), UINT64_C(0xdbb23bd8541704de) }},
+  {{ UINT64_C(0x20787e38572ad0c4), UINT64_C(0xefaaadae5df9ab29), UINT64_C(0x8ca89d45af32b2d0), UINT64_C(0x1f8a9498fcac1d04) }},
+  {{ UINT64_C(0x79d210df5abb915e), UINT64_C(0x7373f31a15057566), UINT64_C(0xe5076e4531829ad2), UINT64_C(0xc24c6dacadcd6437) }},
+  {{ UINT64_C(0xf3fd479a7304f112), UINT64_C(0x92a85dc2a9070d23), UINT64_C(0x98c45e2ed5f0e63b), UINT64_C(0x2a0d5205834ae180) }},
+  {{ UINT64_C(0xeac860fb7b563404), UINT64_C(0x22e136463b5f9d24), UINT64_C(0x3ce6a258678115ac), UINT64_C(0x80643331048709a9) }},
+  {{ UINT64_C(0x799f1543cb8ce63a), UINT64_C(0xe03c15c7a2d707ef), UINT64_C(0xf0b76a36539454dc), UINT64_C(0x0a7c743c3f235310) }},
+  {{ UINT64_C(0xfcd9ef23905f5018), UINT64_C(0x98bce1fdcbe882bb), UINT64_C(0xe32d050260c83702), UINT64_C(0xaeab1a58d98a47a5) }},
+  {{ UINT64_C(0x5716df178c40b494), UINT64_C(0x9c83d9be16b1740e), UINT64_C(0x615b7527a2f67573), UINT64_C(0x437d879aa5412c87) }},
+  {{ UINT64_C(0x86b447845f398e56), UINT64_C(0xf6262156fd686a1a), UINT64_C(0x84686bf343514359), UINT64_C(0x2e70616f492ef7d9) }},
+  {{ UINT64_C(0xc4a2b79c68e12910), UINT64_C(0x8c685487defb7283), UINT64_C(0x709f2e6a34ac0848), UINT64_C(0xec69bf9eb61e0d30) }},
+  {{ UINT64_C(0xeb5873daa48b8122), UINT64_C(0x5e78bf03445f0919), UINT64_C(0x4c2c4f6837b29ab5), UINT64_C(0x7afbe62f71b00f86) }},
+  {{ UINT64_C(0xa26851677499b324), UINT64_C(0x1b993170ff8c6680), UINT64_C(0xd324645f8cf85667), UINT64_C(0x012947b758205da4) }},
+  {{ UINT64_C(0xcd14cbeea6080b3e), UINT64_C(0x087f59d6907a2627), UINT64_C(0x706e94476ac21273), UINT64_C(0x066cbb9b5d5420fd) }},
+  {{ UINT64_C(0xe5da7a9f963b1e1a), UINT64_C(0x4c76911f6decbe7a), UINT64_C(0x37fef6b87508c6d8), UINT64_C(0xad5dbc4927029ff9) }},
+  {{ UINT64_C(0xba05e381bc3fb61a), UINT64_C(0x552934a03716251a), UINT64_C(0x750c0819dc4ec702), UINT64_C(0xeb3b194e871bdf0d) }},
+  {{ UINT64_C(0x41ebeeb5082a2ee2), UINT64_C(0x63ea0b2ee5869592), UINT64_C(0xc0dc91f1c8704b69), UINT64_C(0xa842ef283d736de3) }},
+  {{ UINT64_C(0xb60d29e2480d4a42), UINT64_C(0x0a487720302efa17), UINT64_C(0x4a588e353e6cae2e), UINT64_C(0x104a44d31255e004) }},
+  {{ UINT64_C(0x8f3faf49a84a899a), UINT64_C(0xa7b5abdd9a9db684), UINT64_C(0x022276e8ba568b92), UINT64_C(0xcd87bb526ad93739) }},
+  {{ UINT64_C(0xc9c98abe27a6bf96), UINT64_C(0x1caaebeb8a7fa9c9), UINT64_C(0x0bb1c728ad87b479), UINT64_C(0x53d7057da86687b6) }},
+  {{ UINT64_C(0x631ef0617b54a67c), UINT64_C(0x5d7703f52b85940d), UINT64_C(0x6b62ff0c5d5c85b1), UINT64_C(0x74bbafa84f6de5c7) }},
+  {{ UINT64_C(0x6c16c41dc02dd2ec), UINT64_C(0x4e2b2db98cbba898), UINT64_C(0x27594d46df25d0ae), UINT64_C(0x484b22251d1eedae) }},
+  {{ UINT64_C(0xf09d501226701514), UINT64_C(0x1883d40d29502011), UINT64_C(0x0a80df56653ed5b4), UINT64_C(0x430b7cc8a3523d62) }},
+  {{ UINT64_C(0xd89351cec6639d30), UINT64_C(0x706ee65a8fb50774), UINT64_C(0xc811f57bc38755dc), UINT64_C(0x6c80f1b96e25daf5) }},
+  {{ UINT64_C(0x87f4237fbd54dfe2), UINT64_C(0xef01b328e7d11527), UINT64_C(0xd0d091ac72ad5f1b), UINT64_C(0x2732d436858b07f0) }},
+  {{ UINT64_C(0x1b4e8f84d08d745c), UINT64_C(0x5f5f82ccd94fec82), UINT64_C(0x01955856b97e3197), UINT64_C(0xfa751ba4ed826ddf) }},
+  {{ UINT64_C(0x66317b52305989c8), UINT64_C(0x8d24055884cb0c3e), UINT64_C(0x063cd46bd08296c1), UINT64_C(0xa45e0ad60b4b5b8a) }},
+  {{ UINT64_C(0x5038ddb80967fa04), UINT64_C(0x5415693082c4209e), UINT64_C(0x6ea147b9b394da05), UINT64_C(0x0a1efba639343db5) }},
+  {{ UINT64_C(0xf180d1beb69afe30), UINT64_C(0x61d805f2516a2fb5), UINT64_C(0xb5337c819c82d28c), UINT64_C(0xd6a3deea4367f750) }},
+  {{ UINT64_C(0x4457985308778a9e), UINT64_C(0xcda2d162ebc80c97), UINT64_C(0x63ef1b2e2edf2d67), UINT64_C(0xad92b111c77e7178) }},
+  {{ UINT64_C(0x73618be836dbb93e), UINT64_C(0x2684ca208630d2bb), UINT64_C(0xaedfb68449519e01), UINT64_C(0x563791c646050503) }},
+  {{ UINT64_C(0x7bf029f4f9d28e2e), UINT64_C(0xfb6691ce60cb0db6), UINT64_C(0xf7d4bce58f4bcd92), UINT64_C(0x101d777e5a2145b2) }},
+  {{ UINT64_C(0x1dbf0770495277c6), UINT64_C(0xa8cd2141353d3763), UINT64_C(0xfc902aec663e0876), UINT64_C(0x3aa9eb4b9094b1ac) }},
+  {{ UINT64_C(0xead789fdad809e22), UINT64_C(0x27aef0429532d060), UINT64_C(0x61b84c57a966453c), UINT64_C(0x2a7151339be076e4) }},
+  {{ UINT64_C(0x927e35123ccfdb60), UINT64_C(0xeeea22ca7dbb3ee9), UINT64_C(0x084ed2eae6e156ce), UINT64_C(0x86bdb2432425c485) }},
+  {{ UINT64_C(0x224afa707c4a43d6), UINT64_C(0x9f827f5066b97d4d), UINT64_C(0x7b5bf15dc15912f7), UINT64_C(0xc1149262a1b6080b) }},
+  {{ UINT64_C(0xd99bd6214ea1aa48), UINT64_C(0xec3ecdabb5d7ba73), UINT64_C(0xe32cbc43d0317fa5), UINT64_C(0x48e03eaf35b0869a) }},
+  {{ UINT64_C(0x28e1a29436b2ea4c), UINT64_C(0xe4cac0c8b66af4e9), UINT64_C(0xd5b897855eec5c91), UINT64_C(0x3758758973f96992) }},
+  {{ UINT64_C(0xc530ba526797614c), UINT64_C(0x629f3959fc5e7b22), UINT64_C(0x6602a033ea83b93d), UINT64_C(0x96ec6c5de86c7b40) }},
+  {{ UINT64_C(0x6ad03fc3ddc3e0f8), UINT64_C(0x4078c02af0c2f24c), UINT64_C(0xa5a15cbea2cb47d0), UINT64_C(0x3af89973e1fd5084) }},
+  {{ UINT64_C(0x33088867e532c760), UINT64_C(0xbb341d6a58d98f6c), UINT64_C(0x2e78c028e2d5c6fc), UINT64_C(0xceeb970098e25898) }},
+  {{ UINT64_C(0x76a34027d7138ba4), UINT64_C(0xe19f167f8a503ee3), UINT64_C(0x891cb7197c3e1d80), UINT64_C(0x30e1ed5a9d97a0ec) }},
+  {{ UINT64_C(0x10306ef4a24632d0), UINT64_C(0x91bf0e85051453c5), UINT64_C(0x432c953977bdea12), UINT64_C(0xad8d770161b39522) }},
+  {{ UINT64_C(0x22d43ec1fb96e20c), UINT64_C(0xbd93fe618ac63a4a), UINT64_C(0xabf2790df4953c0c), UINT64_C(0x6d81c78ab3742326) }},
+  {{ UINT64_C(0x97df3fce74afffb4), UINT64_C(0x3a28981e7c8086b1), UINT64_C(0x162f8b043a6d86be), UINT64_C(0xa22e7923d8d04b17) }},
+  {{ UINT64_C(0x45e78623f6f68b04), UINT64_C(0x0ed68479c27e9171), UINT64_C(0x962b4398c4c25157), UINT64_C(0x3e13de5c024ccc3b) }},
+  {{ UINT64_C(0x9bb183487ab0f60a), UINT64_C(0xedda4dc180efb037), UINT64_C(0x9e4e704418126b13), UINT64_C(0x8886647be273e004) }},
+  {{ UINT64_C(0x549c339c7d5366c8), UINT64_C(0x27e11ae0ed81b6e9), UINT64_C(0x8d4e22669fcf5049), UINT64_C(0x0c05aababfa42d1d) }},
+  {{ UINT64_C(0xad985296aa4423a6), UINT64_C(0x11d08fda85f5cd6e), UINT64_C(0x1ee8d1cdf2fe9292), UINT64_C(0x1284f145d8970b51) }},
+  {{ UINT64_C(0xe058538c6274a8b2), UINT64_C(0x94d3e9fb57a7b6f1), UINT64_C(0xdba6924a7bf1e508), UINT64_C(0x7ae56d0c7b693d18) }},
+  {{ UINT64_C(0x6c56f5364516b6d6), UINT64_C(0xc0393a815dcc4a84), UINT64_C(0x830666e3aa69862c), UINT64_C(0x884494c7862051bf) }},
+  {{ UINT64_C(0x4cdeec9d6248beda), UINT64_C(0x1e8abba271fdff93), UINT64_C(0x523f1ac5c858955c), UINT64_C(0x5a32db2a8893f6a3) }},
+  {{ UINT64_C(0xd7e3ae06cbaeba82), UINT64_C(0xd7282a133924c642), UINT64_C(0x376c22e7d4fb4e0f), UINT64_C(0x95198ec6df2f4b28) }},
+  {{ UINT64_C(0x1fcc6f0bf560881e), UINT64_C(0xefa88f8a8950250e), UINT64_C(0x1d1e3065ceedefd1), UINT64_C(0x2d0f3be767032aa7) }},
+  {{ UINT64_C(0x90e6f9d1e3e6e48e), UINT64_C(0x3a60fe5e46eb13c4), UINT64_C(0x96148e6d1935e668), UINT64_C(0xc44cc949df5bf415) }},
+  {{ UINT64_C(0x36e8d37d8341b6aa), UINT64_C(0x0d649452579a43ca), UINT64_C(0xa09060a83f65b43f), UINT64_C(0xfd532a0119834ded) }},
+  {{ UINT64_C(0x6adcc58ce794f130), UINT64_C(0xa4650c636aea4c0b), UINT64_C(0x7ce14b5a85262cec), UINT64_C(0xf2b1460b78cdf461) }},
+  {{ UINT64_C(0x85cd8eded88df448), UINT64_C(0xe13a20ffaa34d050), UINT64_C(0xcce0f1d3985d54f7), UINT64_C(0x8369a73acbd71a47) }},
+  {{ UINT64_C(0x668af05968927176), UINT64_C(0x16b122027bebf44d), UINT64_C(0x93ff0d70df0c4d13), UINT64_C(0xdddd366ab5771481) }},
+  {{ UINT64_C(0xaa27f43525904bb2), UINT64_C(0xd9906c4093be4db6), UINT64_C(0x1a33ab18ff113c46), UINT64_C(0x4098704daecd6569) }},
+  {{ UINT64_C(0x361d778192ffecee), UINT64_C(0x6e9783b55b6e5e28), UINT64_C(0x2dbdd4cc09a90e61), UINT64_C(0xc05c4dbadd676beb) }},
+  {{ UINT64_C(0x673a33220ce7ac5e), UINT64_C(0x0cc78f65dbc7789d), UINT64_C(0x589f927d82444cfa), UINT64_C(0xd1b2aca2a0a0a510) }},
+  {{ UINT64_C(0x3cbdd059533293cc), UINT64_C(0x005799abe68fc3e7), UINT64_C(0x826b5f1f539803aa), UINT64_C(0x5d5874920dfe88db) }},
+  {{ UINT64_C(0xefbbfb5f1a1478c6), UINT64_C(0x5c47a9aae739016c), UINT64_C(0x962c89937dc6c212), UINT64_C(0xf9b49148f7337297) }},
+  {{ UINT64_C(0xc5102adcf11db7bc), UINT64_C(0xe8b363f4cb891123), UINT64_C(0x6a891b790603179b), UINT64_C(0xc46d584af2172ecb) }},
+  {{ UINT64_C(0x18ac3b230c15a5ce), UINT64_C(0xd44821c30d589aab), UINT64_C(0x57260958fca9504a), UINT64_C(0x974492b66304cfed) }},
+  {{ UINT64_C(0xec2a03b44b664d98), UINT64_C(0xf18c4919f9ef2e5d), UINT64_C(0xb7345c6710c65cf5), UINT64_C(0xaad4a06a0f64febf) }},
+  {{ UINT64_C(0x0d75b618e2cbc69a), UINT64_C(0xa4199cd89c091b77), UINT64_C(0xa9c2dcd5c80af594), UINT64_C(0x60701da655969976) }},
+  {{ UINT64_C(0x722cfaf4bb9c7c80), UINT64_C(0x6f858ab8c7803bb4), UINT64_C(0x7eb4168cb3017166), UINT64_C(0xa8dc8ed5822b09e5) }},
+  {{ UINT64_C(0x8a4306ee2c9c30fc), UINT64_C(0x18b9edb274b97693), UINT64_C(0xb4d5c542f7569c07), UINT64_C(0xefdcebf011b64b2d) }},
+  {{ UINT64_C(0xc1c18483ae14c9b0), UINT64_C(0xb39e3203e51b689b), UINT64_C(0x8284ec04795a72e6), UINT64_C(0xf9addb4fab396c1c) }},
+  {{ UINT64_C(0x3ecf082ce2d44e86), UINT64_C(0x63d9a82196253ead), UINT64_C(0x082716b5e894dac2), UINT64_C(0x57bcfe36871fa96d) }},
+  {{ UINT64_C(0x11ce88879e47668c), UINT64_C(0x36ec3271c40631bf), UINT64_C(0x4ba981bdf861b433), UINT64_C(0x8308095033f78bff) }},
+  {{ UINT64_C(0x4ca8e2fcd0d5e2ce), UINT64_C(0x27c6e6f6f29f551c), UINT64_C(0xb2e9b4de9635fe8b), UINT64_C(0xe55a49795a6630fb) }},
+  {{ UINT64_C(0x427c08543740798c), UINT64_C(0xa3a3079bbed54001), UINT64_C(0x7f3e6f2a0d148a31), UINT64_C(0xcefbeb470caddb95) }},
+  {{ UINT64_C(0xdeb4855c1e3ead76), UINT64_C(0x09037ea15a4b2bea), UINT64_C(0xd252b20f0b13d1fa), UINT64_C(0xcf72b9c19b522812) }},
+  {{ UINT64_C(0xf44f16d631f1a270), UINT64_C(0x961a315f4cdcb95f), UINT64_C(0x263ff077fd048932), UINT64_C(0xe769b287c004e455) }},
+  {{ UINT64_C(0xc130a3ce5374f8ea), UINT64_C(0x0161ac49425ed3f6), UINT64_C(0xc5da1dd9ca7ed658), UINT64_C(0x47e1bafece61a670) }},
+  {{ UINT64_C(0xc9082d93f7a9f400), UINT64_C(0xf317ca0aa50e2806), UINT64_C(0x07978b6977fd2e3d), UINT64_C(0xabd2da13e47cfc7c) }},
+  {{ UINT64_C(0x655e1bda3f274f28), UINT64_C(0x28583082bb774c34), UINT64_C(0xd03c93c67dbdc98a), UINT64_C(0x42a78623c936c02c) }},
+  {{ UINT64_C(0x3a09ac359e26fab4), UINT64_C(0x945ae90c9f21c1aa), UINT64_C(0xd70502425eab4ffd), UINT64_C(0x4d2241ff1f3b35ae) }},
+  {{ UINT64_C(0xb15d2a53f79a6d3c), UINT64_C(0x1313c6e2319c6358), UINT64_C(0xb1c1ecf8b533b7a5), UINT64_C(0x911ec25ea3c84b58) }},
+  {{ UINT64_C(0x87895aa8f0c90878), UINT64_C(0xc3fbf0490b2c094d), UINT64_C(0x6924fc1ad4022fbc), UINT64_C(0x8d0a79061278a597) }},
+  {{ UINT64_C(0x6dacad56e7422f3c), UINT64_C(0x68813b58d45e020a), UINT64_C(0x9eea1fd46242eda7), UINT64_C(0x2d05f9295a26a5c0) }},
+  {{ UINT64_C(0xe489a6b5fb35317c), UINT64_C(0x67bae611d9b4e68d), UINT64_C(0x68d23c02e0796d34), UINT64_C(0x2c215feb343c2403) }},
+  {{ UINT64_C(0x121f542f28b81ef8), UINT64_C(0xe2a9eabfb3fc326f), UINT64_C(0xe1fc7cf00172c817), UINT64_C(0x1cc28cb915e75f9a) }},
+  {{ UINT64_C(0x20d3887649d62fd4), UINT64_C(0x1e319b876e4d38b7), UINT64_C(0x7ddc0b36986f47f6), UINT64_C(0x24055430bec3a307) }},
+  {{ UINT64_C(0x4960ef1b52cb1858), UINT64_C(0x2da140b73674e6cf), UINT64_C(0x1470cb334eb8efdb), UINT64_C(0xbf9642ae293006d6) }},
+  {{ UINT64_C(0xd42436c12f9d56ee), UINT64_C(0x988928fca221b88a), UINT64_C(0x2eec9f1f6ceebbb4), UINT64_C(0xb273fb4b2430767f) }},
+  {{ UINT64_C(0xb3e66032c9afd640), UINT64_C(0xa2caaaf43836775c), UINT64_C(0xdc7c667919b0988d), UINT64_C(0x51f608325afa990b) }},
+  {{ UINT64_C(0x3581217ec0bc3dd4), UINT64_C(0xed6082cd15053581), UINT64_C(0x2715725ed3ebcabe), UINT64_C(0xf1bd4fc72dc1687f) }},
+  {{ UINT64_C(0x2e0858611069a5cc), UINT64_C(0x208c1a7c0ed951d3), UINT64_C(0xb5cc1acfc89c8d29), UINT64_C(0x2bb6c58287358d31) }},
+  {{ UINT64_C(0x958811ceb3426114), UINT64_C(0x5c69acd520603021), UINT64_C(0x164f206d95c71c15), UINT64_C(0x274183807dfb1410) }},
+  {{ UINT64_C(0x1e4fcecf62a98c60), UINT64_C(0x3a4b84061ca0b5b8), UINT64_C(0x21c0248e1dc039c1), UINT64_C(0x57a455c0f5879cfe) }},
+  {{ UINT64_C(0xeebff25845bf356c), UINT64_C(0x6d971bc2a340349a), UINT64_C(0x99a5f1872894ab90), UINT64_C(0xa450c9753ae15bf7) }},
+  {{ UINT64_C(0xb2da3ebf63c86e56), UINT64_C(0x2148d077c4c5b55c), UINT64_C(0x47998d8770924d2d), UINT64_C(0x951d430104d1816e) }},
+  {{ UINT64_C(0xbe4f6dbd33dabed6), UINT64_C(0xa7c1ec66742579fc), UINT64_C(0xc770b2797b13c0db), UINT64_C(0x55ed669456d9429e) }},
+  {{ UINT64_C(0x850ca0c8468a0cd4), UINT64_C(0x9f02344c3f51c4bc), UINT64_C(0x184d4852851d249c), UINT64_C(0x38acc2d473b4a29d) }},
+  {{ UINT64_C(0x5f4a012390136c2e), UINT64_C(0x0fdc1d52a9942a9e), UINT64_C(0xf77cc447c9f1c10d), UINT64_C(0x77f919262abfac7a) }},
+  {{ UINT64_C(0xd96ffbf32d8a77fe), UINT64_C(0xb42d5c0829d79443), UINT64_C(0x415484a46094fcb3), UINT64_C(0xda189a0b88033964) }},
+  {{ UINT64_C(0xfc795b42abc8acb0), UINT64_C(0x6f77cf9e49e44d72), UINT64_C(0xa05a40c917a33659), UINT64_C(0x3dc75bfd42981c96) }},
+  {{ UINT64_C(0x5fa71ff9ba1a9e82), UINT64_C(0xd625e6fabd9ffd76), UINT64_C(0xa74b63e5fe0bab46), UINT64_C(0x023218d836c863d6) }},
+};
+
+static const mzd_local_t C_0[] = {
+  {{ UINT64_C(0xb22c0d11229ae744), UINT64_C(0x71e6b0a2eb03e4d2), UINT64_C(0x48c00d47d6a1fc91), UINT64_C(0x23af7e359a34a6be) }}};
+
+static const mzd_local_t C_1[] = {
+  {{ UINT64_C(0x04be7967ed14a024), UINT64_C(0x478280c76d0d4dce), UINT64_C(0xf016940e858b51e3), UINT64_C(0x3c0b8b209c2d8763) }}};
+
+static const mzd_local_t C_2[] = {
+  {{ UINT64_C(0x61678479959e4a0a), UINT64_C(0x83ae590e7a4668bf), UINT64_C(0x5e52a41c5e6e6420), UINT64_C(0xfd128a3a28f536f8) }}};
+
+static const mzd_local_t C_3[] = {
+  {{ UINT64_C(0x0ce22f6025552752), UINT64_C(0x8f388146586fce35), UINT64_C(0xa0d614af77487674), UINT64_C(0x313911715b713f2a) }}};
+static const lowmc_round_t rounds[4] = {
+
+  {
+    K_1, L_0, Li_0, C_0
+  },
+  {
+    K_2, L_1, Li_1, C_1
+  },
+  {
+    K_3, L_2, Li_2, C_2
+  },
+  {
+    K_4, L_3, Li_3, C_3
+  },
+};
+
+const lowmc_t lowmc_255_255_4 = {
+  K_0,
+  Ki_0,
+  rounds,
+};
@@ -19,51 +19,59 @@
 #include <assert.h>
 
 #include "lowmc_129_129_4.h"
+#include "lowmc_192_192_4.h"
+#include "lowmc_255_255_4.h"
 
 
 #if !defined(NO_UINT64_FALLBACK)
 /**
- * S-box for m = 43
+ * S-box layer of LowMC-n-n-4 with m S-boxes on states of the given number of bits
  */
-static void sbox_uint64_lowmc_129_129_4(mzd_local_t* in) {
-  mzd_local_t x0m[1], x1m[1], x2m[1];
-  // a
-  mzd_and_uint64_192(x0m, mask_129_129_43_a, in);
-  // b
-  mzd_and_uint64_192(x1m, mask_129_129_43_b, in);
-  // c
-  mzd_and_uint64_192(x2m, mask_129_129_43_c, in);
-
-  mzd_shift_left_uint64_192(x0m, x0m, 2);
-  mzd_shift_left_uint64_192(x1m, x1m, 1);
-
-  mzd_local_t t0[1], t1[1], t2[1];
-  // b & c
-  mzd_and_uint64_192(t0, x1m, x2m);
-  // c & a
-  mzd_and_uint64_192(t1, x0m, x2m);
-  // a & b
-  mzd_and_uint64_192(t2, x0m, x1m);
-
-  // (b & c) ^ a
-  mzd_xor_uint64_192(t0, t0, x0m);
-
-  // (c & a) ^ a ^ b
-  mzd_xor_uint64_192(t1, t1, x0m);
-  mzd_xor_uint64_192(t1, t1, x1m);
-
-  // (a & b) ^ a ^ b ^c
-  mzd_xor_uint64_192(t2, t2, x0m);
-  mzd_xor_uint64_192(t2, t2, x1m);
-  mzd_xor_uint64_192(t2, t2, x2m);
-
-  mzd_shift_right_uint64_192(t0, t0, 2);
-  mzd_shift_right_uint64_192(t1, t1, 1);
-
-  mzd_xor_uint64_192(t2, t2, t1);
-  mzd_xor_uint64_192(in, t2, t0);
-}
+#define SBOX_UINT64(n, m, bits)                                                                    \
+  static void sbox_uint64_lowmc_##n##_##n##_4(mzd_local_t* in) {                                   \
+    mzd_local_t x0m[1], x1m[1], x2m[1];                                                            \
+    /* a */                                                                                        \
+    mzd_and_uint64_##bits(x0m, mask_##n##_##n##_##m##_a, in);                                      \
+    /* b */                                                                                        \
+    mzd_and_uint64_##bits(x1m, mask_##n##_##n##_##m##_b, in);                                      \
+    /* c */                                                                                        \
+    mzd_and_uint64_##bits(x2m, mask_##n##_##n##_##m##_c, in);                                      \
+                                                                                                   \
+    mzd_shift_left_uint64_##bits(x0m, x0m, 2);                                                     \
+    mzd_shift_left_uint64_##bits(x1m, x1m, 1);                                                     \
+                                                                                                   \
+    mzd_local_t t0[1], t1[1], t2[1];                                                               \
+    /* b & c */                                                                                    \
+    mzd_and_uint64_##bits(t0, x1m, x2m);                                                           \
+    /* c & a */                                                                                    \
+    mzd_and_uint64_##bits(t1, x0m, x2m);                                                           \
+    /* a & b */                                                                                    \
+    mzd_and_uint64_##bits(t2, x0m, x1m);                                                           \
+                                                                                                   \
+    /* (b & c) ^ a */                                                                              \
+    mzd_xor_uint64_##bits(t0, t0, x0m);                                                            \
+                                                                                                   \
+    /* (c & a) ^ a ^ b */                                                                          \
+    mzd_xor_uint64_##bits(t1, t1, x0m);                                                            \
+    mzd_xor_uint64_##bits(t1, t1, x1m);                                                            \
+                                                                                                   \
+    /* (a & b) ^ a ^ b ^c */                                                                       \
+    mzd_xor_uint64_##bits(t2, t2, x0m);                                                            \
+    mzd_xor_uint64_##bits(t2, t2, x1m);                                                            \
+    mzd_xor_uint64_##bits(t2, t2, x2m);                                                            \
+                                                                                                   \
+    mzd_shift_right_uint64_##bits(t0, t0, 2);                                                      \
+    mzd_shift_right_uint64_##bits(t1, t1, 1);                                                      \
+                                                                                                   \
+    mzd_xor_uint64_##bits(t2, t2, t1);                                                             \
+    mzd_xor_uint64_##bits(in, t2, t0);                                                             \
+  }
+
+SBOX_UINT64(129, 43, 192)
+SBOX_UINT64(192, 64, 192)
+SBOX_UINT64(255, 85, 256)
 
+#undef SBOX_UINT64
 
 #endif /* NO_UINT_FALLBACK */
 
@@ -110,6 +118,10 @@ lowmc_implementation_f lowmc_get_implementation(const lowmc_parameters_t* lowmc)
   /* Instances with full Sbox layer */
   if (lowmc->n == 129 && lowmc->m == 43)
     return lowmc_uint64_lowmc_129_129_4;
+  if (lowmc->n == 192 && lowmc->m == 64)
+    return lowmc_uint64_lowmc_192_192_4;
+  if (lowmc->n == 255 && lowmc->m == 85)
+    return lowmc_uint64_lowmc_255_255_4;
 #endif
 
   return NULL;
@@ -23,11 +23,17 @@
 #include <string.h>
 #include <assert.h>
 
-/* max number of ZKB++ rounds */
+/* max number of ZKB++ rounds and max view size per round */
+#if defined(PICNIC_L5_FULL)
+#define MAX_NUM_ROUNDS 438
+#define MAX_VIEW_SIZE 128
+#elif defined(PICNIC_L3_FULL)
+#define MAX_NUM_ROUNDS 329
+#define MAX_VIEW_SIZE 96
+#else
 #define MAX_NUM_ROUNDS 219
-
-/* max view size per round */
 #define MAX_VIEW_SIZE 65
+#endif
 
 /* max number of LowMC rounds */
 #define MAX_LOWMC_R 4
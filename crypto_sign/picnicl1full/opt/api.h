@@ -1,10 +1,22 @@
 #ifndef PICNIC_L1_FULL_API_H
 #define PICNIC_L1_FULL_API_H
 
+#if defined(PICNIC_L5_FULL)
+#define CRYPTO_SECRETKEYBYTES (1 + 2 * 32 + 32)
+#define CRYPTO_PUBLICKEYBYTES (1 + 2 * 32)
+#define CRYPTO_BYTES (4 + 126286)
+#define CRYPTO_ALGNAME "picnicl5full"
+#elif defined(PICNIC_L3_FULL)
+#define CRYPTO_SECRETKEYBYTES (1 + 2 * 24 + 24)
+#define CRYPTO_PUBLICKEYBYTES (1 + 2 * 24)
+#define CRYPTO_BYTES (4 + 71179)
+#define CRYPTO_ALGNAME "picnicl3full"
+#else
 #define CRYPTO_SECRETKEYBYTES (1 + 2 * 17 + 17)
 #define CRYPTO_PUBLICKEYBYTES (1 + 2 * 17)
 #define CRYPTO_BYTES (4 + 32061)
 #define CRYPTO_ALGNAME "picnicl1full"
+#endif
 #define CRYPTO_VERSION "3.0"
 #define CRYPTO_DETERMINISTIC 1
 
@@ -15,5 +27,11 @@ int crypto_sign(unsigned char* sm, size_t* smlen, const unsigned char* m,
                 size_t mlen, const unsigned char* sk);
 int crypto_sign_open(unsigned char* m, size_t* mlen, const unsigned char* sm,
                      size_t smlen, const unsigned char* pk);
+/* Detached signatures: the signature (at most CRYPTO_BYTES - 4 bytes) is written to and read from
+ * a separate buffer and the message is not copied. */
+int crypto_sign_signature(unsigned char* sig, size_t* siglen, const unsigned char* m,
+                          size_t mlen, const unsigned char* sk);
+int crypto_sign_verify(const unsigned char* sig, size_t siglen, const unsigned char* m,
+                       size_t mlen, const unsigned char* pk);
 
 #endif
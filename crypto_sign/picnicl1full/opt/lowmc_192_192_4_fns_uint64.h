@@ -15,3 +15,7 @@
 #define COPY mzd_copy_uint64_192
 #define MPC_MUL mpc_matrix_mul_uint64_192
 
+#define LOWMC_INSTANCE lowmc_192_192_4
+#define LOWMC_N LOWMC_192_192_4_N
+#define LOWMC_R LOWMC_192_192_4_R
+#define LOWMC_M LOWMC_192_192_4_M
@@ -15,3 +15,7 @@
 #define COPY mzd_copy_uint64_256
 #define MPC_MUL mpc_matrix_mul_uint64_256
 
+#define LOWMC_INSTANCE lowmc_255_255_4
+#define LOWMC_N LOWMC_255_255_4_N
+#define LOWMC_R LOWMC_255_255_4_R
+#define LOWMC_M LOWMC_255_255_4_M
@@ -108,6 +108,13 @@
 #define ATTR_ASSUME_ALIGNED(i)
 #endif
 
+/* noinline attribute */
+#if GNUC_CHECK(3, 1) || __has_attribute(noinline)
+#define ATTR_NOINLINE __attribute__((noinline))
+#else
+#define ATTR_NOINLINE
+#endif
+
 /* aligned attribute */
 /* note that C11's alignas will only do the job once DR 444 is implemented */
 #if GNUC_CHECK(4, 9) || __has_attribute(aligned)
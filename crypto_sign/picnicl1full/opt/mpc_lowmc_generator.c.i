@@ -21,6 +21,8 @@
 
 
 #include "lowmc_129_129_4.h"
+#include "lowmc_192_192_4.h"
+#include "lowmc_255_255_4.h"
 
 #define MPC_LOOP_CONST(function, result, first, second, sc)                                        \
   do {                                                                                             \
@@ -128,6 +130,76 @@ static void mpc_and_verify_uint64_192(mzd_local_t* res, const mzd_local_t* first
 }
 
 
+static void mpc_and_uint64_256(mzd_local_t* res, const mzd_local_t* first,
+                               const mzd_local_t* second, const mzd_local_t* r, view_t* view,
+                               unsigned viewshift) {
+  mzd_local_t tmp = {{0}};
+
+  for (unsigned int m = 0; m < SC_PROOF; ++m) {
+    const unsigned int j = (m + 1) % SC_PROOF;
+
+    // f[m] & s[m]
+    mzd_and_uint64_256(&res[m], &first[m], &second[m]);
+
+    // f[m + 1] & s[m]
+    mzd_and_uint64_256(&tmp, &first[j], &second[m]);
+    mzd_xor_uint64_256(&res[m], &res[m], &tmp);
+
+    // f[m] & s[m + 1]
+    mzd_and_uint64_256(&tmp, &first[m], &second[j]);
+    mzd_xor_uint64_256(&res[m], &res[m], &tmp);
+
+    // ... ^ r[m] ^ r[m + 1]
+    mzd_xor_uint64_256(&tmp, &r[m], &r[j]);
+    mzd_xor_uint64_256(&res[m], &res[m], &tmp);
+
+    if (viewshift) {
+      mzd_shift_right_uint64_256(&tmp, &res[m], viewshift);
+      mzd_xor_uint64_256(&view->s[m], &view->s[m], &tmp);
+    } else {
+      // on first call (viewshift == 0), view->t[0..2] == 0
+      mzd_copy_uint64_256(&view->s[m], &res[m]);
+    }
+  }
+}
+
+static void mpc_and_verify_uint64_256(mzd_local_t* res, const mzd_local_t* first,
+                                      const mzd_local_t* second, const mzd_local_t* r, view_t* view,
+                                      const mzd_local_t* mask, unsigned viewshift) {
+  mzd_local_t tmp = {{0}};
+
+  for (unsigned int m = 0; m < (SC_VERIFY - 1); ++m) {
+    const unsigned int j = m + 1;
+
+    mzd_and_uint64_256(&res[m], &first[m], &second[m]);
+
+    mzd_and_uint64_256(&tmp, &first[j], &second[m]);
+    mzd_xor_uint64_256(&res[m], &res[m], &tmp);
+
+    mzd_and_uint64_256(&tmp, &first[m], &second[j]);
+    mzd_xor_uint64_256(&res[m], &res[m], &tmp);
+
+    mzd_xor_uint64_256(&tmp, &r[m], &r[j]);
+    mzd_xor_uint64_256(&res[m], &res[m], &tmp);
+
+    if (viewshift) {
+      mzd_shift_right_uint64_256(&tmp, &res[m], viewshift);
+      mzd_xor_uint64_256(&view->s[m], &view->s[m], &tmp);
+    } else {
+      // on first call (viewshift == 0), view->s[0] == 0
+      mzd_copy_uint64_256(&view->s[m], &res[m]);
+    }
+  }
+
+  if (viewshift) {
+    mzd_shift_left_uint64_256(&tmp, &view->s[SC_VERIFY - 1], viewshift);
+    mzd_and_uint64_256(&res[SC_VERIFY - 1], &tmp, mask);
+  } else {
+    mzd_and_uint64_256(&res[SC_VERIFY - 1], &view->s[SC_VERIFY - 1], mask);
+  }
+}
+
+
 #define bitsliced_step_1(sc, AND, ROL, MASK_A, MASK_B, MASK_C)                                     \
   mzd_local_t x2m[sc] = {{{0}}};                                                                   \
   mzd_local_t r0m[sc] = {{{0}}}, r1m[sc] = {{{0}}}, r2m[sc] = {{{0}}};                             \
@@ -194,6 +266,66 @@ static void mpc_sbox_verify_uint64_lowmc_129_129_4(mzd_local_t* out, const mzd_l
   bitsliced_step_2(SC_VERIFY, mzd_xor_uint64_192, mzd_shift_right_uint64_192);
 }
 
+static void mpc_sbox_prove_uint64_lowmc_192_192_4(mzd_local_t* out, const mzd_local_t* in,
+                                                  view_t* view, const rvec_t* rvec) {
+  bitsliced_step_1(SC_PROOF, mzd_and_uint64_192, mzd_shift_left_uint64_192, mask_192_192_64_a,
+                   mask_192_192_64_b, mask_192_192_64_c);
+
+  // a & b
+  mpc_and_uint64_192(r0m, x0s, x1s, r2m, view, 0);
+  // b & c
+  mpc_and_uint64_192(r2m, x1s, x2m, r1s, view, 1);
+  // c & a
+  mpc_and_uint64_192(r1m, x0s, x2m, r0s, view, 2);
+
+  bitsliced_step_2(SC_PROOF, mzd_xor_uint64_192, mzd_shift_right_uint64_192);
+}
+
+static void mpc_sbox_verify_uint64_lowmc_192_192_4(mzd_local_t* out, const mzd_local_t* in,
+                                                   view_t* view, const rvec_t* rvec) {
+  bitsliced_step_1(SC_VERIFY, mzd_and_uint64_192, mzd_shift_left_uint64_192, mask_192_192_64_a,
+                   mask_192_192_64_b, mask_192_192_64_c);
+
+  // a & b
+  mpc_and_verify_uint64_192(r0m, x0s, x1s, r2m, view, mask_192_192_64_c, 0);
+  // b & c
+  mpc_and_verify_uint64_192(r2m, x1s, x2m, r1s, view, mask_192_192_64_c, 1);
+  // c & a
+  mpc_and_verify_uint64_192(r1m, x0s, x2m, r0s, view, mask_192_192_64_c, 2);
+
+  bitsliced_step_2(SC_VERIFY, mzd_xor_uint64_192, mzd_shift_right_uint64_192);
+}
+
+static void mpc_sbox_prove_uint64_lowmc_255_255_4(mzd_local_t* out, const mzd_local_t* in,
+                                                  view_t* view, const rvec_t* rvec) {
+  bitsliced_step_1(SC_PROOF, mzd_and_uint64_256, mzd_shift_left_uint64_256, mask_255_255_85_a,
+                   mask_255_255_85_b, mask_255_255_85_c);
+
+  // a & b
+  mpc_and_uint64_256(r0m, x0s, x1s, r2m, view, 0);
+  // b & c
+  mpc_and_uint64_256(r2m, x1s, x2m, r1s, view, 1);
+  // c & a
+  mpc_and_uint64_256(r1m, x0s, x2m, r0s, view, 2);
+
+  bitsliced_step_2(SC_PROOF, mzd_xor_uint64_256, mzd_shift_right_uint64_256);
+}
+
+static void mpc_sbox_verify_uint64_lowmc_255_255_4(mzd_local_t* out, const mzd_local_t* in,
+                                                   view_t* view, const rvec_t* rvec) {
+  bitsliced_step_1(SC_VERIFY, mzd_and_uint64_256, mzd_shift_left_uint64_256, mask_255_255_85_a,
+                   mask_255_255_85_b, mask_255_255_85_c);
+
+  // a & b
+  mpc_and_verify_uint64_256(r0m, x0s, x1s, r2m, view, mask_255_255_85_c, 0);
+  // b & c
+  mpc_and_verify_uint64_256(r2m, x1s, x2m, r1s, view, mask_255_255_85_c, 1);
+  // c & a
+  mpc_and_verify_uint64_256(r1m, x0s, x2m, r0s, view, mask_255_255_85_c, 2);
+
+  bitsliced_step_2(SC_VERIFY, mzd_xor_uint64_256, mzd_shift_right_uint64_256);
+}
+
 
 #endif /* NO_UINT_FALLBACK */
 
@@ -265,6 +397,12 @@ zkbpp_lowmc_implementation_f get_zkbpp_lowmc_implementation(const lowmc_paramete
   if (lowmc->n == 129 && lowmc->m == 43) {
     return mpc_lowmc_prove_uint64_lowmc_129_129_4;
   }
+  if (lowmc->n == 192 && lowmc->m == 64) {
+    return mpc_lowmc_prove_uint64_lowmc_192_192_4;
+  }
+  if (lowmc->n == 255 && lowmc->m == 85) {
+    return mpc_lowmc_prove_uint64_lowmc_255_255_4;
+  }
 #endif
 
   return NULL;
@@ -286,6 +424,12 @@ get_zkbpp_lowmc_verify_implementation(const lowmc_parameters_t* lowmc) {
   if (lowmc->n == 129 && lowmc->m == 43) {
     return mpc_lowmc_verify_uint64_lowmc_129_129_4;
   }
+  if (lowmc->n == 192 && lowmc->m == 64) {
+    return mpc_lowmc_verify_uint64_lowmc_192_192_4;
+  }
+  if (lowmc->n == 255 && lowmc->m == 85) {
+    return mpc_lowmc_verify_uint64_lowmc_255_255_4;
+  }
 #endif
 
   return NULL;
@@ -299,15 +443,24 @@ static void mzd_share_uint64_192(mzd_local_t* r, const mzd_local_t* v1, const mz
   mzd_xor_uint64_192(r, r, v3);
 }
 
+static void mzd_share_uint64_256(mzd_local_t* r, const mzd_local_t* v1, const mzd_local_t* v2,
+                                 const mzd_local_t* v3) {
+  mzd_xor_uint64_256(r, v1, v2);
+  mzd_xor_uint64_256(r, r, v3);
+}
+
 #endif
 
 
 zkbpp_share_implementation_f get_zkbpp_share_implentation(const lowmc_parameters_t* lowmc) {
 
 #if !defined(NO_UINT64_FALLBACK)
-  if (lowmc->n == 129 || lowmc->n == 128) {
+  if (lowmc->n == 129 || lowmc->n == 128 || lowmc->n == 192) {
     return mzd_share_uint64_192;
   }
+  if (lowmc->n == 255 || lowmc->n == 256) {
+    return mzd_share_uint64_256;
+  }
 #endif
 
   return NULL;
@@ -186,6 +186,24 @@ int PICNIC_CALLING_CONVENTION picnic_validate_keypair(const picnic_privatekey_t*
   return memcmp(buffer, pk_c, output_size);
 }
 
+static void sign_context_init(picnic_context_t* context, const picnic_instance_t* instance,
+                              const picnic_privatekey_t* sk) {
+  const size_t output_size = instance->output_size;
+  const size_t input_size  = instance->input_size;
+
+  const uint8_t* sk_sk = SK_SK(sk);
+  const uint8_t* sk_c  = SK_C(sk);
+  const uint8_t* sk_pt = SK_PT(sk);
+
+  mzd_from_char_array(context->m_plaintext, sk_pt, output_size);
+  mzd_from_char_array(context->m_key, sk_sk, input_size);
+  context->plaintext   = sk_pt;
+  context->private_key = sk_sk;
+  context->public_key  = sk_c;
+  context->msg         = NULL;
+  context->msglen      = 0;
+}
+
 int PICNIC_CALLING_CONVENTION picnic_sign(const picnic_privatekey_t* sk, const uint8_t* message,
                                           size_t message_len, uint8_t* signature,
                                           size_t* signature_len) {
@@ -199,29 +217,137 @@ int PICNIC_CALLING_CONVENTION picnic_sign(const picnic_privatekey_t* sk, const u
     return -1;
   }
 
-  const size_t output_size = instance->output_size;
-  const size_t input_size  = instance->input_size;
-
-  const uint8_t* sk_sk = SK_SK(sk);
-  const uint8_t* sk_c  = SK_C(sk);
-  const uint8_t* sk_pt = SK_PT(sk);
-
   if (param == Picnic3_L1 || param == Picnic3_L3 || param == Picnic3_L5) {
     return -1;
   } else {
     picnic_context_t context;
-    mzd_from_char_array(context.m_plaintext, sk_pt, output_size);
-    mzd_from_char_array(context.m_key, sk_sk, input_size);
-    context.plaintext   = sk_pt;
-    context.private_key = sk_sk;
-    context.public_key  = sk_c;
-    context.msg         = message;
-    context.msglen      = message_len;
+    sign_context_init(&context, instance, sk);
+    context.msg    = message;
+    context.msglen = message_len;
 
     return impl_sign(instance, &context, signature, signature_len);
   }
 }
 
+size_t PICNIC_CALLING_CONVENTION picnic_sign_context_size(picnic_params_t param) {
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance || param == Picnic3_L1 || param == Picnic3_L3 || param == Picnic3_L5) {
+    return 0;
+  }
+
+  return impl_sign_state_size();
+}
+
+int PICNIC_CALLING_CONVENTION picnic_sign_begin(void* context, size_t context_len,
+                                                const picnic_privatekey_t* sk,
+                                                const uint8_t* message, size_t message_len,
+                                                uint8_t* signature, size_t signature_len) {
+  if (!context || ((uintptr_t)context % sizeof(uint64_t)) || !sk || !signature) {
+    return -1;
+  }
+
+  const picnic_params_t param       = sk->data[0];
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  const size_t context_size         = picnic_sign_context_size(param);
+  if (!instance || !context_size || context_len < context_size ||
+      signature_len < instance->max_signature_size) {
+    return -1;
+  }
+
+  picnic_context_t sign_context;
+  sign_context_init(&sign_context, instance, sk);
+  sign_context.msg    = message;
+  sign_context.msglen = message_len;
+
+  impl_sign_begin(instance, &sign_context, context, signature);
+  return 0;
+}
+
+int PICNIC_CALLING_CONVENTION picnic_sign_step(void* context) {
+  if (!context) {
+    return -1;
+  }
+
+  return impl_sign_step(context);
+}
+
+int PICNIC_CALLING_CONVENTION picnic_sign_finish(void* context, size_t* signature_len) {
+  if (!context || !signature_len) {
+    return -1;
+  }
+
+  return impl_sign_finish(context, signature_len);
+}
+
+size_t PICNIC_CALLING_CONVENTION picnic_presign_size(picnic_params_t param) {
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  if (!instance || param == Picnic3_L1 || param == Picnic3_L3 || param == Picnic3_L5) {
+    return 0;
+  }
+
+  return impl_presign_size();
+}
+
+static int presign_entry(const picnic_privatekey_t* sk, const uint8_t* message,
+                         size_t message_len, void* presign, size_t presign_len,
+                         bool deterministic) {
+  if (!sk || !presign || ((uintptr_t)presign % sizeof(uint64_t))) {
+    return -1;
+  }
+
+  const picnic_params_t param       = sk->data[0];
+  const picnic_instance_t* instance = picnic_instance_get(param);
+  const size_t presign_size         = picnic_presign_size(param);
+  if (!instance || !presign_size || presign_len < presign_size) {
+    return -1;
+  }
+
+  picnic_context_t context;
+  sign_context_init(&context, instance, sk);
+  context.msg    = message;
+  context.msglen = message_len;
+
+  return impl_presign(instance, &context, presign, deterministic);
+}
+
+int PICNIC_CALLING_CONVENTION picnic_presign(const picnic_privatekey_t* sk, void* presign,
+                                             size_t presign_len) {
+  return presign_entry(sk, NULL, 0, presign, presign_len, false);
+}
+
+int PICNIC_CALLING_CONVENTION picnic_presign_deterministic(const picnic_privatekey_t* sk,
+                                                           const uint8_t* message,
+                                                           size_t message_len, void* presign,
+                                                           size_t presign_len) {
+  return presign_entry(sk, message, message_len, presign, presign_len, true);
+}
+
+int PICNIC_CALLING_CONVENTION picnic_sign_presigned(const picnic_privatekey_t* sk, void* presign,
+                                                    size_t presign_len, const uint8_t* message,
+                                                    size_t message_len, uint8_t* signature,
+                                                    size_t* signature_len) {
+  if (!presign) {
+    return -1;
+  }
+
+  const picnic_instance_t* instance = sk ? picnic_instance_get(sk->data[0]) : NULL;
+  const size_t presign_size         = sk ? picnic_presign_size(sk->data[0]) : 0;
+  if (!instance || !presign_size || presign_len < presign_size ||
+      ((uintptr_t)presign % sizeof(uint64_t)) || !signature || !signature_len ||
+      *signature_len < instance->max_signature_size) {
+    // entries must never be used twice, also not after a failed call
+    explicit_bzero(presign, presign_len);
+    return -1;
+  }
+
+  picnic_context_t context;
+  sign_context_init(&context, instance, sk);
+  context.msg    = message;
+  context.msglen = message_len;
+
+  return impl_sign_presigned(instance, &context, presign, signature, signature_len);
+}
+
 int PICNIC_CALLING_CONVENTION picnic_verify(const picnic_publickey_t* pk, const uint8_t* message,
                                             size_t message_len, const uint8_t* signature,
                                             size_t signature_len) {
@@ -23,11 +23,17 @@
 #include <string.h>
 #include <assert.h>
 
-/* max number of ZKB++ rounds */
+/* max number of ZKB++ rounds and max view size per round */
+#if defined(PICNIC_L5_FULL)
+#define MAX_NUM_ROUNDS 438
+#define MAX_VIEW_SIZE 128
+#elif defined(PICNIC_L3_FULL)
+#define MAX_NUM_ROUNDS 329
+#define MAX_VIEW_SIZE 96
+#else
 #define MAX_NUM_ROUNDS 219
-
-/* max view size per round */
 #define MAX_VIEW_SIZE 65
+#endif
 
 /* max number of LowMC rounds */
 #define MAX_LOWMC_R 4
@@ -47,6 +53,29 @@ typedef struct {
   const uint8_t* commitment; /* from signature */
 } verify_round_t;
 
+/* what picnic_sign_presigned needs from a round, independent of the challenge */
+typedef struct {
+  uint8_t seeds[SC_PROOF][MAX_SEED_SIZE];
+  uint8_t communicated_bits[SC_PROOF][MAX_VIEW_SIZE];
+  uint8_t commitments[SC_PROOF][MAX_DIGEST_SIZE];
+  uint8_t input_share[MAX_LOWMC_BLOCK_SIZE]; /* of the third party */
+} presign_round_t;
+
+#define PRESIGN_READY UINT32_C(0x50524531)
+
+typedef struct {
+  uint32_t ready;
+  uint8_t public_key[MAX_LOWMC_BLOCK_SIZE];
+  uint8_t plaintext[MAX_LOWMC_BLOCK_SIZE];
+  uint8_t salt[SALT_SIZE];
+  /* salt and seeds of a deterministic entry are derived from its message, see impl_presign */
+  uint8_t deterministic;
+  uint8_t msg_digest[MAX_DIGEST_SIZE];
+  /* challenge hash over output shares and commitments of all rounds */
+  hash_context h3_ctx;
+  presign_round_t rounds[MAX_NUM_ROUNDS];
+} presign_t;
+
 
 static inline void clear_padding_bits(uint8_t* v, const unsigned int diff) {
   *v &= UINT8_C(0xff) << diff;
@@ -497,181 +526,363 @@ static void generate_seeds(const picnic_instance_t* pp, const picnic_context_t*
   kdf_shake_finalize_key(ctx);
 }
 
-int impl_sign(const picnic_instance_t* pp, const picnic_context_t* context, uint8_t* sig,
-              size_t* siglen) {
-  const size_t num_rounds  = pp->num_rounds;
-  const unsigned int diff  = pp->input_size * 8 - pp->lowmc.n;
+/**
+ * Compute input and output shares, and optionally the views, of all parties of a round from the
+ * seeds stored in the round. Not inlined, so that the MPC state is only on the stack once.
+ */
+ATTR_NOINLINE static void simulate_round(const picnic_instance_t* pp,
+                                         const picnic_context_t* context, const uint8_t* salt,
+                                         unsigned int round_number, proof_round_t* round,
+                                         bool compute_views) {
+  const unsigned int diff = pp->input_size * 8 - pp->lowmc.n;
 
   const zkbpp_lowmc_implementation_f lowmc_impl       = pp->impls.zkbpp_lowmc;
   const zkbpp_share_implementation_f mzd_share        = pp->impls.mzd_share;
 
+  in_out_shares_t in_out_shares;
+  rvec_t rvec[MAX_LOWMC_R]; // random tapes for AND-gates
+
+  for (unsigned int j = 0; j < SC_PROOF; ++j) {
+    kdf_shake_t kdf;
+    kdf_init_from_seed(&kdf, round->seeds[j], salt, round_number, j, j != SC_PROOF - 1, pp);
+
+    // compute sharing
+    if (j < SC_PROOF - 1) {
+      kdf_shake_get_randomness(&kdf, round->input_shares[j], pp->input_size);
+      clear_padding_bits(&round->input_shares[j][pp->input_size - 1], diff);
+      mzd_from_char_array(in_out_shares.s[j], round->input_shares[j], pp->input_size);
+    } else {
+      mzd_share(in_out_shares.s[2], in_out_shares.s[0], in_out_shares.s[1], context->m_key);
+      mzd_to_char_array(round->input_shares[SC_PROOF - 1], in_out_shares.s[SC_PROOF - 1],
+                        pp->input_size);
+    }
+
+    // compute random tapes
+    assert(pp->view_size <= MAX_VIEW_SIZE);
+    uint8_t tape_bytes[MAX_VIEW_SIZE];
+    kdf_shake_get_randomness(&kdf, tape_bytes, pp->view_size);
+    decompress_random_tape(rvec, pp, tape_bytes, j);
+    kdf_shake_clear(&kdf);
+  }
+
+  // perform ZKB++ LowMC evaluation
+  view_t views[MAX_LOWMC_R];
+  lowmc_impl(context->m_plaintext, views, &in_out_shares, rvec);
+
+  // copy output shares and serialize views
+  for (unsigned int j = 0; j < SC_PROOF; ++j) {
+    mzd_to_char_array(round->output_shares[j], in_out_shares.s[j], pp->output_size);
+    if (compute_views) {
+      compress_view(round->communicated_bits[j], pp, views, j);
+    }
+  }
+}
+
+static uint8_t* serialize_presigned_round(const picnic_instance_t* pp,
+                                          const presign_round_t* round, uint8_t* tmp,
+                                          uint8_t challenge) {
+  const unsigned int b = (challenge + 1) % 3;
+  const unsigned int c = (challenge + 2) % 3;
+
+  // write commitment
+  memcpy(tmp, round->commitments[c], pp->digest_size);
+  tmp += pp->digest_size;
+
+  // write views
+  memcpy(tmp, round->communicated_bits[b], pp->view_size);
+  tmp += pp->view_size;
+
+  // write seeds
+  memcpy(tmp, round->seeds[challenge], pp->seed_size);
+  tmp += pp->seed_size;
+  memcpy(tmp, round->seeds[b], pp->seed_size);
+  tmp += pp->seed_size;
+
+  if (challenge) {
+    // write input share
+    memcpy(tmp, round->input_share, pp->input_size);
+    tmp += pp->input_size;
+  }
+
+  return tmp;
+}
+
+typedef enum {
+  SIGN_PHASE_COMMIT, /* output shares of every round for the challenge hash */
+  SIGN_PHASE_VIEWS,  /* commitments of every round for the challenge hash */
+  SIGN_PHASE_PROOF,  /* challenged views of every round into the signature */
+  SIGN_PHASE_DONE,
+} sign_phase_t;
+
+/* State of a signature computed one ZKB++ round per sign_step. The seeds are reproduced from
+ * seed_ctx in each of the three passes over the rounds, as in the one-shot signer. */
+typedef struct {
+  const picnic_instance_t* pp;
+  uint8_t private_key[MAX_LOWMC_KEY_SIZE];
+  uint8_t public_key[MAX_LOWMC_BLOCK_SIZE];
+  uint8_t plaintext[MAX_LOWMC_BLOCK_SIZE];
+  const uint8_t* msg;
+  size_t msglen;
+  uint8_t* sig;
+  size_t sig_pos;
+  kdf_shake_t seed_ctx;
+  hash_context h3_ctx;
+  uint8_t challenge[MAX_NUM_ROUNDS];
+  size_t round_number;
+  sign_phase_t phase;
+} sign_state_t;
+
+static void sign_state_to_context(const sign_state_t* state, picnic_context_t* context) {
+  const picnic_instance_t* pp = state->pp;
+
+  mzd_from_char_array(context->m_plaintext, state->plaintext, pp->output_size);
+  mzd_from_char_array(context->m_key, state->private_key, pp->input_size);
+  context->plaintext   = state->plaintext;
+  context->private_key = state->private_key;
+  context->public_key  = state->public_key;
+  context->msg         = state->msg;
+  context->msglen      = state->msglen;
+}
+
+static void sign_begin(sign_state_t* state, const picnic_instance_t* pp,
+                       const picnic_context_t* context, uint8_t* sig) {
+  state->pp = pp;
+  memcpy(state->private_key, context->private_key, pp->input_size);
+  memcpy(state->public_key, context->public_key, pp->output_size);
+  memcpy(state->plaintext, context->plaintext, pp->output_size);
+  state->msg          = context->msg;
+  state->msglen       = context->msglen;
+  state->sig          = sig;
+  state->sig_pos      = 0;
+  state->round_number = 0;
+  state->phase        = SIGN_PHASE_COMMIT;
+
   // Generate salt
   uint8_t* salt = sig + pp->collapsed_challenge_size;
-  kdf_shake_t seed_ctx;
-  generate_salt(pp, context, &seed_ctx, salt);
+  generate_salt(pp, context, &state->seed_ctx, salt);
   // Reset seed_ctx to produce seeds
-  kdf_shake_clear(&seed_ctx);
-  generate_seeds(pp, context, &seed_ctx);
+  kdf_shake_clear(&state->seed_ctx);
+  generate_seeds(pp, context, &state->seed_ctx);
 
-  hash_context h3_ctx;
-  hash_init_prefix(&h3_ctx, pp->digest_size, HASH_PREFIX_1);
+  hash_init_prefix(&state->h3_ctx, pp->digest_size, HASH_PREFIX_1);
+}
 
-  for (size_t i = 0; i < num_rounds; ++i) {
-    proof_round_t round = { 0 };
-    in_out_shares_t in_out_shares;
-    rvec_t rvec[MAX_LOWMC_R]; // random tapes for AND-gates
+static int sign_step(sign_state_t* state) {
+  const picnic_instance_t* pp = state->pp;
+  if (state->phase == SIGN_PHASE_DONE) {
+    return 0;
+  }
 
-    for (unsigned int j = 0; j < SC_PROOF; ++j) {
-      kdf_shake_t kdf;
-      kdf_shake_get_randomness(&seed_ctx, round.seeds[j], pp->seed_size);
-      kdf_init_from_seed(&kdf, round.seeds[j], salt, i, j, j != SC_PROOF - 1, pp);
-
-      // compute sharing
-      if (j < SC_PROOF - 1) {
-        kdf_shake_get_randomness(&kdf, round.input_shares[j], pp->input_size);
-        clear_padding_bits(&round.input_shares[j][pp->input_size - 1], diff);
-        mzd_from_char_array(in_out_shares.s[j], round.input_shares[j], pp->input_size);
-      } else {
-        mzd_share(in_out_shares.s[2], in_out_shares.s[0], in_out_shares.s[1],
-                  context->m_key);
-        mzd_to_char_array(round.input_shares[SC_PROOF - 1], in_out_shares.s[SC_PROOF - 1],
-                          pp->input_size);
-      }
+  picnic_context_t context;
+  sign_state_to_context(state, &context);
+  const uint8_t* salt = state->sig + pp->collapsed_challenge_size;
 
-      // compute random tapes
-      assert(pp->view_size <= MAX_VIEW_SIZE);
-      uint8_t tape_bytes[MAX_VIEW_SIZE];
-      kdf_shake_get_randomness(&kdf, tape_bytes, pp->view_size);
-      decompress_random_tape(rvec, pp, tape_bytes, j);
-      kdf_shake_clear(&kdf);
-    }
+  proof_round_t round = { 0 };
+  for (unsigned int j = 0; j < SC_PROOF; ++j) {
+    kdf_shake_get_randomness(&state->seed_ctx, round.seeds[j], pp->seed_size);
+  }
+  simulate_round(pp, &context, salt, state->round_number, &round,
+                 state->phase != SIGN_PHASE_COMMIT);
 
-    {
-      // perform ZKB++ LowMC evaluation
-      view_t views[MAX_LOWMC_R];
-      lowmc_impl(context->m_plaintext, views, &in_out_shares, rvec);
+  switch (state->phase) {
+  case SIGN_PHASE_COMMIT:
+    H3_process_round_1(pp, &state->h3_ctx, &round);
+    break;
+  case SIGN_PHASE_VIEWS:
+    H3_process_round_2(pp, &state->h3_ctx, &round);
+    break;
+  default:
+    state->sig_pos = serialize_round(pp, &round, state->sig + state->sig_pos,
+                                     state->challenge[state->round_number]) -
+                     state->sig;
+    break;
+  }
 
-      // copy output shares
-      for (unsigned int j = 0; j < SC_PROOF; ++j) {
-        mzd_to_char_array(round.output_shares[j], in_out_shares.s[j], pp->output_size);
-      }
-    }
+  if (++state->round_number < pp->num_rounds) {
+    return 1;
+  }
 
-    H3_process_round_1(pp, &h3_ctx, &round);
+  // reset seed_ctx to reproduce seeds for the next pass
+  state->round_number = 0;
+  kdf_shake_clear(&state->seed_ctx);
+  switch (state->phase) {
+  case SIGN_PHASE_COMMIT:
+    generate_seeds(pp, &context, &state->seed_ctx);
+    state->phase = SIGN_PHASE_VIEWS;
+    break;
+  case SIGN_PHASE_VIEWS:
+    H3_finalize(pp, &state->h3_ctx, salt, &context, state->challenge);
+    hash_clear(&state->h3_ctx);
+    generate_seeds(pp, &context, &state->seed_ctx);
+
+    // write challenge, the salt is already in place
+    collapse_challenge(state->sig, pp, state->challenge);
+    state->sig_pos = pp->collapsed_challenge_size + SALT_SIZE;
+    state->phase   = SIGN_PHASE_PROOF;
+    break;
+  default:
+    state->phase = SIGN_PHASE_DONE;
+    break;
   }
+  return state->phase != SIGN_PHASE_DONE;
+}
 
-  // reset seed_ctx to reproduce seeds
-  kdf_shake_clear(&seed_ctx);
-  generate_seeds(pp, context, &seed_ctx);
+static int sign_finish(sign_state_t* state, size_t* siglen) {
+  const int ret = state->phase == SIGN_PHASE_DONE ? 0 : -1;
+  if (!ret) {
+    *siglen = state->sig_pos;
+  }
+  explicit_bzero(state, sizeof(sign_state_t));
+  return ret;
+}
 
-  for (size_t i = 0; i < num_rounds; ++i) {
-    proof_round_t round = { 0 };
-    in_out_shares_t in_out_shares;
-    rvec_t rvec[MAX_LOWMC_R]; // random tapes for AND-gates
+int impl_sign(const picnic_instance_t* pp, const picnic_context_t* context, uint8_t* sig,
+              size_t* siglen) {
+  sign_state_t state;
+  sign_begin(&state, pp, context, sig);
+  while (sign_step(&state)) {
+  }
+  return sign_finish(&state, siglen);
+}
 
-    for (unsigned int j = 0; j < SC_PROOF; ++j) {
-      kdf_shake_t kdf;
-      kdf_shake_get_randomness(&seed_ctx, round.seeds[j], pp->seed_size);
-      kdf_init_from_seed(&kdf, round.seeds[j], salt, i, j, j != SC_PROOF - 1, pp);
-
-      // compute sharing
-      if (j < SC_PROOF - 1) {
-        kdf_shake_get_randomness(&kdf, round.input_shares[j], pp->input_size);
-        clear_padding_bits(&round.input_shares[j][pp->input_size - 1], diff);
-        mzd_from_char_array(in_out_shares.s[j], round.input_shares[j], pp->input_size);
-      } else {
-        mzd_share(in_out_shares.s[2], in_out_shares.s[0], in_out_shares.s[1],
-                  context->m_key);
-        mzd_to_char_array(round.input_shares[SC_PROOF - 1], in_out_shares.s[SC_PROOF - 1],
-                          pp->input_size);
-      }
+size_t impl_sign_state_size(void) {
+  return sizeof(sign_state_t);
+}
 
-      // compute random tapes
-      assert(pp->view_size <= MAX_VIEW_SIZE);
-      uint8_t tape_bytes[MAX_VIEW_SIZE];
-      kdf_shake_get_randomness(&kdf, tape_bytes, pp->view_size);
-      decompress_random_tape(rvec, pp, tape_bytes, j);
-      kdf_shake_clear(&kdf);
-    }
+void impl_sign_begin(const picnic_instance_t* pp, const picnic_context_t* context, void* state,
+                     uint8_t* sig) {
+  sign_begin(state, pp, context, sig);
+}
 
-    {
-      // perform ZKB++ LowMC evaluation
-      view_t views[MAX_LOWMC_R];
-      lowmc_impl(context->m_plaintext, views, &in_out_shares, rvec);
+int impl_sign_step(void* state) {
+  return sign_step(state);
+}
 
-      // serialize view
-      for (unsigned int j = 0; j < SC_PROOF; ++j) {
-        mzd_to_char_array(round.output_shares[j], in_out_shares.s[j], pp->output_size);
-        compress_view(round.communicated_bits[j], pp, views, j);
-      }
-    }
+int impl_sign_finish(void* state, size_t* siglen) {
+  return sign_finish(state, siglen);
+}
 
-    H3_process_round_2(pp, &h3_ctx, &round);
-  }
-  uint8_t challenge[MAX_NUM_ROUNDS];
-  H3_finalize(pp, &h3_ctx, salt, context, challenge);
-  hash_clear(&h3_ctx);
+static void hash_message(const picnic_instance_t* pp, const picnic_context_t* context,
+                         uint8_t* digest) {
+  hash_context ctx;
+  hash_init(&ctx, pp->digest_size);
+  hash_update(&ctx, context->msg, context->msglen);
+  hash_final(&ctx);
+  hash_squeeze(&ctx, digest, pp->digest_size);
+  hash_clear(&ctx);
+}
 
-  // reset seed_ctx to reproduce seeds
-  kdf_shake_clear(&seed_ctx);
-  generate_seeds(pp, context, &seed_ctx);
+size_t impl_presign_size(void) {
+  return sizeof(presign_t);
+}
 
-  uint8_t* tmp = sig;
+int impl_presign(const picnic_instance_t* pp, const picnic_context_t* context, void* presign,
+                 bool deterministic) {
+  const size_t num_rounds = pp->num_rounds;
+  presign_t* entry        = presign;
 
-  // write challenge
-  collapse_challenge(tmp, pp, challenge);
-  tmp += pp->collapsed_challenge_size;
-  // "write salt"
-  tmp += SALT_SIZE;
+  entry->ready         = 0;
+  entry->deterministic = deterministic;
+  kdf_shake_t seed_ctx;
+  if (deterministic) {
+    // salt and seeds from sk || m || C || p as in impl_sign, so the entry is bound to m
+    hash_message(pp, context, entry->msg_digest);
+    generate_salt(pp, context, &seed_ctx, entry->salt);
+    kdf_shake_clear(&seed_ctx);
+    generate_seeds(pp, context, &seed_ctx);
+  } else if (rand_bits(entry->salt, SALT_SIZE * 8)) {
+    // random salt instead of deriving it from the message
+    return -1;
+  }
 
+  hash_init_prefix(&entry->h3_ctx, pp->digest_size, HASH_PREFIX_1);
+
+  // evaluate every round once, hash the output shares and keep what the signature needs
   for (size_t i = 0; i < num_rounds; ++i) {
-    proof_round_t round = { 0 };
-    in_out_shares_t in_out_shares;
-    rvec_t rvec[MAX_LOWMC_R]; // random tapes for AND-gates
+    presign_round_t* pround = &entry->rounds[i];
+    proof_round_t round     = { 0 };
 
     for (unsigned int j = 0; j < SC_PROOF; ++j) {
-      kdf_shake_t kdf;
-      kdf_shake_get_randomness(&seed_ctx, round.seeds[j], pp->seed_size);
-      kdf_init_from_seed(&kdf, round.seeds[j], salt, i, j, (j != SC_PROOF - 1), pp);
-
-      // compute sharing
-      if (j < SC_PROOF - 1) {
-        kdf_shake_get_randomness(&kdf, round.input_shares[j], pp->input_size);
-        clear_padding_bits(&round.input_shares[j][pp->input_size - 1], diff);
-        mzd_from_char_array(in_out_shares.s[j], round.input_shares[j], pp->input_size);
-      } else {
-        mzd_share(in_out_shares.s[2], in_out_shares.s[0], in_out_shares.s[1],
-                  context->m_key);
-        mzd_to_char_array(round.input_shares[SC_PROOF - 1], in_out_shares.s[SC_PROOF - 1],
-                          pp->input_size);
+      if (deterministic) {
+        kdf_shake_get_randomness(&seed_ctx, round.seeds[j], pp->seed_size);
+      } else if (rand_bits(round.seeds[j], pp->seed_size * 8)) {
+        explicit_bzero(entry, sizeof(presign_t));
+        return -1;
       }
-
-      // compute random tapes
-      assert(pp->view_size <= MAX_VIEW_SIZE);
-      uint8_t tape_bytes[MAX_VIEW_SIZE];
-      kdf_shake_get_randomness(&kdf, tape_bytes, pp->view_size);
-      decompress_random_tape(rvec, pp, tape_bytes, j);
-      kdf_shake_clear(&kdf);
     }
+    simulate_round(pp, context, entry->salt, i, &round, true);
+    H3_process_round_1(pp, &entry->h3_ctx, &round);
 
-    {
-      // perform ZKB++ LowMC evaluation
-      view_t views[MAX_LOWMC_R];
-      lowmc_impl(context->m_plaintext, views, &in_out_shares, rvec);
+    for (unsigned int j = 0; j < SC_PROOF; ++j) {
+      hash_commitment(pp, pround->commitments[j], round.seeds[j], round.input_shares[j],
+                      round.communicated_bits[j], round.output_shares[j]);
+    }
+    memcpy(pround->seeds, round.seeds, sizeof(pround->seeds));
+    memcpy(pround->communicated_bits, round.communicated_bits, sizeof(pround->communicated_bits));
+    memcpy(pround->input_share, round.input_shares[SC_PROOF - 1], pp->input_size);
+    explicit_bzero(&round, sizeof(round));
+  }
 
-      // serializes views
-      for (unsigned int j = 0; j < SC_PROOF; ++j) {
-        mzd_to_char_array(round.output_shares[j], in_out_shares.s[j], pp->output_size);
-        compress_view(round.communicated_bits[j], pp, views, j);
-      }
+  for (size_t i = 0; i < num_rounds; ++i) {
+    for (unsigned int j = 0; j < SC_PROOF; ++j) {
+      hash_update(&entry->h3_ctx, entry->rounds[i].commitments[j], pp->digest_size);
     }
-    tmp = serialize_round(pp, &round, tmp, challenge[i]);
   }
 
-  *siglen = tmp - sig;
+  if (deterministic) {
+    kdf_shake_clear(&seed_ctx);
+  }
+
+  memcpy(entry->public_key, context->public_key, pp->output_size);
+  memcpy(entry->plaintext, context->plaintext, pp->output_size);
+  entry->ready = PRESIGN_READY;
   return 0;
 }
 
+int impl_sign_presigned(const picnic_instance_t* pp, const picnic_context_t* context,
+                        void* presign, uint8_t* sig, size_t* siglen) {
+  const size_t num_rounds = pp->num_rounds;
+  presign_t* entry        = presign;
+
+  // the seeds of a deterministic entry depend on its message: opening them for the challenge of
+  // another message as well would reveal the private key
+  bool message_matches = true;
+  if (entry->ready == PRESIGN_READY && entry->deterministic) {
+    uint8_t msg_digest[MAX_DIGEST_SIZE];
+    hash_message(pp, context, msg_digest);
+    message_matches = !memcmp(entry->msg_digest, msg_digest, pp->digest_size);
+  }
+
+  int ret = -1;
+  if (entry->ready == PRESIGN_READY && message_matches &&
+      !memcmp(entry->public_key, context->public_key, pp->output_size) &&
+      !memcmp(entry->plaintext, context->plaintext, pp->output_size)) {
+    // finish the challenge hash with public key, salt and message
+    uint8_t challenge[MAX_NUM_ROUNDS];
+    H3_finalize(pp, &entry->h3_ctx, entry->salt, context, challenge);
+
+    uint8_t* tmp = sig;
+
+    // write challenge
+    collapse_challenge(tmp, pp, challenge);
+    tmp += pp->collapsed_challenge_size;
+    // write salt
+    memcpy(tmp, entry->salt, SALT_SIZE);
+    tmp += SALT_SIZE;
+
+    for (size_t i = 0; i < num_rounds; ++i) {
+      tmp = serialize_presigned_round(pp, &entry->rounds[i], tmp, challenge[i]);
+    }
+
+    *siglen = tmp - sig;
+    ret     = 0;
+  }
+
+  // entries must never be used twice
+  explicit_bzero(entry, sizeof(presign_t));
+  return ret;
+}
+
 int impl_verify(const picnic_instance_t* pp, const picnic_context_t* context, const uint8_t* sig,
                 size_t siglen) {
   const size_t num_rounds  = pp->num_rounds;
@@ -31,5 +31,21 @@ int impl_sign(const picnic_instance_t* pp, const picnic_context_t* context, uint
 int impl_verify(const picnic_instance_t* pp, const picnic_context_t* context, const uint8_t* sig,
                 size_t siglen);
 
+/* step-wise signing, one ZKB++ round per impl_sign_step; the message and the signature buffer
+ * must stay valid until impl_sign_finish() */
+size_t impl_sign_state_size(void);
+void impl_sign_begin(const picnic_instance_t* pp, const picnic_context_t* context, void* state,
+                     uint8_t* sig);
+int impl_sign_step(void* state);
+int impl_sign_finish(void* state, size_t* siglen);
+
+size_t impl_presign_size(void);
+/* with deterministic, salt and seeds are derived from the private key and context->msg as in
+ * impl_sign, otherwise they are drawn at random */
+int impl_presign(const picnic_instance_t* pp, const picnic_context_t* context, void* presign,
+                 bool deterministic);
+int impl_sign_presigned(const picnic_instance_t* pp, const picnic_context_t* context,
+                        void* presign, uint8_t* sig, size_t* siglen);
+
 
 #endif
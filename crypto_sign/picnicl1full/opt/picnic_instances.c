@@ -37,11 +37,15 @@
   ZKBPP_FNS(lowmc_uint64_lowmc_129_129_4, mpc_lowmc_prove_uint64_lowmc_129_129_4,                  \
             mpc_lowmc_verify_uint64_lowmc_129_129_4, mzd_share_uint64_192)
 #define PICNIC3_L1_FNS NULL_FNS
-#define lowmc_parameters_192_192_4 { 0, 0, 0, 0 }
-#define PICNIC_L3_FULL_FNS NULL_FNS
+#include "lowmc_192_192_4.h"
+#define PICNIC_L3_FULL_FNS                                                                         \
+  ZKBPP_FNS(lowmc_uint64_lowmc_192_192_4, mpc_lowmc_prove_uint64_lowmc_192_192_4,                  \
+            mpc_lowmc_verify_uint64_lowmc_192_192_4, mzd_share_uint64_192)
 #define PICNIC3_L3_FNS NULL_FNS
-#define lowmc_parameters_255_255_4 { 0, 0, 0, 0 }
-#define PICNIC_L5_FULL_FNS NULL_FNS
+#include "lowmc_255_255_4.h"
+#define PICNIC_L5_FULL_FNS                                                                         \
+  ZKBPP_FNS(lowmc_uint64_lowmc_255_255_4, mpc_lowmc_prove_uint64_lowmc_255_255_4,                  \
+            mpc_lowmc_verify_uint64_lowmc_255_255_4, mzd_share_uint64_256)
 #define PICNIC3_L5_FNS NULL_FNS
 
 #include "lowmc_generator.c.i"
@@ -87,6 +91,11 @@ static bool create_instance(picnic_instance_t* pp) {
     return false;
   }
 
+  /* buffers are only sized for the digest and seed sizes of the selected instance */
+  if (pp->digest_size > MAX_DIGEST_SIZE || pp->seed_size > MAX_SEED_SIZE) {
+    return false;
+  }
+
 
   return true;
 }
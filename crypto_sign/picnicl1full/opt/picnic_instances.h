@@ -16,9 +16,17 @@
 
 #define SALT_SIZE 32
 
-/* max digest and seed size */
+/* max digest and seed size (sized for the instance selected in sign.c) */
+#if defined(PICNIC_L5_FULL)
+#define MAX_DIGEST_SIZE 64
+#define MAX_SEED_SIZE 32
+#elif defined(PICNIC_L3_FULL)
+#define MAX_DIGEST_SIZE 48
+#define MAX_SEED_SIZE 24
+#else
 #define MAX_DIGEST_SIZE 32
 #define MAX_SEED_SIZE 16
+#endif
 
 typedef struct picnic_instance_t {
   lowmc_parameters_t lowmc;
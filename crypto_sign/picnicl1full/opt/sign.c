@@ -1,4 +1,10 @@
 #include "api.h"
 
+#if defined(PICNIC_L5_FULL)
+#define PICNIC_INSTANCE Picnic_L5_full
+#elif defined(PICNIC_L3_FULL)
+#define PICNIC_INSTANCE Picnic_L3_full
+#else
 #define PICNIC_INSTANCE Picnic_L1_full
+#endif
 #include "sign.c.i"
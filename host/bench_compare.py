@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+#
+#  This file is part of the optimized implementation of the Picnic signature scheme.
+#  See the accompanying documentation for complete details.
+#
+#  The code is provided under the MIT license, see LICENSE for
+#  more details.
+#  SPDX-License-Identifier: MIT
+#
+# Compares speedtest output (JSON lines, see speedtest.c) against a baseline and prints one row per
+# scheme, implementation, operation and message length with the ratio of the medians.
+#
+# The baseline is either the output of an earlier speedtest run or a pqm4 benchmark table in
+# Markdown (such as bencharmks-gregz-may27.md), whose averages are compared against every message
+# length. pqm4 tables are measured on the Cortex-M4 and only give a rough picture on other hosts.
+#
+# Against a speedtest baseline, exits with 1 if any median is slower than the baseline by more than
+# the threshold. The comparison against a pqm4 table is informational only and always exits with 0.
+#
+# usage: bench_compare.py [-t threshold in percent] baseline current
+
+import argparse
+import json
+import re
+import sys
+
+OPERATIONS = ("keygen", "sign", "verify")
+
+
+def read_json_lines(path):
+    entries = {}
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line.startswith("{"):
+                continue
+            e = json.loads(line)
+            key = (e["scheme"], e["implementation"], e["operation"], e["message_bytes"])
+            entries[key] = e
+    return entries
+
+
+def read_pqm4_table(path):
+    """Returns {(scheme, implementation, operation): average cycles} of the speed table."""
+    entries = {}
+    row = re.compile(r"^\|\s*([\w-]+)\s*\(\d+ executions\)\s*\|\s*([\w-]+)\s*\|(.*)\|\s*$")
+    with open(path) as f:
+        for line in f:
+            m = row.match(line)
+            if not m:
+                continue
+            averages = re.findall(r"AVG:\s*([\d,]+)", m.group(3))
+            if len(averages) != len(OPERATIONS):
+                continue
+            for op, avg in zip(OPERATIONS, averages):
+                entries[(m.group(1), m.group(2), op)] = int(avg.replace(",", ""))
+    return entries
+
+
+def baseline_median(baseline, is_json, e):
+    if is_json:
+        b = baseline.get((e["scheme"], e["implementation"], e["operation"], e["message_bytes"]))
+        return b["median"] if b and b["unit"] == e["unit"] else None
+    # pqm4 tables list some schemes under a "-dev" name
+    for scheme in (e["scheme"], e["scheme"] + "-dev"):
+        b = baseline.get((scheme, e["implementation"], e["operation"]))
+        if b is not None:
+            return b
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare speedtest results against a baseline.")
+    parser.add_argument("-t", "--threshold", type=float, default=5.0,
+                        help="allowed slowdown in percent (default: 5)")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    args = parser.parse_args()
+
+    current = read_json_lines(args.current)
+    is_json = False
+    with open(args.baseline) as f:
+        is_json = any(line.lstrip().startswith("{") for line in f)
+    baseline = read_json_lines(args.baseline) if is_json else read_pqm4_table(args.baseline)
+
+    regressions = 0
+    print("%-14s %-12s %-7s %8s %16s %16s %8s" % ("scheme", "impl", "op", "mlen", "baseline",
+                                                   "current", "ratio"))
+    for key in sorted(current):
+        e = current[key]
+        base = baseline_median(baseline, is_json, e)
+        if not base:
+            print("%-14s %-12s %-7s %8d %16s %16d %8s" % (e["scheme"], e["implementation"],
+                                                          e["operation"], e["message_bytes"], "-",
+                                                          e["median"], "-"))
+            continue
+        ratio = e["median"] / base
+        slower = ratio > 1 + args.threshold / 100
+        regressions += slower
+        print("%-14s %-12s %-7s %8d %16d %16d %7.3f%s" % (e["scheme"], e["implementation"],
+                                                           e["operation"], e["message_bytes"], base,
+                                                           e["median"], ratio,
+                                                           " !" if slower else ""))
+
+    if regressions:
+        print("%d measurement(s) slower than the baseline by more than %g%%" % (regressions,
+                                                                                args.threshold))
+    if not is_json:
+        # host cycles against Cortex-M4 cycles are no basis for a pass or fail
+        print("pqm4 baseline: informational only, not gating")
+        return 0
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,403 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+/* Host-side stack and heap high-water-mark measurement for the crypto_sign API of one variant.
+ *
+ * Every operation runs on a dedicated thread whose stack is painted with a known pattern before
+ * the thread starts. After the thread has finished, the lowest overwritten byte gives the peak
+ * stack usage. The usage of a thread doing nothing is subtracted, so that only the stack used by
+ * the operation itself is reported. Heap usage is tracked by wrapping the allocation functions
+ * with the linker (see the Makefile). */
+
+#include "api.h"
+
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#if !defined(IMPLEMENTATION_NAME)
+#define IMPLEMENTATION_NAME "unknown"
+#endif
+
+#define STACK_PAINT 0xa5
+#define DEFAULT_STACK_SIZE (8 * 1024 * 1024)
+#define DEFAULT_MESSAGE_LENGTH 32
+
+/* Heap tracking */
+
+void* __real_malloc(size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+void* __wrap_malloc(size_t size);
+void* __wrap_calloc(size_t nmemb, size_t size);
+void* __wrap_realloc(void* ptr, size_t size);
+void __wrap_free(void* ptr);
+void* __wrap_aligned_alloc(size_t alignment, size_t size);
+int __wrap_posix_memalign(void** memptr, size_t alignment, size_t size);
+
+/* Memory allocated inside libc (e.g., stdio buffers, strdup) may be released through the wrapped
+ * free, so the header carries a magic value derived from the pointer and untracked pointers are
+ * passed on unchanged. The header fits into the 16 bytes that glibc keeps in front of its own
+ * allocations, so reading it is safe for those as well. */
+typedef struct {
+  void* base;
+  uint32_t size;
+  uint32_t magic;
+} heap_header_t;
+
+#define HEAP_HEADER_SIZE 16
+#define HEAP_MAGIC UINT32_C(0x6d656d74)
+
+static bool heap_tracking;
+static size_t heap_current;
+static size_t heap_peak;
+
+static void* tracked_alloc(size_t alignment, size_t size) {
+  if (alignment < HEAP_HEADER_SIZE) {
+    alignment = HEAP_HEADER_SIZE;
+  }
+  if (size > UINT32_MAX || size > SIZE_MAX - alignment - HEAP_HEADER_SIZE) {
+    return NULL;
+  }
+
+  uint8_t* base = __real_malloc(size + alignment + HEAP_HEADER_SIZE);
+  if (!base) {
+    return NULL;
+  }
+  uintptr_t ptr = ((uintptr_t)base + HEAP_HEADER_SIZE + alignment - 1) & ~(uintptr_t)(alignment - 1);
+  heap_header_t* header = (heap_header_t*)(ptr - HEAP_HEADER_SIZE);
+  header->base          = base;
+  header->size          = (uint32_t)size;
+  header->magic         = HEAP_MAGIC ^ (uint32_t)ptr;
+
+  if (heap_tracking) {
+    heap_current += size;
+    if (heap_current > heap_peak) {
+      heap_peak = heap_current;
+    }
+  }
+  return (void*)ptr;
+}
+
+/* returns the header of ptr, or NULL if ptr was not allocated by tracked_alloc */
+static heap_header_t* tracked_header(void* ptr) {
+  heap_header_t* header = (heap_header_t*)((uint8_t*)ptr - HEAP_HEADER_SIZE);
+  return header->magic == (HEAP_MAGIC ^ (uint32_t)(uintptr_t)ptr) ? header : NULL;
+}
+
+void __wrap_free(void* ptr) {
+  if (!ptr) {
+    return;
+  }
+
+  heap_header_t* header = tracked_header(ptr);
+  if (!header) {
+    __real_free(ptr);
+    return;
+  }
+  header->magic = 0;
+  if (heap_tracking) {
+    heap_current -= header->size < heap_current ? header->size : heap_current;
+  }
+  __real_free(header->base);
+}
+
+void* __wrap_malloc(size_t size) {
+  return tracked_alloc(0, size);
+}
+
+void* __wrap_calloc(size_t nmemb, size_t size) {
+  if (size && nmemb > SIZE_MAX / size) {
+    return NULL;
+  }
+  void* ptr = tracked_alloc(0, nmemb * size);
+  if (ptr) {
+    memset(ptr, 0, nmemb * size);
+  }
+  return ptr;
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+  if (!ptr) {
+    return tracked_alloc(0, size);
+  }
+  const heap_header_t* header = tracked_header(ptr);
+  if (!header) {
+    return __real_realloc(ptr, size);
+  }
+  if (!size) {
+    __wrap_free(ptr);
+    return NULL;
+  }
+
+  void* nptr = tracked_alloc(0, size);
+  if (nptr) {
+    const size_t old_size = header->size;
+    memcpy(nptr, ptr, old_size < size ? old_size : size);
+    __wrap_free(ptr);
+  }
+  return nptr;
+}
+
+void* __wrap_aligned_alloc(size_t alignment, size_t size) {
+  return tracked_alloc(alignment, size);
+}
+
+int __wrap_posix_memalign(void** memptr, size_t alignment, size_t size) {
+  void* ptr = tracked_alloc(alignment, size);
+  if (!ptr) {
+    return ENOMEM;
+  }
+  *memptr = ptr;
+  return 0;
+}
+
+/* Operations */
+
+typedef enum {
+  OP_NOP,
+  OP_KEYGEN,
+  OP_SIGN,
+  OP_VERIFY,
+  OP_SIGN_DETACHED,
+  OP_VERIFY_DETACHED,
+  OP_MAX,
+} operation_t;
+
+static const char* const operation_names[] = {"nop",    "keygen",        "sign",
+                                              "verify", "sign-detached", "verify-detached"};
+
+typedef struct {
+  unsigned char pk[CRYPTO_PUBLICKEYBYTES];
+  unsigned char sk[CRYPTO_SECRETKEYBYTES];
+  unsigned char* m;
+  size_t mlen;
+  unsigned char* sm;
+  size_t smlen;
+  unsigned char* m2;
+  size_t m2len;
+  unsigned char sig[CRYPTO_BYTES];
+  size_t siglen;
+} test_data_t;
+
+typedef struct {
+  operation_t op;
+  test_data_t* data;
+  int ret;
+  uint64_t time_ns;
+} thread_arg_t;
+
+static uint64_t time_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * UINT64_C(1000000000) + (uint64_t)ts.tv_nsec;
+}
+
+static void* run_operation(void* varg) {
+  thread_arg_t* arg  = varg;
+  test_data_t* data  = arg->data;
+  const uint64_t start = time_now();
+
+  switch (arg->op) {
+  case OP_KEYGEN:
+    arg->ret = crypto_sign_keypair(data->pk, data->sk);
+    break;
+  case OP_SIGN:
+    arg->ret = crypto_sign(data->sm, &data->smlen, data->m, data->mlen, data->sk);
+    break;
+  case OP_VERIFY:
+    arg->ret = crypto_sign_open(data->m2, &data->m2len, data->sm, data->smlen, data->pk);
+    if (!arg->ret && (data->m2len != data->mlen || memcmp(data->m, data->m2, data->mlen))) {
+      arg->ret = -1;
+    }
+    break;
+  case OP_SIGN_DETACHED:
+    arg->ret = crypto_sign_signature(data->sig, &data->siglen, data->m, data->mlen, data->sk);
+    break;
+  case OP_VERIFY_DETACHED:
+    arg->ret = crypto_sign_verify(data->sig, data->siglen, data->m, data->mlen, data->pk);
+    break;
+  default:
+    arg->ret = 0;
+    break;
+  }
+
+  arg->time_ns = time_now() - start;
+  return NULL;
+}
+
+typedef struct {
+  size_t stack;
+  size_t heap;
+  uint64_t time_ns;
+} measurement_t;
+
+/* Runs one operation on a painted stack and measures its peak stack and heap usage. */
+static int measure(uint8_t* stack, size_t stack_size, operation_t op, test_data_t* data,
+                   measurement_t* result) {
+  memset(stack, STACK_PAINT, stack_size);
+
+  pthread_attr_t attr;
+  if (pthread_attr_init(&attr) || pthread_attr_setstack(&attr, stack, stack_size)) {
+    return -1;
+  }
+
+  thread_arg_t arg = {op, data, -1, 0};
+  pthread_t thread;
+
+  heap_current  = 0;
+  heap_peak     = 0;
+  heap_tracking = true;
+  int ret = pthread_create(&thread, &attr, run_operation, &arg);
+  if (!ret) {
+    ret = pthread_join(thread, NULL);
+  }
+  heap_tracking = false;
+  pthread_attr_destroy(&attr);
+  if (ret) {
+    return -1;
+  }
+
+  /* the stack grows downwards: find the lowest byte that was overwritten */
+  size_t untouched = 0;
+  while (untouched < stack_size && stack[untouched] == STACK_PAINT) {
+    ++untouched;
+  }
+
+  result->stack   = stack_size - untouched;
+  result->heap    = heap_peak;
+  result->time_ns = arg.time_ns;
+  return arg.ret;
+}
+
+static void print_usage(const char* arg0) {
+  printf("usage: %s [-i iterations] [-l message length] [-s stack size] [-H]\n", arg0);
+}
+
+static bool parse_size(size_t* value, const char* arg) {
+  char* end  = NULL;
+  errno      = 0;
+  const unsigned long long v = strtoull(arg, &end, 10);
+  if (errno || !end || *end || v > SIZE_MAX) {
+    return false;
+  }
+  *value = v;
+  return true;
+}
+
+int main(int argc, char** argv) {
+  size_t iter       = 1;
+  size_t mlen       = DEFAULT_MESSAGE_LENGTH;
+  size_t stack_size = DEFAULT_STACK_SIZE;
+  bool header       = false;
+
+  int c = -1;
+  while ((c = getopt(argc, argv, "i:l:s:H")) != -1) {
+    switch (c) {
+    case 'i':
+      if (!parse_size(&iter, optarg) || !iter) {
+        print_usage(argv[0]);
+        return -1;
+      }
+      break;
+    case 'l':
+      if (!parse_size(&mlen, optarg)) {
+        print_usage(argv[0]);
+        return -1;
+      }
+      break;
+    case 's':
+      if (!parse_size(&stack_size, optarg)) {
+        print_usage(argv[0]);
+        return -1;
+      }
+      break;
+    case 'H':
+      header = true;
+      break;
+    default:
+      print_usage(argv[0]);
+      return -1;
+    }
+  }
+
+  uint8_t* stack = mmap(NULL, stack_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                        -1, 0);
+  test_data_t data;
+  memset(&data, 0, sizeof(data));
+  data.mlen = mlen;
+  data.m    = malloc(mlen ? mlen : 1);
+  data.m2   = malloc(mlen + CRYPTO_BYTES);
+  data.sm   = malloc(mlen + CRYPTO_BYTES);
+  if (stack == MAP_FAILED || !data.m || !data.m2 || !data.sm) {
+    printf("Failed to allocate memory.\n");
+    return -1;
+  }
+  for (size_t i = 0; i < mlen; ++i) {
+    data.m[i] = (unsigned char)i;
+  }
+
+  /* stack used by the thread itself, e.g., for thread-local storage */
+  measurement_t baseline;
+  if (measure(stack, stack_size, OP_NOP, &data, &baseline)) {
+    printf("Failed to run measurement thread.\n");
+    return -1;
+  }
+
+  measurement_t peak[OP_MAX];
+  uint64_t total_time[OP_MAX];
+  memset(peak, 0, sizeof(peak));
+  memset(total_time, 0, sizeof(total_time));
+
+  int ret = 0;
+  for (size_t i = 0; i < iter && !ret; ++i) {
+    for (operation_t op = OP_KEYGEN; op < OP_MAX; ++op) {
+      measurement_t m;
+      if (measure(stack, stack_size, op, &data, &m)) {
+        printf("%s failed.\n", operation_names[op]);
+        ret = -1;
+        break;
+      }
+      m.stack = m.stack > baseline.stack ? m.stack - baseline.stack : 0;
+      if (m.stack > peak[op].stack) {
+        peak[op].stack = m.stack;
+      }
+      if (m.heap > peak[op].heap) {
+        peak[op].heap = m.heap;
+      }
+      total_time[op] += m.time_ns;
+    }
+  }
+
+  if (!ret) {
+    if (header) {
+      printf("scheme,implementation,operation,stack [bytes],heap [bytes],time [us]\n");
+    }
+    for (operation_t op = OP_KEYGEN; op < OP_MAX; ++op) {
+      printf("%s,%s,%s,%zu,%zu,%" PRIu64 "\n", CRYPTO_ALGNAME, IMPLEMENTATION_NAME,
+             operation_names[op], peak[op].stack, peak[op].heap,
+             total_time[op] / iter / UINT64_C(1000));
+    }
+  }
+
+  free(data.sm);
+  free(data.m2);
+  free(data.m);
+  munmap(stack, stack_size);
+  return ret;
+}
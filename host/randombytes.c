@@ -0,0 +1,28 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+/* randombytes for host builds of the variants that expect it from the pqm4 framework */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/random.h>
+
+void randombytes(uint8_t* x, size_t xlen);
+
+void randombytes(uint8_t* x, size_t xlen) {
+  while (xlen) {
+    const ssize_t ret = getrandom(x, xlen, 0);
+    if (ret < 0) {
+      abort();
+    }
+    x += ret;
+    xlen -= (size_t)ret;
+  }
+}
@@ -0,0 +1,720 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+/* Local signing daemon built on the Picnic3 library of picnic3l1/opt.
+ *
+ * The daemon listens on a Unix stream socket (see signd_proto.h for the protocol) and holds
+ * prepared key pairs: private keys are read and validated once at start-up and their public keys
+ * are derived then, so that clients neither parse keys nor start with cold caches. Every
+ * connection is served by its own thread, which queues the signing and verification requests and
+ * waits for their completion. A pool of worker threads takes the queued requests in batches:
+ * signing requests for the same key are signed together with picnic_sign_batch, which parses the
+ * key once per batch; verification requests are taken together to save queue round trips. If
+ * fewer requests than the batch size are queued, a worker waits up to the batch window for more.
+ *
+ * For signing and verification, the daemon counts requests and errors and keeps a histogram of
+ * the latencies from queueing to completion. SIGND_OP_STATS returns them together with the
+ * throughput and the mean batch size; they are also printed on SIGINT and SIGTERM.
+ *
+ * usage: signd [-s socket] [-k private key file]... [-g keys] [-w workers] [-b batch size]
+ *              [-t batch window in us] [-c verify cache capacity] [-m max message length] */
+
+#include "picnic.h"
+#include "signd_proto.h"
+
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#define PARAMETER_SET Picnic3_L1
+#define MAX_KEYS 64
+#define MAX_CONNECTIONS 256
+/* bucket i counts latencies below 2^i microseconds */
+#define LATENCY_BUCKETS 32
+
+/* metrics of the queued operations */
+#define METRICS_SIGN 0
+#define METRICS_VERIFY 1
+
+typedef struct {
+  picnic_privatekey_t sk;
+  picnic_publickey_t pk;
+} prepared_key_t;
+
+typedef struct job_s {
+  uint32_t op;
+  uint32_t key;
+  const uint8_t* msg;
+  size_t msg_len;
+  /* signature to verify, or buffer of signature_size bytes for the signature */
+  uint8_t* sig;
+  size_t sig_len;
+  int status;
+  bool done;
+  uint64_t queued;
+  /* signalled with queue_lock held once done is set */
+  pthread_cond_t cond;
+  struct job_s* next;
+} job_t;
+
+typedef struct {
+  uint64_t requests;
+  uint64_t errors;
+  uint64_t latency_sum;
+  uint64_t latency_hist[LATENCY_BUCKETS];
+} op_metrics_t;
+
+/* arguments of picnic_sign_batch, one set per worker */
+typedef struct {
+  job_t** jobs;
+  const uint8_t** messages;
+  size_t* message_lens;
+  uint8_t** signatures;
+  size_t* signature_lens;
+  int* statuses;
+} batch_t;
+
+static struct {
+  const char* socket_path;
+  unsigned int workers;
+  unsigned int batch_size;
+  unsigned int batch_window;
+  size_t verify_cache;
+  size_t max_message_len;
+} config = {SIGND_DEFAULT_SOCKET, 0, 8, 200, 0, 1 << 20};
+
+static prepared_key_t keys[MAX_KEYS];
+static size_t num_keys;
+static size_t signature_size;
+
+static pthread_mutex_t queue_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t queue_cond  = PTHREAD_COND_INITIALIZER;
+static job_t* queue_head;
+static job_t** queue_tail = &queue_head;
+static size_t queue_len;
+static bool stopping;
+
+static pthread_mutex_t metrics_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct {
+  op_metrics_t ops[2];
+  uint64_t batches;
+  uint64_t batched_jobs;
+  /* malformed requests and requests for unknown keys */
+  uint64_t rejected;
+  uint64_t connections;
+  uint64_t active_connections;
+  uint64_t start;
+} metrics;
+
+static volatile sig_atomic_t terminate;
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * UINT64_C(1000000000) + (uint64_t)ts.tv_nsec;
+}
+
+/* Metrics */
+
+static void record_jobs(job_t* const* jobs, size_t count) {
+  const uint64_t now = now_ns();
+
+  pthread_mutex_lock(&metrics_lock);
+  ++metrics.batches;
+  metrics.batched_jobs += count;
+  for (size_t i = 0; i < count; ++i) {
+    op_metrics_t* m =
+        &metrics.ops[jobs[i]->op == SIGND_OP_SIGN ? METRICS_SIGN : METRICS_VERIFY];
+    const uint64_t latency = now - jobs[i]->queued;
+    unsigned int bucket    = 0;
+    while (bucket < LATENCY_BUCKETS - 1 && (latency / 1000) >> bucket) {
+      ++bucket;
+    }
+
+    ++m->requests;
+    m->errors += jobs[i]->status != 0;
+    m->latency_sum += latency;
+    ++m->latency_hist[bucket];
+  }
+  pthread_mutex_unlock(&metrics_lock);
+}
+
+/* upper bound of the latency percentile in microseconds */
+static uint64_t latency_percentile(const op_metrics_t* m, unsigned int percent) {
+  uint64_t count = 0;
+  for (unsigned int i = 0; i < LATENCY_BUCKETS; ++i) {
+    count += m->latency_hist[i];
+    if (count * 100 >= m->requests * percent) {
+      return UINT64_C(1) << i;
+    }
+  }
+  return UINT64_C(1) << (LATENCY_BUCKETS - 1);
+}
+
+static int format_stats(char* buf, size_t len) {
+  static const char* const names[] = {"sign", "verify"};
+
+  pthread_mutex_lock(&metrics_lock);
+  const double uptime = (double)(now_ns() - metrics.start) / 1e9;
+  int pos = snprintf(buf, len,
+                     "uptime_s=%.3f connections=%" PRIu64 " active_connections=%" PRIu64
+                     " rejected=%" PRIu64 " batches=%" PRIu64 " mean_batch=%.2f\n",
+                     uptime, metrics.connections, metrics.active_connections, metrics.rejected,
+                     metrics.batches,
+                     metrics.batches ? (double)metrics.batched_jobs / metrics.batches : 0.0);
+  for (unsigned int i = 0; i < 2 && pos >= 0 && (size_t)pos < len; ++i) {
+    const op_metrics_t* m = &metrics.ops[i];
+    pos += snprintf(buf + pos, len - pos,
+                    "%s requests=%" PRIu64 " errors=%" PRIu64 " throughput=%.2f/s mean_us=%.1f"
+                    " p50_us<=%" PRIu64 " p99_us<=%" PRIu64 "\n",
+                    names[i], m->requests, m->errors, uptime > 0 ? m->requests / uptime : 0.0,
+                    m->requests ? (double)m->latency_sum / m->requests / 1000 : 0.0,
+                    m->requests ? latency_percentile(m, 50) : 0,
+                    m->requests ? latency_percentile(m, 99) : 0);
+  }
+  pthread_mutex_unlock(&metrics_lock);
+
+  picnic_verify_cache_stats_t cache;
+  if (pos >= 0 && (size_t)pos < len && !picnic_verify_cache_stats(&cache) && cache.capacity) {
+    pos += snprintf(buf + pos, len - pos,
+                    "verify_cache hits=%" PRIu64 " misses=%" PRIu64 " entries=%zu capacity=%zu\n",
+                    cache.hits, cache.misses, cache.entries, cache.capacity);
+  }
+
+  if (pos < 0) {
+    return -1;
+  }
+  return (size_t)pos < len ? pos : (int)len - 1;
+}
+
+/* Queue and workers */
+
+static void submit_and_wait(job_t* job) {
+  pthread_mutex_lock(&queue_lock);
+  job->done   = false;
+  job->next   = NULL;
+  job->queued = now_ns();
+  *queue_tail = job;
+  queue_tail  = &job->next;
+  ++queue_len;
+  /* wakes idle workers as well as a worker waiting for its batch to fill up */
+  pthread_cond_broadcast(&queue_cond);
+  while (!job->done) {
+    pthread_cond_wait(&job->cond, &queue_lock);
+  }
+  pthread_mutex_unlock(&queue_lock);
+}
+
+/* Removes the first queued job and up to batch_size - 1 further jobs that can be processed with it:
+ * verification requests, or signing requests for the same key. queue_lock is held. */
+static size_t dequeue_batch(job_t** jobs) {
+  const job_t* first = queue_head;
+  size_t count       = 0;
+
+  job_t** link = &queue_head;
+  while (*link && count < config.batch_size) {
+    job_t* job = *link;
+    if (job == first ||
+        (job->op == first->op && (job->op != SIGND_OP_SIGN || job->key == first->key))) {
+      *link         = job->next;
+      jobs[count++] = job;
+      --queue_len;
+    } else {
+      link = &job->next;
+    }
+  }
+
+  queue_tail = &queue_head;
+  while (*queue_tail) {
+    queue_tail = &(*queue_tail)->next;
+  }
+  return count;
+}
+
+static void run_batch(batch_t* batch, size_t count) {
+  job_t** jobs = batch->jobs;
+
+  if (jobs[0]->op == SIGND_OP_SIGN) {
+    const picnic_privatekey_t* sk = &keys[jobs[0]->key].sk;
+    for (size_t i = 0; i < count; ++i) {
+      batch->messages[i]       = jobs[i]->msg;
+      batch->message_lens[i]   = jobs[i]->msg_len;
+      batch->signatures[i]     = jobs[i]->sig;
+      batch->signature_lens[i] = signature_size;
+    }
+
+    /* failing requests are reported through their status, the others are signed */
+    picnic_sign_batch(sk, batch->messages, batch->message_lens, batch->signatures,
+                      batch->signature_lens, batch->statuses, count);
+    for (size_t i = 0; i < count; ++i) {
+      jobs[i]->status  = batch->statuses[i];
+      jobs[i]->sig_len = batch->signature_lens[i];
+    }
+  } else {
+    for (size_t i = 0; i < count; ++i) {
+      jobs[i]->status = picnic_verify(&keys[jobs[i]->key].pk, jobs[i]->msg, jobs[i]->msg_len,
+                                      jobs[i]->sig, jobs[i]->sig_len)
+                            ? -1
+                            : 0;
+    }
+  }
+
+  record_jobs(jobs, count);
+}
+
+static void batch_free(batch_t* batch) {
+  free(batch->jobs);
+  free(batch->messages);
+  free(batch->message_lens);
+  free(batch->signatures);
+  free(batch->signature_lens);
+  free(batch->statuses);
+}
+
+static void* worker(void* arg) {
+  (void)arg;
+
+  batch_t batch;
+  batch.jobs           = calloc(config.batch_size, sizeof(*batch.jobs));
+  batch.messages       = calloc(config.batch_size, sizeof(*batch.messages));
+  batch.message_lens   = calloc(config.batch_size, sizeof(*batch.message_lens));
+  batch.signatures     = calloc(config.batch_size, sizeof(*batch.signatures));
+  batch.signature_lens = calloc(config.batch_size, sizeof(*batch.signature_lens));
+  batch.statuses       = calloc(config.batch_size, sizeof(*batch.statuses));
+  if (!batch.jobs || !batch.messages || !batch.message_lens || !batch.signatures ||
+      !batch.signature_lens || !batch.statuses) {
+    fprintf(stderr, "signd: failed to allocate worker memory\n");
+    batch_free(&batch);
+    return NULL;
+  }
+
+  pthread_mutex_lock(&queue_lock);
+  for (;;) {
+    while (!stopping && !queue_head) {
+      pthread_cond_wait(&queue_cond, &queue_lock);
+    }
+    if (!queue_head) {
+      /* stopping and the queue is drained */
+      break;
+    }
+
+    if (queue_len < config.batch_size && config.batch_window && !stopping) {
+      struct timespec deadline;
+      clock_gettime(CLOCK_REALTIME, &deadline);
+      deadline.tv_nsec += (long)config.batch_window * 1000;
+      deadline.tv_sec += deadline.tv_nsec / 1000000000;
+      deadline.tv_nsec %= 1000000000;
+      while (!stopping && queue_head && queue_len < config.batch_size) {
+        if (pthread_cond_timedwait(&queue_cond, &queue_lock, &deadline) == ETIMEDOUT) {
+          break;
+        }
+      }
+      if (!queue_head) {
+        /* taken by another worker */
+        continue;
+      }
+    }
+
+    const size_t count = dequeue_batch(batch.jobs);
+    pthread_mutex_unlock(&queue_lock);
+
+    run_batch(&batch, count);
+
+    pthread_mutex_lock(&queue_lock);
+    for (size_t i = 0; i < count; ++i) {
+      batch.jobs[i]->done = true;
+      pthread_cond_signal(&batch.jobs[i]->cond);
+    }
+  }
+  pthread_mutex_unlock(&queue_lock);
+
+  batch_free(&batch);
+  return NULL;
+}
+
+/* Connections */
+
+static void reject(void) {
+  pthread_mutex_lock(&metrics_lock);
+  ++metrics.rejected;
+  pthread_mutex_unlock(&metrics_lock);
+}
+
+static void* connection(void* arg) {
+  const int fd = (int)(intptr_t)arg;
+
+  job_t job;
+  pthread_cond_init(&job.cond, NULL);
+  uint8_t* sig     = malloc(signature_size);
+  uint8_t* msg     = NULL;
+  size_t msg_alloc = 0;
+
+  uint8_t header[SIGND_REQUEST_HEADER_SIZE];
+  while (sig && !signd_read_all(fd, header, sizeof(header))) {
+    signd_request_t request;
+    signd_decode_request(&request, header);
+    if (request.msg_len > config.max_message_len || request.sig_len > signature_size) {
+      /* cannot be skipped safely, so the connection is closed */
+      reject();
+      break;
+    }
+
+    if (request.msg_len > msg_alloc) {
+      uint8_t* tmp = realloc(msg, request.msg_len);
+      if (!tmp) {
+        break;
+      }
+      msg       = tmp;
+      msg_alloc = request.msg_len;
+    }
+    if ((request.msg_len && signd_read_all(fd, msg, request.msg_len)) ||
+        (request.sig_len && signd_read_all(fd, sig, request.sig_len))) {
+      break;
+    }
+
+    signd_response_t response = {-1, 0};
+    const uint8_t* payload    = NULL;
+    uint8_t pk[PICNIC_MAX_PUBLICKEY_SIZE];
+    char stats[1024];
+
+    switch (request.op) {
+    case SIGND_OP_SIGN:
+    case SIGND_OP_VERIFY:
+      if (request.key >= num_keys || (request.op == SIGND_OP_VERIFY && !request.sig_len)) {
+        reject();
+        break;
+      }
+      job.op      = request.op;
+      job.key     = request.key;
+      job.msg     = msg;
+      job.msg_len = request.msg_len;
+      job.sig     = sig;
+      job.sig_len = request.sig_len;
+      submit_and_wait(&job);
+
+      response.status = job.status;
+      if (request.op == SIGND_OP_SIGN && !job.status) {
+        payload      = sig;
+        response.len = job.sig_len;
+      }
+      break;
+
+    case SIGND_OP_PUBLIC_KEY: {
+      const int ret =
+          request.key < num_keys ? picnic_write_public_key(&keys[request.key].pk, pk, sizeof(pk))
+                                 : -1;
+      if (ret <= 0) {
+        reject();
+        break;
+      }
+      response.status = 0;
+      response.len    = ret;
+      payload         = pk;
+      break;
+    }
+
+    case SIGND_OP_STATS: {
+      const int ret = format_stats(stats, sizeof(stats));
+      if (ret >= 0) {
+        response.status = 0;
+        response.len    = ret;
+        payload         = (const uint8_t*)stats;
+      }
+      break;
+    }
+
+    default:
+      reject();
+      break;
+    }
+
+    uint8_t response_header[SIGND_RESPONSE_HEADER_SIZE];
+    signd_encode_response(response_header, &response);
+    if (signd_write_all(fd, response_header, sizeof(response_header)) ||
+        (response.len && signd_write_all(fd, payload, response.len))) {
+      break;
+    }
+  }
+
+  close(fd);
+  free(msg);
+  free(sig);
+  pthread_cond_destroy(&job.cond);
+
+  pthread_mutex_lock(&metrics_lock);
+  --metrics.active_connections;
+  pthread_mutex_unlock(&metrics_lock);
+  return NULL;
+}
+
+static void accept_connection(int listen_fd) {
+  const int fd = accept(listen_fd, NULL, NULL);
+  if (fd < 0) {
+    return;
+  }
+
+  pthread_mutex_lock(&metrics_lock);
+  const bool accepted = metrics.active_connections < MAX_CONNECTIONS;
+  if (accepted) {
+    ++metrics.connections;
+    ++metrics.active_connections;
+  }
+  pthread_mutex_unlock(&metrics_lock);
+  if (!accepted) {
+    close(fd);
+    return;
+  }
+
+  pthread_attr_t attr;
+  pthread_t thread;
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+  if (pthread_create(&thread, &attr, connection, (void*)(intptr_t)fd)) {
+    close(fd);
+    pthread_mutex_lock(&metrics_lock);
+    --metrics.active_connections;
+    pthread_mutex_unlock(&metrics_lock);
+  }
+  pthread_attr_destroy(&attr);
+}
+
+/* Start-up */
+
+static int add_key(const picnic_privatekey_t* sk) {
+  if (num_keys == MAX_KEYS) {
+    fprintf(stderr, "signd: at most %d keys are supported\n", MAX_KEYS);
+    return -1;
+  }
+
+  prepared_key_t* key = &keys[num_keys];
+  key->sk             = *sk;
+  if (picnic_sk_to_pk(&key->sk, &key->pk) || picnic_validate_keypair(&key->sk, &key->pk)) {
+    fprintf(stderr, "signd: invalid private key\n");
+    return -1;
+  }
+  ++num_keys;
+  return 0;
+}
+
+static int load_key(const char* path) {
+  uint8_t buf[PICNIC_MAX_PRIVATEKEY_SIZE + 1];
+  FILE* f = fopen(path, "rb");
+  if (!f) {
+    fprintf(stderr, "signd: cannot open %s: %s\n", path, strerror(errno));
+    return -1;
+  }
+  const size_t len = fread(buf, 1, sizeof(buf), f);
+  fclose(f);
+
+  picnic_privatekey_t sk;
+  const int ret = len < sizeof(buf) && !picnic_read_private_key(&sk, buf, len) ? add_key(&sk) : -1;
+  if (ret) {
+    fprintf(stderr, "signd: cannot read private key from %s\n", path);
+  }
+  picnic_clear_private_key(&sk);
+  memset(buf, 0, sizeof(buf));
+  return ret;
+}
+
+static int generate_keys(unsigned long count) {
+  for (unsigned long i = 0; i < count; ++i) {
+    picnic_publickey_t pk;
+    picnic_privatekey_t sk;
+    if (picnic_keygen(PARAMETER_SET, &pk, &sk) || add_key(&sk)) {
+      picnic_clear_private_key(&sk);
+      return -1;
+    }
+    picnic_clear_private_key(&sk);
+  }
+  return 0;
+}
+
+static int open_socket(const char* path) {
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen(path) >= sizeof(addr.sun_path)) {
+    fprintf(stderr, "signd: socket path too long\n");
+    return -1;
+  }
+  strcpy(addr.sun_path, path);
+
+  /* replace the socket of a previous instance, but nothing else */
+  struct stat st;
+  if (!lstat(path, &st)) {
+    if (!S_ISSOCK(st.st_mode)) {
+      fprintf(stderr, "signd: %s exists and is not a socket\n", path);
+      return -1;
+    }
+    unlink(path);
+  }
+
+  const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    perror("signd: socket");
+    return -1;
+  }
+  /* only accessible by the user running the daemon */
+  const mode_t mask = umask(077);
+  const int ret     = bind(fd, (const struct sockaddr*)&addr, sizeof(addr));
+  umask(mask);
+  if (ret || listen(fd, 64)) {
+    perror("signd: bind");
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+static void handle_signal(int sig) {
+  (void)sig;
+  terminate = 1;
+}
+
+static void usage(const char* arg0) {
+  fprintf(stderr,
+          "usage: %s [-s socket] [-k private key file]... [-g keys] [-w workers] [-b batch size]\n"
+          "       [-t batch window in us] [-c verify cache capacity] [-m max message length]\n",
+          arg0);
+}
+
+int main(int argc, char** argv) {
+  unsigned long generate = 0;
+  int c;
+  while ((c = getopt(argc, argv, "s:k:g:w:b:t:c:m:h")) != -1) {
+    switch (c) {
+    case 's':
+      config.socket_path = optarg;
+      break;
+    case 'k':
+      if (load_key(optarg)) {
+        return 1;
+      }
+      break;
+    case 'g':
+      generate = strtoul(optarg, NULL, 10);
+      break;
+    case 'w':
+      config.workers = strtoul(optarg, NULL, 10);
+      break;
+    case 'b':
+      config.batch_size = strtoul(optarg, NULL, 10);
+      break;
+    case 't':
+      config.batch_window = strtoul(optarg, NULL, 10);
+      break;
+    case 'c':
+      config.verify_cache = strtoul(optarg, NULL, 10);
+      break;
+    case 'm':
+      config.max_message_len = strtoul(optarg, NULL, 10);
+      break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (optind != argc || !config.batch_size || config.batch_window >= 1000000) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  /* also initializes the parameter set before any worker runs */
+  if (generate_keys(generate)) {
+    return 1;
+  }
+  if (!num_keys) {
+    fprintf(stderr, "signd: no keys, use -k or -g\n");
+    return 1;
+  }
+  signature_size = picnic_signature_size(PARAMETER_SET);
+
+  if (config.verify_cache && picnic_verify_cache_init(config.verify_cache)) {
+    fprintf(stderr, "signd: verification cache not available, the library needs to be built "
+                    "with PICNIC_VERIFY_CACHE\n");
+  }
+
+  if (!config.workers) {
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    config.workers  = cpus > 0 ? cpus : 1;
+  }
+
+  const int listen_fd = open_socket(config.socket_path);
+  if (listen_fd < 0) {
+    return 1;
+  }
+
+  struct sigaction act;
+  memset(&act, 0, sizeof(act));
+  act.sa_handler = handle_signal;
+  sigaction(SIGINT, &act, NULL);
+  sigaction(SIGTERM, &act, NULL);
+  signal(SIGPIPE, SIG_IGN);
+
+  metrics.start      = now_ns();
+  pthread_t* workers = calloc(config.workers, sizeof(*workers));
+  unsigned int started = 0;
+  while (workers && started < config.workers &&
+         !pthread_create(&workers[started], NULL, worker, NULL)) {
+    ++started;
+  }
+  if (!started) {
+    fprintf(stderr, "signd: failed to start workers\n");
+    free(workers);
+    close(listen_fd);
+    unlink(config.socket_path);
+    return 1;
+  }
+
+  fprintf(stderr, "signd: listening on %s with %zu key(s), %u worker(s), batches of %u\n",
+          config.socket_path, num_keys, started, config.batch_size);
+
+  while (!terminate) {
+    struct pollfd pfd = {listen_fd, POLLIN, 0};
+    if (poll(&pfd, 1, 500) > 0) {
+      accept_connection(listen_fd);
+    }
+  }
+
+  close(listen_fd);
+  unlink(config.socket_path);
+
+  /* the workers finish the queued requests */
+  pthread_mutex_lock(&queue_lock);
+  stopping = true;
+  pthread_cond_broadcast(&queue_cond);
+  pthread_mutex_unlock(&queue_lock);
+  for (unsigned int i = 0; i < started; ++i) {
+    pthread_join(workers[i], NULL);
+  }
+  free(workers);
+
+  char stats[1024];
+  if (format_stats(stats, sizeof(stats)) >= 0) {
+    fputs(stats, stderr);
+  }
+
+  for (size_t i = 0; i < num_keys; ++i) {
+    picnic_clear_private_key(&keys[i].sk);
+  }
+  return 0;
+}
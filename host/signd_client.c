@@ -0,0 +1,319 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+/* Client and load generator for the local signing daemon (signd.c).
+ *
+ * Each of the connections runs in its own thread and sends its share of the requests one after
+ * another: signing requests for distinct messages, verification requests for one signature
+ * obtained from the daemon, or both alternately. The first signature of every connection is also
+ * verified locally against the public key returned by the daemon. The client prints the
+ * throughput and the latency percentiles seen by the clients, followed by the metrics of the
+ * daemon. With -S, only the metrics of the daemon are printed.
+ *
+ * usage: signd_client [-s socket] [-o sign|verify|mixed] [-n requests] [-c connections]
+ *                     [-l message length] [-k key] [-S] */
+
+#include "picnic.h"
+#include "signd_proto.h"
+
+#include <getopt.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAX_CONNECTIONS 256
+
+typedef enum { LOAD_SIGN, LOAD_VERIFY, LOAD_MIXED } load_t;
+
+static struct {
+  const char* socket_path;
+  load_t load;
+  unsigned long requests;
+  unsigned int connections;
+  size_t message_len;
+  uint32_t key;
+} config = {SIGND_DEFAULT_SOCKET, LOAD_SIGN, 100, 4, 32, 0};
+
+typedef struct {
+  unsigned int id;
+  unsigned long requests;
+  /* latencies in ns */
+  uint64_t* latencies;
+  unsigned long completed;
+  unsigned long errors;
+  bool failed;
+} client_t;
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * UINT64_C(1000000000) + (uint64_t)ts.tv_nsec;
+}
+
+static int connect_daemon(void) {
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen(config.socket_path) >= sizeof(addr.sun_path)) {
+    return -1;
+  }
+  strcpy(addr.sun_path, config.socket_path);
+
+  const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return -1;
+  }
+  if (connect(fd, (const struct sockaddr*)&addr, sizeof(addr))) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/* Sends one request and reads the response into out (of out_len bytes). Returns -1 if the
+ * connection failed, otherwise sets *len to the payload length and returns the status. */
+static int call(int fd, uint32_t op, const uint8_t* msg, size_t msg_len, const uint8_t* sig,
+                size_t sig_len, uint8_t* out, size_t out_len, size_t* len) {
+  const signd_request_t request = {op, config.key, msg_len, sig_len};
+  uint8_t header[SIGND_REQUEST_HEADER_SIZE];
+  signd_encode_request(header, &request);
+  if (signd_write_all(fd, header, sizeof(header)) ||
+      (msg_len && signd_write_all(fd, msg, msg_len)) ||
+      (sig_len && signd_write_all(fd, sig, sig_len))) {
+    return -1;
+  }
+
+  uint8_t response_header[SIGND_RESPONSE_HEADER_SIZE];
+  signd_response_t response;
+  if (signd_read_all(fd, response_header, sizeof(response_header))) {
+    return -1;
+  }
+  signd_decode_response(&response, response_header);
+  if (response.len > out_len || (response.len && signd_read_all(fd, out, response.len))) {
+    return -1;
+  }
+
+  *len = response.len;
+  return response.status ? 1 : 0;
+}
+
+static void* run_client(void* arg) {
+  client_t* client = arg;
+  client->failed   = true;
+
+  const size_t max_sig_len = picnic_signature_size(Picnic3_L1);
+  uint8_t* msg             = calloc(config.message_len ? config.message_len : 1, 1);
+  uint8_t* sig             = malloc(max_sig_len);
+  uint8_t* verify_sig      = malloc(max_sig_len);
+  size_t verify_sig_len    = 0;
+  uint8_t* verify_msg      = calloc(config.message_len ? config.message_len : 1, 1);
+  const int fd             = connect_daemon();
+  if (!msg || !sig || !verify_sig || !verify_msg || fd < 0) {
+    fprintf(stderr, "client %u: cannot connect to %s\n", client->id, config.socket_path);
+    goto out;
+  }
+
+  /* the signatures are checked locally once */
+  uint8_t pk_buf[PICNIC_MAX_PUBLICKEY_SIZE];
+  size_t len = 0;
+  picnic_publickey_t pk;
+  if (call(fd, SIGND_OP_PUBLIC_KEY, NULL, 0, NULL, 0, pk_buf, sizeof(pk_buf), &len) ||
+      picnic_read_public_key(&pk, pk_buf, len)) {
+    fprintf(stderr, "client %u: cannot get public key %" PRIu32 "\n", client->id, config.key);
+    goto out;
+  }
+
+  /* a signature to verify */
+  memcpy(verify_msg, &client->id, config.message_len < sizeof(client->id) ? config.message_len
+                                                                          : sizeof(client->id));
+  if (call(fd, SIGND_OP_SIGN, verify_msg, config.message_len, NULL, 0, verify_sig, max_sig_len,
+           &verify_sig_len) ||
+      picnic_verify(&pk, verify_msg, config.message_len, verify_sig, verify_sig_len)) {
+    fprintf(stderr, "client %u: signature of the daemon does not verify\n", client->id);
+    goto out;
+  }
+
+  for (unsigned long i = 0; i < client->requests; ++i) {
+    const bool sign = config.load == LOAD_SIGN || (config.load == LOAD_MIXED && !(i % 2));
+    int ret;
+
+    const uint64_t start = now_ns();
+    if (sign) {
+      /* distinct messages, so that every signature is computed */
+      const uint64_t tag = ((uint64_t)client->id << 32) | i;
+      memcpy(msg, &tag, config.message_len < sizeof(tag) ? config.message_len : sizeof(tag));
+      ret = call(fd, SIGND_OP_SIGN, msg, config.message_len, NULL, 0, sig, max_sig_len, &len);
+    } else {
+      ret = call(fd, SIGND_OP_VERIFY, verify_msg, config.message_len, verify_sig, verify_sig_len,
+                 sig, max_sig_len, &len);
+    }
+    if (ret < 0) {
+      fprintf(stderr, "client %u: connection failed\n", client->id);
+      goto out;
+    }
+    client->latencies[client->completed++] = now_ns() - start;
+    client->errors += ret != 0;
+  }
+  client->failed = false;
+
+out:
+  if (fd >= 0) {
+    close(fd);
+  }
+  free(verify_msg);
+  free(verify_sig);
+  free(sig);
+  free(msg);
+  return NULL;
+}
+
+static int print_daemon_stats(void) {
+  char stats[4096];
+  size_t len   = 0;
+  const int fd = connect_daemon();
+  if (fd < 0 || call(fd, SIGND_OP_STATS, NULL, 0, NULL, 0, (uint8_t*)stats, sizeof(stats) - 1,
+                     &len)) {
+    fprintf(stderr, "cannot get the metrics of the daemon at %s\n", config.socket_path);
+    if (fd >= 0) {
+      close(fd);
+    }
+    return -1;
+  }
+  close(fd);
+
+  stats[len] = '\0';
+  printf("daemon: %s", stats);
+  return 0;
+}
+
+static int compare_uint64(const void* a, const void* b) {
+  const uint64_t x = *(const uint64_t*)a;
+  const uint64_t y = *(const uint64_t*)b;
+  return (x > y) - (x < y);
+}
+
+static void usage(const char* arg0) {
+  fprintf(stderr,
+          "usage: %s [-s socket] [-o sign|verify|mixed] [-n requests] [-c connections]\n"
+          "       [-l message length] [-k key] [-S]\n",
+          arg0);
+}
+
+int main(int argc, char** argv) {
+  bool stats_only = false;
+  int c;
+  while ((c = getopt(argc, argv, "s:o:n:c:l:k:Sh")) != -1) {
+    switch (c) {
+    case 's':
+      config.socket_path = optarg;
+      break;
+    case 'o':
+      if (!strcmp(optarg, "sign")) {
+        config.load = LOAD_SIGN;
+      } else if (!strcmp(optarg, "verify")) {
+        config.load = LOAD_VERIFY;
+      } else if (!strcmp(optarg, "mixed")) {
+        config.load = LOAD_MIXED;
+      } else {
+        usage(argv[0]);
+        return 1;
+      }
+      break;
+    case 'n':
+      config.requests = strtoul(optarg, NULL, 10);
+      break;
+    case 'c':
+      config.connections = strtoul(optarg, NULL, 10);
+      break;
+    case 'l':
+      config.message_len = strtoul(optarg, NULL, 10);
+      break;
+    case 'k':
+      config.key = strtoul(optarg, NULL, 10);
+      break;
+    case 'S':
+      stats_only = true;
+      break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (optind != argc || !config.connections || config.connections > MAX_CONNECTIONS) {
+    usage(argv[0]);
+    return 1;
+  }
+  if (stats_only) {
+    return print_daemon_stats() ? 1 : 0;
+  }
+
+  client_t* clients  = calloc(config.connections, sizeof(*clients));
+  pthread_t* threads = calloc(config.connections, sizeof(*threads));
+  uint64_t* latencies = calloc(config.requests ? config.requests : 1, sizeof(*latencies));
+  if (!clients || !threads || !latencies) {
+    fprintf(stderr, "failed to allocate memory\n");
+    return 1;
+  }
+
+  /* every client records its latencies into its own part of latencies */
+  unsigned long offset = 0;
+  for (unsigned int i = 0; i < config.connections; ++i) {
+    clients[i].id = i;
+    clients[i].requests =
+        config.requests / config.connections + (i < config.requests % config.connections);
+    clients[i].latencies = latencies + offset;
+    offset += clients[i].requests;
+  }
+
+  const uint64_t start = now_ns();
+  unsigned int started = 0;
+  while (started < config.connections &&
+         !pthread_create(&threads[started], NULL, run_client, &clients[started])) {
+    ++started;
+  }
+  for (unsigned int i = 0; i < started; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  const double elapsed = (double)(now_ns() - start) / 1e9;
+
+  /* gather the recorded latencies at the front */
+  unsigned long completed = 0, errors = 0;
+  bool failed             = started != config.connections;
+  for (unsigned int i = 0; i < started; ++i) {
+    memmove(latencies + completed, clients[i].latencies, clients[i].completed * sizeof(*latencies));
+    completed += clients[i].completed;
+    errors += clients[i].errors;
+    failed |= clients[i].failed;
+  }
+  qsort(latencies, completed, sizeof(*latencies), compare_uint64);
+
+  static const char* const loads[] = {"sign", "verify", "mixed"};
+  printf("load=%s connections=%u requests=%lu errors=%lu elapsed_s=%.3f throughput=%.2f/s\n",
+         loads[config.load], config.connections, completed, errors, elapsed,
+         elapsed > 0 ? completed / elapsed : 0.0);
+  if (completed) {
+    printf("latency_us p50=%.1f p90=%.1f p99=%.1f max=%.1f\n", latencies[completed / 2] / 1e3,
+           latencies[completed * 9 / 10] / 1e3, latencies[completed * 99 / 100] / 1e3,
+           latencies[completed - 1] / 1e3);
+  }
+  const int stats_ret = print_daemon_stats();
+
+  free(latencies);
+  free(threads);
+  free(clients);
+  return failed || errors || stats_ret ? 1 : 0;
+}
@@ -0,0 +1,122 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+#ifndef SIGND_PROTO_H
+#define SIGND_PROTO_H
+
+/* Protocol of the local signing daemon (signd.c) on its Unix stream socket.
+ *
+ * A request is a 16-byte header (op, key, msg_len, sig_len) followed by msg_len message bytes and
+ * sig_len signature bytes; a response is an 8-byte header (status, len) followed by len bytes.
+ * All header fields are 32-bit little-endian. Requests on one connection are answered in order;
+ * clients use several connections for concurrent requests.
+ *
+ * - SIGND_OP_SIGN: sign the message with key; the response holds the signature.
+ * - SIGND_OP_VERIFY: verify the signature of the message under the public key of key.
+ * - SIGND_OP_PUBLIC_KEY: the response holds the serialized public key of key.
+ * - SIGND_OP_STATS: the response holds the metrics of the daemon as text.
+ *
+ * status is 0 on success and -1 otherwise, e.g., for an invalid signature or unknown key. */
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#define SIGND_OP_SIGN 1
+#define SIGND_OP_VERIFY 2
+#define SIGND_OP_PUBLIC_KEY 3
+#define SIGND_OP_STATS 4
+
+#define SIGND_REQUEST_HEADER_SIZE 16
+#define SIGND_RESPONSE_HEADER_SIZE 8
+
+#define SIGND_DEFAULT_SOCKET "picnic-signd.sock"
+
+typedef struct {
+  uint32_t op;
+  uint32_t key;
+  uint32_t msg_len;
+  uint32_t sig_len;
+} signd_request_t;
+
+typedef struct {
+  int32_t status;
+  uint32_t len;
+} signd_response_t;
+
+static inline void signd_store_u32(uint8_t* dst, uint32_t value) {
+  for (unsigned int i = 0; i < 4; ++i) {
+    dst[i] = (uint8_t)(value >> (8 * i));
+  }
+}
+
+static inline uint32_t signd_load_u32(const uint8_t* src) {
+  return (uint32_t)src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) |
+         ((uint32_t)src[3] << 24);
+}
+
+static inline void signd_encode_request(uint8_t* dst, const signd_request_t* request) {
+  signd_store_u32(dst, request->op);
+  signd_store_u32(dst + 4, request->key);
+  signd_store_u32(dst + 8, request->msg_len);
+  signd_store_u32(dst + 12, request->sig_len);
+}
+
+static inline void signd_decode_request(signd_request_t* request, const uint8_t* src) {
+  request->op      = signd_load_u32(src);
+  request->key     = signd_load_u32(src + 4);
+  request->msg_len = signd_load_u32(src + 8);
+  request->sig_len = signd_load_u32(src + 12);
+}
+
+static inline void signd_encode_response(uint8_t* dst, const signd_response_t* response) {
+  signd_store_u32(dst, (uint32_t)response->status);
+  signd_store_u32(dst + 4, response->len);
+}
+
+static inline void signd_decode_response(signd_response_t* response, const uint8_t* src) {
+  response->status = (int32_t)signd_load_u32(src);
+  response->len    = signd_load_u32(src + 4);
+}
+
+/* Read exactly len bytes. Returns -1 on errors and if the peer closed the connection. */
+static inline int signd_read_all(int fd, void* buf, size_t len) {
+  uint8_t* ptr = buf;
+  while (len) {
+    const ssize_t ret = read(fd, ptr, len);
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    if (ret <= 0) {
+      return -1;
+    }
+    ptr += ret;
+    len -= (size_t)ret;
+  }
+  return 0;
+}
+
+static inline int signd_write_all(int fd, const void* buf, size_t len) {
+  const uint8_t* ptr = buf;
+  while (len) {
+    const ssize_t ret = write(fd, ptr, len);
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    if (ret <= 0) {
+      return -1;
+    }
+    ptr += ret;
+    len -= (size_t)ret;
+  }
+  return 0;
+}
+
+#endif
@@ -0,0 +1,318 @@
+/*
+ *  This file is part of the optimized implementation of the Picnic signature scheme.
+ *  See the accompanying documentation for complete details.
+ *
+ *  The code is provided under the MIT license, see LICENSE for
+ *  more details.
+ *  SPDX-License-Identifier: MIT
+ */
+
+/* Host-side speed measurement for the crypto_sign API of one variant.
+ *
+ * Key generation, signing and verification are timed separately. Signing and verification use one
+ * fixed key pair, and verification one fixed signature per message length, so that only the
+ * operation itself is measured. Every measurement starts with warm-up runs that are discarded.
+ * For each operation and message length, one JSON object is printed per line with the median,
+ * 90th and 99th percentile, and cycles per message byte; see bench_compare.py for comparing the
+ * output against a baseline. */
+
+#include "api.h"
+
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if !defined(SCHEME_NAME)
+#define SCHEME_NAME CRYPTO_ALGNAME
+#endif
+#if !defined(IMPLEMENTATION_NAME)
+#define IMPLEMENTATION_NAME "unknown"
+#endif
+
+#define DEFAULT_ITERATIONS 20
+#define DEFAULT_WARMUP 2
+#define DEFAULT_MESSAGE_LENGTH 32
+#define MAX_MESSAGE_LENGTHS 16
+
+/* Timing: cycle counter if available, nanoseconds otherwise */
+
+#if defined(__x86_64__) || defined(__i386__)
+#define TIME_UNIT "cycles"
+
+static uint64_t time_now(void) {
+  return __rdtsc();
+}
+#else
+#define TIME_UNIT "ns"
+
+static uint64_t time_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * UINT64_C(1000000000) + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+/* Operations */
+
+typedef enum {
+  OP_KEYGEN,
+  OP_SIGN,
+  OP_VERIFY,
+  OP_MAX,
+} operation_t;
+
+static const char* const operation_names[] = {"keygen", "sign", "verify"};
+
+typedef struct {
+  unsigned char pk[CRYPTO_PUBLICKEYBYTES];
+  unsigned char sk[CRYPTO_SECRETKEYBYTES];
+  unsigned char* m;
+  size_t mlen;
+  unsigned char* sm;
+  size_t smlen;
+  unsigned char* m2;
+  size_t m2len;
+} test_data_t;
+
+static int run_operation(operation_t op, test_data_t* data) {
+  switch (op) {
+  case OP_KEYGEN: {
+    /* keep the fixed key pair intact */
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES];
+    unsigned char sk[CRYPTO_SECRETKEYBYTES];
+    return crypto_sign_keypair(pk, sk);
+  }
+  case OP_SIGN:
+    return crypto_sign(data->sm, &data->smlen, data->m, data->mlen, data->sk);
+  case OP_VERIFY: {
+    int ret = crypto_sign_open(data->m2, &data->m2len, data->sm, data->smlen, data->pk);
+    if (!ret && (data->m2len != data->mlen || memcmp(data->m, data->m2, data->mlen))) {
+      ret = -1;
+    }
+    return ret;
+  }
+  default:
+    return -1;
+  }
+}
+
+/* Statistics */
+
+static int compare_uint64(const void* a, const void* b) {
+  const uint64_t x = *(const uint64_t*)a;
+  const uint64_t y = *(const uint64_t*)b;
+  return (x > y) - (x < y);
+}
+
+/* nearest-rank percentile of sorted samples */
+static uint64_t percentile(const uint64_t* sorted, size_t n, unsigned int p) {
+  size_t rank = (n * p + 99) / 100;
+  return sorted[rank ? rank - 1 : 0];
+}
+
+static uint64_t median(const uint64_t* sorted, size_t n) {
+  return n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+}
+
+static void print_result(operation_t op, size_t mlen, size_t warmup, uint64_t* samples, size_t n) {
+  qsort(samples, n, sizeof(*samples), compare_uint64);
+
+  uint64_t sum = 0;
+  for (size_t i = 0; i < n; ++i) {
+    sum += samples[i];
+  }
+  const uint64_t med = median(samples, n);
+
+  printf("{\"scheme\": \"%s\", \"algname\": \"%s\", \"implementation\": \"%s\", "
+         "\"operation\": \"%s\", \"message_bytes\": %zu, \"iterations\": %zu, \"warmup\": %zu, "
+         "\"unit\": \"%s\", \"median\": %" PRIu64 ", \"p90\": %" PRIu64 ", \"p99\": %" PRIu64
+         ", \"min\": %" PRIu64 ", \"max\": %" PRIu64 ", \"mean\": %" PRIu64,
+         SCHEME_NAME, CRYPTO_ALGNAME, IMPLEMENTATION_NAME, operation_names[op], mlen, n, warmup,
+         TIME_UNIT, med, percentile(samples, n, 90), percentile(samples, n, 99), samples[0],
+         samples[n - 1], sum / n);
+  if (op != OP_KEYGEN && mlen) {
+    printf(", \"%s_per_byte\": %.2f", TIME_UNIT, (double)med / mlen);
+  } else {
+    printf(", \"%s_per_byte\": null", TIME_UNIT);
+  }
+  printf("}\n");
+}
+
+/* Runs warm-up and timed iterations of one operation. */
+static int measure(operation_t op, test_data_t* data, size_t iter, size_t warmup,
+                   uint64_t* samples) {
+  for (size_t i = 0; i < warmup; ++i) {
+    if (run_operation(op, data)) {
+      return -1;
+    }
+  }
+
+  for (size_t i = 0; i < iter; ++i) {
+    const uint64_t start = time_now();
+    const int ret        = run_operation(op, data);
+    samples[i]           = time_now() - start;
+    if (ret) {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+static void print_usage(const char* arg0) {
+  printf("usage: %s [-i iterations] [-w warm-up iterations] [-l message length[,...]] "
+         "[-o keygen|sign|verify[,...]]\n",
+         arg0);
+}
+
+static bool parse_size(size_t* value, const char* arg) {
+  char* end  = NULL;
+  errno      = 0;
+  const unsigned long long v = strtoull(arg, &end, 10);
+  if (errno || !end || *end || v > SIZE_MAX) {
+    return false;
+  }
+  *value = v;
+  return true;
+}
+
+static bool parse_sizes(size_t* values, size_t* count, char* arg) {
+  *count = 0;
+  for (char* tok = strtok(arg, ","); tok; tok = strtok(NULL, ",")) {
+    if (*count == MAX_MESSAGE_LENGTHS || !parse_size(&values[*count], tok)) {
+      return false;
+    }
+    ++*count;
+  }
+  return *count != 0;
+}
+
+static bool parse_operations(bool* ops, char* arg) {
+  memset(ops, 0, sizeof(bool) * OP_MAX);
+  for (char* tok = strtok(arg, ","); tok; tok = strtok(NULL, ",")) {
+    operation_t op = OP_KEYGEN;
+    while (op < OP_MAX && strcmp(tok, operation_names[op])) {
+      ++op;
+    }
+    if (op == OP_MAX) {
+      return false;
+    }
+    ops[op] = true;
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  size_t iter   = DEFAULT_ITERATIONS;
+  size_t warmup = DEFAULT_WARMUP;
+  size_t mlens[MAX_MESSAGE_LENGTHS] = {DEFAULT_MESSAGE_LENGTH};
+  size_t num_mlens = 1;
+  bool ops[OP_MAX] = {true, true, true};
+
+  int c = -1;
+  while ((c = getopt(argc, argv, "i:w:l:o:")) != -1) {
+    switch (c) {
+    case 'i':
+      if (!parse_size(&iter, optarg) || !iter) {
+        print_usage(argv[0]);
+        return -1;
+      }
+      break;
+    case 'w':
+      if (!parse_size(&warmup, optarg)) {
+        print_usage(argv[0]);
+        return -1;
+      }
+      break;
+    case 'l':
+      if (!parse_sizes(mlens, &num_mlens, optarg)) {
+        print_usage(argv[0]);
+        return -1;
+      }
+      break;
+    case 'o':
+      if (!parse_operations(ops, optarg)) {
+        print_usage(argv[0]);
+        return -1;
+      }
+      break;
+    default:
+      print_usage(argv[0]);
+      return -1;
+    }
+  }
+
+  size_t max_mlen = 0;
+  for (size_t i = 0; i < num_mlens; ++i) {
+    if (mlens[i] > max_mlen) {
+      max_mlen = mlens[i];
+    }
+  }
+
+  test_data_t data;
+  memset(&data, 0, sizeof(data));
+  data.m         = malloc(max_mlen ? max_mlen : 1);
+  data.m2        = malloc(max_mlen + CRYPTO_BYTES);
+  data.sm        = malloc(max_mlen + CRYPTO_BYTES);
+  uint64_t* samples = calloc(iter, sizeof(uint64_t));
+  if (!data.m || !data.m2 || !data.sm || !samples) {
+    printf("Failed to allocate memory.\n");
+    return -1;
+  }
+  for (size_t i = 0; i < max_mlen; ++i) {
+    data.m[i] = (unsigned char)i;
+  }
+
+  int ret = crypto_sign_keypair(data.pk, data.sk);
+  if (ret) {
+    printf("keygen failed.\n");
+  }
+
+  if (!ret && ops[OP_KEYGEN]) {
+    if (measure(OP_KEYGEN, &data, iter, warmup, samples)) {
+      printf("keygen failed.\n");
+      ret = -1;
+    } else {
+      print_result(OP_KEYGEN, 0, warmup, samples, iter);
+    }
+  }
+
+  for (size_t l = 0; l < num_mlens && !ret; ++l) {
+    data.mlen = mlens[l];
+
+    /* the fixed signature for verification */
+    if (crypto_sign(data.sm, &data.smlen, data.m, data.mlen, data.sk)) {
+      printf("sign failed.\n");
+      ret = -1;
+      break;
+    }
+
+    for (operation_t op = OP_SIGN; op < OP_MAX; ++op) {
+      if (!ops[op]) {
+        continue;
+      }
+      if (measure(op, &data, iter, warmup, samples)) {
+        printf("%s failed.\n", operation_names[op]);
+        ret = -1;
+        break;
+      }
+      print_result(op, data.mlen, warmup, samples, iter);
+    }
+  }
+
+  free(samples);
+  free(data.sm);
+  free(data.m2);
+  free(data.m);
+  return ret;
+}